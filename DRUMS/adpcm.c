@@ -0,0 +1,115 @@
+#include "adpcm.h"
+
+static const int16_t adpcm_step_table[89] = {
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230,
+    253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963,
+    1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
+    3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487,
+    12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+};
+
+static const int8_t adpcm_index_table[16] = {
+    -1, -1, -1, -1, 2, 4, 6, 8,
+    -1, -1, -1, -1, 2, 4, 6, 8
+};
+
+// Load the state stored at the top of a block
+static void adpcm_load_block(adpcm_state_t *state, const uint8_t *block) {
+    state->predictor = (int16_t)(block[0] | (block[1] << 8));
+    state->step_index = block[2] > 88 ? 88 : block[2];
+}
+
+static inline int16_t adpcm_decode_nibble(adpcm_state_t *state, uint8_t code) {
+    int32_t step = adpcm_step_table[state->step_index];
+
+    // diff = (code + 0.5) * step / 4, done with shifts
+    int32_t diff = step >> 3;
+    if (code & 4) {
+        diff += step;
+    }
+    if (code & 2) {
+        diff += step >> 1;
+    }
+    if (code & 1) {
+        diff += step >> 2;
+    }
+
+    int32_t predictor = state->predictor;
+    if (code & 8) {
+        predictor -= diff;
+    } else {
+        predictor += diff;
+    }
+    if (predictor < -32768) {
+        predictor = -32768;
+    } else if (predictor > 32767) {
+        predictor = 32767;
+    }
+    state->predictor = predictor;
+
+    int32_t index = state->step_index + adpcm_index_table[code];
+    if (index < 0) {
+        index = 0;
+    } else if (index > 88) {
+        index = 88;
+    }
+    state->step_index = index;
+
+    return (int16_t)predictor;
+}
+
+void adpcm_seek(adpcm_state_t *state, const uint8_t *data, uint32_t position) {
+    uint32_t block = position / ADPCM_BLOCK_SAMPLES;
+    uint32_t offset = position % ADPCM_BLOCK_SAMPLES;
+
+    adpcm_load_block(state, data + block * ADPCM_BLOCK_BYTES);
+
+    // anything part way into a block has to be decoded up to there
+    if (offset > 0) {
+        int16_t skipped[ADPCM_BLOCK_SAMPLES];
+        adpcm_decode(state, data, block * ADPCM_BLOCK_SAMPLES, skipped, offset);
+    }
+}
+
+void adpcm_decode_block(adpcm_state_t *state, const uint8_t *block, uint32_t offset, int16_t *out, uint32_t count) {
+    // the header of each block has the exact state, picking it up stops errors building up
+    if (offset == 0) {
+        adpcm_load_block(state, block);
+    }
+
+    const uint8_t *nibbles = block + ADPCM_BLOCK_HEADER + offset / 2;
+    uint32_t i = 0;
+
+    // odd start, finish off the high half of the byte first
+    if (offset & 1) {
+        *out++ = adpcm_decode_nibble(state, *nibbles++ >> 4);
+        i++;
+    }
+    // then two samples per byte
+    for (; i + 1 < count; i += 2) {
+        uint8_t byte = *nibbles++;
+        *out++ = adpcm_decode_nibble(state, byte & 0x0f);
+        *out++ = adpcm_decode_nibble(state, byte >> 4);
+    }
+    if (i < count) {
+        *out++ = adpcm_decode_nibble(state, *nibbles & 0x0f);
+    }
+}
+
+void adpcm_decode(adpcm_state_t *state, const uint8_t *data, uint32_t position, int16_t *out, uint32_t count) {
+    while (count > 0) {
+        uint32_t offset = position % ADPCM_BLOCK_SAMPLES;
+        const uint8_t *block = data + (position / ADPCM_BLOCK_SAMPLES) * ADPCM_BLOCK_BYTES;
+
+        uint32_t run = ADPCM_BLOCK_SAMPLES - offset;
+        if (run > count) {
+            run = count;
+        }
+        adpcm_decode_block(state, block, offset, out, run);
+
+        out += run;
+        position += run;
+        count -= run;
+    }
+}
@@ -0,0 +1,35 @@
+#ifndef ADPCM_H
+#define ADPCM_H
+
+#include <stdint.h>
+
+// IMA ADPCM decoding for the compressed sound clips, 4 bits per sample.
+// The data is split into blocks that each start with the decoder state, so we
+// can start decoding at any block without going through the whole clip.
+// The layout has to match song_conversion/song_converter.py --adpcm
+
+#define ADPCM_BLOCK_SAMPLES 256
+#define ADPCM_BLOCK_HEADER 4    // int16 predictor, uint8 step index, uint8 unused
+#define ADPCM_BLOCK_BYTES (ADPCM_BLOCK_HEADER + ADPCM_BLOCK_SAMPLES / 2)
+
+typedef struct {
+    int32_t predictor;   // last decoded sample
+    int32_t step_index;  // position in the step size table
+} adpcm_state_t;
+
+// Bytes needed to hold a clip of length samples
+#define ADPCM_BYTES_FOR(length) \
+    ((((length) + ADPCM_BLOCK_SAMPLES - 1) / ADPCM_BLOCK_SAMPLES) * ADPCM_BLOCK_BYTES)
+
+// Get the state ready so the next sample decoded is sample number position
+void adpcm_seek(adpcm_state_t *state, const uint8_t *data, uint32_t position);
+
+// Decode count samples starting at position into out. state has to be the one
+// left by adpcm_seek or the previous decode ending at position
+void adpcm_decode(adpcm_state_t *state, const uint8_t *data, uint32_t position, int16_t *out, uint32_t count);
+
+// Same but for count samples from offset inside one block, offset + count has to
+// stay within ADPCM_BLOCK_SAMPLES. For when the block has been copied somewhere else
+void adpcm_decode_block(adpcm_state_t *state, const uint8_t *block, uint32_t offset, int16_t *out, uint32_t count);
+
+#endif // ADPCM_H
@@ -0,0 +1,210 @@
+#include "audio_out.h"
+#include "mixer.h"
+#include "hardware/pwm.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "hardware/clocks.h"
+#include "hardware/gpio.h"
+#include "hardware/structs/systick.h"
+
+// ping pong buffers, one is being played by the DMA while we refill the other
+static uint16_t audio_buffers[2][AUDIO_BLOCK_SIZE];
+static int audio_dma_channels[2];
+static uint audio_slice;
+static audio_render_fn audio_render;
+static audio_profile_t audio_profile;
+static uint audio_pin;
+static dma_channel_config audio_dma_configs[2];
+static uint16_t audio_wrap;  // PWM counts per sample, see audio_out_wrap_for
+
+// parking, see audio_out_park
+#define AUDIO_PARK_WRAP 256  // at div 1 thats over 100 kHz even at a quarter of 125 MHz
+static volatile bool audio_parked;
+static volatile bool audio_waking;     // first block after a resume still to come
+static uint32_t audio_wake_start;
+static audio_wake_stats_t audio_wake_stats;
+
+// SysTick counts down from 2^24 at the system clock, it is per core so it has to
+// be started on the core that runs the DMA interrupt
+#define AUDIO_SYSTICK_MASK 0x00FFFFFFu
+
+// DMA finished one of the buffers, the chained channel is already playing the other one
+static void __isr __time_critical_func(audio_dma_isr)(void) {
+    for (int i = 0; i < 2; i++) {
+        uint channel = audio_dma_channels[i];
+
+        if (dma_channel_get_irq0_status(channel)) {
+            uint32_t start = systick_hw->cvr;
+            dma_channel_acknowledge_irq0(channel);
+
+            // whatever the other buffer has left to play is how long we have to fill this one
+            uint other = audio_dma_channels[i ^ 1];
+            uint32_t slack = dma_channel_is_busy(other) ? dma_hw->ch[other].transfer_count : 0;
+
+            // point it back at the start of its buffer, it gets started again by the chain.
+            // the count too, the first block after a resume is cut short
+            dma_channel_set_read_addr(channel, audio_buffers[i], false);
+            dma_channel_set_trans_count(channel, AUDIO_BLOCK_SIZE, false);
+            audio_render(audio_buffers[i], AUDIO_BLOCK_SIZE);
+
+            if (audio_waking) {
+                uint32_t wake_us = time_us_32() - audio_wake_start;
+                audio_wake_stats.last_wake_us = wake_us;
+                if (wake_us > audio_wake_stats.max_wake_us) {
+                    audio_wake_stats.max_wake_us = wake_us;
+                }
+                audio_waking = false;
+            }
+
+            // if the chain has already started this one again it played a half finished block
+            bool overrun = dma_channel_is_busy(channel);
+            uint32_t cycles = (start - systick_hw->cvr) & AUDIO_SYSTICK_MASK;
+            audio_profile_record(&audio_profile, cycles, slack, overrun);
+        }
+    }
+}
+
+// Both buffers back to silence
+static void audio_out_silence(void) {
+    for (int i = 0; i < 2; i++) {
+        for (int s = 0; s < AUDIO_BLOCK_SIZE; s++) {
+            audio_buffers[i][s] = audio_wrap / 2;
+        }
+    }
+}
+
+void audio_out_init(uint pin, audio_render_fn render) {
+    audio_render = render;
+    audio_pin = pin;
+
+    // set the pin to be able to do PWM
+    // https://electronics.stackexchange.com/questions/729277/what-is-slicing-in-pwm
+    gpio_set_function(pin, GPIO_FUNC_PWM);
+    audio_slice = pwm_gpio_to_slice_num(pin);
+
+    // the PWM wraps once per sample, so the wrap is our sample clock
+    audio_wrap = audio_out_wrap_for(clock_get_hz(clk_sys));
+    pwm_config config = pwm_get_default_config();
+    pwm_config_set_clkdiv_int(&config, 1);
+    pwm_config_set_wrap(&config, audio_wrap - 1);
+    pwm_init(audio_slice, &config, false);
+
+    // Set initial PWM level to middle (silence), and start both buffers silent too
+    pwm_set_gpio_level(pin, audio_wrap / 2);
+    audio_out_silence();
+
+    for (int i = 0; i < 2; i++) {
+        audio_dma_channels[i] = dma_claim_unused_channel(true);
+    }
+
+    for (int i = 0; i < 2; i++) {
+        // one 16 bit level per PWM wrap into the compare register, then hand over to the other channel.
+        // 16 bit writes get copied into both halves of CC, the unused channel doesnt care
+        dma_channel_config c = dma_channel_get_default_config(audio_dma_channels[i]);
+        channel_config_set_transfer_data_size(&c, DMA_SIZE_16);
+        channel_config_set_read_increment(&c, true);
+        channel_config_set_write_increment(&c, false);
+        channel_config_set_dreq(&c, pwm_get_dreq(audio_slice));
+        channel_config_set_chain_to(&c, audio_dma_channels[i ^ 1]);
+        audio_dma_configs[i] = c;
+
+        dma_channel_configure(audio_dma_channels[i], &c,
+                              &pwm_hw->slice[audio_slice].cc,
+                              audio_buffers[i],
+                              AUDIO_BLOCK_SIZE,
+                              false);
+        dma_channel_set_irq0_enabled(audio_dma_channels[i], true);
+    }
+
+    // free running cycle counter for the profile, one block is a lot less than 2^24 cycles
+    systick_hw->csr = 0;
+    systick_hw->rvr = AUDIO_SYSTICK_MASK;
+    systick_hw->cvr = 0;
+    systick_hw->csr = M0PLUS_SYST_CSR_CLKSOURCE_BITS | M0PLUS_SYST_CSR_ENABLE_BITS;
+
+    // a block has to be rendered in the time the other one takes to play, the PWM
+    // counts every cycle and wraps once per sample
+    uint32_t cycles_per_block = (uint32_t)AUDIO_BLOCK_SIZE * audio_wrap;
+    audio_profile_init(&audio_profile, cycles_per_block, AUDIO_BLOCK_SIZE);
+
+    irq_set_exclusive_handler(DMA_IRQ_0, audio_dma_isr);
+    irq_set_enabled(DMA_IRQ_0, true);
+
+    dma_channel_start(audio_dma_channels[0]);
+    pwm_set_enabled(audio_slice, true);
+}
+
+void audio_out_profile(audio_profile_stats_t *stats) {
+    audio_profile_snapshot(&audio_profile, stats);
+}
+
+void audio_out_profile_reset(void) {
+    audio_profile_request_reset(&audio_profile);
+}
+
+uint32_t audio_out_sample_rate(void) {
+    return (clock_get_hz(clk_sys) + audio_wrap / 2) / audio_wrap;
+}
+
+uint16_t audio_out_wrap(void) {
+    return audio_wrap;
+}
+
+void audio_out_park(void) {
+    // take the chaining off first, aborting a chained channel can start the other one
+    for (int i = 0; i < 2; i++) {
+        dma_channel_config c = audio_dma_configs[i];
+        channel_config_set_chain_to(&c, audio_dma_channels[i]);
+        dma_channel_set_config(audio_dma_channels[i], &c, false);
+    }
+    // the abort can raise the interrupt as well, so keep it off until its cleared.
+    // (with audio on core1 a block might still be rendering, it just never gets played)
+    for (int i = 0; i < 2; i++) {
+        dma_channel_set_irq0_enabled(audio_dma_channels[i], false);
+        dma_channel_abort(audio_dma_channels[i]);
+        dma_channel_acknowledge_irq0(audio_dma_channels[i]);
+        dma_channel_set_irq0_enabled(audio_dma_channels[i], true);
+    }
+
+    // midpoint on a short fast wrap, the same level as silence
+    pwm_set_clkdiv_int_frac(audio_slice, 1, 0);
+    pwm_set_wrap(audio_slice, AUDIO_PARK_WRAP - 1);
+    pwm_set_gpio_level(audio_pin, AUDIO_PARK_WRAP / 2);
+
+    audio_wake_stats.parks++;
+    audio_parked = true;
+}
+
+void audio_out_resume(uint32_t since) {
+    if (!audio_parked) {
+        return;
+    }
+
+    // the clock might not be the one we started on, the wrap goes with it
+    audio_wrap = audio_out_wrap_for(clock_get_hz(clk_sys));
+    pwm_set_clkdiv_int_frac(audio_slice, 1, 0);
+    pwm_set_wrap(audio_slice, audio_wrap - 1);
+    pwm_set_gpio_level(audio_pin, audio_wrap / 2);
+    audio_out_silence();
+
+    // channel 0 only plays one sample, so the interrupt comes straight away and
+    // renders the first real block while channel 1 plays its silence
+    for (int i = 0; i < 2; i++) {
+        dma_channel_configure(audio_dma_channels[i], &audio_dma_configs[i],
+                              &pwm_hw->slice[audio_slice].cc, audio_buffers[i], AUDIO_BLOCK_SIZE, false);
+    }
+    dma_channel_set_trans_count(audio_dma_channels[0], 1, false);
+
+    audio_wake_start = since;
+    audio_waking = true;
+    audio_parked = false;
+    dma_channel_start(audio_dma_channels[0]);
+}
+
+bool audio_out_parked(void) {
+    return audio_parked;
+}
+
+void audio_out_wake_stats(audio_wake_stats_t *stats) {
+    *stats = audio_wake_stats;
+}
@@ -0,0 +1,47 @@
+#ifndef AUDIO_OUT_H
+#define AUDIO_OUT_H
+
+#include <stdint.h>
+#include "pico/stdlib.h"
+#include "audio_profile.h"
+#include "audio_rate.h"  // SAMPLE_RATE and the PWM wrap for it
+
+// Called every time one of the two DMA buffers needs refilling with n PWM levels
+typedef void (*audio_render_fn)(uint16_t *levels, uint32_t n);
+
+// Start PWM audio on the given pin. Two DMA channels take turns feeding the
+// PWM compare register one sample per PWM wrap, and render is called once per
+// finished buffer to refill it while the other one plays
+void audio_out_init(uint pin, audio_render_fn render);
+
+// Timing of the render callback so far, can be called from the other core
+void audio_out_profile(audio_profile_stats_t *stats);
+
+// Start the timing stats again
+void audio_out_profile_reset(void);
+
+// The sample rate we actually get out of the PWM, in Hz
+uint32_t audio_out_sample_rate(void);
+
+// PWM counts per sample right now, the render callback gets levels from 0 to this
+uint16_t audio_out_wrap(void);
+
+// Parking stops the DMA (so the render callback stops being called) and holds the
+// output at the midpoint, with the PWM running fast enough that the carrier cant
+// be heard whatever clk_sys gets turned down to. Resuming puts the PWM back for
+// the clk_sys at the time and the first block gets rendered straight away, so
+// call it after the clock is back up. Both have to be called from the core the DMA
+// interrupt runs on (the one that called audio_out_init), with interrupts off
+void audio_out_park(void);
+void audio_out_resume(uint32_t since);
+bool audio_out_parked(void);
+
+typedef struct {
+    uint32_t parks;
+    uint32_t last_wake_us;  // from the since handed to audio_out_resume to the first block rendered
+    uint32_t max_wake_us;
+} audio_wake_stats_t;
+
+void audio_out_wake_stats(audio_wake_stats_t *stats);
+
+#endif // AUDIO_OUT_H
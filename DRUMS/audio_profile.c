@@ -0,0 +1,111 @@
+#include <stdio.h>
+#include <string.h>
+#include "audio_profile.h"
+
+// Only the audio side writes the stats. It bumps seq to odd before changing
+// anything and back to even after, so a reader that sees the same even seq
+// before and after its copy knows it didnt get half an update.
+
+static void audio_profile_clear(audio_profile_t *profile) {
+    audio_profile_stats_t *stats = &profile->stats;
+    uint32_t deadline = stats->deadline_cycles;
+
+    memset(stats, 0, sizeof(*stats));
+    stats->deadline_cycles = deadline;
+    stats->min_cycles = UINT32_MAX;
+    stats->min_slack = profile->block_size;
+}
+
+void audio_profile_init(audio_profile_t *profile, uint32_t deadline_cycles, uint32_t block_size) {
+    memset(profile, 0, sizeof(*profile));
+    profile->block_size = block_size;
+    profile->stats.deadline_cycles = deadline_cycles ? deadline_cycles : 1;
+    audio_profile_clear(profile);
+}
+
+void audio_profile_record(audio_profile_t *profile, uint32_t cycles, uint32_t slack, bool overrun) {
+    audio_profile_stats_t *stats = &profile->stats;
+
+    __atomic_store_n(&profile->seq, profile->seq + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+
+    if (__atomic_load_n(&profile->reset, __ATOMIC_RELAXED)) {
+        audio_profile_clear(profile);
+        __atomic_store_n(&profile->reset, false, __ATOMIC_RELAXED);
+    }
+
+    stats->calls++;
+    stats->total_cycles += cycles;
+    if (cycles < stats->min_cycles) {
+        stats->min_cycles = cycles;
+    }
+    if (cycles > stats->max_cycles) {
+        stats->max_cycles = cycles;
+    }
+
+    uint32_t bucket = (uint32_t)(((uint64_t)cycles * (AUDIO_PROFILE_BUCKETS - 1)) / stats->deadline_cycles);
+    if (bucket > AUDIO_PROFILE_BUCKETS - 1) {
+        bucket = AUDIO_PROFILE_BUCKETS - 1;
+    }
+    stats->histogram[bucket]++;
+
+    if (overrun) {
+        stats->overruns++;
+    }
+    if (slack < profile->block_size / 2) {
+        stats->late_starts++;
+    }
+    if (slack < stats->min_slack) {
+        stats->min_slack = slack;
+    }
+
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    __atomic_store_n(&profile->seq, profile->seq + 1, __ATOMIC_RELAXED);
+}
+
+void audio_profile_snapshot(audio_profile_t *profile, audio_profile_stats_t *out) {
+    uint32_t before, after;
+
+    do {
+        before = __atomic_load_n(&profile->seq, __ATOMIC_ACQUIRE);
+        memcpy(out, (const void *)&profile->stats, sizeof(*out));
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        after = __atomic_load_n(&profile->seq, __ATOMIC_RELAXED);
+    } while ((before & 1) || before != after);
+}
+
+void audio_profile_request_reset(audio_profile_t *profile) {
+    __atomic_store_n(&profile->reset, true, __ATOMIC_RELAXED);
+}
+
+void audio_profile_print(const audio_profile_stats_t *stats, uint32_t clock_hz) {
+    double us_per_cycle = 1e6 / clock_hz;
+
+    if (stats->calls == 0) {
+        printf("audio profile: no blocks yet\n");
+        return;
+    }
+
+    uint32_t average = (uint32_t)(stats->total_cycles / stats->calls);
+    printf("audio profile: %lu blocks, deadline %lu cycles (%.1f us)\n",
+           (unsigned long)stats->calls, (unsigned long)stats->deadline_cycles,
+           stats->deadline_cycles * us_per_cycle);
+    printf("  cycles min %lu avg %lu max %lu (max %.1f%% of deadline)\n",
+           (unsigned long)stats->min_cycles, (unsigned long)average, (unsigned long)stats->max_cycles,
+           100.0 * stats->max_cycles / stats->deadline_cycles);
+    printf("  overruns %lu, late starts %lu, least slack %lu samples\n",
+           (unsigned long)stats->overruns, (unsigned long)stats->late_starts, (unsigned long)stats->min_slack);
+
+    // each line is one slice of the deadline, the last one is over it
+    for (int b = 0; b < AUDIO_PROFILE_BUCKETS; b++) {
+        if (stats->histogram[b] == 0) {
+            continue;
+        }
+        if (b == AUDIO_PROFILE_BUCKETS - 1) {
+            printf("  >100%%     %lu\n", (unsigned long)stats->histogram[b]);
+        } else {
+            printf("  %3d-%3d%%  %lu\n", b * 100 / (AUDIO_PROFILE_BUCKETS - 1),
+                   (b + 1) * 100 / (AUDIO_PROFILE_BUCKETS - 1), (unsigned long)stats->histogram[b]);
+        }
+    }
+}
@@ -0,0 +1,50 @@
+#ifndef AUDIO_PROFILE_H
+#define AUDIO_PROFILE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Timing for the audio callback. The audio side records how many cycles each
+// block took and how much time it had, anyone else can take a snapshot and print
+// it. Recording is a handful of adds so it can stay on all the time.
+// Nothing in here touches the pico hardware so it can also be built on a PC.
+
+// Histogram of cycles per block. The first AUDIO_PROFILE_BUCKETS - 1 buckets split
+// the deadline evenly, the last one is everything that took longer than the deadline
+#define AUDIO_PROFILE_BUCKETS 16
+
+typedef struct {
+    uint32_t calls;          // blocks rendered
+    uint32_t min_cycles;     // quickest block
+    uint32_t max_cycles;     // slowest block
+    uint64_t total_cycles;   // for the average
+    uint32_t deadline_cycles;  // how long one block takes to play
+    uint32_t overruns;       // the DMA got to a block before it was finished
+    uint32_t late_starts;    // started with less than half a block still to play
+    uint32_t min_slack;      // fewest samples left playing when a callback started
+    uint32_t histogram[AUDIO_PROFILE_BUCKETS];
+} audio_profile_stats_t;
+
+typedef struct {
+    audio_profile_stats_t stats;
+    uint32_t seq;            // odd while the audio side is in the middle of an update
+    bool reset;              // set by the reader, the audio side clears the stats next block
+    uint32_t block_size;     // samples per block, to tell what a late start is
+} audio_profile_t;
+
+void audio_profile_init(audio_profile_t *profile, uint32_t deadline_cycles, uint32_t block_size);
+
+// Audio side only. slack is how many samples the DMA still had to play when the
+// callback started, overrun is true if the block wasnt ready in time
+void audio_profile_record(audio_profile_t *profile, uint32_t cycles, uint32_t slack, bool overrun);
+
+// Copy the stats out while the audio side keeps going, safe from the other core
+void audio_profile_snapshot(audio_profile_t *profile, audio_profile_stats_t *out);
+
+// Ask the audio side to start counting again from its next block
+void audio_profile_request_reset(audio_profile_t *profile);
+
+// Print a snapshot, cycles are turned into us with the system clock
+void audio_profile_print(const audio_profile_stats_t *stats, uint32_t clock_hz);
+
+#endif // AUDIO_PROFILE_H
@@ -0,0 +1,51 @@
+#include "audio_queue.h"
+
+// head and tail just keep counting up and wrap at 2^32, the difference is
+// always the number of commands waiting. The acquire/release pairs make sure
+// a command is fully written before the other side can see the new index.
+
+void audio_queue_init(audio_queue_t *queue) {
+    queue->head = 0;
+    queue->tail = 0;
+    queue->overflows = 0;
+    queue->max_depth = 0;
+}
+
+bool audio_queue_push(audio_queue_t *queue, audio_cmd_t cmd) {
+    uint32_t head = queue->head;
+    uint32_t tail = __atomic_load_n(&queue->tail, __ATOMIC_ACQUIRE);
+
+    uint32_t depth = head - tail;
+
+    if (depth >= AUDIO_QUEUE_SIZE) {
+        queue->overflows++;
+        return false;  // full
+    }
+
+    queue->cmds[head & (AUDIO_QUEUE_SIZE - 1)] = cmd;
+    __atomic_store_n(&queue->head, head + 1, __ATOMIC_RELEASE);
+
+    if (depth + 1 > queue->max_depth) {
+        queue->max_depth = depth + 1;
+    }
+    return true;
+}
+
+bool audio_queue_pop(audio_queue_t *queue, audio_cmd_t *cmd) {
+    uint32_t tail = queue->tail;
+    uint32_t head = __atomic_load_n(&queue->head, __ATOMIC_ACQUIRE);
+
+    if (head == tail) {
+        return false;  // empty
+    }
+
+    *cmd = queue->cmds[tail & (AUDIO_QUEUE_SIZE - 1)];
+    __atomic_store_n(&queue->tail, tail + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+uint32_t audio_queue_depth(const audio_queue_t *queue) {
+    uint32_t head = __atomic_load_n(&queue->head, __ATOMIC_ACQUIRE);
+    uint32_t tail = __atomic_load_n(&queue->tail, __ATOMIC_ACQUIRE);
+    return head - tail;
+}
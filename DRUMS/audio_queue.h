@@ -0,0 +1,56 @@
+#ifndef AUDIO_QUEUE_H
+#define AUDIO_QUEUE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Fixed size lock free queue of timestamped commands for the audio side.
+// Exactly one context may push and exactly one may pop, they can be on
+// different cores. Nothing here blocks or turns interrupts off.
+// The mixer drains it at the start of every block, so anything pushed is
+// picked up at a block boundary and starts on the sample it asked for.
+
+#define AUDIO_QUEUE_SIZE 32  // must be a power of two
+
+// time value meaning "as soon as possible", the command starts at the next block
+#define AUDIO_TIME_NOW 0xFFFFFFFFu
+
+#if (AUDIO_QUEUE_SIZE & (AUDIO_QUEUE_SIZE - 1)) != 0
+#error "AUDIO_QUEUE_SIZE must be a power of two"
+#endif
+
+typedef enum {
+    AUDIO_CMD_TRIGGER,    // start the sound on a pad
+    AUDIO_CMD_SET_SOUND,  // assign a different sound to a pad
+} audio_cmd_type_t;
+
+typedef struct {
+    uint32_t time;   // sample (on the mixer clock) this should happen on, or AUDIO_TIME_NOW
+    uint16_t gain;   // for AUDIO_CMD_TRIGGER, MIXER_UNITY_GAIN is full volume
+    uint16_t sound;  // sound index for AUDIO_CMD_SET_SOUND
+    uint8_t type;    // one of audio_cmd_type_t
+    uint8_t pad;     // which drum pad
+} audio_cmd_t;
+
+typedef struct {
+    audio_cmd_t cmds[AUDIO_QUEUE_SIZE];
+    uint32_t head;   // only written by the producer
+    uint32_t tail;   // only written by the consumer
+
+    // stats, only written by the producer so they can be read from anywhere
+    uint32_t overflows;  // commands dropped because the queue was full
+    uint32_t max_depth;  // most commands that were ever waiting at once
+} audio_queue_t;
+
+void audio_queue_init(audio_queue_t *queue);
+
+// Returns false if the queue is full and the command was dropped
+bool audio_queue_push(audio_queue_t *queue, audio_cmd_t cmd);
+
+// Returns false if there was nothing to pop
+bool audio_queue_pop(audio_queue_t *queue, audio_cmd_t *cmd);
+
+// How many commands are waiting right now
+uint32_t audio_queue_depth(const audio_queue_t *queue);
+
+#endif // AUDIO_QUEUE_H
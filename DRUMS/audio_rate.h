@@ -0,0 +1,20 @@
+#ifndef AUDIO_RATE_H
+#define AUDIO_RATE_H
+
+#include <stdint.h>
+
+// The sample rate and the PWM wrap that makes it, on their own so the PC build
+// (see host/host_platform.h) puts out the same levels as the pico
+
+#define SAMPLE_RATE 22050  // 22Khz, to be fair we got this from ur mans repo,
+
+// The PWM counts at clk_sys (divider 1) and wraps once per sample, so the wrap is
+// our sample clock. The 8.4 fractional divider cant get 22050 Hz out of a 4095 wrap
+// (1.375 gives 22200 Hz, 0.7% fast), a whole wrap at full clock gets within a count:
+// 5669 at 125 MHz is 22049.74 Hz, 12 ppm, less than the crystal is off by anyway.
+// Its about 12.5 bits of levels too, 16 didnt really work
+static inline uint16_t audio_out_wrap_for(uint32_t clock_hz) {
+    return (uint16_t)((clock_hz + SAMPLE_RATE / 2) / SAMPLE_RATE);
+}
+
+#endif // AUDIO_RATE_H
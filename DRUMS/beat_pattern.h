@@ -0,0 +1,77 @@
+#ifndef BEAT_PATTERN_H
+#define BEAT_PATTERN_H
+
+#include <stdint.h>
+#include "tempo.h"
+
+// Drum machine style step patterns. A pattern is a grid of steps x pads that gets
+// packed at compile time into one bitmask per step, bit p set means pad p plays on
+// that step. Playing a step is one byte read, and the sequencer plays straight out
+// of the const pattern so switching beats is just changing a pointer.
+// Nothing in here touches the pico hardware so it can also be built on a PC.
+
+#define BEAT_MAX_STEPS 32
+#define BEAT_PATTERN_PADS 5  // lanes in a pattern, one per drum pad
+#define BEAT_STEP_TICKS (TEMPO_PPQN / 4)  // steps are 16th notes
+
+typedef uint8_t beat_step_t;  // one bit per pad
+
+typedef struct {
+    uint16_t bpm;    // tempo it was written for, it plays at whatever the tempo is set to
+    uint8_t steps;   // how many steps before it loops
+    beat_step_t grid[BEAT_MAX_STEPS];
+} beat_pattern_t;
+
+// Patterns are written as one lane per pad, a binary number with step 0 on the
+// left, e.g. 0b1000100010001000 is four on the floor over 16 steps. These turn
+// the lanes into the per step masks, everything here is a constant expression.
+// (the & 31 keeps the shift legal for steps past the end, they come out 0 anyway)
+#define BEAT_LANE_HIT(steps, lane, s) \
+    ((s) < (steps) ? (((uint32_t)(lane) >> (((steps) - 1 - (s)) & 31)) & 1u) : 0u)
+
+#define BEAT_STEP(steps, s, l0, l1, l2, l3, l4) (beat_step_t)( \
+    BEAT_LANE_HIT(steps, l0, s) << 0 | BEAT_LANE_HIT(steps, l1, s) << 1 | \
+    BEAT_LANE_HIT(steps, l2, s) << 2 | BEAT_LANE_HIT(steps, l3, s) << 3 | \
+    BEAT_LANE_HIT(steps, l4, s) << 4)
+
+#define BEAT_GRID(steps, ...) { \
+    BEAT_STEP(steps, 0, __VA_ARGS__),  BEAT_STEP(steps, 1, __VA_ARGS__),  \
+    BEAT_STEP(steps, 2, __VA_ARGS__),  BEAT_STEP(steps, 3, __VA_ARGS__),  \
+    BEAT_STEP(steps, 4, __VA_ARGS__),  BEAT_STEP(steps, 5, __VA_ARGS__),  \
+    BEAT_STEP(steps, 6, __VA_ARGS__),  BEAT_STEP(steps, 7, __VA_ARGS__),  \
+    BEAT_STEP(steps, 8, __VA_ARGS__),  BEAT_STEP(steps, 9, __VA_ARGS__),  \
+    BEAT_STEP(steps, 10, __VA_ARGS__), BEAT_STEP(steps, 11, __VA_ARGS__), \
+    BEAT_STEP(steps, 12, __VA_ARGS__), BEAT_STEP(steps, 13, __VA_ARGS__), \
+    BEAT_STEP(steps, 14, __VA_ARGS__), BEAT_STEP(steps, 15, __VA_ARGS__), \
+    BEAT_STEP(steps, 16, __VA_ARGS__), BEAT_STEP(steps, 17, __VA_ARGS__), \
+    BEAT_STEP(steps, 18, __VA_ARGS__), BEAT_STEP(steps, 19, __VA_ARGS__), \
+    BEAT_STEP(steps, 20, __VA_ARGS__), BEAT_STEP(steps, 21, __VA_ARGS__), \
+    BEAT_STEP(steps, 22, __VA_ARGS__), BEAT_STEP(steps, 23, __VA_ARGS__), \
+    BEAT_STEP(steps, 24, __VA_ARGS__), BEAT_STEP(steps, 25, __VA_ARGS__), \
+    BEAT_STEP(steps, 26, __VA_ARGS__), BEAT_STEP(steps, 27, __VA_ARGS__), \
+    BEAT_STEP(steps, 28, __VA_ARGS__), BEAT_STEP(steps, 29, __VA_ARGS__), \
+    BEAT_STEP(steps, 30, __VA_ARGS__), BEAT_STEP(steps, 31, __VA_ARGS__), \
+}
+
+// A whole pattern initialiser: BEAT_PATTERN(16, 120, kick, tom1, tom2, snare, crash)
+#define BEAT_PATTERN(steps, bpm, ...) {(bpm), (steps), BEAT_GRID(steps, __VA_ARGS__)}
+
+// True if a pattern makes sense, use it in a _Static_assert next to the pattern.
+// Catches lanes with more steps written than the pattern has, empty patterns and
+// silly step counts or tempos
+#define BEAT_PATTERN_OK(steps, bpm, l0, l1, l2, l3, l4) \
+    ((steps) >= 1 && (steps) <= BEAT_MAX_STEPS && (bpm) >= TEMPO_MIN_BPM && (bpm) <= TEMPO_MAX_BPM && \
+     ((uint64_t)((l0) | (l1) | (l2) | (l3) | (l4)) >> (steps)) == 0 && \
+     ((l0) | (l1) | (l2) | (l3) | (l4)) != 0)
+
+// Ticks from the top of the pattern to the start of step
+static inline uint32_t beat_pattern_step_time(uint32_t step) {
+    return step * BEAT_STEP_TICKS;
+}
+
+// Ticks one pass through the pattern takes
+static inline uint32_t beat_pattern_length(const beat_pattern_t *pattern) {
+    return pattern->steps * BEAT_STEP_TICKS;
+}
+
+#endif // BEAT_PATTERN_H
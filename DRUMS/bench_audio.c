@@ -0,0 +1,385 @@
+// On target benchmarks for the audio kernels, the same code the firmware runs timed
+// on the pico itself. host/kernel_bench is quicker to iterate on but a PC doesnt
+// stall on the XIP cache and has a multiplier the M0+ can only dream of, so these
+// are the numbers that say whether a block makes its deadline.
+//   mix            mixer_render and mixer_prefetch with N voices, PCM16 and ADPCM
+//   adpcm_decode   adpcm_decode straight out of the sound data, one block at a time
+//   clamp_pwm      mixer_clamp and mixer_to_pwm, the end of every block
+//   schedule       drum_engine_schedule handing out a loop of N hits
+// The sound data is read either out of flash (through the XIP cache, and streamed
+// by xip_stream like main.c does) or out of a copy in SRAM. Every kernel is run with
+// the XIP cache warm and again with it flushed before every block, the cold numbers
+// are what a block costs after USB or a long song has thrown everything out of it.
+// bench_audio runs the code from flash, bench_audio_ram is the same program built
+// copy_to_ram so the code runs from SRAM, flash both and compare.
+// Results come out on the USB serial once something opens it, any key runs it again.
+#include <stdio.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "pico/stdio_usb.h"
+#include "hardware/clocks.h"
+#include "hardware/sync.h"
+#include "hardware/structs/systick.h"
+#include "hardware/structs/xip_ctrl.h"
+#include "audio_out.h"
+#include "drum_engine.h"
+#include "sample_bank.h"
+#include "xip_stream.h"
+#include "log_ring.h"
+#include "log_events.h"
+
+#ifndef BENCH_CODE_IN_RAM
+#define BENCH_CODE_IN_RAM 0
+#endif
+
+#define BENCH_SYSTICK_MASK 0xffffffu  // SysTick is 24 bits, one block is a lot less than that
+#define BENCH_BLOCKS 1024             // timed blocks per kernel, about 3 s of audio
+#define BENCH_WARMUP_BLOCKS 32
+#define BENCH_MIX_INPUT 1024          // mixed samples the clamp_pwm kernel goes round
+#define BENCH_LOOP_SAMPLES 88200      // 4 s, two bars at 120
+
+// How much sound data gets copied to SRAM for the sram rows. Sounds are cut down to
+// this much for the flash rows too, so both play exactly the same samples
+#ifndef BENCH_SRAM_BYTES
+#define BENCH_SRAM_BYTES 65536
+#endif
+
+#if BENCH_SRAM_BYTES < ADPCM_BLOCK_BYTES || BENCH_SRAM_BYTES % 4 != 0
+#error "BENCH_SRAM_BYTES must hold an ADPCM block and be a multiple of 4"
+#endif
+
+// where the sound data is read from
+typedef enum {
+    BENCH_DATA_NONE,   // the kernel doesnt read any sound data
+    BENCH_DATA_FLASH,
+    BENCH_DATA_SRAM,
+} bench_data_t;
+
+static const char *const bench_data_names[] = {"-", "flash", "sram"};
+
+typedef struct {
+    const char *kernel;
+    const char *variant;
+    uint32_t param;
+    const char *param_name;
+    uint8_t data;                              // one of bench_data_t
+    bool (*setup)(uint32_t param, uint8_t data);  // false if theres nothing to run it on
+    void (*block)(void);                       // one block worth of work
+} bench_t;
+
+typedef struct {
+    uint32_t min_cycles;
+    uint32_t max_cycles;
+    uint64_t total_cycles;
+    xip_stats_t xip;
+} bench_result_t;
+
+// drum_engine.c logs through these, nothing here drains it
+log_ring_t log_ring;
+
+uint32_t log_time() {
+    return time_us_32();
+}
+
+extern const uint8_t sample_bank_image[];
+extern const uint8_t sample_bank_image_end[];
+static sample_bank_t sample_bank;
+static bool sample_bank_ok;
+
+static uint32_t sram_sound[BENCH_SRAM_BYTES / 4];
+static mixer_t mixer;
+static drum_engine_t engine;
+static uint32_t mix_voices;
+static mixer_sound_t sound;
+static adpcm_state_t decode_state;
+static uint32_t decode_position;
+static int32_t mix_input[BENCH_MIX_INPUT];
+static uint32_t mix_offset;
+static volatile uint16_t sink;  // stands in for the PWM compare register
+
+// ---- sound data ----
+
+// The longest sound of a format in the bank, so the mixer has to stream it past
+// the attack copy
+static int longest_sound(uint8_t format) {
+    int longest = -1;
+    uint32_t length = 0;
+
+    for (uint16_t i = 0; sample_bank_ok && i < sample_bank_count(&sample_bank); i++) {
+        const sample_bank_entry_t *entry = sample_bank_entry(&sample_bank, i);
+        if (entry->format == format && entry->length > length) {
+            longest = i;
+            length = entry->length;
+        }
+    }
+    return longest;
+}
+
+// Point sound at the longest sound of a format, cut down to fit in sram_sound and
+// copied there if data says so
+static bool load_sound(uint8_t format, uint8_t data) {
+    int index = longest_sound(format);
+    if (index < 0 || !sample_bank_sound(&sample_bank, (uint16_t)index, &sound)) {
+        return false;
+    }
+
+    uint32_t max_length = format == MIXER_FORMAT_ADPCM
+                              ? (BENCH_SRAM_BYTES / ADPCM_BLOCK_BYTES) * ADPCM_BLOCK_SAMPLES
+                              : BENCH_SRAM_BYTES / 2;
+    if (sound.length > max_length) {
+        sound.length = max_length;
+    }
+    if (data == BENCH_DATA_SRAM) {
+        uint32_t bytes = format == MIXER_FORMAT_ADPCM ? ADPCM_BYTES_FOR(sound.length) : sound.length * 2;
+        memcpy(sram_sound, sound.data, bytes);
+        sound.data = sram_sound;
+    }
+    return true;
+}
+
+// ---- mixing ----
+
+// Every pad gets the same sound, so the flash and sram rows read the same bytes
+static bool setup_mix(uint8_t format, uint32_t voices, uint8_t data) {
+    if (!load_sound(format, data)) {
+        return false;
+    }
+    mixer_init(&mixer);
+    mixer_set_fetch(&mixer, xip_stream_fetch, xip_stream_wait);
+    for (uint8_t i = 0; i < MIXER_NUM_PADS; i++) {
+        mixer_set_sound(&mixer, i, &sound);
+    }
+    mix_voices = voices;
+    return true;
+}
+
+static bool setup_mix_pcm16(uint32_t voices, uint8_t data) {
+    return setup_mix(MIXER_FORMAT_PCM16, voices, data);
+}
+
+static bool setup_mix_adpcm(uint32_t voices, uint8_t data) {
+    return setup_mix(MIXER_FORMAT_ADPCM, voices, data);
+}
+
+// what render_audio_block does minus the PWM, which has its own row
+static void block_mix(void) {
+    int16_t pcm[AUDIO_BLOCK_SIZE];
+
+    // keep the voice count where it should be as sounds finish
+    while (mixer_active_voices(&mixer) < mix_voices) {
+        mixer_trigger(&mixer, (uint8_t)(mixer.triggers % MIXER_NUM_PADS), 0, MIXER_UNITY_GAIN);
+    }
+    mixer_render(&mixer, pcm, AUDIO_BLOCK_SIZE);
+    mixer_prefetch(&mixer);
+    sink = (uint16_t)pcm[0];
+}
+
+// ---- adpcm ----
+
+static bool setup_decode(uint32_t param, uint8_t data) {
+    if (!load_sound(MIXER_FORMAT_ADPCM, data)) {
+        return false;
+    }
+    decode_position = 0;
+    adpcm_seek(&decode_state, sound.data, 0);
+    return true;
+}
+
+static void block_decode(void) {
+    int16_t pcm[AUDIO_BLOCK_SIZE];
+
+    if (decode_position + AUDIO_BLOCK_SIZE > sound.length) {
+        decode_position = 0;
+        adpcm_seek(&decode_state, sound.data, 0);
+    }
+    adpcm_decode(&decode_state, sound.data, decode_position, pcm, AUDIO_BLOCK_SIZE);
+    decode_position += AUDIO_BLOCK_SIZE;
+    sink = (uint16_t)pcm[0];
+}
+
+// ---- clamp and pwm ----
+
+static bool setup_clamp_pwm(uint32_t param, uint8_t data) {
+    uint32_t seed = 2;
+    for (int i = 0; i < BENCH_MIX_INPUT; i++) {
+        // up to three sounds worth, so plenty of it clips
+        seed = seed * 1664525u + 1013904223u;
+        mix_input[i] = (int32_t)((seed >> 8) % (6 * 32768)) - 3 * 32768;
+    }
+    mix_offset = 0;
+    return true;
+}
+
+static void block_clamp_pwm(void) {
+    int16_t pcm[AUDIO_BLOCK_SIZE];
+    uint16_t levels[AUDIO_BLOCK_SIZE];
+
+    mixer_clamp(&mix_input[mix_offset], pcm, AUDIO_BLOCK_SIZE);
+    mixer_to_pwm(pcm, levels, AUDIO_BLOCK_SIZE, audio_out_wrap_for(clock_get_hz(clk_sys)));
+    mix_offset = (mix_offset + AUDIO_BLOCK_SIZE) % (BENCH_MIX_INPUT - AUDIO_BLOCK_SIZE);
+    sink = levels[0];
+}
+
+// ---- the loop ----
+
+// A loop of hits hits spread over BENCH_LOOP_SAMPLES, recorded and locked like a real one
+static bool setup_loop(uint32_t hits, uint8_t data) {
+    drum_engine_init(&engine, NULL, NULL, NULL, SAMPLE_RATE, 120, 0);
+
+    uint32_t seed = 3;
+    for (uint32_t i = 0; i < hits; i++) {
+        seed = seed * 1664525u + 1013904223u;
+        sequencer_record(&engine.sequencer, (uint32_t)((uint64_t)i * BENCH_LOOP_SAMPLES / hits),
+                         (uint8_t)((seed >> 16) % MIXER_NUM_PADS));
+    }
+    uint32_t ticks = tempo_samples_to_ticks(&engine.tempo, BENCH_LOOP_SAMPLES);
+    loop_store_scale(&engine.loop_store, ticks, BENCH_LOOP_SAMPLES);
+    sequencer_set_length(&engine.sequencer, ticks);
+    tempo_lock(&engine.tempo, ticks, BENCH_LOOP_SAMPLES);
+
+    tempo_start(&engine.tempo, drum_engine_now(&engine) + AUDIO_BLOCK_SIZE);
+    sequencer_start(&engine.sequencer, 0);
+    return engine.loop_store.used == hits;
+}
+
+// the queue gets emptied every block like the audio side would
+static void block_loop(void) {
+    audio_cmd_t cmd;
+
+    engine.mixer.clock += AUDIO_BLOCK_SIZE;  // a block went by
+    drum_engine_schedule(&engine);
+    while (audio_queue_pop(&engine.queue, &cmd)) {
+    }
+}
+
+static const bench_t benches[] = {
+    {"mix", "pcm16", 1, "voices", BENCH_DATA_FLASH, setup_mix_pcm16, block_mix},
+    {"mix", "pcm16", 1, "voices", BENCH_DATA_SRAM, setup_mix_pcm16, block_mix},
+    {"mix", "pcm16", 4, "voices", BENCH_DATA_FLASH, setup_mix_pcm16, block_mix},
+    {"mix", "pcm16", 4, "voices", BENCH_DATA_SRAM, setup_mix_pcm16, block_mix},
+    {"mix", "pcm16", 16, "voices", BENCH_DATA_FLASH, setup_mix_pcm16, block_mix},
+    {"mix", "pcm16", 16, "voices", BENCH_DATA_SRAM, setup_mix_pcm16, block_mix},
+    {"mix", "adpcm", 1, "voices", BENCH_DATA_FLASH, setup_mix_adpcm, block_mix},
+    {"mix", "adpcm", 1, "voices", BENCH_DATA_SRAM, setup_mix_adpcm, block_mix},
+    {"mix", "adpcm", 4, "voices", BENCH_DATA_FLASH, setup_mix_adpcm, block_mix},
+    {"mix", "adpcm", 4, "voices", BENCH_DATA_SRAM, setup_mix_adpcm, block_mix},
+    {"adpcm_decode", "direct", AUDIO_BLOCK_SIZE, "block", BENCH_DATA_FLASH, setup_decode, block_decode},
+    {"adpcm_decode", "direct", AUDIO_BLOCK_SIZE, "block", BENCH_DATA_SRAM, setup_decode, block_decode},
+    {"clamp_pwm", "block", AUDIO_BLOCK_SIZE, "block", BENCH_DATA_NONE, setup_clamp_pwm, block_clamp_pwm},
+    {"schedule", "loop", 50, "hits", BENCH_DATA_NONE, setup_loop, block_loop},
+    {"schedule", "loop", 500, "hits", BENCH_DATA_NONE, setup_loop, block_loop},
+    {"schedule", "loop", LOOP_STORE_EVENTS, "hits", BENCH_DATA_NONE, setup_loop, block_loop},
+};
+
+#define NUM_BENCHES (sizeof(benches) / sizeof(benches[0]))
+
+// ---- timing ----
+
+// Throw away everything in the XIP cache, the next reads and instruction fetches
+// from flash all miss. Reading flush back waits for it to finish
+static void __no_inline_not_in_flash_func(flush_xip_cache)(void) {
+    xip_ctrl_hw->flush = 1;
+    (void)xip_ctrl_hw->flush;
+}
+
+// Time every block on its own with the interrupts off, so USB doesnt land in the
+// middle of one
+static void run_bench(const bench_t *bench, bool cold, bench_result_t *result) {
+    for (int i = 0; i < BENCH_WARMUP_BLOCKS; i++) {
+        bench->block();
+    }
+
+    result->min_cycles = UINT32_MAX;
+    result->max_cycles = 0;
+    result->total_cycles = 0;
+    xip_stats_read(&result->xip, true);
+    for (int i = 0; i < BENCH_BLOCKS; i++) {
+        uint32_t irq = save_and_disable_interrupts();
+        if (cold) {
+            flush_xip_cache();
+        }
+        uint32_t start = systick_hw->cvr;
+        bench->block();
+        uint32_t cycles = (start - systick_hw->cvr) & BENCH_SYSTICK_MASK;
+        restore_interrupts(irq);
+
+        result->total_cycles += cycles;
+        if (cycles < result->min_cycles) {
+            result->min_cycles = cycles;
+        }
+        if (cycles > result->max_cycles) {
+            result->max_cycles = cycles;
+        }
+    }
+    xip_stats_read(&result->xip, false);
+}
+
+static void print_result(const bench_t *bench, bool cold, const bench_result_t *result, uint32_t budget) {
+    uint32_t average = (uint32_t)(result->total_cycles / BENCH_BLOCKS);
+    uint32_t hit_rate = result->xip.accesses ? (uint32_t)((uint64_t)result->xip.hits * 100 / result->xip.accesses) : 100;
+
+    printf("%-13s %-7s %5lu %-6s %-5s %-5s %9lu %9lu %9lu %7lu.%lu %5lu%% %4lu%%\n", bench->kernel, bench->variant,
+           (unsigned long)bench->param, bench->param_name, bench_data_names[bench->data], cold ? "cold" : "warm",
+           (unsigned long)result->min_cycles, (unsigned long)average, (unsigned long)result->max_cycles,
+           (unsigned long)(average / AUDIO_BLOCK_SIZE), (unsigned long)(average * 10 / AUDIO_BLOCK_SIZE % 10),
+           (unsigned long)((uint64_t)result->max_cycles * 100 / budget), (unsigned long)hit_rate);
+}
+
+static void run_all(void) {
+    uint32_t clock_hz = clock_get_hz(clk_sys);
+    // what one block can take before the DMA gets to it
+    uint32_t budget = (uint32_t)((uint64_t)clock_hz * AUDIO_BLOCK_SIZE / SAMPLE_RATE);
+    bench_result_t result;
+
+    printf("\nbench_audio: code in %s, clk_sys %lu MHz, %u sample blocks at %u Hz, %lu cycles a block\n",
+           BENCH_CODE_IN_RAM ? "SRAM (copy_to_ram)" : "flash (XIP)", (unsigned long)(clock_hz / 1000000),
+           AUDIO_BLOCK_SIZE, SAMPLE_RATE, (unsigned long)budget);
+    printf("%u timed blocks per row, cycles per block. worst is the slowest block as a share of that,\n"
+           "hit%% is how many cached XIP reads hit\n", BENCH_BLOCKS);
+    printf("%-13s %-7s %5s %-6s %-5s %-5s %9s %9s %9s %9s %6s %5s\n", "kernel", "variant", "param", "", "data",
+           "cache", "min", "avg", "max", "cyc/smp", "worst", "hit%");
+
+    for (uint32_t b = 0; b < NUM_BENCHES; b++) {
+        const bench_t *bench = &benches[b];
+        for (int cold = 0; cold < 2; cold++) {
+            // set up again for the cold run so it starts from the same place
+            if (!bench->setup(bench->param, bench->data)) {
+                printf("%-13s %-7s %5lu %-6s %-5s skipped, nothing to run it on\n", bench->kernel, bench->variant,
+                       (unsigned long)bench->param, bench->param_name, bench_data_names[bench->data]);
+                break;
+            }
+            run_bench(bench, cold, &result);
+            print_result(bench, cold, &result, budget);
+        }
+    }
+    printf("done, any key to run it again\n");
+}
+
+int main() {
+    stdio_init_all();
+    log_ring_init(&log_ring);
+
+    // free running cycle counter, counts down from 2^24 at clk_sys
+    systick_hw->csr = 0;
+    systick_hw->rvr = BENCH_SYSTICK_MASK;
+    systick_hw->cvr = 0;
+    systick_hw->csr = M0PLUS_SYST_CSR_CLKSOURCE_BITS | M0PLUS_SYST_CSR_ENABLE_BITS;
+
+    size_t size = (size_t)(sample_bank_image_end - sample_bank_image);
+    sample_bank_ok = sample_bank_open(&sample_bank, sample_bank_image, size);
+    xip_stream_init();
+
+    while (!stdio_usb_connected()) {
+        sleep_ms(100);
+    }
+    sleep_ms(500);  // give the terminal a moment so the header doesnt get lost
+    if (!sample_bank_ok) {
+        printf("sample bank didnt open, the mix and adpcm rows get skipped\n");
+    }
+
+    while (true) {
+        run_all();
+        while (getchar_timeout_us(100000) == PICO_ERROR_TIMEOUT) {
+        }
+    }
+}
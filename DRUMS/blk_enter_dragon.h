@@ -1,7367 +0,0 @@
-// audio data for: blk_enter_dragon_audio
-// sample rate: 22050 hz
-// duration: 4.000 seconds
-// length: 88200 samples
-
-#ifndef AUDIO_DATA_H_BLK_ENTER_DRAGON_AUDIO
-#define AUDIO_DATA_H_BLK_ENTER_DRAGON_AUDIO
-
-#include <stdint.h>
-#include <stddef.h>
-
-const size_t blk_enter_dragon_audio_length = 88200;
-
-const int16_t blk_enter_dragon_audio[88200] = {
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1,
-    -2, -2, -2, -2, -2, -2, -2, -2, -2, -3, -3, -3,
-    -3, -3, -3, -2, -3, -3, -4, -4, -5, -6, -7, -8,
-    -9, -11, -13, -15, -17, -19, -21, -23, -25, -26, -27, -27,
-    -28, -30, -29, -29, -29, -30, -33, -34, -34, -35, -38, -40,
-    -43, -49, -52, -58, -67, -72, -75, -80, -88, -98, -111, -119,
-    -127, -134, -140, -155, -160, -154, -157, -159, -163, -166, -157, -153,
-    -157, -169, -179, -177, -166, -177, -209, -222, -236, -261, -281, -325,
-    -373, -387, -393, -419, -481, -554, -628, -642, -677, -742, -814, -932,
-    -986, -974, -1040, -1121, -1171, -1198, -1159, -1152, -1202, -1298, -1408, -1484,
-    -1433, -1413, -1470, -1411, -1392, -1337, -1115, -1019, -1139, -1236, -1151, -910,
-    -705, -627, -743, -712, -384, -111, -39, -99, 45, 420, 803, 938,
-    578, 415, 712, 1030, 1460, 1523, 1669, 1984, 2396, 2788, 2782, 2578,
-    2621, 2882, 3524, 3806, 3879, 4058, 4211, 4737, 4816, 4631, 4282, 4134,
-    4867, 5718, 5935, 5908, 5893, 6188, 6741, 6899, 6587, 6438, 7032, 7769,
-    8082, 7776, 7335, 7481, 8275, 9145, 9106, 8861, 9013, 9416, 9599, 9299,
-    8675, 8450, 9036, 9866, 10129, 9918, 9631, 9741, 10471, 10702, 10402, 10206,
-    9934, 10491, 11361, 11045, 10586, 10801, 11204, 12401, 13137, 12884, 12823, 12789,
-    12913, 13607, 13450, 12983, 13529, 14124, 14333, 14879, 14976, 14852, 15287, 15839,
-    15835, 15663, 15905, 16649, 17261, 16983, 16442, 16260, 16283, 16590, 17149, 17147,
-    17322, 17973, 18509, 18601, 18305, 17874, 17561, 17545, 17898, 18213, 18285, 18473,
-    18810, 19201, 19469, 18986, 18111, 17832, 18287, 19018, 19436, 19184, 18840, 19017,
-    19315, 19010, 18058, 17162, 17122, 17751, 18315, 18401, 18056, 17625, 17540, 17411,
-    17042, 16515, 16400, 16824, 17207, 17070, 16217, 15265, 15150, 15383, 15178, 14900,
-    14819, 14861, 15126, 15154, 14318, 12971, 12097, 11937, 12319, 12638, 12354, 11620,
-    10946, 11057, 11347, 10656, 9493, 8933, 8982, 9567, 10224, 9991, 8793, 7596,
-    7232, 7479, 8111, 8073, 7208, 6478, 6188, 6244, 6191, 5543, 4633, 4258,
-    4471, 4753, 4506, 3403, 2062, 1601, 1910, 1784, 1209, 644, 319, 244,
-    -116, -989, -1877, -2458, -2787, -2823, -2908, -3215, -3763, -4442, -4740, -4680,
-    -4648, -5077, -5400, -5340, -5285, -5177, -5756, -6554, -6740, -6854, -6653, -6248,
-    -6055, -6154, -6470, -6911, -7314, -7754, -7553, -7619, -7842, -7703, -8122, -8916,
-    -9538, -9626, -9543, -9421, -8917, -8795, -9127, -9341, -9714, -10477, -10692, -10515,
-    -10088, -9597, -9695, -10114, -10647, -10784, -11117, -11286, -11018, -11352, -11349, -11159,
-    -11423, -11756, -11814, -11891, -12055, -11529, -11152, -10888, -10001, -7434, -7304, -7900,
-    -8046, -8151, -7771, -7324, -7250, -7575, -7895, -8199, -8976, -9656, -10681, -10210,
-    -9340, -9112, -9178, -9924, -9554, -9191, -9713, -10687, -10787, -10488, -9537, -9268,
-    -8445, -8688, -7346, -6479, -5667, -6743, -8236, -9854, -12268, -13933, -15950, -18361,
-    -20609, -22124, -22089, -22122, -23814, -27412, -29705, -26383, -22139, -20419, -20057, -16567,
-    -11333, -7788, -7568, -7023, -3846, -942, 330, -1135, 3429, 5612, 5626, 4258,
-    -173, -12339, -24315, -22599, -2312, -10965, -14265, -14533, -14889, -13114, -13921, -12207,
-    -14780, -14595, -11014, -2427, 5735, 5642, 7154, 7096, 6224, 3422, 136, -2949,
-    -7362, -9247, -10999, -12841, -13493, -15132, -15759, -17373, -18106, -18224, -19849, -20857,
-    -21226, -20932, -21308, -21590, -21532, -22042, -21794, -20703, -20410, -20650, -20938, -21218,
-    -19221, -17925, -18092, -18050, -17492, -15622, -14094, -15899, -17960, -17769, -17200, -15622,
-    -14569, -15137, -13624, -11019, -7990, -4737, -455, 2852, 5769, 7471, 9366, 10601,
-    12300, 13747, 15284, 16531, 17397, 17819, 18169, 18697, 19384, 19438, 19843, 20022,
-    20251, 20903, 20794, 20498, 19689, 19469, 19845, 19970, 19459, 19012, 18296, 17472,
-    17301, 16802, 16114, 15024, 14320, 13926, 13861, 13731, 14268, 15405, 16262, 16753,
-    16440, 15558, 14892, 14250, 12713, 10181, 7719, 4562, 1027, -1172, -3633, -5412,
-    -7150, -8823, -9934, -10949, -12074, -13569, -14494, -14272, -13940, -13644, -14010, -15157,
-    -16059, -16154, -15244, -14121, -13814, -13776, -13946, -13621, -13286, -12950, -12580, -12093,
-    -11137, -10823, -10937, -11716, -12857, -13094, -12241, -11225, -10649, -10289, -9177, -6422,
-    -2608, 1013, 3860, 6342, 8732, 10532, 12019, 12975, 14216, 15828, 16975, 17210,
-    17314, 17899, 18773, 19762, 20092, 20139, 20210, 20019, 19760, 19757, 19491, 19363,
-    19762, 19963, 19614, 18664, 17767, 17407, 17707, 17574, 16866, 16280, 15688, 14956,
-    14129, 13137, 12643, 13357, 15046, 16745, 17532, 17410, 17189, 16752, 15580, 13937,
-    12205, 10280, 8466, 6550, 3867, 623, -2580, -5107, -6703, -7739, -8749, -9812,
-    -11025, -12317, -12854, -12952, -13318, -13659, -14081, -14577, -14690, -14661, -14523, -14382,
-    -14492, -14955, -15147, -14686, -13693, -12358, -11398, -11161, -10971, -10582, -10000, -9396,
-    -8966, -8279, -6856, -5488, -5148, -5751, -6934, -7982, -8281, -8239, -8608, -9099,
-    -9137, -7922, -5885, -3177, -30, 3015, 5544, 7585, 9757, 11765, 13135, 14093,
-    15005, 15693, 16531, 17104, 17389, 17846, 18431, 19360, 19804, 19521, 18753, 18393,
-    18619, 18485, 18058, 17415, 16894, 16854, 16676, 16325, 15951, 15447, 15090, 14939,
-    14790, 14013, 12801, 11528, 10316, 9154, 8433, 8133, 7964, 7100, 6001, 5715,
-    5872, 5985, 5825, 6194, 6606, 6953, 7606, 7858, 6572, 4334, 1802, -407,
-    -2985, -5343, -7748, -10005, -11975, -13666, -14909, -16370, -17472, -18201, -18534, -18865,
-    -19172, -19572, -19283, -18951, -19081, -19378, -19162, -18960, -18447, -17946, -17608, -17377,
-    -16505, -16082, -15653, -15081, -14796, -14199, -13376, -12420, -11882, -11577, -11267, -10382,
-    -8910, -7711, -7397, -7402, -6924, -5914, -5425, -5855, -6311, -6600, -7063, -6887,
-    -6893, -6450, -6156, -6064, -5699, -4417, -2203, 261, 3100, 5278, 7063, 9107,
-    11089, 12862, 14415, 15047, 15821, 16584, 17142, 17600, 18090, 18603, 19019, 19553,
-    19781, 19834, 19683, 19631, 19509, 19170, 18434, 18233, 17365, 16676, 15988, 15462,
-    14816, 14687, 14232, 13737, 12789, 11934, 10586, 9834, 8827, 7990, 7604, 7034,
-    6683, 6396, 6005, 5156, 4152, 2745, 1719, 617, -915, -2070, -1995, -1594,
-    -1766, -2180, -2643, -2883, -2060, -1734, -1484, -2536, -3800, -5307, -6571, -7908,
-    -8931, -10237, -11586, -13208, -14275, -15556, -16890, -18094, -19274, -19429, -19650, -19852,
-    -20627, -21626, -22364, -22185, -21400, -21015, -20919, -20556, -20392, -19927, -19355, -18876,
-    -18887, -18207, -17448, -16405, -15125, -13928, -13302, -12897, -12401, -11648, -10733, -10435,
-    -9998, -9566, -9230, -8194, -6801, -6481, -6078, -5394, -4018, -2784, -1045, 51,
-    90, 125, -132, 121, -24, 127, 795, 1119, 2374, 3174, 3796, 4336,
-    5178, 6074, 7197, 8944, 10527, 11845, 13372, 15275, 17086, 18805, 20178, 20387,
-    20707, 20829, 21250, 21800, 22653, 23060, 23416, 23468, 23264, 22882, 22907, 22468,
-    22508, 22030, 21402, 20145, 19041, 18108, 17387, 16776, 16310, 16052, 15579, 14544,
-    13518, 12085, 11440, 11135, 10768, 10272, 9782, 8346, 7319, 6542, 5421, 4860,
-    3390, 2437, 1217, 458, -855, -1767, -2989, -4472, -5099, -5128, -5535, -5830,
-    -5725, -5438, -5572, -6103, -6493, -7200, -7579, -7725, -7714, -8274, -9166, -9284,
-    -9579, -9377, -9943, -11022, -12462, -13783, -15269, -16540, -17311, -18677, -20027, -20621,
-    -20715, -20822, -21149, -22061, -22548, -22496, -22392, -22297, -22192, -22591, -21847, -20866,
-    -19724, -19157, -18644, -18182, -17541, -16957, -16111, -16032, -15816, -15188, -14424, -13609,
-    -12680, -11693, -11012, -9973, -8898, -8188, -7574, -7111, -6921, -6325, -5387, -3975,
-    -2607, -1601, -736, 623, 1513, 2983, 3994, 4725, 5934, 6928, 7272, 7601,
-    7244, 6866, 7276, 7861, 8026, 8205, 7796, 7235, 7459, 7745, 8435, 9510,
-    10063, 10706, 11428, 12135, 13050, 14177, 14978, 16179, 17475, 18607, 20003, 20721,
-    21376, 22049, 22751, 23657, 24537, 24970, 25064, 24601, 24569, 23472, 22025, 21479,
-    21339, 21310, 20666, 19666, 18449, 18343, 17886, 17351, 16441, 15215, 14538, 14272,
-    14001, 13247, 12367, 11471, 10749, 10198, 9536, 8633, 7618, 7204, 6511, 5138,
-    3424, 1657, 819, 30, -1138, -2022, -3063, -4122, -4929, -5312, -6053, -6846,
-    -7792, -8105, -8491, -8820, -9606, -10104, -9868, -9668, -9837, -10058, -10353, -10597,
-    -10769, -11191, -12005, -12752, -13368, -13483, -12508, -12047, -12835, -14031, -14905, -15091,
-    -15485, -15733, -16664, -17363, -17144, -16897, -17379, -16975, -16866, -17061, -17055, -17243,
-    -18238, -19268, -19984, -20564, -20544, -20289, -19948, -19958, -19540, -18174, -17193, -16561,
-    -15850, -15697, -15417, -14626, -13716, -13286, -12760, -12018, -11448, -10968, -10956, -10424,
-    -9743, -9095, -8384, -7904, -7197, -6762, -6263, -4900, -3266, -1774, -566, 169,
-    1105, 2170, 3165, 4131, 4686, 5181, 6068, 6728, 7082, 7864, 8706, 9893,
-    10567, 11611, 11645, 11542, 11998, 12556, 12690, 12989, 14060, 14601, 14423, 14500,
-    14880, 14698, 14725, 14597, 14414, 14194, 13585, 13462, 13593, 14027, 14592, 14967,
-    15022, 15908, 16820, 17144, 17357, 17731, 18156, 18134, 18595, 19139, 19867, 20844,
-    21493, 22208, 22345, 21905, 21139, 20282, 19301, 18337, 17492, 16607, 15769, 15433,
-    14901, 14256, 13920, 13299, 12485, 12024, 11529, 11081, 10317, 9768, 8841, 8460,
-    8257, 7661, 7654, 7537, 6610, 5880, 5798, 5870, 5080, 4232, 2586, 802,
-    -177, -1045, -1771, -2823, -4444, -5698, -6494, -7256, -8219, -9555, -10532, -10764,
-    -11235, -11369, -12223, -12924, -12998, -13188, -13489, -14049, -14985, -15770, -16057, -16434,
-    -17182, -17789, -18080, -17864, -17350, -16880, -16774, -16736, -17093, -17172, -17496, -17434,
-    -17688, -17996, -17591, -17114, -16877, -16985, -17428, -17518, -17249, -17081, -17453, -17676,
-    -17771, -17608, -17585, -17512, -17591, -18012, -17875, -17902, -17814, -17747, -17737, -17882,
-    -17749, -17722, -17675, -17456, -17024, -16319, -15774, -15271, -14922, -14654, -13802, -12597,
-    -11947, -11849, -11825, -11512, -10978, -10095, -9140, -8725, -8102, -7625, -6941, -6658,
-    -6560, -6718, -6680, -6341, -5427, -4568, -3922, -3145, -1906, -136, 1397, 2396,
-    3463, 4674, 5354, 6241, 7352, 8387, 9224, 9964, 10854, 11559, 12607, 13198,
-    13823, 14530, 15106, 15461, 15374, 15469, 15939, 16549, 17511, 18410, 18737, 18748,
-    18904, 18880, 18983, 19230, 19190, 19480, 20201, 20435, 20268, 19931, 19176, 18944,
-    18287, 18169, 18027, 18210, 18338, 18264, 18433, 17910, 17228, 16945, 16189, 16141,
-    16352, 16932, 17070, 16576, 16450, 15992, 15892, 15855, 16203, 16273, 16605, 16551,
-    16398, 16617, 16760, 16634, 16212, 15608, 14873, 14291, 14285, 13965, 13383, 12538,
-    11670, 10897, 10351, 10034, 9725, 9405, 9205, 8787, 8275, 7155, 6206, 5701,
-    5690, 5965, 6018, 5491, 4580, 3380, 2617, 1848, 1049, 195, -146, -415,
-    -714, -1475, -2807, -4554, -6196, -7369, -8455, -9190, -10022, -10621, -11189, -11607,
-    -11880, -12548, -13556, -14566, -15442, -16095, -16148, -16405, -16857, -17390, -17954, -18221,
-    -18285, -18762, -19138, -19013, -19221, -19708, -20446, -21150, -21411, -21377, -21301, -21028,
-    -20610, -20275, -19872, -19658, -19932, -20359, -20565, -20365, -19892, -19381, -19048, -18681,
-    -18326, -18280, -18447, -18799, -18781, -18439, -17844, -17485, -17518, -17525, -17405, -17393,
-    -17129, -16629, -16325, -15832, -15512, -15035, -14868, -14941, -14740, -14685, -14556, -13724,
-    -12880, -12063, -11468, -10807, -10233, -9874, -9665, -9093, -8563, -7333, -6125, -5618,
-    -5752, -6124, -5989, -5326, -4474, -3094, -1920, -1215, -614, -203, 201, 351,
-    170, 556, 1527, 3301, 4736, 5278, 5161, 4723, 4491, 4461, 4796, 5314,
-    6667, 8137, 9110, 9735, 10327, 10519, 11353, 12403, 12761, 13309, 14082, 14958,
-    15690, 16378, 16671, 17159, 17828, 18509, 19386, 19691, 19962, 20334, 20454, 20465,
-    20113, 20288, 21172, 22074, 23011, 23187, 22826, 22471, 21805, 21857, 21879, 22144,
-    22768, 23176, 23318, 23066, 22931, 22316, 21620, 21079, 21194, 21766, 21903, 22074,
-    21704, 21179, 20486, 19462, 18565, 18175, 18014, 18046, 18167, 17550, 16956, 16158,
-    15514, 14512, 13826, 13514, 13454, 13312, 13378, 13249, 12638, 11893, 11294, 10810,
-    10053, 9379, 8542, 7771, 7333, 6985, 6515, 5836, 5790, 6150, 6398, 5650,
-    3927, 2204, 1008, 518, 199, 80, 7, -252, -528, -810, -1768, -3075,
-    -4505, -5289, -5348, -5318, -4902, -5005, -5278, -5691, -6332, -7010, -7978, -8237,
-    -8072, -7641, -7349, -7406, -7980, -8761, -9467, -9547, -9487, -9341, -9324, -9802,
-    -10078, -10711, -11447, -12276, -13259, -14076, -14861, -15292, -16039, -16850, -17345, -17757,
-    -18211, -18512, -19099, -19233, -19554, -19901, -20283, -20719, -21587, -22547, -22726, -22893,
-    -22285, -21794, -21988, -22046, -22577, -22913, -23764, -24529, -24628, -24456, -23923, -23336,
-    -22766, -22328, -21959, -21977, -22562, -22880, -23023, -22865, -22180, -21506, -20776, -20323,
-    -20384, -20620, -20950, -20823, -20296, -19242, -18512, -17690, -17109, -16819, -16502, -16159,
-    -15571, -15180, -14449, -14257, -14113, -13463, -12938, -12656, -12539, -12116, -11648, -10777,
-    -9632, -8593, -8108, -7881, -7502, -7645, -7271, -6598, -5848, -4713, -3435, -2568,
-    -1826, -1446, -786, -482, -171, 237, 991, 2036, 3091, 3722, 4073, 4466,
-    4939, 5218, 5418, 5683, 6405, 6788, 7550, 7548, 7492, 7195, 7279, 7841,
-    8268, 8733, 8986, 8986, 9140, 9485, 9736, 10156, 10430, 10188, 10362, 10497,
-    10687, 11112, 11448, 11947, 12388, 13142, 14177, 15182, 16031, 16418, 16501, 16221,
-    16323, 16955, 17464, 18224, 19264, 20295, 21107, 21492, 21382, 20901, 20865, 21039,
-    21757, 22683, 23252, 23491, 24012, 24182, 24147, 23861, 23565, 23613, 23797, 24189,
-    24158, 24112, 23984, 24057, 24436, 24460, 24402, 24041, 23390, 23062, 22611, 22597,
-    22543, 22314, 22331, 21984, 21869, 21396, 20902, 20210, 19335, 18905, 18467, 18633,
-    18418, 18202, 18168, 17866, 17204, 16284, 15278, 14453, 13635, 13537, 13489, 13275,
-    12940, 12301, 11562, 10941, 10043, 9332, 8518, 7606, 7340, 7171, 7143, 7060,
-    6560, 5786, 4566, 3610, 2752, 1882, 1047, 451, 73, -453, -1030, -1398,
-    -2079, -2834, -3606, -4578, -5368, -5976, -6423, -6582, -6588, -6649, -6501, -6936,
-    -7716, -8060, -9009, -9492, -9952, -10428, -10436, -10569, -10545, -10701, -10708, -10801,
-    -10868, -10999, -11952, -12836, -13268, -13597, -13876, -13828, -13880, -13677, -13491, -13576,
-    -13920, -14374, -14807, -15043, -15279, -15608, -15735, -15971, -16089, -16211, -16231, -16757,
-    -17496, -17887, -17952, -18015, -18161, -18552, -18982, -19100, -19020, -19035, -19306, -19643,
-    -20323, -20529, -20587, -20397, -20347, -20134, -19974, -20341, -20583, -21256, -21948, -22245,
-    -22137, -21809, -21585, -21115, -20938, -21291, -21758, -21887, -21805, -21423, -20689, -20432,
-    -20463, -20384, -20445, -20239, -20358, -20209, -19690, -19147, -18376, -17828, -17668, -17751,
-    -17799, -17599, -17116, -16210, -15280, -14717, -14464, -14063, -13733, -13257, -13079, -13020,
-    -12654, -12032, -11038, -9805, -8778, -8316, -8211, -8342, -7957, -7396, -6755, -5745,
-    -5151, -4257, -3328, -2915, -2284, -1652, -736, 307, 902, 1509, 1992, 1874,
-    2627, 3455, 4191, 5191, 5747, 6025, 6267, 6880, 7247, 7355, 7644, 7507,
-    7357, 7615, 8008, 8783, 9446, 10149, 10391, 10296, 10106, 10117, 10294, 10378,
-    10816, 11354, 11735, 12016, 12081, 12135, 12092, 12103, 12417, 12437, 12863, 13419,
-    13759, 14045, 13971, 14380, 14529, 14609, 14851, 15241, 15747, 16257, 16386, 16746,
-    16611, 16690, 16895, 17315, 17496, 17427, 17548, 17794, 18062, 18758, 18822, 18638,
-    18401, 18069, 18534, 18939, 19605, 19706, 19258, 19212, 19239, 19524, 19587, 19681,
-    19997, 20385, 20999, 21224, 21098, 20775, 20263, 20070, 20017, 20459, 20840, 21186,
-    21352, 21251, 20990, 20623, 20111, 19715, 19695, 19980, 20098, 20121, 19964, 19437,
-    19480, 19360, 19284, 19092, 18512, 18125, 17790, 17345, 17038, 16792, 16541, 15939,
-    15623, 15206, 14354, 13627, 12837, 12179, 11742, 11523, 11512, 10912, 10093, 9199,
-    8103, 7616, 7421, 7736, 7759, 6857, 5900, 4849, 3767, 2875, 2088, 1863,
-    1494, 1211, 888, -32, -1231, -2403, -3240, -3641, -4087, -4590, -5085, -5708,
-    -6311, -6931, -7502, -7799, -7821, -7799, -8066, -8347, -8787, -9337, -9795, -10124,
-    -10076, -10130, -9964, -10218, -10708, -11111, -11522, -11653, -11830, -11969, -12112, -12150,
-    -12573, -12811, -13099, -13497, -13708, -13872, -14116, -14320, -14476, -14624, -15033, -15401,
-    -15219, -15133, -15107, -15246, -15726, -16498, -17165, -17610, -17607, -17444, -17198, -17240,
-    -17192, -17285, -17677, -18346, -18703, -19006, -19154, -19225, -19427, -19695, -19796, -19778,
-    -19831, -20046, -20367, -20630, -20757, -20564, -20501, -20332, -20332, -20360, -20404, -20596,
-    -20877, -20848, -20516, -20471, -20512, -20513, -20060, -19692, -19335, -19268, -19314, -19516,
-    -19889, -20030, -20052, -20100, -19542, -18936, -18129, -17304, -17086, -17585, -17938, -18452,
-    -18874, -18726, -17989, -17020, -15580, -14325, -14325, -14850, -15569, -16033, -16049, -15474,
-    -14494, -13329, -12291, -11492, -11016, -11164, -11486, -11815, -11978, -11470, -10418, -9271,
-    -8380, -7751, -7249, -7276, -7310, -7363, -7171, -6707, -5845, -4772, -3854, -3057,
-    -2150, -1628, -832, -230, 270, 989, 1738, 2474, 3364, 3972, 4443, 4910,
-    5050, 5587, 6063, 6362, 6637, 6905, 6859, 7030, 7155, 7852, 8471, 8646,
-    8844, 8784, 9053, 9270, 9744, 9835, 9438, 9544, 9670, 9892, 10209, 10342,
-    10855, 11077, 11137, 10744, 10225, 10107, 10438, 11201, 11972, 12329, 12646, 12513,
-    12077, 11869, 11711, 12038, 12167, 12651, 13156, 13572, 13721, 13855, 14033, 14172,
-    14333, 14847, 15418, 15537, 15675, 15885, 15744, 15834, 16404, 17126, 17936, 18383,
-    18458, 17956, 17616, 17533, 17786, 18247, 18850, 19553, 19951, 20130, 19888, 19417,
-    19137, 18919, 19031, 19401, 20180, 21073, 21583, 21795, 21370, 20778, 20315, 20130,
-    20275, 20773, 21274, 21843, 22149, 22194, 21961, 21554, 20924, 20395, 20297, 20296,
-    20510, 20665, 20721, 20537, 20064, 19576, 19028, 18913, 18937, 19053, 18809, 18186,
-    17665, 17093, 16893, 17026, 17051, 16988, 16605, 16077, 15341, 14738, 14197, 13701,
-    13537, 13721, 13528, 13228, 12758, 11980, 11185, 10575, 9762, 9027, 8727, 8654,
-    8460, 8204, 7526, 7031, 6291, 5280, 4523, 3984, 3456, 3218, 2868, 2031,
-    1223, 285, -808, -1825, -2576, -2984, -3361, -3619, -3986, -4730, -5523, -6220,
-    -6619, -6812, -6965, -7090, -7511, -7957, -8267, -8582, -8718, -9053, -9325, -9300,
-    -9620, -9863, -10206, -10771, -10998, -10954, -10947, -10894, -10787, -10781, -10924, -11156,
-    -11702, -12105, -12451, -12444, -12298, -12209, -12145, -12266, -12531, -12917, -13125, -13442,
-    -13567, -13565, -13648, -13772, -13702, -13757, -14042, -14450, -14780, -15258, -15242, -14655,
-    -14342, -14483, -14976, -15877, -16434, -16509, -16126, -15886, -15754, -15658, -16244, -16789,
-    -17677, -18253, -18399, -18092, -17444, -16993, -17004, -17322, -18060, -19062, -19796, -20178,
-    -20229, -20057, -19476, -19285, -19373, -19779, -20421, -21165, -21649, -21630, -21591, -21240,
-    -21164, -21388, -21382, -21728, -21675, -21473, -21624, -21527, -21355, -21153, -21308, -21169,
-    -21263, -21217, -21021, -21000, -21024, -20932, -20975, -21199, -21201, -21317, -21006, -20572,
-    -20436, -19928, -19316, -18724, -18363, -18625, -19383, -19728, -19384, -18952, -18066, -17202,
-    -16411, -15822, -15378, -15379, -15583, -15660, -15633, -15245, -14597, -13416, -12397, -11726,
-    -11428, -11380, -11442, -11374, -10993, -10440, -9608, -8745, -7872, -7258, -6721, -6430,
-    -6353, -6078, -5494, -4450, -3450, -2135, -564, 455, 1270, 1799, 1837, 2142,
-    2975, 3566, 4229, 5071, 5992, 6524, 6947, 7351, 7285, 7493, 7615, 7610,
-    8006, 8521, 9086, 9476, 9400, 9600, 9884, 10420, 11044, 11243, 11163, 11010,
-    10991, 11070, 11503, 12107, 12796, 13305, 13623, 13797, 13573, 13025, 12550, 12464,
-    12810, 13682, 14644, 15055, 15271, 15038, 14577, 13886, 13624, 13609, 13970, 14859,
-    15450, 15992, 16215, 16023, 15779, 15584, 15459, 15678, 15802, 16152, 16712, 17103,
-    17568, 17956, 17929, 17890, 18163, 18322, 18332, 18427, 18252, 18235, 18744, 19162,
-    19544, 19568, 19723, 19892, 20155, 20199, 19933, 19814, 19865, 20333, 20803, 21313,
-    21614, 21818, 22040, 21965, 21901, 21683, 21417, 21511, 21617, 22122, 22524, 22700,
-    22701, 22698, 22678, 22640, 22489, 22132, 22253, 22552, 22636, 22478, 22136, 21803,
-    21758, 21642, 21665, 21580, 21283, 21063, 20809, 20643, 20456, 20393, 20164, 20019,
-    20101, 19989, 19603, 19308, 19014, 18735, 18472, 18183, 18111, 17960, 17720, 17428,
-    17135, 16559, 15963, 15519, 15009, 14985, 14913, 14840, 14479, 13969, 13439, 12515,
-    11787, 11261, 10802, 10596, 10257, 10173, 10237, 10178, 9577, 8501, 7236, 6349,
-    6266, 6357, 6423, 6052, 5370, 4668, 3832, 2734, 1661, 768, 235, -328,
-    -663, -1459, -2233, -2877, -3713, -4613, -5334, -5823, -6205, -6349, -6402, -6904,
-    -7859, -8597, -9177, -9484, -9560, -9685, -9841, -10081, -10499, -10991, -11298, -11689,
-    -12019, -12594, -12864, -12803, -12753, -13079, -13485, -13726, -14129, -14436, -15127, -15567,
-    -15698, -15805, -15817, -16225, -16364, -16632, -16832, -16756, -16798, -17185, -17639, -17894,
-    -17906, -17673, -17839, -18223, -18693, -18748, -18648, -18571, -18709, -19066, -19173, -19591,
-    -19526, -19432, -19578, -19534, -19766, -19625, -19355, -19401, -19738, -20142, -20477, -20504,
-    -20415, -20315, -20368, -20197, -20051, -19881, -19934, -20197, -20409, -20619, -20490, -20340,
-    -20160, -20064, -19931, -19635, -19592, -19807, -19830, -20042, -20226, -19851, -19821, -19553,
-    -19348, -19205, -19049, -18961, -18900, -18958, -18796, -18673, -18528, -18434, -18212, -18161,
-    -18196, -18123, -18103, -18039, -18107, -18086, -17608, -16885, -16376, -16511, -16919, -17424,
-    -17239, -16862, -16049, -15477, -15043, -14420, -14284, -14422, -14873, -15384, -15294, -14624,
-    -13649, -12786, -12272, -12144, -12278, -12693, -12935, -12991, -12735, -12054, -11149, -10497,
-    -10131, -10156, -10583, -10808, -10978, -10608, -9964, -9387, -8910, -8286, -7662, -7434,
-    -7251, -7375, -7656, -7395, -6860, -6450, -6156, -5655, -5429, -5386, -4896, -4417,
-    -3949, -3275, -3020, -2824, -2400, -2060, -1547, -1115, -615, -153, 492, 1024,
-    1428, 2051, 2530, 2950, 3487, 3768, 4163, 4398, 4951, 5478, 5840, 6452,
-    6810, 7005, 7254, 7224, 7295, 7468, 8131, 8646, 9002, 9204, 9144, 8915,
-    8976, 9047, 9325, 9840, 10449, 11074, 11323, 11378, 11171, 11007, 11449, 11844,
-    12130, 12518, 12818, 13155, 13301, 13315, 13251, 13382, 13743, 14066, 14476, 14592,
-    14447, 14652, 14831, 15233, 15703, 16053, 16103, 16228, 16315, 16151, 15969, 15936,
-    16185, 16722, 17165, 17096, 17280, 17027, 16743, 17018, 17261, 17698, 18104, 17746,
-    17345, 17243, 17425, 17361, 17766, 18092, 18197, 18370, 18304, 17889, 17448, 17339,
-    17569, 17975, 18303, 18651, 18601, 18484, 18247, 17816, 17529, 17654, 17902, 18247,
-    18541, 18328, 18069, 17804, 17603, 17415, 17586, 17660, 17769, 17797, 17519, 17215,
-    17085, 16817, 16839, 16811, 16828, 17031, 17217, 17091, 16659, 16414, 16143, 15947,
-    15981, 15902, 15850, 15978, 16083, 16043, 15896, 15547, 15127, 14863, 14904, 14820,
-    14822, 14806, 14529, 14507, 14239, 13846, 13367, 13213, 13476, 13676, 13460, 12807,
-    12060, 11949, 12144, 12236, 11989, 11796, 11555, 11625, 11470, 10781, 10256, 10192,
-    10330, 10557, 10622, 10314, 9745, 9281, 8736, 8503, 8474, 8312, 8229, 8030,
-    7792, 7238, 6968, 6527, 6373, 6528, 6461, 6215, 5847, 5414, 5055, 4651,
-    4363, 4123, 4260, 4077, 3909, 3184, 2493, 2002, 1171, 701, 327, 393,
-    471, 568, 112, -560, -1332, -2090, -2714, -3083, -3336, -3492, -4053, -4164,
-    -4494, -5086, -5540, -5945, -6165, -6262, -6417, -7116, -7561, -7672, -7828, -7522,
-    -7357, -7598, -7918, -8217, -8628, -9022, -9313, -9406, -9358, -9405, -9353, -9445,
-    -9932, -10556, -10940, -11368, -11552, -11477, -11513, -11197, -11387, -11922, -12465, -12972,
-    -13074, -13052, -12947, -13289, -13500, -13667, -13643, -13690, -13965, -14224, -14356, -14316,
-    -14345, -14709, -14879, -14866, -15060, -14974, -15248, -15474, -15623, -15604, -15901, -15864,
-    -16185, -16562, -16472, -16559, -16474, -16659, -17064, -17110, -17292, -17162, -17289, -17567,
-    -17730, -17840, -17714, -17876, -17692, -17946, -18314, -18478, -18827, -18778, -18836, -18877,
-    -18650, -18460, -18357, -18464, -18580, -19058, -19311, -19216, -19414, -19534, -19524, -19405,
-    -19408, -19405, -19474, -19487, -19414, -19232, -19523, -19744, -19930, -20033, -19957, -19812,
-    -19560, -19377, -19236, -19350, -19596, -19664, -19769, -19852, -19753, -19460, -19063, -18735,
-    -18682, -18779, -19000, -19034, -18882, -18823, -18598, -18205, -17957, -17723, -17523, -17549,
-    -17525, -17473, -17388, -17164, -16829, -16556, -16279, -15928, -15731, -15477, -15128, -14893,
-    -14945, -14762, -14321, -13987, -13346, -13152, -13034, -12876, -12601, -12284, -11941, -11656,
-    -11325, -10836, -10536, -10208, -9766, -9492, -9001, -8459, -8146, -8037, -7807, -7703,
-    -7390, -6972, -6482, -5628, -5114, -4631, -4001, -3509, -2803, -2306, -2045, -1675,
-    -853, 189, 1219, 2154, 2532, 2875, 3189, 3767, 4196, 4711, 5245, 5858,
-    6543, 7002, 7253, 7384, 7587, 7941, 8248, 8552, 9091, 9442, 9759, 10072,
-    10266, 10524, 10667, 10980, 11206, 11597, 11736, 12054, 12335, 12535, 12914, 13155,
-    13418, 13547, 13704, 13712, 13760, 13819, 14051, 14317, 14640, 14908, 15132, 15083,
-    15087, 15132, 15233, 15592, 15853, 15853, 16100, 16347, 16487, 16586, 16488, 16607,
-    16500, 16852, 17186, 17358, 17765, 17737, 17615, 17287, 17159, 17095, 17107, 17444,
-    17818, 18189, 18285, 18243, 17931, 17803, 17866, 17866, 17801, 17860, 17922, 18059,
-    18315, 18360, 18384, 18260, 18225, 18273, 18238, 18334, 18248, 18492, 18702, 18762,
-    18763, 18704, 18642, 18552, 18528, 18475, 18450, 18584, 18783, 18783, 18750, 18692,
-    18888, 19083, 19146, 18907, 18601, 18459, 18529, 18717, 18915, 18869, 18914, 18966,
-    18862, 18910, 18775, 18432, 18443, 18663, 18670, 18900, 18914, 18762, 18700, 18369,
-    17860, 17640, 17663, 17673, 17854, 18020, 18137, 18058, 17784, 17559, 17100, 16651,
-    16534, 16681, 16851, 17005, 17241, 17085, 16907, 16670, 16044, 15690, 15376, 15014,
-    15162, 15277, 15225, 15058, 14675, 14345, 14126, 13775, 13051, 12806, 12615, 12631,
-    12828, 12511, 12062, 11682, 11347, 11111, 10904, 10488, 9979, 9642, 9338, 9112,
-    9022, 8780, 8544, 8226, 7923, 7553, 6792, 6079, 5497, 5121, 5095, 5048,
-    4687, 4075, 3406, 2621, 1769, 822, 30, -576, -679, -749, -1194, -1936,
-    -2825, -3618, -4211, -4889, -5514, -6054, -6347, -6327, -6570, -6838, -7276, -7847,
-    -8148, -8480, -8987, -9457, -9740, -9735, -9943, -10247, -10635, -11059, -11526, -11776,
-    -12024, -12393, -12575, -12663, -12996, -13285, -13322, -13652, -14062, -14143, -14270, -14413,
-    -14514, -14753, -15243, -15529, -15441, -15614, -15677, -15711, -15836, -16077, -16302, -16629,
-    -17011, -17049, -16969, -16850, -16792, -16959, -17077, -17438, -17837, -18154, -18477, -18341,
-    -18175, -18302, -18397, -18432, -18381, -18367, -18432, -18682, -18966, -18895, -18775, -18819,
-    -18671, -18639, -18637, -18408, -18539, -18684, -18931, -19021, -18913, -18913, -18798, -18854,
-    -18937, -18985, -19198, -19230, -19034, -18835, -18796, -18797, -18822, -18992, -19057, -19223,
-    -19524, -19499, -19095, -18727, -18386, -18246, -18670, -18998, -19210, -19266, -19152, -18874,
-    -18418, -18136, -17893, -17992, -18236, -18489, -18701, -18605, -18329, -18025, -17792, -17513,
-    -17431, -17609, -17703, -17908, -17957, -17688, -17605, -17514, -17280, -16990, -16849, -16951,
-    -16954, -16919, -16746, -16580, -16513, -16392, -16361, -16068, -15626, -15406, -15125, -15042,
-    -15122, -14937, -14876, -14830, -14489, -14193, -14041, -13762, -13518, -13326, -13102, -13024,
-    -13098, -13144, -12904, -12843, -12543, -11950, -11538, -11177, -11152, -10988, -10891, -10946,
-    -10745, -10666, -10359, -9878, -9480, -9024, -8778, -8625, -8372, -8117, -7916, -7588,
-    -7296, -7160, -6654, -6133, -5842, -5658, -5534, -5478, -5208, -4612, -4180, -3585,
-    -3033, -2526, -1885, -1319, -902, -492, -43, 289, 793, 1308, 1694, 2285,
-    2944, 3731, 4442, 5020, 5500, 5642, 5603, 5679, 5951, 6296, 6801, 7360,
-    7721, 8146, 8591, 8908, 9131, 9183, 9186, 9428, 9768, 10033, 10548, 10876,
-    11242, 11609, 11705, 11903, 12173, 12658, 12825, 12894, 13168, 13327, 13838, 14361,
-    14677, 14971, 15218, 15523, 15650, 15585, 15468, 15655, 16109, 16534, 16973, 17262,
-    17325, 17375, 17494, 17485, 17577, 17641, 17622, 17916, 18046, 18382, 18711, 18652,
-    18769, 18802, 18767, 18802, 18824, 18939, 19053, 19450, 19814, 19926, 19925, 19660,
-    19397, 19328, 19210, 19315, 19559, 19733, 19839, 19854, 19751, 19523, 19262, 19181,
-    19052, 18968, 19134, 19023, 18903, 18847, 18677, 18691, 18796, 18629, 18384, 18155,
-    18016, 18105, 18056, 17760, 17479, 17508, 17607, 17626, 17569, 17245, 16869, 16740,
-    16714, 16472, 16260, 16144, 16209, 16173, 16037, 16063, 15841, 15452, 15148, 14763,
-    14565, 14563, 14459, 14421, 14395, 14236, 14149, 14071, 13725, 13297, 13035, 12780,
-    12853, 13086, 12944, 12905, 12921, 12726, 12590, 12382, 12009, 11864, 11714, 11673,
-    11823, 11962, 12037, 12026, 11784, 11630, 11325, 10981, 10758, 10500, 10422, 10540,
-    10602, 10565, 10657, 10372, 10067, 9935, 9816, 9725, 9585, 9197, 8875, 8814,
-    8984, 9124, 9223, 9053, 8611, 8359, 8087, 7681, 7527, 7550, 7637, 7860,
-    7821, 7464, 7131, 6680, 6335, 6077, 5869, 5836, 5860, 5850, 5705, 5350,
-    4873, 4291, 3618, 3033, 2711, 2563, 2554, 2336, 1817, 1337, 876, 358,
-    -78, -387, -787, -1085, -1335, -1824, -2242, -2687, -3336, -3826, -4214, -4470,
-    -4676, -4978, -5332, -5710, -6051, -6293, -6569, -6898, -7187, -7628, -7839, -8058,
-    -8239, -8341, -8622, -8877, -9178, -9377, -9311, -9483, -9803, -10312, -10828, -10958,
-    -10979, -11061, -11222, -11438, -11544, -11589, -11922, -12459, -12820, -12876, -12822, -12813,
-    -12779, -13069, -13231, -13364, -13737, -13902, -14083, -14264, -14267, -14294, -14353, -14456,
-    -14471, -14613, -14867, -15055, -15194, -15319, -15427, -15492, -15559, -15536, -15489, -15649,
-    -15828, -15811, -15829, -15971, -16020, -16172, -16343, -16354, -16491, -16475, -16447, -16447,
-    -16467, -16515, -16615, -16686, -16701, -16781, -16837, -17018, -17072, -16902, -16877, -17005,
-    -17012, -17016, -16925, -16724, -16809, -17193, -17356, -17241, -17224, -16988, -16712, -16682,
-    -16745, -16819, -17010, -17138, -17166, -17186, -16925, -16726, -16500, -16383, -16463, -16498,
-    -16672, -16767, -16733, -16603, -16506, -16183, -15952, -15967, -15886, -15870, -15858, -15732,
-    -15570, -15434, -15323, -15230, -15073, -14914, -14857, -14759, -14549, -14308, -14079, -14075,
-    -14062, -13855, -13733, -13517, -13255, -13035, -12709, -12502, -12439, -12377, -12392, -12277,
-    -12090, -11765, -11304, -10892, -10654, -10349, -10360, -10307, -10193, -10089, -9681, -9379,
-    -9006, -8571, -8370, -8282, -8174, -8110, -7890, -7453, -7073, -6798, -6565, -6346,
-    -6226, -6088, -5831, -5556, -5267, -5047, -4790, -4530, -4218, -3868, -3554, -3244,
-    -2911, -2572, -2375, -2045, -1714, -1366, -1101, -757, -610, -403, -90, 288,
-    648, 900, 1256, 1529, 1753, 1821, 1800, 1904, 2253, 2682, 2989, 3336,
-    3653, 3804, 3980, 4124, 4086, 4257, 4526, 4739, 5173, 5323, 5427, 5637,
-    5662, 5746, 5858, 5949, 6157, 6373, 6586, 6754, 6752, 6805, 6803, 6916,
-    6994, 7138, 7321, 7315, 7412, 7718, 7848, 7963, 8109, 8125, 8298, 8295,
-    8258, 8394, 8500, 8783, 9116, 9287, 9435, 9589, 9676, 9730, 9767, 9738,
-    9869, 10157, 10398, 10603, 10645, 10823, 10964, 10963, 11065, 11117, 11161, 11316,
-    11550, 11717, 11929, 12208, 12364, 12571, 12632, 12582, 12628, 12667, 12700, 12793,
-    13105, 13300, 13667, 13900, 13988, 14060, 13928, 13873, 13840, 13905, 14114, 14392,
-    14719, 14942, 15120, 15225, 15078, 15052, 14979, 15095, 15440, 15663, 15749, 15883,
-    15922, 15985, 16049, 15971, 16038, 16102, 16196, 16347, 16423, 16442, 16560, 16673,
-    16842, 16838, 16751, 16571, 16637, 16743, 16782, 17014, 17259, 17374, 17424, 17375,
-    17290, 17209, 17070, 17107, 17193, 17308, 17434, 17561, 17530, 17494, 17487, 17481,
-    17475, 17434, 17445, 17455, 17468, 17495, 17462, 17411, 17308, 17307, 17367, 17190,
-    17120, 17127, 17031, 16895, 16892, 16593, 16490, 16499, 16306, 16369, 16422, 16292,
-    16149, 15905, 15581, 15398, 15357, 15312, 15367, 15384, 15304, 15114, 14765, 14369,
-    14040, 13883, 13832, 13881, 13750, 13514, 13267, 12903, 12598, 12252, 11963, 11809,
-    11737, 11510, 11140, 10849, 10412, 9984, 9679, 9378, 9258, 9132, 8828, 8372,
-    7945, 7406, 7037, 6769, 6399, 6182, 5813, 5445, 5051, 4392, 3785, 3142,
-    2560, 1964, 1347, 773, 124, -511, -1169, -1809, -2580, -3325, -3912, -4602,
-    -5033, -5330, -5655, -6143, -6752, -7395, -7871, -8107, -8405, -8675, -8951, -9298,
-    -9749, -10133, -10576, -11138, -11413, -11594, -11806, -12001, -12354, -12801, -13188, -13486,
-    -13785, -14066, -14217, -14441, -14795, -15067, -15308, -15640, -15998, -16372, -16627, -16684,
-    -16769, -16981, -17313, -17781, -18055, -18267, -18313, -18430, -18491, -18472, -18414, -18558,
-    -18916, -19181, -19468, -19604, -19598, -19598, -19418, -19336, -19462, -19512, -19731, -19900,
-    -20035, -20111, -20127, -20157, -20089, -19982, -20082, -20230, -20284, -20255, -20154, -20149,
-    -20143, -20153, -20082, -20080, -20069, -20058, -19912, -19723, -19608, -19559, -19456, -19538,
-    -19465, -19349, -19321, -19105, -18860, -18594, -18405, -18426, -18447, -18403, -18346, -18217,
-    -18042, -17840, -17554, -17404, -17399, -17247, -17166, -17055, -16923, -16855, -16708, -16539,
-    -16352, -16093, -15801, -15594, -15256, -14968, -14974, -14932, -14883, -14788, -14499, -14163,
-    -13806, -13469, -13177, -12998, -12932, -12785, -12632, -12558, -12324, -12112, -11808, -11574,
-    -11391, -11206, -11035, -10781, -10572, -10411, -10287, -10162, -9920, -9794, -9622, -9389,
-    -9180, -8790, -8520, -8246, -7960, -7718, -7578, -7476, -7372, -7171, -6897, -6483,
-    -6117, -5803, -5680, -5586, -5491, -5431, -5303, -5016, -4655, -4250, -3885, -3674,
-    -3499, -3373, -3182, -2915, -2568, -2313, -2007, -1701, -1500, -1324, -1109, -942,
-    -676, -432, -233, -1, 208, 457, 675, 898, 1037, 1301, 1391, 1566,
-    1699, 1837, 1954, 2056, 2215, 2409, 2558, 2749, 2771, 2893, 3054, 3246,
-    3176, 3036, 3129, 3250, 3568, 3743, 3897, 4053, 4142, 4180, 4097, 4011,
-    4128, 4239, 4548, 4862, 5039, 5153, 5213, 5138, 5014, 5090, 5177, 5341,
-    5409, 5519, 5670, 5868, 5763, 5689, 5583, 5621, 5761, 5870, 5970, 6075,
-    6192, 6350, 6365, 6410, 6534, 6525, 6690, 6879, 7035, 7129, 7338, 7415,
-    7525, 7732, 7830, 7980, 8099, 8209, 8400, 8590, 8756, 8952, 9194, 9374,
-    9526, 9702, 9853, 10015, 10093, 10235, 10350, 10519, 10797, 11003, 11324, 11520,
-    11700, 11893, 11982, 12143, 12243, 12427, 12775, 13090, 13319, 13571, 13773, 13852,
-    14021, 14312, 14530, 14851, 15253, 15419, 15513, 15583, 15607, 15747, 16030, 16354,
-    16652, 16880, 17159, 17225, 17154, 17017, 17094, 17236, 17370, 17647, 17808, 17885,
-    18108, 18179, 18143, 18164, 18242, 18327, 18480, 18634, 18630, 18631, 18655, 18577,
-    18594, 18718, 18743, 18771, 18808, 18771, 18721, 18583, 18442, 18331, 18236, 18247,
-    18257, 18113, 18007, 17875, 17714, 17540, 17268, 17063, 16894, 16730, 16583, 16356,
-    16119, 15932, 15841, 15679, 15477, 15219, 14776, 14433, 14221, 13981, 13809, 13576,
-    13308, 13135, 13001, 12823, 12549, 12193, 11826, 11453, 11109, 10867, 10574, 10290,
-    10135, 9897, 9589, 9341, 9136, 8774, 8356, 8065, 7721, 7400, 7158, 6889,
-    6649, 6427, 6119, 5742, 5364, 4924, 4556, 4239, 3839, 3344, 2881, 2459,
-    2008, 1577, 1124, 817, 557, 286, -127, -516, -788, -1278, -1714, -2042,
-    -2413, -2746, -3092, -3397, -3557, -3997, -4430, -4674, -4960, -5143, -5378, -5602,
-    -5912, -6069, -6207, -6263, -6474, -6573, -6764, -6958, -7100, -7355, -7575, -7759,
-    -7881, -7909, -7909, -8033, -8175, -8295, -8498, -8540, -8632, -8705, -8788, -8996,
-    -9210, -9415, -9486, -9458, -9703, -9878, -10052, -10138, -10121, -10186, -10223, -10161,
-    -10355, -10444, -10675, -10754, -10999, -11170, -11050, -11096, -11013, -11235, -11010, -11174,
-    -11300, -11219, -11017, -8977, -7110, -7254, -7197, -7291, -7601, -7538, -8190, -7828,
-    -8274, -8500, -9077, -9112, -9655, -9907, -9616, -9835, -10017, -9966, -9902, -9416,
-    -9917, -10579, -10918, -10291, -10126, -9370, -9025, -8377, -7724, -6943, -6581, -6329,
-    -7226, -8764, -11073, -13000, -15184, -17680, -19735, -21524, -21723, -21344, -22786, -24847,
-    -28556, -28014, -24580, -22025, -20809, -18598, -13764, -9317, -5799, -8034, -5924, -1694,
-    -234, -2067, 24, 5092, 5516, 5541, 2610, -5956, -18709, -26370, -11415, -3963,
-    -12876, -14533, -13887, -13620, -14604, -12654, -13128, -15732, -13290, -6904, 4678, 6696,
-    8098, 7278, 6452, 4963, 1842, -1745, -4332, -6917, -9389, -11882, -13172, -14505,
-    -15975, -17034, -18626, -19399, -20191, -20823, -21178, -21377, -22452, -22359, -22344, -22806,
-    -22604, -22552, -21487, -21292, -20982, -20552, -19724, -19149, -18868, -18049, -16746, -14970,
-    -12902, -13822, -16281, -17288, -17136, -16393, -15816, -15078, -13896, -11866, -9463, -6708,
-    -3036, 438, 4382, 6489, 9185, 11482, 13138, 14505, 15332, 16203, 17110, 18101,
-    18886, 19402, 19766, 20257, 20334, 19924, 20031, 20328, 20462, 19862, 19775, 19483,
-    19411, 18890, 18682, 18239, 18011, 17569, 17361, 16883, 16799, 16296, 15334, 14258,
-    13694, 13345, 14123, 15259, 15666, 16077, 15883, 15105, 14533, 14227, 12895, 10715,
-    8461, 6089, 3177, -307, -3014, -5719, -7103, -8334, -9182, -10177, -11211, -12136,
-    -13162, -13767, -14016, -14355, -14645, -14713, -15398, -15338, -15361, -15207, -15217, -14915,
-    -15076, -14483, -14082, -13408, -12275, -10911, -10843, -11551, -12266, -12877, -13033, -12981,
-    -12238, -11588, -10715, -10259, -9301, -7581, -4769, -1054, 2469, 5637, 7834, 9522,
-    10999, 12286, 13437, 14723, 16067, 16782, 17335, 18120, 18305, 18834, 19121, 19579,
-    19783, 20349, 20650, 20523, 20239, 19858, 19588, 19592, 19190, 18780, 18495, 18263,
-    18255, 17696, 17052, 16357, 16284, 16054, 15370, 14265, 13664, 13657, 14295, 15442,
-    16533, 17258, 17500, 17638, 16745, 15219, 13274, 11138, 8807, 6502, 4000, 1253,
-    -1207, -3430, -5375, -6739, -7963, -9201, -10472, -11666, -12315, -12539, -12592, -12713,
-    -13226, -13880, -14250, -14588, -14475, -14601, -14760, -14823, -14532, -14124, -13929, -13279,
-    -12760, -12283, -11808, -11244, -10470, -9668, -9053, -8620, -7541, -6583, -6252, -6712,
-    -7512, -8204, -8520, -8505, -8828, -9110, -9242, -8390, -6819, -4881, -2049, 1188,
-    4309, 6708, 8636, 10248, 11577, 13049, 14373, 15598, 16558, 17429, 18285, 18895,
-    19399, 19805, 19983, 19821, 19486, 19325, 19369, 19316, 18983, 18381, 17938, 17699,
-    17387, 16961, 16297, 15680, 15160, 14595, 13964, 13440, 12691, 11887, 10995, 10160,
-    8972, 7960, 7015, 6221, 5389, 4956, 5232, 5618, 5917, 6456, 7089, 7338,
-    7374, 7552, 7395, 6293, 4201, 1334, -2164, -5571, -8042, -9807, -11594, -13216,
-    -14598, -15808, -17045, -17744, -18344, -19054, -19732, -20352, -20462, -20029, -19623, -19394,
-    -19274, -18939, -19112, -18995, -18560, -18200, -17830, -17536, -17112, -16514, -16116, -15356,
-    -14624, -13751, -12774, -11832, -10918, -10311, -9837, -9532, -8880, -7944, -6960, -6045,
-    -5755, -5982, -6112, -6219, -6162, -6470, -6965, -7325, -7409, -6897, -6495, -5519,
-    -3976, -1594, 1474, 4464, 6857, 8826, 10455, 12022, 13346, 14701, 15749, 16619,
-    17451, 17776, 18351, 18729, 19199, 19552, 19645, 19553, 19565, 19570, 19534, 19289,
-    19010, 18526, 18072, 17589, 17134, 16606, 15959, 15261, 14663, 13886, 13293, 12674,
-    11870, 10916, 10118, 9239, 8245, 7468, 6689, 6158, 5741, 5045, 3933, 2788,
-    1619, 337, -858, -1573, -1823, -1862, -1896, -1863, -1602, -1642, -1785, -2176,
-    -2583, -2847, -3099, -3508, -4961, -6566, -8085, -9773, -11615, -13292, -14797, -15991,
-    -17107, -18242, -19366, -20114, -20708, -21169, -21570, -21683, -21831, -21960, -22053, -22105,
-    -21901, -21616, -21072, -20650, -20025, -19629, -19234, -18659, -18032, -17265, -16538, -15835,
-    -15126, -14355, -13471, -12627, -11890, -11102, -10431, -9947, -9389, -8581, -7789, -6867,
-    -5995, -5338, -4675, -3746, -2411, -958, -145, 129, 55, 26, -11, 237,
-    450, 507, 769, 1527, 2630, 3798, 4770, 5590, 6718, 8158, 9693, 11235,
-    12933, 14626, 16177, 17475, 18759, 19789, 20683, 21466, 21895, 22234, 22578, 22941,
-    23133, 23270, 23172, 22856, 22610, 22307, 22046, 21769, 21339, 20802, 20183, 19183,
-    18276, 17480, 16686, 15973, 15159, 14382, 13642, 12903, 12221, 11320, 10519, 9753,
-    8999, 8337, 7403, 6440, 5743, 5161, 4219, 3161, 2102, 1005, 112, -740,
-    -1872, -2952, -4109, -5006, -5247, -5229, -5176, -5258, -5394, -5624, -5832, -6227,
-    -6592, -7167, -7752, -8305, -8762, -9171, -9671, -10069, -10276, -10809, -11791, -13066,
-    -14164, -15328, -16508, -17666, -18783, -19737, -20576, -21079, -21513, -21836, -21955, -21934,
-    -21822, -21822, -21848, -21758, -21235, -20586, -20019, -19538, -19106, -18461, -17923, -17359,
-    -16837, -16217, -15691, -15299, -14609, -14058, -13274, -12358, -11659, -10852, -10131, -9230,
-    -8491, -7581, -6619, -6009, -5243, -4508, -3349, -2076, -978, 280, 1404, 2469,
-    3671, 4630, 5395, 5913, 6595, 7474, 7906, 8110, 7853, 7709, 7660, 7438,
-    7304, 7346, 7635, 8069, 8613, 9276, 9825, 10441, 11015, 11419, 12034, 12799,
-    13932, 15347, 16540, 17838, 19047, 19891, 20719, 21322, 21875, 22424, 23182, 23639,
-    23713, 23620, 23355, 23168, 22742, 22035, 21352, 20893, 20313, 19731, 18955, 18156,
-    17451, 16961, 16262, 15566, 14945, 14152, 13695, 13068, 12146, 11481, 10817, 9645,
-    8624, 8042, 7427, 6908, 6241, 4725, 3275, 2275, 1571, 867, -102, -1488,
-    -2446, -3296, -4381, -5484, -6407, -7204, -7714, -7955, -8349, -8947, -9727, -10525,
-    -10816, -10857, -10939, -11074, -11099, -11192, -11103, -11095, -11425, -11795, -12249, -12537,
-    -12560, -12690, -13124, -13789, -14288, -14867, -15264, -15731, -16427, -16646, -16663, -16627,
-    -16639, -16987, -16903, -17254, -17801, -18254, -18705, -19186, -19532, -19692, -19742, -19989,
-    -20152, -20038, -19575, -18795, -18058, -17357, -16614, -16133, -15601, -15296, -14865, -14251,
-    -13614, -13047, -12593, -12191, -11787, -11283, -10752, -10307, -9553, -8538, -7571, -6983,
-    -6167, -4939, -3499, -1994, -1195, -766, 45, 1219, 2502, 4030, 4942, 5665,
-    6515, 7148, 7701, 8255, 8676, 9396, 10447, 11337, 11896, 12286, 12607, 12959,
-    13232, 13713, 14410, 15260, 15407, 15232, 15268, 15291, 15132, 14667, 14284, 14174,
-    14328, 14485, 14529, 14588, 14860, 15231, 15342, 15181, 15227, 15680, 16096, 16716,
-    17547, 18121, 19009, 19692, 20150, 20730, 21362, 21954, 22142, 21739, 21137, 20356,
-    19644, 18857, 18216, 17447, 16742, 16310, 15967, 15339, 14736, 13866, 13418, 13116,
-    12894, 12216, 11554, 10901, 10118, 9615, 9264, 8684, 8249, 7865, 7212, 6916,
-    6541, 5415, 4971, 4747, 4043, 3101, 1274, -1101, -2687, -3670, -4342, -4671,
-    -5899, -7095, -7871, -8475, -9277, -10424, -11624, -12191, -12122, -11995, -12540, -13598,
-    -14590, -15434, -15826, -16105, -16721, -16743, -16590, -16719, -16981, -17508, -17780, -17963,
-    -18045, -17878, -17492, -17215, -16951, -16986, -17085, -17035, -17150, -17301, -17388, -17254,
-    -17034, -16992, -17007, -17220, -17304, -17217, -17355, -17618, -17569, -17502, -17482, -17449,
-    -17473, -17545, -17513, -17570, -17516, -17437, -17586, -17783, -18033, -17997, -17511, -16987,
-    -16526, -15949, -15131, -14529, -13817, -13286, -12740, -12130, -11730, -11314, -10750, -10439,
-    -9836, -9260, -8807, -8270, -7843, -7369, -6771, -6449, -6054, -5370, -4389, -3323,
-    -2743, -2663, -2496, -1527, 169, 2208, 3931, 5176, 6196, 7102, 7910, 8590,
-    8845, 9400, 10481, 11904, 13018, 13340, 13251, 13450, 14118, 15045, 15476, 15778,
-    16203, 16980, 17764, 18113, 18156, 18108, 18108, 18433, 18938, 19286, 19611, 19695,
-    19729, 19879, 19963, 19887, 19399, 18799, 18494, 18702, 18942, 18777, 18556, 18378,
-    18262, 18045, 17768, 17579, 17421, 17321, 17332, 17370, 17264, 17175, 16987, 16746,
-    16601, 16610, 16602, 16675, 16902, 16823, 16712, 16734, 16708, 16623, 16379, 15642,
-    15089, 14565, 14173, 13920, 13332, 12638, 11938, 11376, 10837, 10124, 9420, 8881,
-    8620, 8544, 8154, 7200, 6537, 6186, 6054, 6144, 5530, 4265, 3266, 2532,
-    2198, 2322, 1776, 573, 164, -263, -567, -1592, -3690, -5568, -6534, -6684,
-    -6747, -7651, -8978, -10072, -10694, -11221, -12032, -13101, -13906, -14227, -14106, -14496,
-    -15413, -16460, -17420, -17821, -18172, -18615, -18881, -19257, -19507, -19657, -19925, -20262,
-    -20688, -21281, -21665, -21580, -21463, -21517, -21612, -21861, -21783, -21415, -21306, -20999,
-    -20721, -20477, -20294, -19869, -19537, -19428, -19298, -19172, -19168, -18938, -18511, -18066,
-    -17946, -17858, -17810, -17456, -17180, -17009, -17022, -16836, -16558, -16201, -15754, -15585,
-    -15382, -15211, -15019, -14728, -14452, -13976, -13332, -12493, -11674, -11093, -10555, -10177,
-    -10189, -9854, -9052, -8106, -6900, -6444, -6863, -6966, -6663, -6015, -4697, -3714,
-    -3257, -2569, -1829, -1086, -562, -402, -319, 466, 1717, 2896, 3429, 3349,
-    3362, 3944, 4699, 4921, 5300, 5833, 6894, 8253, 9105, 9482, 10012, 10421,
-    11075, 11995, 12826, 13682, 14380, 14883, 15319, 15828, 16207, 16661, 17126, 17605,
-    18356, 18954, 19407, 19835, 20191, 20344, 20588, 20899, 20995, 21084, 21361, 21582,
-    21822, 22150, 22196, 22222, 22361, 22292, 22238, 22029, 21856, 22023, 22167, 22359,
-    22327, 22164, 21832, 21466, 21139, 20791, 20739, 20817, 20830, 20970, 20856, 19966,
-    18926, 18191, 17742, 17468, 17055, 16327, 15956, 15762, 15364, 15052, 14297, 13540,
-    13362, 13360, 13426, 13061, 11808, 10624, 10066, 9714, 9779, 9592, 8902, 8284,
-    8019, 7670, 6911, 5865, 4962, 4399, 4287, 4408, 4076, 3049, 1721, 715,
-    346, -195, -1072, -1855, -2292, -2530, -2797, -3839, -4746, -5298, -5525, -5446,
-    -5583, -5984, -6362, -6681, -7027, -7249, -7317, -7518, -7822, -8143, -8531, -8740,
-    -8884, -9104, -9082, -9097, -9238, -9490, -9936, -10826, -11668, -12468, -13088, -13511,
-    -13887, -14551, -15535, -16535, -17328, -17829, -18423, -19049, -19478, -19771, -19944, -20315,
-    -20849, -21695, -22316, -22556, -22605, -22401, -22572, -23008, -23238, -23431, -23635, -23766,
-    -24011, -24333, -24104, -23642, -23374, -23313, -23481, -23612, -23470, -23107, -23190, -23232,
-    -22798, -22124, -21365, -21226, -21878, -22229, -22038, -21516, -20500, -19730, -19404, -18928,
-    -18679, -18322, -17857, -17656, -17332, -16504, -15427, -14334, -13846, -14117, -14183, -13819,
-    -13272, -12927, -12541, -12060, -11069, -10045, -9575, -9650, -9404, -8842, -8199, -7548,
-    -6988, -6486, -5969, -5383, -4648, -3911, -3395, -2896, -2209, -1292, -332, 566,
-    1187, 1721, 2407, 2952, 3506, 3983, 4369, 4934, 5461, 5845, 6247, 6610,
-    6923, 7248, 7570, 7508, 7575, 7795, 8130, 8475, 8888, 9216, 9508, 9803,
-    9741, 9554, 9367, 9503, 10170, 11065, 11558, 11880, 12244, 12312, 12545, 13050,
-    13434, 14153, 15218, 16148, 16753, 17063, 16924, 17078, 17577, 18265, 18955, 19424,
-    20082, 20910, 21677, 22018, 21786, 21375, 21292, 21646, 22759, 23726, 23904, 23631,
-    23499, 23700, 24047, 23952, 23552, 23555, 24026, 24751, 25079, 24539, 23989, 23782,
-    23814, 23892, 23821, 23677, 23633, 23601, 23453, 23162, 22678, 22108, 21746, 21499,
-    21214, 20973, 20569, 19990, 19511, 19103, 18718, 18218, 17567, 16914, 16428, 16293,
-    15916, 15289, 14721, 14034, 13454, 12940, 12309, 11804, 11391, 10880, 10490, 10016,
-    9470, 8814, 8051, 7207, 6640, 6280, 5923, 5635, 5115, 4132, 3252, 2472,
-    1248, 436, -157, -919, -1134, -1451, -2175, -2904, -4016, -5009, -5638, -5871,
-    -5973, -6290, -6418, -6672, -7181, -7607, -8491, -8978, -9040, -8950, -8718, -9229,
-    -9806, -9843, -9945, -10048, -10468, -11269, -11947, -12245, -12063, -11674, -11661, -12237,
-    -12918, -13395, -13582, -13693, -14065, -14613, -14665, -14513, -14305, -14535, -15264, -15928,
-    -16043, -15702, -15752, -16305, -16628, -16746, -16697, -16734, -17205, -17708, -17957, -18031,
-    -18078, -18200, -18321, -18494, -18861, -19151, -19353, -19459, -19702, -19960, -20248, -20373,
-    -20353, -20522, -20897, -21130, -21178, -21244, -21416, -21427, -21479, -21851, -21602, -21278,
-    -21341, -21318, -21381, -21458, -21033, -20692, -20585, -20599, -20694, -20453, -20095, -19456,
-    -19030, -18999, -18891, -18392, -17962, -17729, -17548, -17314, -16867, -16220, -15861, -15869,
-    -15611, -14958, -14210, -13624, -13295, -12917, -12496, -11911, -11372, -10897, -10454, -9840,
-    -9091, -8756, -8185, -7444, -6775, -5931, -5436, -5377, -5132, -4325, -3224, -2080,
-    -1067, -426, 95, 695, 1395, 1942, 2274, 2545, 3263, 4445, 5489, 5797,
-    5571, 5389, 5824, 6663, 6963, 6874, 7043, 7476, 8107, 8377, 8141, 8084,
-    8482, 9002, 9342, 9570, 9585, 9672, 9975, 10336, 10601, 10802, 11232, 11509,
-    11717, 12168, 12370, 12238, 12276, 12487, 12985, 13543, 13788, 14092, 14038, 14091,
-    14328, 14499, 14964, 15518, 15833, 16051, 16183, 16259, 16442, 16659, 16727, 16848,
-    17305, 17715, 17930, 17958, 17922, 18063, 18266, 18494, 18416, 18463, 18722, 19042,
-    19300, 19193, 18994, 18970, 19202, 19448, 19566, 19494, 19699, 19985, 20173, 20055,
-    19900, 19746, 19653, 20094, 20191, 20173, 20380, 20472, 20606, 20642, 20201, 19752,
-    19816, 19879, 20249, 20709, 20417, 19794, 19413, 19199, 19245, 19159, 18775, 18522,
-    18679, 18682, 18063, 17177, 16222, 15830, 15977, 15694, 14937, 14382, 13762, 13492,
-    13343, 12651, 11971, 11297, 10625, 10105, 9517, 8944, 8400, 8035, 7594, 7165,
-    6625, 5740, 4925, 4197, 3450, 2960, 2298, 1426, 689, -96, -776, -1476,
-    -2028, -2660, -3251, -3718, -4488, -5269, -5652, -5853, -5832, -5968, -6413, -6831,
-    -7133, -7285, -7614, -8334, -8756, -8826, -8714, -8636, -8930, -9390, -9785, -10014,
-    -10229, -10522, -10695, -10852, -11152, -11284, -11465, -11903, -12229, -12477, -12738, -12907,
-    -12945, -13213, -13648, -14112, -14572, -14837, -14982, -15012, -15394, -15745, -15912, -15930,
-    -15854, -16074, -16562, -17121, -17420, -17435, -17112, -17024, -17397, -17925, -18347, -18394,
-    -18328, -18600, -19026, -18974, -18722, -18739, -18951, -19420, -19846, -19722, -19712, -20075,
-    -20371, -20364, -20150, -19813, -19908, -20512, -20706, -20574, -20322, -20109, -20304, -20416,
-    -20302, -20146, -19994, -20045, -20259, -20271, -19900, -19459, -19285, -19141, -19202, -19324,
-    -19078, -18672, -18278, -17880, -17828, -17878, -17760, -17466, -17213, -16963, -16727, -16472,
-    -15982, -15443, -15069, -15021, -14986, -14695, -14318, -13817, -13380, -13284, -12895, -12385,
-    -11720, -11140, -10953, -10481, -10013, -9442, -8745, -8405, -8093, -7686, -7303, -6742,
-    -6198, -5728, -5223, -4635, -3746, -2957, -2220, -1722, -1318, -781, -65, 755,
-    1538, 2182, 3035, 3759, 4395, 5052, 5075, 4959, 5160, 5752, 6571, 7495,
-    7669, 7357, 7296, 7592, 8121, 8323, 8011, 7904, 8623, 9535, 10188, 10234,
-    9643, 9380, 9700, 10136, 10521, 10421, 10135, 10546, 11245, 11481, 11428, 11168,
-    11089, 11554, 12081, 12106, 11722, 11721, 12036, 12409, 12665, 12344, 12421, 12870,
-    13302, 13750, 13813, 13724, 13841, 14094, 14371, 14550, 14598, 14941, 15495, 15767,
-    15679, 15672, 15887, 16321, 16695, 16901, 17057, 17292, 17699, 17981, 18105, 18120,
-    18266, 18625, 19217, 19599, 19628, 19644, 19782, 20083, 20354, 20489, 20444, 20658,
-    21178, 21443, 21401, 21031, 20708, 20846, 21275, 21535, 21440, 21297, 21143, 21226,
-    21565, 21563, 21321, 20955, 20593, 20748, 20879, 20423, 20256, 20228, 20135, 20441,
-    20309, 19641, 19315, 19126, 18861, 18722, 18175, 17592, 17319, 17180, 16838, 16605,
-    16185, 15717, 15458, 15106, 14625, 14059, 13683, 13519, 13382, 12702, 11856, 11217,
-    10645, 10251, 10041, 9613, 9027, 8722, 8364, 7912, 7230, 6506, 5806, 5239,
-    4840, 4077, 3334, 2742, 2146, 1716, 1123, 115, -1017, -1830, -2357, -2757,
-    -3202, -3853, -4474, -4936, -5324, -5751, -6405, -7059, -7405, -7476, -7470, -7706,
-    -8121, -8504, -8649, -8726, -9094, -9578, -9830, -9841, -9635, -9795, -10522, -11007,
-    -11222, -11169, -10995, -11144, -11288, -11434, -11485, -11576, -11850, -12311, -12750, -12808,
-    -12768, -12723, -12682, -12930, -13111, -13113, -13148, -13348, -13666, -13809, -13811, -13730,
-    -13599, -13710, -13964, -14331, -14604, -14598, -14381, -14352, -14721, -15203, -15469, -15550,
-    -15596, -15839, -16286, -16454, -16490, -16264, -16390, -17009, -17581, -17801, -17690, -17664,
-    -17801, -18155, -18315, -18344, -18544, -18898, -19340, -19676, -19736, -19701, -19761, -19938,
-    -20164, -20301, -20451, -20509, -20589, -20746, -20747, -20775, -20836, -20808, -21028, -21161,
-    -21118, -21145, -21035, -20951, -20866, -20772, -20727, -20746, -20905, -20912, -20671, -20483,
-    -20462, -20459, -20535, -20690, -20677, -20368, -20071, -19883, -19553, -19226, -18951, -18751,
-    -18771, -18835, -18676, -18183, -17596, -17155, -16954, -16695, -16296, -15927, -15689, -15436,
-    -15048, -14633, -14074, -13528, -13229, -12880, -12425, -11947, -11443, -10864, -10282, -9738,
-    -9077, -8647, -8305, -7921, -7417, -6767, -5985, -5223, -4526, -3690, -2836, -2053,
-    -1463, -943, -262, 612, 1699, 2772, 3452, 3972, 4614, 5485, 6033, 6049,
-    6262, 6626, 7188, 7818, 7941, 8025, 8346, 8856, 9412, 9698, 9742, 9728,
-    9833, 10215, 10601, 10712, 10795, 10825, 10984, 11241, 11494, 11659, 11764, 12230,
-    12882, 13214, 13135, 12889, 12870, 13004, 13333, 13798, 13956, 13996, 14246, 14480,
-    14542, 14599, 14542, 14470, 14808, 15282, 15536, 15521, 15358, 15263, 15229, 15410,
-    15660, 15898, 16363, 16734, 16902, 17030, 16935, 16849, 16966, 17256, 17577, 17849,
-    18045, 18127, 18211, 18270, 18352, 18587, 18793, 19110, 19328, 19240, 19383, 19782,
-    20269, 20664, 20605, 20532, 20628, 20791, 20999, 21015, 20912, 20966, 21371, 21865,
-    22015, 21861, 21538, 21513, 22011, 22315, 22008, 21474, 21137, 21337, 21844, 21864,
-    21795, 21779, 21784, 22065, 22091, 21618, 21236, 21124, 21185, 21377, 21389, 21122,
-    20700, 20446, 20350, 20287, 20069, 19764, 19554, 19471, 19256, 19040, 18736, 18399,
-    18209, 17909, 17666, 17536, 17343, 17267, 16970, 16542, 16193, 15872, 15616, 15347,
-    14924, 14347, 14031, 13647, 13331, 12977, 12412, 11806, 11535, 11268, 10763, 10195,
-    9586, 9259, 9152, 9002, 8393, 7672, 7015, 6467, 6077, 5611, 5052, 4343,
-    3717, 3162, 2610, 1930, 1065, 217, -703, -1421, -1997, -2940, -3787, -4260,
-    -4717, -4953, -5372, -6223, -6895, -7260, -7445, -7467, -7750, -8257, -8806, -9194,
-    -9641, -10184, -10826, -11368, -11321, -11153, -11331, -11748, -12424, -13080, -13263, -13477,
-    -13977, -14374, -14526, -14461, -14299, -14625, -15231, -15659, -15830, -15801, -15877, -16277,
-    -16620, -16753, -16848, -17073, -17456, -17751, -17829, -17706, -17830, -18089, -18322, -18796,
-    -19030, -19079, -19150, -19101, -18837, -18910, -19054, -19246, -19580, -19701, -19564, -19523,
-    -19522, -19636, -19870, -19971, -19959, -20003, -20008, -19930, -19801, -19613, -19682, -20032,
-    -20416, -20619, -20733, -20614, -20476, -20418, -20191, -20085, -20048, -20051, -20248, -20391,
-    -20254, -20100, -20098, -20139, -20271, -20282, -20113, -19828, -19560, -19444, -19386, -19519,
-    -19479, -19364, -19224, -18924, -18909, -19112, -19074, -18836, -18433, -17962, -17787, -17830,
-    -17748, -17762, -17650, -17484, -17505, -17477, -17150, -16634, -16356, -16121, -16223, -16249,
-    -16035, -15661, -15555, -15498, -15552, -15239, -14690, -14331, -14216, -14157, -14083, -13590,
-    -13057, -12699, -12566, -12627, -12491, -12181, -11791, -11520, -11427, -11303, -10810, -10037,
-    -9539, -9436, -9463, -9418, -9180, -8809, -8594, -8412, -8097, -7589, -7116, -6861,
-    -6591, -6164, -5714, -5359, -5095, -4903, -4669, -4314, -3852, -3459, -3024, -2382,
-    -1644, -951, -466, -189, 105, 404, 784, 1291, 1781, 2203, 2888, 3506,
-    3959, 4396, 4759, 5254, 5625, 5946, 6038, 6271, 6486, 6660, 6919, 7306,
-    7663, 8129, 8440, 8410, 8680, 8891, 9304, 9698, 9727, 9644, 9844, 10270,
-    10787, 11214, 11297, 11476, 11941, 12391, 12663, 12741, 12497, 12515, 12948, 13420,
-    13690, 13775, 13850, 14102, 14679, 14948, 15076, 14959, 14741, 15052, 15401, 15531,
-    15676, 15781, 15879, 16158, 16472, 16650, 16614, 16632, 16800, 17078, 17358, 17319,
-    17253, 17072, 17056, 17287, 17549, 17791, 17927, 17840, 17802, 17862, 17810, 17861,
-    17778, 17702, 17872, 18152, 18333, 18391, 18326, 18338, 18399, 18430, 18266, 18190,
-    18019, 17957, 17875, 17925, 17842, 18157, 18207, 18302, 18154, 17991, 17681, 17538,
-    17412, 17310, 17260, 17132, 17265, 17473, 17731, 17631, 17473, 17051, 16907, 17027,
-    16781, 16478, 16467, 16329, 16058, 16036, 15663, 15624, 16002, 16229, 16330, 15976,
-    15332, 14653, 14590, 14594, 14797, 14834, 14588, 14375, 14345, 14245, 14041, 13862,
-    13595, 13650, 13552, 13408, 13032, 12555, 12169, 12121, 12368, 12172, 11961, 11826,
-    11593, 11429, 11180, 10865, 10457, 10289, 10287, 10222, 10106, 9988, 9645, 9266,
-    9034, 8885, 8802, 8383, 8212, 7854, 7500, 7422, 7391, 6995, 6885, 6643,
-    6561, 6348, 6094, 5675, 5281, 5009, 4654, 4471, 4103, 3774, 3605, 3233,
-    2999, 2516, 2054, 1636, 1348, 774, 163, -324, -688, -1182, -1540, -1707,
-    -1819, -1914, -2287, -3066, -3631, -4319, -4787, -5055, -5185, -5414, -5774, -6049,
-    -6435, -6647, -6502, -6770, -7001, -7350, -7592, -7933, -8331, -8686, -8965, -9327,
-    -9228, -8920, -8895, -9158, -9659, -10353, -10640, -10635, -10595, -10628, -10822, -11280,
-    -11447, -11560, -11891, -11959, -12434, -12513, -12619, -12479, -12754, -13080, -13537, -13835,
-    -13770, -13733, -13950, -14119, -14533, -14558, -14526, -14771, -15037, -15335, -15472, -15507,
-    -15286, -15378, -15875, -16112, -16196, -16041, -16110, -16324, -16662, -16847, -17087, -17041,
-    -17053, -17348, -17671, -17567, -17308, -17242, -17354, -17786, -18016, -18110, -18193, -18237,
-    -18459, -18789, -18818, -18814, -18593, -18759, -18810, -18896, -19094, -19116, -19108, -19388,
-    -19619, -19817, -19786, -19700, -19548, -19479, -19640, -19639, -19541, -19567, -19764, -19974,
-    -20178, -20242, -20308, -20019, -19821, -19881, -19995, -19857, -19922, -19867, -19825, -19951,
-    -19784, -19608, -19654, -19670, -19639, -19756, -19437, -19028, -18790, -18778, -18762, -18800,
-    -18721, -18658, -18618, -18366, -18279, -18087, -17711, -17366, -17169, -17102, -17035, -16792,
-    -16605, -16489, -16168, -16022, -15892, -15610, -15373, -15115, -14586, -14183, -13762, -13553,
-    -13337, -13347, -13349, -12995, -12416, -11732, -11463, -11321, -11144, -10540, -9924, -9447,
-    -9240, -9203, -8980, -8472, -7876, -7370, -7083, -6769, -6422, -5996, -5359, -4921,
-    -4463, -3644, -3092, -2695, -2340, -1901, -1151, -413, 413, 1243, 1941, 2410,
-    3050, 3724, 4313, 4772, 5171, 5652, 6094, 6611, 6948, 7182, 7713, 8200,
-    8535, 8873, 9141, 9403, 9884, 10126, 10207, 10210, 10274, 10507, 11436, 12154,
-    12351, 12234, 12366, 12748, 13015, 13320, 13286, 13327, 13615, 13842, 14082, 14425,
-    14561, 15078, 15439, 15719, 15641, 15463, 15450, 15476, 15751, 16088, 16240, 16026,
-    16207, 16678, 16935, 17107, 17156, 16877, 16862, 17089, 17320, 17369, 17360, 17598,
-    17880, 17834, 17849, 17827, 17674, 17776, 17956, 17870, 17952, 17825, 17722, 18022,
-    18286, 18316, 18356, 18292, 18348, 18459, 18505, 18535, 18420, 18404, 18485, 18523,
-    18402, 18479, 18700, 18918, 18939, 19192, 18853, 18515, 18484, 18507, 18552, 18453,
-    18544, 18605, 18502, 18729, 18890, 18961, 19041, 18940, 18879, 18903, 18786, 18487,
-    18383, 18458, 18618, 18762, 18700, 18941, 19080, 18979, 19062, 18910, 18611, 18349,
-    18223, 18124, 18025, 18015, 18091, 18115, 18205, 18394, 18232, 18052, 17676, 17514,
-    17313, 17307, 17316, 17299, 17191, 16934, 16886, 16939, 16876, 16654, 16352, 16182,
-    16153, 16095, 15762, 15640, 15563, 15312, 15299, 15272, 14873, 14607, 14671, 14487,
-    14117, 13802, 13319, 12980, 12871, 12962, 13083, 12865, 12419, 11985, 11765, 11470,
-    11145, 10587, 10278, 10085, 9735, 9717, 9342, 8917, 8759, 8558, 8315, 8062,
-    7356, 6839, 6454, 6017, 5622, 5160, 4590, 3995, 3732, 3359, 2752, 2175,
-    1436, 814, 162, -428, -1212, -2138, -2669, -3095, -3402, -3978, -4653, -5121,
-    -5356, -5714, -6326, -6722, -7148, -7402, -7664, -7994, -8310, -8665, -8910, -9212,
-    -9542, -9835, -10266, -10588, -10727, -10832, -10982, -11430, -11950, -12261, -12422, -12560,
-    -12830, -13164, -13327, -13266, -13483, -13989, -14447, -14742, -14875, -14833, -14903, -15086,
-    -15316, -15495, -15600, -15885, -16221, -16601, -16875, -17028, -16927, -17009, -17162, -17207,
-    -17166, -17115, -17272, -17704, -17825, -18024, -18131, -18055, -18184, -18297, -18407, -18451,
-    -18508, -18448, -18254, -18330, -18297, -18345, -18336, -18662, -19037, -19177, -19250, -19189,
-    -18947, -18594, -18479, -18467, -18660, -18991, -19161, -19247, -19194, -19083, -18753, -18578,
-    -18595, -18675, -18978, -18979, -19166, -19151, -19089, -18912, -18767, -18783, -18795, -18927,
-    -18973, -19043, -19166, -19171, -19019, -18862, -18700, -18704, -18772, -19021, -19036, -18897,
-    -18639, -18404, -18271, -18227, -18212, -18190, -18111, -18276, -18206, -18149, -18008, -17834,
-    -17458, -17361, -17355, -17392, -17343, -17257, -17133, -17017, -16703, -16352, -16113, -16080,
-    -16135, -16358, -16353, -16037, -15517, -15008, -14816, -14710, -14667, -14718, -14679, -14619,
-    -14620, -14599, -14164, -13857, -13643, -13371, -13156, -12967, -12900, -12886, -12830, -12717,
-    -12436, -11992, -11611, -11334, -10998, -10897, -10831, -10708, -10492, -10220, -9779, -9353,
-    -9018, -8661, -8590, -8424, -8115, -7858, -7505, -7005, -6560, -6245, -6194, -6182,
-    -5840, -5676, -5412, -4878, -4014, -3189, -2505, -2051, -1819, -1668, -1293, -889,
-    -497, 197, 843, 1470, 2169, 2606, 3017, 3207, 3630, 4189, 4843, 5364,
-    5593, 5828, 6073, 6390, 6741, 6996, 7252, 7642, 8033, 8663, 9137, 9428,
-    9638, 9518, 9533, 9813, 10166, 10796, 11311, 11783, 12031, 12183, 12390, 12537,
-    12644, 13254, 13819, 14184, 14323, 14279, 14165, 14210, 14469, 15173, 15780, 16175,
-    16265, 16377, 16452, 16383, 16283, 16310, 16625, 17271, 17878, 18175, 18099, 17930,
-    17762, 17637, 17633, 17817, 18130, 18518, 18712, 18741, 18773, 18738, 18960, 19144,
-    19009, 18859, 18974, 19193, 19352, 19397, 19347, 19466, 19501, 19513, 19547, 19519,
-    19517, 19696, 19733, 19620, 19300, 19164, 19188, 19419, 19777, 19745, 19531, 19179,
-    18766, 18856, 18737, 18770, 18894, 19007, 18887, 18796, 18661, 18208, 17871, 17678,
-    17676, 17935, 18026, 18015, 17705, 17333, 16940, 16605, 16307, 16309, 16339, 16484,
-    16489, 16283, 16057, 15634, 15175, 15048, 14870, 14835, 14872, 14844, 14816, 14678,
-    14447, 14253, 14106, 14052, 13833, 13636, 13271, 12963, 12930, 12922, 12956, 12862,
-    12901, 13127, 13248, 13065, 12468, 11795, 11456, 11425, 11559, 11714, 11748, 11697,
-    11640, 11562, 11275, 10842, 10372, 10110, 10210, 10431, 10560, 10463, 10201, 9874,
-    9652, 9469, 9173, 9069, 9025, 9161, 9225, 9115, 8893, 8390, 8000, 7917,
-    7912, 8008, 7823, 7636, 7548, 7382, 7210, 7023, 6675, 6472, 6362, 6271,
-    5932, 5560, 5331, 5149, 4998, 4814, 4481, 4284, 4018, 3688, 3368, 2941,
-    2149, 1545, 1196, 903, 949, 872, 493, 24, -549, -1089, -1863, -2603,
-    -2987, -3413, -3581, -3627, -3941, -4192, -4560, -4929, -5516, -6178, -6516, -6839,
-    -6874, -6943, -7103, -7317, -7715, -8103, -8505, -8821, -9023, -9208, -9468, -9619,
-    -9806, -10008, -10233, -10491, -10661, -10918, -11043, -11322, -11577, -11657, -11772, -11986,
-    -12169, -12439, -12803, -12950, -12911, -12850, -12915, -13065, -13242, -13659, -14027, -14300,
-    -14435, -14450, -14318, -14291, -14292, -14388, -14518, -14796, -15173, -15427, -15482, -15485,
-    -15424, -15459, -15530, -15580, -15704, -15889, -16054, -16225, -16182, -16161, -16047, -16243,
-    -16452, -16689, -16809, -16764, -16811, -16731, -16679, -16943, -17014, -16923, -16871, -16860,
-    -16832, -16950, -16965, -17113, -17200, -17461, -17554, -17438, -17393, -17265, -17099, -16820,
-    -16562, -16704, -16973, -17385, -17585, -17608, -17412, -17185, -16868, -16595, -16434, -16373,
-    -16552, -16829, -17028, -17157, -17032, -16768, -16431, -16335, -16198, -16197, -16191, -16229,
-    -16305, -16238, -16252, -16027, -15888, -15878, -15728, -15513, -15163, -15034, -14939, -14963,
-    -15111, -14991, -14766, -14521, -14300, -14105, -13955, -13834, -13613, -13480, -13331, -13326,
-    -13212, -12996, -12845, -12431, -12183, -11885, -11433, -11224, -10996, -10907, -10920, -10927,
-    -10918, -10552, -10098, -9573, -9220, -9052, -8911, -8767, -8746, -8663, -8586, -8403,
-    -7880, -7466, -7099, -6814, -6728, -6622, -6573, -6355, -6040, -5777, -5685, -5511,
-    -5268, -5045, -4742, -4283, -3917, -3563, -3307, -3082, -2966, -2872, -2632, -2311,
-    -1854, -1252, -570, -323, -328, -239, -394, -273, -71, 241, 695, 1114,
-    1561, 1765, 2060, 2383, 2720, 2965, 2837, 2766, 2949, 3089, 3450, 3766,
-    4050, 4630, 5067, 5320, 5231, 5165, 5204, 5317, 5534, 5747, 5971, 6056,
-    6239, 6408, 6434, 6460, 6403, 6392, 6570, 6825, 7069, 7083, 7164, 7232,
-    7366, 7556, 7692, 7888, 7857, 7857, 7944, 8248, 8541, 8846, 9107, 9166,
-    9182, 9223, 9165, 9218, 9321, 9478, 9651, 9971, 10237, 10281, 10192, 10228,
-    10398, 10716, 11197, 11333, 11332, 11181, 11123, 11320, 11445, 11563, 11829, 12129,
-    12449, 12714, 12747, 12700, 12645, 12687, 12766, 13083, 13422, 13663, 13729, 13762,
-    13840, 13950, 13974, 13920, 13861, 14032, 14307, 14608, 14988, 15209, 15133, 14987,
-    15015, 15070, 15175, 15326, 15492, 15683, 15847, 15864, 15828, 15787, 15908, 16119,
-    16219, 16353, 16222, 15946, 16047, 16206, 16290, 16526, 16650, 16717, 16851, 17093,
-    17161, 17038, 17004, 16748, 16695, 16892, 17077, 17327, 17470, 17614, 17626, 17479,
-    17273, 17261, 17383, 17309, 17346, 17430, 17460, 17490, 17374, 17300, 17171, 17104,
-    17187, 17104, 17159, 17179, 17064, 16997, 16863, 16907, 16820, 16866, 16725, 16681,
-    16792, 16726, 16607, 16625, 16415, 16285, 16233, 16147, 15966, 15698, 15588, 15547,
-    15467, 15604, 15476, 15227, 14789, 14317, 14303, 14255, 14315, 14169, 13813, 13551,
-    13191, 13026, 12652, 12397, 12209, 12135, 12236, 12091, 11668, 11089, 10495, 10134,
-    9855, 9778, 9584, 9320, 9005, 8731, 8320, 7892, 7273, 6799, 6416, 6220,
-    6051, 5840, 5433, 4718, 4121, 3538, 2983, 2433, 1736, 1107, 506, -155,
-    -816, -1389, -1918, -2633, -3160, -3778, -4566, -5166, -5710, -6124, -6586, -6875,
-    -7094, -7514, -7952, -8403, -8902, -9274, -9519, -9512, -9647, -10143, -10708, -11245,
-    -11769, -12157, -12472, -12575, -12698, -12798, -12916, -13229, -13774, -14225, -14658, -14840,
-    -15087, -15353, -15564, -15757, -16101, -16472, -16829, -17061, -17202, -17267, -17385, -17478,
-    -17755, -18065, -18326, -18636, -18719, -18792, -18790, -18804, -18909, -19077, -19207, -19456,
-    -19538, -19555, -19535, -19505, -19526, -19567, -19701, -19889, -20003, -20083, -20109, -20047,
-    -19881, -19770, -19854, -19986, -19951, -19837, -19690, -19527, -19581, -19740, -19847, -19849,
-    -19762, -19584, -19464, -19373, -19182, -18960, -18874, -18900, -18978, -19004, -18923, -18765,
-    -18599, -18529, -18464, -18379, -18282, -18183, -18092, -17999, -17763, -17456, -17240, -17010,
-    -16987, -16931, -16955, -16941, -16757, -16526, -16193, -15947, -15751, -15516, -15354, -15099,
-    -14893, -14756, -14619, -14545, -14488, -14399, -14315, -14177, -13771, -13347, -12873, -12465,
-    -12416, -12582, -12627, -12714, -12708, -12385, -11921, -11293, -10583, -10125, -10172, -10400,
-    -10656, -10752, -10568, -10174, -9650, -9083, -8590, -8212, -8075, -8248, -8394, -8394,
-    -8364, -8053, -7635, -7206, -6904, -6654, -6468, -6374, -6403, -6416, -6301, -6120,
-    -5797, -5519, -5269, -4991, -4631, -4261, -3792, -3467, -3279, -3100, -2843, -2570,
-    -2164, -1772, -1552, -1367, -1263, -980, -738, -469, -199, 4, 38, 159,
-    261, 627, 991, 1189, 1371, 1426, 1599, 1788, 2076, 2205, 2096, 2193,
-    2361, 2536, 2752, 2836, 3088, 3217, 3247, 3269, 3074, 3058, 3217, 3547,
-    3883, 4057, 4130, 4074, 4014, 4037, 4034, 4136, 4092, 4147, 4390, 4582,
-    4790, 4912, 4991, 5029, 5088, 5258, 5447, 5336, 5322, 5423, 5475, 5633,
-    5851, 6077, 6199, 6332, 6301, 6142, 6079, 6104, 6209, 6490, 6728, 7026,
-    7106, 7139, 7086, 6974, 7022, 7048, 7114, 7309, 7663, 7998, 8388, 8704,
-    8706, 8587, 8488, 8484, 8687, 9048, 9472, 9907, 10127, 10379, 10534, 10605,
-    10569, 10522, 10600, 10809, 11142, 11412, 11715, 11950, 12075, 12172, 12276, 12457,
-    12698, 12994, 13170, 13286, 13423, 13644, 13937, 14267, 14607, 14849, 15007, 15099,
-    15186, 15242, 15323, 15519, 15902, 16384, 16739, 16918, 17072, 16992, 16964, 17049,
-    17084, 17227, 17351, 17677, 17885, 18102, 18137, 18238, 18210, 18068, 18157, 18277,
-    18441, 18721, 18908, 18906, 18914, 18823, 18723, 18494, 18506, 18723, 18903, 19012,
-    18979, 18702, 18430, 18273, 18205, 18277, 18257, 18187, 18023, 17899, 17859, 17720,
-    17612, 17356, 17147, 17051, 16924, 16768, 16510, 16211, 15954, 15796, 15741, 15549,
-    15394, 15231, 14996, 14798, 14426, 14074, 13653, 13297, 13102, 12980, 12869, 12608,
-    12214, 11743, 11368, 11046, 10775, 10556, 10263, 9983, 9667, 9349, 8944, 8538,
-    8200, 7819, 7722, 7841, 7779, 7387, 6935, 6187, 5662, 5508, 5468, 5457,
-    5268, 4901, 4316, 3611, 2858, 2227, 1798, 1534, 1526, 1422, 1205, 791,
-    142, -668, -1415, -1904, -2278, -2382, -2422, -2597, -2831, -3214, -3772, -4436,
-    -4940, -5290, -5560, -5583, -5691, -5914, -6100, -6389, -6480, -6592, -6800, -6895,
-    -6966, -7113, -7316, -7389, -7542, -7653, -7705, -7882, -8083, -8226, -8346, -8626,
-    -8844, -9112, -9186, -9157, -9241, -9043, -8897, -8846, -8939, -9398, -10017, -10410,
-    -10533, -10502, -10263, -10061, -9989, -9981, -10077, -10356, -10689, -11037, -11285, -11271,
-    -11152, -10930, -10757, -10840, -11028, -11256, -11638, -11921, -12043, -12075, -11963, -11840,
-    -11768, -11851, -11924, -12069, -12314, -12491, -12638, -12683, -12693, -12538, -12363, -12415,
-    -12617, -13013, -13680, -14389, -14973, -15679, -16313, -16762, -17212, -17647, -17989, -18249,
-    -18511, -18585, -18648, -18725, -18597, -18433, -18077, -17689, -17392, -16995, -16627, -16252,
-    -15903, -15684, -15673, -15716, -15614, -15377, -14945, -14452, -13975, -13601, -13356, -13170,
-    -13092, -13127, -13143, -12959, -12627, -12088, -11420, -10986, -10810, -10718, -10782, -10961,
-    -10867, -10606, -10259, -9718, -9254, -8964, -8785, -8676, -8638, -8650, -8582, -8327,
-    -8072, -7685, -7190, -6876, -6533, -6302, -6262, -6141, -5905, -5639, -5402, -5217,
-    -5165, -5051, -4805, -4506, -4218, -3994, -3657, -3374, -3040, -2899, -2914, -2902,
-    -2735, -2367, -2000, -1547, -1177, -782, -467, -373, -262, -241, -164, 90,
-    343, 783, 1257, 1642, 1924, 2171, 2354, 2545, 2668, 2768, 3071, 3508,
-    3940, 4343, 4654, 4870, 5094, 5333, 5658, 5956, 6288, 6613, 6985, 7287,
-    7600, 7986, 8226, 8490, 8847, 9212, 9542, 9922, 10214, 10543, 10896, 11156,
-    11486, 11790, 12078, 12294, 12509, 12691, 12750, 12878, 12980, 13192, 13410, 13693,
-    13760, 13806, 13757, 13510, 13455, 13477, 13532, 13664, 13812, 14072, 14365, 14534,
-    14383, 14065, 13691, 13547, 13683, 13981, 14244, 14372, 14415, 14404, 14289, 13969,
-    13609, 13393, 13422, 13429, 13010, 11542, 9335, 6652, 3652, 957, -1228, -2779,
-    -3655, -3949, -3861, -3729, -3692, -3595, -3371, -3142, -2788, -2498, -2375, -2260,
-    -2280, -2380, -2471, -2620, -2695, -2827, -2837, -2738, -2608, -2667, -2729, -2716,
-    -2851, -2881, -2976, -3042, -3023, -2979, -2906, -2979, -2938, -2990, -2944, -2732,
-    -2682, -2803, -2868, -2844, -2684, -2492, -2434, -2527, -2711, -2636, -2538, -2473,
-    -2399, -2422, -2357, -2363, -2194, -2114, -2189, -2221, -2296, -2226, -2069, -1959,
-    -1986, -2062, -2164, -2219, -2111, -2025, -1941, -1817, -1702, -1571, -1515, -1550,
-    -1573, -1576, -1555, -1498, -1493, -1522, -1398, -1265, -1218, -1236, -1300, -1405,
-    -1505, -1440, -1370, -1273, -1131, -1029, -1017, -1047, -1104, -1190, -1187, -1247,
-    -1227, -1224, -1207, -1292, -1510, -1539, -1617, -1623, -1707, -1779, -1648, -1349,
-    -1116, -1268, -1570, -1933, -1971, -1767, -1432, -1107, -942, -726, -722, -878,
-    -1138, -1386, -1434, -1160, -703, -329, -96, -27, -88, -290, -407, -495,
-    -487, -173, 265, 623, 806, 743, 577, 503, 497, 642, 894, 1209,
-    1470, 1858, 2237, 2306, 2409, 2395, 2350, 2570, 2879, 3092, 3342, 3677,
-    3873, 4041, 4294, 4546, 4591, 4265, 3157, 1350, -744, -3008, -5094, -6834,
-    -8125, -8943, -9371, -9462, -9364, -8862, -8256, -7686, -7046, -6621, -6195, -5772,
-    -5228, -4698, -4232, -3769, -3534, -3343, -3151, -3095, -3005, -2759, -2386, -2066,
-    -1709, -1462, -1340, -1265, -1175, -1073, -797, -328, 171, 683, 950, 972,
-    898, 981, 1198, 1457, 1697, 1967, 2302, 2674, 2895, 3018, 3108, 3258,
-    3483, 3702, 3976, 4093, 4139, 4322, 4447, 4753, 5038, 5352, 5497, 5594,
-    5662, 5564, 5576, 5596, 5825, 6162, 6485, 6580, 6743, 6631, 6494, 6650,
-    6765, 7084, 7340, 7281, 7097, 7150, 7316, 7375, 7673, 7860, 7913, 7996,
-    8046, 7875, 7675, 7645, 7801, 8087, 8390, 8584, 8569, 8507, 8357, 8183,
-    8046, 8148, 8364, 8675, 8894, 8884, 8678, 8528, 8351, 8281, 8388, 8489,
-    8604, 8687, 8627, 8454, 8366, 8299, 8293, 8294, 8317, 8470, 8573, 8577,
-    8406, 8292, 8202, 8118, 8210, 8203, 8223, 8262, 8313, 8320, 8221, 8046,
-    7916, 7835, 7875, 7865, 7807, 7685, 7607, 7592, 7415, 7261, 7058, 7010,
-    7238, 7350, 7201, 6854, 6536, 6526, 6710, 6807, 6786, 6720, 6622, 6643,
-    6557, 6258, 6070, 6078, 6130, 6000, 5450, 4168, 2305, 125, -2195, -4309,
-    -6250, -7938, -9305, -10372, -11159, -11722, -11925, -11967, -11764, -11384, -11154, -10873,
-    -10718, -10569, -10401, -10230, -10080, -9878, -9602, -9530, -9549, -9732, -9905, -9967,
-    -10061, -10068, -10046, -9975, -9845, -9723, -9778, -9940, -10078, -10302, -10391, -10360,
-    -10303, -10138, -10213, -10145, -10126, -10259, -10285, -10283, -10172, -10022, -9919, -10063,
-    -10174, -10086, -9986, -9716, -9441, -9368, -9290, -9301, -9326, -9449, -9482, -9484,
-    -9296, -9128, -8877, -8713, -8754, -8852, -8947, -8996, -8924, -8751, -8538, -8223,
-    -8093, -8130, -8213, -8280, -8230, -7956, -7731, -7730, -7667, -7541, -7328, -7144,
-    -7032, -7040, -6912, -6642, -6433, -6364, -6280, -6200, -6107, -5819, -5721, -5597,
-    -5516, -5433, -5405, -5202, -5098, -5013, -4781, -4658, -4422, -4229, -4174, -3952,
-    -3877, -3603, -3431, -3259, -3065, -2883, -2643, -2403, -2023, -1946, -1890, -1853,
-    -1842, -1558, -1288, -1106, -804, -563, -251, -11, 169, 212, 339, 607,
-    795, 1013, 1194, 1429, 1651, 1908, 2131, 2380, 2650, 2832, 2992, 3050,
-    3207, 3286, 3528, 3825, 4152, 4478, 4754, 4805, 4898, 5070, 5218, 5369,
-    5583, 5939, 6363, 6774, 6976, 6991, 6706, 6225, 5462, 4326, 2934, 1394,
-    -293, -1853, -3295, -4516, -5542, -6306, -6705, -6927, -6832, -6599, -6277, -5814,
-    -5371, -4876, -4339, -3870, -3515, -3087, -2687, -2228, -1745, -1509, -1323, -1164,
-    -957, -731, -477, -330, -213, 54, 165, 444, 752, 949, 1205, 1455,
-    1514, 1518, 1584, 1588, 1807, 2053, 2358, 2821, 3056, 3207, 3357, 3442,
-    3606, 3646, 3684, 3800, 4106, 4523, 4914, 5137, 5142, 5175, 5192, 5260,
-    5359, 5451, 5596, 5871, 6113, 6273, 6328, 6440, 6454, 6538, 6697, 6776,
-    6968, 7129, 7304, 7369, 7510, 7588, 7568, 7702, 7794, 7891, 7939, 8069,
-    8071, 8154, 8276, 8355, 8426, 8467, 8472, 8406, 8460, 8479, 8607, 8729,
-    8897, 8993, 9069, 8939, 8734, 8600, 8571, 8709, 8822, 8847, 8851, 8966,
-    8961, 8950, 8802, 8736, 8691, 8824, 8987, 9094, 9157, 9015, 8865, 8633,
-    8510, 8447, 8382, 8491, 8618, 8719, 8766, 8699, 8551, 8488, 8518, 8517,
-    8513, 8423, 8402, 8350, 8386, 8308, 8271, 8110, 8089, 8008, 7923, 7871,
-    7779, 7832, 7725, 7647, 7533, 7420, 7290, 7181, 6998, 6838, 6705, 6630,
-    6604, 6597, 6620, 6663, 6734, 6751, 6469, 5920, 5068, 4014, 2735, 1365,
-    -133, -1815, -3467, -5097, -6744, -8055, -9184, -10226, -10848, -11180, -11345, -11274,
-    -11231, -11270, -11167, -11144, -11190, -11077, -10892, -10676, -10366, -10145, -10036, -9984,
-    -9965, -10022, -10251, -10399, -10430, -10366, -10162, -10108, -9968, -9974, -9996, -10078,
-    -10287, -10391, -10482, -10542, -10391, -10233, -10120, -10068, -10091, -10216, -10284, -10306,
-    -10421, -10408, -10374, -10173, -9987, -9959, -9969, -9946, -9883, -9707, -9622, -9661,
-    -9739, -9704, -9637, -9493, -9209, -9049, -8914, -8843, -8813, -8770, -8839, -8940,
-    -8981, -8821, -8561, -8284, -8114, -8051, -7960, -7960, -7976, -8021, -8096, -8000,
-    -7646, -7284, -7123, -7024, -7015, -6967, -6809, -6668, -6575, -6450, -6288, -5927,
-    -5650, -5490, -5439, -5421, -5321, -5224, -5058, -4973, -4785, -4588, -4367, -4264,
-    -4184, -4096, -4035, -3803, -3536, -3363, -3138, -2932, -2805, -2670, -2420, -2214,
-    -1947, -1662, -1362, -1117, -890, -756, -814, -663, -347, -87, 187, 390,
-    565, 761, 941, 1080, 1180, 1362, 1596, 1903, 2147, 2350, 2531, 2630,
-    2800, 2987, 3068, 3327, 3543, 3644, 3798, 4004, 4286, 4589, 4742, 4853,
-    4943, 5135, 5431, 5719, 5991, 6299, 6537, 6706, 6576, 6122, 5409, 4559,
-    3643, 2509, 1412, 110, -1175, -2299, -3395, -4175, -4774, -5212, -5563, -5782,
-    -5893, -5940, -5885, -5864, -5763, -5481, -4950, -4346, -3710, -3228, -2987, -2711,
-    -2420, -2119, -1672, -1214, -836, -397, -87, 91, 269, 191, 292, 478,
-    725, 1080, 1299, 1504, 1722, 1782, 1856, 1952, 2092, 2375, 2557, 2721,
-    2988, 3202, 3356, 3436, 3508, 3669, 3833, 4046, 4163, 4274, 4453, 4690,
-    4944, 5187, 5372, 5552, 5717, 5806, 5948, 6044, 6219, 6367, 6437, 6591,
-    6723, 6832, 6923, 6953, 6984, 7159, 7282, 7359, 7588, 7813, 7985, 8132,
-    8033, 8069, 8054, 7989, 8040, 7974, 7942, 8057, 8102, 8253, 8340, 8329,
-    8398, 8449, 8475, 8516, 8531, 8479, 8569, 8648, 8640, 8545, 8447, 8381,
-    8420, 8462, 8485, 8538, 8655, 8671, 8732, 8669, 8621, 8632, 8649, 8664,
-    8603, 8598, 8487, 8544, 8611, 8709, 8867, 8859, 8752, 8557, 8304, 8176,
-    8106, 8122, 8229, 8288, 8305, 8311, 8323, 8302, 8263, 8104, 7941, 7808,
-    7772, 7705, 7687, 7642, 7573, 7478, 7342, 7243, 7176, 7165, 6986, 6842,
-    6756, 6638, 6705, 6780, 6855, 6929, 6882, 6754, 6486, 6031, 5304, 4532,
-    3656, 2624, 1406, 120, -1366, -2854, -4198, -5653, -6944, -8021, -8991, -9661,
-    -10207, -10604, -10874, -11234, -11425, -11621, -11745, -11664, -11543, -11321, -11124, -10834,
-    -10618, -10385, -10258, -10266, -10215, -10146, -10103, -10027, -9844, -9780, -9772, -9757,
-    -9786, -9813, -9851, -9886, -9895, -9922, -9870, -9956, -10018, -10082, -10065, -9983,
-    -9897, -9873, -9957, -10030, -10032, -9978, -9932, -9978, -9972, -9894, -9715, -9552,
-    -9524, -9569, -9644, -9582, -9483, -9360, -9266, -9095, -8917, -8795, -8754, -8687,
-    -8643, -8663, -8599, -8570, -8482, -8389, -8316, -8175, -8016, -7934, -7790, -7637,
-    -7623, -7593, -7567, -7490, -7246, -7052, -6919, -6799, -6654, -6503, -6376, -6360,
-    -6323, -6205, -6163, -5928, -5753, -5488, -5250, -5025, -4887, -4779, -4748, -4768,
-    -4658, -4580, -4404, -4145, -3941, -3763, -3496, -3362, -3328, -3175, -3049, -2787,
-    -2541, -2519, -2394, -2171, -1907, -1614, -1291, -1109, -988, -857, -707, -618,
-    -470, -208, 120, 505, 768, 889, 1006, 1080, 1189, 1370, 1555, 1827,
-    2193, 2517, 2733, 2907, 2979, 2997, 3072, 3213, 3498, 3902, 4250, 4489,
-    4686, 4845, 5031, 5200, 5399, 5660, 5903, 6164, 6400, 6449, 6366, 6067,
-    5524, 4936, 4224, 3469, 2624, 1685, 690, -344, -1359, -2227, -3014, -3791,
-    -4388, -4878, -5250, -5500, -5633, -5668, -5580, -5421, -5294, -4964, -4592, -4234,
-    -3926, -3701, -3452, -3043, -2543, -2122, -1731, -1420, -1087, -694, -448, -287,
-    -111, 183, 507, 830, 1119, 1288, 1496, 1675, 1836, 2029, 2255, 2482,
-    2699, 2989, 3156, 3327, 3517, 3558, 3616, 3704, 3860, 3960, 4104, 4225,
-    4316, 4475, 4620, 4710, 4772, 4908, 5098, 5269, 5450, 5608, 5742, 5857,
-    5930, 6042, 6201, 6434, 6641, 6762, 6850, 6925, 6990, 7047, 7110, 7123,
-    7176, 7355, 7472, 7493, 7574, 7669, 7777, 7913, 7973, 7900, 7902, 8029,
-    8150, 8353, 8484, 8555, 8597, 8605, 8550, 8485, 8531, 8558, 8675, 8806,
-    8903, 8943, 8906, 8851, 8759, 8739, 8761, 8790, 8853, 8975, 8995, 8909,
-    8859, 8789, 8711, 8740, 8768, 8733, 8701, 8624, 8545, 8489, 8422, 8338,
-    8374, 8454, 8490, 8498, 8392, 8291, 8199, 8131, 8109, 8150, 8140, 8108,
-    8086, 7952, 7839, 7713, 7597, 7563, 7626, 7668, 7642, 7580, 7438, 7322,
-    7215, 7114, 7048, 7003, 6994, 7005, 6966, 6859, 6750, 6587, 6339, 6028,
-    5572, 4931, 4132, 3184, 2064, 834, -400, -1604, -2789, -4021, -5240, -6341,
-    -7335, -8216, -8984, -9711, -10318, -10808, -11209, -11498, -11716, -11869, -11947, -11945,
-    -11935, -11855, -11724, -11607, -11444, -11286, -11087, -10908, -10749, -10628, -10592, -10514,
-    -10410, -10269, -10160, -10036, -9924, -9825, -9745, -9747, -9789, -9796, -9790, -9749,
-    -9703, -9672, -9662, -9668, -9635, -9616, -9580, -9587, -9558, -9545, -9564, -9460,
-    -9425, -9436, -9412, -9352, -9313, -9249, -9185, -9249, -9193, -9060, -8950, -8867,
-    -8799, -8769, -8731, -8715, -8751, -8713, -8662, -8538, -8350, -8220, -8143, -8066,
-    -8004, -7965, -7903, -7866, -7749, -7523, -7316, -7189, -7090, -6954, -6827, -6728,
-    -6639, -6568, -6445, -6315, -6147, -5968, -5852, -5658, -5497, -5355, -5286, -5258,
-    -5176, -5058, -4892, -4727, -4502, -4293, -4051, -3812, -3697, -3575, -3502, -3404,
-    -3288, -3144, -2905, -2639, -2322, -2054, -1820, -1641, -1531, -1398, -1285, -1067,
-    -785, -513, -276, -66, 108, 249, 437, 576, 753, 941, 1154, 1398,
-    1629, 1842, 2050, 2281, 2507, 2708, 2843, 2908, 3108, 3350, 3587, 3916,
-    4232, 4464, 4672, 4857, 4947, 5053, 5233, 5458, 5741, 5986, 6181, 6264,
-    6186, 5989, 5610, 5173, 4628, 4024, 3324, 2566, 1731, 878, 43, -766,
-    -1502, -2155, -2732, -3341, -3857, -4235, -4586, -4870, -5003, -5139, -5105, -4954,
-    -4845, -4631, -4406, -4149, -3824, -3522, -3281, -2946, -2538, -2125, -1659, -1225,
-    -822, -479, -215, 8, 308, 610, 918, 1298, 1553, 1800, 2002, 2159,
-    2328, 2445, 2648, 2868, 3113, 3262, 3398, 3516, 3602, 3700, 3827, 4026,
-    4257, 4527, 4709, 4804, 4911, 4955, 5106, 5265, 5401, 5615, 5740, 5877,
-    5981, 6074, 6151, 6279, 6384, 6468, 6563, 6654, 6716, 6822, 6895, 6964,
-    6997, 7057, 7163, 7221, 7402, 7585, 7696, 7767, 7778, 7738, 7788, 7882,
-    7939, 8015, 8100, 8162, 8214, 8250, 8213, 8131, 8148, 8227, 8308, 8407,
-    8505, 8530, 8518, 8531, 8511, 8525, 8622, 8652, 8677, 8736, 8699, 8694,
-    8627, 8517, 8545, 8574, 8584, 8602, 8530, 8423, 8368, 8285, 8281, 8282,
-    8332, 8405, 8482, 8501, 8363, 8263, 8139, 8091, 8125, 8137, 8262, 8319,
-    8281, 8255, 8132, 8023, 7899, 7813, 7765, 7738, 7745, 7769, 7690, 7564,
-    7512, 7414, 7348, 7322, 7224, 7165, 7100, 7070, 6988, 6899, 6801, 6715,
-    6505, 6120, 5688, 5047, 4374, 3666, 2802, 1902, 1023, 51, -970, -2020,
-    -3080, -4118, -5142, -6067, -6887, -7642, -8278, -8904, -9491, -9962, -10376, -10725,
-    -11063, -11344, -11552, -11677, -11699, -11667, -11591, -11542, -11410, -11271, -11291, -11274,
-    -11237, -11164, -10972, -10747, -10515, -10344, -10214, -10142, -10140, -10137, -10094, -10068,
-    -10027, -9904, -9845, -9816, -9826, -9853, -9864, -9854, -9813, -9855, -9872, -9837,
-    -9850, -9838, -9820, -9787, -9733, -9621, -9556, -9508, -9461, -9350, -9331, -9307,
-    -9286, -9257, -9149, -8999, -8865, -8783, -8740, -8682, -8651, -8612, -8504, -8418,
-    -8309, -8157, -8058, -8019, -7952, -7890, -7849, -7710, -7574, -7452, -7335, -7220,
-    -7128, -7049, -6943, -6888, -6736, -6626, -6483, -6365, -6222, -6059, -5913, -5756,
-    -5632, -5460, -5342, -5177, -5056, -4949, -4820, -4684, -4502, -4292, -4100, -3891,
-    -3747, -3570, -3379, -3187, -3085, -3021, -2846, -2633, -2333, -2110, -1875, -1629,
-    -1465, -1306, -1212, -1152, -955, -735, -366, -66, 203, 429, 627, 754,
-    879, 1063, 1283, 1532, 1767, 2026, 2237, 2472, 2641, 2792, 2949, 3136,
-    3359, 3611, 3838, 4054, 4270, 4539, 4741, 4880, 5058, 5241, 5486, 5674,
-    5841, 5905, 5821, 5703, 5485, 5174, 4781, 4313, 3795, 3204, 2540, 1861,
-    1204, 528, -68, -693, -1295, -1793, -2310, -2785, -3313, -3738, -4045, -4251,
-    -4363, -4457, -4442, -4469, -4399, -4378, -4324, -4191, -4063, -3788, -3454, -3143,
-    -2837, -2535, -2200, -1930, -1656, -1307, -962, -569, -159, 153, 368, 580,
-    851, 1097, 1358, 1690, 1991, 2237, 2540, 2701, 2837, 2936, 3067, 3235,
-    3414, 3636, 3841, 3993, 4221, 4346, 4505, 4620, 4757, 4880, 5091, 5251,
-    5382, 5495, 5588, 5686, 5813, 6037, 6185, 6319, 6455, 6545, 6647, 6712,
-    6790, 6860, 6953, 7124, 7264, 7370, 7492, 7547, 7611, 7701, 7725, 7753,
-    7809, 7856, 7927, 7972, 8045, 8111, 8266, 8348, 8376, 8352, 8293, 8283,
-    8351, 8425, 8528, 8534, 8523, 8617, 8633, 8684, 8717, 8695, 8647, 8657,
-    8653, 8648, 8644, 8645, 8698, 8743, 8751, 8810, 8770, 8750, 8678, 8634,
-    8623, 8628, 8647, 8608, 8649, 8678, 8630, 8614, 8548, 8501, 8476, 8495,
-    8462, 8434, 8371, 8324, 8265, 8185, 8097, 8084, 8041, 8031, 7976, 7867,
-    7837, 7754, 7661, 7562, 7496, 7474, 7431, 7408, 7311, 7234, 7136, 7090,
-    6980, 6827, 6580, 6273, 5865, 5428, 4881, 4255, 3584, 2866, 2055, 1162,
-    261, -649, -1605, -2515, -3374, -4193, -4994, -5757, -6502, -7164, -7840, -8462,
-    -9010, -9495, -9934, -10325, -10672, -10947, -11151, -11326, -11502, -11644, -11744, -11788,
-    -11766, -11725, -11673, -11619, -11473, -11367, -11283, -11223, -11158, -11061, -10915, -10771,
-    -10611, -10444, -10250, -10164, -10077, -9974, -9932, -9943, -9929, -9852, -9678, -9555,
-    -9440, -9483, -9427, -9415, -9397, -9410, -9415, -9412, -9358, -9318, -9275, -9227,
-    -9180, -9087, -9067, -9012, -8970, -8940, -8898, -8851, -8817, -8730, -8629, -8545,
-    -8444, -8340, -8324, -8140, -8017, -7923, -7868, -7820, -7778, -7631, -7522, -7405,
-    -7322, -7213, -7038, -6888, -6815, -6683, -6621, -6587, -6521, -6402, -6302, -6127,
-    -5953, -5851, -5685, -5553, -5447, -5287, -5232, -5048, -4921, -4749, -4590, -4394,
-    -4241, -3996, -3795, -3636, -3470, -3313, -3153, -2999, -2820, -2661, -2440, -2224,
-    -2043, -1846, -1616, -1504, -1417, -1235, -1042, -852, -644, -434, -271, -82,
-    97, 290, 389, 619, 883, 1066, 1286, 1456, 1672, 1921, 2183, 2467,
-    2645, 2818, 2998, 3207, 3435, 3653, 3888, 4236, 4457, 4681, 4890, 5029,
-    5147, 5361, 5510, 5649, 5660, 5716, 5559, 5337, 4999, 4595, 4156, 3665,
-    3206, 2738, 2193, 1644, 1067, 474, -74, -597, -1066, -1526, -1972, -2400,
-    -2747, -3012, -3253, -3423, -3580, -3627, -3660, -3662, -3731, -3763, -3676, -3534,
-    -3383, -3171, -2930, -2703, -2472, -2225, -2025, -1816, -1554, -1225, -930, -615,
-    -282, -7, 231, 585, 822, 1040, 1372, 1637, 1906, 2192, 2447, 2653,
-    2850, 3126, 3382, 3667, 3889, 4056, 4192, 4342, 4487, 4615, 4784, 4983,
-    5177, 5386, 5582, 5664, 5722, 5754, 5833, 5931, 6066, 6245, 6420, 6567,
-    6652, 6713, 6802, 6856, 6947, 7057, 7153, 7287, 7415, 7476, 7557, 7632,
-    7730, 7865, 7922, 7965, 8025, 8088, 8126, 8148, 8187, 8285, 8444, 8537,
-    8538, 8500, 8459, 8440, 8423, 8483, 8526, 8601, 8693, 8749, 8798, 8813,
-    8819, 8747, 8751, 8777, 8790, 8808, 8862, 8856, 8845, 8900, 8952, 8879,
-    8803, 8784, 8785, 8751, 8743, 8694, 8603, 8610, 8618, 8535, 8480, 8391,
-    8355, 8356, 8311, 8264, 8226, 8157, 8120, 8074, 8009, 7977, 7936, 7838,
-    7757, 7691, 7674, 7626, 7654, 7643, 7568, 7485, 7361, 7216, 7112, 7055,
-    7008, 7028, 6985, 6865, 6662, 6365, 5955, 5545, 5093, 4582, 4004, 3389,
-    2704, 1997, 1247, 436, -369, -1109, -1894, -2727, -3516, -4300, -5036, -5723,
-    -6337, -6915, -7481, -7994, -8480, -9002, -9475, -9904, -10280, -10590, -10775, -10952,
-    -11096, -11238, -11398, -11551, -11675, -11735, -11752, -11776, -11779, -11691, -11600, -11534,
-    -11489, -11414, -11344, -11211, -11096, -11032, -10983, -10892, -10801, -10683, -10505, -10409,
-    -10329, -10194, -10077, -10018, -9916, -9866, -9852, -9767, -9673, -9588, -9506, -9367,
-    -9271, -9210, -9157, -9163, -9192, -9159, -9035, -8902, -8822, -8755, -8728, -8705,
-    -8622, -8610, -8511, -8421, -8369, -8290, -8210, -8136, -8018, -7907, -7815, -7741,
-    -7657, -7602, -7488, -7407, -7289, -7176, -7092, -6954, -6848, -6743, -6626, -6555,
-    -6460, -6331, -6163, -5973, -5829, -5710, -5569, -5450, -5326, -5154, -5023, -4874,
-    -4736, -4569, -4415, -4255, -4069, -3891, -3744, -3548, -3367, -3236, -3108, -3019,
-    -2861, -2595, -2348, -2144, -1990, -1898, -1763, -1605, -1382, -1175, -973, -760,
-    -558, -348, -159, 105, 311, 462, 688, 887, 1107, 1379, 1577, 1801,
-    2078, 2329, 2560, 2745, 2894, 3058, 3333, 3510, 3742, 3944, 4192, 4426,
-    4618, 4783, 4964, 5096, 5260, 5346, 5307, 5271, 5229, 5098, 4867, 4572,
-    4275, 3956, 3620, 3231, 2791, 2263, 1734, 1207, 740, 291, -147, -535,
-    -916, -1317, -1751, -2066, -2399, -2680, -2881, -3037, -3178, -3243, -3307, -3365,
-    -3393, -3399, -3388, -3323, -3248, -3106, -2909, -2708, -2543, -2374, -2152, -1918,
-    -1665, -1357, -1103, -787, -571, -334, -146, 114, 390, 786, 1178, 1531,
-    1787, 1996, 2205, 2401, 2637, 2827, 3112, 3430, 3736, 3999, 4213, 4355,
-    4489, 4654, 4824, 4994, 5144, 5334, 5536, 5735, 5847, 5979, 6059, 6164,
-    6258, 6383, 6532, 6748, 6874, 6951, 6966, 6987, 7047, 7145, 7296, 7464,
-    7616, 7699, 7712, 7782, 7772, 7800, 7872, 7938, 8011, 8113, 8240, 8335,
-    8385, 8417, 8372, 8345, 8392, 8495, 8620, 8723, 8742, 8705, 8712, 8720,
-    8718, 8766, 8838, 8898, 8895, 8850, 8814, 8786, 8802, 8814, 8822, 8846,
-    8919, 8919, 8852, 8766, 8675, 8602, 8646, 8725, 8750, 8731, 8728, 8696,
-    8674, 8598, 8558, 8565, 8544, 8547, 8560, 8511, 8464, 8420, 8355, 8264,
-    8201, 8191, 8231, 8218, 8164, 8064, 7992, 7918, 7812, 7725, 7654, 7570,
-    7522, 7510, 7461, 7336, 7197, 7031, 6786, 6515, 6240, 5884, 5503, 5106,
-    4619, 3999, 3372, 2724, 2109, 1487, 810, 130, -632, -1375, -2140, -2853,
-    -3515, -4136, -4787, -5424, -6011, -6606, -7181, -7730, -8154, -8589, -8962, -9382,
-    -9791, -10095, -10393, -10692, -10893, -10961, -11156, -11330, -11354, -11495, -11494, -11561,
-    -11747, -11823, -11833, -11645, -11562, -11428, -11341, -11364, -11320, -11329, -11258, -11129,
-    -11042, -10891, -10753, -10602, -10466, -10382, -10306, -10293, -10212, -10037, -9924, -9808,
-    -9777, -9693, -9511, -9397, -9360, -9338, -9267, -9157, -9027, -8875, -8844, -8822,
-    -8762, -8738, -8648, -8577, -8536, -8464, -8384, -8199, -8088, -8120, -8119, -8078,
-    -8037, -7899, -7724, -7671, -7596, -7491, -7390, -7295, -7226, -7140, -7051, -6898,
-    -6816, -6674, -6501, -6388, -6275, -6147, -6105, -5967, -5801, -5696, -5547, -5381,
-    -5269, -5059, -4851, -4893, -4835, -4492, -4235, -3930, -3755, -3970, -3967, -3693,
-    -3321, -2890, -2689, -2636, -2480, -2293, -2165, -2086, -1911, -1674, -1344, -986,
-    -777, -608, -440, -390, -312, -110, 196, 501, 700, 784, 997, 1266,
-    1421, 1541, 1651, 1828, 2094, 2427, 2629, 2773, 2979, 3066, 3231, 3485,
-    3598, 3886, 4111, 4261, 4505, 4662, 4754, 4805, 4784, 4724, 4678, 4677,
-    4664, 4632, 4423, 4050, 3699, 3389, 3070, 2751, 2379, 1977, 1619, 1261,
-    923, 435, 32, -338, -669, -936, -1145, -1464, -1796, -2040, -2216, -2377,
-    -2458, -2519, -2606, -2868, -2923, -2808, -2648, -2451, -2558, -2819, -2801, -2516,
-    -2168, -1844, -1778, -1638, -1331, -1104, -935, -887, -798, -497, -12, 455,
-    652, 759, 873, 1054, 1356, 1653, 1860, 2202, 2476, 2695, 2965, 3150,
-    3264, 3384, 3604, 3853, 4202, 4496, 4645, 4849, 5067, 5256, 5380, 5441,
-    5515, 5756, 5964, 6264, 6483, 6543, 6662, 6742, 6766, 6859, 7024, 7129,
-    7221, 7406, 7561, 7639, 7711, 7695, 7738, 7845, 7919, 8040, 8103, 8091,
-    8118, 8086, 8165, 8252, 8326, 8342, 8378, 8335, 8191, 8243, 8344, 8410,
-    8489, 8510, 8358, 8441, 8465, 8195, 8267, 8488, 8710, 8992, 8776, 8222,
-    8095, 8199, 8456, 8854, 8779, 8638, 8661, 8684, 8645, 8417, 8197, 8203,
-    8562, 8933, 8983, 8734, 8391, 8149, 8217, 8300, 8242, 8327, 8416, 8436,
-    8392, 8192, 8005, 7904, 7780, 7755, 7852, 7893, 7797, 7636, 7557, 7539,
-    7502, 7415, 7245, 7135, 7123, 7094, 7054, 6893, 6717, 6535, 6189, 5812,
-    5507, 5167, 4835, 4431, 3932, 3327, 2811, 2195, 1466, 819, 213, -404,
-    -1061, -1599, -2237, -2910, -3593, -4249, -4845, -5405, -5897, -6445, -6931, -7505,
-    -8067, -8441, -8759, -9186, -9510, -9811, -10147, -10357, -10613, -10821, -10991, -11381,
-    -11534, -11483, -11287, -11079, -11235, -11731, -12044, -12061, -11860, -11468, -11426, -11578,
-    -11528, -11340, -11248, -11361, -11607, -11684, -11395, -10868, -10548, -10584, -10856, -10924,
-    -10740, -10399, -10364, -10267, -10163, -9913, -9536, -9460, -9521, -9554, -9511, -9394,
-    -9172, -8959, -8800, -8749, -8703, -8620, -8497, -8393, -8417, -8401, -8287, -8164,
-    -7968, -7882, -7862, -7775, -7644, -7583, -7505, -7444, -7391, -7333, -7198, -7055,
-    -6896, -6747, -6676, -6655, -6593, -6562, -6463, -6300, -6170, -6037, -5927, -5746,
-    -5597, -5535, -5494, -5466, -5361, -5195, -5003, -4735, -4577, -4467, -4348, -4291,
-    -4180, -4060, -3927, -3706, -3466, -3140, -2977, -2959, -2897, -2652, -2225, -1847,
-    -1805, -1897, -1891, -1659, -1265, -753, -608, -677, -378, -97, 188, 323,
-    145, 109, 489, 1060, 1654, 1875, 1745, 1665, 1938, 2283, 2480, 2687,
-    2865, 3179, 3636, 3862, 3967, 4021, 4068, 4257, 4535, 4711, 4792, 4771,
-    4766, 4812, 4852, 4764, 4492, 4121, 3848, 3657, 3496, 3277, 2969, 2596,
-    2304, 2012, 1648, 1240, 817, 492, 219, 36, -133, -475, -870, -1126,
-    -1380, -1580, -1650, -1766, -1975, -2119, -2161, -2140, -2176, -2223, -2314, -2279,
-    -2193, -2115, -1985, -1883, -1740, -1523, -1390, -1333, -1334, -1274, -1023, -639,
-    -334, -127, 138, 357, 300, 497, 894, 1305, 1933, 2101, 1945, 1949,
-    2158, 2537, 3088, 3441, 3500, 3734, 3984, 4224, 4387, 4377, 4347, 4636,
-    5156, 5627, 5773, 5603, 5510, 5726, 5975, 6081, 6135, 6260, 6525, 6960,
-    7104, 6970, 6839, 6783, 6848, 7026, 7207, 7380, 7529, 7551, 7517, 7539,
-    7532, 7546, 7579, 7632, 7735, 7820, 7890, 7890, 7969, 8016, 8072, 8062,
-    7942, 7849, 7885, 8002, 8024, 8033, 8101, 8161, 8146, 8131, 8056, 7946,
-    7941, 7883, 7969, 8138, 8182, 8120, 7971, 7874, 7778, 7712, 7683, 7659,
-    7761, 7932, 8035, 7830, 7526, 7413, 7418, 7483, 7477, 7290, 7205, 7216,
-    7237, 7338, 7180, 6904, 6921, 7049, 7244, 7233, 6831, 6473, 6476, 6578,
-    6803, 6924, 6766, 6582, 6535, 6478, 6335, 6116, 5841, 5630, 5704, 5916,
-    5902, 5593, 4956, 4447, 4324, 4188, 3801, 3295, 2899, 2633, 2318, 1850,
-    1299, 693, 200, -178, -553, -956, -1454, -1991, -2499, -2885, -3188, -3618,
-    -4070, -4562, -5016, -5281, -5619, -6004, -6261, -6496, -6817, -7085, -7302, -7611,
-    -7922, -8197, -8413, -8502, -8501, -8591, -8800, -9004, -9165, -9286, -9415, -9526,
-    -9511, -9425, -9361, -9305, -9337, -9553, -9700, -9661, -9554, -9236, -9068, -9151,
-    -9211, -9227, -9256, -9124, -9005, -8983, -8789, -8635, -8559, -8486, -8497, -8484,
-    -8329, -8191, -8187, -8103, -7889, -7613, -7348, -7297, -7617, -7812, -7697, -7492,
-    -6986, -6686, -6737, -6684, -6609, -6553, -6534, -6622, -6725, -6487, -5992, -5624,
-    -5561, -5792, -5938, -5838, -5587, -5484, -5416, -5306, -5092, -4789, -4733, -4819,
-    -4899, -4824, -4732, -4663, -4480, -4309, -4157, -4033, -4015, -3962, -3829, -3744,
-    -3659, -3510, -3352, -3142, -2963, -2859, -2790, -2734, -2593, -2473, -2388, -2229,
-    -2100, -1960, -1790, -1615, -1520, -1395, -1271, -1212, -1081, -940, -802, -704,
-    -567, -364, -124, 129, 119, -13, 12, 189, 525, 864, 1020, 1118,
-    1225, 1291, 1411, 1491, 1503, 1636, 1915, 2203, 2451, 2560, 2423, 2370,
-    2397, 2486, 2556, 2565, 2758, 3007, 3207, 3158, 2763, 2342, 2100, 2071,
-    2285, 2463, 2383, 2076, 1773, 1730, 1628, 1326, 932, 733, 856, 1126,
-    1181, 707, 246, 85, 54, 55, -71, -253, -312, -178, -150, -395,
-    -644, -875, -938, -834, -815, -807, -824, -907, -918, -952, -1001, -946,
-    -923, -949, -891, -703, -603, -559, -446, -378, -305, -268, -254, -81,
-    147, 331, 483, 546, 671, 832, 913, 942, 1031, 1106, 1257, 1590,
-    1778, 1832, 1981, 2125, 2075, 2151, 2234, 2233, 2542, 2847, 2988, 3055,
-    2958, 2891, 2974, 3194, 3463, 3567, 3705, 3818, 3866, 3916, 3792, 3839,
-    4004, 4187, 4449, 4423, 4374, 4559, 4727, 4876, 4915, 4711, 4584, 4638,
-    4783, 5126, 5310, 5225, 5145, 5095, 5093, 5126, 5024, 4856, 4973, 5259,
-    5501, 5483, 5239, 4995, 5030, 5359, 5389, 5208, 5107, 5164, 5348, 5426,
-    5273, 5037, 4994, 5095, 5177, 5183, 5119, 5046, 5017, 4990, 5039, 5064,
-    4931, 4783, 4717, 4775, 4932, 4924, 4706, 4568, 4565, 4641, 4654, 4595,
-    4495, 4367, 4454, 4574, 4569, 4568, 4423, 4350, 4389, 4357, 4333, 4196,
-    4003, 3962, 4054, 4110, 3988, 3690, 3459, 3393, 3361, 3150, 2793, 2543,
-    2463, 2391, 2139, 1784, 1427, 1243, 1165, 958, 669, 352, 83, -96,
-    -300, -509, -775, -1048, -1240, -1547, -1758, -1888, -2017, -2057, -2308, -2776,
-    -3176, -3413, -3466, -3385, -3471, -3776, -4071, -4252, -4314, -4458, -4734, -5016,
-    -5102, -4845, -4695, -4858, -5239, -5626, -5649, -5464, -5435, -5573, -5737, -5780,
-    -5662, -5738, -5941, -6036, -5979, -5881, -5855, -5827, -5925, -5958, -5905, -5920,
-    -5945, -5867, -5740, -5671, -5584, -5494, -5530, -5661, -5650, -5573, -5431, -5300,
-    -5285, -5223, -5209, -5216, -5155, -5109, -4989, -4777, -4685, -4641, -4599, -4604,
-    -4493, -4406, -4468, -4470, -4289, -4054, -3932, -3923, -3929, -3903, -3813, -3723,
-    -3746, -3738, -3629, -3510, -3386, -3364, -3444, -3440, -3388, -3272, -3084, -2980,
-    -2898, -2830, -2830, -2868, -2850, -2747, -2660, -2469, -2373, -2397, -2219, -2034,
-    -1920, -1886, -2048, -2089, -1882, -1660, -1342, -1103, -1171, -1345, -1386, -1257,
-    -1087, -917, -845, -767, -488, -223, -243, -468, -734, -637, -239, -72,
-    -36, 62, 111, 255, 465, 375, 382, 541, 604, 684, 771, 811,
-    949, 1219, 1289, 1285, 1250, 1193, 1223, 1264, 1314, 1477, 1574, 1524,
-    1531, 1470, 1386, 1333, 1304, 1258, 1322, 1423, 1239, 1055, 1021, 1030,
-    1163, 1169, 965, 853, 838, 869, 756, 453, 284, 307, 501, 673,
-    543, 326, 121, 52, 50, -7, 30, 78, 38, 21, 36, -27,
-    -42, -139, -222, -215, -99, 19, -85, -231, -264, -161, -76, -33,
-    -117, -121, -29, 77, 247, 314, 269, 216, 230, 269, 498, 741,
-    744, 658, 646, 732, 873, 950, 924, 1008, 1204, 1367, 1486, 1459,
-    1368, 1420, 1504, 1473, 1523, 1622, 1715, 2050, 2148, 1997, 1992, 2079,
-    2168, 2278, 2303, 2278, 2451, 2579, 2625, 2543, 2428, 2431, 2620, 2809,
-    2879, 2969, 2890, 2879, 2924, 2965, 3116, 3254, 3212, 3047, 3053, 3117,
-    3168, 3226, 3229, 3211, 3340, 3537, 3482, 3298, 3199, 3269, 3396, 3456,
-    3379, 3221, 3244, 3363, 3518, 3533, 3394, 3390, 3435, 3502, 3549, 3479,
-    3379, 3309, 3289, 3282, 3272, 3300, 3311, 3288, 3305, 3323, 3226, 3124,
-    3021, 2938, 2941, 2988, 3009, 2997, 3065, 3069, 3138, 3206, 2989, 2698,
-    2596, 2636, 2868, 3147, 3011, 2692, 2474, 2400, 2525, 2511, 2177, 1944,
-    2017, 2207, 2359, 2251, 1759, 1369, 1336, 1369, 1383, 1168, 812, 729,
-    853, 825, 614, 279, 28, 22, 105, 22, -342, -589, -710, -755,
-    -834, -1148, -1288, -1322, -1382, -1330, -1478, -1736, -1853, -2039, -2171, -2281,
-    -2413, -2393, -2382, -2435, -2556, -2740, -2968, -3104, -3079, -3118, -3135, -3104,
-    -3184, -3188, -3264, -3486, -3574, -3567, -3472, -3404, -3491, -3618, -3632, -3569,
-    -3533, -3578, -3723, -3740, -3564, -3440, -3489, -3629, -3816, -3869, -3720, -3596,
-    -3598, -3626, -3634, -3581, -3425, -3422, -3517, -3585, -3641, -3491, -3347, -3431,
-    -3424, -3321, -3230, -2986, -2878, -3009, -3034, -2986, -2936, -2818, -2851, -2924,
-    -2801, -2706, -2660, -2574, -2557, -2557, -2450, -2364, -2395, -2383, -2252, -2050,
-    -1909, -2005, -2173, -2165, -2101, -2018, -1895, -1875, -1858, -1668, -1505, -1529,
-    -1590, -1655, -1705, -1626, -1509, -1449, -1380, -1275, -1128, -960, -881, -995,
-    -1159, -1138, -956, -717, -637, -693, -635, -491, -374, -353, -525, -681,
-    -573, -299, -99, -60, -49, -42, 34, 127, 82, 47, 125, 333,
-    560, 608, 487, 351, 386, 524, 652, 679, 697, 741, 891, 975,
-    875, 628, 480, 524, 698, 871, 829, 710, 610, 634, 778, 778,
-    597, 506, 538, 694, 898, 856, 628, 392, 350, 505, 681, 710,
-    564, 350, 349, 411, 437, 285, 96, 58, 246, 433, 396, 159,
-    -65, -59, 127, 215, 139, 36, 63, 200, 125, 8, -119, -202,
-    -82, 15, 117, 56, 39, 40, -21, 48, 113, 172, 177, 175,
-    222, 360, 317, 269, 322, 366, 528, 553, 643, 736, 734, 694,
-    628, 699, 839, 872, 906, 1026, 955, 835, 649, 756, 843, 1052,
-    1197, 1224, 1291, 1332, 1155, 1043, 1060, 1139, 1203, 1526, 1667, 1486,
-    1471, 1637, 1535, 1332, 1447, 1531, 1365, 1505, 1681, 1700, 1672, 1540,
-    1712, 1905, 2061, 2394, 4141, 8317, 8897, 8455, 8357, 8400, 8541, 8494,
-    8439, 8343, 8183, 7831, 7714, 7473, 6817, 6942, 7153, 7025, 6969, 6700,
-    6943, 7028, 6338, 5517, 5681, 6068, 7450, 7536, 8445, 8233, 9581, 10689,
-    11131, 9937, 8532, 6860, 3155, -17, -3099, -5067, -7784, -8768, -8501, -9148,
-    -11283, -14754, -16627, -13330, -9808, -8436, -7216, -2261, 4415, 8675, 8423, 9157,
-    11976, 13264, 13637, 13087, 16089, 17935, 17802, 15860, 12508, 1504, -13487, -9550,
-    10881, 709, -651, -2875, -2960, -3524, -2181, -1397, -4408, -5859, 1373, 10888,
-    15382, 15838, 15606, 14829, 13663, 11944, 9452, 6360, 4019, 1641, -2468, -5408,
-    -7017, -8188, -9633, -11842, -13283, -13831, -14897, -16886, -16991, -16178, -16812, -17507,
-    -17655, -18317, -17826, -17733, -18105, -17599, -17665, -17511, -16547, -15509, -15616, -15352,
-    -14251, -12075, -11603, -14102, -16827, -17566, -17227, -16127, -15007, -13543, -12842, -11227,
-    -8440, -4847, -680, 2293, 3583, 5161, 7823, 10253, 11814, 12211, 12665, 13348,
-    14043, 15395, 15988, 15820, 15958, 15944, 15899, 15902, 15832, 15879, 15230, 15249,
-    14903, 14693, 14193, 13919, 13653, 13378, 12781, 12029, 11456, 11292, 10962, 9787,
-    8761, 7727, 7760, 8166, 8906, 10003, 9903, 9813, 9702, 8972, 8363, 7358,
-    5522, 2606, -558, -3881, -6755, -8406, -10394, -11893, -13334, -15069, -16344, -17142,
-    -18144, -19329, -20013, -20031, -20341, -20699, -21112, -21788, -22438, -22202, -21843, -21165,
-    -20543, -20161, -20010, -19719, -19260, -18390, -17313, -16474, -16198, -16404, -16775, -17429,
-    -17712, -17522, -16675, -15745, -15333, -15048, -14308, -11959, -8894, -6307, -3991, -1171,
-    1514, 4757, 7365, 8922, 10045, 10790, 11399, 11943, 12749, 13714, 14451, 14926,
-    14794, 15148, 15482, 15732, 15783, 15582, 15106, 15060, 15158, 15193, 14510, 13555,
-    12777, 12646, 12667, 12189, 11355, 10663, 10470, 10274, 9480, 8523, 7933, 8667,
-    10144, 11531, 12362, 12701, 13049, 12976, 12013, 10156, 7812, 5573, 2978, -16,
-    -3155, -5862, -7794, -9349, -10498, -11423, -12673, -13874, -14701, -15315, -15563, -15887,
-    -16222, -16773, -17244, -17005, -16858, -16791, -16432, -15963, -15701, -15835, -15579, -15050,
-    -14742, -14678, -14479, -14107, -13249, -12203, -11354, -10563, -9494, -8354, -7415, -6379,
-    -6038, -6398, -7219, -8128, -8853, -8924, -8606, -8406, -8173, -7075, -5208, -1947,
-    1722, 5230, 7789, 9585, 11290, 13061, 14786, 16146, 16955, 17410, 18020, 18722,
-    19403, 19964, 20414, 20912, 21658, 21886, 21740, 21514, 21270, 20881, 20379, 20034,
-    19894, 19674, 19272, 18620, 17862, 17119, 16581, 16574, 16161, 15239, 14106, 13162,
-    12519, 12147, 12068, 11688, 10985, 9908, 9165, 8905, 8958, 9198, 9519, 9874,
-    10087, 10112, 9897, 9780, 8934, 7564, 5643, 2666, -319, -3185, -5447, -7217,
-    -8869, -10679, -12269, -13407, -14343, -15191, -16290, -17292, -17844, -17944, -17326, -16642,
-    -16658, -16808, -16890, -16961, -16727, -16685, -16846, -16771, -16152, -15470, -14870, -14352,
-    -13819, -13256, -12523, -11652, -10916, -10481, -9924, -9269, -8486, -7900, -7684, -7639,
-    -7165, -6354, -5826, -5754, -5918, -6350, -6629, -6934, -7157, -7105, -6931, -6857,
-    -6606, -5544, -3415, -581, 2466, 5112, 6953, 8765, 10165, 11572, 13063, 14494,
-    15521, 16281, 16678, 17044, 17544, 17978, 18287, 18332, 18371, 18370, 18282, 18126,
-    17999, 17980, 17938, 17630, 16983, 16127, 15369, 14763, 14301, 13973, 13214, 12510,
-    11815, 11178, 10459, 9636, 8464, 7427, 6767, 6330, 5986, 5328, 4705, 3896,
-    2899, 1852, 751, -743, -2083, -2904, -2970, -2809, -2721, -2531, -2367, -2300,
-    -2227, -2526, -3191, -4053, -4752, -5998, -7519, -8856, -10297, -11885, -13374, -14778,
-    -16140, -17530, -18781, -19774, -20520, -21251, -22157, -22869, -23256, -23205, -22983, -22740,
-    -22649, -22601, -22391, -22043, -21622, -21382, -21272, -20947, -20511, -19679, -18606, -17653,
-    -16762, -15933, -15206, -14527, -13801, -13072, -12275, -11750, -11019, -10299, -9448, -8510,
-    -7678, -7228, -6818, -6199, -4981, -3557, -1868, -799, -418, -196, -192, -134,
-    -227, -168, 213, 884, 1839, 2859, 3924, 4745, 5591, 6711, 8163, 9743,
-    11373, 13048, 14679, 16323, 17869, 19183, 20377, 21162, 21848, 22378, 22945, 23507,
-    23958, 24098, 24001, 23759, 23508, 23171, 22911, 22258, 21768, 21258, 20732, 20469,
-    20087, 19536, 18708, 17754, 17227, 16749, 16145, 15293, 14156, 13217, 12379, 11592,
-    10887, 10118, 9365, 8443, 7650, 6887, 5977, 4921, 3594, 2590, 1627, 808,
-    -134, -1223, -2571, -3905, -4844, -5056, -5145, -5252, -5400, -5503, -5583, -5851,
-    -6145, -6673, -7258, -7753, -8243, -8773, -9397, -9868, -10323, -10267, -10497, -11167,
-    -12381, -13778, -15123, -16367, -17578, -18876, -20130, -20977, -21349, -21569, -21760, -22145,
-    -22564, -22700, -22740, -22666, -22601, -22448, -21839, -20971, -20092, -19285, -18551, -18020,
-    -17427, -16780, -16135, -15675, -15197, -14571, -13829, -13022, -12115, -11141, -10178, -9365,
-    -8551, -7824, -7132, -6409, -5642, -4768, -3664, -2442, -1321, -236, 738, 1782,
-    2665, 3648, 4545, 5289, 6275, 7133, 7991, 8588, 8724, 8524, 8573, 8589,
-    8505, 8514, 8511, 8605, 8884, 9255, 9753, 10375, 10931, 11605, 12446, 13099,
-    13798, 14687, 15847, 17091, 18468, 19751, 20990, 21833, 22501, 23106, 23554, 23879,
-    24257, 24428, 24418, 24301, 24141, 23749, 23096, 22540, 21965, 21383, 20586, 19827,
-    19076, 18463, 17770, 17106, 16513, 15795, 15278, 14697, 14090, 13333, 12320, 11378,
-    10547, 9716, 8855, 7997, 7213, 6484, 5654, 4476, 3046, 1824, 815, -212,
-    -1177, -2039, -3022, -4100, -4965, -5559, -6275, -7087, -7932, -8553, -9181, -9781,
-    -10571, -10996, -11122, -11134, -11245, -11457, -11532, -11752, -11913, -12177, -12614, -13081,
-    -13484, -13737, -13709, -13831, -14322, -14930, -15461, -15869, -16301, -16747, -17257, -17585,
-    -17566, -17608, -17759, -17362, -17389, -17732, -18246, -18718, -19298, -19873, -20356, -20612,
-    -20797, -20725, -20582, -20214, -19553, -18771, -18106, -17422, -16790, -16356, -15922, -15281,
-    -14557, -13946, -13359, -12838, -12306, -11883, -11438, -10969, -10490, -10043, -9309, -8537,
-    -7573, -6729, -5875, -4711, -3570, -2453, -1349, -252, 805, 1824, 2960, 3953,
-    4812, 5495, 6150, 6775, 7435, 8154, 8904, 9537, 10160, 10801, 11106, 11498,
-    11961, 12356, 12715, 13208, 13863, 14078, 14058, 14185, 14305, 14294, 14150, 14032,
-    14069, 14078, 13926, 13757, 13761, 13921, 14248, 14673, 14883, 15132, 15544, 16020,
-    16496, 17112, 17747, 18211, 18858, 19561, 20296, 20858, 21307, 21551, 21422, 21032,
-    20505, 19762, 18833, 18019, 17312, 16685, 16069, 15548, 14906, 14315, 13825, 13229,
-    12609, 12011, 11546, 11010, 10406, 9864, 9213, 8793, 8289, 7865, 7529, 7123,
-    6565, 6117, 5823, 5474, 4899, 4064, 2725, 1437, 244, -958, -2139, -3396,
-    -4618, -5448, -6192, -6994, -7703, -8628, -9359, -10109, -10946, -11503, -12213, -12755,
-    -13251, -13694, -14169, -14605, -15141, -15731, -16240, -16697, -17098, -17507, -17738, -17743,
-    -17577, -17377, -17267, -17184, -17181, -17108, -17168, -17131, -17143, -17151, -17034, -17047,
-    -16937, -16968, -17059, -17096, -17017, -16954, -16914, -16957, -16995, -16907, -16862, -16878,
-    -17099, -17264, -17337, -17392, -17344, -17254, -17135, -17282, -17456, -17486, -17575, -17390,
-    -16884, -16385, -15739, -15091, -14417, -13889, -13178, -12498, -11814, -11357, -10983, -10485,
-    -10041, -9487, -8854, -8354, -7818, -7282, -6744, -6279, -5904, -5596, -5293, -4873,
-    -4166, -3501, -2803, -2058, -1040, 487, 1901, 3277, 4637, 5872, 6804, 7668,
-    8565, 9371, 10063, 10744, 11499, 12244, 12954, 13509, 14086, 14686, 15210, 15648,
-    15957, 16324, 16715, 17166, 17711, 18129, 18361, 18614, 18845, 19078, 19310, 19435,
-    19608, 19832, 20111, 20171, 20129, 19899, 19354, 18994, 18728, 18583, 18455, 18423,
-    18442, 18411, 18288, 18037, 17815, 17707, 17446, 17351, 17261, 17245, 17337, 17292,
-    17077, 16963, 16847, 16745, 16755, 16788, 16737, 16644, 16514, 16625, 16771, 16703,
-    16271, 15776, 15116, 14531, 14131, 13636, 13083, 12489, 11946, 11312, 10717, 10239,
-    9883, 9521, 8987, 8398, 7812, 7066, 6517, 6131, 5790, 5523, 5120, 4403,
-    3700, 2986, 2279, 1611, 942, 327, -132, -674, -1301, -2421, -3717, -5048,
-    -6249, -7224, -8200, -9109, -9842, -10495, -11221, -11825, -12370, -12979, -13750, -14503,
-    -15249, -15946, -16449, -16821, -17210, -17629, -18168, -18577, -18974, -19342, -19656, -19859,
-    -20062, -20387, -20652, -20907, -21064, -21239, -21330, -21415, -21327, -21131, -20881, -20703,
-    -20649, -20482, -20273, -20142, -20034, -19853, -19561, -19211, -18891, -18763, -18782, -18799,
-    -18566, -18373, -18090, -17891, -17719, -17557, -17349, -17142, -16870, -16638, -16486, -16268,
-    -16067, -15818, -15620, -15504, -15323, -15027, -14581, -13962, -13363, -12695, -12009, -11340,
-    -10836, -10410, -10008, -9500, -8966, -8220, -7584, -7128, -6840, -6537, -6099, -5512,
-    -4766, -3898, -3047, -2321, -1646, -1018, -474, 25, 427, 948, 1641, 2483,
-    3117, 3524, 3841, 4178, 4428, 4789, 5224, 5864, 6889, 7861, 8685, 9428,
-    10145, 10807, 11611, 12401, 13089, 13777, 14447, 15190, 15814, 16365, 16842, 17387,
-    17924, 18403, 18859, 19365, 19822, 20281, 20646, 20884, 20971, 21130, 21347, 21626,
-    21935, 22102, 22229, 22206, 22135, 22279, 22311, 22397, 22506, 22554, 22549, 22502,
-    22366, 22096, 21792, 21548, 21483, 21478, 21352, 21156, 20874, 20584, 20337, 20064,
-    19597, 19124, 18610, 18134, 17707, 17096, 16465, 15866, 15374, 14886, 14382, 14044,
-    13687, 13397, 13154, 12904, 12453, 11787, 11195, 10640, 10068, 9494, 8911, 8318,
-    7836, 7434, 6974, 6451, 6014, 5733, 5382, 4749, 3731, 2754, 1901, 1296,
-    798, 317, -220, -767, -1283, -1802, -2448, -3100, -3842, -4440, -4749, -4927,
-    -5071, -5394, -5843, -6244, -6602, -6909, -7157, -7319, -7506, -7555, -7616, -7794,
-    -8137, -8573, -8892, -9022, -9063, -9098, -9325, -9648, -10219, -10939, -11738, -12468,
-    -13269, -13920, -14490, -15008, -15674, -16334, -16986, -17617, -18193, -18708, -19176, -19496,
-    -19849, -20206, -20621, -21061, -21649, -22105, -22369, -22500, -22481, -22494, -22557, -22681,
-    -22889, -23080, -23439, -23702, -23671, -23586, -23405, -23200, -23080, -22923, -22719, -22549,
-    -22511, -22454, -22313, -22049, -21705, -21349, -21013, -20651, -20481, -20358, -20182, -19834,
-    -19334, -18757, -18151, -17445, -16832, -16290, -15810, -15368, -14917, -14519, -14172, -13915,
-    -13549, -13115, -12645, -12281, -11979, -11467, -10999, -10309, -9632, -9016, -8434, -7947,
-    -7433, -6930, -6387, -5882, -5388, -4806, -3981, -3149, -2333, -1684, -1013, -418,
-    187, 885, 1550, 2167, 2792, 3380, 3950, 4488, 4946, 5304, 5675, 6004,
-    6376, 6742, 7076, 7295, 7437, 7653, 7915, 8191, 8455, 8687, 8926, 9131,
-    9339, 9590, 9833, 10069, 10235, 10330, 10488, 10674, 10898, 11331, 11820, 12374,
-    12916, 13426, 13951, 14558, 15170, 15633, 16004, 16273, 16672, 17259, 17800, 18305,
-    18836, 19406, 19928, 20370, 20635, 20824, 21091, 21381, 21808, 22193, 22562, 22830,
-    23039, 23133, 23267, 23381, 23416, 23507, 23575, 23774, 23803, 23845, 23826, 23901,
-    23932, 23836, 23691, 23525, 23257, 23098, 22892, 22727, 22502, 22284, 22119, 21881,
-    21629, 21230, 20827, 20345, 19840, 19389, 19005, 18741, 18347, 17967, 17594, 17225,
-    16741, 16130, 15418, 14667, 14026, 13600, 13138, 12723, 12219, 11648, 11081, 10422,
-    9808, 9180, 8526, 7916, 7415, 6953, 6497, 6043, 5544, 4946, 4165, 3351,
-    2572, 1821, 1083, 416, -194, -790, -1378, -1945, -2545, -3163, -3769, -4414,
-    -5022, -5528, -5866, -6167, -6470, -6699, -6858, -7225, -7649, -8018, -8525, -8863,
-    -9188, -9458, -9677, -9959, -10220, -10450, -10690, -10964, -11174, -11451, -11872, -12302,
-    -12576, -12826, -13002, -13215, -13434, -13615, -13770, -13976, -14269, -14535, -14830, -15034,
-    -15285, -15462, -15626, -15843, -16001, -16243, -16562, -16809, -17062, -17346, -17497, -17692,
-    -17861, -18088, -18317, -18536, -18744, -18929, -19102, -19296, -19578, -19825, -20019, -20101,
-    -20196, -20242, -20351, -20542, -20751, -21036, -21239, -21337, -21427, -21488, -21499, -21435,
-    -21449, -21497, -21557, -21500, -21401, -21251, -21038, -20892, -20741, -20683, -20594, -20404,
-    -20205, -19899, -19507, -19145, -18728, -18389, -18075, -17766, -17508, -17168, -16759, -16236,
-    -15695, -15183, -14697, -14279, -13798, -13312, -12891, -12442, -11948, -11353, -10698, -10065,
-    -9411, -8827, -8355, -7917, -7363, -6834, -6282, -5649, -5056, -4322, -3491, -2741,
-    -2024, -1265, -539, 195, 857, 1506, 2083, 2603, 3258, 3902, 4480, 5101,
-    5572, 5906, 6225, 6638, 6905, 7136, 7394, 7532, 7755, 8065, 8354, 8652,
-    8945, 9265, 9489, 9609, 9718, 9919, 10184, 10385, 10691, 10998, 11210, 11418,
-    11578, 11774, 11906, 12106, 12415, 12644, 12928, 13216, 13431, 13662, 13880, 14142,
-    14365, 14599, 14836, 15070, 15403, 15677, 15926, 16239, 16380, 16558, 16732, 16927,
-    17069, 17160, 17352, 17573, 17849, 18157, 18387, 18491, 18478, 18485, 18618, 18808,
-    19037, 19190, 19238, 19298, 19379, 19510, 19589, 19710, 19809, 19942, 20093, 20161,
-    20225, 20208, 20188, 20232, 20257, 20352, 20419, 20496, 20509, 20505, 20454, 20351,
-    20217, 20136, 20087, 20060, 20003, 19911, 19729, 19454, 19300, 19107, 18957, 18770,
-    18490, 18188, 17823, 17428, 17017, 16651, 16327, 15855, 15449, 14967, 14442, 13921,
-    13397, 12877, 12346, 11863, 11373, 10795, 10197, 9559, 8931, 8404, 7938, 7574,
-    7128, 6502, 5841, 5150, 4364, 3516, 2715, 2041, 1395, 786, 170, -607,
-    -1437, -2215, -2909, -3462, -4007, -4577, -5125, -5571, -5936, -6330, -6689, -7041,
-    -7324, -7552, -7785, -7995, -8286, -8600, -8935, -9227, -9421, -9650, -9822, -10041,
-    -10280, -10508, -10741, -10991, -11257, -11487, -11706, -11930, -12158, -12392, -12644, -12884,
-    -13147, -13398, -13629, -13858, -14052, -14255, -14505, -14755, -14854, -15028, -15250, -15453,
-    -15740, -16050, -16360, -16609, -16766, -16918, -17070, -17264, -17425, -17572, -17813, -18111,
-    -18348, -18572, -18699, -18830, -18957, -19175, -19377, -19569, -19747, -19895, -19953, -20009,
-    -20068, -20107, -20201, -20253, -20355, -20466, -20523, -20528, -20528, -20467, -20411, -20396,
-    -20400, -20326, -20214, -20080, -19957, -19866, -19793, -19746, -19704, -19654, -19587, -19466,
-    -19224, -18970, -18688, -18380, -18224, -18145, -18089, -18061, -17947, -17726, -17333, -16859,
-    -16368, -15926, -15697, -15612, -15513, -15342, -15053, -14651, -14130, -13604, -13078, -12546,
-    -12159, -11936, -11679, -11385, -11075, -10641, -10081, -9457, -8889, -8376, -7886, -7484,
-    -7139, -6781, -6337, -5838, -5219, -4458, -3706, -2931, -2130, -1399, -666, 50,
-    669, 1309, 1990, 2598, 3220, 3806, 4382, 4867, 5253, 5662, 6040, 6383,
-    6690, 6970, 7117, 7355, 7610, 7936, 8264, 8503, 8731, 8859, 9087, 9342,
-    9598, 9739, 9735, 9851, 10011, 10233, 10434, 10597, 10761, 10856, 10906, 10921,
-    10874, 10995, 11199, 11498, 11796, 11957, 12087, 12101, 12096, 12157, 12286, 12477,
-    12649, 12908, 13177, 13392, 13547, 13684, 13870, 14045, 14283, 14611, 14922, 15065,
-    15222, 15415, 15628, 15945, 16294, 16663, 16981, 17251, 17397, 17486, 17634, 17823,
-    18145, 18482, 18866, 19190, 19376, 19559, 19644, 19719, 19825, 19937, 20106, 20375,
-    20679, 20986, 21247, 21402, 21393, 21332, 21280, 21290, 21363, 21488, 21639, 21756,
-    21795, 21816, 21808, 21679, 21464, 21246, 21049, 20929, 20896, 20850, 20742, 20559,
-    20307, 20081, 19861, 19684, 19470, 19188, 18916, 18589, 18279, 17960, 17673, 17450,
-    17173, 16853, 16440, 15966, 15462, 14965, 14515, 14130, 13781, 13499, 13122, 12593,
-    12038, 11430, 10865, 10302, 9745, 9253, 8802, 8415, 7987, 7489, 6906, 6336,
-    5753, 5121, 4491, 3756, 3060, 2427, 1704, 905, 93, -720, -1534, -2342,
-    -3026, -3590, -4141, -4675, -5222, -5772, -6267, -6714, -7113, -7401, -7612, -7838,
-    -8126, -8428, -8726, -8972, -9165, -9439, -9691, -9892, -10133, -10379, -10627, -10868,
-    -11114, -11239, -11304, -11403, -11502, -11645, -11765, -11951, -12216, -12410, -12557, -12656,
-    -12730, -12796, -12848, -12953, -13101, -13249, -13373, -13489, -13619, -13713, -13835, -13966,
-    -14025, -14116, -14298, -14458, -14632, -14854, -14962, -14942, -15005, -15164, -15409, -15773,
-    -16062, -16205, -16292, -16347, -16403, -16549, -16830, -17151, -17486, -17760, -17926, -18011,
-    -18039, -18089, -18167, -18343, -18667, -19054, -19408, -19671, -19811, -19824, -19811, -19860,
-    -19995, -20204, -20474, -20768, -20960, -21091, -21174, -21117, -21142, -21200, -21228, -21360,
-    -21403, -21443, -21510, -21520, -21466, -21450, -21433, -21343, -21327, -21223, -21145, -21135,
-    -21145, -21064, -20947, -20932, -20830, -20736, -20559, -20307, -20082, -19729, -19412, -19137,
-    -18934, -18863, -18853, -18707, -18414, -18032, -17537, -17031, -16549, -16120, -15737, -15483,
-    -15308, -15113, -14796, -14317, -13750, -13081, -12466, -11966, -11529, -11118, -10789, -10395,
-    -9921, -9397, -8779, -8121, -7475, -6911, -6397, -5916, -5525, -5061, -4393, -3510,
-    -2606, -1632, -660, 209, 1022, 1711, 2290, 2848, 3473, 4073, 4667, 5285,
-    5859, 6332, 6744, 7088, 7375, 7671, 7935, 8195, 8462, 8723, 9039, 9327,
-    9608, 9930, 10239, 10589, 10924, 11126, 11226, 11280, 11420, 11662, 11955, 12263,
-    12542, 12781, 12987, 13120, 13155, 13144, 13168, 13295, 13489, 13763, 14097, 14334,
-    14449, 14427, 14338, 14289, 14342, 14486, 14704, 14978, 15184, 15382, 15534, 15604,
-    15654, 15738, 15845, 16030, 16204, 16429, 16717, 16935, 17217, 17418, 17553, 17739,
-    17927, 18130, 18335, 18543, 18689, 18844, 19032, 19226, 19404, 19570, 19831, 20041,
-    20234, 20385, 20433, 20513, 20666, 20866, 21035, 21284, 21489, 21675, 21836, 21930,
-    21952, 21939, 21942, 21994, 22102, 22256, 22395, 22466, 22508, 22552, 22524, 22501,
-    22423, 22333, 22351, 22384, 22412, 22364, 22273, 22127, 21988, 21873, 21756, 21573,
-    21394, 21231, 21109, 20961, 20813, 20678, 20464, 20261, 20083, 19849, 19621, 19427,
-    19181, 18931, 18690, 18409, 18154, 17831, 17485, 17141, 16809, 16423, 16000, 15613,
-    15228, 14872, 14560, 14242, 13839, 13432, 12960, 12389, 11923, 11442, 11033, 10667,
-    10306, 10006, 9684, 9289, 8750, 8112, 7486, 6961, 6576, 6263, 5912, 5452,
-    4852, 4161, 3357, 2487, 1643, 879, 228, -414, -1037, -1804, -2609, -3368,
-    -4237, -5089, -5776, -6295, -6717, -7056, -7397, -7835, -8335, -8763, -9151, -9523,
-    -9835, -10111, -10413, -10707, -11056, -11409, -11738, -12053, -12340, -12658, -12970, -13168,
-    -13409, -13707, -14002, -14272, -14561, -14865, -15164, -15459, -15698, -15933, -16189, -16463,
-    -16610, -16817, -16980, -17079, -17260, -17501, -17672, -17859, -17990, -18093, -18217, -18407,
-    -18586, -18673, -18770, -18890, -19007, -19142, -19271, -19409, -19466, -19551, -19670, -19774,
-    -19892, -19935, -19944, -19993, -20115, -20231, -20328, -20416, -20443, -20434, -20427, -20423,
-    -20418, -20425, -20464, -20518, -20567, -20602, -20592, -20570, -20535, -20502, -20463, -20428,
-    -20394, -20380, -20347, -20332, -20359, -20338, -20286, -20148, -19975, -19840, -19754, -19696,
-    -19631, -19561, -19458, -19413, -19276, -19136, -18957, -18826, -18745, -18630, -18541, -18458,
-    -18344, -18207, -17937, -17593, -17336, -17244, -17235, -17220, -17102, -16855, -16546, -16222,
-    -15886, -15579, -15403, -15332, -15320, -15253, -15059, -14710, -14279, -13820, -13505, -13293,
-    -13171, -13126, -12996, -12781, -12531, -12188, -11770, -11365, -11032, -10850, -10719, -10552,
-    -10376, -10129, -9784, -9419, -9078, -8676, -8276, -8027, -7756, -7547, -7361, -7068,
-    -6776, -6535, -6222, -5862, -5478, -5169, -4791, -4366, -3970, -3536, -3136, -2796,
-    -2390, -1989, -1541, -1127, -702, -278, 146, 591, 1038, 1600, 2144, 2638,
-    3157, 3526, 3906, 4313, 4771, 5171, 5534, 5922, 6246, 6570, 6846, 7050,
-    7228, 7501, 7864, 8194, 8460, 8692, 8885, 9069, 9290, 9516, 9808, 10172,
-    10556, 10871, 11105, 11256, 11372, 11546, 11800, 12064, 12322, 12627, 12937, 13188,
-    13391, 13491, 13618, 13812, 14005, 14211, 14481, 14669, 14865, 15066, 15224, 15399,
-    15583, 15819, 15991, 16139, 16272, 16334, 16417, 16502, 16660, 16848, 17029, 17122,
-    17242, 17307, 17348, 17428, 17539, 17680, 17822, 17828, 17767, 17808, 17951, 18040,
-    18205, 18337, 18325, 18371, 18332, 18252, 18165, 18169, 18261, 18401, 18533, 18585,
-    18556, 18470, 18423, 18355, 18256, 18254, 18308, 18404, 18497, 18428, 18306, 18158,
-    18059, 17975, 17945, 17939, 17907, 17852, 17753, 17613, 17518, 17397, 17311, 17207,
-    17160, 17112, 17087, 16992, 16852, 16735, 16623, 16530, 16450, 16332, 16183, 16063,
-    15988, 15935, 15788, 15584, 15421, 15278, 15203, 15057, 14885, 14708, 14544, 14431,
-    14254, 14083, 13814, 13664, 13616, 13514, 13301, 13017, 12744, 12590, 12500, 12370,
-    12190, 11966, 11751, 11620, 11412, 11171, 10957, 10784, 10649, 10460, 10238, 9915,
-    9570, 9202, 8873, 8643, 8416, 8119, 7799, 7452, 7132, 6812, 6610, 6394,
-    6223, 6069, 5838, 5577, 5312, 5027, 4774, 4473, 4152, 3884, 3627, 3310,
-    2934, 2411, 1932, 1495, 1032, 699, 356, 73, -225, -532, -947, -1452,
-    -1926, -2477, -2912, -3265, -3547, -3813, -4252, -4624, -5058, -5508, -5857, -6133,
-    -6361, -6527, -6730, -7056, -7379, -7596, -7827, -7945, -8064, -8246, -8477, -8688,
-    -8957, -9257, -9502, -9711, -9908, -10040, -10134, -10306, -10569, -10866, -11168, -11452,
-    -11610, -11806, -11912, -11997, -12167, -12393, -12643, -12919, -13119, -13231, -13356, -13579,
-    -13768, -13897, -13989, -14097, -14295, -14507, -14673, -14771, -14914, -15048, -15187, -15319,
-    -15441, -15544, -15675, -15825, -15964, -16093, -16301, -16385, -16513, -16621, -16655, -16795,
-    -16887, -16990, -17172, -17268, -17414, -17466, -17566, -17657, -17742, -17879, -17938, -17999,
-    -18053, -18183, -18325, -18463, -18610, -18645, -18711, -18776, -18783, -18807, -18828, -18894,
-    -18987, -19144, -19201, -19210, -19297, -19356, -19416, -19483, -19497, -19459, -19467, -19456,
-    -19436, -19451, -19527, -19572, -19656, -19723, -19737, -19701, -19574, -19451, -19374, -19406,
-    -19467, -19464, -19468, -19451, -19387, -19232, -19033, -18870, -18778, -18780, -18796, -18793,
-    -18688, -18561, -18407, -18258, -18198, -18139, -18086, -18001, -17877, -17728, -17576, -17401,
-    -17196, -16952, -16713, -16440, -16223, -15971, -15696, -15449, -15214, -14938, -14674, -14303,
-    -13933, -13643, -13376, -13078, -12788, -12471, -12122, -11838, -11484, -11119, -10744, -10365,
-    -9989, -9623, -9196, -8829, -8457, -8145, -7829, -7503, -7083, -6667, -6264, -5754,
-    -5329, -4816, -4210, -3636, -2995, -2419, -1883, -1268, -563, 217, 986, 1651,
-    2232, 2789, 3352, 3948, 4508, 5038, 5522, 5976, 6468, 6881, 7240, 7559,
-    7852, 8120, 8481, 8802, 9174, 9564, 9901, 10206, 10484, 10741, 10999, 11275,
-    11584, 11884, 12174, 12442, 12680, 12962, 13245, 13488, 13722, 13908, 14111, 14309,
-    14504, 14673, 14899, 15079, 15312, 15525, 15684, 15800, 15877, 15981, 16115, 16288,
-    16468, 16631, 16778, 16937, 17024, 17105, 17130, 17234, 17312, 17494, 17675, 17836,
-    17973, 17998, 18006, 17978, 17969, 18028, 18085, 18251, 18390, 18504, 18533, 18487,
-    18441, 18455, 18494, 18530, 18595, 18611, 18620, 18651, 18692, 18710, 18762, 18787,
-    18805, 18804, 18795, 18776, 18804, 18892, 18946, 18972, 18995, 18991, 19000, 18982,
-    18949, 18916, 18919, 18960, 18983, 19021, 19044, 19050, 19094, 19150, 19082, 18985,
-    18866, 18791, 18793, 18781, 18753, 18713, 18658, 18628, 18516, 18423, 18289, 18172,
-    18161, 18173, 18155, 18176, 18143, 18057, 18030, 17872, 17713, 17608, 17560, 17503,
-    17492, 17477, 17451, 17369, 17239, 17075, 16889, 16725, 16627, 16494, 16442, 16386,
-    16325, 16179, 16015, 15832, 15567, 15358, 15114, 14883, 14777, 14680, 14507, 14322,
-    14061, 13784, 13549, 13255, 12942, 12705, 12464, 12276, 12083, 11813, 11534, 11259,
-    10972, 10712, 10408, 10035, 9680, 9388, 9096, 8820, 8559, 8269, 7964, 7629,
-    7298, 6886, 6476, 6030, 5632, 5348, 5043, 4694, 4192, 3594, 3006, 2398,
-    1726, 1062, 443, -122, -569, -1022, -1580, -2239, -2871, -3453, -4018, -4596,
-    -5149, -5622, -5951, -6205, -6529, -6901, -7265, -7625, -7928, -8257, -8580, -8933,
-    -9234, -9489, -9756, -10030, -10343, -10679, -10995, -11284, -11553, -11840, -12101, -12371,
-    -12621, -12864, -13029, -13263, -13522, -13728, -13946, -14148, -14335, -14563, -14842, -15031,
-    -15148, -15297, -15421, -15590, -15773, -15956, -16114, -16315, -16486, -16601, -16708, -16782,
-    -16861, -16984, -17130, -17310, -17487, -17644, -17720, -17766, -17807, -17874, -17961, -18052,
-    -18111, -18142, -18187, -18291, -18363, -18414, -18457, -18507, -18537, -18552, -18563, -18566,
-    -18633, -18740, -18830, -18900, -18929, -18982, -18993, -19050, -19132, -19220, -19329, -19396,
-    -19400, -19359, -19343, -19340, -19361, -19407, -19392, -19419, -19448, -19449, -19359, -19221,
-    -19093, -19029, -19075, -19124, -19130, -19105, -19008, -18900, -18762, -18635, -18557, -18513,
-    -18483, -18514, -18521, -18437, -18339, -18225, -18071, -17976, -17895, -17865, -17837, -17791,
-    -17745, -17665, -17582, -17463, -17290, -17142, -17036, -16991, -16916, -16827, -16702, -16563,
-    -16421, -16307, -16173, -15976, -15787, -15601, -15458, -15364, -15202, -15025, -14822, -14664,
-    -14498, -14309, -14140, -13918, -13690, -13539, -13385, -13183, -12985, -12781, -12525, -12353,
-    -12139, -11868, -11620, -11383, -11178, -10956, -10746, -10518, -10241, -10039, -9797, -9546,
-    -9273, -8943, -8645, -8387, -8115, -7869, -7613, -7306, -7033, -6769, -6437, -6131,
-    -5817, -5529, -5285, -5018, -4648, -4207, -3751, -3234, -2695, -2191, -1660, -1166,
-    -694, -224, 245, 713, 1225, 1727, 2217, 2755, 3284, 3845, 4409, 4899,
-    5386, 5699, 5925, 6208, 6513, 6872, 7241, 7548, 7877, 8238, 8574, 8887,
-    9167, 9419, 9665, 9947, 10263, 10556, 10904, 11202, 11491, 11781, 12029, 12301,
-    12621, 12972, 13233, 13474, 13700, 13915, 14204, 14473, 14792, 15078, 15357, 15610,
-    15779, 15911, 16009, 16179, 16409, 16660, 16897, 17061, 17160, 17243, 17342, 17374,
-    17464, 17544, 17632, 17817, 17977, 18158, 18297, 18361, 18416, 18453, 18526, 18604,
-    18726, 18846, 18946, 19058, 19135, 19205, 19209, 19161, 19161, 19165, 19195, 19219,
-    19254, 19266, 19244, 19243, 19205, 19144, 19077, 19002, 18920, 18850, 18801, 18705,
-    18609, 18535, 18460, 18391, 18359, 18232, 18060, 17956, 17841, 17771, 17669, 17489,
-    17339, 17249, 17183, 17080, 16948, 16767, 16603, 16462, 16335, 16210, 16058, 15949,
-    15859, 15725, 15579, 15437, 15244, 15072, 14907, 14710, 14596, 14487, 14336, 14217,
-    14113, 13963, 13842, 13723, 13514, 13302, 13132, 13014, 12959, 12895, 12771, 12654,
-    12543, 12428, 12301, 12122, 11975, 11849, 11769, 11710, 11624, 11537, 11450, 11380,
-    11265, 11140, 10965, 10779, 10654, 10523, 10447, 10382, 10292, 10198, 10119, 10006,
-    9852, 9723, 9565, 9451, 9342, 9162, 8995, 8888, 8819, 8754, 8691, 8548,
-    8339, 8148, 7959, 7780, 7638, 7539, 7478, 7414, 7250, 7015, 6786, 6550,
-    6329, 6146, 5982, 5835, 5710, 5545, 5300, 4985, 4596, 4182, 3783, 3395,
-    3046, 2736, 2432, 2099, 1703, 1280, 859, 440, 45, -333, -727, -1117,
-    -1493, -1906, -2359, -2809, -3276, -3753, -4198, -4636, -5030, -5364, -5689, -5999,
-    -6321, -6625, -6929, -7243, -7544, -7841, -8103, -8367, -8607, -8834, -9066, -9297,
-    -9564, -9761, -9907, -10103, -10350, -10629, -10914, -11111, -11241, -11413, -11567, -11729,
-    -11889, -12032, -12254, -12524, -12749, -12892, -13030, -13123, -13209, -13373, -13523, -13690,
-    -13865, -14025, -14150, -14262, -14397, -14471, -14562, -14660, -14733, -14868, -14986, -15085,
-    -15191, -15282, -15363, -15430, -15498, -15553, -15631, -15734, -15815, -15870, -15906, -15956,
-    -16014, -16075, -16136, -16186, -16246, -16306, -16347, -16350, -16338, -16350, -16400, -16455,
-    -16508, -16548, -16547, -16596, -16622, -16597, -16642, -16669, -16674, -16681, -16637, -16595,
-    -16634, -16738, -16770, -16739, -16703, -16627, -16580, -16573, -16563, -16567, -16597, -16631,
-    -16616, -16575, -16499, -16385, -16298, -16237, -16224, -16242, -16227, -16206, -16142, -16050,
-    -15957, -15807, -15707, -15649, -15572, -15525, -15444, -15313, -15174, -15046, -14948, -14856,
-    -14744, -14613, -14506, -14372, -14204, -14031, -13846, -13705, -13589, -13469, -13346, -13183,
-    -12991, -12779, -12541, -12338, -12178, -12019, -11886, -11731, -11542, -11334, -11056, -10785,
-    -10534, -10311, -10158, -9991, -9817, -9610, -9371, -9153, -8891, -8625, -8393, -8202,
-    -8018, -7809, -7628, -7413, -7179, -6981, -6797, -6594, -6402, -6275, -6096, -5881,
-    -5698, -5510, -5323, -5073, -4785, -4508, -4203, -3890, -3597, -3294, -2987, -2697,
-    -2391, -2120, -1868, -1593, -1338, -1050, -710, -389, -112, 161, 423, 656,
-    898, 1113, 1312, 1540, 1782, 2036, 2289, 2547, 2793, 3016, 3239, 3412,
-    3556, 3755, 3961, 4177, 4392, 4562, 4745, 4901, 5026, 5157, 5242, 5340,
-    5477, 5619, 5755, 5875, 5991, 6086, 6205, 6324, 6406, 6516, 6655, 6772,
-    6904, 7081, 7220, 7355, 7498, 7592, 7706, 7812, 7915, 8049, 8199, 8377,
-    8548, 8711, 8851, 8987, 9127, 9251, 9348, 9424, 9570, 9749, 9937, 10109,
-    10229, 10380, 10527, 10664, 10785, 10886, 11013, 11147, 11320, 11467, 11617, 11816,
-    11981, 12146, 12251, 12309, 12420, 12544, 12677, 12833, 12988, 13140, 13322, 13473,
-    13589, 13705, 13791, 13878, 13967, 14080, 14221, 14386, 14562, 14692, 14819, 14920,
-    14982, 15064, 15137, 15235, 15390, 15523, 15609, 15702, 15799, 15884, 15978, 16054,
-    16118, 16185, 16262, 16354, 16430, 16501, 16603, 16717, 16800, 16839, 16830, 16830,
-    16900, 16992, 17077, 17182, 17270, 17319, 17376, 17403, 17402, 17434, 17461, 17517,
-    17600, 17645, 17697, 17731, 17743, 17756, 17758, 17765, 17762, 17749, 17723, 17682,
-    17639, 17602, 17555, 17507, 17452, 17411, 17383, 17305, 17240, 17191, 17121, 17054,
-    16976, 16886, 16821, 16754, 16679, 16616, 16546, 16444, 16331, 16204, 16032, 15895,
-    15785, 15695, 15610, 15469, 15315, 15140, 14946, 14739, 14553, 14373, 14207, 14053,
-    13848, 13634, 13390, 13133, 12890, 12628, 12384, 12161, 11911, 11621, 11319, 11028,
-    10719, 10408, 10094, 9793, 9518, 9223, 8889, 8505, 8133, 7744, 7379, 7041,
-    6671, 6349, 5991, 5610, 5130, 4501, 3884, 3258, 2627, 2013, 1385, 773,
-    161, -492, -1139, -1795, -2499, -3171, -3803, -4439, -4990, -5402, -5793, -6212,
-    -6641, -7093, -7523, -7901, -8264, -8601, -8923, -9267, -9612, -9961, -10335, -10688,
-    -11015, -11344, -11659, -11971, -12270, -12593, -12926, -13240, -13574, -13861, -14101, -14372,
-    -14663, -14933, -15210, -15477, -15732, -16028, -16243, -16408, -16602, -16769, -17012, -17253,
-    -17441, -17640, -17795, -17935, -18058, -18147, -18214, -18316, -18497, -18687, -18848, -18955,
-    -19036, -19087, -19106, -19141, -19190, -19259, -19355, -19429, -19492, -19547, -19585, -19607,
-    -19591, -19567, -19587, -19620, -19607, -19590, -19558, -19538, -19538, -19499, -19455, -19389,
-    -19334, -19284, -19212, -19117, -19045, -19005, -18961, -18940, -18883, -18813, -18786, -18732,
-    -18621, -18520, -18453, -18428, -18417, -18363, -18306, -18230, -18127, -18019, -17883, -17768,
-    -17653, -17495, -17389, -17280, -17152, -17044, -16916, -16771, -16595, -16413, -16204, -16011,
-    -15800, -15614, -15515, -15390, -15259, -15100, -14880, -14628, -14392, -14168, -13941, -13745,
-    -13563, -13369, -13169, -12985, -12778, -12535, -12287, -12066, -11861, -11645, -11417, -11192,
-    -10972, -10775, -10592, -10383, -10190, -9998, -9799, -9601, -9381, -9154, -8905, -8680,
-    -8481, -8262, -8067, -7882, -7680, -7460, -7200, -6956, -6702, -6470, -6279, -6080,
-    -5901, -5731, -5534, -5258, -4940, -4634, -4345, -4072, -3802, -3558, -3309, -3033,
-    -2767, -2495, -2221, -1966, -1751, -1544, -1304, -1062, -817, -581, -364, -155,
-    72, 264, 430, 622, 808, 991, 1177, 1368, 1550, 1706, 1839, 1968,
-    2108, 2269, 2435, 2581, 2740, 2888, 3026, 3155, 3225, 3306, 3424, 3567,
-    3732, 3870, 4007, 4145, 4250, 4322, 4349, 4398, 4477, 4606, 4753, 4867,
-    4972, 5047, 5113, 5139, 5180, 5277, 5368, 5458, 5539, 5617, 5720, 5801,
-    5855, 5897, 5947, 6051, 6150, 6258, 6372, 6479, 6594, 6733, 6857, 6967,
-    7090, 7200, 7325, 7436, 7564, 7662, 7751, 7890, 8036, 8167, 8290, 8395,
-    8500, 8621, 8721, 8835, 8958, 9091, 9268, 9424, 9563, 9713, 9870, 10005,
-    10144, 10311, 10474, 10685, 10918, 11137, 11370, 11579, 11780, 11990, 12197, 12385,
-    12572, 12799, 13035, 13291, 13535, 13763, 14002, 14179, 14362, 14583, 14799, 15023,
-    15267, 15477, 15633, 15792, 15956, 16144, 16343, 16564, 16777, 16987, 17191, 17335,
-    17451, 17585, 17745, 17914, 18058, 18232, 18367, 18478, 18601, 18683, 18748, 18818,
-    18905, 18976, 19051, 19124, 19150, 19154, 19143, 19115, 19114, 19132, 19130, 19133,
-    19109, 19066, 19004, 18926, 18836, 18752, 18677, 18620, 18546, 18439, 18338, 18218,
-    18075, 17931, 17757, 17584, 17434, 17254, 17067, 16866, 16655, 16475, 16302, 16095,
-    15867, 15624, 15358, 15124, 14906, 14659, 14429, 14167, 13899, 13681, 13447, 13204,
-    12943, 12639, 12343, 12048, 11736, 11439, 11141, 10875, 10615, 10333, 10019, 9734,
-    9429, 9103, 8787, 8464, 8144, 7845, 7550, 7248, 6971, 6691, 6385, 6089,
-    5775, 5394, 4962, 4526, 4066, 3654, 3231, 2817, 2401, 1960, 1523, 1141,
-    725, 332, -87, -501, -870, -1247, -1631, -2004, -2369, -2730, -3092, -3414,
-    -3773, -4118, -4437, -4718, -4968, -5185, -5391, -5587, -5791, -5997, -6194, -6391,
-    -6566, -6744, -6950, -7121, -7309, -7505, -7710, -7915, -8103, -8252, -8400, -8571,
-    -8736, -8873, -9027, -9190, -9334, -9469, -9626, -9778, -9898, -10046, -10159, -10268,
-    -10401, -10522, -10640, -10750, -10825, -10912, -10986, -11060, -11128, -11237, -11334, -11436,
-    -11530, -11604, -11654, -11726, -11800, -11869, -11940, -12014, -12095, -12162, -12253, -12375,
-    -12458, -12509, -12523, -12577, -12607, -12712, -12835, -13013, -13272, -13640, -14108, -14617,
-    -15142, -15723, -16321, -16927, -17563, -18125, -18476, -18742, -18946, -19047, -19025, -18931,
-    -18758, -18525, -18238, -17942, -17624, -17317, -17045, -16731, -16438, -16200, -15965, -15751,
-    -15538, -15294, -15062, -14800, -14545, -14287, -14001, -13757, -13524, -13298, -13090, -12889,
-    -12690, -12451, -12230, -11961, -11718, -11479, -11241, -11027, -10797, -10575, -10385, -10159,
-    -9937, -9719, -9506, -9295, -9070, -8833, -8609, -8402, -8186, -7976, -7746, -7534,
-    -7311, -7099, -6848, -6643, -6415, -6202, -5953, -5760, -5556, -5328, -5088, -4871,
-    -4625, -4392, -4171, -3963, -3743, -3525, -3346, -3116, -2842, -2621, -2394, -2180,
-    -1954, -1716, -1451, -1194, -976, -766, -570, -354, -128, 87, 343, 628,
-    843, 1065, 1297, 1484, 1689, 1939, 2176, 2443, 2705, 2994, 3229, 3506,
-    3742, 4007, 4287, 4566, 4895, 5232, 5551, 5884, 6197, 6470, 6757, 7049,
-    7307, 7592, 7864, 8130, 8422, 8735, 9018, 9321, 9594, 9888, 10179, 10436,
-    10644, 10878, 11122, 11376, 11628, 11879, 12087, 12302, 12472, 12602, 12712, 12817,
-    12920, 13024, 13085, 13148, 13225, 13271, 13318, 13404, 13438, 13462, 13516, 13540,
-    13546, 13591, 13612, 13611, 13619, 13661, 13687, 13706, 13696, 13650, 13603, 13456,
-    12807, 11295, 9000, 6294, 3537, 1066, -936, -2429, -3399, -3869, -3972, -3809,
-    -3481, -3079, -2686, -2347, -2122, -2006, -1975, -2017, -2093, -2169, -2236, -2282,
-    -2321, -2368, -2419, -2454, -2463, -2468, -2491, -2519, -2526, -2534, -2544, -2551,
-    -2564, -2535, -2473, -2462, -2500, -2526, -2557, -2586, -2576, -2548, -2518, -2465,
-    -2414, -2385, -2348, -2315, -2309, -2302, -2270, -2240, -2219, -2170, -2094, -2053,
-    -2033, -1975, -1917, -1908, -1883, -1810, -1730, -1657, -1599, -1576, -1552, -1499,
-    -1446, -1403, -1361, -1324, -1277, -1225, -1205, -1194, -1153, -1104, -1062, -1020,
-    -981, -934, -879, -842, -811, -766, -724, -672, -603, -548, -505, -471,
-    -469, -470, -436, -397, -352, -279, -227, -218, -216, -241, -293, -312,
-    -308, -325, -339, -346, -362, -380, -413, -465, -491, -504, -545, -582,
-    -598, -619, -637, -627, -602, -580, -563, -551, -543, -535, -524, -509,
-    -488, -442, -361, -276, -198, -107, -17, 46, 103, 178, 263, 345,
-    442, 555, 667, 779, 907, 1035, 1156, 1289, 1424, 1553, 1695, 1862,
-    2051, 2262, 2466, 2647, 2831, 3023, 3207, 3409, 3630, 3825, 4011, 4205,
-    4236, 3800, 2711, 1008, -1099, -3298, -5335, -7084, -8461, -9386, -9867, -9981,
-    -9807, -9439, -8945, -8370, -7770, -7190, -6640, -6147, -5731, -5364, -5032, -4740,
-    -4471, -4209, -3952, -3706, -3467, -3228, -2991, -2746, -2476, -2208, -1952, -1678,
-    -1397, -1131, -860, -598, -362, -116, 147, 402, 651, 888, 1106, 1307,
-    1496, 1692, 1910, 2121, 2326, 2556, 2783, 2989, 3199, 3401, 3585, 3778,
-    3983, 4178, 4342, 4484, 4652, 4855, 5046, 5211, 5349, 5451, 5557, 5704,
-    5875, 6039, 6177, 6293, 6409, 6524, 6649, 6789, 6887, 6939, 7018, 7114,
-    7187, 7267, 7363, 7453, 7557, 7668, 7751, 7806, 7857, 7928, 8019, 8095,
-    8157, 8224, 8281, 8323, 8369, 8416, 8459, 8502, 8543, 8582, 8621, 8656,
-    8700, 8728, 8709, 8670, 8645, 8633, 8649, 8679, 8671, 8629, 8584, 8543,
-    8517, 8504, 8476, 8457, 8454, 8421, 8361, 8317, 8275, 8222, 8176, 8122,
-    8068, 8037, 8000, 7948, 7915, 7888, 7847, 7799, 7755, 7727, 7718, 7691,
-    7630, 7573, 7533, 7488, 7423, 7347, 7279, 7215, 7135, 7052, 6988, 6938,
-    6912, 6912, 6909, 6880, 6812, 6718, 6635, 6566, 6493, 6432, 6405, 6396,
-    6341, 6066, 5347, 4085, 2340, 270, -1918, -4045, -5991, -7660, -9011, -10049,
-    -10769, -11200, -11411, -11444, -11329, -11117, -10841, -10536, -10263, -10045, -9875, -9758,
-    -9678, -9615, -9579, -9560, -9548, -9562, -9601, -9646, -9711, -9779, -9812, -9820,
-    -9828, -9822, -9789, -9750, -9741, -9773, -9823, -9860, -9875, -9863, -9829, -9786,
-    -9744, -9702, -9659, -9622, -9594, -9559, -9508, -9468, -9446, -9419, -9399, -9390,
-    -9364, -9323, -9288, -9225, -9133, -9065, -9038, -9027, -9011, -8956, -8853, -8752,
-    -8660, -8584, -8520, -8447, -8387, -8328, -8250, -8159, -8078, -7972, -7858, -7769,
-    -7687, -7588, -7486, -7392, -7272, -7155, -7011, -6858, -6751, -6663, -6575, -6479,
-    -6404, -6290, -6146, -6028, -5872, -5703, -5542, -5417, -5287, -5149, -5041, -4897,
-    -4758, -4621, -4485, -4310, -4152, -4034, -3906, -3780, -3603, -3444, -3250, -3087,
-    -2955, -2795, -2643, -2466, -2314, -2128, -1964, -1822, -1675, -1547, -1409, -1229,
-    -1021, -837, -644, -489, -348, -165, -11, 171, 397, 640, 812, 959,
-    1222, 1437, 1692, 1902, 2027, 2188, 2409, 2703, 2935, 3188, 3410, 3587,
-    3800, 3995, 4207, 4435, 4615, 4850, 5089, 5316, 5570, 5769, 5964, 6139,
-    6334, 6495, 6440, 6006, 5158, 3951, 2500, 888, -793, -2405, -3804, -4931,
-    -5805, -6395, -6780, -6934, -6915, -6767, -6452, -6083, -5654, -5161, -4680, -4166,
-    -3679, -3292, -2931, -2623, -2319, -1998, -1702, -1495, -1310, -1112, -943, -723,
-    -518, -344, -165, 34, 237, 453, 690, 892, 1087, 1298, 1487, 1710,
-    1927, 2078, 2271, 2478, 2681, 2912, 3121, 3170, 3283, 3549, 3761, 3996,
-    4129, 4097, 4171, 4395, 4679, 4948, 5116, 5236, 5361, 5521, 5618, 5701,
-    5821, 5956, 6188, 6392, 6531, 6636, 6683, 6733, 6824, 6963, 7121, 7250,
-    7332, 7371, 7480, 7599, 7659, 7724, 7763, 7849, 7983, 8098, 8171, 8201,
-    8251, 8288, 8361, 8436, 8456, 8542, 8592, 8640, 8731, 8743, 8753, 8762,
-    8733, 8724, 8762, 8807, 8852, 8901, 8909, 8871, 8830, 8816, 8803, 8817,
-    8817, 8806, 8806, 8775, 8732, 8655, 8598, 8591, 8570, 8553, 8530, 8466,
-    8398, 8316, 8249, 8219, 8188, 8203, 8156, 8037, 8001, 8022, 8050, 8074,
-    7950, 7726, 7657, 7690, 7740, 7791, 7721, 7601, 7555, 7498, 7405, 7289,
-    7162, 7128, 7189, 7213, 7132, 7014, 6900, 6808, 6743, 6686, 6633, 6655,
-    6629, 6534, 6419, 6046, 5372, 4332, 2991, 1466, -167, -1831, -3554, -5163,
-    -6612, -7866, -8943, -9821, -10456, -10895, -11144, -11253, -11226, -11170, -11045, -10919,
-    -10788, -10584, -10375, -10158, -9992, -9834, -9716, -9632, -9558, -9538, -9504, -9485,
-    -9510, -9511, -9519, -9548, -9585, -9625, -9621, -9605, -9625, -9667, -9666, -9695,
-    -9739, -9700, -9651, -9611, -9546, -9532, -9578, -9501, -9503, -9610, -9554, -9435,
-    -9288, -9157, -9245, -9469, -9486, -9382, -9220, -8986, -8954, -8973, -8875, -8820,
-    -8824, -8844, -8869, -8755, -8477, -8220, -8128, -8159, -8206, -8216, -8112, -8008,
-    -7935, -7756, -7580, -7455, -7364, -7360, -7291, -7198, -7174, -7054, -6871, -6693,
-    -6558, -6479, -6387, -6270, -6138, -6027, -5946, -5823, -5635, -5466, -5315, -5188,
-    -5048, -4892, -4801, -4707, -4574, -4405, -4223, -4044, -3882, -3759, -3625, -3504,
-    -3412, -3288, -3119, -2961, -2789, -2558, -2392, -2256, -2102, -1957, -1788, -1617,
-    -1426, -1235, -1047, -906, -820, -658, -443, -232, -1, 192, 351, 551,
-    731, 932, 1122, 1201, 1377, 1678, 2052, 2427, 2550, 2506, 2561, 2767,
-    3114, 3540, 3784, 3893, 4126, 4395, 4630, 4767, 4792, 4924, 5248, 5664,
-    6004, 6152, 6170, 6168, 6137, 5895, 5267, 4377, 3355, 2210, 1036, -232,
-    -1547, -2720, -3772, -4625, -5250, -5731, -6046, -6258, -6376, -6310, -6108, -5859,
-    -5573, -5254, -4874, -4403, -3924, -3495, -3095, -2699, -2323, -1990, -1675, -1371,
-    -1101, -857, -592, -312, -45, 204, 395, 528, 673, 851, 1042, 1257,
-    1459, 1618, 1808, 2023, 2203, 2333, 2423, 2559, 2769, 2982, 3207, 3434,
-    3605, 3779, 3957, 4086, 4221, 4357, 4490, 4666, 4883, 5112, 5248, 5283,
-    5377, 5562, 5827, 6093, 6148, 6080, 6128, 6258, 6474, 6754, 6842, 6828,
-    6954, 7106, 7233, 7288, 7207, 7205, 7395, 7689, 7926, 7968, 7898, 7876,
-    7983, 8105, 8138, 8190, 8269, 8396, 8556, 8591, 8570, 8562, 8555, 8619,
-    8695, 8745, 8800, 8829, 8856, 8881, 8897, 8898, 8866, 8826, 8803, 8817,
-    8853, 8864, 8849, 8841, 8855, 8847, 8805, 8755, 8700, 8665, 8651, 8674,
-    8693, 8618, 8533, 8468, 8390, 8373, 8376, 8349, 8297, 8231, 8207, 8182,
-    8129, 8047, 7944, 7884, 7816, 7768, 7774, 7748, 7729, 7718, 7614, 7444,
-    7284, 7181, 7150, 7189, 7200, 7132, 7096, 6984, 6786, 6718, 6710, 6784,
-    6902, 6783, 6508, 6281, 6033, 5763, 5399, 4656, 3600, 2417, 1127, -227,
-    -1656, -3170, -4620, -5789, -6719, -7568, -8461, -9390, -10112, -10555, -10851, -11087,
-    -11221, -11262, -11191, -11030, -10971, -10947, -10879, -10783, -10626, -10436, -10234, -10043,
-    -9884, -9807, -9764, -9694, -9660, -9654, -9659, -9660, -9645, -9614, -9604, -9610,
-    -9642, -9703, -9703, -9715, -9779, -9822, -9836, -9818, -9792, -9763, -9717, -9663,
-    -9636, -9630, -9616, -9615, -9566, -9450, -9349, -9241, -9137, -9106, -9085, -9063,
-    -9038, -8970, -8871, -8756, -8642, -8488, -8401, -8487, -8584, -8554, -8421, -8232,
-    -8085, -8069, -7996, -7864, -7765, -7652, -7652, -7633, -7457, -7252, -7024, -6883,
-    -6925, -6983, -6921, -6759, -6505, -6280, -6179, -6076, -5928, -5788, -5718, -5736,
-    -5738, -5623, -5350, -4985, -4744, -4738, -4812, -4779, -4618, -4447, -4314, -4157,
-    -3933, -3670, -3490, -3413, -3311, -3176, -3002, -2765, -2566, -2381, -2203, -2075,
-    -1944, -1820, -1639, -1401, -1211, -1031, -844, -653, -454, -257, -37, 173,
-    374, 603, 837, 1056, 1224, 1374, 1558, 1780, 2044, 2243, 2366, 2477,
-    2629, 2838, 3034, 3270, 3517, 3769, 4036, 4255, 4422, 4516, 4664, 4888,
-    5192, 5532, 5751, 5933, 6064, 6070, 5940, 5664, 5220, 4636, 4005, 3179,
-    2203, 1202, 104, -972, -1937, -2841, -3667, -4319, -4783, -5114, -5342, -5620,
-    -5952, -6076, -5989, -5765, -5372, -5024, -4749, -4422, -4089, -3742, -3406, -3108,
-    -2761, -2290, -1768, -1306, -1002, -845, -635, -326, -3, 279, 527, 807,
-    1150, 1479, 1654, 1736, 1869, 2088, 2326, 2501, 2632, 2785, 2979, 3158,
-    3291, 3367, 3442, 3550, 3704, 3872, 4014, 4219, 4412, 4607, 4806, 4929,
-    5063, 5171, 5285, 5428, 5595, 5808, 6000, 6189, 6319, 6375, 6409, 6472,
-    6562, 6656, 6792, 6925, 7063, 7217, 7358, 7446, 7430, 7394, 7390, 7475,
-    7684, 7872, 7967, 8010, 8039, 8068, 8110, 8152, 8162, 8216, 8390, 8554,
-    8633, 8644, 8551, 8492, 8554, 8623, 8632, 8635, 8721, 8879, 9033, 9032,
-    8862, 8701, 8624, 8681, 8865, 9013, 8988, 8892, 8832, 8830, 8869, 8790,
-    8647, 8614, 8701, 8841, 8873, 8723, 8537, 8461, 8508, 8565, 8563, 8540,
-    8507, 8511, 8480, 8359, 8246, 8166, 8145, 8106, 8016, 7953, 7873, 7790,
-    7708, 7591, 7514, 7469, 7392, 7305, 7237, 7229, 7226, 7190, 7136, 7033,
-    6956, 6900, 6850, 6807, 6715, 6569, 6343, 6035, 5550, 4887, 4063, 3046,
-    1984, 877, -267, -1364, -2526, -3724, -4800, -5831, -6869, -7772, -8592, -9318,
-    -9784, -10161, -10542, -10904, -11266, -11466, -11532, -11474, -11388, -11357, -11203, -11082,
-    -10973, -10853, -10853, -10757, -10589, -10404, -10193, -10120, -10087, -9957, -9824, -9732,
-    -9697, -9747, -9787, -9708, -9540, -9388, -9340, -9404, -9483, -9495, -9440, -9374,
-    -9390, -9425, -9360, -9251, -9171, -9194, -9302, -9363, -9262, -9087, -9045, -9059,
-    -9044, -8986, -8877, -8833, -8860, -8890, -8837, -8707, -8616, -8574, -8550, -8550,
-    -8509, -8391, -8274, -8165, -8092, -8046, -7976, -7874, -7743, -7638, -7571, -7517,
-    -7398, -7279, -7177, -7054, -7028, -7015, -6877, -6697, -6548, -6400, -6334, -6287,
-    -6149, -5979, -5805, -5681, -5546, -5364, -5121, -4850, -4678, -4586, -4455, -4254,
-    -4080, -3935, -3837, -3708, -3552, -3426, -3272, -3182, -3092, -2943, -2770, -2619,
-    -2476, -2324, -2179, -1986, -1808, -1639, -1481, -1245, -1013, -885, -679, -444,
-    -191, 103, 320, 377, 465, 673, 941, 1305, 1551, 1684, 1834, 2015,
-    2280, 2503, 2637, 2781, 3026, 3368, 3705, 3929, 4016, 4095, 4344, 4666,
-    4925, 5156, 5324, 5523, 5784, 5973, 6035, 5995, 5924, 5757, 5461, 5040,
-    4452, 3739, 2975, 2192, 1375, 563, -230, -1023, -1762, -2395, -3006, -3594,
-    -4078, -4508, -4802, -4971, -5081, -5075, -5067, -5045, -4913, -4727, -4436, -4071,
-    -3773, -3511, -3216, -2862, -2476, -2124, -1852, -1596, -1233, -793, -405, -137,
-    72, 298, 580, 887, 1142, 1363, 1610, 1885, 2145, 2319, 2412, 2521,
-    2665, 2876, 3125, 3335, 3506, 3640, 3762, 3879, 4011, 4129, 4256, 4483,
-    4674, 4829, 5034, 5174, 5317, 5443, 5479, 5584, 5774, 5962, 6173, 6381,
-    6468, 6515, 6591, 6676, 6823, 7002, 7133, 7276, 7460, 7559, 7590, 7555,
-    7531, 7636, 7813, 7906, 7937, 8054, 8118, 8201, 8286, 8256, 8270, 8353,
-    8391, 8389, 8432, 8436, 8502, 8604, 8600, 8617, 8607, 8561, 8564, 8564,
-    8598, 8678, 8699, 8720, 8714, 8694, 8680, 8628, 8669, 8699, 8740, 8776,
-    8681, 8639, 8670, 8716, 8758, 8745, 8671, 8632, 8665, 8672, 8607, 8475,
-    8415, 8438, 8479, 8491, 8398, 8310, 8223, 8132, 8093, 8071, 8039, 8002,
-    7976, 7961, 7944, 7863, 7756, 7664, 7593, 7547, 7524, 7486, 7371, 7234,
-    7120, 7050, 7035, 6999, 6872, 6770, 6694, 6573, 6402, 6095, 5589, 4976,
-    4353, 3613, 2820, 1959, 954, -118, -1170, -2122, -3082, -4063, -5069, -5954,
-    -6695, -7457, -8177, -8857, -9415, -9789, -10153, -10585, -10920, -11139, -11243, -11240,
-    -11322, -11444, -11481, -11410, -11286, -11174, -11129, -11100, -10993, -10855, -10703, -10584,
-    -10524, -10415, -10262, -10127, -10006, -9922, -9898, -9856, -9778, -9722, -9602, -9463,
-    -9462, -9532, -9574, -9586, -9538, -9423, -9387, -9424, -9397, -9330, -9281, -9280,
-    -9320, -9330, -9312, -9263, -9196, -9178, -9150, -9050, -8907, -8855, -8859, -8796,
-    -8731, -8625, -8501, -8450, -8418, -8343, -8265, -8167, -8066, -7946, -7793, -7702,
-    -7574, -7449, -7385, -7312, -7244, -7158, -7062, -6923, -6784, -6667, -6487, -6339,
-    -6189, -6010, -5973, -5975, -5887, -5702, -5398, -5086, -5008, -5039, -4922, -4744,
-    -4491, -4331, -4359, -4285, -4020, -3721, -3450, -3315, -3400, -3398, -3234, -3006,
-    -2751, -2643, -2599, -2424, -2166, -1977, -1879, -1802, -1671, -1430, -1138, -972,
-    -894, -745, -537, -292, -81, 56, 262, 524, 772, 1039, 1227, 1405,
-    1617, 1802, 2019, 2231, 2468, 2737, 2973, 3170, 3340, 3491, 3664, 3868,
-    4066, 4266, 4503, 4790, 5034, 5218, 5337, 5401, 5531, 5692, 5736, 5608,
-    5332, 4952, 4581, 4171, 3628, 2991, 2270, 1601, 1012, 384, -287, -1014,
-    -1698, -2236, -2655, -3059, -3487, -3857, -4141, -4275, -4317, -4405, -4511, -4562,
-    -4551, -4382, -4156, -4059, -3886, -3605, -3290, -2905, -2602, -2397, -2125, -1810,
-    -1476, -1109, -846, -581, -215, 125, 433, 750, 1015, 1224, 1488, 1775,
-    2010, 2241, 2515, 2810, 3072, 3213, 3318, 3498, 3671, 3904, 4167, 4356,
-    4552, 4789, 4980, 5119, 5229, 5309, 5422, 5569, 5752, 5918, 6067, 6221,
-    6317, 6418, 6552, 6591, 6577, 6665, 6797, 6940, 7072, 7166, 7270, 7338,
-    7396, 7453, 7467, 7496, 7605, 7757, 7884, 7985, 8061, 8095, 8124, 8145,
-    8159, 8202, 8279, 8401, 8529, 8556, 8493, 8457, 8492, 8578, 8646, 8622,
-    8618, 8690, 8763, 8797, 8717, 8546, 8435, 8463, 8542, 8580, 8555, 8499,
-    8480, 8510, 8553, 8485, 8359, 8304, 8326, 8437, 8538, 8526, 8394, 8281,
-    8266, 8307, 8358, 8334, 8240, 8149, 8149, 8195, 8186, 8065, 7936, 7916,
-    7953, 8019, 7984, 7798, 7654, 7639, 7662, 7658, 7575, 7447, 7410, 7415,
-    7367, 7253, 7124, 7034, 6995, 6985, 6939, 6841, 6689, 6482, 6273, 6042,
-    5682, 5211, 4651, 3994, 3294, 2557, 1734, 849, -15, -876, -1732, -2572,
-    -3423, -4266, -5081, -5858, -6593, -7239, -7837, -8417, -8945, -9407, -9843, -10305,
-    -10671, -10904, -11072, -11193, -11273, -11365, -11480, -11526, -11551, -11580, -11580, -11511,
-    -11385, -11269, -11166, -11078, -10986, -10916, -10832, -10717, -10620, -10529, -10416, -10281,
-    -10178, -10098, -10017, -9935, -9860, -9759, -9634, -9542, -9478, -9464, -9466, -9423,
-    -9368, -9262, -9100, -9001, -8949, -8907, -8904, -8895, -8897, -8921, -8901, -8792,
-    -8640, -8534, -8535, -8579, -8536, -8422, -8346, -8341, -8305, -8225, -8101, -7996,
-    -8017, -8020, -7921, -7775, -7613, -7486, -7441, -7412, -7318, -7181, -7047, -6962,
-    -6884, -6818, -6715, -6543, -6401, -6276, -6144, -5954, -5723, -5561, -5500, -5452,
-    -5358, -5238, -5063, -4867, -4715, -4574, -4388, -4212, -4106, -4000, -3866, -3722,
-    -3544, -3319, -3114, -2976, -2873, -2754, -2599, -2423, -2227, -1989, -1721, -1481,
-    -1284, -1119, -998, -872, -659, -431, -225, 18, 230, 434, 640, 804,
-    983, 1196, 1414, 1631, 1820, 1991, 2216, 2458, 2708, 2939, 3105, 3288,
-    3494, 3700, 3911, 4119, 4300, 4504, 4793, 5071, 5282, 5414, 5454, 5504,
-    5611, 5579, 5353, 5039, 4674, 4365, 4046, 3617, 3154, 2634, 2117, 1662,
-    1093, 438, -133, -654, -1093, -1458, -1842, -2232, -2617, -2973, -3254, -3456,
-    -3596, -3699, -3771, -3831, -3834, -3748, -3700, -3637, -3492, -3359, -3150, -2874,
-    -2615, -2312, -2040, -1822, -1564, -1286, -984, -667, -415, -134, 208, 510,
-    786, 1052, 1287, 1527, 1812, 2080, 2316, 2551, 2777, 3023, 3265, 3468,
-    3645, 3811, 3977, 4162, 4353, 4512, 4656, 4789, 4928, 5117, 5325, 5477,
-    5594, 5699, 5780, 5900, 6012, 6058, 6160, 6347, 6547, 6733, 6819, 6816,
-    6851, 6967, 7153, 7353, 7486, 7548, 7601, 7675, 7730, 7756, 7763, 7812,
-    7983, 8175, 8283, 8317, 8270, 8257, 8339, 8419, 8459, 8475, 8533, 8638,
-    8713, 8728, 8702, 8715, 8771, 8809, 8837, 8822, 8789, 8800, 8812, 8785,
-    8745, 8729, 8742, 8762, 8763, 8737, 8684, 8601, 8569, 8595, 8597, 8619,
-    8630, 8577, 8549, 8506, 8440, 8435, 8435, 8415, 8399, 8356, 8292, 8240,
-    8190, 8129, 8114, 8157, 8206, 8211, 8107, 7940, 7829, 7764, 7712, 7671,
-    7626, 7590, 7595, 7589, 7536, 7441, 7315, 7240, 7194, 7104, 6986, 6819,
-    6570, 6298, 5980, 5614, 5168, 4689, 4122, 3433, 2723, 1980, 1190, 459,
-    -335, -1210, -2054, -2846, -3555, -4193, -4900, -5659, -6356, -6983, -7541, -8074,
-    -8624, -9132, -9501, -9787, -10043, -10334, -10651, -10950, -11128, -11215, -11327, -11454,
-    -11565, -11617, -11582, -11551, -11570, -11601, -11576, -11447, -11295, -11166, -11118, -11139,
-    -11116, -11029, -10930, -10871, -10829, -10721, -10559, -10369, -10248, -10235, -10237, -10228,
-    -10163, -10061, -9971, -9889, -9825, -9764, -9656, -9587, -9492, -9412, -9319, -9213,
-    -9129, -9056, -9039, -9034, -9015, -8962, -8837, -8676, -8536, -8423, -8369, -8307,
-    -8233, -8225, -8198, -8123, -8010, -7882, -7718, -7590, -7531, -7485, -7395, -7248,
-    -7092, -6992, -6918, -6839, -6738, -6631, -6499, -6384, -6266, -6115, -5957, -5821,
-    -5676, -5542, -5416, -5299, -5228, -5121, -4953, -4755, -4520, -4310, -4191, -4088,
-    -3905, -3725, -3554, -3386, -3279, -3130, -2917, -2710, -2552, -2392, -2271, -2072,
-    -1818, -1596, -1429, -1316, -1183, -973, -751, -580, -386, -234, -62, 154,
-    393, 622, 804, 1022, 1242, 1489, 1686, 1849, 2006, 2165, 2346, 2609,
-    2859, 3109, 3352, 3563, 3754, 3921, 4080, 4266, 4450, 4691, 4942, 5136,
-    5270, 5325, 5313, 5273, 5225, 5094, 4886, 4659, 4300, 3920, 3536, 3096,
-    2649, 2240, 1779, 1347, 871, 378, -105, -566, -1025, -1407, -1757, -2075,
-    -2338, -2574, -2750, -2911, -3078, -3239, -3312, -3371, -3461, -3512, -3415, -3332,
-    -3250, -3157, -3082, -2890, -2579, -2269, -1991, -1848, -1733, -1562, -1263, -959,
-    -607, -297, -31, 217, 500, 795, 1080, 1334, 1580, 1883, 2172, 2431,
-    2615, 2767, 2929, 3190, 3490, 3734, 3967, 4178, 4356, 4529, 4687, 4829,
-    4974, 5138, 5338, 5540, 5728, 5877, 5975, 6055, 6179, 6307, 6441, 6532,
-    6652, 6753, 6834, 6958, 7093, 7162, 7263, 7365, 7484, 7550, 7618, 7658,
-    7700, 7803, 7886, 7975, 8041, 8086, 8176, 8250, 8355, 8368, 8374, 8400,
-    8424, 8414, 8407, 8425, 8467, 8485, 8511, 8560, 8634, 8720, 8784, 8723,
-    8694, 8631, 8660, 8693, 8741, 8759, 8747, 8764, 8766, 8788, 8827, 8821,
-    8824, 8788, 8758, 8705, 8638, 8595, 8559, 8515, 8554, 8613, 8616, 8553,
-    8445, 8317, 8259, 8237, 8217, 8223, 8199, 8076, 7989, 7945, 7881, 7845,
-    7740, 7682, 7596, 7568, 7507, 7455, 7335, 7218, 7224, 7181, 7045, 6937,
-    6768, 6653, 6476, 6209, 5903, 5530, 5128, 4706, 4262, 3706, 3087, 2496,
-    1852, 1199, 494, -259, -979, -1691, -2385, -3057, -3732, -4452, -5163, -5709,
-    -6215, -6709, -7258, -7794, -8278, -8717, -9149, -9523, -9894, -10204, -10425, -10624,
-    -10806, -11012, -11183, -11342, -11476, -11550, -11588, -11678, -11743, -11755, -11726, -11695,
-    -11655, -11589, -11546, -11471, -11403, -11339, -11285, -11236, -11178, -11088, -11032, -10869,
-    -10704, -10639, -10588, -10483, -10443, -10332, -10222, -10134, -9987, -9882, -9822, -9752,
-    -9671, -9618, -9444, -9302, -9185, -9108, -9087, -9069, -8983, -8890, -8806, -8690,
-    -8603, -8535, -8447, -8344, -8245, -8195, -8152, -8050, -7918, -7836, -7732, -7703,
-    -7648, -7572, -7434, -7312, -7162, -7004, -6900, -6809, -6687, -6615, -6563, -6462,
-    -6275, -6078, -5982, -5863, -5742, -5561, -5375, -5204, -5108, -5047, -4910, -4769,
-    -4585, -4394, -4261, -4064, -3887, -3726, -3562, -3418, -3254, -3039, -2857, -2719,
-    -2606, -2449, -2208, -2017, -1825, -1625, -1429, -1238, -1040, -855, -714, -556,
-    -376, -170, 0, 203, 417, 628, 866, 1064, 1254, 1430, 1641, 1870,
-    2096, 2242, 2382, 2522, 2712, 2965, 3359, 3692, 3846, 3976, 4173, 4437,
-    4634, 4781, 4840, 4908, 4970, 4985, 4945, 4876, 4774, 4653, 4481, 4217,
-    3864, 3479, 3083, 2689, 2306, 1953, 1537, 1057, 672, 386, 48, -290,
-    -669, -1086, -1421, -1664, -1892, -2129, -2346, -2513, -2606, -2708, -2799, -2857,
-    -2930, -2962, -2957, -2927, -2859, -2762, -2650, -2453, -2257, -2095, -1907, -1755,
-    -1572, -1328, -1075, -824, -576, -287, -45, 189, 430, 706, 1061, 1359,
-    1640, 1946, 2112, 2345, 2589, 2850, 3038, 3242, 3498, 3754, 3987, 4249,
-    4482, 4674, 4843, 5010, 5186, 5350, 5490, 5604, 5753, 5907, 6080, 6219,
-    6318, 6517, 6696, 6822, 6992, 7073, 7141, 7164, 7215, 7270, 7353, 7470,
-    7583, 7722, 7843, 7931, 8007, 8051, 8076, 8099, 8162, 8211, 8260, 8361,
-    8436, 8456, 8528, 8560, 8574, 8620, 8638, 8674, 8707, 8784, 8772, 8789,
-    8797, 8760, 8819, 8869, 8830, 8840, 8870, 8892, 8849, 8821, 8736, 8694,
-    8709, 8802, 8884, 8872, 8801, 8757, 8722, 8687, 8611, 8533, 8513, 8527,
-    8501, 8509, 8479, 8434, 8404, 8378, 8352, 8310, 8193, 8105, 8056, 7978,
-    7920, 7826, 7732, 7686, 7699, 7702, 7626, 7558, 7459, 7381, 7289, 7187,
-    7041, 6886, 6798, 6684, 6575, 6364, 6064, 5780, 5464, 5064, 4605, 4156,
-    3636, 3114, 2557, 1969, 1368, 753, 138, -487, -1113, -1772, -2453, -3106,
-    -3718, -4328, -4950, -5556, -6094, -6610, -7093, -7575, -8078, -8549, -8890, -9210,
-    -9548, -9935, -10273, -10567, -10789, -10933, -11075, -11267, -11379, -11492, -11566, -11653,
-    -11759, -11868, -11897, -11889, -11842, -11811, -11761, -11677, -11581, -11482, -11408, -11378,
-    -11311, -11255, -11191, -11069, -10938, -10829, -10744, -10626, -10488, -10340, -10182, -10081,
-    -9989, -9904, -9809, -9744, -9696, -9604, -9494, -9384, -9229, -9065, -8959, -8872,
-    -8798, -8766, -8729, -8661, -8547, -8428, -8262, -8136, -8047, -7987, -7940, -7833,
-    -7781, -7716, -7614, -7473, -7321, -7197, -7121, -7095, -7022, -6912, -6818, -6717,
-    -6625, -6490, -6349, -6223, -6111, -6049, -5990, -5861, -5683, -5514, -5343, -5214,
-    -5129, -4986, -4845, -4737, -4570, -4446, -4312, -4133, -3885, -3702, -3591, -3478,
-    -3334, -3168, -2969, -2768, -2541, -2347, -2158, -1985, -1832, -1727, -1564, -1370,
-    -1111, -836, -600, -392, -206, -85, 57, 213, 395, 615, 861, 1064,
-    1289, 1539, 1789, 1967, 2093, 2232, 2426, 2652, 2902, 3148, 3391, 3619,
-    3883, 4072, 4185, 4287, 4403, 4500, 4620, 4711, 4729, 4670, 4531, 4414,
-    4293, 4106, 3903, 3707, 3457, 3160, 2772, 2373, 2021, 1658, 1343, 1096,
-    838, 571, 286, -6, -367, -736, -1053, -1294, -1484, -1635, -1766, -1865,
-    -1964, -2096, -2213, -2336, -2402, -2392, -2331, -2289, -2252, -2213, -2173, -2122,
-    -1985, -1825, -1684, -1533, -1348, -1102, -872, -699, -511, -383, -226, 10,
-    282, 573, 855, 1093, 1332, 1555, 1768, 2009, 2235, 2536, 2853, 3055,
-    3206, 3341, 3503, 3706, 3948, 4260, 4551, 4765, 4958, 5068, 5169, 5257,
-    5352, 5509, 5730, 5994, 6225, 6369, 6447, 6502, 6547, 6587, 6657, 6756,
-    6918, 7080, 7183, 7242, 7294, 7333, 7420, 7515, 7528, 7529, 7600, 7706,
-    7778, 7835, 7851, 7859, 7898, 7909, 7940, 7953, 7970, 8027, 8071, 8074,
-    8018, 7989, 8036, 8096, 8193, 8193, 8146, 8030, 7963, 7986, 7978, 8029,
-    8080, 8101, 8095, 8065, 8025, 7899, 7829, 7765, 7811, 7880, 7895, 7875,
-    7805, 7764, 7687, 7594, 7501, 7440, 7433, 7480, 7530, 7498, 7410, 7293,
-    7178, 7118, 7068, 7011, 6972, 6929, 6930, 6918, 6849, 6763, 6697, 6651,
-    6535, 6437, 6319, 6197, 6124, 6029, 5914, 5756, 5645, 5540, 5372, 5107,
-    4697, 4252, 3860, 3516, 3196, 2864, 2517, 2135, 1727, 1308, 773, 208,
-    -355, -835, -1215, -1592, -1981, -2435, -2869, -3304, -3767, -4249, -4732, -5102,
-    -5430, -5693, -5921, -6241, -6603, -6957, -7292, -7534, -7734, -7923, -8111, -8305,
-    -8432, -8570, -8708, -8848, -9001, -9122, -9186, -9239, -9314, -9371, -9441, -9483,
-    -9475, -9456, -9453, -9408, -9352, -9309, -9251, -9229, -9281, -9326, -9257, -9142,
-    -8978, -8838, -8741, -8644, -8591, -8541, -8543, -8527, -8438, -8350, -8187, -8001,
-    -7848, -7706, -7579, -7505, -7479, -7460, -7388, -7306, -7159, -6998, -6856, -6738,
-    -6668, -6651, -6619, -6541, -6425, -6294, -6192, -6092, -5981, -5905, -5798, -5719,
-    -5618, -5524, -5434, -5356, -5292, -5187, -5076, -5005, -4894, -4795, -4719, -4590,
-    -4408, -4281, -4201, -4121, -4054, -4022, -3941, -3830, -3695, -3539, -3370, -3235,
-    -3092, -3015, -2948, -2885, -2822, -2707, -2571, -2428, -2270, -2155, -2045, -1944,
-    -1826, -1717, -1607, -1486, -1335, -1164, -992, -908, -838, -748, -616, -456,
-    -283, -136, -17, 60, 198, 378, 537, 707, 849, 951, 1078, 1206,
-    1336, 1446, 1569, 1701, 1850, 2024, 2189, 2348, 2495, 2552, 2574, 2528,
-    2479, 2499, 2529, 2539, 2578, 2621, 2611, 2547, 2381, 2153, 1976, 1820,
-    1727, 1681, 1617, 1515, 1406, 1215, 994, 804, 615, 453, 330, 245,
-    134, 35, -89, -198, -261, -385, -463, -544, -673, -742, -771, -789,
-    -819, -837, -858, -858, -838, -826, -808, -807, -836, -822, -790, -676,
-    -575, -475, -319, -215, -147, -120, -103, -77, -16, 160, 336, 509,
-    654, 761, 885, 989, 1062, 1163, 1223, 1347, 1539, 1738, 1907, 2037,
-    2160, 2264, 2358, 2469, 2570, 2680, 2774, 2920, 3048, 3153, 3277, 3429,
-    3532, 3621, 3682, 3748, 3809, 3875, 3950, 4048, 4162, 4330, 4499, 4533,
-    4556, 4586, 4553, 4596, 4620, 4681, 4767, 4841, 4951, 5020, 5072, 5167,
-    5256, 5277, 5205, 5163, 5155, 5154, 5207, 5272, 5319, 5391, 5432, 5450,
-    5420, 5376, 5343, 5326, 5294, 5298, 5311, 5334, 5374, 5372, 5321, 5255,
-    5145, 5085, 5080, 5121, 5157, 5115, 5062, 5021, 5007, 4988, 4952, 4925,
-    4847, 4827, 4821, 4822, 4834, 4838, 4838, 4780, 4716, 4635, 4583, 4541,
-    4512, 4478, 4444, 4468, 4452, 4374, 4267, 4205, 4160, 4110, 4079, 3985,
-    3859, 3703, 3518, 3371, 3181, 3039, 2936, 2805, 2658, 2462, 2216, 1932,
-    1645, 1383, 1177, 1009, 821, 593, 325, 60, -203, -472, -760, -1068,
-    -1335, -1522, -1691, -1881, -2072, -2302, -2555, -2800, -3007, -3238, -3458, -3637,
-    -3776, -3899, -4055, -4219, -4386, -4537, -4663, -4794, -4924, -5045, -5188, -5319,
-    -5365, -5418, -5502, -5531, -5586, -5647, -5689, -5680, -5719, -5788, -5818, -5891,
-    -5934, -5942, -5908, -5840, -5779, -5729, -5736, -5806, -5849, -5826, -5801, -5777,
-    -5697, -5624, -5584, -5532, -5518, -5511, -5512, -5488, -5411, -5394, -5314, -5209,
-    -5141, -5092, -5067, -5024, -4969, -4893, -4821, -4753, -4652, -4574, -4496, -4383,
-    -4364, -4321, -4250, -4177, -4102, -4064, -3995, -3922, -3833, -3689, -3590, -3525,
-    -3526, -3529, -3436, -3327, -3155, -3050, -3009, -2977, -2939, -2859, -2798, -2686,
-    -2555, -2424, -2297, -2246, -2203, -2186, -2156, -2102, -1991, -1845, -1745, -1659,
-    -1569, -1515, -1472, -1408, -1362, -1306, -1215, -1081, -967, -876, -832, -788,
-    -704, -594, -487, -372, -297, -223, -134, -71, -19, 87, 228, 297,
-    390, 455, 507, 567, 643, 726, 795, 890, 1007, 1076, 1107, 1112,
-    1108, 1175, 1274, 1384, 1457, 1434, 1391, 1352, 1334, 1321, 1276, 1279,
-    1306, 1333, 1357, 1300, 1189, 1098, 1016, 975, 912, 866, 806, 730,
-    647, 536, 462, 382, 339, 310, 246, 210, 142, 54, -14, -91,
-    -114, -143, -142, -158, -178, -194, -210, -245, -285, -286, -289, -257,
-    -217, -206, -218, -220, -210, -198, -193, -163, -117, -73, -44, 1,
-    76, 153, 203, 261, 275, 268, 278, 318, 408, 502, 590, 666,
-    743, 824, 874, 895, 923, 973, 1059, 1120, 1194, 1243, 1317, 1384,
-    1433, 1500, 1568, 1626, 1698, 1801, 1889, 1954, 1985, 2033, 2068, 2132,
-    2201, 2269, 2342, 2381, 2439, 2502, 2575, 2679, 2726, 2766, 2780, 2798,
-    2820, 2833, 2853, 2876, 2944, 3020, 3127, 3215, 3235, 3202, 3183, 3136,
-    3111, 3132, 3199, 3315, 3454, 3551, 3525, 3445, 3347, 3285, 3260, 3298,
-    3392, 3488, 3577, 3621, 3601, 3505, 3407, 3326, 3267, 3300, 3381, 3452,
-    3466, 3449, 3422, 3367, 3297, 3234, 3213, 3208, 3203, 3194, 3158, 3152,
-    3145, 3130, 3118, 3120, 3109, 3084, 3075, 3024, 2958, 2890, 2841, 2811,
-    2766, 2726, 2675, 2624, 2565, 2486, 2371, 2262, 2190, 2108, 2010, 1890,
-    1786, 1648, 1557, 1470, 1380, 1233, 1018, 858, 731, 632, 491, 370,
-    267, 159, 10, -173, -382, -564, -686, -747, -821, -953, -1099, -1249,
-    -1398, -1538, -1655, -1778, -1904, -2000, -2063, -2162, -2279, -2364, -2442, -2540,
-    -2597, -2643, -2708, -2817, -2884, -2961, -3054, -3117, -3146, -3142, -3165, -3195,
-    -3258, -3353, -3451, -3508, -3536, -3520, -3503, -3468, -3469, -3509, -3589, -3683,
-    -3767, -3801, -3772, -3725, -3665, -3602, -3543, -3542, -3566, -3631, -3688, -3697,
-    -3646, -3545, -3440, -3374, -3329, -3294, -3278, -3283, -3297, -3299, -3271, -3210,
-    -3135, -3059, -3001, -2970, -2940, -2906, -2875, -2823, -2762, -2708, -2667, -2634,
-    -2628, -2597, -2521, -2409, -2307, -2236, -2193, -2187, -2188, -2176, -2133, -2086,
-    -1988, -1862, -1764, -1705, -1664, -1648, -1648, -1634, -1638, -1585, -1499, -1409,
-    -1311, -1252, -1214, -1196, -1179, -1171, -1116, -1014, -928, -817, -726, -672,
-    -637, -620, -602, -596, -547, -449, -348, -249, -188, -188, -206, -180,
-    -120, -41, 44, 108, 161, 203, 267, 332, 380, 422, 471, 548,
-    596, 599, 599, 611, 653, 719, 788, 809, 838, 892, 913, 889,
-    859, 822, 792, 802, 798, 840, 850, 811, 771, 717, 680, 630,
-    594, 569, 535, 526, 527, 508, 482, 415, 343, 280, 277, 311,
-    380, 368, 268, 156, 76, 89, 156, 177, 197, 230, 205, 126,
-    24, -53, -106, -22, 120, 181, 233, 241, 171, 27, -19, -62,
-    -36, 52, 181, 193, 223, 239, 235, 123, 82, 72, 161, 330,
-    405, 406, 374, 342, 374, 500, 554, 591, 627, 729, 800, 791,
-    801, 851, 863, 929, 960, 1046, 1094, 1132, 1097, 1066, 1059, 1162,
-    1264, 1374, 1456, 1454, 1438, 1413, 1394, 1375, 1374, 1360, 1512, 1686,
-    1793, 1768, 1896, 1870, 1798, 1744, 1776, 1762, 1845, 1951, 2083, 2199,
-    2211, 2030, 2089, 2212, 2098, 2530, 4293, 8513, 9056, 8701, 8637, 8449,
-    8403, 8193, 7805, 7780, 7490, 7129, 7433, 7558, 7116, 7360, 6977, 6612,
-    6376, 6133, 7277, 6810, 6222, 5270, 6052, 6384, 7402, 7177, 8302, 8451,
-    9436, 10116, 10434, 10196, 8602, 6126, 2373, -170, -3487, -5908, -8095, -8951,
-    -9011, -9645, -11366, -14748, -15821, -13455, -10556, -8679, -6957, -2266, 5245, 9225,
-    8203, 8287, 11433, 13114, 13058, 12817, 15456, 16770, 16455, 15825, 11551, -1125,
-    -15158, -10258, 11309, 1451, -1608, -3613, -3067, -3635, -2703, -3908, -7148, -5354,
-    569, 9409, 14364, 15104, 14650, 13614, 12479, 10732, 9071, 7578, 4188, 977,
-    -2401, -4724, -6460, -7605, -9099, -10824, -12491, -13155, -14035, -14617, -15264, -15819,
-    -16803, -17393, -17828, -17326, -17671, -17777, -18236, -18053, -17502, -17378, -16368, -17096,
-    -17011, -16094, -13786, -12322, -12982, -15479, -16731, -17126, -16925, -16041, -15729, -15171,
-    -13273, -10784, -8278, -4987, -872, 2281, 4288, 6554, 8434, 9912, 10859, 11821,
-    13205, 14085, 14725, 15179, 15448, 15721, 16005, 16045, 16160, 16551, 16462, 16341,
-    16170, 15994, 14739, 14136, 13789, 13085, 12972, 13363, 12658, 11725, 11428, 11390,
-    10927, 9535, 8182, 7535, 7267, 7979, 8995, 9906, 10024, 9895, 9571, 8893,
-    8390, 7600, 5422, 2564, -826, -4263, -7310, -9468, -11574, -12982, -14097, -15108,
-    -16017, -17121, -17967, -18632, -18718, -19196, -20043, -20542, -20938, -21195, -21320, -21285,
-    -21270, -21146, -20711, -20183, -19638, -19055, -18386, -17364, -16129, -15427, -15754, -16493,
-    -16870, -16955, -17087, -16747, -16119, -15334, -14619, -13889, -12819, -10882, -8584, -6289,
-    -3411, 98, 3070, 5719, 7315, 8678, 9912, 11231, 12189, 12731, 13441, 14288,
-    15053, 15822, 15902, 15920, 15746, 15691, 15427, 15265, 15009, 14766, 14616, 14323,
-    13844, 13222, 12827, 12542, 12268, 11850, 11327, 10899, 10789, 10110, 8832, 7633,
-    7400, 8035, 9242, 10264, 11074, 11885, 12359, 12033, 10973, 9238, 7363, 5504,
-    3079, -177, -3442, -5833, -7384, -8864, -10190, -11350, -12402, -13541, -14758, -15697,
-    -16232, -16643, -16871, -17136, -17379, -17427, -17346, -17182, -16889, -16760, -16425, -15988,
-    -15453, -14824, -14364, -13877, -13300, -12625, -11908, -11238, -10648, -10106, -9235, -8170,
-    -7070, -6463, -6536, -7039, -7490, -7678, -7755, -7832, -7852, -7796, -7460, -6070,
-    -4136, -1307, 1988, 5358, 7851, 9779, 11537, 13208, 14863, 16306, 17618, 18741,
-    19557, 20239, 20504, 20752, 21120, 21410, 21787, 21908, 21893, 21879, 21648, 21467,
-    21191, 20824, 20368, 20094, 19728, 19282, 18481, 17705, 16972, 16401, 15887, 15289,
-    14627, 13875, 13208, 12409, 11677, 10736, 9819, 8894, 8226, 8396, 8724, 8991,
-    9179, 9688, 10040, 9988, 9908, 9654, 8829, 7207, 4946, 1857, -1421, -4480,
-    -6376, -7921, -9395, -10945, -12371, -13475, -14303, -15141, -16037, -16951, -17604, -18057,
-    -17763, -17386, -17376, -17424, -17403, -17349, -17234, -17142, -17133, -16881, -16590, -16228,
-    -15895, -15508, -14916, -14023, -13125, -12295, -11692, -11188, -10662, -10022, -9301, -8703,
-    -8236, -7645, -6801, -5859, -5478, -5804, -6213, -6465, -6652, -6730, -6898, -7038,
-    -7028, -6931, -6462, -5156, -2910, -81, 2968, 5340, 7021, 8822, 10526, 11817,
-    12738, 13625, 14618, 15602, 16413, 16880, 17287, 17714, 18155, 18362, 18438, 18443,
-    18461, 18412, 18106, 17805, 17359, 16841, 16370, 15769, 15164, 14644, 14134, 13595,
-    13033, 12372, 11634, 10743, 9763, 8865, 8177, 7641, 7165, 6572, 5931, 5132,
-    4393, 3581, 2457, 1294, 85, -1218, -2025, -2535, -2720, -2754, -2855, -2855,
-    -2706, -2755, -2959, -3183, -3354, -3510, -3769, -4887, -6607, -8336, -10033, -11823,
-    -13469, -15048, -16472, -17583, -18555, -19414, -20121, -20604, -21045, -21536, -21945, -22215,
-    -22399, -22362, -22218, -21938, -21568, -21150, -20703, -20206, -19680, -19242, -18776, -18122,
-    -17590, -17209, -16810, -16239, -15476, -14642, -13778, -12816, -11821, -10964, -10190, -9557,
-    -8909, -8281, -7611, -6831, -6057, -5155, -3999, -2612, -994, 16, 303, 299,
-    214, 240, 358, 624, 885, 1129, 1709, 2609, 3674, 4571, 5299, 6355,
-    7874, 9558, 11258, 12920, 14504, 15942, 17315, 18611, 19756, 20730, 21364, 21851,
-    22207, 22524, 22793, 22925, 22787, 22638, 22489, 22315, 22102, 21872, 21505, 21017,
-    20456, 19943, 19438, 18824, 18010, 17158, 16380, 15567, 14786, 14143, 13481, 12796,
-    11919, 10929, 10049, 9286, 8618, 7852, 7109, 6431, 5757, 4857, 3732, 2513,
-    1394, 400, -542, -1521, -2605, -3773, -4740, -5138, -5264, -5387, -5387, -5312,
-    -5386, -5610, -5937, -6386, -6933, -7448, -8006, -8511, -8905, -9274, -9649, -9794,
-    -10076, -10809, -11911, -13180, -14406, -15722, -17038, -18139, -19146, -19846, -20399, -20843,
-    -21263, -21700, -21996, -22184, -22331, -22442, -22434, -22213, -21542, -20732, -19976, -19219,
-    -18482, -17780, -17109, -16547, -16071, -15670, -15171, -14579, -14016, -13310, -12465, -11610,
-    -10765, -9846, -8963, -8127, -7438, -6708, -6001, -5150, -4013, -2832, -1569, -442,
-    625, 1688, 2693, 3653, 4600, 5502, 6378, 7194, 8138, 8729, 8928, 8958,
-    8930, 8863, 8688, 8601, 8584, 8732, 8940, 9305, 9808, 10393, 11101, 11802,
-    12518, 13187, 13998, 15062, 16313, 17576, 18890, 20211, 21320, 22290, 23106, 23765,
-    24179, 24484, 24799, 24988, 25038, 24862, 24615, 24165, 23471, 22734, 22081, 21410,
-    20668, 19973, 19343, 18710, 18009, 17347, 16770, 16183, 15528, 14826, 13963, 12938,
-    11963, 11028, 10212, 9504, 8782, 7931, 7122, 6303, 5517, 4379, 3098, 1871,
-    714, -397, -1531, -2657, -3720, -4765, -5612, -6184, -6769, -7465, -8118, -8603,
-    -9096, -9687, -10379, -10755, -10893, -10969, -11054, -11171, -11294, -11333, -11466, -11704,
-    -12063, -12489, -12897, -13241, -13591, -13926, -14445, -14964, -15401, -15874, -16309, -16777,
-    -17125, -17393, -17471, -17549, -17747, -17504, -17593, -18078, -18618, -19172, -19652, -19973,
-    -20244, -20448, -20533, -20498, -20315, -19914, -19342, -18697, -18117, -17541, -16930, -16348,
-    -15837, -15320, -14717, -14151, -13557, -13074, -12623, -12166, -11649, -11169, -10725, -10154,
-    -9358, -8568, -7737, -6889, -5996, -4969, -3846, -2742, -1618, -389, 822, 1935,
-    3061, 4025, 4877, 5595, 6316, 6994, 7685, 8410, 9058, 9657, 10258, 10778,
-    11274, 11730, 12193, 12605, 12970, 13544, 14150, 14342, 14171, 14135, 14144, 14057,
-    13858, 13732, 13660, 13562, 13447, 13481, 13627, 13924, 14281, 14616, 14908, 15184,
-    15503, 15816, 16020, 16548, 17353, 18226, 19084, 19859, 20538, 21099, 21497, 21695,
-    21417, 20773, 20203, 19558, 18930, 18360, 17687, 17100, 16508, 15892, 15144, 14492,
-    13846, 13227, 12678, 12192, 11770, 11223, 10695, 10204, 9676, 9106, 8566, 8090,
-    7705, 7260, 6800, 6404, 5934, 5434, 4883, 4073, 2821, 1462, 142, -1148,
-    -2438, -3724, -4947, -5896, -6675, -7484, -8238, -9030, -9717, -10316, -10936, -11470,
-    -11945, -12456, -13031, -13588, -14189, -14790, -15318, -15781, -16282, -16681, -16932, -17188,
-    -17294, -17363, -17338, -17311, -17347, -17400, -17376, -17283, -17156, -17023, -16962, -16883,
-    -16797, -16723, -16784, -16878, -16907, -16840, -16769, -16736, -16779, -16855, -16951, -17001,
-    -17001, -17129, -17358, -17507, -17553, -17547, -17557, -17413, -17383, -17502, -17699, -17842,
-    -17923, -17671, -17167, -16705, -16172, -15638, -14990, -14301, -13642, -12979, -12341, -11759,
-    -11189, -10605, -10122, -9597, -9038, -8480, -7933, -7391, -6879, -6469, -6017, -5560,
-    -5196, -4726, -4113, -3492, -2813, -2090, -1043, 397, 1797, 3264, 4728, 6016,
-    6964, 7816, 8609, 9443, 10242, 11042, 11792, 12471, 13132, 13759, 14333, 14854,
-    15329, 15904, 16396, 16803, 17143, 17491, 17850, 18150, 18486, 18795, 19119, 19317,
-    19512, 19694, 19870, 20075, 20200, 20199, 20184, 20077, 19874, 19573, 19309, 19016,
-    18842, 18746, 18621, 18495, 18352, 18209, 18059, 17849, 17624, 17440, 17339, 17222,
-    17129, 17056, 17071, 17142, 17089, 16984, 17015, 17069, 17075, 16989, 16876, 16945,
-    17076, 17056, 16449, 15855, 15226, 14612, 14063, 13534, 12922, 12371, 11773, 11131,
-    10579, 10021, 9526, 9025, 8534, 8079, 7626, 7181, 6728, 6302, 5877, 5461,
-    4910, 4160, 3496, 2772, 2134, 1558, 974, 394, -164, -745, -1441, -2704,
-    -4122, -5433, -6434, -7374, -8257, -9098, -9917, -10686, -11507, -12248, -12878, -13558,
-    -14281, -14917, -15474, -15995, -16592, -17114, -17606, -18063, -18447, -18816, -19243, -19632,
-    -19997, -20293, -20561, -20830, -20976, -21113, -21258, -21419, -21549, -21720, -21851, -21799,
-    -21656, -21507, -21279, -21017, -20738, -20601, -20442, -20191, -19970, -19729, -19527, -19334,
-    -19178, -18922, -18594, -18442, -18314, -18208, -18041, -17871, -17692, -17514, -17261, -17043,
-    -16773, -16438, -16246, -16044, -15835, -15635, -15366, -14898, -14338, -13705, -13069, -12497,
-    -11847, -11222, -10704, -10178, -9666, -9147, -8639, -8141, -7655, -7196, -6708, -6212,
-    -5727, -5138, -4400, -3747, -3119, -2474, -1862, -1188, -500, 191, 858, 1431,
-    1986, 2527, 3064, 3540, 4095, 4626, 5114, 5574, 6000, 6598, 7428, 8154,
-    8923, 9668, 10421, 11206, 11978, 12772, 13479, 14190, 14836, 15477, 16037, 16598,
-    17122, 17658, 18157, 18659, 19158, 19628, 20016, 20320, 20626, 20944, 21188, 21413,
-    21592, 21712, 21875, 22115, 22332, 22408, 22496, 22553, 22583, 22610, 22606, 22572,
-    22535, 22489, 22434, 22317, 22195, 22006, 21889, 21693, 21498, 21300, 21078, 20877,
-    20669, 20454, 20122, 19673, 19160, 18585, 17973, 17369, 16818, 16318, 15814, 15300,
-    14829, 14438, 14097, 13808, 13473, 13167, 12723, 12174, 11612, 11029, 10406, 9795,
-    9232, 8702, 8160, 7640, 7112, 6606, 6132, 5629, 5067, 4411, 3699, 3043,
-    2368, 1737, 1098, 472, -132, -699, -1319, -1966, -2537, -3053, -3553, -4044,
-    -4538, -4977, -5271, -5524, -5833, -6130, -6414, -6691, -6923, -7198, -7454, -7651,
-    -7864, -8062, -8274, -8501, -8677, -8883, -9098, -9325, -9507, -9738, -10306, -10965,
-    -11683, -12428, -13220, -13971, -14600, -15246, -15873, -16459, -16998, -17483, -17957, -18480,
-    -19028, -19521, -20005, -20444, -20850, -21159, -21450, -21718, -21987, -22240, -22454, -22639,
-    -22782, -22897, -23028, -23130, -23167, -23238, -23221, -23170, -23109, -23011, -22905, -22763,
-    -22638, -22515, -22394, -22209, -22009, -21802, -21610, -21378, -21116, -20880, -20611, -20400,
-    -20153, -19750, -19281, -18766, -18271, -17715, -17155, -16638, -16169, -15723, -15327, -14916,
-    -14526, -14181, -13751, -13375, -13021, -12677, -12339, -11809, -11235, -10614, -10053, -9447,
-    -8872, -8359, -7819, -7280, -6734, -6177, -5712, -5129, -4412, -3670, -2938, -2254,
-    -1544, -868, -224, 438, 1068, 1708, 2301, 2863, 3403, 3954, 4448, 4886,
-    5311, 5663, 6024, 6351, 6653, 6930, 7182, 7436, 7714, 7972, 8189, 8389,
-    8608, 8835, 9053, 9281, 9490, 9683, 9892, 10091, 10310, 10539, 10850, 11311,
-    11807, 12340, 12863, 13391, 13864, 14342, 14848, 15382, 15891, 16422, 16948, 17447,
-    17889, 18323, 18748, 19209, 19615, 20006, 20388, 20765, 21094, 21397, 21673, 21911,
-    22148, 22411, 22641, 22833, 22985, 23178, 23319, 23388, 23479, 23526, 23548, 23580,
-    23601, 23577, 23495, 23397, 23294, 23147, 22997, 22833, 22665, 22497, 22306, 22064,
-    21787, 21504, 21222, 20930, 20623, 20279, 19903, 19505, 19084, 18629, 18154, 17676,
-    17212, 16739, 16297, 15855, 15366, 14896, 14369, 13806, 13258, 12721, 12180, 11626,
-    11061, 10527, 9987, 9422, 8852, 8271, 7695, 7154, 6657, 6136, 5604, 5037,
-    4297, 3532, 2796, 2077, 1352, 670, -18, -680, -1324, -1977, -2597, -3196,
-    -3791, -4359, -4909, -5351, -5704, -6058, -6423, -6764, -7114, -7439, -7770, -8108,
-    -8417, -8730, -9021, -9308, -9585, -9896, -10224, -10545, -10848, -11125, -11398, -11676,
-    -11958, -12260, -12541, -12830, -13126, -13383, -13626, -13866, -14072, -14310, -14532, -14766,
-    -14988, -15210, -15458, -15679, -15858, -16042, -16251, -16453, -16664, -16886, -17124, -17334,
-    -17538, -17709, -17924, -18182, -18403, -18607, -18794, -18994, -19231, -19458, -19682, -19890,
-    -20104, -20283, -20459, -20610, -20734, -20867, -20994, -21117, -21242, -21356, -21464, -21547,
-    -21594, -21623, -21639, -21634, -21617, -21573, -21505, -21407, -21280, -21154, -21024, -20857,
-    -20644, -20406, -20133, -19845, -19552, -19249, -18951, -18655, -18308, -17925, -17523, -17078,
-    -16609, -16125, -15620, -15123, -14646, -14180, -13721, -13243, -12737, -12229, -11701, -11139,
-    -10569, -10005, -9452, -8938, -8447, -7941, -7415, -6863, -6290, -5741, -5174, -4468,
-    -3670, -2899, -2154, -1409, -674, 44, 749, 1423, 2052, 2673, 3276, 3848,
-    4409, 4935, 5357, 5695, 6003, 6281, 6550, 6839, 7109, 7364, 7619, 7841,
-    8047, 8273, 8503, 8748, 9009, 9264, 9506, 9739, 9974, 10197, 10416, 10654,
-    10887, 11131, 11388, 11635, 11892, 12139, 12367, 12604, 12843, 13104, 13387, 13642,
-    13883, 14132, 14366, 14597, 14840, 15071, 15310, 15566, 15800, 16036, 16281, 16497,
-    16695, 16871, 17037, 17230, 17427, 17628, 17832, 18009, 18177, 18331, 18461, 18584,
-    18690, 18810, 18958, 19085, 19203, 19315, 19397, 19471, 19543, 19606, 19682, 19771,
-    19857, 19929, 19989, 20033, 20062, 20094, 20132, 20177, 20235, 20296, 20334, 20336,
-    20313, 20270, 20229, 20195, 20140, 20075, 19993, 19860, 19711, 19558, 19373, 19169,
-    18942, 18693, 18424, 18143, 17848, 17514, 17150, 16752, 16319, 15900, 15479, 15019,
-    14556, 14080, 13557, 13011, 12449, 11883, 11342, 10807, 10258, 9705, 9145, 8577,
-    8010, 7431, 6832, 6238, 5679, 5129, 4467, 3675, 2867, 2076, 1303, 566,
-    -168, -863, -1500, -2141, -2773, -3381, -3971, -4539, -5089, -5540, -5865, -6162,
-    -6466, -6772, -7092, -7398, -7681, -7954, -8214, -8457, -8693, -8916, -9136, -9375,
-    -9631, -9906, -10179, -10419, -10645, -10863, -11072, -11296, -11541, -11795, -12051, -12305,
-    -12568, -12827, -13073, -13315, -13546, -13761, -14001, -14258, -14500, -14737, -14972, -15196,
-    -15427, -15673, -15907, -16129, -16361, -16589, -16811, -17020, -17217, -17419, -17631, -17854,
-    -18063, -18255, -18449, -18613, -18757, -18912, -19075, -19244, -19388, -19513, -19645, -19758,
-    -19862, -19956, -20019, -20084, -20148, -20192, -20244, -20296, -20322, -20352, -20376, -20368,
-    -20340, -20280, -20211, -20151, -20067, -19994, -19950, -19888, -19808, -19714, -19575, -19422,
-    -19276, -19125, -18986, -18850, -18706, -18561, -18390, -18206, -18022, -17794, -17556, -17341,
-    -17116, -16871, -16604, -16317, -16019, -15720, -15412, -15094, -14776, -14437, -14078, -13713,
-    -13344, -12963, -12548, -12118, -11699, -11280, -10866, -10453, -10029, -9572, -9087, -8607,
-    -8127, -7649, -7180, -6702, -6234, -5755, -5163, -4445, -3689, -2946, -2218, -1508,
-    -811, -142, 518, 1192, 1855, 2499, 3129, 3736, 4292, 4772, 5204, 5585,
-    5920, 6241, 6540, 6823, 7110, 7381, 7626, 7870, 8109, 8329, 8544, 8753,
-    8954, 9155, 9340, 9515, 9694, 9877, 10055, 10216, 10371, 10525, 10689, 10842,
-    10955, 11076, 11227, 11379, 11536, 11686, 11828, 11983, 12144, 12294, 12428, 12564,
-    12727, 12912, 13106, 13297, 13477, 13650, 13832, 14008, 14192, 14395, 14600, 14823,
-    15055, 15281, 15519, 15760, 16003, 16245, 16493, 16752, 17007, 17260, 17513, 17760,
-    18013, 18270, 18514, 18748, 18978, 19200, 19414, 19616, 19803, 19988, 20163, 20329,
-    20492, 20635, 20765, 20891, 21015, 21115, 21179, 21233, 21276, 21317, 21371, 21405,
-    21422, 21434, 21421, 21382, 21326, 21255, 21184, 21104, 21000, 20892, 20777, 20624,
-    20451, 20263, 20057, 19845, 19614, 19374, 19140, 18898, 18639, 18357, 18047, 17717,
-    17382, 17041, 16686, 16345, 15996, 15610, 15199, 14780, 14354, 13923, 13491, 13053,
-    12614, 12173, 11712, 11230, 10735, 10235, 9758, 9282, 8783, 8293, 7807, 7313,
-    6824, 6321, 5817, 5305, 4663, 3913, 3192, 2467, 1719, 991, 268, -426,
-    -1090, -1747, -2397, -3037, -3662, -4287, -4875, -5343, -5714, -6072, -6425, -6755,
-    -7081, -7400, -7709, -8024, -8314, -8591, -8873, -9126, -9359, -9593, -9835, -10081,
-    -10310, -10514, -10700, -10893, -11088, -11272, -11458, -11618, -11762, -11914, -12047, -12166,
-    -12283, -12394, -12500, -12594, -12701, -12827, -12949, -13064, -13178, -13296, -13419, -13532,
-    -13641, -13771, -13909, -14041, -14196, -14357, -14512, -14679, -14840, -14988, -15150, -15316,
-    -15472, -15640, -15835, -16031, -16228, -16425, -16600, -16774, -16963, -17147, -17346, -17565,
-    -17777, -17991, -18194, -18374, -18550, -18714, -18884, -19071, -19246, -19423, -19600, -19761,
-    -19911, -20048, -20186, -20319, -20453, -20595, -20720, -20830, -20944, -21054, -21150, -21235,
-    -21321, -21396, -21458, -21503, -21517, -21531, -21559, -21571, -21556, -21530, -21503, -21449,
-    -21376, -21298, -21202, -21090, -20969, -20847, -20728, -20603, -20455, -20285, -20111, -19922,
-    -19715, -19493, -19243, -18990, -18737, -18472, -18195, -17884, -17554, -17225, -16874, -16493,
-    -16110, -15750, -15382, -15001, -14606, -14175, -13728, -13275, -12818, -12355, -11887, -11426,
-    -10950, -10466, -9990, -9508, -9002, -8460, -7907, -7355, -6806, -6276, -5732, -5097,
-    -4323, -3498, -2701, -1888, -1079, -294, 485, 1241, 1978, 2683, 3373, 4019,
-    4573, 5070, 5501, 5884, 6270, 6647, 7022, 7373, 7715, 8052, 8364, 8686,
-    9006, 9311, 9603, 9862, 10126, 10386, 10636, 10895, 11127, 11366, 11619, 11841,
-    12047, 12257, 12454, 12619, 12790, 12966, 13122, 13294, 13472, 13636, 13794, 13935,
-    14070, 14195, 14318, 14461, 14597, 14716, 14854, 14993, 15129, 15282, 15418, 15530,
-    15669, 15814, 15960, 16108, 16249, 16418, 16597, 16766, 16935, 17112, 17303, 17479,
-    17650, 17840, 18030, 18223, 18412, 18595, 18780, 18955, 19139, 19309, 19478, 19690,
-    19898, 20083, 20270, 20462, 20661, 20850, 21035, 21213, 21365, 21514, 21648, 21771,
-    21892, 21989, 22112, 22240, 22318, 22396, 22454, 22478, 22515, 22551, 22585, 22617,
-    22647, 22684, 22697, 22686, 22658, 22614, 22556, 22486, 22441, 22396, 22325, 22245,
-    22141, 22024, 21903, 21770, 21634, 21481, 21309, 21125, 20935, 20737, 20525, 20309,
-    20086, 19861, 19628, 19365, 19078, 18778, 18482, 18193, 17892, 17582, 17262, 16927,
-    16589, 16234, 15851, 15463, 15088, 14718, 14330, 13932, 13535, 13107, 12673, 12253,
-    11796, 11338, 10901, 10452, 10005, 9559, 9088, 8598, 8122, 7672, 7211, 6745,
-    6267, 5723, 5078, 4350, 3585, 2781, 1954, 1130, 298, -535, -1381, -2241,
-    -3106, -3944, -4732, -5488, -6124, -6609, -7033, -7439, -7853, -8247, -8622, -9016,
-    -9393, -9767, -10146, -10501, -10854, -11203, -11551, -11894, -12228, -12554, -12875, -13193,
-    -13501, -13799, -14087, -14358, -14619, -14858, -15088, -15338, -15602, -15864, -16113, -16350,
-    -16561, -16756, -16951, -17122, -17281, -17448, -17614, -17791, -17978, -18152, -18312, -18470,
-    -18622, -18757, -18885, -19025, -19171, -19296, -19419, -19561, -19689, -19796, -19895, -19982,
-    -20062, -20143, -20226, -20292, -20352, -20409, -20450, -20495, -20534, -20554, -20588, -20617,
-    -20632, -20650, -20647, -20648, -20665, -20666, -20667, -20683, -20690, -20678, -20664, -20645,
-    -20603, -20565, -20530, -20489, -20474, -20456, -20412, -20356, -20272, -20165, -20069, -19985,
-    -19901, -19826, -19759, -19677, -19578, -19478, -19372, -19247, -19120, -18983, -18847, -18725,
-    -18581, -18429, -18288, -18130, -17965, -17802, -17627, -17439, -17247, -17057, -16856, -16655,
-    -16450, -16234, -16024, -15808, -15595, -15386, -15158, -14935, -14707, -14475, -14257, -14039,
-    -13822, -13598, -13357, -13127, -12888, -12628, -12379, -12124, -11852, -11589, -11318, -11037,
-    -10752, -10460, -10173, -9883, -9577, -9272, -8966, -8672, -8381, -8070, -7767, -7471,
-    -7169, -6876, -6582, -6283, -5988, -5693, -5415, -5164, -4889, -4540, -4158, -3800,
-    -3471, -3140, -2769, -2366, -1937, -1486, -1029, -551, -56, 441, 954, 1462,
-    1958, 2461, 2965, 3461, 3943, 4432, 4902, 5269, 5560, 5850, 6143, 6422,
-    6701, 6987, 7271, 7559, 7844, 8129, 8411, 8667, 8915, 9172, 9449, 9743,
-    10025, 10300, 10572, 10825, 11066, 11302, 11544, 11776, 12009, 12259, 12495, 12720,
-    12955, 13169, 13370, 13587, 13806, 14020, 14223, 14411, 14617, 14838, 15051, 15253,
-    15421, 15570, 15718, 15876, 16065, 16231, 16378, 16538, 16691, 16832, 16975, 17127,
-    17251, 17356, 17489, 17619, 17745, 17874, 17993, 18102, 18191, 18268, 18332, 18385,
-    18445, 18503, 18568, 18620, 18657, 18689, 18708, 18729, 18747, 18771, 18799, 18816,
-    18833, 18831, 18825, 18828, 18824, 18816, 18785, 18753, 18733, 18702, 18676, 18648,
-    18601, 18536, 18463, 18386, 18310, 18242, 18174, 18105, 18043, 17963, 17866, 17769,
-    17667, 17563, 17465, 17369, 17282, 17195, 17092, 16992, 16892, 16768, 16639, 16504,
-    16366, 16243, 16118, 15982, 15843, 15707, 15572, 15426, 15273, 15123, 14975, 14828,
-    14670, 14498, 14330, 14162, 13997, 13851, 13703, 13526, 13334, 13149, 12956, 12763,
-    12582, 12397, 12212, 12037, 11862, 11668, 11441, 11194, 10919, 10631, 10351, 10042,
-    9714, 9396, 9068, 8743, 8428, 8115, 7810, 7515, 7241, 6993, 6779, 6580,
-    6371, 6147, 5912, 5675, 5440, 5214, 5002, 4801, 4602, 4356, 4021, 3633,
-    3235, 2836, 2440, 2053, 1662, 1277, 910, 526, 122, -288, -713, -1123,
-    -1515, -1910, -2306, -2697, -3097, -3498, -3892, -4289, -4685, -5073, -5453, -5804,
-    -6112, -6383, -6633, -6874, -7109, -7348, -7583, -7809, -8028, -8245, -8475, -8716,
-    -8951, -9156, -9344, -9540, -9743, -9958, -10156, -10343, -10562, -10771, -10968, -11167,
-    -11342, -11516, -11701, -11893, -12092, -12278, -12463, -12649, -12832, -13009, -13169, -13317,
-    -13476, -13656, -13834, -14009, -14177, -14314, -14457, -14613, -14750, -14882, -15022, -15163,
-    -15305, -15455, -15591, -15700, -15820, -15954, -16087, -16212, -16337, -16471, -16600, -16728,
-    -16842, -16936, -17039, -17151, -17265, -17364, -17457, -17548, -17622, -17709, -17794, -17875,
-    -17965, -18044, -18127, -18188, -18245, -18316, -18387, -18476, -18557, -18638, -18719, -18792,
-    -18848, -18886, -18974, -19052, -19092, -19145, -19172, -19220, -19303, -19352, -19373, -19361,
-    -19362, -19366, -19367, -19404, -19426, -19450, -19458, -19442, -19426, -19390, -19356, -19316,
-    -19281, -19250, -19210, -19180, -19117, -19024, -18949, -18885, -18846, -18810, -18753, -18716,
-    -18705, -18708, -18707, -18697, -18656, -18581, -18512, -18412, -18310, -18193, -18015, -17839,
-    -17641, -17427, -17206, -16938, -16661, -16405, -16152, -15893, -15624, -15322, -15008, -14735,
-    -14466, -14175, -13880, -13555, -13220, -12918, -12616, -12294, -11970, -11619, -11259, -10922,
-    -10563, -10197, -9841, -9455, -9065, -8700, -8324, -7929, -7543, -7137, -6707, -6350,
-    -5965, -5492, -5048, -4510, -3891, -3337, -2730, -2055, -1364, -667, -11, 607,
-    1229, 1867, 2474, 3062, 3678, 4317, 4985, 5604, 6068, 6441, 6793, 7131,
-    7494, 7884, 8268, 8652, 9020, 9351, 9691, 10010, 10296, 10596, 10898, 11227,
-    11567, 11883, 12167, 12429, 12702, 12962, 13229, 13489, 13719, 13988, 14241, 14469,
-    14721, 14934, 15144, 15356, 15540, 15728, 15928, 16122, 16300, 16482, 16653, 16787,
-    16922, 17061, 17176, 17289, 17404, 17505, 17624, 17743, 17829, 17904, 17995, 18077,
-    18154, 18240, 18323, 18400, 18463, 18528, 18574, 18630, 18693, 18739, 18779, 18768,
-    18805, 18888, 18982, 19081, 19074, 19025, 19037, 19101, 19178, 19242, 19255, 19253,
-    19279, 19291, 19294, 19279, 19270, 19292, 19345, 19398, 19392, 19355, 19333, 19312,
-    19316, 19330, 19338, 19375, 19387, 19392, 19405, 19391, 19354, 19290, 19236, 19180,
-    19133, 19071, 18953, 18823, 18701, 18575, 18450, 18329, 18205, 18116, 18046, 17998,
-    17967, 17899, 17845, 17779, 17703, 17676, 17671, 17655, 17613, 17559, 17497, 17429,
-    17370, 17294, 17216, 17144, 17045, 16963, 16877, 16778, 16660, 16535, 16428, 16305,
-    16184, 16047, 15893, 15706, 15506, 15359, 15213, 15046, 14885, 14706, 14479, 14304,
-    14086, 13775, 13573, 13406, 13237, 13071, 12760, 12370, 12083, 11853, 11656, 11473,
-    11165, 10838, 10565, 10282, 9965, 9610, 9261, 8967, 8751, 8524, 8203, 7824,
-    7442, 7076, 6779, 6469, 6113, 5808, 5476, 5127, 4769, 4283, 3708, 3132,
-    2534, 1951, 1415, 843, 239, -366, -955, -1524, -2092, -2673, -3265, -3835,
-    -4386, -4922, -5461, -5928, -6270, -6589, -6939, -7290, -7601, -7912, -8218, -8491,
-    -8793, -9109, -9402, -9710, -10030, -10314, -10596, -10896, -11155, -11390, -11648, -11914,
-    -12188, -12440, -12677, -12913, -13133, -13353, -13570, -13802, -14040, -14246, -14435, -14609,
-    -14773, -14947, -15136, -15315, -15501, -15651, -15805, -16002, -16138, -16236, -16307, -16374,
-    -16548, -16785, -16971, -17083, -17136, -17152, -17236, -17376, -17471, -17546, -17626, -17724,
-    -17876, -17986, -17988, -17961, -17958, -18025, -18156, -18264, -18302, -18327, -18403, -18474,
-    -18522, -18569, -18624, -18743, -18895, -19020, -19138, -19231, -19288, -19355, -19407, -19452,
-    -19509, -19520, -19510, -19512, -19517, -19512, -19497, -19460, -19400, -19356, -19314, -19255,
-    -19199, -19153, -19123, -19082, -19034, -18974, -18891, -18834, -18776, -18697, -18649, -18611,
-    -18580, -18554, -18492, -18397, -18291, -18211, -18142, -18049, -17970, -17898, -17828, -17760,
-    -17671, -17557, -17421, -17293, -17183, -17085, -16987, -16870, -16752, -16652, -16543, -16401,
-    -16229, -16028, -15886, -15807, -15693, -15533, -15326, -15119, -15018, -14970, -14843, -14677,
-    -14471, -14210, -14051, -13937, -13731, -13525, -13327, -13157, -13057, -12891, -12612, -12295,
-    -12006, -11811, -11676, -11500, -11266, -11035, -10826, -10603, -10333, -10015, -9717, -9510,
-    -9322, -9101, -8852, -8560, -8283, -8025, -7743, -7448, -7149, -6870, -6609, -6351,
-    -6079, -5779, -5486, -5201, -4915, -4607, -4198, -3698, -3195, -2713, -2247, -1771,
-    -1282, -799, -313, 188, 702, 1208, 1721, 2228, 2717, 3213, 3719, 4224,
-    4709, 5211, 5716, 6122, 6456, 6766, 7054, 7373, 7700, 8020, 8350, 8647,
-    8952, 9280, 9586, 9867, 10135, 10403, 10689, 11017, 11346, 11630, 11918, 12174,
-    12391, 12661, 12972, 13298, 13620, 13844, 14005, 14197, 14417, 14686, 15000, 15236,
-    15397, 15580, 15752, 15896, 16010, 16054, 16105, 16241, 16434, 16615, 16718, 16750,
-    16795, 16902, 17021, 17119, 17242, 17384, 17563, 17754, 17868, 17933, 17987, 18045,
-    18149, 18273, 18395, 18505, 18594, 18661, 18703, 18726, 18731, 18743, 18762, 18785,
-    18828, 18845, 18836, 18825, 18774, 18720, 18690, 18644, 18586, 18533, 18487, 18426,
-    18355, 18280, 18206, 18129, 18032, 17927, 17817, 17697, 17591, 17497, 17418, 17333,
-    17202, 17044, 16890, 16758, 16645, 16528, 16394, 16254, 16144, 16052, 15926, 15735,
-    15532, 15388, 15283, 15190, 15063, 14872, 14703, 14581, 14470, 14360, 14191, 14002,
-    13876, 13802, 13747, 13626, 13407, 13200, 13076, 13003, 12955, 12879, 12744, 12605,
-    12500, 12402, 12265, 12079, 11907, 11784, 11735, 11748, 11692, 11525, 11335, 11194,
-    11118, 11025, 10879, 10749, 10681, 10656, 10573, 10416, 10256, 10122, 10033, 9976,
-    9898, 9802, 9699, 9600, 9503, 9406, 9301, 9173, 9035, 8922, 8843, 8767,
-    8648, 8494, 8359, 8251, 8128, 7982, 7821, 7657, 7511, 7367, 7209, 7051,
-    6901, 6739, 6547, 6357, 6159, 5942, 5753, 5556, 5342, 5104, 4781, 4420,
-    4054, 3672, 3313, 2952, 2601, 2281, 1922, 1530, 1131, 697, 253, -150,
-    -548, -961, -1365, -1802, -2285, -2770, -3264, -3757, -4239, -4727, -5197, -5574,
-    -5861, -6119, -6365, -6693, -7103, -7439, -7716, -7944, -8097, -8298, -8532, -8751,
-    -8994, -9225, -9469, -9731, -9954, -10117, -10224, -10343, -10544, -10806, -11036, -11199,
-    -11366, -11563, -11768, -11949, -12068, -12173, -12341, -12558, -12764, -12935, -13097, -13238,
-    -13364, -13513, -13651, -13775, -13904, -14027, -14170, -14313, -14426, -14520, -14579, -14644,
-    -14739, -14825, -14919, -15011, -15100, -15197, -15273, -15336, -15391, -15445, -15506, -15565,
-    -15631, -15687, -15758, -15829, -15867, -15927, -15978, -16002, -16057, -16094, -16101, -16128,
-    -16187, -16265, -16337, -16367, -16328, -16270, -16268, -16288, -16297, -16324, -16363, -16387,
-    -16411, -16393, -16316, -16272, -16258, -16272, -16332, -16370, -16377, -16357, -16327, -16307,
-    -16247, -16155, -16068, -16047, -16118, -16173, -16173, -16098, -15940, -15813, -15784, -15788,
-    -15753, -15681, -15603, -15555, -15528, -15436, -15268, -15091, -14980, -14961, -14932, -14815,
-    -14648, -14496, -14380, -14271, -14138, -13962, -13810, -13709, -13584, -13430, -13265, -13094,
-    -12937, -12776, -12608, -12429, -12251, -12097, -11927, -11730, -11544, -11368, -11168, -10955,
-    -10745, -10530, -10327, -10132, -9932, -9731, -9520, -9286, -9049, -8838, -8634, -8429,
-    -8241, -8053, -7880, -7715, -7547, -7393, -7231, -7066, -6928, -6820, -6684, -6537,
-    -6457, -6350, -6216, -6091, -5842, -5536, -5267, -5012, -4768, -4492, -4180, -3827,
-    -3486, -3199, -2883, -2573, -2284, -1997, -1743, -1458, -1152, -837, -517, -275,
-    -28, 290, 593, 865, 1104, 1284, 1474, 1715, 1992, 2310, 2574, 2760,
-    2962, 3151, 3356, 3586, 3752, 3925, 4149, 4382, 4599, 4750, 4829, 4912,
-    5064, 5236, 5366, 5467, 5565, 5707, 5880, 6019, 6109, 6187, 6319, 6472,
-    6614, 6747, 6852, 6963, 7085, 7210, 7357, 7488, 7602, 7727, 7861, 8010,
-    8165, 8286, 8385, 8520, 8673, 8806, 8944, 9091, 9210, 9322, 9498, 9693,
-    9862, 10030, 10157, 10264, 10414, 10572, 10712, 10840, 10990, 11151, 11316, 11505,
-    11651, 11742, 11854, 11998, 12144, 12287, 12422, 12558, 12710, 12840, 12943, 13057,
-    13182, 13346, 13507, 13626, 13764, 13900, 14030, 14164, 14275, 14391, 14516, 14663,
-    14798, 14897, 15042, 15205, 15350, 15500, 15601, 15652, 15710, 15811, 15956, 16107,
-    16209, 16258, 16320, 16422, 16541, 16627, 16654, 16700, 16822, 16973, 17095, 17147,
-    17148, 17178, 17283, 17404, 17480, 17525, 17575, 17646, 17719, 17761, 17777, 17814,
-    17883, 17926, 17945, 17946, 17916, 17891, 17877, 17855, 17803, 17748, 17729, 17661,
-    17562, 17509, 17425, 17332, 17284, 17228, 17179, 17116, 17018, 16928, 16837, 16767,
-    16740, 16723, 16706, 16670, 16592, 16494, 16412, 16343, 16286, 16221, 16128, 16037,
-    15961, 15877, 15767, 15639, 15516, 15388, 15247, 15101, 14929, 14759, 14606, 14453,
-    14285, 14059, 13812, 13590, 13373, 13166, 12942, 12704, 12475, 12236, 11971, 11679,
-    11388, 11095, 10802, 10548, 10276, 9989, 9724, 9430, 9109, 8762, 8373, 8022,
-    7711, 7403, 7118, 6797, 6380, 5952, 5476, 4898, 4313, 3723, 3105, 2508,
-    1930, 1321, 637, -61, -724, -1333, -1900, -2531, -3180, -3808, -4407, -4838,
-    -5216, -5668, -6092, -6495, -6893, -7265, -7640, -8022, -8392, -8745, -9101, -9455,
-    -9817, -10193, -10557, -10915, -11239, -11529, -11845, -12175, -12492, -12813, -13143, -13432,
-    -13706, -14002, -14244, -14484, -14787, -15060, -15299, -15529, -15724, -15931, -16179, -16409,
-    -16606, -16817, -17043, -17267, -17456, -17589, -17712, -17846, -18011, -18208, -18376, -18511,
-    -18638, -18741, -18823, -18915, -19014, -19100, -19181, -19255, -19327, -19391, -19433, -19469,
-    -19490, -19514, -19573, -19628, -19657, -19670, -19668, -19646, -19633, -19628, -19591, -19550,
-    -19508, -19454, -19448, -19459, -19436, -19394, -19314, -19237, -19230, -19243, -19217, -19167,
-    -19120, -19116, -19138, -19093, -18994, -18912, -18855, -18822, -18777, -18671, -18552, -18482,
-    -18407, -18296, -18147, -17947, -17783, -17671, -17528, -17360, -17184, -17021, -16886, -16734,
-    -16555, -16355, -16151, -15965, -15787, -15610, -15415, -15211, -15009, -14802, -14636, -14468,
-    -14245, -14021, -13790, -13566, -13410, -13255, -13049, -12824, -12566, -12310, -12123, -11942,
-    -11703, -11449, -11229, -11057, -10882, -10655, -10388, -10131, -9936, -9785, -9597, -9340,
-    -9056, -8825, -8658, -8482, -8276, -8029, -7767, -7573, -7406, -7208, -6992, -6768,
-    -6572, -6383, -6164, -5941, -5690, -5403, -5135, -4870, -4579, -4279, -3973, -3681,
-    -3423, -3144, -2827, -2532, -2254, -2015, -1838, -1632, -1367, -1094, -813, -549,
-    -367, -209, -15, 187, 411, 596, 707, 874, 1126, 1384, 1609, 1742,
-    1809, 1917, 2090, 2282, 2457, 2586, 2685, 2830, 3008, 3145, 3253, 3341,
-    3429, 3569, 3744, 3880, 3959, 4027, 4111, 4226, 4347, 4437, 4541, 4658,
-    4770, 4888, 4969, 5043, 5136, 5214, 5297, 5392, 5501, 5624, 5719, 5798,
-    5884, 5956, 6023, 6109, 6195, 6292, 6421, 6536, 6622, 6708, 6791, 6876,
-    6978, 7097, 7224, 7337, 7437, 7543, 7660, 7775, 7885, 7972, 8041, 8169,
-    8334, 8440, 8516, 8579, 8645, 8763, 8911, 9044, 9161, 9281, 9426, 9603,
-    9784, 9932, 10072, 10226, 10411, 10654, 10868, 11015, 11202, 11422, 11664, 11947,
-    12176, 12358, 12585, 12811, 13029, 13268, 13464, 13666, 13924, 14163, 14389, 14625,
-    14829, 15018, 15237, 15475, 15683, 15859, 16053, 16279, 16509, 16689, 16845, 17023,
-    17190, 17373, 17579, 17727, 17854, 18023, 18190, 18317, 18427, 18532, 18612, 18692,
-    18793, 18891, 18985, 19071, 19131, 19187, 19245, 19273, 19271, 19269, 19287, 19330,
-    19350, 19319, 19283, 19254, 19211, 19148, 19055, 18949, 18868, 18809, 18741, 18656,
-    18556, 18419, 18265, 18109, 17941, 17790, 17657, 17518, 17363, 17173, 16951, 16731,
-    16529, 16319, 16091, 15871, 15646, 15424, 15224, 14990, 14698, 14384, 14101, 13867,
-    13643, 13399, 13121, 12813, 12518, 12254, 11981, 11656, 11317, 11011, 10735, 10487,
-    10238, 9933, 9583, 9266, 8996, 8757, 8528, 8241, 7898, 7567, 7264, 6991,
-    6704, 6366, 6015, 5642, 5242, 4838, 4400, 3907, 3418, 2990, 2604, 2229,
-    1842, 1434, 1042, 669, 273, -147, -564, -959, -1331, -1687, -2043, -2406,
-    -2766, -3124, -3466, -3776, -4089, -4405, -4702, -4975, -5203, -5400, -5627, -5876,
-    -6111, -6336, -6543, -6737, -6952, -7175, -7392, -7623, -7857, -8058, -8243, -8436,
-    -8625, -8807, -9006, -9210, -9397, -9556, -9692, -9820, -9947, -10073, -10203, -10340,
-    -10485, -10627, -10737, -10808, -10865, -10934, -11031, -11140, -11243, -11350, -11461, -11546,
-    -11615, -11689, -11752, -11806, -11881, -11965, -12037, -12121, -12213, -12284, -12353, -12446,
-    -12561, -12685, -12807, -12909, -12986, -13040, -13077, -13109, -13150, -13211, -13289, -13374,
-    -13476, -13583, -13650, -13664, -13664, -13706, -13836, -14059, -14342, -14695, -15145, -15673,
-    -16245, -16818, -17366, -17954, -18607, -19163, -19492, -19682, -19827, -19890, -19845, -19708,
-    -19473, -19161, -18830, -18488, -18121, -17751, -17384, -17007, -16652, -16344, -16038, -15685,
-    -15309, -14977, -14707, -14442, -14142, -13829, -13505, -13180, -12888, -12607, -12307, -12024,
-    -11781, -11549, -11319, -11075, -10803, -10543, -10321, -10132, -9960, -9769, -9543, -9333,
-    -9149, -8949, -8736, -8542, -8376, -8231, -8093, -7941, -7750, -7516, -7266, -7026,
-    -6800, -6599, -6417, -6221, -6015, -5805, -5554, -5263, -4987, -4720, -4424, -4097,
-    -3765, -3459, -3183, -2901, -2602, -2304, -1999, -1688, -1387, -1073, -732, -394,
-    -77, 205, 474, 791, 1158, 1499, 1783, 2030, 2281, 2562, 2849, 3110,
-    3378, 3662, 3952, 4258, 4558, 4828, 5101, 5401, 5720, 6047, 6348, 6609,
-    6850, 7082, 7329, 7586, 7814, 8046, 8320, 8585, 8826, 9049, 9229, 9411,
-    9639, 9852, 10063, 10319, 10580, 10841, 11117, 11372, 11646, 11978, 12301, 12577,
-    12807, 12986, 13166, 13392, 13632, 13841, 13999, 14154, 14349, 14529, 14653, 14761,
-    14860, 14969, 15108, 15200, 15218, 15234, 15261, 15291, 15325, 15315, 15253, 15187,
-    15132, 15093, 15030, 14895, 14733, 14576, 14405, 14238, 14037, 13785, 13585, 13317,
-    12541, 10945, 8571, 5739, 2915, 442, -1535, -2957, -3857, -4315, -4375, -4141,
-    -3773, -3384, -3029, -2688, -2340, -2044, -1851, -1758, -1743, -1742, -1719, -1706,
-    -1694, -1657, -1614, -1555, -1497, -1500, -1540, -1562, -1578, -1601, -1645, -1723,
-    -1791, -1834, -1887, -1952, -2022, -2094, -2142, -2177, -2224, -2267, -2310, -2359,
-    -2387, -2384, -2362, -2319, -2284, -2271, -2257, -2250, -2240, -2172, -2069, -1991,
-    -1924, -1870, -1859, -1862, -1854, -1849, -1830, -1774, -1705, -1655, -1655, -1695,
-    -1718, -1706, -1683, -1646, -1613, -1616, -1649, -1674, -1675, -1665, -1669, -1683,
-    -1668, -1630, -1604, -1591, -1576, -1540, -1478, -1417, -1366, -1317, -1282, -1263,
-    -1243, -1226, -1208, -1191, -1201, -1232, -1261, -1301, -1352, -1406, -1493, -1626,
-    -1776, -1911, -2010, -2090, -2185, -2279, -2349, -2418, -2507, -2642, -2845, -3064,
-    -3236, -3372, -3491, -3588, -3661, -3695, -3688, -3682, -3683, -3649, -3561, -3426,
-    -3259, -3100, -2978, -2856, -2673, -2415, -2127, -1851, -1568, -1236, -854, -454,
-    -79, 240, 527, 813, 1083, 1316, 1534, 1772, 2027, 2280, 2507, 2699,
-    2875, 3052, 3234, 3394, 3506, 3567, 3590, 3583, 3549, 3508, 3499, 3511,
-    3365, 2764, 1521, -303, -2477, -4740, -6860, -8653, -10013, -10906, -11354, -11425,
-    -11205, -10749, -10105, -9355, -8571, -7788, -7026, -6311, -5648, -5035, -4496, -4043,
-    -3629, -3220, -2851, -2541, -2237, -1910, -1596, -1320, -1059, -789, -501, -195,
-    93, 310, 462, 613, 769, 884, 966, 1036, 1096, 1173, 1284, 1390,
-    1472, 1549, 1649, 1797, 1972, 2123, 2257, 2411, 2601, 2835, 3100, 3365,
-    3629, 3908, 4194, 4466, 4723, 4977, 5230, 5466, 5669, 5837, 5973, 6090,
-    6218, 6384, 6599, 6831, 7040, 7223, 7369, 7462, 7521, 7568, 7600, 7613,
-    7617, 7630, 7663, 7694, 7708, 7724, 7755, 7804, 7868, 7925, 7985, 8070,
-    8155, 8225, 8291, 8362, 8459, 8580, 8680, 8753, 8821, 8867, 8896, 8929,
-    8952, 8967, 8985, 9002, 9010, 8979, 8906, 8827, 8723, 8604, 8532, 8460,
-    8318, 8178, 8081, 7974, 7859, 7729, 7564, 7433, 7357, 7271, 7164, 7037,
-    6880, 6748, 6686, 6660, 6664, 6705, 6758, 6819, 6900, 7000, 7121, 7267,
-    7432, 7611, 7794, 7971, 8122, 8224, 8318, 8470, 8649, 8790, 8890, 8957,
-    8968, 8912, 8791, 8619, 8436, 8278, 8142, 8010, 7872, 7707, 7493, 7248,
-    6959, 6465, 5524, 4038, 2091, -173, -2572, -4894, -7018, -8880, -10389, -11499,
-    -12252, -12701, -12873, -12838, -12677, -12404, -12020, -11586, -11171, -10777, -10383, -10024,
-    -9713, -9426, -9150, -8893, -8673, -8479, -8278, -8060, -7887, -7817, -7821, -7855,
-    -7879, -7878, -7893, -7912, -7904, -7899, -7942, -8017, -8107, -8250, -8431, -8629,
-    -8855, -9070, -9268, -9472, -9671, -9850, -10015, -10174, -10302, -10402, -10488, -10519,
-    -10492, -10426, -10338, -10263, -10225, -10177, -10061, -9898, -9703, -9475, -9255, -9042,
-    -8807, -8540, -8244, -7932, -7649, -7450, -7330, -7263, -7229, -7182, -7092, -6950,
-    -6769, -6576, -6394, -6241, -6114, -6028, -5990, -5982, -6007, -6034, -6048, -6050,
-    -6019, -6002, -6023, -6060, -6083, -6073, -6062, -6034, -5970, -5896, -5805, -5701,
-    -5582, -5484, -5385, -5188, -4980, -4802, -4615, -4461, -4297, -4108, -3895, -3653,
-    -3448, -3280, -3180, -3158, -3143, -3090, -2958, -2768, -2546, -2288, -2043, -1831,
-    -1658, -1521, -1399, -1280, -1158, -1042, -913, -762, -596, -431, -252, -37,
-    183, 413, 664, 963, 1310, 1612, 1922, 2269, 2624, 3024, 3395, 3740,
-    4119, 4459, 4756, 5037, 5305, 5582, 5907, 6247, 6523, 6751, 6882, 6884,
-    6839, 6730, 6484, 5979, 5080, 3809, 2283, 614, -1131, -2852, -4432, -5772,
-    -6817, -7605, -8135, -8416, -8509, -8409, -8135, -7729, -7244, -6760, -6279, -5780,
-    -5275, -4787, -4305, -3786, -3238, -2714, -2230, -1761, -1283, -803, -351, 57,
-    438, 800, 1169, 1572, 1982, 2376, 2712, 2900, 2911, 2867, 2896, 3003,
-    3182, 3402, 3572, 3663, 3709, 3733, 3733, 3701, 3653, 3605, 3554, 3506,
-    3475, 3449, 3413, 3379, 3365, 3377, 3416, 3481, 3587, 3742, 3932, 4157,
-    4408, 4659, 4937, 5284, 5654, 5981, 6272, 6549, 6841, 7202, 7628, 8034,
-    8354, 8633, 8940, 9201, 9283, 9216, 9161, 9217, 9370, 9563, 9734, 9854,
-    9934, 9998, 10022, 9948, 9774, 9560, 9334, 9102, 8906, 8746, 8566, 8385,
-    8244, 8112, 7970, 7839, 7702, 7558, 7468, 7459, 7493, 7519, 7539, 7586,
-    7648, 7694, 7735, 7772, 7795, 7832, 7905, 8020, 8174, 8327, 8485, 8654,
-    8700, 8523, 8275, 8137, 8130, 8217, 8354, 8474, 8547, 8575, 8564, 8515,
-    8431, 8341, 8259, 8153, 8044, 7952, 7829, 7706, 7655, 7626, 7565, 7505,
-    7435, 7341, 7270, 7229, 7202, 7191, 7180, 7168, 7176, 7182, 7166, 7133,
-    7080, 7016, 6899, 6603, 6036, 5170, 3993, 2553, 878, -1082, -3202, -5137,
-    -6704, -7959, -8960, -9716, -10265, -10656, -10930, -11115, -11231, -11309, -11355, -11335,
-    -11251, -11131, -10975, -10801, -10640, -10486, -10331, -10188, -10054, -9926, -9802, -9662,
-    -9508, -9365, -9229, -9095, -8978, -8840, -8636, -8435, -8326, -8263, -8176, -8084,
-    -7998, -7889, -7776, -7658, -7539, -7568, -7878, -8293, -8536, -8577, -8537, -8498,
-    -8499, -8535, -8588, -8677, -8828, -9032, -9264, -9473, -9624, -9739, -9831, -9896,
-    -9945, -9967, -9935, -9871, -9796, -9709, -9609, -9467, -9253, -9002, -8755, -8509,
-    -8258, -7996, -7698, -7362, -7038, -6757, -6474, -6151, -5823, -5506, -5194, -4900,
-    -4613, -4388, -4398, -4630, -4794, -4735, -4560, -4377, -4227, -4138, -4093, -4078,
-    -4120, -4241, -4424, -4609, -4755, -4878, -4974, -5019, -5052, -5107, -5147, -5158,
-    -5185, -5223, -5206, -5110, -4974, -4819, -4634, -4413, -4154, -3841, -3491, -3138,
-    -2782, -2442, -2142, -1843, -1501, -1126, -715, -272, 170, 584, 847, 854,
-    812, 1006, 1397, 1811, 2204, 2553, 2843, 3093, 3288, 3412, 3497, 3566,
-    3642, 3745, 3831, 3888, 3959, 4047, 4135, 4225, 4318, 4412, 4503, 4626,
-    4820, 5035, 5194, 5285, 5222, 4892, 4307, 3500, 2499, 1354, 93, -1182,
-    -2341, -3365, -4243, -4943, -5471, -5805, -5982, -6243, -6629, -6786, -6580, -6183,
-    -5686, -5114, -4564, -4062, -3580, -3142, -2828, -2577, -2306, -2017, -1725, -1439,
-    -1134, -864, -641, -438, -271, -125, 47, 230, 429, 642, 859, 1099,
-    1366, 1627, 1884, 2152, 2447, 2745, 2961, 3136, 3365, 3646, 3933, 4236,
-    4538, 4817, 5061, 5205, 5036, 4738, 4706, 4876, 5097, 5301, 5469, 5561,
-    5637, 5709, 5736, 5690, 5689, 5733, 5752, 5730, 5727, 5781, 5869, 5973,
-    6073, 6136, 6197, 6295, 6455, 6678, 6915, 7190, 7477, 7738, 8023, 8319,
-    8600, 8866, 9091, 9262, 9423, 9621, 9849, 10080, 10282, 10447, 10589, 10675,
-    10577, 10105, 9746, 9726, 9824, 9948, 9987, 9917, 9771, 9592, 9367, 9047,
-    8682, 8365, 8103, 7876, 7670, 7498, 7325, 7173, 7039, 6921, 6832, 6745,
-    6663, 6639, 6681, 6760, 6866, 6967, 7068, 7252, 7485, 7715, 7913, 8027,
-    8096, 8192, 8366, 8606, 8889, 9170, 9424, 9636, 9740, 9450, 8905, 8750,
-    8894, 9092, 9224, 9247, 9180, 9048, 8867, 8662, 8413, 8157, 7911, 7639,
-    7349, 7059, 6782, 6478, 6071, 5511, 4754, 3818, 2689, 1365, -43, -1477,
-    -2912, -4293, -5625, -6833, -7852, -8698, -9394, -9955, -10444, -10829, -11025, -11075,
-    -11012, -10832, -10584, -10249, -9869, -9624, -9854, -10062, -9792, -9364, -8947, -8632,
-    -8354, -8151, -8073, -8088, -8184, -8326, -8425, -8492, -8563, -8684, -8834, -8995,
-    -9161, -9328, -9498, -9632, -9715, -9778, -9843, -9845, -9815, -9797, -9776, -9796,
-    -9765, -9650, -9502, -9352, -9282, -9301, -9309, -9218, -9047, -8827, -8593, -8377,
-    -8170, -8004, -8158, -8667, -8822, -8588, -8323, -8093, -7884, -7689, -7573, -7542,
-    -7601, -7672, -7729, -7769, -7825, -7845, -7825, -7759, -7633, -7502, -7423, -7410,
-    -7344, -7217, -7113, -6994, -6811, -6605, -6379, -6172, -5971, -5743, -5474, -5169,
-    -4870, -4689, -4593, -4438, -4225, -3969, -3698, -3429, -3175, -2950, -2846, -3257,
-    -3770, -3769, -3576, -3401, -3218, -3010, -2862, -2831, -2902, -3021, -3118, -3136,
-    -3098, -3049, -2986, -2922, -2851, -2713, -2557, -2463, -2368, -2198, -1982, -1769,
-    -1499, -1137, -733, -338, 50, 469, 894, 1342, 1836, 2289, 2582, 2842,
-    3217, 3636, 4060, 4512, 4956, 5303, 5607, 5676, 5274, 5148, 5417, 5701,
-    5987, 6309, 6616, 6761, 6732, 6566, 6268, 5741, 5004, 4067, 3010, 1928,
-    815, -299, -1420, -2569, -3712, -4740, -5601, -6301, -6817, -7106, -7241, -7274,
-    -7266, -7156, -6931, -6594, -6150, -5592, -5074, -4662, -4127, -3470, -2825, -2170,
-    -1445, -768, -213, 275, 362, 201, 517, 992, 1383, 1770, 2141, 2440,
-    2576, 2585, 2569, 2557, 2528, 2485, 2425, 2388, 2387, 2407, 2440, 2450,
-    2435, 2403, 2432, 2472, 2488, 2579, 2768, 3020, 3263, 3470, 3681, 3903,
-    4178, 4489, 4842, 5046, 5249, 5666, 6095, 6457, 6829, 7249, 7581, 7866,
-    8059, 7691, 7444, 7693, 7985, 8243, 8537, 8809, 8984, 9041, 9041, 9018,
-    8962, 8878, 8784, 8681, 8596, 8554, 8559, 8564, 8555, 8493, 8385, 8290,
-    8175, 8071, 8097, 8211, 8339, 8394, 8428, 8460, 8517, 8629, 8793, 8903,
-    8804, 8809, 8994, 9140, 9242, 9400, 9552, 9595, 9632, 9387, 8647, 8439,
-    8619, 8788, 8908, 9012, 9035, 8971, 8861, 8705, 8501, 8294, 8151, 8056,
-    7913, 7788, 7715, 7658, 7578, 7511, 7409, 7306, 7195, 7066, 6996, 7061,
-    7179, 7255, 7288, 7335, 7398, 7502, 7629, 7751, 7687, 7542, 7637, 7839,
-    7965, 8060, 8223, 8292, 8259, 8149, 7437, 6445, 5955, 5433, 4703, 3862,
-    2857, 1692, 409, -929, -2319, -3762, -5130, -6332, -7402, -8398, -9255, -9975,
-    -10648, -11219, -11657, -12052, -12347, -12549, -12657, -12607, -12407, -12146, -11920, -11690,
-    -11417, -11090, -10640, -10175, -9786, -9634, -9438, -9049, -8679, -8397, -8127, -7823,
-    -7611, -7457, -7501, -8231, -8597, -8440, -8355, -8258, -8183, -8190, -8316, -8511,
-    -8721, -8998, -9317, -9575, -9746, -9949, -10167, -10327, -10480, -10648, -10767, -10849,
-    -10962, -11040, -11070, -11026, -10850, -10590, -10366, -10202, -10036, -9837, -9582, -9219,
-    -8872, -8623, -8497, -8192, -7752, -7344, -6983, -6615, -6249, -5942, -5700, -5861,
-    -6425, -6220, -5849, -5567, -5268, -5056, -4968, -5017, -5039, -5084, -5221, -5362,
-    -5447, -5471, -5578, -5657, -5687, -5754, -5813, -5846, -5899, -5992, -6022, -5971,
-    -5835, -5615, -5406, -5237, -5082, -4880, -4620, -4263, -3842, -3497, -3323, -3141,
-    -2761, -2304, -1874, -1495, -1115, -735, -420, -252, -672, -927, -426, -35,
-    355, 724, 1019, 1181, 1283, 1402, 1463, 1480, 1531, 1635, 1720, 1771,
-    1875, 1952, 1986, 2019, 2116, 2177, 2247, 2396, 2631, 2949, 3292, 3584,
-    3822, 4049, 4331, 4662, 5097, 5469, 5696, 5712, 5711, 5720, 5603, 5289,
-    4807, 4234, 3659, 2957, 1911, 252, -704, -1237, -1851, -2310, -2783, -3265,
-    -3803, -4300, -4760, -5215, -5555, -5756, -5819, -5827, -5783, -5652, -5524, -5358,
-    -5157, -4899, -4687, -4419, -4062, -3595, -3025, -2452, -1918, -1476, -1066, -642,
-    -144, 426, 910, 1268, 1523, 1939, 2464, 2992, 3368, 3640, 3948, 4277,
-    4497, 4116, 3508, 3831, 4135, 4421, 4692, 4767, 4772, 4756, 4751, 4684,
-    4559, 4454, 4378, 4381, 4403, 4457, 4510, 4501, 4484, 4486, 4489, 4474,
-    4519, 4689, 4999, 5403, 5744, 6023, 6249, 6497, 6796, 7214, 7635, 7974,
-    8170, 8329, 8655, 9066, 9436, 9634, 9794, 10065, 10299, 10316, 9520, 9092,
-    9316, 9451, 9739, 9868, 9825, 9747, 9655, 9472, 9188, 8874, 8579, 8396,
-    8280, 8157, 8040, 7852, 7618, 7396, 7246, 7054, 6915, 6866, 6897, 7038,
-    7211, 7321, 7388, 7488, 7603, 7785, 8082, 8306, 8427, 8440, 8567, 8877,
-    9251, 9470, 9557, 9697, 9952, 10074, 9737, 8879, 8808, 9002, 9197, 9395,
-    9337, 9219, 9090, 8902, 8652, 8376, 8075, 7749, 7525, 7333, 7131, 6947,
-    6724, 6489, 6316, 6142, 5865, 5653, 5522, 5421, 5352, 5145, 4718, 4155,
-    3568, 2876, 2200, 1499, 695, -262, -1310, -2158, -2851, -3490, -4289, -5072,
-    -5706, -6246, -6925, -8181, -9319, -9583, -9728, -9750, -9873, -10092, -10257, -10411,
-    -10622, -10846, -11071, -11290, -11446, -11442, -11440, -11450, -11444, -11450, -11488, -11479,
-    -11487, -11561, -11542, -11430, -11252, -10968, -10721, -10555, -10366, -10149, -9988, -9771,
-    -9572, -9445, -9479, -9429, -9123, -8754, -8527, -8438, -8316, -8143, -8033, -8267,
-    -9135, -9347, -9059, -8769, -8515, -8442, -8409, -8428, -8509, -8681, -8862, -9040,
-    -9186, -9230, -9145, -9088, -9088, -9067, -9063, -9099, -9039, -9013, -9032, -8899,
-    -8655, -8375, -8097, -7884, -7723, -7514, -7287, -7071, -6765, -6428, -6219, -6177,
-    -5931, -5518, -5130, -4895, -4659, -4417, -4114, -3893, -4242, -4976, -4802, -4459,
-    -4123, -3898, -3749, -3652, -3618, -3657, -3782, -3928, -4027, -4066, -4001, -3849,
-    -3792, -3767, -3653, -3581, -3563, -3466, -3427, -3386, -3115, -2719, -2337, -1955,
-    -1625, -1346, -1003, -622, -213, 270, 742, 969, 1147, 1584, 2077, 2526,
-    2925, 3291, 3617, 3953, 4106, 3513, 3145, 3625, 4035, 4392, 4694, 4936,
-    5036, 5049, 5038, 4977, 4909, 4928, 4942, 5039, 5139, 5006, 4825, 4613,
-    4203, 3679, 3175, 2508, 1856, 1425, 1001, 471, -73, -639, -1196, -1668,
-    -2115, -2487, -2742, -2956, -3373, -3567, -3530, -3479, -3362, -3270, -3231, -3055,
-    -2839, -2899, -3611, -3535, -2995, -2585, -2203, -1775, -1476, -1324, -1198, -1108,
-    -1083, -1002, -790, -578, -317, -96, 0, 177, 338, 369, 438, 598,
-    658, 882, 1295, 1659, 1931, 2227, 2513, 2756, 3045, 3307, 3658, 4063,
-    4360, 4516, 4885, 5265, 5618, 6017, 6273, 6518, 6837, 7078, 6769, 6098,
-    6432, 6836, 7135, 7427, 7713, 7779, 7768, 7799, 7735, 7580, 7546, 7562,
-    7538, 7577, 7575, 7545, 7558, 7495, 7370, 7298, 7231, 7133, 7258, 7501,
-    7653, 7752, 7907, 8007, 8077, 8208, 8335, 8564, 8786, 8813, 8861, 9050,
-    9204, 9387, 9572, 9614, 9718, 9806, 9833, 9055, 8539, 8907, 9098, 9204,
-    9313, 9335, 9240, 9162, 9078, 8792, 8468, 8327, 8186, 8067, 8030, 7972,
-    7927, 7833, 7659, 7470, 7363, 7242, 7204, 7339, 7490, 7584, 7705, 7839,
-    7842, 7851, 7900, 7955, 8087, 8179, 8118, 8206, 8321, 8394, 8493, 8530,
-    8480, 8486, 8500, 8264, 7264, 7094, 7337, 7359, 7325, 7236, 6953, 6506,
-    6047, 5426, 4543, 3725, 2962, 2100, 1201, 240, -739, -1690, -2684, -3667,
-    -4608, -5515, -6401, -7100, -7667, -8182, -8657, -9000, -9351, -9788, -10067, -10272,
-    -10375, -10332, -10407, -10502, -10410, -10288, -10130, -9958, -9847, -9782, -9703, -9554,
-    -9963, -10636, -10309, -9961, -9765, -9591, -9507, -9550, -9571, -9556, -9708, -9960,
-    -10005, -10040, -10136, -10208, -10332, -10405, -10479, -10618, -10719, -10765, -10830, -10822,
-    -10686, -10570, -10484, -10337, -10111, -10001, -9870, -9586, -9298, -9019, -8711, -8597,
-    -8445, -8160, -7870, -7585, -7271, -7017, -6843, -6665, -6524, -7166, -7460, -7030,
-    -6763, -6539, -6349, -6287, -6339, -6329, -6342, -6552, -6725, -6733, -6815, -6866,
-    -6909, -7029, -7050, -7089, -7161, -7196, -7210, -7210, -7072, -6882, -6777, -6686,
-    -6452, -6196, -6085, -5837, -5503, -5202, -4890, -4553, -4383, -4112, -3706, -3303,
-    -2968, -2560, -2180, -1843, -1497, -1456, -2094, -1923, -1422, -1085, -718, -421,
-    -272, -205, -77, -22, -114, -39, 96, 141, 238, 265, 278, 389,
-    506, 566, 636, 702, 780, 1024, 1286, 1505, 1780, 2149, 2429, 2601,
-    2928, 3283, 3615, 4016, 4399, 4630, 4952, 5364, 5710, 5948, 6255, 6415,
-    6501, 6484, 5864, 4986, 4893, 4740, 4432, 4101, 3611, 2971, 2324, 1715,
-    987, 180, -481, -1095, -1684, -2181, -2758, -3219, -3614, -3987, -4381, -4704,
-    -4940, -5006, -4889, -4815, -4756, -4564, -4318, -4140, -3949, -3615, -3200, -2806,
-    -2432, -2196, -1938, -1505, -1025, -559, -113, 312, 716, 1134, 1382, 929,
-    846, 1363, 1723, 2076, 2448, 2662, 2806, 2952, 3035, 2980, 2939, 2998,
-    3074, 3193, 3307, 3326, 3441, 3533, 3637, 3692, 3768, 3861, 4099, 4425,
-    4660, 4934, 5309, 5601, 5783, 5943, 6218, 6577, 6904, 7207, 7366, 7636,
-    7949, 8244, 8544, 8775, 8943, 9159, 9358, 9176, 8426, 8416, 8658, 8770,
-    8902, 8976, 8913, 8783, 8677, 8467, 8188, 7996, 7861, 7786, 7728, 7582,
-    7412, 7282, 7178, 7045, 6896, 6807, 6768, 6890, 7028, 7093, 7245, 7446,
-    7559, 7596, 7691, 7932, 8233, 8473, 8603, 8639, 8855, 9100, 9370, 9619,
-    9784, 9918, 10059, 10122, 9601, 8990, 9193, 9406, 9497, 9550, 9500, 9331,
-    9136, 8978, 8679, 8358, 8106, 7861, 7643, 7425, 7163, 6942, 6730, 6552,
-    6275, 6045, 5849, 5736, 5806, 5863, 5838, 5894, 5942, 5892, 5769, 5716,
-    5734, 5748, 5638, 5288, 4897, 4633, 4302, 3898, 3420, 2850, 2277, 1720,
-    989, -459, -1590, -2107, -2691, -3345, -3982, -4645, -5369, -6035, -6770, -7647,
-    -8403, -8991, -9525, -9975, -10406, -10840, -11224, -11558, -11871, -12250, -12513, -12726,
-    -12804, -12696, -12649, -12630, -12455, -12330, -12291, -12205, -12021, -11744, -11412, -11173,
-    -11141, -10900, -10527, -10203, -9932, -9703, -9539, -9365, -9140, -9275, -9968, -9932,
-    -9548, -9314, -9194, -9095, -9060, -9094, -9043, -9152, -9341, -9356, -9339, -9379,
-    -9390, -9454, -9521, -9537, -9476, -9496, -9526, -9505, -9484, -9311, -9022, -8842,
-    -8637, -8367, -8208, -8086, -7856, -7641, -7330, -6967, -6869, -6914, -6638, -6332,
-    -6080, -5842, -5661, -5525, -5386, -5239, -5700, -6266, -6007, -5655, -5456, -5355,
-    -5285, -5297, -5295, -5266, -5449, -5575, -5512, -5467, -5467, -5462, -5477, -5466,
-    -5394, -5281, -5234, -5099, -4942, -4726, -4370, -3978, -3670, -3291, -2922, -2672,
-    -2380, -2050, -1688, -1163, -677, -476, -200, 304, 734, 1099, 1447, 1709,
-    2018, 2330, 2504, 1968, 1765, 2114, 2393, 2588, 2757, 2904, 2978, 3063,
-    3049, 2859, 2809, 2893, 2922, 2969, 3040, 3109, 3173, 3246, 3256, 3235,
-    3247, 3244, 3347, 3501, 3587, 3555, 3507, 3355, 3087, 2879, 2652, 2551,
-    2514, 2320, 1865, 1555, 1363, 1126, 927, 693, 398, 178, -31, -576,
-    -1581, -1888, -1875, -1931, -2006, -2126, -2258, -2393, -2513, -2712, -2932, -2960,
-    -2961, -3043, -3132, -3198, -3195, -3135, -3043, -3008, -2914, -2806, -2636, -2284,
-    -1902, -1525, -1146, -785, -509, -221, 135, 516, 1058, 1606, 1967, 2220,
-    2650, 3107, 3565, 4053, 4439, 4773, 5142, 5463, 5218, 4964, 5332, 5723,
-    6020, 6301, 6484, 6625, 6748, 6788, 6746, 6727, 6825, 6892, 6902, 6889,
-    6858, 6863, 6878, 6865, 6835, 6863, 6819, 6898, 7086, 7220, 7317, 7397,
-    7460, 7499, 7644, 7756, 7920, 8186, 8391, 8378, 8393, 8557, 8726, 8959,
-    9188, 9280, 9353, 9440, 9333, 8644, 8405, 8589, 8719, 8823, 8909, 8873,
-    8861, 8845, 8721, 8590, 8555, 8589, 8569, 8463, 8340, 8221, 8157, 8118,
-    8048, 8026, 8006, 7905, 7988, 8126, 8240, 8345, 8427, 8458, 8489, 8606,
-    8649, 8780, 8936, 9004, 8920, 8938, 8980, 8997, 9081, 9136, 9084, 9057,
-    9021, 8583, 7801, 7676, 7712, 7663, 7648, 7574, 7394, 7259, 7059, 6725,
-    6383, 6119, 5830, 5458, 5025, 4552, 4042, 3519, 2981, 2353, 1746, 1088,
-    440, -20, -468, -955, -1502, -2092, -2720, -3287, -3777, -4229, -4619, -4985,
-    -5482, -5974, -6296, -6591, -6828, -7057, -7327, -7597, -7821, -8127, -8985, -9736,
-    -9821, -9912, -10090, -10212, -10412, -10644, -10790, -11012, -11341, -11590, -11724, -11882,
-    -12097, -12284, -12420, -12533, -12600, -12619, -12721, -12749, -12825, -12812, -12655, -12408,
-    -12138, -11938, -11747, -11582, -11363, -11073, -10707, -10352, -9981, -9751, -9421, -9040,
-    -8659, -8284, -8011, -7760, -7455, -7181, -7167, -7689, -7776, -7452, -7226, -7054,
-    -6859, -6826, -6823, -6775, -6888, -7087, -7180, -7211, -7292, -7459, -7633, -7810,
-    -7999, -8113, -8187, -8311, -8390, -8476, -8431, -8292, -8128, -8021, -7875, -7750,
-    -7658, -7484, -7245, -6940, -6629, -6362, -6196, -5885, -5520, -5100, -4736, -4472,
-    -4159, -3770, -3432, -3501, -3848, -3506, -2989, -2597, -2241, -1948, -1793, -1605,
-    -1401, -1373, -1342, -1176, -1038, -970, -930, -885, -833, -802, -687, -583,
-    -531, -474, -372, -147, 139, 364, 535, 752, 880, 1022, 1282, 1603,
-    1940, 2277, 2495, 2676, 2958, 3279, 3689, 3988, 4203, 4520, 4869, 5060,
-    4670, 4363, 4665, 4911, 5059, 5146, 5129, 4971, 4854, 4651, 4247, 3892,
-    3585, 3203, 2770, 2323, 1860, 1394, 933, 549, 112, -359, -771, -1092,
-    -1292, -1428, -1616, -1742, -1846, -2035, -2165, -2193, -2134, -2046, -1991, -2050,
-    -1998, -1875, -1678, -1479, -1424, -1366, -1152, -937, -1036, -1640, -1707, -1376,
-    -1133, -910, -709, -546, -449, -283, -249, -307, -210, -76, -8, 65,
-    195, 328, 471, 642, 856, 1053, 1230, 1485, 1828, 2281, 2754, 3152,
-    3616, 3996, 4299, 4651, 5068, 5582, 6057, 6405, 6675, 7083, 7471, 7901,
-    8274, 8486, 8700, 9010, 9221, 8889, 8299, 8429, 8683, 8822, 8889, 8871,
-    8767, 8629, 8498, 8207, 7913, 7800, 7659, 7433, 7236, 7050, 6849, 6668,
-    6512, 6377, 6246, 6161, 6166, 6288, 6473, 6598, 6734, 6930, 7005, 7101,
-    7283, 7597, 8004, 8331, 8507, 8740, 9117, 9429, 9772, 10040, 10176, 10385,
-    10656, 10748, 10159, 9789, 10085, 10280, 10367, 10395, 10380, 10275, 10153, 9967,
-    9633, 9365, 9223, 8986, 8692, 8450, 8167, 7863, 7564, 7249, 6975, 6771,
-    6571, 6445, 6458, 6446, 6354, 6329, 6299, 6191, 6178, 6236, 6397, 6569,
-    6620, 6514, 6553, 6652, 6651, 6657, 6560, 6340, 6207, 6057, 5531, 4375,
-    3809, 3615, 3246, 2786, 2294, 1741, 1109, 454, -317, -1178, -1915, -2553,
-    -3261, -4010, -4698, -5393, -6041, -6678, -7325, -7880, -8389, -8923, -9288, -9546,
-    -9837, -10129, -10339, -10619, -10911, -11086, -11181, -11148, -11119, -11236, -11374, -11297,
-    -11213, -11172, -11068, -11020, -10978, -10813, -10706, -11119, -11762, -11628, -11354, -11211,
-    -11093, -10980, -10895, -10837, -10803, -10856, -10917, -10826, -10719, -10708, -10678, -10617,
-    -10558, -10462, -10407, -10327, -10215, -10162, -10064, -9789, -9502, -9235, -8983, -8751,
-    -8617, -8458, -8242, -7974, -7651, -7374, -7290, -7143, -6850, -6636, -6469, -6294,
-    -6251, -6177, -6043, -6045, -6685, -7115, -6890, -6706, -6646, -6642, -6646, -6644,
-    -6663, -6740, -6893, -6998, -6996, -7026, -7108, -7147, -7166, -7131, -7035, -6986,
-    -6871, -6706, -6576, -6312, -5944, -5585, -5183, -4800, -4454, -4166, -3800, -3378,
-    -2900, -2404, -2004, -1756, -1354, -858, -441, -66, 298, 548, 850, 1162,
-    1141, 571, 568, 927, 1188, 1356, 1464, 1549, 1594, 1573, 1470, 1323,
-    1260, 1249, 1201, 1163, 1139, 1090, 1124, 1171, 1191, 1318, 1452, 1548,
-    1793, 2066, 2360, 2657, 2901, 3117, 3278, 3495, 3724, 3973, 4211, 4258,
-    4216, 4332, 4474, 4513, 4512, 4443, 4281, 4167, 3999, 3282, 2341, 2103,
-    2014, 1856, 1619, 1322, 1010, 691, 292, -197, -666, -1035, -1395, -1775,
-    -2098, -2411, -2704, -2894, -3129, -3354, -3478, -3618, -3728, -3678, -3581, -3411,
-    -3222, -3059, -2901, -2710, -2405, -2024, -1608, -1220, -996, -696, -234, 229,
-    627, 1069, 1449, 1824, 2273, 2571, 2237, 2139, 2638, 3108, 3523, 3863,
-    4154, 4436, 4671, 4811, 4841, 4907, 5008, 5061, 5128, 5231, 5286, 5373,
-    5492, 5539, 5600, 5676, 5708, 5808, 5988, 6166, 6378, 6561, 6695, 6804,
-    6935, 7127, 7338, 7552, 7672, 7639, 7772, 8006, 8206, 8354, 8472, 8520,
-    8630, 8764, 8526, 7787, 7658, 7882, 8003, 8064, 8074, 8054, 8049, 8004,
-    7868, 7662, 7557, 7490, 7402, 7316, 7252, 7201, 7186, 7159, 7119, 7109,
-    7093, 7099, 7190, 7313, 7450, 7641, 7775, 7874, 7972, 8106, 8293, 8496,
-    8679, 8705, 8669, 8785, 8918, 9015, 9077, 9062, 9040, 9049, 8961, 8319,
-    7557, 7476, 7497, 7443, 7362, 7211, 7020, 6838, 6609, 6279, 5945, 5678,
-    5422, 5157, 4901, 4654, 4427, 4234, 4036, 3824, 3631, 3420, 3209, 3093,
-    3009, 2918, 2822, 2666, 2486, 2286, 2121, 2024, 1916, 1741, 1378, 1072,
-    887, 686, 449, 156, -203, -493, -794, -1300, -2385, -3179, -3423, -3722,
-    -4063, -4430, -4864, -5294, -5742, -6272, -6878, -7403, -7903, -8376, -8824, -9222,
-    -9576, -9881, -10164, -10445, -10704, -10866, -11049, -11160, -11107, -11006, -10887, -10784,
-    -10692, -10572, -10419, -10159, -9836, -9507, -9250, -9097, -8794, -8431, -8078, -7750,
-    -7507, -7295, -7035, -6814, -6925, -7422, -7383, -7072, -6860, -6684, -6562, -6506,
-    -6485, -6508, -6618, -6754, -6832, -6948, -7045, -7166, -7278, -7358, -7425, -7493,
-    -7579, -7633, -7649, -7738, -7696, -7546, -7377, -7213, -7075, -6927, -6787, -6615,
-    -6348, -6041, -5729, -5575, -5445, -5165, -4876, -4594, -4355, -4172, -3978, -3758,
-    -3616, -3915, -4254, -4006, -3687, -3451, -3261, -3090, -2970, -2900, -2885, -2944,
-    -2957, -2943, -2959, -3006, -3029, -3004, -2948, -2918, -2888, -2847, -2730, -2659,
-    -2608, -2401, -2143, -1903, -1687, -1499, -1290, -1085, -841, -542, -234, 33,
-    125, 287, 558, 817, 1079, 1323, 1497, 1651, 1818, 1815, 1345, 1155,
-    1442, 1690, 1867, 1998, 2124, 2171, 2171, 2113, 1980, 1926, 1898, 1804,
-    1672, 1610, 1560, 1496, 1422, 1335, 1248, 1199, 1094, 1060, 1139, 1203,
-    1232, 1252, 1265, 1282, 1307, 1364, 1456, 1560, 1577, 1453, 1465, 1525,
-    1547, 1555, 1535, 1438, 1351, 1266, 855, 80, -133, -71, -108, -190,
-    -257, -333, -506, -685, -935, -1219, -1335, -1433, -1664, -1840, -1908, -1996,
-    -2062, -2020, -2005, -1945, -1869, -1796, -1583, -1265, -956, -667, -390, -63,
-    264, 608, 961, 1348, 1774, 2074, 2306, 2663, 3019, 3341, 3659, 3911,
-    4079, 4285, 4430, 4085, 3662, 3856, 4108, 4238, 4314, 4386, 4373, 4294,
-    4205, 3986, 3762, 3714, 3591, 3325, 3174, 3073, 2944, 2890, 2902, 2845,
-    2820, 2775, 2785, 2953, 3171, 3341, 3481, 3622, 3792, 3963, 4174, 4444,
-    4760, 5063, 5199, 5385, 5668, 5936, 6177, 6416, 6551, 6680, 6852, 6822,
-    6262, 5993, 6213, 6351, 6393, 6420, 6425, 6324, 6203, 6042, 5767, 5549,
-    5418, 5155, 4894, 4732, 4564, 4356, 4212, 4111, 4014, 3874, 3686, 3594,
-    3667, 3734, 3759, 3784, 3839, 3913, 3997, 4099, 4258, 4444, 4575, 4560,
-    4680, 4843, 4974, 5098, 5175, 5172, 5243, 5336, 5028, 4323, 4199, 4347,
-    4360, 4291, 4206, 4082, 3872, 3660, 3342, 2943, 2634, 2324, 1914, 1563,
-    1252, 937, 591, 317, 44, -204, -528, -869, -1080, -1173, -1287, -1416,
-    -1555, -1710, -1848, -1965, -2041, -2070, -2105, -2266, -2468, -2519, -2576, -2688,
-    -2765, -2890, -3031, -3080, -3199, -3881, -4567, -4582, -4554, -4648, -4771, -4886,
-    -5067, -5268, -5441, -5714, -6000, -6185, -6396, -6592, -6694, -6775, -6881, -6971,
-    -6984, -6985, -6972, -7043, -7048, -6879, -6644, -6452, -6293, -6130, -5973, -5779,
-    -5596, -5351, -5066, -4828, -4757, -4616, -4362, -4161, -4026, -3868, -3799, -3722,
-    -3539, -3608, -4258, -4537, -4308, -4199, -4185, -4187, -4220, -4306, -4344, -4422,
-    -4622, -4818, -4932, -5084, -5176, -5206, -5255, -5321, -5308, -5256, -5199, -5185,
-    -5218, -5107, -4836, -4553, -4304, -4061, -3833, -3600, -3356, -3098, -2737, -2357,
-    -2080, -1931, -1640, -1308, -1092, -896, -677, -536, -335, -69, -308, -904,
-    -859, -568, -440, -372, -323, -338, -400, -441, -576, -783, -930, -1040,
-    -1184, -1263, -1334, -1457, -1535, -1513, -1474, -1433, -1480, -1531, -1399, -1171,
-    -934, -727, -535, -362, -154, 53, 313, 653, 996, 1189, 1343, 1656,
-    1942, 2138, 2349, 2514, 2614, 2813, 2928, 2417, 1955, 2136, 2318, 2360,
-    2336, 2281, 2165, 2063, 1911, 1628, 1320, 1080, 869, 654, 471, 273,
-    49, -109, -254, -401, -539, -752, -879, -859, -815, -756, -742, -766,
-    -781, -722, -624, -457, -261, -113, -93, 5, 207, 329, 442, 587,
-    652, 708, 872, 785, 221, 58, 309, 470, 587, 665, 677, 675,
-    689, 577, 389, 249, 202, 161, 131, 117, 37, -15, 12, 25,
-    24, -21, -70, 49, 237, 408, 579, 732, 870, 1007, 1163, 1350,
-    1609, 1897, 2086, 2165, 2362, 2590, 2745, 2911, 3044, 3135, 3292, 3443,
-    3145, 2640, 2688, 2911, 3044, 3133, 3160, 3140, 3184, 3100, 2852, 2666,
-    2604, 2566, 2463, 2384, 2305, 2221, 2233, 2258, 2232, 2176, 2080, 2076,
-    2238, 2398, 2554, 2719, 2868, 2992, 3106, 3242, 3435, 3710, 3994, 4091,
-    4118, 4281, 4458, 4631, 4761, 4793, 4868, 5007, 4958, 4405, 3974, 4053,
-    4165, 4194, 4141, 4028, 3894, 3798, 3581, 3296, 3067, 2900, 2725, 2545,
-    2371, 2196, 2058, 1992, 1896, 1771, 1631, 1497, 1477, 1576, 1703, 1798,
-    1867, 1947, 1980, 2039, 2142, 2281, 2499, 2646, 2605, 2595, 2719, 2821,
-    2895, 2892, 2826, 2828, 2863, 2554, 1826, 1492, 1560, 1522, 1418, 1284,
-    1071, 822, 554, 199, -211, -557, -854, -1141, -1427, -1728, -2013, -2290,
-    -2519, -2749, -2965, -3166, -3375, -3504, -3490, -3444, -3444, -3432, -3430, -3448,
-    -3404, -3290, -3124, -2934, -2844, -2855, -2755, -2565, -2400, -2277, -2228, -2180,
-    -2063, -1973, -2321, -2860, -2886, -2728, -2651, -2580, -2625, -2705, -2806, -2934,
-    -3145, -3411, -3596, -3755, -3922, -4078, -4201, -4328, -4412, -4450, -4560, -4663,
-    -4760, -4836, -4771, -4622, -4489, -4364, -4244, -4168, -4090, -3939, -3685, -3364,
-    -3085, -2967, -2877, -2666, -2434, -2180, -1981, -1852, -1685, -1473, -1422, -1852,
-    -2185, -2012, -1786, -1603, -1487, -1465, -1491, -1534, -1598, -1797, -1987, -2099,
-    -2192, -2278, -2377, -2446, -2483, -2475, -2497, -2558, -2629, -2716, -2693, -2529,
-    -2351, -2205, -2037, -1882, -1776, -1624, -1413, -1139, -791, -568, -526, -399,
-    -148, 130, 358, 487, 564, 690, 879, 750, 292, 163, 380, 571,
-    663, 714, 704, 675, 596, 438, 243, 131, -10, -135, -195, -229,
-    -275, -322, -328, -400, -487, -623, -675, -576, -462, -337, -196, -13,
-    60, 170, 374, 558, 792, 1005, 1146, 1190, 1304, 1477, 1672, 1847,
-    1890, 1883, 1987, 2034, 1649, 1113, 1004, 1125, 1208, 1260, 1136, 950,
-    819, 707, 442, 101, -72, -271, -445, -618, -804, -938, -1046, -1053,
-    -1168, -1294, -1521, -1608, -1422, -1263, -1059, -902, -697, -557, -415, -310,
-    -2, 285, 596, 758, 815, 1013, 1272, 1588, 1768, 1836, 1962, 2149,
-    2183, 1628, 1302, 1410, 1588, 1650, 1599, 1554, 1525, 1354, 1227, 922,
-    724, 532, 403, 274, 180, 101, -134, -164, -213, -318, -461, -474,
-    -382, -300, 29, 154, 204, 477, 654, 720, 1002, 1377, 1568, 1879,
-    2017, 2133, 2436, 2630, 2927, 3106, 3647, 4435, 8353, 10378, 9903, 9583,
-    9583, 9757, 9878, 9703, 9393, 9306, 9059, 8612, 8376, 7907, 7540, 7594,
-    7205, 6931, 6496, 6850, 6874, 5885, 5006, 4715, 5352, 6011, 6371, 7043,
-    7954, 9052, 9553, 9907, 9657, 8618, 7240, 4367, 1230, -2376, -5136, -7139,
-    -8652, -9004, -9255, -10551, -13212, -16320, -14978, -11294, -8921, -7993, -5137, 1893,
-    8180, 10139, 8670, 10941, 12968, 13760, 12969, 14455, 17031, 17152, 16668, 14702,
-    6618, -9484, -14505, 4626, 6909, -358, -3542, -2575, -1242, -2287, -971, -3288,
-    -5468, -1445, 7429, 15413, 16010, 16304, 15917, 15312, 13784, 11401, 8723, 6399,
-    3880, 441, -3238, -5497, -7026, -8101, -9989, -12139, -12550, -13535, -14722, -15319,
-    -15729, -16018, -16864, -17090, -17416, -17389, -17164, -17276, -17614, -16968, -16689, -16289,
-    -15742, -15316, -14472, -13906, -12262, -11129, -12526, -15151, -15849, -15536, -15210, -14830,
-    -14022, -12747, -10913, -8979, -6201, -2301, 1124, 3752, 5085, 7248, 8523, 10192,
-    11295, 12304, 12817, 13518, 13977, 14471, 14564, 15073, 15129, 14765, 14760, 14852,
-    14956, 14731, 14455, 14480, 13755, 13426, 12950, 12782, 12798, 11987, 11443, 11428,
-    11046, 10631, 9836, 9252, 7986, 7886, 8147, 8838, 9703, 10380, 10380, 10249,
-    9843, 9465, 9030, 7384, 4788, 1204, -2578, -6082, -8223, -10241, -12298, -13706,
-    -15080, -16392, -17759, -18922, -19610, -20148, -20770, -21608, -22039, -22180, -22059, -22117,
-    -22433, -22156, -22159, -21670, -21129, -21003, -20596, -19708, -18809, -17870, -16619, -16355,
-    -16778, -17404, -17759, -17865, -17338, -16721, -16033, -15114, -14525, -13736, -11989, -9546,
-    -7233, -4827, -1985, 1025, 3880, 6303, 7979, 9236, 10428, 11514, 12058, 12448,
-    12881, 13565, 14193, 14441, 14574, 14871, 15194, 15076, 14865, 14660, 14612, 14365,
-    14171, 13864, 13481, 13072, 12461, 12085, 11596, 11240, 10706, 10454, 10181, 9719,
-    8766, 8258, 8660, 9954, 11078, 11920, 12583, 12988, 13114, 12358, 10836, 8919,
-    6908, 4637, 1660, -1508, -4713, -6635, -8189, -9665, -11021, -12149, -13042, -14117,
-    -15010, -15478, -15831, -16363, -16738, -16939, -17112, -17235, -17326, -16912, -16506, -16421,
-    -16101, -15777, -15285, -14687, -14240, -13664, -13185, -12591, -11810, -10938, -10065, -9132,
-    -8045, -6913, -6079, -6115, -6534, -7158, -7761, -8260, -8401, -8427, -8534, -8462,
-    -7726, -6117, -3648, -526, 2670, 5790, 8110, 10046, 11693, 13117, 14309, 15453,
-    16712, 17906, 18769, 19492, 19983, 20364, 20923, 21173, 21370, 21500, 21771, 21799,
-    21752, 21674, 21324, 20837, 20393, 19762, 19214, 18689, 18140, 17695, 17061, 16411,
-    16004, 15368, 14643, 13898, 12971, 12139, 11379, 10640, 9536, 8391, 7976, 8065,
-    8183, 8416, 8986, 9440, 9716, 9735, 9744, 9167, 8018, 6214, 3459, 451,
-    -2590, -5229, -7082, -8626, -10092, -11373, -12473, -13264, -13958, -14723, -15549, -16268,
-    -16901, -16824, -16110, -15789, -16072, -16026, -16040, -16080, -16105, -15987, -15738, -15349,
-    -14935, -14563, -14276, -13760, -13236, -12414, -11554, -11134, -10955, -10732, -10530, -10186,
-    -9579, -9071, -8530, -7719, -6845, -6294, -6263, -6427, -6694, -7109, -7396, -7632,
-    -7755, -7647, -7342, -6887, -5984, -4200, -1600, 1317, 4210, 6322, 8176, 10005,
-    11639, 13103, 14525, 15711, 16589, 17268, 17852, 18249, 18422, 18533, 18717, 18881,
-    18887, 18980, 19018, 18732, 18268, 17822, 17224, 16622, 16030, 15396, 14794, 14052,
-    13264, 12448, 11632, 10925, 10158, 9440, 8657, 7867, 7198, 6498, 5708, 4970,
-    4347, 3804, 3087, 2047, 967, -133, -1469, -2596, -3118, -3274, -3304, -3168,
-    -3050, -2804, -2650, -2859, -3288, -3703, -4030, -4171, -4642, -6114, -7703, -9267,
-    -10871, -12482, -14004, -15392, -16589, -17673, -18656, -19583, -20445, -21160, -21750, -22232,
-    -22422, -22477, -22466, -22531, -22488, -22355, -22172, -21770, -21201, -20500, -19767, -19069,
-    -18497, -17788, -17009, -16246, -15501, -14876, -14226, -13660, -12985, -12296, -11678, -11028,
-    -10482, -9859, -9013, -8161, -7405, -6803, -6145, -5250, -4037, -2588, -1167, -532,
-    -344, -328, -372, -373, -189, 149, 539, 1250, 2225, 3333, 4436, 5326,
-    6190, 7509, 9356, 11286, 13153, 15063, 16699, 18118, 19264, 20272, 21193, 22104,
-    22843, 23517, 24024, 24277, 24395, 24472, 24427, 24280, 23960, 23489, 22874, 22292,
-    21715, 21109, 20480, 19771, 18999, 18153, 17284, 16470, 15585, 14628, 13769, 13015,
-    12235, 11521, 10731, 9952, 9047, 8199, 7472, 6689, 6040, 5475, 4758, 3701,
-    2587, 1581, 702, -137, -1017, -1872, -2892, -4038, -4575, -4596, -4615, -4708,
-    -4673, -4704, -4836, -5028, -5422, -6007, -6636, -7294, -7916, -8411, -8910, -9494,
-    -9890, -10231, -10919, -11956, -13344, -14854, -16267, -17649, -18846, -19857, -20702, -21321,
-    -21878, -22415, -22897, -23144, -23286, -23285, -23156, -22815, -22262, -21583, -20707, -19806,
-    -18961, -18216, -17595, -17024, -16442, -15846, -15263, -14574, -13896, -13325, -12755, -11935,
-    -11088, -10190, -9262, -8386, -7666, -7003, -6216, -5431, -4632, -3592, -2591, -1576,
-    -624, 276, 1115, 2062, 3017, 4029, 4875, 5649, 6443, 7307, 8089, 8416,
-    8401, 8290, 8198, 8097, 7991, 7981, 8138, 8439, 8820, 9304, 9861, 10612,
-    11509, 12382, 13011, 13583, 14571, 15864, 17227, 18510, 19743, 20853, 21768, 22479,
-    23087, 23503, 23767, 23998, 24127, 24145, 24107, 23972, 23745, 23116, 22433, 21776,
-    21143, 20418, 19759, 19100, 18541, 17929, 17295, 16669, 16051, 15475, 14821, 14125,
-    13226, 12307, 11402, 10601, 9894, 9268, 8562, 7809, 7043, 6253, 5199, 3908,
-    2663, 1512, 477, -665, -1778, -2814, -3958, -5131, -5961, -6594, -7095, -7709,
-    -8362, -8936, -9516, -10269, -10867, -11200, -11483, -11671, -11807, -11935, -12043, -12124,
-    -12174, -12273, -12413, -12559, -12743, -12998, -13379, -13836, -14284, -14720, -15111, -15493,
-    -15829, -16177, -16478, -16582, -16528, -16743, -16712, -16536, -17098, -17784, -18416, -18886,
-    -19304, -19671, -20001, -20219, -20381, -20397, -20237, -19865, -19432, -18878, -18357, -17885,
-    -17381, -16858, -16404, -15973, -15526, -15112, -14731, -14292, -13785, -13205, -12534, -11909,
-    -11327, -10521, -9684, -8894, -7975, -6944, -5675, -4287, -2974, -1755, -444, 837,
-    2038, 3318, 4465, 5353, 6063, 6713, 7449, 8110, 8784, 9494, 10149, 10767,
-    11294, 11805, 12209, 12654, 13103, 13519, 13949, 14555, 14925, 14821, 14590, 14474,
-    14273, 13941, 13545, 13264, 13114, 13003, 12988, 13120, 13327, 13573, 13835, 14100,
-    14262, 14516, 14954, 15379, 15913, 16759, 17687, 18544, 19325, 20039, 20662, 21100,
-    21435, 21533, 21176, 20742, 20149, 19510, 18884, 18222, 17497, 16742, 15992, 15300,
-    14748, 14158, 13553, 13059, 12576, 12131, 11637, 11059, 10505, 9987, 9439, 8854,
-    8316, 7892, 7483, 7023, 6534, 6102, 5685, 5205, 4571, 3506, 2159, 749,
-    -604, -1952, -3225, -4425, -5396, -6125, -6997, -7833, -8560, -9254, -9905, -10531,
-    -11101, -11647, -12263, -12916, -13570, -14147, -14725, -15287, -15784, -16205, -16594, -16939,
-    -17348, -17587, -17706, -17688, -17648, -17642, -17516, -17348, -17215, -17110, -16988, -16882,
-    -16752, -16679, -16702, -16811, -16850, -16836, -16843, -16917, -16959, -16968, -16978, -17007,
-    -17040, -17109, -17189, -17322, -17429, -17455, -17459, -17465, -17499, -17371, -17383, -17605,
-    -17848, -18080, -18170, -17723, -17255, -16789, -16249, -15620, -14954, -14269, -13649, -13054,
-    -12462, -11919, -11420, -10923, -10414, -9850, -9261, -8583, -7996, -7464, -6980, -6479,
-    -5960, -5444, -4941, -4272, -3540, -2845, -2063, -1142, 331, 1832, 3236, 4679,
-    6123, 7189, 8054, 8793, 9567, 10307, 11058, 11785, 12491, 13085, 13610, 14120,
-    14682, 15198, 15657, 16137, 16592, 17031, 17405, 17641, 17796, 17960, 18086, 18239,
-    18485, 18785, 18959, 19098, 19203, 19414, 19476, 19501, 19448, 19206, 18962, 18879,
-    18857, 18756, 18696, 18658, 18656, 18599, 18535, 18445, 18309, 18233, 18174, 18227,
-    18259, 18216, 18204, 18058, 17982, 17903, 17839, 17779, 17782, 17739, 17600, 17383,
-    17279, 17353, 17451, 17115, 16478, 15855, 15164, 14505, 13853, 13191, 12582, 11977,
-    11381, 10796, 10241, 9711, 9199, 8759, 8285, 7722, 7314, 6890, 6447, 6031,
-    5605, 5127, 4524, 3937, 3355, 2774, 2247, 1761, 1235, 677, 182, -383,
-    -1313, -2719, -4049, -5254, -6178, -7188, -8191, -9196, -10063, -10809, -11541, -12233,
-    -12929, -13623, -14328, -14955, -15586, -16277, -16932, -17501, -18032, -18492, -18933, -19310,
-    -19629, -19874, -20122, -20332, -20650, -20926, -21118, -21242, -21279, -21293, -21306, -21345,
-    -21392, -21244, -21027, -20788, -20443, -20066, -19857, -19673, -19477, -19314, -19158, -19027,
-    -18923, -18872, -18841, -18696, -18497, -18331, -18120, -17844, -17561, -17330, -17170, -16991,
-    -16891, -16704, -16458, -16295, -16181, -15968, -15786, -15608, -15218, -14665, -14087, -13477,
-    -12826, -12146, -11451, -10800, -10230, -9618, -9003, -8452, -7912, -7435, -7010, -6516,
-    -5976, -5344, -4738, -4054, -3401, -2738, -2047, -1433, -912, -437, 31, 477,
-    934, 1445, 1993, 2455, 2891, 3374, 3889, 4251, 4528, 4792, 5161, 5897,
-    6703, 7458, 8190, 8988, 9851, 10687, 11538, 12368, 13131, 13832, 14541, 15293,
-    16003, 16664, 17258, 17845, 18401, 18913, 19392, 19876, 20284, 20711, 21099, 21485,
-    21790, 21967, 22093, 22220, 22350, 22479, 22575, 22566, 22537, 22439, 22364, 22292,
-    22286, 22285, 22195, 22072, 21862, 21587, 21275, 20997, 20755, 20520, 20256, 19995,
-    19807, 19649, 19505, 19229, 18802, 18322, 17772, 17282, 16851, 16421, 15994, 15680,
-    15347, 14954, 14555, 14208, 13951, 13729, 13526, 13280, 12758, 12214, 11656, 11129,
-    10578, 10022, 9438, 8867, 8278, 7712, 7182, 6673, 6208, 5714, 5139, 4418,
-    3646, 2850, 2020, 1280, 574, -125, -840, -1521, -2226, -2847, -3396, -3944,
-    -4496, -4994, -5457, -5823, -6055, -6242, -6418, -6580, -6796, -7017, -7252, -7536,
-    -7792, -7912, -7981, -8100, -8237, -8366, -8496, -8644, -8856, -9097, -9295, -9751,
-    -10483, -11245, -12050, -12861, -13635, -14261, -14897, -15571, -16235, -16890, -17540, -18166,
-    -18734, -19251, -19683, -20064, -20467, -20898, -21273, -21569, -21814, -22040, -22261, -22448,
-    -22644, -22793, -22886, -22908, -22901, -22868, -22859, -22870, -22874, -22775, -22709, -22589,
-    -22455, -22318, -22184, -22054, -21877, -21693, -21507, -21383, -21291, -21148, -21010, -20835,
-    -20578, -20343, -20013, -19522, -19026, -18540, -18042, -17574, -17133, -16664, -16151, -15662,
-    -15242, -14858, -14498, -14035, -13587, -13155, -12748, -12408, -11830, -11112, -10402, -9756,
-    -9074, -8394, -7767, -7216, -6655, -6086, -5501, -4932, -4343, -3618, -2893, -2184,
-    -1516, -835, -191, 408, 1046, 1643, 2126, 2627, 3182, 3752, 4288, 4806,
-    5231, 5567, 5830, 6020, 6218, 6449, 6678, 6886, 7094, 7322, 7566, 7824,
-    8141, 8446, 8730, 9020, 9292, 9561, 9858, 10147, 10462, 10791, 11096, 11372,
-    11743, 12189, 12685, 13300, 13931, 14550, 15129, 15692, 16232, 16722, 17163, 17587,
-    18002, 18440, 18841, 19161, 19527, 19931, 20289, 20609, 20893, 21112, 21329, 21590,
-    21869, 22064, 22216, 22340, 22470, 22598, 22695, 22768, 22860, 22996, 23156, 23285,
-    23334, 23329, 23336, 23378, 23414, 23450, 23448, 23426, 23344, 23221, 23034, 22841,
-    22689, 22528, 22362, 22136, 21831, 21466, 21090, 20708, 20293, 19852, 19364, 18844,
-    18311, 17797, 17281, 16766, 16281, 15768, 15204, 14596, 13963, 13301, 12640, 12034,
-    11456, 10868, 10276, 9665, 9096, 8585, 8036, 7467, 6927, 6410, 5908, 5460,
-    5005, 4399, 3710, 3018, 2286, 1543, 771, 41, -574, -1135, -1691, -2244,
-    -2849, -3464, -4069, -4662, -5220, -5649, -6022, -6383, -6750, -7122, -7498, -7837,
-    -8148, -8450, -8762, -9128, -9493, -9838, -10192, -10530, -10876, -11230, -11560, -11852,
-    -12119, -12331, -12548, -12814, -13086, -13321, -13515, -13693, -13879, -14077, -14228, -14341,
-    -14469, -14663, -14924, -15216, -15437, -15583, -15726, -15885, -16044, -16238, -16464, -16700,
-    -16983, -17289, -17573, -17836, -18128, -18427, -18712, -18955, -19171, -19373, -19581, -19822,
-    -20094, -20361, -20614, -20844, -21063, -21254, -21441, -21612, -21765, -21874, -21944, -21968,
-    -21982, -21970, -21919, -21833, -21742, -21623, -21500, -21358, -21165, -20952, -20778, -20653,
-    -20511, -20276, -19979, -19641, -19314, -19022, -18721, -18423, -18138, -17859, -17570, -17248,
-    -16910, -16615, -16337, -15995, -15595, -15132, -14635, -14175, -13747, -13313, -12889, -12451,
-    -12012, -11567, -11084, -10559, -10008, -9489, -8952, -8387, -7809, -7216, -6649, -6104,
-    -5447, -4564, -3648, -2723, -1813, -946, -124, 619, 1292, 1940, 2637, 3368,
-    4115, 4835, 5470, 5980, 6309, 6564, 6824, 7091, 7322, 7524, 7705, 7899,
-    8128, 8352, 8556, 8765, 8958, 9144, 9302, 9437, 9559, 9685, 9856, 10060,
-    10264, 10452, 10642, 10874, 11140, 11421, 11672, 11924, 12205, 12497, 12821, 13163,
-    13502, 13862, 14193, 14487, 14741, 14984, 15284, 15632, 15976, 16292, 16570, 16826,
-    17053, 17255, 17438, 17599, 17777, 17952, 18073, 18171, 18273, 18400, 18556, 18723,
-    18861, 18954, 19020, 19085, 19134, 19150, 19167, 19211, 19268, 19331, 19373, 19416,
-    19498, 19591, 19675, 19756, 19841, 19925, 20018, 20135, 20247, 20376, 20504, 20565,
-    20568, 20533, 20473, 20469, 20519, 20569, 20603, 20600, 20497, 20325, 20127, 19919,
-    19716, 19509, 19242, 18899, 18554, 18206, 17850, 17491, 17100, 16704, 16282, 15815,
-    15308, 14792, 14238, 13701, 13176, 12619, 12076, 11508, 10949, 10435, 9908, 9362,
-    8832, 8315, 7796, 7299, 6806, 6305, 5833, 5273, 4518, 3696, 2881, 2090,
-    1378, 720, 77, -551, -1179, -1838, -2501, -3135, -3777, -4407, -4946, -5387,
-    -5794, -6193, -6563, -6893, -7189, -7483, -7826, -8185, -8514, -8819, -9120, -9420,
-    -9711, -9997, -10271, -10521, -10770, -10981, -11164, -11371, -11574, -11752, -11921, -12075,
-    -12232, -12393, -12526, -12650, -12805, -13018, -13290, -13558, -13764, -13910, -14025, -14165,
-    -14371, -14623, -14887, -15141, -15403, -15698, -16009, -16310, -16606, -16910, -17199, -17478,
-    -17763, -18014, -18255, -18513, -18778, -19065, -19349, -19591, -19813, -20032, -20237, -20414,
-    -20566, -20664, -20725, -20809, -20883, -20904, -20883, -20831, -20794, -20760, -20677, -20535,
-    -20392, -20331, -20330, -20318, -20252, -20115, -19930, -19744, -19585, -19441, -19309, -19199,
-    -19087, -18997, -18932, -18824, -18696, -18589, -18479, -18353, -18224, -18063, -17854, -17669,
-    -17526, -17392, -17269, -17109, -16897, -16683, -16476, -16252, -15993, -15695, -15339, -14941,
-    -14565, -14188, -13754, -13275, -12762, -12265, -11795, -11274, -10696, -10121, -9587, -9111,
-    -8654, -8149, -7579, -6972, -6386, -5820, -5271, -4718, -4060, -3344, -2668, -1977,
-    -1291, -650, -10, 639, 1263, 1882, 2530, 3137, 3683, 4198, 4604, 4935,
-    5262, 5539, 5817, 6114, 6363, 6595, 6837, 7092, 7360, 7603, 7818, 8061,
-    8352, 8656, 8947, 9191, 9412, 9660, 9894, 10079, 10235, 10380, 10559, 10807,
-    11080, 11303, 11471, 11595, 11692, 11824, 11954, 12032, 12116, 12215, 12311, 12392,
-    12435, 12499, 12641, 12805, 12960, 13085, 13163, 13255, 13385, 13522, 13675, 13843,
-    14046, 14293, 14548, 14802, 15058, 15308, 15557, 15843, 16171, 16482, 16802, 17153,
-    17504, 17874, 18225, 18500, 18737, 18972, 19230, 19520, 19829, 20124, 20364, 20567,
-    20758, 20903, 20995, 21070, 21154, 21231, 21283, 21302, 21281, 21274, 21312, 21352,
-    21350, 21283, 21159, 21035, 20933, 20817, 20675, 20534, 20411, 20309, 20195, 20052,
-    19923, 19813, 19684, 19546, 19402, 19242, 19090, 18949, 18819, 18706, 18573, 18404,
-    18186, 17886, 17553, 17235, 16946, 16697, 16426, 16086, 15697, 15266, 14829, 14391,
-    13913, 13400, 12871, 12329, 11766, 11206, 10676, 10179, 9698, 9174, 8596, 8005,
-    7401, 6821, 6255, 5670, 5125, 4525, 3785, 3029, 2293, 1581, 894, 181,
-    -501, -1118, -1716, -2292, -2853, -3389, -3892, -4380, -4808, -5199, -5610, -5984,
-    -6271, -6480, -6682, -6946, -7241, -7539, -7833, -8118, -8431, -8768, -9083, -9367,
-    -9645, -9949, -10244, -10500, -10719, -10907, -11123, -11370, -11618, -11866, -12084, -12300,
-    -12536, -12738, -12902, -13040, -13154, -13253, -13338, -13412, -13480, -13546, -13616, -13689,
-    -13748, -13761, -13747, -13740, -13765, -13854, -13992, -14141, -14281, -14384, -14443, -14499,
-    -14582, -14697, -14866, -15053, -15242, -15473, -15720, -15963, -16218, -16463, -16695, -16938,
-    -17174, -17365, -17547, -17775, -18034, -18314, -18602, -18875, -19143, -19410, -19654, -19842,
-    -20001, -20166, -20298, -20387, -20484, -20585, -20661, -20721, -20787, -20818, -20815, -20819,
-    -20806, -20788, -20807, -20860, -20905, -20909, -20886, -20827, -20764, -20729, -20731, -20761,
-    -20774, -20787, -20797, -20781, -20757, -20733, -20702, -20640, -20569, -20477, -20348, -20213,
-    -20075, -19967, -19887, -19769, -19610, -19426, -19213, -18985, -18718, -18415, -18097, -17729,
-    -17342, -16972, -16586, -16167, -15726, -15275, -14778, -14248, -13701, -13132, -12576, -12045,
-    -11517, -10966, -10397, -9798, -9179, -8591, -8016, -7458, -6939, -6483, -6050, -5540,
-    -4916, -4163, -3365, -2623, -1917, -1226, -666, -355, -43, 456, 1024, 1652,
-    2290, 2808, 3207, 3515, 3720, 3861, 3998, 4154, 4345, 4575, 4851, 5138,
-    5413, 5716, 6061, 6427, 6782, 7182, 7646, 8129, 8630, 9128, 9611, 10093,
-    10614, 11156, 11710, 12288, 12846, 13298, 13608, 13955, 14440, 14962, 15460, 15881,
-    16223, 16529, 16781, 16737, 16394, 16201, 16238, 16344, 16511, 16658, 16725, 16740,
-    16719, 16617, 16451, 16290, 16177, 16124, 16101, 16070, 16018, 15984, 16007, 16090,
-    16201, 16302, 16461, 16696, 16947, 17193, 17450, 17725, 18019, 18369, 18778, 19212,
-    19627, 19999, 20272, 20465, 20788, 21238, 21681, 22051, 22355, 22646, 22932, 23117,
-    22960, 22664, 22632, 22760, 22919, 23100, 23231, 23290, 23295, 23242, 23100, 22926,
-    22764, 22605, 22461, 22359, 22275, 22162, 22065, 21982, 21878, 21757, 21636, 21564,
-    21553, 21560, 21538, 21500, 21454, 21396, 21335, 21283, 21251, 21202, 21079, 20836,
-    20598, 20506, 20488, 20454, 20328, 20139, 19949, 19750, 19361, 18608, 17847, 17340,
-    16961, 16666, 16377, 16050, 15690, 15287, 14812, 14253, 13706, 13195, 12674, 12149,
-    11676, 11243, 10809, 10387, 9956, 9542, 9158, 8774, 8409, 8079, 7748, 7413,
-    7093, 6746, 6360, 5915, 5393, 4822, 4192, 3429, 2534, 1710, 1039, 423,
-    -229, -943, -1657, -2348, -3068, -4048, -5237, -6199, -6911, -7496, -7958, -8395,
-    -8868, -9385, -9926, -10497, -11069, -11606, -12155, -12704, -13182, -13567, -13924, -14281,
-    -14617, -14941, -15226, -15456, -15627, -15719, -15767, -15823, -15891, -15971, -16035, -16053,
-    -16074, -16085, -16055, -16054, -16166, -16335, -16408, -16365, -16292, -16263, -16299, -16368,
-    -16429, -16623, -17204, -17894, -18310, -18561, -18719, -18812, -18951, -19161, -19400, -19678,
-    -20036, -20366, -20656, -20968, -21265, -21524, -21725, -21875, -21993, -22097, -22188, -22240,
-    -22260, -22214, -22112, -22047, -21997, -21897, -21772, -21623, -21435, -21235, -21006, -20750,
-    -20541, -20438, -20331, -20051, -19674, -19350, -19104, -18893, -18699, -18512, -18547, -18928,
-    -19253, -19308, -19245, -19099, -18908, -18756, -18680, -18651, -18691, -18800, -18896, -18974,
-    -19008, -18995, -18970, -18931, -18886, -18826, -18774, -18718, -18627, -18497, -18275, -18006,
-    -17776, -17538, -17262, -16999, -16726, -16411, -16072, -15710, -15342, -15033, -14811, -14538,
-    -14135, -13681, -13249, -12852, -12473, -12076, -11747, -11739, -11940, -11943, -11719, -11380,
-    -10952, -10514, -10120, -9793, -9534, -9339, -9160, -8971, -8787, -8599, -8382, -8117,
-    -7842, -7546, -7220, -6910, -6596, -6301, -6029, -5694, -5347, -5041, -4673, -4229,
-    -3787, -3324, -2818, -2281, -1722, -1201, -815, -501, -74, 466, 1019, 1538,
-    2029, 2525, 3031, 3391, 3427, 3399, 3623, 4014, 4464, 4900, 5257, 5563,
-    5846, 6098, 6312, 6507, 6712, 6938, 7172, 7438, 7744, 8060, 8401, 8725,
-    9027, 9353, 9682, 10060, 10516, 10922, 11257, 11635, 12036, 12422, 12812, 13192,
-    13564, 13937, 14249, 14432, 14609, 14918, 15312, 15679, 15955, 16169, 16358, 16512,
-    16442, 16060, 15735, 15660, 15726, 15919, 16158, 16334, 16435, 16493, 16516, 16498,
-    16450, 16393, 16340, 16329, 16374, 16407, 16447, 16541, 16654, 16791, 16933, 17058,
-    17245, 17497, 17712, 17900, 18116, 18334, 18553, 18770, 18978, 19190, 19405, 19543,
-    19574, 19644, 19829, 20063, 20252, 20387, 20501, 20574, 20558, 20231, 19668, 19293,
-    19136, 19077, 19111, 19149, 19106, 18973, 18789, 18554, 18274, 17998, 17749, 17494,
-    17258, 17074, 16895, 16737, 16596, 16433, 16263, 16092, 15944, 15869, 15842, 15798,
-    15769, 15752, 15690, 15614, 15556, 15542, 15590, 15637, 15578, 15458, 15442, 15545,
-    15676, 15740, 15744, 15717, 15665, 15478, 14968, 14371, 13997, 13786, 13703, 13696,
-    13659, 13559, 13401, 13198, 12916, 12554, 12156, 11761, 11365, 11023, 10704, 10382,
-    10067, 9742, 9393, 9025, 8660, 8344, 8110, 7881, 7605, 7351, 7100, 6841,
-    6606, 6386, 6208, 6072, 5898, 5599, 5306, 5141, 5083, 5040, 4893, 4655,
-    4365, 4039, 3534, 2763, 2040, 1532, 1184, 976, 790, 546, 222, -153,
-    -558, -1000, -1472, -1975, -2486, -2962, -3361, -3727, -4088, -4458, -4832, -5204,
-    -5580, -5957, -6271, -6484, -6675, -6835, -6987, -7193, -7416, -7634, -7837, -8019,
-    -8195, -8440, -8757, -9007, -9132, -9183, -9257, -9389, -9558, -9751, -9995, -10486,
-    -11159, -11682, -11989, -12144, -12189, -12245, -12350, -12522, -12734, -12989, -13263, -13549,
-    -13847, -14125, -14331, -14451, -14514, -14583, -14684, -14807, -14950, -15104, -15245, -15327,
-    -15371, -15423, -15457, -15494, -15556, -15593, -15587, -15542, -15496, -15491, -15624, -15811,
-    -15876, -15805, -15704, -15661, -15682, -15740, -15838, -16053, -16589, -17212, -17613, -17805,
-    -17868, -17864, -17889, -17965, -18078, -18262, -18515, -18810, -19120, -19416, -19670, -19836,
-    -19920, -19980, -20077, -20181, -20291, -20407, -20507, -20568, -20531, -20445, -20343, -20227,
-    -20142, -20075, -19980, -19826, -19656, -19464, -19303, -19235, -19153, -18926, -18654, -18406,
-    -18189, -17998, -17808, -17648, -17708, -18097, -18451, -18541, -18452, -18251, -18036, -17881,
-    -17823, -17844, -17965, -18179, -18383, -18559, -18704, -18782, -18785, -18731, -18694, -18677,
-    -18661, -18662, -18655, -18627, -18517, -18319, -18054, -17746, -17425, -17138, -16859, -16509,
-    -16078, -15628, -15144, -14752, -14416, -13968, -13349, -12725, -12142, -11594, -11060, -10528,
-    -10070, -9945, -10036, -9890, -9485, -8948, -8364, -7787, -7269, -6781, -6346, -6057,
-    -5873, -5697, -5474, -5187, -4781, -4220, -3635, -3047, -2490, -1992, -1529, -1090,
-    -600, -29, 620, 1302, 2003, 2670, 3282, 3893, 4504, 5101, 5661, 6152,
-    6506, 6840, 7348, 7981, 8579, 9110, 9584, 10027, 10464, 10725, 10609, 10468,
-    10641, 11046, 11555, 12095, 12577, 12979, 13357, 13627, 13744, 13792, 13871, 13985,
-    14128, 14331, 14571, 14777, 14952, 15126, 15242, 15318, 15376, 15479, 15637, 15857,
-    16088, 16311, 16501, 16674, 16873, 17100, 17323, 17552, 17695, 17730, 17823, 18069,
-    18364, 18604, 18783, 18925, 19076, 19186, 19035, 18579, 18257, 18214, 18333, 18510,
-    18710, 18846, 18944, 18996, 18905, 18701, 18502, 18383, 18315, 18298, 18357, 18406,
-    18412, 18407, 18390, 18327, 18241, 18197, 18257, 18398, 18588, 18765, 18881, 18971,
-    19076, 19222, 19398, 19580, 19767, 19864, 19883, 19988, 20200, 20423, 20581, 20654,
-    20681, 20708, 20628, 20195, 19606, 19235, 19082, 19047, 19064, 19079, 19022, 18930,
-    18755, 18413, 17998, 17616, 17323, 17082, 16917, 16808, 16679, 16523, 16362, 16155,
-    15904, 15667, 15530, 15525, 15600, 15719, 15809, 15849, 15864, 15880, 15918, 15983,
-    16094, 16172, 16144, 16125, 16215, 16381, 16490, 16524, 16470, 16396, 16340, 16078,
-    15484, 14887, 14530, 14333, 14207, 14113, 13970, 13791, 13567, 13211, 12685, 12127,
-    11629, 11165, 10737, 10356, 9979, 9568, 9162, 8735, 8240, 7722, 7266, 6940,
-    6712, 6519, 6335, 6109, 5843, 5570, 5304, 5052, 4837, 4651, 4377, 3952,
-    3564, 3278, 3010, 2707, 2301, 1836, 1388, 894, 117, -890, -1734, -2326,
-    -2805, -3231, -3656, -4125, -4551, -4931, -5429, -6029, -6561, -7009, -7432, -7857,
-    -8271, -8670, -9050, -9411, -9828, -10307, -10764, -11123, -11359, -11554, -11743, -11935,
-    -12148, -12363, -12582, -12795, -12985, -13123, -13222, -13390, -13578, -13655, -13658, -13664,
-    -13712, -13828, -13983, -14121, -14363, -14943, -15598, -15980, -16147, -16209, -16213, -16226,
-    -16274, -16338, -16478, -16779, -17133, -17370, -17524, -17669, -17790, -17904, -18033, -18131,
-    -18251, -18468, -18700, -18823, -18808, -18696, -18589, -18510, -18432, -18379, -18353, -18338,
-    -18342, -18320, -18240, -18175, -18188, -18193, -18101, -17966, -17873, -17861, -17930, -17997,
-    -18033, -18255, -18781, -19275, -19481, -19529, -19519, -19469, -19430, -19434, -19485, -19650,
-    -19948, -20186, -20284, -20330, -20339, -20324, -20298, -20269, -20243, -20275, -20397, -20451,
-    -20350, -20143, -19875, -19600, -19311, -19034, -18810, -18625, -18463, -18262, -17988, -17656,
-    -17371, -17173, -16897, -16518, -16156, -15862, -15659, -15494, -15317, -15206, -15354, -15699,
-    -15900, -15859, -15704, -15497, -15300, -15176, -15116, -15117, -15266, -15479, -15562, -15526,
-    -15462, -15390, -15289, -15195, -15128, -15064, -15079, -15113, -15044, -14857, -14554, -14201,
-    -13849, -13484, -13104, -12736, -12407, -12071, -11687, -11217, -10723, -10319, -9935, -9444,
-    -8860, -8290, -7820, -7448, -7099, -6733, -6479, -6464, -6486, -6282, -5885, -5440,
-    -5005, -4627, -4304, -4022, -3856, -3843, -3805, -3559, -3168, -2777, -2406, -2041,
-    -1684, -1336, -1089, -950, -734, -369, 77, 550, 1010, 1447, 1890, 2340,
-    2809, 3275, 3706, 4107, 4479, 4814, 5133, 5467, 5849, 6235, 6600, 6933,
-    7233, 7530, 7862, 8188, 8486, 8822, 9216, 9631, 10080, 10550, 11012, 11458,
-    11870, 12163, 12365, 12671, 13120, 13620, 14085, 14503, 14879, 15206, 15508, 15699,
-    15809, 16007, 16270, 16535, 16754, 16882, 16973, 17062, 17176, 17287, 17362, 17401,
-    17415, 17434, 17466, 17511, 17556, 17583, 17612, 17630, 17598, 17554, 17534, 17543,
-    17556, 17586, 17638, 17727, 17818, 17911, 18026, 18147, 18287, 18381, 18323, 18281,
-    18378, 18553, 18734, 18881, 19027, 19131, 19191, 19179, 19005, 18832, 18789, 18826,
-    18887, 18877, 18793, 18687, 18601, 18541, 18449, 18311, 18151, 18009, 17878, 17767,
-    17630, 17452, 17292, 17144, 16953, 16710, 16468, 16272, 16089, 15893, 15712, 15574,
-    15468, 15365, 15283, 15210, 15147, 15089, 14926, 14640, 14457, 14414, 14419, 14404,
-    14364, 14319, 14265, 14199, 14012, 13702, 13495, 13419, 13383, 13328, 13214, 13067,
-    12933, 12833, 12735, 12590, 12406, 12223, 12053, 11908, 11792, 11663, 11549, 11448,
-    11321, 11136, 10926, 10742, 10615, 10509, 10401, 10309, 10249, 10169, 10085, 10049,
-    10032, 10014, 9970, 9754, 9499, 9429, 9451, 9481, 9479, 9466, 9442, 9396,
-    9287, 9003, 8675, 8506, 8436, 8375, 8267, 8092, 7870, 7674, 7513, 7343,
-    7122, 6857, 6593, 6361, 6192, 6027, 5822, 5612, 5367, 5055, 4688, 4287,
-    3880, 3516, 3152, 2796, 2496, 2220, 1905, 1600, 1315, 1014, 724, 363,
-    -162, -612, -925, -1214, -1527, -1861, -2204, -2569, -2958, -3451, -4077, -4635,
-    -5021, -5319, -5599, -5892, -6220, -6544, -6841, -7134, -7483, -7887, -8294, -8670,
-    -8966, -9206, -9476, -9740, -9997, -10280, -10595, -10911, -11222, -11487, -11708, -11910,
-    -12046, -12120, -12228, -12390, -12508, -12597, -12671, -12711, -12902, -13172, -13277, -13288,
-    -13287, -13306, -13342, -13379, -13412, -13482, -13677, -13946, -14099, -14132, -14156, -14194,
-    -14267, -14386, -14499, -14593, -14687, -14829, -14999, -15193, -15356, -15447, -15531, -15627,
-    -15692, -15765, -15884, -16043, -16212, -16371, -16471, -16547, -16579, -16549, -16502, -16533,
-    -16583, -16586, -16589, -16541, -16518, -16677, -16777, -16710, -16584, -16464, -16375, -16303,
-    -16227, -16152, -16134, -16250, -16376, -16375, -16325, -16270, -16197, -16158, -16130, -16072,
-    -15995, -15952, -15984, -16068, -16152, -16144, -16064, -16002, -15939, -15856, -15813, -15815,
-    -15841, -15879, -15880, -15850, -15805, -15686, -15515, -15361, -15275, -15160, -15019, -14869,
-    -14678, -14613, -14674, -14573, -14346, -14092, -13869, -13667, -13476, -13290, -13123, -13042,
-    -13069, -12990, -12791, -12573, -12339, -12109, -11939, -11764, -11564, -11363, -11195, -11080,
-    -11012, -10906, -10725, -10511, -10302, -10051, -9805, -9609, -9453, -9330, -9211, -9047,
-    -8884, -8661, -8370, -8070, -7833, -7643, -7435, -7230, -7016, -6805, -6773, -6744,
-    -6507, -6204, -5907, -5659, -5422, -5169, -4892, -4624, -4486, -4385, -4114, -3785,
-    -3452, -3115, -2831, -2599, -2333, -2073, -1837, -1635, -1478, -1314, -1071, -792,
-    -516, -233, 65, 318, 517, 674, 833, 1033, 1267, 1489, 1779, 2091,
-    2381, 2616, 2844, 3102, 3381, 3684, 3917, 3943, 4090, 4408, 4746, 5049,
-    5290, 5507, 5706, 5881, 5965, 5876, 5882, 6053, 6227, 6420, 6587, 6671,
-    6752, 6865, 6960, 7052, 7107, 7125, 7190, 7303, 7414, 7523, 7644, 7765,
-    7857, 7905, 7932, 7970, 8061, 8171, 8321, 8552, 8783, 8987, 9148, 9303,
-    9471, 9643, 9837, 9909, 9901, 10144, 10488, 10813, 11069, 11286, 11497, 11712,
-    11894, 11933, 11879, 12016, 12226, 12424, 12629, 12768, 12852, 12970, 13089, 13191,
-    13280, 13314, 13341, 13424, 13512, 13602, 13711, 13815, 13904, 13967, 14004, 14059,
-    14146, 14262, 14364, 14522, 14723, 14917, 15068, 15174, 15288, 15430, 15579, 15718,
-    15687, 15727, 16003, 16319, 16591, 16793, 16966, 17130, 17279, 17346, 17247, 17196,
-    17329, 17473, 17621, 17730, 17747, 17737, 17763, 17781, 17798, 17774, 17709, 17663,
-    17650, 17621, 17604, 17598, 17566, 17507, 17399, 17274, 17185, 17132, 17106, 17066,
-    17090, 17135, 17168, 17139, 17060, 17011, 16991, 16994, 16954, 16748, 16745, 16887,
-    17031, 17122, 17168, 17182, 17185, 17139, 16966, 16670, 16556, 16554, 16559, 16550,
-    16468, 16295, 16120, 15991, 15837, 15666, 15449, 15197, 14967, 14733, 14493, 14289,
-    14085, 13874, 13609, 13301, 12990, 12712, 12482, 12271, 12077, 11936, 11806, 11637,
-    11379, 11099, 10845, 10602, 10391, 10052, 9673, 9545, 9463, 9355, 9216, 9030,
-    8788, 8511, 8165, 7684, 7199, 6925, 6637, 6285, 5847, 5276, 4591, 3919,
-    3268, 2583, 1871, 1131, 377, -354, -1078, -1800, -2500, -3209, -3907, -4623,
-    -5283, -5860, -6343, -6738, -7147, -7538, -7883, -8217, -8575, -8967, -9322, -9643,
-    -9955, -10269, -10780, -11136, -11272, -11399, -11523, -11643, -11817, -12026, -12275, -12613,
-    -13113, -13468, -13629, -13796, -13975, -14163, -14435, -14749, -15005, -15266, -15555, -15837,
-    -16109, -16373, -16619, -16862, -17101, -17310, -17512, -17737, -18003, -18266, -18509, -18697,
-    -18829, -18973, -19040, -19041, -19067, -19144, -19254, -19336, -19386, -19409, -19512, -19762,
-    -19716, -19573, -19441, -19292, -19177, -19118, -19079, -19072, -19169, -19395, -19355, -19233,
-    -19138, -19047, -18977, -18985, -18997, -18945, -18942, -18984, -19021, -19067, -19075, -19067,
-    -19071, -19067, -19056, -19031, -19055, -19074, -19103, -19108, -19037, -18967, -18888, -18712,
-    -18515, -18361, -18268, -18194, -18089, -17945, -17794, -17819, -17804, -17483, -17134, -16782,
-    -16431, -16138, -15892, -15662, -15495, -15518, -15543, -15289, -15018, -14766, -14530, -14342,
-    -14214, -14051, -13851, -13697, -13567, -13442, -13321, -13179, -13032, -12871, -12667, -12450,
-    -12236, -12084, -11943, -11841, -11702, -11490, -11295, -11020, -10651, -10309, -10023, -9801,
-    -9598, -9356, -9096, -8888, -8877, -8639, -8205, -7780, -7352, -6953, -6642, -6389,
-    -6171, -6034, -6107, -5993, -5673, -5360, -5043, -4711, -4432, -4206, -3946, -3697,
-    -3495, -3301, -3107, -2903, -2711, -2525, -2351, -2151, -1948, -1775, -1620, -1492,
-    -1364, -1165, -943, -746, -460, -129, 136, 356, 537, 705, 918, 1130,
-    1210, 1168, 1442, 1788, 2125, 2487, 2828, 3092, 3289, 3442, 3442, 3315,
-    3501, 3764, 3986, 4190, 4360, 4460, 4518, 4604, 4650, 4670, 4686, 4711,
-    4752, 4796, 4848, 4909, 4986, 5041, 5052, 5063, 5033, 5030, 5105, 5153,
-    5216, 5370, 5522, 5619, 5710, 5771, 5841, 5954, 6059, 5980, 5982, 6265,
-    6550, 6834, 7147, 7425, 7614, 7760, 7867, 7767, 7733, 7963, 8194, 8389,
-    8574, 8714, 8795, 8864, 8947, 8996, 9045, 9100, 9195, 9290, 9396, 9467,
-    9561, 9661, 9720, 9785, 9841, 9887, 10018, 10221, 10393, 10624, 10911, 11151,
-    11347, 11559, 11747, 11982, 12247, 12460, 12484, 12746, 13160, 13535, 13912, 14322,
-    14678, 14952, 15198, 15345, 15313, 15515, 15877, 16210, 16488, 16742, 16927, 17056,
-    17203, 17340, 17462, 17574, 17673, 17791, 17899, 18016, 18095, 18209, 18290, 18321,
-    18379, 18378, 18388, 18480, 18592, 18668, 18800, 18927, 18964, 18969, 18980, 18955,
-    18963, 18980, 18861, 18656, 18739, 18859, 18928, 19008, 19104, 19117, 19062, 19005,
-    18771, 18475, 18440, 18438, 18365, 18234, 18076, 17875, 17665, 17498, 17290, 17052,
-    16795, 16545, 16313, 16089, 15827, 15548, 15300, 14993, 14689, 14402, 14062, 13767,
-    13558, 13325, 13094, 12925, 12730, 12444, 12166, 11911, 11645, 11390, 11133, 10654,
-    10283, 10184, 10084, 9940, 9798, 9646, 9417, 9159, 8898, 8380, 7939, 7700,
-    7472, 7213, 6952, 6648, 6243, 5791, 5330, 4799, 4272, 3749, 3260, 2787,
-    2317, 1809, 1316, 837, 303, -183, -670, -1157, -1537, -1827, -2158, -2439,
-    -2675, -2942, -3301, -3629, -3952, -4278, -4537, -4824, -5279, -5471, -5486, -5490,
-    -5523, -5537, -5596, -5756, -5904, -6130, -6550, -6754, -6836, -6933, -7088, -7257,
-    -7486, -7760, -7983, -8183, -8421, -8668, -8931, -9179, -9415, -9651, -9895, -10102,
-    -10340, -10621, -10845, -11091, -11303, -11422, -11501, -11594, -11616, -11645, -11736, -11876,
-    -11978, -12087, -12176, -12215, -12390, -12602, -12528, -12420, -12316, -12198, -12065, -11994,
-    -12006, -12006, -12178, -12393, -12347, -12266, -12227, -12231, -12278, -12374, -12470, -12499,
-    -12541, -12628, -12774, -12999, -13317, -13740, -14273, -14858, -15454, -16129, -16849, -17574,
-    -18321, -18921, -19302, -19579, -19763, -19814, -19790, -19684, -19506, -19249, -18961, -18640,
-    -18315, -18176, -17928, -17478, -17076, -16666, -16270, -15887, -15550, -15234, -14933, -14838,
-    -14637, -14250, -13905, -13608, -13346, -13108, -12907, -12682, -12405, -12132, -11866, -11634,
-    -11424, -11228, -11060, -10903, -10729, -10522, -10346, -10144, -9974, -9828, -9604, -9318,
-    -9073, -8769, -8465, -8189, -7956, -7720, -7455, -7167, -6862, -6651, -6614, -6349,
-    -5972, -5585, -5171, -4790, -4441, -4154, -3895, -3744, -3737, -3505, -3158, -2845,
-    -2570, -2348, -2174, -2023, -1826, -1602, -1390, -1198, -1008, -819, -646, -480,
-    -296, -87, 113, 273, 483, 647, 830, 1078, 1335, 1585, 1921, 2217,
-    2490, 2721, 2984, 3311, 3700, 4089, 4299, 4446, 4873, 5321, 5794, 6262,
-    6687, 7089, 7470, 7823, 8002, 8118, 8477, 8867, 9224, 9515, 9755, 9962,
-    10171, 10394, 10626, 10857, 11085, 11305, 11515, 11674, 11799, 11920, 12063, 12175,
-    12270, 12343, 12368, 12456, 12602, 12666, 12727, 12838, 12917, 13001, 13059, 13136,
-    13276, 13449, 13549, 13419, 13412, 13632, 13793, 13999, 14186, 14363, 14544, 14687,
-    14725, 14548, 14488, 14630, 14705, 14754, 14734, 14488, 13663, 12025, 9637, 6829,
-    3978, 1412, -632, -2093, -3073, -3616, -3807, -3747, -3607, -3382, -3162, -2978,
-    -2781, -2639, -2615, -2552, -2557, -2631, -2700, -2777, -2815, -2768, -2677, -2728,
-    -2949, -2884, -2704, -2543, -2311, -2126, -1961, -1793, -1656, -1680, -1850, -1782,
-    -1607, -1479, -1385, -1360, -1392, -1449, -1488, -1498, -1511, -1563, -1618, -1612,
-    -1632, -1679, -1696, -1681, -1713, -1787, -1815, -1856, -1877, -1819, -1800, -1777,
-    -1691, -1670, -1638, -1585, -1559, -1502, -1384, -1285, -1429, -1574, -1415, -1278,
-    -1141, -996, -925, -858, -768, -703, -828, -954, -809, -646, -534, -511,
-    -561, -629, -682, -728, -765, -806, -852, -885, -896, -966, -1018, -1036,
-    -1055, -1166, -1283, -1383, -1497, -1525, -1478, -1525, -1523, -1499, -1526, -1554,
-    -1589, -1613, -1573, -1466, -1454, -1720, -1823, -1700, -1587, -1428, -1298, -1219,
-    -1127, -1045, -1073, -1306, -1373, -1241, -1137, -1040, -979, -970, -993, -1031,
-    -1042, -1034, -1011, -989, -924, -847, -800, -717, -604, -512, -453, -342,
-    -216, -103, 101, 308, 473, 732, 975, 1174, 1359, 1541, 1762, 2041,
-    2365, 2521, 2520, 2761, 3115, 3468, 3836, 4132, 4200, 3763, 2636, 763,
-    -1557, -3721, -5639, -7258, -8503, -9367, -9893, -10085, -9962, -9631, -9166, -8615,
-    -8053, -7485, -6992, -6557, -6175, -5807, -5521, -5300, -5039, -4808, -4577, -4254,
-    -3962, -3683, -3363, -3032, -2725, -2429, -2095, -1732, -1357, -1004, -876, -763,
-    -385, 32, 416, 792, 1136, 1454, 1752, 2015, 2047, 2077, 2380, 2711,
-    2969, 3172, 3337, 3454, 3577, 3737, 3854, 3976, 4106, 4223, 4342, 4439,
-    4546, 4678, 4839, 4962, 5079, 5236, 5372, 5550, 5769, 5925, 6081, 6255,
-    6397, 6498, 6592, 6735, 6913, 7119, 7246, 7151, 7190, 7424, 7639, 7885,
-    8101, 8288, 8443, 8588, 8652, 8476, 8440, 8600, 8738, 8845, 8891, 8893,
-    8857, 8833, 8813, 8751, 8722, 8732, 8759, 8769, 8754, 8686, 8635, 8608,
-    8527, 8465, 8414, 8372, 8394, 8406, 8360, 8322, 8304, 8267, 8210, 8188,
-    8191, 8213, 8247, 8114, 7855, 7843, 7939, 8008, 8090, 8158, 8178, 8171,
-    8172, 8005, 7723, 7693, 7756, 7783, 7785, 7748, 7655, 7549, 7463, 7373,
-    7262, 7208, 7157, 7102, 7063, 7001, 6928, 6899, 6814, 6739, 6706, 6669,
-    6626, 6633, 6627, 6592, 6611, 6626, 6583, 6544, 6504, 6243, 5555, 4319,
-    2362, 129, -1931, -3943, -5767, -7291, -8518, -9456, -10099, -10484, -10872, -11051,
-    -10815, -10518, -10232, -9957, -9766, -9641, -9547, -9448, -9408, -9382, -9326, -9316,
-    -9340, -9373, -9434, -9503, -9547, -9632, -9712, -9732, -9772, -9775, -9741, -9755,
-    -9732, -9670, -9611, -9572, -9515, -9441, -9365, -9289, -9304, -9530, -9583, -9439,
-    -9312, -9155, -8983, -8879, -8804, -8736, -8756, -8976, -9003, -8845, -8741, -8655,
-    -8591, -8582, -8603, -8584, -8548, -8521, -8447, -8375, -8327, -8272, -8243, -8234,
-    -8188, -8146, -8142, -8089, -8024, -7984, -7885, -7768, -7663, -7516, -7343, -7224,
-    -7122, -6988, -6818, -6653, -6494, -6498, -6617, -6467, -6235, -6010, -5763, -5534,
-    -5348, -5192, -5047, -5059, -5209, -5076, -4862, -4689, -4532, -4390, -4316, -4244,
-    -4140, -4055, -3975, -3878, -3765, -3680, -3584, -3491, -3417, -3323, -3229, -3164,
-    -3027, -2925, -2821, -2667, -2528, -2363, -2135, -1923, -1714, -1510, -1269, -1010,
-    -777, -570, -560, -514, -228, 79, 387, 704, 1003, 1268, 1538, 1766,
-    1793, 1847, 2140, 2455, 2726, 2965, 3184, 3335, 3532, 3734, 3879, 4042,
-    4209, 4388, 4583, 4782, 4981, 5180, 5406, 5588, 5741, 5849, 5692, 5215,
-    4359, 3114, 1629, 49, -1573, -3109, -4450, -5531, -6335, -6861, -7224, -7524,
-    -7475, -7090, -6633, -6066, -5473, -4902, -4339, -3810, -3429, -3268, -2947, -2475,
-    -2086, -1733, -1457, -1257, -1112, -950, -793, -669, -513, -385, -248, -103,
-    12, 124, 242, 372, 471, 606, 746, 842, 1022, 1225, 1412, 1676,
-    1939, 2166, 2395, 2612, 2851, 3089, 3343, 3455, 3488, 3771, 4090, 4373,
-    4703, 4982, 5236, 5463, 5697, 5751, 5743, 5991, 6272, 6498, 6702, 6860,
-    6960, 7033, 7145, 7205, 7260, 7340, 7396, 7457, 7515, 7559, 7578, 7606,
-    7609, 7601, 7651, 7673, 7689, 7754, 7798, 7861, 7968, 8057, 8132, 8197,
-    8301, 8404, 8505, 8602, 8487, 8426, 8571, 8684, 8818, 8932, 9043, 9128,
-    9199, 9236, 9021, 8887, 8969, 9020, 9051, 9052, 9019, 8938, 8881, 8838,
-    8740, 8672, 8602, 8519, 8447, 8377, 8300, 8208, 8140, 8045, 7963, 7914,
-    7803, 7724, 7683, 7615, 7605, 7626, 7622, 7609, 7601, 7632, 7661, 7721,
-    7677, 7455, 7415, 7509, 7572, 7670, 7743, 7786, 7809, 7859, 7747, 7459,
-    7362, 7390, 7388, 7367, 7299, 7166, 6992, 6873, 6743, 6570, 6350, 5923,
-    5205, 4173, 2838, 1248, -474, -2233, -3989, -5583, -6995, -8240, -9231, -10017,
-    -10598, -10933, -11096, -11139, -11093, -10937, -10709, -10445, -10135, -10001, -9941, -9659,
-    -9333, -9050, -8779, -8569, -8408, -8298, -8230, -8372, -8600, -8603, -8551, -8557,
-    -8584, -8678, -8820, -8982, -9109, -9229, -9336, -9396, -9452, -9487, -9519, -9570,
-    -9637, -9694, -9748, -9813, -9803, -9805, -9820, -9742, -9689, -9605, -9458, -9337,
-    -9228, -9125, -8981, -8844, -8694, -8564, -8641, -8652, -8439, -8237, -8033, -7815,
-    -7632, -7473, -7309, -7225, -7363, -7426, -7274, -7119, -6989, -6886, -6835, -6846,
-    -6850, -6838, -6850, -6798, -6726, -6663, -6589, -6528, -6489, -6467, -6418, -6385,
-    -6327, -6218, -6125, -6002, -5869, -5746, -5570, -5364, -5172, -4993, -4814, -4628,
-    -4423, -4205, -4116, -4172, -4065, -3803, -3562, -3290, -3051, -2837, -2616, -2430,
-    -2376, -2468, -2392, -2173, -1983, -1795, -1663, -1574, -1517, -1454, -1384, -1290,
-    -1138, -1001, -864, -728, -589, -453, -339, -216, -102, 69, 263, 438,
-    668, 885, 1099, 1390, 1669, 1922, 2185, 2457, 2754, 3047, 3325, 3465,
-    3541, 3830, 4168, 4481, 4836, 5152, 5467, 5768, 6017, 6073, 6050, 6145,
-    6112, 5805, 5206, 4324, 3193, 1912, 594, -768, -2047, -3202, -4231, -5099,
-    -5802, -6332, -6748, -7008, -7122, -7104, -6936, -6706, -6387, -5981, -5549, -5054,
-    -4495, -3965, -3476, -2992, -2536, -2101, -1650, -1268, -1104, -906, -525, -189,
-    129, 433, 693, 935, 1180, 1330, 1267, 1298, 1521, 1742, 1947, 2124,
-    2255, 2337, 2454, 2567, 2648, 2768, 2893, 3030, 3165, 3320, 3456, 3566,
-    3705, 3831, 4003, 4191, 4363, 4578, 4798, 5002, 5249, 5533, 5768, 5976,
-    6187, 6383, 6593, 6835, 6949, 6895, 7001, 7244, 7449, 7661, 7864, 8047,
-    8216, 8377, 8358, 8201, 8230, 8382, 8523, 8643, 8726, 8734, 8694, 8687,
-    8640, 8600, 8599, 8596, 8589, 8576, 8579, 8516, 8455, 8420, 8368, 8368,
-    8346, 8330, 8357, 8371, 8420, 8512, 8631, 8730, 8797, 8877, 8945, 9024,
-    9098, 8985, 8825, 8858, 8945, 9022, 9116, 9199, 9274, 9326, 9311, 9086,
-    8821, 8775, 8789, 8759, 8717, 8637, 8508, 8360, 8217, 8056, 7910, 7800,
-    7691, 7570, 7459, 7355, 7224, 7089, 6960, 6834, 6744, 6645, 6558, 6531,
-    6504, 6531, 6610, 6651, 6682, 6707, 6758, 6797, 6828, 6815, 6606, 6423,
-    6338, 6078, 5610, 4934, 4046, 2971, 1723, 286, -1354, -2873, -4136, -5311,
-    -6380, -7369, -8267, -9042, -9705, -10219, -10639, -10939, -11113, -11195, -11197, -11165,
-    -11086, -10990, -10895, -10767, -10624, -10491, -10363, -10208, -10060, -9922, -9735, -9533,
-    -9362, -9230, -9120, -9023, -8936, -8873, -8941, -9127, -9184, -9111, -9034, -8961,
-    -8885, -8783, -8718, -8723, -8837, -9031, -9082, -9015, -8937, -8891, -8895, -8893,
-    -8920, -8969, -9013, -9053, -9066, -9058, -9014, -8982, -8966, -8920, -8869, -8842,
-    -8829, -8783, -8731, -8674, -8577, -8466, -8333, -8148, -7944, -7756, -7601, -7451,
-    -7285, -7114, -6978, -6978, -7035, -6936, -6740, -6507, -6278, -6061, -5853, -5706,
-    -5637, -5713, -5804, -5708, -5548, -5387, -5272, -5178, -5098, -5047, -4999, -4984,
-    -4967, -4914, -4869, -4804, -4746, -4674, -4594, -4499, -4412, -4317, -4186, -4050,
-    -3911, -3719, -3507, -3261, -2998, -2746, -2506, -2274, -2035, -1779, -1527, -1328,
-    -1280, -1177, -911, -622, -328, -40, 253, 516, 709, 809, 754, 793,
-    1023, 1262, 1472, 1653, 1828, 1953, 2047, 2132, 2189, 2272, 2394, 2526,
-    2689, 2872, 3068, 3252, 3444, 3614, 3802, 3999, 4192, 4407, 4667, 4942,
-    5227, 5411, 5446, 5285, 4925, 4382, 3702, 2886, 1880, 709, -297, -1156,
-    -1958, -2682, -3302, -3802, -4214, -4578, -4964, -5366, -5476, -5357, -5187, -5009,
-    -4798, -4574, -4341, -4085, -3821, -3578, -3294, -2978, -2650, -2321, -1978, -1664,
-    -1360, -1080, -835, -612, -412, -210, 16, 258, 535, 840, 1119, 1395,
-    1675, 1933, 2193, 2469, 2693, 2744, 2761, 2972, 3230, 3499, 3785, 4075,
-    4359, 4605, 4762, 4759, 4738, 4948, 5207, 5426, 5588, 5715, 5804, 5875,
-    5925, 5948, 5936, 5965, 6003, 6055, 6119, 6202, 6273, 6362, 6425, 6492,
-    6546, 6607, 6703, 6830, 6968, 7174, 7382, 7575, 7786, 8016, 8206, 8395,
-    8569, 8645, 8537, 8526, 8677, 8827, 8988, 9151, 9290, 9414, 9467, 9395,
-    9161, 9028, 9075, 9111, 9125, 9098, 9036, 8957, 8868, 8737, 8568, 8404,
-    8290, 8183, 8078, 7974, 7874, 7788, 7723, 7647, 7596, 7546, 7527, 7552,
-    7588, 7649, 7777, 7896, 8005, 8130, 8261, 8349, 8453, 8536, 8480, 8305,
-    8311, 8403, 8494, 8600, 8710, 8791, 8840, 8788, 8580, 8265, 8124, 8056,
-    7971, 7877, 7743, 7569, 7412, 7255, 7067, 6856, 6677, 6520, 6373, 6234,
-    6073, 5846, 5562, 5143, 4565, 3846, 2970, 2008, 1005, -63, -1127, -2168,
-    -3211, -4230, -5165, -6024, -6813, -7496, -8121, -8825, -9444, -9772, -9979, -10097,
-    -10124, -10093, -10036, -9978, -9996, -10136, -10240, -10137, -10017, -9885, -9754, -9670,
-    -9628, -9576, -9578, -9638, -9714, -9777, -9853, -9907, -9948, -10010, -10084, -10137,
-    -10242, -10339, -10408, -10469, -10478, -10433, -10386, -10287, -10161, -10042, -9929, -9767,
-    -9604, -9440, -9277, -9196, -9287, -9265, -9072, -8868, -8653, -8418, -8192, -7992,
-    -7858, -7856, -7983, -7989, -7869, -7786, -7682, -7604, -7576, -7568, -7557, -7606,
-    -7679, -7725, -7769, -7802, -7779, -7751, -7743, -7703, -7658, -7660, -7627, -7571,
-    -7528, -7427, -7292, -7148, -6952, -6736, -6532, -6333, -6105, -5888, -5667, -5449,
-    -5358, -5380, -5207, -4935, -4671, -4396, -4098, -3802, -3530, -3345, -3314, -3343,
-    -3196, -3000, -2826, -2636, -2477, -2348, -2226, -2140, -2123, -2084, -2015, -1956,
-    -1851, -1706, -1568, -1434, -1271, -1157, -1086, -965, -831, -696, -487, -265,
-    -14, 274, 559, 819, 1093, 1377, 1660, 1943, 2184, 2254, 2319, 2587,
-    2900, 3216, 3552, 3897, 4226, 4518, 4697, 4732, 4803, 5059, 5322, 5584,
-    5839, 6031, 6127, 6125, 5956, 5617, 5177, 4622, 3959, 3250, 2492, 1662,
-    797, -67, -980, -1866, -2652, -3372, -3989, -4464, -4863, -5132, -5304, -5405,
-    -5447, -5402, -5296, -5118, -4888, -4688, -4621, -4415, -4021, -3603, -3171, -2715,
-    -2266, -1822, -1423, -1169, -1054, -833, -479, -158, 157, 474, 748, 979,
-    1184, 1311, 1416, 1549, 1679, 1829, 2018, 2219, 2388, 2544, 2678, 2751,
-    2850, 2998, 3139, 3336, 3559, 3783, 4047, 4300, 4536, 4773, 5023, 5265,
-    5514, 5744, 5831, 5809, 5969, 6226, 6482, 6743, 7006, 7221, 7422, 7547,
-    7494, 7367, 7413, 7529, 7610, 7687, 7767, 7790, 7802, 7800, 7745, 7708,
-    7697, 7686, 7709, 7763, 7819, 7841, 7872, 7870, 7841, 7855, 7889, 7927,
-    8033, 8136, 8261, 8402, 8529, 8632, 8743, 8850, 8960, 9087, 9168, 9062,
-    8957, 9037, 9149, 9254, 9373, 9471, 9519, 9561, 9493, 9246, 9043, 9032,
-    9035, 9004, 8983, 8954, 8868, 8782, 8644, 8463, 8319, 8193, 8080, 8018,
-    7996, 7961, 7893, 7819, 7699, 7590, 7531, 7480, 7452, 7469, 7459, 7467,
-    7478, 7480, 7473, 7488, 7488, 7501, 7524, 7452, 7219, 7110, 7148, 7200,
-    7261, 7326, 7310, 7205, 7012, 6569, 5871, 5203, 4565, 3806, 2952, 2047,
-    1061, -9, -1110, -2281, -3455, -4540, -5559, -6492, -7299, -8015, -8692, -9307,
-    -9869, -10400, -10833, -11165, -11435, -11606, -11704, -11759, -11742, -11674, -11582, -11477,
-    -11350, -11209, -11023, -10832, -10788, -10828, -10685, -10463, -10232, -9995, -9767, -9606,
-    -9479, -9408, -9527, -9709, -9691, -9612, -9560, -9510, -9456, -9449, -9473, -9517,
-    -9624, -9719, -9764, -9810, -9817, -9763, -9698, -9661, -9625, -9619, -9632, -9608,
-    -9568, -9523, -9432, -9330, -9217, -9082, -8929, -8782, -8647, -8512, -8346, -8152,
-    -8013, -8048, -8057, -7896, -7689, -7463, -7240, -7038, -6881, -6737, -6682, -6809,
-    -6894, -6799, -6692, -6588, -6496, -6403, -6350, -6302, -6291, -6326, -6329, -6304,
-    -6268, -6164, -6008, -5864, -5747, -5631, -5545, -5453, -5313, -5154, -4971, -4755,
-    -4538, -4310, -4080, -3841, -3610, -3392, -3161, -2877, -2601, -2450, -2432, -2276,
-    -1992, -1684, -1359, -1068, -816, -579, -370, -302, -355, -264, -65, 132,
-    344, 527, 681, 814, 949, 1034, 1114, 1237, 1348, 1485, 1691, 1907,
-    2076, 2244, 2426, 2595, 2784, 2992, 3197, 3438, 3696, 3969, 4272, 4584,
-    4890, 5169, 5409, 5657, 5916, 6078, 5992, 5762, 5603, 5398, 5118, 4752,
-    4257, 3680, 3070, 2366, 1470, 556, -160, -800, -1398, -1951, -2495, -3000,
-    -3436, -3832, -4231, -4541, -4771, -4958, -5035, -5011, -4973, -4928, -4824, -4690,
-    -4544, -4353, -4121, -3832, -3476, -3114, -2740, -2355, -1983, -1613, -1245, -885,
-    -470, -10, 374, 581, 828, 1233, 1655, 2102, 2520, 2855, 3155, 3438,
-    3613, 3638, 3748, 3998, 4222, 4445, 4640, 4783, 4913, 5025, 5067, 5059,
-    5097, 5145, 5198, 5309, 5449, 5550, 5639, 5725, 5775, 5813, 5875, 5947,
-    6057, 6174, 6273, 6417, 6578, 6710, 6831, 6947, 7071, 7254, 7479, 7588,
-    7567, 7690, 7932, 8169, 8411, 8583, 8695, 8806, 8911, 8865, 8704, 8675,
-    8743, 8795, 8867, 8908, 8916, 8924, 8922, 8833, 8706, 8611, 8530, 8494,
-    8509, 8508, 8470, 8441, 8404, 8337, 8280, 8234, 8207, 8227, 8229, 8235,
-    8292, 8337, 8356, 8383, 8428, 8493, 8610, 8720, 8654, 8536, 8593, 8704,
-    8796, 8891, 8935, 8922, 8898, 8837, 8625, 8393, 8320, 8299, 8271, 8255,
-    8177, 8047, 7917, 7771, 7575, 7380, 7201, 7030, 6906, 6853, 6810, 6753,
-    6695, 6614, 6519, 6418, 6271, 6119, 5950, 5683, 5359, 4983, 4498, 3923,
-    3292, 2611, 1897, 1204, 429, -545, -1496, -2281, -3011, -3708, -4404, -5134,
-    -5835, -6454, -7112, -7886, -8542, -8985, -9375, -9747, -10077, -10383, -10654, -10900,
-    -11165, -11441, -11664, -11838, -11950, -11970, -11931, -11871, -11819, -11771, -11724, -11672,
-    -11594, -11507, -11371, -11215, -11081, -10904, -10725, -10576, -10428, -10292, -10152, -9976,
-    -9775, -9721, -9830, -9818, -9658, -9470, -9270, -9119, -9019, -8952, -8952, -9077,
-    -9246, -9278, -9216, -9160, -9086, -9007, -8966, -8971, -9009, -9070, -9135, -9157,
-    -9124, -9043, -8919, -8762, -8564, -8347, -8157, -7993, -7831, -7674, -7506, -7314,
-    -7123, -6934, -6753, -6636, -6556, -6428, -6268, -6130, -6050, -6063, -6100, -6021,
-    -5812, -5617, -5488, -5343, -5223, -5200, -5221, -5260, -5307, -5304, -5219, -5101,
-    -4991, -4852, -4720, -4629, -4532, -4438, -4348, -4233, -4072, -3871, -3657, -3410,
-    -3126, -2816, -2494, -2198, -1920, -1646, -1371, -1096, -837, -594, -385, -214,
-    -40, 177, 426, 576, 555, 513, 593, 801, 1096, 1370, 1545, 1676,
-    1782, 1803, 1787, 1791, 1798, 1839, 1962, 2156, 2379, 2614, 2835, 3024,
-    3211, 3425, 3663, 3903, 4135, 4359, 4586, 4819, 5011, 5119, 5153, 5121,
-    5027, 4874, 4645, 4316, 3909, 3448, 2939, 2417, 1911, 1436, 953, 317,
-    -454, -1129, -1602, -1926, -2154, -2349, -2593, -2910, -3239, -3562, -3886, -4162,
-    -4378, -4553, -4645, -4621, -4517, -4393, -4253, -4074, -3869, -3633, -3361, -3084,
-    -2802, -2467, -2063, -1611, -1131, -651, -178, 322, 856, 1395, 1895, 2331,
-    2697, 2994, 3302, 3664, 4039, 4401, 4629, 4671, 4670, 4755, 4965, 5254,
-    5552, 5843, 6066, 6135, 6094, 6025, 5925, 5807, 5712, 5612, 5526, 5522,
-    5568, 5591, 5620, 5703, 5800, 5887, 5972, 6040, 6097, 6181, 6315, 6479,
-    6659, 6863, 7080, 7330, 7636, 7934, 8176, 8354, 8461, 8546, 8677, 8871,
-    9091, 9219, 9151, 8988, 8889, 8882, 8954, 9087, 9231, 9361, 9456, 9432,
-    9269, 9080, 8915, 8742, 8566, 8392, 8225, 8104, 8037, 8002, 7996, 8016,
-    8050, 8078, 8097, 8109, 8109, 8106, 8122, 8162, 8221, 8309, 8422, 8565,
-    8743, 8915, 9032, 9058, 9023, 8991, 8990, 9042, 9088, 8966, 8692, 8451,
-    8311, 8231, 8166, 8120, 8095, 8070, 8019, 7900, 7688, 7436, 7201, 6958,
-    6694, 6462, 6253, 6053, 5905, 5820, 5762, 5687, 5575, 5417, 5200, 4907,
-    4531, 4078, 3562, 3005, 2439, 1873, 1328, 798, 250, -323, -957, -1658,
-    -2369, -3058, -3712, -4329, -4998, -5778, -6558, -7205, -7720, -8171, -8611, -9044,
-    -9436, -9795, -10133, -10445, -10763, -11110, -11450, -11749, -12024, -12273, -12495, -12701,
-    -12833, -12841, -12759, -12617, -12441, -12244, -12040, -11854, -11681, -11518, -11369, -11207,
-    -11003, -10741, -10424, -10079, -9744, -9450, -9206, -8992, -8789, -8594, -8407, -8301,
-    -8358, -8483, -8533, -8482, -8381, -8302, -8281, -8312, -8370, -8433, -8502, -8559,
-    -8599, -8677, -8815, -8956, -9078, -9218, -9360, -9466, -9528, -9510, -9405, -9254,
-    -9076, -8886, -8704, -8538, -8386, -8239, -8104, -7965, -7784, -7542, -7247, -6912,
-    -6584, -6315, -6060, -5777, -5493, -5212, -4990, -4935, -5015, -5046, -4922, -4704,
-    -4472, -4274, -4139, -4061, -4035, -4032, -4012, -3954, -3846, -3735, -3691, -3697,
-    -3696, -3699, -3710, -3682, -3606, -3486, -3292, -3035, -2757, -2474, -2190, -1908,
-    -1647, -1410, -1183, -948, -678, -361, -12, 346, 675, 963, 1265, 1624,
-    2007, 2355, 2570, 2584, 2528, 2593, 2812, 3110, 3416, 3684, 3885, 4005,
-    4051, 4060, 4099, 4205, 4361, 4535, 4669, 4698, 4642, 4559, 4446, 4296,
-    4131, 3935, 3715, 3517, 3320, 3086, 2815, 2517, 2175, 1781, 1373, 988,
-    630, 302, -7, -326, -651, -947, -1180, -1327, -1408, -1526, -1798, -2189,
-    -2529, -2707, -2752, -2725, -2670, -2628, -2613, -2643, -2727, -2839, -2913, -2894,
-    -2790, -2625, -2430, -2294, -2242, -2169, -2015, -1828, -1632, -1423, -1199, -914,
-    -551, -157, 238, 631, 1012, 1377, 1743, 2128, 2524, 2917, 3288, 3600,
-    3883, 4215, 4598, 5008, 5421, 5701, 5762, 5759, 5847, 6017, 6222, 6431,
-    6612, 6744, 6823, 6851, 6811, 6704, 6583, 6502, 6483, 6518, 6568, 6573,
-    6501, 6410, 6375, 6375, 6362, 6344, 6347, 6385, 6484, 6640, 6812, 6981,
-    7150, 7332, 7540, 7755, 7958, 8146, 8298, 8396, 8500, 8686, 8936, 9195,
-    9393, 9446, 9386, 9371, 9461, 9575, 9673, 9759, 9818, 9836, 9805, 9736,
-    9640, 9497, 9310, 9126, 8995, 8925, 8876, 8817, 8730, 8610, 8491, 8396,
-    8292, 8170, 8059, 7963, 7911, 7924, 7955, 7984, 8026, 8089, 8162, 8226,
-    8272, 8281, 8238, 8180, 8161, 8204, 8310, 8404, 8360, 8189, 8041, 8005,
-    8041, 8074, 8068, 8022, 7937, 7824, 7677, 7481, 7254, 6987, 6647, 6244,
-    5828, 5408, 4957, 4481, 3984, 3423, 2785, 2114, 1428, 709, -40, -800,
-    -1547, -2235, -2862, -3446, -3987, -4494, -4989, -5479, -5961, -6476, -7031, -7529,
-    -7933, -8261, -8513, -8795, -9226, -9705, -10045, -10222, -10316, -10400, -10519, -10670,
-    -10836, -11001, -11147, -11283, -11408, -11505, -11588, -11689, -11805, -11893, -11924, -11876,
-    -11763, -11644, -11562, -11500, -11416, -11332, -11279, -11226, -11160, -11062, -10886, -10632,
-    -10341, -10050, -9771, -9522, -9327, -9201, -9130, -9040, -8892, -8699, -8515, -8458,
-    -8533, -8605, -8560, -8395, -8196, -8027, -7933, -7928, -7972, -8046, -8118, -8152,
-    -8165, -8171, -8187, -8252, -8379, -8500, -8526, -8452, -8321, -8171, -8036, -7929,
-    -7836, -7741, -7656, -7565, -7466, -7375, -7226, -6958, -6615, -6260, -5927, -5637,
-    -5420, -5248, -5067, -4869, -4643, -4367, -4154, -4097, -4069, -3950, -3736, -3426,
-    -3096, -2822, -2619, -2510, -2467, -2441, -2409, -2343, -2245, -2136, -2051, -2030,
-    -2068, -2105, -2048, -1897, -1710, -1505, -1292, -1089, -919, -765, -610, -467,
-    -330, -197, -22, 257, 629, 1042, 1440, 1784, 2058, 2297, 2561, 2839,
-    3126, 3430, 3638, 3714, 3818, 4053, 4366, 4717, 5072, 5354, 5541, 5624,
-    5579, 5443, 5268, 5077, 4875, 4663, 4398, 4016, 3547, 3058, 2599, 2190,
-    1801, 1419, 1062, 719, 355, -41, -441, -849, -1258, -1630, -1943, -2175,
-    -2297, -2322, -2329, -2384, -2482, -2564, -2590, -2586, -2576, -2605, -2718, -2840,
-    -2866, -2746, -2507, -2244, -1980, -1718, -1494, -1319, -1202, -1127, -1036, -907,
-    -743, -544, -329, -151, -3, 160, 338, 550, 817, 1110, 1433, 1784,
-    2129, 2432, 2695, 2936, 3153, 3373, 3627, 3902, 4228, 4628, 5030, 5356,
-    5612, 5860, 6123, 6374, 6571, 6634, 6573, 6557, 6656, 6830, 7070, 7305,
-    7470, 7599, 7693, 7730, 7708, 7653, 7588, 7531, 7497, 7466, 7435, 7409,
-    7383, 7370, 7360, 7342, 7347, 7387, 7463, 7585, 7735, 7857, 7924, 7959,
-    7986, 8030, 8120, 8237, 8376, 8558, 8754, 8920, 9064, 9206, 9367, 9538,
-    9622, 9509, 9280, 9145, 9174, 9286, 9434, 9573, 9630, 9619, 9591, 9532,
-    9422, 9274, 9094, 8907, 8749, 8606, 8448, 8289, 8143, 8006, 7877, 7737,
-    7590, 7476, 7398, 7357, 7359, 7365, 7333, 7260, 7182, 7132, 7121, 7140,
-    7161, 7171, 7195, 7259, 7366, 7473, 7553, 7610, 7559, 7335, 7062, 6874,
-    6780, 6713, 6609, 6447, 6202, 5857, 5435, 4957, 4424, 3827, 3159, 2425,
-    1655, 902, 170, -551, -1254, -1955, -2662, -3376, -4104, -4808, -5469, -6082,
-    -6615, -7080, -7534, -8016, -8491, -8911, -9282, -9605, -9907, -10239, -10542, -10724,
-    -10790, -10810, -10839, -10915, -11090, -11326, -11501, -11566, -11545, -11464, -11365, -11268,
-    -11164, -11071, -11029, -11007, -10967, -10928, -10913, -10941, -11010, -11052, -11019, -10944,
-    -10854, -10763, -10686, -10621, -10579, -10556, -10517, -10445, -10334, -10178, -10008, -9865,
-    -9751, -9639, -9541, -9452, -9359, -9309, -9271, -9148, -8941, -8691, -8453, -8337,
-    -8374, -8436, -8410, -8305, -8158, -7989, -7825, -7686, -7563, -7433, -7322, -7246,
-    -7160, -7063, -6984, -6939, -6943, -6962, -6939, -6859, -6747, -6617, -6484, -6366,
-    -6273, -6211, -6144, -6026, -5886, -5726, -5524, -5294, -5064, -4855, -4674, -4525,
-    -4403, -4296, -4178, -3997, -3747, -3445, -3155, -3005, -2980, -2925, -2769, -2560,
-    -2343, -2122, -1898, -1691, -1523, -1372, -1203, -1044, -887, -715, -576, -480,
-    -410, -354, -273, -140, 34, 237, 476, 727, 940, 1089, 1205, 1359,
-    1568, 1815, 2112, 2442, 2770, 3072, 3342, 3581, 3769, 3928, 4105, 4306,
-    4536, 4790, 4987, 5027, 4946, 4877, 4855, 4829, 4742, 4600, 4433, 4227,
-    3974, 3680, 3365, 3023, 2635, 2224, 1809, 1396, 990, 579, 173, -206,
-    -544, -844, -1123, -1391, -1672, -1963, -2235, -2468, -2645, -2783, -2885, -2936,
-    -2948, -2937, -2926, -2915, -2901, -2865, -2774, -2655, -2512, -2307, -2068, -1836,
-    -1603, -1353, -1085, -806, -530, -261, 39, 366, 694, 1031, 1362, 1681,
-    1963, 2179, 2395, 2655, 2933, 3200, 3442, 3651, 3851, 4079, 4309, 4497,
-    4646, 4761, 4861, 4953, 5050, 5161, 5264, 5370, 5496, 5622, 5727, 5799,
-    5848, 5896, 5960, 6031, 6083, 6147, 6245, 6369, 6508, 6629, 6724, 6810,
-    6900, 6979, 7046, 7144, 7278, 7423, 7560, 7674, 7769, 7825, 7867, 7945,
-    8034, 8109, 8168, 8202, 8220, 8259, 8325, 8367, 8384, 8383, 8348, 8285,
-    8210, 8154, 8120, 8089, 8080, 8083, 8078, 8051, 7990, 7900, 7794, 7701,
-    7618, 7545, 7518, 7533, 7564, 7578, 7549, 7484, 7412, 7355, 7308, 7286,
-    7311, 7343, 7351, 7336, 7312, 7279, 7220, 7175, 7173, 7180, 7165, 7117,
-    7039, 6963, 6932, 6929, 6913, 6876, 6803, 6688, 6561, 6435, 6326, 6224,
-    6122, 6030, 5933, 5802, 5609, 5342, 5024, 4698, 4382, 4057, 3727, 3409,
-    3088, 2738, 2331, 1873, 1401, 941, 493, 52, -376, -787, -1205, -1644,
-    -2098, -2543, -2986, -3428, -3843, -4239, -4634, -5020, -5405, -5783, -6129, -6435,
-    -6727, -7024, -7330, -7649, -7967, -8266, -8520, -8717, -8886, -9033, -9148, -9248,
-    -9343, -9437, -9535, -9621, -9663, -9662, -9636, -9584, -9519, -9458, -9403, -9357,
-    -9310, -9246, -9163, -9064, -8954, -8831, -8700, -8578, -8471, -8369, -8262, -8170,
-    -8101, -8036, -7971, -7911, -7851, -7793, -7739, -7680, -7610, -7552, -7527, -7542,
-    -7587, -7627, -7634, -7595, -7528, -7468, -7411, -7345, -7273, -7196, -7122, -7063,
-    -6989, -6865, -6713, -6562, -6413, -6270, -6126, -5970, -5817, -5675, -5528, -5356,
-    -5166, -4972, -4787, -4606, -4421, -4237, -4061, -3910, -3791, -3685, -3575, -3464,
-    -3361, -3269, -3189, -3104, -3011, -2931, -2882, -2859, -2863, -2882, -2900, -2901,
-    -2879, -2843, -2795, -2728, -2646, -2561, -2473, -2391, -2310, -2197, -2055, -1910,
-    -1758, -1588, -1410, -1228, -1040, -856, -671, -466, -258, -53, 169, 422,
-    703, 972, 1210, 1425, 1611, 1767, 1921, 2090, 2265, 2439, 2604, 2742,
-    2858, 2950, 3003, 3027, 3035, 3006, 2931, 2831, 2736, 2657, 2577, 2473,
-    2355, 2232, 2101, 1974, 1845, 1705, 1568, 1430, 1293, 1163, 1033, 893,
-    755, 630, 513, 400, 285, 159, 55, 5, -5, -12, -45, -100,
-    -159, -221, -283, -333, -360, -372, -381, -404, -441, -475, -500, -523,
-    -550, -592, -655, -730, -793, -823, -819, -789, -747, -694, -625, -538,
-    -442, -352, -254, -137, -8, 131, 282, 437, 591, 746, 892, 1017,
-    1137, 1269, 1423, 1617, 1833, 2056, 2264, 2426, 2551, 2659, 2763, 2883,
-    3028, 3172, 3294, 3381, 3443, 3502, 3575, 3646, 3688, 3703, 3700, 3675,
-    3644, 3624, 3625, 3656, 3711, 3787, 3873, 3953, 4043, 4143, 4232, 4322,
-    4413, 4491, 4579, 4699, 4841, 4984, 5096, 5158, 5192, 5244, 5335, 5446,
-    5569, 5701, 5829, 5936, 5990, 5995, 5976, 5952, 5954, 5975, 5968, 5931,
-    5879, 5827, 5773, 5701, 5593, 5446, 5286, 5120, 4955, 4800, 4665, 4560,
-    4472, 4396, 4342, 4299, 4267, 4240, 4215, 4192, 4181, 4182, 4196, 4245,
-    4315, 4373, 4419, 4443, 4446, 4461, 4526, 4620, 4715, 4816, 4908, 4986,
-    5047, 5072, 5062, 5012, 4947, 4894, 4840, 4775, 4671, 4526, 4366, 4185,
-    3973, 3709, 3400, 3077, 2739, 2391, 2048, 1708, 1372, 1046, 736, 443,
-    175, -88, -372, -669, -958, -1217, -1449, -1652, -1841, -2045, -2252, -2461,
-    -2668, -2853, -3024, -3174, -3300, -3404, -3471, -3533, -3610, -3708, -3829, -3957,
-    -4092, -4227, -4345, -4432, -4488, -4546, -4623, -4727, -4854, -4988, -5131, -5281,
-    -5440, -5597, -5742, -5864, -5959, -6049, -6122, -6158, -6164, -6155, -6157, -6176,
-    -6200, -6200, -6156, -6093, -6028, -5967, -5923, -5884, -5842, -5792, -5744, -5686,
-    -5605, -5517, -5411, -5295, -5186, -5086, -5020, -4979, -4949, -4923, -4876, -4805,
-    -4716, -4626, -4554, -4496, -4453, -4421, -4405, -4396, -4370, -4346, -4339, -4330,
-    -4296, -4234, -4144, -4035, -3927, -3806, -3674, -3553, -3433, -3312, -3171, -3015,
-    -2870, -2735, -2627, -2532, -2425, -2328, -2248, -2182, -2119, -2055, -1986, -1893,
-    -1801, -1734, -1694, -1690, -1712, -1752, -1791, -1792, -1751, -1695, -1652, -1640,
-    -1667, -1695, -1702, -1704, -1697, -1694, -1698, -1679, -1631, -1555, -1459, -1350,
-    -1212, -1044, -855, -668, -477, -272, -55, 185, 410, 609, 806, 994,
-    1186, 1377, 1539, 1668, 1789, 1910, 2020, 2142, 2272, 2373, 2437, 2439,
-    2388, 2322, 2246, 2180, 2124, 2057, 1964, 1839, 1687, 1526, 1379, 1229,
-    1060, 889, 709, 522, 350, 205, 87, -4, -62, -124, -194, -238,
-    -259, -255, -238, -223, -213, -209, -185, -138, -86, -34, -2, 11,
-    18, 28, 60, 113, 192, 284, 348, 373, 363, 328, 290, 276,
-    289, 319, 351, 352, 332, 312, 291, 275, 251, 213, 165, 115,
-    82, 67, 77, 109, 148, 195, 252, 337, 447, 543, 633, 728,
-    828, 927, 1020, 1120, 1234, 1360, 1472, 1544, 1593, 1651, 1740, 1851,
-    1959, 2067, 2170, 2262, 2331, 2364, 2379, 2404, 2455, 2521, 2587, 2648,
-    2687, 2715, 2748, 2774, 2787, 2783, 2778, 2782, 2794, 2815, 2844, 2878,
-    2907, 2950, 3031, 3120, 3212, 3303, 3376, 3436, 3496, 3555, 3604, 3659,
-    3721, 3763, 3787, 3787, 3757, 3721, 3696, 3689, 3683, 3669, 3655, 3626,
-    3576, 3506, 3416, 3317, 3223, 3150, 3096, 3060, 3029, 2983, 2930, 2868,
-    2808, 2747, 2671, 2607, 2565, 2538, 2524, 2516, 2515, 2532, 2582, 2647,
-    2719, 2796, 2846, 2875, 2911, 2969, 3053, 3126, 3166, 3178, 3169, 3146,
-    3094, 3002, 2890, 2798, 2721, 2632, 2538, 2417, 2260, 2090, 1896, 1681,
-    1464, 1242, 1030, 852, 695, 513, 294, 59, -172, -379, -588, -798,
-    -988, -1168, -1339, -1497, -1643, -1765, -1855, -1912, -1954, -1995, -2041, -2092,
-    -2130, -2144, -2136, -2133, -2142, -2141, -2147, -2170, -2199, -2252, -2313, -2363,
-    -2414, -2473, -2517, -2535, -2553, -2586, -2661, -2779, -2898, -2999, -3076, -3128,
-    -3172, -3225, -3306, -3408, -3508, -3606, -3710, -3812, -3889, -3949, -4013, -4083,
-    -4157, -4207, -4221, -4208, -4189, -4185, -4172, -4135, -4087, -4016, -3920, -3826,
-    -3740, -3649, -3564, -3492, -3412, -3336, -3272, -3204, -3144, -3080, -2992, -2877,
-    -2750, -2630, -2544, -2489, -2438, -2387, -2339, -2270, -2190, -2111, -2037, -1987,
-    -1965, -1947, -1922, -1900, -1902, -1912, -1920, -1918, -1908, -1904, -1891, -1869,
-    -1834, -1806, -1794, -1775, -1745, -1701, -1646, -1574, -1504, -1471, -1429, -1375,
-    -1331, -1279, -1238, -1223, -1206, -1180, -1101, -1030, -938, -824, -730, -644,
-    -588, -521, -474, -405, -315, -195, -41, 59, 144, 198, 260, 319,
-    356, 383, 435, 523, 580, 644, 661, 705, 777, 832, 883, 912,
-    969, 1008, 1062, 1088, 1110, 1135, 1092, 1075, 1052, 1041, 973, 872,
-    805, 731, 647, 613, 546, 521, 517, 476, 439, 379, 282, 182,
-    103, 89, 101, 105, 55, 8, -26, -67, -94, -155, -194, -206,
-    -155, -159, -158, -175, -138, -131, -65, -1, 54, 139, 211, 287,
-    369, 440, 481, 500, 521, 596, 621, 626, 611, 638, 648, 633,
-    638, 644, 688, 706, 719, 750, 678, 624, 611, 601, 589, 631,
-    624, 566, 540, 500, 467, 426, 346, 361, 353, 374, 421, 378,
-    385, 392, 427, 509, 585, 628, 730, 856, 963, 1064, 1140, 1238,
-    1348, 1436, 1505, 1539, 1587, 1651, 1780, 1832, 1825, 1904, 1961, 2063,
-    2224, 2283, 2367, 2429, 2417, 2467, 2456, 2529, 3106, 5383, 8994, 9257,
-    8987, 8816, 8632, 8552, 8524, 8356, 8131, 7748, 7372, 7399, 7460, 6633,
-    6702, 6373, 5945, 5712, 5840, 6564, 6045, 5352, 4658, 5174, 5041, 6226,
-    6096, 7169, 7836, 9028, 9277, 9212, 8375, 7204, 5020, 1733, -1551, -4819,
-    -6975, -8800, -9684, -9609, -10335, -12483, -15982, -16527, -13367, -10186, -8566, -7060,
-    -1807, 5755, 10157, 8469, 10189, 13110, 14155, 13613, 12947, 16464, 17855, 17507,
-    16038, 12109, -1539, -14242, -5401, 11010, 1295, -1982, -2923, -1824, -2836, -2180,
-    -3141, -6284, -4816, 2164, 11538, 14587, 14715, 14868, 14531, 13117, 11314, 8502,
-    6318, 4305, 1487, -2147, -5382, -7888, -9161, -10025, -11081, -12422, -13776, -14980,
-    -14965, -15717, -15996, -16041, -16519, -17031, -17267, -17009, -16983, -17371, -16914, -16110,
-    -16093, -15717, -15320, -14734, -14650, -13117, -10914, -11597, -14199, -15977, -15983, -16086,
-    -15142, -14530, -13962, -12432, -10007, -7750, -4313, -573, 2523, 4704, 6963, 8629,
-    9566, 10805, 12228, 13135, 13802, 14637, 14649, 15284, 16295, 16773, 16563, 16709,
-    16470, 16576, 16393, 15993, 15796, 15082, 14848, 14855, 14862, 14633, 13952, 12923,
-    12697, 11899, 11255, 10274, 9300, 8446, 7888, 8137, 8451, 9654, 10412, 10690,
-    10478, 10069, 9145, 8432, 7464, 5261, 2151, -1544, -5289, -8284, -10250, -12029,
-    -13487, -14715, -16035, -17061, -18249, -19098, -19780, -19868, -20160, -20932, -21435, -21411,
-    -21288, -21194, -20892, -20464, -20019, -19661, -19448, -19219, -18989, -18832, -18040, -17071,
-    -16652, -16832, -17474, -18069, -18317, -18017, -17504, -16806, -15984, -15424, -14701, -13389,
-    -11178, -8714, -6508, -4052, -911, 1865, 4419, 6403, 7665, 8768, 10032, 11018,
-    11750, 12782, 13531, 14182, 14762, 15199, 15372, 15740, 15968, 16004, 15646, 15286,
-    15067, 14883, 14387, 13514, 12775, 12152, 11892, 11773, 11441, 11248, 11045, 10669,
-    9826, 8841, 8181, 8052, 8749, 9978, 11113, 12224, 12919, 13268, 12872, 11623,
-    9746, 7613, 5510, 2782, -459, -3817, -6235, -7921, -9510, -10949, -12027, -12866,
-    -13560, -14271, -14969, -15646, -16209, -16725, -17172, -17326, -17418, -17375, -16922, -16415,
-    -16085, -15819, -15377, -15133, -14853, -14461, -13862, -13330, -12945, -12269, -11455, -10952,
-    -10566, -9829, -8787, -7640, -7003, -7125, -7541, -8051, -8428, -8685, -8947, -8915,
-    -8754, -8131, -6771, -4834, -1718, 1886, 5280, 7688, 9729, 11707, 13440, 14988,
-    16392, 17798, 18931, 19845, 20734, 21675, 22263, 22517, 22607, 22733, 22647, 22191,
-    22033, 22061, 22002, 21732, 21498, 21221, 20672, 20110, 19435, 18628, 17717, 16823,
-    16127, 15301, 14569, 13856, 13204, 12490, 11703, 10905, 10285, 9473, 8529, 7779,
-    7788, 8047, 8303, 8762, 9267, 9594, 9753, 9918, 9965, 9083, 7576, 5547,
-    2662, -386, -3432, -5390, -6889, -8563, -10369, -12145, -13520, -14762, -15744, -16377,
-    -16828, -17294, -17745, -17625, -17431, -17657, -17991, -17987, -17762, -17391, -17209, -17034,
-    -16833, -16501, -16178, -15792, -15326, -14601, -13903, -13191, -12339, -11629, -10946, -10276,
-    -9702, -9160, -8471, -7666, -6931, -6198, -5667, -5464, -5514, -5701, -5834, -5760,
-    -5784, -5918, -6105, -6330, -6371, -6114, -4812, -2535, 291, 3232, 5411, 7117,
-    8978, 10736, 12520, 13873, 14810, 15561, 16211, 16728, 17102, 17568, 18043, 18390,
-    18504, 18615, 18842, 18787, 18575, 18333, 18099, 17805, 17466, 16934, 16434, 16061,
-    15719, 15135, 14376, 13447, 12719, 12086, 11485, 10980, 10392, 9681, 8863, 7878,
-    6778, 5788, 4953, 4183, 3345, 2402, 1270, -102, -1542, -2470, -2891, -3077,
-    -3212, -3261, -3197, -3094, -3209, -3450, -3654, -3968, -4200, -4528, -5682, -7224,
-    -8687, -10219, -11863, -13228, -14540, -15663, -16733, -17791, -18825, -19652, -20532, -21377,
-    -21959, -22179, -22231, -22141, -21837, -21602, -21308, -21102, -21007, -20861, -20608, -20279,
-    -19964, -19455, -18890, -18339, -17715, -17046, -16231, -15418, -14751, -14140, -13427, -12757,
-    -12171, -11596, -11018, -10297, -9461, -8714, -8011, -7261, -6294, -5073, -3514, -1811,
-    -794, -380, -189, -157, -75, 167, 557, 907, 1398, 2158, 3174, 4216,
-    5205, 6177, 7399, 8918, 10448, 11863, 13274, 14818, 16300, 17622, 18896, 19931,
-    20806, 21557, 22231, 22803, 23142, 23222, 23286, 23297, 23262, 23122, 22890, 22516,
-    22089, 21547, 20868, 20117, 19501, 18818, 18015, 17232, 16490, 15845, 15183, 14648,
-    14038, 13419, 12783, 11981, 11084, 10284, 9610, 8960, 8230, 7654, 7038, 6298,
-    5322, 4149, 2911, 1691, 535, -543, -1518, -2567, -3758, -4773, -5270, -5537,
-    -5732, -5872, -5904, -5961, -6190, -6518, -6966, -7425, -7893, -8412, -8925, -9499,
-    -10049, -10378, -10562, -10840, -11567, -12578, -13740, -14907, -16157, -17402, -18403, -19278,
-    -20075, -20663, -21092, -21528, -21823, -21952, -21920, -21756, -21502, -21260, -21084, -20697,
-    -20209, -19709, -19083, -18488, -17854, -17186, -16612, -16039, -15423, -14810, -14177, -13573,
-    -12817, -11947, -11087, -10189, -9413, -8669, -7922, -7130, -6193, -5418, -4537, -3461,
-    -2222, -853, 385, 1484, 2536, 3534, 4613, 5627, 6461, 7093, 7706, 8540,
-    9053, 9224, 9272, 9280, 9252, 9176, 9037, 8801, 8736, 8923, 9293, 9728,
-    10260, 10880, 11495, 12099, 12508, 13281, 14422, 15628, 16896, 18102, 19189, 20211,
-    21114, 21847, 22503, 22990, 23305, 23554, 23671, 23715, 23644, 23530, 23163, 22652,
-    22170, 21683, 21139, 20526, 19862, 19165, 18405, 17677, 17084, 16526, 16012, 15547,
-    15011, 14317, 13398, 12400, 11376, 10397, 9503, 8633, 7712, 6886, 6114, 5186,
-    3903, 2459, 1056, -94, -1095, -2046, -2915, -3853, -4934, -5822, -6452, -7061,
-    -7699, -8315, -8793, -9256, -9800, -10418, -10704, -10827, -10813, -10758, -10803, -10991,
-    -11158, -11339, -11681, -12140, -12498, -12776, -12942, -13097, -13339, -13718, -14174, -14710,
-    -15342, -16036, -16745, -17259, -17530, -17517, -17590, -17743, -17506, -17716, -18265, -18901,
-    -19508, -20054, -20410, -20670, -20811, -20863, -20804, -20662, -20252, -19701, -18978, -18274,
-    -17664, -17064, -16432, -15734, -15070, -14487, -13868, -13316, -12729, -12105, -11633, -11248,
-    -10815, -10256, -9581, -8748, -7884, -6932, -6034, -5079, -4105, -3129, -2165, -1125,
-    53, 1265, 2353, 3409, 4228, 4918, 5569, 6231, 6900, 7614, 8354, 9041,
-    9685, 10312, 10912, 11383, 11799, 12245, 12638, 13032, 13588, 14233, 14464, 14315,
-    14301, 14422, 14423, 14235, 14103, 14117, 14135, 14052, 14022, 14223, 14488, 14737,
-    15074, 15466, 15837, 16165, 16373, 16448, 16774, 17397, 18155, 18915, 19582, 20224,
-    20719, 21026, 21179, 20815, 20182, 19589, 18991, 18375, 17767, 17205, 16583, 15982,
-    15280, 14546, 13912, 13288, 12658, 12127, 11667, 11207, 10750, 10307, 9789, 9204,
-    8632, 8189, 7852, 7441, 6910, 6423, 6116, 5801, 5415, 5002, 4259, 3092,
-    1801, 394, -1203, -2748, -4150, -5362, -6218, -7019, -7815, -8616, -9444, -10269,
-    -11108, -11834, -12502, -13112, -13679, -14162, -14652, -15166, -15696, -16185, -16598, -16965,
-    -17310, -17612, -17894, -17967, -17875, -17754, -17545, -17318, -17140, -16957, -16729, -16601,
-    -16527, -16534, -16506, -16417, -16299, -16174, -16009, -15920, -15934, -15949, -16107, -16385,
-    -16595, -16745, -16850, -16971, -17135, -17424, -17633, -17783, -17896, -17998, -17926, -17798,
-    -17832, -18030, -18216, -18377, -18159, -17622, -17031, -16399, -15821, -15162, -14462, -13824,
-    -13217, -12497, -11810, -11138, -10493, -9889, -9259, -8609, -8041, -7652, -7316, -6875,
-    -6362, -5804, -5241, -4688, -4085, -3386, -2727, -2188, -1688, -741, 625, 2006,
-    3464, 4926, 6161, 6926, 7649, 8335, 9081, 9850, 10648, 11502, 12263, 12905,
-    13452, 13975, 14459, 14869, 15334, 15802, 16246, 16728, 17223, 17682, 18113, 18411,
-    18607, 18780, 19029, 19321, 19574, 19735, 19843, 19917, 19913, 19900, 19761, 19592,
-    19417, 19345, 19218, 19023, 18800, 18569, 18337, 18072, 17942, 17815, 17606, 17324,
-    17175, 17079, 16929, 16819, 16750, 16793, 16862, 16820, 16687, 16581, 16481, 16391,
-    16231, 16087, 16213, 16478, 16561, 16114, 15674, 15129, 14644, 14125, 13601, 13095,
-    12602, 12097, 11481, 10806, 10311, 9857, 9458, 9099, 8731, 8356, 7963, 7483,
-    6856, 6196, 5696, 5154, 4479, 3792, 3132, 2476, 1782, 1083, 412, -204,
-    -778, -1450, -2633, -3952, -5258, -6301, -7266, -8203, -9118, -9961, -10764, -11466,
-    -12145, -12777, -13381, -13962, -14445, -14904, -15401, -15964, -16435, -16838, -17237, -17679,
-    -18165, -18558, -18812, -19032, -19179, -19351, -19497, -19638, -19879, -20153, -20342, -20454,
-    -20563, -20706, -20689, -20572, -20510, -20370, -20140, -20018, -19971, -19852, -19647, -19406,
-    -19174, -18994, -18955, -19033, -18951, -18790, -18701, -18652, -18511, -18325, -18110, -17868,
-    -17585, -17306, -17021, -16724, -16496, -16344, -16092, -15832, -15576, -15256, -14736, -14160,
-    -13516, -12826, -12198, -11562, -11024, -10529, -10031, -9486, -8945, -8383, -7843, -7358,
-    -6957, -6573, -6135, -5696, -5160, -4475, -3745, -3012, -2318, -1701, -1129, -628,
-    -120, 427, 922, 1370, 1877, 2336, 2797, 3335, 3862, 4254, 4712, 5217,
-    5935, 6830, 7681, 8563, 9394, 10160, 11001, 11782, 12536, 13236, 13935, 14661,
-    15369, 16037, 16592, 17121, 17735, 18306, 18802, 19203, 19519, 19890, 20176, 20419,
-    20594, 20785, 21008, 21216, 21426, 21580, 21700, 21831, 21895, 21940, 21981, 21993,
-    21905, 21783, 21672, 21539, 21431, 21378, 21296, 21191, 21065, 20915, 20694, 20528,
-    20366, 20189, 20023, 19880, 19745, 19452, 19067, 18584, 18088, 17627, 17118, 16592,
-    16216, 15862, 15405, 14968, 14556, 14199, 13852, 13474, 13071, 12521, 11959, 11453,
-    10953, 10368, 9771, 9187, 8593, 8012, 7400, 6765, 6131, 5523, 5011, 4405,
-    3732, 3081, 2453, 1792, 1145, 478, -205, -880, -1439, -2006, -2541, -2994,
-    -3418, -3850, -4306, -4747, -5088, -5282, -5449, -5733, -6047, -6280, -6450, -6586,
-    -6749, -6932, -7112, -7341, -7622, -7966, -8250, -8335, -8417, -8543, -8739, -8919,
-    -9241, -9924, -10684, -11489, -12291, -13094, -13845, -14551, -15219, -15830, -16453, -17103,
-    -17649, -18111, -18656, -19211, -19678, -20134, -20546, -20971, -21312, -21576, -21821, -22064,
-    -22243, -22422, -22540, -22657, -22850, -22978, -22992, -22969, -22962, -22939, -22926, -22937,
-    -22925, -22867, -22802, -22669, -22487, -22327, -22107, -21890, -21720, -21578, -21366, -21121,
-    -20951, -20777, -20603, -20293, -19848, -19327, -18790, -18280, -17735, -17216, -16690, -16190,
-    -15680, -15184, -14697, -14269, -13838, -13373, -12957, -12582, -12238, -11834, -11196, -10538,
-    -9918, -9332, -8661, -8014, -7456, -6950, -6449, -5983, -5518, -5105, -4570, -3939,
-    -3164, -2405, -1667, -986, -311, 347, 966, 1531, 2100, 2620, 3150, 3615,
-    4110, 4593, 5013, 5411, 5737, 6029, 6319, 6590, 6869, 7118, 7400, 7741,
-    8049, 8303, 8582, 8826, 9088, 9360, 9612, 9867, 10087, 10238, 10453, 10740,
-    11020, 11323, 11799, 12283, 12800, 13278, 13731, 14120, 14572, 15129, 15645, 16119,
-    16636, 17114, 17553, 17974, 18391, 18762, 19113, 19441, 19806, 20173, 20526, 20867,
-    21236, 21566, 21868, 22161, 22448, 22708, 22967, 23204, 23403, 23597, 23752, 23888,
-    24019, 24168, 24294, 24365, 24393, 24314, 24175, 24085, 24018, 23933, 23780, 23557,
-    23291, 23011, 22713, 22362, 21974, 21663, 21394, 21052, 20685, 20319, 19896, 19420,
-    18939, 18447, 17911, 17358, 16811, 16266, 15711, 15176, 14655, 14135, 13586, 13039,
-    12482, 11924, 11383, 10862, 10332, 9808, 9333, 8850, 8344, 7841, 7350, 6851,
-    6369, 5871, 5209, 4450, 3793, 3096, 2368, 1629, 912, 225, -492, -1211,
-    -2026, -2755, -3320, -3887, -4475, -5053, -5536, -5929, -6310, -6681, -7111, -7536,
-    -7934, -8321, -8660, -8990, -9296, -9601, -9906, -10192, -10468, -10734, -11018, -11283,
-    -11483, -11716, -11945, -12169, -12409, -12683, -12943, -13165, -13378, -13589, -13843, -14163,
-    -14386, -14526, -14688, -14887, -15134, -15352, -15615, -15897, -16172, -16534, -16797, -16945,
-    -17095, -17261, -17472, -17703, -17944, -18183, -18434, -18714, -19019, -19313, -19561, -19794,
-    -20024, -20209, -20385, -20537, -20684, -20830, -20973, -21108, -21201, -21293, -21384, -21410,
-    -21418, -21474, -21548, -21569, -21558, -21545, -21516, -21546, -21590, -21442, -21241, -21070,
-    -20930, -20793, -20629, -20464, -20310, -20190, -20073, -19765, -19398, -19064, -18739, -18387,
-    -18042, -17676, -17294, -16913, -16557, -16173, -15776, -15322, -14826, -14324, -13808, -13264,
-    -12701, -12117, -11528, -10955, -10392, -9803, -9220, -8621, -7998, -7392, -6820, -6276,
-    -5733, -5139, -4440, -3659, -2979, -2258, -1396, -547, 244, 936, 1589, 2232,
-    2814, 3349, 3791, 4301, 4904, 5397, 5787, 6114, 6424, 6705, 6972, 7230,
-    7446, 7645, 7855, 8085, 8336, 8585, 8855, 9121, 9373, 9596, 9857, 10127,
-    10393, 10660, 10914, 11156, 11430, 11701, 11950, 12170, 12402, 12626, 12851, 13114,
-    13335, 13469, 13762, 14130, 14439, 14673, 14874, 15108, 15347, 15549, 15691, 15774,
-    16001, 16295, 16562, 16802, 17034, 17241, 17430, 17594, 17716, 17810, 17926, 18061,
-    18227, 18377, 18526, 18676, 18839, 18977, 19106, 19257, 19389, 19527, 19682, 19791,
-    19900, 20039, 20196, 20326, 20396, 20433, 20450, 20497, 20561, 20502, 20472, 20623,
-    20769, 20839, 20841, 20832, 20817, 20745, 20628, 20455, 20325, 20299, 20219, 20087,
-    19948, 19801, 19590, 19331, 19026, 18678, 18310, 17950, 17604, 17274, 16890, 16470,
-    16027, 15596, 15126, 14635, 14109, 13565, 13059, 12553, 11990, 11453, 10920, 10367,
-    9753, 9122, 8520, 7936, 7369, 6740, 6009, 5440, 4935, 4275, 3487, 2661,
-    1891, 1144, 369, -430, -1270, -1961, -2529, -3090, -3639, -4187, -4737, -5271,
-    -5733, -6122, -6474, -6775, -7039, -7251, -7466, -7728, -7980, -8201, -8410, -8631,
-    -8841, -9060, -9287, -9478, -9679, -9895, -10064, -10262, -10489, -10749, -11009, -11272,
-    -11551, -11825, -12188, -12568, -12761, -12937, -13132, -13344, -13595, -13852, -14124, -14405,
-    -14763, -15145, -15356, -15528, -15713, -15939, -16191, -16443, -16692, -16948, -17230, -17504,
-    -17712, -17911, -18083, -18277, -18466, -18631, -18805, -19003, -19176, -19317, -19448, -19574,
-    -19676, -19810, -19902, -19943, -20011, -20101, -20199, -20304, -20408, -20486, -20550, -20717,
-    -20788, -20687, -20607, -20531, -20472, -20428, -20379, -20342, -20323, -20403, -20414, -20256,
-    -20085, -19933, -19834, -19746, -19634, -19495, -19335, -19170, -18994, -18808, -18611, -18370,
-    -18151, -17924, -17661, -17388, -17125, -16833, -16544, -16253, -15950, -15615, -15284, -14885,
-    -14451, -14047, -13654, -13256, -12870, -12480, -12104, -11755, -11441, -10935, -10352, -9831,
-    -9298, -8789, -8326, -7890, -7461, -7060, -6742, -6283, -5707, -5078, -4373, -3650,
-    -2945, -2260, -1581, -888, -221, 457, 1133, 1798, 2435, 3017, 3580, 4145,
-    4644, 5093, 5487, 5806, 6110, 6441, 6766, 7046, 7349, 7653, 7931, 8202,
-    8429, 8623, 8818, 9011, 9109, 9187, 9482, 9805, 10065, 10278, 10445, 10614,
-    10754, 10874, 10912, 10922, 11106, 11302, 11474, 11618, 11734, 11850, 11976, 12106,
-    12231, 12340, 12496, 12680, 12892, 13075, 13218, 13374, 13593, 13787, 13981, 14162,
-    14347, 14554, 14794, 15028, 15274, 15548, 15841, 16135, 16424, 16660, 16897, 17134,
-    17357, 17491, 17736, 18151, 18515, 18835, 19132, 19402, 19641, 19822, 19979, 20025,
-    20145, 20387, 20555, 20677, 20796, 20918, 21011, 21076, 21137, 21161, 21177, 21222,
-    21279, 21325, 21332, 21291, 21250, 21218, 21158, 21116, 21042, 20940, 20832, 20734,
-    20629, 20544, 20485, 20402, 20276, 20107, 19886, 19673, 19458, 19198, 18851, 18644,
-    18509, 18315, 18076, 17783, 17467, 17131, 16765, 16324, 15785, 15396, 15043, 14640,
-    14209, 13764, 13301, 12824, 12349, 11856, 11324, 10826, 10337, 9863, 9371, 8843,
-    8273, 7752, 7246, 6731, 6224, 5709, 5148, 4512, 3800, 3081, 2395, 1733,
-    1052, 370, -336, -1035, -1715, -2371, -3085, -3757, -4238, -4672, -5057, -5378,
-    -5692, -6028, -6395, -6755, -7222, -7677, -7944, -8201, -8487, -8813, -9120, -9431,
-    -9730, -10007, -10303, -10577, -10798, -11001, -11192, -11407, -11621, -11832, -11989, -12150,
-    -12296, -12421, -12547, -12649, -12710, -12758, -12780, -12793, -12803, -12853, -12925, -13017,
-    -13091, -13170, -13276, -13464, -13528, -13499, -13513, -13573, -13666, -13770, -13903, -14076,
-    -14311, -14667, -14894, -15027, -15207, -15422, -15651, -15861, -16102, -16335, -16579, -16864,
-    -17121, -17364, -17607, -17860, -18126, -18410, -18680, -18909, -19148, -19372, -19583, -19759,
-    -19876, -19982, -20073, -20136, -20191, -20250, -20339, -20439, -20540, -20621, -20690, -20823,
-    -20976, -20945, -20885, -20855, -20853, -20866, -20901, -20964, -21017, -21136, -21307, -21300,
-    -21257, -21231, -21238, -21250, -21263, -21267, -21221, -21175, -21143, -21081, -21013, -20930,
-    -20847, -20748, -20638, -20480, -20309, -20127, -19900, -19643, -19350, -19005, -18661, -18283,
-    -17876, -17450, -17029, -16629, -16243, -15843, -15413, -14957, -14586, -14138, -13525, -12930,
-    -12353, -11808, -11286, -10787, -10290, -9790, -9394, -8945, -8330, -7769, -7247, -6741,
-    -6213, -5666, -5037, -4303, -3524, -2711, -1875, -1076, -315, 403, 1080, 1746,
-    2446, 3121, 3763, 4348, 4853, 5330, 5782, 6168, 6571, 6983, 7401, 7784,
-    8125, 8438, 8748, 9073, 9368, 9547, 9873, 10282, 10623, 10922, 11176, 11395,
-    11602, 11812, 11962, 11983, 12122, 12358, 12515, 12653, 12787, 12899, 12999, 13123,
-    13238, 13334, 13450, 13581, 13691, 13790, 13876, 13934, 14026, 14172, 14335, 14536,
-    14742, 14931, 15163, 15383, 15592, 15842, 16100, 16360, 16588, 16790, 17000, 17225,
-    17470, 17634, 17751, 18048, 18352, 18619, 18872, 19093, 19298, 19499, 19681, 19761,
-    19781, 19971, 20181, 20336, 20492, 20625, 20728, 20827, 20925, 21011, 21090, 21192,
-    21288, 21363, 21432, 21476, 21502, 21578, 21679, 21795, 21918, 22016, 22112, 22251,
-    22353, 22461, 22575, 22674, 22752, 22787, 22796, 22820, 22850, 22880, 22772, 22695,
-    22754, 22760, 22747, 22690, 22589, 22482, 22347, 22165, 21851, 21555, 21410, 21226,
-    21018, 20794, 20524, 20231, 19924, 19598, 19253, 18908, 18564, 18198, 17823, 17447,
-    17043, 16634, 16265, 15899, 15547, 15200, 14828, 14482, 14165, 13808, 13478, 13138,
-    12794, 12445, 12069, 11689, 11320, 10962, 10572, 10061, 9674, 9356, 8988, 8622,
-    8220, 7802, 7364, 6878, 6275, 5500, 4776, 4094, 3339, 2577, 1792, 977,
-    145, -707, -1592, -2503, -3402, -4301, -5176, -5976, -6684, -7331, -7885, -8368,
-    -8828, -9249, -9648, -10033, -10345, -10644, -10942, -11211, -11498, -11785, -12080, -12377,
-    -12653, -12918, -13167, -13512, -13894, -14077, -14229, -14399, -14584, -14813, -15054, -15297,
-    -15536, -15855, -16203, -16378, -16534, -16741, -16953, -17185, -17435, -17682, -17934, -18194,
-    -18420, -18599, -18784, -18978, -19162, -19330, -19497, -19620, -19740, -19859, -19947, -20030,
-    -20094, -20110, -20151, -20173, -20170, -20182, -20197, -20206, -20206, -20188, -20154, -20138,
-    -20257, -20325, -20220, -20139, -20077, -20046, -20057, -20085, -20093, -20105, -20232, -20308,
-    -20242, -20217, -20223, -20241, -20274, -20325, -20372, -20431, -20512, -20549, -20547, -20550,
-    -20543, -20523, -20492, -20446, -20373, -20325, -20259, -20164, -20051, -19893, -19710, -19563,
-    -19376, -19173, -18974, -18781, -18584, -18383, -18169, -17925, -17721, -17618, -17373, -17047,
-    -16778, -16518, -16277, -16049, -15826, -15586, -15416, -15363, -15188, -14933, -14724, -14526,
-    -14342, -14192, -14074, -13948, -13834, -13709, -13524, -13330, -13137, -12943, -12731, -12508,
-    -12275, -12037, -11815, -11549, -11258, -10949, -10590, -10235, -9893, -9508, -9132, -8771,
-    -8426, -8078, -7722, -7341, -6936, -6600, -6298, -5865, -5443, -5061, -4662, -4233,
-    -3776, -3304, -2846, -2514, -2244, -1851, -1462, -1128, -833, -539, -264, 22,
-    344, 681, 1059, 1486, 1906, 2322, 2730, 3162, 3581, 3982, 4319, 4614,
-    4917, 5216, 5537, 5905, 6256, 6622, 7007, 7370, 7700, 8027, 8373, 8734,
-    9102, 9456, 9695, 9972, 10378, 10748, 11086, 11417, 11740, 12034, 12300, 12531,
-    12634, 12779, 13070, 13331, 13542, 13721, 13877, 13993, 14108, 14226, 14336, 14472,
-    14634, 14778, 14904, 15010, 15121, 15245, 15405, 15540, 15692, 15861, 16019, 16218,
-    16452, 16639, 16837, 17032, 17205, 17352, 17510, 17689, 17867, 18049, 18190, 18204,
-    18327, 18532, 18694, 18848, 18998, 19123, 19208, 19272, 19266, 19133, 19112, 19178,
-    19196, 19178, 19138, 19056, 18953, 18867, 18778, 18678, 18608, 18530, 18451, 18365,
-    18274, 18172, 18095, 18025, 17935, 17888, 17850, 17797, 17798, 17797, 17757, 17730,
-    17696, 17638, 17580, 17567, 17569, 17550, 17536, 17422, 17249, 17232, 17228, 17179,
-    17134, 17078, 16980, 16841, 16696, 16452, 16163, 16034, 15911, 15738, 15557, 15363,
-    15136, 14921, 14718, 14503, 14292, 14095, 13866, 13643, 13432, 13234, 13038, 12887,
-    12704, 12524, 12396, 12259, 12128, 12046, 11916, 11772, 11657, 11546, 11408, 11280,
-    11163, 11022, 10861, 10687, 10366, 10066, 9890, 9653, 9370, 9083, 8758, 8406,
-    8061, 7716, 7259, 6872, 6644, 6379, 6089, 5798, 5482, 5169, 4888, 4576,
-    4191, 3792, 3375, 2927, 2494, 2066, 1634, 1243, 891, 500, 133, -204,
-    -562, -897, -1214, -1594, -1953, -2265, -2586, -2925, -3234, -3535, -3854, -4160,
-    -4507, -4959, -5245, -5405, -5599, -5783, -5977, -6223, -6498, -6761, -7074, -7494,
-    -7764, -7965, -8231, -8494, -8770, -9087, -9392, -9673, -9975, -10282, -10527, -10783,
-    -11045, -11286, -11520, -11755, -11938, -12123, -12335, -12498, -12651, -12835, -12977, -13124,
-    -13285, -13381, -13452, -13564, -13690, -13786, -13882, -13990, -14063, -14225, -14438, -14492,
-    -14539, -14639, -14713, -14801, -14936, -15104, -15278, -15554, -15851, -15972, -16086, -16234,
-    -16359, -16499, -16674, -16838, -17011, -17222, -17411, -17546, -17700, -17837, -17961, -18083,
-    -18197, -18259, -18345, -18431, -18485, -18559, -18646, -18683, -18740, -18783, -18781, -18785,
-    -18828, -18856, -18874, -18885, -18900, -18922, -19059, -19155, -19123, -19126, -19140, -19142,
-    -19197, -19264, -19336, -19435, -19644, -19779, -19773, -19787, -19793, -19791, -19840, -19898,
-    -19934, -19974, -20018, -20011, -19987, -19977, -19941, -19884, -19816, -19710, -19576, -19478,
-    -19371, -19257, -19172, -19073, -18944, -18839, -18708, -18566, -18466, -18393, -18312, -18203,
-    -18056, -17895, -17758, -17691, -17504, -17240, -17002, -16718, -16447, -16213, -15963, -15725,
-    -15538, -15409, -15135, -14784, -14467, -14146, -13852, -13598, -13326, -13048, -12779, -12489,
-    -12146, -11830, -11532, -11224, -10891, -10531, -10134, -9755, -9406, -9023, -8618, -8233,
-    -7812, -7370, -6929, -6456, -5979, -5487, -4912, -4239, -3494, -2759, -2065, -1436,
-    -807, -41, 718, 1433, 2144, 2802, 3439, 4069, 4667, 5173, 5631, 6163,
-    6629, 7015, 7370, 7694, 8012, 8346, 8660, 8940, 9225, 9520, 9783, 10056,
-    10337, 10623, 10910, 11221, 11500, 11772, 12072, 12347, 12601, 12892, 13175, 13461,
-    13760, 14050, 14323, 14593, 14875, 15164, 15427, 15660, 15807, 15997, 16298, 16556,
-    16774, 16964, 17120, 17268, 17387, 17470, 17483, 17558, 17731, 17850, 17934, 18006,
-    18063, 18114, 18164, 18188, 18197, 18228, 18245, 18234, 18236, 18250, 18274, 18311,
-    18357, 18363, 18388, 18431, 18439, 18466, 18529, 18568, 18619, 18693, 18775, 18858,
-    18950, 19038, 19110, 19183, 19220, 19180, 19245, 19385, 19476, 19556, 19627, 19689,
-    19728, 19746, 19719, 19630, 19656, 19734, 19766, 19792, 19797, 19782, 19762, 19738,
-    19689, 19630, 19597, 19533, 19441, 19345, 19247, 19150, 19049, 18903, 18715, 18572,
-    18432, 18265, 18138, 18017, 17906, 17855, 17816, 17761, 17707, 17686, 17666, 17624,
-    17599, 17493, 17373, 17411, 17449, 17442, 17439, 17415, 17370, 17291, 17213, 17038,
-    16832, 16766, 16702, 16603, 16486, 16331, 16156, 15972, 15771, 15525, 15293, 15088,
-    14871, 14649, 14415, 14183, 13950, 13716, 13447, 13173, 12935, 12666, 12410, 12183,
-    11914, 11676, 11483, 11266, 11011, 10732, 10468, 10205, 9959, 9701, 9333, 9037,
-    8856, 8611, 8348, 8077, 7787, 7473, 7148, 6796, 6323, 5909, 5624, 5279,
-    4825, 4263, 3649, 3016, 2366, 1704, 1043, 423, -204, -851, -1492, -2124,
-    -2752, -3378, -3984, -4609, -5212, -5764, -6245, -6610, -6944, -7290, -7582, -7860,
-    -8158, -8464, -8753, -9030, -9304, -9548, -9835, -10195, -10430, -10599, -10796, -10986,
-    -11202, -11420, -11666, -11928, -12251, -12623, -12841, -12992, -13193, -13410, -13654, -13909,
-    -14189, -14471, -14762, -15048, -15295, -15542, -15801, -16066, -16305, -16516, -16715, -16916,
-    -17119, -17285, -17462, -17631, -17758, -17894, -18014, -18088, -18162, -18236, -18312, -18365,
-    -18397, -18407, -18420, -18512, -18591, -18528, -18481, -18430, -18365, -18317, -18290, -18278,
-    -18268, -18338, -18402, -18326, -18263, -18242, -18269, -18323, -18398, -18502, -18618, -18752,
-    -18871, -18988, -19132, -19275, -19402, -19487, -19567, -19648, -19743, -19808, -19843, -19895,
-    -19938, -19963, -19982, -19929, -19857, -19799, -19747, -19686, -19633, -19576, -19490, -19431,
-    -19450, -19371, -19186, -19030, -18868, -18738, -18631, -18530, -18417, -18351, -18369, -18286,
-    -18085, -17927, -17799, -17708, -17603, -17494, -17387, -17307, -17240, -17153, -17076, -17013,
-    -16941, -16841, -16708, -16576, -16450, -16334, -16178, -16034, -15912, -15779, -15650, -15508,
-    -15302, -15106, -14924, -14732, -14524, -14344, -14143, -13927, -13770, -13656, -13387, -13085,
-    -12816, -12550, -12302, -12061, -11804, -11555, -11393, -11268, -10993, -10687, -10428, -10182,
-    -9946, -9714, -9502, -9303, -9131, -8948, -8732, -8517, -8292, -8055, -7796, -7523,
-    -7244, -6982, -6708, -6408, -6129, -5860, -5576, -5296, -4944, -4471, -3948, -3421,
-    -2888, -2363, -1838, -1287, -755, -317, 155, 780, 1372, 1940, 2509, 3066,
-    3601, 4141, 4657, 5072, 5480, 5971, 6360, 6670, 6958, 7262, 7551, 7806,
-    8028, 8237, 8480, 8737, 8973, 9229, 9504, 9797, 10090, 10373, 10632, 10905,
-    11194, 11465, 11734, 12026, 12305, 12624, 12968, 13293, 13611, 13940, 14249, 14564,
-    14887, 15186, 15380, 15642, 15980, 16268, 16537, 16790, 17011, 17201, 17378, 17482,
-    17467, 17514, 17654, 17756, 17832, 17890, 17948, 17970, 17977, 17953, 17930, 17949,
-    17983, 18010, 18048, 18098, 18169, 18249, 18313, 18351, 18401, 18449, 18463, 18477,
-    18499, 18518, 18585, 18670, 18736, 18793, 18845, 18887, 18931, 18964, 18916, 18792,
-    18795, 18844, 18858, 18857, 18854, 18838, 18815, 18768, 18620, 18397, 18301, 18254,
-    18162, 18036, 17899, 17750, 17569, 17365, 17142, 16935, 16763, 16589, 16412, 16242,
-    16071, 15907, 15739, 15545, 15347, 15174, 14988, 14781, 14602, 14423, 14268, 14174,
-    14096, 14002, 13907, 13817, 13742, 13671, 13593, 13407, 13230, 13191, 13159, 13100,
-    13039, 12976, 12897, 12797, 12670, 12457, 12265, 12209, 12140, 12025, 11885, 11745,
-    11586, 11403, 11214, 11035, 10884, 10751, 10608, 10477, 10359, 10247, 10140, 10014,
-    9866, 9725, 9603, 9448, 9297, 9176, 9058, 8989, 8967, 8939, 8893, 8835,
-    8784, 8722, 8654, 8536, 8322, 8196, 8163, 8110, 8028, 7929, 7822, 7692,
-    7538, 7328, 7035, 6821, 6696, 6531, 6324, 6093, 5856, 5591, 5283, 4939,
-    4564, 4182, 3796, 3399, 3024, 2656, 2298, 1928, 1525, 1098, 686, 275,
-    -165, -581, -988, -1375, -1703, -2007, -2328, -2671, -3024, -3380, -3770, -4175,
-    -4657, -5127, -5422, -5635, -5868, -6126, -6399, -6672, -6953, -7252, -7615, -7990,
-    -8237, -8447, -8714, -9003, -9287, -9554, -9823, -10108, -10394, -10663, -10901, -11131,
-    -11359, -11564, -11761, -11943, -12141, -12366, -12596, -12800, -13014, -13225, -13396, -13553,
-    -13664, -13706, -13737, -13784, -13845, -13900, -13959, -14013, -14084, -14239, -14345, -14329,
-    -14311, -14324, -14346, -14374, -14405, -14448, -14537, -14716, -14857, -14884, -14925, -15004,
-    -15092, -15191, -15289, -15409, -15551, -15699, -15826, -15926, -16034, -16129, -16216, -16302,
-    -16368, -16454, -16567, -16671, -16765, -16876, -16957, -16999, -17031, -17003, -16916, -16836,
-    -16772, -16706, -16636, -16581, -16518, -16507, -16561, -16506, -16356, -16231, -16114, -15995,
-    -15882, -15784, -15712, -15727, -15811, -15788, -15683, -15623, -15579, -15540, -15505, -15468,
-    -15462, -15491, -15528, -15528, -15512, -15496, -15461, -15432, -15392, -15335, -15306, -15288,
-    -15245, -15214, -15201, -15139, -15049, -14946, -14769, -14553, -14355, -14161, -13952, -13748,
-    -13546, -13339, -13213, -13106, -12875, -12593, -12327, -12045, -11762, -11491, -11238, -11032,
-    -10931, -10839, -10620, -10368, -10144, -9913, -9694, -9483, -9282, -9115, -8979, -8831,
-    -8651, -8477, -8304, -8123, -7948, -7759, -7574, -7417, -7266, -7116, -6998, -6890,
-    -6753, -6617, -6454, -6235, -6022, -5827, -5624, -5389, -5119, -4815, -4533, -4348,
-    -4126, -3784, -3431, -3084, -2735, -2404, -2084, -1777, -1537, -1391, -1192, -874,
-    -561, -267, 23, 289, 546, 780, 974, 1135, 1313, 1507, 1691, 1894,
-    2105, 2316, 2536, 2741, 2924, 3107, 3299, 3468, 3646, 3841, 4021, 4232,
-    4467, 4680, 4883, 5077, 5272, 5465, 5660, 5788, 5839, 5980, 6208, 6426,
-    6638, 6831, 6999, 7153, 7287, 7341, 7342, 7441, 7602, 7731, 7854, 7966,
-    8063, 8156, 8233, 8273, 8307, 8380, 8452, 8522, 8616, 8717, 8827, 8945,
-    9058, 9159, 9270, 9380, 9470, 9585, 9712, 9852, 10059, 10306, 10563, 10817,
-    11060, 11287, 11508, 11725, 11851, 11949, 12160, 12411, 12640, 12857, 13057, 13241,
-    13419, 13568, 13614, 13641, 13773, 13927, 14053, 14180, 14297, 14397, 14479, 14533,
-    14554, 14586, 14640, 14674, 14716, 14775, 14838, 14916, 15002, 15065, 15109, 15161,
-    15199, 15232, 15306, 15388, 15497, 15658, 15831, 16002, 16170, 16335, 16481, 16622,
-    16729, 16738, 16783, 16943, 17111, 17259, 17408, 17551, 17680, 17792, 17841, 17798,
-    17808, 17919, 18006, 18060, 18108, 18135, 18148, 18146, 18112, 18042, 17988, 17935,
-    17850, 17769, 17693, 17618, 17551, 17472, 17363, 17235, 17100, 16946, 16821, 16732,
-    16645, 16603, 16605, 16592, 16555, 16506, 16448, 16381, 16334, 16238, 16071, 15991,
-    15993, 15969, 15925, 15871, 15802, 15713, 15612, 15440, 15200, 15047, 14953, 14813,
-    14662, 14510, 14343, 14147, 13920, 13667, 13397, 13142, 12882, 12623, 12387, 12148,
-    11905, 11660, 11381, 11068, 10761, 10461, 10147, 9849, 9562, 9289, 9058, 8831,
-    8586, 8315, 8024, 7721, 7422, 7115, 6713, 6285, 5934, 5529, 5008, 4444,
-    3874, 3285, 2676, 2049, 1335, 592, -44, -651, -1300, -1950, -2594, -3257,
-    -3937, -4569, -5115, -5593, -6033, -6480, -6918, -7332, -7741, -8134, -8513, -8897,
-    -9284, -9656, -10028, -10388, -10703, -10989, -11253, -11494, -11737, -11983, -12238, -12487,
-    -12726, -12947, -13193, -13524, -13821, -14024, -14227, -14445, -14662, -14876, -15096, -15332,
-    -15620, -15987, -16294, -16482, -16678, -16891, -17097, -17308, -17525, -17752, -17987, -18235,
-    -18459, -18642, -18817, -18958, -19074, -19181, -19278, -19380, -19489, -19579, -19645, -19705,
-    -19730, -19723, -19726, -19709, -19657, -19591, -19519, -19440, -19355, -19277, -19197, -19177,
-    -19230, -19202, -19093, -18985, -18882, -18797, -18729, -18669, -18623, -18652, -18736, -18717,
-    -18634, -18592, -18558, -18533, -18530, -18543, -18582, -18649, -18720, -18742, -18746, -18741,
-    -18705, -18670, -18626, -18561, -18503, -18457, -18382, -18285, -18184, -18037, -17865, -17692,
-    -17479, -17237, -16990, -16739, -16480, -16224, -15970, -15716, -15555, -15430, -15200, -14930,
-    -14675, -14411, -14156, -13925, -13707, -13508, -13395, -13282, -13050, -12810, -12605, -12384,
-    -12177, -12001, -11842, -11697, -11581, -11441, -11254, -11076, -10894, -10689, -10491, -10289,
-    -10076, -9877, -9682, -9463, -9247, -9026, -8773, -8539, -8310, -8039, -7746, -7457,
-    -7176, -6913, -6682, -6444, -6225, -6114, -5978, -5701, -5367, -5022, -4677, -4367,
-    -4089, -3803, -3549, -3386, -3188, -2898, -2636, -2405, -2169, -1951, -1750, -1546,
-    -1363, -1208, -1024, -815, -626, -422, -198, 24, 241, 447, 629, 806,
-    996, 1175, 1362, 1559, 1746, 1958, 2193, 2420, 2642, 2850, 3022, 3169,
-    3333, 3433, 3441, 3520, 3687, 3831, 3957, 4084, 4193, 4283, 4367, 4385,
-    4341, 4380, 4485, 4556, 4620, 4697, 4766, 4817, 4862, 4893, 4921, 4974,
-    5025, 5074, 5150, 5242, 5333, 5422, 5521, 5628, 5740, 5844, 5946, 6086,
-    6239, 6405, 6616, 6830, 7042, 7257, 7453, 7626, 7821, 8028, 8129, 8189,
-    8354, 8550, 8701, 8835, 8962, 9079, 9197, 9287, 9290, 9289, 9390, 9519,
-    9621, 9724, 9832, 9930, 10014, 10087, 10157, 10252, 10367, 10494, 10655, 10831,
-    11013, 11201, 11392, 11586, 11785, 11990, 12188, 12422, 12699, 12961, 13239, 13538,
-    13815, 14095, 14386, 14658, 14928, 15234, 15495, 15635, 15809, 16083, 16346, 16582,
-    16809, 17010, 17195, 17377, 17498, 17548, 17655, 17848, 18029, 18182, 18324, 18445,
-    18544, 18614, 18651, 18683, 18724, 18759, 18809, 18883, 18944, 18995, 19043, 19064,
-    19057, 19049, 19025, 18986, 18993, 19010, 18990, 18980, 18980, 18963, 18954, 18939,
-    18889, 18837, 18806, 18684, 18469, 18323, 18239, 18128, 18004, 17851, 17656, 17465,
-    17274, 17001, 16683, 16452, 16272, 16066, 15861, 15647, 15401, 15136, 14848, 14530,
-    14221, 13933, 13650, 13388, 13142, 12877, 12610, 12350, 12063, 11755, 11459, 11161,
-    10877, 10645, 10396, 10109, 9848, 9608, 9374, 9142, 8903, 8650, 8403, 8154,
-    7807, 7420, 7125, 6878, 6624, 6338, 5971, 5531, 5074, 4594, 4041, 3519,
-    3111, 2713, 2298, 1885, 1449, 1005, 556, 99, -362, -788, -1185, -1570,
-    -1919, -2269, -2618, -2944, -3274, -3616, -3956, -4266, -4560, -4812, -4998, -5186,
-    -5359, -5492, -5621, -5754, -5893, -6029, -6184, -6335, -6519, -6806, -7051, -7206,
-    -7363, -7533, -7725, -7935, -8148, -8355, -8613, -8927, -9156, -9310, -9468, -9639,
-    -9828, -10004, -10183, -10381, -10592, -10791, -10933, -11058, -11179, -11288, -11405, -11519,
-    -11641, -11761, -11889, -12012, -12101, -12189, -12253, -12305, -12379, -12428, -12461, -12488,
-    -12508, -12526, -12551, -12582, -12608, -12717, -12882, -12976, -13033, -13111, -13230, -13422,
-    -13697, -14042, -14471, -15051, -15720, -16363, -16985, -17617, -18251, -18767, -19095, -19346,
-    -19577, -19719, -19715, -19597, -19408, -19159, -18889, -18587, -18247, -17907, -17575, -17252,
-    -16938, -16634, -16339, -16030, -15713, -15388, -15053, -14718, -14374, -14021, -13681, -13379,
-    -13111, -12873, -12672, -12468, -12254, -12064, -11867, -11645, -11421, -11201, -10999, -10853,
-    -10742, -10595, -10405, -10208, -10002, -9785, -9575, -9387, -9227, -9082, -8927, -8741,
-    -8529, -8330, -8154, -7969, -7754, -7515, -7270, -7021, -6769, -6505, -6233, -5964,
-    -5690, -5414, -5144, -4859, -4553, -4238, -3934, -3681, -3492, -3332, -3150, -2950,
-    -2754, -2580, -2411, -2214, -2003, -1821, -1673, -1534, -1379, -1190, -973, -746,
-    -515, -281, -50, 176, 385, 579, 781, 1000, 1237, 1486, 1714, 1933,
-    2184, 2456, 2731, 3030, 3353, 3681, 4025, 4384, 4734, 5078, 5422, 5769,
-    6147, 6560, 6956, 7279, 7528, 7758, 8013, 8268, 8505, 8738, 8964, 9175,
-    9374, 9537, 9662, 9808, 9993, 10187, 10393, 10609, 10823, 11034, 11243, 11447,
-    11650, 11829, 11964, 12080, 12196, 12308, 12419, 12524, 12620, 12727, 12855, 12985,
-    13109, 13232, 13363, 13489, 13587, 13662, 13740, 13831, 13947, 14083, 14200, 14265,
-    14279, 14261, 14218, 13999, 13235, 11631, 9256, 6463, 3647, 1110, -952, -2416,
-    -3285, -3705, -3805, -3658, -3377, -3070, -2769, -2512, -2328, -2207, -2168, -2219,
-    -2300, -2368, -2421, -2456, -2484, -2504, -2493, -2463, -2432, -2387, -2327, -2272,
-    -2222, -2171, -2107, -2024, -1932, -1842, -1766, -1706, -1656, -1634, -1646, -1656,
-    -1642, -1623, -1608, -1627, -1708, -1800, -1853, -1886, -1906, -1906, -1903, -1894,
-    -1867, -1847, -1833, -1799, -1745, -1691, -1648, -1636, -1652, -1650, -1610, -1544,
-    -1474, -1406, -1329, -1235, -1139, -1057, -994, -940, -890, -830, -753, -663,
-    -573, -494, -418, -329, -237, -181, -172, -173, -148, -104, -68, -72,
-    -126, -194, -238, -265, -289, -298, -292, -279, -259, -250, -262, -252,
-    -205, -162, -142, -147, -188, -240, -257, -249, -251, -256, -261, -265,
-    -251, -225, -223, -233, -230, -225, -218, -196, -187, -202, -193, -144,
-    -95, -78, -97, -138, -166, -172, -197, -254, -307, -341, -360, -369,
-    -373, -368, -335, -272, -188, -85, 27, 139, 267, 418, 574, 717,
-    840, 957, 1101, 1288, 1503, 1724, 1939, 2148, 2363, 2585, 2805, 3034,
-    3285, 3548, 3810, 4019, 3994, 3477, 2330, 622, -1432, -3577, -5592, -7320,
-    -8648, -9541, -10037, -10186, -10040, -9683, -9209, -8681, -8152, -7657, -7199, -6772,
-    -6385, -6031, -5705, -5411, -5149, -4905, -4662, -4414, -4161, -3912, -3660, -3379,
-    -3055, -2708, -2367, -2053, -1758, -1472, -1191, -914, -628, -332, -45, 218,
-    462, 703, 953, 1212, 1474, 1732, 1977, 2200, 2388, 2537, 2671, 2831,
-    3032, 3246, 3434, 3588, 3711, 3812, 3911, 4027, 4169, 4337, 4525, 4714,
-    4888, 5054, 5227, 5406, 5589, 5765, 5929, 6090, 6277, 6489, 6689, 6851,
-    6983, 7111, 7248, 7400, 7567, 7727, 7852, 7941, 8020, 8103, 8185, 8259,
-    8328, 8400, 8480, 8540, 8535, 8473, 8421, 8426, 8472, 8521, 8551, 8549,
-    8516, 8464, 8407, 8363, 8348, 8360, 8376, 8386, 8387, 8371, 8346, 8336,
-    8344, 8356, 8361, 8358, 8362, 8392, 8430, 8433, 8401, 8375, 8366, 8365,
-    8373, 8368, 8319, 8248, 8204, 8180, 8149, 8111, 8073, 8044, 8033, 8004,
-    7899, 7736, 7600, 7523, 7482, 7459, 7429, 7353, 7232, 7099, 6963, 6832,
-    6735, 6680, 6646, 6629, 6617, 6589, 6549, 6523, 6524, 6543, 6561, 6555,
-    6532, 6521, 6526, 6515, 6417, 6089, 5342, 4088, 2382, 351, -1833, -3950,
-    -5845, -7460, -8765, -9736, -10383, -10750, -10883, -10859, -10768, -10637, -10454, -10231,
-    -9996, -9777, -9604, -9511, -9494, -9531, -9603, -9688, -9772, -9843, -9892, -9919,
-    -9934, -9945, -9944, -9921, -9873, -9795, -9710, -9656, -9636, -9622, -9597, -9564,
-    -9527, -9484, -9432, -9365, -9292, -9236, -9193, -9135, -9057, -8986, -8936, -8899,
-    -8870, -8849, -8833, -8814, -8784, -8747, -8706, -8662, -8608, -8543, -8479, -8442,
-    -8446, -8469, -8487, -8500, -8511, -8507, -8473, -8406, -8320, -8227, -8132, -8028,
-    -7909, -7766, -7609, -7466, -7359, -7280, -7204, -7106, -6982, -6840, -6687, -6534,
-    -6393, -6270, -6151, -6011, -5853, -5699, -5563, -5433, -5306, -5199, -5121, -5040,
-    -4913, -4739, -4556, -4389, -4231, -4069, -3910, -3776, -3675, -3597, -3529, -3464,
-    -3400, -3331, -3252, -3159, -3052, -2934, -2808, -2679, -2543, -2391, -2224, -2063,
-    -1927, -1820, -1723, -1610, -1460, -1274, -1075, -887, -719, -557, -378, -173,
-    47, 269, 490, 714, 927, 1098, 1226, 1360, 1561, 1831, 2119, 2381,
-    2610, 2830, 3056, 3289, 3521, 3743, 3948, 4140, 4323, 4499, 4673, 4861,
-    5080, 5325, 5588, 5865, 6137, 6317, 6256, 5814, 4930, 3642, 2063, 357,
-    -1307, -2813, -4121, -5227, -6108, -6736, -7102, -7238, -7184, -6975, -6648, -6246,
-    -5816, -5398, -5004, -4610, -4175, -3695, -3225, -2825, -2509, -2249, -2012, -1786,
-    -1568, -1359, -1160, -967, -783, -614, -463, -310, -129, 84, 318, 565,
-    822, 1079, 1319, 1543, 1754, 1940, 2095, 2243, 2430, 2669, 2925, 3154,
-    3346, 3522, 3698, 3872, 4037, 4199, 4367, 4530, 4661, 4750, 4818, 4906,
-    5048, 5247, 5474, 5682, 5838, 5952, 6056, 6170, 6295, 6419, 6541, 6660,
-    6769, 6860, 6936, 7003, 7077, 7176, 7309, 7466, 7630, 7782, 7918, 8038,
-    8145, 8233, 8295, 8337, 8388, 8465, 8556, 8637, 8702, 8760, 8813, 8850,
-    8879, 8913, 8951, 8971, 8954, 8907, 8856, 8831, 8843, 8890, 8959, 9030,
-    9072, 9060, 9004, 8937, 8884, 8844, 8800, 8747, 8682, 8601, 8504, 8403,
-    8317, 8256, 8225, 8224, 8241, 8259, 8261, 8238, 8190, 8130, 8069, 8013,
-    7956, 7899, 7853, 7824, 7806, 7789, 7768, 7744, 7723, 7705, 7683, 7638,
-    7558, 7454, 7355, 7279, 7230, 7204, 7197, 7203, 7202, 7171, 7097, 6994,
-    6897, 6827, 6775, 6725, 6668, 6581, 6381, 5951, 5203, 4130, 2782, 1233,
-    -437, -2139, -3799, -5369, -6807, -8054, -9064, -9842, -10427, -10850, -11112, -11200,
-    -11142, -10999, -10824, -10633, -10424, -10201, -9993, -9826, -9697, -9583, -9468, -9354,
-    -9252, -9173, -9112, -9050, -8979, -8924, -8919, -8976, -9062, -9133, -9178, -9216,
-    -9256, -9294, -9324, -9368, -9436, -9499, -9525, -9525, -9510, -9466, -9410, -9374,
-    -9362, -9356, -9333, -9279, -9220, -9205, -9228, -9223, -9158, -9059, -8960, -8874,
-    -8801, -8729, -8663, -8612, -8567, -8496, -8382, -8239, -8091, -7951, -7820, -7689,
-    -7541, -7369, -7219, -7131, -7089, -7050, -6996, -6926, -6843, -6754, -6667, -6591,
-    -6541, -6499, -6438, -6358, -6273, -6184, -6090, -5992, -5899, -5817, -5734, -5632,
-    -5533, -5463, -5396, -5295, -5153, -4979, -4792, -4607, -4431, -4271, -4145, -4040,
-    -3916, -3760, -3587, -3412, -3245, -3089, -2930, -2760, -2570, -2362, -2162, -2005,
-    -1891, -1796, -1694, -1568, -1409, -1222, -1026, -849, -706, -582, -462, -339,
-    -213, -87, 49, 209, 387, 569, 760, 957, 1136, 1298, 1470, 1654,
-    1841, 2043, 2267, 2505, 2747, 2967, 3144, 3304, 3496, 3730, 3984, 4234,
-    4468, 4697, 4943, 5205, 5471, 5734, 5966, 6087, 5989, 5597, 4915, 4001,
-    2923, 1737, 497, -755, -1979, -3132, -4161, -5023, -5699, -6198, -6536, -6718,
-    -6744, -6635, -6432, -6184, -5911, -5602, -5248, -4865, -4476, -4079, -3657, -3215,
-    -2795, -2432, -2126, -1844, -1551, -1240, -921, -616, -346, -115, 95, 302,
-    514, 734, 968, 1210, 1433, 1619, 1777, 1936, 2120, 2328, 2544, 2752,
-    2940, 3101, 3234, 3355, 3479, 3605, 3729, 3865, 4032, 4223, 4410, 4569,
-    4706, 4850, 5013, 5170, 5304, 5435, 5593, 5770, 5924, 6031, 6107, 6190,
-    6303, 6442, 6587, 6726, 6859, 6986, 7108, 7230, 7353, 7478, 7617, 7774,
-    7917, 8015, 8070, 8117, 8185, 8279, 8385, 8484, 8573, 8647, 8696, 8710,
-    8705, 8699, 8697, 8712, 8760, 8829, 8878, 8883, 8866, 8856, 8870, 8890,
-    8890, 8873, 8865, 8871, 8862, 8829, 8788, 8754, 8726, 8709, 8707, 8715,
-    8725, 8729, 8720, 8698, 8676, 8650, 8613, 8579, 8555, 8527, 8482, 8425,
-    8366, 8310, 8264, 8228, 8192, 8146, 8082, 7992, 7879, 7765, 7666, 7581,
-    7508, 7445, 7373, 7283, 7184, 7089, 7003, 6930, 6867, 6803, 6736, 6677,
-    6634, 6608, 6592, 6570, 6524, 6462, 6407, 6342, 6206, 5916, 5406, 4647,
-    3667, 2514, 1236, -119, -1490, -2823, -4086, -5257, -6322, -7277, -8113, -8810,
-    -9366, -9797, -10127, -10384, -10589, -10738, -10813, -10818, -10777, -10710, -10628, -10538,
-    -10441, -10343, -10252, -10167, -10078, -9989, -9915, -9852, -9784, -9711, -9643, -9592,
-    -9567, -9563, -9553, -9513, -9447, -9367, -9289, -9227, -9181, -9138, -9096, -9065,
-    -9032, -8976, -8898, -8821, -8762, -8718, -8674, -8617, -8549, -8485, -8432, -8399,
-    -8401, -8441, -8482, -8489, -8468, -8448, -8439, -8435, -8427, -8415, -8411, -8415,
-    -8402, -8359, -8303, -8253, -8201, -8133, -8051, -7961, -7874, -7797, -7718, -7612,
-    -7468, -7297, -7118, -6949, -6799, -6660, -6519, -6379, -6243, -6093, -5920, -5737,
-    -5560, -5389, -5220, -5048, -4866, -4675, -4490, -4326, -4203, -4127, -4064, -3972,
-    -3851, -3735, -3644, -3563, -3483, -3404, -3334, -3272, -3200, -3094, -2962, -2830,
-    -2703, -2570, -2432, -2298, -2167, -2040, -1917, -1782, -1619, -1425, -1210, -989,
-    -780, -590, -405, -218, -34, 154, 363, 593, 828, 1064, 1305, 1555,
-    1814, 2074, 2318, 2538, 2738, 2923, 3094, 3266, 3456, 3652, 3837, 4008,
-    4170, 4328, 4489, 4648, 4809, 4988, 5197, 5402, 5544, 5574, 5452, 5153,
-    4667, 4006, 3189, 2255, 1263, 263, -713, -1636, -2496, -3297, -4029, -4657,
-    -5166, -5565, -5854, -6024, -6074, -6013, -5853, -5616, -5328, -5000, -4648, -4291,
-    -3928, -3557, -3193, -2846, -2505, -2159, -1816, -1497, -1210, -946, -682, -418,
-    -171, 57, 296, 555, 810, 1038, 1242, 1437, 1634, 1829, 2006, 2155,
-    2301, 2471, 2665, 2876, 3094, 3300, 3480, 3645, 3808, 3960, 4099, 4243,
-    4409, 4600, 4806, 5010, 5199, 5377, 5543, 5695, 5839, 5981, 6111, 6215,
-    6294, 6362, 6428, 6493, 6547, 6593, 6651, 6731, 6820, 6907, 7006, 7126,
-    7249, 7355, 7449, 7548, 7659, 7774, 7875, 7950, 8013, 8089, 8189, 8305,
-    8430, 8554, 8663, 8753, 8823, 8869, 8897, 8928, 8981, 9058, 9145, 9224,
-    9285, 9326, 9350, 9355, 9346, 9333, 9310, 9261, 9182, 9083, 8977, 8872,
-    8773, 8677, 8579, 8488, 8414, 8357, 8313, 8282, 8256, 8221, 8172, 8121,
-    8073, 8025, 7977, 7925, 7869, 7816, 7785, 7780, 7795, 7821, 7848, 7855,
-    7834, 7797, 7759, 7729, 7711, 7710, 7716, 7716, 7694, 7651, 7600, 7554,
-    7517, 7476, 7418, 7331, 7209, 7065, 6921, 6786, 6644, 6454, 6171, 5764,
-    5220, 4530, 3691, 2726, 1677, 567, -595, -1788, -2978, -4135, -5239, -6269,
-    -7218, -8079, -8828, -9448, -9943, -10331, -10634, -10883, -11094, -11250, -11336, -11358,
-    -11330, -11250, -11128, -10988, -10854, -10729, -10600, -10451, -10283, -10114, -9965, -9845,
-    -9756, -9695, -9656, -9629, -9609, -9591, -9570, -9537, -9487, -9427, -9377, -9344,
-    -9313, -9269, -9223, -9193, -9182, -9181, -9178, -9163, -9147, -9142, -9145, -9127,
-    -9075, -9003, -8935, -8891, -8875, -8868, -8850, -8817, -8781, -8739, -8686, -8625,
-    -8566, -8514, -8464, -8406, -8336, -8260, -8187, -8121, -8063, -8022, -7998, -7974,
-    -7936, -7877, -7798, -7699, -7588, -7461, -7324, -7189, -7052, -6894, -6711, -6526,
-    -6362, -6220, -6088, -5953, -5802, -5643, -5490, -5338, -5167, -4969, -4759, -4558,
-    -4376, -4208, -4042, -3871, -3705, -3553, -3410, -3267, -3120, -2978, -2846, -2716,
-    -2581, -2440, -2301, -2164, -2031, -1912, -1816, -1735, -1647, -1538, -1408, -1262,
-    -1111, -962, -807, -638, -452, -250, -29, 199, 417, 622, 820, 1017,
-    1215, 1417, 1623, 1833, 2050, 2282, 2525, 2771, 3019, 3265, 3502, 3728,
-    3945, 4156, 4363, 4572, 4785, 5001, 5217, 5431, 5639, 5824, 5957, 6009,
-    5949, 5748, 5388, 4875, 4245, 3533, 2762, 1950, 1115, 273, -558, -1351,
-    -2081, -2737, -3317, -3813, -4229, -4577, -4871, -5104, -5261, -5337, -5340, -5287,
-    -5184, -5033, -4825, -4564, -4264, -3945, -3611, -3264, -2914, -2574, -2245, -1917,
-    -1579, -1232, -886, -552, -233, 75, 380, 687, 996, 1294, 1569, 1813,
-    2034, 2243, 2448, 2653, 2860, 3062, 3253, 3440, 3632, 3829, 4025, 4217,
-    4406, 4580, 4722, 4836, 4942, 5055, 5173, 5285, 5380, 5455, 5525, 5613,
-    5727, 5854, 5973, 6068, 6138, 6190, 6237, 6291, 6357, 6433, 6520, 6615,
-    6708, 6790, 6868, 6959, 7071, 7196, 7316, 7419, 7506, 7588, 7674, 7766,
-    7860, 7951, 8043, 8142, 8256, 8380, 8511, 8642, 8770, 8883, 8968, 9028,
-    9080, 9139, 9197, 9236, 9246, 9236, 9220, 9215, 9223, 9236, 9239, 9218,
-    9174, 9113, 9045, 8971, 8898, 8833, 8781, 8733, 8675, 8604, 8532, 8474,
-    8436, 8409, 8379, 8342, 8299, 8255, 8204, 8143, 8077, 8013, 7957, 7913,
-    7887, 7875, 7867, 7860, 7851, 7836, 7811, 7777, 7742, 7708, 7668, 7609,
-    7527, 7428, 7334, 7261, 7208, 7167, 7124, 7065, 6986, 6882, 6745, 6553,
-    6282, 5914, 5442, 4863, 4178, 3391, 2516, 1580, 607, -382, -1370, -2351,
-    -3325, -4282, -5208, -6089, -6919, -7686, -8379, -8992, -9520, -9962, -10329, -10637,
-    -10888, -11079, -11213, -11296, -11334, -11337, -11326, -11307, -11281, -11248, -11203, -11131,
-    -11028, -10907, -10783, -10661, -10551, -10454, -10371, -10300, -10234, -10161, -10074, -9981,
-    -9896, -9823, -9763, -9706, -9644, -9568, -9477, -9377, -9284, -9214, -9174, -9156,
-    -9153, -9152, -9141, -9114, -9081, -9041, -8991, -8937, -8890, -8844, -8783, -8702,
-    -8612, -8533, -8484, -8464, -8457, -8449, -8440, -8425, -8392, -8342, -8280, -8211,
-    -8139, -8075, -8030, -7995, -7956, -7900, -7823, -7729, -7625, -7514, -7397, -7276,
-    -7144, -6989, -6807, -6607, -6403, -6211, -6040, -5888, -5745, -5597, -5437, -5268,
-    -5098, -4928, -4751, -4568, -4390, -4223, -4050, -3854, -3641, -3437, -3270, -3146,
-    -3048, -2949, -2835, -2718, -2605, -2492, -2365, -2217, -2061, -1917, -1802, -1709,
-    -1614, -1502, -1370, -1219, -1050, -867, -677, -490, -309, -119, 95, 338,
-    596, 848, 1081, 1292, 1490, 1686, 1887, 2099, 2324, 2557, 2791, 3018,
-    3240, 3471, 3724, 4000, 4284, 4552, 4790, 4997, 5189, 5377, 5555, 5703,
-    5795, 5817, 5761, 5624, 5397, 5067, 4633, 4101, 3490, 2825, 2133, 1441,
-    764, 108, -533, -1161, -1765, -2322, -2809, -3223, -3574, -3875, -4132, -4343,
-    -4503, -4613, -4676, -4689, -4646, -4550, -4416, -4251, -4054, -3811, -3514, -3175,
-    -2817, -2463, -2122, -1792, -1465, -1140, -819, -507, -204, 96, 401, 719,
-    1046, 1367, 1663, 1925, 2160, 2383, 2605, 2829, 3055, 3281, 3503, 3712,
-    3901, 4074, 4246, 4427, 4615, 4792, 4945, 5074, 5189, 5297, 5397, 5487,
-    5570, 5647, 5722, 5795, 5871, 5959, 6066, 6189, 6318, 6438, 6544, 6637,
-    6720, 6795, 6863, 6922, 6976, 7028, 7091, 7173, 7277, 7392, 7503, 7598,
-    7683, 7764, 7846, 7929, 8014, 8111, 8225, 8350, 8469, 8571, 8664, 8760,
-    8865, 8971, 9064, 9141, 9206, 9263, 9306, 9326, 9321, 9298, 9267, 9238,
-    9213, 9196, 9189, 9187, 9183, 9168, 9137, 9088, 9022, 8942, 8852, 8756,
-    8657, 8555, 8455, 8367, 8305, 8270, 8247, 8217, 8168, 8106, 8040, 7976,
-    7914, 7855, 7813, 7797, 7797, 7796, 7775, 7740, 7705, 7682, 7670, 7656,
-    7634, 7603, 7566, 7517, 7451, 7369, 7277, 7187, 7115, 7062, 7021, 6973,
-    6893, 6759, 6555, 6268, 5890, 5415, 4842, 4180, 3441, 2635, 1778, 893,
-    0, -890, -1761, -2616, -3464, -4307, -5138, -5950, -6721, -7431, -8073, -8640,
-    -9128, -9551, -9936, -10295, -10619, -10894, -11111, -11274, -11393, -11477, -11533, -11565,
-    -11591, -11620, -11640, -11640, -11611, -11546, -11444, -11329, -11214, -11091, -10958, -10824,
-    -10688, -10556, -10443, -10342, -10243, -10158, -10082, -9990, -9884, -9776, -9660, -9537,
-    -9422, -9325, -9248, -9197, -9166, -9137, -9091, -9018, -8926, -8826, -8737, -8679,
-    -8654, -8645, -8657, -8684, -8681, -8630, -8573, -8532, -8503, -8502, -8526, -8553,
-    -8599, -8659, -8678, -8635, -8572, -8496, -8399, -8295, -8192, -8082, -7985, -7916,
-    -7854, -7777, -7675, -7536, -7372, -7198, -7019, -6828, -6617, -6396, -6187, -5999,
-    -5821, -5651, -5476, -5265, -5015, -4759, -4511, -4284, -4089, -3909, -3740, -3613,
-    -3509, -3358, -3154, -2946, -2763, -2621, -2519, -2428, -2350, -2311, -2279, -2198,
-    -2068, -1917, -1755, -1595, -1440, -1282, -1128, -991, -870, -760, -636, -470,
-    -275, -74, 138, 359, 582, 824, 1080, 1309, 1515, 1729, 1951, 2196,
-    2487, 2789, 3067, 3334, 3587, 3818, 4052, 4277, 4452, 4629, 4873, 5149,
-    5395, 5585, 5696, 5723, 5681, 5542, 5282, 4955, 4616, 4253, 3847, 3396,
-    2898, 2363, 1805, 1221, 612, -10, -622, -1190, -1691, -2143, -2561, -2941,
-    -3283, -3570, -3782, -3941, -4081, -4185, -4237, -4247, -4199, -4082, -3925, -3749,
-    -3549, -3337, -3112, -2860, -2625, -2429, -2193, -1865, -1496, -1132, -786, -476,
-    -194, 76, 307, 504, 740, 1034, 1336, 1635, 1941, 2232, 2493, 2733,
-    2948, 3141, 3327, 3509, 3704, 3918, 4131, 4330, 4517, 4695, 4873, 5059,
-    5230, 5379, 5526, 5663, 5786, 5929, 6093, 6240, 6368, 6486, 6586, 6678,
-    6761, 6791, 6794, 6856, 6986, 7129, 7258, 7355, 7410, 7447, 7465, 7434,
-    7398, 7426, 7503, 7591, 7692, 7795, 7870, 7919, 7958, 7991, 8027, 8073,
-    8136, 8219, 8313, 8405, 8492, 8570, 8644, 8731, 8823, 8899, 8961, 9011,
-    9035, 9055, 9106, 9172, 9227, 9269, 9285, 9270, 9240, 9176, 9061, 8957,
-    8929, 8946, 8954, 8936, 8880, 8788, 8683, 8544, 8371, 8232, 8171, 8141,
-    8104, 8066, 8021, 7959, 7896, 7837, 7776, 7724, 7680, 7641, 7610, 7587,
-    7569, 7555, 7547, 7556, 7577, 7586, 7578, 7564, 7537, 7497, 7466, 7455,
-    7447, 7417, 7330, 7162, 6926, 6626, 6230, 5733, 5199, 4667, 4106, 3491,
-    2812, 2052, 1233, 376, -538, -1484, -2372, -3181, -3955, -4702, -5419, -6120,
-    -6795, -7431, -8029, -8585, -9096, -9562, -9969, -10308, -10599, -10848, -11054, -11218,
-    -11334, -11410, -11474, -11532, -11574, -11601, -11604, -11561, -11476, -11371, -11259, -11150,
-    -11050, -10945, -10847, -10788, -10747, -10654, -10499, -10335, -10185, -10064, -9980, -9918,
-    -9893, -9932, -9983, -9963, -9893, -9821, -9744, -9666, -9598, -9536, -9483, -9448,
-    -9418, -9392, -9369, -9331, -9278, -9219, -9153, -9086, -9021, -8940, -8852, -8779,
-    -8716, -8660, -8618, -8565, -8473, -8359, -8245, -8130, -8017, -7904, -7783, -7681,
-    -7630, -7578, -7457, -7287, -7115, -6949, -6810, -6707, -6621, -6569, -6561, -6519,
-    -6392, -6229, -6064, -5888, -5713, -5545, -5384, -5249, -5139, -5031, -4913, -4776,
-    -4622, -4464, -4300, -4123, -3942, -3759, -3565, -3378, -3209, -3046, -2895, -2763,
-    -2614, -2425, -2220, -2012, -1800, -1596, -1398, -1201, -1044, -936, -804, -596,
-    -350, -103, 129, 318, 471, 600, 680, 738, 864, 1067, 1287, 1512,
-    1749, 1984, 2212, 2423, 2607, 2782, 2970, 3176, 3412, 3671, 3931, 4188,
-    4450, 4710, 4963, 5194, 5367, 5473, 5512, 5468, 5348, 5189, 5001, 4770,
-    4499, 4187, 3825, 3422, 2971, 2444, 1870, 1341, 877, 438, 3, -444,
-    -910, -1373, -1832, -2310, -2745, -3062, -3287, -3464, -3594, -3679, -3736, -3774,
-    -3802, -3817, -3799, -3742, -3646, -3499, -3308, -3091, -2856, -2601, -2319, -2009,
-    -1686, -1368, -1059, -762, -480, -192, 127, 470, 822, 1180, 1532, 1869,
-    2189, 2462, 2664, 2859, 3119, 3420, 3717, 3988, 4208, 4378, 4527, 4634,
-    4688, 4762, 4902, 5071, 5243, 5411, 5557, 5678, 5781, 5858, 5915, 5973,
-    6039, 6117, 6213, 6318, 6423, 6530, 6649, 6784, 6924, 7056, 7171, 7263,
-    7332, 7388, 7457, 7558, 7687, 7829, 7971, 8101, 8221, 8328, 8383, 8384,
-    8418, 8530, 8671, 8801, 8903, 8951, 8963, 8956, 8895, 8807, 8784, 8830,
-    8881, 8916, 8940, 8951, 8955, 8947, 8915, 8867, 8819, 8777, 8743, 8717,
-    8695, 8673, 8660, 8660, 8663, 8655, 8632, 8594, 8535, 8460, 8389, 8351,
-    8356, 8379, 8399, 8407, 8392, 8360, 8305, 8199, 8079, 8029, 8043, 8058,
-    8059, 8034, 7970, 7888, 7780, 7616, 7463, 7397, 7383, 7368, 7355, 7341,
-    7310, 7261, 7185, 7070, 6915, 6725, 6507, 6265, 5984, 5649, 5259, 4830,
-    4366, 3856, 3286, 2662, 1995, 1294, 569, -161, -866, -1545, -2217, -2885,
-    -3554, -4226, -4885, -5543, -6218, -6852, -7380, -7832, -8254, -8651, -9045, -9442,
-    -9822, -10210, -10615, -10955, -11178, -11328, -11433, -11497, -11551, -11607, -11658, -11712,
-    -11773, -11824, -11838, -11794, -11698, -11580, -11457, -11334, -11212, -11092, -10971, -10853,
-    -10736, -10624, -10522, -10423, -10313, -10186, -10060, -9940, -9822, -9715, -9628, -9562,
-    -9542, -9565, -9555, -9477, -9377, -9275, -9175, -9109, -9084, -9097, -9177, -9285,
-    -9321, -9264, -9163, -9036, -8901, -8785, -8696, -8632, -8594, -8571, -8534, -8456,
-    -8329, -8176, -8023, -7880, -7746, -7613, -7471, -7322, -7173, -7022, -6877, -6750,
-    -6629, -6486, -6317, -6140, -5968, -5812, -5672, -5535, -5416, -5351, -5309, -5213,
-    -5056, -4884, -4714, -4562, -4445, -4346, -4282, -4280, -4275, -4183, -4016, -3817,
-    -3596, -3377, -3190, -3040, -2918, -2811, -2689, -2533, -2332, -2094, -1844, -1604,
-    -1380, -1163, -936, -687, -429, -174, 74, 309, 523, 743, 995, 1260,
-    1516, 1762, 2006, 2254, 2499, 2695, 2825, 2959, 3167, 3426, 3696, 3956,
-    4176, 4352, 4497, 4579, 4597, 4631, 4723, 4830, 4911, 4948, 4913, 4790,
-    4589, 4327, 4024, 3701, 3377, 3061, 2740, 2387, 1995, 1585, 1181, 804,
-    456, 113, -234, -578, -925, -1269, -1571, -1812, -2014, -2197, -2361, -2502,
-    -2612, -2712, -2842, -2977, -3037, -3001, -2907, -2789, -2671, -2572, -2481, -2403,
-    -2366, -2329, -2207, -1982, -1702, -1401, -1102, -831, -595, -381, -175, 43,
-    293, 588, 918, 1240, 1527, 1790, 2053, 2331, 2630, 2935, 3221, 3484,
-    3728, 3942, 4140, 4357, 4597, 4830, 5043, 5240, 5429, 5608, 5739, 5803,
-    5865, 5993, 6176, 6367, 6538, 6676, 6781, 6857, 6876, 6834, 6810, 6876,
-    7011, 7160, 7300, 7425, 7518, 7576, 7609, 7632, 7669, 7740, 7851, 7975,
-    8081, 8163, 8243, 8331, 8428, 8536, 8642, 8729, 8801, 8861, 8902, 8941,
-    9004, 9077, 9135, 9171, 9199, 9232, 9262, 9246, 9179, 9124, 9124, 9152,
-    9174, 9172, 9138, 9080, 8995, 8852, 8671, 8536, 8481, 8461, 8439, 8414,
-    8375, 8305, 8209, 8103, 8000, 7923, 7889, 7888, 7888, 7866, 7831, 7806,
-    7796, 7799, 7815, 7836, 7848, 7854, 7851, 7838, 7835, 7860, 7886, 7891,
-    7877, 7860, 7848, 7818, 7730, 7593, 7467, 7369, 7250, 7074, 6823, 6492,
-    6095, 5622, 5048, 4426, 3842, 3295, 2722, 2113, 1482, 810, 91, -658,
-    -1422, -2175, -2883, -3537, -4156, -4761, -5365, -5955, -6510, -7027, -7512, -7964,
-    -8390, -8796, -9171, -9515, -9831, -10100, -10325, -10529, -10718, -10878, -11001, -11095,
-    -11191, -11317, -11434, -11476, -11448, -11392, -11333, -11284, -11253, -11237, -11262, -11337,
-    -11382, -11327, -11220, -11120, -11020, -10917, -10847, -10814, -10803, -10800, -10768, -10681,
-    -10559, -10429, -10317, -10230, -10154, -10066, -9969, -9868, -9766, -9663, -9559, -9452,
-    -9354, -9265, -9167, -9062, -8965, -8873, -8774, -8658, -8537, -8458, -8427, -8374,
-    -8254, -8094, -7934, -7788, -7672, -7575, -7495, -7470, -7486, -7443, -7313, -7163,
-    -7024, -6874, -6730, -6625, -6557, -6515, -6472, -6374, -6220, -6039, -5858, -5695,
-    -5557, -5428, -5296, -5160, -5021, -4870, -4701, -4524, -4351, -4195, -4046, -3885,
-    -3720, -3556, -3390, -3215, -3024, -2852, -2735, -2636, -2483, -2264, -2027, -1792,
-    -1573, -1384, -1210, -1072, -1004, -933, -771, -546, -324, -109, 117, 325,
-    497, 632, 745, 892, 1117, 1380, 1641, 1883, 2099, 2304, 2512, 2732,
-    2956, 3186, 3435, 3689, 3926, 4129, 4302, 4469, 4632, 4765, 4853, 4889,
-    4895, 4876, 4788, 4617, 4421, 4248, 4074, 3866, 3618, 3322, 2985, 2626,
-    2204, 1725, 1287, 932, 606, 277, -40, -347, -668, -1005, -1356, -1692,
-    -1939, -2096, -2221, -2340, -2456, -2570, -2670, -2736, -2759, -2749, -2710, -2641,
-    -2556, -2459, -2353, -2233, -2077, -1886, -1671, -1453, -1248, -1028, -788, -557,
-    -330, -83, 183, 455, 734, 1012, 1261, 1488, 1699, 1866, 2036, 2266,
-    2519, 2750, 2964, 3176, 3369, 3533, 3675, 3794, 3937, 4149, 4380, 4578,
-    4745, 4887, 5012, 5138, 5282, 5440, 5595, 5744, 5883, 6008, 6128, 6242,
-    6363, 6500, 6641, 6779, 6896, 6996, 7106, 7214, 7307, 7397, 7494, 7591,
-    7683, 7773, 7853, 7916, 7974, 7999, 7982, 7996, 8058, 8114, 8147, 8177,
-    8212, 8236, 8238, 8199, 8127, 8108, 8163, 8219, 8238, 8219, 8172, 8122,
-    8089, 8075, 8060, 8036, 8013, 7987, 7956, 7917, 7867, 7825, 7794, 7770,
-    7752, 7719, 7680, 7649, 7612, 7572, 7533, 7491, 7451, 7416, 7389, 7350,
-    7305, 7249, 7150, 7048, 7008, 6997, 6973, 6949, 6932, 6910, 6873, 6810,
-    6707, 6607, 6583, 6600, 6591, 6546, 6468, 6370, 6265, 6154, 6021, 5848,
-    5643, 5424, 5188, 4928, 4630, 4299, 3951, 3580, 3185, 2761, 2306, 1846,
-    1383, 907, 422, -72, -570, -1060, -1534, -2003, -2472, -2936, -3419, -3926,
-    -4387, -4771, -5125, -5465, -5783, -6082, -6371, -6663, -6978, -7308, -7578, -7746,
-    -7881, -8025, -8180, -8339, -8479, -8594, -8690, -8780, -8867, -8927, -8962, -8983,
-    -9008, -9041, -9064, -9070, -9069, -9073, -9085, -9096, -9091, -9072, -9048, -9014,
-    -8979, -8945, -8905, -8861, -8817, -8773, -8743, -8747, -8755, -8699, -8594, -8488,
-    -8383, -8280, -8173, -8067, -7984, -7941, -7915, -7828, -7683, -7543, -7416, -7301,
-    -7198, -7089, -6972, -6849, -6737, -6631, -6514, -6380, -6239, -6110, -5998, -5884,
-    -5760, -5639, -5533, -5439, -5348, -5242, -5125, -5011, -4900, -4796, -4695, -4594,
-    -4494, -4395, -4309, -4252, -4230, -4184, -4069, -3929, -3798, -3676, -3558, -3441,
-    -3346, -3294, -3290, -3268, -3154, -3001, -2870, -2765, -2684, -2608, -2518, -2410,
-    -2297, -2192, -2080, -1952, -1808, -1660, -1523, -1394, -1255, -1110, -971, -841,
-    -719, -592, -437, -270, -100, 68, 232, 395, 559, 735, 901, 1039,
-    1145, 1237, 1390, 1600, 1801, 1972, 2125, 2278, 2419, 2521, 2571, 2577,
-    2622, 2728, 2808, 2837, 2828, 2792, 2748, 2704, 2654, 2578, 2475, 2362,
-    2255, 2156, 2046, 1908, 1752, 1596, 1437, 1274, 1106, 928, 768, 633,
-    499, 369, 249, 139, 32, -65, -154, -259, -374, -505, -613, -632,
-    -616, -613, -624, -636, -634, -642, -669, -729, -784, -747, -660, -598,
-    -555, -522, -483, -431, -363, -288, -218, -146, -64, 39, 150, 251,
-    344, 443, 548, 651, 759, 850, 934, 1043, 1155, 1262, 1380, 1504,
-    1625, 1737, 1857, 1970, 2070, 2162, 2227, 2335, 2509, 2672, 2809, 2929,
-    3051, 3168, 3256, 3315, 3335, 3395, 3544, 3692, 3808, 3904, 3988, 4067,
-    4145, 4227, 4309, 4389, 4470, 4560, 4660, 4742, 4804, 4853, 4904, 4957,
-    5014, 5065, 5085, 5103, 5137, 5156, 5181, 5212, 5239, 5253, 5257, 5270,
-    5272, 5270, 5242, 5195, 5216, 5268, 5287, 5283, 5271, 5272, 5263, 5232,
-    5167, 5078, 5063, 5106, 5123, 5117, 5100, 5078, 5051, 5022, 5004, 4986,
-    4974, 4971, 4978, 4980, 4960, 4930, 4902, 4884, 4874, 4865, 4840, 4791,
-    4751, 4712, 4671, 4644, 4616, 4580, 4530, 4485, 4443, 4392, 4326, 4211,
-    4105, 4068, 4023, 3941, 3823, 3694, 3571, 3421, 3238, 2999, 2765, 2614,
-    2469, 2280, 2059, 1815, 1572, 1329, 1093, 862, 625, 393, 164, -63,
-    -307, -566, -819, -1059, -1287, -1509, -1733, -1970, -2204, -2413, -2620, -2813,
-    -2992, -3175, -3353, -3523, -3676, -3823, -3970, -4137, -4329, -4450, -4504, -4582,
-    -4683, -4793, -4885, -4961, -5054, -5178, -5331, -5422, -5438, -5469, -5522, -5592,
-    -5663, -5713, -5754, -5781, -5806, -5829, -5848, -5861, -5871, -5905, -5939, -5955,
-    -5966, -5966, -5954, -5942, -5934, -5907, -5863, -5827, -5778, -5729, -5690, -5639,
-    -5579, -5513, -5442, -5377, -5348, -5311, -5177, -5020, -4911, -4815, -4723, -4616,
-    -4507, -4426, -4394, -4370, -4261, -4122, -4021, -3941, -3884, -3822, -3740, -3657,
-    -3576, -3502, -3434, -3367, -3293, -3232, -3199, -3159, -3106, -3063, -3012, -2946,
-    -2889, -2839, -2767, -2707, -2661, -2600, -2537, -2475, -2405, -2340, -2276, -2209,
-    -2149, -2122, -2039, -1865, -1722, -1621, -1523, -1434, -1338, -1238, -1166, -1142,
-    -1087, -951, -823, -721, -621, -538, -443, -333, -225, -121, -20, 76,
-    172, 279, 364, 422, 484, 551, 619, 716, 826, 899, 975, 1064,
-    1118, 1160, 1213, 1269, 1323, 1368, 1404, 1421, 1440, 1425, 1369, 1389,
-    1449, 1460, 1453, 1436, 1408, 1371, 1323, 1224, 1078, 1009, 1001, 972,
-    934, 874, 787, 711, 652, 584, 514, 456, 401, 353, 301, 222,
-    130, 60, 11, -37, -48, -56, -90, -98, -122, -163, -172, -163,
-    -149, -155, -156, -154, -165, -158, -195, -217, -134, -48, 2, 31,
-    51, 75, 98, 121, 82, 35, 90, 169, 226, 266, 275, 286,
-    323, 372, 407, 451, 513, 571, 629, 678, 704, 728, 784, 856,
-    936, 1045, 1129, 1207, 1303, 1371, 1451, 1559, 1684, 1807, 1898, 1998,
-    2085, 2177, 2270, 2298, 2391, 2564, 2707, 2811, 2883, 2959, 3030, 3082,
-    3108, 3063, 3064, 3154, 3231, 3283, 3303, 3296, 3296, 3305, 3327, 3342,
-    3355, 3368, 3372, 3374, 3355, 3311, 3289, 3306, 3323, 3340, 3352, 3339,
-    3337, 3325, 3304, 3324, 3375, 3434, 3457, 3454, 3463, 3453, 3439, 3383,
-    3318, 3368, 3457, 3508, 3529, 3525, 3530, 3508, 3459, 3376, 3268, 3254,
-    3295, 3300, 3284, 3235, 3184, 3139, 3098, 3079, 3049, 3017, 2987, 2937,
-    2889, 2825, 2744, 2680, 2627, 2581, 2535, 2470, 2399, 2324, 2235, 2149,
-    2074, 2011, 1945, 1842, 1725, 1607, 1481, 1335, 1146, 994, 930, 877,
-    794, 673, 532, 393, 233, 50, -173, -369, -466, -559, -699, -862,
-    -1027, -1157, -1278, -1398, -1511, -1630, -1739, -1850, -1964, -2069, -2195, -2311,
-    -2398, -2474, -2536, -2609, -2682, -2732, -2797, -2879, -2939, -2965, -2977, -3003,
-    -3041, -3097, -3155, -3191, -3265, -3365, -3377, -3321, -3303, -3313, -3319, -3346,
-    -3386, -3419, -3497, -3609, -3647, -3618, -3629, -3670, -3692, -3708, -3717, -3710,
-    -3703, -3703, -3704, -3695, -3678, -3668, -3676, -3680, -3658, -3626, -3583, -3521,
-    -3468, -3420, -3342, -3266, -3224, -3166, -3071, -2991, -2941, -2897, -2851, -2795,
-    -2741, -2723, -2699, -2589, -2437, -2331, -2258, -2191, -2144, -2103, -2071, -2085,
-    -2112, -2081, -2018, -1984, -1969, -1945, -1917, -1893, -1862, -1827, -1798, -1780,
-    -1752, -1711, -1688, -1696, -1690, -1644, -1574, -1492, -1416, -1354, -1282, -1187,
-    -1100, -1024, -935, -838, -744, -652, -584, -523, -441, -370, -332, -241,
-    -74, 77, 179, 268, 346, 414, 491, 532, 513, 503, 549, 591,
-    596, 589, 605, 640, 649, 643, 648, 661, 662, 651, 637, 590,
-    530, 515, 493, 470, 476, 477, 463, 491, 520, 509, 535, 569,
-    584, 568, 570, 551, 539, 533, 508, 481, 519, 618, 701, 718,
-    719, 742, 771, 749, 703, 599, 524, 523, 515, 439, 374, 382,
-    363, 340, 319, 284, 252, 170, 113, 38, -28, -70, -133, -142,
-    -163, -211, -197, -162, -127, -103, -72, 7, 63, 80, 123, 123,
-    143, 120, 196, 247, 244, 374, 537, 599, 653, 776, 820, 846,
-    863, 822, 703, 768, 871, 830, 815, 870, 909, 949, 998, 1030,
-    1022, 1095, 1096, 1118, 1117, 1115, 1100, 1196, 1238, 1220, 1309, 1318,
-    1385, 1448, 1492, 1518, 1568, 1643, 1668, 1713, 1676, 1662, 1712, 1865,
-    1828, 1901, 2145, 2240, 2236, 2389, 2426, 2368, 2353, 2367, 2858, 5283,
-    8831, 9138, 8845, 8637, 8220, 7899, 7338, 6724, 6139, 5334, 4378, 3854,
-    3073, 1906, 1785, 1208, 802, 325, 302, 1297, 959, 435, 83, 1135,
-    1369, 2850, 3292, 4624, 5481, 6427, 7202, 7685, 6956, 5795, 3690, 601,
-    -2371, -5384, -7153, -8986, -9510, -9249, -10030, -11901, -15380, -15997, -12528, -9158,
-    -7449, -5781, -237, 7186, 11270, 9847, 11455, 14220, 15623, 15268, 15521, 19183,
-    20173, 19427, 18096, 14339, 534, -12102, -1718, 14245, 4943, 2209, 1206, 2574,
-    1607, 3115, 2556, -778, 875, 8430, 17425, 20988, 21252, 21181, 20822, 19841,
-    17559, 15223, 13332, 10800, 7648, 3977, 1474, -639, -2031, -3179, -5040, -5933,
-    -6683, -8039, -8916, -9031, -8915, -9696, -10271, -10404, -10978, -10663, -10501, -10814,
-    -10832, -10305, -9665, -9294, -8666, -8305, -7880, -6541, -4583, -5026, -7959, -9316,
-    -9255, -8782, -8571, -7951, -6430, -4666, -2768, -547, 3121, 6985, 10114, 12201,
-    14079, 15768, 17107, 18411, 19504, 20441, 21007, 21595, 22181, 22738, 23177, 23280,
-    23330, 23164, 22838, 22916, 22969, 22349, 22276, 21439, 21018, 20527, 20140, 19700,
-    19263, 18543, 18090, 17527, 17371, 16773, 15905, 14773, 13751, 13429, 13815, 14686,
-    15383, 15400, 15159, 14656, 14081, 13746, 12472, 10147, 6686, 2587, -2021, -5820,
-    -9072, -12477, -15575, -18322, -20758, -22816, -24725, -26281, -27328, -27938, -28609, -29463,
-    -29552, -29350, -29265, -29512, -29556, -29287, -28682, -28212, -28012, -27761, -27319, -26616,
-    -25725, -24554, -23755, -24116, -24854, -25320, -25416, -25161, -24735, -24055, -23291, -22844,
-    -22264, -21125, -19036, -16489, -14279, -11665, -8668, -5676, -2945, -1055, 469, 1803,
-    2921, 3867, 4528, 5354, 5928, 6503, 6942, 7177, 7329, 7587, 7699, 7441,
-    7072, 6767, 6623, 6597, 6464, 6113, 5889, 5548, 5457, 5222, 4774, 4279,
-    4015, 3904, 3379, 2407, 1572, 1506, 2428, 3659, 4604, 5233, 5809, 6226,
-    5946, 4831, 3092, 1331, -540, -3150, -6266, -9284, -11435, -12870, -14208, -15382,
-    -16433, -17284, -18055, -18959, -19759, -20138, -20276, -20415, -20686, -20796, -20713, -20594,
-    -20275, -19831, -19416, -19224, -18862, -18337, -17805, -17344, -16691, -16057, -15304, -14412,
-    -13656, -12898, -11893, -10763, -9503, -8068, -7464, -7500, -8058, -8501, -8822, -9043,
-    -9134, -9057, -8831, -8020, -6258, -3866, -472, 3123, 6597, 9155, 11387, 13430,
-    15070, 16470, 17916, 19236, 20262, 21015, 21708, 22429, 23083, 23712, 24297, 24646,
-    24728, 24867, 24989, 24983, 24980, 25072, 24962, 24696, 24124, 23475, 22752, 22012,
-    21115, 20131, 19026, 17692, 16308, 15048, 13818, 12551, 11246, 10181, 9245, 8061,
-    6550, 5517, 5151, 5055, 5158, 5567, 6020, 6278, 6343, 6448, 6590, 5958,
-    4744, 2762, -196, -3232, -5931, -7661, -9267, -10741, -12037, -13276, -14245, -15128,
-    -15797, -16374, -16915, -17385, -17707, -17376, -16934, -16663, -16392, -16242, -15933, -15717,
-    -15543, -15359, -15053, -14610, -14150, -13563, -12719, -11889, -11159, -10450, -9617, -8933,
-    -8309, -7633, -7021, -6464, -5710, -5010, -4189, -3187, -2427, -2144, -2232, -2508,
-    -2927, -3371, -3709, -4026, -4059, -3919, -3531, -2751, -1067, 1537, 4586, 7579,
-    9872, 11751, 13492, 15009, 16484, 17888, 19041, 19998, 20877, 21519, 22005, 22523,
-    22921, 22994, 23048, 23184, 23180, 23211, 23146, 22808, 22430, 22054, 21734, 21272,
-    20779, 20295, 19617, 18908, 18266, 17672, 17064, 16297, 15552, 14898, 14249, 13436,
-    12602, 11841, 11001, 10184, 9337, 8557, 7659, 6520, 5473, 4416, 3131, 2239,
-    1749, 1672, 1681, 1656, 1875, 2098, 2060, 1862, 1537, 1055, 662, 295,
-    -1011, -2718, -4310, -5985, -7568, -9111, -10583, -12066, -13284, -14362, -15324, -16056,
-    -16643, -17246, -17777, -18177, -18513, -18745, -18898, -18936, -18818, -18708, -18610, -18408,
-    -18200, -17962, -17666, -17277, -16817, -16423, -16130, -15817, -15490, -15120, -14766, -14538,
-    -14308, -14095, -13946, -13749, -13476, -13076, -12784, -12536, -12182, -11773, -11114, -10192,
-    -8966, -7374, -6460, -6210, -6151, -6020, -5814, -5539, -5093, -4702, -4287, -3688,
-    -2877, -2004, -1276, -457, 711, 2215, 3937, 5645, 7372, 9018, 10505, 11823,
-    13070, 14136, 15134, 16009, 16724, 17391, 18152, 18788, 19174, 19373, 19442, 19264,
-    18937, 18549, 18032, 17397, 16895, 16372, 15774, 15115, 14398, 13616, 12903, 12310,
-    11583, 10798, 10065, 9248, 8433, 7660, 6966, 6212, 5399, 4690, 3907, 3099,
-    2374, 1612, 557, -675, -1908, -2938, -3810, -4626, -5477, -6604, -7889, -8972,
-    -9336, -9400, -9446, -9400, -9421, -9464, -9526, -9656, -9998, -10458, -10926, -11488,
-    -12000, -12302, -12654, -13005, -13225, -13581, -14326, -15382, -16599, -17665, -18712, -19779,
-    -20708, -21542, -22311, -22960, -23407, -23749, -23895, -23900, -23715, -23473, -23191, -22813,
-    -22268, -21463, -20582, -19690, -18834, -17969, -17186, -16425, -15671, -14940, -14364, -13646,
-    -12889, -12265, -11587, -10733, -9879, -9005, -8081, -7178, -6407, -5584, -4649, -3828,
-    -2842, -1734, -606, 514, 1530, 2473, 3437, 4446, 5546, 6664, 7625, 8409,
-    9180, 10055, 10471, 10465, 10365, 10159, 9931, 9697, 9459, 9230, 9252, 9354,
-    9512, 9867, 10351, 10931, 11564, 12150, 12495, 13078, 14184, 15368, 16526, 17727,
-    18871, 19822, 20580, 21304, 21970, 22369, 22664, 22906, 22960, 22984, 22932, 22853,
-    22459, 21818, 21203, 20600, 19991, 19348, 18676, 18046, 17457, 16906, 16459, 15947,
-    15396, 14877, 14345, 13611, 12826, 12111, 11390, 10724, 10042, 9279, 8509, 7794,
-    7115, 6426, 5422, 4299, 3281, 2453, 1582, 646, -184, -1005, -1945, -2710,
-    -3212, -3807, -4493, -5030, -5493, -5964, -6606, -7300, -7746, -8029, -8168, -8251,
-    -8418, -8650, -8930, -9199, -9506, -9840, -10162, -10448, -10695, -10973, -11300, -11817,
-    -12320, -12719, -13166, -13657, -14053, -14471, -14809, -14910, -15015, -15087, -14758, -14964,
-    -15603, -16162, -16555, -16956, -17301, -17587, -17746, -17793, -17671, -17435, -16932, -16259,
-    -15494, -14799, -14194, -13605, -12994, -12432, -11904, -11335, -10792, -10340, -9955, -9579,
-    -9183, -8751, -8316, -7824, -7223, -6424, -5578, -4694, -3845, -2907, -1782, -573,
-    570, 1773, 2967, 4156, 5330, 6549, 7572, 8401, 9065, 9668, 10309, 10933,
-    11539, 12166, 12740, 13318, 13887, 14439, 14957, 15430, 15863, 16334, 16910, 17470,
-    17538, 17309, 17147, 17085, 16917, 16528, 16176, 15935, 15702, 15413, 15182, 15104,
-    15125, 15187, 15215, 15212, 15246, 15393, 15527, 15647, 16065, 16752, 17404, 17999,
-    18562, 19072, 19454, 19687, 19775, 19298, 18631, 17980, 17166, 16425, 15743, 14981,
-    14117, 13331, 12616, 11868, 11142, 10571, 9954, 9246, 8662, 8149, 7558, 6858,
-    6234, 5618, 5093, 4591, 4102, 3631, 3204, 2759, 2298, 1866, 1362, 817,
-    -9, -1276, -2625, -3913, -5252, -6570, -7829, -8920, -9675, -10390, -11134, -11856,
-    -12550, -13143, -13795, -14388, -14902, -15375, -15824, -16300, -16764, -17264, -17713, -18095,
-    -18490, -18815, -19195, -19635, -19995, -20093, -20117, -20111, -20047, -19966, -19863, -19786,
-    -19673, -19625, -19569, -19531, -19489, -19430, -19435, -19458, -19444, -19448, -19455, -19425,
-    -19427, -19381, -19406, -19376, -19254, -19094, -19078, -19210, -19309, -19358, -19399, -19407,
-    -19120, -18932, -19014, -19129, -19179, -19172, -18746, -18055, -17381, -16660, -15901, -15138,
-    -14467, -13887, -13276, -12733, -12216, -11702, -11165, -10619, -10044, -9508, -8948, -8441,
-    -7952, -7507, -6975, -6432, -5885, -5386, -4856, -4197, -3456, -2708, -1970, -803,
-    721, 2271, 3819, 5343, 6627, 7555, 8398, 9225, 10061, 10929, 11752, 12593,
-    13394, 14093, 14830, 15560, 16183, 16646, 17152, 17742, 18185, 18452, 18757, 19138,
-    19483, 19659, 19832, 20002, 20200, 20355, 20411, 20439, 20530, 20579, 20517, 20426,
-    20104, 19657, 19247, 18917, 18596, 18355, 18230, 18104, 17906, 17656, 17452, 17257,
-    17096, 16846, 16676, 16574, 16352, 16276, 16225, 16203, 16245, 16238, 16224, 16289,
-    16321, 16324, 16183, 16115, 16323, 16608, 16618, 16125, 15569, 14983, 14386, 13716,
-    13084, 12564, 12123, 11675, 11167, 10691, 10209, 9734, 9272, 8832, 8369, 7948,
-    7503, 7111, 6725, 6370, 6102, 5638, 4981, 4341, 3695, 3059, 2496, 1954,
-    1410, 866, 445, -142, -1311, -2585, -3795, -4704, -5483, -6275, -7137, -7913,
-    -8609, -9281, -9957, -10667, -11388, -12132, -12818, -13468, -14089, -14665, -15228, -15719,
-    -16177, -16648, -17101, -17557, -17951, -18270, -18566, -18817, -19026, -19235, -19385, -19418,
-    -19433, -19449, -19552, -19606, -19565, -19400, -19241, -18976, -18616, -18366, -18183, -17880,
-    -17548, -17281, -17001, -16732, -16570, -16412, -16196, -15989, -15832, -15578, -15369, -15146,
-    -14947, -14755, -14579, -14440, -14337, -14170, -13944, -13818, -13674, -13512, -13321, -12984,
-    -12458, -11927, -11414, -10905, -10394, -9852, -9319, -8812, -8290, -7780, -7266, -6706,
-    -6158, -5617, -5171, -4730, -4328, -3952, -3486, -2842, -2140, -1466, -824, -239,
-    314, 900, 1460, 1975, 2397, 2873, 3301, 3644, 3992, 4371, 4650, 4893,
-    5154, 5412, 5948, 6685, 7381, 8129, 8891, 9636, 10391, 11072, 11738, 12311,
-    12839, 13372, 13917, 14468, 15058, 15568, 16062, 16514, 16945, 17288, 17666, 17952,
-    18198, 18428, 18599, 18757, 19026, 19243, 19400, 19524, 19642, 19745, 19821, 19883,
-    19923, 19918, 19954, 19953, 19871, 19831, 19758, 19649, 19529, 19350, 19135, 18951,
-    18741, 18497, 18261, 18067, 17914, 17799, 17596, 17216, 16717, 16212, 15678, 15155,
-    14695, 14196, 13743, 13343, 12935, 12518, 12164, 11796, 11472, 11122, 10810, 10314,
-    9759, 9312, 8870, 8388, 7896, 7372, 6869, 6350, 5806, 5193, 4645, 4236,
-    3801, 3264, 2612, 1915, 1251, 547, -100, -783, -1413, -2051, -2620, -3190,
-    -3728, -4222, -4676, -5150, -5651, -6109, -6458, -6735, -6957, -7127, -7311, -7465,
-    -7598, -7723, -7905, -8090, -8228, -8371, -8510, -8692, -8877, -8963, -9006, -9052,
-    -9123, -9229, -9515, -10136, -10842, -11603, -12385, -13078, -13710, -14347, -14988, -15585,
-    -16220, -16874, -17468, -18039, -18635, -19154, -19597, -20059, -20484, -20837, -21117, -21382,
-    -21654, -21934, -22145, -22361, -22517, -22649, -22730, -22793, -22783, -22734, -22702, -22641,
-    -22566, -22483, -22399, -22300, -22215, -22126, -21950, -21729, -21486, -21265, -21050, -20845,
-    -20600, -20363, -20181, -19980, -19737, -19433, -19052, -18614, -18185, -17735, -17251, -16780,
-    -16366, -15948, -15539, -15180, -14842, -14503, -14146, -13736, -13364, -13036, -12774, -12432,
-    -11886, -11308, -10693, -10067, -9441, -8857, -8316, -7788, -7218, -6659, -6101, -5569,
-    -4876, -4127, -3334, -2466, -1637, -875, -163, 536, 1237, 1879, 2529, 3098,
-    3677, 4352, 4946, 5438, 5877, 6307, 6644, 6927, 7184, 7445, 7707, 7949,
-    8152, 8385, 8608, 8809, 8987, 9177, 9397, 9607, 9824, 10048, 10265, 10500,
-    10738, 10979, 11253, 11607, 12132, 12652, 13215, 13768, 14319, 14843, 15351, 15967,
-    16612, 17220, 17831, 18401, 18949, 19456, 19930, 20336, 20765, 21209, 21647, 22017,
-    22361, 22697, 23022, 23314, 23547, 23766, 23988, 24187, 24378, 24537, 24729, 24855,
-    24937, 25011, 25061, 25085, 25113, 25126, 25101, 25074, 25048, 24973, 24890, 24816,
-    24689, 24527, 24343, 24100, 23837, 23559, 23230, 22866, 22570, 22265, 21934, 21576,
-    21192, 20773, 20339, 19887, 19357, 18799, 18313, 17822, 17286, 16741, 16189, 15637,
-    15057, 14409, 13778, 13167, 12557, 11952, 11343, 10763, 10203, 9617, 9016, 8398,
-    7819, 7262, 6721, 6200, 5585, 4802, 4017, 3246, 2508, 1764, 1037, 319,
-    -384, -1098, -1794, -2501, -3159, -3731, -4305, -4897, -5364, -5793, -6214, -6614,
-    -7050, -7490, -7892, -8253, -8631, -9005, -9391, -9785, -10178, -10586, -10997, -11400,
-    -11761, -12132, -12524, -12879, -13239, -13571, -13886, -14201, -14518, -14820, -15104, -15372,
-    -15631, -15862, -16067, -16269, -16474, -16691, -16909, -17105, -17281, -17472, -17658, -17888,
-    -18125, -18291, -18398, -18551, -18716, -18865, -19046, -19243, -19440, -19698, -19984, -20175,
-    -20350, -20539, -20749, -20978, -21186, -21416, -21661, -21904, -22097, -22267, -22427, -22557,
-    -22683, -22804, -22918, -23027, -23115, -23174, -23199, -23208, -23195, -23161, -23077, -22960,
-    -22816, -22645, -22462, -22259, -22039, -21805, -21544, -21266, -21017, -20730, -20320, -19894,
-    -19499, -19080, -18667, -18243, -17805, -17368, -16957, -16505, -15949, -15390, -14850, -14323,
-    -13806, -13289, -12747, -12205, -11686, -11131, -10573, -10023, -9440, -8856, -8310, -7769,
-    -7201, -6662, -6118, -5527, -4761, -3952, -3152, -2353, -1566, -808, -79, 621,
-    1305, 1979, 2626, 3232, 3798, 4308, 4844, 5360, 5783, 6179, 6539, 6862,
-    7164, 7443, 7713, 7960, 8252, 8580, 8877, 9155, 9412, 9662, 9906, 10164,
-    10388, 10600, 10838, 11065, 11288, 11524, 11765, 11995, 12215, 12454, 12681, 12910,
-    13147, 13396, 13627, 13877, 14134, 14394, 14651, 14905, 15143, 15359, 15571, 15774,
-    15987, 16193, 16365, 16588, 16833, 17068, 17275, 17459, 17623, 17772, 17919, 18036,
-    18113, 18244, 18380, 18516, 18648, 18773, 18880, 18971, 19053, 19124, 19201, 19306,
-    19395, 19485, 19578, 19668, 19742, 19799, 19860, 19920, 19997, 20085, 20149, 20218,
-    20277, 20338, 20408, 20472, 20507, 20539, 20554, 20543, 20514, 20459, 20364, 20257,
-    20207, 20145, 20042, 19907, 19738, 19528, 19294, 19033, 18693, 18329, 18011, 17673,
-    17292, 16886, 16457, 15994, 15530, 15040, 14519, 13993, 13472, 12944, 12404, 11859,
-    11300, 10729, 10162, 9593, 9039, 8491, 7920, 7350, 6801, 6260, 5721, 5068,
-    4290, 3504, 2733, 1978, 1264, 599, -71, -788, -1459, -2041, -2584, -3104,
-    -3630, -4128, -4499, -4790, -5101, -5440, -5753, -6011, -6261, -6517, -6773, -7040,
-    -7324, -7614, -7906, -8192, -8445, -8709, -8988, -9253, -9525, -9805, -10093, -10375,
-    -10667, -10929, -11194, -11470, -11742, -11989, -12237, -12481, -12704, -12932, -13170, -13410,
-    -13660, -13886, -14105, -14371, -14669, -14886, -15070, -15261, -15443, -15632, -15845, -16062,
-    -16280, -16537, -16806, -17017, -17207, -17413, -17617, -17828, -18053, -18273, -18495, -18722,
-    -18924, -19100, -19282, -19455, -19611, -19753, -19891, -20046, -20198, -20356, -20488, -20591,
-    -20659, -20698, -20731, -20751, -20762, -20763, -20757, -20737, -20702, -20665, -20591, -20535,
-    -20527, -20508, -20408, -20282, -20128, -19962, -19821, -19693, -19554, -19403, -19280, -19138,
-    -18935, -18750, -18550, -18335, -18106, -17874, -17624, -17387, -17158, -16887, -16598, -16318,
-    -16014, -15692, -15359, -15019, -14667, -14310, -13929, -13512, -13072, -12639, -12194, -11735,
-    -11263, -10787, -10310, -9818, -9313, -8803, -8302, -7807, -7337, -6899, -6415, -5775,
-    -5015, -4233, -3465, -2726, -2005, -1301, -628, 20, 671, 1338, 1956, 2541,
-    3127, 3684, 4138, 4545, 4893, 5167, 5454, 5742, 6008, 6268, 6525, 6789,
-    7022, 7250, 7449, 7661, 7901, 8140, 8376, 8613, 8848, 9097, 9345, 9576,
-    9787, 9985, 10171, 10345, 10508, 10637, 10738, 10916, 11135, 11343, 11543, 11718,
-    11886, 12066, 12247, 12378, 12489, 12657, 12830, 12977, 13142, 13314, 13489, 13662,
-    13835, 14002, 14173, 14372, 14585, 14804, 15026, 15241, 15450, 15651, 15865, 16077,
-    16332, 16603, 16866, 17135, 17399, 17673, 17965, 18247, 18510, 18750, 18991, 19221,
-    19463, 19694, 19881, 20070, 20315, 20548, 20759, 20957, 21129, 21277, 21416, 21544,
-    21615, 21681, 21798, 21872, 21903, 21909, 21907, 21894, 21858, 21778, 21679, 21606,
-    21519, 21380, 21227, 21062, 20878, 20669, 20439, 20196, 19938, 19680, 19419, 19152,
-    18890, 18606, 18311, 18014, 17706, 17382, 17039, 16689, 16319, 15944, 15520, 15049,
-    14629, 14250, 13862, 13462, 13041, 12625, 12216, 11778, 11285, 10762, 10287, 9851,
-    9388, 8935, 8472, 7997, 7509, 6998, 6474, 5986, 5496, 4849, 4095, 3358,
-    2602, 1859, 1125, 388, -335, -1033, -1713, -2373, -3001, -3616, -4250, -4807,
-    -5214, -5562, -5919, -6263, -6601, -6918, -7201, -7518, -7858, -8124, -8344, -8557,
-    -8773, -8998, -9217, -9429, -9631, -9862, -10100, -10282, -10443, -10605, -10765, -10926,
-    -11077, -11238, -11402, -11565, -11719, -11838, -11948, -12066, -12185, -12311, -12438, -12570,
-    -12703, -12830, -12931, -13026, -13119, -13204, -13317, -13425, -13516, -13630, -13750, -13889,
-    -14038, -14175, -14331, -14519, -14748, -14951, -15079, -15200, -15343, -15501, -15685, -15876,
-    -16063, -16268, -16505, -16712, -16860, -17012, -17194, -17386, -17584, -17787, -17994, -18202,
-    -18407, -18595, -18783, -18970, -19139, -19308, -19479, -19639, -19792, -19942, -20085, -20205,
-    -20318, -20424, -20518, -20616, -20691, -20742, -20800, -20872, -20932, -20968, -20998, -21018,
-    -21054, -21119, -21117, -21045, -20985, -20925, -20859, -20792, -20707, -20611, -20531, -20462,
-    -20344, -20183, -20040, -19904, -19742, -19557, -19354, -19159, -18980, -18777, -18544, -18305,
-    -18046, -17766, -17495, -17216, -16916, -16616, -16303, -15948, -15581, -15210, -14808, -14402,
-    -14003, -13567, -13112, -12663, -12198, -11718, -11247, -10770, -10268, -9789, -9319, -8781,
-    -8204, -7643, -7087, -6523, -5874, -5080, -4227, -3421, -2647, -1840, -1018, -218,
-    565, 1328, 2072, 2792, 3438, 3993, 4495, 4944, 5335, 5700, 6050, 6388,
-    6733, 7081, 7418, 7748, 8071, 8383, 8682, 8964, 9230, 9486, 9746, 10007,
-    10261, 10507, 10742, 10968, 11179, 11352, 11509, 11693, 11901, 12103, 12299, 12493,
-    12690, 12893, 13089, 13257, 13413, 13593, 13793, 13986, 14169, 14349, 14537, 14714,
-    14861, 14993, 15133, 15285, 15438, 15578, 15716, 15857, 16007, 16174, 16354, 16538,
-    16728, 16918, 17100, 17262, 17417, 17581, 17750, 17925, 18128, 18349, 18552, 18716,
-    18864, 19013, 19163, 19331, 19519, 19699, 19876, 20064, 20257, 20433, 20592, 20754,
-    20923, 21092, 21271, 21457, 21640, 21822, 21990, 22124, 22229, 22317, 22399, 22484,
-    22572, 22648, 22706, 22750, 22793, 22841, 22877, 22895, 22905, 22920, 22926, 22901,
-    22847, 22775, 22686, 22598, 22520, 22444, 22347, 22205, 22036, 21869, 21698, 21504,
-    21288, 21062, 20829, 20587, 20325, 20035, 19742, 19476, 19222, 18956, 18688, 18415,
-    18118, 17807, 17493, 17161, 16812, 16454, 16080, 15696, 15318, 14941, 14558, 14176,
-    13800, 13423, 13034, 12633, 12232, 11825, 11405, 10968, 10520, 10071, 9620, 9172,
-    8741, 8315, 7872, 7405, 6924, 6420, 5848, 5175, 4423, 3627, 2800, 1944,
-    1066, 174, -714, -1579, -2424, -3247, -4038, -4792, -5485, -6067, -6537, -6959,
-    -7371, -7769, -8162, -8566, -8974, -9368, -9744, -10100, -10446, -10793, -11135, -11460,
-    -11776, -12090, -12404, -12722, -13046, -13366, -13666, -13937, -14183, -14419, -14658, -14899,
-    -15145, -15391, -15627, -15842, -16046, -16245, -16439, -16638, -16846, -17045, -17223, -17382,
-    -17521, -17641, -17754, -17863, -17969, -18087, -18219, -18349, -18468, -18573, -18672, -18783,
-    -18900, -18998, -19076, -19149, -19217, -19282, -19354, -19429, -19503, -19585, -19671, -19744,
-    -19813, -19895, -19973, -20029, -20068, -20105, -20147, -20185, -20214, -20233, -20260, -20293,
-    -20322, -20343, -20362, -20385, -20411, -20416, -20393, -20363, -20325, -20261, -20178, -20091,
-    -19994, -19898, -19818, -19738, -19645, -19547, -19442, -19335, -19243, -19152, -19038, -18912,
-    -18786, -18652, -18514, -18376, -18233, -18099, -17988, -17881, -17759, -17630, -17495, -17347,
-    -17205, -17069, -16913, -16738, -16559, -16383, -16222, -16075, -15915, -15743, -15585, -15437,
-    -15272, -15081, -14875, -14663, -14449, -14224, -13985, -13733, -13458, -13171, -12900, -12648,
-    -12397, -12142, -11877, -11609, -11348, -11084, -10789, -10464, -10131, -9797, -9466, -9149,
-    -8848, -8556, -8262, -7962, -7656, -7344, -7031, -6730, -6455, -6204, -5957, -5719,
-    -5492, -5243, -4948, -4624, -4301, -3990, -3686, -3357, -2973, -2543, -2088, -1616,
-    -1134, -646, -149, 356, 872, 1401, 1931, 2442, 2926, 3407, 3896, 4353,
-    4723, 5020, 5310, 5630, 5975, 6326, 6668, 6987, 7280, 7547, 7808, 8078,
-    8357, 8647, 8938, 9206, 9460, 9728, 10017, 10304, 10578, 10851, 11127, 11394,
-    11636, 11851, 12053, 12260, 12485, 12721, 12953, 13175, 13388, 13589, 13790, 14005,
-    14235, 14468, 14697, 14916, 15112, 15287, 15456, 15630, 15801, 15966, 16128, 16287,
-    16450, 16616, 16773, 16916, 17047, 17166, 17286, 17403, 17515, 17624, 17723, 17800,
-    17868, 17950, 18045, 18140, 18228, 18311, 18394, 18467, 18501, 18505, 18516, 18544,
-    18586, 18635, 18678, 18704, 18717, 18725, 18733, 18751, 18785, 18827, 18868, 18902,
-    18914, 18894, 18862, 18832, 18799, 18761, 18717, 18664, 18611, 18574, 18534, 18464,
-    18372, 18271, 18166, 18062, 17952, 17821, 17672, 17524, 17391, 17270, 17141, 16995,
-    16853, 16732, 16621, 16496, 16338, 16158, 15995, 15860, 15732, 15608, 15487, 15345,
-    15186, 15034, 14895, 14764, 14647, 14542, 14441, 14346, 14245, 14109, 13941, 13779,
-    13634, 13500, 13367, 13221, 13060, 12898, 12733, 12550, 12354, 12154, 11944, 11714,
-    11454, 11148, 10809, 10476, 10148, 9805, 9454, 9111, 8782, 8483, 8213, 7934,
-    7645, 7373, 7132, 6912, 6697, 6478, 6258, 6042, 5812, 5576, 5350, 5128,
-    4907, 4694, 4457, 4164, 3836, 3491, 3125, 2745, 2370, 2012, 1663, 1303,
-    918, 522, 132, -245, -612, -979, -1352, -1730, -2126, -2539, -2959, -3375,
-    -3777, -4172, -4578, -4981, -5351, -5670, -5951, -6214, -6468, -6710, -6944, -7178,
-    -7406, -7629, -7860, -8099, -8336, -8572, -8799, -9015, -9228, -9427, -9606, -9778,
-    -9948, -10122, -10324, -10543, -10741, -10918, -11096, -11283, -11479, -11682, -11879, -12062,
-    -12230, -12390, -12552, -12722, -12909, -13120, -13329, -13513, -13675, -13825, -13973, -14126,
-    -14280, -14434, -14596, -14753, -14886, -15003, -15118, -15238, -15362, -15488, -15624, -15770,
-    -15912, -16049, -16182, -16304, -16422, -16536, -16641, -16742, -16849, -16956, -17068, -17189,
-    -17302, -17397, -17497, -17620, -17762, -17913, -18060, -18186, -18293, -18389, -18484, -18595,
-    -18730, -18871, -19000, -19109, -19201, -19281, -19357, -19426, -19500, -19597, -19707, -19791,
-    -19830, -19836, -19836, -19856, -19884, -19893, -19894, -19900, -19892, -19863, -19834, -19804,
-    -19769, -19736, -19691, -19619, -19541, -19464, -19377, -19287, -19214, -19146, -19077, -19020,
-    -18990, -18981, -18982, -18983, -18976, -18961, -18955, -18974, -19005, -19014, -18991, -18940,
-    -18863, -18759, -18634, -18500, -18370, -18241, -18093, -17899, -17659, -17389, -17112, -16842,
-    -16583, -16322, -16055, -15781, -15487, -15168, -14844, -14520, -14188, -13846, -13490, -13116,
-    -12734, -12336, -11919, -11501, -11093, -10686, -10281, -9878, -9475, -9085, -8699, -8298,
-    -7880, -7454, -7037, -6653, -6286, -5901, -5508, -5092, -4581, -3969, -3332, -2713,
-    -2112, -1528, -950, -347, 295, 963, 1629, 2278, 2905, 3519, 4134, 4738,
-    5285, 5754, 6171, 6573, 6974, 7372, 7759, 8136, 8516, 8907, 9306, 9705,
-    10092, 10458, 10804, 11133, 11447, 11751, 12046, 12329, 12610, 12902, 13191, 13449,
-    13687, 13932, 14174, 14399, 14620, 14836, 15039, 15228, 15390, 15524, 15666, 15837,
-    16026, 16222, 16412, 16580, 16735, 16877, 16994, 17101, 17211, 17318, 17425, 17538,
-    17649, 17750, 17844, 17923, 18000, 18087, 18177, 18264, 18356, 18447, 18521, 18570,
-    18607, 18647, 18689, 18724, 18751, 18774, 18796, 18814, 18831, 18847, 18872, 18901,
-    18933, 18953, 18955, 18949, 18936, 18918, 18910, 18924, 18963, 19021, 19086, 19144,
-    19189, 19225, 19247, 19260, 19280, 19298, 19314, 19335, 19352, 19363, 19370, 19359,
-    19332, 19301, 19277, 19252, 19214, 19155, 19063, 18937, 18795, 18652, 18513, 18386,
-    18259, 18121, 17992, 17898, 17836, 17780, 17724, 17669, 17610, 17558, 17507, 17441,
-    17375, 17325, 17286, 17258, 17240, 17223, 17204, 17183, 17156, 17110, 17044, 16975,
-    16901, 16814, 16725, 16637, 16547, 16446, 16331, 16209, 16073, 15936, 15809, 15678,
-    15541, 15400, 15240, 15052, 14835, 14600, 14366, 14120, 13854, 13564, 13254, 12962,
-    12700, 12431, 12148, 11857, 11548, 11232, 10912, 10576, 10240, 9922, 9612, 9306,
-    9006, 8703, 8397, 8099, 7814, 7538, 7258, 6957, 6635, 6305, 5972, 5633,
-    5301, 4960, 4531, 4001, 3443, 2896, 2356, 1824, 1288, 743, 199, -358,
-    -928, -1507, -2101, -2700, -3309, -3926, -4549, -5131, -5594, -5968, -6342, -6718,
-    -7090, -7474, -7869, -8254, -8614, -8941, -9249, -9553, -9864, -10180, -10483, -10770,
-    -11038, -11284, -11530, -11785, -12046, -12309, -12565, -12811, -13045, -13269, -13494, -13717,
-    -13946, -14172, -14388, -14591, -14771, -14936, -15103, -15263, -15425, -15606, -15798, -15997,
-    -16204, -16407, -16591, -16762, -16918, -17056, -17185, -17304, -17418, -17537, -17674, -17802,
-    -17892, -17953, -18000, -18057, -18136, -18208, -18265, -18307, -18338, -18351, -18353, -18362,
-    -18386, -18422, -18473, -18541, -18625, -18711, -18805, -18918, -19041, -19162, -19287, -19410,
-    -19515, -19603, -19682, -19744, -19810, -19881, -19949, -20025, -20102, -20161, -20194, -20211,
-    -20216, -20190, -20153, -20114, -20073, -20046, -20037, -20015, -19957, -19879, -19794, -19707,
-    -19630, -19555, -19482, -19397, -19283, -19153, -19010, -18865, -18732, -18601, -18475, -18346,
-    -18213, -18086, -17961, -17835, -17709, -17589, -17471, -17354, -17242, -17125, -17002, -16873,
-    -16746, -16630, -16536, -16474, -16417, -16342, -16257, -16172, -16094, -16003, -15894, -15778,
-    -15668, -15566, -15456, -15325, -15163, -14976, -14792, -14607, -14417, -14232, -14039, -13827,
-    -13594, -13345, -13079, -12794, -12509, -12236, -11974, -11707, -11427, -11149, -10869, -10590,
-    -10311, -10032, -9760, -9488, -9214, -8935, -8649, -8360, -8069, -7783, -7518, -7292,
-    -7082, -6857, -6622, -6376, -6128, -5883, -5625, -5363, -5108, -4866, -4595, -4217,
-    -3767, -3310, -2853, -2400, -1950, -1495, -1039, -578, -92, 409, 919, 1441,
-    1971, 2509, 3045, 3577, 4113, 4639, 5168, 5659, 6051, 6394, 6736, 7074,
-    7410, 7744, 8088, 8429, 8756, 9074, 9376, 9663, 9944, 10223, 10500, 10779,
-    11062, 11342, 11622, 11900, 12172, 12440, 12708, 12976, 13238, 13494, 13749, 13998,
-    14253, 14500, 14727, 14935, 15134, 15331, 15509, 15669, 15832, 15994, 16159, 16313,
-    16453, 16584, 16693, 16792, 16899, 17009, 17118, 17226, 17340, 17463, 17597, 17735,
-    17865, 17978, 18081, 18176, 18255, 18321, 18377, 18424, 18471, 18516, 18556, 18597,
-    18639, 18684, 18719, 18736, 18746, 18742, 18738, 18740, 18733, 18715, 18688, 18658,
-    18627, 18594, 18565, 18529, 18490, 18456, 18425, 18391, 18351, 18299, 18233, 18154,
-    18066, 17963, 17855, 17748, 17643, 17532, 17417, 17305, 17190, 17069, 16935, 16790,
-    16634, 16460, 16276, 16086, 15900, 15737, 15583, 15429, 15279, 15126, 14978, 14826,
-    14665, 14499, 14342, 14201, 14069, 13928, 13780, 13631, 13485, 13356, 13247, 13145,
-    13051, 12966, 12889, 12820, 12755, 12695, 12638, 12569, 12487, 12397, 12301, 12207,
-    12110, 12006, 11903, 11813, 11731, 11639, 11532, 11421, 11306, 11174, 11024, 10866,
-    10706, 10558, 10423, 10285, 10138, 9983, 9822, 9654, 9480, 9311, 9148, 8992,
-    8847, 8704, 8555, 8395, 8230, 8076, 7936, 7800, 7658, 7519, 7398, 7293,
-    7195, 7099, 7002, 6900, 6778, 6636, 6486, 6337, 6182, 6020, 5853, 5677,
-    5483, 5264, 5010, 4717, 4392, 4048, 3687, 3307, 2912, 2516, 2125, 1738,
-    1338, 917, 482, 34, -425, -896, -1380, -1875, -2374, -2876, -3386, -3896,
-    -4410, -4933, -5446, -5898, -6273, -6607, -6918, -7199, -7450, -7679, -7891, -8090,
-    -8293, -8505, -8720, -8929, -9127, -9315, -9508, -9704, -9892, -10064, -10234, -10408,
-    -10587, -10773, -10971, -11175, -11380, -11574, -11752, -11916, -12082, -12264, -12465, -12674,
-    -12876, -13064, -13239, -13407, -13573, -13738, -13898, -14045, -14185, -14323, -14460, -14589,
-    -14709, -14820, -14917, -14988, -15034, -15067, -15098, -15133, -15172, -15218, -15273, -15336,
-    -15396, -15450, -15500, -15551, -15600, -15640, -15676, -15715, -15751, -15784, -15822, -15864,
-    -15904, -15943, -15979, -16005, -16030, -16071, -16126, -16183, -16230, -16267, -16299, -16328,
-    -16358, -16384, -16398, -16401, -16402, -16404, -16408, -16412, -16412, -16404, -16388, -16352,
-    -16292, -16215, -16130, -16042, -15959, -15888, -15832, -15790, -15754, -15722, -15693, -15663,
-    -15632, -15597, -15556, -15516, -15481, -15447, -15415, -15385, -15351, -15312, -15265, -15208,
-    -15147, -15093, -15044, -14991, -14929, -14859, -14780, -14689, -14575, -14441, -14294, -14138,
-    -13981, -13830, -13682, -13533, -13372, -13192, -12999, -12790, -12559, -12306, -12040, -11773,
-    -11512, -11260, -11022, -10794, -10565, -10335, -10113, -9901, -9699, -9508, -9317, -9122,
-    -8931, -8741, -8546, -8357, -8182, -8020, -7874, -7740, -7608, -7481, -7369, -7272,
-    -7187, -7109, -7024, -6921, -6803, -6678, -6545, -6399, -6228, -6010, -5744, -5467,
-    -5195, -4905, -4585, -4248, -3889, -3507, -3120, -2737, -2362, -2001, -1652, -1318,
-    -996, -678, -366, -69, 219, 503, 781, 1053, 1321, 1579, 1830, 2081,
-    2331, 2567, 2781, 2981, 3179, 3375, 3565, 3740, 3901, 4062, 4230, 4391,
-    4536, 4668, 4787, 4901, 5021, 5140, 5247, 5336, 5415, 5501, 5608, 5731,
-    5858, 5995, 6150, 6324, 6499, 6660, 6807, 6948, 7088, 7230, 7376, 7523,
-    7668, 7805, 7937, 8071, 8209, 8342, 8475, 8614, 8760, 8911, 9059, 9194,
-    9322, 9458, 9604, 9747, 9877, 9990, 10098, 10213, 10345, 10491, 10644, 10796,
-    10948, 11099, 11245, 11379, 11503, 11622, 11753, 11909, 12075, 12245, 12423, 12613,
-    12799, 12972, 13129, 13279, 13423, 13562, 13696, 13827, 13953, 14067, 14166, 14260,
-    14356, 14447, 14534, 14627, 14723, 14816, 14907, 14994, 15072, 15145, 15226, 15306,
-    15372, 15425, 15475, 15529, 15591, 15663, 15746, 15831, 15914, 16007, 16113, 16220,
-    16316, 16404, 16496, 16601, 16716, 16833, 16949, 17069, 17192, 17311, 17425, 17535,
-    17639, 17726, 17797, 17859, 17907, 17935, 17943, 17938, 17924, 17903, 17880, 17853,
-    17814, 17757, 17684, 17592, 17488, 17385, 17293, 17205, 17114, 17018, 16912, 16793,
-    16677, 16579, 16498, 16426, 16361, 16300, 16240, 16182, 16122, 16057, 15989, 15921,
-    15864, 15817, 15773, 15736, 15703, 15666, 15620, 15566, 15499, 15418, 15321, 15206,
-    15081, 14951, 14809, 14650, 14480, 14299, 14113, 13922, 13723, 13513, 13289, 13053,
-    12809, 12553, 12285, 12020, 11752, 11458, 11138, 10805, 10464, 10131, 9807, 9478,
-    9144, 8805, 8457, 8114, 7770, 7409, 7044, 6675, 6293, 5927, 5561, 5103,
-    4549, 3984, 3425, 2851, 2269, 1677, 1063, 439, -189, -815, -1439, -2070,
-    -2697, -3323, -3947, -4501, -4937, -5333, -5741, -6126, -6496, -6884, -7262, -7617,
-    -7982, -8360, -8747, -9148, -9548, -9927, -10286, -10632, -10969, -11304, -11632, -11953,
-    -12274, -12598, -12925, -13246, -13556, -13852, -14132, -14392, -14640, -14876, -15098, -15317,
-    -15534, -15748, -15971, -16202, -16430, -16656, -16872, -17065, -17240, -17403, -17556, -17706,
-    -17857, -18004, -18146, -18278, -18394, -18500, -18605, -18703, -18793, -18876, -18963, -19062,
-    -19160, -19244, -19312, -19364, -19408, -19452, -19483, -19492, -19493, -19495, -19496, -19492,
-    -19484, -19469, -19449, -19424, -19386, -19333, -19272, -19208, -19148, -19093, -19040, -18995,
-    -18961, -18936, -18912, -18884, -18857, -18834, -18812, -18796, -18792, -18779, -18744, -18692,
-    -18621, -18538, -18452, -18362, -18263, -18160, -18060, -17964, -17876, -17784, -17679, -17557,
-    -17422, -17280, -17133, -16967, -16785, -16601, -16418, -16230, -16039, -15846, -15651, -15448,
-    -15232, -15007, -14774, -14529, -14280, -14041, -13808, -13582, -13368, -13155, -12932, -12706,
-    -12479, -12259, -12059, -11871, -11683, -11496, -11306, -11104, -10885, -10650, -10405, -10172,
-    -9959, -9756, -9559, -9368, -9185, -9016, -8860, -8703, -8534, -8353, -8163, -7963,
-    -7752, -7531, -7311, -7100, -6905, -6721, -6540, -6352, -6150, -5905, -5602, -5274,
-    -4953, -4634, -4316, -4009, -3712, -3418, -3132, -2846, -2555, -2271, -2011, -1773,
-    -1551, -1338, -1121, -892, -656, -418, -173, 67, 292, 501, 706, 907,
-    1094, 1260, 1404, 1530, 1652, 1788, 1933, 2077, 2222, 2364, 2499, 2622,
-    2722, 2801, 2874, 2952, 3040, 3142, 3254, 3368, 3487, 3612, 3734, 3847,
-    3958, 4069, 4182, 4294, 4402, 4511, 4614, 4701, 4784, 4869, 4951, 5039,
-    5149, 5273, 5396, 5509, 5617, 5725, 5832, 5938, 6044, 6147, 6238, 6319,
-    6399, 6481, 6577, 6700, 6845, 6994, 7135, 7257, 7357, 7439, 7512, 7590,
-    7681, 7779, 7877, 7978, 8084, 8192, 8296, 8390, 8482, 8577, 8682, 8802,
-    8934, 9061, 9181, 9305, 9438, 9568, 9698, 9840, 10001, 10184, 10383, 10588,
-    10789, 10992, 11205, 11430, 11655, 11871, 12073, 12261, 12448, 12649, 12873, 13118,
-    13384, 13667, 13951, 14220, 14468, 14702, 14925, 15142, 15363, 15588, 15810, 16032,
-    16264, 16510, 16751, 16969, 17164, 17351, 17536, 17716, 17884, 18036, 18172, 18296,
-    18406, 18496, 18570, 18639, 18709, 18782, 18856, 18929, 18998, 19063, 19125, 19176,
-    19211, 19222, 19205, 19157, 19085, 19004, 18936, 18884, 18839, 18793, 18742, 18684,
-    18615, 18533, 18438, 18332, 18226, 18129, 18041, 17949, 17851, 17749, 17649, 17545,
-    17423, 17281, 17131, 16972, 16794, 16600, 16406, 16213, 16010, 15793, 15566, 15325,
-    15073, 14814, 14552, 14291, 14035, 13775, 13508, 13240, 12963, 12657, 12326, 11986,
-    11630, 11257, 10899, 10572, 10254, 9935, 9625, 9319, 9009, 8697, 8380, 8053,
-    7725, 7405, 7096, 6797, 6505, 6218, 5947, 5683, 5373, 4990, 4576, 4165,
-    3746, 3321, 2916, 2521, 2119, 1721, 1337, 947, 548, 155, -240, -631,
-    -997, -1339, -1684, -2032, -2373, -2715, -3063, -3413, -3774, -4140, -4483, -4784,
-    -5050, -5294, -5522, -5742, -5961, -6183, -6412, -6644, -6880, -7121, -7358, -7575,
-    -7777, -7972, -8156, -8329, -8490, -8646, -8809, -8989, -9176, -9362, -9545, -9719,
-    -9871, -10001, -10126, -10251, -10380, -10514, -10640, -10755, -10864, -10957, -11031, -11103,
-    -11176, -11246, -11320, -11405, -11503, -11613, -11716, -11805, -11885, -11949, -12006, -12068,
-    -12120, -12172, -12241, -12300, -12351, -12415, -12478, -12527, -12588, -12642, -12673, -12692,
-    -12702, -12706, -12736, -12795, -12862, -12936, -13021, -13108, -13177, -13223, -13296, -13453,
-    -13712, -14079, -14538, -15060, -15652, -16296, -16929, -17562, -18191, -18694, -19017, -19251,
-    -19434, -19523, -19518, -19431, -19257, -19008, -18699, -18352, -18005, -17676, -17363, -17065,
-    -16760, -16447, -16151, -15863, -15574, -15301, -15027, -14720, -14399, -14088, -13787, -13508,
-    -13249, -12989, -12732, -12504, -12290, -12031, -11723, -11417, -11131, -10864, -10630, -10422,
-    -10226, -10056, -9887, -9669, -9420, -9170, -8916, -8674, -8459, -8246, -8037, -7846,
-    -7659, -7462, -7251, -7015, -6762, -6503, -6233, -5958, -5691, -5419, -5140, -4870,
-    -4604, -4331, -4058, -3767, -3442, -3116, -2813, -2516, -2230, -1961, -1685, -1415,
-    -1180, -939, -645, -337, -39, 249, 508, 746, 988, 1211, 1411, 1625,
-    1854, 2081, 2301, 2498, 2679, 2879, 3093, 3299, 3519, 3777, 4065, 4388,
-    4736, 5086, 5430, 5760, 6074, 6386, 6701, 7013, 7320, 7623, 7928, 8253,
-    8598, 8948, 9302, 9652, 9982, 10292, 10588, 10872, 11135, 11382, 11655, 11976,
-    12308, 12604, 12851, 13040, 13178, 13288, 13361, 13414, 13506, 13638, 13766, 13885,
-    13985, 14046, 14084, 14118, 14137, 14146, 14146, 14131, 14127, 14150, 14185, 14222,
-    14255, 14273, 14284, 14299, 14310, 14312, 14310, 14295, 14266, 14228, 14197, 14178,
-    14149, 14109, 14059, 13825, 13014, 11341, 8924, 6163, 3445, 1038, -897, -2301,
-    -3195, -3649, -3765, -3655, -3385, -3003, -2609, -2303, -2099, -1979, -1939, -1957,
-    -2016, -2116, -2233, -2336, -2416, -2471, -2493, -2497, -2497, -2475, -2408, -2309,
-    -2220, -2163, -2118, -2078, -2053, -2021, -1970, -1923, -1891, -1857, -1835, -1827,
-    -1813, -1815, -1865, -1921, -1940, -1938, -1934, -1925, -1923, -1933, -1951, -1982,
-    -2014, -2002, -1950, -1907, -1883, -1862, -1850, -1855, -1877, -1927, -1997, -2051,
-    -2066, -2042, -1982, -1903, -1824, -1745, -1666, -1592, -1528, -1481, -1444, -1403,
-    -1358, -1315, -1257, -1174, -1079, -983, -893, -823, -772, -734, -735, -777,
-    -811, -819, -838, -894, -991, -1124, -1266, -1409, -1576, -1751, -1883, -1976,
-    -2060, -2138, -2219, -2327, -2453, -2582, -2717, -2846, -2953, -3038, -3094, -3110,
-    -3107, -3106, -3090, -3046, -2992, -2939, -2885, -2824, -2753, -2675, -2591, -2495,
-    -2388, -2277, -2163, -2039, -1908, -1771, -1644, -1545, -1440, -1281, -1085, -896,
-    -729, -593, -482, -367, -259, -179, -88, 57, 221, 377, 544, 710,
-    855, 1003, 1164, 1315, 1464, 1630, 1806, 1999, 2223, 2455, 2675, 2905,
-    3145, 3378, 3617, 3825, 3799, 3253, 2036, 258, -1818, -3932, -5870, -7474,
-    -8668, -9450, -9844, -9913, -9737, -9353, -8791, -8139, -7482, -6863, -6303, -5803,
-    -5364, -5005, -4715, -4427, -4115, -3818, -3551, -3292, -3047, -2821, -2596, -2371,
-    -2148, -1913, -1659, -1384, -1088, -789, -502, -222, 46, 290, 519, 743,
-    954, 1162, 1373, 1572, 1774, 2009, 2268, 2513, 2740, 2960, 3164, 3339,
-    3482, 3617, 3778, 3980, 4195, 4390, 4561, 4724, 4882, 5011, 5108, 5210,
-    5354, 5528, 5704, 5872, 6027, 6162, 6285, 6392, 6481, 6562, 6654, 6772,
-    6925, 7100, 7270, 7424, 7556, 7670, 7778, 7884, 7986, 8078, 8157, 8223,
-    8288, 8365, 8454, 8548, 8634, 8697, 8734, 8748, 8729, 8673, 8614, 8590,
-    8596, 8605, 8600, 8575, 8530, 8470, 8384, 8277, 8192, 8154, 8144, 8136,
-    8115, 8080, 8035, 7972, 7896, 7823, 7767, 7740, 7749, 7784, 7827, 7864,
-    7879, 7877, 7876, 7879, 7881, 7880, 7879, 7879, 7883, 7902, 7945, 8002,
-    8048, 8080, 8098, 8105, 8098, 8062, 7987, 7916, 7882, 7863, 7837, 7802,
-    7752, 7684, 7603, 7494, 7367, 7275, 7228, 7187, 7134, 7078, 7001, 6891,
-    6762, 6623, 6490, 6385, 6256, 5913, 5129, 3811, 2023, -80, -2291, -4410,
-    -6312, -7933, -9230, -10184, -10817, -11169, -11280, -11202, -11001, -10722, -10407, -10100,
-    -9819, -9570, -9397, -9300, -9205, -9099, -9026, -8985, -8977, -9012, -9063, -9120,
-    -9204, -9285, -9312, -9301, -9289, -9287, -9302, -9330, -9368, -9422, -9484, -9536,
-    -9565, -9569, -9548, -9514, -9486, -9473, -9468, -9467, -9467, -9470, -9473, -9458,
-    -9428, -9390, -9339, -9265, -9179, -9094, -9014, -8941, -8882, -8829, -8789, -8777,
-    -8748, -8666, -8548, -8428, -8322, -8237, -8168, -8107, -8060, -8033, -7986, -7889,
-    -7769, -7650, -7539, -7440, -7354, -7287, -7228, -7165, -7096, -7006, -6885, -6746,
-    -6609, -6489, -6381, -6279, -6184, -6095, -6014, -5925, -5816, -5710, -5617, -5514,
-    -5390, -5258, -5135, -5022, -4919, -4831, -4749, -4679, -4627, -4546, -4420, -4281,
-    -4147, -4022, -3911, -3814, -3731, -3653, -3573, -3454, -3283, -3096, -2902, -2698,
-    -2504, -2325, -2162, -2004, -1837, -1660, -1456, -1227, -985, -733, -492, -270,
-    -53, 168, 400, 638, 887, 1153, 1409, 1654, 1914, 2183, 2452, 2715,
-    2966, 3203, 3427, 3637, 3814, 3968, 4154, 4383, 4624, 4859, 5074, 5269,
-    5448, 5593, 5702, 5815, 5969, 6084, 5977, 5496, 4588, 3296, 1736, 39,
-    -1668, -3256, -4630, -5731, -6543, -7090, -7405, -7524, -7464, -7245, -6897, -6451,
-    -5938, -5387, -4833, -4313, -3823, -3339, -2875, -2453, -2073, -1734, -1428, -1148,
-    -904, -710, -531, -323, -94, 131, 344, 538, 715, 878, 1008, 1102,
-    1212, 1373, 1564, 1759, 1956, 2137, 2285, 2403, 2498, 2584, 2683, 2811,
-    2969, 3151, 3335, 3500, 3642, 3779, 3923, 4082, 4260, 4449, 4646, 4843,
-    5036, 5231, 5437, 5649, 5859, 6067, 6265, 6454, 6634, 6778, 6884, 7005,
-    7174, 7368, 7556, 7723, 7859, 7969, 8062, 8120, 8158, 8229, 8349, 8483,
-    8606, 8706, 8764, 8777, 8763, 8724, 8672, 8630, 8613, 8612, 8616, 8608,
-    8584, 8555, 8524, 8488, 8457, 8439, 8426, 8411, 8387, 8354, 8328, 8321,
-    8328, 8339, 8345, 8346, 8349, 8336, 8286, 8225, 8208, 8242, 8293, 8347,
-    8392, 8413, 8412, 8383, 8324, 8268, 8264, 8297, 8332, 8357, 8361, 8331,
-    8270, 8192, 8104, 8022, 7969, 7947, 7945, 7943, 7920, 7876, 7823, 7767,
-    7713, 7672, 7643, 7614, 7573, 7512, 7446, 7397, 7367, 7340, 7306, 7263,
-    7212, 7151, 7057, 6930, 6820, 6732, 6571, 6199, 5513, 4471, 3107, 1511,
-    -242, -2054, -3780, -5325, -6684, -7854, -8823, -9601, -10206, -10645, -10942, -11116,
-    -11164, -11093, -10929, -10702, -10455, -10221, -10000, -9793, -9609, -9447, -9300, -9173,
-    -9077, -9013, -8984, -8969, -8944, -8916, -8904, -8907, -8920, -8936, -8959, -9011,
-    -9085, -9128, -9113, -9069, -9031, -9012, -9017, -9029, -9044, -9087, -9142, -9152,
-    -9123, -9101, -9093, -9091, -9113, -9157, -9208, -9269, -9324, -9342, -9317, -9270,
-    -9207, -9143, -9087, -9024, -8950, -8867, -8768, -8651, -8535, -8423, -8315, -8208,
-    -8080, -7915, -7741, -7578, -7420, -7264, -7121, -6999, -6909, -6829, -6710, -6546,
-    -6380, -6236, -6117, -6021, -5932, -5854, -5809, -5769, -5693, -5602, -5539, -5492,
-    -5451, -5432, -5434, -5453, -5484, -5491, -5452, -5378, -5283, -5175, -5072, -4974,
-    -4868, -4752, -4627, -4486, -4331, -4167, -3996, -3830, -3663, -3474, -3269, -3064,
-    -2854, -2637, -2426, -2221, -2028, -1855, -1670, -1438, -1181, -925, -676, -443,
-    -228, -22, 162, 320, 498, 721, 948, 1158, 1363, 1554, 1715, 1852,
-    1975, 2098, 2251, 2445, 2661, 2883, 3105, 3314, 3512, 3714, 3923, 4138,
-    4362, 4599, 4840, 5076, 5310, 5554, 5782, 5907, 5831, 5483, 4846, 3957,
-    2873, 1641, 330, -949, -2118, -3164, -4077, -4844, -5460, -5916, -6217, -6398,
-    -6464, -6375, -6151, -5859, -5525, -5153, -4767, -4386, -4010, -3653, -3301, -2925,
-    -2531, -2150, -1789, -1451, -1144, -866, -614, -384, -159, 73, 310, 538,
-    750, 945, 1147, 1363, 1577, 1776, 1967, 2155, 2346, 2519, 2656, 2786,
-    2960, 3171, 3381, 3585, 3775, 3945, 4104, 4242, 4341, 4446, 4604, 4779,
-    4928, 5062, 5191, 5304, 5407, 5495, 5571, 5670, 5817, 5991, 6166, 6339,
-    6502, 6654, 6797, 6934, 7072, 7226, 7398, 7572, 7735, 7879, 8011, 8151,
-    8294, 8423, 8530, 8619, 8707, 8795, 8850, 8867, 8887, 8942, 9005, 9057,
-    9092, 9101, 9093, 9071, 9014, 8926, 8861, 8833, 8797, 8735, 8668, 8597,
-    8514, 8414, 8298, 8191, 8127, 8106, 8099, 8095, 8096, 8098, 8092, 8079,
-    8072, 8084, 8118, 8166, 8217, 8261, 8301, 8343, 8386, 8427, 8467, 8497,
-    8511, 8522, 8530, 8511, 8476, 8457, 8453, 8449, 8446, 8430, 8390, 8334,
-    8262, 8162, 8056, 7975, 7894, 7786, 7666, 7553, 7439, 7319, 7185, 7041,
-    6922, 6850, 6800, 6745, 6688, 6638, 6576, 6465, 6246, 5862, 5275, 4471,
-    3463, 2279, 961, -428, -1826, -3188, -4476, -5664, -6742, -7696, -8504, -9172,
-    -9718, -10133, -10410, -10577, -10660, -10667, -10621, -10538, -10425, -10307, -10193, -10060,
-    -9909, -9781, -9683, -9592, -9506, -9435, -9389, -9377, -9381, -9354, -9293, -9235,
-    -9199, -9176, -9166, -9169, -9180, -9189, -9191, -9183, -9166, -9146, -9133, -9132,
-    -9127, -9115, -9103, -9085, -9065, -9055, -9051, -9036, -9021, -9012, -8987, -8948,
-    -8913, -8877, -8835, -8796, -8756, -8717, -8697, -8679, -8631, -8572, -8527, -8478,
-    -8414, -8347, -8280, -8217, -8162, -8084, -7953, -7794, -7646, -7510, -7376, -7241,
-    -7105, -6970, -6842, -6712, -6573, -6424, -6272, -6133, -6013, -5896, -5774, -5657,
-    -5553, -5460, -5375, -5283, -5182, -5089, -5010, -4925, -4839, -4761, -4685, -4610,
-    -4537, -4464, -4404, -4361, -4298, -4206, -4119, -4044, -3951, -3837, -3715, -3586,
-    -3462, -3336, -3163, -2936, -2701, -2474, -2241, -2003, -1767, -1532, -1303, -1078,
-    -840, -590, -335, -78, 169, 401, 632, 863, 1087, 1299, 1504, 1706,
-    1919, 2138, 2345, 2546, 2746, 2937, 3123, 3308, 3486, 3662, 3838, 3993,
-    4136, 4302, 4476, 4623, 4766, 4932, 5106, 5276, 5402, 5409, 5271, 4999,
-    4565, 3947, 3190, 2332, 1397, 431, -530, -1476, -2367, -3156, -3837, -4406,
-    -4858, -5210, -5470, -5628, -5686, -5662, -5565, -5397, -5160, -4865, -4537, -4193,
-    -3831, -3458, -3083, -2705, -2329, -1966, -1621, -1303, -1019, -751, -475, -227,
-    -20, 174, 378, 583, 779, 956, 1113, 1286, 1502, 1717, 1913, 2101,
-    2284, 2458, 2622, 2781, 2931, 3086, 3266, 3452, 3641, 3836, 4014, 4176,
-    4338, 4510, 4674, 4835, 5004, 5172, 5348, 5520, 5675, 5827, 5974, 6118,
-    6265, 6408, 6540, 6663, 6773, 6860, 6969, 7097, 7196, 7280, 7372, 7476,
-    7584, 7686, 7764, 7819, 7910, 8031, 8136, 8225, 8298, 8364, 8421, 8467,
-    8509, 8533, 8569, 8624, 8680, 8739, 8780, 8802, 8813, 8822, 8834, 8841,
-    8846, 8845, 8846, 8844, 8827, 8814, 8807, 8797, 8785, 8778, 8765, 8738,
-    8713, 8659, 8594, 8576, 8554, 8507, 8468, 8442, 8426, 8414, 8397, 8346,
-    8304, 8325, 8349, 8348, 8338, 8315, 8287, 8259, 8231, 8200, 8161, 8134,
-    8122, 8103, 8064, 8008, 7940, 7874, 7813, 7747, 7677, 7587, 7498, 7426,
-    7345, 7262, 7185, 7107, 7023, 6939, 6863, 6769, 6649, 6475, 6173, 5758,
-    5227, 4526, 3674, 2709, 1657, 538, -616, -1792, -2971, -4080, -5086, -6033,
-    -6923, -7735, -8462, -9097, -9630, -10066, -10418, -10685, -10861, -10956, -11003, -11017,
-    -10996, -10931, -10826, -10710, -10588, -10468, -10360, -10244, -10122, -10013, -9914, -9819,
-    -9721, -9640, -9576, -9522, -9493, -9474, -9474, -9491, -9489, -9483, -9497, -9531,
-    -9569, -9595, -9619, -9639, -9670, -9699, -9673, -9616, -9578, -9561, -9543, -9514,
-    -9478, -9431, -9389, -9352, -9298, -9220, -9138, -9062, -8991, -8913, -8813, -8705,
-    -8607, -8515, -8427, -8338, -8234, -8125, -8019, -7916, -7804, -7682, -7571, -7463,
-    -7366, -7284, -7206, -7148, -7075, -6972, -6876, -6805, -6745, -6663, -6564, -6462,
-    -6363, -6290, -6201, -6068, -5942, -5848, -5759, -5656, -5543, -5425, -5299, -5181,
-    -5059, -4914, -4757, -4608, -4470, -4334, -4188, -4026, -3862, -3698, -3534, -3378,
-    -3213, -3040, -2872, -2703, -2531, -2347, -2161, -1980, -1796, -1624, -1448, -1278,
-    -1118, -920, -703, -514, -350, -180, 22, 238, 463, 676, 872, 1104,
-    1359, 1583, 1778, 1972, 2172, 2366, 2563, 2754, 2934, 3124, 3334, 3550,
-    3756, 3951, 4139, 4324, 4513, 4696, 4877, 5053, 5221, 5383, 5495, 5517,
-    5432, 5223, 4889, 4426, 3853, 3187, 2451, 1675, 863, 52, -701, -1424,
-    -2133, -2794, -3370, -3853, -4250, -4569, -4833, -5021, -5091, -5092, -5058, -4974,
-    -4830, -4636, -4396, -4111, -3809, -3497, -3157, -2800, -2440, -2090, -1754, -1424,
-    -1098, -775, -468, -180, 91, 358, 631, 886, 1119, 1344, 1551, 1747,
-    1925, 2094, 2261, 2427, 2594, 2736, 2896, 3081, 3233, 3357, 3481, 3627,
-    3792, 3961, 4120, 4249, 4399, 4583, 4744, 4886, 5032, 5187, 5351, 5527,
-    5710, 5878, 6050, 6238, 6421, 6594, 6743, 6876, 7001, 7123, 7245, 7355,
-    7461, 7556, 7650, 7741, 7801, 7856, 7910, 7959, 8008, 8049, 8099, 8149,
-    8205, 8251, 8281, 8353, 8433, 8471, 8493, 8514, 8545, 8575, 8601, 8610,
-    8609, 8656, 8715, 8734, 8735, 8728, 8717, 8711, 8714, 8708, 8688, 8688,
-    8699, 8709, 8717, 8713, 8708, 8705, 8705, 8697, 8685, 8674, 8660, 8655,
-    8636, 8599, 8577, 8560, 8548, 8536, 8527, 8525, 8516, 8505, 8465, 8425,
-    8429, 8405, 8341, 8262, 8175, 8089, 7991, 7893, 7777, 7677, 7634, 7574,
-    7484, 7394, 7303, 7223, 7151, 7081, 6994, 6904, 6832, 6748, 6639, 6481,
-    6239, 5906, 5474, 4931, 4270, 3508, 2652, 1723, 746, -279, -1313, -2321,
-    -3300, -4234, -5128, -5965, -6747, -7467, -8116, -8718, -9214, -9613, -9988, -10317,
-    -10592, -10809, -10971, -11088, -11158, -11211, -11195, -11119, -11063, -11002, -10932, -10852,
-    -10751, -10641, -10531, -10443, -10356, -10259, -10172, -10078, -9991, -9917, -9836, -9752,
-    -9683, -9635, -9606, -9599, -9596, -9594, -9603, -9592, -9570, -9533, -9490, -9453,
-    -9410, -9378, -9341, -9313, -9293, -9217, -9151, -9123, -9103, -9088, -9057, -9023,
-    -8976, -8929, -8887, -8780, -8666, -8588, -8507, -8433, -8349, -8253, -8155, -8064,
-    -7987, -7887, -7776, -7662, -7536, -7423, -7317, -7200, -7075, -6962, -6860, -6770,
-    -6693, -6609, -6529, -6443, -6338, -6220, -6082, -5942, -5801, -5659, -5522, -5378,
-    -5254, -5110, -4929, -4790, -4680, -4583, -4490, -4383, -4270, -4144, -4035, -3901,
-    -3705, -3528, -3369, -3208, -3052, -2880, -2705, -2528, -2365, -2204, -2014, -1817,
-    -1608, -1395, -1192, -980, -758, -537, -322, -121, 70, 264, 460, 650,
-    857, 1077, 1300, 1527, 1747, 1962, 2167, 2378, 2581, 2764, 2993, 3229,
-    3414, 3584, 3746, 3914, 4089, 4273, 4453, 4612, 4821, 5054, 5229, 5361,
-    5430, 5427, 5345, 5161, 4884, 4504, 4059, 3567, 3018, 2429, 1799, 1150,
-    510, -121, -735, -1328, -1898, -2429, -2894, -3306, -3659, -3928, -4134, -4285,
-    -4382, -4428, -4427, -4380, -4275, -4158, -4008, -3777, -3545, -3326, -3092, -2844,
-    -2574, -2291, -1989, -1704, -1415, -1062, -719, -420, -142, 119, 379, 631,
-    880, 1113, 1330, 1557, 1784, 2005, 2216, 2417, 2629, 2840, 3040, 3232,
-    3416, 3586, 3765, 3959, 4139, 4325, 4526, 4718, 4902, 5079, 5256, 5425,
-    5602, 5781, 5921, 6089, 6284, 6426, 6537, 6635, 6733, 6829, 6934, 7042,
-    7118, 7227, 7381, 7495, 7574, 7641, 7704, 7769, 7828, 7885, 7926, 7964,
-    8015, 8067, 8115, 8154, 8195, 8248, 8297, 8331, 8363, 8385, 8395, 8423,
-    8453, 8467, 8500, 8545, 8579, 8605, 8628, 8650, 8667, 8701, 8724, 8725,
-    8778, 8835, 8838, 8824, 8805, 8789, 8778, 8783, 8774, 8741, 8760, 8795,
-    8780, 8746, 8710, 8680, 8653, 8619, 8572, 8510, 8455, 8413, 8373, 8333,
-    8284, 8247, 8223, 8183, 8132, 8085, 8030, 7969, 7928, 7874, 7806, 7764,
-    7727, 7673, 7612, 7553, 7492, 7432, 7389, 7314, 7239, 7217, 7156, 7031,
-    6866, 6651, 6379, 6041, 5638, 5123, 4531, 3929, 3246, 2467, 1638, 768,
-    -117, -1014, -1916, -2822, -3714, -4564, -5375, -6137, -6852, -7526, -8128, -8669,
-    -9172, -9619, -9999, -10338, -10620, -10836, -11032, -11188, -11279, -11340, -11381, -11395,
-    -11375, -11335, -11264, -11167, -11096, -10985, -10833, -10728, -10653, -10582, -10512, -10435,
-    -10342, -10251, -10198, -10114, -9986, -9899, -9837, -9785, -9748, -9712, -9688, -9677,
-    -9677, -9669, -9650, -9627, -9597, -9575, -9555, -9514, -9475, -9445, -9400, -9343,
-    -9294, -9232, -9167, -9128, -9075, -9003, -8940, -8878, -8807, -8721, -8628, -8513,
-    -8406, -8318, -8175, -8028, -7936, -7857, -7781, -7702, -7610, -7500, -7408, -7331,
-    -7192, -7034, -6912, -6790, -6677, -6570, -6458, -6350, -6246, -6136, -6005, -5866,
-    -5724, -5578, -5446, -5308, -5160, -5016, -4874, -4719, -4561, -4409, -4247, -4098,
-    -3964, -3806, -3644, -3486, -3326, -3154, -2970, -2778, -2573, -2398, -2220, -1987,
-    -1780, -1615, -1452, -1296, -1133, -956, -772, -615, -437, -192, 42, 253,
-    465, 660, 857, 1057, 1251, 1439, 1640, 1859, 2076, 2300, 2517, 2724,
-    2942, 3162, 3376, 3588, 3808, 4024, 4232, 4445, 4630, 4811, 5004, 5181,
-    5341, 5472, 5572, 5622, 5614, 5538, 5358, 5142, 4898, 4547, 4113, 3628,
-    3100, 2553, 2011, 1459, 884, 362, -105, -580, -1034, -1465, -1871, -2232,
-    -2553, -2836, -3072, -3241, -3358, -3430, -3454, -3457, -3428, -3355, -3246, -3112,
-    -2949, -2759, -2562, -2349, -2128, -1916, -1683, -1429, -1172, -913, -651, -375,
-    -97, 197, 478, 734, 1035, 1337, 1579, 1796, 2002, 2203, 2413, 2643,
-    2849, 3034, 3260, 3475, 3641, 3789, 3914, 4033, 4161, 4289, 4418, 4561,
-    4728, 4896, 5072, 5245, 5401, 5563, 5732, 5894, 6047, 6197, 6341, 6469,
-    6596, 6701, 6786, 6876, 6961, 7031, 7094, 7164, 7243, 7328, 7428, 7497,
-    7564, 7678, 7759, 7789, 7803, 7807, 7810, 7831, 7873, 7888, 7919, 8005,
-    8073, 8114, 8146, 8156, 8171, 8189, 8208, 8230, 8262, 8304, 8346, 8394,
-    8430, 8455, 8491, 8523, 8543, 8558, 8573, 8580, 8582, 8582, 8555, 8525,
-    8503, 8475, 8438, 8399, 8375, 8354, 8346, 8341, 8303, 8294, 8310, 8270,
-    8194, 8113, 8033, 7962, 7917, 7876, 7810, 7787, 7798, 7772, 7728, 7674,
-    7614, 7559, 7499, 7438, 7380, 7332, 7296, 7263, 7226, 7177, 7132, 7085,
-    7015, 6917, 6788, 6618, 6397, 6120, 5764, 5325, 4829, 4272, 3654, 2980,
-    2268, 1539, 792, 41, -736, -1535, -2288, -3035, -3813, -4580, -5316, -6011,
-    -6654, -7233, -7788, -8311, -8735, -9107, -9469, -9798, -10098, -10362, -10587, -10782,
-    -10941, -11071, -11160, -11215, -11244, -11256, -11254, -11227, -11189, -11153, -11113, -11064,
-    -11005, -10940, -10870, -10810, -10755, -10690, -10628, -10569, -10515, -10449, -10363, -10271,
-    -10171, -10103, -10039, -9937, -9873, -9852, -9838, -9826, -9804, -9764, -9709, -9679,
-    -9628, -9511, -9406, -9320, -9233, -9150, -9058, -8965, -8876, -8790, -8699, -8591,
-    -8477, -8364, -8262, -8169, -8072, -7981, -7896, -7812, -7721, -7630, -7546, -7467,
-    -7410, -7356, -7295, -7232, -7164, -7098, -7013, -6918, -6815, -6709, -6630, -6515,
-    -6370, -6264, -6173, -6080, -5981, -5867, -5728, -5586, -5469, -5300, -5086, -4897,
-    -4714, -4531, -4350, -4161, -3974, -3788, -3604, -3400, -3183, -2966, -2751, -2552,
-    -2356, -2156, -1959, -1766, -1570, -1363, -1165, -972, -791, -634, -472, -308,
-    -147, 15, 179, 360, 544, 740, 919, 1080, 1292, 1499, 1664, 1827,
-    1990, 2158, 2339, 2535, 2710, 2883, 3129, 3393, 3631, 3869, 4099, 4324,
-    4544, 4748, 4927, 5085, 5227, 5326, 5372, 5355, 5270, 5130, 4934, 4685,
-    4386, 4055, 3687, 3274, 2837, 2364, 1871, 1389, 908, 439, -16, -445,
-    -846, -1218, -1554, -1892, -2187, -2400, -2610, -2816, -2985, -3127, -3232, -3283,
-    -3292, -3295, -3240, -3094, -2940, -2785, -2611, -2433, -2245, -2040, -1824, -1604,
-    -1361, -1095, -825, -544, -261, 18, 300, 578, 851, 1121, 1397, 1660,
-    1911, 2156, 2370, 2585, 2805, 3008, 3206, 3396, 3586, 3773, 3969, 4154,
-    4301, 4480, 4680, 4830, 4964, 5093, 5210, 5332, 5475, 5612, 5729, 5903,
-    6114, 6287, 6444, 6589, 6708, 6817, 6928, 7027, 7118, 7232, 7350, 7455,
-    7558, 7649, 7728, 7800, 7870, 7930, 7984, 8036, 8069, 8097, 8113, 8110,
-    8126, 8138, 8142, 8148, 8154, 8169, 8189, 8223, 8231, 8225, 8273, 8314,
-    8311, 8302, 8286, 8268, 8271, 8297, 8309, 8329, 8415, 8503, 8546, 8578,
-    8597, 8597, 8597, 8601, 8589, 8581, 8596, 8608, 8615, 8618, 8614, 8602,
-    8584, 8559, 8521, 8478, 8429, 8365, 8301, 8218, 8131, 8056, 7965, 7868,
-    7777, 7692, 7620, 7557, 7495, 7405, 7335, 7312, 7252, 7161, 7070, 6972,
-    6884, 6817, 6750, 6649, 6553, 6475, 6329, 6108, 5834, 5495, 5094, 4643,
-    4145, 3599, 3029, 2445, 1833, 1199, 545, -125, -807, -1498, -2189, -2874,
-    -3550, -4221, -4875, -5505, -6127, -6707, -7250, -7778, -8271, -8729, -9149, -9526,
-    -9859, -10169, -10466, -10690, -10869, -11067, -11251, -11412, -11546, -11636, -11683, -11714,
-    -11739, -11702, -11621, -11558, -11496, -11426, -11361, -11296, -11223, -11142, -11057, -10948,
-    -10825, -10701, -10577, -10456, -10336, -10223, -10117, -10018, -9928, -9847, -9775, -9702,
-    -9641, -9592, -9529, -9474, -9429, -9381, -9330, -9268, -9193, -9109, -9046, -8986,
-    -8881, -8789, -8739, -8692, -8644, -8591, -8521, -8438, -8372, -8299, -8168, -8034,
-    -7935, -7844, -7761, -7688, -7612, -7525, -7438, -7348, -7237, -7120, -7004, -6885,
-    -6764, -6639, -6517, -6395, -6279, -6166, -6053, -5937, -5816, -5710, -5599, -5469,
-    -5344, -5216, -5080, -4935, -4776, -4600, -4421, -4269, -4090, -3868, -3677, -3516,
-    -3349, -3179, -2999, -2796, -2586, -2399, -2182, -1917, -1677, -1471, -1268, -1072,
-    -884, -690, -489, -298, -98, 118, 329, 538, 745, 951, 1152, 1346,
-    1538, 1724, 1914, 2103, 2293, 2476, 2645, 2831, 3028, 3216, 3405, 3599,
-    3799, 4008, 4228, 4422, 4583, 4766, 4938, 5029, 5062, 5056, 5004, 4913,
-    4802, 4635, 4407, 4188, 3957, 3658, 3322, 2965, 2586, 2192, 1805, 1417,
-    1023, 655, 298, -52, -385, -704, -1006, -1292, -1557, -1799, -2017, -2205,
-    -2371, -2510, -2634, -2739, -2792, -2820, -2831, -2812, -2763, -2684, -2571, -2427,
-    -2294, -2138, -1909, -1673, -1465, -1251, -1024, -789, -535, -261, -13, 244,
-    558, 868, 1150, 1424, 1694, 1955, 2210, 2470, 2711, 2950, 3201, 3439,
-    3672, 3893, 4101, 4297, 4480, 4658, 4830, 5001, 5167, 5319, 5465, 5585,
-    5704, 5839, 5962, 6080, 6200, 6319, 6438, 6563, 6681, 6770, 6890, 7046,
-    7169, 7258, 7341, 7419, 7497, 7590, 7679, 7734, 7817, 7939, 8035, 8109,
-    8177, 8241, 8291, 8341, 8389, 8417, 8452, 8497, 8534, 8566, 8589, 8604,
-    8613, 8616, 8623, 8627, 8635, 8636, 8634, 8625, 8599, 8585, 8579, 8565,
-    8550, 8535, 8526, 8524, 8536, 8533, 8513, 8537, 8572, 8567, 8544, 8514,
-    8483, 8458, 8445, 8414, 8360, 8354, 8365, 8344, 8310, 8275, 8234, 8185,
-    8140, 8089, 8029, 7987, 7946, 7893, 7835, 7771, 7701, 7628, 7554, 7480,
-    7410, 7343, 7264, 7181, 7074, 6942, 6802, 6634, 6427, 6181, 5896, 5580,
-    5229, 4849, 4406, 3929, 3467, 2964, 2404, 1808, 1186, 551, -82, -707,
-    -1359, -2004, -2589, -3173, -3772, -4362, -4941, -5508, -6053, -6567, -7065, -7534,
-    -7964, -8379, -8771, -9136, -9480, -9800, -10094, -10361, -10605, -10814, -11005, -11183,
-    -11336, -11479, -11595, -11677, -11738, -11783, -11818, -11831, -11828, -11801, -11759, -11730,
-    -11659, -11543, -11447, -11365, -11286, -11205, -11115, -11007, -10894, -10804, -10677, -10508,
-    -10370, -10254, -10144, -10044, -9945, -9843, -9743, -9651, -9547, -9437, -9344, -9250,
-    -9158, -9076, -8994, -8909, -8831, -8754, -8673, -8608, -8550, -8492, -8439, -8375,
-    -8299, -8225, -8157, -8092, -8017, -7934, -7832, -7739, -7658, -7528, -7382, -7267,
-    -7161, -7060, -6954, -6837, -6701, -6574, -6461, -6295, -6116, -5976, -5843, -5712,
-    -5578, -5436, -5288, -5141, -4994, -4824, -4656, -4501, -4336, -4178, -4021, -3855,
-    -3693, -3540, -3384, -3224, -3075, -2924, -2769, -2613, -2442, -2266, -2095, -1933,
-    -1769, -1595, -1412, -1219, -1052, -876, -649, -432, -238, -47, 143, 339,
-    544, 759, 950, 1147, 1399, 1632, 1836, 2044, 2256, 2477, 2698, 2919,
-    3135, 3357, 3597, 3817, 4024, 4229, 4412, 4578, 4721, 4824, 4883, 4908,
-    4892, 4830, 4735, 4602, 4438, 4249, 4026, 3766, 3470, 3157, 2832, 2504,
-    2161, 1790, 1450, 1149, 830, 502, 180, -129, -422, -688, -938, -1197,
-    -1413, -1576, -1746, -1907, -2037, -2139, -2214, -2271, -2306, -2320, -2304, -2264,
-    -2223, -2155, -2056, -1941, -1803, -1655, -1507, -1345, -1163, -972, -772, -563,
-    -344, -113, 123, 359, 591, 822, 1062, 1310, 1561, 1788, 2007, 2271,
-    2542, 2787, 3017, 3235, 3450, 3663, 3869, 4048, 4207, 4402, 4603, 4771,
-    4935, 5095, 5255, 5416, 5564, 5705, 5840, 5981, 6113, 6230, 6355, 6474,
-    6586, 6695, 6791, 6877, 6966, 7056, 7140, 7217, 7283, 7348, 7414, 7475,
-    7535, 7582, 7621, 7660, 7700, 7735, 7741, 7761, 7823, 7875, 7911, 7933,
-    7943, 7956, 7969, 7972, 7949, 7936, 7962, 7979, 7981, 7981, 7980, 7989,
-    7995, 7985, 7967, 7954, 7948, 7932, 7914, 7902, 7885, 7865, 7842, 7810,
-    7775, 7749, 7724, 7693, 7653, 7603, 7558, 7513, 7467, 7421, 7362, 7303,
-    7249, 7198, 7135, 7053, 7007, 6987, 6954, 6909, 6846, 6779, 6713, 6639,
-    6554, 6458, 6395, 6358, 6303, 6234, 6158, 6079, 5998, 5891, 5754, 5594,
-    5420, 5220, 4986, 4728, 4449, 4142, 3813, 3467, 3097, 2713, 2317, 1899,
-    1464, 1011, 550, 97, -361, -815, -1275, -1744, -2205, -2656, -3091, -3532,
-    -3964, -4338, -4692, -5050, -5414, -5784, -6137, -6473, -6796, -7112, -7409, -7650,
-    -7864, -8083, -8289, -8474, -8628, -8762, -8893, -9019, -9125, -9205, -9277, -9339,
-    -9385, -9416, -9434, -9435, -9420, -9399, -9366, -9328, -9289, -9242, -9194, -9135,
-    -9061, -8988, -8911, -8845, -8785, -8717, -8638, -8551, -8480, -8390, -8256, -8133,
-    -8031, -7951, -7887, -7818, -7750, -7682, -7625, -7550, -7433, -7328, -7243, -7161,
-    -7075, -6977, -6881, -6792, -6707, -6614, -6514, -6428, -6345, -6259, -6172, -6076,
-    -5973, -5867, -5769, -5671, -5578, -5485, -5383, -5287, -5178, -5065, -4959, -4852,
-    -4761, -4670, -4567, -4451, -4336, -4240, -4107, -3946, -3813, -3699, -3605, -3517,
-    -3422, -3323, -3231, -3153, -3037, -2893, -2773, -2662, -2547, -2422, -2288, -2160,
-    -2043, -1929, -1804, -1679, -1563, -1443, -1321, -1196, -1068, -938, -809, -684,
-    -555, -431, -301, -172, -50, 86, 220, 352, 482, 598, 720, 852,
-    992, 1118, 1239, 1407, 1578, 1722, 1851, 1958, 2064, 2168, 2259, 2327,
-    2382, 2469, 2546, 2586, 2610, 2623, 2634, 2627, 2591, 2534, 2464, 2393,
-    2304, 2205, 2102, 1989, 1874, 1753, 1629, 1496, 1361, 1225, 1084, 950,
-    809, 671, 547, 416, 289, 153, 14, -103, -205, -298, -408, -499,
-    -543, -593, -647, -703, -757, -791, -822, -853, -894, -909, -872, -835,
-    -796, -745, -678, -594, -519, -447, -372, -282, -177, -77, 32, 143,
-    255, 373, 492, 615, 736, 863, 986, 1107, 1235, 1353, 1479, 1605,
-    1721, 1835, 1932, 2032, 2140, 2250, 2349, 2421, 2522, 2648, 2757, 2859,
-    2946, 3032, 3115, 3189, 3255, 3307, 3395, 3506, 3601, 3697, 3794, 3900,
-    4001, 4085, 4161, 4235, 4322, 4404, 4479, 4556, 4626, 4695, 4766, 4836,
-    4904, 4966, 5030, 5083, 5137, 5185, 5220, 5261, 5294, 5319, 5335, 5338,
-    5342, 5340, 5334, 5299, 5253, 5254, 5265, 5259, 5244, 5219, 5192, 5154,
-    5111, 5053, 4998, 4990, 4992, 4979, 4966, 4956, 4951, 4936, 4914, 4889,
-    4871, 4864, 4846, 4821, 4798, 4774, 4756, 4741, 4730, 4718, 4707, 4693,
-    4667, 4644, 4613, 4583, 4564, 4534, 4497, 4447, 4385, 4316, 4240, 4155,
-    4035, 3924, 3853, 3768, 3661, 3538, 3395, 3232, 3056, 2872, 2662, 2467,
-    2304, 2125, 1929, 1730, 1529, 1322, 1104, 881, 645, 414, 186, -55,
-    -291, -526, -761, -991, -1217, -1434, -1648, -1856, -2069, -2281, -2486, -2699,
-    -2901, -3092, -3287, -3480, -3673, -3865, -4056, -4234, -4413, -4603, -4745, -4844,
-    -4950, -5057, -5162, -5269, -5377, -5471, -5558, -5646, -5689, -5703, -5730, -5755,
-    -5768, -5769, -5772, -5773, -5778, -5785, -5777, -5767, -5761, -5745, -5727, -5703,
-    -5675, -5641, -5602, -5561, -5518, -5484, -5449, -5414, -5389, -5350, -5309, -5279,
-    -5254, -5236, -5221, -5205, -5179, -5165, -5149, -5085, -5006, -4944, -4892, -4844,
-    -4799, -4751, -4691, -4638, -4579, -4482, -4379, -4289, -4193, -4086, -3976, -3876,
-    -3782, -3697, -3611, -3514, -3424, -3335, -3243, -3153, -3058, -2964, -2866, -2767,
-    -2671, -2581, -2500, -2415, -2337, -2264, -2182, -2109, -2052, -2004, -1965, -1922,
-    -1872, -1819, -1782, -1731, -1640, -1550, -1477, -1410, -1348, -1285, -1218, -1147,
-    -1089, -1014, -907, -805, -707, -600, -486, -376, -276, -180, -89, 2,
-    97, 185, 279, 375, 471, 575, 680, 790, 896, 992, 1079, 1161,
-    1243, 1308, 1365, 1424, 1465, 1491, 1500, 1502, 1508, 1510, 1498, 1465,
-    1450, 1454, 1443, 1418, 1384, 1345, 1309, 1264, 1207, 1137, 1086, 1052,
-    1011, 970, 935, 905, 866, 808, 742, 672, 608, 548, 488, 431,
-    367, 312, 272, 230, 193, 157, 122, 84, 48, 14, -32, -63,
-    -83, -111, -138, -164, -182, -191, -196, -215, -236, -216, -177, -150,
-    -119, -82, -41, 6, 55, 87, 119, 187, 267, 341, 423, 509,
-    591, 664, 724, 775, 835, 908, 977, 1047, 1120, 1184, 1249, 1324,
-    1398, 1472, 1548, 1619, 1683, 1745, 1799, 1846, 1902, 1958, 2003, 2046,
-    2086, 2125, 2174, 2209, 2217, 2241, 2305, 2372, 2427, 2487, 2543, 2594,
-    2653, 2694, 2717, 2760, 2831, 2895, 2951, 3014, 3071, 3119, 3162, 3187,
-    3205, 3238, 3273, 3292, 3312, 3332, 3343, 3353, 3367, 3379, 3391, 3402,
-    3403, 3398, 3389, 3372, 3352, 3339, 3323, 3303, 3279, 3248, 3219, 3197,
-    3152, 3091, 3065, 3074, 3078, 3078, 3083, 3075, 3066, 3066, 3046, 3015,
-    3015, 3033, 3037, 3040, 3051, 3052, 3049, 3049, 3034, 3011, 3000, 2985,
-    2954, 2921, 2889, 2847, 2803, 2760, 2708, 2650, 2587, 2508, 2414, 2313,
-    2206, 2096, 1982, 1861, 1729, 1585, 1433, 1284, 1129, 953, 779, 641,
-    525, 401, 274, 145, 14, -112, -241, -391, -536, -654, -765, -884,
-    -995, -1098, -1204, -1314, -1427, -1542, -1647, -1745, -1844, -1939, -2034, -2133,
-    -2222, -2301, -2382, -2463, -2532, -2607, -2690, -2770, -2848, -2929, -2996, -3057,
-    -3133, -3212, -3286, -3365, -3440, -3512, -3590, -3652, -3671, -3673, -3691, -3710,
-    -3719, -3729, -3735, -3744, -3763, -3770, -3749, -3726, -3719, -3700, -3666, -3631,
-    -3599, -3564, -3535, -3512, -3482, -3443, -3404, -3370, -3333, -3295, -3253, -3205,
-    -3153, -3112, -3078, -3037, -3000, -2975, -2947, -2921, -2912, -2904, -2880, -2858,
-    -2838, -2812, -2805, -2810, -2774, -2701, -2636, -2577, -2509, -2451, -2396, -2332,
-    -2282, -2239, -2169, -2090, -2028, -1974, -1901, -1832, -1774, -1715, -1661, -1597,
-    -1525, -1461, -1400, -1337, -1272, -1225, -1182, -1148, -1088, -1024, -970, -938,
-    -897, -861, -830, -792, -745, -703, -670, -637, -602, -550, -514, -490,
-    -458, -378, -300, -236, -169, -75, -24, 45, 140, 227, 282, 351,
-    430, 524, 579, 667, 713, 775, 824, 893, 926, 958, 998, 1079,
-    1095, 1058, 1066, 1083, 1095, 1066, 1041, 1025, 1018, 969, 940, 842,
-    811, 772, 711, 678, 577, 532, 519, 450, 399, 342, 334, 297,
-    270, 287, 302, 237, 236, 264, 248, 207, 196, 213, 191, 186,
-    206, 248, 282, 266, 260, 300, 292, 316, 334, 371, 295, 308,
-    359, 379, 346, 374, 399, 378, 373, 333, 362, 344, 370, 339,
-    341, 327, 303, 235, 290, 280, 180, 221, 279, 342, 319, 306,
-    412, 414, 466, 507, 409, 548, 600, 643, 691, 822, 908, 912,
-    894, 1046, 1190, 1225, 1155, 1386, 1378, 1388, 1433, 1717, 1637, 1509,
-    1573, 1705, 1824, 1783, 1775, 1809, 1743, 1743, 1848, 1798, 1651, 2070,
-    3066, 7332, 8698, 8524, 8316, 8182, 8091, 7964, 7987, 7915, 7627, 7388,
-    7231, 7366, 6861, 6784, 6684, 6215, 6335, 5904, 6562, 6834, 6021, 5211,
-    5433, 6052, 6466, 7224, 8212, 8547, 9545, 10101, 10829, 9844, 9015, 7534,
-    3950, 695, -2963, -5493, -7461, -8462, -8934, -9387, -10969, -13657, -16723, -14521,
-    -11062, -9087, -7841, -4589, 2783, 8528, 9466, 8539, 11444, 13351, 13643, 12624,
-    15238, 17980, 17589, 16633, 14272, 5404, -11025, -13534, 9042, 4617, -205, -2821,
-    -2013, -1660, -2323, -1362, -3786, -5135, -571, 9011, 15572, 15658, 16011, 15431,
-    15040, 13164, 10575, 8702, 6298, 3632, -290, -3418, -5614, -7864, -9156, -10392,
-    -11906, -12874, -13821, -14524, -15332, -15811, -15947, -16376, -17016, -17302, -17075, -16866,
-    -17067, -17442, -17054, -16807, -15870, -15679, -15647, -15357, -14222, -12224, -11504, -13236,
-    -15686, -16127, -15767, -15319, -15107, -14382, -12706, -11101, -8973, -6353, -1997, 1491,
-    4022, 5238, 7452, 9269, 10578, 11603, 12933, 13614, 14419, 14775, 15333, 16024,
-    16410, 16724, 16482, 16075, 16117, 16059, 16044, 15584, 15015, 14130, 14062, 13877,
-    13708, 13307, 12613, 11793, 11312, 10785, 10511, 9678, 8508, 7409, 7474, 7452,
-    8479, 9636, 9537, 9475, 9285, 9052, 8874, 7808, 5928, 3275, -273, -3667,
-    -7351, -9318, -11362, -13191, -14396, -15822, -16796, -17616, -18608, -19031, -19505, -19841,
-    -20568, -21321, -21184, -21281, -21673, -21878, -21869, -21766, -21447, -20896, -20561, -19912,
-    -19240, -18520, -17422, -16402, -16244, -16961, -17661, -18065, -18006, -17637, -17261, -16767,
-    -16181, -15472, -14424, -12564, -10065, -7548, -4968, -1823, 1064, 3933, 5938, 7427,
-    8690, 10120, 11337, 12043, 12709, 13402, 14117, 14822, 15252, 15416, 15470, 15426,
-    15294, 15097, 14900, 14654, 14470, 14331, 14000, 13634, 13336, 13264, 13019, 12435,
-    11856, 11325, 10964, 10564, 9784, 8827, 8349, 8774, 9864, 11033, 11869, 12334,
-    12759, 12781, 12106, 10484, 8438, 6480, 4065, 649, -2762, -5714, -7550, -9050,
-    -10355, -11558, -12460, -13051, -13691, -14434, -15015, -15549, -16052, -16636, -16948, -17081,
-    -17178, -17041, -16693, -16423, -16039, -15606, -15210, -14944, -14727, -14236, -13522, -13045,
-    -12491, -11838, -11130, -10498, -9499, -8509, -7492, -6698, -6563, -6782, -7207, -7732,
-    -8211, -8616, -8811, -8778, -8455, -7373, -5587, -3008, 304, 3616, 6362, 8239,
-    10189, 12061, 13762, 15109, 16285, 17396, 18281, 19143, 19806, 20286, 20599, 20986,
-    21472, 21926, 21902, 21917, 21839, 21697, 21326, 20882, 20397, 19847, 19221, 18665,
-    18108, 17532, 16906, 16485, 15911, 15130, 14311, 13625, 12948, 12213, 11369, 10695,
-    10058, 9024, 7879, 7507, 7630, 8018, 8532, 9062, 9470, 9635, 9601, 9643,
-    9361, 8309, 6617, 3833, 769, -2335, -4833, -6763, -8586, -10056, -11468, -12799,
-    -14020, -15022, -15856, -16679, -17328, -17681, -17538, -16916, -16692, -16864, -17046, -17072,
-    -16923, -16748, -16534, -16188, -15805, -15348, -14909, -14461, -13865, -13265, -12734, -12324,
-    -11786, -11228, -10621, -10066, -9478, -8827, -8215, -7689, -6814, -5841, -5467, -5478,
-    -5593, -5984, -6433, -6738, -6972, -6923, -6782, -6558, -6237, -5185, -3155, -502,
-    2380, 5135, 7128, 8946, 10616, 12059, 13273, 14390, 15242, 16065, 16879, 17524,
-    17938, 18203, 18483, 18624, 18675, 18622, 18531, 18332, 17957, 17541, 17226, 16888,
-    16474, 15915, 15335, 14737, 14199, 13686, 13122, 12450, 11738, 11124, 10553, 9862,
-    8982, 8149, 7407, 6660, 5921, 5234, 4698, 4016, 3206, 2073, 815, -687,
-    -1908, -2512, -2650, -2646, -2573, -2608, -2486, -2630, -2945, -3255, -3478, -3701,
-    -3938, -4648, -6137, -7722, -9396, -11151, -12780, -14302, -15705, -16938, -18023, -18956,
-    -19775, -20408, -20908, -21274, -21560, -21767, -21907, -21886, -21976, -21948, -21853, -21660,
-    -21214, -20789, -20353, -19849, -19299, -18771, -18219, -17571, -16858, -16112, -15258, -14458,
-    -13682, -12991, -12324, -11740, -11082, -10489, -9798, -9026, -8255, -7444, -6785, -6148,
-    -5180, -3839, -2265, -990, -482, -327, -241, -193, -259, -131, 88, 357,
-    925, 1861, 3086, 4247, 5093, 6034, 7272, 8818, 10476, 12180, 13825, 15377,
-    16853, 18140, 19235, 20162, 20980, 21608, 22174, 22663, 23029, 23318, 23447, 23572,
-    23594, 23402, 23151, 22762, 22279, 21797, 21134, 20377, 19627, 18924, 18217, 17501,
-    16759, 16018, 15211, 14426, 13592, 12834, 12088, 11239, 10482, 9758, 9107, 8376,
-    7484, 6736, 6023, 5117, 3963, 2794, 1687, 610, -404, -1308, -2242, -3319,
-    -4482, -5185, -5467, -5609, -5684, -5793, -5915, -6107, -6329, -6667, -7117, -7705,
-    -8265, -8838, -9337, -9727, -10245, -10490, -10695, -11260, -12257, -13443, -14547, -15676,
-    -16795, -17882, -18914, -19795, -20491, -20998, -21363, -21638, -21884, -22104, -22282, -22212,
-    -21978, -21631, -21017, -20339, -19681, -19040, -18414, -17818, -17211, -16625, -16004, -15370,
-    -14749, -14209, -13775, -13302, -12619, -11750, -10811, -9940, -9160, -8439, -7787, -7092,
-    -6350, -5555, -4533, -3351, -2035, -847, 218, 1337, 2493, 3648, 4684, 5577,
-    6350, 7112, 8019, 8685, 8901, 8874, 8837, 8952, 9011, 8984, 8991, 9065,
-    9168, 9393, 9802, 10305, 11062, 11911, 12752, 13353, 13914, 14741, 15746, 16872,
-    17984, 19141, 20248, 21223, 21978, 22703, 23256, 23771, 24183, 24414, 24447, 24372,
-    24213, 23878, 23248, 22546, 21883, 21276, 20642, 20008, 19360, 18643, 17879, 17203,
-    16584, 15949, 15360, 14788, 14189, 13394, 12582, 11649, 10844, 10048, 9214, 8341,
-    7553, 6757, 5935, 4814, 3490, 2188, 1063, 58, -941, -1862, -2841, -3953,
-    -5030, -5886, -6531, -7096, -7768, -8351, -8788, -9290, -10016, -10570, -10871, -11057,
-    -11199, -11205, -11106, -11096, -11185, -11338, -11632, -12056, -12457, -12766, -13045, -13439,
-    -13891, -14356, -14856, -15328, -15735, -16206, -16598, -16987, -17134, -17210, -17582, -17555,
-    -17520, -18038, -18690, -19250, -19687, -20055, -20346, -20550, -20680, -20637, -20437, -20080,
-    -19494, -18902, -18341, -17856, -17391, -16793, -16211, -15688, -15155, -14583, -14025, -13399,
-    -12806, -12161, -11660, -11187, -10650, -10160, -9519, -8757, -7929, -7088, -6203, -5164,
-    -3931, -2734, -1617, -378, 893, 2026, 3161, 4220, 5066, 5729, 6373, 7020,
-    7672, 8265, 8875, 9438, 10066, 10714, 11334, 11852, 12350, 12770, 13160, 13623,
-    14221, 14537, 14433, 14273, 14310, 14369, 14241, 14065, 14034, 14015, 13966, 13955,
-    14037, 14200, 14342, 14564, 14798, 15085, 15402, 15710, 15955, 16458, 17231, 18025,
-    18735, 19434, 20149, 20695, 21174, 21455, 21433, 20887, 20291, 19594, 18911, 18256,
-    17510, 16766, 16069, 15464, 14876, 14345, 13781, 13182, 12631, 12039, 11493, 10833,
-    10239, 9732, 9268, 8735, 8207, 7762, 7365, 6949, 6470, 6037, 5667, 5191,
-    4691, 3963, 2689, 1376, 58, -1212, -2568, -3827, -4968, -5862, -6623, -7374,
-    -8063, -8736, -9448, -10128, -10810, -11438, -12075, -12654, -13258, -13798, -14308, -14877,
-    -15399, -15844, -16334, -16739, -17078, -17431, -17662, -17782, -17788, -17790, -17795, -17743,
-    -17649, -17518, -17362, -17274, -17217, -17160, -17065, -17014, -17034, -17106, -17170, -17280,
-    -17373, -17378, -17359, -17418, -17525, -17636, -17644, -17665, -17812, -17926, -17945, -17940,
-    -17950, -17903, -17736, -17750, -17965, -18207, -18386, -18363, -17880, -17277, -16579, -15920,
-    -15283, -14617, -13980, -13279, -12657, -12109, -11562, -11028, -10476, -9949, -9374, -8757,
-    -8176, -7648, -7150, -6696, -6229, -5775, -5376, -4891, -4229, -3528, -2854, -2206,
-    -1345, -73, 1267, 2718, 4200, 5631, 6663, 7532, 8386, 9233, 10004, 10720,
-    11462, 12192, 12792, 13377, 13992, 14601, 15121, 15550, 16047, 16542, 16957, 17317,
-    17668, 18081, 18417, 18637, 18848, 19040, 19271, 19421, 19561, 19744, 19916, 19932,
-    20003, 19975, 19713, 19434, 19260, 19051, 18853, 18781, 18700, 18549, 18377, 18228,
-    18090, 17911, 17711, 17578, 17516, 17406, 17319, 17268, 17223, 17258, 17312, 17366,
-    17442, 17544, 17585, 17559, 17422, 17405, 17480, 17560, 17133, 16542, 15925, 15303,
-    14779, 14195, 13609, 12998, 12413, 11805, 11201, 10624, 10083, 9594, 9060, 8554,
-    8039, 7562, 7116, 6693, 6229, 5741, 5196, 4528, 3931, 3315, 2693, 2110,
-    1473, 854, 281, -276, -869, -1958, -3336, -4697, -5800, -6646, -7583, -8508,
-    -9356, -10118, -10911, -11621, -12225, -12884, -13496, -14123, -14706, -15282, -15895, -16474,
-    -16977, -17447, -17898, -18393, -18890, -19302, -19718, -20039, -20336, -20561, -20771, -20985,
-    -21143, -21238, -21324, -21444, -21533, -21485, -21318, -21106, -20921, -20670, -20419, -20267,
-    -20144, -19964, -19771, -19563, -19370, -19212, -19133, -18986, -18727, -18496, -18337, -18160,
-    -17971, -17760, -17560, -17320, -17098, -16897, -16666, -16396, -16214, -16031, -15785, -15528,
-    -15247, -14785, -14300, -13764, -13205, -12612, -12053, -11512, -10983, -10474, -9971, -9453,
-    -8954, -8455, -7972, -7486, -7020, -6484, -5947, -5400, -4732, -4010, -3277, -2532,
-    -1864, -1230, -642, -43, 596, 1184, 1685, 2218, 2771, 3307, 3790, 4219,
-    4670, 5118, 5592, 6112, 6892, 7643, 8426, 9190, 9924, 10671, 11399, 12148,
-    12866, 13575, 14234, 14912, 15554, 16176, 16753, 17309, 17822, 18322, 18834, 19291,
-    19707, 20052, 20369, 20711, 20981, 21205, 21391, 21567, 21713, 21896, 22124, 22262,
-    22361, 22403, 22352, 22322, 22254, 22177, 22086, 22093, 22055, 22029, 21963, 21823,
-    21626, 21403, 21173, 20943, 20736, 20523, 20316, 20034, 19665, 19216, 18689, 18094,
-    17495, 16942, 16441, 16020, 15592, 15116, 14638, 14246, 13852, 13519, 13147, 12773,
-    12407, 11911, 11410, 10885, 10354, 9784, 9212, 8617, 8081, 7551, 7000, 6435,
-    5911, 5380, 4824, 4125, 3381, 2716, 2116, 1514, 935, 306, -342, -946,
-    -1510, -2096, -2653, -3214, -3717, -4246, -4707, -5130, -5452, -5717, -6016, -6274,
-    -6526, -6744, -6968, -7201, -7418, -7569, -7717, -7910, -8158, -8430, -8630, -8798,
-    -9009, -9193, -9390, -9605, -10164, -10884, -11629, -12360, -13090, -13851, -14528, -15157,
-    -15781, -16415, -17027, -17622, -18156, -18621, -19084, -19517, -19961, -20408, -20815, -21152,
-    -21452, -21701, -21934, -22164, -22373, -22587, -22729, -22839, -22937, -23057, -23111, -23126,
-    -23121, -23064, -22986, -22918, -22847, -22769, -22697, -22622, -22538, -22403, -22248, -22028,
-    -21809, -21567, -21294, -21052, -20810, -20608, -20375, -20027, -19557, -19029, -18488, -17919,
-    -17324, -16763, -16238, -15739, -15280, -14848, -14465, -14115, -13674, -13261, -12854, -12510,
-    -12204, -11715, -11116, -10487, -9924, -9329, -8743, -8183, -7639, -7102, -6576, -6042,
-    -5560, -5058, -4349, -3590, -2850, -2123, -1443, -750, -120, 564, 1213, 1855,
-    2439, 2991, 3553, 4076, 4572, 5014, 5392, 5752, 6078, 6415, 6734, 7049,
-    7341, 7591, 7833, 8077, 8281, 8496, 8732, 8940, 9148, 9354, 9566, 9782,
-    9977, 10165, 10361, 10591, 10857, 11315, 11812, 12340, 12900, 13455, 13965, 14474,
-    14979, 15488, 16004, 16512, 17033, 17543, 18037, 18470, 18920, 19365, 19762, 20116,
-    20454, 20795, 21129, 21454, 21777, 22061, 22315, 22565, 22765, 22956, 23126, 23303,
-    23426, 23501, 23567, 23649, 23712, 23761, 23779, 23773, 23734, 23649, 23581, 23524,
-    23448, 23351, 23208, 23026, 22817, 22589, 22325, 22034, 21730, 21407, 21068, 20709,
-    20345, 19969, 19581, 19156, 18697, 18195, 17693, 17166, 16614, 16079, 15560, 15020,
-    14476, 13919, 13342, 12771, 12194, 11643, 11110, 10569, 10010, 9447, 8874, 8300,
-    7746, 7207, 6660, 6130, 5623, 5079, 4353, 3584, 2817, 2094, 1392, 706,
-    21, -660, -1332, -1998, -2644, -3264, -3839, -4422, -5003, -5498, -5857, -6193,
-    -6542, -6897, -7237, -7567, -7911, -8260, -8577, -8893, -9205, -9526, -9842, -10153,
-    -10477, -10819, -11161, -11470, -11744, -12023, -12300, -12575, -12837, -13099, -13369, -13640,
-    -13912, -14174, -14405, -14609, -14803, -14992, -15182, -15368, -15548, -15751, -15964, -16202,
-    -16448, -16689, -16904, -17092, -17277, -17481, -17663, -17866, -18075, -18290, -18500, -18714,
-    -18937, -19171, -19397, -19608, -19827, -20047, -20250, -20430, -20605, -20762, -20924, -21071,
-    -21220, -21360, -21489, -21589, -21684, -21756, -21800, -21813, -21794, -21758, -21720, -21684,
-    -21631, -21552, -21442, -21317, -21154, -20974, -20774, -20573, -20365, -20132, -19867, -19582,
-    -19268, -18921, -18545, -18147, -17719, -17268, -16829, -16398, -15968, -15508, -15023, -14527,
-    -14003, -13486, -12959, -12440, -11916, -11381, -10842, -10305, -9760, -9216, -8672, -8144,
-    -7602, -7054, -6515, -5974, -5449, -4810, -4027, -3244, -2474, -1714, -972, -241,
-    458, 1141, 1802, 2415, 3026, 3620, 4188, 4740, 5250, 5644, 5972, 6300,
-    6624, 6946, 7239, 7508, 7773, 8035, 8303, 8578, 8837, 9096, 9363, 9631,
-    9880, 10127, 10373, 10617, 10873, 11121, 11366, 11613, 11845, 12071, 12293, 12523,
-    12747, 12958, 13178, 13394, 13620, 13865, 14113, 14341, 14560, 14780, 15010, 15241,
-    15466, 15674, 15888, 16111, 16341, 16573, 16796, 17012, 17217, 17414, 17601, 17782,
-    17962, 18129, 18288, 18446, 18592, 18728, 18860, 18997, 19122, 19244, 19367, 19469,
-    19571, 19674, 19762, 19847, 19932, 20019, 20105, 20188, 20275, 20350, 20414, 20470,
-    20526, 20584, 20630, 20663, 20691, 20710, 20714, 20690, 20641, 20570, 20483, 20381,
-    20251, 20116, 19979, 19826, 19658, 19457, 19228, 18974, 18691, 18391, 18064, 17712,
-    17350, 16971, 16577, 16163, 15727, 15280, 14806, 14311, 13800, 13281, 12754, 12217,
-    11683, 11134, 10570, 10013, 9446, 8868, 8290, 7707, 7137, 6580, 6032, 5477,
-    4831, 4070, 3284, 2517, 1748, 979, 220, -517, -1225, -1910, -2554, -3161,
-    -3753, -4324, -4879, -5354, -5718, -6058, -6394, -6705, -6998, -7275, -7548, -7811,
-    -8062, -8296, -8518, -8762, -9015, -9261, -9514, -9766, -10003, -10229, -10458, -10694,
-    -10933, -11184, -11439, -11685, -11922, -12149, -12374, -12604, -12847, -13085, -13308, -13528,
-    -13753, -13995, -14248, -14500, -14752, -14997, -15247, -15498, -15736, -15964, -16176, -16376,
-    -16586, -16796, -17009, -17236, -17469, -17700, -17916, -18110, -18294, -18473, -18652, -18834,
-    -19016, -19214, -19426, -19616, -19786, -19934, -20060, -20175, -20282, -20378, -20469, -20556,
-    -20628, -20686, -20731, -20750, -20744, -20727, -20700, -20656, -20599, -20541, -20487, -20435,
-    -20381, -20317, -20236, -20133, -20006, -19862, -19698, -19518, -19335, -19153, -18962, -18762,
-    -18570, -18378, -18176, -17958, -17723, -17476, -17223, -16972, -16713, -16446, -16175, -15886,
-    -15590, -15291, -14973, -14643, -14302, -13946, -13574, -13196, -12817, -12427, -12023, -11606,
-    -11172, -10729, -10280, -9820, -9349, -8877, -8417, -7970, -7515, -7058, -6610, -6139,
-    -5579, -4909, -4168, -3404, -2657, -1938, -1239, -552, 131, 802, 1455, 2095,
-    2726, 3357, 3962, 4494, 4967, 5384, 5734, 6061, 6376, 6678, 6970, 7232,
-    7478, 7724, 7962, 8188, 8396, 8585, 8771, 8953, 9138, 9329, 9518, 9700,
-    9869, 10026, 10183, 10334, 10470, 10595, 10715, 10831, 10948, 11070, 11207, 11346,
-    11491, 11643, 11782, 11923, 12067, 12207, 12357, 12513, 12678, 12855, 13032, 13215,
-    13401, 13586, 13780, 13976, 14181, 14401, 14636, 14874, 15110, 15348, 15589, 15841,
-    16103, 16362, 16620, 16878, 17143, 17428, 17713, 17994, 18279, 18561, 18829, 19071,
-    19297, 19520, 19735, 19941, 20138, 20329, 20515, 20691, 20856, 21007, 21142, 21248,
-    21325, 21394, 21456, 21510, 21553, 21579, 21593, 21590, 21576, 21549, 21491, 21405,
-    21296, 21178, 21065, 20946, 20819, 20678, 20523, 20354, 20151, 19924, 19688, 19432,
-    19168, 18903, 18649, 18404, 18143, 17871, 17580, 17262, 16915, 16536, 16152, 15767,
-    15377, 14994, 14609, 14220, 13819, 13402, 12971, 12532, 12095, 11648, 11183, 10723,
-    10248, 9759, 9275, 8797, 8331, 7854, 7362, 6855, 6328, 5800, 5178, 4422,
-    3651, 2893, 2134, 1392, 642, -97, -826, -1559, -2269, -2961, -3612, -4232,
-    -4841, -5342, -5728, -6098, -6467, -6829, -7186, -7529, -7860, -8169, -8462, -8739,
-    -8987, -9221, -9450, -9670, -9885, -10088, -10279, -10455, -10622, -10789, -10949, -11092,
-    -11220, -11344, -11485, -11642, -11789, -11918, -12034, -12141, -12244, -12340, -12444, -12561,
-    -12683, -12819, -12977, -13137, -13278, -13403, -13517, -13622, -13732, -13852, -13973, -14100,
-    -14250, -14420, -14602, -14787, -14958, -15125, -15303, -15482, -15657, -15833, -16014, -16196,
-    -16383, -16579, -16784, -16995, -17207, -17411, -17609, -17797, -17973, -18147, -18331, -18513,
-    -18698, -18898, -19099, -19293, -19479, -19644, -19788, -19929, -20069, -20209, -20349, -20483,
-    -20611, -20728, -20825, -20901, -20962, -21018, -21073, -21121, -21167, -21224, -21286, -21334,
-    -21371, -21408, -21440, -21449, -21432, -21400, -21361, -21319, -21263, -21187, -21100, -21001,
-    -20889, -20770, -20640, -20489, -20315, -20125, -19923, -19710, -19489, -19266, -19033, -18787,
-    -18527, -18246, -17941, -17620, -17287, -16942, -16584, -16217, -15841, -15453, -15056, -14639,
-    -14197, -13741, -13272, -12794, -12308, -11811, -11313, -10807, -10289, -9771, -9252, -8727,
-    -8184, -7633, -7083, -6511, -5936, -5335, -4617, -3811, -3003, -2198, -1400, -610,
-    185, 981, 1756, 2499, 3229, 3915, 4510, 5016, 5444, 5820, 6205, 6594,
-    6962, 7318, 7659, 7975, 8274, 8563, 8841, 9115, 9398, 9685, 9973, 10258,
-    10525, 10777, 11017, 11241, 11461, 11680, 11881, 12065, 12243, 12417, 12594, 12788,
-    12982, 13158, 13321, 13473, 13614, 13757, 13900, 14030, 14165, 14331, 14513, 14682,
-    14830, 14955, 15062, 15165, 15275, 15390, 15524, 15692, 15883, 16074, 16259, 16431,
-    16590, 16744, 16897, 17050, 17214, 17391, 17574, 17763, 17960, 18154, 18341, 18526,
-    18707, 18889, 19066, 19228, 19389, 19569, 19761, 19954, 20151, 20344, 20521, 20686,
-    20844, 20998, 21157, 21306, 21438, 21581, 21756, 21934, 22092, 22228, 22343, 22440,
-    22523, 22585, 22633, 22700, 22792, 22881, 22946, 22985, 23004, 23005, 22980, 22931,
-    22863, 22790, 22718, 22647, 22567, 22473, 22365, 22236, 22088, 21932, 21765, 21581,
-    21382, 21175, 20960, 20737, 20506, 20262, 20002, 19734, 19462, 19185, 18908, 18628,
-    18328, 18018, 17730, 17463, 17179, 16868, 16534, 16169, 15787, 15406, 15018, 14636,
-    14287, 13958, 13614, 13248, 12858, 12448, 12029, 11598, 11156, 10724, 10304, 9883,
-    9462, 9043, 8611, 8160, 7696, 7227, 6751, 6226, 5597, 4870, 4072, 3221,
-    2354, 1509, 679, -147, -950, -1729, -2485, -3212, -3950, -4729, -5458, -6048,
-    -6548, -7046, -7545, -8024, -8485, -8925, -9346, -9750, -10122, -10457, -10774, -11090,
-    -11406, -11727, -12051, -12374, -12693, -13000, -13293, -13571, -13834, -14083, -14327, -14569,
-    -14815, -15069, -15314, -15543, -15766, -15987, -16200, -16417, -16645, -16860, -17059, -17260,
-    -17465, -17660, -17849, -18030, -18194, -18356, -18525, -18678, -18798, -18914, -19047, -19197,
-    -19357, -19511, -19654, -19793, -19918, -19999, -20048, -20096, -20153, -20216, -20291, -20375,
-    -20455, -20529, -20587, -20618, -20627, -20624, -20611, -20602, -20605, -20613, -20616, -20616,
-    -20611, -20604, -20606, -20610, -20607, -20598, -20578, -20545, -20512, -20479, -20444, -20405,
-    -20352, -20291, -20243, -20192, -20109, -20010, -19924, -19849, -19782, -19725, -19663, -19587,
-    -19511, -19423, -19305, -19164, -19016, -18876, -18747, -18626, -18508, -18384, -18243, -18083,
-    -17910, -17725, -17532, -17340, -17160, -16987, -16803, -16603, -16396, -16195, -16004, -15812,
-    -15608, -15394, -15173, -14936, -14687, -14443, -14204, -13959, -13707, -13448, -13196, -12956,
-    -12705, -12425, -12133, -11845, -11563, -11291, -11022, -10744, -10468, -10195, -9897, -9564,
-    -9219, -8885, -8565, -8252, -7941, -7626, -7313, -7005, -6697, -6388, -6090, -5806,
-    -5540, -5295, -5035, -4706, -4313, -3901, -3486, -3065, -2638, -2213, -1800, -1400,
-    -1005, -613, -219, 189, 607, 1038, 1488, 1934, 2370, 2820, 3300, 3794,
-    4276, 4686, 5010, 5309, 5615, 5904, 6192, 6513, 6848, 7180, 7508, 7824,
-    8132, 8439, 8740, 9035, 9334, 9639, 9957, 10281, 10592, 10890, 11186, 11474,
-    11749, 12009, 12254, 12481, 12703, 12928, 13151, 13364, 13572, 13775, 13971, 14157,
-    14336, 14508, 14680, 14843, 14984, 15117, 15274, 15446, 15615, 15778, 15930, 16066,
-    16193, 16304, 16402, 16516, 16662, 16824, 16985, 17136, 17275, 17407, 17529, 17642,
-    17756, 17872, 17995, 18130, 18271, 18401, 18517, 18612, 18686, 18746, 18796, 18837,
-    18871, 18901, 18931, 18960, 18986, 19017, 19041, 19049, 19051, 19049, 19032, 19002,
-    18954, 18885, 18821, 18780, 18732, 18671, 18615, 18544, 18452, 18357, 18247, 18128,
-    18040, 17985, 17926, 17857, 17786, 17709, 17618, 17514, 17405, 17301, 17207, 17127,
-    17059, 16987, 16900, 16802, 16691, 16573, 16457, 16336, 16203, 16066, 15933, 15799,
-    15663, 15534, 15415, 15288, 15153, 15019, 14875, 14721, 14563, 14389, 14203, 14037,
-    13894, 13749, 13601, 13448, 13276, 13088, 12895, 12690, 12481, 12295, 12122, 11939,
-    11735, 11510, 11264, 10993, 10707, 10424, 10154, 9898, 9659, 9427, 9175, 8895,
-    8593, 8280, 7973, 7673, 7374, 7075, 6778, 6493, 6229, 5977, 5731, 5490,
-    5240, 4985, 4737, 4465, 4133, 3753, 3346, 2939, 2565, 2218, 1860, 1487,
-    1105, 709, 305, -98, -510, -914, -1283, -1629, -1977, -2331, -2690, -3057,
-    -3432, -3807, -4178, -4548, -4917, -5264, -5571, -5842, -6099, -6360, -6625, -6884,
-    -7145, -7418, -7687, -7931, -8161, -8392, -8632, -8876, -9121, -9372, -9626, -9882,
-    -10142, -10400, -10650, -10893, -11115, -11295, -11456, -11623, -11799, -11981, -12177, -12382,
-    -12595, -12796, -12948, -13054, -13151, -13254, -13362, -13483, -13614, -13742, -13872, -13996,
-    -14107, -14210, -14318, -14437, -14568, -14703, -14831, -14956, -15085, -15217, -15357, -15501,
-    -15640, -15774, -15909, -16045, -16194, -16352, -16506, -16654, -16806, -16962, -17121, -17285,
-    -17441, -17576, -17688, -17790, -17895, -18007, -18126, -18254, -18393, -18535, -18654, -18731,
-    -18777, -18813, -18846, -18878, -18917, -18966, -19021, -19078, -19129, -19163, -19185, -19205,
-    -19220, -19230, -19251, -19286, -19326, -19361, -19383, -19390, -19383, -19374, -19373, -19379,
-    -19383, -19391, -19402, -19411, -19421, -19433, -19429, -19407, -19385, -19357, -19300, -19229,
-    -19174, -19147, -19144, -19156, -19172, -19186, -19197, -19177, -19091, -18958, -18815, -18677,
-    -18551, -18440, -18341, -18237, -18125, -18001, -17850, -17671, -17471, -17252, -17029, -16806,
-    -16572, -16327, -16075, -15809, -15528, -15236, -14932, -14627, -14324, -14022, -13721, -13408,
-    -13090, -12771, -12437, -12086, -11727, -11374, -11011, -10620, -10219, -9819, -9424, -9042,
-    -8660, -8277, -7903, -7525, -7117, -6669, -6190, -5717, -5255, -4732, -4108, -3450,
-    -2814, -2191, -1562, -926, -278, 377, 1022, 1656, 2277, 2885, 3494, 4097,
-    4691, 5257, 5749, 6148, 6497, 6846, 7194, 7527, 7862, 8196, 8526, 8863,
-    9201, 9518, 9822, 10143, 10481, 10821, 11160, 11485, 11794, 12094, 12385, 12661,
-    12941, 13257, 13598, 13937, 14265, 14570, 14843, 15081, 15298, 15498, 15686, 15882,
-    16084, 16287, 16479, 16642, 16787, 16917, 17030, 17141, 17250, 17354, 17449, 17541,
-    17620, 17679, 17732, 17774, 17811, 17851, 17894, 17943, 17996, 18037, 18058, 18081,
-    18137, 18212, 18290, 18361, 18419, 18466, 18511, 18555, 18588, 18633, 18721, 18835,
-    18953, 19062, 19149, 19215, 19256, 19280, 19302, 19332, 19372, 19418, 19463, 19491,
-    19501, 19505, 19508, 19520, 19529, 19530, 19535, 19538, 19530, 19504, 19461, 19412,
-    19369, 19328, 19273, 19197, 19103, 19011, 18918, 18799, 18691, 18621, 18571, 18527,
-    18467, 18391, 18310, 18216, 18116, 18018, 17944, 17920, 17915, 17901, 17889, 17871,
-    17833, 17790, 17742, 17691, 17651, 17606, 17551, 17496, 17433, 17360, 17274, 17189,
-    17105, 17003, 16901, 16793, 16659, 16516, 16362, 16198, 16034, 15873, 15710, 15529,
-    15336, 15153, 14969, 14764, 14549, 14344, 14157, 13983, 13799, 13590, 13363, 13125,
-    12885, 12635, 12382, 12157, 11948, 11729, 11497, 11251, 10983, 10687, 10374, 10049,
-    9722, 9412, 9103, 8787, 8463, 8127, 7782, 7430, 7082, 6740, 6393, 6053,
-    5703, 5337, 4968, 4535, 3988, 3394, 2803, 2207, 1614, 1027, 443, -129,
-    -711, -1290, -1841, -2378, -2913, -3462, -4021, -4580, -5133, -5610, -5983, -6308,
-    -6604, -6886, -7179, -7483, -7795, -8122, -8458, -8799, -9144, -9479, -9796, -10101,
-    -10409, -10731, -11047, -11360, -11669, -11965, -12266, -12560, -12839, -13109, -13378, -13655,
-    -13932, -14195, -14446, -14682, -14911, -15130, -15326, -15506, -15696, -15890, -16062, -16200,
-    -16317, -16428, -16544, -16656, -16764, -16866, -16967, -17065, -17137, -17182, -17223, -17268,
-    -17313, -17371, -17459, -17558, -17655, -17745, -17818, -17878, -17931, -17983, -18050, -18122,
-    -18202, -18294, -18389, -18493, -18601, -18705, -18810, -18920, -19034, -19150, -19257, -19353,
-    -19451, -19550, -19646, -19733, -19807, -19892, -19977, -20016, -20028, -20027, -20008, -19980,
-    -19949, -19908, -19856, -19810, -19761, -19678, -19577, -19483, -19399, -19320, -19248, -19184,
-    -19129, -19078, -19011, -18929, -18847, -18759, -18676, -18618, -18575, -18522, -18466, -18414,
-    -18347, -18260, -18176, -18092, -18020, -17964, -17909, -17844, -17771, -17704, -17638, -17551,
-    -17443, -17335, -17238, -17129, -16990, -16828, -16657, -16494, -16339, -16184, -16023, -15869,
-    -15729, -15564, -15360, -15151, -14954, -14759, -14568, -14393, -14234, -14077, -13913, -13723,
-    -13507, -13286, -13070, -12861, -12654, -12454, -12255, -12047, -11823, -11578, -11322, -11059,
-    -10803, -10572, -10354, -10126, -9885, -9640, -9402, -9159, -8897, -8616, -8335, -8071,
-    -7793, -7487, -7175, -6860, -6553, -6269, -5990, -5703, -5429, -5155, -4855, -4528,
-    -4148, -3702, -3230, -2765, -2301, -1846, -1406, -952, -473, 13, 500, 987,
-    1466, 1941, 2419, 2900, 3393, 3891, 4389, 4906, 5413, 5832, 6161, 6474,
-    6798, 7120, 7440, 7757, 8073, 8404, 8743, 9074, 9409, 9754, 10104, 10455,
-    10799, 11125, 11440, 11750, 12050, 12337, 12629, 12928, 13220, 13492, 13758, 14022,
-    14277, 14510, 14725, 14926, 15121, 15315, 15491, 15639, 15776, 15910, 16042, 16179,
-    16318, 16442, 16565, 16691, 16805, 16895, 16965, 17023, 17089, 17165, 17246, 17330,
-    17420, 17515, 17618, 17731, 17842, 17951, 18066, 18180, 18288, 18390, 18479, 18558,
-    18634, 18691, 18735, 18794, 18855, 18892, 18923, 18957, 18971, 18963, 18943, 18901,
-    18847, 18813, 18790, 18744, 18678, 18608, 18541, 18467, 18386, 18305, 18224, 18136,
-    18042, 17939, 17823, 17693, 17559, 17425, 17292, 17157, 17018, 16880, 16756, 16645,
-    16539, 16434, 16324, 16199, 16067, 15934, 15791, 15641, 15498, 15361, 15220, 15083,
-    14959, 14824, 14676, 14535, 14409, 14286, 14153, 14010, 13859, 13716, 13594, 13468,
-    13334, 13208, 13092, 12973, 12853, 12741, 12629, 12514, 12409, 12301, 12193, 12081,
-    11959, 11833, 11711, 11588, 11466, 11352, 11245, 11143, 11051, 10955, 10851, 10746,
-    10639, 10523, 10403, 10286, 10162, 10035, 9908, 9775, 9651, 9537, 9413, 9281,
-    9146, 9020, 8890, 8748, 8598, 8442, 8304, 8180, 8042, 7897, 7756, 7626,
-    7495, 7364, 7237, 7094, 6950, 6817, 6675, 6521, 6362, 6191, 6014, 5845,
-    5669, 5459, 5222, 4965, 4687, 4391, 4081, 3751, 3400, 3037, 2670, 2299,
-    1919, 1524, 1122, 700, 267, -160, -606, -1073, -1547, -2020, -2495, -2985,
-    -3483, -3984, -4479, -4950, -5393, -5782, -6123, -6453, -6772, -7085, -7392, -7689,
-    -7974, -8242, -8501, -8753, -8994, -9229, -9453, -9664, -9863, -10055, -10244, -10422,
-    -10583, -10728, -10871, -11014, -11155, -11300, -11455, -11610, -11759, -11919, -12080, -12230,
-    -12391, -12534, -12653, -12790, -12955, -13123, -13270, -13413, -13570, -13735, -13904, -14048,
-    -14169, -14302, -14439, -14574, -14700, -14822, -14952, -15068, -15170, -15266, -15356, -15442,
-    -15523, -15602, -15680, -15753, -15823, -15883, -15935, -15981, -16021, -16050, -16072, -16094,
-    -16110, -16123, -16134, -16143, -16152, -16160, -16176, -16185, -16195, -16204, -16185, -16171,
-    -16179, -16185, -16186, -16186, -16193, -16204, -16227, -16255, -16249, -16236, -16240, -16242,
-    -16252, -16262, -16267, -16264, -16253, -16242, -16224, -16203, -16185, -16163, -16142, -16124,
-    -16107, -16083, -16046, -15997, -15941, -15876, -15802, -15730, -15658, -15575, -15483, -15386,
-    -15293, -15200, -15105, -15007, -14897, -14790, -14673, -14530, -14390, -14254, -14118, -13975,
-    -13821, -13668, -13520, -13391, -13249, -13071, -12898, -12732, -12569, -12409, -12235, -12053,
-    -11866, -11678, -11488, -11290, -11093, -10887, -10685, -10498, -10311, -10118, -9917, -9713,
-    -9507, -9308, -9110, -8907, -8706, -8504, -8305, -8121, -7945, -7774, -7604, -7440,
-    -7273, -7108, -6957, -6793, -6618, -6466, -6320, -6164, -5998, -5826, -5632, -5397,
-    -5140, -4854, -4548, -4253, -3968, -3688, -3397, -3097, -2795, -2487, -2185, -1881,
-    -1576, -1278, -984, -699, -420, -141, 140, 419, 694, 962, 1221, 1476,
-    1725, 1969, 2225, 2478, 2714, 2935, 3149, 3357, 3567, 3785, 3981, 4169,
-    4379, 4565, 4715, 4852, 4967, 5078, 5192, 5296, 5384, 5479, 5600, 5713,
-    5804, 5895, 5987, 6078, 6175, 6284, 6406, 6535, 6669, 6806, 6938, 7064,
-    7190, 7326, 7476, 7626, 7768, 7915, 8062, 8217, 8389, 8557, 8721, 8897,
-    9072, 9240, 9404, 9571, 9734, 9890, 10049, 10196, 10349, 10524, 10682, 10824,
-    10972, 11116, 11256, 11392, 11517, 11627, 11755, 11899, 12021, 12124, 12228, 12331,
-    12438, 12547, 12660, 12777, 12901, 13026, 13141, 13253, 13366, 13481, 13597, 13713,
-    13827, 13935, 14045, 14160, 14284, 14411, 14538, 14677, 14819, 14954, 15080, 15208,
-    15340, 15461, 15587, 15706, 15809, 15936, 16067, 16172, 16273, 16375, 16481, 16575,
-    16661, 16736, 16796, 16878, 16957, 17004, 17047, 17083, 17124, 17179, 17226, 17271,
-    17319, 17367, 17414, 17456, 17483, 17493, 17492, 17491, 17487, 17470, 17449, 17423,
-    17396, 17382, 17366, 17350, 17340, 17318, 17289, 17251, 17212, 17162, 17098, 17047,
-    16984, 16929, 16913, 16875, 16811, 16749, 16694, 16651, 16605, 16548, 16482, 16418,
-    16367, 16298, 16199, 16100, 16010, 15925, 15844, 15760, 15664, 15557, 15448, 15323,
-    15180, 15030, 14871, 14706, 14533, 14348, 14158, 13953, 13739, 13527, 13313, 13091,
-    12860, 12627, 12389, 12138, 11883, 11624, 11345, 11062, 10786, 10491, 10206, 9930,
-    9622, 9302, 8980, 8663, 8355, 8034, 7696, 7324, 6959, 6614, 6236, 5857,
-    5420, 4860, 4270, 3679, 3086, 2498, 1893, 1288, 676, 64, -550, -1179,
-    -1793, -2415, -3033, -3640, -4248, -4738, -5123, -5516, -5906, -6290, -6667, -7030,
-    -7407, -7776, -8147, -8524, -8886, -9262, -9631, -9963, -10303, -10655, -11007, -11353,
-    -11680, -11996, -12313, -12643, -12977, -13279, -13576, -13888, -14197, -14492, -14771, -15039,
-    -15296, -15546, -15787, -16009, -16219, -16428, -16646, -16862, -17060, -17241, -17412, -17578,
-    -17737, -17886, -18028, -18159, -18286, -18395, -18481, -18560, -18639, -18721, -18797, -18875,
-    -18950, -19003, -19059, -19094, -19099, -19121, -19157, -19190, -19210, -19221, -19237, -19255,
-    -19282, -19290, -19269, -19263, -19274, -19280, -19286, -19283, -19275, -19269, -19260, -19246,
-    -19223, -19194, -19172, -19160, -19149, -19132, -19104, -19073, -19046, -19009, -18972, -18931,
-    -18873, -18800, -18714, -18610, -18499, -18389, -18269, -18129, -17995, -17857, -17708, -17558,
-    -17380, -17182, -16998, -16825, -16649, -16462, -16275, -16095, -15922, -15760, -15567, -15355,
-    -15169, -15000, -14827, -14641, -14449, -14259, -14065, -13872, -13679, -13481, -13286, -13105,
-    -12929, -12752, -12570, -12372, -12184, -12019, -11850, -11675, -11480, -11279, -11079, -10858,
-    -10632, -10412, -10193, -9974, -9759, -9549, -9323, -9109, -8892, -8639, -8389, -8158,
-    -7935, -7715, -7495, -7281, -7067, -6872, -6678, -6448, -6219, -6013, -5806, -5556,
-    -5255, -4949, -4640, -4325, -4024, -3739, -3454, -3177, -2921, -2657, -2392, -2141,
-    -1886, -1646, -1418, -1202, -992, -772, -566, -363, -153, 48, 250, 441,
-    623, 793, 964, 1137, 1286, 1460, 1657, 1819, 1971, 2116, 2252, 2384,
-    2512, 2629, 2725, 2843, 2986, 3107, 3206, 3305, 3412, 3526, 3646, 3767,
-    3883, 4001, 4118, 4242, 4361, 4473, 4590, 4698, 4806, 4922, 5034, 5134,
-    5217, 5310, 5405, 5482, 5569, 5667, 5763, 5858, 5954, 6052, 6142, 6247,
-    6347, 6437, 6570, 6696, 6780, 6867, 6954, 7039, 7125, 7212, 7288, 7357,
-    7455, 7562, 7645, 7729, 7819, 7910, 8006, 8117, 8239, 8355, 8467, 8583,
-    8703, 8822, 8942, 9077, 9224, 9377, 9529, 9689, 9851, 10015, 10209, 10411,
-    10613, 10842, 11081, 11322, 11557, 11789, 12019, 12251, 12510, 12756, 13002, 13286,
-    13550, 13779, 14004, 14228, 14454, 14674, 14892, 15087, 15276, 15488, 15687, 15864,
-    16029, 16186, 16352, 16520, 16691, 16860, 17015, 17170, 17320, 17455, 17579, 17699,
-    17810, 17921, 18039, 18140, 18230, 18306, 18383, 18483, 18571, 18659, 18756, 18831,
-    18893, 18942, 18977, 19006, 19051, 19095, 19114, 19162, 19219, 19228, 19216, 19191,
-    19163, 19122, 19064, 18994, 18884, 18780, 18690, 18560, 18411, 18258, 18111, 17969,
-    17822, 17665, 17487, 17295, 17091, 16869, 16634, 16392, 16156, 15905, 15648, 15390,
-    15118, 14850, 14583, 14330, 14073, 13793, 13533, 13284, 13019, 12741, 12461, 12172,
-    11876, 11611, 11344, 11077, 10846, 10586, 10301, 10016, 9722, 9443, 9164, 8881,
-    8583, 8280, 8013, 7739, 7444, 7150, 6855, 6560, 6266, 5944, 5533, 5071,
-    4627, 4188, 3746, 3299, 2857, 2425, 1993, 1573, 1156, 743, 333, -69,
-    -452, -831, -1204, -1568, -1931, -2296, -2667, -3015, -3354, -3684, -3997, -4326,
-    -4608, -4838, -5073, -5302, -5527, -5753, -5976, -6189, -6414, -6653, -6859, -7055,
-    -7273, -7506, -7740, -7948, -8147, -8342, -8527, -8720, -8902, -9067, -9239, -9409,
-    -9548, -9680, -9835, -9978, -10118, -10261, -10384, -10506, -10629, -10737, -10835, -10930,
-    -11023, -11110, -11199, -11276, -11354, -11435, -11487, -11541, -11606, -11657, -11711, -11787,
-    -11879, -11964, -12044, -12122, -12192, -12275, -12366, -12437, -12490, -12552, -12632, -12702,
-    -12765, -12837, -12907, -12977, -13051, -13137, -13267, -13474, -13753, -14109, -14551, -15057,
-    -15616, -16216, -16823, -17453, -18080, -18570, -18872, -19078, -19218, -19249, -19183, -19038,
-    -18814, -18542, -18236, -17907, -17591, -17285, -16960, -16648, -16371, -16117, -15878, -15641,
-    -15393, -15154, -14931, -14704, -14462, -14216, -13991, -13782, -13569, -13358, -13150, -12931,
-    -12703, -12475, -12242, -12002, -11767, -11533, -11308, -11089, -10865, -10644, -10425, -10196,
-    -9971, -9750, -9527, -9302, -9062, -8804, -8546, -8284, -8021, -7770, -7510, -7233,
-    -6971, -6719, -6454, -6184, -5932, -5705, -5485, -5250, -5015, -4780, -4533, -4295,
-    -4058, -3801, -3560, -3347, -3138, -2948, -2760, -2523, -2283, -2080, -1855, -1594,
-    -1348, -1114, -873, -640, -414, -191, 23, 231, 449, 677, 907, 1144,
-    1391, 1627, 1860, 2108, 2345, 2562, 2800, 3077, 3379, 3699, 4038, 4401,
-    4773, 5113, 5422, 5724, 6017, 6316, 6642, 6956, 7254, 7577, 7908, 8212,
-    8499, 8765, 9016, 9274, 9539, 9789, 10038, 10301, 10571, 10842, 11109, 11361,
-    11605, 11843, 12072, 12288, 12480, 12638, 12765, 12869, 12959, 13047, 13152, 13267,
-    13377, 13473, 13558, 13627, 13689, 13750, 13810, 13873, 13952, 14023, 14055, 14053,
-    14041, 14030, 14018, 14003, 13984, 13957, 13934, 13911, 13863, 13810, 13767, 13523,
-    12667, 10956, 8532, 5758, 3020, 634, -1224, -2527, -3310, -3648, -3660, -3458,
-    -3136, -2788, -2470, -2200, -1997, -1876, -1818, -1797, -1815, -1863, -1911, -1947,
-    -1970, -1990, -2011, -2041, -2062, -2057, -2056, -2081, -2113, -2134, -2147, -2155,
-    -2150, -2152, -2165, -2147, -2114, -2114, -2155, -2184, -2183, -2191, -2201, -2191,
-    -2161, -2114, -2070, -2032, -2011, -2001, -1990, -1990, -1991, -1995, -1992, -1970,
-    -1940, -1889, -1824, -1749, -1671, -1613, -1556, -1504, -1451, -1391, -1336, -1286,
-    -1252, -1204, -1152, -1137, -1129, -1111, -1082, -1053, -1022, -971, -930, -868,
-    -785, -728, -696, -682, -665, -650, -631, -590, -564, -541, -516, -493,
-    -479, -501, -526, -560, -618, -681, -746, -799, -853, -898, -938, -1002,
-    -1056, -1103, -1162, -1225, -1287, -1327, -1365, -1396, -1429, -1470, -1483, -1498,
-    -1524, -1539, -1545, -1532, -1506, -1470, -1447, -1423, -1365, -1315, -1288, -1257,
-    -1217, -1165, -1110, -1038, -959, -873, -767, -663, -560, -460, -364, -270,
-    -190, -109, -14, 93, 214, 348, 503, 650, 796, 966, 1138, 1304,
-    1478, 1663, 1853, 2049, 2246, 2428, 2629, 2869, 3090, 3284, 3500, 3701,
-    3667, 3105, 1866, 57, -2036, -4151, -6112, -7748, -8956, -9737, -10123, -10152,
-    -9893, -9443, -8870, -8234, -7601, -6999, -6448, -5965, -5545, -5183, -4872, -4605,
-    -4360, -4123, -3889, -3659, -3437, -3213, -2979, -2747, -2516, -2277, -2030, -1773,
-    -1511, -1258, -1008, -736, -456, -203, 43, 301, 550, 796, 1058, 1312,
-    1544, 1788, 2039, 2253, 2439, 2631, 2826, 3032, 3264, 3500, 3729, 3969,
-    4201, 4398, 4573, 4739, 4888, 5035, 5189, 5334, 5476, 5636, 5800, 5954,
-    6094, 6223, 6347, 6463, 6563, 6657, 6757, 6859, 6970, 7087, 7182, 7272,
-    7391, 7504, 7577, 7647, 7724, 7793, 7876, 7967, 8036, 8113, 8216, 8301,
-    8350, 8392, 8427, 8453, 8488, 8526, 8557, 8599, 8651, 8691, 8715, 8723,
-    8712, 8687, 8650, 8612, 8577, 8541, 8512, 8492, 8459, 8412, 8374, 8339,
-    8301, 8265, 8231, 8196, 8165, 8135, 8095, 8063, 8047, 8038, 8024, 7998,
-    7957, 7918, 7893, 7881, 7871, 7853, 7831, 7819, 7799, 7756, 7709, 7674,
-    7640, 7607, 7575, 7540, 7506, 7476, 7451, 7430, 7396, 7337, 7269, 7202,
-    7127, 7055, 6992, 6920, 6852, 6786, 6712, 6650, 6616, 6581, 6529, 6469,
-    6323, 5928, 5101, 3724, 1896, -169, -2317, -4420, -6318, -7907, -9170, -10089,
-    -10687, -11039, -11164, -11094, -10914, -10677, -10420, -10171, -9940, -9727, -9552, -9417,
-    -9296, -9215, -9185, -9162, -9158, -9200, -9260, -9318, -9384, -9456, -9506, -9549,
-    -9587, -9603, -9623, -9646, -9646, -9633, -9627, -9624, -9608, -9597, -9595, -9587,
-    -9593, -9585, -9535, -9483, -9452, -9419, -9375, -9334, -9284, -9212, -9153, -9092,
-    -9008, -8944, -8905, -8866, -8816, -8757, -8681, -8585, -8493, -8394, -8284, -8190,
-    -8099, -8019, -7955, -7896, -7848, -7802, -7758, -7699, -7632, -7573, -7503, -7434,
-    -7354, -7261, -7185, -7112, -7037, -6951, -6858, -6768, -6678, -6591, -6479, -6347,
-    -6235, -6118, -5998, -5878, -5751, -5616, -5479, -5360, -5222, -5068, -4937, -4816,
-    -4704, -4593, -4482, -4368, -4241, -4109, -3959, -3801, -3648, -3495, -3357, -3225,
-    -3104, -2995, -2877, -2750, -2617, -2483, -2339, -2189, -2043, -1878, -1714, -1570,
-    -1426, -1275, -1123, -966, -785, -604, -431, -226, -9, 189, 376, 572,
-    775, 983, 1209, 1426, 1629, 1849, 2082, 2313, 2529, 2741, 2965, 3197,
-    3434, 3669, 3914, 4169, 4415, 4656, 4889, 5105, 5314, 5512, 5708, 5905,
-    6099, 6205, 6071, 5567, 4632, 3326, 1780, 120, -1532, -3073, -4422, -5526,
-    -6362, -6935, -7283, -7405, -7308, -7067, -6731, -6313, -5831, -5326, -4821, -4328,
-    -3873, -3445, -3025, -2650, -2335, -2061, -1807, -1568, -1336, -1098, -865, -643,
-    -430, -236, -48, 137, 314, 488, 657, 828, 998, 1178, 1366, 1546,
-    1729, 1900, 2065, 2240, 2405, 2565, 2727, 2902, 3088, 3278, 3476, 3662,
-    3864, 4090, 4286, 4460, 4634, 4809, 4979, 5152, 5329, 5488, 5665, 5864,
-    6032, 6183, 6329, 6471, 6612, 6758, 6912, 7054, 7202, 7344, 7461, 7574,
-    7665, 7744, 7818, 7882, 7934, 7980, 8041, 8100, 8158, 8224, 8271, 8313,
-    8351, 8371, 8386, 8401, 8420, 8439, 8468, 8499, 8526, 8586, 8651, 8681,
-    8704, 8725, 8739, 8752, 8773, 8782, 8777, 8798, 8821, 8813, 8797, 8781,
-    8764, 8755, 8752, 8743, 8732, 8723, 8701, 8667, 8628, 8578, 8522, 8472,
-    8414, 8344, 8289, 8240, 8184, 8132, 8069, 8000, 7933, 7866, 7790, 7711,
-    7648, 7587, 7521, 7470, 7416, 7378, 7374, 7358, 7326, 7298, 7271, 7247,
-    7224, 7216, 7204, 7192, 7204, 7196, 7171, 7151, 7109, 7067, 7038, 7001,
-    6959, 6887, 6714, 6314, 5587, 4519, 3127, 1515, -194, -1955, -3675, -5258,
-    -6675, -7897, -8925, -9758, -10382, -10815, -11079, -11212, -11237, -11161, -11037, -10867,
-    -10667, -10489, -10289, -10071, -9900, -9764, -9641, -9533, -9448, -9369, -9289, -9253,
-    -9220, -9159, -9136, -9137, -9124, -9115, -9109, -9099, -9084, -9074, -9063, -9048,
-    -9049, -9058, -9072, -9093, -9113, -9132, -9154, -9161, -9149, -9150, -9147, -9129,
-    -9125, -9116, -9099, -9084, -9067, -9032, -8978, -8933, -8883, -8829, -8787, -8716,
-    -8640, -8588, -8532, -8458, -8372, -8281, -8171, -8069, -7973, -7837, -7702, -7590,
-    -7470, -7340, -7221, -7114, -6988, -6867, -6751, -6614, -6495, -6392, -6296, -6207,
-    -6121, -6042, -5953, -5868, -5784, -5689, -5602, -5512, -5427, -5345, -5247, -5152,
-    -5057, -4958, -4854, -4742, -4640, -4535, -4434, -4318, -4177, -4041, -3912, -3781,
-    -3646, -3507, -3357, -3199, -3053, -2898, -2720, -2548, -2387, -2227, -2065, -1902,
-    -1725, -1540, -1366, -1180, -980, -792, -611, -432, -253, -83, 76, 239,
-    399, 572, 756, 930, 1108, 1288, 1467, 1653, 1841, 2036, 2229, 2433,
-    2648, 2855, 3062, 3260, 3479, 3735, 3971, 4198, 4431, 4666, 4911, 5156,
-    5400, 5635, 5855, 5977, 5866, 5494, 4848, 3941, 2853, 1637, 366, -895,
-    -2095, -3185, -4149, -4956, -5598, -6080, -6399, -6569, -6602, -6513, -6323, -6060,
-    -5741, -5376, -4993, -4593, -4184, -3785, -3407, -3049, -2699, -2383, -2090, -1801,
-    -1534, -1249, -977, -747, -516, -290, -64, 166, 399, 625, 837, 1083,
-    1325, 1536, 1753, 1966, 2185, 2410, 2625, 2841, 3054, 3262, 3461, 3648,
-    3824, 3990, 4153, 4306, 4458, 4605, 4752, 4908, 5058, 5203, 5339, 5472,
-    5602, 5718, 5824, 5911, 6008, 6114, 6209, 6322, 6427, 6543, 6692, 6824,
-    6937, 7040, 7146, 7257, 7368, 7486, 7592, 7714, 7848, 7956, 8066, 8172,
-    8274, 8367, 8446, 8540, 8630, 8696, 8752, 8798, 8833, 8850, 8859, 8863,
-    8865, 8859, 8851, 8857, 8855, 8850, 8844, 8829, 8817, 8791, 8762, 8731,
-    8683, 8652, 8616, 8586, 8573, 8534, 8517, 8525, 8505, 8472, 8439, 8408,
-    8380, 8360, 8338, 8306, 8293, 8295, 8287, 8273, 8254, 8232, 8209, 8177,
-    8142, 8109, 8075, 8030, 7970, 7904, 7836, 7778, 7731, 7680, 7627, 7574,
-    7527, 7495, 7452, 7384, 7321, 7262, 7189, 7106, 7010, 6919, 6844, 6771,
-    6702, 6634, 6564, 6486, 6301, 5912, 5302, 4471, 3442, 2247, 930, -455,
-    -1857, -3212, -4499, -5707, -6786, -7729, -8547, -9221, -9759, -10173, -10473, -10677,
-    -10814, -10893, -10905, -10864, -10784, -10674, -10547, -10404, -10257, -10115, -9972, -9847,
-    -9737, -9635, -9551, -9483, -9434, -9403, -9381, -9363, -9339, -9331, -9338, -9321,
-    -9288, -9271, -9262, -9254, -9250, -9239, -9214, -9198, -9202, -9183, -9126, -9074,
-    -9033, -8982, -8929, -8874, -8809, -8744, -8689, -8634, -8587, -8554, -8524, -8495,
-    -8469, -8433, -8390, -8353, -8311, -8255, -8197, -8143, -8094, -8049, -8002, -7949,
-    -7898, -7846, -7787, -7720, -7638, -7540, -7449, -7357, -7232, -7089, -6968, -6852,
-    -6723, -6598, -6474, -6346, -6230, -6115, -5974, -5825, -5696, -5572, -5444, -5317,
-    -5190, -5063, -4948, -4831, -4707, -4597, -4500, -4400, -4290, -4174, -4050, -3925,
-    -3800, -3671, -3543, -3417, -3290, -3171, -3060, -2939, -2813, -2691, -2562, -2422,
-    -2275, -2113, -1938, -1762, -1572, -1355, -1132, -923, -715, -508, -302, -91,
-    114, 305, 504, 724, 946, 1154, 1355, 1561, 1777, 1996, 2205, 2402,
-    2595, 2783, 2960, 3131, 3300, 3477, 3666, 3860, 4053, 4254, 4467, 4683,
-    4895, 5100, 5298, 5481, 5614, 5637, 5497, 5179, 4689, 4038, 3246, 2343,
-    1379, 402, -559, -1494, -2389, -3212, -3931, -4537, -5038, -5434, -5711, -5866,
-    -5911, -5869, -5756, -5576, -5327, -5026, -4696, -4343, -3970, -3588, -3207, -2837,
-    -2481, -2133, -1791, -1460, -1147, -848, -560, -289, -36, 200, 420, 627,
-    824, 1014, 1196, 1370, 1546, 1726, 1905, 2082, 2257, 2433, 2624, 2832,
-    3035, 3224, 3416, 3614, 3809, 3998, 4182, 4361, 4553, 4758, 4949, 5124,
-    5300, 5477, 5641, 5795, 5942, 6076, 6203, 6321, 6425, 6522, 6629, 6737,
-    6838, 6939, 7043, 7145, 7241, 7330, 7410, 7483, 7551, 7616, 7678, 7739,
-    7801, 7868, 7934, 8003, 8075, 8143, 8212, 8296, 8387, 8461, 8524, 8583,
-    8632, 8672, 8709, 8735, 8762, 8809, 8858, 8888, 8912, 8940, 8963, 8981,
-    8990, 8984, 8972, 8962, 8943, 8908, 8872, 8839, 8807, 8778, 8748, 8716,
-    8686, 8651, 8611, 8566, 8515, 8462, 8418, 8373, 8318, 8263, 8210, 8155,
-    8110, 8069, 8020, 7980, 7966, 7948, 7917, 7885, 7849, 7802, 7759, 7710,
-    7648, 7604, 7585, 7558, 7525, 7501, 7475, 7442, 7406, 7357, 7295, 7236,
-    7171, 7087, 6996, 6905, 6792, 6627, 6364, 5966, 5418, 4717, 3867, 2887,
-    1804, 641, -562, -1772, -2974, -4143, -5248, -6274, -7208, -8035, -8765, -9400,
-    -9916, -10317, -10639, -10888, -11064, -11184, -11249, -11263, -11247, -11199, -11097, -10957,
-    -10810, -10657, -10495, -10339, -10191, -10053, -9936, -9835, -9738, -9656, -9599, -9553,
-    -9511, -9475, -9442, -9409, -9382, -9358, -9338, -9326, -9322, -9328, -9340, -9353,
-    -9365, -9383, -9397, -9400, -9398, -9388, -9370, -9352, -9322, -9261, -9191, -9134,
-    -9082, -9029, -8985, -8939, -8893, -8857, -8805, -8718, -8621, -8531, -8435, -8338,
-    -8250, -8161, -8073, -7997, -7918, -7834, -7761, -7694, -7619, -7540, -7454, -7355,
-    -7250, -7141, -7026, -6913, -6806, -6704, -6609, -6515, -6411, -6308, -6209, -6100,
-    -5981, -5855, -5718, -5576, -5440, -5283, -5104, -4933, -4778, -4624, -4480, -4344,
-    -4201, -4063, -3928, -3765, -3577, -3395, -3214, -3027, -2852, -2689, -2525, -2372,
-    -2230, -2083, -1939, -1804, -1663, -1510, -1351, -1181, -998, -808, -615, -424,
-    -239, -60, 112, 273, 438, 609, 777, 945, 1122, 1307, 1506, 1719,
-    1928, 2137, 2377, 2636, 2880, 3111, 3338, 3550, 3756, 3967, 4167, 4373,
-    4614, 4864, 5096, 5328, 5558, 5748, 5871, 5902, 5804, 5569, 5211, 4719,
-    4104, 3404, 2643, 1832, 1000, 176, -624, -1387, -2105, -2768, -3367, -3901,
-    -4362, -4737, -5030, -5245, -5376, -5428, -5411, -5320, -5161, -4962, -4720, -4414,
-    -4076, -3739, -3395, -3046, -2702, -2350, -1988, -1640, -1288, -913, -543, -200,
-    133, 454, 746, 1017, 1269, 1497, 1712, 1923, 2111, 2276, 2441, 2611,
-    2783, 2958, 3136, 3311, 3483, 3651, 3807, 3952, 4089, 4226, 4367, 4503,
-    4634, 4768, 4908, 5055, 5210, 5363, 5510, 5666, 5835, 5994, 6132, 6264,
-    6389, 6510, 6636, 6755, 6868, 6998, 7143, 7284, 7418, 7548, 7666, 7772,
-    7867, 7949, 8018, 8082, 8133, 8167, 8197, 8232, 8275, 8327, 8383, 8438,
-    8493, 8543, 8581, 8610, 8628, 8632, 8638, 8648, 8653, 8655, 8665, 8681,
-    8701, 8730, 8752, 8767, 8797, 8835, 8856, 8864, 8871, 8870, 8865, 8860,
-    8846, 8832, 8838, 8854, 8858, 8855, 8850, 8836, 8812, 8781, 8739, 8686,
-    8627, 8560, 8487, 8415, 8349, 8292, 8243, 8197, 8154, 8110, 8059, 8001,
-    7935, 7855, 7768, 7693, 7622, 7545, 7473, 7409, 7348, 7294, 7241, 7172,
-    7107, 7066, 7023, 6964, 6899, 6823, 6710, 6540, 6290, 5935, 5484, 4943,
-    4297, 3544, 2713, 1814, 854, -147, -1167, -2185, -3186, -4163, -5106, -5992,
-    -6816, -7574, -8256, -8861, -9392, -9848, -10239, -10577, -10859, -11085, -11268, -11404,
-    -11487, -11533, -11546, -11519, -11463, -11382, -11275, -11164, -11059, -10931, -10776, -10632,
-    -10505, -10376, -10260, -10156, -10053, -9961, -9884, -9796, -9694, -9607, -9533, -9458,
-    -9392, -9341, -9303, -9278, -9264, -9251, -9246, -9249, -9248, -9240, -9227, -9200,
-    -9164, -9128, -9087, -9041, -9002, -8970, -8938, -8912, -8882, -8842, -8804, -8764,
-    -8712, -8651, -8587, -8513, -8444, -8375, -8280, -8167, -8072, -7987, -7894, -7809,
-    -7728, -7636, -7544, -7454, -7336, -7199, -7070, -6933, -6784, -6643, -6513, -6386,
-    -6268, -6156, -6042, -5934, -5832, -5718, -5595, -5468, -5330, -5182, -5032, -4878,
-    -4724, -4577, -4438, -4305, -4174, -4038, -3893, -3749, -3603, -3452, -3295, -3126,
-    -2953, -2787, -2618, -2425, -2229, -2051, -1880, -1707, -1536, -1356, -1173, -998,
-    -816, -609, -395, -186, 24, 231, 430, 624, 816, 1003, 1194, 1387,
-    1573, 1759, 1952, 2151, 2357, 2574, 2800, 3030, 3259, 3480, 3690, 3891,
-    4086, 4283, 4484, 4683, 4878, 5072, 5253, 5405, 5509, 5535, 5471, 5328,
-    5102, 4771, 4343, 3837, 3266, 2647, 1998, 1323, 638, -21, -642, -1236,
-    -1796, -2314, -2791, -3222, -3594, -3908, -4167, -4366, -4509, -4602, -4642, -4632,
-    -4573, -4461, -4297, -4096, -3864, -3611, -3343, -3063, -2775, -2484, -2181, -1871,
-    -1561, -1250, -933, -611, -284, 41, 346, 640, 945, 1251, 1532, 1791,
-    2037, 2270, 2497, 2720, 2926, 3127, 3346, 3571, 3781, 3977, 4163, 4337,
-    4503, 4664, 4816, 4963, 5106, 5239, 5364, 5486, 5603, 5723, 5850, 5979,
-    6107, 6234, 6349, 6451, 6546, 6633, 6712, 6797, 6883, 6965, 7047, 7134,
-    7221, 7313, 7403, 7479, 7560, 7661, 7761, 7841, 7912, 7975, 8031, 8089,
-    8146, 8190, 8242, 8314, 8388, 8452, 8513, 8567, 8614, 8662, 8707, 8743,
-    8776, 8798, 8807, 8813, 8817, 8816, 8824, 8843, 8861, 8881, 8897, 8898,
-    8886, 8868, 8837, 8798, 8766, 8732, 8693, 8659, 8629, 8601, 8577, 8548,
-    8506, 8476, 8460, 8433, 8391, 8348, 8299, 8249, 8206, 8158, 8103, 8063,
-    8038, 8008, 7973, 7935, 7892, 7851, 7813, 7773, 7730, 7683, 7623, 7556,
-    7492, 7425, 7360, 7309, 7261, 7208, 7148, 7064, 6927, 6732, 6468, 6119,
-    5690, 5186, 4596, 3925, 3193, 2408, 1579, 719, -176, -1084, -1973, -2843,
-    -3710, -4558, -5372, -6145, -6864, -7528, -8149, -8711, -9197, -9621, -10001, -10332,
-    -10615, -10853, -11044, -11197, -11322, -11410, -11469, -11510, -11524, -11511, -11480, -11423,
-    -11339, -11246, -11148, -11043, -10949, -10869, -10789, -10714, -10645, -10569, -10490, -10418,
-    -10348, -10272, -10193, -10111, -10033, -9968, -9901, -9820, -9748, -9697, -9657, -9626,
-    -9598, -9565, -9539, -9523, -9494, -9444, -9386, -9324, -9259, -9199, -9141, -9080,
-    -9022, -8962, -8891, -8822, -8756, -8683, -8603, -8518, -8419, -8316, -8221, -8128,
-    -8035, -7951, -7875, -7796, -7719, -7639, -7551, -7461, -7372, -7274, -7168, -7059,
-    -6945, -6829, -6708, -6574, -6434, -6299, -6162, -6014, -5864, -5713, -5560, -5407,
-    -5248, -5072, -4886, -4702, -4513, -4321, -4133, -3947, -3763, -3586, -3408, -3230,
-    -3060, -2896, -2728, -2558, -2381, -2197, -2016, -1841, -1664, -1492, -1331, -1174,
-    -1015, -855, -690, -521, -352, -180, -4, 168, 343, 525, 713, 902,
-    1093, 1287, 1486, 1696, 1909, 2116, 2330, 2555, 2785, 3019, 3254, 3485,
-    3716, 3954, 4191, 4423, 4654, 4884, 5111, 5333, 5534, 5696, 5808, 5861,
-    5847, 5764, 5609, 5378, 5072, 4698, 4258, 3758, 3216, 2642, 2051, 1460,
-    876, 300, -262, -803, -1312, -1776, -2196, -2577, -2913, -3196, -3426, -3607,
-    -3745, -3838, -3879, -3869, -3815, -3728, -3610, -3461, -3281, -3074, -2844, -2597,
-    -2336, -2064, -1782, -1490, -1192, -890, -590, -294, -3, 287, 578, 871,
-    1163, 1446, 1714, 1961, 2190, 2411, 2629, 2849, 3068, 3279, 3482, 3674,
-    3861, 4037, 4196, 4333, 4452, 4560, 4662, 4760, 4855, 4956, 5069, 5195,
-    5326, 5457, 5587, 5720, 5857, 5997, 6139, 6280, 6416, 6545, 6667, 6786,
-    6903, 7017, 7120, 7207, 7280, 7345, 7411, 7479, 7552, 7623, 7684, 7733,
-    7770, 7802, 7838, 7878, 7919, 7956, 7989, 8020, 8054, 8088, 8119, 8150,
-    8185, 8222, 8257, 8289, 8323, 8364, 8411, 8460, 8501, 8535, 8561, 8585,
-    8605, 8624, 8640, 8655, 8667, 8676, 8678, 8676, 8671, 8663, 8649, 8620,
-    8577, 8526, 8475, 8428, 8384, 8339, 8289, 8231, 8166, 8094, 8021, 7948,
-    7875, 7801, 7727, 7654, 7581, 7507, 7434, 7368, 7309, 7250, 7188, 7125,
-    7067, 7020, 6978, 6935, 6891, 6849, 6811, 6773, 6725, 6659, 6563, 6428,
-    6241, 5995, 5680, 5293, 4839, 4320, 3738, 3093, 2390, 1645, 872, 84,
-    -713, -1512, -2306, -3092, -3865, -4620, -5350, -6050, -6712, -7333, -7910, -8444,
-    -8938, -9395, -9808, -10170, -10481, -10750, -10982, -11177, -11330, -11445, -11527, -11582,
-    -11608, -11603, -11571, -11517, -11445, -11360, -11265, -11160, -11047, -10924, -10797, -10669,
-    -10544, -10421, -10303, -10191, -10092, -10004, -9926, -9854, -9786, -9719, -9653, -9588,
-    -9528, -9480, -9442, -9414, -9394, -9376, -9360, -9348, -9345, -9346, -9346, -9338,
-    -9324, -9305, -9282, -9247, -9201, -9151, -9100, -9045, -8979, -8897, -8800, -8694,
-    -8583, -8469, -8355, -8236, -8114, -7988, -7858, -7729, -7600, -7470, -7343, -7217,
-    -7096, -6981, -6873, -6769, -6666, -6559, -6449, -6333, -6214, -6098, -5985, -5878,
-    -5767, -5649, -5524, -5396, -5267, -5133, -4993, -4847, -4698, -4546, -4384, -4210,
-    -4028, -3845, -3663, -3480, -3291, -3089, -2874, -2652, -2428, -2208, -1995, -1787,
-    -1581, -1377, -1170, -961, -755, -555, -362, -172, 14, 197, 373, 542,
-    707, 877, 1053, 1234, 1418, 1599, 1773, 1943, 2114, 2290, 2467, 2646,
-    2828, 3018, 3217, 3417, 3618, 3828, 4052, 4285, 4516, 4732, 4926, 5094,
-    5229, 5329, 5388, 5397, 5348, 5233, 5053, 4812, 4516, 4174, 3794, 3384,
-    2951, 2496, 2026, 1548, 1071, 600, 136, -318, -753, -1163, -1541, -1884,
-    -2193, -2470, -2714, -2923, -3095, -3230, -3331, -3401, -3433, -3427, -3387, -3321,
-    -3226, -3097, -2932, -2739, -2529, -2306, -2069, -1816, -1545, -1254, -947, -626,
-    -298, 30, 356, 674, 984, 1284, 1578, 1867, 2150, 2423, 2684, 2934,
-    3176, 3408, 3630, 3835, 4022, 4193, 4357, 4513, 4660, 4794, 4919, 5038,
-    5152, 5257, 5353, 5444, 5536, 5630, 5723, 5812, 5902, 5996, 6098, 6201,
-    6301, 6397, 6490, 6587, 6690, 6801, 6920, 7047, 7180, 7314, 7443, 7563,
-    7672, 7774, 7868, 7958, 8045, 8130, 8210, 8281, 8344, 8402, 8456, 8501,
-    8533, 8553, 8568, 8579, 8587, 8591, 8595, 8600, 8600, 8588, 8566, 8541,
-    8517, 8495, 8472, 8451, 8435, 8427, 8422, 8413, 8398, 8377, 8355, 8336,
-    8323, 8317, 8318, 8324, 8337, 8353, 8367, 8374, 8373, 8366, 8353, 8334,
-    8312, 8289, 8265, 8236, 8204, 8170, 8136, 8095, 8042, 7978, 7910, 7839,
-    7763, 7686, 7610, 7535, 7454, 7364, 7268, 7172, 7076, 6974, 6863, 6741,
-    6605, 6440, 6234, 5977, 5668, 5308, 4896, 4438, 3939, 3405, 2838, 2243,
-    1623, 985, 331, -337, -1015, -1699, -2382, -3060, -3726, -4374, -5002, -5606,
-    -6185, -6735, -7256, -7750, -8217, -8657, -9068, -9449, -9802, -10120, -10402, -10650,
-    -10873, -11074, -11253, -11407, -11542, -11655, -11740, -11793, -11813, -11810, -11794, -11769,
-    -11731, -11680, -11616, -11539, -11449, -11346, -11233, -11114, -10988, -10855, -10716, -10575,
-    -10435, -10303, -10179, -10063, -9951, -9843, -9739, -9639, -9544, -9454, -9371, -9293,
-    -9221, -9155, -9099, -9053, -9011, -8964, -8913, -8864, -8819, -8776, -8735, -8697,
-    -8665, -8635, -8595, -8538, -8466, -8390, -8313, -8234, -8152, -8061, -7962, -7856,
-    -7743, -7624, -7501, -7372, -7239, -7101, -6957, -6806, -6655, -6509, -6371, -6237,
-    -6104, -5973, -5843, -5711, -5577, -5441, -5303, -5162, -5017, -4873, -4738, -4614,
-    -4491, -4363, -4229, -4094, -3958, -3818, -3675, -3536, -3402, -3263, -3113, -2947,
-    -2771, -2591, -2408, -2223, -2036, -1843, -1642, -1435, -1222, -1006, -785, -560,
-    -331, -100, 137, 379, 624, 866, 1102, 1333, 1560, 1781, 1998, 2215,
-    2434, 2654, 2871, 3089, 3306, 3519, 3722, 3915, 4103, 4287, 4465, 4632,
-    4781, 4907, 4998, 5043, 5041, 4996, 4913, 4792, 4630, 4429, 4193, 3923,
-    3622, 3295, 2950, 2590, 2218, 1838, 1456, 1078, 702, 332, -25, -362,
-    -678, -974, -1250, -1506, -1741, -1958, -2153, -2322, -2460, -2568, -2644, -2692,
-    -2713, -2710, -2687, -2643, -2583, -2506, -2413, -2302, -2168, -2016, -1852, -1679,
-    -1495, -1295, -1080, -851, -609, -358, -98, 169, 440, 715, 992, 1270,
-    1550, 1832, 2114, 2392, 2663, 2927, 3186, 3441, 3692, 3937, 4176, 4406,
-    4623, 4827, 5018, 5198, 5371, 5542, 5711, 5875, 6030, 6172, 6307, 6434,
-    6550, 6653, 6743, 6826, 6908, 6985, 7056, 7121, 7184, 7247, 7311, 7374,
-    7436, 7500, 7567, 7638, 7713, 7789, 7862, 7933, 8005, 8077, 8148, 8215,
-    8278, 8336, 8390, 8439, 8486, 8535, 8586, 8634, 8674, 8705, 8727, 8737,
-    8739, 8740, 8745, 8752, 8756, 8753, 8749, 8744, 8736, 8719, 8692, 8663,
-    8630, 8595, 8557, 8518, 8483, 8450, 8419, 8388, 8358, 8331, 8310, 8293,
-    8280, 8267, 8252, 8234, 8216, 8197, 8179, 8158, 8134, 8106, 8073, 8034,
-    7996, 7962, 7934, 7904, 7867, 7820, 7762, 7694, 7619, 7540, 7460, 7377,
-    7282, 7170, 7036, 6872, 6668, 6417, 6114, 5763, 5366, 4925, 4443, 3928,
-    3388, 2822, 2229, 1611, 976, 331, -313, -953, -1586, -2211, -2831, -3442,
-    -4042, -4628, -5195, -5741, -6262, -6761, -7238, -7691, -8119, -8516, -8878, -9208,
-    -9512, -9793, -10056, -10299, -10522, -10728, -10913, -11075, -11209, -11315, -11398, -11464,
-    -11519, -11563, -11598, -11623, -11639, -11644, -11636, -11610, -11566, -11506, -11443, -11375,
-    -11303, -11218, -11120, -11010, -10894, -10774, -10652, -10531, -10414, -10299, -10187, -10075,
-    -9966, -9859, -9755, -9654, -9556, -9459, -9359, -9256, -9153, -9058, -8973, -8894,
-    -8819, -8751, -8690, -8630, -8564, -8486, -8400, -8313, -8230, -8149, -8072, -7998,
-    -7929, -7864, -7795, -7715, -7622, -7520, -7416, -7315, -7213, -7103, -6982, -6850,
-    -6710, -6563, -6411, -6258, -6108, -5959, -5809, -5657, -5506, -5356, -5205, -5053,
-    -4901, -4750, -4597, -4437, -4272, -4109, -3949, -3794, -3641, -3494, -3352, -3214,
-    -3067, -2907, -2739, -2569, -2401, -2234, -2067, -1904, -1747, -1593, -1433, -1261,
-    -1077, -887, -695, -504, -310, -108, 103, 321, 546, 776, 1010, 1246,
-    1481, 1715, 1948, 2181, 2412, 2643, 2873, 3102, 3329, 3554, 3776, 3996,
-    4211, 4413, 4594, 4747, 4869, 4950, 4985, 4974, 4926, 4848, 4741, 4598,
-    4417, 4200, 3950, 3669, 3360, 3030, 2686, 2335, 1981, 1625, 1270, 920,
-    574, 237, -87, -390, -670, -929, -1167, -1382, -1575, -1746, -1897, -2028,
-    -2137, -2222, -2282, -2316, -2327, -2319, -2293, -2250, -2185, -2098, -1989, -1865,
-    -1731, -1591, -1444, -1289, -1121, -936, -734, -517, -291, -60, 172, 401,
-    628, 854, 1081, 1310, 1539, 1769, 2003, 2239, 2474, 2704, 2928, 3149,
-    3369, 3590, 3808, 4021, 4231, 4436, 4633, 4822, 5002, 5174, 5337, 5495,
-    5649, 5797, 5937, 6069, 6195, 6320, 6443, 6562, 6669, 6764, 6848, 6923,
-    6993, 7060, 7128, 7199, 7273, 7345, 7409, 7463, 7507, 7542, 7572, 7598,
-    7625, 7655, 7688, 7723, 7756, 7783, 7803, 7820, 7839, 7863, 7890, 7915,
-    7938, 7958, 7975, 7987, 7995, 7998, 7999, 7997, 7991, 7981, 7970, 7955,
-    7940, 7925, 7914, 7904, 7888, 7862, 7826, 7784, 7738, 7691, 7646, 7607,
-    7577, 7552, 7523, 7485, 7440, 7389, 7337, 7286, 7236, 7187, 7141, 7097,
-    7054, 7010, 6961, 6910, 6859, 6813, 6770, 6729, 6685, 6642, 6599, 6556,
-    6509, 6455, 6389, 6307, 6206, 6085, 5944, 5781, 5591, 5376, 5140, 4883,
-    4600, 4282, 3928, 3543, 3137, 2714, 2278, 1833, 1388, 944, 494, 31,
-    -444, -924, -1403, -1875, -2339, -2793, -3236, -3667, -4086, -4492, -4887, -5268,
-    -5633, -5980, -6305, -6610, -6898, -7170, -7424, -7658, -7872, -8071, -8257, -8430,
-    -8590, -8736, -8865, -8977, -9071, -9149, -9207, -9248, -9276, -9301, -9327, -9352,
-    -9371, -9380, -9378, -9362, -9331, -9283, -9226, -9166, -9109, -9053, -8995, -8934,
-    -8867, -8794, -8718, -8641, -8562, -8482, -8398, -8313, -8230, -8146, -8059, -7970,
-    -7880, -7789, -7696, -7599, -7498, -7398, -7303, -7212, -7126, -7041, -6955, -6864,
-    -6768, -6668, -6566, -6460, -6352, -6246, -6147, -6060, -5979, -5898, -5815, -5729,
-    -5638, -5541, -5435, -5325, -5218, -5116, -5019, -4922, -4821, -4715, -4608, -4500,
-    -4395, -4289, -4182, -4075, -3970, -3867, -3763, -3656, -3546, -3435, -3321, -3202,
-    -3082, -2962, -2847, -2737, -2630, -2523, -2413, -2299, -2177, -2049, -1917, -1784,
-    -1647, -1512, -1383, -1262, -1146, -1030, -912, -791, -667, -538, -400, -256,
-    -111, 32, 173, 314, 459, 608, 756, 902, 1047, 1191, 1339, 1488,
-    1636, 1781, 1923, 2063, 2198, 2326, 2444, 2553, 2649, 2729, 2789, 2827,
-    2844, 2843, 2824, 2791, 2747, 2691, 2622, 2541, 2448, 2346, 2230, 2101,
-    1957, 1804, 1645, 1481, 1316, 1151, 996, 850, 713, 579, 444, 310,
-    183, 64, -45, -149, -246, -337, -418, -491, -557, -617, -671, -713,
-    -741, -756, -760, -755, -742, -722, -695, -664, -629, -589, -543, -489,
-    -424, -348, -263, -174, -81, 17, 117, 217, 314, 409, 503, 599,
-    695, 794, 898, 1012, 1136, 1266, 1396, 1524, 1649, 1773, 1896, 2020,
-    2140, 2258, 2374, 2489, 2602, 2710, 2811, 2908, 3009, 3116, 3229, 3342,
-    3452, 3558, 3661, 3759, 3852, 3938, 4020, 4101, 4184, 4269, 4355, 4438,
-    4515, 4589, 4660, 4728, 4788, 4838, 4879, 4914, 4948, 4978, 5007, 5038,
-    5075, 5115, 5154, 5187, 5211, 5231, 5248, 5264, 5276, 5283, 5286, 5285,
-    5281, 5272, 5257, 5237, 5217, 5204, 5194, 5187, 5177, 5164, 5149, 5134,
-    5116, 5094, 5067, 5039, 5013, 4991, 4971, 4953, 4934, 4915, 4895, 4876,
-    4853, 4822, 4782, 4739, 4695, 4653, 4612, 4575, 4543, 4521, 4503, 4484,
-    4458, 4424, 4388, 4349, 4308, 4261, 4207, 4143, 4070, 3987, 3892, 3782,
-    3660, 3531, 3398, 3259, 3112, 2953, 2784, 2606, 2419, 2221, 2014, 1798,
-    1578, 1356, 1134, 910, 682, 451, 219, -13, -248, -487, -735, -988,
-    -1239, -1484, -1723, -1955, -2178, -2388, -2588, -2784, -2982, -3181, -3377, -3564,
-    -3743, -3914, -4082, -4245, -4403, -4556, -4703, -4843, -4977, -5102, -5214, -5313,
-    -5401, -5480, -5550, -5611, -5664, -5711, -5753, -5790, -5819, -5839, -5852, -5855,
-    -5851, -5839, -5824, -5805, -5783, -5760, -5740, -5724, -5709, -5691, -5667, -5637,
-    -5601, -5558, -5508, -5454, -5404, -5362, -5325, -5289, -5249, -5203, -5157, -5111,
-    -5069, -5028, -4989, -4950, -4912, -4873, -4829, -4776, -4715, -4649, -4582, -4513,
-    -4442, -4368, -4293, -4216, -4137, -4056, -3971, -3882, -3788, -3692, -3594, -3498,
-    -3401, -3306, -3215, -3130, -3050, -2972, -2892, -2809, -2724, -2637, -2546, -2455,
-    -2366, -2285, -2213, -2144, -2072, -1998, -1924, -1855, -1790, -1730, -1672, -1616,
-    -1562, -1509, -1456, -1398, -1333, -1260, -1182, -1102, -1020, -937, -853, -768,
-    -682, -595, -506, -412, -313, -208, -102, 5, 110, 215, 320, 421,
-    515, 605, 697, 793, 891, 987, 1079, 1168, 1253, 1329, 1393, 1446,
-    1493, 1537, 1575, 1603, 1619, 1623, 1618, 1603, 1577, 1539, 1493, 1446,
-    1400, 1357, 1314, 1268, 1217, 1163, 1108, 1050, 988, 924, 860, 799,
-    739, 682, 628, 576, 529, 483, 439, 389, 334, 278, 227, 185,
-    150, 119, 90, 65, 44, 27, 9, -7, -21, -28, -30, -28,
-    -26, -24, -20, -16, -12, -9, -5, 3, 19, 45, 79, 119,
-    163, 208, 255, 302, 349, 396, 446, 500, 556, 611, 670, 732,
-    801, 872, 941, 1007, 1066, 1122, 1179, 1238, 1301, 1366, 1431, 1495,
-    1560, 1625, 1690, 1753, 1812, 1870, 1928, 1987, 2046, 2102, 2155, 2204,
-    2248, 2290, 2329, 2367, 2406, 2447, 2494, 2544, 2596, 2647, 2695, 2740,
-    2783, 2823, 2860, 2896, 2932, 2966, 3005, 3048, 3096, 3142, 3181, 3212,
-    3236, 3258, 3278, 3296, 3313, 3330, 3344, 3354, 3361, 3367, 3373, 3377,
-    3374, 3366, 3355, 3346, 3338, 3329, 3315, 3295, 3269, 3240, 3208, 3175,
-    3141, 3111, 3087, 3068, 3054, 3041, 3030, 3018, 3005, 2988, 2969, 2949,
-    2931, 2917, 2908, 2906, 2908, 2910, 2905, 2893, 2875, 2852, 2825, 2792,
-    2755, 2712, 2666, 2614, 2553, 2487, 2416, 2340, 2254, 2157, 2049, 1936,
-    1822, 1705, 1583, 1453, 1314, 1166, 1013, 854, 691, 528, 368, 213,
-    64, -81, -224, -367, -511, -657, -803, -948, -1091, -1227, -1354, -1470,
-    -1577, -1680, -1782, -1883, -1983, -2082, -2179, -2272, -2359, -2438, -2512, -2583,
-    -2653, -2719, -2780, -2838, -2895, -2957, -3020, -3080, -3132, -3176, -3217, -3257,
-    -3298, -3339, -3384, -3435, -3489, -3540, -3580, -3608, -3628, -3644, -3658, -3668,
-    -3678, -3686, -3698, -3712, -3723, -3724, -3715, -3700, -3681, -3659, -3632, -3603,
-    -3574, -3548, -3525, -3501, -3474, -3441, -3408, -3371, -3330, -3285, -3237, -3191,
-    -3146, -3110, -3075, -3039, -2999, -2950, -2902, -2843, -2790, -2737, -2692, -2657,
-    -2629, -2603, -2568, -2528, -2479, -2428, -2370, -2307, -2250, -2193, -2144, -2090,
-    -2046, -1982, -1924, -1856, -1798, -1729, -1656, -1601, -1521, -1459, -1405, -1343,
-    -1299, -1233, -1184, -1122, -1064, -1009, -955, -890, -849, -793, -761, -723,
-    -684, -637, -586, -525, -457, -420, -364, -322, -293, -257, -220, -188,
-    -133, -71, -5, 62, 126, 190, 254, 307, 372, 441, 494, 562,
-    611, 671, 729, 783, 842, 895, 923, 969, 984, 1001, 1010, 1020,
-    1026, 1035, 1033, 1017, 1007, 964, 950, 887, 857, 814, 769, 741,
-    725, 685, 646, 590, 544, 484, 427, 389, 341, 285, 264, 249,
-    216, 192, 164, 176, 122, 107, 96, 86, 98, 96, 114, 138,
-    163, 171, 182, 200, 203, 202, 185, 221, 251, 284, 305, 274,
-    279, 339, 371, 345, 340, 383, 392, 400, 421, 469, 523, 506,
-    512, 487, 479, 497, 489, 515, 506, 522, 564, 632, 700, 671,
-    642, 678, 723, 754, 761, 770, 855, 929, 969, 982, 1045, 1088,
-    1173, 1161, 1232, 1283, 1394, 1434, 1550, 1492, 1596, 1687, 1653, 1689,
-    1697, 1772, 1703, 1703, 2030, 2005, 1770, 1870, 1852, 2163, 1449, 1794,
-    1930, 2664, 5174, 8502, 8765, 8693, 8474, 8430, 8448, 8331, 8225, 7891,
-    7886, 7750, 7870, 7481, 7226, 7410, 6887, 6647, 6367, 6500, 7080, 6567,
-    5840, 5101, 5946, 5780, 6701, 6694, 8281, 8750, 9915, 10184, 10613, 9283,
-    7800, 5190, 2469, -1162, -4818, -6654, -8266, -8994, -9146, -10406, -12414, -16201,
-    -16646, -13137, -10654, -9296, -6353, -567, 6016, 9343, 7969, 10001, 12365, 13175,
-    12176, 14006, 16823, 17520, 16799, 15793, 9714, -5719, -16093, -3749, 10003, -704,
-    -2247, -2699, -1791, -3624, -1645, -3134, -6840, -3966, 3918, 13197, 15488, 16028,
-    15709, 15054, 13864, 11718, 9183, 7087, 5082, 2180, -1903, -5110, -7102, -9114,
-    -10397, -11511, -12714, -14078, -15398, -15458, -15736, -15656, -17430, -17861, -17035, -17872,
-    -17922, -17566, -17177, -17160, -17561, -16320, -15911, -15596, -15442, -14924, -13306, -12361,
-    -12857, -15271, -17370, -16955, -16224, -15501, -15149, -14354, -12446, -10371, -7569, -3272,
-    49, 2573, 4895, 7441, 8924, 10171, 11075, 12165, 12908, 13546, 14054, 14322,
-    15130, 16116, 16216, 16331, 16413, 16546, 16431, 16485, 15617, 15539, 15058, 14426,
-    13539, 13344, 13167, 12836, 12363, 11788, 10890, 10515, 10265, 9478, 8264, 7704,
-    7774, 8433, 9403, 10137, 10149, 9863, 9509, 9157, 8646, 7315, 5237, 1981,
-    -1681, -5632, -7957, -9591, -11471, -12822, -14222, -15396, -16756, -17802, -18615, -19314,
-    -19659, -20187, -20622, -20768, -20744, -20955, -21111, -21172, -21090, -20901, -20631, -20442,
-    -20050, -19611, -18986, -17884, -16728, -16214, -16517, -17350, -17898, -18056, -17792, -17378,
-    -16989, -16268, -15626, -14727, -13411, -11295, -8856, -6420, -3495, -178, 2960, 5508,
-    7139, 8460, 9765, 10974, 11877, 12601, 13439, 13985, 14559, 14929, 15132, 15325,
-    15588, 15724, 15637, 15204, 14685, 14390, 14350, 14174, 13706, 13247, 12843, 12529,
-    12194, 11545, 11123, 10924, 10628, 10084, 9052, 8258, 8235, 9143, 10376, 11444,
-    12088, 12705, 13003, 12523, 11149, 9264, 7249, 5207, 2391, -830, -4141, -6362,
-    -8012, -9503, -10717, -11655, -12498, -13367, -14249, -15038, -15554, -16002, -16203, -16604,
-    -16841, -16961, -16855, -16634, -16381, -16329, -16193, -15929, -15600, -15227, -14745, -14248,
-    -13753, -13212, -12345, -11610, -10776, -10073, -9134, -7943, -6780, -6258, -6522, -7059,
-    -7527, -7900, -8250, -8425, -8542, -8557, -7914, -6339, -4108, -1042, 2294, 5683,
-    8116, 10041, 11761, 13276, 14651, 15956, 17226, 18321, 19166, 19846, 20311, 20582,
-    20902, 21200, 21339, 21512, 21503, 21433, 21234, 20972, 20823, 20402, 20050, 19643,
-    19117, 18674, 18132, 17469, 16937, 16223, 15677, 15018, 14275, 13570, 12728, 11911,
-    11236, 10687, 9865, 8893, 8353, 8401, 8633, 8805, 8984, 9424, 9610, 9493,
-    9590, 9508, 8554, 7021, 4689, 1632, -1482, -4302, -6330, -8039, -9688, -11130,
-    -12447, -13670, -14705, -15541, -16351, -17013, -17569, -17685, -17093, -16702, -16716, -16941,
-    -17173, -17207, -17075, -16917, -16679, -16444, -16242, -15747, -15137, -14418, -13790, -13135,
-    -12546, -11917, -11218, -10560, -10030, -9503, -8911, -8259, -7640, -6800, -5819, -5279,
-    -5305, -5534, -5886, -6372, -6581, -6671, -6936, -7070, -6924, -6772, -6165, -4503,
-    -1974, 841, 3702, 5892, 7717, 9403, 10974, 12367, 13628, 14626, 15436, 16233,
-    16936, 17474, 17959, 18220, 18365, 18519, 18721, 18905, 18854, 18652, 18330, 17964,
-    17481, 17016, 16420, 15872, 15315, 14747, 14077, 13403, 12694, 12042, 11401, 10616,
-    9762, 8889, 8078, 7378, 6620, 5903, 5165, 4520, 3861, 3070, 2032, 818,
-    -452, -1711, -2412, -2772, -2925, -2992, -3086, -2932, -2743, -2792, -2922, -3103,
-    -3388, -3540, -3869, -5313, -7013, -8622, -10389, -12012, -13527, -15078, -16373, -17471,
-    -18700, -19762, -20572, -21155, -21676, -22034, -22224, -22362, -22417, -22407, -22354, -22122,
-    -21959, -21787, -21481, -21084, -20629, -20080, -19424, -18787, -18140, -17461, -16739, -15892,
-    -15057, -14274, -13534, -12771, -11948, -11195, -10485, -9748, -9023, -8358, -7682, -6943,
-    -6255, -5466, -4317, -2990, -1555, -759, -459, -388, -283, -144, 16, 340,
-    726, 1227, 1908, 2813, 3757, 4495, 5298, 6517, 8047, 9674, 11381, 13080,
-    14569, 15959, 17243, 18571, 19769, 20800, 21584, 22208, 22793, 23311, 23513, 23512,
-    23444, 23456, 23444, 23330, 23133, 22798, 22365, 21888, 21197, 20515, 19766, 19013,
-    18185, 17328, 16506, 15682, 14961, 14268, 13539, 12805, 11910, 10954, 10019, 9124,
-    8400, 7655, 7064, 6420, 5663, 4631, 3574, 2485, 1459, 531, -379, -1342,
-    -2399, -3695, -4636, -5015, -5229, -5381, -5436, -5443, -5545, -5744, -6092, -6585,
-    -7127, -7688, -8303, -8764, -9181, -9625, -9963, -10162, -10583, -11483, -12685, -14002,
-    -15273, -16431, -17515, -18534, -19491, -20300, -20892, -21338, -21718, -22008, -22231, -22306,
-    -22252, -22126, -21949, -21606, -21005, -20397, -19668, -18892, -18227, -17591, -17009, -16426,
-    -15809, -15218, -14649, -14136, -13592, -12877, -12011, -11199, -10318, -9486, -8582, -7671,
-    -6841, -6000, -5262, -4392, -3286, -2105, -926, 208, 1304, 2434, 3482, 4472,
-    5221, 5916, 6717, 7573, 8485, 8863, 9046, 9060, 8994, 8834, 8617, 8569,
-    8523, 8697, 8985, 9353, 9837, 10462, 11158, 11887, 12516, 13002, 13850, 15057,
-    16394, 17709, 18837, 19895, 20943, 21840, 22661, 23356, 23845, 24212, 24416, 24449,
-    24402, 24196, 23918, 23280, 22572, 21991, 21425, 20771, 20007, 19388, 18756, 18095,
-    17545, 17030, 16386, 15736, 15106, 14513, 13757, 12939, 12097, 11253, 10452, 9651,
-    8843, 8051, 7194, 6278, 5325, 4096, 2832, 1639, 511, -577, -1611, -2570,
-    -3578, -4726, -5643, -6274, -6830, -7490, -8095, -8620, -9093, -9715, -10406, -10852,
-    -11130, -11348, -11484, -11524, -11553, -11666, -11738, -11913, -12156, -12483, -12891, -13341,
-    -13751, -14155, -14641, -15148, -15615, -16017, -16320, -16698, -17077, -17354, -17423, -17617,
-    -17769, -17493, -17764, -18272, -18793, -19276, -19706, -20115, -20399, -20575, -20557, -20478,
-    -20246, -19678, -19097, -18544, -17970, -17346, -16790, -16253, -15732, -15210, -14676, -14132,
-    -13618, -13065, -12577, -12121, -11612, -11114, -10590, -9892, -9093, -8378, -7608, -6723,
-    -5704, -4451, -3179, -2022, -817, 446, 1675, 2762, 3806, 4646, 5401, 6080,
-    6723, 7369, 7988, 8518, 9036, 9606, 10184, 10735, 11282, 11829, 12315, 12790,
-    13362, 14039, 14577, 14631, 14591, 14647, 14676, 14548, 14314, 14133, 14044, 13959,
-    13899, 13979, 14116, 14331, 14580, 14851, 15111, 15432, 15864, 16272, 16624, 17256,
-    18017, 18818, 19618, 20260, 20769, 21192, 21437, 21570, 21164, 20653, 20093, 19449,
-    18743, 18074, 17429, 16818, 16269, 15663, 15032, 14442, 13853, 13290, 12762, 12181,
-    11572, 10972, 10387, 9891, 9389, 8823, 8385, 8033, 7661, 7277, 6938, 6531,
-    5984, 5424, 4857, 3870, 2495, 1160, -101, -1398, -2665, -3933, -5065, -5892,
-    -6617, -7271, -7894, -8629, -9332, -9977, -10550, -11229, -11897, -12508, -13129, -13700,
-    -14290, -14843, -15257, -15639, -16073, -16531, -16962, -17311, -17509, -17600, -17576, -17546,
-    -17516, -17424, -17335, -17199, -17160, -17191, -17133, -17065, -16987, -16953, -16988, -17057,
-    -17173, -17209, -17210, -17247, -17249, -17277, -17298, -17301, -17315, -17460, -17595, -17655,
-    -17610, -17588, -17614, -17490, -17430, -17587, -17857, -17976, -18101, -17688, -17061, -16402,
-    -15731, -15146, -14573, -13944, -13326, -12761, -12232, -11644, -11040, -10445, -9935, -9423,
-    -8871, -8376, -7854, -7339, -6863, -6329, -5843, -5420, -4997, -4545, -3958, -3314,
-    -2600, -1914, -720, 727, 2154, 3670, 5207, 6382, 7212, 7966, 8732, 9520,
-    10389, 11193, 11931, 12599, 13230, 13785, 14317, 14827, 15298, 15721, 16112, 16479,
-    16808, 17106, 17449, 17829, 18067, 18387, 18705, 19023, 19252, 19381, 19458, 19659,
-    19754, 19703, 19666, 19485, 19205, 18939, 18821, 18728, 18650, 18535, 18436, 18315,
-    18276, 18243, 18119, 17990, 17800, 17645, 17470, 17273, 17199, 17098, 17128, 17163,
-    17125, 17116, 17140, 17136, 17070, 16902, 16765, 16854, 17023, 16885, 16283, 15696,
-    15048, 14480, 13894, 13310, 12692, 12100, 11424, 10735, 10185, 9636, 9119, 8608,
-    8068, 7505, 7055, 6564, 6075, 5678, 5246, 4890, 4399, 3808, 3297, 2716,
-    2053, 1441, 838, 212, -396, -936, -1651, -2896, -4228, -5425, -6307, -7220,
-    -8130, -8993, -9781, -10553, -11285, -11986, -12662, -13350, -14080, -14714, -15262, -15740,
-    -16196, -16683, -17189, -17654, -18104, -18545, -19004, -19416, -19751, -20049, -20314, -20503,
-    -20708, -20898, -20954, -20999, -21101, -21246, -21310, -21206, -21035, -20827, -20576, -20293,
-    -20067, -19891, -19679, -19509, -19337, -19166, -18967, -18868, -18724, -18458, -18143, -17940,
-    -17776, -17566, -17350, -17152, -16943, -16693, -16503, -16316, -16074, -15917, -15862, -15645,
-    -15425, -15151, -14763, -14176, -13596, -13020, -12376, -11815, -11296, -10794, -10253, -9664,
-    -9182, -8772, -8272, -7749, -7266, -6865, -6431, -6004, -5548, -4926, -4306, -3683,
-    -3034, -2431, -1813, -1204, -613, 22, 654, 1214, 1768, 2317, 2885, 3383,
-    3882, 4343, 4688, 5050, 5402, 6102, 6962, 7788, 8639, 9492, 10325, 11148,
-    11960, 12735, 13437, 14083, 14751, 15410, 15973, 16510, 17023, 17537, 18028, 18516,
-    18904, 19240, 19566, 19929, 20235, 20495, 20752, 20998, 21197, 21335, 21488, 21658,
-    21796, 21818, 21826, 21864, 21892, 21893, 21921, 21887, 21849, 21775, 21685, 21595,
-    21509, 21414, 21281, 21077, 20911, 20763, 20582, 20380, 20199, 20031, 19709, 19250,
-    18703, 18139, 17603, 17067, 16546, 16115, 15712, 15254, 14825, 14453, 14094, 13704,
-    13258, 12869, 12399, 11906, 11345, 10833, 10293, 9738, 9130, 8569, 8005, 7437,
-    6883, 6359, 5828, 5279, 4660, 3988, 3256, 2587, 1910, 1327, 736, 148,
-    -447, -983, -1559, -2155, -2693, -3194, -3713, -4255, -4777, -5162, -5458, -5738,
-    -5997, -6259, -6523, -6800, -7029, -7255, -7450, -7672, -7879, -8095, -8301, -8513,
-    -8713, -8923, -9114, -9290, -9421, -9733, -10391, -11133, -11881, -12603, -13349, -14032,
-    -14680, -15350, -16007, -16638, -17236, -17781, -18275, -18747, -19204, -19617, -20019, -20395,
-    -20729, -21010, -21305, -21583, -21870, -22112, -22308, -22491, -22651, -22759, -22875, -22927,
-    -22971, -22983, -22990, -22970, -22917, -22887, -22863, -22830, -22781, -22705, -22583, -22437,
-    -22286, -22131, -21925, -21675, -21450, -21227, -20978, -20738, -20390, -19894, -19327, -18739,
-    -18152, -17545, -16999, -16459, -15931, -15423, -15018, -14633, -14257, -13800, -13340, -12926,
-    -12549, -12254, -11871, -11296, -10716, -10126, -9540, -8934, -8389, -7834, -7276, -6713,
-    -6183, -5680, -5201, -4565, -3836, -3131, -2432, -1729, -1041, -366, 270, 880,
-    1484, 2108, 2696, 3240, 3755, 4213, 4650, 5052, 5449, 5779, 6092, 6401,
-    6724, 6965, 7200, 7440, 7740, 7983, 8204, 8443, 8709, 8927, 9172, 9396,
-    9644, 9892, 10125, 10355, 10569, 10786, 11144, 11674, 12192, 12732, 13231, 13717,
-    14192, 14681, 15182, 15726, 16216, 16703, 17161, 17594, 18013, 18421, 18831, 19239,
-    19621, 19995, 20371, 20756, 21109, 21471, 21781, 22051, 22319, 22582, 22838, 23050,
-    23225, 23393, 23510, 23609, 23691, 23751, 23762, 23748, 23739, 23707, 23665, 23628,
-    23562, 23477, 23356, 23231, 23072, 22867, 22636, 22370, 22079, 21814, 21488, 21136,
-    20798, 20428, 20014, 19600, 19181, 18739, 18281, 17804, 17319, 16793, 16230, 15671,
-    15115, 14558, 14002, 13470, 12958, 12458, 11934, 11378, 10815, 10269, 9704, 9139,
-    8570, 7997, 7432, 6869, 6337, 5780, 5234, 4579, 3779, 2959, 2183, 1450,
-    736, 49, -650, -1335, -2016, -2651, -3265, -3861, -4463, -5072, -5631, -6022,
-    -6358, -6682, -7009, -7326, -7636, -7914, -8211, -8510, -8800, -9095, -9378, -9653,
-    -9923, -10192, -10463, -10725, -10993, -11262, -11534, -11808, -12088, -12371, -12641, -12910,
-    -13187, -13453, -13707, -13965, -14208, -14447, -14668, -14882, -15100, -15310, -15542, -15783,
-    -16023, -16257, -16455, -16655, -16881, -17108, -17348, -17569, -17781, -18001, -18226, -18444,
-    -18653, -18866, -19081, -19297, -19514, -19731, -19929, -20132, -20333, -20531, -20716, -20877,
-    -21014, -21152, -21286, -21403, -21512, -21602, -21688, -21754, -21800, -21819, -21801, -21789,
-    -21740, -21662, -21573, -21473, -21343, -21202, -21028, -20837, -20623, -20408, -20162, -19874,
-    -19581, -19295, -18991, -18663, -18310, -17932, -17532, -17117, -16682, -16235, -15792, -15342,
-    -14889, -14420, -13933, -13428, -12906, -12379, -11841, -11284, -10716, -10146, -9592, -9047,
-    -8523, -7992, -7461, -6928, -6379, -5810, -5230, -4478, -3663, -2862, -2084, -1342,
-    -616, 111, 830, 1528, 2201, 2851, 3465, 4064, 4623, 5162, 5602, 5938,
-    6254, 6576, 6885, 7193, 7487, 7763, 8044, 8318, 8558, 8795, 9035, 9273,
-    9498, 9709, 9923, 10127, 10353, 10568, 10777, 10976, 11196, 11409, 11639, 11867,
-    12085, 12294, 12496, 12703, 12930, 13166, 13437, 13695, 13945, 14193, 14455, 14705,
-    14946, 15170, 15403, 15641, 15901, 16139, 16369, 16583, 16814, 17039, 17248, 17455,
-    17644, 17838, 18033, 18211, 18373, 18523, 18682, 18829, 18967, 19105, 19224, 19328,
-    19430, 19548, 19669, 19779, 19868, 19942, 20023, 20104, 20179, 20248, 20303, 20350,
-    20392, 20440, 20497, 20540, 20544, 20543, 20539, 20549, 20542, 20524, 20487, 20418,
-    20344, 20253, 20137, 19998, 19848, 19685, 19505, 19304, 19070, 18821, 18556, 18272,
-    17956, 17619, 17242, 16846, 16430, 15995, 15542, 15072, 14584, 14088, 13592, 13082,
-    12547, 12001, 11434, 10877, 10321, 9757, 9182, 8616, 8068, 7511, 6947, 6404,
-    5858, 5256, 4515, 3701, 2907, 2146, 1385, 629, -114, -827, -1505, -2168,
-    -2818, -3434, -4005, -4579, -5107, -5507, -5828, -6154, -6472, -6772, -7060, -7351,
-    -7626, -7879, -8131, -8387, -8633, -8894, -9159, -9413, -9654, -9896, -10121, -10353,
-    -10588, -10835, -11074, -11311, -11552, -11791, -12040, -12276, -12490, -12723, -12965, -13212,
-    -13459, -13699, -13929, -14169, -14424, -14664, -14897, -15150, -15411, -15666, -15923, -16169,
-    -16409, -16648, -16889, -17136, -17366, -17593, -17820, -18034, -18259, -18483, -18690, -18880,
-    -19063, -19227, -19381, -19516, -19642, -19770, -19896, -20020, -20131, -20219, -20302, -20378,
-    -20446, -20496, -20542, -20589, -20601, -20596, -20607, -20599, -20569, -20529, -20483, -20427,
-    -20363, -20289, -20181, -20063, -19959, -19852, -19738, -19611, -19459, -19291, -19122, -18947,
-    -18763, -18572, -18372, -18170, -17962, -17738, -17507, -17272, -17030, -16776, -16510, -16233,
-    -15938, -15643, -15342, -15019, -14691, -14351, -14003, -13657, -13298, -12922, -12529, -12134,
-    -11739, -11320, -10894, -10471, -10033, -9577, -9106, -8620, -8131, -7656, -7174, -6654,
-    -6147, -5652, -5051, -4323, -3562, -2805, -2045, -1301, -577, 136, 829, 1498,
-    2148, 2774, 3381, 3980, 4536, 5010, 5431, 5801, 6118, 6423, 6714, 6974,
-    7225, 7480, 7735, 7967, 8184, 8397, 8602, 8799, 8974, 9148, 9334, 9501,
-    9659, 9818, 9978, 10147, 10316, 10472, 10614, 10761, 10904, 11024, 11142, 11271,
-    11409, 11564, 11720, 11874, 12025, 12176, 12340, 12505, 12671, 12847, 13038, 13244,
-    13457, 13670, 13883, 14089, 14293, 14506, 14722, 14941, 15180, 15428, 15683, 15933,
-    16167, 16400, 16643, 16890, 17129, 17361, 17608, 17857, 18101, 18350, 18591, 18822,
-    19042, 19251, 19452, 19644, 19825, 19980, 20117, 20251, 20379, 20507, 20635, 20740,
-    20817, 20884, 20950, 21011, 21074, 21133, 21183, 21222, 21249, 21263, 21248, 21207,
-    21159, 21098, 21033, 20964, 20891, 20805, 20690, 20551, 20396, 20231, 20053, 19848,
-    19633, 19411, 19177, 18940, 18670, 18368, 18068, 17771, 17469, 17158, 16830, 16473,
-    16099, 15722, 15321, 14898, 14485, 14070, 13634, 13201, 12768, 12315, 11860, 11391,
-    10905, 10416, 9919, 9428, 8941, 8447, 7946, 7436, 6936, 6423, 5912, 5375,
-    4696, 3944, 3225, 2506, 1785, 1065, 358, -327, -1010, -1678, -2346, -2996,
-    -3628, -4277, -4851, -5293, -5674, -6040, -6395, -6738, -7074, -7392, -7695, -8007,
-    -8319, -8605, -8867, -9122, -9372, -9608, -9828, -10032, -10231, -10416, -10585, -10763,
-    -10941, -11113, -11282, -11438, -11578, -11708, -11837, -11963, -12085, -12204, -12326, -12453,
-    -12573, -12696, -12821, -12946, -13079, -13202, -13336, -13479, -13603, -13739, -13903, -14073,
-    -14232, -14364, -14493, -14634, -14795, -14958, -15113, -15290, -15489, -15693, -15889, -16062,
-    -16230, -16395, -16564, -16734, -16903, -17084, -17268, -17464, -17667, -17855, -18038, -18219,
-    -18407, -18603, -18791, -18964, -19115, -19257, -19395, -19529, -19675, -19826, -19975, -20124,
-    -20270, -20397, -20513, -20636, -20750, -20868, -21005, -21133, -21245, -21320, -21371, -21421,
-    -21467, -21518, -21550, -21562, -21583, -21602, -21606, -21582, -21540, -21481, -21404, -21326,
-    -21227, -21099, -20960, -20806, -20649, -20463, -20255, -20056, -19848, -19623, -19386, -19136,
-    -18865, -18567, -18264, -17953, -17612, -17256, -16900, -16536, -16161, -15769, -15354, -14936,
-    -14523, -14089, -13644, -13203, -12754, -12293, -11813, -11317, -10810, -10312, -9826, -9314,
-    -8794, -8296, -7798, -7292, -6771, -6248, -5716, -5075, -4284, -3444, -2619, -1802,
-    -992, -200, 567, 1309, 2027, 2727, 3424, 4067, 4628, 5134, 5561, 5944,
-    6331, 6693, 7031, 7359, 7688, 8017, 8347, 8680, 8997, 9303, 9612, 9894,
-    10152, 10400, 10653, 10920, 11176, 11419, 11649, 11873, 12094, 12295, 12470, 12627,
-    12787, 12948, 13112, 13285, 13449, 13609, 13766, 13912, 14048, 14173, 14293, 14412,
-    14529, 14644, 14762, 14894, 15028, 15158, 15301, 15448, 15606, 15773, 15943, 16118,
-    16281, 16443, 16610, 16788, 16982, 17167, 17362, 17567, 17752, 17921, 18094, 18282,
-    18489, 18707, 18921, 19117, 19324, 19538, 19732, 19914, 20090, 20265, 20448, 20633,
-    20811, 20980, 21152, 21325, 21493, 21652, 21792, 21921, 22046, 22170, 22284, 22379,
-    22471, 22558, 22641, 22710, 22758, 22792, 22821, 22842, 22849, 22835, 22813, 22789,
-    22756, 22697, 22615, 22535, 22458, 22363, 22259, 22154, 22045, 21923, 21797, 21660,
-    21506, 21359, 21203, 21017, 20819, 20611, 20391, 20164, 19935, 19703, 19465, 19230,
-    18979, 18709, 18427, 18128, 17814, 17493, 17170, 16835, 16483, 16120, 15748, 15368,
-    14968, 14564, 14165, 13759, 13345, 12916, 12477, 12044, 11611, 11185, 10749, 10304,
-    9870, 9425, 8957, 8479, 8006, 7546, 7090, 6634, 6147, 5596, 4960, 4237,
-    3477, 2710, 1946, 1195, 434, -351, -1154, -1959, -2753, -3549, -4350, -5125,
-    -5785, -6322, -6822, -7302, -7748, -8168, -8561, -8924, -9262, -9602, -9945, -10291,
-    -10654, -11019, -11382, -11730, -12062, -12384, -12697, -13013, -13317, -13601, -13899, -14208,
-    -14507, -14787, -15054, -15296, -15518, -15751, -15977, -16195, -16435, -16674, -16898, -17108,
-    -17307, -17488, -17652, -17811, -17962, -18114, -18269, -18412, -18558, -18695, -18822, -18953,
-    -19089, -19228, -19357, -19468, -19565, -19653, -19749, -19839, -19925, -20014, -20098, -20177,
-    -20254, -20320, -20376, -20428, -20478, -20503, -20523, -20562, -20599, -20621, -20631, -20633,
-    -20621, -20607, -20597, -20568, -20541, -20535, -20533, -20527, -20509, -20482, -20445, -20395,
-    -20340, -20275, -20209, -20146, -20086, -20028, -19961, -19894, -19836, -19777, -19713, -19637,
-    -19549, -19445, -19342, -19248, -19141, -19030, -18935, -18837, -18724, -18592, -18442, -18277,
-    -18129, -17990, -17820, -17644, -17482, -17314, -17130, -16926, -16707, -16480, -16258, -16037,
-    -15801, -15568, -15346, -15125, -14894, -14646, -14404, -14166, -13913, -13648, -13379, -13114,
-    -12844, -12569, -12302, -12038, -11778, -11514, -11251, -10995, -10734, -10462, -10178, -9899,
-    -9627, -9348, -9075, -8808, -8534, -8260, -7985, -7706, -7426, -7148, -6847, -6524,
-    -6220, -5929, -5630, -5311, -4934, -4504, -4069, -3659, -3250, -2841, -2462, -2104,
-    -1744, -1373, -987, -585, -155, 302, 793, 1308, 1821, 2340, 2858, 3353,
-    3841, 4332, 4779, 5139, 5461, 5785, 6098, 6397, 6686, 6970, 7258, 7540,
-    7814, 8093, 8381, 8671, 8955, 9233, 9503, 9782, 10062, 10316, 10565, 10822,
-    11083, 11352, 11626, 11889, 12140, 12396, 12647, 12877, 13108, 13340, 13570, 13799,
-    14018, 14235, 14456, 14672, 14874, 15066, 15260, 15448, 15629, 15801, 15964, 16127,
-    16286, 16446, 16605, 16755, 16895, 17031, 17172, 17306, 17425, 17544, 17663, 17776,
-    17882, 17978, 18068, 18158, 18255, 18335, 18394, 18459, 18529, 18597, 18669, 18729,
-    18772, 18809, 18850, 18875, 18878, 18874, 18868, 18865, 18867, 18864, 18855, 18852,
-    18849, 18833, 18804, 18774, 18735, 18688, 18636, 18583, 18528, 18467, 18406, 18342,
-    18274, 18202, 18129, 18055, 17968, 17873, 17784, 17698, 17610, 17519, 17423, 17323,
-    17227, 17129, 17014, 16895, 16787, 16683, 16582, 16486, 16388, 16282, 16176, 16059,
-    15919, 15769, 15624, 15485, 15348, 15213, 15081, 14950, 14819, 14684, 14537, 14380,
-    14217, 14052, 13877, 13692, 13501, 13315, 13133, 12947, 12761, 12579, 12393, 12199,
-    12009, 11816, 11612, 11403, 11193, 10973, 10735, 10476, 10200, 9915, 9609, 9283,
-    8944, 8597, 8256, 7941, 7640, 7338, 7055, 6796, 6543, 6291, 6041, 5798,
-    5577, 5374, 5162, 4948, 4729, 4461, 4125, 3754, 3375, 2986, 2592, 2194,
-    1790, 1385, 988, 592, 197, -197, -595, -997, -1394, -1791, -2194, -2603,
-    -3011, -3415, -3817, -4218, -4625, -5034, -5426, -5785, -6102, -6378, -6625, -6862,
-    -7093, -7313, -7540, -7768, -7985, -8217, -8463, -8699, -8922, -9133, -9340, -9545,
-    -9745, -9943, -10141, -10335, -10525, -10716, -10905, -11084, -11260, -11439, -11621, -11798,
-    -11972, -12145, -12322, -12497, -12659, -12823, -12993, -13159, -13326, -13491, -13654, -13816,
-    -13986, -14165, -14326, -14477, -14649, -14822, -14987, -15145, -15295, -15437, -15579, -15731,
-    -15875, -16013, -16163, -16312, -16453, -16587, -16709, -16825, -16942, -17051, -17145, -17237,
-    -17335, -17439, -17552, -17660, -17765, -17871, -17972, -18062, -18144, -18229, -18311, -18388,
-    -18471, -18548, -18626, -18706, -18786, -18861, -18930, -19000, -19068, -19140, -19215, -19269,
-    -19325, -19394, -19458, -19511, -19545, -19569, -19591, -19618, -19648, -19667, -19687, -19710,
-    -19724, -19734, -19740, -19735, -19715, -19686, -19660, -19625, -19586, -19546, -19502, -19457,
-    -19406, -19345, -19274, -19199, -19114, -19020, -18927, -18838, -18762, -18692, -18626, -18572,
-    -18525, -18480, -18424, -18355, -18276, -18170, -18056, -17921, -17746, -17567, -17374, -17149,
-    -16900, -16625, -16336, -16037, -15736, -15431, -15114, -14814, -14530, -14244, -13951, -13647,
-    -13337, -13009, -12665, -12328, -11996, -11661, -11330, -10997, -10652, -10297, -9934, -9562,
-    -9187, -8805, -8414, -8023, -7633, -7245, -6851, -6458, -6057, -5650, -5221, -4677,
-    -4035, -3387, -2730, -2070, -1418, -756, -90, 568, 1221, 1874, 2539, 3208,
-    3849, 4465, 5098, 5678, 6127, 6519, 6914, 7297, 7668, 8031, 8389, 8747,
-    9104, 9447, 9778, 10097, 10412, 10730, 11038, 11347, 11657, 11954, 12241, 12517,
-    12790, 13059, 13314, 13567, 13814, 14043, 14268, 14488, 14706, 14919, 15122, 15305,
-    15472, 15647, 15816, 15971, 16124, 16277, 16435, 16586, 16730, 16868, 16995, 17129,
-    17255, 17350, 17441, 17536, 17631, 17721, 17814, 17912, 18005, 18096, 18182, 18256,
-    18320, 18378, 18434, 18488, 18543, 18601, 18661, 18720, 18779, 18838, 18885, 18926,
-    18977, 19022, 19060, 19095, 19131, 19167, 19204, 19245, 19269, 19297, 19350, 19381,
-    19391, 19405, 19418, 19434, 19453, 19470, 19482, 19486, 19502, 19508, 19500, 19494,
-    19479, 19464, 19459, 19457, 19458, 19461, 19461, 19447, 19421, 19375, 19305, 19220,
-    19122, 19013, 18899, 18787, 18675, 18553, 18436, 18318, 18205, 18106, 18014, 17935,
-    17871, 17817, 17776, 17740, 17702, 17650, 17607, 17574, 17518, 17457, 17406, 17347,
-    17280, 17205, 17119, 17018, 16916, 16809, 16677, 16529, 16378, 16226, 16071, 15911,
-    15750, 15579, 15401, 15210, 15005, 14805, 14598, 14381, 14160, 13930, 13699, 13462,
-    13223, 12982, 12732, 12475, 12209, 11947, 11689, 11415, 11129, 10848, 10569, 10290,
-    10013, 9717, 9416, 9139, 8843, 8522, 8211, 7896, 7583, 7273, 6957, 6623,
-    6277, 5940, 5589, 5230, 4853, 4368, 3793, 3221, 2650, 2074, 1502, 930,
-    352, -238, -840, -1438, -2031, -2609, -3178, -3758, -4328, -4900, -5453, -5885,
-    -6245, -6614, -6970, -7327, -7689, -8035, -8378, -8713, -9031, -9347, -9671, -9987,
-    -10278, -10567, -10864, -11149, -11421, -11687, -11946, -12201, -12467, -12720, -12955, -13200,
-    -13454, -13702, -13940, -14162, -14375, -14579, -14777, -14961, -15148, -15339, -15520, -15694,
-    -15860, -16016, -16169, -16318, -16464, -16601, -16728, -16848, -16971, -17108, -17241, -17360,
-    -17475, -17585, -17691, -17789, -17873, -17948, -18032, -18123, -18188, -18237, -18298, -18355,
-    -18405, -18454, -18504, -18547, -18585, -18629, -18664, -18702, -18755, -18815, -18882, -18954,
-    -19033, -19114, -19197, -19288, -19380, -19474, -19571, -19659, -19736, -19803, -19858, -19893,
-    -19909, -19900, -19870, -19836, -19796, -19762, -19725, -19667, -19606, -19551, -19496, -19435,
-    -19372, -19312, -19243, -19172, -19101, -19015, -18938, -18874, -18811, -18746, -18686, -18624,
-    -18551, -18488, -18427, -18348, -18272, -18202, -18125, -18043, -17959, -17863, -17758, -17656,
-    -17546, -17429, -17309, -17192, -17079, -16959, -16827, -16684, -16536, -16395, -16249, -16097,
-    -15943, -15780, -15622, -15459, -15284, -15109, -14928, -14742, -14558, -14378, -14187, -13996,
-    -13814, -13612, -13387, -13169, -12955, -12738, -12525, -12317, -12099, -11873, -11651, -11423,
-    -11190, -10963, -10733, -10495, -10247, -9994, -9743, -9497, -9250, -8987, -8713, -8442,
-    -8172, -7904, -7638, -7358, -7065, -6774, -6472, -6166, -5873, -5588, -5312, -5038,
-    -4755, -4434, -4021, -3554, -3084, -2598, -2110, -1616, -1116, -631, -135, 366,
-    850, 1341, 1837, 2336, 2841, 3348, 3853, 4351, 4855, 5380, 5843, 6195,
-    6510, 6829, 7147, 7462, 7771, 8090, 8414, 8730, 9044, 9356, 9666, 9976,
-    10281, 10583, 10878, 11174, 11476, 11770, 12051, 12318, 12581, 12849, 13121, 13398,
-    13672, 13939, 14205, 14463, 14711, 14950, 15189, 15439, 15675, 15877, 16065, 16243,
-    16406, 16565, 16712, 16835, 16944, 17051, 17150, 17230, 17302, 17375, 17440, 17503,
-    17576, 17656, 17742, 17831, 17915, 17997, 18085, 18180, 18277, 18367, 18451, 18533,
-    18612, 18683, 18746, 18801, 18844, 18875, 18908, 18935, 18951, 18961, 18963, 18956,
-    18944, 18920, 18880, 18843, 18809, 18757, 18691, 18623, 18548, 18463, 18377, 18287,
-    18181, 18066, 17955, 17841, 17722, 17598, 17467, 17333, 17202, 17078, 16953, 16821,
-    16684, 16544, 16405, 16267, 16127, 15988, 15851, 15712, 15577, 15452, 15325, 15183,
-    15034, 14884, 14733, 14587, 14450, 14315, 14182, 14058, 13936, 13820, 13702, 13578,
-    13465, 13365, 13252, 13135, 13021, 12904, 12782, 12665, 12546, 12423, 12308, 12191,
-    12060, 11926, 11798, 11675, 11556, 11438, 11318, 11193, 11070, 10944, 10810, 10684,
-    10562, 10445, 10340, 10236, 10129, 10026, 9917, 9800, 9683, 9566, 9456, 9348,
-    9241, 9136, 9027, 8919, 8816, 8710, 8597, 8474, 8350, 8245, 8140, 8021,
-    7896, 7764, 7622, 7478, 7330, 7171, 7015, 6873, 6719, 6540, 6355, 6172,
-    5983, 5792, 5584, 5347, 5085, 4787, 4445, 4087, 3736, 3376, 3008, 2637,
-    2262, 1885, 1506, 1117, 719, 321, -82, -487, -886, -1292, -1712, -2134,
-    -2557, -2996, -3447, -3904, -4368, -4818, -5217, -5564, -5898, -6234, -6563, -6883,
-    -7201, -7513, -7815, -8097, -8365, -8633, -8903, -9157, -9393, -9621, -9841, -10054,
-    -10263, -10464, -10660, -10854, -11036, -11207, -11378, -11548, -11718, -11892, -12062, -12221,
-    -12380, -12543, -12709, -12877, -13039, -13189, -13335, -13474, -13600, -13722, -13843, -13959,
-    -14075, -14189, -14291, -14385, -14491, -14600, -14700, -14794, -14889, -14981, -15078, -15167,
-    -15239, -15307, -15386, -15463, -15522, -15574, -15623, -15668, -15712, -15754, -15795, -15836,
-    -15880, -15928, -15970, -16003, -16036, -16065, -16090, -16119, -16146, -16175, -16205, -16233,
-    -16261, -16283, -16302, -16317, -16324, -16321, -16317, -16317, -16319, -16329, -16335, -16319,
-    -16311, -16316, -16316, -16313, -16309, -16297, -16286, -16281, -16265, -16230, -16200, -16180,
-    -16152, -16114, -16071, -16027, -15979, -15927, -15873, -15807, -15737, -15666, -15591, -15508,
-    -15418, -15324, -15232, -15135, -15033, -14930, -14827, -14722, -14613, -14494, -14367, -14228,
-    -14081, -13933, -13777, -13614, -13444, -13275, -13109, -12937, -12759, -12583, -12414, -12239,
-    -12054, -11875, -11695, -11518, -11346, -11156, -10954, -10756, -10557, -10351, -10147, -9948,
-    -9742, -9530, -9317, -9103, -8896, -8689, -8482, -8269, -8047, -7825, -7601, -7388,
-    -7190, -7001, -6828, -6666, -6511, -6364, -6222, -6085, -5949, -5812, -5676, -5520,
-    -5308, -5052, -4796, -4542, -4266, -3981, -3705, -3425, -3142, -2863, -2585, -2302,
-    -2022, -1741, -1445, -1141, -849, -563, -278, -9, 261, 531, 790, 1045,
-    1295, 1529, 1750, 1975, 2206, 2438, 2675, 2899, 3113, 3325, 3521, 3713,
-    3897, 4075, 4253, 4413, 4563, 4701, 4826, 4955, 5082, 5213, 5338, 5447,
-    5565, 5701, 5845, 5977, 6107, 6236, 6351, 6476, 6604, 6724, 6861, 7017,
-    7174, 7324, 7464, 7606, 7751, 7890, 8027, 8165, 8307, 8454, 8598, 8739,
-    8884, 9031, 9180, 9330, 9479, 9621, 9755, 9883, 9999, 10117, 10239, 10357,
-    10487, 10616, 10748, 10889, 11020, 11149, 11276, 11399, 11524, 11656, 11807, 11950,
-    12078, 12208, 12332, 12450, 12569, 12697, 12837, 12985, 13148, 13300, 13434, 13573,
-    13703, 13834, 13972, 14106, 14240, 14371, 14496, 14615, 14736, 14857, 14976, 15095,
-    15210, 15319, 15422, 15523, 15619, 15707, 15793, 15879, 15964, 16046, 16132, 16224,
-    16309, 16389, 16467, 16541, 16607, 16661, 16735, 16824, 16894, 16955, 17006, 17041,
-    17076, 17128, 17184, 17233, 17301, 17370, 17421, 17467, 17511, 17550, 17583, 17606,
-    17619, 17628, 17637, 17638, 17628, 17606, 17574, 17537, 17487, 17431, 17370, 17301,
-    17228, 17149, 17066, 16975, 16889, 16810, 16729, 16652, 16571, 16497, 16429, 16360,
-    16299, 16229, 16161, 16106, 16037, 15950, 15853, 15752, 15651, 15548, 15452, 15351,
-    15244, 15132, 14996, 14851, 14699, 14538, 14369, 14195, 14022, 13837, 13634, 13431,
-    13217, 12986, 12749, 12506, 12258, 12012, 11759, 11502, 11235, 10953, 10662, 10359,
-    10044, 9721, 9393, 9071, 8748, 8422, 8099, 7776, 7446, 7100, 6745, 6385,
-    6029, 5656, 5158, 4563, 3968, 3360, 2752, 2143, 1526, 933, 350, -249,
-    -861, -1472, -2091, -2711, -3328, -3965, -4528, -4950, -5341, -5742, -6134, -6527,
-    -6914, -7303, -7687, -8061, -8432, -8800, -9181, -9563, -9941, -10318, -10682, -11037,
-    -11384, -11718, -12048, -12367, -12676, -12981, -13289, -13591, -13875, -14156, -14442, -14711,
-    -14977, -15235, -15475, -15705, -15929, -16140, -16335, -16519, -16706, -16890, -17063, -17238,
-    -17406, -17558, -17705, -17847, -17987, -18124, -18257, -18377, -18488, -18594, -18691, -18782,
-    -18875, -18964, -19055, -19139, -19214, -19290, -19359, -19409, -19452, -19487, -19512, -19534,
-    -19552, -19559, -19562, -19566, -19555, -19522, -19492, -19465, -19434, -19398, -19357, -19312,
-    -19259, -19204, -19143, -19065, -18995, -18937, -18873, -18814, -18762, -18710, -18661, -18616,
-    -18572, -18525, -18479, -18424, -18360, -18290, -18208, -18124, -18032, -17928, -17823, -17712,
-    -17596, -17484, -17364, -17230, -17090, -16941, -16782, -16614, -16438, -16257, -16069, -15882,
-    -15702, -15506, -15300, -15106, -14916, -14722, -14530, -14332, -14124, -13921, -13720, -13499,
-    -13274, -13056, -12843, -12631, -12421, -12219, -12013, -11803, -11600, -11390, -11187, -10993,
-    -10790, -10585, -10378, -10170, -9958, -9747, -9541, -9332, -9131, -8933, -8733, -8540,
-    -8339, -8135, -7929, -7713, -7495, -7275, -7058, -6838, -6621, -6406, -6173, -5942,
-    -5694, -5397, -5090, -4796, -4500, -4201, -3906, -3615, -3315, -3020, -2733, -2456,
-    -2193, -1930, -1679, -1438, -1200, -977, -757, -541, -330, -111, 101, 307,
-    505, 691, 871, 1042, 1206, 1357, 1500, 1643, 1784, 1932, 2074, 2211,
-    2352, 2485, 2614, 2740, 2860, 2979, 3105, 3242, 3367, 3477, 3589, 3690,
-    3785, 3883, 3981, 4084, 4198, 4319, 4441, 4558, 4673, 4785, 4892, 4987,
-    5079, 5165, 5242, 5326, 5406, 5472, 5543, 5619, 5694, 5772, 5850, 5928,
-    6009, 6083, 6152, 6228, 6308, 6393, 6489, 6587, 6695, 6814, 6937, 7065,
-    7200, 7333, 7461, 7597, 7742, 7874, 7992, 8110, 8231, 8345, 8461, 8574,
-    8684, 8815, 8962, 9104, 9249, 9397, 9542, 9687, 9841, 10004, 10165, 10331,
-    10500, 10665, 10840, 11025, 11218, 11416, 11625, 11844, 12055, 12265, 12475, 12683,
-    12899, 13107, 13326, 13549, 13762, 13980, 14205, 14430, 14654, 14869, 15076, 15278,
-    15492, 15708, 15909, 16102, 16286, 16468, 16644, 16814, 16981, 17154, 17346, 17529,
-    17690, 17850, 17999, 18136, 18265, 18384, 18497, 18600, 18692, 18771, 18839, 18907,
-    18970, 19029, 19084, 19134, 19172, 19196, 19207, 19205, 19190, 19166, 19135, 19104,
-    19073, 19030, 18975, 18920, 18863, 18796, 18707, 18600, 18489, 18378, 18255, 18113,
-    17955, 17786, 17616, 17445, 17263, 17077, 16894, 16714, 16525, 16316, 16096, 15870,
-    15634, 15389, 15142, 14892, 14637, 14373, 14102, 13830, 13556, 13281, 13008, 12736,
-    12460, 12179, 11891, 11602, 11311, 11011, 10705, 10402, 10107, 9815, 9522, 9230,
-    8942, 8660, 8373, 8077, 7778, 7493, 7217, 6927, 6628, 6338, 6027, 5653,
-    5222, 4774, 4340, 3921, 3500, 3082, 2666, 2251, 1835, 1423, 1020, 625,
-    228, -170, -557, -941, -1321, -1692, -2054, -2405, -2750, -3087, -3422, -3761,
-    -4094, -4399, -4684, -4937, -5138, -5322, -5519, -5710, -5902, -6107, -6312, -6521,
-    -6742, -6961, -7174, -7384, -7602, -7827, -8043, -8246, -8441, -8624, -8802, -8981,
-    -9144, -9299, -9459, -9616, -9770, -9915, -10050, -10190, -10318, -10430, -10561, -10690,
-    -10803, -10922, -11030, -11115, -11219, -11337, -11437, -11541, -11652, -11750, -11848, -11943,
-    -12026, -12103, -12182, -12257, -12321, -12376, -12439, -12503, -12564, -12638, -12711, -12767,
-    -12846, -12957, -13104, -13327, -13624, -13982, -14417, -14924, -15482, -16076, -16687, -17332,
-    -17976, -18474, -18787, -19013, -19181, -19244, -19198, -19069, -18877, -18636, -18355, -18055,
-    -17747, -17438, -17147, -16880, -16635, -16415, -16195, -15971, -15750, -15516, -15276, -15048,
-    -14810, -14557, -14312, -14064, -13817, -13588, -13357, -13119, -12894, -12672, -12449, -12225,
-    -11996, -11772, -11554, -11322, -11078, -10835, -10591, -10349, -10114, -9880, -9650, -9426,
-    -9210, -8996, -8779, -8566, -8355, -8134, -7911, -7694, -7465, -7228, -6998, -6769,
-    -6538, -6310, -6090, -5876, -5657, -5430, -5203, -4975, -4739, -4508, -4288, -4073,
-    -3857, -3638, -3412, -3184, -2965, -2753, -2536, -2316, -2105, -1899, -1684, -1459,
-    -1233, -1004, -772, -540, -310, -79, 157, 392, 626, 858, 1083, 1300,
-    1517, 1741, 1966, 2191, 2421, 2649, 2868, 3088, 3329, 3583, 3842, 4116,
-    4417, 4732, 5043, 5355, 5671, 5979, 6272, 6558, 6846, 7123, 7392, 7658,
-    7927, 8195, 8463, 8730, 8990, 9244, 9502, 9769, 10038, 10299, 10552, 10797,
-    11038, 11279, 11516, 11747, 11976, 12195, 12384, 12532, 12654, 12763, 12857, 12939,
-    13022, 13113, 13200, 13276, 13345, 13406, 13455, 13495, 13525, 13547, 13570, 13600,
-    13626, 13639, 13651, 13668, 13673, 13674, 13658, 13414, 12547, 10799, 8313, 5507,
-    2773, 381, -1483, -2748, -3483, -3803, -3799, -3567, -3231, -2879, -2552, -2279,
-    -2081, -1949, -1866, -1835, -1849, -1887, -1934, -1999, -2074, -2138, -2183, -2214,
-    -2231, -2238, -2245, -2254, -2261, -2264, -2269, -2275, -2278, -2281, -2289, -2301,
-    -2309, -2315, -2315, -2311, -2309, -2312, -2315, -2313, -2305, -2293, -2275, -2251,
-    -2221, -2182, -2134, -2083, -2033, -1983, -1930, -1875, -1819, -1760, -1699, -1644,
-    -1594, -1545, -1497, -1452, -1408, -1355, -1295, -1236, -1180, -1122, -1062, -1006,
-    -959, -919, -881, -843, -803, -760, -711, -660, -611, -571, -532, -485,
-    -434, -386, -348, -317, -281, -240, -197, -156, -114, -68, -18, 39,
-    104, 167, 213, 239, 256, 266, 258, 228, 189, 155, 129, 103,
-    69, 29, -9, -40, -74, -110, -146, -181, -220, -262, -300, -334,
-    -365, -391, -403, -408, -416, -423, -419, -403, -384, -366, -345, -320,
-    -292, -259, -218, -171, -113, -41, 47, 144, 247, 359, 478, 605,
-    737, 876, 1023, 1173, 1328, 1483, 1634, 1780, 1920, 2061, 2213, 2385,
-    2577, 2776, 2975, 3167, 3343, 3506, 3673, 3793, 3672, 3043, 1765, -62,
-    -2173, -4300, -6242, -7856, -9062, -9851, -10261, -10347, -10167, -9792, -9294, -8730,
-    -8138, -7555, -7007, -6510, -6072, -5694, -5368, -5080, -4818, -4566, -4316, -4062,
-    -3804, -3542, -3276, -3012, -2754, -2499, -2244, -1984, -1719, -1447, -1174, -905,
-    -642, -388, -146, 87, 317, 549, 782, 1015, 1248, 1482, 1712, 1941,
-    2163, 2375, 2576, 2775, 2977, 3178, 3374, 3570, 3771, 3974, 4172, 4360,
-    4537, 4708, 4878, 5050, 5223, 5396, 5571, 5742, 5906, 6060, 6207, 6349,
-    6485, 6618, 6744, 6862, 6977, 7091, 7203, 7310, 7409, 7502, 7585, 7659,
-    7732, 7813, 7892, 7962, 8026, 8094, 8167, 8235, 8292, 8347, 8405, 8465,
-    8517, 8563, 8609, 8659, 8707, 8750, 8792, 8833, 8862, 8875, 8877, 8870,
-    8853, 8832, 8815, 8805, 8791, 8768, 8737, 8693, 8637, 8577, 8513, 8444,
-    8371, 8307, 8252, 8204, 8160, 8119, 8074, 8020, 7966, 7918, 7871, 7818,
-    7767, 7724, 7687, 7644, 7601, 7563, 7528, 7490, 7447, 7396, 7339, 7283,
-    7230, 7177, 7128, 7094, 7077, 7063, 7045, 7025, 7002, 6968, 6927, 6888,
-    6848, 6799, 6750, 6708, 6661, 6596, 6531, 6475, 6343, 5954, 5119, 3759,
-    1946, -145, -2317, -4406, -6297, -7908, -9189, -10130, -10759, -11119, -11259, -11231,
-    -11088, -10871, -10617, -10360, -10125, -9922, -9756, -9625, -9529, -9463, -9424, -9406,
-    -9405, -9414, -9432, -9452, -9474, -9495, -9514, -9531, -9541, -9542, -9536, -9526,
-    -9516, -9506, -9494, -9477, -9456, -9435, -9414, -9391, -9366, -9341, -9318, -9297,
-    -9279, -9269, -9267, -9266, -9255, -9230, -9198, -9165, -9128, -9083, -9031, -8979,
-    -8927, -8871, -8808, -8737, -8665, -8592, -8519, -8447, -8372, -8295, -8215, -8133,
-    -8050, -7966, -7880, -7793, -7702, -7606, -7504, -7399, -7295, -7194, -7092, -6991,
-    -6895, -6801, -6704, -6598, -6485, -6368, -6247, -6124, -6002, -5885, -5768, -5646,
-    -5516, -5383, -5246, -5100, -4946, -4792, -4644, -4504, -4366, -4230, -4097, -3969,
-    -3842, -3719, -3603, -3488, -3370, -3249, -3128, -3012, -2896, -2773, -2644, -2511,
-    -2370, -2220, -2064, -1911, -1760, -1605, -1444, -1280, -1116, -950, -783, -618,
-    -455, -288, -114, 64, 238, 408, 579, 755, 931, 1108, 1294, 1490,
-    1694, 1899, 2103, 2309, 2519, 2728, 2938, 3146, 3355, 3563, 3773, 3990,
-    4216, 4452, 4697, 4948, 5193, 5424, 5644, 5866, 6070, 6164, 6007, 5480,
-    4541, 3247, 1712, 71, -1557, -3074, -4405, -5500, -6331, -6895, -7211, -7308,
-    -7217, -6971, -6611, -6183, -5719, -5235, -4747, -4269, -3822, -3414, -3049, -2725,
-    -2439, -2183, -1948, -1731, -1529, -1337, -1150, -962, -774, -585, -395, -202,
-    -6, 188, 382, 580, 783, 991, 1203, 1421, 1641, 1862, 2081, 2297,
-    2507, 2709, 2903, 3090, 3273, 3453, 3631, 3804, 3973, 4138, 4298, 4452,
-    4600, 4744, 4890, 5041, 5195, 5347, 5489, 5624, 5755, 5884, 6014, 6146,
-    6277, 6404, 6526, 6645, 6762, 6883, 7006, 7132, 7254, 7370, 7481, 7588,
-    7694, 7795, 7890, 7981, 8068, 8156, 8243, 8325, 8404, 8474, 8538, 8594,
-    8644, 8688, 8727, 8759, 8787, 8811, 8829, 8843, 8850, 8856, 8864, 8875,
-    8885, 8893, 8899, 8903, 8905, 8900, 8886, 8862, 8832, 8796, 8756, 8718,
-    8680, 8643, 8606, 8570, 8539, 8509, 8476, 8438, 8393, 8345, 8294, 8241,
-    8192, 8149, 8108, 8065, 8014, 7956, 7894, 7828, 7762, 7694, 7626, 7558,
-    7496, 7438, 7384, 7332, 7280, 7230, 7182, 7136, 7087, 7032, 6976, 6922,
-    6868, 6813, 6760, 6718, 6687, 6660, 6630, 6604, 6579, 6520, 6337, 5920,
-    5186, 4117, 2753, 1174, -524, -2248, -3914, -5456, -6825, -7993, -8944, -9686,
-    -10234, -10609, -10831, -10923, -10917, -10838, -10707, -10537, -10343, -10145, -9957, -9787,
-    -9637, -9513, -9422, -9363, -9329, -9314, -9314, -9326, -9350, -9381, -9417, -9456,
-    -9493, -9521, -9540, -9552, -9561, -9563, -9557, -9542, -9520, -9492, -9458, -9420,
-    -9381, -9345, -9309, -9273, -9233, -9187, -9132, -9070, -9006, -8945, -8886, -8828,
-    -8771, -8714, -8661, -8607, -8552, -8494, -8439, -8388, -8339, -8293, -8249, -8208,
-    -8163, -8111, -8051, -7983, -7909, -7826, -7736, -7639, -7538, -7431, -7321, -7211,
-    -7106, -7009, -6915, -6822, -6723, -6620, -6515, -6406, -6295, -6183, -6067, -5947,
-    -5819, -5686, -5549, -5406, -5257, -5109, -4964, -4825, -4695, -4571, -4452, -4337,
-    -4222, -4105, -3985, -3860, -3729, -3595, -3463, -3333, -3204, -3070, -2932, -2792,
-    -2655, -2519, -2384, -2248, -2113, -1976, -1837, -1698, -1558, -1416, -1269, -1114,
-    -951, -783, -609, -431, -251, -72, 109, 292, 476, 659, 845, 1034,
-    1231, 1432, 1634, 1836, 2035, 2233, 2431, 2635, 2848, 3070, 3296, 3529,
-    3766, 4006, 4237, 4459, 4677, 4899, 5122, 5344, 5565, 5783, 5960, 6018,
-    5870, 5458, 4776, 3853, 2744, 1510, 220, -1061, -2281, -3397, -4373, -5186,
-    -5827, -6300, -6610, -6767, -6784, -6683, -6487, -6214, -5875, -5486, -5067, -4637,
-    -4207, -3782, -3371, -2982, -2616, -2272, -1945, -1633, -1340, -1065, -810, -573,
-    -352, -140, 68, 274, 477, 677, 873, 1067, 1257, 1446, 1633, 1817,
-    1999, 2180, 2362, 2545, 2729, 2916, 3107, 3301, 3497, 3690, 3880, 4066,
-    4247, 4420, 4586, 4749, 4915, 5085, 5253, 5412, 5557, 5694, 5824, 5949,
-    6067, 6182, 6296, 6417, 6542, 6665, 6780, 6885, 6986, 7083, 7179, 7274,
-    7368, 7460, 7548, 7631, 7709, 7785, 7859, 7933, 8009, 8088, 8169, 8248,
-    8325, 8403, 8484, 8569, 8654, 8739, 8821, 8902, 8975, 9038, 9088, 9127,
-    9159, 9185, 9205, 9214, 9210, 9196, 9176, 9151, 9122, 9090, 9056, 9021,
-    8986, 8946, 8899, 8844, 8781, 8713, 8645, 8581, 8524, 8472, 8421, 8370,
-    8319, 8270, 8221, 8171, 8120, 8071, 8025, 7978, 7928, 7872, 7814, 7758,
-    7708, 7660, 7612, 7565, 7517, 7471, 7428, 7390, 7355, 7324, 7293, 7263,
-    7233, 7200, 7159, 7109, 7054, 6996, 6938, 6879, 6823, 6771, 6709, 6597,
-    6368, 5959, 5327, 4472, 3420, 2207, 878, -518, -1931, -3313, -4626, -5846,
-    -6952, -7928, -8762, -9456, -10015, -10448, -10767, -10979, -11095, -11130, -11098, -11014,
-    -10892, -10744, -10583, -10415, -10248, -10086, -9934, -9792, -9663, -9553, -9466, -9404,
-    -9365, -9343, -9333, -9333, -9339, -9349, -9360, -9372, -9386, -9400, -9412, -9418,
-    -9415, -9406, -9393, -9377, -9360, -9340, -9317, -9292, -9264, -9233, -9199, -9162,
-    -9122, -9079, -9034, -8985, -8930, -8868, -8800, -8731, -8662, -8596, -8533, -8471,
-    -8409, -8345, -8278, -8204, -8123, -8040, -7958, -7880, -7806, -7732, -7657, -7576,
-    -7494, -7407, -7319, -7228, -7135, -7040, -6944, -6844, -6737, -6623, -6503, -6381,
-    -6260, -6139, -6016, -5888, -5757, -5625, -5496, -5366, -5234, -5096, -4956, -4814,
-    -4672, -4528, -4382, -4234, -4088, -3945, -3804, -3664, -3524, -3384, -3242, -3098,
-    -2949, -2796, -2646, -2499, -2358, -2218, -2078, -1936, -1792, -1646, -1498, -1345,
-    -1188, -1029, -867, -704, -539, -368, -196, -23, 147, 316, 486, 659,
-    835, 1012, 1189, 1366, 1545, 1731, 1923, 2124, 2331, 2546, 2767, 2995,
-    3225, 3451, 3670, 3882, 4092, 4302, 4514, 4727, 4944, 5171, 5400, 5609,
-    5757, 5795, 5677, 5376, 4889, 4229, 3424, 2511, 1528, 514, -496, -1472,
-    -2385, -3214, -3941, -4559, -5063, -5454, -5734, -5907, -5981, -5968, -5879, -5723,
-    -5508, -5241, -4931, -4590, -4227, -3849, -3462, -3072, -2685, -2311, -1952, -1612,
-    -1288, -980, -687, -408, -143, 113, 362, 604, 836, 1056, 1267, 1472,
-    1674, 1874, 2071, 2264, 2453, 2639, 2822, 3002, 3176, 3345, 3511, 3672,
-    3829, 3983, 4135, 4286, 4436, 4584, 4728, 4868, 5007, 5147, 5286, 5424,
-    5561, 5697, 5835, 5973, 6109, 6237, 6354, 6462, 6565, 6664, 6762, 6857,
-    6953, 7049, 7150, 7251, 7349, 7442, 7533, 7625, 7718, 7812, 7902, 7988,
-    8072, 8156, 8239, 8317, 8389, 8456, 8520, 8582, 8641, 8694, 8739, 8778,
-    8812, 8842, 8870, 8895, 8918, 8938, 8960, 8980, 8999, 9016, 9031, 9042,
-    9051, 9055, 9049, 9035, 9013, 8987, 8957, 8924, 8888, 8854, 8823, 8798,
-    8770, 8736, 8694, 8646, 8597, 8547, 8494, 8438, 8381, 8324, 8269, 8213,
-    8156, 8099, 8043, 7991, 7939, 7885, 7826, 7761, 7690, 7613, 7533, 7450,
-    7367, 7282, 7197, 7115, 7038, 6966, 6897, 6831, 6766, 6707, 6652, 6595,
-    6511, 6368, 6126, 5752, 5224, 4540, 3713, 2767, 1728, 618, -539, -1715,
-    -2883, -4015, -5092, -6099, -7024, -7857, -8593, -9231, -9774, -10226, -10591, -10872,
-    -11077, -11213, -11288, -11313, -11297, -11246, -11167, -11067, -10952, -10828, -10700, -10569,
-    -10439, -10311, -10190, -10080, -9982, -9893, -9814, -9746, -9688, -9641, -9600, -9561,
-    -9526, -9493, -9462, -9432, -9401, -9370, -9345, -9326, -9312, -9299, -9285, -9269,
-    -9252, -9232, -9207, -9177, -9147, -9115, -9083, -9048, -9006, -8960, -8908, -8854,
-    -8799, -8742, -8684, -8624, -8561, -8498, -8434, -8367, -8295, -8219, -8140, -8060,
-    -7983, -7903, -7821, -7736, -7651, -7565, -7478, -7386, -7286, -7180, -7070, -6955,
-    -6833, -6706, -6576, -6449, -6325, -6204, -6081, -5956, -5826, -5694, -5559, -5421,
-    -5282, -5142, -5000, -4857, -4710, -4558, -4402, -4244, -4086, -3928, -3771, -3615,
-    -3460, -3306, -3153, -2999, -2843, -2685, -2525, -2366, -2208, -2051, -1894, -1732,
-    -1568, -1404, -1236, -1064, -886, -703, -516, -327, -134, 64, 263, 459,
-    651, 839, 1028, 1220, 1414, 1610, 1806, 2002, 2200, 2398, 2595, 2792,
-    2988, 3185, 3384, 3584, 3784, 3983, 4180, 4377, 4572, 4769, 4971, 5174,
-    5372, 5544, 5661, 5688, 5597, 5373, 5017, 4538, 3950, 3271, 2524, 1733,
-    920, 108, -685, -1443, -2150, -2794, -3364, -3858, -4276, -4618, -4881, -5066,
-    -5172, -5208, -5181, -5099, -4965, -4785, -4565, -4313, -4038, -3741, -3425, -3094,
-    -2752, -2404, -2059, -1719, -1384, -1056, -735, -422, -117, 179, 464, 737,
-    999, 1249, 1488, 1718, 1939, 2151, 2355, 2552, 2743, 2930, 3113, 3293,
-    3470, 3647, 3820, 3992, 4159, 4321, 4480, 4637, 4793, 4946, 5098, 5247,
-    5392, 5533, 5670, 5799, 5923, 6041, 6156, 6269, 6380, 6487, 6589, 6684,
-    6774, 6861, 6946, 7030, 7114, 7197, 7280, 7363, 7445, 7526, 7606, 7684,
-    7760, 7836, 7910, 7981, 8050, 8120, 8190, 8262, 8333, 8399, 8465, 8529,
-    8592, 8649, 8699, 8744, 8786, 8825, 8861, 8892, 8917, 8939, 8956, 8967,
-    8970, 8966, 8959, 8951, 8942, 8928, 8908, 8883, 8853, 8819, 8783, 8745,
-    8705, 8664, 8622, 8581, 8540, 8498, 8455, 8413, 8371, 8331, 8291, 8251,
-    8210, 8168, 8127, 8089, 8053, 8018, 7982, 7944, 7905, 7865, 7821, 7772,
-    7720, 7666, 7611, 7554, 7494, 7431, 7367, 7303, 7235, 7166, 7096, 7033,
-    6973, 6904, 6800, 6634, 6381, 6024, 5552, 4964, 4263, 3459, 2572, 1617,
-    614, -420, -1463, -2499, -3512, -4489, -5420, -6295, -7105, -7844, -8509, -9099,
-    -9612, -10051, -10420, -10724, -10970, -11158, -11295, -11383, -11432, -11445, -11428, -11383,
-    -11316, -11233, -11139, -11039, -10933, -10825, -10714, -10601, -10489, -10378, -10272, -10170,
-    -10076, -9989, -9912, -9842, -9780, -9723, -9671, -9624, -9582, -9544, -9506, -9469,
-    -9434, -9402, -9373, -9346, -9320, -9293, -9264, -9229, -9189, -9145, -9099, -9052,
-    -9001, -8947, -8889, -8827, -8765, -8703, -8637, -8566, -8493, -8422, -8353, -8285,
-    -8219, -8153, -8085, -8015, -7941, -7865, -7785, -7699, -7611, -7521, -7432, -7343,
-    -7252, -7158, -7059, -6956, -6851, -6741, -6625, -6502, -6375, -6247, -6119, -5990,
-    -5860, -5726, -5589, -5445, -5296, -5143, -4988, -4834, -4679, -4522, -4363, -4205,
-    -4048, -3890, -3730, -3568, -3403, -3237, -3072, -2907, -2742, -2577, -2412, -2248,
-    -2082, -1912, -1738, -1560, -1381, -1201, -1024, -848, -676, -505, -333, -159,
-    17, 197, 381, 568, 759, 951, 1142, 1334, 1529, 1728, 1934, 2144,
-    2359, 2580, 2803, 3027, 3250, 3469, 3688, 3908, 4128, 4346, 4562, 4779,
-    5001, 5224, 5431, 5601, 5711, 5743, 5680, 5517, 5252, 4892, 4448, 3933,
-    3359, 2736, 2076, 1393, 704, 22, -642, -1278, -1873, -2419, -2910, -3343,
-    -3719, -4036, -4293, -4491, -4629, -4711, -4738, -4711, -4634, -4510, -4346, -4147,
-    -3918, -3663, -3386, -3094, -2791, -2479, -2158, -1830, -1494, -1154, -812, -473,
-    -143, 176, 482, 773, 1055, 1329, 1598, 1863, 2122, 2373, 2612, 2838,
-    3048, 3245, 3431, 3610, 3783, 3953, 4118, 4280, 4436, 4588, 4736, 4880,
-    5020, 5158, 5295, 5429, 5563, 5697, 5830, 5962, 6091, 6214, 6332, 6443,
-    6548, 6647, 6742, 6836, 6930, 7025, 7121, 7217, 7310, 7395, 7474, 7547,
-    7617, 7686, 7757, 7830, 7906, 7981, 8051, 8115, 8171, 8220, 8263, 8305,
-    8348, 8392, 8438, 8484, 8528, 8572, 8613, 8653, 8693, 8731, 8765, 8795,
-    8821, 8846, 8870, 8894, 8916, 8935, 8949, 8957, 8957, 8951, 8940, 8926,
-    8912, 8897, 8883, 8867, 8844, 8811, 8768, 8717, 8663, 8606, 8550, 8496,
-    8448, 8403, 8357, 8307, 8249, 8187, 8122, 8057, 7995, 7934, 7875, 7818,
-    7762, 7707, 7652, 7597, 7541, 7485, 7428, 7370, 7312, 7255, 7203, 7155,
-    7112, 7069, 7018, 6946, 6836, 6667, 6425, 6102, 5696, 5208, 4642, 4000,
-    3287, 2514, 1688, 823, -70, -974, -1876, -2764, -3629, -4463, -5261, -6019,
-    -6736, -7406, -8027, -8596, -9109, -9569, -9975, -10331, -10637, -10893, -11101, -11264,
-    -11385, -11470, -11524, -11550, -11551, -11528, -11485, -11424, -11348, -11257, -11158, -11057,
-    -10958, -10861, -10768, -10674, -10580, -10484, -10384, -10282, -10184, -10091, -10006, -9929,
-    -9859, -9793, -9729, -9666, -9601, -9536, -9474, -9415, -9362, -9313, -9268, -9228,
-    -9192, -9163, -9138, -9110, -9079, -9046, -9010, -8967, -8916, -8858, -8799, -8743,
-    -8687, -8629, -8569, -8505, -8435, -8356, -8273, -8189, -8110, -8038, -7965, -7887,
-    -7805, -7715, -7620, -7517, -7408, -7295, -7181, -7066, -6954, -6841, -6727, -6607,
-    -6479, -6345, -6205, -6060, -5914, -5765, -5615, -5461, -5307, -5154, -5001, -4846,
-    -4685, -4521, -4355, -4188, -4013, -3830, -3645, -3463, -3288, -3115, -2941, -2763,
-    -2584, -2398, -2207, -2014, -1827, -1650, -1482, -1317, -1152, -986, -815, -641,
-    -461, -277, -92, 91, 272, 451, 631, 815, 1003, 1196, 1393, 1594,
-    1799, 2006, 2215, 2423, 2629, 2831, 3030, 3232, 3441, 3656, 3874, 4091,
-    4314, 4545, 4781, 5009, 5213, 5381, 5502, 5565, 5560, 5482, 5331, 5109,
-    4816, 4452, 4022, 3539, 3018, 2470, 1906, 1336, 770, 216, -320, -834,
-    -1321, -1779, -2204, -2591, -2934, -3230, -3475, -3671, -3817, -3916, -3970, -3984,
-    -3962, -3906, -3817, -3696, -3543, -3361, -3153, -2927, -2685, -2426, -2148, -1855,
-    -1558, -1262, -964, -662, -357, -51, 256, 566, 876, 1180, 1469, 1742,
-    2004, 2260, 2511, 2758, 3002, 3242, 3479, 3709, 3928, 4137, 4336, 4523,
-    4700, 4868, 5029, 5184, 5336, 5487, 5634, 5775, 5909, 6035, 6154, 6266,
-    6371, 6472, 6573, 6672, 6764, 6853, 6944, 7040, 7135, 7222, 7300, 7374,
-    7450, 7524, 7595, 7667, 7743, 7820, 7889, 7945, 7992, 8035, 8079, 8121,
-    8165, 8214, 8268, 8325, 8381, 8431, 8478, 8519, 8557, 8592, 8626, 8660,
-    8693, 8726, 8759, 8789, 8815, 8836, 8855, 8873, 8886, 8895, 8904, 8912,
-    8915, 8912, 8905, 8898, 8892, 8878, 8850, 8813, 8772, 8729, 8683, 8637,
-    8595, 8557, 8517, 8466, 8402, 8332, 8262, 8192, 8124, 8061, 8005, 7954,
-    7902, 7849, 7794, 7738, 7681, 7625, 7568, 7512, 7456, 7404, 7355, 7306,
-    7256, 7203, 7149, 7090, 7021, 6932, 6813, 6656, 6447, 6174, 5834, 5430,
-    4967, 4444, 3856, 3208, 2512, 1780, 1019, 236, -558, -1350, -2135, -2915,
-    -3688, -4449, -5185, -5890, -6561, -7193, -7778, -8318, -8815, -9271, -9687, -10062,
-    -10396, -10693, -10951, -11172, -11356, -11503, -11615, -11693, -11740, -11763, -11764, -11747,
-    -11713, -11666, -11606, -11534, -11447, -11353, -11255, -11153, -11041, -10920, -10798, -10681,
-    -10572, -10464, -10355, -10250, -10149, -10049, -9946, -9842, -9746, -9663, -9588, -9518,
-    -9451, -9387, -9323, -9259, -9197, -9139, -9084, -9031, -8980, -8932, -8889, -8848,
-    -8809, -8770, -8727, -8679, -8625, -8568, -8511, -8454, -8393, -8331, -8265, -8194,
-    -8114, -8025, -7932, -7839, -7740, -7630, -7512, -7393, -7280, -7168, -7055, -6939,
-    -6825, -6708, -6582, -6445, -6303, -6166, -6036, -5908, -5777, -5643, -5506, -5364,
-    -5217, -5067, -4917, -4766, -4615, -4464, -4314, -4165, -4015, -3861, -3701, -3535,
-    -3361, -3184, -3005, -2826, -2645, -2463, -2283, -2104, -1923, -1737, -1546, -1354,
-    -1163, -967, -762, -551, -343, -141, 58, 256, 451, 641, 834, 1037,
-    1248, 1459, 1664, 1863, 2061, 2261, 2462, 2666, 2875, 3089, 3305, 3521,
-    3734, 3942, 4147, 4347, 4543, 4733, 4909, 5061, 5178, 5252, 5273, 5234,
-    5134, 4977, 4763, 4496, 4179, 3822, 3432, 3012, 2568, 2107, 1644, 1187,
-    734, 284, -159, -588, -996, -1384, -1745, -2068, -2350, -2593, -2807, -2994,
-    -3151, -3275, -3364, -3420, -3438, -3419, -3362, -3276, -3167, -3036, -2890, -2727,
-    -2549, -2351, -2136, -1906, -1662, -1405, -1134, -853, -565, -274, 21, 317,
-    611, 904, 1198, 1491, 1777, 2053, 2324, 2596, 2866, 3126, 3371, 3603,
-    3824, 4036, 4236, 4429, 4620, 4811, 4994, 5164, 5319, 5462, 5597, 5725,
-    5849, 5972, 6097, 6220, 6336, 6441, 6535, 6619, 6699, 6777, 6856, 6936,
-    7015, 7097, 7183, 7274, 7364, 7452, 7537, 7622, 7703, 7781, 7858, 7936,
-    8012, 8083, 8149, 8218, 8294, 8368, 8431, 8482, 8527, 8569, 8606, 8639,
-    8672, 8709, 8746, 8777, 8796, 8803, 8804, 8800, 8796, 8793, 8794, 8798,
-    8800, 8796, 8784, 8767, 8746, 8722, 8697, 8671, 8643, 8614, 8588, 8567,
-    8546, 8522, 8495, 8468, 8442, 8415, 8385, 8355, 8325, 8292, 8254, 8215,
-    8181, 8151, 8117, 8073, 8022, 7969, 7915, 7859, 7800, 7746, 7699, 7653,
-    7600, 7536, 7465, 7391, 7317, 7242, 7160, 7065, 6943, 6782, 6572, 6307,
-    5986, 5609, 5178, 4697, 4167, 3594, 2986, 2351, 1694, 1013, 316, -391,
-    -1099, -1804, -2504, -3194, -3868, -4521, -5155, -5767, -6350, -6898, -7415, -7905,
-    -8367, -8799, -9197, -9562, -9894, -10193, -10453, -10674, -10868, -11043, -11200, -11336,
-    -11451, -11542, -11610, -11654, -11676, -11679, -11669, -11648, -11617, -11577, -11529, -11473,
-    -11410, -11341, -11264, -11177, -11079, -10976, -10874, -10771, -10663, -10552, -10439, -10327,
-    -10213, -10099, -9986, -9878, -9778, -9680, -9578, -9477, -9382, -9292, -9205, -9122,
-    -9039, -8959, -8881, -8799, -8712, -8633, -8566, -8507, -8455, -8405, -8355, -8302,
-    -8247, -8184, -8113, -8041, -7967, -7891, -7815, -7736, -7652, -7564, -7471, -7371,
-    -7263, -7150, -7034, -6917, -6794, -6662, -6524, -6383, -6237, -6088, -5935, -5780,
-    -5630, -5484, -5333, -5173, -5014, -4859, -4703, -4547, -4391, -4231, -4073, -3913,
-    -3742, -3567, -3401, -3244, -3089, -2939, -2790, -2638, -2485, -2328, -2163, -1993,
-    -1824, -1659, -1493, -1328, -1161, -988, -812, -633, -448, -258, -64, 132,
-    330, 537, 754, 974, 1198, 1425, 1655, 1886, 2114, 2334, 2551, 2776,
-    3009, 3236, 3459, 3681, 3902, 4123, 4342, 4547, 4735, 4907, 5042, 5124,
-    5154, 5132, 5054, 4929, 4761, 4551, 4306, 4028, 3716, 3367, 2994, 2600,
-    2190, 1775, 1358, 942, 531, 131, -254, -621, -972, -1299, -1598, -1866,
-    -2108, -2319, -2499, -2652, -2775, -2872, -2946, -2988, -2990, -2965, -2920, -2852,
-    -2759, -2648, -2513, -2359, -2189, -1997, -1781, -1560, -1341, -1118, -890, -659,
-    -418, -167, 90, 355, 626, 893, 1154, 1413, 1667, 1918, 2168, 2414,
-    2655, 2892, 3125, 3353, 3575, 3789, 4000, 4214, 4426, 4632, 4834, 5029,
-    5218, 5400, 5571, 5732, 5896, 6061, 6215, 6354, 6488, 6613, 6732, 6850,
-    6964, 7075, 7192, 7311, 7415, 7505, 7589, 7665, 7737, 7811, 7883, 7952,
-    8023, 8090, 8150, 8204, 8257, 8307, 8355, 8399, 8439, 8475, 8510, 8545,
-    8575, 8600, 8622, 8648, 8678, 8703, 8723, 8743, 8760, 8774, 8787, 8789,
-    8789, 8797, 8810, 8814, 8812, 8809, 8801, 8792, 8785, 8774, 8763, 8759,
-    8750, 8725, 8691, 8656, 8617, 8578, 8542, 8505, 8469, 8439, 8404, 8362,
-    8316, 8268, 8219, 8168, 8116, 8060, 8004, 7948, 7891, 7833, 7773, 7715,
-    7664, 7614, 7560, 7504, 7451, 7396, 7340, 7276, 7195, 7099, 6989, 6849,
-    6664, 6438, 6170, 5857, 5502, 5107, 4667, 4192, 3688, 3143, 2560, 1952,
-    1327, 684, 34, -621, -1278, -1927, -2569, -3206, -3837, -4452, -5051, -5632,
-    -6191, -6728, -7240, -7723, -8179, -8606, -9005, -9376, -9715, -10021, -10298, -10550,
-    -10771, -10963, -11130, -11272, -11394, -11498, -11573, -11620, -11652, -11674, -11679, -11668,
-    -11645, -11607, -11559, -11503, -11431, -11347, -11266, -11186, -11102, -11016, -10930, -10837,
-    -10740, -10638, -10532, -10426, -10328, -10234, -10141, -10050, -9960, -9874, -9791, -9708,
-    -9626, -9544, -9462, -9382, -9304, -9224, -9140, -9059, -8980, -8899, -8816, -8730,
-    -8645, -8562, -8477, -8381, -8278, -8179, -8082, -7980, -7875, -7769, -7660, -7552,
-    -7439, -7313, -7187, -7070, -6957, -6842, -6729, -6614, -6495, -6373, -6245, -6114,
-    -5986, -5865, -5744, -5623, -5503, -5383, -5264, -5145, -5021, -4892, -4759, -4624,
-    -4489, -4351, -4205, -4051, -3897, -3742, -3582, -3418, -3251, -3085, -2920, -2749,
-    -2565, -2376, -2189, -2002, -1812, -1621, -1428, -1234, -1037, -830, -616, -405,
-    -204, -5, 196, 398, 603, 812, 1024, 1240, 1458, 1670, 1878, 2086,
-    2292, 2498, 2704, 2909, 3116, 3327, 3540, 3750, 3952, 4142, 4317, 4476,
-    4608, 4704, 4765, 4792, 4780, 4728, 4630, 4492, 4323, 4128, 3902, 3643,
-    3359, 3054, 2733, 2399, 2057, 1716, 1380, 1045, 708, 372, 47, -264,
-    -561, -840, -1099, -1334, -1545, -1736, -1913, -2072, -2209, -2324, -2415, -2484,
-    -2530, -2551, -2547, -2521, -2474, -2409, -2322, -2214, -2086, -1940, -1779, -1602,
-    -1410, -1205, -992, -770, -539, -297, -47, 206, 458, 710, 964, 1220,
-    1475, 1733, 1992, 2248, 2497, 2737, 2971, 3203, 3432, 3653, 3868, 4079,
-    4288, 4489, 4677, 4849, 5012, 5169, 5321, 5466, 5603, 5734, 5860, 5982,
-    6097, 6206, 6313, 6418, 6524, 6628, 6728, 6825, 6921, 7016, 7107, 7194,
-    7277, 7359, 7439, 7516, 7587, 7652, 7714, 7774, 7831, 7884, 7935, 7985,
-    8028, 8062, 8090, 8114, 8134, 8148, 8156, 8160, 8166, 8173, 8173, 8161,
-    8141, 8120, 8098, 8076, 8053, 8026, 7996, 7965, 7933, 7899, 7864, 7831,
-    7800, 7772, 7748, 7723, 7697, 7674, 7653, 7631, 7606, 7579, 7551, 7522,
-    7490, 7457, 7422, 7391, 7360, 7327, 7292, 7258, 7224, 7186, 7141, 7092,
-    7043, 6991, 6936, 6879, 6821, 6767, 6713, 6650, 6576, 6497, 6410, 6313,
-    6200, 6066, 5905, 5719, 5512, 5279, 5020, 4734, 4423, 4090, 3738, 3370,
-    2980, 2573, 2155, 1728, 1285, 830, 365, -105, -577, -1046, -1511, -1969,
-    -2418, -2858, -3291, -3710, -4113, -4503, -4887, -5260, -5619, -5963, -6292, -6606,
-    -6905, -7184, -7442, -7684, -7917, -8135, -8331, -8508, -8669, -8814, -8948, -9069,
-    -9174, -9262, -9337, -9399, -9446, -9478, -9497, -9501, -9494, -9480, -9456, -9418,
-    -9374, -9329, -9283, -9232, -9180, -9120, -9053, -8980, -8902, -8819, -8734, -8648,
-    -8556, -8458, -8364, -8278, -8195, -8110, -8025, -7939, -7855, -7774, -7690, -7602,
-    -7519, -7442, -7365, -7281, -7197, -7112, -7027, -6944, -6862, -6775, -6685, -6595,
-    -6503, -6406, -6307, -6205, -6098, -5988, -5878, -5763, -5645, -5531, -5423, -5317,
-    -5211, -5105, -4997, -4888, -4780, -4671, -4560, -4451, -4341, -4226, -4110, -4002,
-    -3902, -3800, -3696, -3592, -3489, -3389, -3290, -3185, -3077, -2975, -2878, -2777,
-    -2672, -2565, -2455, -2344, -2233, -2120, -2001, -1880, -1760, -1638, -1512, -1382,
-    -1245, -1100, -954, -807, -654, -501, -352, -206, -59, 89, 238, 388,
-    537, 687, 841, 996, 1150, 1305, 1463, 1617, 1760, 1898, 2035, 2166,
-    2288, 2397, 2492, 2574, 2648, 2706, 2740, 2753, 2755, 2743, 2716, 2674,
-    2618, 2543, 2457, 2361, 2251, 2129, 2002, 1869, 1733, 1601, 1470, 1334,
-    1198, 1063, 926, 784, 644, 508, 375, 248, 129, 16, -88, -183,
-    -272, -353, -424, -485, -543, -600, -648, -685, -713, -737, -755, -765,
-    -764, -750, -734, -716, -691, -652, -605, -551, -489, -425, -360, -284,
-    -204, -123, -37, 58, 159, 269, 391, 515, 640, 768, 899, 1023,
-    1149, 1274, 1399, 1524, 1649, 1775, 1901, 2029, 2158, 2284, 2408, 2534,
-    2655, 2769, 2874, 2982, 3091, 3195, 3294, 3390, 3483, 3580, 3676, 3761,
-    3840, 3920, 4006, 4090, 4173, 4254, 4328, 4398, 4469, 4533, 4592, 4653,
-    4712, 4773, 4834, 4896, 4953, 5003, 5054, 5100, 5137, 5171, 5202, 5226,
-    5248, 5266, 5285, 5302, 5319, 5334, 5342, 5351, 5359, 5360, 5352, 5341,
-    5333, 5325, 5314, 5299, 5281, 5263, 5249, 5227, 5197, 5167, 5143, 5124,
-    5105, 5085, 5060, 5030, 5000, 4970, 4936, 4904, 4873, 4846, 4821, 4798,
-    4776, 4750, 4725, 4703, 4675, 4643, 4608, 4572, 4534, 4494, 4455, 4415,
-    4370, 4321, 4265, 4197, 4131, 4055, 3963, 3855, 3738, 3614, 3480, 3333,
-    3174, 3001, 2824, 2637, 2432, 2217, 1998, 1778, 1558, 1331, 1097, 855,
-    608, 361, 111, -140, -388, -637, -878, -1117, -1351, -1580, -1807, -2027,
-    -2239, -2451, -2661, -2867, -3066, -3262, -3449, -3625, -3797, -3962, -4115, -4263,
-    -4401, -4521, -4639, -4758, -4872, -4976, -5072, -5161, -5245, -5327, -5404, -5466,
-    -5529, -5593, -5646, -5690, -5724, -5748, -5771, -5793, -5814, -5830, -5841, -5847,
-    -5845, -5844, -5839, -5825, -5808, -5783, -5752, -5721, -5682, -5641, -5606, -5571,
-    -5534, -5494, -5454, -5409, -5361, -5315, -5263, -5204, -5146, -5076, -5000, -4933,
-    -4872, -4806, -4736, -4663, -4589, -4516, -4449, -4374, -4295, -4225, -4156, -4082,
-    -4006, -3925, -3844, -3766, -3693, -3620, -3548, -3479, -3409, -3339, -3272, -3201,
-    -3126, -3052, -2972, -2894, -2817, -2736, -2661, -2591, -2521, -2448, -2376, -2309,
-    -2238, -2169, -2101, -2022, -1944, -1863, -1771, -1683, -1607, -1535, -1457, -1374,
-    -1289, -1202, -1119, -1039, -950, -863, -787, -706, -622, -533, -439, -345,
-    -254, -166, -77, 10, 95, 184, 271, 357, 450, 543, 638, 735,
-    826, 916, 1002, 1078, 1147, 1212, 1273, 1323, 1363, 1400, 1428, 1452,
-    1475, 1487, 1496, 1505, 1499, 1477, 1448, 1418, 1386, 1348, 1307, 1254,
-    1200, 1150, 1089, 1020, 954, 891, 831, 774, 716, 657, 596, 536,
-    476, 415, 359, 303, 252, 209, 170, 138, 108, 78, 52, 27,
-    3, -17, -33, -46, -61, -73, -79, -81, -73, -60, -49, -28,
-    -4, 14, 31, 51, 80, 113, 147, 182, 214, 253, 296, 334,
-    374, 418, 471, 530, 591, 652, 710, 766, 824, 880, 935, 992,
-    1051, 1117, 1188, 1259, 1329, 1395, 1466, 1539, 1608, 1676, 1743, 1809,
-    1872, 1933, 1994, 2054, 2114, 2176, 2237, 2300, 2367, 2429, 2484, 2532,
-    2581, 2634, 2684, 2728, 2767, 2801, 2838, 2869, 2893, 2913, 2936, 2966,
-    2997, 3025, 3049, 3070, 3087, 3104, 3115, 3126, 3140, 3157, 3178, 3198,
-    3218, 3236, 3253, 3268, 3279, 3287, 3294, 3302, 3307, 3311, 3313, 3315,
-    3318, 3320, 3324, 3330, 3339, 3344, 3338, 3326, 3311, 3300, 3290, 3276,
-    3257, 3237, 3217, 3196, 3170, 3140, 3111, 3090, 3073, 3056, 3034, 3007,
-    2979, 2948, 2914, 2876, 2837, 2800, 2764, 2726, 2685, 2639, 2589, 2533,
-    2470, 2401, 2325, 2243, 2156, 2064, 1967, 1865, 1755, 1639, 1520, 1401,
-    1285, 1166, 1039, 901, 757, 612, 469, 327, 182, 34, -114, -261,
-    -410, -562, -715, -863, -1001, -1130, -1257, -1384, -1510, -1636, -1757, -1876,
-    -1989, -2097, -2198, -2292, -2383, -2470, -2552, -2628, -2700, -2769, -2836, -2899,
-    -2956, -3009, -3061, -3113, -3164, -3213, -3259, -3300, -3334, -3364, -3394, -3430,
-    -3470, -3507, -3537, -3559, -3579, -3603, -3629, -3651, -3667, -3681, -3698, -3716,
-    -3728, -3731, -3728, -3722, -3714, -3703, -3687, -3670, -3653, -3635, -3612, -3579,
-    -3540, -3499, -3457, -3410, -3359, -3307, -3257, -3207, -3155, -3101, -3045, -2991,
-    -2939, -2888, -2836, -2783, -2726, -2668, -2612, -2561, -2513, -2468, -2426, -2383,
-    -2338, -2294, -2255, -2219, -2177, -2133, -2094, -2063, -2033, -1996, -1953, -1906,
-    -1858, -1811, -1764, -1718, -1672, -1631, -1586, -1533, -1472, -1412, -1352, -1287,
-    -1218, -1148, -1076, -1006, -940, -872, -800, -730, -668, -610, -545, -479,
-    -416, -356, -282, -216, -153, -94, -43, 5, 63, 129, 187, 228,
-    288, 350, 396, 427, 464, 502, 538, 582, 628, 649, 688, 708,
-    723, 732, 751, 765, 776, 794, 819, 825, 836, 838, 851, 842,
-    832, 839, 840, 801, 797, 781, 732, 708, 700, 677, 647, 640,
-    619, 557, 523, 491, 459, 417, 394, 383, 336, 317, 292, 269,
-    245, 197, 163, 153, 132, 113, 89, 86, 61, 27, 46, 51,
-    53, 56, 59, 39, 69, 74, 103, 125, 164, 174, 188, 216,
-    259, 263, 293, 338, 339, 411, 431, 396, 462, 480, 482, 486,
-    501, 537, 628, 570, 603, 631, 621, 633, 686, 678, 712, 779,
-    833, 863, 871, 891, 958, 966, 1030, 1061, 1127, 1161, 1172, 1170,
-    1306, 1350, 1297, 1407, 1475, 1665, 1675, 1621, 1721, 1737, 1876, 1786,
-    1775, 1862, 1836, 1808, 1849, 1885, 1936, 1994, 1989, 2005, 2019, 1917,
-    2079, 2083, 2004, 2735, 5919, 8796, 8611, 8350, 7999, 7425, 6992, 6455,
-    5635, 4889, 4271, 3380, 2849, 2144, 1347, 1778, 1078, 623, 557, 982,
-    1673, 1198, 608, 661, 1955, 2162, 3709, 4100, 5062, 6300, 7406, 7811,
-    7932, 7541, 6343, 3600, 381, -2821, -5534, -7354, -9186, -9813, -9108, -10331,
-    -12438, -15800, -15424, -11512, -8689, -7496, -5352, 903, 8156, 12092, 9560, 11835,
-    14600, 16023, 15279, 16169, 19451, 20107, 19658, 17879, 12968, -2908, -12373, 2497,
-    13553, 4004, 890, 1397, 2815, 823, 2671, 2079, -1694, 1368, 9997, 18682,
-    20458, 21244, 20994, 20576, 19346, 17161, 14846, 12975, 10628, 7242, 3392, 913,
-    -1091, -2349, -3616, -5167, -5982, -6901, -7699, -8540, -8997, -9367, -9909, -10337,
-    -10854, -10750, -10780, -10829, -11135, -10736, -10422, -9516, -9143, -8750, -8217, -7673,
-    -6059, -4332, -5480, -8201, -9336, -9367, -9073, -8426, -7966, -6775, -4709, -2601,
-    -23, 3596, 7129, 10314, 11922, 13937, 15388, 17042, 18146, 19144, 20220, 21088,
-    21689, 22202, 22723, 22819, 22777, 22946, 22840, 22677, 22664, 23042, 22644, 22664,
-    21959, 21429, 21042, 20823, 20355, 19982, 19260, 18669, 17680, 17309, 16398, 15032,
-    13627, 12735, 12591, 13344, 14372, 14531, 14612, 14549, 14086, 13744, 13416, 11937,
-    9465, 5575, 1232, -3489, -7403, -11026, -14698, -17528, -20181, -22660, -24911, -26749,
-    -28083, -29091, -29583, -30220, -30705, -30569, -30172, -30166, -30254, -29832, -29641, -29374,
-    -28710, -28385, -27847, -27134, -26549, -25672, -24542, -24109, -24699, -25518, -25858, -25594,
-    -25069, -24367, -23803, -23027, -22516, -21616, -20124, -18146, -15594, -13432, -10735, -7443,
-    -4359, -1864, -130, 1144, 2101, 3144, 3840, 4321, 4953, 5396, 5789, 6330,
-    6793, 7215, 7590, 7792, 7683, 7373, 7111, 6933, 6890, 6726, 6526, 6147,
-    5827, 5383, 4858, 4432, 4142, 3815, 3458, 2778, 1576, 812, 1019, 2209,
-    3626, 4882, 5738, 6469, 6879, 6421, 4927, 2911, 860, -1215, -4014, -7163,
-    -10121, -12126, -13595, -14822, -15975, -16924, -17793, -18506, -19245, -19811, -20010, -20098,
-    -20146, -20437, -20606, -20546, -20226, -19734, -19237, -18866, -18482, -17905, -17294, -16871,
-    -16412, -15888, -15344, -14637, -13750, -12895, -12072, -11188, -10230, -8991, -7712, -7108,
-    -7177, -7604, -7996, -8321, -8537, -8559, -8342, -7964, -7003, -5150, -2900, 181,
-    3580, 6993, 9449, 11562, 13514, 15301, 16733, 18126, 19355, 20533, 21617, 22493,
-    22969, 23394, 23866, 24202, 24513, 24623, 24625, 24559, 24503, 24368, 24257, 24102,
-    23772, 23319, 22875, 22424, 21788, 20906, 19825, 18547, 17250, 15998, 14920, 13766,
-    12413, 11007, 9664, 8392, 7124, 5835, 5020, 4820, 4844, 5005, 5407, 5997,
-    6325, 6433, 6738, 6920, 6335, 5020, 2798, -55, -3077, -5811, -7585, -9176,
-    -10727, -12117, -13270, -14091, -14741, -15345, -15962, -16730, -17323, -17570, -16990, -16752,
-    -16742, -16625, -16365, -16154, -15819, -15422, -14981, -14436, -13706, -13048, -12519, -12302,
-    -11958, -11627, -11250, -10667, -9787, -8890, -8108, -7383, -6543, -5685, -4817, -3932,
-    -3061, -2503, -2408, -2447, -2786, -3189, -3407, -3746, -3913, -3943, -3917, -3876,
-    -3416, -1764, 1011, 4189, 7321, 9722, 11748, 13545, 15216, 16703, 17994, 19194,
-    20246, 21161, 21787, 22351, 22802, 23033, 23120, 23172, 23181, 23165, 23031, 22953,
-    22757, 22508, 22120, 21774, 21343, 20968, 20552, 19963, 19363, 18867, 18300, 17545,
-    16572, 15743, 15008, 14268, 13385, 12582, 11860, 11201, 10522, 9827, 8915, 7759,
-    6505, 5285, 3938, 2641, 1834, 1421, 1294, 1371, 1401, 1612, 1734, 1643,
-    1332, 1067, 712, 446, 24, -1262, -2820, -4280, -5866, -7465, -9025, -10525,
-    -11929, -13235, -14461, -15418, -16283, -16982, -17578, -18081, -18455, -18655, -18625, -18637,
-    -18713, -18561, -18226, -17886, -17599, -17394, -17093, -16752, -16509, -16295, -16081, -15920,
-    -15799, -15568, -15447, -15302, -15068, -14835, -14600, -14247, -13895, -13604, -13296, -12937,
-    -12422, -11860, -11353, -10695, -9567, -8196, -6798, -6011, -5694, -5533, -5430, -5451,
-    -5428, -5276, -5035, -4620, -3879, -2898, -1846, -1076, -60, 1317, 2887, 4589,
-    6260, 7990, 9739, 11291, 12609, 13788, 14916, 16083, 16980, 17574, 18031, 18252,
-    18382, 18411, 18258, 18105, 17890, 17723, 17551, 17235, 16824, 16289, 15631, 14954,
-    14219, 13524, 12817, 12072, 11304, 10490, 9659, 8879, 8084, 7448, 6742, 6056,
-    5500, 4932, 4334, 3520, 2770, 2081, 1322, 334, -584, -1506, -2441, -3329,
-    -4268, -5258, -6400, -7612, -8400, -8588, -8598, -8556, -8598, -8783, -9067, -9367,
-    -9722, -10080, -10408, -10675, -11007, -11259, -11545, -11936, -12244, -12378, -12686, -13383,
-    -14469, -15688, -16952, -18191, -19310, -20250, -21102, -21968, -22538, -23006, -23311, -23421,
-    -23411, -23270, -23073, -22847, -22595, -22118, -21316, -20531, -19821, -19196, -18577, -17823,
-    -17080, -16371, -15656, -14907, -14108, -13344, -12764, -12145, -11449, -10674, -9821, -8907,
-    -8015, -7088, -6110, -5093, -4173, -3102, -1960, -768, 434, 1595, 2747, 4008,
-    5257, 6451, 7565, 8565, 9395, 10157, 10890, 11142, 11105, 10899, 10637, 10366,
-    10072, 9836, 9680, 9760, 9861, 10053, 10389, 10871, 11445, 11996, 12487, 12897,
-    13658, 14692, 15791, 16883, 17951, 19005, 20030, 20883, 21601, 22213, 22600, 22774,
-    22924, 22910, 22852, 22662, 22494, 22105, 21573, 21159, 20742, 20252, 19681, 19025,
-    18428, 17841, 17255, 16748, 16300, 15815, 15300, 14711, 13926, 13124, 12354, 11691,
-    11050, 10427, 9740, 9012, 8319, 7602, 6785, 5673, 4566, 3427, 2270, 1131,
-    67, -809, -1691, -2648, -3379, -3968, -4473, -5089, -5735, -6353, -6952, -7623,
-    -8162, -8463, -8674, -8871, -9030, -9086, -9110, -9145, -9179, -9307, -9576, -9920,
-    -10308, -10620, -10983, -11354, -11702, -12119, -12417, -12754, -13198, -13728, -14195, -14441,
-    -14449, -14567, -14635, -14410, -14696, -15217, -15818, -16347, -16766, -17080, -17431, -17659,
-    -17732, -17691, -17597, -17080, -16412, -15717, -15149, -14552, -13972, -13394, -12840, -12281,
-    -11762, -11197, -10635, -10081, -9555, -9031, -8512, -8033, -7477, -6840, -6103, -5515,
-    -4873, -4076, -3135, -2001, -790, 386, 1590, 2892, 4142, 5236, 6312, 7222,
-    8058, 8706, 9359, 10032, 10669, 11332, 11895, 12461, 13046, 13543, 14054, 14641,
-    15076, 15327, 15629, 16242, 16816, 16834, 16675, 16623, 16655, 16387, 15970, 15696,
-    15546, 15275, 15049, 14934, 14999, 15100, 15192, 15314, 15439, 15595, 15779, 15795,
-    15848, 16307, 17012, 17571, 18058, 18548, 18998, 19410, 19685, 19679, 19135, 18498,
-    17719, 16959, 16192, 15430, 14684, 13943, 13250, 12554, 11871, 11232, 10522, 9842,
-    9295, 8765, 8222, 7650, 7006, 6391, 5844, 5315, 4751, 4222, 3686, 3232,
-    2868, 2416, 1930, 1427, 936, -145, -1508, -2746, -3975, -5346, -6654, -7905,
-    -8971, -9745, -10491, -11236, -11917, -12590, -13197, -13792, -14335, -14933, -15548, -16179,
-    -16795, -17336, -17925, -18417, -18807, -19136, -19420, -19610, -19867, -20152, -20337, -20442,
-    -20429, -20355, -20315, -20183, -19986, -19731, -19507, -19394, -19306, -19212, -19103, -19131,
-    -19200, -19236, -19379, -19462, -19557, -19620, -19643, -19644, -19678, -19651, -19535, -19585,
-    -19663, -19654, -19577, -19521, -19473, -19255, -19081, -19048, -19191, -19191, -19178, -18699,
-    -18126, -17509, -16867, -16208, -15523, -14825, -14139, -13467, -12750, -12115, -11516, -10995,
-    -10442, -9858, -9307, -8742, -8199, -7701, -7135, -6530, -5983, -5436, -4897, -4288,
-    -3560, -2868, -2154, -1398, -170, 1251, 2646, 4061, 5528, 6780, 7708, 8561,
-    9468, 10368, 11126, 11850, 12629, 13324, 13939, 14564, 15235, 15867, 16422, 16953,
-    17431, 17816, 18206, 18602, 19002, 19308, 19567, 19869, 20062, 20209, 20287, 20298,
-    20298, 20392, 20449, 20372, 20320, 20119, 19768, 19471, 19278, 19018, 18710, 18442,
-    18189, 17950, 17780, 17627, 17500, 17348, 17201, 17102, 17043, 16980, 16904, 16776,
-    16689, 16589, 16486, 16433, 16473, 16514, 16515, 16418, 16321, 16463, 16686, 16594,
-    15993, 15391, 14714, 14124, 13510, 12962, 12462, 11997, 11509, 10985, 10515, 10098,
-    9639, 9223, 8757, 8309, 7850, 7366, 6950, 6495, 6070, 5598, 5105, 4535,
-    4026, 3461, 2938, 2475, 1986, 1500, 990, 474, -296, -1628, -2941, -4136,
-    -4933, -5773, -6567, -7353, -8085, -8834, -9555, -10205, -10808, -11413, -12064, -12638,
-    -13154, -13707, -14327, -14866, -15400, -15826, -16235, -16600, -17004, -17400, -17732, -18002,
-    -18253, -18558, -18836, -19074, -19247, -19352, -19458, -19603, -19703, -19632, -19440, -19260,
-    -18982, -18609, -18334, -18133, -17902, -17653, -17430, -17254, -17128, -17043, -16919, -16672,
-    -16381, -16112, -15925, -15698, -15481, -15290, -15112, -14891, -14682, -14486, -14263, -14036,
-    -13877, -13675, -13514, -13287, -12944, -12451, -11974, -11426, -10812, -10208, -9614, -9071,
-    -8561, -8028, -7561, -7133, -6666, -6144, -5641, -5183, -4732, -4261, -3781, -3199,
-    -2539, -1955, -1292, -699, -154, 365, 873, 1388, 1912, 2308, 2665, 3079,
-    3468, 3866, 4277, 4590, 4829, 5139, 5469, 6142, 6913, 7646, 8383, 9106,
-    9773, 10397, 10973, 11591, 12180, 12760, 13320, 13883, 14411, 14925, 15336, 15778,
-    16178, 16624, 16972, 17375, 17709, 18043, 18308, 18531, 18775, 18975, 19107, 19205,
-    19315, 19467, 19666, 19743, 19839, 19903, 19928, 19917, 19880, 19826, 19795, 19744,
-    19651, 19497, 19376, 19239, 19084, 18873, 18684, 18530, 18339, 18139, 17960, 17767,
-    17427, 16970, 16455, 15886, 15334, 14792, 14324, 13922, 13504, 13049, 12639, 12311,
-    12004, 11697, 11364, 11070, 10622, 10126, 9609, 9070, 8507, 7946, 7401, 6901,
-    6408, 5957, 5518, 5080, 4628, 4163, 3564, 2867, 2159, 1507, 834, 202,
-    -415, -1029, -1657, -2205, -2787, -3360, -3892, -4358, -4832, -5247, -5702, -6045,
-    -6258, -6496, -6743, -7026, -7299, -7549, -7765, -7984, -8165, -8298, -8458, -8656,
-    -8820, -8937, -8996, -9128, -9267, -9455, -9651, -9998, -10635, -11303, -12011, -12720,
-    -13438, -14112, -14710, -15299, -15876, -16434, -16937, -17420, -17880, -18374, -18832, -19260,
-    -19726, -20140, -20517, -20815, -21106, -21346, -21522, -21667, -21850, -21991, -22122, -22215,
-    -22325, -22412, -22479, -22473, -22460, -22417, -22414, -22352, -22282, -22191, -22046, -21918,
-    -21764, -21603, -21438, -21253, -21047, -20826, -20574, -20334, -20076, -19880, -19618, -19194,
-    -18712, -18210, -17715, -17158, -16648, -16168, -15713, -15288, -14916, -14574, -14258, -13892,
-    -13488, -13159, -12801, -12518, -12082, -11501, -10922, -10346, -9756, -9138, -8563, -7994,
-    -7455, -6893, -6342, -5827, -5344, -4697, -3923, -3174, -2425, -1711, -996, -260,
-    482, 1210, 1872, 2506, 3100, 3703, 4329, 4901, 5427, 5884, 6321, 6673,
-    7025, 7394, 7720, 8002, 8257, 8540, 8848, 9125, 9389, 9664, 9962, 10248,
-    10516, 10767, 10999, 11214, 11423, 11643, 11868, 12106, 12472, 12985, 13519, 14084,
-    14633, 15134, 15633, 16173, 16738, 17289, 17811, 18338, 18848, 19319, 19765, 20201,
-    20650, 21108, 21534, 21929, 22324, 22707, 23030, 23336, 23611, 23882, 24141, 24385,
-    24594, 24768, 24930, 25085, 25187, 25263, 25327, 25373, 25398, 25398, 25383, 25347,
-    25283, 25193, 25086, 24946, 24776, 24582, 24360, 24119, 23873, 23620, 23337, 23037,
-    22730, 22383, 22015, 21616, 21202, 20738, 20285, 19825, 19342, 18850, 18357, 17846,
-    17328, 16791, 16236, 15708, 15173, 14612, 14039, 13468, 12915, 12356, 11789, 11214,
-    10640, 10081, 9520, 8947, 8378, 7837, 7303, 6732, 6177, 5508, 4713, 3895,
-    3076, 2258, 1446, 668, -80, -792, -1481, -2169, -2843, -3481, -4110, -4747,
-    -5360, -5805, -6199, -6605, -7005, -7405, -7803, -8184, -8554, -8911, -9279, -9630,
-    -9978, -10347, -10706, -11049, -11391, -11748, -12097, -12444, -12770, -13067, -13369, -13662,
-    -13952, -14227, -14498, -14782, -15068, -15346, -15607, -15861, -16104, -16335, -16571, -16797,
-    -17039, -17292, -17529, -17776, -18022, -18228, -18444, -18658, -18854, -19059, -19260, -19473,
-    -19675, -19919, -20146, -20352, -20553, -20746, -20934, -21113, -21295, -21491, -21683, -21861,
-    -21988, -22104, -22252, -22395, -22503, -22588, -22644, -22683, -22722, -22738, -22742, -22735,
-    -22729, -22715, -22678, -22622, -22536, -22425, -22300, -22158, -21993, -21810, -21631, -21432,
-    -21193, -20924, -20621, -20292, -19951, -19583, -19204, -18802, -18384, -17957, -17508, -17041,
-    -16552, -16055, -15543, -15013, -14483, -13933, -13378, -12823, -12267, -11713, -11155, -10566,
-    -9982, -9403, -8822, -8237, -7662, -7096, -6522, -5961, -5345, -4559, -3741, -2976,
-    -2214, -1465, -725, 10, 731, 1409, 2071, 2695, 3285, 3849, 4411, 4952,
-    5386, 5733, 6062, 6367, 6651, 6939, 7222, 7494, 7755, 8009, 8259, 8504,
-    8750, 8987, 9228, 9475, 9730, 9983, 10215, 10448, 10697, 10943, 11187, 11437,
-    11701, 11950, 12191, 12431, 12683, 12941, 13195, 13439, 13691, 13951, 14211, 14464,
-    14711, 14952, 15187, 15416, 15615, 15815, 16031, 16258, 16481, 16689, 16874, 17049,
-    17227, 17397, 17560, 17733, 17895, 18057, 18215, 18353, 18489, 18617, 18745, 18860,
-    18970, 19085, 19192, 19306, 19431, 19549, 19653, 19746, 19845, 19942, 20024, 20104,
-    20185, 20266, 20348, 20425, 20485, 20534, 20565, 20584, 20601, 20604, 20601, 20585,
-    20554, 20502, 20415, 20313, 20202, 20066, 19911, 19736, 19544, 19345, 19129, 18888,
-    18624, 18347, 18042, 17707, 17357, 16989, 16600, 16198, 15780, 15344, 14901, 14457,
-    13991, 13502, 12995, 12483, 11976, 11466, 10949, 10417, 9863, 9304, 8748, 8201,
-    7654, 7098, 6554, 5965, 5228, 4406, 3607, 2833, 2075, 1333, 599, -104,
-    -781, -1444, -2086, -2697, -3271, -3834, -4339, -4713, -5021, -5326, -5615, -5903,
-    -6190, -6475, -6759, -7031, -7280, -7518, -7750, -7975, -8202, -8433, -8674, -8923,
-    -9174, -9418, -9645, -9867, -10090, -10317, -10566, -10830, -11104, -11382, -11658, -11944,
-    -12226, -12489, -12750, -13009, -13269, -13533, -13800, -14072, -14353, -14627, -14895, -15165,
-    -15423, -15668, -15917, -16162, -16401, -16637, -16854, -17066, -17291, -17520, -17734, -17945,
-    -18154, -18348, -18541, -18737, -18920, -19085, -19243, -19410, -19574, -19719, -19856, -19986,
-    -20105, -20209, -20300, -20382, -20457, -20524, -20578, -20618, -20649, -20675, -20693, -20693,
-    -20675, -20651, -20628, -20598, -20561, -20516, -20446, -20360, -20265, -20151, -20031, -19899,
-    -19749, -19590, -19426, -19251, -19074, -18901, -18710, -18492, -18265, -18024, -17772, -17514,
-    -17257, -16997, -16709, -16399, -16079, -15748, -15415, -15072, -14715, -14345, -13961, -13566,
-    -13159, -12748, -12343, -11928, -11496, -11048, -10587, -10122, -9659, -9187, -8705, -8222,
-    -7750, -7280, -6804, -6294, -5672, -4943, -4199, -3464, -2736, -2025, -1338, -674,
-    -9, 647, 1281, 1912, 2528, 3134, 3696, 4166, 4592, 4975, 5311, 5640,
-    5965, 6285, 6593, 6872, 7145, 7408, 7646, 7869, 8083, 8286, 8483, 8674,
-    8860, 9044, 9225, 9396, 9557, 9710, 9858, 10001, 10142, 10286, 10436, 10588,
-    10742, 10896, 11047, 11196, 11347, 11499, 11659, 11832, 12018, 12216, 12421, 12625,
-    12819, 13011, 13213, 13427, 13649, 13875, 14117, 14374, 14635, 14888, 15136, 15387,
-    15641, 15898, 16153, 16409, 16674, 16941, 17207, 17476, 17741, 17999, 18245, 18479,
-    18699, 18908, 19120, 19325, 19524, 19718, 19899, 20082, 20253, 20398, 20531, 20653,
-    20770, 20882, 20985, 21085, 21171, 21240, 21304, 21354, 21386, 21406, 21418, 21422,
-    21415, 21402, 21385, 21356, 21308, 21240, 21149, 21035, 20911, 20778, 20624, 20454,
-    20264, 20051, 19818, 19556, 19279, 18997, 18696, 18378, 18048, 17709, 17364, 17012,
-    16645, 16263, 15868, 15469, 15061, 14637, 14202, 13756, 13302, 12858, 12415, 11962,
-    11501, 11032, 10585, 10141, 9674, 9203, 8722, 8245, 7791, 7335, 6865, 6386,
-    5925, 5406, 4724, 3975, 3249, 2519, 1793, 1075, 369, -318, -1013, -1704,
-    -2387, -3048, -3679, -4306, -4847, -5256, -5615, -5969, -6317, -6640, -6953, -7280,
-    -7591, -7880, -8156, -8410, -8658, -8902, -9138, -9358, -9565, -9781, -9983, -10163,
-    -10347, -10533, -10704, -10870, -11038, -11193, -11337, -11484, -11616, -11741, -11871, -11997,
-    -12112, -12219, -12323, -12423, -12533, -12650, -12764, -12882, -13007, -13131, -13256, -13369,
-    -13481, -13606, -13732, -13861, -13998, -14143, -14292, -14446, -14605, -14763, -14923, -15099,
-    -15280, -15470, -15672, -15864, -16054, -16246, -16444, -16633, -16814, -17010, -17209, -17412,
-    -17613, -17793, -17977, -18157, -18331, -18509, -18673, -18830, -18986, -19136, -19293, -19444,
-    -19592, -19739, -19881, -20016, -20140, -20262, -20385, -20509, -20628, -20715, -20785, -20856,
-    -20920, -20981, -21039, -21087, -21125, -21144, -21144, -21131, -21105, -21074, -21039, -21000,
-    -20960, -20906, -20835, -20747, -20635, -20523, -20409, -20273, -20123, -19951, -19757, -19554,
-    -19333, -19101, -18859, -18601, -18325, -18025, -17708, -17382, -17044, -16702, -16359, -16009,
-    -15650, -15280, -14894, -14491, -14076, -13654, -13221, -12781, -12333, -11874, -11413, -10943,
-    -10456, -9964, -9462, -8963, -8463, -7948, -7426, -6901, -6349, -5683, -4878, -4040,
-    -3218, -2399, -1590, -797, -24, 740, 1482, 2210, 2935, 3591, 4165, 4672,
-    5101, 5498, 5889, 6270, 6654, 7020, 7368, 7710, 8026, 8321, 8615, 8907,
-    9196, 9474, 9737, 9997, 10251, 10489, 10716, 10927, 11127, 11321, 11507, 11687,
-    11868, 12053, 12237, 12417, 12581, 12732, 12889, 13048, 13210, 13375, 13538, 13698,
-    13848, 13995, 14148, 14298, 14444, 14579, 14718, 14873, 15033, 15195, 15355, 15519,
-    15691, 15862, 16033, 16210, 16392, 16584, 16783, 16976, 17168, 17360, 17559, 17778,
-    17996, 18204, 18407, 18593, 18776, 18967, 19162, 19362, 19556, 19746, 19930, 20101,
-    20275, 20447, 20615, 20783, 20948, 21109, 21252, 21384, 21506, 21608, 21706, 21811,
-    21920, 22026, 22122, 22207, 22280, 22347, 22408, 22455, 22490, 22518, 22532, 22529,
-    22518, 22496, 22461, 22417, 22364, 22306, 22235, 22151, 22072, 21992, 21906, 21805,
-    21682, 21557, 21421, 21263, 21096, 20925, 20747, 20560, 20356, 20131, 19903, 19659,
-    19401, 19148, 18886, 18612, 18334, 18045, 17752, 17444, 17120, 16786, 16434, 16079,
-    15720, 15350, 14967, 14574, 14172, 13759, 13343, 12921, 12491, 12057, 11620, 11177,
-    10737, 10305, 9865, 9411, 8965, 8516, 8058, 7597, 7134, 6677, 6197, 5628,
-    4930, 4131, 3297, 2448, 1594, 755, -88, -942, -1776, -2585, -3372, -4122,
-    -4857, -5537, -6068, -6490, -6893, -7287, -7674, -8059, -8453, -8847, -9229, -9604,
-    -9969, -10325, -10671, -11010, -11345, -11671, -11997, -12324, -12636, -12935, -13224, -13497,
-    -13759, -14021, -14287, -14551, -14807, -15046, -15278, -15504, -15726, -15948, -16161, -16364,
-    -16566, -16765, -16956, -17140, -17321, -17486, -17642, -17794, -17934, -18075, -18222, -18366,
-    -18509, -18646, -18777, -18904, -19023, -19125, -19219, -19318, -19411, -19497, -19584, -19655,
-    -19713, -19771, -19835, -19895, -19944, -19989, -20030, -20065, -20096, -20128, -20158, -20179,
-    -20198, -20215, -20226, -20230, -20232, -20233, -20231, -20219, -20199, -20176, -20149, -20115,
-    -20079, -20037, -19989, -19940, -19883, -19826, -19769, -19709, -19653, -19591, -19519, -19442,
-    -19360, -19273, -19187, -19102, -19008, -18893, -18770, -18648, -18522, -18393, -18263, -18130,
-    -17996, -17861, -17717, -17565, -17409, -17247, -17083, -16916, -16746, -16572, -16388, -16202,
-    -16014, -15818, -15617, -15413, -15206, -14994, -14779, -14563, -14346, -14125, -13901, -13679,
-    -13449, -13208, -12965, -12718, -12462, -12200, -11936, -11674, -11415, -11147, -10859, -10564,
-    -10272, -9980, -9694, -9409, -9116, -8821, -8524, -8222, -7915, -7607, -7300, -7002,
-    -6711, -6439, -6193, -5964, -5749, -5536, -5281, -4970, -4628, -4273, -3905, -3514,
-    -3095, -2657, -2208, -1742, -1260, -766, -253, 261, 763, 1256, 1740, 2215,
-    2689, 3159, 3629, 4110, 4554, 4908, 5215, 5524, 5828, 6122, 6420, 6713,
-    7007, 7312, 7618, 7920, 8215, 8497, 8770, 9048, 9330, 9603, 9871, 10143,
-    10419, 10688, 10946, 11199, 11447, 11684, 11921, 12170, 12426, 12677, 12916, 13143,
-    13364, 13583, 13801, 14017, 14231, 14436, 14634, 14825, 15017, 15211, 15403, 15584,
-    15760, 15935, 16105, 16270, 16433, 16597, 16762, 16926, 17086, 17235, 17377, 17514,
-    17648, 17774, 17890, 18000, 18111, 18220, 18316, 18402, 18489, 18568, 18636, 18698,
-    18754, 18806, 18861, 18913, 18953, 18980, 18992, 18994, 19000, 19006, 19002, 18993,
-    18979, 18956, 18926, 18891, 18850, 18807, 18765, 18717, 18670, 18622, 18568, 18511,
-    18448, 18379, 18313, 18248, 18174, 18094, 18015, 17933, 17848, 17761, 17673, 17588,
-    17501, 17405, 17304, 17205, 17102, 16996, 16890, 16774, 16648, 16524, 16405, 16282,
-    16153, 16018, 15879, 15740, 15604, 15469, 15326, 15177, 15023, 14864, 14704, 14545,
-    14381, 14209, 14041, 13879, 13713, 13543, 13373, 13200, 13021, 12841, 12664, 12490,
-    12309, 12112, 11898, 11663, 11407, 11133, 10850, 10561, 10262, 9950, 9637, 9332,
-    9041, 8766, 8510, 8269, 8041, 7821, 7608, 7398, 7187, 6970, 6752, 6533,
-    6307, 6078, 5850, 5611, 5360, 5107, 4845, 4536, 4169, 3775, 3379, 2985,
-    2590, 2197, 1805, 1418, 1030, 640, 248, -142, -530, -913, -1291, -1670,
-    -2051, -2432, -2811, -3189, -3569, -3946, -4323, -4701, -5074, -5417, -5711, -5964,
-    -6205, -6452, -6701, -6948, -7197, -7447, -7690, -7922, -8149, -8377, -8612, -8847,
-    -9074, -9296, -9520, -9740, -9953, -10162, -10367, -10569, -10770, -10964, -11152, -11343,
-    -11541, -11736, -11924, -12106, -12283, -12457, -12625, -12790, -12959, -13124, -13274, -13416,
-    -13559, -13706, -13855, -13999, -14139, -14284, -14433, -14575, -14709, -14843, -14980, -15121,
-    -15263, -15401, -15539, -15680, -15819, -15960, -16108, -16252, -16391, -16530, -16671, -16806,
-    -16941, -17079, -17214, -17341, -17461, -17573, -17686, -17800, -17911, -18014, -18110, -18203,
-    -18295, -18377, -18447, -18517, -18591, -18661, -18722, -18783, -18843, -18901, -18958, -19017,
-    -19076, -19135, -19196, -19248, -19290, -19337, -19390, -19440, -19486, -19524, -19556, -19583,
-    -19608, -19626, -19645, -19669, -19688, -19697, -19704, -19704, -19695, -19682, -19662, -19633,
-    -19596, -19550, -19506, -19469, -19438, -19415, -19396, -19382, -19376, -19372, -19366, -19353,
-    -19323, -19273, -19206, -19121, -19012, -18878, -18723, -18552, -18372, -18177, -17961, -17728,
-    -17488, -17249, -17012, -16768, -16511, -16247, -15976, -15703, -15425, -15141, -14856, -14565,
-    -14266, -13963, -13663, -13354, -13031, -12708, -12379, -12033, -11682, -11328, -10963, -10592,
-    -10211, -9825, -9438, -9041, -8629, -8210, -7789, -7365, -6948, -6523, -6082, -5661,
-    -5218, -4656, -4006, -3354, -2702, -2045, -1396, -747, -97, 547, 1186, 1825,
-    2461, 3092, 3721, 4345, 4947, 5488, 5941, 6336, 6722, 7103, 7476, 7851,
-    8223, 8582, 8929, 9265, 9590, 9912, 10237, 10562, 10888, 11211, 11527, 11830,
-    12129, 12428, 12716, 12988, 13259, 13526, 13784, 14043, 14298, 14540, 14775, 14994,
-    15194, 15393, 15594, 15785, 15975, 16159, 16332, 16496, 16652, 16795, 16927, 17051,
-    17166, 17278, 17395, 17510, 17611, 17699, 17781, 17857, 17927, 17988, 18051, 18118,
-    18174, 18223, 18276, 18332, 18393, 18459, 18519, 18568, 18615, 18664, 18711, 18753,
-    18801, 18851, 18897, 18937, 18978, 19020, 19058, 19090, 19122, 19156, 19185, 19208,
-    19231, 19252, 19275, 19295, 19307, 19313, 19318, 19323, 19332, 19335, 19331, 19330,
-    19336, 19344, 19348, 19333, 19306, 19271, 19223, 19157, 19070, 18968, 18861, 18751,
-    18646, 18549, 18459, 18376, 18302, 18238, 18181, 18133, 18088, 18041, 18003, 17969,
-    17936, 17907, 17879, 17855, 17827, 17781, 17736, 17684, 17624, 17568, 17498, 17421,
-    17340, 17250, 17160, 17063, 16955, 16856, 16749, 16634, 16515, 16383, 16248, 16113,
-    15970, 15822, 15663, 15495, 15320, 15140, 14961, 14782, 14596, 14404, 14202, 14000,
-    13793, 13574, 13356, 13131, 12894, 12648, 12400, 12153, 11902, 11648, 11383, 11108,
-    10831, 10555, 10275, 9987, 9693, 9395, 9086, 8767, 8446, 8122, 7790, 7447,
-    7107, 6772, 6421, 6075, 5726, 5375, 4999, 4503, 3912, 3330, 2748, 2158,
-    1573, 981, 403, -164, -732, -1299, -1874, -2435, -2992, -3559, -4112, -4666,
-    -5186, -5595, -5946, -6303, -6654, -6995, -7322, -7637, -7949, -8264, -8589, -8917,
-    -9243, -9565, -9886, -10198, -10499, -10801, -11098, -11391, -11686, -11969, -12247, -12527,
-    -12796, -13058, -13317, -13563, -13812, -14053, -14284, -14509, -14731, -14959, -15175, -15368,
-    -15555, -15736, -15908, -16069, -16207, -16339, -16475, -16607, -16740, -16870, -16995, -17105,
-    -17208, -17309, -17404, -17496, -17584, -17666, -17749, -17823, -17893, -17969, -18043, -18112,
-    -18174, -18227, -18281, -18332, -18392, -18469, -18555, -18649, -18756, -18870, -18987, -19102,
-    -19220, -19336, -19449, -19553, -19646, -19735, -19814, -19877, -19928, -19957, -19966, -19962,
-    -19938, -19906, -19863, -19812, -19769, -19719, -19665, -19625, -19577, -19522, -19468, -19405,
-    -19343, -19277, -19209, -19152, -19092, -19034, -18981, -18925, -18871, -18816, -18755, -18700,
-    -18640, -18576, -18510, -18434, -18357, -18286, -18208, -18125, -18040, -17951, -17862, -17764,
-    -17659, -17557, -17458, -17358, -17255, -17141, -17027, -16912, -16783, -16641, -16490, -16333,
-    -16175, -16017, -15861, -15707, -15554, -15401, -15239, -15068, -14892, -14707, -14517, -14320,
-    -14116, -13908, -13702, -13509, -13326, -13144, -12958, -12760, -12548, -12332, -12112, -11889,
-    -11658, -11415, -11170, -10934, -10702, -10473, -10243, -10011, -9774, -9527, -9271, -9010,
-    -8744, -8481, -8220, -7954, -7674, -7384, -7096, -6814, -6531, -6246, -5958, -5672,
-    -5387, -5099, -4809, -4472, -4040, -3562, -3084, -2596, -2103, -1619, -1129, -644,
-    -166, 323, 813, 1300, 1787, 2282, 2784, 3288, 3796, 4300, 4809, 5317,
-    5760, 6107, 6416, 6724, 7031, 7340, 7652, 7962, 8267, 8570, 8873, 9177,
-    9491, 9805, 10116, 10425, 10731, 11032, 11337, 11636, 11923, 12210, 12501, 12790,
-    13077, 13366, 13654, 13936, 14208, 14466, 14709, 14930, 15131, 15320, 15492, 15644,
-    15781, 15906, 16022, 16133, 16240, 16354, 16477, 16600, 16715, 16826, 16937, 17048,
-    17166, 17286, 17408, 17532, 17653, 17771, 17890, 18006, 18119, 18238, 18355, 18468,
-    18580, 18679, 18757, 18823, 18885, 18937, 18981, 19017, 19043, 19065, 19087, 19102,
-    19100, 19088, 19071, 19047, 19019, 18983, 18936, 18878, 18808, 18727, 18646, 18563,
-    18472, 18379, 18288, 18189, 18081, 17970, 17850, 17720, 17592, 17468, 17347, 17226,
-    17099, 16968, 16835, 16699, 16565, 16436, 16304, 16172, 16047, 15922, 15789, 15649,
-    15510, 15376, 15244, 15112, 14977, 14844, 14713, 14588, 14465, 14342, 14221, 14098,
-    13966, 13832, 13701, 13568, 13430, 13291, 13153, 13020, 12889, 12752, 12617, 12489,
-    12362, 12234, 12103, 11968, 11839, 11717, 11598, 11480, 11364, 11244, 11116, 10989,
-    10869, 10752, 10638, 10525, 10419, 10319, 10219, 10115, 10009, 9902, 9796, 9690,
-    9586, 9480, 9372, 9263, 9154, 9047, 8946, 8849, 8742, 8627, 8507, 8377,
-    8237, 8094, 7948, 7799, 7651, 7504, 7351, 7193, 7032, 6870, 6703, 6529,
-    6346, 6154, 5958, 5763, 5552, 5307, 5031, 4727, 4397, 4057, 3712, 3359,
-    3008, 2658, 2297, 1925, 1542, 1145, 742, 333, -86, -518, -958, -1408,
-    -1874, -2347, -2823, -3301, -3780, -4262, -4752, -5227, -5647, -6005, -6333, -6646,
-    -6946, -7237, -7520, -7788, -8045, -8292, -8530, -8760, -8988, -9213, -9436, -9650,
-    -9860, -10071, -10283, -10491, -10695, -10895, -11091, -11281, -11462, -11636, -11808, -11978,
-    -12143, -12311, -12481, -12643, -12798, -12946, -13089, -13234, -13376, -13506, -13626, -13745,
-    -13863, -13976, -14090, -14204, -14316, -14426, -14536, -14637, -14735, -14836, -14930, -15014,
-    -15094, -15171, -15240, -15307, -15377, -15447, -15519, -15588, -15653, -15714, -15771, -15823,
-    -15871, -15916, -15960, -16005, -16051, -16090, -16122, -16150, -16181, -16212, -16239, -16257,
-    -16271, -16287, -16305, -16323, -16335, -16334, -16329, -16323, -16316, -16310, -16304, -16294,
-    -16283, -16273, -16266, -16260, -16251, -16236, -16214, -16187, -16163, -16139, -16113, -16081,
-    -16046, -16011, -15984, -15958, -15930, -15895, -15853, -15804, -15753, -15701, -15646, -15588,
-    -15526, -15456, -15378, -15294, -15204, -15111, -15018, -14926, -14830, -14724, -14610, -14493,
-    -14371, -14240, -14104, -13965, -13823, -13675, -13523, -13365, -13203, -13041, -12880, -12715,
-    -12544, -12370, -12189, -11999, -11803, -11608, -11413, -11214, -11014, -10816, -10618, -10415,
-    -10212, -10009, -9805, -9593, -9380, -9174, -8970, -8767, -8566, -8371, -8181, -7997,
-    -7819, -7651, -7493, -7346, -7211, -7077, -6939, -6795, -6651, -6504, -6348, -6195,
-    -6041, -5859, -5616, -5324, -5020, -4718, -4410, -4101, -3799, -3497, -3189, -2882,
-    -2579, -2275, -1971, -1674, -1375, -1077, -786, -507, -240, 24, 284, 544,
-    806, 1063, 1312, 1554, 1799, 2034, 2260, 2491, 2718, 2940, 3165, 3381,
-    3591, 3796, 3999, 4201, 4387, 4556, 4710, 4847, 4975, 5103, 5234, 5363,
-    5487, 5607, 5727, 5844, 5959, 6075, 6196, 6318, 6442, 6568, 6699, 6830,
-    6961, 7089, 7216, 7337, 7456, 7581, 7708, 7834, 7963, 8087, 8213, 8341,
-    8473, 8612, 8755, 8900, 9044, 9189, 9340, 9487, 9633, 9780, 9928, 10079,
-    10229, 10379, 10528, 10669, 10808, 10945, 11089, 11236, 11380, 11525, 11667, 11803,
-    11930, 12050, 12175, 12306, 12440, 12577, 12712, 12849, 12987, 13122, 13255, 13379,
-    13502, 13624, 13743, 13863, 13981, 14101, 14226, 14343, 14456, 14570, 14683, 14795,
-    14902, 15010, 15116, 15219, 15320, 15422, 15529, 15630, 15733, 15836, 15930, 16024,
-    16113, 16201, 16284, 16359, 16442, 16522, 16600, 16679, 16753, 16822, 16886, 16952,
-    17022, 17085, 17147, 17209, 17275, 17334, 17382, 17428, 17465, 17493, 17514, 17523,
-    17528, 17520, 17500, 17471, 17432, 17388, 17339, 17284, 17228, 17167, 17110, 17054,
-    16993, 16934, 16878, 16826, 16774, 16718, 16667, 16611, 16550, 16493, 16437, 16386,
-    16333, 16280, 16230, 16168, 16102, 16029, 15948, 15869, 15784, 15695, 15605, 15512,
-    15421, 15325, 15223, 15107, 14979, 14851, 14708, 14555, 14398, 14233, 14061, 13877,
-    13686, 13488, 13286, 13079, 12858, 12624, 12379, 12124, 11858, 11583, 11303, 11014,
-    10724, 10436, 10137, 9826, 9508, 9181, 8842, 8510, 8169, 7820, 7469, 7103,
-    6745, 6380, 6001, 5607, 5096, 4492, 3893, 3280, 2668, 2061, 1443, 829,
-    206, -414, -1039, -1661, -2285, -2922, -3543, -4165, -4714, -5122, -5505, -5899,
-    -6279, -6662, -7036, -7410, -7781, -8149, -8523, -8886, -9251, -9617, -9968, -10318,
-    -10670, -11016, -11357, -11697, -12025, -12343, -12660, -12966, -13267, -13563, -13857, -14149,
-    -14436, -14718, -14992, -15257, -15510, -15752, -15990, -16214, -16430, -16644, -16845, -17036,
-    -17218, -17390, -17551, -17706, -17857, -18001, -18138, -18268, -18389, -18505, -18613, -18715,
-    -18811, -18896, -18976, -19055, -19129, -19192, -19246, -19298, -19342, -19373, -19396, -19411,
-    -19420, -19426, -19430, -19430, -19422, -19407, -19385, -19362, -19346, -19330, -19312, -19288,
-    -19257, -19235, -19223, -19211, -19200, -19192, -19186, -19179, -19167, -19149, -19127, -19100,
-    -19065, -19025, -18983, -18938, -18882, -18810, -18733, -18646, -18547, -18443, -18327, -18203,
-    -18075, -17934, -17791, -17640, -17485, -17330, -17167, -17001, -16833, -16659, -16475, -16279,
-    -16076, -15880, -15681, -15483, -15293, -15100, -14903, -14708, -14507, -14305, -14098, -13893,
-    -13697, -13499, -13307, -13110, -12902, -12694, -12488, -12284, -12081, -11878, -11672, -11456,
-    -11238, -11022, -10804, -10577, -10354, -10132, -9896, -9662, -9438, -9218, -9004, -8783,
-    -8560, -8339, -8111, -7888, -7671, -7458, -7243, -7026, -6817, -6607, -6402, -6198,
-    -5994, -5791, -5554, -5260, -4956, -4674, -4395, -4107, -3816, -3542, -3272, -2990,
-    -2728, -2469, -2211, -1992, -1750, -1493, -1272, -1042, -809, -586, -355, -137,
-    76, 284, 479, 671, 851, 1023, 1188, 1346, 1503, 1657, 1805, 1953,
-    2089, 2215, 2347, 2487, 2636, 2785, 2920, 3054, 3175, 3274, 3373, 3473,
-    3573, 3674, 3762, 3856, 3958, 4060, 4179, 4296, 4403, 4508, 4598, 4685,
-    4789, 4892, 4991, 5085, 5179, 5290, 5396, 5488, 5585, 5682, 5772, 5855,
-    5951, 6048, 6142, 6260, 6351, 6427, 6549, 6652, 6732, 6845, 6958, 7057,
-    7152, 7240, 7340, 7440, 7537, 7632, 7714, 7796, 7878, 7952, 8032, 8113,
-    8199, 8305, 8424, 8547, 8680, 8818, 8958, 9105, 9264, 9429, 9602, 9776,
-    9951, 10139, 10332, 10528, 10733, 10944, 11164, 11389, 11616, 11848, 12082, 12318,
-    12552, 12779, 13009, 13244, 13480, 13710, 13934, 14158, 14381, 14608, 14836, 15061,
-    15285, 15496, 15698, 15900, 16097, 16274, 16444, 16628, 16807, 16972, 17151, 17324,
-    17480, 17636, 17782, 17928, 18076, 18208, 18343, 18470, 18581, 18688, 18771, 18845,
-    18922, 18988, 19049, 19098, 19141, 19181, 19212, 19240, 19257, 19263, 19263, 19241,
-    19213, 19181, 19132, 19069, 18999, 18927, 18857, 18783, 18702, 18599, 18485, 18367,
-    18233, 18087, 17929, 17765, 17609, 17439, 17253, 17062, 16861, 16651, 16435, 16214,
-    15996, 15770, 15534, 15308, 15080, 14828, 14576, 14322, 14050, 13780, 13506, 13229,
-    12957, 12673, 12390, 12112, 11821, 11534, 11251, 10962, 10673, 10368, 10064, 9770,
-    9471, 9189, 8909, 8625, 8352, 8070, 7779, 7485, 7191, 6898, 6592, 6293,
-    5986, 5603, 5162, 4724, 4295, 3867, 3436, 3009, 2588, 2172, 1766, 1357,
-    940, 530, 126, -274, -660, -1036, -1405, -1758, -2102, -2455, -2803, -3143,
-    -3481, -3811, -4143, -4462, -4745, -5005, -5246, -5481, -5727, -5958, -6187, -6434,
-    -6669, -6877, -7098, -7334, -7551, -7766, -7981, -8174, -8377, -8573, -8737, -8907,
-    -9068, -9211, -9363, -9503, -9632, -9765, -9897, -10026, -10150, -10273, -10390, -10491,
-    -10596, -10704, -10799, -10894, -10993, -11088, -11185, -11278, -11373, -11470, -11563, -11648,
-    -11730, -11805, -11870, -11938, -12015, -12092, -12171, -12244, -12306, -12366, -12433, -12500,
-    -12564, -12639, -12719, -12792, -12867, -12932, -12986, -13042, -13092, -13138, -13187, -13229,
-    -13269, -13329, -13441, -13619, -13883, -14250, -14684, -15163, -15716, -16300, -16877, -17505,
-    -18139, -18609, -18890, -19090, -19225, -19250, -19180, -19031, -18798, -18513, -18216, -17910,
-    -17598, -17297, -17010, -16729, -16460, -16202, -15944, -15693, -15448, -15201, -14954, -14704,
-    -14445, -14187, -13936, -13677, -13413, -13155, -12900, -12645, -12392, -12139, -11888, -11646,
-    -11407, -11162, -10915, -10671, -10428, -10182, -9932, -9677, -9422, -9168, -8917, -8668,
-    -8416, -8156, -7899, -7650, -7407, -7165, -6917, -6659, -6405, -6168, -5930, -5674,
-    -5421, -5193, -4965, -4707, -4441, -4193, -3946, -3682, -3420, -3169, -2912, -2650,
-    -2393, -2134, -1873, -1624, -1376, -1107, -832, -575, -325, -70, 178, 422,
-    673, 915, 1145, 1384, 1629, 1857, 2076, 2304, 2530, 2747, 2991, 3267,
-    3547, 3831, 4132, 4439, 4731, 5027, 5337, 5651, 5967, 6289, 6612, 6933,
-    7260, 7592, 7915, 8229, 8542, 8852, 9153, 9446, 9738, 10031, 10323, 10609,
-    10891, 11174, 11455, 11719, 11970, 12216, 12456, 12682, 12886, 13066, 13224, 13364,
-    13492, 13613, 13728, 13825, 13897, 13957, 14020, 14078, 14126, 14178, 14231, 14272,
-    14305, 14336, 14357, 14368, 14387, 14403, 14398, 14382, 14372, 14355, 14324, 14287,
-    14241, 14189, 14149, 14107, 14041, 13980, 13918, 13603, 12634, 10803, 8283, 5472,
-    2765, 438, -1371, -2627, -3359, -3653, -3637, -3428, -3117, -2777, -2466, -2221,
-    -2049, -1949, -1905, -1901, -1923, -1960, -2012, -2077, -2144, -2199, -2242, -2277,
-    -2306, -2321, -2322, -2318, -2311, -2300, -2291, -2287, -2296, -2316, -2341, -2361,
-    -2375, -2385, -2390, -2388, -2385, -2382, -2373, -2351, -2321, -2295, -2276, -2254,
-    -2228, -2202, -2177, -2152, -2124, -2094, -2062, -2028, -1993, -1958, -1925, -1894,
-    -1863, -1828, -1787, -1745, -1704, -1667, -1636, -1613, -1591, -1564, -1534, -1509,
-    -1491, -1479, -1463, -1440, -1408, -1369, -1335, -1310, -1291, -1277, -1260, -1241,
-    -1222, -1205, -1193, -1189, -1198, -1216, -1239, -1267, -1313, -1384, -1467, -1542,
-    -1609, -1677, -1752, -1829, -1909, -1993, -2079, -2154, -2216, -2269, -2315, -2353,
-    -2385, -2414, -2442, -2465, -2486, -2506, -2528, -2546, -2559, -2559, -2545, -2518,
-    -2478, -2424, -2360, -2293, -2227, -2161, -2093, -2016, -1930, -1843, -1761, -1681,
-    -1587, -1477, -1366, -1257, -1138, -1002, -857, -710, -560, -402, -236, -64,
-    113, 296, 488, 691, 900, 1105, 1310, 1524, 1740, 1949, 2147, 2341,
-    2527, 2707, 2895, 3096, 3300, 3515, 3761, 3967, 3898, 3270, 1961, 95,
-    -2054, -4210, -6156, -7743, -8898, -9620, -9950, -9950, -9688, -9244, -8691, -8089,
-    -7482, -6900, -6363, -5882, -5464, -5102, -4779, -4483, -4209, -3953, -3705, -3452,
-    -3194, -2930, -2660, -2387, -2111, -1832, -1551, -1275, -1010, -757, -512, -274,
-    -42, 193, 433, 674, 912, 1150, 1390, 1621, 1839, 2055, 2277, 2501,
-    2718, 2931, 3140, 3339, 3525, 3708, 3896, 4082, 4259, 4430, 4600, 4770,
-    4937, 5103, 5267, 5430, 5589, 5744, 5890, 6029, 6167, 6306, 6446, 6582,
-    6714, 6839, 6955, 7069, 7183, 7298, 7414, 7533, 7651, 7764, 7869, 7969,
-    8067, 8157, 8235, 8301, 8358, 8405, 8446, 8482, 8513, 8541, 8564, 8584,
-    8596, 8600, 8597, 8593, 8584, 8565, 8539, 8518, 8508, 8504, 8498, 8492,
-    8489, 8482, 8467, 8444, 8417, 8382, 8343, 8308, 8280, 8254, 8229, 8214,
-    8205, 8194, 8178, 8164, 8154, 8142, 8126, 8106, 8081, 8055, 8031, 8011,
-    7990, 7967, 7946, 7924, 7897, 7866, 7833, 7796, 7751, 7703, 7659, 7621,
-    7587, 7556, 7522, 7484, 7443, 7402, 7354, 7297, 7241, 7189, 7135, 7076,
-    7018, 6961, 6904, 6856, 6809, 6751, 6689, 6635, 6505, 6089, 5181, 3735,
-    1861, -264, -2463, -4555, -6403, -7947, -9167, -10056, -10628, -10943, -11068, -11046,
-    -10909, -10699, -10459, -10210, -9976, -9776, -9619, -9503, -9425, -9382, -9367, -9370,
-    -9385, -9408, -9438, -9473, -9510, -9543, -9569, -9592, -9616, -9633, -9638, -9631,
-    -9616, -9596, -9573, -9548, -9525, -9506, -9493, -9479, -9459, -9432, -9401, -9365,
-    -9321, -9275, -9229, -9185, -9140, -9102, -9069, -9035, -8995, -8956, -8921, -8882,
-    -8836, -8789, -8746, -8706, -8662, -8612, -8561, -8508, -8452, -8389, -8317, -8238,
-    -8159, -8075, -7987, -7900, -7820, -7742, -7662, -7580, -7495, -7400, -7295, -7186,
-    -7080, -6975, -6867, -6761, -6655, -6549, -6440, -6335, -6234, -6135, -6031, -5925,
-    -5821, -5719, -5617, -5513, -5406, -5297, -5191, -5090, -4990, -4888, -4788, -4690,
-    -4590, -4480, -4361, -4244, -4128, -4006, -3871, -3727, -3580, -3425, -3260, -3087,
-    -2915, -2747, -2579, -2406, -2228, -2051, -1872, -1690, -1506, -1320, -1133, -943,
-    -750, -553, -353, -154, 44, 244, 450, 662, 880, 1104, 1329, 1555,
-    1781, 2004, 2222, 2437, 2653, 2874, 3097, 3317, 3538, 3761, 3985, 4205,
-    4420, 4631, 4839, 5049, 5262, 5475, 5687, 5909, 6119, 6221, 6053, 5483,
-    4493, 3159, 1598, -67, -1706, -3210, -4508, -5567, -6364, -6898, -7185, -7261,
-    -7159, -6912, -6558, -6132, -5662, -5171, -4684, -4217, -3770, -3349, -2959, -2606,
-    -2283, -1984, -1715, -1473, -1251, -1040, -837, -647, -462, -276, -85, 109,
-    307, 506, 706, 912, 1122, 1329, 1529, 1723, 1917, 2109, 2299, 2491,
-    2688, 2888, 3087, 3286, 3481, 3668, 3848, 4024, 4200, 4375, 4548, 4721,
-    4891, 5056, 5211, 5360, 5506, 5650, 5793, 5934, 6072, 6206, 6337, 6466,
-    6588, 6708, 6830, 6957, 7085, 7208, 7328, 7444, 7552, 7651, 7744, 7834,
-    7922, 8007, 8089, 8168, 8239, 8299, 8353, 8408, 8466, 8524, 8578, 8626,
-    8670, 8707, 8738, 8766, 8795, 8824, 8844, 8850, 8843, 8833, 8821, 8805,
-    8781, 8755, 8732, 8710, 8683, 8653, 8624, 8600, 8575, 8548, 8524, 8510,
-    8504, 8497, 8486, 8471, 8456, 8438, 8414, 8387, 8360, 8335, 8312, 8285,
-    8255, 8219, 8181, 8143, 8106, 8070, 8035, 8001, 7968, 7936, 7901, 7867,
-    7835, 7807, 7780, 7750, 7715, 7679, 7644, 7610, 7571, 7525, 7478, 7437,
-    7403, 7364, 7316, 7263, 7211, 7155, 7089, 7021, 6960, 6877, 6674, 6231,
-    5460, 4348, 2947, 1340, -379, -2117, -3796, -5353, -6746, -7947, -8940, -9724,
-    -10308, -10705, -10943, -11049, -11050, -10969, -10827, -10646, -10448, -10245, -10044, -9856,
-    -9693, -9556, -9446, -9364, -9312, -9288, -9279, -9278, -9285, -9300, -9320, -9340,
-    -9358, -9376, -9393, -9406, -9416, -9427, -9436, -9437, -9435, -9428, -9415, -9388,
-    -9353, -9317, -9283, -9244, -9198, -9154, -9114, -9075, -9030, -8981, -8931, -8888,
-    -8848, -8803, -8754, -8705, -8657, -8610, -8560, -8508, -8456, -8400, -8343, -8286,
-    -8227, -8163, -8099, -8036, -7971, -7896, -7819, -7739, -7650, -7549, -7444, -7340,
-    -7240, -7137, -7032, -6932, -6838, -6748, -6658, -6568, -6472, -6377, -6282, -6182,
-    -6076, -5975, -5872, -5763, -5651, -5540, -5432, -5325, -5216, -5103, -4992, -4882,
-    -4774, -4672, -4567, -4453, -4340, -4228, -4110, -3988, -3868, -3745, -3612, -3474,
-    -3331, -3179, -3025, -2868, -2707, -2540, -2369, -2196, -2025, -1850, -1661, -1470,
-    -1281, -1083, -875, -667, -454, -239, -35, 167, 372, 568, 757, 949,
-    1149, 1352, 1558, 1769, 1988, 2215, 2442, 2665, 2895, 3127, 3353, 3583,
-    3819, 4049, 4277, 4509, 4739, 4964, 5189, 5409, 5624, 5837, 6005, 6043,
-    5870, 5434, 4728, 3787, 2659, 1407, 113, -1157, -2361, -3457, -4408, -5197,
-    -5813, -6253, -6532, -6667, -6664, -6543, -6331, -6045, -5696, -5306, -4888, -4455,
-    -4019, -3585, -3164, -2767, -2390, -2030, -1693, -1383, -1091, -819, -567, -330,
-    -104, 110, 318, 522, 720, 917, 1118, 1315, 1505, 1689, 1870, 2053,
-    2235, 2414, 2590, 2772, 2955, 3134, 3311, 3486, 3664, 3845, 4024, 4199,
-    4371, 4542, 4709, 4868, 5021, 5171, 5324, 5479, 5633, 5783, 5933, 6086,
-    6239, 6389, 6536, 6680, 6823, 6961, 7091, 7212, 7326, 7439, 7547, 7649,
-    7746, 7842, 7939, 8034, 8125, 8211, 8294, 8373, 8445, 8505, 8556, 8604,
-    8653, 8700, 8744, 8781, 8813, 8840, 8858, 8869, 8872, 8871, 8867, 8858,
-    8842, 8822, 8802, 8786, 8771, 8755, 8739, 8725, 8712, 8697, 8679, 8660,
-    8641, 8621, 8595, 8564, 8531, 8499, 8471, 8440, 8407, 8373, 8344, 8318,
-    8293, 8266, 8242, 8220, 8198, 8169, 8132, 8093, 8056, 8022, 7986, 7945,
-    7902, 7863, 7829, 7797, 7762, 7724, 7684, 7642, 7596, 7548, 7501, 7459,
-    7418, 7372, 7322, 7271, 7223, 7178, 7131, 7079, 7028, 6981, 6923, 6807,
-    6569, 6149, 5510, 4644, 3570, 2330, 977, -435, -1855, -3242, -4557, -5772,
-    -6871, -7844, -8683, -9384, -9949, -10386, -10705, -10921, -11046, -11092, -11073, -11000,
-    -10888, -10748, -10593, -10430, -10266, -10103, -9950, -9809, -9680, -9568, -9479, -9407,
-    -9342, -9286, -9250, -9234, -9223, -9213, -9207, -9209, -9216, -9226, -9239, -9251,
-    -9262, -9271, -9280, -9283, -9280, -9272, -9260, -9242, -9222, -9204, -9182, -9154,
-    -9124, -9091, -9054, -9015, -8977, -8942, -8900, -8850, -8798, -8746, -8692, -8636,
-    -8580, -8525, -8471, -8414, -8352, -8285, -8215, -8140, -8057, -7967, -7874, -7779,
-    -7681, -7579, -7476, -7369, -7257, -7146, -7042, -6938, -6827, -6713, -6601, -6490,
-    -6377, -6263, -6148, -6032, -5918, -5816, -5719, -5614, -5502, -5399, -5305, -5207,
-    -5097, -4982, -4865, -4742, -4612, -4483, -4356, -4226, -4093, -3960, -3826, -3688,
-    -3545, -3401, -3256, -3112, -2965, -2813, -2653, -2491, -2327, -2158, -1982, -1800,
-    -1616, -1431, -1242, -1052, -860, -662, -461, -260, -56, 150, 359, 568,
-    776, 984, 1193, 1405, 1614, 1816, 2018, 2224, 2435, 2646, 2857, 3074,
-    3295, 3514, 3731, 3948, 4167, 4383, 4596, 4806, 5018, 5234, 5453, 5654,
-    5794, 5823, 5696, 5388, 4892, 4222, 3411, 2497, 1518, 508, -495, -1461,
-    -2360, -3174, -3890, -4501, -5002, -5389, -5664, -5832, -5902, -5883, -5782, -5612,
-    -5383, -5106, -4789, -4441, -4068, -3679, -3278, -2876, -2480, -2093, -1721, -1364,
-    -1021, -696, -390, -104, 165, 416, 654, 879, 1094, 1298, 1496, 1692,
-    1883, 2067, 2248, 2430, 2613, 2793, 2966, 3135, 3302, 3469, 3637, 3803,
-    3963, 4121, 4282, 4447, 4611, 4774, 4936, 5094, 5243, 5383, 5515, 5642,
-    5767, 5894, 6022, 6149, 6276, 6407, 6539, 6666, 6788, 6907, 7021, 7128,
-    7228, 7326, 7425, 7525, 7624, 7720, 7812, 7906, 7999, 8085, 8160, 8231,
-    8301, 8369, 8433, 8492, 8550, 8604, 8651, 8696, 8736, 8770, 8801, 8828,
-    8850, 8868, 8884, 8898, 8905, 8909, 8912, 8911, 8907, 8901, 8890, 8868,
-    8840, 8814, 8789, 8758, 8728, 8706, 8687, 8660, 8630, 8600, 8568, 8536,
-    8506, 8475, 8441, 8406, 8373, 8343, 8309, 8273, 8239, 8211, 8183, 8155,
-    8123, 8087, 8048, 8006, 7959, 7909, 7860, 7811, 7759, 7707, 7657, 7610,
-    7561, 7506, 7443, 7374, 7305, 7238, 7169, 7095, 7018, 6941, 6865, 6789,
-    6693, 6536, 6273, 5870, 5316, 4603, 3746, 2769, 1700, 560, -622, -1812,
-    -2986, -4117, -5187, -6187, -7111, -7944, -8671, -9295, -9833, -10285, -10645, -10916,
-    -11114, -11246, -11312, -11320, -11283, -11210, -11113, -11004, -10887, -10764, -10638, -10510,
-    -10382, -10255, -10136, -10026, -9923, -9828, -9738, -9655, -9580, -9519, -9475, -9445,
-    -9425, -9419, -9423, -9428, -9427, -9424, -9424, -9425, -9421, -9409, -9393, -9380,
-    -9370, -9356, -9333, -9301, -9266, -9227, -9184, -9138, -9090, -9037, -8983, -8929,
-    -8874, -8818, -8759, -8697, -8632, -8566, -8498, -8425, -8346, -8267, -8186, -8101,
-    -8020, -7946, -7871, -7783, -7684, -7586, -7494, -7399, -7300, -7199, -7099, -6999,
-    -6900, -6792, -6676, -6557, -6434, -6302, -6163, -6022, -5886, -5755, -5623, -5488,
-    -5354, -5224, -5094, -4963, -4833, -4705, -4577, -4449, -4319, -4181, -4037, -3895,
-    -3756, -3614, -3469, -3322, -3172, -3018, -2863, -2708, -2547, -2376, -2202, -2027,
-    -1851, -1674, -1496, -1320, -1141, -958, -779, -599, -407, -206, -7, 195,
-    408, 620, 827, 1035, 1248, 1463, 1679, 1895, 2111, 2328, 2541, 2749,
-    2955, 3158, 3364, 3577, 3791, 4005, 4222, 4441, 4658, 4874, 5089, 5302,
-    5504, 5673, 5776, 5778, 5659, 5408, 5028, 4527, 3920, 3229, 2474, 1674,
-    855, 38, -760, -1523, -2235, -2881, -3453, -3945, -4355, -4683, -4927, -5092,
-    -5181, -5203, -5166, -5073, -4925, -4729, -4489, -4210, -3905, -3579, -3235, -2884,
-    -2531, -2181, -1831, -1481, -1138, -807, -479, -159, 141, 423, 696, 958,
-    1205, 1446, 1680, 1896, 2100, 2299, 2488, 2668, 2840, 3009, 3175, 3337,
-    3487, 3634, 3784, 3936, 4089, 4243, 4397, 4554, 4716, 4876, 5028, 5179,
-    5334, 5492, 5647, 5799, 5947, 6085, 6217, 6347, 6471, 6590, 6708, 6824,
-    6938, 7052, 7167, 7274, 7371, 7462, 7543, 7617, 7694, 7768, 7836, 7905,
-    7970, 8030, 8095, 8166, 8233, 8295, 8355, 8410, 8459, 8503, 8541, 8575,
-    8612, 8649, 8680, 8707, 8736, 8765, 8788, 8800, 8811, 8828, 8840, 8847,
-    8851, 8848, 8840, 8830, 8817, 8798, 8782, 8769, 8756, 8742, 8725, 8702,
-    8674, 8646, 8617, 8583, 8546, 8507, 8467, 8427, 8388, 8351, 8315, 8280,
-    8246, 8207, 8162, 8118, 8071, 8015, 7959, 7906, 7855, 7804, 7756, 7706,
-    7655, 7608, 7562, 7509, 7453, 7400, 7350, 7298, 7244, 7193, 7138, 7075,
-    7005, 6920, 6793, 6612, 6353, 5984, 5497, 4910, 4214, 3406, 2518, 1572,
-    569, -465, -1502, -2532, -3545, -4518, -5442, -6312, -7115, -7848, -8508, -9094,
-    -9608, -10055, -10435, -10746, -10989, -11170, -11301, -11388, -11435, -11446, -11421, -11371,
-    -11303, -11217, -11112, -10996, -10873, -10748, -10628, -10513, -10403, -10301, -10207, -10119,
-    -10039, -9960, -9881, -9806, -9737, -9666, -9598, -9539, -9489, -9448, -9418, -9395,
-    -9377, -9362, -9346, -9332, -9318, -9298, -9274, -9250, -9220, -9185, -9154, -9125,
-    -9089, -9049, -9008, -8963, -8913, -8855, -8794, -8730, -8665, -8600, -8535, -8463,
-    -8381, -8295, -8207, -8114, -8019, -7923, -7822, -7717, -7615, -7508, -7394, -7280,
-    -7171, -7064, -6957, -6849, -6740, -6630, -6522, -6412, -6302, -6196, -6093, -5988,
-    -5876, -5756, -5632, -5502, -5366, -5226, -5088, -4951, -4814, -4670, -4522, -4375,
-    -4229, -4086, -3940, -3784, -3622, -3464, -3302, -3129, -2949, -2762, -2572, -2387,
-    -2207, -2023, -1837, -1656, -1471, -1282, -1095, -905, -713, -525, -341, -155,
-    31, 215, 401, 588, 780, 974, 1173, 1373, 1576, 1781, 1988, 2199,
-    2412, 2624, 2832, 3033, 3233, 3439, 3653, 3872, 4090, 4305, 4520, 4739,
-    4959, 5173, 5369, 5533, 5646, 5685, 5628, 5467, 5202, 4842, 4395, 3868,
-    3276, 2636, 1970, 1289, 606, -67, -717, -1332, -1904, -2431, -2908, -3329,
-    -3691, -3992, -4236, -4424, -4553, -4624, -4640, -4605, -4523, -4399, -4235, -4038,
-    -3815, -3567, -3291, -2994, -2679, -2355, -2025, -1693, -1358, -1022, -692, -367,
-    -47, 271, 583, 885, 1173, 1449, 1714, 1967, 2207, 2435, 2652, 2860,
-    3064, 3260, 3450, 3630, 3801, 3964, 4119, 4268, 4412, 4553, 4690, 4826,
-    4960, 5094, 5226, 5356, 5484, 5614, 5746, 5878, 6007, 6131, 6254, 6381,
-    6510, 6641, 6768, 6890, 7010, 7126, 7237, 7342, 7441, 7538, 7633, 7725,
-    7811, 7893, 7969, 8038, 8103, 8162, 8218, 8276, 8334, 8392, 8446, 8496,
-    8540, 8578, 8610, 8639, 8665, 8691, 8712, 8727, 8737, 8746, 8754, 8764,
-    8773, 8781, 8788, 8794, 8795, 8791, 8782, 8772, 8761, 8753, 8744, 8734,
-    8726, 8719, 8711, 8700, 8684, 8665, 8645, 8624, 8604, 8579, 8549, 8514,
-    8476, 8438, 8400, 8360, 8315, 8267, 8214, 8160, 8106, 8049, 7989, 7926,
-    7862, 7799, 7740, 7682, 7622, 7561, 7501, 7441, 7380, 7317, 7253, 7189,
-    7128, 7064, 6992, 6902, 6778, 6606, 6366, 6046, 5638, 5144, 4569, 3917,
-    3196, 2418, 1598, 748, -124, -1010, -1903, -2789, -3656, -4495, -5298, -6060,
-    -6776, -7441, -8054, -8614, -9122, -9575, -9972, -10315, -10610, -10861, -11069, -11235,
-    -11362, -11455, -11516, -11549, -11553, -11533, -11490, -11428, -11352, -11264, -11170, -11071,
-    -10964, -10851, -10735, -10620, -10511, -10407, -10306, -10207, -10112, -10025, -9946, -9872,
-    -9803, -9741, -9688, -9644, -9609, -9579, -9557, -9542, -9536, -9531, -9523, -9513,
-    -9498, -9477, -9450, -9416, -9375, -9331, -9286, -9234, -9175, -9112, -9045, -8975,
-    -8899, -8819, -8734, -8647, -8553, -8451, -8345, -8243, -8144, -8039, -7927, -7810,
-    -7691, -7573, -7458, -7341, -7219, -7094, -6970, -6842, -6710, -6576, -6442, -6308,
-    -6178, -6050, -5918, -5785, -5653, -5521, -5387, -5253, -5122, -4987, -4844, -4699,
-    -4558, -4418, -4273, -4117, -3955, -3795, -3637, -3476, -3312, -3143, -2968, -2788,
-    -2607, -2424, -2235, -2046, -1860, -1671, -1477, -1277, -1073, -866, -663, -467,
-    -270, -72, 124, 316, 514, 718, 923, 1128, 1337, 1548, 1759, 1974,
-    2187, 2396, 2603, 2809, 3012, 3217, 3426, 3635, 3842, 4049, 4255, 4460,
-    4663, 4868, 5071, 5265, 5441, 5585, 5683, 5725, 5703, 5610, 5444, 5203,
-    4885, 4502, 4068, 3591, 3075, 2536, 1986, 1429, 873, 326, -203, -711,
-    -1188, -1626, -2024, -2378, -2687, -2951, -3172, -3348, -3480, -3572, -3627, -3640,
-    -3616, -3555, -3456, -3328, -3175, -2998, -2796, -2578, -2343, -2089, -1822, -1548,
-    -1269, -982, -688, -392, -92, 207, 502, 792, 1079, 1357, 1623, 1886,
-    2148, 2406, 2655, 2892, 3116, 3321, 3504, 3660, 3795, 3922, 4048, 4173,
-    4297, 4421, 4545, 4669, 4796, 4925, 5054, 5187, 5323, 5458, 5591, 5721,
-    5849, 5972, 6094, 6211, 6319, 6423, 6525, 6625, 6724, 6824, 6923, 7018,
-    7112, 7205, 7293, 7373, 7453, 7532, 7604, 7671, 7739, 7808, 7875, 7939,
-    7999, 8052, 8103, 8151, 8192, 8229, 8269, 8308, 8343, 8374, 8399, 8419,
-    8434, 8443, 8447, 8449, 8449, 8449, 8447, 8444, 8443, 8443, 8444, 8444,
-    8437, 8424, 8408, 8392, 8378, 8364, 8347, 8330, 8315, 8304, 8289, 8270,
-    8254, 8239, 8213, 8179, 8149, 8125, 8099, 8071, 8042, 8010, 7974, 7938,
-    7899, 7851, 7802, 7756, 7708, 7656, 7602, 7544, 7480, 7414, 7349, 7284,
-    7219, 7152, 7085, 7016, 6937, 6839, 6710, 6536, 6304, 6008, 5642, 5207,
-    4707, 4150, 3538, 2879, 2179, 1451, 701, -68, -847, -1625, -2398, -3167,
-    -3916, -4636, -5328, -5991, -6619, -7214, -7774, -8290, -8763, -9203, -9604, -9950,
-    -10249, -10515, -10748, -10942, -11100, -11228, -11330, -11407, -11461, -11492, -11500, -11487,
-    -11455, -11408, -11347, -11270, -11184, -11092, -10999, -10905, -10811, -10712, -10611, -10512,
-    -10414, -10314, -10214, -10116, -10026, -9938, -9853, -9778, -9718, -9665, -9612, -9561,
-    -9514, -9472, -9440, -9414, -9384, -9351, -9322, -9286, -9241, -9189, -9132, -9065,
-    -8996, -8928, -8855, -8778, -8700, -8626, -8551, -8471, -8382, -8287, -8192, -8097,
-    -7999, -7895, -7788, -7685, -7590, -7496, -7396, -7289, -7178, -7064, -6948, -6827,
-    -6703, -6581, -6459, -6333, -6209, -6086, -5957, -5819, -5676, -5531, -5388, -5249,
-    -5109, -4962, -4817, -4674, -4525, -4369, -4209, -4045, -3878, -3715, -3551, -3386,
-    -3224, -3065, -2900, -2731, -2561, -2388, -2209, -2025, -1833, -1635, -1434, -1236,
-    -1042, -849, -653, -457, -261, -62, 139, 339, 540, 742, 943, 1147,
-    1353, 1555, 1755, 1958, 2161, 2366, 2578, 2792, 3004, 3215, 3423, 3623,
-    3824, 4031, 4238, 4443, 4650, 4849, 5029, 5178, 5286, 5340, 5340, 5286,
-    5173, 5006, 4786, 4514, 4194, 3834, 3440, 3016, 2570, 2107, 1637, 1166,
-    701, 246, -193, -610, -1003, -1367, -1702, -2008, -2279, -2519, -2730, -2908,
-    -3044, -3143, -3205, -3233, -3234, -3208, -3147, -3059, -2950, -2814, -2650, -2464,
-    -2259, -2035, -1801, -1558, -1302, -1043, -782, -517, -248, 22, 293, 566,
-    840, 1116, 1391, 1663, 1927, 2185, 2436, 2679, 2913, 3135, 3348, 3551,
-    3747, 3935, 4117, 4287, 4453, 4618, 4776, 4925, 5068, 5211, 5352, 5494,
-    5633, 5763, 5891, 6020, 6145, 6264, 6386, 6510, 6633, 6753, 6869, 6975,
-    7078, 7179, 7270, 7354, 7436, 7515, 7589, 7664, 7737, 7808, 7878, 7945,
-    8008, 8065, 8118, 8166, 8208, 8247, 8282, 8314, 8346, 8375, 8404, 8429,
-    8450, 8471, 8492, 8509, 8521, 8535, 8549, 8561, 8572, 8577, 8577, 8578,
-    8579, 8574, 8567, 8564, 8562, 8561, 8558, 8552, 8540, 8528, 8513, 8492,
-    8468, 8444, 8415, 8385, 8355, 8325, 8297, 8271, 8242, 8206, 8166, 8124,
-    8079, 8033, 7982, 7929, 7877, 7824, 7769, 7713, 7652, 7591, 7531, 7471,
-    7405, 7338, 7273, 7211, 7146, 7077, 6995, 6893, 6766, 6602, 6394, 6140,
-    5841, 5492, 5089, 4636, 4132, 3582, 2993, 2367, 1707, 1024, 324, -384,
-    -1096, -1804, -2505, -3192, -3863, -4517, -5152, -5766, -6355, -6914, -7443, -7940,
-    -8405, -8835, -9231, -9591, -9919, -10213, -10475, -10704, -10904, -11079, -11226, -11345,
-    -11440, -11515, -11569, -11606, -11622, -11617, -11598, -11568, -11521, -11461, -11393, -11316,
-    -11233, -11147, -11059, -10969, -10882, -10794, -10704, -10611, -10517, -10422, -10328, -10233,
-    -10139, -10047, -9959, -9876, -9799, -9725, -9653, -9582, -9514, -9446, -9375, -9303,
-    -9230, -9157, -9084, -9009, -8930, -8851, -8774, -8693, -8609, -8523, -8436, -8350,
-    -8264, -8174, -8082, -7992, -7903, -7811, -7715, -7616, -7516, -7416, -7318, -7219,
-    -7121, -7023, -6925, -6822, -6716, -6606, -6493, -6376, -6254, -6127, -5997, -5866,
-    -5735, -5604, -5470, -5333, -5193, -5051, -4906, -4756, -4601, -4443, -4282, -4117,
-    -3946, -3773, -3598, -3424, -3246, -3063, -2879, -2694, -2508, -2320, -2128, -1934,
-    -1740, -1544, -1345, -1140, -935, -732, -531, -332, -133, 66, 264, 464,
-    665, 868, 1072, 1278, 1485, 1694, 1903, 2111, 2315, 2517, 2720, 2922,
-    3125, 3326, 3528, 3732, 3937, 4142, 4343, 4532, 4704, 4853, 4968, 5042,
-    5074, 5062, 5006, 4902, 4750, 4554, 4318, 4046, 3740, 3405, 3048, 2676,
-    2294, 1903, 1506, 1108, 715, 330, -44, -403, -744, -1064, -1359, -1630,
-    -1872, -2085, -2268, -2422, -2549, -2650, -2724, -2772, -2792, -2787, -2756, -2702,
-    -2625, -2524, -2405, -2267, -2112, -1938, -1749, -1547, -1335, -1112, -878, -636,
-    -391, -143, 110, 366, 625, 884, 1143, 1404, 1667, 1928, 2186, 2438,
-    2687, 2931, 3169, 3399, 3621, 3837, 4045, 4246, 4442, 4634, 4823, 5007,
-    5184, 5354, 5515, 5671, 5820, 5963, 6101, 6234, 6363, 6488, 6609, 6724,
-    6836, 6948, 7058, 7163, 7263, 7357, 7449, 7537, 7621, 7696, 7765, 7830,
-    7892, 7950, 8004, 8055, 8105, 8155, 8203, 8247, 8290, 8331, 8369, 8403,
-    8432, 8457, 8481, 8504, 8525, 8546, 8567, 8588, 8605, 8617, 8625, 8628,
-    8629, 8629, 8626, 8621, 8615, 8610, 8605, 8599, 8594, 8588, 8584, 8582,
-    8578, 8570, 8559, 8549, 8536, 8519, 8495, 8468, 8442, 8414, 8383, 8348,
-    8311, 8274, 8235, 8193, 8150, 8104, 8056, 8003, 7945, 7883, 7820, 7759,
-    7696, 7632, 7567, 7505, 7443, 7380, 7312, 7234, 7143, 7033, 6899, 6734,
-    6531, 6289, 6006, 5679, 5309, 4894, 4443, 3957, 3439, 2887, 2306, 1703,
-    1083, 450, -194, -845, -1497, -2143, -2781, -3410, -4026, -4625, -5200, -5751,
-    -6280, -6785, -7265, -7720, -8151, -8557, -8934, -9283, -9603, -9896, -10159, -10395,
-    -10603, -10787, -10951, -11094, -11218, -11321, -11405, -11470, -11520, -11554, -11572, -11575,
-    -11566, -11547, -11518, -11477, -11424, -11364, -11301, -11234, -11160, -11078, -10994, -10909,
-    -10824, -10734, -10641, -10548, -10456, -10365, -10270, -10171, -10072, -9973, -9874, -9773,
-    -9672, -9571, -9471, -9370, -9268, -9165, -9063, -8962, -8861, -8760, -8662, -8567,
-    -8474, -8385, -8295, -8205, -8115, -8025, -7935, -7842, -7748, -7655, -7563, -7471,
-    -7376, -7278, -7180, -7086, -6992, -6895, -6795, -6694, -6593, -6491, -6384, -6275,
-    -6166, -6054, -5937, -5812, -5682, -5550, -5416, -5276, -5131, -4981, -4831, -4678,
-    -4521, -4361, -4198, -4033, -3865, -3694, -3522, -3348, -3174, -3000, -2824, -2646,
-    -2464, -2281, -2095, -1906, -1713, -1518, -1322, -1127, -929, -726, -521, -317,
-    -116, 85, 291, 499, 704, 907, 1110, 1317, 1525, 1731, 1936, 2145,
-    2356, 2567, 2776, 2986, 3198, 3412, 3627, 3836, 4038, 4230, 4405, 4557,
-    4680, 4771, 4826, 4844, 4822, 4758, 4654, 4512, 4337, 4129, 3893, 3632,
-    3349, 3050, 2736, 2410, 2075, 1738, 1403, 1070, 739, 415, 103, -193,
-    -474, -742, -994, -1225, -1433, -1619, -1784, -1926, -2043, -2136, -2208, -2259,
-    -2286, -2289, -2272, -2236, -2183, -2112, -2022, -1915, -1792, -1657, -1506, -1342,
-    -1166, -981, -787, -586, -377, -157, 71, 304, 541, 782, 1028, 1275,
-    1519, 1761, 2004, 2247, 2485, 2718, 2944, 3167, 3387, 3599, 3805, 4004,
-    4202, 4396, 4584, 4766, 4941, 5114, 5282, 5445, 5601, 5752, 5897, 6036,
-    6167, 6291, 6410, 6524, 6633, 6734, 6830, 6923, 7010, 7092, 7167, 7235,
-    7298, 7359, 7418, 7473, 7525, 7574, 7621, 7664, 7701, 7733, 7763, 7793,
-    7822, 7846, 7866, 7883, 7899, 7913, 7922, 7928, 7934, 7941, 7948, 7951,
-    7951, 7950, 7949, 7947, 7941, 7933, 7923, 7912, 7898, 7881, 7863, 7845,
-    7826, 7807, 7786, 7763, 7739, 7713, 7683, 7650, 7614, 7579, 7545, 7511,
-    7475, 7437, 7397, 7357, 7313, 7266, 7216, 7167, 7120, 7073, 7022, 6968,
-    6912, 6857, 6801, 6742, 6683, 6625, 6569, 6510, 6447, 6376, 6299, 6210,
-    6105, 5979, 5830, 5656, 5458, 5232, 4979, 4702, 4400, 4075, 3726, 3355,
-    2964, 2554, 2128, 1687, 1234, 774, 309, -157, -622, -1086, -1548, -2003,
-    -2453, -2896, -3332, -3755, -4163, -4556, -4934, -5301, -5654, -5991, -6311, -6614,
-    -6901, -7170, -7421, -7653, -7870, -8072, -8258, -8426, -8579, -8717, -8843, -8956,
-    -9054, -9138, -9210, -9269, -9314, -9345, -9367, -9378, -9380, -9375, -9360, -9339,
-    -9312, -9277, -9236, -9187, -9132, -9070, -9006, -8938, -8867, -8793, -8720, -8645,
-    -8566, -8481, -8391, -8303, -8215, -8127, -8036, -7941, -7848, -7753, -7657, -7557,
-    -7456, -7358, -7260, -7161, -7062, -6964, -6867, -6772, -6677, -6580, -6483, -6387,
-    -6289, -6190, -6090, -5991, -5894, -5799, -5706, -5612, -5519, -5428, -5335, -5243,
-    -5148, -5052, -4955, -4859, -4762, -4666, -4570, -4475, -4380, -4281, -4178, -4073,
-    -3970, -3867, -3762, -3655, -3547, -3440, -3332, -3221, -3105, -2988, -2870, -2753,
-    -2633, -2511, -2389, -2265, -2140, -2012, -1881, -1750, -1617, -1482, -1345, -1206,
-    -1068, -931, -794, -657, -520, -384, -249, -113, 25, 165, 305, 444,
-    582, 719, 855, 990, 1123, 1258, 1395, 1536, 1676, 1812, 1946, 2076,
-    2200, 2313, 2414, 2504, 2582, 2648, 2697, 2728, 2742, 2740, 2722, 2687,
-    2636, 2574, 2499, 2413, 2316, 2209, 2095, 1973, 1846, 1713, 1577, 1439,
-    1298, 1157, 1016, 875, 738, 605, 476, 351, 229, 111, -1, -109,
-    -211, -308, -395, -470, -535, -593, -644, -688, -721, -747, -766, -778,
-    -778, -767, -747, -721, -690, -651, -604, -551, -492, -425, -349, -265,
-    -176, -81, 19, 124, 233, 345, 459, 575, 692, 810, 930, 1052,
-    1174, 1299, 1425, 1551, 1676, 1800, 1922, 2043, 2162, 2277, 2390, 2506,
-    2626, 2745, 2862, 2974, 3084, 3191, 3294, 3392, 3488, 3583, 3677, 3767,
-    3851, 3931, 4007, 4081, 4151, 4218, 4284, 4349, 4411, 4471, 4529, 4585,
-    4639, 4689, 4736, 4780, 4820, 4858, 4893, 4925, 4954, 4981, 5007, 5032,
-    5055, 5075, 5090, 5102, 5112, 5116, 5118, 5119, 5123, 5130, 5136, 5138,
-    5137, 5135, 5133, 5128, 5120, 5113, 5107, 5101, 5091, 5077, 5060, 5042,
-    5023, 5003, 4981, 4960, 4940, 4919, 4896, 4874, 4852, 4830, 4806, 4780,
-    4752, 4722, 4690, 4655, 4619, 4582, 4544, 4507, 4469, 4428, 4383, 4334,
-    4280, 4220, 4154, 4079, 4000, 3917, 3827, 3726, 3613, 3489, 3355, 3211,
-    3056, 2891, 2720, 2542, 2354, 2155, 1946, 1732, 1512, 1289, 1061, 831,
-    601, 370, 139, -92, -320, -547, -773, -998, -1224, -1448, -1671, -1891,
-    -2108, -2323, -2531, -2734, -2931, -3122, -3309, -3492, -3670, -3843, -4011, -4174,
-    -4330, -4474, -4607, -4731, -4851, -4965, -5073, -5173, -5267, -5354, -5434, -5505,
-    -5567, -5624, -5678, -5727, -5769, -5804, -5834, -5858, -5874, -5883, -5885, -5881,
-    -5871, -5855, -5835, -5812, -5786, -5757, -5725, -5690, -5653, -5615, -5573, -5527,
-    -5478, -5426, -5373, -5320, -5267, -5214, -5161, -5108, -5054, -4997, -4936, -4871,
-    -4806, -4742, -4679, -4615, -4549, -4485, -4422, -4358, -4292, -4224, -4159, -4096,
-    -4035, -3972, -3909, -3846, -3780, -3710, -3638, -3564, -3488, -3411, -3332, -3251,
-    -3170, -3090, -3010, -2933, -2856, -2780, -2705, -2629, -2552, -2472, -2390, -2309,
-    -2229, -2151, -2072, -1992, -1913, -1832, -1749, -1662, -1573, -1487, -1402, -1318,
-    -1231, -1144, -1059, -975, -889, -801, -713, -628, -545, -464, -382, -298,
-    -214, -126, -36, 56, 148, 241, 334, 428, 523, 615, 705, 791,
-    873, 952, 1024, 1092, 1157, 1219, 1277, 1331, 1376, 1413, 1442, 1465,
-    1480, 1488, 1490, 1489, 1484, 1474, 1455, 1427, 1395, 1360, 1319, 1274,
-    1225, 1177, 1130, 1080, 1023, 964, 905, 846, 787, 729, 673, 621,
-    571, 521, 475, 431, 390, 348, 306, 265, 225, 185, 144, 103,
-    66, 35, 10, -12, -31, -48, -64, -76, -85, -92, -96, -96,
-    -86, -69, -49, -30, -9, 18, 49, 82, 115, 155, 200, 248,
-    296, 343, 393, 447, 505, 564, 625, 692, 764, 837, 911, 987,
-    1066, 1144, 1220, 1293, 1365, 1434, 1499, 1559, 1617, 1675, 1735, 1795,
-    1855, 1913, 1970, 2024, 2075, 2124, 2170, 2215, 2261, 2308, 2357, 2403,
-    2445, 2484, 2525, 2566, 2606, 2644, 2684, 2727, 2769, 2808, 2843, 2878,
-    2914, 2951, 2986, 3020, 3056, 3094, 3131, 3166, 3201, 3236, 3268, 3294,
-    3315, 3333, 3347, 3357, 3362, 3365, 3369, 3373, 3378, 3381, 3381, 3376,
-    3367, 3356, 3344, 3329, 3312, 3296, 3282, 3269, 3250, 3228, 3207, 3191,
-    3176, 3158, 3141, 3128, 3116, 3100, 3080, 3059, 3041, 3023, 3003, 2983,
-    2965, 2949, 2931, 2910, 2887, 2863, 2834, 2796, 2750, 2698, 2639, 2570,
-    2494, 2413, 2328, 2237, 2143, 2045, 1945, 1840, 1725, 1604, 1480, 1355,
-    1226, 1094, 962, 831, 698, 560, 419, 279, 145, 12, -123, -256,
-    -383, -505, -628, -749, -867, -986, -1107, -1227, -1342, -1455, -1569, -1678,
-    -1783, -1885, -1985, -2083, -2181, -2276, -2370, -2467, -2566, -2661, -2750, -2835,
-    -2914, -2983, -3050, -3123, -3197, -3267, -3334, -3395, -3442, -3484, -3542, -3601,
-    -3631, -3639, -3659, -3696, -3723, -3733, -3739, -3743, -3739, -3731, -3730, -3727,
-    -3717, -3699, -3678, -3650, -3622, -3601, -3581, -3554, -3519, -3480, -3439, -3397,
-    -3358, -3325, -3296, -3270, -3245, -3212, -3172, -3134, -3103, -3069, -3028, -2992,
-    -2958, -2921, -2882, -2850, -2824, -2800, -2775, -2740, -2694, -2642, -2601, -2561,
-    -2518, -2470, -2432, -2388, -2334, -2266, -2189, -2117, -2053, -2000, -1933, -1851,
-    -1778, -1714, -1645, -1562, -1513, -1452, -1380, -1296, -1235, -1181, -1137, -1085,
-    -1022, -947, -874, -828, -780, -737, -678, -638, -585, -545, -497, -452,
-    -403, -357, -342, -286, -244, -176, -129, -73, -11, 36, 111, 134,
-    212, 273, 346, 410, 461, 496, 542, 601, 640, 674, 726, 772,
-    813, 837, 864, 895, 942, 958, 975, 946, 963, 945, 945, 892,
-    886, 871, 877, 834, 809, 805, 753, 748, 712, 663, 606, 568,
-    554, 502, 506, 443, 398, 368, 364, 320, 317, 270, 308, 272,
-    287, 234, 242, 215, 211, 175, 152, 183, 185, 144, 186, 128,
-    140, 165, 101, 194, 79, 188, 196, 107, 173, 116, 168, 195,
-    231, 201, 224, 235, 290, 269, 244, 247, 265, 305, 317, 298,
-    403, 445, 427, 466, 554, 507, 591, 645, 749, 748, 776, 831,
-    939, 912, 980, 1059, 1063, 1074, 1118, 1165, 1225, 1277, 1331, 1293,
-    1393, 1412, 1473, 1503, 1465, 1512, 1540, 1701, 1686, 1705, 1673, 1616,
-    1816, 1803, 1735, 1757, 2061, 3617, 7916, 8635, 8313, 8366, 8114, 8247,
-    8184, 8099, 8033, 7602, 7364, 7370, 7372, 6682, 7103, 7108, 6489, 6636,
-    6360, 6939, 6985, 6382, 5626, 5841, 6064, 7069, 7099, 8563, 9008, 10176,
-    10057, 10588, 9883, 8999, 7091, 3218, -345, -3195, -4988, -7194, -7986, -8656,
-    -9951, -11486, -13862, -16376, -13584, -10429, -8700, -7242, -2729, 4871, 8835, 8416,
-    8116, 11223, 13633, 14328, 12827, 15205, 16881, 17184, 15421, 13059, 1734, -14119,
-    -12923, 12615, 849, -360, -3776, -3456, -3606, -2712, -1339, -4226, -5256, -838,
-    8219, 14096, 15259, 16133, 15263, 13285, 11579, 9340, 8843, 5904, 1682, -3613,
-    -5235, -6490, -6778, -7545, -11066, -12927, -13251, -14087, -15038, -16676, -16375, -17166,
-    -17170, -16420, -17729, -17706, -18316, -18447, -18030, -17282, -17078, -15943, -16115, -16154,
-    -15228, -13954, -12227, -11081, -13262, -15156, -15129, -15299, -14704, -14677, -14189, -11791,
-    -10405, -8272, -5851, -370, 2875, 4465, 5297, 6775, 8582, 10784, 11245, 12223,
-    13382, 14314, 14037, 14591, 14992, 16531, 15672, 14837, 15561, 15972, 16283, 16126,
-    15256, 13633, 13983, 13880, 12869, 13063, 12911, 11380, 11847, 11737, 9879, 10501,
-    9387, 7985, 6445, 6709, 6393, 7536, 9999, 8448, 8747, 10075, 8663, 8107,
-    7914, 4758, 2096, -1534, -5273, -8723, -9097, -10735, -13029, -13240, -14472, -16107,
-    -17291, -18423, -19241, -18585, -18487, -19689, -20055, -19502, -21023, -21249, -21251, -20817,
-    -20286, -20550, -20416, -20628, -19414, -19557, -19228, -17698, -16750, -16858, -17919, -18040,
-    -17484, -16923, -17742, -17096, -16255, -14535, -14201, -13869, -12420, -9786, -6922, -4601,
-    -1021, 2715, 5160, 6695, 7572, 9226, 10956, 12359, 12189, 12771, 13700, 13725,
-    13339, 13960, 14712, 15878, 16565, 15282, 15038, 15478, 15243, 14673, 14212, 14061,
-    14612, 14031, 13732, 12614, 12138, 11908, 10628, 10394, 10357, 9763, 9361, 8786,
-    9334, 10230, 11078, 12081, 12335, 12445, 12636, 11211, 10237, 8331, 6101, 2698,
-    -228, -4034, -6302, -7902, -9023, -9876, -10691, -11909, -12893, -14106, -14997, -15337,
-    -16171, -16454, -16639, -16852, -16682, -17213, -17195, -16825, -15982, -15728, -16038, -16066,
-    -15492, -15544, -14864, -13713, -12827, -11625, -11223, -11636, -10508, -9305, -8613, -6858,
-    -5874, -5599, -5574, -6610, -7451, -7910, -8341, -8794, -9299, -8100, -6765, -4803,
-    -1890, 694, 3767, 7117, 9273, 11449, 13318, 14506, 15502, 16598, 17872, 18925,
-    19868, 20742, 21292, 21987, 22093, 21981, 22232, 22377, 21905, 21701, 21577, 21451,
-    20823, 20060, 19228, 18920, 18685, 18206, 17573, 17273, 16627, 15597, 14421, 13845,
-    13883, 13433, 12368, 11581, 10842, 10403, 9231, 8342, 8414, 8773, 8894, 9296,
-    9561, 10169, 10175, 10135, 9847, 9627, 8210, 5715, 2668, -403, -3255, -5310,
-    -6844, -8255, -9791, -11137, -12979, -14474, -15429, -16178, -16746, -16682, -17503, -17659,
-    -17149, -17390, -17106, -16474, -16774, -16767, -16704, -16326, -16138, -16154, -15700, -15394,
-    -14544, -13581, -13005, -11913, -11057, -10979, -10693, -10185, -9715, -8616, -7992, -7340,
-    -6565, -5990, -5707, -5612, -5646, -5672, -6095, -6515, -6585, -6823, -6840, -6838,
-    -6652, -6079, -4894, -2720, -11, 2481, 5186, 6884, 8747, 10596, 12056, 13338,
-    14512, 15485, 16179, 17072, 17483, 17923, 18370, 18497, 18730, 18790, 18665, 18599,
-    18311, 17905, 17531, 17092, 16937, 16363, 15874, 15436, 14974, 14366, 13681, 12940,
-    12234, 11659, 10922, 10209, 9331, 8653, 7786, 6870, 6276, 5702, 5192, 4642,
-    3762, 2783, 1706, 458, -978, -2074, -2631, -2925, -2971, -3079, -3254, -2967,
-    -2986, -3063, -3186, -3384, -3593, -3864, -4815, -6449, -8092, -9634, -11245, -12806,
-    -14244, -15663, -16836, -17954, -18973, -19815, -20550, -21200, -21739, -22133, -22347, -22500,
-    -22520, -22617, -22441, -22042, -21624, -21171, -20868, -20578, -20141, -19549, -18922, -18286,
-    -17695, -17158, -16425, -15560, -14770, -14018, -13358, -12604, -11874, -11103, -10381, -9632,
-    -8806, -7992, -7260, -6688, -6011, -4953, -3564, -1822, -557, -11, 225, 268,
-    355, 392, 663, 1024, 1351, 1780, 2531, 3449, 4094, 4653, 5659, 7057,
-    8681, 10393, 12047, 13789, 15442, 16950, 18266, 19468, 20462, 21319, 22069, 22655,
-    23146, 23434, 23614, 23745, 23780, 23740, 23549, 23271, 22932, 22525, 22001, 21356,
-    20864, 20362, 19627, 18771, 17768, 16824, 15848, 14936, 14165, 13416, 12730, 11981,
-    11234, 10424, 9612, 8988, 8310, 7594, 6914, 6168, 5249, 4192, 2985, 1769,
-    603, -429, -1421, -2515, -3694, -4804, -5267, -5327, -5348, -5451, -5620, -5827,
-    -6156, -6456, -6895, -7336, -7681, -8162, -8539, -8776, -9118, -9647, -9955, -10197,
-    -10874, -11866, -13151, -14488, -15914, -17177, -18185, -19116, -20021, -20896, -21524, -22024,
-    -22374, -22466, -22344, -22310, -22307, -22181, -21972, -21458, -20919, -20285, -19471, -18707,
-    -18006, -17218, -16523, -16027, -15542, -14961, -14251, -13629, -12914, -12095, -11371, -10594,
-    -9789, -8970, -8228, -7463, -6553, -5677, -4730, -3530, -2380, -1298, -267, 722,
-    1740, 2583, 3493, 4475, 5361, 6291, 7090, 7988, 8567, 8743, 8761, 8597,
-    8335, 8104, 8069, 8187, 8393, 8640, 9015, 9554, 10059, 10626, 11182, 11829,
-    12350, 13180, 14279, 15549, 16850, 18052, 19272, 20506, 21456, 22269, 23034, 23467,
-    23804, 24137, 24263, 24231, 24150, 23977, 23666, 23149, 22663, 22018, 21325, 20531,
-    19726, 19011, 18306, 17677, 17068, 16494, 15959, 15484, 14981, 14353, 13533, 12662,
-    11631, 10638, 9769, 8844, 7940, 7171, 6317, 5527, 4458, 3326, 2164, 1045,
-    59, -1031, -2022, -2991, -4100, -5183, -5909, -6478, -6975, -7614, -8252, -8740,
-    -9342, -10023, -10429, -10624, -10638, -10786, -10791, -10879, -10973, -11151, -11343, -11649,
-    -11944, -12269, -12584, -13042, -13463, -13877, -14327, -14740, -15112, -15558, -16062, -16509,
-    -16837, -17010, -17047, -17365, -17279, -17408, -17983, -18679, -19250, -19737, -20143, -20437,
-    -20618, -20695, -20601, -20370, -19983, -19408, -18831, -18168, -17594, -16997, -16365, -15861,
-    -15329, -14692, -14108, -13639, -13179, -12755, -12260, -11818, -11358, -10944, -10412, -9582,
-    -8779, -7950, -7055, -6134, -5036, -3826, -2605, -1404, -200, 1033, 2156, 3257,
-    4241, 5169, 5910, 6639, 7241, 7906, 8613, 9192, 9716, 10248, 10816, 11291,
-    11711, 12161, 12577, 13111, 13710, 14348, 14560, 14300, 14216, 14270, 14199, 13980,
-    13800, 13681, 13546, 13505, 13531, 13653, 13940, 14234, 14577, 14828, 15094, 15368,
-    15642, 15820, 16202, 16928, 17739, 18551, 19289, 19971, 20525, 20937, 21215, 21121,
-    20539, 19966, 19300, 18618, 17946, 17342, 16753, 16179, 15648, 15089, 14502, 13928,
-    13320, 12644, 12013, 11426, 10868, 10325, 9823, 9336, 8845, 8384, 7942, 7575,
-    7189, 6722, 6365, 5963, 5565, 5104, 4289, 3086, 1820, 562, -783, -2192,
-    -3520, -4794, -5688, -6334, -7081, -7904, -8789, -9544, -10202, -10855, -11438, -12047,
-    -12623, -13163, -13635, -14066, -14501, -14908, -15307, -15765, -16171, -16544, -16927, -17158,
-    -17296, -17322, -17315, -17291, -17191, -17076, -17057, -17064, -17015, -16987, -16933, -16910,
-    -16834, -16836, -16888, -16884, -16971, -17022, -17106, -17177, -17217, -17339, -17457, -17568,
-    -17501, -17566, -17579, -17484, -17429, -17370, -17297, -17108, -17157, -17374, -17483, -17619,
-    -17484, -16902, -16385, -15751, -15129, -14515, -13881, -13252, -12666, -12048, -11483, -10896,
-    -10318, -9805, -9365, -8970, -8521, -7950, -7428, -7031, -6588, -6099, -5656, -5222
-};
-
-#endif // AUDIO_DATA_H_BLK_ENTER_DRAGON_AUDIO
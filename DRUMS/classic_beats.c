@@ -0,0 +1,16 @@
+#include "classic_beats.h"
+#include "mixer.h"
+
+_Static_assert(BEAT_PATTERN_PADS == MIXER_NUM_PADS, "beat patterns need a lane for every pad");
+_Static_assert(NUM_CLASSIC_BEATS < 0xFF, "beat numbers have to fit in a byte, 0xFF means no beat");
+
+// a pattern that doesnt make sense stops the build here
+#define CLASSIC_BEAT_CHECK(name, steps, bpm, ...) \
+    _Static_assert(BEAT_PATTERN_OK(steps, bpm, __VA_ARGS__), #name " has lanes longer than its steps, no hits or a bad tempo");
+CLASSIC_BEAT_LIST(CLASSIC_BEAT_CHECK)
+
+#define CLASSIC_BEAT_PATTERN(name, steps, bpm, ...) [name] = BEAT_PATTERN(steps, bpm, __VA_ARGS__),
+
+const beat_pattern_t classic_beats[NUM_CLASSIC_BEATS] = {
+    CLASSIC_BEAT_LIST(CLASSIC_BEAT_PATTERN)
+};
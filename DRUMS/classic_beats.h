@@ -0,0 +1,44 @@
+#ifndef CLASSIC_BEATS_H
+#define CLASSIC_BEATS_H
+
+#include "beat_pattern.h"
+
+// The built in beats, picked with the beat select button or the arduino's beat pins
+// (CLASSIC_1 plays the first one here and so on).
+// To add one put another X(...) line in the list, it gets checked when it compiles.
+// name, steps, bpm, then one lane per pad with step 0 on the left:
+//   kick, tom1, tom2, snare, crash
+// WE HAVE NO HIHAT, hithats seem to come up a lot, but we dont have one smh
+#define CLASSIC_BEAT_LIST(X) \
+    /* money beat, crash on every 8th */ \
+    X(CLASSIC_BEAT_MONEY, 16, 120, \
+      0b1000000010000000, \
+      0, \
+      0, \
+      0b0000100000001000, \
+      0b1010101010101010) \
+    /* hip hope r smt (the crash at the end could go, it sounds kinda bad) */ \
+    X(CLASSIC_BEAT_HIP_HOP, 16, 120, \
+      0b1000001010000000, \
+      0, \
+      0, \
+      0b0000100000001000, \
+      0b0000000000000010) \
+    /* funky beat, NOW THIS IS GOOD */ \
+    X(CLASSIC_BEAT_FUNK, 16, 120, \
+      0b1000100100001000, \
+      0, \
+      0, \
+      0b0010001000100010, \
+      0b0101010010000101)
+
+#define CLASSIC_BEAT_ID(name, steps, bpm, ...) name,
+
+typedef enum {
+    CLASSIC_BEAT_LIST(CLASSIC_BEAT_ID)
+    NUM_CLASSIC_BEATS
+} classic_beat_t;
+
+extern const beat_pattern_t classic_beats[NUM_CLASSIC_BEATS];
+
+#endif // CLASSIC_BEATS_H
@@ -1,7367 +0,0 @@
-// audio data for: darude_sandstorm_audio
-// sample rate: 22050 hz
-// duration: 4.000 seconds
-// length: 88200 samples
-
-#ifndef AUDIO_DATA_H_DARUDE_SANDSTORM_AUDIO
-#define AUDIO_DATA_H_DARUDE_SANDSTORM_AUDIO
-
-#include <stdint.h>
-#include <stddef.h>
-
-const size_t darude_sandstorm_audio_length = 88200;
-
-const int16_t darude_sandstorm_audio[88200] = {
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0,
-    0, 1, 1, 1, 1, 1, 2, 3, 3, 2, 2, 2,
-    1, 3, 3, 1, 2, 6, 5, 3, 4, 2, -1, -2,
-    -2, -1, 3, 7, 4, 12, 13, 4, 4, 10, 9, 6,
-    10, 10, 16, 20, 21, 19, 13, 15, 11, 17, 20, 11,
-    13, 37, 37, 20, 28, 8, -9, -11, -7, -14, 16, 57,
-    35, 74, 91, 22, 24, 65, 61, 21, 74, 73, 89, 121,
-    130, 115, 69, 78, 60, 113, 116, 51, 62, 240, 247, 104,
-    218, 52, -110, -49, -117, -54, 49, 214, 208, 366, 373, 163,
-    174, 260, 194, 190, 180, 136, 405, 250, 224, 300, 251, 354,
-    -108, 138, 359, 164, 69, 427, 318, 497, 438, -162, -122, -18,
-    195, -456, -493, 147, 168, -211, -565, -413, -500, -390, -381, -828,
-    -473, -366, -815, -580, -573, -623, -152, -727, -243, -118, -512, -902,
-    -715, -751, -804, -609, -1447, -1022, -1121, -1387, -1341, -749, -1026, -1065,
-    -969, -510, -158, -532, -98, 265, 674, 377, -367, -571, -274, 628,
-    1280, -455, -353, 139, 504, -35, -128, -355, -354, -98, -55, 754,
-    476, -308, -609, 138, 128, -153, -1292, -752, -128, -331, 30, -1477,
-    -807, -859, -1268, -2102, -1410, -753, -510, -407, -53, -332, -748, -238,
-    781, 1218, -810, -1175, -1273, -998, 17, 765, 515, -14, 1262, 1239,
-    2183, 2025, 1853, 1384, 2008, 2548, 1993, 1067, 475, -724, -69, 1764,
-    2117, 1298, 830, 1474, 1559, 1337, 1922, 1912, 545, -356, -558, 594,
-    -779, -637, 390, 305, 798, -583, -1083, -284, 526, 29, -809, -654,
-    761, 1246, 492, 847, -22, 394, -466, 445, 1168, 1178, -643, 175,
-    2339, 2088, 1335, 191, 353, 1159, 2328, 2322, 2380, 1877, 2968, 2608,
-    1290, 1413, 1468, 1880, 745, -18, 805, -275, -665, 92, -424, -5,
-    -648, -1269, -819, 389, -218, -226, 603, -99, -9, -779, -1130, -132,
-    -1080, -1746, -1166, -1539, -1223, -1972, -3092, -2408, -1067, -896, -3490, -2684,
-    -1534, -2229, -2897, -3388, -1365, -1653, -875, -537, -1834, -1001, -369, -1754,
-    -2430, -1225, -1173, -1052, -1785, -772, -373, -1858, -691, -1223, -1069, -1139,
-    -742, -1331, -106, 159, 198, -143, 269, -1105, -1467, -2594, -3785, -2161,
-    -2034, -2977, -557, 808, -1808, -2196, -1072, -1291, -2659, -3218, -3659, -2837,
-    -2252, -2111, -3238, -2115, -665, -2185, -1219, -2129, -823, -2987, -1760, -1940,
-    -2983, -2130, -2397, -2752, -1891, -672, -2004, -459, -1060, -1496, -1201, -1204,
-    -1895, -903, -790, -824, -240, -1672, -1650, -2821, -3332, -722, -733, -986,
-    -1809, -991, 1319, 1202, 130, -1083, -1656, -1744, -72, 153, -560, -645,
-    -2661, -1799, -668, -617, -1843, -2212, -1013, -642, -1383, -1023, -827, -1509,
-    -67, -1017, -1859, -2560, -1371, -2247, -3189, -2531, -2047, -3053, -3169, -3180,
-    -2612, -1506, -1177, -1011, 793, -724, -2072, -701, -1490, 72, -1802, -1044,
-    -1733, -1122, 1074, -838, -2333, -930, -1718, -1449, -975, 153, 940, 5,
-    -295, -821, -854, -1124, -710, -1131, -1105, -436, -80, 929, -325, 361,
-    393, 1116, -118, -550, 845, -1182, -687, 62, 465, -1362, -968, 2043,
-    78, -938, -1176, -225, 481, 1427, -14, -182, 383, 1768, 2267, 2985,
-    -10, 620, 730, -661, -593, 1052, 1261, 2039, 3009, 3205, 2711, 1145,
-    1624, 3925, 1349, -15, 55, 1380, 1705, 1219, 848, 1743, 1596, 1935,
-    1708, 1247, -336, 1670, 749, 767, 492, 888, 1896, 977, 2183, 1863,
-    1886, 1558, 2102, 2072, 1141, 2331, 2039, 2065, 1052, 1662, 1175, 1865,
-    1779, 311, 1601, 2316, 3198, 1918, 505, 2110, 2597, 2015, 507, 605,
-    2936, 3150, 2130, 3059, 2781, 3211, 3994, 2898, 3321, 3609, 2493, 2784,
-    2060, 2729, 1510, 2165, 1591, 1471, 2288, 2639, 1414, 1959, 2698, 1660,
-    567, 846, -84, 689, 33, -1113, -909, -1188, -163, 152, 454, 778,
-    685, 16, -766, 1209, -134, -763, 885, 525, 454, -772, -558, -458,
-    993, 1648, 1124, 432, 2292, 1082, 1089, 639, -913, -491, -465, -729,
-    -737, 938, 1129, 173, 502, 840, 75, -451, 221, 850, -117, -671,
-    -386, 935, 9, 402, 105, 599, -225, -322, -24, -180, -819, -45,
-    -704, -948, -689, -455, 123, -1377, -1874, -1655, -659, -892, -491, 257,
-    -531, -529, 127, 653, 1013, 338, 1073, 677, 2381, 472, 1614, 2126,
-    2132, 1966, 1273, 1737, 3131, 2155, 2509, 272, 1072, 1265, 2528, 333,
-    -207, 146, 971, -8, -698, 289, -493, -195, -636, -641, 768, 114,
-    749, 1812, 1585, -335, -467, 690, 1246, 879, -349, -603, 959, 1542,
-    852, 1645, 1199, 649, 816, 719, 875, 1033, 478, 830, 65, -198,
-    545, 227, -1293, -1901, -1305, -339, -386, -396, 210, -377, -1016, -178,
-    1152, 1284, 828, 1444, 1865, 275, -149, -1271, -695, -770, -206, -1647,
-    -889, -2994, -2955, -1779, -1105, -1510, -1876, -648, -781, 955, 36, -1335,
-    -524, -517, 1036, 285, -141, 179, -433, -254, -1526, -915, -1177, 589,
-    433, 557, 316, 729, 1042, 11, 12, -315, -349, -1505, -17, -741,
-    -1660, -1226, -1717, -1761, -94, -220, -1238, 56, 298, -781, 572, 247,
-    244, -177, -1531, -1153, -421, -260, 230, -695, -250, 365, -204, -110,
-    718, 1093, 581, 660, -622, -308, -1184, 109, 660, -178, 12, -711,
-    -979, -575, 833, -365, -1243, -675, 1519, -270, -1249, -2356, -1775, -716,
-    -256, -1824, -962, -2529, -1303, -1255, -668, -337, -424, -624, -266, -1129,
-    -1489, -1053, -1069, -877, -359, -1730, -1915, -496, -957, 392, -691, -437,
-    321, 1495, 151, -860, -1060, -330, -382, -2569, -2594, -1768, -1827, -2167,
-    -615, -1351, -51, -896, -1688, -152, -806, -2237, -2019, -1720, -1064, -614,
-    -587, -576, -174, -663, -909, -1938, -257, -359, -2156, -1737, -735, -131,
-    -999, -1584, -104, -631, 142, 361, -999, -109, 6, 208, -51, 88,
-    -738, -351, -399, -1423, -1215, -1831, -1683, -1775, -1845, -1811, -1711, -321,
-    -537, -1707, -1616, -2548, -2237, -2621, -1579, -2382, -2502, -1768, -1183, -2136,
-    -2581, -1690, -1147, -2286, -2531, -1626, -883, -2533, -3132, -877, -169, 844,
-    -429, 358, 219, 582, 487, -804, -295, -1037, -1121, -493, -1872, -850,
-    915, -1235, 46, 1110, 1695, 751, 71, -1324, 461, 980, -852, -356,
-    -749, -610, -266, -548, -792, -1289, -1818, -1624, -457, -2259, -2816, -2190,
-    -1945, -603, -1826, -1776, -2280, -930, -894, -751, -2140, -1931, -1243, -576,
-    -587, -347, -1328, -825, -663, -3108, -2364, -1193, -1377, -1207, -1907, -1163,
-    -401, -345, 80, 825, 1463, 480, -54, -94, 933, -1084, -56, -38,
-    286, 648, 1081, 2330, 1210, 647, 628, 1414, 2638, 1615, 1794, 2158,
-    2306, 2821, 323, 1062, 1055, 1742, 437, -1746, -834, -559, 913, 1049,
-    1230, 1866, 1757, 487, 30, 1072, 115, -851, 324, -257, 171, -568,
-    -381, -1192, -1576, -351, 357, -33, 212, 1027, 1442, 147, 613, 448,
-    150, -155, -213, -876, -564, -178, -1338, 572, -453, -939, -1294, 201,
-    991, 1464, -143, -520, 204, 1239, -623, 810, 788, 1176, 470, 702,
-    1544, 1746, 1312, -565, 862, 933, 615, 1552, 99, 6, 2273, 1963,
-    2398, 1905, 3745, 2489, 2913, 3162, 3674, 3719, 3593, 3741, 2635, 4131,
-    2452, 4474, 4189, 2789, 2986, 4182, 4854, 4287, 4152, 4564, 3560, 4565,
-    3784, 3180, 2857, 2850, 2982, 2546, 2852, 3355, 3473, 4528, 3072, 2885,
-    3170, 2825, 2554, 2392, 3114, 2772, 1689, 968, 1768, 1665, 1309, 1258,
-    1490, 692, 1737, 2186, 1934, 2108, 1978, 1129, 2412, 3406, 2015, 1687,
-    1665, 3262, 4044, 4106, 3133, 3144, 4203, 2662, 2865, 3330, 3171, 3991,
-    4431, 3099, 3556, 4781, 4512, 3411, 2686, 4006, 5277, 2855, 3199, 3811,
-    3257, 3955, 3417, 2554, 2075, 2771, 2362, 2389, 2182, 1863, 1222, 1492,
-    1158, 1851, 1733, 59, 35, 949, -568, 194, -1595, -1648, 573, 66,
-    -38, -254, -153, -378, -554, -400, -809, 666, -1061, -540, -488, -1286,
-    -429, -882, -1314, -1141, -1095, -1745, -449, -1292, -1652, -1179, -145, -183,
-    -259, -1433, -511, 236, 295, -699, -776, -1931, -1929, -2265, -1634, -3406,
-    -2390, -1627, -1155, -2563, -2847, -1330, -2582, -2699, -2318, -2999, -4086, -4754,
-    -4578, -4592, -3323, -5410, -5759, -5388, -4055, -3870, -4104, -3329, -3372, -4398,
-    -4202, -4241, -3100, -4042, -2863, -3662, -2971, -2894, -2839, -3009, -3898, -5213,
-    -3299, -4602, -5107, -3746, -2906, -2418, -2274, -3539, -1797, -2845, -4929, -2912,
-    -2385, -3508, -4742, -3952, -4250, -4945, -2827, -2159, -2883, -4566, -3454, -2002,
-    -2110, -2235, -1338, 391, 461, -505, -2114, -3217, -3410, -2649, -4476, -2042,
-    -2063, -2126, -2025, -1040, -1509, -2842, -927, -1674, -967, -3024, -3243, -1639,
-    -1457, -1828, -4439, -2545, -3027, -2012, -1839, -936, -1962, -1792, 318, -1126,
-    -831, -2732, -163, 331, -176, -440, -211, 305, 508, -208, -71, -1266,
-    74, -2267, -2827, -2692, -2615, -2923, -2351, -2796, -2773, -3012, -906, -659,
-    -2030, -1967, -1120, -1850, -2944, -1470, -2707, -969, -1334, -1463, -913, -923,
-    150, -843, -1020, -1012, 804, -4, -1030, -262, 2002, 1087, 1513, 1273,
-    1676, -366, -360, 1279, 1147, 3272, 2887, 1604, 3245, 2885, 1971, 268,
-    1961, 995, 1794, 843, -297, 1937, 3330, 1532, 725, 874, 3731, 1829,
-    2254, 2367, 2623, 1962, 1573, 3123, 1835, 2537, 1016, 429, 359, 1875,
-    2161, 1305, -1282, 1015, 897, -1037, -1821, 775, 1960, 1176, 1727, 2692,
-    3446, 2017, 4873, 3138, 4409, 4963, 4253, 1984, 1484, 2864, 2160, 1534,
-    423, 1410, 1828, 635, 3916, 3606, 3515, 2930, 2675, 1844, 1672, 2132,
-    -666, 2118, 3775, 2960, 4963, 3090, 5242, 5621, 4223, 4731, 4200, 3452,
-    5446, 3733, 3560, 971, 2535, 855, 2048, 1155, 583, 1020, 3129, 3308,
-    3094, 2530, 1794, 23, 2063, -387, -150, 593, -584, -1302, -950, -1076,
-    -1505, 1529, 545, 1313, 2285, 657, 1470, 1719, -342, 227, -290, 1456,
-    1584, 3180, 1075, 849, 1850, 1750, 4231, 2508, 1027, 1725, 4301, 2473,
-    882, 1398, 687, 1472, 1165, 309, 230, -407, -392, 2031, 1182, -438,
-    1752, 1437, 563, 73, -150, 442, -196, -4112, -3491, -3773, -3930, -1818,
-    -2033, -2448, -1426, -593, -2178, -1229, -2830, -2638, -2547, -2087, -3840, -3546,
-    -3798, -2504, -2100, -417, -1621, -937, -837, -389, 784, -473, -2296, -1037,
-    -201, -1505, -2349, -1656, -1140, -1254, 981, -295, 610, -154, -1509, -1474,
-    1471, 1325, -1333, -2794, -4177, -2563, -3729, -4549, -3654, -2928, -2544, -959,
-    -3399, -3909, -1995, -4917, -5561, -4096, -3983, -5034, -4200, -4930, -4404, -1657,
-    -2332, -3302, -983, 50, -443, -149, 486, -1088, -1280, -2054, -2719, -2338,
-    1112, 1239, -1742, 227, 2576, 1720, -52, -289, 1150, -87, -100, -1151,
-    -2549, -2552, -3072, -2553, -1317, -158, -1802, -920, -982, -780, 35, -1383,
-    -471, -1148, -609, -344, -1273, 66, -1315, -1973, -566, 543, 728, 78,
-    -331, 1175, 1186, 1697, 1027, 108, -502, 1691, 1961, 2308, 4938, 3493,
-    1634, 2241, 2195, 3325, 1779, -382, 414, 1330, 1781, 2114, 976, -128,
-    1209, 1064, 1500, -507, 38, 1483, 114, -735, 1483, 1884, -668, 380,
-    -288, 1108, -1619, -1369, -1678, -689, -1022, -1289, 268, 2345, 2544, -170,
-    186, 1644, 3542, 2847, 2356, 1204, 2034, 2445, 3142, 3208, 1083, 2484,
-    2746, 1885, 2829, 3509, 1150, 1333, 2118, 951, -618, 962, 1114, -299,
-    2196, 1121, -1387, 321, 2628, 498, -2305, 894, 2531, 2603, 613, 1329,
-    1314, 2397, 2105, 2498, 2806, 4362, 4855, 3943, 2446, 1451, 1881, 3154,
-    2298, 1382, 2070, 1678, 2709, 516, 883, 3284, 2242, 1828, 3437, 845,
-    -1875, 47, 646, 233, -693, -1577, -1183, 34, 1626, 1172, -376, 542,
-    391, 1027, 953, -391, -1518, -891, 5, 1693, 388, 1333, 2504, 1015,
-    2028, -172, 107, 2377, 1214, 2220, 211, -181, 1861, 2071, 1524, 1427,
-    1081, 1479, 3143, 2777, 1865, 3077, 3186, 2069, 3552, 1190, -2449, 638,
-    1329, -1959, -2927, -1822, -1704, -1734, 2069, -665, -526, 964, 81, -1043,
-    -3047, -2708, -2783, -1485, -1591, -1311, -1486, -2934, -882, -711, 1881, 327,
-    -161, 340, 384, 769, -585, -1530, -2088, -539, -640, -1104, -1218, -846,
-    533, -1117, -351, -872, 606, 2511, -510, -2188, -381, -1284, -1990, -1943,
-    -3654, -4680, -3466, -942, -1505, -4548, -3364, -3607, -4349, -4058, -3174, -3068,
-    -3111, -3977, -2799, -1657, -3459, -5199, -2864, -640, -1707, -1935, -1121, 32,
-    -26, -1160, -3522, -1990, -1750, -3092, -1156, -1268, -1433, -603, -2113, -2786,
-    -915, -94, -1117, -1068, 53, 1020, -617, -2283, -718, -810, -2475, -2130,
-    -528, -207, -1089, 2040, 416, -2052, -1692, -1834, -1463, -2842, -1748, -1651,
-    -646, -507, -803, 911, -202, -957, 1145, 1064, 440, -90, -2422, -1808,
-    451, -86, -728, 101, 1681, 1627, 3093, 712, -283, -429, -1175, 767,
-    817, -1122, 536, 3288, 2923, 880, 153, 1457, 1794, 795, 158, -15,
-    -44, 37, 678, 1207, -1220, -826, 402, -211, -988, 859, -209, 262,
-    -1310, 20, 754, 992, 2034, 212, 643, -507, -1199, 670, 1716, 1283,
-    1721, 2649, 2564, 1067, 1623, 1010, 2049, 1061, 1014, 2009, 847, -560,
-    -1306, -852, 350, 1764, 3210, 1146, 327, 1402, 1412, -168, 1519, 2289,
-    1646, 1843, 1266, 1424, 1933, 2021, 2808, 2408, 4715, 4029, 3055, 3736,
-    3283, 3718, 2232, 1403, 2446, 2151, 3547, 3083, 3025, 2291, 2542, 3555,
-    1591, 413, 1097, -215, -571, -588, -92, -2094, -2430, -2900, -3192, -2559,
-    -522, -815, -967, -895, -1257, -1041, -1740, -2139, -2896, -4070, -2191, -2035,
-    -2373, 408, -681, -672, 1274, 269, 383, -178, 98, 488, 1519, -874,
-    -1204, -121, -235, 2235, 2062, 2024, 2014, 1822, 2000, 2413, 1382, 572,
-    225, 974, 1119, 61, -543, -1668, -518, -1755, -2147, -1608, -701, 174,
-    1913, 1979, -602, -343, -1021, -1683, -1928, -1484, -3643, -2466, -953, -1664,
-    1254, 1883, 1321, 317, 2198, 2405, 2164, 2148, 1194, 379, 485, 1413,
-    1292, 1356, 2221, 670, 1714, 2111, 1346, 1054, 1697, 1105, 1189, 510,
-    895, -1928, -1764, -181, -977, -2634, -2492, -4173, -1220, -1825, -144, -1777,
-    15, 555, -1411, -1735, -1763, -626, -917, -1248, -1331, -1981, 395, -976,
-    -1426, -715, -766, 886, 161, -1477, -332, 823, 375, 923, 2164, 2146,
-    1741, 800, 1460, 424, -136, 2105, 1157, 1298, 2748, 1642, 359, 835,
-    -193, -1485, 759, 1791, -456, -1169, -629, -755, 376, -764, -1504, -1096,
-    -2806, -1945, -2084, -1649, -2004, -1207, -661, -1739, -3746, -1677, 315, 93,
-    2271, -633, -393, 227, -1439, -3375, 158, -5, 1146, 727, 3876, 1693,
-    893, 297, 59, -518, -241, 1459, -887, 1048, 1501, 1317, 540, 429,
-    1333, 597, -936, -1073, -697, 698, 1631, 599, -1527, -98, -1207, -590,
-    -829, -1232, 236, 298, -72, -621, 697, 703, 420, -525, -1825, -1113,
-    -2465, -1693, 108, 1390, 365, 1530, 2303, 296, 935, 2760, -669, -126,
-    32, -1143, -2495, 1924, 838, -861, -1867, -1722, -1066, 492, 575, -1693,
-    -1237, -901, 142, -24, -1437, -700, 898, 1088, 657, -873, 150, 1529,
-    573, -185, 1134, 1232, 1999, 2570, 1528, 2201, 2604, 984, 2189, -456,
-    -2445, -315, 1046, 85, 483, 577, -1206, -655, -604, -1220, -1331, -3062,
-    -3223, -2844, -4494, -5389, -3829, -4130, -3917, -3700, -4467, -4068, -3880, -3360,
-    -3349, -3917, -4220, -3664, -2885, -2452, -3598, -2919, -2905, -2276, -2728, -1219,
-    -1973, -339, 916, 109, 424, 326, 598, 1301, -561, 191, 478, 226,
-    -140, 1148, -435, 1133, 1323, 93, 769, 1296, -530, -981, 597, -276,
-    -1165, -2545, -2454, -2840, -630, -1127, -2021, -3403, -1026, -976, -1475, -2156,
-    -2564, -2965, -1537, -2510, -1438, 3, -375, 120, 42, -72, -119, 2258,
-    2155, 2492, -437, -139, -743, 46, 2180, 1919, 2410, 3086, 4067, 2937,
-    3434, 3647, 2551, 2003, 1730, 893, 1916, 499, 529, 2324, 1474, -992,
-    1223, 1177, -1120, 570, 1290, 1456, 628, -475, 611, -176, -70, 686,
-    -149, 485, -1250, 794, 519, 858, 951, 2737, 2095, 2149, 2840, 1733,
-    1467, 1538, 1237, 959, 553, 1882, 3105, 1552, 1649, 1812, 2720, 3052,
-    3319, 3177, 3067, 2199, 3075, 3081, 2081, 1428, 1129, 2013, -192, 1500,
-    2479, 1165, 1965, 2525, 2346, 721, 274, 446, -550, 811, 4, -877,
-    -778, 762, 1183, -590, 654, 2432, 2971, 1816, 3518, 2661, 1241, 1907,
-    2578, 3007, 3720, 3459, 3810, 4116, 1990, 726, 1135, 2019, 1938, 1256,
-    2126, 2312, 2526, 1579, 2178, 2611, 1272, 1079, 615, 789, 685, 832,
-    1415, 1713, -30, 196, -1116, -1838, -1094, -650, -1684, -769, -198, 850,
-    1633, 1806, 1654, 827, -214, 268, 576, -972, 19, 742, 72, 1144,
-    1165, 1396, 768, 836, 164, 863, -476, -929, -651, -1503, -3997, -3196,
-    -2661, -2685, -3678, -1635, -1861, -895, -1316, -1731, -1772, -762, -1501, -1747,
-    -2219, -2204, -1997, -1838, -2533, -53, -1131, 250, 1598, -611, 546, 537,
-    112, 574, 2069, 1227, 1414, 1563, 1002, 705, -51, 1686, 732, -476,
-    17, -1099, -2593, -2530, -3091, -2497, -2201, -2083, -2574, -290, -49, -1526,
-    -1939, -1615, -3670, -2830, -2561, -3417, -3877, -2551, -1648, -2718, -2963, -3880,
-    -3182, -3582, -3971, -3767, -4259, -2965, -2022, -1358, -2772, -1547, 359, -731,
-    -1431, 580, -1565, -1355, -2148, -1777, -2223, -956, 779, -41, 302, 29,
-    -908, 452, 3, 622, -270, 484, 393, 1867, 1650, 1385, 801, -202,
-    -352, -304, 329, -1291, -2001, -1985, -1837, -255, -137, -368, -316, 898,
-    126, -311, 991, 697, -207, -457, -1466, -658, -1025, -374, 237, 1607,
-    60, 546, 620, 759, 541, 1012, 362, -424, -854, -1442, -1338, -1986,
-    -1101, 41, -351, -1206, -2090, -828, -748, -1830, -914, -817, -929, -1576,
-    -2249, -142, -1271, -1772, -2226, -1634, -1405, -761, -1339, -1368, -277, -638,
-    -1313, -706, -1168, -2294, 943, -418, -635, -1015, -120, -595, -466, -784,
-    -95, 451, -401, -1362, -747, -41, 1217, 193, 429, 1545, 2436, 1567,
-    1260, -129, 224, -757, -441, -184, 944, 132, 2201, 1131, 1363, 671,
-    1549, 595, 1503, 881, 1562, 875, 1100, 1884, 1260, 936, 2802, 1779,
-    2434, 2263, 1741, 2621, 2420, 3314, 2847, 3008, 3392, 1544, 1305, 1200,
-    1535, 462, 182, 2460, 3028, 2029, 1085, 2384, 2384, 2216, 2251, 1810,
-    1853, 1317, 2003, 1323, 946, 198, 805, 1051, 800, 1466, 251, -69,
-    1145, 855, 1817, 738, 1330, 1750, 972, 1221, 910, 2102, 2000, 1080,
-    1483, 275, 1235, 2140, 2640, 2300, 2225, 1255, 1877, 539, 1170, 810,
-    526, 613, 1156, 107, -23, 477, -86, -674, 669, 1171, 396, -48,
-    971, 566, 1235, 556, 145, 397, 72, 921, 719, 889, 956, 1522,
-    2283, 1345, -483, -269, -717, -851, -1208, 414, -514, 358, -127, 1568,
-    148, -2226, -438, -135, -1057, -1260, -1880, -1811, -768, -2328, -1291, -541,
-    -361, -1953, -1654, -1816, -2884, -2832, -2523, -2283, -2969, -3872, -2941, -1664,
-    -3142, -3594, -3435, -2577, -3598, -2708, -3078, -2471, -1515, -1845, -1021, -1461,
-    -1353, -1370, -1505, -1177, -1031, -1072, -1220, -336, -1290, -1720, -1067, -1225,
-    -699, -1161, -314, -1362, -1008, -830, 182, -1452, -1484, -48, -711, -1047,
-    -1662, -1430, -1729, -1304, -2116, -2007, -2553, -2358, -1748, -1277, -191, -408,
-    -874, -1509, -1544, -829, -1586, -1205, -1138, -1716, -577, -781, -686, -1327,
-    -822, 323, 1915, -519, -1474, -330, 434, -592, -1126, -1224, -836, -479,
-    -1061, -951, -227, -773, 621, -921, -1542, -1219, -245, -1176, -1103, -1882,
-    3, -1628, -1796, -1138, -1288, -1690, -1606, -835, -1585, -968, -519, -423,
-    -1079, -1062, -40, 46, 587, 1199, 1052, 1054, 1782, 1442, 1266, 382,
-    -327, 1065, 2905, 638, 70, 820, 522, 548, 1485, 659, 271, 1239,
-    2038, 1804, 2764, 3143, 2505, 962, 1751, 1795, 664, 77, 675, 1627,
-    294, 82, 1757, 4191, 2842, 1228, 1018, 2118, 496, 35, 1666, 1610,
-    690, 2128, 2371, 2437, 952, 2877, 3211, 2972, 1836, 2442, 2462, 2297,
-    3029, 3812, 2852, 2650, 1753, 2531, 2320, 606, 1497, 1705, 1651, 1530,
-    3310, 2448, 2160, 1937, 2483, 1002, 1197, -224, 63, 761, 41, -767,
-    -688, -21, 1356, 1892, 1785, 564, 964, 2273, 2313, -274, 1936, 2084,
-    2558, 1466, 1702, 2153, 2652, 2075, 2344, 3221, 1305, 2180, 1962, 2227,
-    2865, 1699, 1220, 1841, 1664, 876, 1824, 2620, 1083, 1937, 871, 2120,
-    1784, 2888, 1435, 2089, 3273, 1058, 2491, 2323, 752, 653, 614, 1339,
-    895, 1008, 771, 1963, 1137, 1241, 960, 1348, 971, 563, 529, 88,
-    131, -1434, -995, 47, -1424, -750, -115, -134, -1110, -1816, -214, 882,
-    -296, -1123, -1400, -254, -1546, -805, -1330, -713, -2235, -2993, -874, -1903,
-    -2603, -2563, -987, -1719, -1107, -2064, -1868, -2448, -2767, -3439, -3412, -3352,
-    -1612, -1482, -1391, -1722, -1362, -1112, -1558, -1698, -1115, -1221, -1316, -1805,
-    -1504, -1834, -607, -1268, -1553, -1472, -950, -1676, -629, -1577, -1660, -1819,
-    -1363, -1309, 199, -358, -1338, -1120, -1419, -2010, -2031, -2233, -2388, -3283,
-    -2291, -2675, -2604, -3045, -2407, -2676, -4248, -4571, -2475, -2724, -2078, -4081,
-    -2444, -1922, -2346, -3169, -2872, -5040, -5003, -3362, -2371, -2822, -2418, -1461,
-    -1898, -3780, -3285, -1842, -2830, -4958, -4345, -3572, -4849, -4912, -3221, -3527,
-    -4854, -3765, -3233, -3411, -3559, -2358, -2692, -4142, -3006, -3225, -2020, -3105,
-    -3232, -2560, -2052, -2330, -2678, -2547, -2227, -596, -1649, -1300, -1589, -1176,
-    -824, -491, -1341, -537, -400, -905, -1581, -429, -952, -2091, -587, -46,
-    -280, 503, 516, 407, 292, 269, 1663, 1243, 343, -19, 720, 988,
-    765, 962, 291, 609, -65, 1057, 633, 832, 1643, 1387, 1563, 1097,
-    -63, 365, 193, 1127, 1253, 787, 1541, 2300, 1325, 1353, 1285, 2863,
-    2850, 764, 1179, 2641, 1930, 2508, 2028, 2935, 2700, 2952, 2868, 2970,
-    3211, 4133, 4609, 4441, 4044, 2820, 2234, 2352, 3279, 3171, 3501, 4056,
-    4291, 5542, 4881, 3619, 3484, 3829, 2334, 1031, 2217, 3406, 3126, 3417,
-    2597, 1980, 2849, 1092, 1567, 1221, 2067, 1112, 1481, 1702, 1893, 1659,
-    1450, 1702, 2017, 2248, 1836, 2479, 2130, 1550, 1366, 2540, 2234, 2331,
-    1762, 3327, 2271, 2514, 1930, 2303, 895, 1256, 2583, 2875, 2453, 1554,
-    2617, 3225, 2487, 2633, 2475, 2694, 2325, 1308, 812, 1100, 1682, 2025,
-    1825, 539, 1150, 822, 601, 623, 890, 536, -1056, -978, -1345, -1432,
-    -1633, -439, 329, -924, -286, 486, -651, -328, -1204, -1349, -1532, -1161,
-    -1567, -2305, -2240, -1722, -1355, -1682, -1071, -516, -987, 1041, -614, -561,
-    -1811, -2770, -1975, -1996, -2662, -1816, -659, -518, -440, -1327, -1238, -1000,
-    -395, -665, -734, -1788, -2370, -1121, 187, -1155, -1099, -298, -437, -632,
-    -1782, -814, 1180, 218, -653, 21, 630, -47, -496, -1048, -1107, -2593,
-    -1866, -1733, -1025, -868, -591, -942, 119, -693, -450, -142, -631, -375,
-    -219, -613, -195, -826, -587, -1197, -2290, -1431, -560, -1623, -2300, -2307,
-    -2513, -1262, -2036, -2253, -2233, -1880, -286, -493, -1708, -2604, -2253, -2820,
-    -2427, -2416, -3668, -2473, -2407, -3528, -3587, -3200, -2406, -2912, -3610, -3866,
-    -3824, -3954, -3887, -2638, -3191, -2654, -2757, -1900, -1537, -2167, -1976, -2702,
-    -3385, -2251, -2309, -2281, -2261, -2596, -1899, -712, -541, -399, -947, -582,
-    -539, -913, -212, 550, -468, -852, -190, -477, -548, -117, 176, 202,
-    3, -210, 442, 1380, 2528, 1535, 1854, 1855, 1763, 1473, 964, 564,
-    1034, 1438, 1640, 1595, 1329, 1048, 1253, 1253, 176, 198, 885, 1183,
-    1860, 2013, 2361, 2373, 2610, 2285, 2209, 1498, 2056, 3007, 2475, 1799,
-    2485, 2956, 4056, 3705, 2569, 2102, 1699, 2752, 1613, 1022, 1153, 2266,
-    1003, 1710, 2412, 1694, 2808, 1861, 922, 716, -256, 304, 827, -339,
-    195, 1097, 783, 570, 1453, 1139, 1814, 1258, 1657, 545, 1402, 2292,
-    2312, 1108, 1478, 932, 1304, 2134, 1172, 922, 953, 1507, 1776, 1431,
-    955, 927, -56, 1269, 874, 521, 1248, 1877, 1833, 1118, 1276, 809,
-    1751, 1522, 1602, 1207, 1151, 1416, 1141, 1750, 2122, 2079, 2067, 2180,
-    2360, 821, 1192, 821, 913, 440, 651, 548, 2307, 2137, 1966, 1705,
-    2231, 1852, 232, 389, 372, -184, -59, 47, 189, 664, 1058, 220,
-    -540, -216, -147, -695, -885, -2361, -1667, -1465, -1502, -1598, -981, -859,
-    -1614, -471, -2759, -3365, -2837, -2204, -2808, -2815, -2195, -684, -956, -1397,
-    -1602, -1967, -1875, -1942, -2197, -3077, -3110, -545, -1863, -1263, -1815, -905,
-    -1067, -922, -1027, 651, 52, -124, 1227, 1380, 363, -721, -574, -825,
-    -1624, -1853, 189, 165, 105, -744, -88, 104, -1671, 2, -224, -512,
-    -1152, 35, -405, -472, -870, -197, -605, -1156, -1501, -184, -285, -951,
-    -815, -1527, -1299, 73, 817, 416, -176, 160, 851, -138, -580, -1434,
-    150, -406, -1445, -241, -209, -1421, -3086, -2833, -925, -1027, -1558, -1863,
-    -1382, -1604, -1601, -819, -1110, -920, -276, -1016, 56, -538, -932, -395,
-    216, -248, 774, 1074, -139, 48, -1249, -1236, -703, -1034, -1495, -1446,
-    -1382, -1111, -883, -1342, -1279, -255, 202, 316, 577, 319, 572, 213,
-    -94, -625, -478, -156, -851, -415, -967, -259, -303, 264, 136, 503,
-    239, 166, 1039, 1077, 572, -639, -932, -132, -161, -92, -665, 466,
-    1746, 1499, 1226, 148, 1207, 1673, 1998, 2243, 1985, 2686, 2412, 2622,
-    1970, 958, 1974, 2005, 2171, 834, 914, 107, -466, 441, 2532, 2188,
-    1750, 1610, 676, 2119, 516, 942, -153, -571, 457, -318, 300, -374,
-    460, 2471, 1220, 1105, 2086, -437, -1009, 154, -534, -139, 727, 1350,
-    2043, 1154, 207, 873, -889, -364, -458, -1673, -1337, -528, 344, 237,
-    -282, -147, 1008, 1089, 1459, 1585, 3000, 2733, 3974, 2933, 2853, 3185,
-    1459, 2207, 2706, 2596, 2572, 2394, 1855, 1050, 864, 717, 1322, 1540,
-    820, 603, -90, -358, 259, 327, 178, 47, -154, 420, 169, 886,
-    499, 196, 38, 1010, 227, 974, 1063, 300, 95, -514, -1100, -2565,
-    -1735, 232, -404, -941, -972, -163, 803, -267, -604, 122, -303, 335,
-    -338, -2030, -1530, -1830, -2587, -3086, -2365, -2185, -1275, -2589, -2722, -3301,
-    -2452, -3394, -3540, -3273, -4597, -3587, -2792, -3116, -4610, -4122, -2061, -1969,
-    -245, -403, -576, -443, 167, 482, 1437, 104, -992, 266, 608, 16,
-    353, 1895, 1800, 796, 1019, 603, -88, -331, -693, 476, -215, -696,
-    -510, -2372, -1879, -3085, -3019, -2732, -1474, -2905, -1637, -2157, -4101, -2993,
-    -2884, -2055, -2539, -2471, -1884, -2632, -2976, -1891, -789, -2496, -1710, -514,
-    -579, -208, -1226, -424, 280, -404, -561, -1546, 317, -569, -39, 1365,
-    1653, 617, 198, 683, -600, 77, 530, -433, -1182, -1058, -38, -715,
-    -1075, -1495, 99, -371, 249, 321, -1355, -869, -1794, -1213, -608, -1402,
-    -1548, -162, 1088, 767, 780, 2231, 1307, 535, 1608, 2603, 1717, 2095,
-    2264, 1518, 589, 1464, 1682, 1002, 1890, 3355, 1522, 3430, 4979, 3796,
-    2561, 2932, 2858, 1823, 1056, 1659, 1560, 1496, 709, 1711, 2052, 1189,
-    3514, 3215, 1813, 1074, 1032, 125, -1266, 1116, -508, 134, 304, 810,
-    -170, -1018, -532, 904, 1658, 1162, 2924, 2895, 2470, 819, 913, 27,
-    -191, 439, 870, 1272, 1463, 2680, 2509, 2542, 1060, 506, -50, 893,
-    -411, -618, -1294, -1477, -1359, -785, -3223, -1984, -556, -1237, -2628, -3270,
-    -577, -324, 873, 233, -1159, 449, -187, -2031, -1167, -1036, -286, -344,
-    -1416, -1492, 140, 1527, -22, 135, -202, -1139, -668, 400, -94, 473,
-    96, 2057, 570, 3558, 3052, 2030, 1416, 3013, 1867, 331, 1136, 1625,
-    -205, -462, -676, 1999, 1195, 827, 1186, 829, 182, -680, -1222, -2449,
-    -1639, -1596, -1677, -1794, -1304, -514, -369, 686, 1059, 734, 674, 1761,
-    2545, 556, 945, 45, -170, -65, 595, -163, 157, 2285, 2694, 1100,
-    1382, 2371, 943, 775, 638, 1314, -1591, 191, -1621, -3182, -3265, -2497,
-    -2303, -2019, -3398, -3833, -2879, -2214, -2131, -3183, -2965, -3097, -3225, -3564,
-    -4423, -1983, -2989, -1165, -1623, -858, -830, -149, -782, 625, 1095, 1313,
-    1285, 849, 634, 97, 692, 1528, 3559, 2080, 1761, 1753, 3856, 2686,
-    1196, 2009, 730, 1057, 30, 402, 400, -1616, -3574, -3073, -1589, -416,
-    -876, -1165, -1828, -2393, -2911, -2808, -3292, -1783, -1771, -2336, -1917, -363,
-    -302, -551, -597, -797, 473, -730, -89, 1593, 480, 1049, -455, -625,
-    390, 554, 283, -228, -322, 686, -75, 482, 889, 1665, 1636, 1091,
-    754, -1760, -1615, -844, -926, -2544, -1372, 712, 286, 1546, 2204, 419,
-    -560, 125, -929, -902, -841, -1790, -1132, -346, 887, -609, 1150, 1436,
-    1332, 297, 1150, 1793, 869, 1177, 2016, 1744, 2156, 2084, 907, 1158,
-    2940, 3323, 3024, 3361, 3446, 4302, 3836, 3923, 2840, 4036, 1860, 1086,
-    1556, 1027, 699, 1225, 1517, 987, 1501, 430, 1111, 1276, 842, 1253,
-    646, 1225, 688, 155, -1372, -495, 314, 2170, 2741, 2066, 1637, 2313,
-    2053, 2108, 1374, 3149, 1745, 1228, 1097, 653, 808, 2926, 4412, 3515,
-    3572, 3178, 4087, 2266, 244, 1777, 11, 1141, 405, 949, -139, -934,
-    1101, 2006, -299, -2181, -886, -555, -1716, -1039, -542, -944, -882, -717,
-    -2347, -2182, -1703, -2265, -1030, -577, -1327, -251, 60, 1605, 1370, -313,
-    1350, 930, -479, -668, 1517, 1791, 1431, 1976, 1732, 3313, 2941, 2782,
-    2683, 1910, 1346, 995, 1004, -368, -775, -535, -62, -535, 728, -292,
-    -569, -1094, -2616, -674, -2637, -2165, -3455, -2718, -2102, -2144, -279, -807,
-    -858, -1924, -3023, -944, -1588, -2067, -1080, -2424, -1336, -1789, -1078, -1865,
-    -2867, -349, -114, -36, 524, 130, -500, -810, -875, -457, -1348, -2714,
-    -2120, -2011, -3365, -4816, -2783, -2311, -2758, -1821, -1708, -2433, -2824, -3271,
-    -3912, -4748, -5051, -5268, -4964, -4534, -3950, -3135, -3857, -2257, -2584, -1959,
-    -873, -1515, -1921, -454, -944, -1702, -1199, -1760, -1877, -1082, -1964, -885,
-    53, 200, 1360, 407, -613, -308, -128, -348, -2262, -1846, -2814, -1809,
-    -1767, -2585, -1966, -1851, -1727, -1762, -2305, -3496, -3502, -3454, -3553, -2467,
-    -2533, -2756, -418, -1290, -1867, -2228, -809, 103, -884, -301, 250, 166,
-    1734, 128, 574, -128, -294, 1234, 1498, 974, 127, 1896, 3104, 2071,
-    2152, 3949, 3413, 1104, 440, 439, -212, -750, 877, -544, -893, 389,
-    -27, -879, -2248, -2549, -1384, -1758, -1371, -1382, -2253, -831, 36, -811,
-    -108, 149, -154, 311, 945, 50, -627, 195, 362, 316, 261, 1127,
-    1581, 1678, 2087, 2783, 2663, 3155, 3247, 3216, 4602, 3258, 3551, 2802,
-    2723, 2458, 1603, 2573, 2497, 2698, 3590, 2154, 2489, 2077, 1389, 892,
-    1304, 947, -84, -129, -1037, -64, 505, -663, 29, 444, -285, 378,
-    441, -680, 852, 1842, 686, 2380, 3084, 3859, 3348, 1542, 471, 742,
-    1961, 2528, 2585, 4190, 4415, 4121, 3847, 4203, 3508, 2490, 2556, 1155,
-    1065, 578, 1851, 2765, 960, 1343, 1717, -177, 235, -335, -1692, -572,
-    721, 495, 1295, 394, 375, 561, -912, -1927, -2113, -2308, -899, -1375,
-    -777, 137, -148, 553, -9, -117, -683, -582, 1141, 1451, 377, 1624,
-    2874, 2326, 1696, 2479, 1859, 1048, 1674, 762, 1805, 2041, 893, -172,
-    1214, 603, 1820, 1340, 767, -527, -1239, -1138, -2101, -1664, -2051, -881,
-    -451, -1301, -1443, -1790, -1309, -1142, -997, -977, -535, -305, 341, 251,
-    -605, -799, -632, -675, -245, -1389, 31, -600, 1046, 1706, 800, 157,
-    109, 541, 759, 227, 229, -340, -927, -643, -2679, -2415, -1101, -285,
-    -685, 365, -486, -1123, -2445, -2910, -2422, -3275, -1941, -1514, -867, -1328,
-    -1306, -1737, -883, -611, -1652, -1145, 279, 810, 515, 141, 605, 525,
-    648, 322, 683, 812, 786, 671, -166, 830, 739, 1872, 833, -415,
-    -158, -1070, -806, -1121, -572, -1489, -2992, -2626, -2717, -3016, -2438, -1461,
-    -2482, -2585, -3302, -2016, -2325, -2537, -2822, -3027, -2477, -1501, -1075, -383,
-    -1129, -1417, 302, 456, 936, 1772, 1263, 1963, 2002, 516, 350, 1424,
-    2023, 2477, 2090, 2493, 2916, 4110, 3525, 1810, 2282, 1470, 1301, 1723,
-    112, 509, -123, 163, 431, -1754, -1671, -423, -1213, -411, 326, -963,
-    -798, -720, -1236, -1375, -1807, -1232, 661, -6, -180, -136, 1916, 2279,
-    1508, 2990, 2807, 2710, 2409, 2086, 3339, 2539, 2512, 3014, 3585, 3905,
-    4225, 5288, 5642, 4584, 4048, 4224, 4208, 3093, 2493, 2534, 1245, 531,
-    1166, 1037, 557, -50, 839, 1591, 1926, 694, -578, -886, -420, -1162,
-    -2011, -1244, -2405, -1885, -2110, -1484, -1203, -1077, -647, -446, 501, -620,
-    -1217, -194, -551, -1461, -1423, 204, 1838, 2852, 3477, 3079, 3014, 2164,
-    2003, 697, -93, -675, -99, -1167, -1180, -305, -742, -824, 604, 1022,
-    -12, -1253, -727, -352, -929, -292, -109, -66, -1133, -1688, -560, -396,
-    -1386, -1110, 241, -1778, -1208, -1257, -516, -561, -23, -72, -1876, -2461,
-    -1403, -690, -783, 932, 178, 965, 1010, 1432, 2736, 1690, 1960, 1182,
-    920, 850, -421, -1593, -1584, -168, -539, -2627, -1214, -773, -1702, -1893,
-    -1573, -2300, -2366, -3356, -1741, -2338, -2394, -2500, -1825, -1548, -2093, -2621,
-    -1675, -837, -1752, -1527, -1838, -2028, -1212, -1109, -1247, -55, -864, -427,
-    -573, -1431, -688, -1213, -772, -2025, -1256, -1242, -1996, -2634, -2608, -2157,
-    -3535, -3589, -2742, -3154, -4077, -4469, -4302, -3207, -2958, -3138, -2567, -2756,
-    -3173, -2557, -3249, -2423, -1718, -1533, -1925, -1485, -653, -1103, -1069, -1170,
-    -261, -1029, -823, -761, -84, -866, -764, 52, -224, -243, -1023, -705,
-    -721, -1144, -1597, -957, -813, -1047, -798, -1399, -2572, -2499, -1622, -1598,
-    -2075, -1976, -1163, -1197, -1312, -1579, -2347, -3053, -1908, -2348, -2567, -2532,
-    -1674, -579, -1194, -597, 429, 499, -372, -365, -74, -229, 300, -148,
-    301, -162, 531, 962, 509, 1415, 2159, 1315, 318, -65, 231, 530,
-    -24, -1617, -834, -754, -398, 334, 58, 247, 253, 151, 1565, 985,
-    122, -414, -113, -41, -753, -656, -657, -292, 226, 906, 533, 772,
-    1481, 605, 290, -560, 1137, 1972, 1476, 1392, 2449, 1606, 1364, 837,
-    1476, 1559, 2234, 2872, 2140, 1774, 2191, 2905, 3874, 3124, 2852, 3476,
-    3574, 3648, 3888, 3138, 2961, 4517, 3548, 3803, 2516, 2414, 3157, 3394,
-    3444, 3115, 3823, 4221, 3928, 3513, 3831, 2947, 3352, 3137, 2935, 2923,
-    2330, 2942, 2278, 2278, 1422, 2216, 2096, 2583, 2294, 1895, 3005, 3240,
-    2982, 2087, 1850, 1906, 1967, 3038, 2966, 2147, 1559, 2075, 1782, 978,
-    1035, 1942, 864, 780, 551, 1492, 1487, 1169, 1214, 1392, 925, 643,
-    1340, 1338, 1375, 903, 190, 1261, 1743, 1388, 176, 242, 1037, 932,
-    1065, 1202, 1638, 2223, 2089, 1887, 815, 946, 1942, 2113, 1520, 2068,
-    1124, 1803, 998, 1936, 1687, 839, 257, 203, 123, -578, 140, -544,
-    -22, -717, -1041, -887, -323, -433, -246, 723, 218, -94, -34, 664,
-    526, 1332, 124, 102, 1316, 1107, 172, -540, -1539, -1483, -705, -1285,
-    -2098, -1147, -494, -200, -415, -23, -434, -399, 254, -863, -1389, -937,
-    -1690, -1734, -2218, -2109, -2295, -2711, -2675, -2886, -4399, -3998, -2486, -3350,
-    -4232, -5174, -4050, -2966, -3463, -3476, -3895, -3007, -2759, -2799, -2298, -2690,
-    -2238, -1781, -2136, -3004, -3818, -1531, -1942, -3047, -2791, -1974, -1169, -962,
-    -1144, -2019, -1235, -397, -741, -806, -1349, -977, -917, -839, -1494, -1553,
-    -1552, -1420, -1274, -784, -1374, -1475, -1138, -1312, -1677, -1592, -1909, -1048,
-    -1730, -1900, -2957, -2384, -1925, -2189, -2584, -3029, -2750, -1803, -1384, -648,
-    -1670, -1784, -2027, -2315, -2739, -2393, -2207, -1693, -2413, -3185, -1471, -1149,
-    -678, -1015, -1467, -1122, -863, -968, -181, 711, -434, -1095, -940, -738,
-    -636, -732, -523, -773, -634, -339, -143, -1005, -336, -545, -364, 319,
-    562, -337, -145, 836, 1280, 737, -71, 1463, 2004, 1010, 814, 995,
-    175, 861, 942, 475, 600, 1011, 1876, 2235, 1867, 1233, 411, 1171,
-    799, 82, 740, 735, 1418, 1269, 1648, 842, -733, -309, -37, -687,
-    -451, 119, 715, 1189, 1032, 1339, 1168, 1121, 234, 769, 1507, 1100,
-    1152, 1140, 1311, 525, 1292, 1345, 2594, 1561, 2148, 2493, 1725, 2380,
-    2013, 2117, 1690, 1166, 2113, 1546, 947, 145, 1320, 1981, 662, 754,
-    965, 1267, 660, 106, 1128, 1155, 1387, 565, 339, 234, 35, 1108,
-    738, 795, 1144, 939, 494, 274, 541, 738, 651, 1370, 1591, 1003,
-    1524, 962, 1448, 321, -278, -477, -196, -673, -231, -159, 165, 799,
-    2247, 2136, 1506, 867, 1804, 2486, 1808, 1180, 1316, 1113, 640, 1291,
-    1550, 1887, 2432, 1054, 1237, 1282, 125, -200, 195, 754, 182, 597,
-    453, 350, -36, 116, -318, -321, -240, 17, 201, 591, -199, 428,
-    603, 116, 381, -334, -497, -169, -979, -994, -252, -971, 395, 478,
-    -455, -886, -1823, -1796, -950, -1164, -1370, -1415, -633, -1615, -673, -804,
-    -776, -1978, -1748, -1983, -2099, -1690, -890, -1121, -397, -812, -640, -193,
-    39, -757, -1895, -965, -1, -752, -1034, -700, 432, -282, 553, -446,
-    -1066, -1725, -2561, -1794, -1755, -1546, -1489, -1685, -1709, -2362, -1338, -1013,
-    -951, -1308, -672, -369, -256, -14, 146, 766, 178, 138, -453, -393,
-    -146, 79, -522, -151, -546, 108, 674, 642, -28, 229, 1144, 507,
-    927, 492, 122, 201, 899, 65, -109, -144, -279, -912, -658, -142,
-    -700, -98, 326, 181, 2, 548, 2573, 2703, 2145, 2678, 2200, 2690,
-    1579, 1040, 1218, 1386, 2321, 2125, 1611, 1412, 1140, 1146, 1622, 1343,
-    1741, 2027, 1713, 1444, 2144, 1492, 1947, 1747, 1761, 1505, 928, 1442,
-    1252, 1856, 1995, 1677, 1368, 1226, 1002, 803, 136, 1561, 2272, 2409,
-    1619, 1948, 2605, 2656, 2074, 2710, 2484, 2578, 2404, 2507, 2321, 2433,
-    1480, 1721, 995, 641, 649, 958, 1174, 1263, 712, 756, 1702, 2652,
-    999, 1324, 1733, 1402, 1077, 1134, 1558, 871, -104, 109, 39, 598,
-    706, 554, 21, 118, 1086, 751, 956, 1243, 611, 674, 344, 153,
-    -899, -975, -621, -270, 781, 938, 381, 421, 1325, 1200, 1001, 707,
-    580, -409, -455, 792, -250, 675, 342, 388, -288, 354, 268, -572,
-    -934, -744, -539, -305, -489, -909, -35, -144, 145, -623, -740, -1159,
-    -506, -538, -666, -1952, -1213, -954, -760, 274, -1299, -1363, -1069, -393,
-    -1339, -1813, -1757, -1707, -1399, -447, -1455, -720, -1016, -806, -225, -1703,
-    -1959, -2515, -1730, -2502, -4024, -2954, -2855, -2828, -3168, -3472, -3591, -4153,
-    -3091, -3259, -3844, -3150, -3007, -3245, -3571, -3751, -4034, -4139, -4235, -5293,
-    -5009, -4392, -3710, -3980, -3288, -3055, -2744, -3426, -2549, -3393, -3322, -3310,
-    -2597, -3038, -3283, -2805, -2744, -3632, -3347, -2816, -2677, -3458, -3089, -2351,
-    -2132, -2236, -2389, -1822, -2487, -2379, -2394, -1730, -2566, -2093, -1505, -1637,
-    -2029, -1034, -1565, -845, -957, -345, -811, -711, -1487, -923, -413, -513,
-    -1182, -1518, -1845, -1803, -1648, -1991, -1880, -375, 442, 726, 874, 1223,
-    1024, 926, 199, -58, 101, -462, -963, -224, 596, 824, 106, -149,
-    -278, -685, -491, -873, -342, -744, -1193, -1425, -670, -471, -1344, -1289,
-    -616, -596, -837, -1598, -1500, -2077, -1251, -165, -1340, -720, -917, -540,
-    -214, -762, 129, 134, 804, 1514, 968, 1687, 1682, 2352, 2869, 1883,
-    1528, 1279, 2385, 2915, 2867, 2940, 3354, 2551, 2322, 2419, 2518, 2167,
-    2766, 2997, 2979, 3923, 3539, 3562, 2384, 3955, 3220, 2676, 2267, 2665,
-    3527, 2837, 2621, 2295, 2686, 2812, 2327, 2269, 2572, 2924, 2561, 2789,
-    3224, 2783, 2521, 3198, 3970, 4231, 2373, 3237, 3148, 3032, 3350, 3114,
-    3503, 4097, 4697, 4941, 3774, 3673, 3958, 4306, 3749, 3501, 4062, 4161,
-    3913, 3844, 3258, 2577, 2242, 2023, 1407, 1226, 1563, 1699, 2130, 1660,
-    1384, 1805, 786, 1021, 1130, 769, 1407, 1053, 521, -268, 439, 1039,
-    1442, 298, -165, 516, 210, 104, -74, -907, -858, -303, 449, -531,
-    685, 1006, 549, 118, 18, 964, 1004, 401, 195, 273, -179, -128,
-    -963, -582, -233, -784, -57, 102, -151, -349, -128, -117, -384, -466,
-    137, 278, -8, -876, -1398, -1305, -1408, -988, -1336, -1486, -449, -512,
-    -105, -1413, -1568, -2143, -1001, -2125, -2022, -1151, -1456, -1027, -345, -338,
-    -1513, -2406, -1179, -1099, -1551, -1856, -1035, -531, -807, -949, -1287, -1455,
-    -1339, -1666, -1668, -1537, -2298, -2104, -1258, -1041, -1403, -697, -1072, -2672,
-    -2140, -1799, -1905, -1604, -2241, -2662, -2000, -2041, -3041, -2825, -3597, -2997,
-    -2856, -2031, -1719, -1890, -1710, -1391, -1850, -1984, -2582, -2933, -2465, -2983,
-    -1544, -707, -1732, -1645, -1793, -1523, -2326, -2245, -1427, -936, -459, -891,
-    -821, -1512, -1860, -1358, -1583, -1969, -1680, -1782, -449, -54, -218, -1261,
-    -1470, -747, 276, -325, -763, 677, 268, -299, -584, -965, 375, 930,
-    1665, 836, -84, 1668, 2394, 204, -625, -1490, -1489, -1110, 837, 1337,
-    1806, 1264, 1864, 2467, 1704, 1889, 1357, 1692, 1769, 1932, 98, -538,
-    -489, -483, -149, -515, -1271, -1864, -1135, -682, -1082, -1389, -888, -1121,
-    -93, 1319, 1556, 1207, 784, 1980, 1821, 2488, 2583, 3495, 2325, 2849,
-    3526, 3723, 4519, 4325, 4130, 3702, 4345, 4162, 4781, 5230, 4639, 5048,
-    4203, 3627, 4329, 4327, 3832, 4930, 4107, 4271, 4638, 4055, 3251, 3564,
-    3685, 3439, 3592, 3645, 3771, 3157, 3487, 2874, 2815, 3064, 2593, 2854,
-    2696, 2663, 1983, 1457, 1133, -112, -817, -1137, -318, -459, -773, -1040,
-    -1423, -1490, -866, -1490, -3193, -3044, -3510, -3708, -3113, -3787, -2296, -1991,
-    -2587, -2394, -3898, -3630, -3355, -3517, -3542, -2223, -1811, -2097, -3392, -3100,
-    -3045, -4102, -4130, -3484, -3448, -3296, -1637, -2472, -1965, -1445, -3581, -3539,
-    -4170, -3586, -3122, -1824, -2694, -3400, -2809, -2428, -2921, -925, -1275, -2393,
-    -1661, -768, -565, -1021, 32, -320, -1036, -16, -381, -848, -470, 119,
-    566, -31, 427, -223, 1202, 1668, 1875, 898, 1289, 1821, 1680, 2551,
-    2110, 1884, 2514, 3300, 3180, 1777, 1421, 1648, 1576, -678, -1297, -2079,
-    -3162, -2692, -2205, -2382, -2501, -1824, -2315, -3318, -4254, -4792, -5200, -4294,
-    -3897, -3672, -4921, -5570, -6074, -4585, -5389, -5692, -5384, -5057, -4903, -4257,
-    -3420, -3825, -4239, -3690, -4418, -3662, -3032, -3761, -2857, -3277, -2800, -2625,
-    -2257, -2181, -3005, -2635, -2661, -3098, -2590, -1625, -1721, -3177, -2149, -1609,
-    -1561, -1916, -1335, -1450, -1198, -1522, -1408, -1912, -1250, -1251, -1559, -1886,
-    -2298, -1960, -886, -988, -683, -424, 334, 1076, 2273, 2595, 2004, 1806,
-    2024, 2156, 2929, 2777, 2276, 2396, 2962, 1871, 2669, 3243, 4761, 5163,
-    3627, 4376, 4377, 5747, 4719, 4579, 4936, 3906, 2896, 3170, 4284, 2004,
-    1449, 3209, 5068, 3940, 3136, 3656, 3230, 2043, 1240, 1101, 531, 1905,
-    896, 1795, 852, 931, 1016, 1346, 2293, 2577, 3080, 2285, 2338, 1995,
-    1129, 2057, 1870, 1986, 2334, 1862, 1571, 2556, 3714, 2681, 2274, 1315,
-    76, -94, 589, 424, 160, -301, -1114, -1685, -297, 571, 900, 125,
-    685, 1706, 2136, 261, -84, -60, -360, 240, 637, 904, 1301, 1049,
-    1727, 1879, 2090, 4068, 5032, 5204, 3751, 3175, 3341, 3647, 3303, 3421,
-    3019, 2577, 3635, 5217, 4457, 4807, 4941, 4603, 3615, 3972, 4161, 3760,
-    4966, 5316, 3780, 3628, 3153, 3553, 4465, 4261, 3514, 2716, 3093, 2901,
-    2433, 1751, 1598, 2719, 3301, 3773, 4886, 3822, 3679, 1831, 2167, 1439,
-    2036, 3514, 3517, 2843, 2579, 3562, 3127, 3218, 3355, 2406, 3077, 3465,
-    2595, 3084, 2519, 2322, 1558, 679, -429, -1147, 108, 1030, 122, -604,
-    185, 284, 562, -776, -975, -1658, -2032, -826, -1736, -1424, -1192, -545,
-    -2287, -3709, -6430, -7431, -5856, -5269, -5011, -5049, -3832, -4240, -4030, -4710,
-    -3220, -2870, -2763, -2719, -3634, -3493, -2527, -2296, -2650, -2802, -1795, -1385,
-    -974, -705, 313, 114, 348, -1367, -2726, -4259, -3140, -2649, -3634, -3790,
-    -3549, -3451, -3580, -4392, -4810, -4778, -2896, -3033, -3857, -3043, -3281, -3063,
-    -1906, -1795, -2152, -2444, -1072, -697, -181, -2081, -3070, -2717, -2129, -2125,
-    -1210, -613, -821, -873, 568, 811, 998, 178, -595, -550, 591, -46,
-    -178, 278, 386, 147, 655, 781, 550, 745, 792, 1290, -75, 296,
-    1554, 1454, 838, -441, -315, 70, 1486, 1660, 1198, 1294, 445, 464,
-    114, -295, 1049, 1875, 2126, 1852, 2680, 1718, 1039, 2051, 1821, 1842,
-    2080, 2351, 2576, 1503, 2158, 1961, 1671, 762, 1011, 936, 101, 956,
-    503, -455, -1285, -1543, -318, -641, -769, -1245, -363, -252, -1050, -1267,
-    -1882, -2602, -1400, -470, -1318, -1299, -1374, -1408, -1690, -280, 527, 52,
-    711, 1097, -27, -1149, -1048, -863, -1720, -1630, -1037, -159, -1838, -1204,
-    -292, -653, 366, -558, -965, -1099, -1537, -1766, -1620, -1165, -1658, -2867,
-    -3706, -3360, -4258, -3459, -2712, -2795, -3191, -3074, -3320, -3008, -3693, -3062,
-    -3521, -4109, -3314, -3010, -2233, -1508, -1817, -2033, -1843, -718, 455, 22,
-    -420, -952, -296, -37, -377, 494, 1520, 1627, 698, 350, 427, -289,
-    539, 1330, 2216, 1961, 1341, 839, 753, 94, -721, 83, 385, -59,
-    931, 1109, 649, 559, 634, 753, -241, -507, -246, 63, -593, -1211,
-    -1132, -494, 150, 1442, 2173, 1734, 4180, 3629, 2692, 2732, 1600, 1635,
-    2815, 4135, 3574, 5039, 5586, 4129, 2640, 2105, 2223, 3243, 3530, 4334,
-    3231, 2933, 3225, 4068, 3403, 2693, 2533, 2632, 107, 1043, 1821, 1629,
-    532, 1048, 932, 728, 492, 1055, 1238, 776, -180, 439, 1244, 1308,
-    1193, 3176, 3311, 4070, 3362, 2504, 1059, 933, 1601, 1654, 2513, 3385,
-    3362, 3551, 3676, 3991, 3077, 3027, 2974, 3343, 2589, 1233, 1957, 135,
-    -887, -1350, -1312, 521, 668, 870, 772, -752, -1611, -1164, -1202, -565,
-    -1704, -1290, -1681, -2158, -1014, -2066, -3189, -3031, -3598, -3090, -1779, -1813,
-    -2199, -2739, -2546, -1523, -787, -1714, -1884, -563, -532, -1822, -1586, -1685,
-    -2471, -2390, -2357, -1937, -2641, -2221, -2279, -1728, -3908, -5715, -4262, -3024,
-    -3843, -3136, -2960, -3195, -3909, -3927, -4956, -5075, -4356, -4533, -3851, -4083,
-    -3711, -3357, -2381, -2395, -1792, -1830, -2071, -2491, -1610, -888, -1794, -1952,
-    -1354, -434, 503, 974, 464, 674, 785, -30, -504, -203, 475, 491,
-    793, 876, -18, -515, -960, -1215, -1650, -2678, -1108, -1030, -1645, -622,
-    -347, -932, -1066, -1579, -1852, -1941, -2566, -3343, -2902, -2320, -2868, -1317,
-    -183, 292, 881, 2699, 2614, 1833, 2124, 1376, 1402, 1222, 1488, 2041,
-    2976, 3586, 2969, 4108, 4019, 4911, 5172, 4921, 4747, 4057, 3464, 2462,
-    876, 782, 1037, 724, 999, 784, -313, 329, 1824, 1912, 2020, 1639,
-    990, 1179, 425, -183, -1399, -965, -802, -608, -475, -973, 121, 308,
-    189, -731, 427, 749, 1564, 2168, 2043, 1708, 1836, 2536, 1784, 1952,
-    2155, 2377, 3102, 2559, 2778, 2780, 2735, 2369, 2475, 2524, 1507, 567,
-    1200, 60, -255, -579, -909, -774, 266, 209, 874, 793, -114, -1085,
-    -1975, -3007, -2787, -2846, -3139, -3396, -2620, -1788, -1237, -2239, -2794, -1189,
-    357, -436, 287, -2157, -2090, -1203, -649, -621, 157, 1614, 635, -1059,
-    -1005, -320, -1568, -2266, -1715, -904, -432, -1008, -1373, -1856, -1551, -1452,
-    -939, -3245, -3643, -3554, -2925, -2787, -2618, -2562, -3679, -4185, -4155, -4855,
-    -4696, -4812, -3695, -3470, -4095, -4153, -3219, -2445, -2954, -2520, -2790, -2726,
-    -2548, -1587, -643, 251, -371, -1225, -530, -382, -1587, -639, 315, -2233,
-    -2876, -2696, -1908, -2379, -2094, -2032, -1097, -322, -1012, -1366, -1925, -2241,
-    -2380, -2322, -1984, -2059, -2068, -2353, -1925, -1809, -2725, -1792, -968, -539,
-    -746, -538, -639, -845, -881, -456, -546, -164, 1158, 1507, 1528, 1759,
-    2912, 2424, 2425, 1596, 2274, 2418, 2347, 2481, 2293, 2481, 1227, 1524,
-    2510, 898, 313, 359, 811, 1747, 585, 373, 303, 1621, 1289, 707,
-    979, 1403, 1974, 1363, 1451, 1883, 2799, 1725, 2819, 2613, 2950, 3453,
-    3385, 4986, 5052, 4831, 4935, 4862, 4450, 3586, 4140, 4093, 5927, 6368,
-    5658, 6539, 6194, 5581, 6268, 6066, 5529, 5924, 5755, 4468, 4024, 3593,
-    2692, 1909, 1977, 2608, 1956, 2914, 3969, 3761, 3471, 3170, 3290, 3642,
-    3339, 3732, 3314, 3270, 3054, 1802, 2782, 2748, 3085, 3684, 4085, 4338,
-    4067, 3171, 2909, 3520, 3526, 3400, 3610, 4232, 4300, 4319, 4089, 4419,
-    3844, 3698, 3895, 3413, 2238, 1766, 1409, 1411, 1597, 1260, 59, 284,
-    878, 671, 35, -50, 1023, -119, -379, -1529, -814, -477, -1449, -1169,
-    -762, -757, -500, 245, -1089, -1027, -981, -449, -494, 122, -448, 97,
-    502, -45, -740, 378, 949, 428, 936, 693, 740, 785, 224, -215,
-    -863, -455, -1229, -1657, -184, -1811, -2109, -2485, -2597, -2104, -2531, -2075,
-    -2220, -3099, -3067, -3558, -4381, -4323, -4688, -4733, -6356, -5527, -5045, -5123,
-    -4038, -3935, -4687, -4102, -2971, -2383, -2480, -2760, -3151, -5253, -5183, -4880,
-    -3838, -3327, -1864, -1201, -2527, -3411, -4296, -4008, -4310, -4926, -5463, -4786,
-    -4168, -3800, -4033, -4256, -5009, -4464, -4061, -4923, -5283, -4300, -3589, -4255,
-    -4581, -3968, -3985, -3853, -3643, -3821, -4466, -4941, -4640, -4313, -4173, -4168,
-    -1984, -1261, -2316, -2583, -2809, -3160, -2369, -1640, -1380, -880, -1193, -1032,
-    -1676, -2169, -1700, -1480, -1670, -1326, -2253, -3087, -2488, -2473, -2916, -2385,
-    -1625, -1163, -1935, -1986, -2123, -2033, -1985, -2193, -1995, -1809, -1667, -1044,
-    -645, -1238, -650, -991, -142, 104, 455, 649, 396, 1084, 489, 550,
-    702, 291, 486, 1583, 1987, 1999, 2709, 2548, 2306, 3034, 2021, 1164,
-    1471, 1714, 1900, 1159, 989, 688, 2170, 1970, 1398, 1507, 2296, 1961,
-    1747, 686, 498, 381, -3, 721, 696, 132, 986, 943, 1657, 1916,
-    1884, 1378, 2220, 3170, 2719, 2332, 3198, 4728, 4770, 4741, 4436, 3868,
-    3846, 3624, 3005, 2605, 3691, 4347, 4776, 4302, 4971, 5301, 3773, 2556,
-    2859, 2631, 2459, 2688, 3759, 3561, 2036, 2496, 3408, 3121, 3862, 4208,
-    3758, 2277, 2435, 2887, 2606, 2656, 2368, 2168, 2383, 3114, 3692, 3976,
-    4665, 4654, 4688, 4835, 4422, 5169, 4723, 5458, 5096, 5443, 5276, 4708,
-    5966, 5137, 5052, 5357, 5427, 5131, 4936, 4595, 3815, 3727, 3645, 3985,
-    3410, 3631, 2939, 2251, 1460, 1752, 1035, 1255, 1259, 1005, 907, 938,
-    1253, 420, 46, -130, -360, 449, 1079, 1120, 1223, 1844, 2007, 1809,
-    1678, 1614, 1432, 915, 310, 250, 887, 1290, 1295, 1519, 1893, 1309,
-    1547, 1785, 1625, 460, 313, 740, -33, -371, -359, -333, -474, -699,
-    -1058, -1298, -1789, -941, -1861, -1983, -1122, -1630, -1484, -1441, -1693, -2129,
-    -2642, -2554, -2692, -3456, -3602, -2428, -1931, -1226, -2023, -2071, -774, -1043,
-    -940, -1159, -1761, -2366, -2206, -1233, -1303, -399, 96, -1431, -1418, -2048,
-    -3336, -4396, -4898, -4946, -5360, -5824, -5593, -4838, -4244, -4625, -4079, -4237,
-    -5426, -4932, -4825, -3540, -4005, -4516, -3729, -4283, -4901, -4688, -5284, -5308,
-    -5439, -5880, -5604, -4687, -3997, -2464, -2944, -3402, -3541, -2678, -3258, -3101,
-    -3101, -1842, -2311, -2247, -1661, -2008, -2647, -2296, -2485, -3465, -3808, -4060,
-    -4144, -4093, -4224, -4939, -4178, -4000, -4436, -4616, -5528, -4951, -5102, -5074,
-    -5367, -4724, -4282, -4433, -4399, -4014, -3982, -3593, -3773, -3245, -3095, -3003,
-    -2105, -1277, -1153, -372, -540, -774, -840, -554, -168, -617, -206, 1024,
-    982, 1309, 1905, 1916, 949, 134, -122, 321, -359, -116, 149, 222,
-    -865, -1493, -1381, -961, 88, -41, -470, 125, -349, -5, -1049, -1140,
-    -734, -1308, -1318, -1202, -538, -380, -131, 297, 1021, 977, 1364, 2405,
-    2817, 1548, 1570, 1916, 1736, 1660, 1551, 2018, 2755, 2390, 3296, 3836,
-    4045, 3244, 3209, 3170, 1943, 2011, 1752, 2194, 1492, 1632, 1231, 759,
-    623, 1188, 1594, 2514, 1998, 1812, 1276, 556, 769, 824, 609, 1241,
-    869, 649, 1061, 532, 1447, 1983, 2838, 3415, 3513, 3140, 2982, 2736,
-    2849, 3322, 3036, 3402, 3349, 3966, 4641, 4442, 4041, 3527, 3329, 3731,
-    3433, 3401, 2867, 2959, 2720, 2949, 2099, 1189, 1293, 1104, 2190, 2382,
-    2189, 2192, 1432, 628, 549, 575, 733, 1082, 524, -973, -262, 889,
-    981, 1617, 1601, 1672, 1569, 2457, 2734, 3058, 3334, 3737, 3655, 3403,
-    2087, 2028, 2841, 2572, 1823, 1491, 1656, 2432, 2511, 2396, 2847, 2530,
-    1514, 1518, 2139, 1382, 1528, 1092, 1376, 770, 1596, 1742, 1277, 1087,
-    212, 74, -469, -897, -427, 116, 463, 583, 713, 671, 1727, 1617,
-    1045, 595, 663, 1139, 1449, 1614, 955, -210, -1183, -561, 488, 183,
-    950, 2545, 2452, 1099, -232, -1075, -210, -236, -738, -662, -338, -7,
-    -90, -416, -1267, -1508, 141, -1205, -1842, -1866, -687, -411, -639, -218,
-    -1059, -414, -799, -1404, -1533, -1625, -1073, -1046, -766, -1858, -658, 848,
-    858, 159, -1002, -620, -470, -1165, -335, 132, 387, 791, 185, -401,
-    -914, -1602, -1110, -1239, -2188, -2338, -2326, -3257, -3784, -4162, -3915, -2910,
-    -2736, -2438, -3224, -4588, -4873, -4570, -5143, -5714, -5514, -5254, -5970, -5583,
-    -5540, -4845, -3495, -4156, -4013, -3887, -3948, -3116, -1642, -1766, -2481, -2569,
-    -2889, -3324, -2204, -1814, -1523, -1802, -1773, -1065, -908, -603, -655, -1225,
-    -779, -1255, -1864, -1987, -2013, -2259, -2396, -3072, -2957, -2375, -2935, -3062,
-    -4066, -4001, -4265, -4235, -3935, -3473, -3248, -3312, -3249, -2517, -2521, -2754,
-    -2601, -2905, -2090, -2492, -2946, -2993, -1688, -1078, -1848, -2647, -3075, -2540,
-    -2198, -2680, -1692, -1569, -520, 363, 174, -62, -374, -613, -1254, -1060,
-    -1523, -1804, -1276, -1288, -1324, -1763, -1821, -1231, -785, 18, 290, -622,
-    -714, -1316, -1879, -1756, -1079, -1534, -1054, -1063, -1066, -1000, 268, 497,
-    346, 372, 1153, 1432, 864, 1623, 1129, 767, 1375, 1974, 2015, 2049,
-    2217, 2571, 2269, 2556, 1481, 1227, 1656, 1841, 1803, 519, 635, 889,
-    1787, 1408, 119, -174, 730, 691, 311, 689, 754, 973, 736, 649,
-    652, 432, 1244, 1428, 1096, 1536, 704, 1022, 1701, 2038, 2267, 2213,
-    3469, 3533, 3133, 2430, 2317, 2663, 2635, 3005, 3381, 3414, 3895, 4812,
-    5262, 4937, 5460, 5431, 5651, 3738, 3262, 3280, 3945, 2742, 1934, 3153,
-    3329, 1763, 2063, 3209, 3583, 3694, 3995, 3653, 3122, 2868, 1919, 2073,
-    2227, 2277, 1772, 2302, 2922, 2514, 3439, 2659, 3436, 3337, 2944, 2618,
-    2967, 1835, 1753, 2271, 2924, 4263, 4606, 4587, 4530, 3445, 3547, 2028,
-    2123, 1944, 1929, 2047, 1658, 1435, 1897, 2115, 1841, 1842, 1531, 360,
-    980, 1061, 606, 1435, 1966, 2026, 1591, 681, 244, -90, -272, -50,
-    730, 956, 1335, 1418, 2129, 2007, 2529, 1761, 1018, 552, 276, 979,
-    2243, 2933, 2672, 2505, 2704, 3388, 2722, 2182, 1974, 1342, 1208, 1043,
-    811, -580, -438, -94, 641, -65, -347, -734, 253, -323, -792, -2102,
-    -1572, -2693, -2023, -1229, -814, -1492, -1690, -283, 183, 264, -28, -345,
-    379, 1319, 765, 1013, 1183, -102, -201, -505, -1188, -278, 564, -217,
-    70, 431, 222, -117, -23, -1248, -1032, -974, -1237, -1382, -1611, -1988,
-    -2650, -1561, -1224, -1130, -790, -2202, -1989, -1667, -2264, -3532, -3607, -3310,
-    -4359, -4237, -3956, -3381, -2831, -2514, -1761, -1734, -1668, -1545, -843, -1345,
-    -1778, -2382, -3258, -3273, -2921, -2456, -2055, -1738, -788, -1219, -210, -402,
-    -783, -1317, -1772, -1880, -2800, -2518, -2871, -2337, -1596, -2080, -2171, -2182,
-    -1661, -2381, -2755, -3058, -3614, -3469, -2742, -2699, -2781, -2962, -3029, -2834,
-    -2206, -2022, -1109, -637, -625, -1356, -660, 155, -755, -394, 318, -313,
-    -1200, -1660, -976, -1511, -1949, -537, 375, 363, 268, 769, 908, -1,
-    -1008, -540, -1252, -1960, -2241, -2329, -2341, -3046, -3870, -3546, -3179, -2624,
-    -2592, -2584, -2936, -3460, -3015, -3363, -3011, -2952, -3285, -3193, -2862, -2887,
-    -2727, -2432, -2472, -1431, -1590, -932, -90, -869, -751, -463, -597, -422,
-    -552, -134, -325, 217, 539, 1095, 1208, 769, 283, 214, -489, -840,
-    -160, -200, -375, -1210, -1351, -1702, -2069, -2108, -1396, -838, -1005, -1571,
-    -723, -1354, -1594, -1276, -1543, -989, -1328, -1385, -850, -234, -738, 57,
-    -191, 984, 1292, 1052, 624, 198, -168, -1522, -579, 660, 1529, 2578,
-    3995, 3754, 3202, 2264, 1190, 765, 932, 917, 1303, 1068, 632, 1069,
-    1308, 662, 732, 1830, 417, 697, 746, 1707, 2034, 2067, 1393, 495,
-    494, 579, -552, -1399, -746, -1281, -747, -341, -821, 787, 1652, 473,
-    191, 513, 608, 182, 740, 887, 1778, 2711, 2573, 3100, 3993, 3771,
-    3111, 3285, 2113, 2261, 1412, 1976, 1255, 723, 190, 1261, 1407, 981,
-    1409, 1810, 1561, 415, 168, 52, 64, 334, 792, 1520, 1479, 913,
-    962, 1146, 1788, 1944, 1548, 1885, 2930, 3554, 2729, 2818, 1974, 1884,
-    1940, 1750, 1786, 3127, 2900, 3358, 4030, 3278, 2132, 1836, 2236, 2445,
-    2398, 1105, 1383, 1486, 700, 386, 1108, 1526, 1625, 1932, 1738, 1099,
-    586, 7, 191, 808, 1083, 178, 379, 576, 249, 949, 136, 1535,
-    2458, 2191, 2446, 2122, 2001, 2072, 1386, 670, 945, 809, 1104, 2400,
-    2332, 3073, 3154, 3720, 3939, 2839, 2613, 1348, 1227, 1353, 1515, 1046,
-    773, 1265, 492, 365, 188, 187, -4, 906, 865, 1083, 1288, 866,
-    814, 214, 290, -108, 345, 365, 52, 793, 1503, 1422, 1852, 2833,
-    3480, 3148, 2751, 2429, 2658, 2640, 2237, 1658, 2717, 2795, 2708, 2812,
-    3314, 2788, 3072, 1472, 652, 480, 270, 32, -700, -597, -484, -338,
-    130, -208, -185, -336, 414, 484, 383, -229, -547, -778, -730, -1138,
-    -1863, -1956, -668, -565, -1114, -527, -398, -310, 414, 514, 312, 153,
-    -164, 18, 376, 870, 748, 894, 1384, 1949, 1038, 1448, 1340, 1610,
-    1118, 1191, 701, 629, 266, 673, 192, 141, -307, -1385, -1860, -1467,
-    -1242, -1286, -1902, -1562, -1296, -1218, -1979, -3066, -4147, -3649, -3859, -3330,
-    -3261, -2057, -3086, -2033, -1992, -2671, -2328, -1603, -1731, -2758, -2665, -3477,
-    -4769, -3627, -2489, -958, -544, 157, 797, 390, -1278, -2966, -3315, -3289,
-    -3365, -3636, -3303, -2527, -2724, -2276, -2843, -2714, -1936, -2487, -4044, -3649,
-    -2596, -2068, -2216, -2186, -2173, -2459, -2382, -2795, -3221, -3780, -4297, -3798,
-    -2969, -2467, -1920, -1172, -751, -2142, -2545, -2134, -1836, -2140, -1904, -1190,
-    -31, -252, -441, -628, -1017, -792, -898, -1702, -1445, -2411, -2053, -1608,
-    -2915, -3521, -2805, -2768, -2124, -3207, -3517, -2985, -2401, -3095, -3214, -3717,
-    -3517, -3961, -4172, -3024, -2804, -2599, -2022, -2026, -1351, -1857, -1795, -1217,
-    -1149, -1817, -1472, -1222, -1115, -1913, -1282, -626, -300, 186, 278, 603,
-    72, 510, 399, 39, -926, -1931, -1621, -782, -815, -1544, -1953, -1956,
-    -2102, -1952, -2789, -2464, -1729, -2408, -2258, -3654, -3391, -2637, -2925, -2310,
-    -2286, -1898, -1661, -964, -753, -622, -509, -576, -448, -516, 393, 156,
-    934, 111, -120, 271, 329, 861, 1107, 1093, 652, 1193, 2100, 1508,
-    1301, 1117, 1364, -173, -258, -754, -356, -652, -1250, -570, 318, -450,
-    114, 591, 69, 333, 18, -670, -930, -156, -187, -59, 436, -26,
-    -217, 289, 1443, 934, 1194, 1849, 1829, 2277, 1499, 1347, 1767, 1528,
-    776, 1707, 2015, 1935, 2468, 2462, 2120, 2228, 2161, 2805, 2623, 1891,
-    1707, 1685, 1182, 934, -42, -257, 3, 10, 249, 478, 501, 607,
-    428, 418, 847, 706, 725, 1092, 918, 1199, 545, 1121, 2044, 1686,
-    1911, 1849, 2298, 2628, 2979, 3168, 3295, 2799, 2395, 2908, 3170, 2681,
-    2828, 2770, 3227, 2457, 2437, 2608, 3074, 3089, 2881, 2887, 2587, 3140,
-    2714, 2170, 849, 623, 940, 1404, 1483, 2011, 2397, 1249, 1418, 1318,
-    683, 178, 14, 377, 915, 1771, 1535, 1460, 1387, 1137, 1651, 1660,
-    1535, 2993, 3114, 2488, 2469, 2622, 938, 1198, 1754, 2522, 2946, 4509,
-    4407, 3317, 2118, 1444, 600, 750, 450, 1053, 1293, 368, 1417, 1721,
-    1642, 1284, 1955, -185, -1260, -313, 685, 2028, 2075, 2321, 1859, 887,
-    112, 251, 209, 433, 186, 961, 1697, 582, 1662, 2789, 2780, 2972,
-    2500, 2371, 2038, 2006, 2029, 2233, 3002, 3540, 3371, 2851, 3502, 2859,
-    2793, 2579, 3022, 2908, 1920, 1007, 242, 497, 1519, 1378, 1207, 935,
-    411, 60, 105, -171, -763, -1067, -467, -16, 586, 982, 1109, 1526,
-    1364, 1829, 2113, 1492, 767, 1196, 1826, 1732, 1010, 2065, 1974, 1756,
-    1807, 2266, 2636, 2145, 1965, 2047, 1628, 1857, 1894, 1521, 1153, 1473,
-    55, 1065, 1378, 5, 97, 247, 1262, 1657, 1165, 455, -330, -651,
-    -1474, -1646, -1188, -1623, -1014, -1303, -1005, -734, -674, -1061, -866, -266,
-    -202, 623, 623, 729, 851, 580, 54, -48, -334, -474, -305, -688,
-    -486, -198, 98, 683, 618, -469, 86, -335, -854, -545, -622, -1219,
-    -1974, -2335, -1645, -1507, -861, -727, -1646, -1418, -1886, -1559, -1725, -2352,
-    -2300, -2974, -2822, -1540, -1369, -1328, -1192, -1243, -356, 20, -214, -388,
-    360, 216, 378, 60, 93, 340, -78, -653, -110, 160, -739, -1116,
-    -831, -899, -1294, -1287, -1626, -1615, -1722, -1856, -2102, -1774, -1640, -2622,
-    -2818, -3645, -3617, -3051, -2584, -2335, -2023, -1779, -2537, -3184, -3330, -3191,
-    -3362, -2950, -2289, -2241, -2504, -2255, -2172, -2144, -1739, -1034, -367, -250,
-    -637, -1097, -1006, -1297, -777, -923, -1938, -1567, -1164, -1217, -1438, -1911,
-    -1777, -1749, -2080, -2510, -2947, -1892, -2311, -2907, -2953, -3632, -3204, -2273,
-    -2291, -2386, -3146, -3588, -3483, -3580, -3763, -4263, -3561, -3428, -3430, -3195,
-    -3356, -3999, -3526, -3304, -3929, -3147, -3673, -2639, -1586, -1869, -1933, -2937,
-    -3279, -2159, -2288, -2028, -226, 63, -670, -1384, -2768, -3021, -2840, -2749,
-    -1840, -1337, -1783, -2217, -2309, -2139, -1551, -2318, -2253, -3514, -4947, -4603,
-    -3755, -3165, -3232, -2796, -2758, -3044, -3609, -3329, -3121, -3109, -3149, -2967,
-    -2853, -3234, -1736, -1058, -1880, -1724, -2474, -2592, -2263, -2040, -1586, -414,
-    171, 552, 1162, 1178, 564, 240, -647, -1177, -1287, -1515, -1020, -1193,
-    -1643, -1796, -1812, -1176, -542, -256, 197, 344, -593, -1441, -1606, -1414,
-    -1279, -1402, -1219, -871, -747, 86, -101, -225, -199, -476, 422, 1203,
-    1015, 1227, 1454, 1346, 1018, 1143, 1498, 1470, 2145, 2252, 1939, 2449,
-    2760, 2450, 2509, 2247, 2072, 2304, 1206, 1370, 1706, 1234, 978, 265,
-    407, 802, 1478, 1337, 1258, 1391, 1126, 885, 111, 950, 1063, 1019,
-    1219, 968, 1291, 1918, 1626, 2118, 2403, 2436, 2301, 2679, 3624, 3303,
-    3042, 2134, 2956, 3365, 3220, 3093, 3500, 4499, 3930, 4346, 5403, 5231,
-    5093, 4192, 4252, 3555, 2783, 3072, 3030, 2645, 2066, 1941, 1988, 2172,
-    2404, 2453, 2248, 2108, 1646, 2079, 1546, 1767, 2685, 1922, 2550, 3020,
-    2725, 2498, 2660, 2662, 2433, 1898, 2792, 4383, 3749, 4376, 4969, 4118,
-    4614, 4524, 4031, 4141, 4867, 5110, 5397, 4796, 4252, 4606, 3915, 3747,
-    2786, 2817, 2538, 1657, 1829, 1570, 1330, 1840, 591, 775, 1233, 1103,
-    1933, 583, -41, -403, -420, -97, -224, -632, 585, 1501, 907, 983,
-    795, 639, 1080, 2052, 2978, 2506, 2374, 2601, 2276, 2452, 1519, 1992,
-    2732, 2645, 2707, 2795, 3054, 3131, 2682, 2294, 1902, 1284, 911, 400,
-    698, -98, 298, 824, 247, 633, 546, 395, 622, 715, 154, -223,
-    -507, -1021, -1933, -1315, -840, -538, 345, -210, -718, -583, 153, -359,
-    380, 1487, 1135, 732, 770, -294, -1110, -671, -584, 757, 1482, 1674,
-    1895, 1820, 1129, 958, 5, -77, 85, -1528, -851, -286, -113, -83,
-    -610, -133, -68, -2067, -1816, -1476, -1270, -1005, -1234, -1039, -1442, -1767,
-    -1559, -1651, -1790, -2648, -2585, -2223, -3454, -2067, -1408, -1346, -1443, -1052,
-    -1464, -1276, -1018, -819, -531, -175, 87, -665, -199, 430, 220, -23,
-    240, -435, -1453, -1568, -2517, -3356, -3590, -2691, -2134, -814, -625, -911,
-    -1078, -1938, -3528, -4234, -4334, -4311, -4322, -3877, -3273, -3317, -2550, -2998,
-    -2419, -1780, -1737, -1977, -712, -36, -408, -816, -1348, -1698, -1746, -1745,
-    -1050, 224, 684, 535, 209, 101, -409, -192, 262, -11, -793, -516,
-    -836, -1400, -1323, -2424, -2590, -1992, -1723, -2311, -1156, -1815, -2650, -2938,
-    -3359, -3012, -3354, -3254, -3412, -3156, -2408, -2787, -2779, -2334, -2154, -1614,
-    -1584, -1306, -420, 366, 147, -112, -1182, -1038, -1098, -1637, -1763, -785,
-    -906, -339, 29, 63, -796, -493, -252, -372, -143, -1319, -1620, -1510,
-    -1803, -3025, -3366, -3081, -1632, -1676, -2293, -2291, -2221, -2705, -3106, -3592,
-    -3491, -3234, -2406, -2401, -2251, -2514, -2391, -1175, -1780, -1905, -1444, -197,
-    960, 1100, 920, 178, -138, 25, -457, -1043, -737, 51, -269, -701,
-    -430, 57, 263, 727, 642, 105, -712, -741, -957, -1401, -1767, -1988,
-    -2495, -2441, -3007, -2563, -1218, -1233, -699, -674, -1875, -2398, -2249, -2806,
-    -2580, -2958, -2159, -1878, -519, -691, -713, 132, 565, 924, 1846, 1041,
-    1384, 1366, 1111, 653, 673, 1329, 1771, 1868, 1248, 1614, 2154, 2268,
-    2334, 1890, 1721, 1811, 1847, 1635, 752, 1064, 1564, 1388, 2006, 2410,
-    1906, 1122, -14, 411, 263, -675, -501, 73, -373, 935, 1207, 1111,
-    1331, 919, 769, 1374, 1442, 60, 1393, 2328, 2239, 1852, 324, -28,
-    511, 1968, 2273, 2158, 3041, 3622, 3909, 3054, 1878, 1711, 1125, 2137,
-    1257, 527, 1714, 2380, 1800, 1603, 2223, 2653, 1647, 802, 1083, 917,
-    1037, 2100, 1274, 952, 430, -94, 538, 798, 594, 507, 702, 278,
-    449, 1093, 862, 699, 712, 606, 838, 906, 1409, 2370, 3093, 3136,
-    3190, 3439, 2734, 3093, 3188, 2553, 2187, 2442, 1431, 646, 419, 291,
-    772, 850, 341, 911, 663, 980, 612, 102, -805, -1147, -861, -1216,
-    -955, -377, -197, -59, 155, 18, 102, -601, -622, -709, 449, 980,
-    1704, 1747, 1269, 1288, 1650, 1812, 1998, 1796, 1779, 1228, 959, 751,
-    1081, 607, 381, 523, 155, -156, 468, -482, -726, -245, 46, 32,
-    -172, -196, 387, -186, -654, -130, -446, -659, -227, 206, 137, 41,
-    967, 885, 647, 596, 203, -38, -550, -552, -172, -425, -585, -96,
-    223, 748, 752, 890, 927, 516, 108, 79, 257, 452, 785, 1478,
-    948, 840, 1234, 700, 660, 87, 777, 597, 586, 222, 513, 844,
-    1540, 1740, 1296, 596, 951, 622, 225, -295, -512, 730, 892, 360,
-    -507, 492, 401, 757, 978, 1629, 1244, 1253, 1395, 1701, 1336, 1643,
-    1431, 1673, 1475, 1269, 1217, 1588, 746, 979, 1258, 1081, 1503, 1034,
-    845, 450, 744, 1053, 1240, 1143, 1203, 821, 565, 377, 359, 470,
-    -406, -286, 173, -221, -322, -406, -343, 94, 15, 426, 541, 947,
-    554, 858, 761, -248, -299, -158, -600, -973, -1364, -966, -665, -491,
-    -224, -212, -465, -340, 167, 174, 104, -583, -87, 201, -230, -380,
-    -898, -435, 59, -306, -440, -63, -49, 85, -331, 128, 253, 136,
-    430, -14, -80, 42, 486, 951, 409, 515, 371, -778, -608, -426,
-    -505, -1004, -800, -413, -285, -680, -815, -402, -185, -456, 436, 41,
-    -264, -28, 332, 558, -238, 63, 510, -4, -140, 107, 1053, 604,
-    466, 330, 324, 497, -262, -406, -228, -492, -185, -631, -511, -332,
-    -870, -567, -400, -464, -586, -31, 450, 811, 996, -146, 101, 441,
-    -107, 49, 101, -737, -109, 261, -235, -156, -263, -58, -12, -117,
-    -573, -550, -754, -339, -203, -381, 183, -88, -554, -636, -764, -1250,
-    -1473, -1503, -1052, -1591, -1530, -1243, -737, -912, -995, -963, -968, -588,
-    -708, -925, -634, -859, -1047, -1062, -931, -1392, -1708, -1645, -2097, -1753,
-    -2014, -1680, -1806, -1902, -1710, -1619, -1419, -1246, -864, -970, -1243, -1887,
-    -2304, -2370, -2234, -2597, -2112, -1726, -1215, -1315, -1469, -1537, -1516, -1574,
-    -1774, -1876, -2281, -2255, -2010, -1794, -2484, -2060, -2023, -2140, -2610, -2577,
-    -2507, -2496, -2126, -2296, -2705, -2722, -2919, -2454, -2636, -2523, -2506, -2830,
-    -2732, -2729, -2612, -3117, -2431, -1856, -2591, -2283, -2705, -2277, -2203, -2057,
-    -1934, -1685, -1630, -1252, -995, -1154, -1267, -1304, -1366, -1808, -2229, -1805,
-    -1849, -1669, -1875, -1696, -1477, -1829, -1753, -1563, -1244, -813, -299, -631,
-    -543, -528, -759, -726, -786, -388, -697, -506, -381, -333, -77, 235,
-    535, 323, 306, -150, 53, 68, -304, -99, -525, 37, 14, -181,
-    -211, 133, -9, -97, 170, 475, 384, 385, 682, 1211, 663, 641,
-    937, 1093, 876, 1271, 1401, 1218, 1438, 1585, 1262, 1360, 1504, 1318,
-    1973, 1512, 1432, 1381, 1337, 1087, 1084, 1191, 804, 926, 713, 852,
-    906, 921, 958, 1264, 1880, 1921, 1805, 1841, 1685, 1607, 1509, 2020,
-    2194, 1669, 1740, 1813, 1720, 1499, 1529, 1525, 2096, 1867, 2026, 1720,
-    1207, 1036, 1290, 1275, 1413, 1444, 1444, 844, 771, 454, 330, 250,
-    153, 615, 289, 325, 939, 964, 840, 499, 829, 805, 288, 350,
-    526, 462, 202, 87, 1087, 1309, 1170, 982, 1653, 1247, 1014, 1158,
-    938, 1043, 510, 764, 825, 786, 571, 1011, 1118, 1488, 1788, 1884,
-    1800, 1684, 1848, 1827, 2447, 2038, 2067, 1874, 1785, 1662, 1254, 1040,
-    1180, 1275, 1584, 1891, 1990, 2240, 2330, 2348, 2164, 2101, 1559, 1148,
-    1273, 1224, 1331, 1123, 872, 1064, 885, 837, 774, 729, 646, 401,
-    -19, 581, 822, 531, 540, 1031, 1392, 1109, 1027, 1384, 1068, 617,
-    996, 927, 940, 556, 244, 310, 51, 169, 516, 317, 973, 488,
-    381, 234, 130, 258, 1013, 892, 1095, 804, 1055, 1190, 1308, 1858,
-    1424, 1907, 1784, 1533, 1024, 685, 611, 1271, 1584, 1211, 1089, 898,
-    952, 831, 789, 610, 822, 331, 176, 109, -233, 179, 265, 399,
-    50, 467, 347, 405, 90, 194, 346, 369, 260, 197, 367, 813,
-    1216, 1047, 792, 297, -72, 20, 196, 151, 282, 308, 178, 760,
-    152, -181, -103, 689, 1117, 1241, 1006, 685, 90, -283, -210, -329,
-    -922, -582, -726, -796, -254, -353, -368, -463, -202, -252, -888, -955,
-    -573, -591, -810, -774, -495, -595, -405, -122, -427, 13, -700, -633,
-    -1177, -1501, -1219, -1242, -1633, -939, -845, -672, -755, -17, -379, -425,
-    -247, -1150, -1264, -1395, -1057, -1205, -1485, -1058, -926, -685, -760, -1277,
-    -1348, -998, -1086, -1004, -901, -977, -1087, -1072, -1697, -1514, -1534, -1599,
-    -1770, -2404, -2016, -1893, -1726, -1372, -1616, -1898, -2067, -2251, -2119, -2147,
-    -1444, -1470, -1331, -985, -1348, -965, -1599, -1538, -1815, -1729, -997, -1673,
-    -1719, -1610, -1665, -1916, -1928, -1558, -2493, -2579, -2274, -2405, -1760, -2048,
-    -1565, -1528, -1838, -1887, -2066, -1830, -2131, -1684, -1697, -1351, -1569, -1715,
-    -2237, -2054, -2406, -2177, -2486, -2191, -1916, -1828, -1491, -1890, -1604, -1711,
-    -1763, -1861, -2031, -2299, -2205, -1861, -2256, -1784, -1302, -1610, -1881, -2220,
-    -1929, -1680, -1828, -2315, -2468, -1690, -1350, -1582, -1510, -1408, -1252, -919,
-    -979, -1149, -1496, -920, -880, -796, -920, -1033, -861, -746, -1033, -1034,
-    -991, -928, -783, -1038, -1068, -638, -169, -2, -269, -533, -738, -672,
-    -477, -284, -102, -521, -546, -957, -270, -384, -393, -267, -57, -28,
-    -53, -316, -373, -225, -124, -51, -448, -377, 66, 178, 674, -10,
-    254, 54, -287, 304, -406, -174, 36, -619, -104, 266, 635, 382,
-    764, 742, 302, 253, -392, -269, -1094, -891, -882, -686, -493, -323,
-    -381, -843, -380, -439, -15, -34, -747, -331, -233, -231, -523, -343,
-    55, -234, -173, -289, -88, 76, -128, -6, -362, -345, -330, 113,
-    114, 86, 332, 291, 22, 155, 682, 944, 717, 788, 704, 232,
-    -331, -154, -771, -218, -53, -28, -75, 15, -99, -221, -546, -321,
-    166, 47, 35, 433, 15, 126, 179, 420, 884, 1164, 906, 1131,
-    1665, 1620, 1515, 1912, 1335, 1043, 1386, 1385, 887, 939, 742, 621,
-    1031, 1116, 1215, 1509, 1266, 945, 319, 123, 346, 201, 177, 35,
-    -534, -362, 522, 570, 982, 495, 616, 74, 227, 262, 220, 256,
-    209, 972, 264, 761, 1144, 736, 1030, 437, 363, 663, 1153, 1377,
-    1342, 1059, 871, 815, 886, 372, 251, 487, -125, -44, 1, -186,
-    469, 860, 1047, 602, 402, 87, 396, 403, 366, 746, 616, 725,
-    820, 379, 442, 414, 590, 1210, 1120, 1127, 517, 420, 284, 90,
-    92, -33, 582, 772, 1028, 765, 803, 951, 579, 220, 73, 866,
-    813, 550, 417, 560, 934, 970, 1230, 892, 962, 747, 654, 530,
-    219, 468, 550, -357, -217, 381, 467, 358, 351, 487, 59, 1,
-    94, -370, 225, 387, 553, 854, 956, 1042, 1428, 1232, 894, 478,
-    84, 142, 588, 544, 566, 976, 1179, 1448, 545, 508, 157, 226,
-    291, 457, 254, -425, -284, -185, -127, -139, -97, 745, 720, 612,
-    -197, -53, -379, -1222, -721, -116, -370, 113, -445, -880, -1092, -790,
-    66, 85, -2, -594, 157, 321, 643, 418, 527, 675, 187, -157,
-    -323, 326, 368, 342, -119, 317, 19, 1536, 569, 32, 433, 863,
-    1083, -559, -767, 1088, 997, 851, 538, 153, 798, 580, 539, -373,
-    -80, -304, -81, 605, 812, -81, -441, 93, 903, 190, 587, 694,
-    724, 299, 226, -67, 619, 697, 757, 244, 356, 586, 114, 168,
-    745, 514, -355, -163, 614, 136, -529, -431, -233, -248, 317, 398,
-    -417, 538, 243, -37, -326, 572, -218, -676, -828, -5, -782, -1115,
-    21, -831, -722, 312, -239, -377, -312, -842, 280, 314, -1147, -1746,
-    694, 1291, 312, 1272, 763, 662, 821, 1179, 244, -37, 1400, 1348,
-    806, 583, 1075, 939, 534, 189, 470, -280, -916, 822, 221, 138,
-    219, -135, -1526, -716, -244, -771, -1533, -1407, -2554, -3054, -2779, -2580,
-    -2062, -1073, -2255, -944, -1273, -942, -114, 722, -1248, -2119, -439, -1313,
-    -1012, -1488, -819, -107, 539, 457, 1356, 538, 159, 1123, 2190, 1390,
-    1780, 1780, 1370, 850, 202, -369, 446, 641, -496, -1336, 639, -838,
-    -1214, -1076, -385, 327, -402, 129, -1333, -822, 12, -622, -1284, -1194,
-    -1699, -1301, -2226, -3000, -2508, -2123, -2359, -1706, -584, -1180, -1917, 386,
-    -617, -524, 546, -1492, 96, 136, -332, 378, 1164, 610, 449, 408,
-    -1086, -616, -705, -320, 1217, 1981, 863, -880, 176, 91, 321, -1272,
-    -2624, -1912, -2826, -675, -1229, -1000, -896, -668, 614, 2, -781, -695,
-    -1005, 363, -257, 407, 657, 24, -1400, 486, -97, -1143, -116, 443,
-    404, -379, 1072, 1368, 1355, 546, -1113, -41, 451, 419, 1047, 497,
-    341, 442, 704, 308, 1184, 2845, 1320, 1804, 1786, 374, 1611, -130,
-    -938, -65, 408, -217, 1904, 2563, 841, 652, -238, -158, -1832, -1185,
-    599, -687, -1177, -376, -164, -755, -64, 1295, 13, -882, 1086, 2438,
-    1459, 1421, 121, -1556, -427, 813, 786, 977, 544, 653, 1513, 2133,
-    446, 573, 1345, -14, -49, -15, -283, 46, 579, -1740, -1272, -1503,
-    -1785, -712, -201, -463, -1955, -1056, -1068, -3085, -1817, -2014, -1098, -2631,
-    -575, 763, 651, 584, 389, 32, 84, 68, 306, 497, 832, 1047,
-    -222, -432, -334, 625, -969, 744, 937, 698, 643, 937, -40, -152,
-    268, -702, -1066, -129, -1744, -1798, -2411, -2443, -1145, -1546, -1328, -117,
-    -1397, -2613, -2819, -2109, -3207, -2483, -1751, -2464, -1426, -841, -565, -2291,
-    -1217, -845, -513, 989, -1214, -701, 2354, 1559, -41, 1133, 435, 1171,
-    1489, 859, 300, 24, 91, -1915, -159, 1864, 1633, 54, -1478, -957,
-    -1713, -2370, -1902, -2876, -2925, -3411, -2710, -3834, -2556, -2000, -1529, -2124,
-    -2856, -1804, -1861, -1901, -645, -502, -802, -334, -1639, 447, 443, -34,
-    958, 1309, 1251, 3842, 2500, 2117, 3297, 2906, 2351, 1088, 2428, 2999,
-    1546, 4638, 3586, 3655, 3961, 3443, 3631, 2662, 2575, 1512, 336, 2528,
-    911, -268, -355, -47, -218, 131, -295, 269, 841, 836, 301, -801,
-    -814, -25, 767, -45, 692, -175, 558, -65, -136, 1668, 1236, 1019,
-    2242, 4061, 2296, 2146, 2057, 767, 616, 2555, 1504, 3481, 4183, 2225,
-    2523, 2447, 248, 1095, 2829, 1181, 762, 741, 614, 2428, 973, 2060,
-    3305, 2077, 2006, 1780, 1447, 2051, 2052, 1321, 1278, 2310, 2561, 1651,
-    2513, 628, -458, -210, -242, -827, -1325, 2306, 964, 1023, 2702, 1789,
-    1781, 1553, 893, 1160, 1231, 987, 851, 964, 1187, 1740, 1590, 1423,
-    2319, -108, -740, 448, 708, -2852, -2762, 434, 617, -1730, -386, 1275,
-    -1505, -1875, -1353, -1895, -2017, -2506, -1460, -1409, -740, -731, 293, -474,
-    -1527, 672, 1126, 702, 1678, 1897, 607, -85, -130, -1566, -2005, -729,
-    -831, 213, 1068, 406, 129, -612, -356, -245, -165, 421, -991, -884,
-    -1822, -1433, -338, -2177, -2361, -2136, -2466, -2128, -3427, -2572, -2457, -3121,
-    -3091, -2662, -3491, -2346, -2875, -502, -692, -1090, -1830, -2787, -2198, -1507,
-    -511, 728, 1325, -184, 519, -3, -774, -1052, -434, -1598, -1354, -341,
-    86, -1337, -1312, 612, -485, -280, 395, -1611, -1033, -816, -1214, -2526,
-    -237, -2696, -2674, -749, -267, -1495, -31, -1426, -1806, -2091, -2670, -1842,
-    -832, -616, -1276, -381, 112, -251, -127, 466, 793, 847, 1099, 1448,
-    1524, 1820, 1326, -23, 1102, 890, 68, -98, 788, 477, -776, 772,
-    1537, -503, 285, 1889, -732, 104, -175, 685, -2026, -1053, -2064, -3239,
-    -3532, -3109, -2701, -2501, -3216, -3400, -3753, -2546, -1629, -2740, -1090, -1980,
-    -577, -1071, -1560, 798, -1976, -1788, 2306, 2036, 1111, 3299, 3991, 4518,
-    3692, 2393, 2740, 2566, 1755, 2164, 2189, 354, 3022, 1974, 1288, 1458,
-    3010, 3892, 1061, 1733, -679, -56, -802, -585, -962, -892, -124, 714,
-    973, -197, 133, 21, -1155, -298, -800, -637, -995, -832, -46, 222,
-    1729, 735, -1165, 41, 1478, 2124, 1853, 639, 2353, 510, 658, 1397,
-    928, 1822, 2982, 3773, 3849, 3917, 1935, 714, 536, 491, 437, 333,
-    -998, 8, 720, -1303, -483, -169, 945, 122, -432, -228, 133, -205,
-    1438, -673, -726, 954, 178, -787, 460, -733, -1800, -882, -619, -245,
-    37, 1264, 703, 1418, 325, 13, 473, 688, 1251, 398, 543, 410,
-    106, 1100, 1685, 676, -450, 583, -773, -447, -75, -590, -486, 728,
-    -1742, -2479, -287, -614, -1519, -1864, -10, -1884, -1934, -2269, -1750, -2050,
-    -1532, -1521, -2301, -2132, -2071, -110, 20, -208, -1162, -1391, 138, 589,
-    1416, -304, 174, -219, 609, 811, 841, -73, 299, 657, 248, 474,
-    -636, -555, -573, -510, -1115, -1787, -2263, -2976, -2930, -3036, -1355, -2969,
-    -2240, -2977, -1735, -1315, -1385, -1853, -1576, -2184, -3108, -3095, -659, -764,
-    -1539, 2, -1130, -389, -1033, -67, -1819, -578, 838, 1202, -498, -1287,
-    231, -660, 52, 870, 394, -96, 13, 646, -647, -1735, -937, -701,
-    703, 406, -841, -980, -1056, -593, -1668, -1152, -1093, -298, -37, -966,
-    254, 125, -213, -490, -1263, -2441, -1669, -647, -363, -60, -697, -208,
-    -179, -421, 1340, 1081, 1179, 2072, 2070, 878, 984, 723, 775, 698,
-    1608, 1355, 88, 1588, 2146, 1455, 296, 582, 1904, 457, -147, 161,
-    106, -105, -475, -585, -1364, -2673, -2743, -1654, -1558, -1976, -1765, -290,
-    1184, 343, -1052, -835, -7, -58, 351, 229, -407, 173, 909, 2959,
-    2439, 2336, 1772, 3183, 3435, 2224, 4658, 5051, 5113, 5172, 3997, 5611,
-    5364, 3662, 4355, 4195, 4577, 3779, 3252, 1866, 3183, 1691, 486, 947,
-    1310, -761, -543, 1190, 985, 284, -443, -960, -27, -72, 709, 294,
-    -641, 162, 908, 1299, 1604, 243, 1129, 1202, 1936, 1048, 1212, 1777,
-    3313, 3719, 3166, 2514, 1363, 2400, 3270, 2378, 4850, 4043, 3426, 2173,
-    2374, 1461, 516, 842, 409, 789, 1988, 2227, 1870, 2886, 2544, 1906,
-    1299, 795, 3112, 2873, 2040, 1815, 1293, 2094, 1637, 1112, -340, 730,
-    1040, 418, 596, 1067, -677, -111, 2402, 2365, 413, -894, 669, -253,
-    825, 1172, 1185, 1020, 1793, 2206, 2513, 1881, 487, 1250, 1008, 1381,
-    250, -521, 105, -62, -968, -466, -740, -925, -459, -1108, -511, -305,
-    -1136, -853, -1127, -2065, -2982, -2238, -1465, -1733, -1295, -1502, -339, -379,
-    478, -621, 565, 1535, 976, -871, 210, -1022, -974, -777, -83, 646,
-    -29, 1024, -1116, -1387, -1063, -983, -1270, -1433, -2679, -3169, -3580, -2460,
-    -2329, -4122, -3817, -3633, -3743, -2053, -2291, -2715, -3412, -3930, -4818, -5056,
-    -4232, -5169, -4634, -3822, -4224, -3299, -3032, -3518, -3090, -1907, -2072, -2468,
-    -2197, -1174, -1190, -2854, -3211, -1209, -1507, -1963, -956, -2276, -1649, -2001,
-    -1682, -2788, -2372, -2249, -2146, -2684, -1293, -2199, -2704, -2100, -2269, -2995,
-    -3910, -3975, -2228, -2542, -2509, -2158, -1450, -2368, -3400, -2816, -2091, -3031,
-    -3453, -3407, -2770, -2581, -2342, -2907, -1793, -912, -514, -1313, -624, -1846,
-    -221, -844, -1123, -933, -1124, -947, 756, 564, -51, -157, 199, -231,
-    -856, -1131, -1235, -775, -1558, -2508, -2590, -2225, -3194, -3151, -3463, -2915,
-    -1863, -1672, -2069, -2189, -2541, -2254, -2618, -2759, -1986, -1916, -1104, -613,
-    -576, -1122, -123, 196, 255, 838, 1356, 1682, 4488, 4565, 2843, 3649,
-    4148, 4002, 4292, 4383, 4379, 3759, 3517, 4371, 3334, 2429, 3125, 3907,
-    3576, 2652, 2987, 2082, 996, 1386, 1096, 1069, 529, -464, 475, 1189,
-    -526, 262, 1978, 1119, -807, -1137, 15, -961, -663, 1089, 394, 1020,
-    1043, 1073, 216, 1825, 2627, 2307, 2424, 3694, 1437, 268, 1315, 2371,
-    3413, 4758, 4783, 3264, 3161, 2779, 2103, 1637, 1196, 2872, 2745, 1216,
-    1024, 2297, 2295, 2582, 2478, 2205, 2363, 2408, 2819, 2929, 3323, 3013,
-    3507, 3559, 1185, 1160, 801, 683, 1612, 1448, 778, 741, 1286, 1009,
-    1230, 1325, 1346, 1352, 2553, 1891, 1146, 664, 607, 1233, 2955, 1971,
-    1796, 1441, 1745, 1962, 1914, 2489, 1759, 1383, 1559, 1137, 1129, 683,
-    1341, 1634, 607, 705, 2004, 870, 95, -402, -665, -594, -901, -517,
-    834, 1025, 884, 475, 816, 832, -47, 450, 1245, 984, 865, 808,
-    457, 270, 1460, 1788, 759, -228, -603, -864, -1101, -1645, -2772, -2842,
-    -2333, -2144, -2490, -3362, -2844, -2482, -2323, -2760, -2047, -2272, -2434, -2002,
-    -2520, -2922, -1672, -1259, -1526, -2045, -2618, -2436, -2092, -2432, -1427, -1068,
-    -841, -1731, -2126, -759, -1367, -1149, 181, -53, 46, 48, -327, -893,
-    -477, -638, -639, -1054, -552, -1202, -960, -368, -1134, -1828, -69, -500,
-    -1008, -1819, -1867, -1106, -983, -1169, -1027, -425, 596, 648, 162, -624,
-    -282, 91, -1022, -1539, -1490, -1919, -1025, -488, -1118, -1357, -768, -272,
-    -947, -971, -275, -249, -48, -439, -71, 235, -292, -417, -2139, -2505,
-    -1666, -1457, -2202, -2570, -1211, -1228, -1899, -2396, -1734, -686, -1536, -2100,
-    -2526, -1916, -1458, -2615, -2676, -1679, -2035, -1486, -1286, -1927, -1874, -1979,
-    -1498, -2156, -1769, -350, -91, -186, -568, -472, 59, 292, 913, 356,
-    -108, 1256, 1646, 2204, 2748, 2972, 2731, 2062, 1742, 1968, 1348, 1846,
-    1096, 1507, 1459, 980, 1403, 1600, 1511, 1484, 1315, 922, 687, 1534,
-    1108, 438, 337, 1204, 1987, 2309, 243, 811, 1124, 895, -172, 1314,
-    1320, 718, 447, 1136, 880, 857, 90, 441, 1685, 1289, 905, 762,
-    723, 1025, 989, -329, -509, -512, -246, 32, 820, 1592, 1419, 1055,
-    1766, 2289, 1797, 829, 148, 1138, 1433, 303, 308, 862, 2148, 1890,
-    1792, 2336, 2326, 790, 921, 1031, 1171, 523, 642, 606, 1160, 552,
-    326, -403, 654, 273, 258, 417, 681, 1051, 166, -539, 18, -183,
-    -429, -774, -1527, -1121, -578, -756, -759, -723, -1039, -795, 286, 1797,
-    1409, 631, -136, -586, -134, -104, -185, -65, -416, -315, 346, -501,
-    -403, -1242, -479, -402, -967, -595, -554, -1101, -465, -768, -926, -633,
-    -637, -152, 652, 327, -880, -414, 69, -68, -1230, -2007, -1529, -2139,
-    -2306, -1677, -1344, -2098, -1601, -1790, -2172, -2584, -2263, -2956, -2516, -2056,
-    -2679, -2546, -1235, -960, -2131, -2627, -1371, -590, -2689, -2661, -1643, -2178,
-    -2886, -1855, -1268, -561, -1930, -1428, -660, -1166, -1484, -1204, -1334, -1296,
-    -1483, -1077, -1137, -1698, -1867, -1090, -789, -1910, -2274, -1708, -1612, -1655,
-    -2053, -1457, -432, -380, -96, -369, 171, -415, -545, -916, -288, -400,
-    -428, 205, 167, 322, -298, -439, 137, -187, -351, -41, -363, -865,
-    -550, -522, -612, -816, -514, -362, -230, -841, -513, -183, -110, 502,
-    61, -482, -289, -608, -557, -808, -821, -353, -691, -632, -694, -1041,
-    -796, -216, -318, -16, -285, -643, -397, -86, 401, 568, 188, 529,
-    7, -653, 134, 814, 749, 151, 254, 364, 884, 524, 250, 647,
-    507, 717, 229, 152, 937, 1589, 1806, 2217, 3205, 3078, 2911, 2226,
-    2173, 2163, 2160, 2031, 2339, 1934, 1989, 2627, 2811, 3236, 3105, 2788,
-    2795, 2582, 2719, 2900, 2523, 1750, 1791, 1030, 1416, 1275, 1465, 1501,
-    1557, 1664, 1093, 1541, 1475, 1560, 1068, 1017, 1838, 1806, 1275, 926,
-    626, 713, 635, 453, 763, 538, 77, 77, -53, 665, 221, 166,
-    -119, -437, 89, -57, 566, 991, 876, 1234, 1318, 704, 1124, 1064,
-    1129, 1673, 875, 829, 1034, 2047, 1905, 1978, 917, 1916, 2251, 1026,
-    933, 1141, 868, 1138, 1255, 1733, 1676, 1604, 1865, 1377, 1754, 1037,
-    706, 1433, 945, 453, 247, 222, 167, 304, 185, 976, 1238, 367,
-    542, 603, 306, 797, 1315, 424, 488, 486, 402, 446, -39, -618,
-    -409, -342, -679, -795, -798, -496, -1260, -1707, -1620, -803, -714, -750,
-    -830, -1135, -712, -690, -650, -486, -752, -570, -711, -1349, -743, -1494,
-    -1754, -1530, -2060, -2206, -1410, -1692, -2361, -2016, -2017, -1489, -1217, -2034,
-    -1198, -414, -714, -1193, -1827, -1696, -1483, -2435, -2311, -2026, -1404, -1432,
-    -1674, -1468, -1692, -2073, -2479, -1898, -2091, -1740, -1130, -643, -230, -551,
-    -1285, -597, -1238, -558, 43, -1007, -858, -1090, -1309, -1827, -1683, -1794,
-    -1634, -2047, -2091, -1590, -912, -1348, -1211, -1628, -876, -552, -1149, -301,
-    182, 260, 349, 233, -554, -636, -175, 252, -103, -399, 148, 464,
-    47, -152, -719, -448, -116, -297, -862, -252, 171, -249, -866, -331,
-    -461, -621, -1304, -1077, -956, -1031, -1311, -2001, -1811, -1293, -1064, -1692,
-    -1346, -1336, -1495, -1273, -266, -349, -654, -392, -24, -597, -863, -343,
-    -691, -1228, -1582, -736, -918, -767, -947, -269, -157, -276, -240, -946,
-    -707, -496, -329, -38, 242, 938, 1045, 1213, 1761, 1929, 1786, 1269,
-    882, 822, 670, 1063, 1401, 1326, 2145, 1903, 1700, 2107, 2157, 2368,
-    2222, 1839, 1941, 2019, 2297, 2641, 2430, 2385, 2693, 2354, 2654, 2261,
-    2201, 2023, 1662, 1555, 818, 1467, 1321, 1398, 1348, 884, 456, 287,
-    356, 786, 703, 798, 1190, 420, -269, -520, -944, -248, 88, 59,
-    -832, -745, -1271, -391, -370, -451, -701, -747, -785, -553, -370, -112,
-    132, -61, 177, 171, -148, -327, 696, 468, 561, 65, 132, 798,
-    331, 3, 1035, 741, 1290, 1475, 1049, 1174, 880, 246, 322, 228,
-    516, 544, -65, -214, -380, -369, -64, -242, -503, -29, -122, -188,
-    378, 754, 444, 401, 572, 982, 1020, 1380, 1813, 1547, 1125, 1046,
-    1118, 771, 1173, 713, 1386, 1576, 734, 318, 584, 70, 55, -289,
-    -258, 156, 85, 376, -17, 639, -139, -629, -7, 305, 22, -347,
-    395, -110, -402, -388, -205, 154, -474, -564, -927, -689, -747, -993,
-    -828, -852, -913, -2, -297, -219, -413, -853, -636, -630, -753, -661,
-    -371, -255, -224, -178, -451, -299, -308, -647, -1358, -989, 241, 403,
-    352, -591, -482, 438, -302, -228, 416, 362, -77, -426, -296, -693,
-    -737, -681, 256, 54, -407, -499, -631, -84, -220, -1007, -264, 515,
-    325, 848, 1179, 1335, 888, 197, 386, 866, 710, 685, 518, 281,
-    944, 980, 1007, 1207, 872, 391, 1089, 1122, 1145, 1352, 672, 377,
-    323, 941, 1099, 565, 553, 1065, 984, 329, -290, -564, -282, -492,
-    -1038, -1378, -1825, -1351, -1302, -1380, -1501, -977, -1134, -929, -969, -1219,
-    -1206, -1194, -855, -1083, -1337, -1606, -1337, -745, -646, -507, -620, -962,
-    -1708, -2003, -1308, -1075, -528, -403, -374, -814, -377, -136, -71, 1152,
-    585, 36, -584, -1630, -1258, -1108, -384, -225, 336, 596, 965, 909,
-    1081, 1338, 981, 1218, 1547, 1001, 1106, 605, 443, 1276, 1256, 1003,
-    880, 1700, 1462, 1874, 1157, 1043, 1324, 530, 191, 788, 491, 835,
-    356, 587, 1175, 770, -99, -60, 35, -1, -567, -524, -578, -1189,
-    -1580, -989, -218, -235, -720, -1135, -1102, 149, 397, 436, 47, -194,
-    101, -69, -1, -143, 17, 298, 440, 1048, 1187, 1235, 538, 323,
-    519, 644, 675, 994, 75, -320, -551, -311, 235, 666, 1293, 827,
-    829, -39, 344, 539, 351, 383, 182, -49, 364, -261, 13, 275,
-    167, -212, -571, -240, -146, -414, -875, -691, -429, 207, -189, -1338,
-    -531, -483, 385, 1150, 1022, 645, 447, -24, 6, -205, -11, 440,
-    468, -596, -483, -146, -123, 256, -72, 213, 126, -196, -159, -584,
-    -1037, -668, -128, -1085, -2162, -1778, -1167, -784, -611, -1101, -1124, -1172,
-    -1223, -840, -142, -194, -447, -234, -258, 3, -94, 97, -214, -1434,
-    -1429, -1142, -1154, -763, -1625, -1735, -1678, -1288, -1791, -2367, -2026, -1484,
-    -1602, -1933, -1042, -1126, -1502, -1743, -1459, -772, -831, -432, -746, 15,
-    13, -484, -204, -281, -972, -1066, -1072, -1030, -1950, -1461, -1485, -815,
-    -570, -81, -232, -263, -262, -1256, -1231, -451, -299, -1034, -1583, -362,
-    -303, -541, -87, 596, 464, -2, -400, -97, 403, -667, -499, -528,
-    -408, -336, 24, -318, -144, -135, -98, 317, 413, -110, 160, -776,
-    -317, 163, -564, -17, -442, 309, 315, 324, 283, -184, -230, -338,
-    78, -305, -630, -580, -178, -434, 12, -248, -799, 201, 0, -149,
-    467, -91, -253, -67, -286, -553, -278, -319, 684, 1575, 796, 80,
-    539, 379, 780, 778, 193, 459, 437, 629, 548, 967, 489, 868,
-    1105, 909, 1536, 1616, 1546, 2180, 2462, 2303, 3455, 3239, 2904, 3371,
-    3364, 3426, 3749, 3574, 3458, 3334, 2637, 3453, 2950, 1343, 596, 784,
-    1663, 643, 325, 897, 517, 52, 254, -97, 654, 178, -407, 247,
-    969, 896, 795, 268, 255, 301, -85, -496, -310, 290, -252, -330,
-    721, 2153, 1900, 924, 2450, 963, 219, 156, 784, 2322, 1828, 1791,
-    1616, 2079, 2131, 1589, 322, 151, -1018, -820, -83, 840, 904, 1561,
-    1772, 2057, 2775, 1520, 600, 1075, 1613, 1669, 2085, 2098, 1649, 1567,
-    233, 864, -32, -818, -1038, -234, -584, -602, 381, 1271, 367, -55,
-    -110, 591, 902, 1308, 1714, 2412, 2502, 2057, 1662, 2576, 2383, 1930,
-    746, 471, 65, 204, 13, -2136, -769, 206, -366, 588, 1154, 734,
-    -366, -94, -729, -1085, -2082, -2070, -1275, -747, -1401, -427, -448, -341,
-    -206, -870, -1089, 57, 271, 847, 634, 334, -685, -573, -461, -324,
-    205, 1051, 1442, 865, 995, 657, 1046, -749, -1098, -971, -711, -2155,
-    -2297, -1474, -1435, -2534, -2438, -2379, -1804, -1581, -1952, -2592, -2102, -1522,
-    -2343, -3059, -2713, -2150, -1952, -2502, -2334, -1049, -1568, -2208, -1553, -1498,
-    -640, -241, 750, -426, -138, 947, -323, 292, 41, 330, 659, 951,
-    540, 339, 711, 790, 944, 483, 27, 220, -327, -1174, -614, -303,
-    -324, -1076, -20, -626, -689, -1124, -947, -940, -1233, -1537, -1997, -1717,
-    -2446, -2851, -1201, -1275, -2053, -2067, -864, -1171, -1259, -1288, -1578, -1640,
-    -1029, -225, -1534, -1113, -746, 717, -280, -138, -503, 729, 662, 117,
-    1399, 890, 128, 401, 851, -407, -2037, -1281, -868, -1382, -799, -2170,
-    -2145, -1876, -2036, -1766, -788, -2012, -1715, -822, -1371, -2380, -1513, -707,
-    -1283, -2108, -1381, -153, -845, -110, 439, 392, 1443, 3173, 1600, 1038,
-    2575, 2404, 1328, 955, 535, 2045, 2445, 2562, 1301, 2421, 3750, 3031,
-    2696, 2134, 2277, 2239, 1944, 1558, 644, 1179, 1175, 26, -302, 528,
-    -213, -51, 1367, 20, -1605, -1126, -197, -1904, -2082, -2130, -1497, -1915,
-    -2035, -678, -581, -644, 361, 1254, 388, 485, 621, 250, -1106, -843,
-    -127, 677, 2098, 3102, 3244, 2638, 757, 1136, 86, -492, -543, -55,
-    -1261, -1260, -463, 345, -109, 231, -312, 502, -1258, -493, 993, 1378,
-    2312, 1239, 834, 457, 545, -292, -1050, -877, -1088, -567, -845, -1947,
-    -456, 127, 172, 90, -788, -845, -64, -18, -46, 567, 1342, 1624,
-    3506, 2956, 2400, 2374, 2113, 1150, 418, 282, -861, 966, -73, -2333,
-    -1620, 270, 225, -248, -88, -22, -564, -242, -1092, -2441, -1701, -1309,
-    -1401, -2677, -1250, -739, -322, -329, 199, 1490, 160, -41, 2343, 2163,
-    1170, 1397, 1691, 1714, 1788, 1406, 1872, 2429, 2386, 2052, 1290, 1390,
-    513, -206, -1124, -939, -655, -1327, -43, 74, -1158, -871, -262, -1437,
-    -1806, -56, -1145, -2144, -2075, -2320, -2872, -1784, -2054, -2318, -2004, -778,
-    -126, -465, -1107, -717, 452, -721, -1641, -583, 965, 544, 601, -223,
-    180, 79, 1044, 1339, 1876, 2359, 822, 1271, 2318, 1803, 1840, 1633,
-    621, 490, 1487, 90, -21, 898, 1154, -661, -816, 1202, 524, 51,
-    810, -228, 433, -505, -537, -242, -1825, -733, -729, 350, -285, -627,
-    -587, 115, -408, -678, 565, 1131, 1021, 1231, 422, 788, 200, 647,
-    866, 897, 1953, 1627, 938, 1725, 1966, 1481, 1082, 41, 413, 310,
-    -913, 453, -407, -203, -1223, -1073, -1296, -92, 478, -72, 51, 163,
-    -115, -1309, -1951, -1163, -1084, -406, 742, 974, -279, 912, 1554, 107,
-    173, 2248, 2452, 3050, 3710, 3868, 3515, 3634, 2256, 1424, 2710, 3051,
-    2638, 3343, 3870, 2974, 1610, 2015, 3196, 2966, 1949, 2386, 2297, 691,
-    1068, 488, -1069, -213, 207, 685, 1691, 371, -203, -1505, -1982, -1939,
-    -844, -775, -1047, -592, 320, 560, 873, 938, 934, 384, 6, -1,
-    835, 691, 1118, -8, -971, 427, 2427, 2554, 2368, 2716, 2374, 2046,
-    202, -698, -976, -1121, -482, -424, -869, 315, 781, 31, 322, 96,
-    499, -1025, -1880, -2361, 244, 1308, -973, -2368, -1756, -2027, -1163, -118,
-    -1451, -2061, -1509, -1368, -1713, -2180, -9, 1047, 263, -665, 431, 692,
-    -769, -352, 510, 655, 266, 401, 448, 1050, 502, 950, 720, -1032,
-    -1160, -1584, -1298, -1246, -3461, -4124, -2785, -1665, -1747, -1946, -1736, -2265,
-    -3117, -2851, -3357, -5129, -4125, -3383, -4460, -3250, -2672, -2609, -1189, -2466,
-    -1493, -1434, -1503, -1484, -1973, -867, -1611, -2531, -1512, -698, -372, -56,
-    -779, -1137, 269, -372, -702, -942, -1887, -3047, -2931, -2982, -2668, -2540,
-    -1763, -2426, -3125, -2836, -1959, -2483, -3817, -3193, -2905, -4556, -4788, -4948,
-    -4647, -4822, -4230, -3761, -3712, -4243, -3013, -1809, -2019, -2980, -1846, -828,
-    -1902, -2377, -973, -296, -415, -506, 151, -522, -851, -437, 374, 873,
-    -295, -53, 591, 1257, 160, 649, 744, 167, -645, -1136, -1561, -765,
-    -928, -1594, -1513, -707, 1385, 488, -36, -120, -432, -725, -2376, -1425,
-    -1725, -1491, -596, -497, 362, 16, -600, -774, -679, 142, 1529, 1364,
-    -795, 486, 1080, 160, 602, 487, 426, 543, 342, 471, 5, 587,
-    1059, 1344, 1899, 342, 400, 761, 353, 288, 816, 91, -573, -276,
-    620, 150, -112, 1320, 1352, 957, 306, 676, 342, -75, 310, 1299,
-    1633, 1235, 1760, 1248, 2012, 1860, 2304, 2750, 3291, 2326, 2239, 2175,
-    1388, 1620, 3057, 4045, 3742, 3535, 3565, 3956, 4060, 4047, 2833, 2166,
-    2598, 1737, 1645, 1934, 2072, 2852, 1634, 1632, 773, 741, 1557, 1896,
-    1453, 1776, 1477, 964, 47, -601, -845, -570, -273, -163, 556, 766,
-    -166, 148, 1102, 705, 2116, 2041, 1906, 1509, 578, -373, 906, 2546,
-    2803, 3304, 5186, 3850, 2863, 2319, 1258, 884, 886, 1256, 1264, 1265,
-    2059, 1553, 1816, 234, 293, 1682, -27, -974, -645, -18, 604, 781,
-    618, -710, -974, -1377, -1476, -1522, -1484, -745, -1178, -1094, -797, 599,
-    1049, 431, 868, 50, 555, 776, 772, 1300, 1234, 1202, 502, 1955,
-    1958, 1797, 1201, 1402, 1274, 303, -323, -451, -577, -1056, -652, -176,
-    -933, -651, -930, -1034, -394, -623, -1687, -1725, -1590, -1380, -2639, -3492,
-    -2992, -1944, -1505, -1240, -1457, 686, -471, -1722, 429, 723, 781, 426,
-    238, -581, -181, -101, -767, -1031, -638, -185, 140, 4, -476, -108,
-    -269, -1129, -2281, -1969, -2599, -3205, -2767, -2887, -2656, -1491, -1877, -2056,
-    -2603, -3636, -2551, -2913, -3386, -3927, -4467, -4198, -3542, -3593, -3272, -2930,
-    -3114, -2744, -2316, -1311, -1961, -1795, -965, -581, -1159, -795, -1024, -1264,
-    -796, -393, 956, 1989, 1494, 1665, 1608, 645, -240, 670, -317, 607,
-    548, -753, -1425, -741, -632, -877, -1955, -1670, -1658, -958, -461, -1458,
-    -1674, -2034, -3522, -2123, -1378, -2493, -2811, -3377, -2293, -1575, -1638, -237,
-    904, -136, -571, -210, 1352, 785, 41, -170, 282, -96, 510, 360,
-    812, 1208, 993, 884, -346, 308, -68, -170, 940, -239, -667, 296,
-    742, 42, -14, 305, -220, -606, -741, 1116, 593, 180, -110, -440,
-    -313, -222, 712, 977, 182, 624, 1600, 1562, 1699, 1582, 1579, 1429,
-    756, 2072, 2742, 2614, 3454, 2872, 2811, 3718, 3511, 2745, 3036, 3974,
-    3741, 3105, 3676, 3503, 2762, 2429, 2410, 2152, 1183, 1810, 1889, 1503,
-    854, 506, -91, -608, 23, 27, 379, 533, -39, 587, 595, -188,
-    -1374, -1047, -577, -515, -76, 645, 229, 645, 349, 2086, 3201, 2497,
-    2521, 2250, 1400, 1488, 2709, 2942, 3449, 3910, 3984, 2945, 2363, 1875,
-    1597, 1702, 1501, 1312, 1091, 768, 1991, 2165, 796, 260, 874, 866,
-    -381, 7, 260, 235, 95, 252, 432, 557, -540, -1813, -2170, -1505,
-    -1349, -1158, -1359, -726, 181, 253, 770, 183, -678, -511, -168, -236,
-    -511, 36, 1031, 1161, 551, 923, 1277, 282, 206, 388, 41, -1138,
-    -1216, -944, -1051, -1213, -1632, -1762, -1638, -2155, -2420, -1521, -1601, -2294,
-    -2102, -1534, -1922, -2271, -2319, -2187, -2224, -2347, -1590, -843, -1263, -2224,
-    -1838, -1494, -769, -151, 202, 0, -241, 52, -372, -61, 132, 378,
-    -113, -441, -1116, -1128, -2038, -2279, -1729, -1963, -2674, -2951, -1969, -2090,
-    -2012, -1979, -2203, -1824, -1839, -2554, -2484, -2497, -2359, -2964, -2723, -2588,
-    -2385, -2400, -2777, -2422, -2487, -2406, -2036, -1945, -1657, -1699, -1269, -1303,
-    -1290, -678, -129, 193, -71, -70, 103, 100, 16, -338, 20, 977,
-    666, 399, 257, 100, 815, 138, 496, 467, -63, 329, 1248, 2044,
-    2203, 1705, 1176, 874, 894, 912, 619, 1201, 1285, 1405, 1392, 754,
-    196, 415, 611, 903, 1364, 1287, 993, 1576, 1529, 1376, 1536, 1460,
-    1474, 1302, 1619, 1495, 1341, 790, 284, -46, -67, 49, 86, 218,
-    528, 975, 994, 1044, 509, 820, 994, 1221, 1334, 1232, 1093, 497,
-    636, 1370, 1490, 1307, 1540, 1857, 1935, 1804, 1475, 1678, 2119, 2111,
-    2697, 3050, 2827, 2466, 2391, 2405, 2518, 2717, 2420, 2685, 3145, 2361,
-    2866, 2995, 2395, 2396, 2286, 1505, 735, 749, 462, 767, 1387, 2230,
-    2424, 2620, 2536, 2235, 1791, 1057, 400, 285, 613, 978, 1265, 1118,
-    1424, 1334, 1722, 1519, 1361, 1078, 1107, 658, 63, 192, 283, 467,
-    364, 457, 635, 447, 712, 483, 502, 587, 873, 500, 545, 255,
-    -208, 332, 436, 653, 551, 410, 244, 175, 121, -68, 214, 225,
-    416, -167, -164, -206, -273, -251, 226, 141, 91, 301, -87, -604,
-    -784, -950, -1357, -1091, -1019, -749, -550, -969, -675, -718, -874, -1065,
-    -1250, -1112, -1426, -1818, -1521, -1598, -1624, -1698, -2181, -2340, -2379, -1966,
-    -1844, -2380, -2203, -2149, -2679, -2884, -2646, -2525, -2808, -2836, -2468, -2303,
-    -2050, -1658, -1858, -1611, -1859, -1906, -1543, -1257, -1370, -1398, -1835, -1759,
-    -1592, -1670, -1560, -1261, -1269, -1333, -1458, -1930, -1973, -2320, -2446, -2729,
-    -2534, -2443, -2143, -2090, -2030, -1984, -1785, -1712, -2479, -3056, -3513, -3387,
-    -3085, -3081, -3073, -2163, -2097, -2425, -2192, -2039, -2070, -2372, -2348, -2278,
-    -2291, -2515, -2603, -2219, -1849, -1888, -1510, -1202, -886, -912, -1260, -1331,
-    -1263, -1148, -855, -821, -1113, -548, -626, -604, -150, 287, 613, 767,
-    1009, 816, 1028, 1099, 1280, 1259, 593, 733, 721, 754, 1025, 934,
-    794, 579, 553, 385, 702, 562, 677, 788, 1053, 860, 498, 176,
-    318, 321, 255, 21, -6, -66, -204, 19, 10, -22, 117, 177,
-    434, 692, 619, 958, 1165, 1408, 1200, 1252, 1479, 1306, 1176, 1032,
-    917, 353, 356, 530, 501, 536, 927, 1284, 1314, 1248, 1244, 1616,
-    2016, 2344, 2142, 2202, 2238, 2762, 2413, 2128, 2178, 2004, 2320, 2178,
-    2515, 2162, 2229, 2244, 2262, 1922, 1833, 1914, 1852, 1593, 1268, 1121,
-    1336, 1589, 1688, 2156, 2065, 1756, 1504, 1237, 890, 520, 371, 460,
-    957, 1214, 1550, 1770, 2100, 2079, 1792, 1581, 1316, 1174, 980, 845,
-    1188, 1351, 1348, 1260, 1061, 1263, 1288, 926, 846, 872, 1255, 773,
-    459, 419, 428, 354, 599, 700, 666, 952, 951, 1495, 1240, 1171,
-    1522, 1824, 1617, 1271, 982, 957, 840, 735, 858, 653, 716, 330,
-    162, 367, 482, 459, 392, 214, 20, 316, 538, 761, 806, 345,
-    208, 589, 730, 576, 325, 175, -101, 282, 367, 385, 512, 688,
-    615, 999, 863, 871, 1064, 849, 690, 689, 114, 209, 136, 51,
-    189, -542, -719, -625, -450, -365, -667, -1262, -1026, -867, -1186, -1456,
-    -1609, -1432, -1620, -1724, -1963, -1820, -1752, -1981, -1935, -2003, -1886, -1960,
-    -2072, -2149, -2045, -1711, -1138, -1193, -1383, -1517, -1539, -1632, -1895, -2279,
-    -2577, -2773, -2805, -2576, -2087, -1685, -1946, -2062, -2085, -2129, -2315, -2511,
-    -2933, -2998, -2746, -2844, -3313, -3598, -3556, -3458, -3459, -3664, -3424, -2584,
-    -2609, -2644, -2772, -2779, -3156, -3139, -3077, -3079, -2771, -2907, -3276, -3533,
-    -3201, -2915, -3120, -2927, -2355, -2467, -2440, -2502, -2293, -2600, -2476, -2200,
-    -1617, -1156, -1155, -962, -842, -688, -1164, -1264, -1216, -1245, -1010, -785,
-    -1003, -605, -415, -656, -638, -528, -529, -322, -311, -551, -285, -49,
-    28, -580, -816, -785, -512, -717, -921, -1074, -785, -340, -295, -204,
-    -289, -192, 97, 150, -208, -296, -184, -209, -142, -245, -206, 154,
-    213, 292, 660, 931, 1084, 798, 381, 416, 717, 349, 365, 886,
-    751, 734, 419, 869, 1481, 1661, 1817, 1811, 2250, 2492, 2524, 2292,
-    2480, 2256, 2475, 2555, 2907, 2887, 2428, 2958, 3371, 3085, 2238, 2460,
-    2575, 2370, 2070, 1908, 2038, 2159, 2036, 2002, 2225, 2373, 2118, 1953,
-    1646, 1417, 1282, 850, 1024, 996, 1095, 1078, 1093, 1350, 1472, 1295,
-    1801, 1892, 1525, 1629, 1568, 1748, 1993, 1782, 1631, 1328, 1268, 1280,
-    1157, 957, 804, 1401, 1465, 1495, 1312, 1457, 1566, 1360, 1287, 1317,
-    1687, 2030, 2153, 2066, 2283, 2380, 1922, 1571, 1385, 1266, 1060, 1029,
-    827, 745, 719, 412, 296, -31, 171, 403, 526, 527, 563, 315,
-    186, 14, -452, -577, -465, -154, -328, -850, -801, -582, -423, -381,
-    -269, 178, 265, 572, 701, 302, 323, 314, 393, -12, 406, 387,
-    464, 239, 83, 54, -114, -332, -239, -234, -479, -765, -827, -1293,
-    -1314, -1485, -1195, -1309, -1498, -1115, -1117, -900, -606, -850, -731, -632,
-    -584, -486, -882, -994, -905, -858, -736, -965, -1146, -823, -1047, -1411,
-    -1451, -1468, -1517, -1485, -1609, -1550, -2193, -2075, -1876, -1799, -1783, -1702,
-    -1487, -1503, -1615, -1345, -1461, -1637, -1546, -1620, -1891, -1728, -1920, -2046,
-    -1978, -2029, -1693, -1621, -1978, -1339, -1460, -1465, -1420, -1520, -1599, -1589,
-    -1371, -1269, -1142, -1430, -1307, -986, -821, -1044, -1378, -1190, -722, -751,
-    -681, -536, -569, -488, -625, -129, -271, -242, -94, -170, 141, 375,
-    220, 152, 168, 330, 251, 181, 441, 95, -189, -248, -42, -364,
-    -143, -164, -14, 247, -33, -30, 85, -79, 161, 50, 67, 132,
-    -242, 40, 397, 431, 422, 72, -158, 116, 25, 422, 432, 652,
-    292, 101, 401, 513, 504, 600, 515, 497, 399, 252, 389, 309,
-    52, -98, 297, 512, 462, 542, 829, 1044, 1233, 1206, 1364, 1672,
-    1503, 1707, 1881, 2320, 2481, 2588, 2481, 2835, 2535, 2399, 2458, 2214,
-    2154, 2054, 2049, 1928, 2260, 2459, 2676, 2678, 2459, 2411, 2618, 2224,
-    1851, 2364, 2047, 1841, 2084, 2021, 1651, 1340, 1387, 1670, 1228, 1154,
-    1206, 1187, 1147, 1168, 997, 1086, 1512, 1488, 1524, 1177, 1023, 809,
-    716, 972, 1058, 1156, 922, 485, 875, 1083, 758, 654, 765, 778,
-    837, 1074, 818, 979, 884, 1066, 1122, 1035, 1126, 1107, 1328, 1330,
-    1160, 1169, 548, 543, 235, 96, -51, -623, -146, 63, -163, -358,
-    -398, -410, -534, -496, -496, -363, -704, -839, -472, -389, -295, 124,
-    -89, -464, 66, 335, 32, -134, 9, -332, -240, -57, -123, -34,
-    41, 201, 296, -354, 21, -304, -483, -647, -578, -608, -1091, -1162,
-    -1227, -1332, -1282, -1643, -1909, -1917, -1923, -1791, -1869, -1878, -1427, -1168,
-    -1345, -1321, -1197, -1025, -901, -722, -893, -1027, -1314, -1201, -819, -985,
-    -1060, -875, -958, -982, -1101, -856, -1370, -1341, -1452, -1201, -1363, -1337,
-    -1636, -1640, -1940, -2091, -2001, -2199, -1945, -1968, -1759, -1755, -1849, -1387,
-    -1698, -1613, -2022, -1769, -1924, -2215, -2161, -2041, -2063, -1664, -1569, -1491,
-    -1777, -1675, -1704, -1827, -1984, -1994, -1717, -1445, -992, -912, -422, -468,
-    -706, -61, -2, 475, 745, 969, 1627, 1547, 1312, 1453, 1127, 1000,
-    785, 752, 769, 511, 697, 403, 15, -29, -289, -193, -297, -419,
-    -465, -598, -906, -1859, -2760, -677, 976, -845, -3156, -3767, -2826, -1958,
-    -1006, 273, 1235, 1538, 2042, 2208, 2070, 2008, 1821, 1883, 1265, 619,
-    323, -199, -1039, -1180, -698, -941, -1621, -1626, -1615, -1747, -1191, -1115,
-    -340, -117, 258, 764, 1229, 797, 1234, 1392, 1385, 2386, 2657, 2548,
-    2479, 2620, 2794, 3538, 3480, 3847, 4051, 4629, 4644, 4085, 4347, 4308,
-    4442, 4311, 4728, 4760, 4544, 4335, 4260, 4453, 4109, 4053, 4198, 4069,
-    4158, 4218, 3613, 2767, 2756, 2774, 3044, 3302, 3167, 2852, 2557, 2415,
-    2647, 1991, 1705, 1892, 1635, 1628, 1103, -7, -510, -701, -961, -1096,
-    -1755, -1863, -1947, -2412, -2884, -3283, -3334, -3354, -3897, -4932, -5101, -4994,
-    -5103, -5042, -4807, -4713, -4864, -4482, -4538, -4321, -4963, -5255, -4683, -4334,
-    -3584, -4366, -3960, -4212, -4691, -4105, -2962, -2990, -3169, -3233, -2051, -3107,
-    -3776, -2826, -1832, -1524, -1281, -1673, -1675, -188, 223, -387, -812, -2226,
-    -2537, -1509, -1126, -506, 162, -445, 210, 685, 1786, 1750, 1779, 2693,
-    3230, 3244, 3369, 2946, 2636, 2289, 1553, 1790, 1046, 400, 724, 493,
-    309, 2010, 2853, 2461, 2046, 1393, 831, 460, 712, 1337, 1210, 1194,
-    1099, 927, 737, 15, 274, -348, -395, 351, 73, 457, -1421, -3153,
-    -3038, -2769, -2534, -2484, -3336, -3971, -3945, -3802, -3550, -3005, -2979, -3280,
-    -3825, -4775, -4935, -4660, -3828, -4229, -4171, -4290, -4415, -2961, -2726, -2743,
-    -3378, -3672, -3231, -3453, -3089, -2496, -1948, -1097, -749, -1260, -2094, -2739,
-    -2609, -2059, -2732, -2350, -3269, -3055, -2054, -1541, -1163, -1792, -1426, -1145,
-    -618, -311, -336, -97, 540, 493, 1185, 1534, 1065, 789, 1426, 2090,
-    3123, 2750, 3596, 3939, 4445, 5137, 4531, 5118, 5679, 5571, 5379, 4941,
-    4758, 4751, 4744, 5264, 4948, 4672, 4614, 4059, 4230, 4799, 4202, 4384,
-    3824, 4286, 4104, 3851, 3398, 3455, 2938, 945, 1127, 1332, 1762, 2917,
-    3204, 2287, 1796, 1625, 1087, 1355, 286, 120, -84, 533, 551, -222,
-    21, 1158, 1151, 949, 529, 1169, 1084, 1618, 1840, 1764, 1853, 1556,
-    2207, 2780, 2554, 2177, 1822, 2091, 2526, 2655, 1402, 738, 473, 911,
-    1161, 1059, 801, 341, -831, -1945, -1758, -1243, -662, -326, 135, -77,
-    -1165, -1624, -1670, -1953, -1697, -2318, -2676, -1967, -1214, -1362, -977, -557,
-    340, 842, 1552, 1939, 1582, 1370, 1207, 1401, 1779, 2572, 2286, 2949,
-    3794, 3383, 3802, 4341, 4602, 4331, 4071, 4297, 4271, 4299, 3928, 3687,
-    3704, 3403, 2944, 2390, 2703, 4277, 5011, 4839, 4080, 3562, 2949, 2393,
-    2410, 1539, 1612, 2462, 2044, 2349, 2980, 3530, 3345, 3867, 3312, 4073,
-    3830, 2799, 2849, 2635, 652, 985, 1487, 2451, 3085, 3159, 2773, 2042,
-    1620, 869, 486, -472, -909, -916, -1050, -1033, -1626, -2151, -1825, -1323,
-    -486, -1042, -1453, -1599, -1181, -623, -857, -1565, -1486, -1774, -2738, -3642,
-    -3735, -4142, -4579, -4072, -2989, -3662, -2451, -1331, -1570, -2368, -2515, -2154,
-    -2759, -2027, -2549, -1613, -1776, -2063, -2260, -1414, -1291, -1550, -2136, -2763,
-    -2930, -2907, -2114, -2115, -3061, -3651, -3477, -2786, -3044, -3181, -3528, -3463,
-    -3150, -3878, -4146, -4101, -4358, -3304, -3750, -3940, -3338, -3069, -2614, -2706,
-    -2064, -2516, -1986, -666, 749, 458, 328, 224, -134, 89, 118, -4,
-    394, 230, 649, 663, 1201, 750, 1274, 1466, 719, -14, 410, 329,
-    106, -291, -1304, -1239, -35, 609, 607, 1847, 1444, 1774, 1181, 231,
-    -213, -61, 175, 230, 838, 825, 1174, 1914, 2201, 2432, 2231, 2471,
-    2062, 3213, 3130, 3140, 2894, 2990, 3196, 2789, 2999, 3115, 2953, 2500,
-    2640, 2759, 2367, 2540, 2365, 1187, 824, 614, 345, 472, 593, -587,
-    -1484, -1625, -1388, -1042, -663, -1188, -1928, -2086, -2136, -3414, -2464, -3200,
-    -3132, -3208, -3325, -3414, -3082, -2937, -2458, -2170, -2238, -2200, -1430, -633,
-    -806, -800, -790, -1270, -1689, -1799, -1655, -1611, -1692, -1631, -1150, -925,
-    -779, -1480, -1724, -1877, -1696, -2247, -1920, -1379, -2071, -3011, -2834, -3142,
-    -3152, -2312, -1984, -2815, -2794, -2628, -2636, -3227, -3296, -3294, -3788, -3846,
-    -3882, -3357, -3034, -2699, -2008, -1428, -728, -316, 279, 1010, 538, -85,
-    -1043, -1447, -1355, -1195, -905, -262, 149, 1026, 165, -44, -436, -384,
-    -1236, -814, -762, -326, -121, -307, -736, -711, -1410, -692, 55, 355,
-    750, 1096, 1184, 539, 405, 915, 1158, 1317, 1363, 1155, 1327, 1649,
-    2190, 2502, 2755, 2361, 3414, 4338, 4306, 4399, 3234, 2349, 1587, 1968,
-    3355, 3320, 4368, 5264, 4261, 3645, 3398, 2688, 2055, 1561, 1314, 1446,
-    2005, 1963, 2157, 1521, 1681, 2273, 1769, 431, -80, 985, 1328, 1616,
-    1375, 665, 778, 562, -316, -1218, -1464, -1491, -814, -57, -588, 157,
-    977, 1312, 806, 1064, 186, 483, 1176, 1082, 944, 756, 1137, 1347,
-    1406, 2101, 1594, 1400, 1351, 831, 173, 152, -397, -1827, -2568, -2616,
-    -1837, -2282, -1946, -1331, -1691, -2378, -3373, -4143, -4238, -4366, -4105, -3721,
-    -4424, -4539, -5221, -4359, -4124, -4015, -3428, -3621, -2615, -1945, -2638, -2986,
-    -3083, -2973, -2738, -2820, -2105, -1879, -911, -202, -935, -1223, -1422, -1655,
-    -1232, -994, -1545, -1844, -1880, -2022, -1880, -2314, -2093, -1916, -2203, -1299,
-    -875, -1741, -2004, -1588, -2657, -2441, -2023, -2199, -2273, -1914, -1931, -2037,
-    -1439, -1302, -1038, -483, -783, -1524, -572, 832, 975, 557, 336, 162,
-    473, 165, 921, 1585, 1428, 1485, 1434, 1045, 1118, 2002, 1294, 1901,
-    1375, 1704, 1964, 2311, 2146, 1015, 820, 1462, 2054, 2128, 2939, 2527,
-    2634, 2122, 1854, 1635, 2243, 2935, 3157, 2748, 2796, 2929, 2903, 3470,
-    4197, 4587, 4766, 5469, 5948, 5183, 4343, 4137, 4308, 4629, 4606, 4677,
-    5294, 5403, 5096, 5339, 5552, 5590, 5635, 5304, 4550, 4111, 4244, 3429,
-    3431, 3487, 3009, 2621, 2694, 2204, 2665, 3054, 3664, 3701, 3648, 3885,
-    3430, 3111, 2385, 2055, 2817, 1962, 1875, 2183, 1906, 2508, 2541, 2805,
-    3387, 2736, 3153, 2733, 2442, 1854, 1962, 2303, 2541, 2298, 2147, 1927,
-    1774, 1960, 1251, 1165, 1195, 1315, 1132, 486, 81, -413, -624, -1009,
-    -1657, -1822, -2139, -2208, -2067, -2134, -2157, -1857, -1688, -1871, -2489, -2247,
-    -2662, -2966, -3048, -3190, -2718, -2566, -2061, -1941, -1916, -229, -784, -1370,
-    -956, -1530, -2327, -2086, -1600, -1425, -907, -300, -400, -728, -1316, -1926,
-    -2640, -2814, -3162, -3443, -2973, -3007, -3038, -3442, -3695, -3767, -3050, -4554,
-    -5125, -5070, -4546, -3707, -3902, -3744, -4618, -4399, -4907, -5351, -5897, -6098,
-    -6232, -5685, -5714, -6109, -4672, -3841, -3969, -4357, -4565, -4809, -4877, -4052,
-    -3255, -2761, -1890, -1517, -683, -728, -848, -754, -938, -1114, -1226, -1362,
-    -1143, -1377, -2275, -2976, -2579, -1970, -1676, -1142, -1453, -2452, -2464, -2501,
-    -2598, -2256, -2427, -2798, -2330, -2166, -2011, -2059, -2081, -1496, -1316, -1263,
-    -815, -78, 525, 407, 463, -220, -111, -120, -490, -84, -98, 693,
-    938, 718, 837, 659, 719, 1039, 1241, 1290, 1467, 1055, 1219, 603,
-    231, 377, 784, 898, 1943, 2042, 1610, 1708, 2190, 1900, 1457, 1421,
-    977, 976, 1603, 1682, 2472, 3044, 3369, 3695, 4018, 3359, 3594, 4469,
-    4500, 4372, 4394, 3826, 3223, 3603, 3849, 3980, 4361, 4189, 4556, 4500,
-    4495, 4354, 4671, 4768, 4039, 3529, 2950, 2561, 2835, 2881, 1978, 1700,
-    1646, 1636, 2052, 2525, 2419, 2365, 2286, 1932, 1647, 1621, 1482, 2035,
-    2394, 2439, 1869, 2609, 2899, 3235, 3100, 3644, 3997, 3983, 3729, 3337,
-    3077, 2956, 3121, 3304, 3161, 3510, 3976, 3724, 3205, 3503, 3357, 3218,
-    2901, 1959, 2089, 1402, 892, 697, 622, 272, 297, 356, 451, 126,
-    238, 329, -109, -598, -1117, -1216, -1555, -1376, -1581, -1789, -1157, -900,
-    -1141, -635, -794, -606, 132, -56, 422, 487, -16, -736, -1635, -1606,
-    -904, -1071, -497, -53, 291, 139, -190, -352, -253, -1078, -1397, -1925,
-    -2108, -2253, -2382, -2590, -3089, -3482, -3394, -4025, -3896, -4073, -4674, -4636,
-    -4487, -4355, -4475, -4897, -4789, -4412, -4135, -3971, -4202, -4066, -4313, -3748,
-    -2796, -3514, -3340, -2426, -2147, -2620, -3043, -4138, -4152, -3455, -2567, -1937,
-    -1179, -393, -1294, -1811, -2183, -2293, -2682, -2912, -2825, -2669, -3054, -2999,
-    -3047, -2382, -2399, -2105, -1935, -3118, -3198, -2697, -2158, -2036, -1937, -1946,
-    -1974, -1984, -1623, -2270, -2889, -2944, -3168, -3368, -3181, -2417, -2133, -1477,
-    -1417, -1645, -1525, -1699, -1593, -1138, -28, 108, 660, 1049, 1272, 1443,
-    1216, 1296, 1346, 1266, 1407, 1253, 1092, 978, 516, 468, 437, 340,
-    688, 705, 503, 469, 530, 246, -12, 298, 197, 289, 379, 980,
-    1099, 1452, 1216, 1474, 2024, 1886, 1949, 1954, 1585, 2200, 2450, 2563,
-    2530, 3480, 3476, 3357, 3149, 3217, 3072, 3261, 2857, 2686, 2598, 2297,
-    2410, 2353, 2468, 2569, 2312, 2643, 2762, 2762, 2613, 1833, 2154, 2267,
-    2019, 2048, 2066, 2505, 3106, 2993, 2912, 3070, 3218, 3836, 3260, 3246,
-    3208, 3496, 3471, 2967, 2593, 2301, 2460, 3132, 3332, 3625, 3330, 3265,
-    3206, 2794, 2329, 2072, 2301, 2692, 2090, 2468, 2481, 2137, 2097, 2122,
-    1961, 1337, 1178, 1573, 1698, 1852, 1776, 1949, 2401, 1627, 1611, 1497,
-    1722, 1540, 1976, 1892, 1685, 2068, 1889, 1485, 1299, 832, 1434, 1143,
-    1216, 1147, 1479, 1217, 1106, 583, 962, 961, 1474, 1049, 627, 487,
-    486, -19, 165, 146, 414, 497, 60, 137, 73, 471, 88, 262,
-    325, 55, 454, -22, -558, -681, -1358, -1583, -1603, -1744, -1369, -1216,
-    -723, -774, -744, -660, -664, -1354, -1249, -1503, -1953, -2180, -2363, -2188,
-    -1880, -1440, -1252, -696, -974, -1618, -1434, -1494, -1762, -2181, -2131, -2092,
-    -1884, -2088, -2871, -2909, -2265, -2223, -2421, -1912, -1890, -1567, -1843, -2391,
-    -3017, -3280, -3201, -3374, -3154, -3088, -2947, -2738, -2763, -2460, -2533, -2375,
-    -2100, -2470, -2975, -3655, -3643, -3754, -4137, -4172, -4201, -3648, -3511, -3785,
-    -3750, -3776, -4061, -4150, -4404, -4199, -4692, -4840, -4738, -4587, -4767, -4232,
-    -3745, -4013, -4214, -4250, -4213, -4142, -3860, -3857, -3544, -3682, -4089, -3778,
-    -3936, -3772, -3306, -2917, -2986, -3119, -2620, -2575, -2681, -2648, -2976, -2631,
-    -2316, -2095, -2191, -2130, -2115, -1971, -2528, -2394, -2473, -1797, -1445, -1706,
-    -2371, -2578, -2647, -2566, -2470, -2243, -1865, -1445, -1378, -1551, -1773, -1749,
-    -1818, -1849, -1449, -826, -786, -1362, -1328, -1420, -1379, -1212, -1149, -1173,
-    -1094, -538, -349, -386, -942, -889, -319, -504, 8, -244, 21, -240,
-    -534, -357, -22, 216, 411, 368, 897, 1471, 1210, 956, 1082, 1114,
-    1206, 1163, 1261, 1192, 1066, 1257, 1060, 1090, 1275, 1353, 1627, 2188,
-    1810, 1595, 1682, 1725, 1784, 2029, 2514, 2542, 2737, 2592, 3055, 3784,
-    3431, 3952, 4391, 4364, 4128, 3761, 3432, 3172, 3038, 3250, 3018, 3281,
-    3522, 3648, 3719, 3698, 4036, 3773, 3246, 3215, 3288, 3216, 3171, 3359,
-    3342, 3894, 3799, 4005, 4284, 4212, 4181, 4047, 4164, 4204, 4072, 3835,
-    3630, 3715, 4042, 4080, 4232, 4290, 4188, 3981, 3862, 3898, 4039, 4182,
-    4231, 4085, 3589, 3531, 4057, 3703, 3975, 3820, 4182, 4313, 3936, 4315,
-    5109, 4485, 3984, 3527, 2983, 3257, 3259, 3443, 3865, 4013, 3947, 3614,
-    3331, 3432, 3191, 3205, 3516, 3136, 2730, 2381, 2246, 2429, 2578, 2575,
-    2991, 2984, 2894, 3384, 3440, 3175, 3011, 2728, 2588, 2496, 2413, 2381,
-    1603, 1210, 989, 766, 933, 1649, 1853, 2080, 2368, 2023, 1758, 1458,
-    1079, 949, 999, 1184, 1063, 588, 680, 314, 220, 213, 152, 10,
-    444, 455, 104, 148, -15, -112, 60, -164, -89, -268, -402, -298,
-    -633, -405, -730, -244, -63, -374, -380, -384, -435, -552, -534, -748,
-    -969, -1196, -1175, -1374, -1356, -1368, -1511, -1523, -2032, -2010, -1957, -2797,
-    -2593, -2793, -2719, -2971, -2960, -2401, -2574, -2717, -3020, -2780, -2455, -2341,
-    -2273, -2097, -2184, -2505, -2768, -2278, -2078, -1903, -2082, -2067, -2100, -2495,
-    -2625, -2867, -2482, -2287, -2515, -3138, -2727, -2768, -2930, -3126, -3317, -2910,
-    -2811, -2676, -2249, -2228, -2742, -2940, -2680, -2752, -2643, -2782, -2728, -2265,
-    -2503, -2476, -2395, -2731, -2944, -2915, -3327, -3400, -3553, -3744, -3910, -3617,
-    -3297, -3299, -3117, -3271, -2664, -2762, -2725, -2607, -2618, -2564, -2994, -3340,
-    -3262, -3026, -3194, -3621, -3286, -3734, -4034, -3712, -3694, -3995, -3823, -3744,
-    -3979, -3648, -3159, -3036, -3364, -3115, -3563, -3821, -3922, -3972, -3276, -3392,
-    -3089, -2765, -2332, -1990, -2237, -2442, -2320, -2314, -1752, -1611, -1623, -1412,
-    -1938, -1886, -1608, -1634, -1382, -1269, -1175, -1280, -1068, -1033, -1056, -1212,
-    -1739, -1667, -1666, -1450, -1138, -1071, -1269, -723, -1144, -1138, -1424, -1555,
-    -1048, -1142, -1416, -1215, -1293, -1562, -1040, -1093, -926, -734, -722, -696,
-    -1142, -1342, -1604, -1423, -1248, -811, -55, 225, 862, 1088, 1240, 1444,
-    1407, 1278, 884, 746, 591, 853, 196, 238, 108, 289, 153, 143,
-    553, 505, 542, 702, 1217, 1219, 1578, 1576, 1241, 1590, 1608, 1757,
-    1897, 2112, 2220, 2140, 1828, 1899, 1671, 1502, 1670, 1663, 1640, 1652,
-    1709, 1718, 1988, 2310, 2382, 2740, 2856, 2961, 3014, 2563, 2037, 1833,
-    1988, 2381, 2228, 2802, 3007, 2551, 2467, 2227, 2537, 2198, 2379, 2184,
-    2161, 2500, 2568, 2344, 2728, 2617, 2610, 2850, 2838, 2790, 2615, 2406,
-    2384, 2485, 2671, 3001, 2693, 2666, 2551, 2500, 2820, 3124, 3253, 3558,
-    3555, 3545, 3538, 3387, 3525, 3733, 3702, 3568, 3255, 3070, 3017, 2848,
-    2474, 2560, 2568, 1965, 2082, 1602, 1446, 1554, 1545, 1801, 2435, 2312,
-    2398, 2503, 2539, 2494, 2100, 1970, 1439, 1384, 1455, 1244, 1475, 1686,
-    1445, 1421, 1177, 898, 973, 1035, 1249, 1202, 1744, 1661, 2028, 2482,
-    2436, 2377, 2446, 2390, 2653, 2325, 2414, 2223, 2282, 2179, 2078, 1914,
-    1964, 1942, 1710, 1600, 1385, 1489, 1855, 1688, 1334, 1536, 1318, 910,
-    871, 863, 1093, 1286, 1600, 1418, 1259, 1322, 938, 635, 662, 546,
-    469, 565, 641, 582, 449, 71, 160, 449, 578, 630, 468, 339,
-    259, 220, 80, -56, -248, 108, 243, 404, 474, 552, 134, 83,
-    142, 1, -192, -1, 344, -71, -147, 3, 130, 250, -31, -147,
-    -297, -832, -811, -1051, -1347, -1273, -1144, -1374, -1225, -1224, -1121, -777,
-    -560, -435, -234, -86, -436, -352, -40, -92, -346, -122, -533, -148,
-    -114, -828, -1060, -776, -837, -1218, -1160, -1215, -1409, -1252, -1206, -1137,
-    -1102, -1287, -1065, -1394, -1284, -1371, -1902, -1907, -1741, -1934, -1809, -1811,
-    -1572, -1750, -1950, -1964, -2256, -2174, -2657, -2547, -2439, -2627, -2520, -2257,
-    -2130, -2037, -1804, -1958, -2295, -2556, -2413, -2349, -2199, -2691, -2719, -2770,
-    -2684, -2963, -2778, -2793, -3051, -3032, -2801, -2796, -2611, -2594, -2537, -2672,
-    -3017, -2834, -3080, -3051, -3187, -3468, -3088, -2806, -3404, -3317, -3427, -3466,
-    -3285, -2980, -2513, -2740, -2799, -2643, -2650, -2630, -2576, -2886, -2565, -2543,
-    -2409, -2362, -2795, -2466, -2417, -2640, -2585, -2737, -2927, -3080, -3213, -3655,
-    -4029, -3496, -3339, -3200, -3007, -2688, -2419, -2476, -2586, -2253, -2394, -2810,
-    -2565, -2878, -3325, -3248, -3129, -3153, -3164, -3418, -3286, -2975, -2224, -2202,
-    -2262, -1695, -1285, -1343, -1644, -1369, -1089, -1077, -746, -323, -197, -202,
-    -169, -117, -412, -1329, -1197, -1536, -1410, -1105, -1229, -1210, -946, -913,
-    -735, -462, -394, -485, -449, -265, -737, -978, -732, -1188, -1191, -788,
-    -778, -417, -374, -791, -251, 47, -86, -73, 231, 73, -73, 145,
-    349, 693, 956, 1373, 1299, 1190, 1718, 1696, 1628, 1411, 1392, 1636,
-    2095, 1743, 1492, 1656, 1223, 1190, 1560, 1389, 1842, 2075, 1825, 2081,
-    1867, 1560, 1679, 1680, 1808, 1661, 1847, 2029, 2035, 1869, 2114, 1282,
-    1084, 1091, 1116, 988, 851, 909, 1398, 1697, 1891, 2167, 2448, 2236,
-    2593, 3049, 2754, 3073, 2722, 2712, 2628, 2829, 3160, 2757, 2295, 2380,
-    2478, 2374, 2641, 2896, 3025, 2897, 2655, 3109, 3399, 3423, 3533, 3394,
-    3491, 3376, 3503, 3799, 3343, 3524, 3454, 3200, 3085, 2966, 2366, 2292,
-    2361, 2661, 2649, 3359, 3132, 3312, 3422, 3165, 3206, 3200, 3305, 3540,
-    3772, 3382, 3458, 3402, 3124, 3148, 2522, 2343, 2324, 2378, 2518, 2444,
-    2700, 2619, 2654, 2456, 2854, 2637, 2806, 3153, 3146, 2921, 2980, 3084,
-    2709, 2955, 2582, 2754, 2573, 2052, 2035, 2068, 2365, 2370, 2431, 2291,
-    2221, 2343, 3006, 2896, 2443, 2561, 2189, 1890, 2283, 2137, 2611, 2387,
-    2186, 2654, 2156, 1891, 1709, 1383, 1196, 1145, 539, 222, 372, 317,
-    352, 733, 864, 906, 659, 732, 813, 955, 513, 714, 292, 105,
-    -75, -654, -581, -375, -642, -549, -514, -343, -101, -529, -244, -78,
-    38, 269, 501, 751, 426, 443, 540, 686, 786, 1005, 376, 500,
-    249, -596, -683, -869, -995, -1270, -1119, -794, -937, -324, -412, -461,
-    -287, -444, -862, -918, -1150, -679, -990, -1585, -1677, -1423, -1510, -1614,
-    -1234, -1388, -1261, -1198, -1309, -1325, -1271, -888, -1391, -1492, -1383, -1085,
-    -1123, -1150, -864, -1028, -1042, -1238, -1570, -2024, -2254, -2416, -2265, -2024,
-    -1590, -1459, -1650, -1874, -1852, -1698, -1095, -953, -828, -1826, -1785, -1268,
-    -1741, -1580, -1771, -1774, -2760, -3086, -2639, -2226, -1862, -1773, -2425, -2026,
-    -1614, -2183, -3151, -3957, -4543, -4371, -4015, -3149, -2318, -2265, -1834, -2059,
-    -1122, -1123, -2028, -2927, -2336, -1737, -1631, -770, -643, -1616, -2315, -2883,
-    -3305, -3566, -3487, -3506, -3332, -3243, -1674, -1475, -1802, -2419, -2765, -2775,
-    -2098, -2374, -1851, -1412, -1324, -1105, -1231, -933, -770, -1049, -1358, -1321,
-    -1376, -1527, -947, -1322, -2586, -2520, -1995, -1655, -1090, -1170, -1854, -2743,
-    -3120, -2928, -2972, -3101, -3105, -2635, -2762, -2651, -2814, -2258, -1837, -1098,
-    -1211, -1598, 97, 733, -415, -1295, -1451, -1308, -1543, -1090, -835, 99,
-    -239, -858, -600, -42, -324, -653, -947, -1110, -1007, -858, -1530, -1080,
-    -892, -2529, -2615, -2194, -1622, -1307, -892, -862, -1114, -1543, -2203, -2538,
-    -2223, -2127, -2059, -2019, -2240, -2618, -2428, -2450, -1957, -1098, -884, -759,
-    33, 330, 451, -101, -877, -1253, -1144, -875, -523, -149, 260, 1136,
-    1291, 908, 1169, 662, 577, 756, 877, 74, -259, 361, 457, -376,
-    -713, -206, 409, 949, 1030, 333, -277, -380, -492, -553, -1140, -1016,
-    -1151, -1160, -591, -691, -383, -320, 203, 117, 345, 1033, 1843, 1762,
-    1072, 638, 360, 370, 731, 1021, 1323, 1208, 1687, 2177, 2021, 1161,
-    1066, 1401, 1071, 859, 1057, 1049, 833, 829, 1236, 670, 605, 857,
-    919, 1108, 1512, 1230, 542, -79, -362, -203, 818, 902, 887, 884,
-    672, 990, 1230, 1319, 1883, 1994, 2293, 2579, 2340, 1708, 2349, 2131,
-    1940, 1570, 1843, 2103, 2616, 2218, 2543, 2780, 3320, 3158, 2649, 2266,
-    1792, 2027, 1160, 998, 1261, 1444, 906, 759, 878, 506, 1062, 1463,
-    1429, 658, 587, 325, 690, 814, 525, -7, 433, 931, 950, 686,
-    1352, 2211, 2283, 1815, 3187, 3497, 2443, 2590, 2214, 995, 1555, 2760,
-    3484, 3634, 4644, 4477, 3513, 3260, 2071, 1436, 1747, 1886, 1275, 1788,
-    2099, 1679, 2265, 2778, 3242, 3712, 2622, 1831, 1101, 1095, 1884, 1762,
-    1563, 1676, 1426, 849, 389, 199, 201, 19, 54, -122, -298, 1358,
-    1902, 1931, 1722, 1052, 1488, 2488, 2781, 3009, 3195, 3291, 2866, 2591,
-    2716, 2504, 2443, 2546, 2034, 2477, 2353, 2208, 2501, 864, 786, 483,
-    362, 765, 438, 236, -84, -979, -1062, -1307, -1176, -796, -983, -169,
-    453, -266, -233, -480, -425, 22, -623, -84, 1442, 1904, 1303, 780,
-    -195, 151, 866, 1246, 1019, 1580, 1829, 1813, 1664, 942, 892, 1193,
-    833, 557, -133, -239, 713, 1054, -103, -1235, -1186, -720, 343, 535,
-    476, -241, -600, -1735, -2383, -2275, -1873, -2178, -2117, -1957, -2056, -2236,
-    -2277, -2021, -945, -1011, -1373, -946, -761, -18, -42, -1786, -2373, -1771,
-    -1087, -738, -69, 319, -118, -236, -292, -276, -567, -659, -1282, -1136,
-    -1422, -1747, -1640, -1463, -2370, -2455, -2487, -1539, -1241, -646, -1160, -1516,
-    -2183, -2344, -2697, -2725, -2941, -2508, -2182, -1973, -2117, -2163, -1875, -1551,
-    -1502, -678, -853, -185, 216, -216, 86, -853, -1574, -1386, -1000, -454,
-    560, 334, -463, -299, -285, -431, -708, -1483, -1264, -1512, -1735, -1578,
-    -2038, -3419, -3460, -3350, -3159, -3089, -2724, -2310, -3003, -3335, -3369, -3589,
-    -3643, -3879, -3856, -2976, -2251, -2714, -3003, -2928, -2043, -1260, -1220, -1015,
-    -895, -568, 740, 1164, 441, -41, 279, -222, 116, 292, -390, -606,
-    -215, -440, -833, -740, -328, -1078, -818, -1459, -2102, -1679, -1782, -2903,
-    -3209, -2604, -2661, -2596, -1559, -2694, -3377, -3354, -3306, -3608, -4094, -4011,
-    -3784, -3367, -3232, -2887, -3297, -2662, -1601, -1551, -2132, -1066, -882, -472,
-    -435, -1631, -2507, -1871, -371, 730, 931, 2240, 2542, 1760, 291, -889,
-    -1282, -1836, -1815, -1411, -1120, -775, -368, 523, 120, 295, 113, -1639,
-    -3077, -3036, -2556, -1814, -1009, -897, -1326, -977, -1442, -2263, -2421, -2935,
-    -3461, -3187, -3089, -3533, -2301, -1133, -1106, -928, -451, -557, -427, -237,
-    -341, -97, 865, 1321, 1534, 1038, 1098, 992, 1311, 907, 789, 335,
-    1047, 1098, -195, -1658, -762, 91, 459, 38, -68, 426, 118, 107,
-    -342, -611, -264, 135, -863, -1286, -698, -285, -418, 199, 1140, 1133,
-    1566, 2264, 2645, 2701, 2426, 2109, 1785, 1716, 2554, 3029, 3156, 3614,
-    3243, 2920, 2913, 2545, 2266, 2229, 2475, 2023, 1114, 636, 535, -124,
-    -709, -184, 541, 1016, 1145, 798, 1114, 804, 126, -218, -222, -287,
-    -60, 134, 279, 822, 899, 777, 1103, 1205, 1424, 1517, 2082, 2987,
-    3786, 3585, 3124, 2494, 2174, 2213, 2588, 2672, 2449, 2554, 3574, 3545,
-    3448, 3422, 2690, 1979, 1504, 1783, 1566, 843, 1210, 1629, 785, 198,
-    238, 250, 589, 1090, 876, 660, 309, -101, -388, -75, 108, 409,
-    546, 468, 690, 1601, 1532, 1762, 1670, 1935, 2510, 2899, 2874, 2700,
-    2231, 2282, 2222, 2806, 2967, 3331, 3577, 3555, 2587, 2350, 2287, 1518,
-    1384, 1403, 1009, 515, -298, -135, 187, -317, -266, -295, -543, -664,
-    -529, 176, 411, 334, 250, 188, -173, -824, -709, -713, -657, -30,
-    700, 989, 1032, 1243, 1679, 2028, 1906, 2521, 2237, 2175, 2374, 2370,
-    2926, 2731, 3033, 3486, 3417, 3870, 3605, 2976, 2706, 2495, 2283, 2059,
-    1736, 1198, 871, 602, 280, -378, -958, -967, -1061, -923, 87, 468,
-    -25, -931, -1239, -1355, -1518, -1798, -1854, -1803, -1295, -1116, -1099, -1027,
-    -659, -837, -93, 1089, 1038, 1096, 849, -566, -314, 1300, 2571, 2484,
-    2814, 2986, 2800, 1940, 1472, 750, 764, 646, 675, 96, 409, 820,
-    1445, 1061, 328, 577, 813, -217, -485, -115, 231, 331, 170, -439,
-    -705, -1114, -1813, -2149, -2975, -2686, -2511, -2059, -2771, -2824, -1714, -1406,
-    -1757, -1796, -1803, -1062, -1446, -620, -412, 108, 42, -171, 288, 273,
-    -605, -843, -815, -950, -1354, -1573, -999, -1800, -2776, -2953, -2588, -1852,
-    -1441, -1823, -1771, -1758, -1663, -1883, -2154, -2308, -2529, -2223, -2317, -1912,
-    -754, -1065, -558, -457, 11, -440, 269, 1306, 1240, 706, 219, 157,
-    -323, -254, 404, 927, 401, -25, 253, -43, -1074, -1108, -728, -1388,
-    -1552, -1852, -2354, -2919, -2781, -3426, -4206, -4134, -3766, -3217, -3176, -3012,
-    -3183, -2746, -2769, -3404, -4366, -4324, -4170, -3672, -3134, -3076, -2714, -1955,
-    -1646, -924, -549, -748, -603, 397, 521, 389, 157, 222, -100, 44,
-    601, 849, 704, 752, 1281, 1384, 1005, 876, 605, -17, -465, -975,
-    -1909, -2407, -1980, -2338, -2377, -2563, -2281, -1789, -1729, -1459, -1557, -1576,
-    -2654, -2535, -1935, -2191, -2480, -2774, -3073, -2862, -2631, -1905, -1210, -1080,
-    -922, -613, 124, 875, 324, -32, 123, 60, -487, -58, 289, 936,
-    1045, 450, 520, 702, 1000, 1168, 391, 316, -151, -1212, -1686, -1779,
-    -1392, -1558, -2334, -2094, -1691, -1747, -1690, -1401, -1738, -2368, -2478, -2848,
-    -2958, -2561, -1974, -1685, -1584, -2135, -2221, -1826, -1463, -1090, -653, -123,
-    135, 996, 986, 585, 1085, 1420, 1272, 1368, 1424, 1527, 978, 788,
-    654, 615, 760, 903, 484, 752, 487, 238, -158, -997, -1922, -1985,
-    -1319, -1614, -1182, -1045, -1113, -1080, -1404, -1778, -2498, -2031, -2301, -2391,
-    -2123, -2087, -2233, -2236, -1732, -972, -523, -575, 515, 1116, 1281, 1698,
-    223, -537, 210, 1495, 2044, 2741, 3204, 3054, 2289, 2208, 1771, 780,
-    -87, -172, 60, 560, 775, 1339, 1128, 1423, 1553, 1781, 1070, 596,
-    583, 1001, 1017, 1451, 1230, 994, 658, 346, 139, 211, 202, 456,
-    492, 221, 809, 1118, 1318, 1989, 1866, 1039, 1115, 1874, 1898, 1846,
-    2382, 2728, 2838, 2970, 3180, 3637, 3337, 2904, 2122, 1823, 1633, 1295,
-    884, 807, 347, 462, 1151, 1350, 1118, 865, 637, 671, 610, 428,
-    316, 779, 592, 526, 760, 1047, 1429, 2294, 2195, 2078, 2170, 2067,
-    2605, 2615, 2529, 3065, 2969, 3632, 3706, 3846, 3535, 3509, 4071, 3716,
-    2982, 3088, 2648, 2420, 2240, 1847, 1316, 1209, 623, 1022, 1011, 656,
-    370, 196, -32, 20, 746, 682, 158, 698, 578, 1, 1, -186,
-    49, 58, -208, 178, 304, 750, 867, 948, 1258, 955, 772, 725,
-    890, 1157, 1134, 1352, 1249, 1384, 1391, 1366, 1214, 1672, 1409, 1087,
-    865, 1041, 1017, 1106, 908, 598, 429, 630, 364, 694, 683, 363,
-    269, 768, 936, 1337, 1473, 880, 808, 357, -119, 156, 302, -133,
-    -465, -576, -127, 78, 108, 282, 346, 459, 358, 50, -49, 98,
-    -43, -817, -711, -36, 490, 128, -102, -278, -209, -295, -229, -41,
-    -102, -760, -663, -442, -1105, -1072, -436, -147, -250, 165, -263, -912,
-    -1244, -947, -649, -858, -780, -606, -811, -909, -568, -216, -201, -264,
-    -157, -546, -920, -545, -421, -359, -265, -532, -634, -595, -747, -625,
-    -831, -730, -910, -1186, -1627, -1731, -1185, -924, -900, -1071, -1346, -1047,
-    -1156, -1120, -1041, -1122, -1014, -1206, -1176, -1199, -1328, -1520, -598, -224,
-    -45, -542, -1095, -997, -898, -1337, -669, -162, -271, -653, -750, -189,
-    -192, 396, 571, 612, 392, 100, -543, -1281, -1144, -772, -979, -687,
-    -461, -478, -574, -541, -657, -707, -988, -1276, -927, -732, -340, -418,
-    -42, -145, -342, -429, -768, -1046, -986, -224, -242, 77, -107, -76,
-    -119, 14, 226, 803, 510, 246, 60, -445, -567, -227, 301, 188,
-    -130, -272, -305, -562, -929, -971, -1053, -946, -1291, -1226, -682, -683,
-    -959, -1071, -1133, -955, -1148, -1398, -1489, -1434, -1111, -1348, -1002, -828,
-    -1105, -1397, -1434, -1540, -1239, -974, -1052, -1398, -1270, -646, -800, -1171,
-    -235, 70, -616, -824, -429, -757, -800, -485, -215, -479, -546, -564,
-    -676, -598, -950, -926, -798, -886, -1447, -1251, -977, -1152, -743, -1268,
-    -1551, -1442, -1535, -2017, -1798, -1410, -1069, -1352, -2225, -2249, -2216, -2055,
-    -1473, -1630, -1562, -1447, -1884, -2136, -1804, -1532, -1188, -848, -997, -922,
-    -1176, -1437, -1043, -412, -701, -1078, -776, -891, -575, -781, -1376, -1588,
-    -1642, -1572, -1368, -1328, -681, -505, -409, 22, 213, -101, -175, -255,
-    -498, -834, -969, -519, -245, -642, -708, -589, -146, -40, -338, -736,
-    -569, -430, -319, -182, 63, -93, -142, -196, 152, -248, -353, -73,
-    -115, -33, -329, -327, -388, -580, -212, -597, -817, -328, -304, -199,
-    156, 215, 46, -50, 19, -255, -356, -24, 353, 107, -196, -126,
-    47, 268, 818, 954, 1182, 1506, 925, 658, 706, 555, 810, 1168,
-    1486, 1322, 1169, 1350, 1074, 1289, 1234, 840, 1156, 816, 401, 907,
-    1366, 1893, 1401, 1160, 1276, 1221, 695, 723, 947, 884, 523, 885,
-    1071, 673, 426, 327, 107, -99, 22, -135, -11, 563, 752, 637,
-    677, 667, 658, 272, 156, 431, 414, 473, 664, 1053, 1204, 1320,
-    1434, 1060, 1511, 1921, 1606, 1282, 1466, 1312, 1293, 1507, 1640, 1345,
-    962, 721, 618, 1299, 1856, 1806, 1793, 1729, 1459, 1204, 1345, 1075,
-    819, 600, 267, 657, 975, 1192, 1286, 1431, 1491, 1344, 1109, 1194,
-    881, 423, 370, 584, 931, 798, 1118, 1388, 1257, 1214, 1263, 999,
-    549, 622, 640, 429, 540, 837, 884, 1067, 584, 903, 1056, 963,
-    739, 1159, 1307, 1347, 1052, 1158, 996, 782, 404, 106, 386, 362,
-    113, 631, 733, 942, 1692, 1741, 1652, 1287, 799, 392, 353, 524,
-    763, 987, 1204, 1329, 1890, 1965, 1768, 1476, 1203, 822, 568, 872,
-    952, 1113, 1085, 1262, 1178, 1177, 1293, 924, 447, 403, 523, 487,
-    368, 95, 321, 168, 225, 325, 396, 411, 185, 403, 170, 121,
-    -152, 173, 405, 120, 6, -179, -324, 25, 459, 427, 44, 114,
-    414, 400, 447, 909, 493, 43, -8, -191, -310, -315, -400, -39,
-    276, 163, -230, -403, -617, -341, -159, -125, 66, -317, -464, -209,
-    -334, -275, -73, -93, -322, -414, -360, -284, -234, -705, -529, -59,
-    198, 135, 96, 277, 82, 131, 332, 155, -161, -303, -83, -136,
-    -286, -653, -934, -1224, -1404, -1408, -968, -968, -819, -629, -568, -879,
-    -1273, -1298, -1178, -1097, -822, -940, -925, -1059, -1141, -1158, -1139, -1231,
-    -1664, -1743, -1341, -1246, -1371, -1526, -1573, -913, -993, -1269, -1457, -1377,
-    -1256, -1144, -887, -789, -955, -709, -643, -914, -623, -601, -832, -1019,
-    -1235, -1042, -646, -1105, -911, -1241, -1098, -1213, -1131, -940, -1011, -1072,
-    -1170, -1207, -1198, -1089, -1073, -1166, -1466, -1643, -2090, -1947, -2184, -2091,
-    -1864, -1605, -1413, -1217, -972, -937, -1094, -1318, -1309, -1407, -1201, -1047,
-    -905, -874, -839, -300, 35, -106, 35, -8, 14, 214, -67, -93,
-    -366, -397, -725, -568, -452, -596, -471, -137, 101, 276, 313, 390,
-    609, 353, 119, -209, -400, -363, -847, -442, -309, -258, -441, -124,
-    51, -113, 71, 260, 135, -66, 41, 120, 279, 237, 509, 793,
-    752, 562, 381, 468, 298, 66, 12, -325, -552, -362, -17, -324,
-    -6, 200, 382, 328, -219, -418, -45, -54, 210, -9, -106, -429,
-    -646, -631, -499, -341, 116, 110, -128, -5, -56, -20, 39, 130,
-    -171, -98, -210, -350, -15, -27, 217, 675, 776, 522, 604, 487,
-    104, 291, 383, 225, -89, -157, 31, 149, 36, 210, 381, 385,
-    424, 145, 202, -34, -332, -13, -110, -373, -552, -528, -724, -534,
-    -469, -159, -266, -213, -305, -377, -870, -848, -656, -1051, -967, -517,
-    -229, -160, 153, 338, 370, 145, 10, 3, 27, 9, -63, -311,
-    -362, -489, -168, -258, -242, 3, -387, -265, -267, -144, -357, -650,
-    -823, -644, -339, -170, -275, -645, -537, -168, -3, 45, 20, -314,
-    -530, -358, -529, -538, -344, -250, -361, -139, -135, -210, -152, -30,
-    373, 251, -208, -305, -533, -502, -317, -207, 141, 143, -319, 2,
-    116, 327, -211, -56, 293, 201, 137, 15, -133, -7, 344, 359,
-    155, -429, 21, 105, 31, 59, 22, 6, 93, 250, 227, -177,
-    219, 663, 773, 464, 317, 562, 682, 693, 875, 613, 971, 919,
-    609, 625, 867, 802, 793, 1047, 799, 334, 765, 1090, 908, 1033,
-    932, 812, 962, 1186, 1016, 948, 1161, 970, 903, 1076, 754, 256,
-    64, 535, 605, 754, 510, 296, 413, 571, 359, 44, 296, 611,
-    1115, 764, 758, 810, 1001, 1097, 881, 515, 795, 945, 625, 645,
-    541, 534, 1123, 892, 439, 565, 904, 344, 731, 1081, 661, 580,
-    803, 736, 483, 407, 680, 714, 554, 174, -95, 177, 85, -220,
-    187, 376, 372, 404, 513, 603, 620, 548, 1126, 880, 799, 711,
-    622, 843, 991, 1010, 601, 452, 745, 691, 174, 622, 778, 806,
-    271, 376, 320, 17, 240, 596, 526, 165, 307, 679, 346, 149,
-    700, 142, -265, -77, -355, -601, 163, -167, -363, 54, -234, 98,
-    24, 210, -23, 203, -119, 597, 323, 401, 137, 237, 77, 140,
-    197, 407, 720, 600, 554, 590, 632, 702, 796, 590, 286, 462,
-    83, -442, 68, 329, 46, 13, 362, 70, -96, 35, 625, 213,
-    -216, 113, -468, -86, -182, -608, -611, 113, -1068, -1464, -758, -1024,
-    -943, -400, -795, -218, 99, 351, -397, -575, 7, 359, -509, -801,
-    400, -621, -484, 252, -352, -645, -537, 449, 680, -823, -487, 309,
-    140, -30, -1082, 348, 274, -429, -953, -61, -919, -1428, -754, -72,
-    -1066, -782, -315, 81, -763, -176, 103, 262, -248, -463, -813, -304,
-    125, -20, -467, -615, -315, 385, -487, -886, 388, -538, -873, -309,
-    -57, -783, -866, -305, -971, -457, -419, -939, -852, -289, -701, -312,
-    -324, -55, -339, -838, -739, -1254, -2011, -983, -779, -1949, -1362, -522,
-    166, -486, -169, -723, -87, -247, -2219, -797, 92, -625, -1244, -837,
-    -940, -1490, 404, -237, -1767, -1309, -546, -1652, -1771, -2441, -1538, -1097,
-    -1441, -1390, -1783, -982, -238, -326, -419, -795, -268, -765, -727, 1336,
-    343, 95, 157, 614, 217, 455, 448, 912, 747, 236, -968, 411,
-    -758, -599, -638, 166, -1939, -1282, -178, -1263, -1539, -2045, -819, -1807,
-    -1528, -1926, -2239, -1720, -1376, -153, -1617, -681, -286, -847, -250, 624,
-    -904, 226, -276, -11, -205, 1378, 2032, 1312, 1292, 542, -976, 146,
-    1996, 2312, 1174, 2497, 983, 2617, 2906, 1799, 885, -36, -1973, -2239,
-    -1163, 110, 431, 142, 893, -714, 460, 1834, -27, 1529, 2527, 2941,
-    2126, 2881, 1149, 1139, 1376, 1274, -193, -1269, -657, -2129, -1511, -351,
-    2789, 2685, 2163, 312, 604, 1797, 1007, -636, -484, 1007, 2395, 2461,
-    2082, 2199, 2047, 2905, 3429, 1610, 468, 1068, 2310, -574, -812, -620,
-    -469, 44, 1034, 1168, 231, 828, 704, 666, 269, -544, -498, -870,
-    1846, 1094, 1270, 2284, 1189, 1323, 1952, 1686, 2518, 3132, 2174, 1156,
-    1448, 756, 7, 949, 1363, 559, 2343, 1646, 1191, 155, 778, 613,
-    -459, -805, -1489, -1735, -1804, -1959, -1838, -2529, -3469, -3156, -1466, -213,
-    -973, -2948, -862, -1395, -1355, -1436, -1483, -2431, -2173, -3549, -2335, -1819,
-    -511, -1679, -1145, 1020, -314, -1371, 1248, 1759, -559, -120, -1287, -1298,
-    -67, -68, 750, -23, 964, 57, 1244, 1161, 1002, -88, -236, -128,
-    -1276, -982, -2391, -3113, -3025, -2010, -2884, -2598, -2720, -2135, -1744, -608,
-    -803, -1437, -1355, -3225, -3647, -3864, -4209, -2307, -922, -670, -1146, -1842,
-    131, 250, -1966, -766, 1334, 1424, -113, 280, -510, -235, 155, -642,
-    -375, -792, -553, 416, 1732, 889, 542, 1092, -10, -195, 474, -1254,
-    -1562, -43, -1161, -1864, -1116, -602, -2843, -2302, -690, -2102, -2757, -2102,
-    -2727, -2025, -2575, -3537, -1189, -1216, -2542, -2219, -535, -1587, -1961, -573,
-    196, -476, 1415, 2337, 2025, 757, -189, 1042, 1639, 2858, 2651, 1305,
-    2854, 3496, 2557, 2724, 3379, 2293, 2467, 2263, 502, 636, 1268, 364,
-    443, -510, 682, 225, 611, 1882, -926, -1619, 498, 119, -1666, -198,
-    415, 1211, -279, -418, 506, 1038, 198, 6, -242, 3166, 3953, 4666,
-    2667, 1670, 1518, 154, 549, 2009, 2020, 3312, 4439, 4309, 4470, 3246,
-    2384, 2478, 879, 1448, 917, 704, 2268, 1381, 1020, 2916, 2093, 1214,
-    252, 168, 2005, 1922, 1470, 2132, 1351, -1293, -793, 517, 862, -886,
-    -968, -494, 428, 460, -15, 2001, 1258, 1249, 2394, -58, -344, 918,
-    1554, 758, 1329, 1498, 3006, 1948, 1043, 1308, 1968, 2101, 507, 558,
-    895, 852, 807, 144, -1492, -1539, -924, 173, 590, 52, -2015, -1965,
-    -824, -48, -120, -289, -285, 1377, -122, -1169, -608, 715, 1758, 1370,
-    1138, 1226, 1942, 2468, 2893, 1908, 898, 1327, 799, 348, -160, 1578,
-    1236, -440, -861, 1754, 824, -1291, -1627, -393, -1120, -2275, -1586, -1610,
-    -2045, -3182, -2213, -1138, -1769, -2308, -1756, -1987, -1705, -1490, -2255, -3394,
-    -2765, -3103, -2112, -2096, -1735, -2019, -1115, -1857, -919, -51, 16, -347,
-    1744, 2979, 263, -1469, 47, -510, -1026, -267, -443, 879, 1580, 1480,
-    2075, -232, 969, 541, -983, -1286, -624, -3588, -3358, -2227, -2295, -2790,
-    -3180, -1442, -1657, -1856, -2716, -2695, -2060, -1740, -3913, -4971, -2423, -2111,
-    -2572, -832, -1707, -2607, -2371, -1769, -2176, -964, -1223, -884, 1250, 986,
-    -62, -2017, -817, -1629, 50, 603, -363, 781, 1608, -389, -183, 1966,
-    285, -1439, -1739, -698, -572, -1509, 188, -623, -986, -2898, -3604, -2399,
-    -1072, -1989, -1405, -3009, -3552, -2348, -3126, -2796, -3981, -1972, -2228, -2481,
-    -2991, -944, -701, -1798, -270, 482, -394, 362, 598, 1231, 2864, 2321,
-    1097, 12, 1864, 1638, 1710, 2111, 2036, 503, 2894, 1463, 1223, 1636,
-    1004, 527, 1489, 1310, -1065, -674, 550, -261, 105, 792, 1072, -469,
-    -759, -1586, -2558, -2209, -1448, -329, -2154, -928, 266, -1283, 104, 167,
-    -86, 877, 424, 1232, 2573, 1640, -17, -514, 815, 338, 1915, 1884,
-    2417, 3132, 3272, 3071, 2792, 1670, -130, -1756, -1192, 939, 68, 1414,
-    2725, 1976, 1787, 390, 2372, 1087, -403, -764, 1279, 1207, 1327, 1106,
-    1441, 1105, -414, -273, 1382, 383, -622, -852, -581, -1230, 1911, 3046,
-    890, 182, 825, 1248, 1238, 1260, 1706, 1771, 2370, 2422, 2168, 2046,
-    2476, 1847, 460, 1961, 1380, -953, -394, 2422, 226, -1619, 222, 855,
-    547, 1690, 2004, 695, 352, -269, 896, -656, -1146, -1001, 101, 379,
-    1469, 660, 886, 1069, 2010, 1809, 1546, 2257, 3701, 4532, 2329, 1314,
-    1434, 1155, 2290, 2394, 1628, 967, 3394, 2536, 1489, 1434, 289, -1423,
-    -483, 135, -1326, -2171, -1938, -1074, -2199, -3250, -2533, -1771, -2065, -1996,
-    -1363, -2972, -3203, -3134, -2887, -2632, -1969, -1840, -2054, -3063, -1726, -1552,
-    -899, -963, 51, 1119, 836, 1244, 845, 1219, 1832, 477, -1814, -1090,
-    606, 1685, 1381, 383, 1319, 2217, 1392, 530, -589, -502, -649, 673,
-    250, -1927, -1481, -1394, -1742, -1087, -939, -3067, -1657, -665, -604, -1398,
-    -1900, -2790, -3032, -3043, -2272, -2625, -3042, -1929, -1524, 1, -240, -67,
-    -559, -618, 665, 2224, 1523, 1423, -300, 616, 596, -303, -447, 1112,
-    1908, 871, 1273, 285, 473, 1903, -452, -118, 232, -432, -452, -152,
-    -836, -1411, -1246, -1640, -2496, -2132, -2284, -1889, -1964, -1395, -1167, -2278,
-    -2713, -1323, -1687, -1083, -480, -1959, -2223, -1473, 164, 43, 1823, 1350,
-    -289, 1569, 1323, 447, 1051, 1269, 1745, 2127, 2417, 3354, 2791, 3229,
-    3142, 3237, 3319, 1911, 1833, 3103, 2970, 1657, 1457, 1376, 217, -127,
-    408, -405, 858, 1323, 1361, 1375, 939, 742, -58, -383, 448, -648,
-    -2094, -1784, 190, 801, 851, 568, 1427, 984, 1334, 2938, 2946, 1329,
-    1530, 1764, 828, 837, 1907, 2110, 3544, 4512, 2671, 2773, 1349, 532,
-    906, 1581, 1231, 1393, 83, 1340, 1777, 864, 1949, 461, 296, 1233,
-    885, 270, 553, 867, 943, 1011, 1035, 605, -976, -943, -1450, -971,
-    -529, 51, -989, -571, 1549, 2053, 1324, 449, -108, -397, -118, 59,
-    611, 1161, 2370, 2416, 1705, 1177, 1069, 694, 144, 1347, 790, -1297,
-    -357, -405, -1015, -1183, -552, -684, -370, -1057, -1114, -263, -1434, -1273,
-    -1479, -1886, -1500, -1227, -1905, -1161, 205, -747, -888, 918, 439, 635,
-    1348, 1261, 1049, 1271, 1181, 403, 923, -421, 66, 357, 1402, 1765,
-    1475, 439, 693, 312, -1424, -1015, -394, -1189, -1289, -1578, -1201, -3069,
-    -3889, -3585, -4341, -3089, -1534, -1888, -2850, -3646, -3810, -3630, -3637, -3843,
-    -4121, -4132, -2927, -2862, -2887, -2784, -1933, -1317, -1006, -173, 273, 1133,
-    1008, -209, -863, -669, -478, -526, -686, -417, 153, 77, 130, 316,
-    358, -226, -339, -1982, -2734, -1882, -2930, -2412, -2104, -2317, -3518, -4106,
-    -3886, -1953, -1885, -1092, -1547, -1972, -2094, -1858, -1973, -2059, -2300, -3027,
-    -2976, -2307, -1586, -729, 45, -536, 1006, 428, -119, 692, 1046, 297,
-    -370, -667, -350, 109, -203, 718, 2043, 1455, 1258, 1117, 789, 891,
-    633, -88, -481, -1653, -1476, -953, -1878, -1162, -2285, -2618, -2580, -1889,
-    -1072, -1009, -1891, -2431, -2526, -1953, -1995, -2372, -1457, -1988, -1635, -431,
-    349, -22, 1527, 1886, 1822, 1041, 1576, 2785, 2736, 3183, 2291, 1468,
-    2632, 2931, 2381, 3800, 4400, 3558, 3016, 2897, 2809, 2613, 2900, 3065,
-    2711, 2103, 2096, 1444, 235, 686, 947, 967, 2205, 1790, 1702, 1703,
-    133, 122, 496, 96, -220, -290, 490, 281, 318, 857, 1506, 2485,
-    2853, 1629, 2545, 3585, 2722, 2903, 3036, 1656, 684, 1367, 3618, 4084,
-    4810, 5660, 4823, 3353, 2288, 1897, 1107, 804, 1241, 1576, 1214, 1547,
-    1281, 1670, 1520, 1139, 1532, 1061, 761, 622, 806, 1459, 1320, 329,
-    99, 402, 358, -517, -467, 258, -199, 76, 294, 1052, 1531, 1615,
-    1535, 253, 402, 1010, 709, 1565, 1860, 1840, 2974, 3577, 2012, 2153,
-    2362, 2044, 2124, 1185, 152, 0, 363, -435, 445, 879, -209, 480,
-    1111, 1000, 983, 24, -264, 226, -924, -390, -1216, -1737, -12, -378,
-    -1404, 315, 426, 290, 898, 2084, 1063, 513, 386, 959, 455, 906,
-    923, 593, 749, 1195, 1252, 676, 1423, 62, -704, -162, -1267, -2677,
-    -1841, -2023, -2507, -2163, -3192, -2823, -2198, -1968, -1702, -1619, -3270, -2525,
-    -2804, -3117, -2908, -2950, -2554, -2211, -2898, -2066, -2316, -2473, -2274, -1522,
-    -1755, -1349, -1760, -1136, -897, -1812, -2165, -1563, -1045, -1184, -1989, -1618,
-    -1557, -2260, -1903, -1516, -576, -774, -1498, -1828, -1696, -1758, -1709, -2333,
-    -2695, -2107, -1575, -1221, -1114, -307, -907, -2506, -1851, -1473, -1913, -1285,
-    -1672, -1954, -1930, -2042, -2616, -2318, -1288, -1529, -1728, -1244, -1078, -884,
-    -1479, -1494, -1336, -1583, -1690, -1727, -1999, -1263, -769, -757, -108, -433,
-    -1158, -626, -1053, -859, -1236, -1615, -1452, -1717, -1589, -1682, -1129, -942,
-    -850, -999, -878, -817, -1770, -1806, -1508, -2159, -1666, -1757, -2198, -1626,
-    -1015, -1221, -650, -1109, -1080, -907, -251, -123, -365, -758, -599, -1186,
-    -800, -648, -148, 138, 817, 1084, 187, 603, 1060, 1084, 983, 563,
-    -184, 352, 3, 881, 1330, 1249, 2291, 2363, 1934, 1704, 2474, 2047,
-    1939, 1661, 1718, 1422, 1567, 1851, 1564, 1124, 1177, 1151, 1493, 1666,
-    1243, 1168, 726, 550, -9, 630, 1498, 1496, 996, 1205, 1102, 844,
-    1584, 684, 1482, 1284, 561, 943, 787, 1480, 746, 270, 228, 199,
-    766, 837, 876, 1080, 1604, 1583, 888, 1833, 1366, 838, 1255, 1863,
-    1654, 1283, 1403, 1699, 1698, 1279, 929, 1453, 1132, 898, 1315, 1699,
-    1584, 849, 962, 1467, 797, 702, 763, 545, 415, 1198, 1446, 1697,
-    1341, 1553, 1727, 983, 720, 592, -149, -408, -145, -663, -914, -365,
-    103, 545, 572, 553, 311, 607, 536, 420, -111, 104, 561, 791,
-    862, 1032, 983, 1169, 604, 461, 465, 784, 397, 577, 491, -135,
-    347, 713, 608, 300, -204, -484, 118, 43, 860, 462, -65, -254,
-    -579, -1441, -1224, -363, -992, -1791, -1554, -2298, -2152, -2320, -1677, -1520,
-    -1522, -2291, -1974, -2238, -2108, -2380, -2246, -1856, -2652, -2545, -1806, -2266,
-    -2263, -2162, -2503, -2462, -2504, -2579, -1828, -1557, -1473, -1532, -1275, -1575,
-    -1298, -1232, -754, -815, -1107, -1479, -1041, -1007, -1501, -1120, -1117, -1001,
-    -948, -1603, -1648, -1429, -1542, -900, -1059, -1058, -918, -1073, -605, -553,
-    -902, -781, -948, -866, -1510, -952, -536, -920, -1369, -835, -459, -848,
-    -920, -1033, -686, -112, -1178, -1654, -444, -558, -678, -583, -472, -682,
-    -564, -799, -99, -226, 153, 553, 186, 67, -148, 3, -341, -210,
-    -248, -871, -560, -207, -828, -429, -125, -269, -108, 351, -113, -512,
-    -263, -580, -104, -292, -938, -658, -627, -4, -407, -492, 47, 181,
-    13, 388, 522, 434, 522, 345, 593, 78, 333, 817, 1133, 1157,
-    752, 899, 1013, 772, 879, 784, 1324, 1376, 1329, 1705, 927, 1760,
-    1863, 1440, 1315, 1540, 2200, 2567, 2780, 2479, 2388, 2351, 2315, 2457,
-    1730, 1602, 1572, 1363, 702, 874, 1134, 1031, 1047, 1406, 1731, 1875,
-    1138, 903, 805, 624, 335, 115, 126, 437, 317, 855, 1587, 919,
-    216, -166, 651, 562, 81, 367, 707, 694, 1012, 848, 822, 764,
-    507, 1246, 1097, 1030, 396, 511, 841, 915, 894, 242, 622, 935,
-    1583, 1196, 1087, 683, 846, 830, 792, 1270, 1179, 825, 846, 1610,
-    1756, 745, 898, 847, 1238, 1792, 1482, 1244, 1480, 1006, 475, 123,
-    98, 782, 288, 165, -122, -128, 515, 345, -216, -13, 847, 571,
-    868, 431, 219, 725, 678, 486, 843, 341, -316, -5, -143, 91,
-    -72, -266, -99, 32, -8, -338, 106, -195, -159, -489, -115, 241,
-    -400, -669, -24, 433, 106, -686, -450, -368, -622, -703, -892, -967,
-    -1190, -2128, -1672, -1631, -1388, -1474, -1867, -1873, -1687, -1757, -1616, -1814,
-    -1827, -2474, -2431, -1880, -2245, -2589, -2760, -3256, -3008, -2697, -2276, -2912,
-    -2551, -1965, -2274, -2515, -2078, -2129, -1718, -1664, -1563, -1011, -1189, -1420,
-    -1912, -1815, -1702, -1454, -1347, -919, -540, -583, 24, -99, -554, -654,
-    -664, -553, -319, -341, -99, 838, 755, 148, -136, -212, -171, -42,
-    -481, -478, -609, -970, -446, -380, -748, -945, -1277, -1245, -847, -556,
-    -626, -1210, -1275, -870, -527, -192, -437, -986, -483, -363, -249, -228,
-    -690, -472, -445, -635, -495, -703, -750, -776, -737, -649, -743, -512,
-    -301, -185, -84, -365, -727, -737, -313, 86, -570, -954, -425, -178,
-    308, 322, 716, 573, 254, 453, 1003, 748, 807, 921, 1066, 643,
-    0, 515, 659, 1007, 858, 1324, 904, 914, 1056, 1303, 1456, 1294,
-    1525, 1454, 1042, 1516, 1567, 2278, 3025, 2673, 2180, 2302, 2835, 3102,
-    2188, 1884, 1663, 1262, 1330, 1617, 2232, 1816, 1860, 1646, 1417, 1721,
-    1718, 1016, 1511, 1999, 2244, 2213, 1764, 1713, 1228, 1453, 1385, 1351,
-    1305, 1668, 1366, 1725, 1646, 984, 680, 1037, 606, 608, 819, 917,
-    978, 654, 977, 1449, 798, 302, 553, 861, 450, -208, -105, 10,
-    17, -26, 152, 24, 128, 240, -15, 40, 316, 516, 409, -293,
-    -933, -537, -134, 906, 827, 783, 598, -107, 253, 587, 901, 918,
-    866, 847, 649, 632, 475, 738, 616, 685, 227, 230, 804, 1205,
-    948, 847, 958, 782, 613, 251, 381, 686, 75, -496, -180, -362,
-    -458, -522, -1099, -842, -778, -671, -560, -212, -456, -1140, -1077, -739,
-    -743, -714, -962, -1140, -923, -1118, -975, -858, -988, -1093, -781, -878,
-    -703, -817, -1081, -1207, -899, -1052, -1346, -926, -1471, -1451, -1191, -1144,
-    -1543, -2388, -2357, -1721, -1744, -2431, -2527, -2711, -2070, -2214, -2789, -3418,
-    -3382, -3285, -3335, -3091, -2881, -2826, -2696, -2430, -2201, -2420, -2454, -2359,
-    -2244, -2349, -1895, -1472, -1191, -1014, -1031, -1293, -992, -584, -240, -439,
-    -509, -608, -892, -903, -998, -1233, -887, -893, -1356, -1107, -955, -862,
-    -912, -905, -664, -507, -786, -1248, -1283, -1031, -1178, -1054, -721, -771,
-    -602, -695, -380, -176, -726, -633, -821, -852, -1102, -1490, -1477, -1032,
-    -636, -352, -450, -87, -351, -1113, -1957, -1259, -535, -999, -1692, -1538,
-    -890, -1675, -1764, -1635, -1692, -1662, -1419, -1120, -1750, -1850, -1285, -1270,
-    -1721, -1890, -2101, -1447, -1326, -1368, -1090, -443, 8, 239, 172, 153,
-    239, 448, 203, -70, 11, 107, 585, 840, 1303, 1274, 904, 1106,
-    1511, 1456, 1391, 1923, 1765, 1308, 1005, 1429, 2023, 1703, 1226, 1416,
-    1928, 2087, 1867, 1550, 1781, 1825, 2111, 2397, 2383, 2364, 2445, 2503,
-    2101, 2042, 1545, 1167, 1634, 1772, 2006, 1832, 1513, 1445, 2192, 1281,
-    1305, 1722, 1606, 1441, 1416, 1884, 1903, 1681, 1616, 1740, 1613, 1603,
-    1646, 1490, 1371, 1237, 1064, 1132, 1639, 1348, 403, -116, 268, 621,
-    1121, 903, 1018, 1312, 738, 166, 515, 489, -183, 133, 593, 789,
-    901, 804, 608, 628, 723, 813, 901, 460, 930, 1051, 452, 362,
-    394, 988, 1199, 1307, 1256, 751, 792, 747, 729, 1312, 1487, 1235,
-    643, 114, 405, 1258, 1934, 1414, 863, 958, 1018, 1103, 971, 1237,
-    1303, 1052, 793, 955, 865, 942, 308, 244, 289, 213, 265, 832,
-    1182, 807, -114, -372, -540, -395, -540, -302, -624, -526, 97, 65,
-    -297, -478, -160, -306, -585, -435, -677, -649, -888, -826, -758, -652,
-    -1407, -1509, -1809, -1537, -1184, -1439, -1320, -1352, -692, -917, -1257, -1148,
-    -1435, -1065, -371, -680, -1016, -1280, -1246, -1069, -1109, -1020, -1174, -1032,
-    -759, -833, -1222, -1526, -1416, -1057, -957, -1331, -1186, -1174, -629, -357,
-    -1013, -947, -759, -864, -462, -84, -95, -603, -675, -1185, -1069, -917,
-    -906, -1021, -1195, -810, -922, -1080, -1429, -1167, -976, -1169, -1099, -1428,
-    -1256, -966, -1024, -303, -932, -1158, -994, -866, -743, 147, 373, -328,
-    -725, -778, -708, -235, -263, -583, 310, 20, -101, 614, -464, -206,
-    218, -1102, -1114, -560, -505, -1378, -2098, -1152, -638, -1531, -1797, -1023,
-    -562, -823, -981, -1637, -1478, -1023, -1371, -1131, -1095, -1740, -857, -1006,
-    -1560, -1229, -352, -954, -362, -539, -1111, -804, -689, -1372, -674, -85,
-    -442, -370, -213, 151, 529, 1703, 1299, 1692, 2411, 1564, 1672, 1656,
-    1053, 1006, 1591, 1749, 1516, 1321, 901, 628, 298, 623, -94, 434,
-    1210, 496, 513, 417, 355, 175, -126, 960, 817, 922, 804, 1111,
-    1144, 884, 1454, 1587, 1281, 700, 780, 790, 580, -4, -958, 518,
-    1500, 1022, 972, 2038, 108, -1011, -147, 753, 1483, 1986, 1289, 342,
-    1798, 1133, 447, -1154, -1392, -843, -1277, -1863, -1358, -625, -622, 396,
-    712, 1219, 35, -463, 161, 1094, 1261, 661, 1526, 998, -291, -910,
-    -132, -925, -1131, -1332, -1365, -1465, -937, 640, 1365, 91, -622, 43,
-    498, 1295, 1284, 379, 1337, 1293, 1628, 705, 313, 2193, 2157, 1321,
-    1043, 892, 733, 1576, 773, -132, 474, 1353, 1293, 1924, 1562, 522,
-    342, 344, 80, -399, -487, 266, 276, -405, -371, -187, 918, 100,
-    1077, 517, 295, 458, 949, 745, -238, 470, 921, 708, 333, 1115,
-    693, 521, 899, 374, -633, -288, -107, -1385, -855, -1102, -1117, -2054,
-    -2443, -3092, -3303, -3621, -3285, -2172, -1519, -1852, -2401, -2341, -1881, -2030,
-    -2987, -1715, -1856, -2086, -871, -691, -732, -541, 265, 106, 396, -745,
-    203, 2005, 2625, 1599, 1142, 932, 718, 497, 495, 779, 1456, 938,
-    862, 861, 1272, 396, 506, 839, -1037, -1496, -744, -1184, -206, -1200,
-    -2327, -1794, -550, -1334, -1464, 570, 599, -1019, -1680, -1382, -2001, -3127,
-    -2897, -1906, -1598, -2469, -1472, -1920, -1866, -557, 277, -142, 222, 1403,
-    2471, 1866, 2047, 2539, 1304, 1098, 2073, 2416, 2284, 1599, 1565, 2809,
-    1541, 1643, 1266, 950, 1610, 639, -261, 196, -606, -1449, -1456, -1580,
-    -1661, -464, 238, -284, -1406, -1029, -230, -790, -1274, -802, -610, -1146,
-    231, -380, -1690, -981, -342, -761, -324, 216, 1721, 2809, 2189, 1225,
-    1004, 2089, 1981, 1523, 2250, 2381, 1969, 2322, 2444, 1553, 3059, 2558,
-    1495, 1593, 2126, 1249, 233, 1820, 1946, -412, 371, 1561, 1508, 1427,
-    1464, 2644, 3016, 983, 290, 1156, 1052, 1340, 1580, 473, 53, 1091,
-    1241, 395, 432, 1167, 1172, 1423, 1019, 1884, 2190, 1076, -258, -530,
-    877, 1421, 1654, 2046, 1067, 842, 681, -154, -1316, -1397, -1364, -842,
-    -179, -178, -357, 511, -433, -118, 583, -467, -249, -460, 91, 1262,
-    1377, 540, -1174, -1680, -843, -2010, -2251, -2362, -2140, -2243, -2586, -1786,
-    -1880, -1137, 125, 539, -993, -674, 681, 491, 629, 487, 831, 582,
-    1154, 1676, 1813, 1215, 1558, 1981, 101, -184, 774, 215, -1730, -1121,
-    -2181, -1968, -26, -463, -1055, -2196, -883, -1117, -1519, -1945, -1784, -336,
-    -546, -1594, -1482, -479, -1879, -594, -47, -225, -249, 864, 1519, -482,
-    -1483, -299, 685, -211, 696, 327, -549, -163, -756, -1446, -1609, -2273,
-    -1630, -1684, -2912, -3629, -3561, -3711, -3466, -4262, -4872, -4697, -3216, -2926,
-    -2903, -2670, -3163, -2401, -3174, -4144, -3872, -3137, -2817, -4007, -4588, -3164,
-    -2674, -2678, -2793, -1626, -942, -1145, -400, -974, 435, 330, -921, 112,
-    330, 115, 1251, 645, 813, 2234, 2038, 1268, 365, 882, -11, -436,
-    377, 642, -1627, -1559, -1474, -2704, -2699, -2195, -660, -400, -473, -370,
-    -1272, -1228, -1747, -2100, -2769, -2182, -2953, -2373, -1951, -2482, -1673, -1898,
-    -754, -447, -244, -351, -248, 1072, 959, 1398, 579, 318, 828, 1948,
-    1545, 1975, 2632, 2664, 3103, 2414, 1807, 1961, 2223, 2197, 1884, 2291,
-    1683, 520, 225, 234, -313, -320, 530, 1469, 1164, 753, 1351, 388,
-    -800, 330, 262, -767, 21, 1210, 1639, 412, 961, 1402, 1469, 2271,
-    521, 1063, 3104, 2931, 2938, 3769, 3675, 2586, 1289, 1966, 2981, 2814,
-    1857, 2119, 1583, 406, 1491, 1455, 1618, 1184, 1305, 1540, 1415, 715,
-    1695, 1236, 1623, 2352, 3231, 2570, 3184, 3226, 3530, 2634, 1997, 2729,
-    2017, 1844, 1575, 2124, 2134, 2788, 2351, 1189, 2479, 2254, 3450, 2910,
-    2727, 2831, 1924, 1577, 1545, 1641, 1739, 3231, 4165, 2607, 1975, 1550,
-    -684, -289, 822, -993, -1009, -1079, -1809, -1418, -956, -909, -861, 207,
-    -1704, -2271, -469, -342, -654, -60, -136, -134, -1907, -3007, -2582, -1734,
-    -2052, -2812, -1272, -833, -1000, -972, 189, 299, 200, -58, -207, 1041,
-    1598, 1706, 1311, 1737, 2497, 2128, 2028, 2770, 1478, 566, 1734, 1069,
-    101, 17, -264, -1845, -2046, -437, -1218, -2495, -1267, -648, -2331, -2536,
-    -2626, -2925, -2802, -4610, -3992, -2830, -3392, -4032, -4353, -1879, -956, -2246,
-    -1848, -1737, -1794, -469, -1457, -2000, -459, -258, -899, -166, -440, 518,
-    724, -37, -54, -92, -1163, -2138, -2305, -1307, -2077, -4284, -4935, -4094,
-    -4543, -5269, -4898, -3918, -2109, -2686, -2585, -1757, -2567, -4481, -4236, -3407,
-    -3903, -4690, -3301, -2769, -3196, -2821, -2500, -1755, -1287, -1389, -920, -917,
-    -1057, -540, 730, 317, -1081, -1316, -637, -54, -425, 1053, 1768, 717,
-    882, 1182, 187, 868, 1212, -592, 80, 198, -363, -1561, -2212, -2327,
-    -1904, -1060, -1220, -692, -1018, -1044, -1782, -2169, -1895, -1643, -2291, -3140,
-    -3528, -3215, -2508, -1413, -1032, -1047, -1266, -727, -376, -688, 329, 1145,
-    942, 424, 468, 1390, 1691, 1636, 2133, 2382, 2735, 2589, 531, 1082,
-    3240, 1701, -216, 492, -192, -9, 210, 643, 441, -252, -331, 728,
-    515, 866, 1393, 1118, 1437, 1309, 886, -5, 562, 670, 682, 1412,
-    1331, 436, 1250, 2908, 2088, 1316, 1781, 2035, 1844, 2181, 2494, 2915,
-    3397, 4136, 3443, 3893, 3541, 2992, 3137, 2747, 2129, 2597, 2453, 2530,
-    1768, 632, 1731, 1683, 711, -67, 1029, 1318, 184, 832, 1255, 1685,
-    1642, 1654, 1437, 1859, 1594, 324, 570, 317, 851, 3075, 2977, 2192,
-    1945, 2239, 1695, 3139, 3082, 2161, 2371, 1089, 278, 1364, 2442, 1852,
-    3447, 4276, 3505, 2756, 2988, 1978, 447, 805, 686, -455, -391, 780,
-    -433, -894, -230, 1278, 1793, 1145, -102, -650, 272, 1175, 172, 8,
-    -734, -1852, -1163, -2255, -2904, -3105, -2634, -2630, -1677, -2457, -1712, 524,
-    114, -912, -1373, -930, -87, 357, 869, 2155, 2241, 2348, 3259, 2947,
-    2650, 2320, 2731, 2139, 1018, 308, -319, -210, -325, -480, -1567, -793,
-    316, -373, -1020, -1504, -2311, -1797, -1220, -2949, -3177, -2088, -2693, -3219,
-    -2560, -1190, -1629, -962, -917, -1341, -1584, -380, -781, -1036, -1780, -2540,
-    -2156, -2671, -2425, -336, -207, -1194, -572, -387, -222, -983, -1436, -1283,
-    -1366, -2062, -3160, -3702, -2973, -3059, -4237, -3930, -3234, -1702, -1706, -2633,
-    -2280, -2625, -2753, -2853, -3402, -2515, -2885, -2291, -3581, -4181, -3095, -1509,
-    -1254, -1483, 44, 40, -552, -648, -333, -480, -1651, -1547, -393, 390,
-    -173, 217, 1093, 1047, 327, 42, 377, 409, 7, -382, -1179, -1134,
-    -1207, -1447, -1713, -1892, -2161, -2306, -1859, -1887, -1681, -1342, -851, -897,
-    -865, -480, -1272, -2571, -2284, -2291, -2166, -1929, -2079, -1484, -1014, -770,
-    243, 320, 730, 1469, 869, 407, 244, 325, 1100, 1485, 1984, 2473,
-    2813, 3368, 2722, 2455, 2812, 2177, 1385, 2101, 2219, 1892, 1257, 530,
-    829, 328, -612, -1101, -1236, -507, 46, 762, 332, 1037, 415, 479,
-    286, 305, 67, -252, 394, 637, 1698, 2060, 2614, 2829, 3260, 2458,
-    3145, 2936, 2386, 2636, 3148, 3702, 3802, 4418, 4428, 3651, 3938, 3398,
-    3174, 2967, 2970, 1770, 1723, 2589, 2355, 1770, 1276, 1737, 1300, 956,
-    834, 326, 506, 1516, 2368, 2034, 2191, 2195, 1511, 566, 596, 652,
-    623, -85, 732, 1658, 1732, 1603, 2168, 2445, 2231, 3093, 3231, 2774,
-    2683, 2562, 2114, 2158, 3480, 3448, 4096, 4719, 4181, 3303, 1740, 1078,
-    851, 362, -182, 608, 988, 785, 652, -51, -747, -907, -470, -1674,
-    -2098, -945, -885, -1090, -791, -941, -1064, -1416, -2634, -3328, -2656, -2820,
-    -2107, -1360, -2559, -1218, -141, -348, -1004, -801, -1138, -1260, -610, 551,
-    809, 972, 1825, 2502, 1474, 1535, 1972, 1504, 1838, 922, 164, 516,
-    458, -34, -491, -517, -659, -977, -1239, -1022, -1625, -1612, -1572, -1417,
-    -2019, -2826, -2719, -2694, -3752, -3306, -2802, -2376, -2591, -2272, -1377, -1942,
-    -2190, -2507, -2721, -2653, -2550, -1529, -701, -770, -949, -850, -889, -873,
-    -1035, -2341, -2092, -3463, -3251, -2700, -3438, -4463, -3833, -3633, -3695, -3472,
-    -3883, -3366, -3906, -3308, -2290, -2649, -3325, -1718, -1587, -2064, -2419, -2776,
-    -1893, -1304, -2373, -2290, -1113, -1337, -1347, -616, -946, -1475, -1341, -1690,
-    -1456, -1148, -1614, -1101, -908, -911, -1150, -726, -1755, -1885, -2269, -1847,
-    -1449, -1857, -2151, -1630, -1095, -1051, -1003, -2027, -2245, -1505, -1606, -1468,
-    -1450, -2136, -1198, -819, -937, -1199, -554, -474, -810, -1364, -659, -523,
-    -766, -483, 215, 189, 387, 572, 540, 569, 321, 194, 743, 702,
-    808, 977, 1597, 1706, 865, 1043, 1385, 686, 887, 780, 643, 1347,
-    1743, 845, 857, 1013, 826, 991, 392, 450, 853, 1302, 1821, 2579,
-    2317, 1648, 2012, 2304, 1906, 1142, 753, 1154, 1407, 502, 977, 2024,
-    2095, 1839, 1914, 1894, 1764, 2323, 1574, 1628, 2079, 2853, 2846, 2596,
-    2857, 3030, 2615, 1678, 2127, 2504, 2514, 2088, 2518, 2363, 2366, 2598,
-    2596, 2522, 1953, 1517, 1520, 2284, 2611, 1591, 1757, 2260, 2889, 3420,
-    2971, 1877, 1603, 2574, 2880, 2368, 2220, 2958, 3720, 2946, 3143, 3112,
-    2773, 3020, 3040, 2311, 1935, 2528, 2379, 1689, 2162, 2319, 1694, 1278,
-    1210, 1321, 1215, 857, 1013, 1281, 953, 1129, 1402, 1153, 504, 787,
-    902, 637, 943, 1101, 690, 729, 868, 1147, 952, 825, 661, 29,
-    -308, -200, -347, -519, 157, 97, 186, 112, -136, -398, -386, -316,
-    112, 120, -182, 223, 929, 1196, 349, 1, 25, 135, -222, -308,
-    -299, -378, -712, -1013, -1162, -1255, -1246, -672, -217, -653, -476, -382,
-    -691, -1011, -776, -900, -972, -1195, -1055, -1265, -1971, -1847, -1161, -1343,
-    -1955, -1514, -1224, -1003, -1632, -1827, -1695, -2576, -2885, -2803, -2753, -2803,
-    -2887, -3189, -3241, -2830, -2493, -2845, -3514, -3794, -3205, -2887, -2584, -2581,
-    -2996, -2684, -2732, -2577, -2821, -2236, -1991, -2448, -2651, -2158, -2964, -3201,
-    -2625, -1831, -2198, -2075, -1657, -1739, -1683, -1572, -1495, -1240, -713, 32,
-    24, -282, -731, -375, -271, -762, -504, -1348, -423, 343, -85, -650,
-    -1390, -1485, -1617, -1684, -1356, -1436, -1748, -1637, -1955, -1769, -1505, -1633,
-    -1830, -2240, -2224, -2020, -2327, -2115, -1394, -1508, -1423, -1096, -1079, -1031,
-    -900, -819, -833, -673, -700, -510, -555, -616, -776, -899, -834, -923,
-    -422, -4, -529, -302, -17, 427, 530, 390, 536, 702, 748, 676,
-    672, 928, 807, 392, 572, 701, 784, 917, 934, 1243, 963, 1245,
-    1449, 1275, 1122, 802, 784, 544, 370, 590, 1028, 763, 636, 45,
-    -49, 656, 1216, 2117, 2036, 2590, 2398, 2311, 2298, 1946, 1537, 1374,
-    2067, 1677, 1000, 1193, 1782, 1542, 1514, 1413, 1898, 1840, 1991, 2132,
-    2007, 2082, 2096, 1820, 1904, 2158, 1990, 1960, 1756, 1500, 1710, 2098,
-    2498, 2229, 2000, 2468, 2676, 2375, 2113, 1975, 1805, 2202, 1931, 1527,
-    2045, 2129, 2491, 2412, 2641, 2578, 2140, 1881, 1275, 1359, 1665, 1627,
-    1712, 1759, 1752, 1660, 1521, 1714, 1238, 842, 371, 238, 633, 395,
-    347, 556, 695, 221, 262, 257, 93, 371, -14, -571, -710, -766,
-    -64, -57, 127, 51, 118, 111, 413, 253, 756, 450, 664, 670,
-    340, 272, 140, -64, -184, 186, 221, -175, -565, -347, -266, -291,
-    128, 449, 220, -353, -810, -780, -947, -932, -342, 98, 646, 861,
-    754, 414, -88, -333, -514, -856, -1383, -1849, -2309, -2172, -1827, -2029,
-    -2037, -2127, -2208, -2142, -1861, -1590, -1514, -1603, -1336, -1467, -1834, -1365,
-    -1530, -1401, -2104, -2644, -2921, -3120, -3077, -2786, -2459, -2384, -2709, -2714,
-    -2801, -2572, -2438, -2848, -2868, -2831, -2630, -2615, -2809, -2521, -2430, -2767,
-    -3064, -2968, -2705, -2433, -2423, -1927, -918, -198, -520, -597, -556, -766,
-    -690, -368, -695, -510, -418, -343, -13, -120, -326, -678, -199, -316,
-    -627, -940, -892, -1448, -1111, -498, -593, -508, -609, -763, -811, -922,
-    -823, -396, -104, -170, -213, -364, -376, -523, -928, -1404, -1324, -1559,
-    -1471, -1259, -670, -693, -377, -200, -209, -340, -489, -536, -174, -58,
-    -76, 256, 608, 565, 1036, 888, 970, 961, 647, 425, -38, -117,
-    174, 535, 622, 1046, 1148, 1223, 1009, 1016, 936, 1139, 1184, 1617,
-    1680, 1832, 2155, 2030, 2251, 2416, 2346, 2221, 2096, 2043, 2054, 1888,
-    1939, 1820, 1835, 1818, 1717, 1575, 1800, 2032, 2025, 2108, 2023, 2420,
-    2620, 2638, 2088, 1764, 1141, 663, 397, 354, 840, 1577, 1949, 2223,
-    2402, 2467, 2374, 2106, 1874, 1671, 1223, 1119, 1091, 1353, 1323, 897,
-    1088, 1518, 1278, 1512, 1347, 1066, 981, 1212, 1531, 2133, 2655, 2624,
-    2749, 2643, 2813, 3136, 2693, 2761, 2670, 2883, 2438, 2123, 2061, 2224,
-    2450, 1891, 1551, 1377, 966, 752, 585, 478, 357, 641, 417, -196,
-    -696, -1098, -800, -592, -674, -738, -287, 353, 624, 228, -141, -456,
-    -542, -808, -1490, -1472, -1405, -1340, -1076, -905, -982, -552, -313, -202,
-    -426, -414, -242, -197, 88, 119, 119, 237, 43, 348, 524, 379,
-    151, 175, 70, -318, -506, 9, 119, 56, -331, -325, -261, -209,
-    -370, -457, -335, -687, -856, -822, -1046, -850, -1487, -2116, -2349, -2448,
-    -2841, -2477, -2159, -2109, -2029, -1840, -1863, -2222, -1954, -2102, -2358, -2069,
-    -2302, -2996, -2967, -2487, -2596, -3284, -3153, -3652, -3297, -3490, -3753, -3466,
-    -3427, -3272, -2548, -2299, -2411, -2813, -3180, -3120, -2728, -2574, -2789, -3061,
-    -2964, -3146, -3247, -2909, -3077, -2771, -2636, -2709, -2652, -2560, -1973, -1672,
-    -1502, -1091, -1498, -1680, -1272, -1193, -1013, -1226, -1375, -1164, -1158, -611,
-    -147, -32, -258, -551, -797, -710, -954, -1535, -1675, -1720, -1699, -1424,
-    -1204, -1559, -1976, -2147, -1813, -1734, -1854, -1820, -1831, -1383, -1106, -891,
-    -1156, -1260, -1093, -1145, -657, -721, -748, -554, -674, -589, -651, -517,
-    -683, -326, -118, 99, 89, 275, 485, 797, 309, 696, 978, 484,
-    644, 564, 284, 81, 40, -52, 170, 994, 1609, 2302, 2216, 2089,
-    1711, 1950, 1847, 1465, 1756, 1583, 2201, 2623, 2342, 1926, 1410, 1519,
-    2283, 2432, 2144, 2218, 2442, 2530, 2774, 2458, 2275, 2501, 2387, 2559,
-    3163, 3070, 2832, 2770, 2675, 2811, 2524, 2199, 2083, 2213, 2188, 2020,
-    1913, 1681, 1821, 2291, 2132, 2025, 2306, 1982, 1564, 1438, 1564, 1317,
-    1338, 1314, 1282, 1396, 1990, 2329, 1892, 2181, 2518, 2355, 2282, 1932,
-    1971, 2169, 2547, 2401, 2327, 2175, 2528, 2827, 2773, 2416, 2117, 2320,
-    2738, 2991, 3058, 2983, 2607, 2151, 2281, 1999, 2077, 1905, 1403, 973,
-    425, 670, 433, 154, 375, 275, 162, 52, 289, 83, 197, -183,
-    -567, -441, -502, -1003, -1391, -1694, -1521, -1435, -1719, -1362, -761, -931,
-    -727, -589, -192, 113, 6, -485, -549, -168, -221, 14, 309, -239,
-    -544, -606, -1073, -920, -844, -738, -485, -663, -684, -124, 375, 772,
-    359, -213, -281, -86, 206, -220, -168, -155, -261, -190, -416, -796,
-    -1006, -1064, -989, -1236, -1714, -1594, -1236, -1179, -1490, -2110, -2180, -1625,
-    -1819, -2410, -2828, -2991, -3044, -2550, -2454, -2481, -2183, -2343, -2585, -2541,
-    -2174, -2575, -2792, -3284, -3958, -4252, -3597, -2468, -1634, -1878, -2450, -2990,
-    -3700, -3861, -3918, -3149, -1730, -558, -125, -1146, -2286, -2809, -2471, -2184,
-    -1839, -2067, -1924, -1142, -327, -148, -977, -761, -134, -231, -348, -626,
-    -426, 360, 219, -748, -1327, -1154, -903, -234, 282, 286, -602, -1642,
-    -1628, -1569, -570, 60, -314, -516, -329, -97, -415, -708, -1051, -1609,
-    -1877, -1655, -1504, -1107, -1406, -1707, -2014, -2822, -1307, 853, 814, -1303,
-    -2173, -1275, -240, 303, 1574, 2062, 2210, 2049, 2062, 1647, 2037, 1894,
-    1802, 1584, 1058, 218, -423, -956, -332, 738, 321, -735, -908, -1468,
-    -1625, -1142, -713, 149, 491, 372, 468, 1198, 1487, 1940, 2069, 3062,
-    2901, 3561, 4196, 4208, 4324, 4683, 4260, 4290, 4771, 4723, 5195, 5066,
-    5195, 4782, 4674, 4549, 4801, 5034, 5127, 4691, 4983, 4993, 4501, 4100,
-    4062, 4543, 3681, 3532, 3435, 3910, 3375, 3141, 2719, 3226, 3338, 3048,
-    2679, 2647, 2491, 2219, 1839, 1834, 2045, 1702, 671, -684, -677, -279,
-    -684, -824, -1040, -1086, -666, -936, -1521, -2741, -3254, -2138, -2229, -2816,
-    -3210, -4065, -3504, -3180, -3227, -4180, -3951, -3975, -3799, -3041, -2913, -2597,
-    -3158, -3158, -2465, -3486, -4368, -2931, -3018, -3371, -3916, -3488, -4847, -4634,
-    -3149, -2108, -1379, -1797, -1809, -1789, -724, -468, -1902, -2866, -3537, -3973,
-    -3330, -2866, -2595, -1668, -1074, -1315, -469, 1173, 410, -359, 270, 1443,
-    1186, 1504, 1472, 1573, 1447, 502, -344, -341, -425, -24, 826, 1206,
-    2425, 2985, 2438, 2117, 927, 356, 1015, 1947, 1863, 1799, 1915, 2016,
-    2269, 1934, 2044, 2121, 1706, 303, -463, 479, 1000, 205, -1953, -2714,
-    -3745, -4207, -2895, -2083, -1549, -1505, -3655, -4740, -5194, -4711, -4307, -3601,
-    -3682, -4812, -4843, -3565, -3528, -3412, -3491, -4314, -2962, -2848, -3458, -4257,
-    -4065, -4325, -4155, -2949, -1771, -2229, -3181, -3506, -2867, -2576, -3165, -3769,
-    -3701, -3058, -2831, -1911, -2596, -2651, -1904, -2433, -3051, -2908, -1679, -1576,
-    -1788, -1282, -1895, -1321, -473, 1087, -42, -795, -853, -38, 215, 307,
-    140, 196, 756, 1775, 2337, 2123, 2164, 1898, 1746, 1759, 2485, 2229,
-    3413, 3697, 2247, 2314, 3170, 3447, 3431, 3721, 3635, 3853, 3835, 3672,
-    3322, 2833, 2974, 3207, 3438, 2607, 1339, 1599, 1621, 1256, 1263, 1499,
-    1195, 1602, 2047, 1968, 1731, 2228, 1133, 540, 114, 259, 1408, 2087,
-    1804, 1095, 941, 1750, 3192, 2240, 1405, 962, 1749, 1838, 2241, 1694,
-    1847, 2019, 2457, 2440, 2247, 2196, 1956, 938, 45, 532, 687, 1236,
-    968, 518, 16, -530, -1397, -1212, -1287, -1844, -1715, -1294, -1055, -1175,
-    -1249, -1321, -2502, -3079, -2993, -2295, -1253, -221, -79, -706, 311, 90,
-    33, 768, 1542, 1415, 1544, 1371, 1851, 2482, 2467, 2942, 4184, 4184,
-    4779, 5515, 5309, 4593, 3648, 3296, 3275, 3977, 3567, 3298, 3175, 3379,
-    3391, 3372, 2582, 1872, 2034, 2638, 3173, 3641, 3264, 2302, 1923, 1690,
-    1495, 1324, 1567, 2131, 2807, 2619, 2628, 3233, 3399, 3350, 3072, 2323,
-    2352, 1763, 2663, 2646, 2859, 3423, 3194, 3092, 2988, 3183, 2628, 1734,
-    1489, 1958, 1433, 1315, 310, -31, 907, 2051, 1920, 1873, 1215, 655,
-    -604, -1533, -1160, -467, -94, 350, -441, -114, -1269, -1614, -2176, -3299,
-    -4686, -4639, -3007, -2412, -3751, -3881, -3114, -3821, -4084, -5013, -5236, -4106,
-    -3035, -1506, -1308, -1892, -2414, -2632, -2751, -1720, -1598, -1596, -1573, -1135,
-    -1914, -1846, -2207, -3136, -3154, -3848, -3111, -3154, -3674, -4487, -4848, -4253,
-    -3527, -2447, -2585, -2704, -2751, -4249, -4248, -4759, -3846, -3207, -2347, -1714,
-    -1289, -1625, 249, 807, -539, -1559, -2473, -1934, -976, -266, 669, 812,
-    1051, 1032, 984, 1547, 607, 523, -91, -41, 719, 744, 685, 1232,
-    796, -340, -532, 30, -431, 262, 269, 210, 1026, 745, 722, 133,
-    -152, -663, -491, 338, 739, 1705, 1173, 1871, 1186, 1386, 1669, 1722,
-    3161, 3052, 1787, 1142, 1237, 2047, 3189, 3422, 3075, 3450, 3327, 3896,
-    3327, 2860, 2474, 1876, 1371, 1628, 1276, 716, 212, 230, -307, -1053,
-    -1624, -1582, -719, -1571, -897, -1439, -1737, -1707, -1981, -2355, -3236, -2213,
-    -2255, -2115, -1873, -2045, -2365, -1696, -1334, -453, -439, -1238, -986, -417,
-    -782, -1301, -1264, -1069, -619, -459, -776, -553, -186, 31, 368, -45,
-    -1079, -1784, -1604, -1395, -1963, -2540, -2791, -3923, -4026, -4264, -4807, -4797,
-    -3458, -2855, -2741, -3245, -4256, -4655, -4995, -5237, -4983, -4516, -4842, -4322,
-    -3592, -3084, -2927, -3086, -2886, -2621, -2459, -2583, -2088, -1462, -977, -1530,
-    -1136, -389, -89, 666, 559, 598, 375, 171, 25, -361, -440, 253,
-    -31, -454, -761, -403, -163, -371, -290, -318, -508, 354, 84, 319,
-    98, -140, -430, -1003, -697, 246, -147, -371, -326, -350, 869, 1739,
-    931, 1178, 578, 1673, 3605, 3295, 2748, 2498, 1672, 1638, 2021, 2631,
-    3465, 4558, 4983, 4718, 3998, 3303, 2112, 1417, 1435, 1939, 2771, 2186,
-    2150, 1593, 2015, 2141, 2185, 2553, 1387, 1243, 1414, 1809, 2713, 2407,
-    2799, 2135, 2538, 2122, 2541, 2267, 1237, 852, 1232, 1274, 1202, 3200,
-    3810, 2953, 2179, 1424, 991, 1111, 2204, 2810, 2833, 3663, 3762, 3004,
-    2663, 2305, 2084, 1833, 1867, 2119, 1716, 933, -340, -1347, -1317, -754,
-    -991, -991, -803, -1184, -1545, -1982, -2688, -3082, -3740, -3702, -2587, -1881,
-    -1816, -1557, -965, -703, -1198, -1530, -1959, -478, 762, 819, -258, -1230,
-    -2097, -2101, -1598, -1175, -728, 80, 172, 190, 322, 405, 78, -280,
-    -814, -1165, -1954, -3404, -3411, -3866, -4688, -3974, -3389, -4190, -3842, -3850,
-    -3887, -4147, -3529, -4019, -4137, -3599, -2792, -2649, -3330, -3650, -3871, -3327,
-    -3265, -2836, -2452, -1742, -1483, -1606, -1310, -560, -532, -905, -210, -224,
-    53, 261, 649, 1053, 974, 939, 504, 945, 588, -43, 425, 17,
-    -1173, -1345, -967, -999, -1212, -1750, -1521, -1279, 71, 493, -280, -425,
-    -708, -1234, -1611, -1436, -1227, -1279, -1799, -2106, -1863, -1532, -276, 1153,
-    1132, 2221, 2589, 2964, 2671, 2208, 2076, 2433, 3025, 3402, 4173, 4702,
-    4690, 4394, 4264, 4112, 4276, 3519, 4120, 3957, 3698, 3708, 3380, 2963,
-    3628, 3849, 3525, 2527, 1818, 2250, 2240, 2620, 2272, 1519, 1158, 717,
-    1085, 1664, 1750, 1101, 677, 1428, 2099, 2358, 2849, 2503, 2623, 2156,
-    2091, 2312, 2887, 3051, 3014, 3072, 2963, 3031, 3097, 2799, 3160, 3136,
-    3427, 2994, 2658, 2902, 2617, 1646, 941, 1973, 2441, 1228, 491, -142,
-    -178, -151, 63, 617, 1108, 1023, 912, 363, -272, -980, -1721, -1920,
-    -1653, -1211, -292, -329, -1013, -1327, -955, -1023, -933, 838, 121, -687,
-    -233, -1149, -1593, -800, -428, -112, 114, 76, -433, -712, -1245, -2229,
-    -3173, -3649, -3596, -3802, -3246, -3030, -2803, -2681, -3443, -3243, -3553, -4827,
-    -4997, -4420, -3442, -2712, -2549, -2769, -3714, -4641, -4914, -5107, -5079, -4973,
-    -4671, -3673, -3368, -3418, -2686, -2468, -2786, -2895, -3107, -3426, -3212, -2047,
-    -1005, -104, -231, -151, 273, -56, 224, -466, -649, -1355, -1974, -2947,
-    -2869, -3301, -3866, -4361, -3891, -3141, -2620, -2717, -2939, -3476, -3293, -3293,
-    -3316, -2923, -3000, -2973, -2999, -2799, -2805, -2386, -1418, -1483, -718, -960,
-    -350, 537, 641, 929, 517, -356, 190, 646, 1357, 2073, 2565, 3060,
-    3785, 3759, 3737, 3501, 3318, 3075, 2879, 2063, 1527, 2008, 1968, 1320,
-    355, 197, 593, 1183, 1321, 1358, 1532, 1635, 1548, 1518, 1233, 755,
-    220, 144, 194, 1060, 1198, 1102, 1301, 2064, 2463, 2489, 2793, 3598,
-    3748, 3683, 3695, 3621, 3725, 4760, 5126, 5252, 5294, 5038, 5062, 5640,
-    5319, 4877, 4500, 4615, 4318, 4273, 3772, 3768, 3873, 3469, 2532, 2538,
-    3106, 4033, 4996, 5034, 4494, 4102, 3332, 2616, 2607, 2497, 2078, 1826,
-    1200, 580, 944, 1797, 2372, 3118, 2975, 3162, 3620, 3933, 3428, 3281,
-    3094, 3293, 2318, 2326, 3179, 3425, 3491, 3289, 3101, 3194, 3084, 3039,
-    2294, 1647, 627, -254, -668, -234, 26, -327, -264, -342, -635, -467,
-    -378, 200, 527, 237, -425, -625, -1162, -1580, -1511, -1149, -1387, -1524,
-    -1419, -968, -322, 273, 46, -120, 68, 268, -127, -71, 423, 612,
-    494, 478, 623, 65, -551, -705, -678, -1798, -2343, -2302, -2703, -2912,
-    -2798, -3285, -3574, -4098, -4818, -5123, -4434, -4061, -4600, -4783, -4418, -4894,
-    -5640, -5965, -5742, -5968, -5842, -5779, -5633, -5446, -5180, -4852, -4577, -3949,
-    -3821, -3688, -2118, -1221, -2024, -2445, -3250, -3724, -3367, -2686, -2337, -1512,
-    399, 377, -189, -1487, -3415, -4244, -4259, -4260, -4364, -4556, -4490, -4238,
-    -5435, -5482, -5006, -4155, -4162, -5084, -5078, -4945, -4383, -4057, -4004, -4569,
-    -4951, -4697, -4773, -4519, -4278, -4575, -4241, -4245, -4523, -3758, -3271, -2335,
-    -1941, -1911, -2191, -2024, -1483, -1046, -23, 138, 865, 1069, 1395, 1503,
-    1958, 2164, 888, 422, -20, -230, -549, -2128, -2647, -2221, -1438, -899,
-    -194, -588, -754, -533, -1139, -1973, -2326, -2412, -1894, -1533, -1614, -1573,
-    -1283, -45, 627, 648, 337, 356, 828, 1871, 1699, 1420, 1482, 1385,
-    1946, 2715, 2708, 2438, 3839, 3937, 4019, 4276, 3832, 4402, 4129, 3540,
-    3402, 3047, 2691, 2344, 2073, 2391, 2090, 2851, 3656, 4061, 3469, 3612,
-    3108, 2849, 2483, 2100, 2131, 1944, 1631, 2065, 1693, 1589, 1773, 2013,
-    2935, 3420, 3956, 4641, 5471, 5769, 5663, 5280, 4953, 4722, 4426, 5111,
-    5351, 5789, 5460, 5481, 5309, 5241, 5326, 5042, 4406, 3931, 4062, 3813,
-    3009, 2428, 2083, 2005, 1419, 2224, 2748, 3473, 3765, 3636, 3448, 2956,
-    2461, 2189, 2235, 1600, 1727, 2114, 2373, 2710, 3093, 3726, 3536, 3582,
-    3623, 3450, 4059, 4335, 3735, 3882, 3641, 2833, 2861, 3028, 3435, 3555,
-    3112, 3013, 3285, 3149, 2616, 2281, 2452, 1558, 905, -129, -1078, -1279,
-    -1392, -1817, -1605, -1859, -1453, -1027, 59, 180, 84, -347, -898, -1896,
-    -2109, -2503, -2650, -2530, -1596, -994, -549, -1034, -867, -771, 103, 234,
-    1130, 1465, 1252, 562, 872, 654, 536, 1095, 1648, 1822, 2039, 1337,
-    1252, 501, 64, -1000, -2043, -2575, -2671, -2722, -2644, -2858, -3074, -3348,
-    -3203, -3248, -3337, -3451, -3349, -3039, -3336, -4023, -5282, -5925, -5781, -5630,
-    -6152, -5561, -5419, -5106, -5178, -4610, -4898, -4435, -2692, -1897, -1729, -1931,
-    -3432, -3452, -2850, -1697, -1362, -372, 357, 399, -673, -1311, -1749, -2595,
-    -3599, -3110, -3716, -3409, -3244, -2755, -3517, -3662, -3785, -3551, -4465, -4828,
-    -5142, -4860, -4696, -4240, -4151, -4428, -4831, -5118, -5257, -5147, -5301, -4946,
-    -4673, -4990, -5136, -4467, -4473, -4170, -3894, -3917, -3446, -3292, -3170, -2532,
-    -2148, -1957, -1364, -1350, -1080, -797, -1405, -1376, -1410, -1657, -2013, -1702,
-    -1538, -2152, -2402, -2932, -2648, -2250, -1376, -1157, -1899, -2073, -1386, -1608,
-    -1771, -1650, -1704, -1903, -1757, -1727, -1118, -959, -620, -875, -1339, -521,
-    563, 684, 270, -308, -603, -279, 280, 696, 1390, 2022, 2537, 2718,
-    2061, 1987, 1808, 1240, 1265, 599, 445, 296, 289, 496, 262, -519,
-    -321, -80, 387, 1329, 1173, 1438, 1170, 447, 819, 810, 692, 774,
-    472, 594, 762, 779, 1215, 1740, 2506, 2655, 2961, 3187, 4160, 4907,
-    4717, 4445, 4028, 3817, 3955, 4083, 4227, 4645, 4378, 4272, 4277, 3843,
-    4066, 3938, 4023, 4155, 3747, 2809, 2914, 2786, 2369, 1274, 851, 1174,
-    1397, 2187, 2673, 2537, 2310, 2070, 1856, 1262, 1133, 1618, 1191, 948,
-    1902, 2582, 3407, 3872, 4330, 4408, 4739, 5449, 6229, 6350, 5968, 5426,
-    5379, 5460, 5707, 5517, 5732, 5782, 6318, 6440, 5813, 5126, 4481, 4519,
-    4374, 4487, 4177, 3460, 3403, 2894, 1966, 1131, 1090, 1402, 2101, 2230,
-    2066, 1421, 245, 841, 466, 129, 240, -78, 200, 777, 941, 1157,
-    1412, 1548, 1957, 2238, 2554, 2591, 2768, 3168, 2944, 2578, 2014, 1928,
-    2383, 3451, 3676, 3575, 3713, 3982, 3365, 3383, 2824, 2659, 2421, 1909,
-    1854, 1641, 826, -87, -478, -876, -829, -127, -167, 30, 15, -751,
-    -1358, -2050, -1859, -2043, -2838, -2597, -2401, -2431, -2106, -2031, -2004, -1520,
-    -1966, -669, 196, -591, -370, -1144, -2640, -2635, -1463, -826, -338, 564,
-    704, 343, -111, -1098, -1878, -2427, -2630, -2171, -2106, -1726, -1293, -1410,
-    -1604, -1832, -1434, -1148, -2487, -2986, -2489, -2315, -1719, -2021, -2528, -3034,
-    -3601, -3674, -4207, -4178, -4242, -4142, -4061, -4018, -4032, -2837, -2408, -2869,
-    -3577, -4052, -3674, -3385, -2999, -2442, -2164, -2339, -1955, -1499, -2027, -2356,
-    -2732, -3253, -3421, -3363, -3386, -3504, -4628, -5349, -4870, -4517, -4354, -4378,
-    -4368, -4515, -4345, -4410, -4708, -4865, -4595, -4620, -4827, -5056, -4868, -4451,
-    -4416, -3757, -3319, -2948, -2797, -2709, -1672, -1493, -1942, -2750, -2850, -3165,
-    -2739, -2636, -2320, -1764, -1517, -1689, -1834, -1598, -1521, -1788, -2493, -3272,
-    -3424, -3291, -2661, -3201, -4831, -4977, -4799, -4248, -4167, -4218, -4256, -4572,
-    -4420, -4091, -4337, -4813, -4667, -4369, -4504, -4584, -4233, -3970, -3367, -2638,
-    -2063, -1720, -1425, -1337, -616, 606, 255, 110, -149, -695, -761, -492,
-    -168, 459, 927, 644, 480, 405, 488, 441, 38, 240, -295, -1236,
-    -1327, -1197, -1263, -1975, -1746, -1391, -837, -540, -509, -241, -607, -1175,
-    -1093, -1345, -1125, -808, -938, -759, -853, -914, -468, 56, 446, 1133,
-    1905, 2523, 2489, 1840, 1570, 1520, 1653, 1925, 2279, 2838, 3032, 3409,
-    3928, 3856, 3517, 2971, 2564, 2773, 3201, 3187, 2927, 2966, 2509, 2057,
-    1829, 1583, 1083, 1174, 1561, 1965, 1616, 1668, 1600, 1125, 1504, 1213,
-    1167, 1474, 1326, 1033, 1441, 1648, 2026, 2171, 2452, 2694, 2929, 3890,
-    4155, 4022, 3502, 3369, 3820, 3907, 4094, 4957, 5366, 5304, 5170, 5245,
-    5339, 4884, 4765, 4547, 4645, 4428, 4045, 3897, 3552, 3043, 2558, 1908,
-    1921, 2493, 3185, 3436, 3541, 3714, 3367, 3369, 3092, 2975, 2422, 2636,
-    2366, 2297, 2557, 2877, 2877, 2992, 3123, 4090, 5115, 4769, 4517, 3894,
-    2669, 2822, 3947, 5060, 5671, 6415, 6107, 5245, 4381, 3364, 2753, 2597,
-    2251, 2048, 2165, 2340, 2509, 2676, 2582, 2580, 2738, 2401, 1308, 1337,
-    2254, 2774, 2894, 2989, 2985, 2559, 2189, 1906, 1695, 1148, 937, 1080,
-    1647, 1345, 1827, 2306, 2141, 1610, 1526, 1501, 1704, 1836, 2057, 2199,
-    2259, 2267, 2757, 2618, 2295, 1802, 1631, 1258, 1026, 1045, 837, 217,
-    -585, -508, 12, 223, 130, 73, -262, -900, -1360, -2219, -2327, -2209,
-    -1826, -1719, -1712, -1436, -1182, -1239, -1076, -610, 246, 305, 332, 1141,
-    1589, 1540, 1116, 736, 414, 407, 141, 410, 485, 665, 732, 885,
-    917, 262, -22, -452, -771, -906, -1628, -2001, -1749, -2275, -2954, -3158,
-    -3193, -3050, -2779, -2496, -2920, -3452, -3882, -4073, -4289, -4270, -4472, -4784,
-    -4570, -4243, -4120, -3714, -3363, -2993, -2639, -2249, -2147, -1441, -1129, -1502,
-    -1779, -1897, -1925, -1745, -1711, -1483, -1282, -883, -668, -581, -287, -119,
-    -726, -998, -1676, -1535, -1829, -2633, -2784, -3232, -3788, -4113, -4053, -3502,
-    -3215, -3163, -3484, -3878, -4509, -4553, -4708, -4711, -4734, -4591, -3753, -3574,
-    -3476, -3546, -3726, -3576, -3551, -3242, -2796, -2364, -2052, -2397, -2805, -2698,
-    -2851, -2839, -2543, -2404, -1912, -1706, -1751, -1525, -1575, -1870, -1714, -1872,
-    -1917, -1904, -1995, -1888, -2234, -2712, -3221, -3703, -3537, -3143, -2460, -2641,
-    -2581, -2900, -2849, -3328, -3779, -3887, -3994, -4008, -3619, -3137, -3069, -2649,
-    -2260, -2103, -2257, -1632, -1378, -827, -925, -1047, -1268, -2041, -1946, -1581,
-    -740, -699, -608, -178, 334, 13, -107, -131, -871, -1555, -1337, -1065,
-    -1080, -1439, -1741, -2150, -2857, -2830, -2496, -2012, -1592, -1167, -1306, -1222,
-    -1359, -1583, -1645, -1658, -1901, -1900, -1763, -1252, -514, -95, 213, 357,
-    989, 1304, 1223, 1390, 1501, -138, -919, -141, 728, 1886, 3000, 3576,
-    3229, 2500, 1492, 747, 92, -132, 323, 645, 458, 864, 1091, 854,
-    638, 895, 750, -102, -101, 257, 1234, 1698, 1483, 1275, 1472, 770,
-    548, 435, 49, -160, 129, 428, 355, 991, 2366, 2493, 2439, 2127,
-    1845, 1436, 1977, 2509, 2945, 3337, 3857, 3796, 3780, 4135, 4070, 3979,
-    3797, 3703, 3161, 3076, 3082, 2675, 2177, 2534, 3095, 3016, 2851, 2717,
-    2387, 1835, 1615, 990, 997, 532, 769, 1003, 1531, 1742, 1493, 1920,
-    2461, 3272, 3532, 3530, 3657, 4009, 4137, 3838, 3175, 2646, 2588, 2712,
-    3150, 3969, 4556, 4479, 4688, 4544, 4357, 4456, 4601, 4595, 4158, 3338,
-    3101, 3703, 3024, 2006, 1430, 1411, 1879, 2365, 2271, 2057, 2470, 1641,
-    1518, 1458, 1327, 1231, 1685, 1705, 2185, 1741, 1639, 1763, 2040, 3018,
-    3471, 3338, 3542, 4344, 3855, 2971, 2409, 2367, 2779, 2938, 2713, 2911,
-    2925, 2885, 3080, 2543, 2870, 2981, 3209, 2662, 2658, 2802, 2211, 1989,
-    2124, 1739, 1280, 1228, 1455, 1882, 1853, 1919, 1845, 1712, 1321, 1348,
-    1124, 943, 1089, 911, 836, 566, 915, 1125, 1241, 1316, 1904, 2339,
-    2214, 1739, 1389, 753, 531, 814, 767, 1164, 1109, 1261, 1560, 1536,
-    1340, 1179, 827, 811, 422, 576, 571, 529, 558, 359, -254, -803,
-    -1089, -1558, -1307, -974, -327, 186, -131, -304, -849, -972, -983, -1481,
-    -1555, -1084, -640, -670, -207, -44, 55, 220, 442, 1113, 1025, 314,
-    135, -54, 102, 310, 183, 119, 278, 260, 139, 490, -173, -464,
-    -529, -747, -1181, -1491, -1762, -1861, -1919, -2835, -3565, -3903, -3439, -3117,
-    -2801, -2508, -1917, -2005, -2223, -2683, -2583, -2970, -3088, -2847, -2867, -2451,
-    -1842, -1272, -893, -1319, -1403, -272, 192, -299, -406, -797, -2384, -2247,
-    -1226, -956, -446, 404, 1054, 1093, 298, -829, -1206, -1944, -2241, -2026,
-    -2088, -2034, -1938, -2144, -1664, -1766, -1192, -1330, -2599, -2943, -2380, -1848,
-    -1700, -1792, -1811, -2164, -2950, -3359, -3781, -4024, -3750, -3388, -3332, -3398,
-    -3337, -2472, -1972, -2560, -2746, -2572, -2359, -2427, -2034, -1760, -1436, -988,
-    -935, -1019, -978, -874, -821, -1221, -865, -1098, -1343, -1228, -2087, -2878,
-    -2659, -2145, -1640, -1372, -1563, -1770, -2264, -2901, -3619, -3819, -3826, -3816,
-    -3562, -3369, -2880, -2377, -2300, -1896, -1321, -1461, -1244, -735, -834, -1189,
-    -1196, -1940, -1678, -1288, -1302, -740, -267, 1, -362, -511, -547, -646,
-    -794, -825, -1243, -1408, -1809, -2530, -2710, -2894, -3600, -3751, -3230, -2525,
-    -2094, -1821, -1620, -2106, -2415, -2513, -2845, -3062, -3138, -2915, -2449, -2163,
-    -1911, -1307, -963, -411, -128, -74, -11, -63, 573, 931, 175, -394,
-    -415, -578, -409, -451, -142, -285, -87, 393, 235, 976, 1236, 1135,
-    1016, 636, 385, 59, -872, -914, -1536, -1877, -1112, -687, 89, 363,
-    239, 199, -273, -1227, -1288, -1512, -1715, -1532, -883, -533, -182, 7,
-    195, 761, 867, 1466, 1756, 2189, 2323, 1320, 1139, 1157, 1056, 1062,
-    1183, 1636, 2213, 2358, 2646, 2994, 3152, 2806, 2613, 2321, 1754, 1638,
-    980, 262, -126, -369, -676, -344, 167, 492, 233, 247, 140, -231,
-    -454, -935, -1138, -954, -213, 60, 477, 1000, 1397, 1730, 2024, 1551,
-    1994, 2292, 2734, 3370, 3031, 3132, 2954, 2976, 2940, 3135, 3421, 3966,
-    3917, 3988, 3709, 3521, 3176, 3034, 2716, 2317, 2280, 2065, 1639, 1019,
-    486, 876, 940, 914, 1060, 1199, 1448, 689, 1053, 1059, 290, 248,
-    14, -145, 155, 601, 1245, 1665, 1881, 2435, 2614, 2159, 2671, 2946,
-    3234, 2791, 2412, 3326, 1975, 1469, 2181, 2843, 3541, 4987, 5686, 4527,
-    3476, 2987, 2492, 1822, 1338, 2118, 2324, 1695, 2730, 3728, 3785, 3022,
-    2808, 1630, 1001, 1205, 1404, 2258, 2334, 2471, 2281, 1555, 1326, 1188,
-    876, 209, 229, 584, 1097, 820, 762, 1879, 1652, 1398, 1248, 842,
-    1115, 1572, 1478, 2046, 2019, 2225, 2762, 3334, 3625, 4351, 3990, 3115,
-    2590, 2153, 1955, 831, 243, 546, 1234, 1468, 1940, 1916, 1746, 902,
-    454, -386, -799, -361, -42, -376, -321, 157, 294, 484, 1291, 1640,
-    1971, 3014, 2626, 3014, 3638, 3209, 2593, 2264, 2235, 2331, 2202, 2394,
-    2420, 2381, 2190, 1940, 1917, 2192, 2054, 1736, 1510, 752, 177, -459,
-    -748, -1791, -2267, -1794, -1422, -611, -310, -349, -874, -1513, -1835, -2445,
-    -2626, -2841, -2390, -2151, -1529, -1754, -1227, -830, -831, -229, -233, -191,
-    -130, -31, 719, 1051, 547, 119, 154, -56, -788, -226, -358, 169,
-    536, 650, 240, -70, 240, 36, -217, -162, -985, -1341, -1687, -2540,
-    -2361, -2108, -1965, -1965, -2008, -1878, -2542, -2823, -3316, -3586, -4088, -3892,
-    -3139, -2926, -2852, -2526, -2216, -1989, -2216, -1615, -1459, -1669, -1608, -524,
-    -681, -719, -935, -1349, -1813, -1236, -737, -890, -415, -481, -147, 116,
-    -403, -368, -544, -902, -849, -1072, -1570, -1855, -1915, -2130, -3265, -4203,
-    -4057, -3811, -3054, -2599, -2352, -2832, -3007, -3605, -3748, -4276, -4420, -4700,
-    -4221, -3773, -3540, -3036, -2534, -2249, -1940, -1090, -765, -354, -630, -845,
-    -1131, -1646, -1881, -1247, -751, -196, -170, -42, 199, 519, 66, -535,
-    -677, -1375, -2081, -2687, -2565, -2238, -2258, -2639, -2723, -2355, -2375, -2255,
-    -2190, -2319, -2559, -3177, -2930, -2636, -2944, -2719, -2254, -2479, -2582, -2267,
-    -2135, -1788, -1496, -1141, -1547, -1519, -797, -417, -247, -1367, -2631, -2850,
-    -1676, -1193, 560, 1885, 1746, 1135, -379, -1157, -1394, -1542, -1633, -576,
-    -1356, -1178, -1236, -1088, -1122, -1343, -988, -1402, -2675, -2893, -2106, -1652,
-    -1715, -1684, -1673, -1988, -2017, -2856, -2928, -2787, -3017, -2527, -2121, -2638,
-    -1585, -566, -300, -694, -949, -1308, -863, -657, -487, -454, 14, 968,
-    1022, 1580, 2028, 1971, 1512, 714, 57, -352, -580, 152, -737, -1508,
-    -1256, -1094, -728, -371, -454, -1096, -1059, -1325, -1862, -2154, -2102, -1730,
-    -1309, -1087, -1036, -516, -278, 124, 921, 1224, 941, 1741, 2664, 2944,
-    2701, 2287, 1793, 1583, 2048, 2184, 2297, 2505, 2757, 2777, 2735, 3333,
-    2846, 2936, 2406, 2018, 1217, 589, 102, 868, 439, -616, -659, -143,
-    320, 523, 677, 120, -316, -302, -742, -893, -290, -554, -649, -698,
-    -518, 215, 30, -90, 194, 1008, 1522, 1803, 3232, 3283, 2673, 1749,
-    1679, 1331, 1721, 2236, 2414, 2979, 3565, 3909, 4220, 4330, 3755, 3141,
-    3109, 2502, 2705, 2329, 2465, 1545, 369, 361, 595, 1174, 1498, 1771,
-    1759, 1136, 630, 345, 165, 64, 25, 22, -122, 25, 136, 151,
-    841, 1081, 1233, 1558, 2644, 4040, 4048, 3383, 2825, 1638, 1753, 2059,
-    2495, 2696, 2990, 3074, 3720, 3718, 3974, 3733, 3297, 2909, 2182, 2339,
-    2070, 1374, 1249, 729, 372, -66, 28, 134, 412, 822, 828, 306,
-    -69, -195, 35, -112, -116, -59, 358, 533, 378, 952, 1027, 692,
-    1768, 2311, 3388, 3556, 3245, 2546, 1614, 1416, 1956, 2616, 3267, 3607,
-    3729, 3953, 3628, 3206, 2635, 2731, 2869, 2414, 2101, 1597, 1155, 917,
-    403, -201, -397, -392, 51, 798, 937, 1101, 70, 163, -324, -532,
-    -623, -565, -327, -134, -257, 207, 315, 175, 581, 425, 1103, 2466,
-    2773, 1975, 2116, 1273, -287, -156, 653, 1858, 3180, 3942, 3562, 3361,
-    2331, 1002, 851, 548, 1211, -245, -80, 1143, 1861, 1429, 348, 369,
-    480, -724, -1129, -939, -251, 197, 312, -209, -495, -1180, -1539, -1582,
-    -1758, -1718, -1449, -1318, -2129, -886, 525, 324, -310, -452, -770, -703,
-    -102, 412, 543, 958, 1098, 900, 804, 924, 1157, 1431, 1185, 837,
-    362, 886, 318, -1138, -1871, -1760, -678, -623, -657, -943, -1021, -1571,
-    -2596, -2833, -2799, -2651, -2716, -2613, -2168, -1507, -1091, -1131, -903, -608,
-    -536, -922, -594, 723, 873, 307, 96, -385, 248, 312, 408, 655,
-    964, 1014, 1125, 1145, 1400, 882, 681, 167, -236, -455, -1466, -1803,
-    -1883, -2888, -2651, -1937, -1637, -1378, -973, -1237, -2238, -2947, -3283, -3719,
-    -3860, -3691, -3488, -3200, -2680, -2486, -2368, -2568, -2422, -1997, -1752, -1736,
-    -779, 341, -72, -893, -1392, -1871, -1920, -1456, -1170, -794, -234, 40,
-    -10, 172, 137, -63, -635, -853, -995, -1097, -1034, -1329, -2203, -2965,
-    -3066, -2624, -2074, -1626, -1430, -1393, -1833, -2948, -3484, -3545, -2964, -2930,
-    -3015, -2780, -2663, -2211, -2445, -2066, -1808, -1216, -728, -762, 264, 360,
-    90, -446, -1162, -965, -855, -873, -393, -150, -21, 371, 842, 1254,
-    1396, 794, 109, -280, -283, -980, -1867, -2363, -2088, -2090, -2417, -2516,
-    -2703, -2716, -2304, -2131, -1955, -2397, -2398, -2188, -2307, -2648, -2729, -2532,
-    -2961, -2635, -2441, -1786, -1516, -753, 285, 436, 738, 1160, 137, -246,
-    84, 59, 236, 671, 904, 1661, 1856, 1909, 1828, 1531, 1257, 1017,
-    594, 87, -516, -887, -1435, -1376, -1554, -1257, -1435, -1512, -1187, -1600,
-    -1391, -1590, -2033, -2235, -2198, -2197, -2132, -1858, -1432, -1083, -1099, -1215,
-    -667, 140, 582, -566, 630, 821, 929, 869, -661, -1308, -365, 784,
-    1731, 2033, 2835, 3135, 2779, 2027, 1107, 636, 335, 722, -474, -631,
-    379, 933, 782, 380, -43, 333, -628, -1650, -1438, -898, -306, -111,
-    475, 441, 110, -102, -987, -1225, -1131, -1293, -978, -940, -480, 160,
-    425, 238, 124, 271, 234, 554, 888, 1716, 2467, 2908, 3142, 2828,
-    2675, 2506, 1858, 2094, 2145, 2240, 1882, 1501, 1236, 886, 465, 685,
-    684, 966, 959, 643, 356, -10, 68, -19, 163, -46, 544, 904,
-    869, 1079, 1627, 1630, 1742, 1367, 1355, 1377, 2139, 2679, 3088, 3533,
-    3650, 3754, 3303, 3259, 3038, 2993, 3376, 3201, 2955, 3075, 2614, 2333,
-    1988, 1631, 1444, 1331, 1198, 1297, 1350, 898, 603, 212, 499, 644,
-    1042, 742, 337, 281, 765, 1162, 1102, 1039, 560, 317, 336, 299,
-    636, 752, 822, 744, 485, 640, 923, 1054, 902, 1340, 1281, 1311,
-    1395, 1366, 1393, 1308, 963, 1404, 1770, 1601, 1335, 1641, 1817, 1638,
-    1620, 1744, 1800, 1528, 1369, 1366, 985, 1053, 1134, 981, 1055, 934,
-    900, 936, 969, 1125, 1078, 1066, 943, 908, 1170, 1306, 1142, 1295,
-    1213, 1085, 1267, 1172, 1043, 1178, 1592, 1501, 1398, 1491, 1412, 1226,
-    1049, 1132, 1015, 1059, 702, 372, 742, 733, 521, 518, 400, -109,
-    87, 472, 172, -195, 147, 35, 123, 100, -288, -335, -513, -127,
-    -63, -280, -253, -268, -369, 124, 76, 97, 287, 139, 132, 243,
-    339, 443, 411, 142, 8, 161, 481, 855, 854, 797, 685, 392,
-    90, 55, 204, 341, 379, 164, -144, -314, 13, 206, -107, -542,
-    -244, -681, -764, -844, -875, -726, -941, -1232, -895, -885, -951, -727,
-    -748, -739, -972, -891, -705, -871, -864, -739, -994, -935, -1150, -1178,
-    -973, -970, -684, -540, -477, -711, -693, -628, -621, -718, -830, -937,
-    -709, -722, -746, -854, -826, -532, -468, -492, -553, -542, -751, -609,
-    -751, -820, -1006, -931, -643, -467, -527, -658, -691, -831, -793, -1126,
-    -833, -726, -963, -1004, -1129, -1385, -1533, -1474, -1271, -1145, -1130, -1191,
-    -1141, -1212, -1653, -1540, -1340, -1476, -1687, -1741, -1683, -1615, -1669, -1725,
-    -1777, -1504, -1647, -1733, -1863, -1731, -1331, -1461, -1490, -1313, -1396, -1597,
-    -1598, -1406, -1170, -998, -662, -472, -571, -458, -781, -863, -789, -749,
-    -698, -510, -739, -911, -859, -920, -688, -491, -328, -285, -425, -536,
-    -622, -783, -833, -1025, -1332, -1126, -1298, -1429, -1125, -943, -933, -1299,
-    -1505, -1717, -1479, -1519, -1719, -1877, -1757, -1909, -2097, -1978, -1903, -1775,
-    -1646, -1439, -1411, -1495, -1568, -1487, -1798, -1630, -1556, -1383, -1349, -1169,
-    -1089, -1093, -1020, -851, -695, -850, -820, -946, -875, -842, -916, -927,
-    -1058, -1145, -1034, -1105, -1105, -950, -863, -625, -705, -1048, -1207, -1125,
-    -1039, -905, -862, -840, -739, -594, -624, -741, -516, -583, -529, -377,
-    -533, -919, -1083, -1159, -909, -779, -921, -1240, -1214, -1207, -780, -692,
-    -762, -781, -862, -515, -333, -404, -378, -289, -283, -10, -133, -422,
-    -248, -311, -249, -335, -284, -414, -426, -513, -310, -355, -408, -266,
-    -134, -15, -182, -58, -80, 127, 106, 25, 31, 186, 219, 379,
-    405, 444, 555, 347, 367, 337, 488, 873, 931, 900, 658, 774,
-    1026, 1068, 1043, 1118, 1100, 978, 879, 721, 759, 766, 853, 1048,
-    1078, 1010, 1010, 1065, 979, 1162, 887, 588, 716, 767, 889, 862,
-    1015, 941, 827, 1031, 971, 758, 626, 881, 774, 975, 720, 790,
-    937, 846, 591, 657, 675, 803, 806, 759, 982, 1228, 1355, 1318,
-    1259, 1086, 1080, 1039, 1171, 1018, 1363, 1415, 1266, 906, 856, 1057,
-    1236, 1498, 1510, 1457, 1393, 1466, 1314, 1264, 1147, 1485, 1759, 1891,
-    2026, 1880, 1580, 1259, 1418, 1519, 1479, 1147, 1365, 1278, 1398, 1481,
-    1576, 1493, 1515, 1545, 1387, 1298, 1479, 1348, 1307, 1335, 1089, 1037,
-    1054, 764, 579, 830, 875, 864, 651, 709, 755, 893, 863, 843,
-    908, 797, 712, 752, 747, 609, 783, 1035, 1067, 938, 1039, 1200,
-    1164, 1433, 1641, 1524, 1440, 1401, 1528, 1791, 1634, 1666, 1668, 1583,
-    1572, 1648, 1660, 1664, 1529, 1587, 1426, 1141, 1045, 1022, 973, 1053,
-    907, 979, 1035, 991, 915, 679, 564, 609, 479, 285, 186, -39,
-    192, 195, 293, 558, 521, 592, 793, 701, 518, 331, 230, 173,
-    47, -115, -283, 19, 58, -29, 4, 248, 310, 274, 311, 271,
-    246, 322, 358, 292, 128, -29, 255, 159, 111, 119, 382, 360,
-    532, 683, 699, 603, 489, 268, 120, 125, 375, 487, 321, 475,
-    502, 485, 502, 420, 257, -193, -306, -275, -164, -321, -425, -476,
-    -514, -554, -512, -475, -616, -587, -597, -693, -790, -970, -837, -863,
-    -878, -759, -793, -747, -863, -801, -844, -857, -1071, -1035, -717, -635,
-    -806, -812, -899, -875, -803, -704, -500, -496, -444, -595, -622, -708,
-    -540, -329, -220, -132, -368, -440, -400, -228, -372, -363, -438, -352,
-    -360, -436, -582, -603, -638, -565, -475, -295, -367, -567, -539, -459,
-    -698, -817, -1009, -884, -758, -740, -956, -1082, -1113, -1042, -864, -870,
-    -901, -752, -776, -741, -805, -885, -730, -678, -421, -435, -532, -428,
-    -623, -817, -1018, -903, -962, -1058, -1068, -831, -659, -686, -723, -744,
-    -525, -379, -356, -399, -383, -512, -673, -852, -822, -853, -824, -770,
-    -617, -464, -517, -479, -349, -371, -280, -481, -648, -748, -676, -655,
-    -636, -814, -671, -497, -406, -353, -249, -322, -403, -558, -667, -702,
-    -641, -733, -705, -995, -971, -710, -482, -526, -605, -874, -859, -917,
-    -834, -876, -809, -949, -979, -844, -786, -988, -1201, -1252, -1145, -883,
-    -826, -857, -732, -792, -894, -921, -1033, -894, -744, -617, -602, -562,
-    -433, -178, -186, -178, -138, -200, -277, -308, -309, -411, -434, -390,
-    -167, -15, 15, 2, -146, -139, 39, 21, -177, -86, 151, 391,
-    101, -2, 82, 97, 35, -62, -16, 31, 9, 41, 19, 4,
-    -132, -225, -393, -458, -417, -229, 10, -79, -49, -172, -77, -249,
-    -313, -232, -139, -108, -134, -97, -122, -188, -280, -346, -168, 14,
-    114, 8, -138, -116, -329, -400, -320, -198, -59, -101, -128, -25,
-    -147, -279, -126, 8, 10, 55, 235, 428, 424, 279, 115, 96,
-    161, 310, 295, 258, 350, 333, 422, 400, 312, 400, 422, 559,
-    342, 253, 288, 285, 444, 316, 252, 13, 228, 284, 405, 522,
-    91, 46, -4, 189, 191, 30, -12, 27, 11, 36, 187, 70,
-    64, -71, -157, -164, 27, 164, 176, 187, -53, -157, 150, 280,
-    244, 202, 243, 685, 708, 613, 754, 894, 788, 821, 475, 635,
-    542, 521, 844, 886, 687, 691, 960, 1152, 897, 894, 903, 650,
-    636, 860, 991, 866, 590, 495, 380, 523, 626, 654, 710, 599,
-    550, 684, 799, 974, 1067, 765, 861, 793, 522, 277, 233, 665,
-    841, 562, 301, 725, 1111, 958, 873, 750, 742, 692, 693, 715,
-    1184, 1362, 993, 893, 1009, 1086, 873, 984, 985, 899, 686, 481,
-    721, 634, 963, 766, 588, 924, 639, 617, 588, 789, 886, 690,
-    653, 550, 457, 647, 704, 551, 544, 806, 890, 746, 919, 827,
-    898, 899, 750, 934, 730, 863, 1002, 1164, 1066, 698, 349, 336,
-    977, 1059, 954, 833, 524, 535, 853, 624, 323, 376, 494, 526,
-    207, 436, 348, 398, 420, 357, 239, 400, 256, 285, 146, -15,
-    277, 105, 461, 867, 566, 546, 584, 893, 673, 447, 508, 140,
-    -241, -15, 183, 555, 273, 446, 261, 522, 326, 11, 34, 450,
-    333, -377, 43, 340, 95, 147, -251, -21, -299, 205, -28, -829,
-    89, -249, -234, 319, -406, 71, 549, -2, 243, -566, -409, -429,
-    -40, -121, -706, -540, -82, -323, -13, -375, -554, -637, -180, -75,
-    -354, -99, 235, 93, -583, -803, -581, -637, -123, -1065, -329, -323,
-    -605, -374, -682, -365, -576, -687, -1092, -647, -668, -304, 8, -805,
-    -80, -210, -870, -439, 80, 41, -320, 121, -28, 12, -574, 17,
-    224, -755, -277, -184, -1236, -1240, -189, -73, -619, -756, -656, 415,
-    142, -1681, -576, -114, -825, -831, -832, -431, -1605, -273, -22, -1053,
-    -1183, -636, -304, 226, -573, -407, 90, -169, 662, -588, -1348, -862,
-    -1419, -1315, -1269, -1315, -1491, -2127, -48, -579, -818, -1423, 411, -334,
-    -651, -161, -271, 578, -382, -870, 156, 36, 63, -260, 383, -787,
-    -1412, -886, -428, -1716, -2482, -1676, -1665, -2089, -1962, -1316, -1953, -1845,
-    -1191, -2106, -1681, -684, -93, -1216, -1820, -1070, 250, 1541, 1112, 1070,
-    2698, 1923, 510, -1075, -492, -544, -890, -677, -962, -639, -299, -9,
-    -262, 922, 1148, 1917, 757, -334, -316, -591, 1, -1662, -460, 276,
-    -2044, -790, -920, -1938, 74, -424, -327, 366, 1132, 149, 1466, 1724,
-    1990, 1678, -430, 967, 333, 330, 546, 1389, 1850, 1612, -331, -633,
-    326, 756, -454, -1246, -1284, -328, -1546, 454, 1098, 891, 1117, 1100,
-    -338, 842, 1450, 1913, 1130, 752, 2587, 2551, 1494, 1572, 1965, 1924,
-    496, 819, 250, -491, -388, 872, 1232, 1166, -475, -560, -398, -253,
-    -1454, -1436, -1321, -1840, -2178, -1322, 413, 1584, -387, -979, -378, -163,
-    -970, -414, -306, 728, 1322, 603, 1582, 2182, 1206, 696, -167, -1034,
-    -884, -1565, -373, 474, -601, 57, -752, -1299, -2629, -1041, -1576, -2040,
-    -1884, -1774, -2811, -1944, -594, -177, -2127, -1143, -782, 84, 833, -335,
-    1147, 2133, 995, -187, 2065, 1723, -405, 295, 591, 590, -1028, -1291,
-    -1681, 1099, 824, 550, 1323, -874, -1869, -3223, -3335, -2919, -3850, -3409,
-    -2144, -1872, -1884, -2016, -1591, -496, -218, -707, -938, -670, -202, 33,
-    1185, 2379, 3047, 1902, 1227, 3689, 3315, 1899, 470, 898, 280, 354,
-    1278, 128, 914, -131, -406, 25, -1680, -1610, -1074, -1418, -2057, -442,
-    -42, -681, 1230, -910, -1565, -1041, 120, 1174, 3149, 4119, 2780, 2547,
-    3253, 1605, 482, 1097, 1910, 1869, 3067, -8, -424, 2127, 1513, 1444,
-    2825, 2395, 2357, 2375, 1673, 570, -1096, -1328, -733, -25, -730, -350,
-    -1313, -2555, -322, 704, 346, 878, -190, 1368, 2561, 2216, 2967, 2732,
-    2390, 2239, 2956, 1691, 2758, 4124, 2734, 2565, 2379, 2809, 601, -719,
-    -373, -1811, -1899, 743, 377, 280, 3134, 3055, 1919, 902, 1812, 1458,
-    1094, 2239, 2521, 1957, 2693, 2718, 2586, 3420, 2558, 817, -606, -64,
-    -746, -758, 1857, 192, -297, -63, 127, -399, -1645, -3524, -1725, -467,
-    -189, -234, -1379, -1489, 358, 1149, 153, 484, -570, -387, -494, -462,
-    2237, 3875, 1828, 2433, 3203, 3233, 2151, 2586, 1242, -1019, -1008, -100,
-    1058, -110, -1623, 738, 742, -678, -2453, -2582, -2416, -4208, -4097, -1469,
-    -938, -2659, -1671, 266, 468, -599, -2452, -388, -590, -674, 573, 694,
-    1836, 2773, 1340, 1454, 1289, -101, 586, 1640, -298, -1629, -279, -57,
-    -45, 367, -221, 49, -807, -2021, -3050, -3211, -1572, -2328, -3695, -2877,
-    -1462, -1871, -1359, -105, -1532, -3051, -1570, 718, -750, 332, 2587, 2724,
-    2563, 1396, 2379, 2528, 1153, 388, 890, 373, -593, 1338, 1858, 1498,
-    493, 1819, -351, -2102, -2878, -1252, -1800, -1469, -2629, -1409, -289, 642,
-    -972, -2792, -1382, -1953, -201, 948, 530, 530, 1253, 220, -105, 1386,
-    1377, 1046, 832, 1518, 1541, 2552, 2355, 1749, 1487, 2513, 2674, 1866,
-    495, 450, -771, -467, -1792, -235, 807, 145, 585, -769, -2423, -1480,
-    -2248, -1573, 442, 445, -13, 1026, 660, 354, 2605, 1796, 1047, 94,
-    -191, -801, 1451, 1257, 329, 964, -190, -1503, -1132, 625, -1613, -2534,
-    -346, 533, 136, 991, 503, 1083, 1091, 213, -1009, 938, 16, 352,
-    2013, 3518, 3335, 2515, 2598, 1996, 2691, 1646, -236, -423, -1297, -590,
-    463, -114, -1040, -1737, -1292, -1329, -2793, -4308, -3200, -3398, -3609, -1826,
-    -1589, -3903, -2133, -624, -1408, -209, -360, -1276, -2030, -415, 613, 628,
-    945, 1164, 555, 863, 267, 309, 143, -978, -2417, -1496, 249, -1949,
-    -2325, -1172, -2047, -1666, -1241, -1976, -2681, -3131, -2679, -3070, -2501, -716,
-    859, 145, -1343, -1809, -2291, -1004, -693, -706, 586, 99, 89, 2464,
-    2939, 1450, 585, 873, 971, 380, 627, -1166, -2175, -2771, -2277, -979,
-    -664, -1436, -2672, -4146, -3798, -3808, -2730, -1549, -3547, -2871, -2235, -2842,
-    -2746, -3877, -2588, -1915, -1596, -1668, -615, 1850, 1026, -29, 1317, 1400,
-    1904, 2383, 1513, 1691, 1037, -368, 161, 1958, 2414, -471, 870, 2240,
-    811, 108, -271, -1614, -708, -75, -1064, 41, -252, -485, -226, -2006,
-    -2272, -1236, 863, 1304, 1918, 3154, 2045, 1298, 883, 913, 891, 917,
-    221, 2626, 3000, -588, -671, 1350, 3052, 2930, 2273, 3180, 2393, 1200,
-    -750, 532, -184, 1059, 3060, 214, -1352, -831, -737, -619, -387, -284,
-    992, 1073, 2701, 2113, 3792, 1354, 2292, 1867, -160, -591, 419, 1455,
-    2033, 967, 1828, 1159, 1632, 815, 452, -115, 517, -122, 1052, -357,
-    -883, 1599, 3390, 3005, 1664, 1275, 964, 1886, 2344, 2166, 3449, 3970,
-    3263, 2834, 3220, 1714, 2579, 2066, 698, -1290, 718, 695, -426, -589,
-    417, -335, -843, -848, -2437, -2430, -3172, -1960, -1281, -1892, -2552, -431,
-    -19, -628, -1992, -1402, -876, -1730, 188, 1958, 1691, 2449, 2330, 4141,
-    3274, 2846, 2697, 1140, 2186, 675, -442, 314, -1492, -1360, -196, 200,
-    -769, -2032, -1789, -1988, -2200, -1887, -2228, -3113, -4090, -3109, -3234, -2354,
-    -1808, -2453, -2748, -2426, -2243, -855, 888, 1660, 1406, 2107, 3208, 2347,
-    2664, 1694, 777, 654, 1236, 672, -426, 707, 1400, -434, 636, 534,
-    -708, -1907, -2242, -892, -2717, -1540, -3586, -2753, -1089, -1587, -2976, -3648,
-    -3107, -2312, -2651, -2611, -1518, -819, 391, 1131, 329, 267, -329, -744,
-    692, 726, -688, -1347, 848, 574, 271, 603, 744, 1094, 1143, 945,
-    254, -885, -285, 5, 651, 1456, 1996, 1606, 943, -1110, -1159, 387,
-    1359, 2647, 3896, 2923, 3236, 2502, 415, -543, 518, 1934, 1120, 1083,
-    539, -464, 337, -892, 921, 2010, 1830, 1690, 535, -313, -485, -719,
-    -2246, -538, -893, 247, 264, -1902, -949, -439, -746, 34, 1345, 3146,
-    3942, 3465, 2486, 2568, 2975, 1838, 932, 58, 533, 984, 2424, 1322,
-    499, 611, 1322, 243, -1497, -1455, -1230, -1862, -1504, -1771, -437, 2128,
-    1806, 315, -445, -318, 50, 197, 895, 2836, 2948, 3233, 4060, 4430,
-    3923, 3415, 3653, 1648, 1092, 868, 451, 1432, 763, 1663, 973, -1258,
-    -1449, -3296, -2874, -3319, -4280, -3489, -2773, -3071, -3080, -2708, -2793, -2925,
-    -4253, -3734, -4291, -4169, -2858, -1972, -1497, -738, 919, 1198, 957, 392,
-    -206, 1005, -206, -2133, -926, -562, -147, 523, 1891, 1124, 169, -137,
-    -1025, -1283, -2120, -2169, -2324, -1849, -1304, -1330, -1033, -2038, -1496, -1769,
-    -2407, -2593, -2699, -1477, -1377, -204, 1221, 939, 614, -298, -1535, -729,
-    -1964, -2404, -2571, -3634, -2637, 293, -706, -2166, -2162, -2579, -4291, -3686,
-    -2961, -3990, -2955, -3335, -1662, -526, -1477, -1261, -557, -2029, -3291, -2855,
-    -1978, -662, 119, 310, 1323, 20, 510, 1470, 683, 178, -262, -236,
-    -1132, -358, 1000, 1287, 1372, 1189, -78, -1203, -273, 166, -1034, -841,
-    -107, -1483, -1377, -430, -760, -500, -2248, -1275, -569, -379, 1908, 4034,
-    3451, 2973, 2494, 2233, 1840, 1036, 716, 622, 1232, 1575, 654, 1109,
-    1474, 1738, 2588, 2381, 1795, 1371, 1329, 1492, 305, 8, -421, 572,
-    -172, -1262, -2870, -3065, -1409, -1066, -758, 413, 670, 872, 2785, 3071,
-    3208, 2922, 2610, 1873, 1585, 2282, 1873, 1560, 3140, 2161, 2166, 1656,
-    1391, 398, 19, 513, 49, 275, 453, 18, 180, 2323, 2165, 774,
-    -827, -595, 427, 174, 393, 1912, 2328, 3514, 3453, 3544, 3709, 3130,
-    3357, 1892, 570, 478, 335, 1007, 1570, 1219, 1124, 1571, -216, -1227,
-    -2285, -2564, -2346, -3577, -1706, -1116, -1516, -1627, -439, -319, -1701, -1715,
-    -630, -688, -652, -255, 598, 791, 1246, 1046, 829, 162, 292, 78,
-    -1281, -1788, -639, -93, 925, 1214, 148, -131, -491, -2197, -3418, -3305,
-    -2401, -2157, -1976, -1971, -449, -319, -26, -433, 22, -888, -910, -1354,
-    -771, -349, -109, 1538, 1846, 1342, 1965, 2118, 1005, -40, 103, -405,
-    214, 227, 475, 212, 230, -299, -2220, -3144, -1492, -2675, -2472, -2315,
-    -2808, -2853, -1658, -1979, -2155, -3212, -2150, -2148, -1657, -980, -542, -41,
-    679, 523, 1072, 730, 744, -424, -1308, 47, 106, 204, 564, 561,
-    1279, 1752, 2437, 1783, 847, 209, 436, 1522, 1085, -46, -1273, -224,
-    652, 308, 696, 156, 180, 1519, 1861, 1165, 1000, 547, 1347, 2525,
-    1554, 824, 915, 1075, 2356, 2469, 2273, 1650, 1951, 1600, 1800, 987,
-    366, 1041, 903, 382, -836, 411, 743, 727, 247, 230, 492, 108,
-    6, 641, 182, 65, 122, 499, 506, -250, 831, 1735, 1873, 1671,
-    1235, 1573, 1919, 2125, 1945, 1068, 937, 1485, 1740, 1448, 1680, 1617,
-    1384, 1602, 1522, 1184, 1628, 1559, 925, 991, 674, 114, -179, 173,
-    1053, 1944, 1439, 1277, 319, 277, 708, 1487, 550, 334, 754, 726,
-    327, 259, -650, -515, -167, 535, 90, 352, 131, -693, -450, -727,
-    -1121, -1523, -1770, -819, -775, -78, 390, 499, -476, -639, -909, -1185,
-    -1451, -1074, -1164, -687, -953, -1161, -956, -1195, -1372, -1195, -1670, -2206,
-    -1298, -960, -973, -228, 62, -310, -1266, -1210, -1249, -270, -1159, -649,
-    153, -445, -831, -127, 300, 19, -357, -1781, -1343, -760, -1033, -686,
-    -193, 249, -308, -164, -637, -889, -1685, -1790, -1580, -1009, -1188, -635,
-    -1263, -1050, -326, -219, -1373, -1539, -1247, -2089, -2086, -1726, -1970, -1830,
-    -1302, -1217, -205, -1067, -1954, -2246, -2160, -581, -823, -741, 30, -73,
-    -422, -337, 315, 318, -829, -6, 703, 1333, 1167, 95, 53, 450,
-    656, 1021, 1050, 967, 1288, 976, 212, 799, 1201, 914, 484, 522,
-    471, -207, -309, -105, -318, -935, -355, -97, 601, 1360, 1294, 1322,
-    929, 489, 469, 529, 1658, 1864, 986, 391, 1517, 1177, 728, 1510,
-    703, 1062, 669, 725, 1067, 1101, 76, -143, 71, 809, 529, 463,
-    -33, 260, 1106, 1339, 516, 384, -721, -1187, -760, -666, -586, -456,
-    -346, 243, 510, -16, -612, -359, -108, 270, 864, 879, 1891, 1368,
-    516, 756, 1468, 1007, 643, 1609, 2249, 2143, 1866, 1562, 984, 1757,
-    1090, 449, 210, 639, 772, 433, 42, 270, 110, 370, -440, -180,
-    -1173, -1240, -791, -1282, -2270, -2078, -1967, -1127, -823, -1414, -1348, -1918,
-    -1559, -1419, -1776, -1613, -1142, -879, -891, -1536, -1522, -1180, -947, -1043,
-    -720, -528, -875, -851, -666, -75, -349, -903, -493, -504, -162, -678,
-    -938, -344, -130, -617, -319, 122, 0, -182, -521, -813, -636, -910,
-    -432, -122, -435, -565, -1043, -1227, -864, -1341, -1104, -629, -363, -14,
-    433, 157, 430, 394, 364, 286, 1111, 1008, 504, 107, -790, -582,
-    5, -570, -838, -562, -683, -468, -734, -537, -479, -1210, -1026, -1201,
-    -1186, -1731, -1369, -1205, -1685, -1398, -1741, -1582, -805, -542, -850, -447,
-    -209, -311, 155, 960, 847, 993, 1644, 656, 499, 695, 580, 1469,
-    2101, 1854, 1498, 1107, 1481, 1840, 2019, 1655, 2619, 2615, 2202, 1616,
-    1477, 1442, 1246, 1203, 1059, 1127, 966, 7, -407, 8, -52, 43,
-    653, 629, 379, -51, -606, -153, -450, -422, -424, -264, 641, 859,
-    452, 691, 62, -205, -104, 258, 545, 856, 842, 1054, 868, 627,
-    1514, 1261, 1533, 1660, 802, 859, 1652, 777, 835, 92, -125, 210,
-    453, -277, -691, -550, -727, 269, 887, 1315, 1500, 1458, 1266, 811,
-    513, 672, 655, 730, 505, 765, 1015, 1411, 1435, 1329, 499, 274,
-    1265, 897, 669, 417, 913, 788, 884, 830, 1353, 928, 336, 29,
-    -3, -150, 109, -337, -344, 81, -549, -500, -747, -1170, -1601, -1367,
-    -1260, -1156, -1476, -1776, -2016, -2167, -1731, -1880, -2368, -1669, -830, -1047,
-    -970, -429, 29, -252, -162, 474, 864, 370, -229, -480, -196, -475,
-    -158, 5, 173, -19, 595, 750, 868, 390, -303, -421, -3, 113,
-    -525, -452, -652, -1307, -1482, -669, -769, -385, -701, -1037, -315, 397,
-    391, -403, 184, 526, 419, -253, -905, -1108, -1036, -666, -500, -844,
-    -946, -1344, -1106, -1266, -1770, -1475, -1706, -1522, -834, -758, -96, -76,
-    -404, -661, -948, -613, -549, -891, -687, -353, -168, -830, -1050, -939,
-    -747, -158, 230, -61, -475, -1036, -445, 102, 801, 488, 168, 455,
-    666, 934, 881, 821, 940, 1524, 1931, 1843, 1858, 1249, 1367, 1923,
-    1790, 1564, 2229, 1808, 1778, 1825, 1458, 1787, 696, 389, 565, 424,
-    -126, -675, -532, -767, -1080, -161, 20, 47, -131, -178, -19, 137,
-    -173, -289, -220, -925, -379, 87, 140, 212, -22, -491, -337, 836,
-    1038, 602, 126, 144, 9, 332, 134, 769, 876, 954, 854, 884,
-    602, 196, 450, 581, 742, 909, 785, 918, 698, 540, 1080, 845,
-    -15, 563, 769, 858, 891, 681, 302, -556, -728, -411, -35, -101,
-    239, 178, 303, 339, 225, 659, 599, 165, -556, -1181, -1161, -1264,
-    -986, -793, -508, -599, -940, -839, -550, -1074, -1496, -1571, -1202, -1850,
-    -2030, -1892, -2069, -2425, -2040, -2570, -2159, -1885, -1672, -1584, -1289, -642,
-    -892, -1410, -1042, -824, -480, -651, -772, -764, -792, -527, -47, -261,
-    21, -561, -396, -377, -672, -409, -242, -186, 321, 19, 341, 748,
-    649, 255, -422, -776, 44, -66, -374, -491, -322, -495, -610, -1119,
-    -725, -706, -729, -158, -456, -10, -756, -1103, -846, -573, -1012, -1381,
-    -545, -325, -592, -892, -686, -371, -268, -393, -142, -553, -939, -556,
-    40, 468, 822, 684, 695, 1171, 979, 434, 387, 168, -170, 49,
-    -336, -709, -475, -406, -318, -529, 311, 109, 727, 1161, 858, 1441,
-    1955, 1779, 1877, 1254, 725, 987, 1354, 1845, 2120, 1235, 1190, 1541,
-    2083, 2206, 2287, 1786, 1505, 1066, 1219, 1863, 1577, 1221, 1359, 902,
-    1552, 982, 738, 841, 188, 283, 123, -496, 174, 155, 396, 326,
-    -459, -327, 131, 270, 484, 367, 210, -18, 190, 513, 1039, 927,
-    619, 376, 404, 448, 324, 407, 662, 734, 381, 414, -260, -193,
-    52, -45, 223, 468, 636, 886, 1306, 1625, 1736, 1734, 1746, 1122,
-    421, 132, 1, 114, -46, -344, 165, 662, 486, 464, 979, 1164,
-    326, 406, 1182, 474, -16, 274, 548, 411, -100, -353, -356, -877,
-    -828, -602, -879, -1715, -2101, -1563, -1021, -288, -997, -1319, -792, -1002,
-    -1364, -1324, -1062, -1044, -1578, -1197, -1279, -1630, -2352, -1889, -2066, -2138,
-    -2040, -1424, -1193, -603, -925, -650, -218, -471, -431, -1150, -712, -772,
-    -806, -465, -225, -86, 123, -51, 541, 265, -262, -427, -539, 122,
-    487, 138, 479, 497, 627, 617, 399, 323, 300, 409, -435, -840,
-    -1132, -1045, -1180, -1521, -1207, -1478, -1883, -2055, -1957, -1989, -1619, -1144,
-    -628, -151, -648, -998, -1150, -1486, -1322, -924, -1187, -863, -606, 75,
-    931, 922, 294, -23, 177, 532, 605, 384, 782, -89, 181, 733,
-    829, 1047, 1184, 950, 385, 386, 736, 790, 711, -34, 471, 1045,
-    983, 1017, 1177, 1392, 1442, 1453, 1629, 839, 1420, 1512, 1646, 1439,
-    1377, 1407, 870, 918, 975, 1022, 1464, 1525, 1749, 1270, 843, 1219,
-    937, 430, 375, 246, 537, 1216, 1400, 1636, 1272, 1574, 2134, 1823,
-    1468, 1231, 741, 524, 366, 330, -183, 95, -94, 480, 818, 831,
-    574, 603, 1076, 596, 110, 880, 955, 687, 464, 946, 1019, 621,
-    469, 701, 859, 647, 933, 759, 1029, 1296, 1180, 1107, 750, 1166,
-    1615, 1343, 1160, 867, 1122, 16, -121, 393, -148, -482, -1250, -1361,
-    -1566, -1163, -1046, -713, -918, -1205, -934, -756, -828, -1087, -1154, -905,
-    -1180, -1226, -1436, -1843, -1207, -1585, -2350, -2391, -1872, -1768, -1659, -1644,
-    -1556, -1524, -922, -330, -805, -811, -195, -249, -83, -304, -397, -575,
-    -1292, -1561, -1549, -1052, -1449, -1900, -2010, -1928, -1762, -1775, -1670, -1370,
-    -1219, -1420, -429, -820, -913, -1339, -1283, -1014, -1429, -872, -1159, -1134,
-    -660, -537, -771, -270, -246, -127, -810, -436, 378, 378, -311, -198,
-    -109, -51, -393, -1632, -1354, -769, -1141, -1314, -999, -657, -1206, -1380,
-    -1166, -575, 528, -204, -1077, -475, -434, -818, -1242, -1427, -597, -380,
-    -457, -201, 223, 443, 847, 769, 528, 870, 856, 993, 1190, 1498,
-    575, 430, 621, 876, 630, 488, 948, 835, 1236, 1667, 2141, 2314,
-    1729, 1649, 1821, 1140, 549, 612, 112, -87, 647, 1371, 2622, 2247,
-    435, 164, 1288, 2554, 2098, 2378, 3323, 3392, 1774, 1378, 696, -40,
-    119, -49, -337, 835, 28, -569, 623, 1620, 2379, 2026, 1568, 840,
-    676, 639, 223, -3, 1216, 1301, 896, -232, -989, -2086, -1621, -146,
-    -127, -335, 325, 426, 1107, 1952, 2003, 2719, 1237, -21, 70, 1257,
-    1769, 1787, 2244, 1882, 1247, -338, -590, -806, -836, -1345, -586, -331,
-    -652, -748, 173, 483, 1067, -95, -1081, -20, 64, 420, 841, 2156,
-    1935, 1750, 1083, 902, 802, 1122, -663, -1988, -929, -945, -1709, -709,
-    -323, -882, -1361, -1896, -1529, -2592, -3593, -3646, -3529, -3196, -4072, -3392,
-    -1727, -1218, -2404, -2828, -2781, -1027, -1092, -1480, -590, 389, 307, 556,
-    600, 1552, 708, 687, 124, -1695, -1694, -1539, -841, -254, -325, -1082,
-    -1271, -1638, -1296, -1680, -2616, -2353, -1575, -1727, -2659, -2382, -1026, -569,
-    -109, -1106, -975, -627, -178, -998, -1584, -742, 42, 212, -265, 407,
-    628, 699, 181, -903, -1031, -1117, -1428, -989, 494, 1450, 1102, 121,
-    -127, 195, 166, -1364, -1048, -735, -821, -1298, -827, 133, 773, 520,
-    -175, 560, -194, 324, 1217, 1972, 1594, 2565, 3848, 3572, 3167, 2205,
-    2259, 1732, 710, 601, 1208, 2063, 2662, 1490, 1159, 1756, 1904, 1129,
-    -57, 560, 118, -191, -1029, 273, 725, 320, 1026, 1623, 124, -112,
-    548, 2761, 3574, 3140, 2053, 3266, 3089, 1660, 1866, 2668, 2485, 1570,
-    2673, 1921, 1345, 1080, 1823, 1877, 2390, 2505, 2003, 828, -291, -1248,
-    -1404, -1888, -241, 896, -625, -1957, -1889, -1228, -1, 170, 332, 730,
-    295, 907, 2017, 1822, 1492, 1455, 1259, 421, 110, -679, 603, 980,
-    84, -180, 94, 29, 380, -397, -295, -865, -891, -611, -890, -1578,
-    -384, 642, -904, -2250, -1169, -74, 462, 399, 530, 1603, 1917, 1799,
-    960, 996, 204, -385, -2161, -2798, -1825, -1956, -1790, -2479, -1820, -879,
-    -1975, -2155, -2856, -3600, -5347, -4229, -2493, -3193, -4131, -3115, -694, -601,
-    -2024, -2422, -1462, -2089, -2796, -2438, -1311, -991, 1251, 1821, 403, -348,
-    309, 653, -607, -1553, -2031, -2539, -2034, -1182, 268, -163, -1804, -1730,
-    -1294, -1790, -2070, -1692, -1592, -1354, -2394, -1933, -1215, -515, -1971, -1935,
-    -2662, -2454, -1588, -1712, -1075, -483, 593, 690, 1071, 758, 553, 363,
-    883, -17, -1006, -1893, -173, 1162, 1035, -485, -402, -510, -359, -1586,
-    -1871, -2195, -674, -1214, -1179, -1046, -1702, 69, 527, 397, 624, 127,
-    -256, 474, 1525, 1470, 1063, 2702, 4041, 4264, 2549, 3447, 2724, 1768,
-    2505, 1428, 1889, 3594, 3946, 3088, 2168, 2641, 1752, 926, 177, -262,
-    696, 184, -466, 614, 1895, 1167, 643, 1176, 2242, 1789, 1394, 3580,
-    4532, 3619, 3347, 2624, 2480, 2410, 2053, 1067, 1523, 2157, 1420, 594,
-    624, 997, 1858, 976, 530, 1735, 1868, 1711, 1092, 922, 96, -1579,
-    -142, -29, 265, -805, -876, -722, -805, -260, 1277, 2746, 3150, 2297,
-    1262, 2149, 1613, 1610, 448, 299, 664, 1093, 1050, 1005, 2162, 1135,
-    739, 632, -991, -1684, -1546, -2542, -1964, -1481, -1374, -1041, 499, 514,
-    -1208, -1320, 207, 878, -577, -431, -691, 689, 922, 620, 917, 190,
-    906, 178, -761, -1484, -1283, -873, -503, 227, -1718, -1940, -2215, -3288,
-    -2930, -3137, -2329, -3667, -3093, -2330, -2332, -2121, -978, -1431, -1899, -2921,
-    -2844, -2451, -2001, -1465, 175, -412, -461, -213, 345, 1622, 1475, 471,
-    -418, -483, -1630, -2113, -1413, -331, 578, 147, -1212, -1053, -856, -1155,
-    -1292, -2094, -3473, -2724, -2055, -2704, -1611, -870, -1617, -2538, -2328, -215,
-    -203, -87, -37, 101, 1080, 723, 113, 620, 376, -695, -949, -1326,
-    -821, -509, 566, 1595, 1320, 364, 449, 597, -590, -1372, -1256, -1249,
-    -207, -1355, -1335, -1181, -833, -225, 591, 19, -712, -778, 772, 2410,
-    2748, 2910, 2688, 2224, 2330, 2834, 3457, 3624, 3024, 1992, 1047, 1716,
-    1303, 1277, 1216, 1246, 1063, 1063, 169, 221, -268, -902, -126, 655,
-    87, 995, 666, 1025, 817, -509, -233, 643, 1411, 3646, 4633, 5227,
-    4158, 2172, 1750, 2301, 1718, 1992, 1991, 1415, 2097, 1910, 1694, 1129,
-    1713, 1905, 2160, 1387, 1480, 1732, 92, -629, -641, 235, 767, -141,
-    -1356, -2366, -1625, -1332, -313, -68, 459, 1277, 890, 2483, 2775, 1484,
-    514, 1579, 708, -141, -241, -71, 259, 219, -50, 435, -193, 609,
-    -779, -1707, -1056, -856, -1219, -961, -1935, -644, 700, 1147, -405, -1129,
-    -699, -1226, -2496, -1821, -123, 94, 784, 420, -755, -882, -526, 161,
-    12, -892, -849, -405, -1338, -1440, -2291, -1551, -1110, -1999, -2333, -2489,
-    -3482, -4020, -3644, -1080, -2742, -2644, -2225, -1979, -2231, -2199, -2236, -1979,
-    -1349, 173, 872, 615, 824, 863, 2055, 918, 264, 177, 833, -311,
-    -833, -971, -347, -405, -195, 219, -130, -1532, -1960, -1992, -2090, -2375,
-    -2435, -1567, -2792, -2522, -1993, -2297, -2212, -2223, -2740, -1951, -417, 151,
-    -38, 523, 1182, 2131, 2578, 1474, 1594, 2250, 1572, 503, -1267, -939,
-    354, 193, 116, 771, 956, 325, 353, -1048, -1613, -932, -1576, -586,
-    334, -118, 1034, 1241, 426, 23, 80, 1385, 1295, 183, 1682, 1991,
-    3997, 4113, 3182, 3203, 3458, 2649, 1907, 1181, 689, -543, 234, 1178,
-    2082, 2644, 2521, 1737, 1268, 1742, 827, 714, 331, 353, 292, 1701,
-    2620, 2437, 1487, -422, -803, -150, 2012, 4431, 4781, 3795, 2513, 1601,
-    1696, 2334, 2376, 1333, 1010, 1526, 1161, 196, -109, 489, 1236, 1679,
-    1448, 2521, 1878, 1547, -30, -635, -1036, 311, 440, 237, 251, -556,
-    -1640, -699, 46, 1672, 1100, 1580, 1491, 1873, 1857, 1890, 2338, 2896,
-    1446, 1179, 1438, 2276, 2396, 935, 352, 239, -120, -1110, -593, -1116,
-    -1759, -1635, -2500, -3129, -2157, -832, -711, -607, 144, -982, -1838, -1621,
-    -1369, 76, 1208, 1897, 1466, 304, 475, 1102, 1008, 638, -367, -1529,
-    -1691, -1348, -2093, -2090, -1991, -1951, -1943, -2500, -3389, -3928, -3588, -4413,
-    -4279, -3556, -4123, -2477, -2136, -2359, -2256, -3306, -2542, -2232, -2215, -1629,
-    -856, -921, -837, -492, -111, -522, -15, 1119, 656, -454, -1475, -1077,
-    -1299, -1378, -1010, -1598, -1052, -1560, -1470, -1224, -2428, -3016, -2584, -3140,
-    -3781, -2832, -1033, -411, -1021, -1689, -1812, -1324, -834, 404, 599, 1220,
-    1003, 327, 7, 405, 571, 1310, 1333, -30, -776, -1251, -616, -587,
-    5, 974, 843, 7, -1031, -1008, -940, -1692, -742, -252, -1361, -454,
-    998, 1465, 2055, 1622, 329, 905, 1237, 2170, 2912, 3411, 2552, 3234,
-    4599, 4448, 3610, 3115, 2768, 1209, 950, 859, 1266, 2091, 1249, 1462,
-    859, 140, -162, 1355, 1549, -258, 604, 409, -296, 1276, 2170, 1923,
-    -95, -759, -281, 701, 2626, 3845, 3610, 3750, 2708, 2227, 2728, 2469,
-    2100, 1448, 1219, 2429, 1903, 74, 388, 1096, 1268, 1757, 1487, 2071,
-    1757, 791, 533, -537, -1123, 42, 6, -575, -1859, -2077, -1614, -1392,
-    -1043, -179, 356, 1767, 2028, 1892, 2443, 2408, 2163, 1840, 974, 593,
-    1574, 2324, 1773, 735, -204, -471, -453, -1144, -731, -1026, -1503, -1754,
-    -1211, -2023, -1987, -920, -472, -409, -126, -733, -844, -1330, -1601, -790,
-    -1043, -315, 483, 783, 344, -407, 234, 4, -1498, -1495, -1525, -1244,
-    -1023, -1931, -2142, -1880, -2515, -2954, -3386, -4429, -4709, -3348, -3019, -2658,
-    -3186, -3575, -1901, -768, -1731, -2084, -2325, -2482, -1468, -159, 283, 478,
-    880, 405, -118, -327, -29, -130, -927, -1683, -1843, -1317, -1947, -2058,
-    -1379, -1699, -2311, -2546, -2934, -3053, -2967, -2870, -3460, -3239, -2132, -1141,
-    72, -237, -546, -869, -734, -411, -914, -726, 129, 1153, 1500, 1961,
-    1632, 1266, 1546, 1065, -117, -436, 300, 309, -590, -348, -29, -49,
-    -478, -392, -777, -857, -1156, -1124, -366, -250, -55, 634, 61, 596,
-    1283, 1407, 1612, 1518, 1935, 2688, 2453, 2821, 3377, 2631, 2195, 2186,
-    2247, 2627, 2655, 1979, 1328, 1063, 732, 497, 737, 955, 1222, 870,
-    880, 885, 712, 1163, 997, 480, 852, 1246, 1896, 2507, 1970, 1841,
-    1694, 1204, 1258, 1525, 1253, 1718, 2965, 2346, 1718, 1213, 1511, 2168,
-    2103, 1516, 683, 841, 726, 820, 699, 480, 680, 160, 411, 693,
-    592, 710, 524, 485, 665, -24, 802, 1393, 1306, 1002, 831, 543,
-    284, 439, 1493, 1481, 1227, 1012, 613, 1236, 1272, 361, -69, -7,
-    -283, -704, -959, -870, -218, 310, 321, 445, -145, 507, 680, 56,
-    148, -169, -565, -988, -257, -415, -909, -1739, -1290, -760, -1342, -965,
-    -638, -1126, -1391, -1311, -2139, -2439, -2744, -3200, -3429, -3307, -3045, -3035,
-    -2835, -2398, -2557, -2842, -2956, -2469, -2534, -1489, -294, -1300, -1178, -1301,
-    -1202, -1044, -1899, -1212, -1232, -1451, -766, 19, -39, 104, -52, -381,
-    -1002, -1607, -1569, -1738, -2119, -1869, -1541, -1419, -1574, -2036, -2012, -2020,
-    -1793, -1963, -1866, -1347, -1737, -1475, -1121, -746, -264, -439, 516, 385,
-    405, -638, -819, -1001, -618, -840, -93, 100, 480, 805, 337, 258,
-    128, -406, -395, -286, -703, -234, -520, -217, -380, -458, 311, 598,
-    748, 1217, 1326, 1236, 925, 754, 669, 716, 1299, 1478, 1081, 971,
-    982, 945, 1540, 1524, 1478, 1426, 1420, 1390, 1239, 1086, 1115, 1104,
-    1278, 1636, 1715, 1609, 1013, 1171, 1162, 744, 1231, 1596, 1297, 1260,
-    1390, 1338, 1362, 1437, 1502, 1698, 1808, 1348, 1293, 1132, 723, 524,
-    740, 378, 440, 751, 750, 389, 59, 175, 215, 664, 587, 363,
-    161, 344, 7, -127, 90, 317, 207, 342, 666, 832, 1128, 1258,
-    1088, 783, 779, 1107, 833, -32, 304, 597, 203, 275, 918, 1059,
-    871, 917, 940, 589, 125, -467, -813, -1052, -1475, -1536, -1678, -1458,
-    -1636, -1626, -1152, -762, -1221, -1010, -720, -352, -631, -597, -642, -929,
-    -315, -176, -380, -814, -1022, -913, -635, -546, -476, -99, -219, -484,
-    -966, -1473, -1420, -1548, -1510, -1338, -1320, -1151, -1466, -1664, -2247, -2686,
-    -2417, -2177, -2048, -1666, -1280, -1161, -816, -807, -1025, -706, -528, -519,
-    -699, -1505, -1417, -1335, -1173, -925, -591, -844, -522, -562, -395, -481,
-    -1240, -1364, -1434, -1240, -1391, -1608, -1370, -1840, -1752, -1173, -970, -891,
-    -910, -152, 179, 109, 249, -104, -128, -43, -483, -776, -793, -540,
-    -292, -75, 120, 176, 6, 170, 305, -111, -325, -208, -220, 226,
-    387, 321, 351, 436, 776, 690, 589, 583, 776, 773, 856, 1173,
-    606, 1123, 1409, 1197, 1600, 1714, 1556, 1373, 1389, 1486, 1285, 1449,
-    1376, 1437, 1695, 1684, 1717, 1597, 1852, 1582, 1126, 672, 417, 938,
-    977, 842, 440, 847, 1037, 1250, 1516, 1793, 1746, 2220, 2346, 2196,
-    2031, 1809, 1771, 2053, 1611, 981, 864, 861, 1307, 1627, 1405, 1213,
-    1331, 1036, 1001, 898, 880, 729, 313, 156, -45, -263, -545, -506,
-    12, 32, 42, -65, -129, -321, -15, 202, 147, 519, 492, 705,
-    748, 636, 559, 819, 1159, 1084, 1334, 911, 1050, 1050, 652, 262,
-    138, -136, 6, -197, -414, -388, -652, -685, -748, -603, -867, -1157,
-    -1236, -844, -530, -265, -254, -286, -6, 16, -327, -419, -818, -1468,
-    -1317, -1399, -1811, -1766, -1558, -1365, -1668, -1539, -1470, -1472, -1416, -1441,
-    -1412, -2092, -2635, -2461, -2528, -2911, -2846, -2776, -2501, -2354, -2227, -1924,
-    -1580, -1480, -1102, -740, -738, -1052, -1308, -1394, -1344, -1042, -1040, -1164,
-    -842, -657, -627, -501, -786, -1361, -998, -944, -1172, -1446, -1469, -1486,
-    -1480, -1257, -871, -888, -991, -750, -423, -326, -707, -598, -324, -618,
-    -659, -651, -788, -784, -1040, -854, -658, -507, -462, -186, -396, -392,
-    -131, -82, -137, -262, -238, -167, -305, -50, -57, 260, 382, 388,
-    560, 573, 616, 569, 514, 646, 766, 872, 915, 1445, 1640, 1931,
-    2083, 1935, 1713, 1734, 1638, 1882, 1787, 1946, 1494, 1428, 1722, 1783,
-    1451, 1249, 1285, 1195, 1323, 1311, 1215, 1124, 1024, 1107, 1025, 1005,
-    765, 1107, 1535, 1726, 1535, 1527, 1528, 2118, 2359, 1778, 1677, 1363,
-    1461, 1832, 1930, 1716, 1817, 2060, 2130, 1812, 1349, 1038, 855, 604,
-    556, 698, 619, 422, 219, 266, 300, 111, 404, 540, 641, 739,
-    893, 581, 630, 1181, 1574, 1492, 1396, 1293, 1074, 730, 658, 921,
-    976, 844, 939, 875, 501, 328, 345, 261, -23, -216, 8, 48,
-    -244, -690, -958, -943, -1110, -846, -1197, -1149, -1144, -1513, -1369, -962,
-    -646, -668, -325, -212, -583, -582, -755, -891, -489, -380, -647, -628,
-    -948, -1105, -1298, -1453, -1295, -1073, -1450, -1399, -1052, -1202, -1614, -1813,
-    -1448, -1212, -1219, -956, -881, -918, -988, -1194, -1295, -1296, -1448, -1217,
-    -1123, -1202, -1228, -1540, -1598, -1479, -1006, -922, -1041, -1151, -1444, -1551,
-    -1397, -1059, -921, -944, -974, -1017, -997, -1045, -742, -693, -543, -332,
-    -324, -540, -503, -739, -1002, -1205, -1001, -593, -280, -39, 52, 263,
-    3, 101, -30, -10, 199, 19, 19, -118, -57, 103, -97, -28,
-    127, -291, -227, -196, -44, 157, -103, -88, 290, 526, 703, 661,
-    773, 793, 675, 963, 1147, 1398, 1425, 1402, 1567, 1394, 1189, 957,
-    1139, 933, 927, 1260, 1529, 1520, 1660, 1519, 1368, 1614, 1445, 743,
-    663, 485, 475, 774, 1137, 1084, 1184, 1532, 1225, 1149, 1611, 1420,
-    1494, 1561, 1703, 1696, 1606, 1614, 1672, 1747, 1622, 1321, 1335, 1110,
-    1065, 1148, 1133, 849, 836, 544, 465, 396, 491, 502, 545, 649,
-    636, 513, 594, 835, 938, 845, 458, 122, -45, -77, 26, 51,
-    305, 498, 344, 496, 522, 416, 316, 209, 158, -83, -119, 416,
-    95, 459, 459, 242, 199, 472, 558, 275, 69, 187, 56, 38,
-    -134, -382, -532, -162, -332, -233, -235, -575, -866, -665, -697, -986,
-    -1333, -1597, -1559, -1808, -2072, -1908, -2004, -2525, -2304, -1899, -2167, -2477,
-    -2160, -2055, -2205, -2292, -2257, -1851, -1947, -1948, -1448, -1390, -1325, -1116,
-    -954, -821, -884, -1160, -1343, -1421, -1731, -1585, -1339, -1090, -1007, -791,
-    -466, -332, -541, -417, -318, -938, -1444, -1432, -1361, -1035, -1021, -984,
-    -860, -603, -706, -580, -720, -839, -931, -947, -843, -916, -968, -998,
-    -1307, -1248, -1181, -1128, -1000, -877, -488, -448, -508, -329, -460, -616,
-    -794, -468, -239, -312, -1, -146, 111, 377, 278, 345, 497, 477,
-    600, 217, 80, 276, 514, 403, 352, 540, 489, 811, 1232, 1228,
-    1208, 1033, 947, 1125, 1087, 938, 768, 940, 1067, 1175, 988, 901,
-    1103, 1138, 722, 931, 1038, 647, 633, 912, 1277, 1132, 1383, 1261,
-    1246, 1697, 1609, 1629, 2106, 2153, 1760, 1622, 1168, 739, 808, 675,
-    764, 1003, 1099, 1282, 1360, 1058, 927, 861, 886, 759, 422, 430,
-    410, 244, 139, 723, 1004, 735, 795, 955, 1078, 1153, 904, 675,
-    849, 921, 1164, 1489, 1652, 1422, 1129, 1373, 1319, 1264, 1209, 1322,
-    1167, 969, 642, 239, 259, 46, -136, -223, -545, -229, -130, -286,
-    -44, 174, -308, -581, -523, -483, -340, -227, -106, -184, -486, -246,
-    -13, -91, -430, -317, -333, -437, -532, -710, -1008, -1089, -1279, -896,
-    -841, -507, -802, -814, -772, -645, -879, -1344, -1347, -1414, -1521, -1643,
-    -1420, -1137, -1128, -1222, -996, -1412, -1493, -1794, -1779, -1851, -1631, -1768,
-    -1748, -1774, -1834, -1916, -1751, -1623, -1471, -1665, -1711, -1569, -1808, -2056,
-    -2168, -2103, -1866, -1905, -1590, -1444, -1114, -769, -676, -274, -367, -503,
-    -641, -840, -596, -637, -717, -835, -391, -296, -254, -384, -322, -458,
-    -373, -220, -570, -691, -429, -571, -1029, -8, 2139, 2096, -609, -2450,
-    -2227, -1843, -1144, -316, 704, 1960, 2151, 1738, 1755, 1982, 1499, 1166,
-    973, 735, 352, 345, 121, 320, 49, -665, -827, -1353, -1805, -1632,
-    -1248, -792, -670, -346, -31, 829, 1068, 1613, 845, 1182, 1494, 1279,
-    1683, 1554, 1213, 1626, 2298, 2787, 3134, 2977, 3600, 3346, 3532, 4235,
-    4462, 4487, 4722, 4678, 4298, 4233, 4673, 4361, 4152, 4348, 3594, 3348,
-    3270, 2969, 2681, 2403, 2130, 2028, 1489, 1586, 1485, 1424, 1796, 477,
-    164, 381, 896, 304, 923, -385, -835, -1069, -40, 283, 372, 952,
-    797, 442, -713, -1820, -2095, -2432, -2709, -3099, -2532, -2349, -3730, -3959,
-    -3308, -2209, -1923, -1341, -2206, -3392, -3540, -3789, -4459, -5405, -4857, -3995,
-    -4210, -5197, -5417, -4824, -5120, -4572, -3311, -3241, -2787, -2287, -2454, -1838,
-    -1976, -1790, -3096, -3698, -3360, -1661, -1368, -1786, -958, -1432, -1710, -1343,
-    -1931, -2940, -3952, -3266, -2337, -2409, -2310, -800, -383, -525, -1024, -760,
-    -452, 1045, 1483, 1716, 1560, 1061, 928, 1768, 1959, 1396, 1790, 3184,
-    2311, 1649, 1892, 2249, 2549, 3028, 3364, 2808, 2440, 807, 103, -202,
-    -641, -1943, -2444, -2904, -3153, -1339, -1046, -371, -337, -1008, -1557, -1929,
-    -1677, -1632, -867, -697, -444, -927, -1037, -1382, -1508, -1096, -1479, -2025,
-    -2191, -2216, -1936, -1883, -1772, -1939, -1453, -2041, -2524, -3438, -3330, -2494,
-    -1882, -2168, -2713, -2231, -1807, -1941, -1970, -1019, -1208, -1688, -851, -715,
-    -274, -230, 103, -158, 421, 857, 398, 627, 1110, 683, 1191, 159,
-    440, 873, 1388, 1468, 1335, 787, -118, -517, -692, 125, 924, 748,
-    465, 1098, 2401, 2190, 1846, 2026, 2345, 3435, 3392, 3324, 3808, 4491,
-    5334, 4841, 4256, 4939, 4795, 4717, 4934, 4451, 3884, 3227, 3487, 3501,
-    3873, 3652, 3508, 2472, 2155, 2558, 2178, 2229, 1963, 1935, 914, 2530,
-    3162, 2910, 1525, 364, -16, 389, 1624, 3584, 3850, 3112, 3083, 2622,
-    1712, 1018, 897, 315, 1108, 1743, 1436, -654, -1501, -814, -123, 481,
-    601, -62, -642, -1387, -1618, -2075, -4286, -3568, -2066, -1667, -2793, -3533,
-    -3308, -2608, -2989, -2242, -2083, -2443, -1862, -1855, -1511, -1599, -640, -953,
-    -1953, -1911, -1493, -1176, -444, -472, -615, -1101, -1126, -1394, -1782, -2688,
-    -2894, -2534, -1941, -2459, -2128, -538, -92, -460, -711, -1417, -1510, -286,
-    -297, 475, 1378, 2068, 2455, 2670, 2491, 1805, 1839, 2429, 1398, 810,
-    985, 2295, 2950, 2544, 1368, 1009, 445, -198, -121, 22, -104, -139,
-    510, 1150, -150, 1034, 3051, 2751, 2982, 2533, 1904, 1685, 2243, 3450,
-    3900, 4453, 4234, 4523, 4625, 5088, 4922, 3720, 2094, 1226, 1947, 2287,
-    2221, 1941, 1545, 877, -209, -593, -1881, -1968, -1908, -2381, -2479, -1748,
-    -2073, -1752, -688, -371, -724, -1558, -1598, -1225, -956, -17, 153, -781,
-    -350, -273, -448, -683, -1230, 395, -257, -538, -1261, -2075, -1775, -1841,
-    -2010, -2333, -2498, -2602, -3383, -3808, -4316, -4825, -4765, -4459, -4113, -3036,
-    -2210, -698, -455, -1624, -3179, -3760, -2741, -1893, -2011, -1283, -480, -392,
-    -165, -57, 227, 687, -544, -1621, -1470, -1755, -1661, -1012, -1001, -1969,
-    -2506, -2619, -2055, -1526, -1378, -1220, -1739, -1977, -2824, -576, 1074, 1969,
-    215, -750, -837, -570, 1011, 3191, 2910, 3167, 2992, 2695, 2165, 1792,
-    1182, 2071, 2511, 3374, 2608, 2101, 2158, 3370, 3292, 3939, 4100, 3033,
-    2428, 1632, 1048, 454, 207, 993, 2368, 2564, 1944, 1241, 498, 783,
-    1430, 1944, 2358, 2524, 2311, 2901, 3012, 3249, 3682, 3552, 2091, 1585,
-    2314, 3137, 3211, 2664, 2658, 1253, 824, -44, -7, -623, -1103, -1227,
-    -28, -97, 143, 1312, 2154, 2078, 961, 612, -158, -471, 194, 1112,
-    1063, 1862, 1651, 1125, 1060, 1078, 1515, 999, 223, -708, -374, -304,
-    -500, -1450, -1443, -1763, -1670, -2829, -3963, -4326, -4434, -3690, -3785, -4279,
-    -4662, -4339, -2284, -1857, -2252, -2825, -3930, -4071, -3141, -2635, -2538, -1538,
-    -2301, -2511, -2782, -2993, -2531, -2057, -2656, -3208, -3065, -2549, -2606, -2463,
-    -1650, -2406, -2832, -2798, -2894, -3575, -3430, -3143, -3008, -3581, -3753, -1826,
-    -752, -502, -991, -963, -800, -1072, -1290, -820, 181, -24, -165, 280,
-    635, 373, 75, 493, 474, -57, -803, -1532, -1170, -1669, -664, -383,
-    -993, -2100, -2612, -2391, -2368, -2082, -1395, -1299, -530, 681, 1333, 899,
-    832, 1133, 1450, 1841, 2566, 2737, 2752, 3043, 3261, 3318, 3982, 4070,
-    4198, 3775, 3001, 2588, 2228, 1990, 2239, 2883, 3493, 3096, 2921, 2084,
-    1104, 698, 828, 943, 1003, 810, 293, 1649, 2207, 2483, 983, 274,
-    225, 616, 2435, 3722, 3499, 2283, 1592, 2060, 2317, 2059, 2051, 1865,
-    2063, 2706, 2775, 1228, 1380, 1747, 2455, 1733, 1027, 885, -66, -1011,
-    -1111, -1347, -1285, -55, 901, 239, -45, -1389, -2248, -2770, -2024, -1770,
-    -1155, -629, -1350, -616, 122, -91, 385, -37, -1074, -1372, -940, -640,
-    -936, -840, -2056, -2600, -2716, -3327, -3670, -3932, -4414, -4541, -4298, -4764,
-    -3380, -2050, -1917, -2408, -2873, -3286, -3796, -3526, -2560, -2255, -2470, -1860,
-    -1659, -1710, -1847, -2149, -1584, -1685, -3216, -3769, -4058, -3313, -2322, -2906,
-    -3417, -3754, -3941, -5007, -4830, -5001, -4826, -4376, -4051, -3784, -3580, -2371,
-    -1104, -971, -1582, -1658, -1762, -1582, -763, -38, 390, 663, 27, 413,
-    334, 430, 583, 671, -6, -738, -1166, -886, -588, -602, -956, -754,
-    -1136, -1677, -2457, -2431, -2254, -2207, -2205, -1661, -1406, -472, 179, 344,
-    -34, 277, 213, 447, 631, 1761, 1980, 2919, 3224, 3275, 3215, 3149,
-    3645, 4272, 3940, 2753, 2363, 2664, 2124, 2583, 2331, 2832, 3024, 2383,
-    1965, 1061, 1020, 1046, 1843, 1969, 2185, 2228, 3621, 3292, 2500, 2262,
-    1812, 1894, 2555, 3153, 3980, 4491, 4458, 4907, 4713, 4341, 4129, 4393,
-    4478, 4538, 3631, 3468, 3979, 4112, 3476, 3815, 4028, 3165, 2024, 779,
-    258, 344, 525, 838, 1564, 2660, 2589, 2488, 642, 51, 548, 1889,
-    2914, 2351, 2324, 1979, 1747, 1859, 1870, 1646, 1475, 1672, 1680, 2582,
-    1374, 706, 10, -172, 264, 871, 444, 111, -826, -1517, -1230, -1599,
-    -2477, -1482, -851, -606, -1565, -2332, -2110, -2410, -2195, -2478, -2011, -1631,
-    -1236, -469, -542, -102, 623, -359, -2004, -2292, -1851, -1220, -1724, -2891,
-    -3750, -4065, -4325, -4461, -4752, -4460, -5465, -5632, -4647, -5007, -5117, -3065,
-    -2917, -2498, -3185, -3232, -2533, -2174, -1761, -1927, -1665, -1023, -910, -1411,
-    -1521, -1053, -975, -1999, -3386, -3381, -2602, -2561, -2866, -3020, -3999, -3965,
-    -3996, -3740, -3959, -4888, -5767, -6022, -5338, -4911, -4852, -3876, -2901, -2830,
-    -3221, -3207, -2734, -3293, -2802, -1780, -1296, -1209, -1149, -302, -248, 233,
-    219, 1056, 582, -240, -519, -281, -469, -302, -930, -965, -1431, -1876,
-    -2107, -2046, -1852, -1528, -1847, -1770, -1157, -256, 644, 315, 143, -708,
-    -1173, -1230, -914, -545, 602, 777, 1256, 1622, 2400, 2246, 2299, 2738,
-    1778, 8, -313, 324, 818, 916, 1392, 2004, 1996, 871, 1433, 870,
-    542, -214, -721, -588, -274, 568, 1606, 2845, 2818, 2443, 2519, 2287,
-    2813, 3543, 4351, 4651, 4612, 4821, 4390, 4646, 4307, 4286, 3929, 3626,
-    3216, 2924, 3733, 4139, 4114, 4243, 3756, 3104, 2870, 1969, 1262, 862,
-    1167, 797, 2661, 3528, 4775, 3838, 2872, 2210, 1731, 2787, 4533, 4550,
-    4386, 4085, 3107, 3311, 3699, 3962, 4160, 3641, 3861, 3894, 2580, 2311,
-    2076, 2309, 2841, 2702, 2931, 2494, 2296, 1394, 863, -500, 139, 1221,
-    1377, 1034, 767, 845, 892, 1109, 1440, 2054, 2767, 2784, 2644, 2495,
-    2516, 2272, 2124, 1117, 581, 9, -98, 804, 1068, 1160, 395, -349,
-    -706, -1153, -1396, -973, -1683, -2266, -2905, -3752, -2486, -1909, -1536, -764,
-    -635, -741, -941, -1420, -950, -322, 212, 130, 736, -11, -368, -593,
-    210, -652, -1659, -1898, -1169, -1314, -1534, -2500, -3747, -5068, -5887, -5930,
-    -5441, -5528, -5897, -6066, -5835, -5591, -5292, -3911, -2996, -2608, -2736, -3196,
-    -3875, -4185, -4418, -4041, -3633, -3054, -2796, -2675, -2463, -2358, -2224, -2928,
-    -3814, -4446, -4381, -4031, -3793, -3378, -3680, -4713, -4430, -4540, -4700, -5307,
-    -5625, -5643, -6316, -6329, -5720, -5283, -4234, -3578, -3194, -3203, -3343, -2908,
-    -2957, -2314, -1690, -1647, -1078, -1135, -1140, -1386, -1772, -2077, -2117, -2224,
-    -2093, -2038, -2067, -1879, -1753, -1775, -1809, -2422, -2539, -2446, -2903, -2959,
-    -2679, -2270, -1309, -501, -526, 122, -250, -100, -275, -820, -912, -632,
-    -529, 46, 457, 376, 499, 920, 1503, 1661, 1030, 1134, 773, 588,
-    578, 273, -102, -16, 161, 474, 671, 377, 148, 656, 1045, 917,
-    1276, 1484, 2247, 2791, 3556, 3998, 3697, 3240, 3434, 3588, 3289, 3532,
-    3292, 3383, 3473, 2889, 3020, 2742, 2559, 2121, 2109, 2466, 2810, 3104,
-    3846, 4029, 4675, 3737, 3521, 3214, 3386, 3360, 3326, 3040, 3404, 3363,
-    3423, 3339, 4454, 4114, 3902, 3865, 3793, 3909, 3662, 4200, 4716, 4625,
-    4994, 5267, 5080, 5585, 4537, 4383, 4777, 3919, 2533, 2921, 2917, 3439,
-    3376, 2968, 2947, 2984, 3518, 3616, 3551, 4198, 4091, 4299, 5053, 4494,
-    4058, 4084, 3832, 3404, 3057, 2818, 3024, 2668, 2654, 2995, 2998, 2949,
-    2866, 2659, 2627, 3477, 3584, 3155, 2784, 2808, 2044, 2370, 2041, 1996,
-    2337, 1930, 1308, 1213, 1523, 1901, 1766, 1489, 1477, 1353, 1326, 1352,
-    1095, 1516, 1714, 1167, 941, 307, -286, 259, -138, 170, -351, -576,
-    -436, -655, -697, -277, -556, -927, -979, -672, -1186, -745, -229, -419,
-    -246, -754, -293, -150, -80, 332, 573, 120, -837, -1351, -1430, -1504,
-    -1291, -1781, -2075, -2357, -3113, -2963, -2832, -2686, -2070, -2132, -2249, -2375,
-    -3023, -3264, -3062, -3394, -4011, -4081, -3308, -3096, -3546, -2726, -2146, -2562,
-    -2874, -3338, -3482, -2278, -2072, -2278, -2285, -2023, -1554, -2231, -1992, -2018,
-    -2765, -3055, -3500, -3706, -3590, -3637, -4106, -4539, -5537, -5953, -5202, -4842,
-    -4372, -4364, -4517, -4321, -4089, -4286, -4328, -4301, -4722, -4722, -4822, -5490,
-    -5376, -5010, -5094, -5144, -4371, -4218, -4594, -4637, -4451, -3960, -3719, -3859,
-    -3271, -3440, -3026, -3177, -3551, -3578, -3952, -4475, -4541, -4513, -4376, -4962,
-    -4405, -4216, -4218, -4161, -4054, -4141, -3523, -3155, -3600, -3055, -2749, -2125,
-    -2650, -2961, -2114, -2556, -3171, -3027, -3140, -3202, -2682, -2287, -1855, -1829,
-    -1983, -2084, -1916, -1688, -1750, -1296, -1043, -864, -903, -1252, -808, -1046,
-    -507, -961, -1022, -418, -664, -225, -514, 64, 21, 33, -181, 294,
-    9, 252, 268, 774, 579, 1012, 729, 547, 641, 599, 601, 381,
-    514, -82, -230, 360, 373, 745, 730, 704, 1070, 1530, 1943, 1942,
-    2641, 2670, 2909, 2703, 3074, 3357, 3680, 3083, 3221, 3004, 3052, 3177,
-    2400, 2154, 2645, 2514, 1838, 1495, 1511, 1577, 1824, 1858, 1975, 2200,
-    2235, 2025, 2309, 2156, 2073, 2068, 2382, 2376, 2395, 2756, 3380, 3448,
-    3227, 3177, 3300, 3312, 3855, 4339, 4682, 4854, 5238, 4921, 4789, 5104,
-    4753, 4684, 4310, 4083, 4052, 3886, 4083, 3847, 3433, 3533, 3848, 3558,
-    3230, 3245, 3319, 3519, 3917, 4069, 4010, 3805, 4092, 3881, 3621, 3503,
-    3033, 2725, 2775, 2371, 2608, 2394, 2380, 2256, 2539, 2965, 3141, 3262,
-    3236, 3431, 3650, 3213, 2850, 2913, 2725, 2818, 2900, 2091, 2276, 1907,
-    1860, 2134, 1907, 2393, 2401, 2570, 2849, 2413, 2253, 2213, 2464, 2472,
-    2743, 2481, 1931, 2367, 2130, 1925, 1595, 1465, 1536, 932, 1203, 897,
-    723, 864, 684, 669, 822, 464, 490, 609, 259, 292, 454, 570,
-    558, 164, 393, 276, 399, 632, 271, 301, 110, -71, 183, 241,
-    299, 154, -177, 77, 377, 519, 596, 266, -124, -235, -404, -728,
-    -869, -1213, -1315, -1657, -1681, -1895, -1363, -1212, -1351, -1144, -1072, -1156,
-    -742, -732, -810, -940, -634, -597, -923, -820, -1166, -1124, -1432, -1200,
-    -1431, -1800, -1582, -2151, -2380, -2058, -2652, -2929, -3241, -3537, -3488, -3547,
-    -3531, -3416, -3048, -2894, -2593, -2700, -2649, -2897, -2806, -2962, -3289, -3370,
-    -3024, -2536, -2508, -2376, -2967, -2799, -2121, -2013, -1925, -1627, -1798, -1476,
-    -1646, -2082, -2498, -2953, -2887, -2807, -2921, -3167, -3751, -3635, -3919, -3845,
-    -3620, -3832, -3493, -3616, -3599, -3329, -3145, -2825, -3045, -3174, -3011, -2985,
-    -3019, -3026, -3426, -3661, -3731, -3767, -3607, -3687, -3769, -3520, -3487, -2691,
-    -2677, -3073, -3034, -3269, -3220, -2671, -2994, -3155, -3422, -3510, -3363, -3181,
-    -2705, -3032, -3000, -2686, -2365, -2490, -2372, -2705, -2316, -2270, -2401, -2768,
-    -2661, -2402, -2088, -1862, -2042, -2101, -2016, -1893, -1283, -1416, -2036, -2122,
-    -2240, -1900, -1919, -2230, -2186, -2091, -1718, -1443, -1558, -1477, -1653, -1516,
-    -1403, -1168, -1125, -1675, -1493, -1476, -868, -399, -816, -1150, -1116, -1008,
-    -563, -359, -623, -885, -971, -856, -335, -112, -352, -84, -83, 343,
-    203, 244, 182, -58, -448, -98, 341, 1028, 736, 847, 1349, 1713,
-    1765, 1879, 1808, 1939, 2169, 2377, 2349, 2089, 1785, 1868, 2070, 2344,
-    2486, 2672, 2364, 2066, 1898, 1602, 1289, 1189, 1371, 1374, 1247, 1125,
-    907, 1076, 1461, 1923, 2095, 2567, 2165, 2008, 2613, 2493, 2219, 2006,
-    1935, 2148, 2547, 3056, 3143, 3002, 3416, 3386, 3806, 3918, 3594, 3796,
-    3848, 3903, 3953, 3393, 2725, 2712, 3066, 3083, 2687, 2685, 2130, 2373,
-    2721, 2714, 2777, 3140, 3104, 3087, 3379, 3272, 3727, 3387, 3527, 3477,
-    3401, 3506, 3007, 2855, 3145, 2754, 2891, 2671, 2667, 2488, 2492, 2899,
-    2999, 2507, 2664, 2512, 2687, 2867, 2651, 2470, 2126, 2342, 2435, 2661,
-    3243, 3407, 2994, 3150, 3365, 3937, 3621, 3447, 3432, 3294, 3417, 3350,
-    2977, 3079, 3517, 3387, 3432, 3085, 2973, 3088, 2790, 2670, 2247, 1975,
-    1942, 1616, 1333, 1455, 1571, 1296, 1340, 1478, 1475, 1203, 1046, 1042,
-    812, 1431, 1473, 1269, 953, 917, 971, 1029, 1241, 1091, 1438, 1314,
-    1041, 1214, 1068, 929, 975, 574, 704, 500, 889, 1220, 1002, 749,
-    586, 507, 450, 203, -177, 191, -100, 109, 265, 165, 59, 280,
-    -53, -475, -647, -390, -547, -322, 103, 222, 253, 307, -309, -403,
-    -78, -433, -326, -456, -654, -991, -1386, -1933, -1935, -1900, -2193, -2091,
-    -2202, -2243, -2185, -1776, -1858, -1493, -1416, -1075, -1109, -1062, -1901, -2279,
-    -2014, -1739, -1820, -1414, -1334, -1040, -871, -1082, -1089, -798, -1304, -1433,
-    -1199, -1450, -1704, -1467, -1382, -2053, -2198, -2327, -2737, -2553, -2439, -2561,
-    -2598, -2824, -2142, -2206, -2200, -2164, -2390, -2172, -2385, -2381, -2121, -2223,
-    -2258, -2244, -2209, -2167, -2458, -2485, -2530, -2340, -2587, -3413, -3656, -3231,
-    -3004, -3397, -3288, -3206, -3468, -3994, -3535, -3578, -3726, -3538, -3448, -2988,
-    -2764, -2708, -2370, -2627, -2639, -2310, -2872, -2996, -2762, -2711, -2887, -2788,
-    -2744, -2435, -2342, -2472, -2846, -3327, -2818, -2478, -2813, -2756, -2754, -3036,
-    -3206, -3223, -3173, -3683, -3353, -3057, -3337, -3451, -3456, -3354, -3764, -3672,
-    -3638, -3836, -3886, -3540, -3479, -3250, -3327, -3306, -3052, -3356, -2872, -2006,
-    -2517, -3389, -3219, -3054, -2717, -3157, -3220, -2671, -2646, -2689, -2657, -2507,
-    -2119, -1817, -2033, -1833, -1967, -2137, -2439, -2022, -1649, -1867, -2096, -1777,
-    -1936, -1512, -1687, -1472, -1390, -1370, -1376, -1356, -1136, -1009, -1178, -913,
-    -1114, -1302, -1425, -1059, -761, -834, -993, -1269, -1161, -1370, -1014, -1183,
-    -1316, -1128, -858, -925, -867, -878, -760, -329, -304, -237, -186, -55,
-    577, 847, 974, 1225, 585, 1004, 1514, 1632, 1860, 1340, 870, 638,
-    1160, 1111, 1421, 1417, 1201, 1200, 897, 1202, 1052, 841, 811, 624,
-    1126, 1710, 1656, 1359, 1748, 1664, 1508, 1167, 1593, 2015, 1755, 1784,
-    2484, 2003, 1927, 2520, 2804, 2307, 2104, 2053, 1890, 1990, 1902, 1210,
-    1037, 1753, 1557, 1420, 1582, 1701, 1648, 1624, 2094, 1882, 2188, 2727,
-    2866, 2989, 2738, 2603, 2788, 2742, 3613, 3793, 3490, 3551, 3503, 3885,
-    3919, 3771, 3518, 3641, 3095, 3004, 2809, 2971, 2775, 2541, 3009, 3286,
-    2917, 3127, 2792, 2825, 2925, 2946, 2538, 2848, 3038, 2886, 3159, 2759,
-    2640, 3016, 2723, 2712, 3124, 3272, 3290, 3392, 2874, 2696, 2886, 2941,
-    3469, 3409, 3091, 2733, 2202, 2688, 2819, 2764, 3012, 3203, 3482, 3304,
-    3632, 3400, 3260, 3568, 3582, 3789, 2989, 2755, 3483, 3591, 3225, 2547,
-    2410, 2898, 3146, 3069, 2594, 2436, 2509, 3320, 3118, 3236, 2715, 2662,
-    2568, 2342, 1893, 1303, 1676, 1984, 2135, 2058, 1774, 1665, 1643, 1710,
-    1175, 1172, 1494, 1322, 930, 612, 1022, 1256, 762, 463, 1061, 1303,
-    1017, 1258, 1099, 1182, 1569, 1640, 1740, 2324, 1809, 1486, 1357, 738,
-    709, 542, 282, 912, 1573, 1662, 1823, 1498, 1551, 1265, 805, 575,
-    406, 847, 392, 526, 254, -289, -155, -624, -366, -28, -248, -696,
-    -671, -493, -321, -612, -177, -159, -1391, -994, -897, -850, -724, -1668,
-    -2064, -1458, -369, 110, -131, 1045, 914, 383, -838, -1572, -2512, -2365,
-    -1932, -2075, -1058, -1161, -2007, -839, -413, 533, 450, 455, 99, -517,
-    -392, -497, -1958, -2703, -1473, -1318, -2672, -3077, -3455, -3780, -3335, -2592,
-    -1887, -1125, -151, -216, -818, -1177, -852, -1119, -2928, -3012, -2253, -1200,
-    -1626, -1939, -1818, -2049, -2077, -2225, -2691, -3101, -3576, -3544, -2933, -3460,
-    -2895, -1807, -1528, -1800, -2433, -3244, -3277, -2878, -1637, -1069, -533, -304,
-    -133, 156, 185, 145, -107, -374, -1790, -2233, -1914, -1922, -1882, -1967,
-    -1848, -2062, -2580, -3323, -4165, -4580, -4636, -4166, -3998, -4125, -3821, -2316,
-    -1694, -1944, -3006, -3688, -3860, -3474, -2423, -1256, -709, -264, -249, -409,
-    -1292, -1843, -2033, -1700, -2402, -3372, -3453, -3113, -2634, -2296, -2777, -2012,
-    -1756, -2718, -3462, -3661, -4051, -3401, -2821, -3557, -3807, -2839, -1980, -1496,
-    -2276, -2832, -2606, -2696, -1923, -1067, -1165, -1040, -755, -364, -99, -471,
-    -1091, -921, -457, -1697, -1681, -1668, -1963, -1592, -988, -879, -1243, -1775,
-    -2732, -3304, -3064, -2897, -2845, -3034, -3065, -1933, -1996, -1787, -2424, -2750,
-    -3015, -2510, -1571, -1174, -710, -621, -121, -3, 192, 223, 409, 567,
-    163, -546, -864, -456, -110, -33, 493, 677, 447, -204, -309, -504,
-    -488, -718, -735, -257, -1226, -186, -334, -319, -1084, -2127, -1285, -601,
-    793, 2385, 2934, 2029, 1469, 1537, 1220, 572, 615, 161, -172, 887,
-    1474, 622, 559, 836, 1372, 1490, 1460, 1011, 376, 84, 211, 57,
-    -779, -30, 945, 229, -296, -229, 170, 330, 591, 1384, 2437, 2885,
-    2823, 3111, 2936, 2751, 3345, 2806, 1758, 1286, 2271, 3582, 3499, 2893,
-    2486, 2090, 1316, 1126, 518, -105, 115, 312, 997, 1110, 1216, 2156,
-    2649, 2068, 1767, 1609, 1436, 2164, 2879, 3560, 4193, 4482, 4560, 5019,
-    4611, 4088, 3579, 3774, 2423, 2415, 2591, 3260, 3431, 3326, 3155, 2652,
-    1947, 1179, 1168, 1455, 1464, 1712, 1908, 1911, 1360, 2604, 3725, 2990,
-    2653, 3026, 3037, 2714, 2403, 3503, 3780, 3999, 3658, 4286, 4142, 3835,
-    3997, 4618, 3630, 2919, 3187, 4014, 3971, 3814, 3147, 2959, 3158, 2845,
-    1911, 1859, 1006, 1445, 1539, 1728, 1770, 2135, 3194, 2762, 2024, 986,
-    217, 1136, 1763, 2578, 2843, 2777, 3124, 3609, 3614, 3439, 3825, 3672,
-    3201, 2257, 2363, 2515, 2979, 3254, 3044, 2905, 2754, 2896, 2457, 2121,
-    2255, 2094, 2350, 1896, 1564, 1912, 2122, 2037, 2032, 1639, 1378, 1735,
-    2461, 3015, 3591, 3262, 2861, 3250, 3088, 2914, 3315, 2708, 1767, 1510,
-    1409, 980, 1722, 1979, 1562, 1269, 445, 17, -535, -904, -1312, -434,
-    -955, -1158, -687, 450, 1710, 1414, 69, 264, 505, 1129, 2912, 3294,
-    2902, 2162, 2229, 1931, 1589, 1782, 1908, 1480, 2284, 2806, 1596, 623,
-    733, 1236, 1910, 1539, 1088, 123, -245, -536, -1417, -1950, -3141, -1934,
-    -1151, -1430, -2025, -2653, -2566, -2431, -1584, -1232, -726, -125, 528, 888,
-    1157, 479, 856, 99, -1261, -854, -256, -1052, -362, -447, -390, -1118,
-    -1606, -1750, -2474, -3043, -2448, -1883, -1853, -2511, -2200, -1370, -920, -789,
-    -1343, -1612, -1955, -1393, -1210, -1049, -15, 156, 31, -343, -422, -61,
-    506, -384, -1066, -1280, -933, -803, -497, -1119, -1447, -1538, -2869, -3386,
-    -4031, -4247, -3639, -3256, -3427, -4064, -4416, -3217, -2106, -2261, -2882, -3579,
-    -3866, -4610, -3642, -3258, -2161, -1237, -253, -476, -454, -733, -1051, -1596,
-    -2537, -2954, -2874, -2750, -2060, -1589, -1732, -2046, -2177, -2615, -3099, -3105,
-    -3095, -2977, -2849, -2870, -3114, -2866, -3161, -2957, -2922, -3369, -3433, -3378,
-    -2512, -1505, -1441, -671, -653, -822, -670, -1416, -2181, -1644, -1458, -1824,
-    -2045, -2309, -2835, -2609, -2439, -3221, -3008, -3226, -3449, -4158, -4582, -4713,
-    -4828, -4566, -3480, -2305, -1895, -2032, -2247, -2612, -2318, -1858, -1247, -344,
-    -538, -848, -688, -578, -56, 323, 69, 102, -81, -517, -759, -1495,
-    -1356, -1742, -1680, -1408, -2357, -2513, -2478, -3013, -3995, -3715, -3470, -3261,
-    -2392, -1863, -1859, -3171, -4079, -4024, -4161, -2293, 644, 1546, 851, -421,
-    -1047, -768, -1400, -895, -331, -559, -442, -71, -1094, -2036, -1332, -267,
-    56, 216, 247, 248, -132, -1009, -1866, -2472, -2019, -2059, -1069, -1600,
-    -2702, -2426, -2376, -2144, -1942, -1216, 418, 1193, 673, 337, 883, 826,
-    946, -236, -699, -858, -169, 217, 624, 630, 456, 647, 61, -759,
-    -1213, -1709, -913, -761, -974, -667, 533, 1198, 620, 329, -225, -821,
-    -321, -20, 665, 860, 1192, 2036, 1821, 2054, 1958, 2143, 3189, 1908,
-    296, 515, 1043, 1968, 2277, 1842, 1260, 842, 474, 521, 858, 725,
-    537, 926, 1246, 657, 1186, 2270, 1804, 1015, 1264, 858, 906, 670,
-    1660, 2900, 3361, 3306, 3636, 3578, 3488, 3212, 2922, 2674, 1996, 1173,
-    1096, 1761, 2681, 2965, 2386, 1653, 1291, 695, 618, 252, 336, 708,
-    -143, -48, 1029, 2106, 2688, 2186, 1239, 2079, 2101, 2473, 2793, 2862,
-    3427, 3740, 4074, 4589, 4397, 3912, 4380, 4016, 3154, 2281, 2873, 2851,
-    2689, 2681, 2219, 2489, 2403, 2157, 1458, 460, 227, 600, 570, 869,
-    1310, 1882, 1875, 789, 593, 1691, 1432, 1702, 2636, 2674, 2949, 3682,
-    4047, 3633, 3654, 3287, 3483, 2976, 2106, 1358, 1383, 1921, 2284, 2130,
-    2496, 2560, 2739, 2619, 1764, 862, 132, -23, -485, -537, 1004, 1362,
-    2001, 1068, -62, 308, 1054, 3018, 3944, 3952, 3547, 2907, 2435, 1979,
-    1704, 1883, 1655, 2147, 2848, 2854, 1993, 2262, 2396, 2656, 2076, 1572,
-    1625, 1337, 1094, 822, -18, -892, -180, 686, 485, 331, -172, -755,
-    -532, -592, -380, 394, 931, 1027, 1566, 1314, 1067, 1592, 1769, 1004,
-    645, 1204, 1922, 2102, 1998, 1637, 1224, 139, -287, -823, -788, -489,
-    -254, 282, 868, 305, 765, 660, 434, 159, 329, 253, 188, 53,
-    355, 655, 882, 1370, 1365, 886, 763, 641, -92, -1039, -1397, -614,
-    -343, -415, -814, -1164, -781, -1107, -1696, -1999, -1882, -2133, -2772, -2768,
-    -2464, -2186, -1332, -138, -378, -404, -361, -481, -208, 471, 685, 621,
-    400, 774, 696, 360, -16, -139, 516, -105, -737, -971, -838, -249,
-    -155, -364, -898, -1741, -2556, -2736, -3081, -3521, -3664, -3190, -3004, -3275,
-    -2190, -1480, -1404, -1504, -2240, -2015, -1597, -1596, -1072, -1022, -875, -373,
-    -330, -118, -135, -259, -65, -246, -939, -1654, -1932, -1635, -1282, -890,
-    -724, -969, -1371, -1706, -1883, -2803, -2888, -2749, -3160, -3542, -2970, -2129,
-    -2162, -2307, -3062, -2821, -2374, -1814, -1198, -1163, -874, -659, -286, -205,
-    -376, -163, 36, 54, 113, -444, -1248, -1225, -1082, -184, -1000, -2017,
-    -2445, -2114, -1797, -2388, -2905, -3070, -3651, -3240, -1472, -1069, -1300, -3100,
-    -3609, -3871, -2911, -720, -145, -127, -408, -837, -1287, -1787, -1452, -883,
-    -516, -406, 85, -415, -848, -1361, -1166, -406, -66, -106, -357, -373,
-    -648, -1163, -1258, -2322, -1420, -1491, -1868, -2056, -2797, -2329, -1995, -1358,
-    -1517, -716, -140, -117, -412, -357, -544, 140, -610, -2082, -2105, -1396,
-    -1193, -525, -894, -1341, -1410, -1819, -2475, -2315, -2034, -2442, -2471, -2577,
-    -3040, -2475, -1227, -439, -269, -148, 382, 685, 878, 858, 1261, 1560,
-    2223, 2103, 1403, 1244, 925, 848, 453, -606, 197, 8, 539, 1434,
-    925, -104, -602, -1532, -2081, -2265, -1853, -1375, -1428, -1228, -1350, -1380,
-    -1431, -602, 463, 658, 21, -792, -1124, 158, 972, 2249, 2083, 1766,
-    1574, 1276, 1007, 1302, 1080, 957, 1046, 976, 680, 879, 1053, 544,
-    70, -151, 138, -334, -814, -775, -938, -1172, -816, -336, -347, -108,
-    626, 1270, 662, 1, -104, 713, 1284, 1669, 1838, 2072, 1365, 1457,
-    1751, 1640, 1720, 2252, 2557, 2891, 2624, 1911, 1416, 1103, 986, 983,
-    781, 230, 120, -314, -558, -697, -83, 224, 258, 248, 17, 419,
-    1402, 908, 951, 570, 1030, 1075, 1510, 1633, 1670, 1858, 1819, 2253,
-    2143, 2566, 2497, 2903, 2207, 1507, 998, 574, 319, 1090, 1561, 1699,
-    1619, 878, 934, 346, 694, 1147, 1144, 1280, 1626, 1660, 1807, 1717,
-    1393, 1375, 1642, 2371, 2494, 2209, 1581, 1246, 1225, 1217, 1535, 2408,
-    2893, 1785, 190, 479, 931, 1412, 1580, 1797, 1472, 1381, 890, 466,
-    639, 508, 782, 1192, 1761, 1876, 1589, 1898, 1943, 1627, 1467, 1432,
-    1820, 1800, 2053, 2052, 1561, 1351, 1676, 2147, 1984, 2181, 1878, 1850,
-    1588, 1762, 2219, 2103, 1438, 1211, 1401, 1924, 1872, 1447, 1373, 1033,
-    1271, 1358, 1239, 1290, 936, 608, 840, 1245, 1224, 925, 956, 938,
-    1033, 578, 921, 1492, 1323, 1442, 1356, 566, 734, 904, 1065, 1329,
-    1137, 680, 1214, 1765, 1521, 1299, 1288, 1627, 1471, 985, 730, 741,
-    882, 753, 345, 757, 1023, 1013, 899, 930, 709, 180, 470, 390,
-    -245, -323, 678, 1313, 1811, 1303, 620, 247, 184, 135, -333, -294,
-    -91, -160, -74, -341, -476, 84, 355, -165, -331, -495, -349, -99,
-    147, -471, -492, -678, -746, -584, -529, -6, 360, 38, 350, 452,
-    422, 616, 535, 195, -411, -362, -112, 21, 265, 518, 455, 454,
-    420, 107, 115, 386, 17, -467, -737, -750, -804, -1189, -902, -384,
-    -167, -199, -768, -1069, -1090, -1082, -1425, -1784, -1275, -839, -632, -564,
-    -740, -949, -1164, -1381, -1902, -1898, -1258, -853, -799, -976, -1197, -1307,
-    -1175, -975, -821, -436, -475, -518, -465, -905, -966, -457, -364, -620,
-    -839, -606, -671, -808, -715, -1365, -1483, -1366, -996, -728, -1023, -996,
-    -983, -1301, -1124, -1039, -1004, -897, -898, -750, -466, -560, -855, -949,
-    -730, -1247, -1762, -1845, -1789, -1686, -1671, -1539, -1300, -1358, -1759, -1842,
-    -1509, -1339, -1228, -1245, -1148, -1118, -1200, -700, -815, -798, -1094, -1362,
-    -1235, -1152, -1007, -905, -823, -881, -964, -994, -699, -606, -814, -867,
-    -811, -943, -973, -944, -692, -616, -742, -636, -794, -744, -964, -1008,
-    -957, -610, -624, -954, -875, -667, -700, -972, -725, -929, -902, -1069,
-    -893, -545, -408, -814, -1381, -1556, -1644, -1483, -1331, -1520, -1389, -1324,
-    -1408, -1400, -1679, -1536, -1357, -976, -920, -853, -452, -417, -193, -539,
-    -846, -727, -732, -656, -1118, -1311, -1154, -474, -449, -404, -384, -434,
-    -554, -454, -548, -532, -177, -670, -917, -573, -367, -94, -275, -160,
-    -564, -822, -954, -986, -1028, -816, -771, -728, -490, -679, -609, -441,
-    -774, -1358, -1636, -1350, -1269, -1127, -801, -172, -172, -442, -592, -833,
-    -865, -1042, -313, -69, -42, -47, 131, 73, 499, 666, 536, 15,
-    7, 153, 200, 612, 264, 457, 585, 446, 171, -318, -193, -132,
-    88, -140, -68, 338, -52, -276, 41, 116, 366, 159, 88, -327,
-    -203, -129, -277, -496, -156, 120, 483, 137, -143, -65, 21, 82,
-    221, 462, 1023, 970, 951, 1017, 484, 469, 831, 818, 666, 370,
-    455, 691, 1115, 1393, 1187, 1144, 776, 672, 648, 848, 592, 757,
-    1009, 1049, 1391, 1505, 1323, 1111, 783, 989, 1129, 973, 791, 1066,
-    1217, 1138, 1018, 1243, 1394, 1167, 1250, 1175, 1100, 996, 912, 1040,
-    1017, 1377, 1626, 1646, 1054, 737, 563, 530, 374, 821, 861, 700,
-    612, 679, 943, 1244, 997, 867, 982, 1500, 1408, 1570, 1977, 2071,
-    1723, 1509, 1450, 1571, 1630, 1503, 1297, 1138, 1314, 1678, 1375, 1357,
-    1499, 1085, 1137, 1370, 1794, 1635, 1456, 1300, 1270, 1487, 1407, 1041,
-    897, 904, 744, 924, 765, 442, 559, 808, 1065, 1168, 1210, 900,
-    730, 649, 450, 735, 791, 816, 728, 1079, 1141, 807, 472, 88,
-    331, 453, 166, 403, 582, 509, 890, 1549, 1423, 1130, 1080, 1468,
-    1539, 1312, 1331, 1310, 1311, 1388, 1339, 1182, 580, 233, 107, 238,
-    468, 1171, 1312, 868, 620, 375, 244, -88, -195, 244, 332, -35,
-    -306, -248, -8, -132, -50, -166, 58, -4, -119, -333, -199, -101,
-    190, 310, 283, 387, 455, 391, 524, 182, 342, 439, 492, 375,
-    394, 495, 279, 113, -42, -151, -394, -71, 195, -27, -23, -242,
-    -366, -184, 301, 178, 110, 174, -135, -148, -155, 374, 667, 482,
-    297, 153, 23, -155, -457, -560, -475, -328, -109, 41, -201, 65,
-    -87, -227, -435, -610, -552, -737, -954, -1222, -1219, -784, -1006, -593,
-    -530, -413, -493, -635, -643, -647, -668, -324, -131, -35, -40, -41,
-    -66, -141, -323, -364, -277, -522, -716, -587, -455, -383, -231, -300,
-    -638, -987, -1120, -1275, -820, -553, -328, -236, -294, -233, -135, -315,
-    -458, -622, -688, -854, -784, -682, -952, -824, -631, -871, -1316, -1257,
-    -882, -799, -802, -1064, -857, -752, -776, -819, -923, -1248, -1218, -1122,
-    -1087, -1260, -1353, -984, -777, -658, -649, -712, -516, -418, -327, -515,
-    -286, -279, -302, -391, -429, -427, -373, -454, -574, -768, -874, -977,
-    -836, -838, -614, -560, -788, -991, -1026, -1081, -1314, -1492, -1302, -1179,
-    -1161, -999, -822, -920, -1112, -998, -1205, -1419, -1144, -962, -782, -717,
-    -858, -729, -573, -641, -681, -661, -671, -636, -512, -375, -222, -358,
-    -816, -874, -1005, -986, -945, -976, -1099, -701, -570, -684, -799, -925,
-    -878, -884, -752, -489, -623, -881, -866, -453, -89, -103, -324, -490,
-    -666, -585, -585, -628, -699, -527, -604, -730, -690, -773, -871, -869,
-    -749, -758, -812, -751, -781, -1037, -992, -1097, -1049, -1158, -767, -827,
-    -633, -342, -490, -525, -680, -444, -351, -350, -302, -489, -400, -275,
-    -141, -58, 117, -84, -274, -430, -310, -505, -247, 83, -406, -638,
-    -645, -489, -655, -568, -470, -357, -311, -16, 373, 383, 184, 113,
-    -125, -180, -294, -511, -489, -378, -427, -201, 34, 42, -147, -42,
-    -40, -347, -339, -742, -341, 84, 57, 127, 29, 106, 47, -21,
-    -247, -89, 249, 110, 297, 255, 512, 537, 520, 457, 499, 872,
-    1262, 1084, 767, 758, 1049, 1128, 1011, 690, 543, 637, 703, 735,
-    850, 844, 958, 987, 755, 609, 497, 492, 472, 301, 268, 200,
-    319, 442, 512, 459, 289, 366, 179, 286, 477, 590, 233, 41,
-    -18, 386, 711, 629, 682, 701, 881, 989, 981, 765, 1094, 1008,
-    759, 442, 631, 357, 559, 839, 788, 761, 1341, 1323, 799, 951,
-    992, 1054, 809, 513, 467, 700, 989, 839, 879, 1157, 1036, 852,
-    449, 655, 968, 955, 654, 346, 261, 341, 602, 373, 515, 489,
-    437, 832, 531, 146, 296, 478, 294, 345, 569, 334, 407, 496,
-    578, 344, 796, 1429, 1046, 880, 902, 504, 659, 973, 782, 780,
-    1300, 1308, 1135, 1284, 806, 406, 259, 504, 892, 740, 146, 202,
-    361, 162, 545, 615, 710, 612, 811, 872, 1105, 662, 631, 837,
-    948, 454, -35, 663, 528, 518, 634, 855, 715, 725, 476, 162,
-    320, 528, 230, 238, 333, 512, 492, 548, 655, 362, 47, -287,
-    198, 683, 34, 534, 468, 473, 770, 263, 530, 602, 818, 380,
-    213, 91, 80, 642, 848, 556, 768, 660, 469, 851, 439, 918,
-    839, 509, 79, 812, 710, 290, 109, -59, 504, -373, 535, 448,
-    820, 556, 457, 542, 118, -562, 67, -128, -541, -778, -764, -681,
-    -499, 29, -161, -307, 329, -168, 13, -43, 265, 121, -266, -519,
-    -559, -359, -409, -940, -985, 212, -614, -4, 118, 94, 1082, 603,
-    -592, -240, -206, -315, -283, 393, 267, -629, -54, 117, -244, -551,
-    123, 21, -152, -969, -615, -220, -271, -916, -551, -445, 135, -1234,
-    -1343, -1721, -1443, -37, -1144, -1443, -615, -567, -887, -1031, -810, -513,
-    -930, -1539, -747, -473, -11, 430, 179, -132, 203, -297, -1486, -1018,
-    115, 243, 27, 36, -232, 59, -319, -267, -753, -1446, -672, -1674,
-    -2146, -317, -155, -607, 259, -366, 89, 238, -1168, -1039, -55, -645,
-    -371, 355, 601, -1068, -719, 343, -526, -1598, -626, -497, -590, -882,
-    -467, -284, -555, -305, -892, -1683, -1847, -720, -185, -642, 55, -657,
-    -863, -638, 291, -763, -1039, -1053, -1580, -1274, -1513, -1146, -37, -1602,
-    -1856, -18, -1043, 395, -1430, -1402, -1983, -1608, 1220, 44, 1253, 1255,
-    433, 408, -838, -1043, -1163, -1455, -2142, -433, 59, -653, -430, -773,
-    447, 508, 1615, 2052, 799, 577, -653, -2311, -1619, -794, -2346, -1483,
-    -668, -1562, -2246, -1371, -1734, -1926, 337, 1135, 1699, 804, 918, 1175,
-    2033, 1331, 1128, 135, 36, 1281, 1632, 1597, 1218, 2925, 1940, 796,
-    15, 148, -1186, -786, -515, -2332, -482, -342, -371, -65, 1332, 1336,
-    -243, -513, 1025, 2759, 2813, 1131, 1427, 2914, 3773, 3868, 3862, 2919,
-    946, 1071, 488, 1657, 1896, 1405, 1577, 439, -1118, -1178, -1298, -2332,
-    -4108, -3180, -3494, -3513, -2224, -628, 266, 354, -712, -316, -353, -1334,
-    358, 290, 1880, 2610, 1669, 2391, 2697, 655, 1479, 864, 54, -722,
-    167, 346, 400, 587, 254, 687, 142, -1599, -1947, -1407, -2787, -3392,
-    -1417, -3698, -3194, -2155, -1099, 116, -1074, -819, -1235, -1357, -257, -1139,
-    -501, 155, 1497, 901, 365, 930, 391, -75, -154, -1083, -665, 247,
-    -1621, -1202, -486, -660, -1614, 584, -1340, -2003, -3136, -1934, -2569, -2941,
-    -1477, -1349, -601, -1584, -1988, -1681, -1658, -2294, -887, -10, 1432, 993,
-    184, 1426, 690, 347, 1853, 1679, 104, -416, 132, -68, 138, 439,
-    1647, 1090, 653, 246, -1461, -2302, -2937, 17, 109, -978, -1004, -154,
-    -288, 672, -2829, -1491, -1255, -1428, 1268, 2445, 3901, 3642, 2112, 641,
-    1125, 207, -572, 1356, 1260, 1424, 1583, 1748, 1997, 3332, 3377, 2477,
-    2569, 3002, 758, -416, -539, -60, 1512, 2790, 1894, -610, -554, 144,
-    -478, 336, 235, 67, 2960, 1341, -425, 1636, 1956, 1587, 3900, 3772,
-    1961, 43, 1387, 1108, 2012, 1634, 481, 2373, 851, 992, 1600, -364,
-    -700, -1865, -207, -413, 1050, 1564, 2104, 1273, 1255, 1256, 719, -22,
-    1355, 1089, 2160, 3709, 4340, 3212, 1809, 1793, 3156, 1564, 655, 2079,
-    900, 981, 2770, 2894, 3093, -76, -908, -1078, -1208, -2119, -2987, -1492,
-    -1688, -2945, -2430, 115, 58, -1610, -1772, -696, -312, -915, -181, 937,
-    1831, 1619, 1755, 1968, 85, -148, 2042, 1909, 213, 644, 148, -77,
-    125, 249, 1127, 918, -94, -536, -2720, -4370, -1951, -1823, -1859, -2260,
-    -2065, -736, -1115, -1775, -1974, -2212, -1908, -1187, 81, -1173, -900, 1008,
-    1593, 1777, 2708, 2827, 2890, 742, -159, 511, -1745, -1074, 1213, 1149,
-    1197, -476, -975, 345, -1882, -2170, -2761, -1261, -1407, -3698, -2742, -2556,
-    -1188, -481, -1641, -2193, -2434, -2535, -2486, -2271, -1402, 665, -406, 76,
-    863, 220, -553, 238, 730, -796, -1111, -360, 1448, -16, -1115, -364,
-    341, -294, 1537, -462, -2764, -1235, 759, -792, -1391, 633, 563, 138,
-    -3375, -1989, -140, -25, 686, 1564, 2545, 2009, 824, 1559, -62, 397,
-    1267, 628, 150, 1207, -820, -1330, -538, -700, 1008, 1692, 349, -1129,
-    359, 539, -690, -1500, -1425, -913, -1010, -1070, -2326, -2423, -421, 641,
-    160, 311, 338, 2127, 2221, 1578, 819, 1546, 3053, 2181, 1016, 322,
-    383, 2588, 2745, 949, 1241, 687, 301, -790, 363, -639, -1428, -1853,
-    -1469, -1725, -1519, 829, 2325, -29, -276, -246, 1391, 1560, 1288, 19,
-    954, 2453, 3331, 2410, 3174, 3816, 3184, 2016, 1511, 794, 2284, 761,
-    303, 979, 1423, -985, -1876, -2189, -2105, -1923, -2674, -824, -1084, -1792,
-    -2019, -1195, -1035, -1886, -3984, -1727, -2486, -1056, 1145, 986, -450, 821,
-    1781, 1579, 1248, 1163, 1783, 268, -388, -652, -309, 430, 1245, 252,
-    -108, -1221, -948, -469, -836, -1749, -2079, -686, -1590, -2878, -2403, -911,
-    -797, -421, -2158, -2872, -1262, -814, -496, -636, -599, -12, 1493, 813,
-    1048, -55, -560, -680, 582, -582, -2027, -2367, -884, 205, -36, -119,
-    -119, 311, 507, -1182, -583, -2669, -3725, -2488, -1813, -220, -364, -2282,
-    -2919, -2111, -2119, -951, 90, -1021, 399, -1107, -827, 312, 31, -99,
-    358, 702, 305, -1310, -1529, -1903, -1852, 105, -874, -1163, -616, -726,
-    -715, -1186, -517, 1054, -193, -700, -41, 349, 1212, 5, -617, -709,
-    -2006, 410, 2097, 3371, 1704, 695, 806, 1279, 300, 1545, 505, -149,
-    1934, 2824, 1203, 239, 292, 465, 1819, 2777, 918, 1277, 964, 339,
-    -1242, -819, 432, 600, 43, -412, -976, -1845, -1355, 743, 528, 103,
-    2089, 2763, 2956, 3110, 2666, 3216, 3462, 1025, 1431, 639, 1073, 2450,
-    3019, 394, 101, 511, 274, 804, 961, 154, -1571, -579, -814, -1279,
-    997, 1286, 776, -956, -1289, 648, 1245, 1489, 2307, 3485, 4487, 3726,
-    3751, 2567, 2657, 3529, 4406, 2004, 1270, 2270, 2347, 2545, 3966, 2763,
-    2275, 1192, 495, 56, -1761, -2070, -858, -978, -2017, -3368, -2155, -317,
-    -614, -1407, -1747, -1770, -1959, -796, -1317, -615, 366, 94, 1503, 1866,
-    1078, 402, 1160, 1129, 445, 116, -111, 27, -142, 1364, 800, -452,
-    -765, -476, -1330, -883, 339, -1957, -2528, -690, -11, -47, -1019, -2590,
-    -2079, -2829, -429, -680, -1098, 553, 1207, 1139, 761, 634, 1628, 1924,
-    921, 603, -110, -2818, -2488, -1035, -179, -8, 851, -1103, -823, -931,
-    -856, -1854, -1577, -1047, -2398, -2452, -1552, -1530, -3067, -3011, -2897, -2092,
-    -1113, -332, -935, -660, 183, -253, 193, 324, 1296, 881, -408, -579,
-    -862, -450, 279, -54, -535, -1494, 22, -219, -486, -978, -1364, -538,
-    25, -1440, -1499, -1365, 394, 895, 500, -646, -541, -42, 879, 2922,
-    3736, 2710, 2806, 3306, 3117, 884, 239, 492, -346, 854, 3473, 1776,
-    551, -57, -438, 314, 952, 1688, 1216, 768, 441, 251, -63, -2537,
-    -489, 752, -862, -2410, -1960, -1320, -109, -1266, -92, 2070, 1257, 2803,
-    3307, 1871, 3136, 3889, 2506, 738, 691, 741, 2602, 3098, 3458, 3634,
-    2099, 497, -739, -395, -518, -410, -436, -1660, -2498, -1677, 654, 112,
-    -661, -1009, -687, 2, 790, 593, 1744, 3097, 3569, 2094, 2326, 2731,
-    1887, 2573, 1574, 1000, 370, 683, 1479, 2177, 2221, 1513, 229, -1490,
-    -322, 232, 78, -112, -626, -513, -1735, -1246, -189, 320, -275, -821,
-    -2741, -1685, -1847, -2261, -1901, -932, 894, 540, 1229, 1213, 125, 486,
-    306, 10, -1175, -2215, -1297, -1417, -1918, -1517, -1284, -1182, -2099, -2318,
-    -2277, -1627, -2508, -2285, -1206, -2354, -1309, -482, -1226, -1081, -1005, -1277,
-    -1306, -1084, -967, -544, 880, 675, 963, 1609, 1018, -456, -851, 48,
-    146, -1240, -1239, -1067, -391, 216, 768, -1125, -2319, -1184, -1981, -2919,
-    -3520, -2261, -1983, -2285, -1914, -2373, -2035, -1233, -2480, -1800, -1434, -1905,
-    -731, 114, -740, -389, 1151, 1031, 882, 1223, 91, -533, -1001, -1460,
-    -739, -1020, 484, -253, -1524, -1729, -1485, -775, -1891, -2152, -2773, -1891,
-    -1979, -947, -49, 321, 369, -1974, -1705, -962, 325, 2057, 3432, 3647,
-    3383, 3053, 1545, 589, 2440, 2825, 1458, 1006, 2936, 1635, 465, 1917,
-    1763, 1909, 2563, 2084, 1301, 1129, 651, -676, -1566, -1261, -332, 421,
-    -234, -2466, -1710, -2441, -1773, -175, 0, 1006, 2401, 1485, 1395, 1475,
-    2658, 2282, 1504, -948, -1482, 773, 1993, 1771, 2590, 1520, 69, 157,
-    -196, -147, -42, -883, -727, -744, -1178, -157, 413, 1836, 2606, 868,
-    479, 1354, 788, 1801, 1915, 2708, 3647, 3289, 3380, 3758, 2415, 2221,
-    2321, 1745, 622, 902, 2292, 1252, 796, 971, 37, -503, -161, -293,
-    -970, -238, -16, -1407, -2840, -1159, -775, -488, -257, -596, -2112, -2473,
-    -1905, -514, -787, -25, 881, 34, -155, 405, 790, 694, -734, -424,
-    -1194, -1710, -622, -693, 562, 461, -446, -866, -2417, -2351, -1683, -2056,
-    -1348, -2565, -2710, -1210, -980, -1548, -554, 209, -600, -1243, -1080, -639,
-    421, 698, 1779, 582, 842, 842, 665, 387, 152, 118, -351, 191,
-    -355, -67, 322, -107, -687, -1062, -1792, -2226, -2183, -2728, -2538, -2084,
-    -2295, -3711, -2660, -1192, -998, -1674, -1603, -2408, -2530, -1087, -404, -263,
-    156, 733, 1557, 1274, 624, 207, -7, 608, 469, 200, 352, -218,
-    -1532, 280, 497, -549, -1017, -14, 496, 288, 73, -167, -608, -913,
-    -80, 159, 958, 1362, 611, 810, 1252, 2016, 1673, 339, 885, 681,
-    284, 803, 952, 849, -225, -930, -198, 628, 391, 971, 1022, 405,
-    1054, 1173, 1027, 1373, 620, 214, 799, 1595, 1538, 944, 1136, 660,
-    1421, 1416, 1005, 1105, 1033, 1279, 990, 272, 1084, 1090, 1467, 1047,
-    1034, 1264, 792, 1364, 1454, 881, 290, 473, 667, 119, -84, 684,
-    -251, 137, 706, 439, 734, 1098, 1069, 1169, 1715, 458, 137, 1385,
-    1169, 980, 1075, 1200, 1248, 1640, 871, 1107, 717, 1200, 966, 608,
-    234, -104, 684, 661, 657, 958, 524, 69, 683, 1034, 571, 269,
-    247, 313, 888, 291, -759, -22, -248, -296, -749, -1293, -1276, -834,
-    -114, -187, -454, -420, -1286, -1094, -985, -1583, -1306, -1189, -1792, -1559,
-    -1424, -961, -1240, -470, 318, -1276, -1821, -770, -493, -471, -568, -851,
-    -959, -775, -1017, -123, -531, -105, 154, -344, -566, 190, 512, -142,
-    -643, -898, -147, 134, -95, -1127, -1362, -1500, -1427, -397, -274, -388,
-    224, 337, 241, -38, -94, -52, -800, -995, -1015, -587, -900, -1451,
-    -1232, -1592, -1864, -1864, -1419, -902, -694, -1276, -1958, -2081, -1742, -1410,
-    -1530, -1356, -979, -1522, -1274, -974, -565, -453, -970, -867, -65, -177,
-    -269, -530, -393, 108, -271, -1027, -540, 60, 423, 996, 708, 1044,
-    1087, 1341, 1849, 1438, 1266, 1541, 452, 224, 954, 470, 1000, 687,
-    801, 517, 697, 952, 960, 512, 178, -69, -184, -470, -164, 980,
-    732, 861, 516, 582, 1141, 676, 264, -240, 68, 742, 471, -13,
-    -139, 747, 466, 621, 265, 27, 387, 496, 508, 113, -208, -32,
-    211, 471, 139, 573, 192, -514, 21, 883, 196, -99, 287, 491,
-    659, 815, 621, 376, 520, 1550, 1205, 1977, 2148, 2026, 2240, 2201,
-    1699, 1509, 1796, 1075, 297, 1000, 745, 414, 652, 1223, 1347, 946,
-    657, 441, -354, -111, 84, 266, 736, 146, -199, 363, -555, -1144,
-    -1378, -749, -331, -725, -1196, -634, -889, -1715, -1707, -1287, -1158, -1128,
-    -1709, -1302, -1095, -1210, -1431, -1804, -1500, -1203, -672, -1062, -929, -968,
-    -918, -520, -828, -933, -1071, -575, -260, -349, 215, -102, -1187, -1106,
-    -1082, -553, -374, -669, -1130, -676, -600, -904, -194, -753, -606, -1116,
-    -1092, -1251, -1376, -1282, -1288, -1459, -929, -656, -317, -255, -40, 310,
-    282, 263, -511, -729, -809, -443, -281, -166, -639, -1374, -1717, -982,
-    -807, -1014, -1228, -877, -558, -632, -787, -1011, -1080, -1048, -1795, -1802,
-    -1461, -1407, -631, -713, -775, -806, -1194, -1317, -1059, -500, -398, -170,
-    -180, -6, -482, 230, 337, 265, 633, 555, 194, 568, 1323, 2049,
-    1583, 1405, 1378, 1416, 1472, 1505, 1761, 1713, 1722, 1475, 1469, 1162,
-    688, 720, 959, 1362, 1176, 500, 500, 1023, 1222, 1457, 1427, 1045,
-    670, 825, 389, 545, 479, 346, 590, 1268, 1867, 1993, 1414, 1188,
-    1469, 1695, 616, 92, 337, 519, 710, 611, 1224, 522, 418, 872,
-    1191, 986, 369, 226, 579, 626, 756, 159, 192, 461, 422, 733,
-    468, 795, 609, 450, 1073, 880, 1240, 1233, 931, 368, 824, 586,
-    812, 1140, 1322, 1207, 1616, 1556, 1210, 1558, 1542, 788, 719, 826,
-    1368, 1557, 1024, 867, 1184, 1289, 1156, 657, 200, 263, 115, -65,
-    -29, -165, -241, -268, 35, -161, -1255, -1575, -1141, -1133, -1795, -1957,
-    -1806, -1942, -2251, -2388, -2710, -2193, -2074, -1790, -1221, -872, -517, -1204,
-    -1372, -879, -657, -680, -785, -1010, -651, -692, -652, -944, -46, -21,
-    52, 613, 1026, 535, 262, 47, -54, 522, 280, 187, -395, -727,
-    -681, -200, -170, 77, 25, -49, 124, -131, -371, -866, -727, -743,
-    -453, -1174, -1331, -1468, -1153, -1000, -606, -342, -548, -906, -714, -877,
-    -1223, -1751, -1490, -1361, -1262, -1101, -866, -416, -789, -650, -299, -525,
-    -804, -556, -537, -342, -182, -22, -242, 84, -152, -70, -234, 203,
-    3, -487, 202, 648, 561, 292, 661, 902, 719, 1141, 1177, 1630,
-    1493, 1140, 1523, 2005, 1802, 1624, 993, 1451, 1374, 1196, 831, 962,
-    979, 1617, 1306, 1293, 1013, 760, 1081, 1064, 636, 575, 465, 327,
-    678, 727, 19, -12, -354, 534, 1105, 378, 129, -8, -152, -165,
-    118, 165, 231, 40, -73, 85, 211, 582, 389, 846, 467, 617,
-    523, 784, 976, 1025, 1008, 873, 328, 509, 317, 313, 716, 710,
-    1093, 761, 1112, 1195, 1087, 1395, 1573, 985, 878, 1275, 1652, 1354,
-    940, 823, 114, 80, 154, -78, 282, 466, 629, 906, 519, 102,
-    -77, 9, 287, 332, 421, 371, 38, -461, -650, -928, -60, -812,
-    -301, -452, -390, -179, -369, -467, -899, -1638, -1608, -2060, -1559, -1500,
-    -1257, -738, -934, -1338, -1050, -775, -744, -636, -1209, -762, -1143, -1039,
-    -1310, -851, -507, -304, -337, -1126, -888, -529, -510, -461, -764, -866,
-    -802, -539, -114, -537, -854, -510, -403, -557, -927, -1156, -1062, -372,
-    126, 40, -249, -573, -327, -27, -69, -360, -877, -630, -565, -587,
-    -241, 89, -545, -540, -597, -770, -628, -677, -465, -663, -603, -777,
-    -521, -715, -1012, -1186, -1007, -918, -794, -919, -1086, -1247, -887, -537,
-    -526, -469, -625, -640, -743, -738, -1041, -976, -718, -676, -540, 4,
-    -270, -69, -230, -315, 247, 62, 381, 442, 1049, 1438, 956, 912,
-    1026, 1354, 1386, 1302, 1048, 1365, 1659, 1791, 1509, 1282, 1178, 1156,
-    1016, 908, 1067, 1071, 1152, 1380, 1379, 1315, 573, 498, 746, 889,
-    627, 509, 211, 97, 48, 205, -102, 287, 607, 272, 444, 521,
-    628, 665, 517, 501, 536, 497, 494, 291, 223, 488, 792, 586,
-    160, 367, 443, 277, -221, -144, -96, 79, 107, 215, 335, 521,
-    721, 857, 1040, 788, 665, 453, 451, 635, 495, 588, 473, 900,
-    704, 971, 1222, 679, 266, 119, 550, 968, 614, 1069, 793, 772,
-    956, 580, 208, -146, -19, 454, 602, 367, -167, -239, -360, -664,
-    -607, -728, -1290, -1719, -1563, -1298, -1359, -1602, -2027, -1580, -1541, -1635,
-    -1433, -1588, -1456, -1223, -1237, -1470, -1210, -997, -1793, -1575, -826, -631,
-    -460, -268, -367, -544, -825, -708, -249, -225, -103, -176, 181, 604,
-    384, -81, -281, -606, -717, -689, -934, -509, -553, -372, -604, -833,
-    -900, -476, -406, -262, -116, -718, -1043, -870, -932, -680, -1244, -1596,
-    -946, -1055, -1425, -1369, -1375, -999, -756, -875, -591, -819, -727, -224,
-    -195, 4, -200, -852, -313, 624, 546, 322, 57, 281, 338, 395,
-    74, 101, 498, 988, 913, 749, 382, 142, 712, 796, 594, 505,
-    638, 571, 359, 735, 917, 747, 968, 596, 1052, 1046, 813, 1108,
-    1031, 1243, 1326, 1404, 1227, 1212, 1565, 1744, 1896, 2056, 1415, 1069,
-    1112, 1132, 1361, 1686, 1159, 800, 1177, 1616, 1797, 1327, 1268, 1304,
-    750, 816, 727, 1011, 1176, 922, 958, 773, 454, 838, 1015, 1029,
-    652, 302, 315, 353, 180, 173, 691, 442, -29, -110, 85, 270,
-    8, -111, 240, 397, 422, 556, 602, 540, 767, 1361, 1111, 747,
-    937, 974, 1701, 1268, 1270, 1192, 454, 591, 664, 558, 631, 667,
-    839, 762, 816, 414, 107, -132, -608, 21, 275, 176, -461, -474,
-    -200, -780, -1284, -1762, -1331, -449, -778, -1253, -1409, -1168, -730, -639,
-    -996, -1609, -1105, -1491, -1907, -2261, -2294, -1873, -1570, -1589, -1904, -1795,
-    -1236, -1808, -2354, -1909, -1568, -1050, -1334, -1867, -1779, -1863, -1771, -993,
-    -687, -698, -955, -1234, -1627, -1487, -1561, -1748, -1029, -1064, -1153, -681,
-    -103, -88, -341, -1064, -933, -31, 163, -174, -3, -329, -1107, -985,
-    -583, -776, -230, -324, -982, -1149, -888, -543, -1426, -768, 77, -769,
-    -704, -1163, -2170, -2427, -2753, -2025, -1168, -1162, -956, -337, -403, -919,
-    -1281, -1338, -1152, -587, -433, 229, 33, 242, 1140, 969, 847, 968,
-    697, 713, 630, 177, 766, 657, 963, 1014, 451, 642, 143, 306,
-    662, -2, 930, 1689, 1516, 1161, 737, 1088, 1765, 2293, 990, 617,
-    1626, 2470, 2839, 2913, 4442, 4103, 2871, 1606, 1188, 1103, -487, -927,
-    -350, 25, 884, -65, 445, 1617, 1726, 1986, 837, 791, 702, -291,
-    -195, -233, -270, 141, 1112, 420, -603, -1062, -1066, 268, 881, 848,
-    1449, 2162, 2045, 2536, 2305, 2367, 2096, 578, 820, 1572, 2025, 1401,
-    985, 927, 1525, 830, -1085, -1052, -174, 288, -322, 167, 238, -72,
-    252, 700, 276, -56, -744, 36, 921, 1250, 586, 1454, 2893, 2589,
-    2479, 1759, 1891, 1556, 1925, 820, -192, -416, -237, -7, 288, 1630,
-    -47, -1275, -1727, -1889, -1685, -2656, -3322, -1416, -2254, -3709, -2794, -616,
-    -728, -1300, -1695, -1287, -729, -805, -1005, -199, 68, -156, 389, 162,
-    377, -532, -739, -651, -1386, -1896, -1443, -781, -1340, -2551, -2133, -2269,
-    -3122, -3018, -3151, -3459, -4037, -3362, -3683, -3438, -2573, -1032, -1170, -704,
-    -1341, -2128, -2299, -603, -835, -274, 502, 1595, 1528, 769, 653, 1712,
-    2310, 876, -462, -1147, 130, 341, -561, -735, -431, -1546, -1953, -1977,
-    -2856, -2225, -2147, -2257, -3040, -1795, -1512, -1805, -1202, -1374, -1655, -893,
-    -623, -143, 414, 1171, 2041, 2493, 3004, 2448, 1132, 1019, 971, 669,
-    112, -700, 194, 1122, 1523, 1545, 1325, 2159, 1103, 57, -693, -724,
-    -1165, -1235, -387, 393, 834, 489, 1748, 1979, -366, -782, 78, 1729,
-    3987, 4822, 4574, 2929, 2484, 2645, 2966, 2611, 2213, 2079, 2535, 2606,
-    2111, 2068, 1932, 988, 2030, 2935, 1945, 752, 1248, 1572, 116, -805,
-    -1204, -88, -2, -608, -646, -719, -1694, -717, 127, 220, 760, 1986,
-    2198, 2103, 1048, 1564, 1566, 689, 849, 1744, 1535, 781, 2523, 1433,
-    -167, 1011, 725, 238, -57, -147, 610, 564, -328, -992, 570, 1339,
-    504, -282, -1051, 320, 1274, 1399, 772, 1294, 2144, 1707, 2657, 2363,
-    1139, -456, 491, 235, -641, -1975, -540, 731, -423, -2283, -2194, -1303,
-    -2203, -4195, -4139, -3840, -4192, -4340, -4004, -4677, -3638, -726, -1534, -3093,
-    -2782, -1904, -2127, -1983, -1700, -447, -27, -274, -352, 228, 812, 1210,
-    843, -1424, -1050, -669, 377, -324, -381, -1045, -1358, -1322, -988, -1731,
-    -2958, -3130, -3914, -3612, -3463, -3392, -2403, -2267, -1854, -2204, -2627, -2852,
-    -2912, -1465, -1001, -73, 366, 1131, 956, 401, 926, -328, -1056, -755,
-    -1987, -1556, -2399, -2499, -593, 44, -585, -1264, -1631, -2194, -2088, -2121,
-    -2747, -3542, -2063, -1709, -2123, -1730, 54, -194, -248, -667, -1014, -398,
-    637, 1092, 1522, 2476, 2802, 2164, 1603, 1623, 1994, 1545, -54, 265,
-    1464, 1867, 1360, 2070, 1536, 1080, -403, -1408, -245, -209, -756, -609,
-    1158, 337, 990, 862, 1420, 1597, -979, -176, 1033, 1781, 3458, 3872,
-    2853, 2265, 2561, 2548, 1437, 1403, 2459, 1146, 1020, 2276, 2006, 653,
-    1365, 2361, 2819, 2372, 1451, 986, 411, -236, 177, 836, -209, 1280,
-    950, -782, -1145, -358, -544, -608, 1367, 1727, 1211, 3150, 3671, 3255,
-    2490, 1607, 1634, 1500, 466, 700, 1511, 1531, 1247, 325, 1375, 1491,
-    6, -1229, -1382, -231, -1084, -1308, -1205, -2179, -343, 933, -180, -633,
-    64, 111, 562, 1014, 447, 1480, 2078, 1339, 1717, 1050, 734, 702,
-    1173, -129, -652, 569, 636, 842, 1520, 636, -235, -955, -1810, -1918,
-    -2038, -2739, -3357, -4053, -3463, -2826, -2721, -2333, -3042, -2299, -3095, -3918,
-    -3013, -2169, -1348, -1042, -539, -83, -451, -606, -484, -1010, -1869, -1747,
-    -3413, -5145, -3274, -696, -1306, -1670, -750, -1292, -1656, -1246, -2247, -1830,
-    -1679, -1592, -2595, -1952, -1460, -1547, -1306, -1625, -2186, -2122, -1049, -107,
-    -201, -528, 350, -228, 38, 1163, 1141, 584, -662, -628, -1412, -2883,
-    -2639, -1479, -1186, -1323, -567, -137, -734, -542, -1013, -2047, -3551, -2157,
-    -1648, -1474, -653, 213, 1, -1825, -1828, -1107, -781, 345, 603, 624,
-    1373, 2149, 1886, 1655, 2144, 1956, 2224, 1869, 2602, 1224, 397, 1257,
-    2105, 1739, 2330, 1640, 845, 924, 2390, 720, -1194, 185, 726, 196,
-    1703, 2178, 1769, -387, 9, 691, 655, 2293, 4349, 4689, 3647, 2986,
-    2817, 979, 95, 1443, 2607, 2273, 2708, 1160, 44, 665, 2349, 2630,
-    1804, 2088, 1251, 136, 325, -512, -1479, -2289, -138, -442, -340, -1498,
-    -1315, -777, -249, 986, 814, 865, 2291, 2456, 2145, 1583, 580, 2270,
-    1886, 250, 1009, 1521, 2579, 1954, 2088, 2324, 1579, 1875, 1326, 745,
-    89, -987, -2268, -1887, -899, -757, 660, 1692, 306, -581, -871, -1126,
-    -581, -226, 528, -186, 88, 1013, 851, 172, -558, 727, 205, -2643,
-    -3393, -1993, -881, -567, -1145, -1628, -2426, -2753, -2459, -2113, -3512, -3954,
-    -2263, -2679, -4023, -2046, -664, -697, -1856, -2156, -1589, -2256, -2282, -1023,
-    -179, 859, 267, 478, 1285, 1262, 271, 969, 498, -1915, -2783, -3090,
-    -2871, -1851, -1664, -1419, -1629, -1272, -882, -2196, -3302, -3216, -3323, -5009,
-    -4197, -2647, -2123, -1114, -1268, -1356, -1010, -1712, -1766, -1366, -1120, -442,
-    853, -127, -496, 164, 451, -187, -846, -1657, -1868, -1454, -737, -729,
-    -10, -178, -733, -496, -785, -946, -718, -2080, -2595, -1155, -193, -447,
-    -457, 1387, 1938, 1121, 521, 907, 990, 1067, 2036, 2086, 2430, 3230,
-    2510, 2617, 2229, 1970, 1220, 940, 957, 16, -166, 368, 1245, 1056,
-    1444, 1869, 509, -676, -1132, -1703, -2443, -1128, -410, 748, 1007, 1866,
-    861, -212, 378, -249, 1192, 4036, 5271, 4694, 4017, 3139, 2410, 1469,
-    2076, 1785, 1677, 1921, 4037, 3019, 2642, 3275, 3466, 3989, 3768, 3003,
-    2194, 1691, 440, -32, -648, -2278, -202, 488, -520, -1039, -1610, -1846,
-    -1193, -1207, -884, -104, 551, 206, 206, 922, -102, 18, 2, -493,
-    -884, 750, 2019, 1503, 1120, 379, 856, 1375, 285, -1078, -1513, -1221,
-    453, 449, -1310, -900, 1123, 1832, 1997, 475, -781, -655, -376, 803,
-    1766, 1298, 756, 1823, 2103, 1669, 861, 79, -477, -821, -444, -215,
-    -468, -439, -22, -577, -1982, -2451, -2175, -3032, -2769, -2832, -3438, -3519,
-    -2657, -2920, -2864, -2290, -2290, -1972, -1251, -1297, -3066, -2706, -1648, -943,
-    -898, -1165, -1395, -1083, -870, -1148, -1198, -2801, -2854, -2378, -1890, -1207,
-    -1711, -1419, -1692, -1436, -2384, -3066, -4116, -3944, -2611, -2561, -3153, -2523,
-    -1148, 69, 352, -1420, -2125, -1868, -479, 128, 130, 453, 640, 1893,
-    1927, 1138, 1296, -498, -219, 404, -913, -1553, -1364, -1319, -1074, -1057,
-    -516, -643, -2255, -2745, -3274, -3152, -3626, -3656, -2617, -2054, -1717, -879,
-    -212, -1292, -1394, -1131, 666, 1446, 2250, 2192, 3467, 3758, 3185, 2854,
-    3439, 3663, 3023, 2556, 2069, 1743, 2740, 2317, 2556, 2831, 3000, 2593,
-    2076, 1051, 97, -369, -582, -211, -775, -228, 807, 1345, 929, -522,
-    -713, -624, 1394, 2798, 3277, 3261, 2846, 2313, 1472, 702, 747, 866,
-    1608, 1740, 2350, 2103, 1517, 2010, 2379, 2843, 2674, 1763, 1553, 1106,
-    1776, 1630, 521, -170, 334, 570, 440, -1205, -1689, -1468, -296, 320,
-    381, 930, 1338, 1694, 1998, 2020, 1885, 2787, 1277, -515, -392, 1014,
-    1525, 1750, 1833, 1671, 1420, 600, -395, -603, -1135, -1315, -230, -178,
-    -1364, -353, 1471, 1433, 743, -60, -1058, -1604, -924, -619, -427, 493,
-    826, 762, 590, 99, -297, 537, -672, -2001, -2536, -1933, -856, -824,
-    -778, -1576, -2314, -3195, -2945, -2642, -3029, -3111, -2994, -2503, -2448, -3133,
-    -1615, -188, -525, -1168, -1724, -1717, -2010, -942, 271, 7, 799, 1104,
-    1004, 931, 340, -393, -997, -1474, -2361, -2472, -2126, -2206, -2028, -2310,
-    -2819, -3036, -3822, -4491, -4317, -4074, -3739, -3604, -3143, -3208, -2695, -1761,
-    -1707, -1619, -1304, -859, -946, -1062, -987, -122, 919, 1286, 1358, 1541,
-    1730, 1273, 1662, 1151, 1067, 830, 981, 8, 86, 418, -110, 134,
-    138, -985, -1560, -2000, -2013, -717, -586, -805, -1386, -733, -307, -627,
-    -669, -437, -155, 533, 121, 970, 935, 1011, 1667, 1907, 2067, 1627,
-    1565, 1542, 1382, 1429, 1264, 1726, 1435, 1385, 1698, 2017, 2303, 1874,
-    1806, 1852, 1440, 2107, 2147, 2248, 2454, 1806, 1659, 1553, 916, 1423,
-    2197, 1979, 1661, 2170, 1711, 1883, 2238, 1612, 1119, 1142, 831, 741,
-    606, 751, 1345, 1488, 999, 1223, 1042, 991, 426, -135, 101, 830,
-    1306, 1023, 624, 816, 186, 537, 324, -132, -338, 46, 103, 284,
-    468, 612, 563, 226, 190, 732, 372, 14, 136, 565, 953, 561,
-    1165, 1261, 1255, 699, 693, 464, 19, 410, 808, 1083, 1389, 701,
-    158, 523, 459, 310, 526, 378, 403, 594, 153, 796, 447, 312,
-    -545, -295, -871, -1280, -1355, -2167, -2321, -2047, -1749, -2087, -2319, -2486,
-    -2592, -2453, -2311, -2254, -2225, -2309, -2505, -2582, -1998, -1613, -1431, -1677,
-    -2280, -1902, -1147, -1362, -1236, -1166, -127, -290, -648, -815, -403, -671,
-    -817, -476, -120, -1032, -904, -903, -799, -1249, -1177, -859, -1194, -1727,
-    -1721, -1588, -1229, -1152, -1315, -1172, -950, -1209, -1332, -1430, -1440, -1462,
-    -1373, -1302, -1449, -1685, -2150, -1680, -1457, -1392, -1776, -1532, -1112, -1116,
-    -1680, -1680, -1539, -1677, -1102, -534, -573, -255, 261, 258, 969, 1061,
-    1062, 566, 1045, 1362, 1619, 1217, 1280, 1269, 1268, 1303, 1439, 1765,
-    1056, 1056, 1301, 1322, 1599, 1060, 1182, 1362, 1846, 1606, 865, 915,
-    594, 564, 1252, 1386, 1747, 1802, 1924, 1706, 1465, 1039, 1177, 1512,
-    1590, 1786, 2711, 2779, 2333, 2171, 1986, 1817, 2017, 1515, 1151, 1249,
-    1082, 1328, 1599, 1171, 742, 759, 487, 433, 125, 15, 412, 936,
-    1158, 618, 689, 737, 241, 352, 303, 529, 522, 1249, 1439, 1481,
-    1734, 1095, 762, 1075, 1090, 1122, 1790, 1758, 2119, 2444, 2304, 1886,
-    1259, 1035, 1160, 1411, 1574, 464, -436, -753, -361, -158, -691, -743,
-    -762, -1100, -870, -1053, -1028, -1171, -1121, -1210, -930, -545, -947, -1163,
-    -823, -500, -883, -952, -550, -529, -170, 200, -111, -13, -93, -453,
-    -503, -136, -138, -585, -744, -970, -872, -485, -827, -1088, -1342, -1895,
-    -1847, -1509, -1420, -1539, -1880, -1623, -1317, -1432, -1606, -1836, -2142, -1675,
-    -1562, -2036, -2252, -2228, -1697, -1843, -2251, -2484, -2465, -2278, -2172, -2430,
-    -2691, -2339, -2384, -2580, -2249, -2111, -1598, -1414, -1221, -1114, -744, -810,
-    -850, -340, -482, -223, 165, -371, -1231, -536, -141, -160, -218, -740,
-    -713, -471, -485, -386, -186, -508, -760, -1085, -1329, -1253, -495, -522,
-    -546, -735, -597, -716, -616, -748, -807, -465, 55, -355, -268, 72,
-    915, 1507, 1394, 906, 1220, 1307, 1712, 1731, 1311, 1134, 1550, 1185,
-    459, 863, 680, 985, 1002, 1132, 1408, 1288, 994, 935, 1098, 1657,
-    1499, 1276, 1043, 795, 1067, 1519, 1527, 1458, 1304, 1954, 2336, 2188,
-    1719, 1601, 1665, 1818, 1565, 2119, 2669, 2838, 2785, 3089, 3367, 3100,
-    2637, 2110, 1525, 1715, 1532, 1386, 862, 738, 456, 173, -347, -852,
-    -818, -711, -416, 20, 49, -187, -595, -205, -6, -295, -259, -288,
-    -422, -66, -236, 507, 266, 641, 712, 949, 1092, 1261, 916, 739,
-    1402, 1759, 1888, 1652, 1287, 1598, 1765, 1343, 1507, 997, 881, 784,
-    736, 271, 481, 394, 181, 244, 374, 144, 56, 11, -398, -696,
-    -736, -726, -1147, -795, -1010, -1445, -1239, -1284, -1776, -1729, -2048, -1939,
-    -1953, -2226, -2201, -2569, -2478, -2640, -2427, -2160, -1844, -1559, -1415, -1281,
-    -1058, -1138, -802, -647, -642, -606, -931, -1133, -948, -939, -1072, -1430,
-    -1245, -427, -239, -381, -523, -512, -687, -1054, -920, -1132, -1298, -1187,
-    -1016, -1225, -1417, -1370, -1531, -1618, -1978, -2122, -1878, -2073, -1845, -1520,
-    -1073, -1378, -1163, -607, -557, -656, -508, -276, -381, -531, -385, -37,
-    -203, -513, -741, -1222, -1360, -1316, -780, -677, -703, -651, -1028, -648,
-    -581, -486, -261, -72, 87, -177, 342, 220, 218, 466, 483, 497,
-    646, 685, 364, 303, 834, 993, 1198, 1890, 2116, 2400, 2816, 2267,
-    2315, 2495, 2095, 1587, 1666, 1604, 1328, 704, 860, 266, 25, -55,
-    483, 375, 473, 679, 1060, 999, 1208, 663, 424, 612, 830, 516,
-    426, 288, 653, 1071, 1287, 1448, 1212, 1097, 869, 1166, 1639, 1796,
-    1694, 1646, 1862, 1712, 2030, 1739, 1443, 1218, 1419, 1313, 954, 1063,
-    914, 700, 966, 984, 1184, 820, 1032, 1143, 738, 741, 959, 608,
-    410, 473, 513, 444, 304, 411, -24, -278, -18, -83, -148, -248,
-    -88, -333, -339, -659, -633, -959, -1048, -508, -54, -57, 213, 456,
-    744, 710, 434, 415, 328, 87, -80, -183, -308, -249, -466, -797,
-    -585, -250, -721, -701, -852, -851, -727, -1046, -1357, -1103, -1139, -1489,
-    -1798, -2192, -2394, -2342, -2118, -2378, -1993, -2173, -2233, -2328, -2616, -2371,
-    -2041, -1436, -1302, -1437, -1254, -1325, -1519, -705, -759, -645, -1023, -1166,
-    -1461, -1845, -1781, -1541, -1656, -2104, -1924, -2045, -1934, -1586, -1740, -1771,
-    -1787, -1695, -1337, -1338, -1141, -882, -878, -888, -829, -808, -781, -868,
-    -978, -932, -1027, -943, -601, -387, -242, 208, 803, 986, 573, 940,
-    1344, 634, 681, 839, 282, 125, 108, -444, -638, -967, -1059, -1126,
-    -772, -496, -60, 355, 486, 453, 917, 732, 441, 378, 365, 316,
-    553, 993, 843, 683, 742, 971, 1123, 989, 1425, 1540, 1460, 1513,
-    1602, 1656, 1893, 2162, 2413, 2037, 1829, 2208, 2021, 1814, 2266, 1992,
-    2269, 2312, 2184, 2015, 2234, 1851, 1479, 1291, 1578, 1094, 1421, 2013,
-    1820, 1647, 1510, 1207, 1276, 1068, 776, 865, 1002, 769, 435, 236,
-    154, 292, 515, 42, -355, -406, -438, 97, 381, 808, 1142, 1538,
-    1005, 1424, 1704, 1595, 1231, 758, 984, 1095, 832, 1392, 1183, 1167,
-    1119, 1055, 1039, 971, 1018, 834, 919, 1399, 941, 871, 619, 459,
-    -1, -17, -255, -722, -920, -890, -1219, -530, -526, -560, -583, -829,
-    -871, -1027, -898, -977, -543, -249, 191, 296, 440, 390, 47, -191,
-    -457, -843, -1478, -1567, -1776, -1810, -2078, -2108, -2286, -2416, -2258, -2099,
-    -1943, -2033, -2314, -2048, -2251, -2148, -1961, -1779, -1363, -1411, -2031, -2492,
-    -2341, -1912, -2117, -2027, -1406, -1557, -1019, -630, -304, -272, -141, -35,
-    -475, -876, -418, -434, -301, -778, -1000, -1189, -1593, -1837, -2129, -2691,
-    -2560, -2128, -1769, -1803, -1622, -1334, -759, -1178, -1654, -1671, -1507, -1708,
-    -1903, -1744, -1623, -1614, -1469, -1615, -1458, -825, -535, -1071, -1464, -998,
-    -514, -590, -119, 121, 95, 235, 1011, 1153, 889, 499, 801, 1487,
-    1682, 1487, 1578, 1700, 1692, 1184, 632, 1290, 1424, 1049, 693, 1013,
-    1730, 2228, 2136, 1884, 1630, 1731, 1582, 1514, 924, 894, 764, 622,
-    1088, 1680, 1342, 990, 822, 1042, 1110, 1100, 1435, 2348, 2386, 2323,
-    2059, 1948, 2046, 1826, 1874, 2287, 2370, 2201, 1766, 1644, 1906, 2336,
-    2150, 2209, 2221, 1926, 1479, 1450, 1629, 1963, 2206, 1968, 1723, 1327,
-    965, 896, 585, 126, -113, 65, 486, 69, 320, 672, 381, 470,
-    447, 549, 281, 606, 704, 1398, 1465, 1337, 1516, 1675, 1437, 1397,
-    1115, 613, 205, -124, 166, 0, -120, 180, -172, -695, -775, -470,
-    -170, -358, -486, -537, -541, -488, 405, 831, 621, -300, -844, -1540,
-    -2355, -2344, -1965, -1443, -553, 2, 78, -429, -987, -743, -654, -825,
-    -1219, -1148, -961, 103, 540, 434, 100, -853, -1635, -1916, -1363, -2272,
-    -2214, -2639, -2909, -2316, -1758, -1407, 36, 921, 1009, -505, -1924, -3032,
-    -3007, -2333, -2684, -2480, -2714, -2367, -1901, -1955, -2240, -1893, -2015, -2067,
-    -1681, -1303, -894, -799, -942, -643, -793, -459, -281, 226, 74, -471,
-    368, 956, 333, -64, -163, -485, -1302, -1643, -1661, -1611, -1152, -754,
-    -881, -67, 264, -771, 351, 2368, 1701, -528, -2158, -2862, -2422, -2178,
-    -1482, 322, 1467, 1906, 1755, 2104, 1562, 1766, 1699, 1680, 818, 780,
-    -488, -718, -1075, -1288, -1806, -1308, -1088, -559, 493, 1361, 1331, 782,
-    1015, 562, 423, 845, 1684, 1971, 2385, 2723, 3436, 3820, 3995, 3883,
-    3573, 3982, 3842, 3528, 4043, 4272, 4053, 4472, 4334, 4142, 4118, 4285,
-    4265, 4122, 4399, 3871, 4115, 4623, 4668, 4190, 4267, 3954, 3738, 3661,
-    3335, 3953, 4043, 3334, 3229, 2587, 2336, 2149, 2598, 2127, 2143, 2358,
-    2172, 827, 276, 186, -96, -964, -719, -822, -366, -1129, -1725, -2712,
-    -2864, -2457, -2111, -1553, -1761, -1838, -2296, -3235, -5528, -5739, -4324, -4814,
-    -5378, -6104, -6180, -5249, -5281, -4141, -3670, -3713, -3920, -4103, -4635, -4852,
-    -4165, -4145, -4206, -4440, -4551, -3654, -3158, -2855, -2549, -2621, -3124, -3064,
-    -3537, -4462, -3960, -3799, -3820, -4664, -4199, -4031, -4254, -3736, -3168, -2001,
-    -980, -113, 417, 1230, 831, 1585, 2769, 2378, 1871, 1359, 2367, 2086,
-    2007, 2796, 3076, 2744, 4086, 3145, 2279, 1144, 602, 144, -908, -1755,
-    -1444, -829, 543, 422, 167, 948, -119, -1069, -1142, -1072, -670, -692,
-    -978, -1073, -1161, -343, -174, -608, -968, -1569, -1198, -496, -1349, -2254,
-    -2218, -2050, -1353, -717, -598, -2334, -3991, -4084, -5129, -5727, -5831, -5040,
-    -4566, -4416, -4200, -3807, -3164, -3912, -3981, -3890, -2660, -1775, -1447, -1231,
-    -2749, -2474, -2026, -311, -211, -776, -1471, -1394, -1372, -2025, -2041, -1172,
-    -739, -26, 17, -565, -1284, -2624, -2463, -1590, -424, 58, 1153, 1219,
-    1750, 1906, 1765, 975, 1906, 1934, 3091, 3879, 4023, 3781, 4222, 4593,
-    4572, 5195, 5889, 5603, 5192, 5200, 4451, 4169, 4303, 3869, 4554, 4574,
-    4589, 4869, 4953, 4941, 5183, 4830, 3692, 3222, 3470, 2470, 3560, 2837,
-    2531, 4378, 2884, 2999, 3710, 4480, 5683, 7227, 6800, 5428, 4318, 4281,
-    2663, 2683, 3179, 2091, 2640, 3678, 1992, 1409, 1190, 2085, 2735, 2253,
-    1379, 1151, 1274, 705, -748, -3372, -4621, -3908, -4565, -4812, -4172, -3547,
-    -4200, -4291, -3256, -3456, -1537, -460, -503, -570, -1009, -1107, -471, -1675,
-    -2310, -1469, -802, -704, -180, -205, -1301, -2326, -3232, -3331, -3159, -2140,
-    -1650, -1732, -2415, -3728, -2490, -1233, -1007, -1727, -2437, -3335, -2283, -938,
-    -359, 159, 523, 92, 199, 1237, 525, 503, 814, 523, 365, 1107,
-    1300, 1373, 1591, 1208, 1430, 2057, 1460, 796, 1042, 705, 847, 1281,
-    1609, 1901, 2147, 3846, 3434, 2903, 3211, 2196, 1497, 1438, 2006, 3509,
-    4893, 5104, 4590, 4378, 4012, 3403, 3867, 3408, 1949, 1874, 2005, 1416,
-    2006, 2428, 1676, 941, 232, -333, 305, 965, 779, 999, 895, 353,
-    -136, 644, 1508, 376, -577, -529, 730, 1090, 1225, 2336, 2126, 2333,
-    2506, 1166, 160, -1098, -1561, -1621, -2690, -2254, -951, -218, -417, -644,
-    -1247, -2081, -3492, -4359, -5331, -5353, -5490, -5783, -5622, -5263, -4947, -3465,
-    -575, -632, -1703, -2997, -3807, -3360, -2573, -2264, -1078, -182, -411, -592,
-    -1270, -1724, -1636, -1997, -2428, -1719, -1140, 70, -152, -740, -1654, -2643,
-    -2848, -2853, -2910, -3569, -3137, -3441, -3594, -4863, -2897, -2259, -1529, -2935,
-    -3093, -2520, -2481, -1197, 804, 1763, 1409, 1023, 227, 278, 10, 805,
-    1066, 1074, 1406, 2632, 1710, 2746, 3126, 2966, 1973, 1998, 2643, 2601,
-    1065, 621, 929, 939, 552, 1582, 1617, 1447, 1582, 338, 604, 1910,
-    2213, 2980, 2840, 2762, 3496, 4030, 3468, 3541, 3198, 1523, 1115, 2143,
-    2729, 3954, 4302, 3130, 2076, 1647, 2105, 922, 979, 1569, 2548, 1766,
-    1234, 520, 1928, 2182, 1962, 1853, 1352, 1526, 1223, 1178, 2135, 2034,
-    2534, 3229, 3005, 1754, 645, 181, -372, -1363, -1423, -1319, -982, -735,
-    -659, -783, -462, -1632, -3123, -3586, -3560, -3314, -2973, -3237, -2858, -2662,
-    -2695, -1294, -1637, -1858, -2776, -2897, -2533, -1832, -2277, -1145, 229, 1255,
-    448, -1480, -2573, -3064, -2761, -2812, -3355, -3462, -2666, -2255, -2070, -2110,
-    -2060, -2721, -3519, -3678, -4862, -4829, -4868, -4592, -4015, -3088, -1914, -1450,
-    -2028, -2361, -2868, -2697, -1279, -384, 168, 861, 1144, 750, 802, 153,
-    279, 99, 361, 506, -384, -470, -381, 343, 453, 805, 1209, 813,
-    137, -176, -924, -966, -1246, -1493, -1182, -1150, -190, 211, -627, -1716,
-    -1211, -735, 259, 23, 1249, 1510, 1767, 2412, 2810, 2729, 2647, 2649,
-    2194, 2834, 2621, 3313, 3226, 3625, 3534, 3382, 3223, 1931, 1854, 951,
-    585, 1261, 1840, 2974, 2511, 1795, 3817, 3620, 3334, 1311, 574, 1790,
-    1270, 3225, 4098, 3218, 2841, 2908, 2028, 2436, 1456, 785, 30, 131,
-    1339, 1639, 739, 457, 1605, 1814, 2266, 2110, 2196, 2699, 2415, 1498,
-    1426, 464, 994, 1622, 1316, 337, -1272, -1211, -818, -107, -260, -74,
-    472, 688, 748, 579, -493, 10, -584, -1808, -1620, -1199, -624, -993,
-    -1576, -2041, -3358, -3513, -3201, -3909, -4237, -4053, -4083, -4267, -3481, -1960,
-    -709, -600, -1166, -2014, -2242, -1842, -1414, -791, -856, -704, -644, -1172,
-    -1178, -1499, -1898, -1575, -1839, -3521, -4192, -4190, -3031, -2491, -2645, -3087,
-    -3903, -4805, -5102, -4365, -4064, -4021, -4230, -4227, -4478, -4429, -3035, -1520,
-    -1716, -2542, -3065, -3525, -2889, -2107, -1460, -827, -219, 747, 1316, 784,
-    986, 1124, 466, -1262, -2589, -1686, -660, -817, -414, -283, -923, -881,
-    -897, -1301, -1875, -2164, -2362, -2840, -2491, -2165, -1690, -1009, -1710, -1756,
-    -1618, -1493, -530, 317, 361, 639, 1301, 1157, 1491, 1377, 1923, 1464,
-    902, 1134, 1391, 1396, 1638, 2237, 2553, 3232, 3025, 3015, 2252, 2294,
-    1792, 1336, 1413, 1707, 2458, 2659, 2564, 2683, 2498, 2120, 1505, 1422,
-    2363, 2335, 3122, 3125, 3761, 3743, 4092, 4131, 3963, 3937, 2952, 2378,
-    2837, 3736, 3628, 2893, 2197, 2816, 3604, 3138, 2313, 2080, 2390, 2615,
-    2244, 2779, 2717, 2618, 2412, 2409, 3044, 2180, 2070, 1999, 1911, 3938,
-    4188, 4242, 3285, 2756, 1272, 1267, 1399, 1701, 1573, 968, 1628, 1370,
-    1151, 1585, 1509, 1042, 1257, 1383, 1544, 1070, 400, 165, 34, 7,
-    1061, 1193, 704, -449, -98, -757, -1770, -1360, -554, 759, 990, 1637,
-    1210, 513, -626, -451, -787, -1680, -2062, -2117, -828, -324, -707, -1413,
-    -3064, -3555, -3136, -3173, -3867, -4848, -5120, -4561, -4427, -4106, -2967, -2493,
-    -2499, -3084, -3923, -3637, -3071, -2656, -1702, -1420, -1354, -1260, -1002, -1027,
-    -1418, -1661, -1995, -2717, -2820, -3632, -3230, -3372, -2820, -3509, -4310, -5168,
-    -4487, -4425, -3984, -4493, -4909, -4955, -5057, -5324, -4735, -4640, -4530, -4466,
-    -4077, -3762, -4122, -3402, -2730, -2465, -2207, -1261, -796, -798, -1328, -759,
-    -1279, -1124, -1600, -1627, -1831, -2020, -1848, -1392, -1201, -1704, -1918, -1610,
-    -1308, -1827, -2080, -2102, -1599, -1310, -1003, -1578, -1934, -1412, -1001, -974,
-    -434, 16, 497, 1585, 1218, 1768, 2112, 1807, 1875, 1926, 1309, 1473,
-    1456, 756, 1136, 2147, 2327, 2037, 1666, 1748, 1503, 1397, 1209, 1366,
-    665, 1283, 1691, 2502, 2574, 2800, 2258, 2526, 2917, 2973, 3187, 3513,
-    3750, 4005, 4281, 4193, 4229, 3990, 4362, 4879, 4529, 4421, 3817, 3507,
-    3922, 4367, 4909, 4885, 4378, 4153, 4156, 3406, 3217, 3526, 3751, 3513,
-    2076, 2085, 3970, 4451, 4516, 2714, 3202, 4248, 5328, 6437, 6580, 6158,
-    5546, 4899, 3599, 2652, 2392, 2864, 3527, 3412, 3897, 3203, 2939, 2642,
-    3064, 3175, 2950, 2776, 3228, 3232, 2405, 2078, 1043, 810, 1569, 1117,
-    692, 819, 564, -318, -657, -253, 314, 1535, 3142, 3153, 2606, 2149,
-    1700, 1675, 1821, 1354, 1254, 1742, 1344, 927, 858, 632, 702, -31,
-    -653, -884, -856, -1055, -1134, -1458, -2536, -1505, -657, -662, -1577, -1937,
-    -2173, -2392, -2567, -1955, -1498, -743, 126, -274, -803, -917, -1344, -1948,
-    -2727, -3058, -3037, -2166, -1634, -1381, -1799, -2210, -2281, -2455, -2667, -3325,
-    -3784, -3738, -3656, -3928, -4479, -4375, -3513, -3078, -3697, -3820, -3932, -4347,
-    -3824, -3523, -3619, -3108, -2979, -2636, -1916, -2455, -2826, -3373, -3149, -4048,
-    -4987, -4880, -4189, -3893, -3672, -3588, -3663, -4041, -4416, -5059, -5070, -4952,
-    -4299, -4060, -4477, -4334, -3514, -2734, -3288, -3443, -3993, -3563, -2338, -1765,
-    -1662, -1090, -1183, -567, -160, -708, -791, -818, -781, -2480, -3293, -2858,
-    -2806, -2540, -2666, -2566, -2515, -2892, -2158, -2245, -1635, -1784, -2068, -1742,
-    -1171, -1063, -758, -97, -62, 2, -605, -621, 289, 512, 657, 773,
-    1247, 1641, 1778, 2329, 2049, 1342, 1164, 700, 427, 799, 874, 1057,
-    711, 429, 70, -65, -536, -975, -372, -244, 73, 59, -712, 244,
-    1408, 1796, 1366, 46, 581, 1536, 2656, 4554, 5140, 4005, 3452, 3099,
-    3484, 3030, 2970, 3348, 4101, 3493, 3886, 2738, 2295, 3441, 4504, 4860,
-    4813, 5049, 4939, 4328, 3745, 2995, 2169, 1433, 2338, 1993, 1313, 593,
-    686, 754, 1216, 1566, 2669, 3803, 4270, 4050, 4214, 4006, 4550, 4521,
-    3879, 3401, 3863, 4963, 5930, 5777, 5123, 4706, 4408, 4426, 4455, 5082,
-    4243, 3631, 3707, 3025, 2838, 2951, 4532, 5199, 4465, 3571, 2968, 2613,
-    2724, 3046, 3169, 3441, 3611, 3989, 3687, 3133, 3410, 3325, 2434, 2683,
-    3083, 3854, 3908, 3416, 2775, 2015, 1662, 1627, 911, 821, 378, 53,
-    195, 396, 726, 986, 1815, 2879, 2765, 2304, 1159, 727, 1122, 795,
-    1070, 1564, 1425, 1693, 1823, 1620, 1681, 1497, 1451, 991, 73, -182,
-    -31, 691, 475, 193, -258, 4, -780, -716, -1139, -1568, -1781, -1680,
-    -2297, -1865, -904, -1642, -1454, -1669, -1600, -1495, -976, 237, 756, 948,
-    1182, 1466, 913, 186, -236, -1193, -975, -1237, -2065, -2628, -2916, -2360,
-    -2116, -2003, -1990, -2181, -2074, -2559, -2664, -3484, -4550, -4553, -4009, -3427,
-    -3540, -3259, -3041, -3849, -3759, -3778, -3749, -2849, -2333, -1711, -1557, -1803,
-    -1883, -1265, -1163, -841, -1068, -1414, -2148, -3509, -3911, -3904, -3724, -2809,
-    -3279, -3442, -3551, -4591, -4873, -5384, -5370, -5356, -5794, -4083, -3737, -3928,
-    -4842, -6771, -6884, -6692, -5082, -3221, -2225, -2423, -3467, -4687, -4151, -3673,
-    -3346, -2737, -2264, -2112, -1544, -2584, -2887, -2560, -2400, -1541, -1622, -1766,
-    -2086, -2516, -3195, -3400, -4107, -4658, -3871, -3296, -3442, -3961, -4611, -4463,
-    -3885, -3318, -2755, -2247, -1635, -1813, -2060, -2309, -1794, -1718, -2409, -2168,
-    -2726, -1869, -1332, -684, -918, -1710, -2213, -2029, -1799, -1510, -1897, -1737,
-    -1520, -1100, -1413, -1569, -710, -667, -859, -1125, -1833, -1469, -438, 626,
-    897, 1343, 2175, 2428, 2195, 2771, 1636, 1725, 1556, 523, 613, 804,
-    1016, 1245, 794, 376, 198, 285, 102, 168, -405, -32, 457, 1106,
-    1389, 1336, 2109, 2571, 2034, 1462, 1609, 1023, 1180, 1971, 2036, 2472,
-    3135, 3556, 3273, 3505, 3323, 3720, 3453, 2874, 1917, 1973, 2997, 3201,
-    3056, 3342, 2885, 2371, 2224, 1144, 773, 450, 977, 1078, 1005, 1806,
-    3127, 4227, 3880, 2718, 3280, 3002, 3483, 4537, 4440, 4634, 5408, 5416,
-    6003, 5863, 4919, 4618, 4332, 4469, 4059, 3950, 4118, 4341, 4925, 5064,
-    4839, 4464, 4251, 3736, 3788, 3417, 2858, 2380, 2314, 2647, 2792, 2880,
-    2353, 1603, 1161, 1263, 1279, 1605, 2728, 4021, 4444, 4663, 4456, 4252,
-    4497, 4688, 4469, 4369, 3390, 2989, 2672, 2724, 2975, 3486, 3608, 3441,
-    2851, 2659, 1840, 1437, 2094, 1766, 1023, 1994, 2440, 1806, 1806, 1052,
-    10, 277, 1949, 2855, 2941, 2516, 2080, 1282, 517, 1266, 1395, 1470,
-    1724, 2107, 2489, 1433, 1139, 1290, 1104, 740, 1602, 1214, 731, 497,
-    -252, -768, -1410, -1702, -208, -230, -566, -1179, -2257, -2323, -1962, -1538,
-    -857, -158, -22, -12, 278, 458, 699, -35, -581, -742, -680, -740,
-    -516, -60, -357, -994, -1574, -1880, -2400, -2709, -2217, -3135, -2599, -2251,
-    -2518, -1283, -750, -917, -1965, -2439, -2681, -2423, -1458, -1658, -1579, -898,
-    -409, -686, -726, -1257, -1272, -756, -1780, -2975, -3335, -3475, -2604, -1828,
-    -1982, -2614, -3107, -2921, -3297, -4518, -5008, -5028, -4749, -3777, -3979, -3845,
-    -2871, -2834, -2788, -3499, -3922, -3865, -3141, -2621, -2089, -2017, -1403, -1646,
-    -1466, -1476, -1849, -1852, -2137, -2613, -3652, -3201, -2084, -1851, -2462, -2493,
-    -3448, -4202, -4759, -4870, -4929, -4775, -4433, -4915, -5659, -4768, -4309, -4540,
-    -4979, -5532, -5612, -5654, -4818, -4232, -3155, -2374, -2096, -2111, -1876, -1850,
-    -1295, -634, -1004, -1501, -1760, -1927, -1807, -907, -914, -1058, -1053, -2017,
-    -2940, -3691, -4050, -3859, -3575, -3477, -3371, -2890, -2361, -2231, -3035, -3820,
-    -3671, -3700, -3341, -3360, -2423, -1164, -1022, -945, -1367, -1861, -1222, -1318,
-    -1379, -1215, -1324, -558, 168, 493, 722, 768, 185, -223, -859, -1423,
-    -2026, -2235, -2011, -2450, -2301, -1364, -1058, -993, -1648, -1946, -2033, -1201,
-    483, 1606, 2514, 2390, 2648, 2549, 1672, 1015, 1230, 1013, 885, 1590,
-    1513, 650, 279, 1017, 1743, 2325, 2635, 2324, 1310, 1028, 700, 729,
-    -106, -19, 795, 863, -110, -414, -836, 93, 126, 673, 1608, 2422,
-    3128, 3253, 3439, 3835, 4158, 3561, 2582, 1947, 2514, 3023, 3272, 3693,
-    2521, 2414, 2573, 2004, 1438, 911, 1012, 1497, 1481, 837, 1170, 2964,
-    3152, 2996, 2331, 1947, 2786, 3375, 3385, 3684, 4066, 4120, 4526, 4821,
-    5599, 5341, 5443, 5465, 4156, 3819, 3901, 4043, 4581, 4466, 4119, 3828,
-    3147, 3125, 2551, 1790, 1687, 1811, 1841, 2696, 2308, 3268, 3819, 3698,
-    3150, 2294, 2126, 2098, 1904, 1824, 2381, 3525, 4209, 4017, 4078, 4470,
-    4787, 5162, 4616, 4381, 4942, 5275, 5025, 4813, 4333, 4569, 4081, 3333,
-    3077, 2637, 2269, 1888, 1868, 1569, 2289, 2849, 2813, 2925, 2018, 1354,
-    1849, 2152, 2468, 2724, 2901, 2645, 2881, 2608, 3035, 2830, 3274, 2833,
-    2178, 1705, 1983, 2611, 3084, 2506, 2713, 2695, 2067, 1133, 658, 289,
-    637, 645, 456, 531, 863, 1364, 1551, 688, -405, -561, -411, -387,
-    160, 602, 983, 1978, 2108, 2071, 1649, 1652, 2125, 1987, 1229, 726,
-    899, 1354, 1352, 944, 682, 132, -521, -1040, -1253, -1599, -1720, -2404,
-    -2950, -2410, -1737, -893, -1089, -162, -1300, -2373, -2944, -2115, -1173, -58,
-    354, 326, -504, -1062, -1201, -1063, -1962, -1337, -921, -4, -62, -1437,
-    -2494, -1732, -944, -824, -1105, -1740, -1564, -2148, -2488, -2492, -3590, -4369,
-    -3343, -2905, -2944, -3829, -4189, -3909, -3694, -2752, -1981, -1866, -1096, -1126,
-    -1522, -1173, -907, -790, -1383, -2456, -1955, -1285, -1865, -2254, -2602, -2756,
-    -3347, -3813, -4123, -4497, -5055, -4413, -4181, -3854, -4204, -2976, -1932, -2659,
-    -3773, -4272, -4764, -4504, -4322, -3571, -2880, -2485, -1784, -1079, -915, -1303,
-    -1446, -1421, -2672, -3113, -2828, -1908, -1003, -668, -1038, -1873, -2597, -2757,
-    -2933, -3885, -3860, -3984, -4205, -3611, -4080, -4103, -3359, -3151, -3239, -3973,
-    -4273, -4449, -3797, -3237, -2659, -2883, -2314, -2305, -2446, -2068, -1765, -2862,
-    -3681, -3654, -2869, -2126, -1761, -2262, -2947, -3713, -4235, -3746, -3978, -4048,
-    -3849, -3640, -3395, -3056, -3137, -2537, -2269, -2188, -2528, -3619, -3919, -3893,
-    -3896, -2924, -1949, -906, -229, 143, -89, -40, -409, -426, -353, -1167,
-    -1966, -2115, -1437, -892, -840, -872, -999, -1556, -2111, -2194, -2632, -2343,
-    -1664, -2066, -2141, -1321, -1408, -2006, -1968, -2460, -2459, -2345, -1887, -1160,
-    -546, 471, 894, 769, 468, 444, 282, 157, -614, -727, -103, 628,
-    396, 904, 806, 309, 56, -179, -710, -1166, -1328, -1238, -1080, -515,
-    -292, -551, 735, 1326, 346, -952, -585, -661, 1117, 2857, 3206, 2801,
-    2509, 2211, 2721, 2496, 2968, 2536, 2066, 2364, 3697, 1904, 1482, 1406,
-    1755, 1442, 1749, 1509, 1209, 923, 714, 671, 193, -959, -33, 518,
-    451, -329, -1169, -847, -534, 244, 1081, 1836, 2707, 2898, 2633, 3012,
-    3807, 4529, 3605, 3206, 3230, 3741, 4096, 4348, 4446, 3971, 3372, 2458,
-    2063, 2252, 2385, 1681, 1219, 1409, 1492, 2097, 2572, 2488, 1962, 2059,
-    1810, 2134, 2448, 2677, 3378, 3823, 3888, 4586, 4762, 4715, 3885, 4334,
-    4879, 3933, 3102, 3098, 4282, 4413, 4010, 3548, 3006, 2576, 2455, 2368,
-    1701, 1576, 1371, 1585, 1322, 1133, 1814, 2849, 2818, 2420, 1582, 1385,
-    1722, 2271, 2915, 3856, 4565, 4689, 4743, 5358, 5499, 5520, 5176, 4515,
-    2692, 2953, 3542, 3473, 3154, 3021, 2685, 2248, 1513, 1309, 1415, 1473,
-    1515, 1374, 210, 237, 1196, 1904, 1772, 2039, 1578, 1625, 1813, 2024,
-    2407, 2853, 3634, 3632, 3138, 3218, 3205, 3223, 3223, 2849, 2468, 1884,
-    1441, 1499, 1670, 1771, 1833, 1723, 1531, 753, 47, -666, -1072, -1250,
-    -1479, -233, 454, 510, 286, -39, -32, 580, 1400, 1532, 2106, 2898,
-    3208, 3327, 3446, 3367, 3449, 2987, 1681, 1175, 1745, 2096, 1142, 821,
-    795, -214, -445, -824, -720, -1584, -2222, -2272, -1839, -1552, -2473, -1720,
-    -756, -394, -1587, -2822, -2935, -3045, -812, 546, 1268, 1584, 939, 672,
-    899, -359, -2, 847, 672, 925, 825, -124, -848, -844, 318, 1464,
-    1180, 674, -414, -1050, -1102, -1055, -2498, -2223, -1568, -2331, -3019, -3592,
-    -4305, -4077, -3099, -2370, -1900, -1598, -1040, -476, -389, -445, -359, -1984,
-    -2303, -1641, -727, -109, -758, -1012, -2208, -2822, -3390, -3497, -3626, -3793,
-    -3553, -3480, -3113, -3201, -3686, -2244, -1425, -1935, -2807, -3274, -3071, -2926,
-    -2452, -1415, -958, -502, -326, -414, -304, 164, 603, 801, -805, -1494,
-    -1212, -1473, -1564, -2083, -2687, -2829, -2941, -3283, -3873, -3698, -3442, -3336,
-    -3532, -3223, -3764, -2866, -1572, -1837, -3010, -3207, -3237, -3136, -3014, -2756,
-    -2336, -1843, -1494, -1247, -1204, -1082, -362, -818, -2197, -2755, -2714, -2119,
-    -1583, -2005, -2128, -2546, -2888, -3270, -3708, -4144, -4192, -4225, -4168, -3999,
-    -3957, -2928, -2296, -2485, -1856, -1609, -1842, -1760, -998, -345, 67, 608,
-    924, 1387, 1044, 763, 863, 242, -400, -258, -975, -2312, -3309, -2629,
-    -1929, -1462, -1473, -1819, -2828, -3695, -4009, -4101, -3872, -3837, -3438, -3030,
-    -2697, -2977, -3094, -3143, -2735, -2818, -2007, -1459, -585, -20, 800, 1050,
-    1165, 1145, 880, 678, 352, 388, 166, 254, 85, -243, -334, 133,
-    -212, -263, -53, -815, -1559, -1857, -1076, -695, -1178, -786, -312, 931,
-    -600, -1830, -1216, -871, -18, 1357, 2627, 2354, 1459, 1285, 911, -53,
-    681, 981, 750, 743, 1074, -186, -269, 375, 1206, 1802, 1725, 608,
-    418, 156, 199, -193, -614, 3, 226, -146, -517, -784, -815, -1157,
-    -241, 815, 1412, 2292, 2598, 2503, 2199, 2512, 3459, 2380, 1726, 1811,
-    1764, 2343, 2775, 2318, 2089, 1989, 1609, 1324, 865, 86, -144, 645,
-    1095, 1103, 1511, 2421, 2748, 1986, 1990, 1887, 2089, 1824, 1835, 3125,
-    3525, 3876, 4317, 4555, 4943, 4231, 4205, 3997, 2727, 2204, 2457, 2467,
-    2492, 2493, 2732, 2379, 2375, 1546, 1033, 732, 522, 1436, 1327, 1334,
-    1236, 2492, 3169, 2974, 2370, 2316, 2735, 2858, 3322, 3812, 4418, 5022,
-    5651, 5387, 5035, 4949, 4342, 4225, 4006, 2773, 2448, 2661, 3294, 3156,
-    3150, 3003, 2431, 1805, 1348, 697, -32, -83, 14, 307, 597, 345,
-    812, 1217, 1874, 2099, 2153, 1510, 1639, 2041, 2451, 2610, 3097, 4131,
-    4828, 5214, 4890, 4364, 3843, 3981, 4279, 4002, 2827, 2554, 2559, 2868,
-    2837, 2522, 2500, 2493, 1736, 829, 526, 332, 818, 419, 684, 1298,
-    1925, 1715, 1370, 896, 1427, 1835, 2580, 2211, 1860, 2487, 2851, 2463,
-    1663, 1244, 1483, 1829, 1739, 1961, 1372, 1103, 428, 524, 43, -258,
-    -362, -240, -1029, -1015, -909, -651, -1601, -775, 992, 664, -402, -1237,
-    -837, 1016, 2322, 2210, 2504, 3008, 2465, 1300, 29, -516, -131, 676,
-    1526, 1375, 1884, 1199, 375, 401, 821, 991, 1432, 877, 356, 174,
-    -24, -79, -1434, -748, -695, -1315, -1735, -2435, -3355, -3731, -2961, -2636,
-    -2345, -1403, -655, 554, 144, 227, -810, -2017, -1930, -1279, -970, -810,
-    -1453, -1706, -2094, -2803, -3159, -2984, -3169, -3687, -3272, -2998, -2509, -2073,
-    -2001, -1331, -932, -1611, -1943, -1872, -1634, -863, -274, -47, 413, 1000,
-    1164, 1287, 980, 521, 558, -78, -1030, -1798, -1058, -247, -194, -535,
-    -1390, -1969, -2871, -3313, -3895, -4195, -4691, -4209, -4687, -4878, -4635, -3616,
-    -2469, -2273, -3160, -3391, -3259, -3373, -2860, -2488, -1954, -1256, -705, -550,
-    184, -477, -418, -951, -975, -1406, -1865, -1849, -1301, -969, -1262, -1401,
-    -1367, -1869, -2521, -2821, -3272, -3796, -3449, -3531, -3923, -3284, -2063, -1892,
-    -1486, -1181, -1392, -2010, -2066, -1995, -1513, -1034, -1139, -478, -157, -68,
-    6, -789, -1495, -1866, -1637, -2261, -2884, -3011, -2068, -1642, -1912, -2344,
-    -2228, -2136, -2729, -3509, -4113, -4182, -3969, -3495, -3472, -2377, -1489, -1597,
-    -1946, -2253, -2639, -2073, -1165, -155, 181, 78, 169, -406, -879, -1505,
-    -1233, -438, -462, -242, -1427, -2220, -2459, -2302, -2583, -2007, -1601, -1607,
-    -1956, -2429, -2303, -3173, -3199, -1704, -755, -2071, -2783, -2900, -2252, -1596,
-    -944, 599, 454, 678, 342, -93, -1891, -2346, -2096, -1234, -617, -140,
-    -740, -1908, -1912, -1606, -1143, -525, -522, -600, -641, -1363, -2011, -2046,
-    -2546, -1662, -780, -872, -1278, -1599, -1632, -1852, -1515, -636, 45, 994,
-    997, 1038, 1470, 1473, 1597, 18, -306, -41, 575, 1144, 1056, 795,
-    527, -379, -745, -1130, -1622, -1423, -1305, -1560, -2126, -2419, -1642, -624,
-    -237, -341, -381, -221, 80, 233, 534, 1473, 2015, 2006, 2653, 2976,
-    2880, 2801, 3450, 2782, 1529, 1303, 1515, 1998, 2155, 1773, 1362, 1027,
-    710, 163, -584, 144, 85, -60, -200, -327, 257, 1285, 2728, 2696,
-    3012, 2089, 1320, 1416, 1672, 2382, 2395, 2873, 3450, 3980, 3781, 3628,
-    3208, 2904, 2545, 2053, 1236, 1163, 1537, 1420, 1318, 1548, 1470, 769,
-    742, 406, -504, -1173, -1009, -233, -141, 550, 1181, 1380, 2869, 3078,
-    2409, 1959, 1757, 1630, 1479, 2468, 3454, 4034, 5014, 4599, 4417, 4284,
-    3638, 2740, 2231, 1645, 1474, 1370, 2074, 2254, 2067, 2508, 2412, 1925,
-    1224, 996, 236, 514, 612, 968, 838, 1101, 1708, 1344, 1339, 1097,
-    1079, 1195, 914, 2131, 3657, 3349, 3203, 3155, 2919, 2789, 3030, 2500,
-    2126, 1538, 1346, 494, 635, 586, 388, 796, 870, 780, 568, 189,
-    350, -360, 175, 1485, 1888, 1641, -111, -62, 1048, 1645, 1955, 3419,
-    4092, 3862, 3334, 2966, 1457, 1707, 2273, 2655, 2188, 2193, 2189, 1030,
-    917, 1527, 1723, 1982, 1664, 1493, 1204, 640, 718, 213, -536, -234,
-    -75, -132, -1103, -1163, -927, -807, -818, -248, 79, 543, 977, 1670,
-    1375, 1155, 1114, 296, 210, 362, 1049, 1194, 1349, 558, 444, 153,
-    16, -113, -1216, -752, -471, -359, -257, -403, -428, 292, 821, 1182,
-    953, 688, 538, 1051, 1488, 1209, 1436, 1813, 2029, 2299, 1613, 1131,
-    1073, 187, -396, -349, 329, 379, 366, 94, -264, -1489, -2364, -3096,
-    -2958, -3120, -3015, -2988, -2442, -2502, -1755, -759, -107, -426, -884, -1130,
-    -1188, -987, -885, -481, 90, 981, 1578, 1579, 1487, 1246, 598, 895,
-    478, -270, -991, -1217, -700, -241, 92, -551, -893, -1272, -1610, -2280,
-    -2798, -3094, -2856, -3274, -2831, -2520, -1673, -1378, -1545, -1614, -2076, -2266,
-    -1682, -1305, -814, -335, -278, 192, -40, 28, 13, -249, -600, -635,
-    -1049, -2107, -2400, -2813, -3170, -2259, -2097, -1963, -1846, -2374, -2517, -2807,
-    -2693, -2324, -2137, -2045, -1480, -1364, -1184, -1273, -1732, -1741, -1049, -1184,
-    -522, 279, 692, 558, 543, 827, 646, 278, 37, -700, -1089, -957,
-    -1184, -1589, -1695, -2030, -2363, -2491, -2592, -2442, -2177, -2123, -2021, -2928,
-    -3083, -2606, -1595, -2533, -3929, -3785, -2729, -1641, -1273, 44, 1122, 823,
-    -73, -651, -1401, -1522, -1116, -1061, -1060, -1121, -194, -1065, -1082, -1060,
-    -695, -82, 54, -309, -395, -837, -854, -1778, -2453, -1562, -1224, -2043,
-    -2324, -2624, -2187, -1971, -1587, -1058, -787, -484, -676, -251, -266, 368,
-    612, -427, -1391, -1158, -527, 106, -3, -627, -1260, -2237, -3082, -3522,
-    -3274, -3297, -3186, -2833, -2235, -2553, -1869, -985, -596, -777, -501, -735,
-    -763, -335, 265, 859, 1324, 1882, 2383, 2524, 1795, 1200, 1247, 715,
-    69, -200, 174, -113, 142, 184, 377, -335, -885, -1601, -1671, -2028,
-    -1966, -1944, -1950, -1657, -1558, -895, 820, 1283, 970, 192, -4, -159,
-    38, 116, 740, 1402, 1536, 2004, 1724, 1849, 1804, 1250, 962, 714,
-    -60, -515, -800, -453, -243, -325, -741, -1686, -1775, -2118, -2296, -2091,
-    -1342, -892, -188, 262, 950, 1593, 1719, 2116, 2155, 1888, 1331, 924,
-    1564, 2126, 2096, 2586, 2824, 2957, 2899, 2952, 2930, 2501, 1742, 1399,
-    850, 758, 871, 309, 13, 447, 292, 85, -328, -406, -466, -535,
-    -369, -86, 8, 151, 130, 591, 1098, 1000, 984, 1079, 1586, 1897,
-    1866, 1889, 2223, 2287, 1993, 1913, 1839, 1836, 1579, 1478, 1446, 1216,
-    1120, 881, 752, 810, 784, 1144, 1434, 1205, 1007, 1226, 1447, 1546,
-    1647, 1596, 1688, 2166, 2345, 2085, 1900, 2252, 2224, 1970, 2142, 1751,
-    1731, 1830, 1659, 2019, 1722, 1382, 1195, 832, 728, 746, 657, 449,
-    605, 934, 564, 351, 645, 892, 808, 952, 1224, 1076, 1136, 1480,
-    1726, 1747, 1510, 1135, 1478, 1604, 1285, 1434, 1617, 1874, 1673, 1419,
-    1345, 1107, 1243, 1106, 1005, 933, 739, 509, 417, 886, 883, 589,
-    382, 486, 996, 1116, 1158, 1068, 1411, 1909, 1894, 1592, 1486, 1956,
-    1877, 1508, 1208, 732, 834, 1061, 1372, 1495, 1405, 1108, 1038, 516,
-    180, 348, 210, 57, -365, -413, -249, -124, -47, -323, -251, -154,
-    -52, 429, 710, 1187, 1260, 838, 973, 1023, 1376, 1359, 1473, 1392,
-    1413, 1125, 739, 375, 669, 1167, 1394, 1207, 1141, 1088, 795, 387,
-    225, 114, -91, -174, -348, -645, -833, -833, -526, -300, -392, -276,
-    -154, -282, 93, 440, 494, 337, 325, 188, 161, 205, 100, -245,
-    -410, -433, -173, -260, -485, -621, -799, -833, -654, -735, -889, -660,
-    -493, -345, -562, -284, -694, -671, -290, -183, -130, -185, -100, 40,
-    -81, -166, 0, 429, 764, 519, 188, 147, -256, -471, -416, -413,
-    -609, -743, -776, -831, -988, -1302, -1389, -1253, -1445, -1595, -1772, -1478,
-    -1397, -1546, -1583, -1314, -1370, -1266, -1124, -1091, -864, -1026, -1050, -1307,
-    -959, -551, -356, -652, -686, -798, -848, -886, -821, -810, -699, -768,
-    -907, -770, -913, -677, -821, -800, -856, -890, -1068, -1287, -1181, -1320,
-    -1593, -1472, -1176, -1188, -1076, -1116, -922, -556, -589, -863, -751, -521,
-    -534, -463, -737, -835, -1184, -1269, -1201, -1031, -927, -1050, -1192, -1218,
-    -1248, -1560, -1747, -1897, -2001, -1960, -2249, -2155, -2327, -2207, -2027, -1759,
-    -1293, -1139, -923, -795, -664, -608, -583, -423, -248, -64, 160, -76,
-    -424, -881, -792, -756, -557, -390, -212, -153, -291, -265, -495, -778,
-    -668, -658, -568, -874, -1374, -1805, -1565, -1608, -1657, -1434, -1328, -954,
-    -772, -814, -829, -611, -380, -742, -446, -71, -149, -436, -360, -996,
-    -995, -859, -914, -847, -1013, -811, -651, -738, -1117, -1106, -1284, -1343,
-    -1104, -1099, -1212, -1056, -1004, -1092, -757, -420, -238, 48, -43, 165,
-    56, 85, 70, 310, 402, 418, 529, 323, 49, 45, -357, -311,
-    -108, -249, -234, -341, -296, -101, -346, -369, -803, -711, -752, -867,
-    -792, -857, -970, -967, -927, -821, -625, -546, -418, -128, 44, -18,
-    12, 253, 598, 428, 183, 7, -33, -182, -374, -321, 29, 218,
-    424, 465, 360, 151, -69, 93, 305, 329, 228, -30, -160, -362,
-    -136, 243, 311, 433, 591, 664, 773, 920, 1256, 1189, 897, 876,
-    1007, 1015, 483, 237, 194, 43, 271, 504, 671, 828, 762, 457,
-    474, 321, 173, -76, -526, -461, -285, -329, -220, -377, -439, -344,
-    61, 295, 465, 449, 608, 814, 1103, 1279, 1512, 1607, 1689, 1609,
-    1342, 1532, 1230, 1316, 1197, 1376, 1512, 1456, 1084, 1043, 1039, 942,
-    909, 818, 716, 723, 782, 572, 368, 218, 514, 561, 926, 1159,
-    1001, 954, 1069, 995, 1225, 1330, 1384, 1397, 1711, 1531, 1090, 797,
-    590, 779, 581, 793, 878, 874, 675, 823, 1253, 1340, 971, 900,
-    893, 728, 507, 699, 740, 929, 864, 1025, 1119, 1344, 1473, 1572,
-    1585, 1668, 1639, 1630, 1932, 1986, 2069, 1559, 1254, 1118, 1105, 1137,
-    1140, 1286, 1563, 1089, 888, 974, 951, 972, 819, 624, 643, 597,
-    597, 461, 446, 604, 442, 636, 463, 721, 715, 368, 504, 530,
-    557, 795, 776, 956, 1072, 815, 408, 176, 154, 197, 580, 1249,
-    1491, 1356, 1366, 1063, 1019, 910, 823, 634, 610, 734, 547, 569,
-    543, 564, 327, 248, 531, 780, 909, 716, 908, 1094, 1146, 1039,
-    581, 692, 374, 13, -54, -27, 171, 322, 359, 223, 167, 195,
-    202, -240, -418, -500, -450, -679, -739, -751, -804, -796, -575, -607,
-    -456, -528, -419, -281, -238, -124, 51, 92, 390, 563, 678, 658,
-    666, 551, 455, 472, 485, 530, 502, 478, 402, 274, 289, 210,
-    105, 139, 8, -248, -251, -154, -636, -636, -952, -1088, -911, -544,
-    -473, -185, -103, -38, -59, 106, 114, -384, -574, -701, -720, -485,
-    -634, -851, -698, -801, -860, -853, -848, -774, -909, -695, -683, -768,
-    -949, -918, -1096, -1039, -984, -867, -784, -425, -118, 120, 194, 249,
-    -1, 52, 286, 412, 209, 285, 54, -139, -482, -441, -510, -281,
-    -334, -83, -124, -277, -322, -332, -708, -850, -1005, -1196, -1200, -1078,
-    -1133, -1327, -1213, -1168, -1013, -952, -1020, -1034, -943, -838, -954, -754,
-    -1014, -839, -751, -775, -927, -1154, -895, -638, -726, -957, -855, -578,
-    -509, -351, -559, -728, -859, -884, -976, -1006, -905, -795, -758, -873,
-    -988, -907, -742, -708, -244, -330, -393, -400, -154, -237, -143, -217,
-    -413, -540, -767, -867, -773, -612, -542, -299, -167, -429, -727, -880,
-    -1042, -1198, -1091, -1079, -1224, -1219, -1319, -1593, -1992, -1975, -1801, -1583,
-    -1472, -1491, -1423, -1502, -1182, -846, -648, -741, -595, -638, -442, -207,
-    -329, -511, -421, -311, -207, -180, -313, -322, -373, -596, -600, -708,
-    -795, -850, -608, -598, -483, -363, -759, -757, -670, -771, -830, -782,
-    -479, -254, -84, -23, -196, -279, -431, -547, -800, -976, -1164, -1255,
-    -1244, -995, -843, -813, -737, -912, -956, -894, -971, -983, -1070, -1194,
-    -1170, -999, -1036, -1019, -857, -724, -549, -460, 1, 366, 611, 554,
-    542, 560, 459, 355, 199, 275, 486, 491, 248, 182, 197, 279,
-    238, 289, 51, -203, -233, -144, -417, -658, -700, -458, -371, -299,
-    -189, -251, -609, -326, -390, -125, -364, -304, 2, 15, -15, 60,
-    54, -13, 208, 162, 249, 29, 108, 172, 145, 401, 407, 354,
-    380, 235, 270, 447, 620, 782, 887, 701, 467, 459, 314, 167,
-    169, 548, 686, 672, 723, 1064, 1107, 921, 1064, 973, 1019, 782,
-    727, 724, 893, 898, 776, 808, 863, 906, 892, 705, 750, 605,
-    540, 186, 223, 245, 147, 92, 93, 174, 216, 175, 333, 310,
-    322, 706, 948, 936, 799, 744, 603, 795, 961, 1073, 978, 1024,
-    1159, 1224, 1247, 1341, 1212, 1179, 1279, 1230, 976, 1019, 775, 820,
-    1009, 955, 760, 736, 1030, 959, 925, 779, 582, 535, 821, 1280,
-    1242, 845, 924, 1357, 1513, 1367, 1281, 978, 713, 508, 536, 433,
-    216, 354, 557, 556, 340, 85, 47, 213, 385, 152, 18, 115,
-    137, -20, -190, 190, 402, 415, 377, 735, 857, 696, 712, 888,
-    760, 1075, 1309, 1601, 1391, 1062, 1048, 1130, 992, 498, 640, 1019,
-    1399, 1260, 1178, 803, 702, 563, 663, 529, 705, 521, 225, 231,
-    352, 62, -14, -23, -47, -100, -277, 151, -229, -261, -318, -166,
-    0, 267, -1, 263, 82, 491, 448, 292, 386, 477, 37, -137,
-    65, 315, -67, 31, 445, 409, 547, 633, 681, 373, 433, 306,
-    360, 414, 828, 623, 783, 698, 712, 462, 412, 469, 413, 47,
-    188, 170, -52, -96, 389, 745, 461, 98, 104, 57, 252, -245,
-    -564, -649, -630, -565, -296, -758, -622, -910, -983, -792, -682, -740,
-    -625, -822, -961, -470, -65, -440, -391, -209, -174, -462, -64, -454,
-    -1, -157, -76, -256, 251, -50, -187, -104, 155, 100, -220, -281,
-    -266, -336, -441, -65, -320, -561, 235, 113, -18, -957, -355, 114,
-    -286, -343, -498, -691, -257, -1045, -756, 184, -1216, -999, -258, -674,
-    -1042, -1429, -772, -820, -874, -1331, -1260, -974, -668, -865, -460, -1189,
-    -1373, -936, -473, -1414, -1282, -585, 329, -82, -1440, -1234, -1093, -931,
-    -29, -974, -679, -871, -440, -474, -1356, -871, -927, -736, -938, -718,
-    -972, -321, -378, -1550, -1163, -150, -1772, -2010, -1290, -1654, -1303, -576,
-    -21, 286, -657, 229, 814, -673, -261, 276, -1035, -1067, 270, 724,
-    392, 208, -892, -553, -842, -1906, -2091, -1295, -1790, -2777, -2240, -1883,
-    -2979, -2939, -2086, -2938, -2941, -2327, -1620, -971, -1181, -630, -647, -727,
-    404, -2053, -299, 770, 1339, 2512, 1476, 61, -95, -77, 1747, 2103,
-    1655, 2405, 2158, 1258, 212, -2251, -2183, -1018, -1055, -2361, -1336, -2043,
-    289, -1943, -1479, -2796, -2953, -213, -747, -377, -750, -582, -1229, -2207,
-    -1061, -1083, -1746, -1030, 806, 69, -1070, -1447, -1218, -1230, -553, 586,
-    1189, 2520, 2956, 2319, 2242, 3761, 2806, 2097, 1071, 1324, 1190, 685,
-    1847, 1091, 1671, 736, 1807, 1750, 1035, -331, -1845, -1531, -741, -1540,
-    -1144, -502, -1224, 1465, 1569, 1177, 1359, 178, 1292, 515, 139, 926,
-    2240, 1544, 2826, 1912, 2652, 1958, 1345, 1631, 427, -345, 223, 199,
-    1096, 1874, 1180, 2309, 2158, 1731, 1371, 327, 339, 352, -806, -148,
-    259, -409, 698, 897, -1162, -869, 554, 699, 885, -13, 63, -274,
-    -1111, 72, 1230, 714, 1478, 1709, 1910, 1364, 847, 1114, 707, 1840,
-    2344, 952, -674, -103, -496, 311, -576, -943, -1372, -494, -1320, -780,
-    -768, -1804, -1503, -617, -1114, -587, -2094, -1731, -1225, 632, 215, -152,
-    -1220, -1076, -203, -832, -824, -412, 806, -186, 436, 1971, 2151, 117,
-    -1485, 1289, 914, 121, -366, 155, 309, 187, -1717, -486, -1625, -1973,
-    -1425, -49, 202, -1947, -2225, -1025, -1500, -3599, -1499, -423, -520, 1207,
-    -520, 154, -107, 638, -1206, -360, 1108, 462, 581, 465, 1047, 985,
-    1538, 1598, -385, -582, -474, -169, -1503, -2714, -3709, -2917, -1893, -1394,
-    -1287, -57, -269, -1434, -1948, -1118, -1717, -1129, -1224, -457, 36, -618,
-    1175, 1507, 1606, 2181, 683, 396, 2250, 1312, 1931, 3907, 3667, 3233,
-    2058, 957, 1753, 1365, 1063, 499, 1918, 1280, -80, 1144, 1737, 1568,
-    -168, -343, 992, 1350, 1765, -310, -507, 1412, -514, 129, 489, -1945,
-    -451, 1659, 170, -180, 895, -275, -986, 472, 1869, 2064, 1998, 2529,
-    3163, 2846, 2829, 2646, 2642, 2513, 3046, 924, 1337, 1709, 1317, 2572,
-    2130, 1439, 1406, 524, 1327, 887, 929, -215, -608, 289, 131, 6,
-    -315, 1438, 2263, 2786, 2045, 774, 1729, 2772, 547, -364, 1609, 1643,
-    1657, 517, 595, 2086, 2254, 2723, 429, 574, 2250, 742, 328, 1905,
-    1865, -335, -290, 1118, 2208, 1508, -338, -1053, 203, -1018, -504, -1125,
-    183, -1087, -135, 233, -333, -257, 248, 486, -504, -1221, -540, 109,
-    -1304, -852, 1114, 740, 495, 362, 979, 1505, 948, 985, -417, -565,
-    -1447, -2546, -2017, -983, -710, -1552, -2105, 230, -1938, -1366, -843, -2093,
-    -2128, -2989, -2589, -1412, -1452, -2810, -1537, 251, 101, -1009, -1651, -336,
-    -1073, -597, 601, -892, -1518, 5, 831, -1205, -859, -593, 267, 411,
-    -16, -902, -1673, -1835, -1280, -1971, -2956, -1552, -1377, -1505, -2598, -2083,
-    -2132, -3312, -3882, -3742, -2299, -2135, -1944, -2010, -2328, -2391, 907, 407,
-    -1920, -324, 443, -1284, -1652, -444, -1325, -739, -365, 307, 1201, 562,
-    144, -92, 317, -968, -1730, -1292, -2709, -2506, -2412, -981, -1615, -1815,
-    -1708, -2331, -2030, -2429, -2823, -2324, -2189, -3366, -1746, -734, -1736, 699,
-    1303, -700, -236, -197, -156, -22, 1054, 2721, 3711, 4669, 2495, 205,
-    1249, 1409, 755, -297, 995, 1668, 295, 1625, 961, -1425, -1594, -175,
-    1192, -292, 315, 1225, 880, 658, 471, -384, -288, -805, -1882, -344,
-    -1031, -1750, -1177, -2188, -1503, -309, 1056, 1499, 779, 878, 2307, 2559,
-    2399, 3108, 1520, 2645, 3383, 538, -78, -407, -999, 2306, 2809, -555,
-    -314, 434, -1908, -2188, 216, 685, -544, -1166, -515, 404, 881, 1176,
-    -437, 860, 1784, 2190, 1971, 1260, -179, -70, 1873, 1597, 1348, 452,
-    1558, 1238, 561, 1358, 2287, 2723, 1940, 1195, -180, -879, -217, -262,
-    -1278, 882, 904, 590, 833, 1019, -13, -1107, -1704, 734, 1726, -79,
-    -1275, -236, -231, -2163, 188, 977, 283, -1198, -581, -316, 17, -275,
-    -256, 343, -354, 872, 3016, 1844, 1556, 614, -754, 1042, -167, -1759,
-    -1519, -1324, -1328, -237, -270, 1225, -101, -1330, -1955, -1585, -954, -1827,
-    -1321, -2193, -2418, -749, -1787, -1077, 289, -227, -666, -2239, -1658, 500,
-    -100, 42, 325, 743, 770, 598, 2234, 2971, 322, 995, 1849, 1358,
-    131, 658, -949, -2593, -2475, -941, -448, -896, -1442, -875, -1125, -1103,
-    -2231, -2032, -315, -2295, -1819, -2176, -2218, -2763, -1607, -97, 729, -871,
-    493, 496, -1137, 21, 99, 1644, 1993, 807, 1061, 1302, 928, 291,
-    1081, 1226, -811, -1481, -1254, -1202, -2480, -1381, -339, -100, 740, -146,
-    -1251, -2975, -2401, -2990, -3286, -2319, -1623, -360, -691, -1221, -538, 802,
-    -226, -1672, -1769, -609, 719, 2465, 4761, 5721, 3992, 3075, 3401, 1729,
-    1471, 2342, 1576, 1957, 2241, 3368, 2061, 965, 747, 598, 1261, 1957,
-    1270, 308, 481, 230, -809, -67, -227, 1368, -1092, -2390, -588, 815,
-    -1205, -2317, -2644, -341, 748, 1552, 1382, 2233, 2984, 3458, 3075, 1786,
-    2905, 2351, 2085, 2628, 749, -1483, -85, 1356, 890, 332, 543, 601,
-    815, -92, -1542, -838, -1220, -388, -979, -670, -190, -490, 396, 1628,
-    2199, 3316, 2592, 1358, 2451, 1315, 1544, 774, 859, 1928, 3159, 3098,
-    2055, 1741, 2116, 2270, 1655, 1538, 2006, -155, -1045, 118, 888, -77,
-    -285, 817, -7, 98, 110, 663, -517, 299, 784, 314, 259, -212,
-    -681, -1025, 844, 2059, 766, -1547, -662, 1005, 927, -174, -1076, 721,
-    966, -635, -992, 1033, 1120, -51, 316, -657, -1092, -281, -2060, -2964,
-    -2671, -2057, -1459, -758, -1466, -2618, -1810, -2504, -3019, -1452, -2419, -2038,
-    -1983, -1656, -2403, -1763, 907, 600, -2190, -1591, 71, -317, -2079, 185,
-    1188, 219, -279, -146, 977, 1286, 868, 343, 367, -424, -658, -584,
-    -2337, -2599, -1653, -2166, -1360, -1125, -474, -1063, -2066, -1815, -1542, -2031,
-    -1927, -4017, -3384, -2428, -2731, -1673, -1055, -780, 450, 560, -1848, -1704,
-    -1013, -479, -993, -714, -1338, -63, 37, 162, 1375, 1943, 1626, 863,
-    49, -1810, -1511, -1552, -1284, -1536, -338, -225, -767, -1684, -1065, -1069,
-    -1090, -984, -1938, -1389, -2736, -2571, -432, -2014, -1861, -523, -815, -1002,
-    -792, -1527, -764, -972, 2455, 4383, 3375, 2376, 2581, 2974, 1838, 2982,
-    1701, 1677, 2572, 2560, 2495, 2712, 2240, 152, 200, 482, 1577, 1795,
-    1662, 383, 520, -663, -1040, -1458, -1449, -1683, -696, -15, 1038, 267,
-    -1382, -1394, -751, -380, 310, 2766, 2328, 368, 1162, 2519, 2453, 2670,
-    3699, 3002, 1785, 757, 347, 1024, 1477, 1163, 670, -59, -820, -458,
-    -413, 77, -29, -1202, -289, 388, -198, 554, -339, -960, 675, 2155,
-    1933, 1360, 1351, 865, 133, 253, 1562, 1471, 2467, 2331, 1790, 2111,
-    2273, 2433, 836, 935, 917, 657, 430, 1770, 746, 393, 587, 1017,
-    265, -9, -1078, -2193, -854, -879, -2387, -1737, -60, 177, -484, -760,
-    -172, 1174, 2148, 1249, -231, -1721, -1029, -716, 355, 1033, 254, 447,
-    638, 1686, 1933, 596, -745, -1009, -378, -801, -1906, -2889, -3711, -2535,
-    -2518, -2697, -2811, -2777, -3154, -2076, -3276, -3055, -2134, -1463, -1830, -2028,
-    -1494, -2269, -2308, -773, -95, 202, 1697, -241, 652, 554, -433, 488,
-    619, 1157, 1318, 884, 883, 880, 278, 862, 104, -583, -1167, -1076,
-    -2577, -3161, -1244, -885, -907, -1119, -1205, -1854, -3132, -3312, -3234, -2301,
-    -1835, -1770, -2039, -1200, 72, -548, -251, -436, 456, 83, -149, -658,
-    107, 244, 1078, 1241, 1260, 505, 1683, 1403, 804, 573, 114, -801,
-    80, -156, -1345, -2029, -1904, -1100, -253, -198, -774, -1199, -949, -1728,
-    -2544, -2214, -2001, -2072, -1782, -1652, -1988, -1832, -628, -135, -1135, -1275,
-    -387, -173, 1434, 2615, 3401, 3466, 3442, 2487, 3216, 2205, 1223, 2103,
-    2381, 2550, 2218, 3080, 2684, 1133, 705, 1121, 1659, 2323, 1694, 1795,
-    1070, 1097, 743, -248, -506, -253, -485, 154, 694, -997, -1105, -682,
-    284, -430, -789, 61, 749, 2470, 1835, 2126, 1338, 958, 2068, 2536,
-    2775, 2506, 1529, 1185, 1035, 344, -518, 853, 1212, 1083, 1553, 1256,
-    56, 127, 407, -332, -381, -350, 93, 698, 612, 420, 509, 1418,
-    1740, 629, 708, -84, 163, 726, 1151, 901, 1311, -131, 81, 52,
-    358, 877, 2378, 2031, 1565, 918, 1712, 1642, 1763, 1572, 263, 733,
-    621, 749, 936, 46, -179, 868, 1442, 1495, 1314, 1559, 1226, 1017,
-    326, -341, -906, -533, -289, -589, -52, -111, -330, -1040, -735, 296,
-    77, -1218, -1793, -1611, -367, -1226, -1707, -1782, -2250, -2072, -2221, -2447,
-    -2782, -2813, -1894, -936, -277, -2213, -2547, -1260, -1385, -1250, -910, -940,
-    -977, -509, -231, -337, -314, 147, 315, 111, 217, -32, 221, -511,
-    -781, -924, -546, -533, -389, -814, -604, -799, -1479, -1964, -1651, -1688,
-    -2202, -1538, -321, -1430, -1809, -1705, -1847, -1859, -1671, -1813, -1807, -1356,
-    -1193, -608, -519, -10, 208, 614, 541, 233, -18, 80, -344, 56,
-    -44, -1403, -893, -651, -425, -263, -1405, -1900, -972, -392, -1286, -587,
-    -1423, -1941, -1608, -1735, -419, -1049, -1766, -1963, -1201, -721, -1191, -1655,
-    -1461, -1055, -774, -688, -313, -381, -410, -463, -580, 525, 487, 127,
-    623, 1212, 897, 678, 929, 1504, 1676, 1876, 1637, 1789, 1449, 1722,
-    1812, 1965, 1597, 1551, 587, 1060, 1838, 1454, 1459, 1245, 762, 472,
-    519, 1111, 1216, 988, 451, 1134, 1637, 1617, 1252, 743, 747, 951,
-    260, -32, 489, 584, 579, 216, 563, 1478, 958, 342, 413, 494,
-    486, 453, 407, 1763, 1254, -360, 122, 286, 876, 979, 653, 771,
-    466, 453, 156, 979, 1374, 632, 1345, 965, 964, 958, 900, 856,
-    750, 431, 522, 508, 587, 31, 175, 334, 1062, 1007, 884, 466,
-    1057, 1471, 690, 1197, 1497, 1428, 1022, 646, 618, 928, 1329, 679,
-    1086, 558, 419, 683, 687, -52, -449, 146, 227, -123, 452, 43,
-    960, 488, -1117, -883, -309, -335, -948, -1194, -997, -1167, -1171, -1672,
-    -1990, -2368, -2466, -2025, -2327, -2521, -2523, -1994, -1228, -1713, -2667, -2698,
-    -2465, -1835, -1469, -1746, -1425, -1573, -2147, -1414, -443, -341, 640, 746,
-    1023, 461, 276, -91, -286, -204, 70, 499, -733, -944, -931, -1073,
-    -1268, -1188, -724, -569, -780, -361, -386, -560, -1220, -1869, -1615, -1552,
-    -1554, -1598, -1887, -2522, -2200, -1723, -1483, -1769, -2320, -1249, -160, -168,
-    -63, -268, -7, 113, 21, 626, 67, 183, -111, 40, 426, 213,
-    137, -471, -235, 226, 315, -212, -1238, -986, -1211, -1096, -1364, -1337,
-    -1312, -996, -1381, -946, -910, -480, -1436, -1664, -1774, -988, -742, -1093,
-    -535, -639, -259, 68, 227, 527, 312, 204, 566, 271, 294, 1091,
-    1530, 1794, 1983, 1712, 1833, 1711, 1628, 1266, 1915, 1990, 1957, 1833,
-    1433, 2338, 1420, 1480, 1673, 1239, 1359, 1050, 1174, 1532, 1432, 1568,
-    1469, 1111, 1290, 1488, 1199, 1239, 1299, 770, 167, 540, 626, 800,
-    1155, 1767, 1049, 660, 395, 413, 1032, 1009, 581, 758, 1151, 1014,
-    1206, 837, 702, 618, 470, 703, 704, 1020, 503, 446, 711, -711,
-    -669, -80, 706, 1057, 946, 1798, 1629, 1390, 810, 381, 674, 341,
-    -178, 100, 494, 834, 696, 854, 1253, 685, 226, 921, 1386, 1208,
-    1427, 579, 1107, 1036, 1141, 1183, 1429, 807, 1303, 530, 720, 160,
-    314, 439, 393, 609, 876, 196, 289, 435, 696, 595, -227, -502,
-    -1072, -939, -593, -351, -23, 136, -747, -384, -764, -1644, -1816, -1431,
-    -1867, -2050, -2354, -1726, -1532, -2100, -2302, -1709, -772, -1343, -1515, -1680,
-    -1644, -1343, -1542, -1054, -634, -1055, -771, -1048, -784, 74, 107, 220,
-    69, -492, -1039, -915, -495, -733, 18, 26, -677, -299, -863, -702,
-    -607, -826, -887, -1426, -1605, -542, -1285, -1858, -1901, -1604, -1720, -2016,
-    -2780, -2075, -1812, -2336, -2276, -1400, -776, -1099, -782, -727, -499, 424,
-    530, 169, -475, -280, 298, -74, 567, 702, 916, 612, 62, -247,
-    -561, -654, -585, -675, -825, -1030, -689, -407, -718, -1010, -1564, -784,
-    -865, -1374, -1383, -1418, -1321, -1546, -1776, -1190, -955, -1085, -922, -531,
-    -65, 484, 657, 566, 29, 574, 743, 556, 438, 448, 844, 1380,
-    1105, 605, 744, 1429, 1687, 1774, 1198, 694, 673, 662, 1250, 1182,
-    1785, 1800, 1466, 1184, 1103, 605, 1659, 1475, 872, 1064, 1218, 1445,
-    1815, 1119, 1665, 1363, 953, 541, 246, 352, 798, 888, 1084, 936,
-    1028, 781, 1250, 1409, 799, 619, 249, 554, 389, -79, -52, 621,
-    248, -311, -549, -565, 119, -115, -465, -452, -629, -593, -375, -80,
-    265, 498, 484, 355, 411, 819, 394, 227, 688, 746, 247, 423,
-    883, 867, 1135, 1397, 675, 743, 548, 311, 590, 575, 604, 578,
-    408, 913, 1059, 1143, 881, 708, 947, 1409, 1553, 1400, 1074, -329,
-    -519, 33, 152, 550, 103, 517, 312, 38, -288, -414, -817, -696,
-    -676, 114, 249, 73, -342, -835, -1120, -1117, -1417, -1798, -1883, -2353,
-    -2565, -1827, -1619, -1598, -1465, -1653, -1333, -1473, -1695, -1843, -1927, -943,
-    -980, -1643, -1531, -1206, -1041, -805, -293, -340, -774, -688, -825, -109,
-    -339, -954, -741, -427, -394, -258, 142, -107, -669, -1367, -958, -972,
-    -980, -1063, -963, -1242, -1009, -970, -722, -976, -1096, -1064, -647, -538,
-    -420, -773, -1306, -1121, -928, -704, 40, 105, -173, 114, 302, 526,
-    396, 334, 6, -474, 151, 709, 66, -180, 749, 992, 522, -526,
-    -1084, -1164, -892, -1298, -1248, -1168, -994, -816, -593, -631, -1093, -1046,
-    -1097, -788, -809, -828, -1033, -948, -916, -717, -316, -93, -286, -426,
-    -624, -442, -417, -525, -134, 251, 321, 340, 343, 614, 1100, 1599,
-    1155, 726, 245, 562, 614, 829, 783, 1383, 1234, 1745, 1725, 1400,
-    1578, 1460, 1373, 1938, 1895, 1882, 1295, 975, 1137, 1123, 940, 1269,
-    1523, 663, 485, 884, 1028, 1317, 943, 963, 884, 643, 682, 1045,
-    1127, 720, 475, 53, 299, 276, 277, 558, 312, 71, 196, 481,
-    861, 816, 507, 406, -131, -462, 0, 264, 513, 392, 102, 95,
-    978, 735, 810, 436, 320, 268, 153, -44, 111, 152, 487, 685,
-    1174, 1692, 1224, 899, 1041, 812, 312, 78, 483, 1112, 1532, 1232,
-    1483, 1266, 1557, 1000, 577, 760, 1088, 1229, 1037, 814, 1203, 173,
-    370, 211, 522, 848, 73, -399, -559, -1025, -1583, -870, -351, -40,
-    -554, -488, -486, -885, -1194, -1098, -1389, -1917, -1803, -1827, -1507, -1530,
-    -2172, -2504, -1926, -1748, -1597, -1464, -1303, -2013, -2039, -1933, -1629, -1311,
-    -1340, -1300, -829, -768, -44, -35, -321, -420, -589, -800, -518, -364,
-    -671, -148, -351, -83, -250, -285, -338, -272, -713, -617, -990, -1827,
-    -1850, -1500, -1594, -1043, -1017, -668, -763, -931, -1024, -973, -959, -886,
-    -1525, -1048, -715, -739, -421, -105, -468, -648, -516, -535, -620, -283,
-    -96, 64, 434, 158, 48, 471, -354, -326, -532, -785, -319, -793,
-    -1184, -1322, -1347, -991, -31, 52, -176, -566, -453, -230, -783, -323,
-    -258, 279, 674, -102, -605, -665, -404, -563, 154, -199, -466, -613,
-    -524, 149, 541, 220, 401, 591, 695, 764, 795, 969, 1326, 1246,
-    1412, 1253, 916, 627, 557, 746, 1197, 1811, 1897, 2016, 2009, 2149,
-    1910, 2119, 2520, 1887, 1704, 1822, 1856, 1867, 1375, 717, 553, 417,
-    680, 1436, 2042, 1754, 1485, 821, 868, 606, 1074, 1434, 534, 756,
-    362, 586, 478, 334, 284, -205, -472, 374, -174, 881, 867, 447,
-    -205, 282, 479, 247, -138, -334, 143, 313, 451, -319, -799, -311,
-    335, -187, -187, -10, -77, -23, 669, 597, 599, 1003, 1046, 552,
-    7, -316, -56, 924, 1574, 826, 493, 323, 654, 1331, 1471, 1026,
-    932, 999, 258, 606, 636, 148, 6, 135, -282, -62, -592, -1017,
-    -438, -1726, -1794, -1888, -1409, -1468, -545, -300, -888, -728, -864, -1197,
-    -1138, -501, -400, -660, -1650, -1784, -1640, -1854, -2334, -1766, -1668, -1694,
-    -1378, -1263, -1200, -1043, -1528, -1130, -451, -788, -1342, -1373, -608, -607,
-    -966, -1484, -2034, -2370, -1613, -1014, -1173, -1644, -1613, -1726, -1692, -1682,
-    -1259, -261, 15, -695, -1614, -1024, -1106, -2407, -1586, -486, -721, -868,
-    298, -702, -1222, -329, 492, 1479, 359, 1201, 1884, 1581, 451, -1321,
-    -2434, -2646, -2334, -1967, -1742, -675, 611, 98, -1150, -1293, -275, 820,
-    1115, 1834, 1385, -169, -1315, -1441, -1601, -2226, -2260, -1188, -236, -1661,
-    -2821, -2110, -1429, -659, 134, 505, 1189, 1403, 1045, 1620, 2453, 2323,
-    1475, 1002, 1247, 637, 124, -355, -78, 704, 740, -61, 267, 304,
-    94, -210, -1098, -394, 158, -40, -750, 50, 708, 132, 706, 2046,
-    1893, 704, -390, 283, 1181, 954, 2548, 3931, 4418, 4045, 3898, 4371,
-    4791, 4034, 2795, 2534, 3337, 2694, 1421, 483, 1484, 1973, 1611, 1194,
-    1679, 951, 190, -672, -1030, -944, -1023, -886, -616, 533, 6, -710,
-    190, 1284, 1491, -69, -510, -499, -74, 342, 704, 1614, 1539, 1629,
-    2589, 2870, 3536, 2738, 2576, 1499, 1558, 1191, -478, -269, 259, -408,
-    -228, 251, -416, -294, -482, -484, -1480, -1210, -1171, -857, -1749, -1700,
-    -871, -470, -177, 803, 1377, 1522, 945, 1307, 921, 716, 1311, 1279,
-    1848, 2592, 1917, 2860, 2383, 1216, 135, 1103, 757, 319, -306, -1575,
-    -2020, -1342, -338, 6, -429, -1294, -1884, -2066, -2654, -1987, -2065, -2203,
-    -2485, -2060, -1764, -1592, -1722, -1472, -1089, -1196, -2813, -2972, -2703, -2257,
-    -2249, -1434, -1014, -1053, 345, 945, 5, -427, -522, -658, -1015, -1531,
-    -1346, -1936, -2193, -1230, -635, -1327, -1498, -355, -426, -2299, -3059, -2686,
-    -1236, -2573, -2509, -1228, -2203, -2720, -1164, -19, -966, -1747, -1271, -2884,
-    -3184, -2284, -1450, 271, 1343, 1400, 2217, 1228, -503, -684, -73, -416,
-    -1401, -261, -1044, -1062, -1509, -2372, -1485, -699, -375, 546, 428, -140,
-    110, -944, -2352, -1959, -1102, -1508, -1613, -391, -167, -1011, -1671, -1752,
-    -2167, -1544, -969, 874, 1980, 1451, 693, 1224, 1882, 590, -8, -281,
-    348, -626, -1151, -639, 15, 1990, 2533, 1337, 498, 655, 292, -1011,
-    -1193, 65, 393, -1165, -1223, 865, 1552, 451, 2208, 2020, 889, 1568,
-    1795, 1646, 764, 1524, 1843, 2603, 2976, 3311, 3601, 3558, 2789, 3186,
-    2701, 1814, 2566, 2859, 1489, 382, 1044, 1580, 930, 882, 614, 871,
-    382, 1428, 861, 578, -255, -1736, -1206, -296, -493, -947, -1397, -240,
-    790, 2285, 1263, 294, 929, 726, 208, 106, 1804, 2538, 3036, 3010,
-    2327, 2968, 3353, 2892, 3228, 2260, 1091, -58, -902, -1143, -161, -618,
-    -817, 608, 461, -1411, -1900, -1042, -1854, -2909, -2634, -2149, -1891, -686,
-    -128, -779, 997, 1292, 1073, 734, 821, 2274, 2435, 2313, 2717, 3273,
-    2685, 2482, 3260, 2727, 1941, 759, 1289, 1857, 641, -179, -655, -54,
-    -1281, -2596, -2583, -2480, -1742, -1930, -2969, -4479, -3999, -4134, -4045, -3695,
-    -2988, -1780, -2030, -2823, -2508, -1795, -1431, -1638, -2274, -1586, -927, -930,
-    -755, -702, -4, -104, -427, 407, 574, -95, -499, -439, 17, -1621,
-    -1990, -1949, -1775, -576, -954, -1465, -1380, -2417, -2574, -2948, -2964, -3412,
-    -2269, -2362, -1741, -1826, -2334, -2202, -1279, -827, -2465, -3169, -2023, -881,
-    -693, 554, 2620, 1899, 123, 296, -334, -137, -246, -679, -1142, -1637,
-    -766, -656, -438, -1132, -1420, -1601, -1655, -532, -41, 911, 149, -790,
-    -491, -41, 335, -962, -2531, -1439, 175, 1027, 156, -766, -592, -723,
-    -578, 160, 476, 1912, 2311, 1923, 1770, 747, 181, 710, 1020, 581,
-    -568, -382, -221, 275, -4, 200, 53, -775, -348, 224, 167, -94,
-    359, 850, 166, 597, 1862, 248, 995, 3956, 3889, 2246, 2594, 2754,
-    3323, 3920, 2717, 3107, 4570, 4308, 3788, 4406, 3425, 2639, 3127, 3537,
-    3304, 2548, 1394, 1111, 1427, 452, 1929, 2330, 2005, 2793, 1271, 1117,
-    961, -760, -286, -1463, -530, 931, 1470, 1332, 719, 1754, 2218, 1807,
-    1277, 967, 632, 608, 1790, 1829, 2463, 2503, 2763, 2609, 2076, 2651,
-    3011, 2954, 2060, 1170, 1359, 1062, -138, -1337, -885, -713, -324, -374,
-    -524, 533, -203, -1787, -1214, -750, -179, 269, -96, -716, -160, 1686,
-    1319, 519, -196, -272, -1145, 618, 2508, 2384, 1190, 1271, 1516, 1949,
-    840, 1665, 2221, 1400, 638, 836, 56, -345, -1881, -1959, -1843, -1678,
-    -1453, -2008, -2674, -3189, -3551, -3729, -3684, -3037, -3690, -3944, -3097, -3840,
-    -3897, -2217, -2375, -3186, -3838, -3707, -3703, -3481, -2262, -1837, -2351, -1574,
-    -203, -533, 398, 861, 613, 634, -547, -668, -697, -1730, -2139, -2332,
-    -861, -864, -1488, -1575, -2490, -1941, -2793, -3971, -4638, -3766, -3179, -3126,
-    -2808, -3315, -3653, -2492, -2831, -2195, -1340, -2928, -2947, -2808, -1744, 777,
-    3134, 1784, -125, 174, -484, -828, -785, -1094, -380, 150, 515, 311,
-    465, -1201, -1236, -560, -461, -1015, -568, 359, -199, -1061, -968, -1141,
-    -1755, -1826, -2357, -2678, -355, 188, 24, -901, -2096, -1124, -27, 244,
-    488, 1953, 2109, 956, 1498, 1898, 1842, 2466, 2180, 1100, -257, -350,
-    -574, -348, -24, 729, 634, -5, -527, -25, -233, 1045, 890, -78,
-    2, 786, 813, 1998, 2038, 2673, 3527, 2941, 2398, 2812, 3175, 2899,
-    3011, 3413, 4323, 5160, 4063, 3845, 3033, 2297, 2490, 1938, 1941, 2771,
-    2729, 1501, -670, 512, 2291, 1149, 113, 691, 983, 736, 496, -640,
-    -1313, -1168, -952, -429, 363, 2067, 2241, 1406, 2383, 2291, 2429, 1875,
-    1971, 1377, 1425, 2359, 2558, 2210, 1178, 2449, 2341, 1570, 2141, 2352,
-    1188, 144, -324, -633, -2170, -2166, -1094, -906, -378, 247, -227, -25,
-    -16, 504, -126, -984, -980, -784, -215, 437, -75, -362, 900, 2845,
-    1294, 403, 1193, 1246, 1506, 444, 399, 1135, 1694, 1667, 1098, 818,
-    -240, 411, 151, -735, -279, -263, -1955, -2553, -2537, -3041, -2762, -1913,
-    -2357, -2489, -2006, -2240, -3382, -3164, -2634, -3771, -4219, -2935, -3397, -2930,
-    -2635, -1847, -666, -1846, -2241, -2847, -3317, -2598, -1298, -812, -366, -299,
-    -615, -534, 256, -228, -27, 462, -225, -551, -849, -1786, -2436, -2570,
-    -2904, -2195, -854, -1386, -1479, -1593, -2973, -3515, -3421, -2935, -3162, -3277,
-    -2947, -2917, -1748, -1128, -259, -855, -3010, -3123, -1569, -562, 626, 2068,
-    1674, 189, 2, -546, -1189, -311, -247, -499, 195, -292, -379, 1071,
-    -271, -1249, -178, 918, 536, -200, 372, 218, -587, -805, -182, 59,
-    -708, -1527, -1244, -492, -306, -759, -1785, -1910, -1139, -124, 821, 1464,
-    1942, 2518, 2720, 2125, 1693, 1770, 1334, 1595, 798, -43, 554, 208,
-    296, 1446, 1379, 1247, 1372, 1233, 1763, 1106, -447, -191, -695, -379,
-    868, 1063, 1386, 436, 2023, 2836, 1959, 1196, 1618, 1942, 1742, 1047,
-    2356, 3188, 2692, 3026, 3596, 3250, 2207, 2000, 2251, 2700, 2128, 774,
-    403, 799, 1142, 1269, 1139, 744, 644, 253, -475, -915, -1743, -1200,
-    -691, -284, 174, -173, 590, 483, -163, 1471, 2076, 1915, 2303, 2316,
-    1090, 1282, 2219, 2421, 2731, 2569, 1777, 834, 65, 1087, 1562, 962,
-    513, -6, -910, -1731, -1493, -573, -382, -217, -126, -828, -1040, -1090,
-    -2105, -1784, -1189, -1495, -411, 189, -633, -244, 429, 1671, 2059, 1759,
-    245, 258, 134, 302, 1681, 1580, 1614, 2034, 1838, 1982, 2019, 1092,
-    724, 146, -733, -1764, -1895, -3442, -3673, -1796, -1951, -2023, -2018, -2908,
-    -3313, -2908, -2645, -3035, -3210, -2987, -2238, -1503, -2248, -2527, -1761, -1958,
-    -1119, -1636, -1775, -1270, -1167, -470, 418, 205, -187, 1463, 2179, 1828,
-    452, 584, 801, -356, -402, -1254, -2092, -2223, -2595, -1737, -1706, -1088,
-    -763, -1119, -1531, -1869, -2317, -2740, -3502, -2996, -2202, -2469, -2223, -2763,
-    -1994, -1494, -1116, -1340, -1713, -1591, -1536, -47, 985, 1226, 1096, 791,
-    -348, -1455, -791, -1033, -1730, -1501, -1251, -876, -261, 67, -316, 94,
-    -104, 395, 448, 796, 426, 947, 847, -620, -980, -1099, -1416, -1980,
-    -1502, -497, -606, -1232, -1192, -1137, -716, -874, -1130, -215, 1000, 810,
-    1318, 1967, 1998, 1635, 1287, 1326, 1547, 1988, 1412, 675, 594, 1433,
-    1822, 1274, 513, 1088, 1003, 763, 1526, 983, 921, 986, 1668, 1432,
-    331, 943, 1258, 1785, 1789, 1576, 1786, 920, 1131, 1553, 1942, 1661,
-    918, 914, 1114, 621, 985, 1718, 1871, 1299, 1151, 1304, 916, 1350,
-    2535, 2402, 2219, 1381, 1259, 2180, 2106, 1738, 1942, 2724, 2086, 1169,
-    1056, 791, 208, 713, 1386, 1591, 1222, 872, 762, 981, 846, 1029,
-    498, 413, 1125, 452, 672, 260, -120, -48, -360, -244, 64, -212,
-    -533, -440, -190, 10, 239, 482, 719, 667, 766, 653, 943, 731,
-    879, 430, -220, 296, -299, 377, 385, 51, 230, -452, -648, -822,
-    -420, 524, 968, 789, 1012, 317, 97, 256, 209, -462, -1546, -1562,
-    -1785, -2391, -1055, -920, -1038, -531, -421, -274, -99, -691, -1430, -1885,
-    -2212, -2394, -2676, -2327, -2759, -2981, -2089, -1597, -1735, -1127, -1164, -1521,
-    -880, -527, -75, -738, -1480, -1593, -1590, -1567, -1091, -757, -843, -1518,
-    -1102, -1406, -1758, -1074, -784, -948, -1536, -2023, -2134, -2085, -2407, -1955,
-    -1132, -927, -1231, -1766, -1525, -1226, -1479, -1375, -1209, -1832, -1485, -1043,
-    -720, -254, -1114, -496, -520, -927, -993, -981, -604, -1271, -777, 48,
-    -686, -1325, -2063, -1549, -1771, -1260, -699, -506, 101, -27, -52, 59,
-    387, 63, 206, 189, 250, 123, 822, 893, 566, 238, 93, 114,
-    343, 330, 260, 83, -172, 86, 82, 813, 1389, 1371, 1538, 1832,
-    914, 1015, 932, 813, 740, 770, 584, 1136, 1838, 2369, 2846, 2541,
-    2752, 2600, 2276, 2000, 2087, 2474, 2261, 2262, 2469, 2152, 2307, 2096,
-    2024, 2090, 2286, 1992, 1820, 2145, 1968, 2109, 1805, 2034, 1955, 1272,
-    1021, 1175, 1354, 1768, 1859, 1357, 1058, 1067, 978, 1069, 1174, 1467,
-    1975, 2219, 2555, 2282, 2497, 2562, 2512, 2077, 1553, 2011, 2098, 2043,
-    1245, 993, 458, 418, 540, 1108, 1079, 1199, 929, 1032, 347, 331,
-    158, -259, -38, -158, -236, 250, -305, -1292, -1572, -1549, -977, -523,
-    192, 984, 1136, 1243, 1216, 1286, 1068, 973, 511, 273, 805, 997,
-    1107, 1070, 869, 877, 483, 300, 165, 208, -66, -684, -605, -913,
-    -821, -963, -583, -745, -1270, -1358, -1137, -1168, -1710, -2150, -1899, -2019,
-    -1957, -1700, -1332, -1334, -1779, -1761, -1983, -1922, -2123, -2150, -2214, -2168,
-    -2218, -2001, -1987, -2514, -2988, -3139, -2595, -2365, -2275, -2009, -1685, -1678,
-    -2007, -2368, -2508, -2583, -2378, -2183, -2157, -1856, -1568, -1543, -1763, -2070,
-    -2542, -2144, -2021, -2518, -2267, -1953, -1844, -2017, -1685, -1779, -1891, -1689,
-    -1597, -1479, -1733, -1455, -1886, -2526, -2758, -2304, -1968, -1364, -720, -576,
-    -529, -361, -559, -492, -541, -500, -92, -77, -83, -88, 95, -361,
-    -475, -693, -1040, -1117, -275, 265, 605, 689, 537, 614, 275, 31,
-    -146, -323, -9, -151, 11, 270, 342, 8, 32, -316, -404, -773,
-    -466, 24, 494, 780, 751, 1221, 1389, 1343, 1599, 1799, 1826, 1745,
-    1404, 1384, 1408, 1488, 1894, 2009, 2346, 2653, 2331, 2178, 2226, 2093,
-    1881, 1866, 2042, 2055, 2040, 2334, 2464, 2281, 1527, 1228, 1127, 917,
-    1233, 1822, 2478, 2418, 2243, 2296, 2111, 1670, 1681, 1189, 993, 1228,
-    1318, 1624, 1749, 1780, 1825, 1875, 1697, 1401, 1396, 1549, 1624, 1677,
-    1810, 1817, 1826, 1861, 1903, 1752, 1972, 1944, 1906, 1889, 1658, 1293,
-    910, 948, 988, 1147, 1452, 1341, 1128, 933, 1094, 809, 335, 457,
-    379, 528, 376, 357, 16, -327, -485, -639, -427, -313, 35, 328,
-    454, 383, 341, 384, 449, 599, 836, 903, 1168, 1273, 1200, 1064,
-    631, 83, -190, -267, -603, -249, 140, -19, -137, -160, -336, -626,
-    -985, -1232, -1189, -1234, -1371, -1800, -2071, -2546, -2242, -2163, -1846, -1946,
-    -1887, -1827, -1834, -1783, -1681, -1517, -1197, -1364, -1455, -1364, -983, -1060,
-    -1046, -1324, -1813, -2071, -1927, -1827, -1605, -1072, -991, -1197, -1796, -1985,
-    -2159, -2296, -2277, -2474, -2147, -1980, -1857, -1959, -1735, -2017, -2007, -2147,
-    -2163, -2162, -1672, -1415, -1149, -1122, -1070, -853, -838, -714, -293, -293,
-    -606, -949, -1318, -1335, -1303, -1162, -1213, -804, -892, -824, -383, -5,
-    -315, -643, -528, -391, -412, -571, -716, -1018, -1015, -996, -989, -992,
-    -934, -713, -370, 12, 158, 95, -60, 108, 368, 320, 153, 386,
-    670, 849, 611, 477, 133, 167, 87, 154, -182, 47, -115, 327,
-    629, 738, 885, 955, 773, 715, 742, 1196, 1433, 1575, 1369, 1613,
-    1904, 2067, 2149, 2248, 2580, 2482, 2136, 2070, 1904, 1970, 2137, 2402,
-    2383, 2482, 2174, 1753, 1736, 1363, 787, 1065, 1103, 1058, 772, 863,
-    1464, 1870, 1806, 1258, 1175, 925, 1181, 1545, 1811, 1752, 1685, 1622,
-    1531, 1742, 1858, 1686, 1740, 1679, 1757, 1580, 1677, 1855, 1588, 1236,
-    1308, 1157, 1128, 1728, 1682, 1321, 715, 395, 483, 326, 378, 98,
-    172, 345, 373, 524, 893, 901, 715, 637, 434, 130, 408, 293,
-    224, 80, -197, -123, 472, 159, 44, 191, 373, 343, 220, 134,
-    322, 491, 515, 636, 832, 837, 600, 750, 272, -272, -283, -351,
-    -673, -434, -435, -840, -908, -242, -103, -304, -474, -605, -1119, -1367,
-    -1143, -848, -882, -1364, -1129, -973, -1226, -1439, -1589, -1729, -1687, -1856,
-    -1867, -1886, -1887, -1785, -1613, -1288, -1354, -1838, -1824, -1665, -2056, -1731,
-    -1849, -1972, -1631, -1491, -1578, -1680, -1827, -1703, -1541, -1992, -2501, -2577,
-    -2415, -1986, -1537, -1663, -2106, -2135, -2202, -2207, -2157, -2226, -2287, -2145,
-    -2147, -2185, -2067, -1909, -1518, -1200, -946, -912, -1194, -1409, -1206, -1019,
-    -1120, -1223, -1217, -960, -918, -861, -1036, -722, -528, -455, -402, -294,
-    -137, -70, -642, -853, -683, -459, -572, -942, -847, -566, -253, -233,
-    -378, -275, -218, -38, -101, -412, -310, 39, 413, 839, 744, 759,
-    1024, 909, 679, 796, 699, 615, 265, 363, 598, 897, 1026, 1275,
-    1320, 1284, 1338, 1292, 1480, 1568, 1567, 1593, 1560, 1362, 1798, 2075,
-    2275, 1752, 1290, 1423, 1511, 1801, 2053, 2137, 2012, 2334, 2534, 2258,
-    1722, 1505, 1531, 1710, 1394, 1361, 1246, 1491, 1681, 1569, 1604, 1434,
-    1346, 1352, 1449, 971, 967, 815, 1235, 1406, 1544, 1482, 1174, 1342,
-    1636, 1995, 2130, 1743, 1829, 2059, 2242, 1761, 1501, 1592, 1628, 1590,
-    1707, 1461, 1202, 1183, 886, 688, 802, 441, 228, 111, -274, -249,
-    183, 622, 695, 492, 571, 551, 236, -34, 262, 365, 584, -111,
-    -333, 46, 401, 768, 1059, 1089, 633, 872, 979, 887, 749, 838,
-    288, 352, 311, 203, -50, 60, 69, -309, -695, -1017, -1213, -1264,
-    -1279, -1245, -946, -1102, -1118, -1010, -1148, -1342, -1525, -1215, -1032, -1147,
-    -1293, -1345, -1434, -1719, -1835, -1507, -1578, -1748, -2014, -1894, -1638, -1375,
-    -1312, -1191, -1091, -1265, -1319, -1656, -2002, -2050, -2131, -2218, -1898, -1850,
-    -1540, -1505, -1298, -1240, -1669, -1869, -2046, -2025, -1684, -1686, -1686, -1511,
-    -1504, -1695, -1646, -1422, -1451, -1724, -2042, -1731, -1475, -1408, -1578, -1208,
-    -1038, -958, -784, -1081, -1276, -950, -1248, -1738, -1741, -1091, -954, -677,
-    -392, -400, -404, -451, -508, -730, -542, -467, 81, -139, -150, -169,
-    -549, -710, -902, -992, -854, -805, -1063, -998, -543, 93, 93, 143,
-    93, 134, -139, 326, 532, 295, -27, 141, 461, 303, 816, 663,
-    449, 397, 657, 604, 448, 742, 1032, 1187, 1426, 1411, 1672, 1855,
-    1840, 1604, 1634, 1653, 1790, 1946, 1446, 1297, 878, 656, 761, 659,
-    917, 961, 758, 832, 1548, 2144, 2498, 2365, 1955, 1749, 1570, 1775,
-    1654, 1949, 1837, 1538, 1548, 2071, 2451, 2164, 1648, 1755, 1762, 1480,
-    1794, 1484, 169, 1325, 3145, 2822, 211, -1526, -1701, -317, 428, 1484,
-    2633, 3771, 3984, 3886, 3992, 3387, 3441, 2877, 2055, 1617, 988, -180,
-    -948, -1350, -1094, -1035, -1015, -1961, -2664, -2906, -1692, -977, -463, -8,
-    -345, 35, 266, 625, -116, 319, 797, 1218, 935, 629, 476, 1025,
-    2163, 2508, 2598, 2797, 2979, 2941, 3229, 3474, 3849, 4163, 4026, 3536,
-    3258, 3175, 3291, 3532, 3603, 3058, 2742, 2294, 1936, 1911, 1788, 1641,
-    1714, 565, 636, 404, -227, -62, -297, -372, -420, -860, -1589, -525,
-    -585, -2050, -1389, -1004, -1549, -1680, -2376, -3809, -3428, -2608, -1988, -1350,
-    -1894, -1161, -1371, -2462, -3586, -5030, -5364, -5802, -5962, -6073, -5723, -5933,
-    -5423, -6036, -6601, -6189, -5077, -5161, -5797, -5562, -4734, -5085, -5128, -5909,
-    -6488, -6322, -6521, -5627, -5202, -5015, -4599, -4354, -4302, -4718, -4498, -3560,
-    -3375, -1619, -1516, -2120, -1259, -919, -1409, -1239, -677, -1840, -1826, -1445,
-    -854, 261, 191, -261, -39, -182, 137, -477, -1707, -1763, -1528, -1560,
-    -667, -416, -403, 458, 1124, 1759, 1461, 951, 1036, 1913, 2992, 3630,
-    3059, 3189, 4288, 4695, 4695, 3502, 3044, 2512, 2144, 2501, 2835, 1734,
-    1443, 1199, 1771, 1427, 1128, 963, 792, -99, -1779, -2002, -1911, -1093,
-    -1048, -1859, -1593, -869, -267, -1539, -1823, -1316, -587, -395, -332, -358,
-    -1276, -948, -607, 305, 394, -32, -556, -713, 122, 1259, 1541, 1073,
-    698, -189, -1428, -1921, -1728, -602, -116, 14, -417, -1133, -1224, -1575,
-    -1621, -1487, -1032, -724, -542, -421, 136, 212, 1036, 1716, 1429, 2088,
-    2317, 2125, 1381, 1908, 1923, 3033, 3723, 4473, 4040, 4262, 4804, 5492,
-    4997, 4977, 4226, 4372, 3704, 3339, 3680, 4896, 5332, 4741, 4793, 4649,
-    4268, 4158, 3913, 3252, 2908, 2875, 2646, 2255, 2303, 2195, 3053, 4211,
-    4027, 3135, 3169, 3133, 3663, 3106, 2927, 2948, 3074, 3735, 3656, 4378,
-    3074, 2505, 2448, 2039, 1549, 949, 508, -228, -457, 268, -162, -1013,
-    -1764, -2074, -2315, -2396, -1974, -2721, -3054, -2968, -3577, -3453, -2847, -2955,
-    -2886, -1800, -1874, -2158, -1810, -3285, -4247, -3571, -2429, -823, -107, -314,
-    -341, -1608, -1665, -2493, -2393, -2744, -3167, -2841, -3226, -2887, -2819, -3481,
-    -3903, -2798, -2653, -2543, -2454, -2493, -2258, -2656, -3338, -4018, -4666, -4781,
-    -4357, -2541, -1607, -1332, -1766, -1717, -1211, -1382, -942, -539, -128, 35,
-    952, 1292, 1713, 1335, 1916, 2397, 3515, 3147, 1861, 2130, 3228, 3044,
-    2106, 2374, 2428, 1751, 1581, 1287, 1014, 1536, 2085, 1443, 2283, 1960,
-    2324, 2237, 1774, 2924, 3975, 3508, 3454, 3446, 4222, 4345, 4554, 4342,
-    4353, 4678, 5076, 6213, 4937, 4557, 5167, 4654, 4742, 3522, 1238, 1140,
-    1806, 1926, 2041, 2726, 1923, 846, 201, -812, -942, -1665, -1121, -974,
-    -1372, -1872, -2381, -1488, -1067, -382, 375, 495, -692, -491, -457, -941,
-    -1380, -1923, -1711, -953, -1, 559, 633, 1104, 62, -634, -481, -891,
-    -1923, -3691, -3527, -2248, -1800, -2025, -1917, -2558, -3008, -3405, -3504, -4124,
-    -4302, -4230, -4767, -4678, -4423, -3823, -2753, -2131, -1398, -810, -1465, -2086,
-    -1799, -2223, -2230, -1873, -1552, -1674, 365, 751, 194, 547, 933, 270,
-    -206, -144, 48, -92, -932, -687, -338, 203, 618, 719, 140, -992,
-    -785, -692, -1536, -1474, -1226, -1056, 621, 1301, 520, 285, 1577, 2501,
-    2956, 2792, 2187, 2018, 2759, 3374, 3214, 3439, 4290, 4162, 3942, 4335,
-    4259, 3950, 3522, 3073, 2473, 2783, 2393, 1552, 2035, 1822, 1661, 1112,
-    1363, 1182, 1683, 1509, 996, 834, 390, 208, 629, 1625, 1853, 997,
-    3043, 3018, 2753, 1572, 527, 341, 1132, 1033, 2187, 3034, 2811, 2026,
-    1371, 1233, 913, 247, 86, 146, -150, -914, -188, 14, -689, -1054,
-    -246, 161, -105, -1117, -1823, -2164, -2875, -2745, -3092, -3037, -3341, -3465,
-    -1856, -783, -1639, -2972, -3587, -3195, -2552, -2516, -2507, -2489, -2229, -1332,
-    -1561, -1416, -1659, -1240, -1472, -1336, -2118, -2916, -2665, -1676, -1582, -1968,
-    -1791, -2529, -2289, -2545, -3180, -2822, -2616, -2972, -2869, -3078, -3035, -3116,
-    -3627, -3371, -1850, -1352, -1531, -1399, -1258, -930, -540, 425, -113, -365,
-    -330, -809, -417, -179, -346, 1049, 1371, 982, -64, -1423, -1573, -868,
-    -107, -283, -398, -388, -535, -761, -885, -1325, -929, -1569, -1392, -1253,
-    -1901, -762, -442, -521, -281, 1042, 1382, 393, -554, -1, -67, 669,
-    944, 1525, 2204, 1696, 2731, 3820, 3739, 4002, 3300, 2860, 3211, 2514,
-    1494, 1776, 2681, 3353, 3345, 3276, 2929, 1909, 1435, 983, -48, -228,
-    -182, -316, 347, 659, 708, 1696, 2411, 2556, 1329, 161, 292, 195,
-    222, 1066, 1015, 608, 871, 1356, 1584, 2084, 2489, 2426, 1934, 2017,
-    1793, 2107, 1747, 961, 328, 497, 948, 844, 1173, 1619, 952, 552,
-    260, -336, -886, -1052, -1277, -1549, -1374, -933, -496, -63, -227, -754,
-    -535, -25, -206, 67, -302, 441, 671, 400, 36, 32, 134, -274,
-    -852, -1706, -1740, -1828, -2710, -3058, -4117, -3877, -3760, -2696, -2769, -3036,
-    -2701, -3438, -3868, -4466, -5602, -4817, -4212, -3589, -3183, -3491, -3133, -1978,
-    -1685, -2878, -4761, -5199, -4007, -3198, -1718, -502, -380, -852, -1206, -1572,
-    -2027, -2528, -2640, -2423, -2561, -2918, -2439, -1787, -2683, -3138, -2298, -1768,
-    -1278, -1411, -1608, -2240, -2836, -2784, -2352, -2343, -1871, -2515, -1541, -989,
-    -1216, -1401, -933, -878, -1234, -1234, -786, -426, -163, -291, -484, -33,
-    704, 883, 882, 1252, 448, 197, -159, 312, 422, 183, -146, -11,
-    -333, -933, -912, -483, -403, -726, -1174, -1050, -946, -75, 291, 510,
-    2262, 3154, 3011, 2592, 2624, 2164, 2745, 3437, 3450, 4082, 4407, 4541,
-    4659, 4237, 4255, 4339, 3863, 3000, 2972, 2156, 1574, 1646, 2902, 3269,
-    2733, 3340, 3639, 2648, 1985, 1179, 948, 1121, 966, 1256, 1145, 2207,
-    1833, 1728, 2860, 3354, 2892, 2501, 1841, 1788, 1849, 2159, 2019, 2109,
-    2828, 2786, 3191, 3451, 3639, 3434, 3491, 1952, 1205, 1700, 372, 483,
-    1388, 1430, 1585, 1939, 2066, 1876, 1765, 1339, 627, 710, -266, -209,
-    -113, -128, -259, -92, 809, 1345, 796, -316, -775, -1008, -1055, -1269,
-    -908, -446, -455, -421, 353, 1740, 1639, 380, 375, -167, -360, -219,
-    -690, -1614, -1990, -1599, -962, -1240, -733, -918, -1224, -1579, -3100, -4390,
-    -4296, -4190, -3844, -3849, -3483, -3001, -3173, -2683, -2562, -2768, -2945, -3143,
-    -3679, -3249, -3004, -2590, -2466, -2031, -1893, -1413, -2433, -2412, -2891, -3734,
-    -3629, -3212, -3511, -3517, -3841, -3568, -3011, -2183, -2287, -2675, -3001, -3065,
-    -2946, -3809, -4082, -3665, -3437, -3373, -2649, -3358, -3008, -2260, -2304, -2229,
-    -3495, -3784, -3922, -3120, -1451, 108, 634, 473, -61, -1434, -1617, -1610,
-    -1622, -1453, -1291, -1094, -1777, -885, -657, -1435, -921, 154, 458, 707,
-    574, -280, -292, -419, -533, -596, -688, -738, 85, 1175, 928, 142,
-    177, -243, 228, 346, 131, 553, 1650, 2437, 2014, 2565, 2642, 3196,
-    2848, 2724, 3215, 1754, 1157, 1138, 1650, 1774, 2099, 1809, 1894, 1779,
-    1094, 119, -212, -323, 524, 1514, 1936, 1744, 1896, 2112, 3228, 4374,
-    4857, 4880, 4330, 4695, 4780, 4891, 5113, 5427, 5390, 6403, 5913, 5858,
-    5144, 4127, 3452, 3413, 4058, 2868, 2865, 2811, 3408, 3518, 3897, 3405,
-    2838, 2072, 1856, 1503, 850, 883, 1170, 1236, 1399, 1744, 2058, 2121,
-    2309, 3108, 3480, 3400, 3319, 2688, 2495, 2661, 3335, 3593, 3523, 4235,
-    4349, 4359, 3929, 3328, 2553, 2449, 2745, 2145, 1739, 935, 855, 1500,
-    2183, 2276, 2332, 2472, 1801, 546, -269, 393, 737, 236, -268, 120,
-    -91, -34, -78, 426, 1117, 648, 200, -62, -799, -355, -517, -232,
-    115, 250, 394, 46, -171, 313, 337, 727, 833, 622, -143, -208,
-    -1096, -1635, -946, -1077, -735, -1171, -1676, -2922, -3398, -3764, -3420, -2904,
-    -2834, -2721, -3393, -3452, -3646, -2648, -1911, -2099, -2753, -2395, -2799, -2568,
-    -2376, -2216, -2415, -1898, -1202, -1559, -2181, -2539, -3680, -3452, -3085, -3385,
-    -3871, -4481, -4167, -3138, -2735, -2469, -2606, -3150, -3530, -4316, -4880, -4233,
-    -3862, -3438, -4631, -4771, -4672, -4784, -4739, -3671, -2849, -2534, -4074, -4895,
-    -4794, -4289, -3082, -2485, -1929, -2465, -3113, -3887, -3806, -3682, -3753, -3694,
-    -3395, -2478, -2104, -1795, -2234, -2708, -2589, -2082, -966, -684, -984, -1237,
-    -1708, -1666, -1715, -1983, -2626, -3037, -2381, -2781, -2330, -2577, -2709, -2253,
-    -2208, -1868, -2183, -1582, -1180, -855, -475, -439, -598, -540, -700, -541,
-    -184, 296, 788, 929, 802, 560, -34, -604, -576, -690, -371, -761,
-    -645, -775, -447, -74, 385, 718, 550, 965, 1277, 1298, 1947, 2657,
-    2830, 2560, 2566, 2844, 2787, 2586, 2718, 2612, 2024, 2486, 2903, 2391,
-    2607, 2661, 2804, 3264, 3177, 3282, 3254, 2780, 2894, 3323, 3052, 3105,
-    2918, 2696, 2981, 3108, 2890, 2909, 3264, 3475, 3255, 3570, 3277, 3359,
-    3722, 3552, 3693, 3710, 3516, 3677, 3651, 3821, 3853, 4207, 4205, 4299,
-    4522, 4540, 4498, 4538, 4672, 4934, 4770, 5055, 5132, 5324, 4974, 5212,
-    5330, 4974, 4366, 3902, 3688, 3602, 4110, 4423, 3786, 3048, 2906, 3444,
-    3268, 3757, 3917, 3668, 3604, 3169, 2946, 2892, 2912, 2877, 1910, 2011,
-    2095, 2117, 1769, 2393, 3014, 3410, 3339, 3020, 2899, 3421, 3174, 2824,
-    1795, 1787, 2173, 1515, 1326, 1403, 1230, 1593, 2022, 2343, 2559, 2289,
-    1852, 1684, 1690, 1992, 1653, 1441, 1755, 1728, 1584, 1903, 1351, 1025,
-    374, 169, -263, -624, -899, -1039, -1220, -781, -689, -511, -952, -491,
-    243, -521, -765, -899, -959, -1694, -1926, -2179, -2163, -1827, -1876, -1457,
-    -1224, -947, -456, -476, -733, -1162, -828, -988, -939, -2226, -2438, -2550,
-    -2379, -3211, -3386, -3044, -2891, -3179, -3528, -3005, -2817, -3036, -3124, -2886,
-    -2765, -2398, -1814, -2245, -2063, -2079, -2363, -2604, -2634, -2733, -2524, -2927,
-    -2740, -2421, -2767, -3127, -3029, -3129, -3318, -3825, -3394, -3655, -3629, -3399,
-    -3723, -3458, -3937, -4101, -4434, -4263, -4603, -4924, -5004, -4620, -4101, -3811,
-    -4057, -3250, -3468, -3777, -3884, -4178, -4015, -4027, -3971, -4332, -4273, -3721,
-    -3289, -3004, -2980, -2965, -2700, -2771, -2738, -2744, -2964, -2899, -2292, -1996,
-    -2426, -2556, -2505, -2660, -2980, -2549, -2616, -2689, -3020, -3161, -2680, -2421,
-    -2583, -2599, -2571, -2665, -2411, -2171, -2089, -1177, -1223, -885, -1179, -1988,
-    -2259, -2333, -2157, -1808, -1365, -1770, -1327, -600, 3, 244, -356, -575,
-    -517, -877, -1154, -1107, -945, -701, -1052, -452, -654, -409, -848, -511,
-    151, 513, 694, 710, 745, 1094, 1371, 2153, 2260, 1936, 1831, 2134,
-    1654, 1275, 973, 1072, 1213, 1123, 1444, 1364, 1432, 1763, 1144, 1246,
-    903, 318, 703, 498, 711, 480, 1099, 952, 1123, 1072, 1412, 1778,
-    1515, 1794, 1753, 2424, 2940, 3195, 3699, 3415, 3448, 3868, 3754, 3665,
-    3278, 2955, 2350, 2818, 3151, 3325, 3191, 3335, 3497, 3601, 4114, 4287,
-    4417, 3890, 3878, 4358, 3829, 3904, 3497, 3728, 4147, 3693, 3966, 3710,
-    4080, 3941, 3864, 3578, 3908, 4007, 4003, 4031, 3208, 3327, 3731, 3703,
-    4220, 3881, 3488, 3511, 2987, 2908, 3280, 3462, 3468, 3975, 4129, 4376,
-    4882, 5329, 5085, 4345, 3741, 3449, 3546, 3448, 3219, 2993, 3117, 3582,
-    3646, 3885, 3336, 2841, 2426, 2420, 2758, 2993, 2887, 3008, 3444, 3211,
-    3618, 3443, 3446, 2802, 2372, 2047, 1921, 1696, 2075, 2409, 2538, 2914,
-    2858, 2549, 2604, 2915, 2334, 1809, 1733, 1784, 1349, 1369, 1235, 1221,
-    1424, 1122, 740, 706, 1046, 1202, 1121, 910, 928, 1086, 1194, 1121,
-    795, 310, 389, 293, 332, -107, -358, -622, -317, -223, -258, -425,
-    -596, -196, -4, 162, 477, 613, 459, 454, 306, 215, -255, -462,
-    -390, -431, -922, -887, -1318, -1232, -895, -1375, -1717, -2124, -2169, -1570,
-    -1768, -2016, -1814, -2168, -2055, -1820, -2190, -3041, -3246, -3534, -4241, -4396,
-    -3783, -3120, -3231, -3220, -2525, -1757, -1732, -2081, -2475, -3045, -3179, -3496,
-    -3474, -3509, -3386, -3090, -2871, -2788, -2643, -3150, -3258, -3048, -2947, -2721,
-    -2482, -2873, -2901, -2412, -2659, -2421, -2525, -2851, -3462, -3740, -3650, -3947,
-    -4132, -3822, -3477, -2994, -3388, -3446, -3518, -3438, -3900, -3749, -3485, -4274,
-    -4739, -4711, -5016, -5027, -5047, -4805, -4456, -4432, -4880, -4888, -4188, -4393,
-    -4288, -4282, -3506, -3191, -3397, -3188, -3637, -3568, -3427, -4037, -4613, -4671,
-    -4557, -4254, -4499, -4419, -4277, -3873, -3629, -3159, -2845, -2800, -3268, -3401,
-    -3469, -3514, -3717, -4186, -3995, -3525, -3325, -3210, -2567, -2596, -2541, -2547,
-    -2832, -3328, -3157, -2945, -2805, -2872, -2335, -2156, -2206, -2309, -2260, -2092,
-    -2128, -2589, -2269, -1886, -1761, -1726, -1569, -1370, -1281, -768, -917, -571,
-    -861, -1258, -783, -972, -994, -1235, -971, -836, -1063, -563, -769, -912,
-    -1207, -992, -524, -432, 347, 716, 554, 730, 884, 944, 801, 660,
-    83, 413, -28, 316, 826, 566, 689, 1121, 1347, 1387, 1258, 1340,
-    1514, 1397, 1483, 1445, 894, 1000, 1033, 1053, 1504, 977, 1339, 1858,
-    2049, 1631, 1330, 1771, 2202, 1990, 1820, 1999, 2100, 2562, 2316, 2268,
-    2491, 2397, 2116, 1946, 1938, 1584, 1807, 2053, 1847, 2182, 2504, 2052,
-    2410, 3259, 3140, 2920, 3252, 3278, 3031, 2700, 3058, 2872, 2851, 2858,
-    3317, 3798, 3607, 3654, 3421, 3045, 2626, 2848, 2874, 3008, 3075, 3421,
-    3440, 3045, 2465, 2334, 1901, 2233, 2388, 2690, 2807, 2919, 2717, 2702,
-    3203, 2780, 3363, 3779, 3614, 3246, 2916, 2705, 2914, 2580, 2748, 2884,
-    2950, 2940, 3636, 3513, 3114, 2922, 2789, 3101, 2903, 2885, 3147, 3769,
-    3809, 3735, 3489, 3196, 3047, 3370, 3313, 3186, 3218, 3474, 3575, 3255,
-    3108, 3233, 3139, 3094, 3433, 3654, 3102, 2813, 2266, 2131, 1840, 1894,
-    1855, 1903, 2037, 1699, 2427, 2646, 2032, 1682, 1031, 1492, 1831, 1630,
-    1896, 2438, 2164, 2023, 2126, 1899, 1740, 1373, 1595, 1143, 1107, 1142,
-    1217, 951, 603, 644, 1023, 1382, 1082, 1374, 1334, 881, 412, 698,
-    352, 588, 904, 691, 493, -81, -41, 629, 210, 183, 307, -388,
-    -740, -174, -54, -220, -771, -710, -645, -662, -445, -815, -1016, -969,
-    -600, -159, -107, -235, -562, -679, -435, -821, -1087, -1189, -1163, -879,
-    -972, -821, -674, -867, -820, -1428, -2146, -2264, -1667, -2001, -2217, -2429,
-    -2434, -2212, -1931, -1551, -1533, -1290, -1101, -1019, -1272, -2111, -1854, -1179,
-    -1458, -1755, -1629, -1344, -1475, -1470, -1277, -1925, -1984, -1591, -2142, -2341,
-    -2446, -3038, -2986, -3255, -3066, -3079, -2937, -2988, -2622, -2575, -2243, -1870,
-    -2225, -2350, -2544, -2437, -2200, -2105, -2020, -2065, -2163, -2223, -2131, -2104,
-    -2631, -2598, -2543, -3104, -2999, -2857, -2882, -2851, -3028, -3465, -3706, -3284,
-    -2870, -2424, -2187, -2417, -2589, -2404, -2263, -1576, -1618, -2081, -1802, -1852,
-    -2046, -2152, -2807, -3195, -2767, -2412, -2471, -2671, -2528, -2316, -2585, -2668,
-    -2636, -2976, -3048, -2986, -2695, -2657, -2533, -2425, -2219, -2591, -2680, -2479,
-    -2381, -2416, -2909, -2809, -2665, -2083, -2310, -2359, -2027, -1814, -1645, -1870,
-    -1722, -1972, -2152, -1765, -2068, -2190, -1781, -1783, -1898, -1480, -1777, -1908,
-    -1737, -1395, -1464, -1087, -1239, -997, -834, -1287, -1357, -1135, -1158, -1760,
-    -1798, -1440, -1394, -1321, -1339, -954, -1010, -1225, -627, -741, -974, -979,
-    -1148, -648, -658, -1004, -813, -836, -878, -398, -375, -354, -247, -687,
-    -218, 208, 373, 453, 22, -755, -472, -635, -668, -916, -551, -43,
-    203, 455, 233, -44, -126, 523, 849, 622, 738, 872, 926, 1048,
-    1122, 1163, 1486, 1521, 1395, 1304, 994, 1020, 1224, 1090, 1175, 542,
-    658, 680, 1169, 1655, 1926, 1373, 1314, 1533, 1797, 2064, 2305, 2123,
-    1866, 2078, 1625, 1746, 1546, 1767, 2025, 2283, 1796, 1381, 2508, 2546,
-    2382, 2540, 2278, 2233, 2667, 2523, 1875, 1993, 2530, 2521, 2207, 2094,
-    1825, 2319, 2389, 2638, 2497, 2526, 2399, 2355, 2543, 2646, 2732, 2981,
-    2952, 2968, 3241, 3006, 2989, 2773, 2534, 2984, 2740, 2700, 2609, 2579,
-    2965, 2883, 2798, 2732, 2804, 3186, 3513, 3714, 2897, 2836, 3317, 3223,
-    3030, 2432, 2400, 3023, 3173, 3249, 3358, 3577, 3683, 3275, 2854, 3136,
-    2681, 2588, 3121, 2246, 2141, 1909, 2118, 1607, 2029, 2746, 2999, 3404,
-    3334, 3505, 3295, 3659, 3731, 3164, 2944, 3291, 2956, 2510, 2475, 2597,
-    2902, 2571, 2240, 2090, 2463, 2527, 2375, 2631, 2759, 2977, 2331, 1858,
-    1827, 1941, 1732, 1821, 1372, 1417, 1551, 1563, 1568, 1049, 946, 653,
-    958, 902, 1096, 1276, 1426, 1747, 1744, 1696, 1996, 2637, 2678, 1822,
-    1610, 1534, 1440, 807, 131, 407, 782, 1279, 1790, 1438, 1415, 1532,
-    1430, 1217, 985, 935, 1069, 1342, 1080, 835, 713, 674, 271, 235,
-    -515, -673, -257, -293, -385, -357, -462, -656, -750, -1154, -799, -780,
-    -392, -659, -537, 3, 193, -82, -165, -530, -129, 1016, 1237, 1502,
-    1143, -283, -886, -821, -228, 394, 472, 994, 1185, 341, -1254, -2315,
-    -3262, -3746, -3387, -3431, -2596, -2129, -1253, -1362, -1531, -1285, -282, 252,
-    676, 845, 265, -284, -783, -1469, -2054, -3259, -3180, -2492, -2019, -1883,
-    -2841, -3131, -3113, -2356, -1716, -1415, -678, -227, 524, 496, -464, -424,
-    -437, -357, -745, -2449, -2938, -1800, -1173, -446, -535, -953, -1052, -1069,
-    -1740, -2258, -3010, -2526, -2458, -3056, -3613, -3942, -4581, -4294, -2541, -2110,
-    -1644, -1613, -2298, -2515, -2399, -1929, -1539, -990, -224, 356, -24, -498,
-    -786, -432, -1034, -1345, -1280, -2105, -3310, -3486, -2710, -2192, -1598, -1885,
-    -2431, -2585, -2897, -3567, -3460, -3648, -3472, -3464, -3377, -3450, -3907, -4258,
-    -4254, -3086, -2396, -2855, -2908, -3110, -3080, -2556, -1868, -798, -529, -264,
-    -137, -170, -1077, -1599, -1659, -2043, -2012, -1441, -2503, -2998, -2890, -2596,
-    -1872, -1680, -2175, -2768, -3114, -3422, -4314, -3894, -3860, -3851, -4039, -3369,
-    -3321, -3683, -3908, -2804, -1751, -1715, -2759, -2891, -2413, -2459, -1823, -1491,
-    -1242, -716, -392, -541, -1059, -1114, -1401, -2472, -3092, -2796, -2619, -2979,
-    -3276, -2608, -1741, -1486, -1274, -1466, -1417, -1749, -2053, -2067, -2848, -3310,
-    -2987, -3074, -2816, -3338, -2969, -1393, -1110, -1257, -1425, -1678, -1810, -1264,
-    -911, -421, -396, 213, 973, 643, 686, -102, -495, -561, -619, -158,
-    -351, -1262, -2034, -1937, -1210, -311, -218, -533, -465, -141, -305, -702,
-    -967, -1739, -918, -836, -690, -1265, -1031, 217, 343, 901, 1076, -492,
-    -1006, -540, -137, 1764, 3107, 3354, 2753, 1274, 185, -246, -205, 59,
-    417, 529, 917, 580, 1340, -36, -360, 171, 999, 2310, 2976, 3318,
-    3177, 1763, 525, -267, -230, -200, -725, 665, 1442, 1486, 1352, 938,
-    1182, 1331, 1355, 1629, 2509, 2869, 3476, 3718, 3168, 2875, 2814, 2256,
-    2282, 1834, 609, 889, 1876, 2661, 2541, 2574, 2552, 2535, 2923, 2604,
-    2160, 1876, 1602, 1547, 1507, 1021, 1792, 1124, 1206, 2626, 3331, 2687,
-    2254, 2425, 2169, 2116, 2790, 3142, 3505, 4103, 4393, 4266, 4085, 3703,
-    3310, 3340, 3762, 2578, 1567, 1164, 1558, 1938, 2094, 2404, 2535, 2342,
-    2453, 2358, 1641, 1538, 1743, 1398, 1627, 1651, 1719, 1360, 508, 936,
-    1651, 2339, 2371, 2166, 2066, 2615, 2328, 2923, 3375, 4051, 4289, 4501,
-    4986, 4094, 4127, 3388, 2761, 2960, 2038, 1386, 1279, 1764, 2828, 3112,
-    3046, 2651, 2085, 2250, 1522, 1232, 851, 1251, 1568, 635, 1084, 1326,
-    1401, 1096, 2056, 2398, 1995, 1967, 1652, 1437, 1515, 1470, 2416, 3482,
-    3914, 3776, 3386, 2923, 3305, 2875, 2488, 1743, 1423, 1524, 1138, 1076,
-    1234, 1746, 2723, 2541, 2013, 913, 536, 179, -129, -9, -290, -702,
-    -705, -588, -754, -1323, -772, 138, 885, 330, 298, 471, 474, 823,
-    972, 1216, 1832, 1585, 1340, 1481, 988, 839, 1068, 923, 98, -515,
-    -1433, -852, -166, 397, -184, -306, 0, -160, -1057, -1478, -944, -1244,
-    -1177, -1010, -981, -1221, -2447, -1934, -1084, -914, -593, -2451, -2489, -1227,
-    -1235, -249, 1325, 1566, 1311, 283, -616, -1231, -1689, -2411, -2452, -1693,
-    -2024, -2071, -1392, -1938, -3195, -2023, -1345, -1325, -1332, -1570, -1933, -1742,
-    -1677, -2008, -2151, -1773, -2439, -2329, -1627, -1760, -2428, -2426, -3019, -2735,
-    -2826, -2297, -1092, -911, -436, -435, -1202, -780, -740, -1626, -1811, -1379,
-    -2669, -3486, -3253, -2629, -1930, -1145, -1205, -1811, -1919, -1749, -2547, -2496,
-    -2413, -3080, -2712, -2480, -2521, -2854, -2510, -2204, -1570, -1567, -2047, -2010,
-    -1917, -1877, -1417, -935, -752, -621, -630, 67, 83, -9, -529, -1076,
-    -1971, -1777, -2489, -4019, -3444, -2384, -1721, -927, -987, -1554, -1466, -1799,
-    -2384, -2409, -2919, -2898, -2952, -2820, -2946, -1942, -1925, -1791, -2120, -1686,
-    -1278, -1655, -2466, -2555, -1850, -1633, -233, 169, 604, 546, 258, -7,
-    -206, -992, -2107, -2150, -2024, -2376, -2971, -2806, -2401, -1298, -1843, -1474,
-    -1253, -1131, -1657, -2858, -3495, -3746, -3403, -2445, -2437, -2223, -1832, -1973,
-    -1354, -1281, -1489, -1800, -1639, -1725, -1332, -983, -332, 106, 411, 591,
-    712, 1156, 597, -101, -536, -719, -584, 37, -675, -1264, -1575, -1278,
-    -600, -367, -90, 298, 575, 558, -894, -2075, -2712, -2918, -2979, -2663,
-    -2376, -2082, -1665, -1006, -1328, -1342, -1733, -1318, -1219, -255, 256, 1009,
-    1198, 2159, 2179, 2259, 1769, 1646, 1916, 1895, 1531, 1217, 1075, 420,
-    434, 391, 1316, 2162, 1667, 1438, 1128, 1057, 318, 146, -204, -918,
-    -1100, -532, -1014, -1616, -891, -665, -29, -349, -1230, -1183, 365, 1064,
-    2690, 4168, 4166, 3267, 2421, 1477, 667, 436, 503, 1009, 1842, 1298,
-    1468, 2668, 2200, 1685, 2613, 3325, 2768, 2285, 2131, 1626, 1344, 1425,
-    506, 311, 472, 157, 548, 1145, 1069, 72, -460, -457, 91, 899,
-    1777, 2636, 3485, 3566, 3681, 3491, 3110, 2897, 2701, 2655, 2437, 1381,
-    360, 425, 1038, 2018, 2881, 3274, 3386, 2988, 2720, 2289, 1893, 1476,
-    1391, 1046, 736, 587, 451, 796, 1732, 2446, 2834, 2882, 2387, 1906,
-    1667, 2151, 2788, 2794, 3455, 4136, 3747, 3481, 3848, 3679, 2901, 2635,
-    3156, 1917, 1002, 732, 1059, 1916, 2272, 2462, 2176, 1795, 1312, 608,
-    725, 1239, 886, 523, 166, 860, 1510, 1404, 1432, 2304, 2137, 813,
-    700, 1060, 1584, 2528, 3754, 4454, 4753, 4968, 4135, 3603, 3105, 2644,
-    2330, 1560, 1520, 1174, 262, 237, 497, 940, 1098, 1690, 1644, 837,
-    356, 188, -110, -314, -287, 343, 696, 99, 291, 754, 882, 1431,
-    1790, 2100, 2173, 1639, 1703, 1418, 1562, 1943, 2458, 3232, 3850, 3516,
-    2822, 2829, 2945, 2230, 1458, 566, -176, -269, 32, 423, 1206, 1527,
-    1199, 1537, 1352, 782, -41, -737, -1291, -1896, -1697, -1860, -2113, -1350,
-    -1016, -893, -170, 407, 94, -581, -239, 68, -221, -321, 398, 1310,
-    2485, 2363, 2328, 2257, 1621, 724, 134, 286, 190, 769, 946, 641,
-    1440, 1304, 1036, 823, 25, -887, -1885, -1964, -1571, -1274, -1626, -1846,
-    -2214, -3044, -2388, -1114, -1533, -1334, -2742, -3791, -3183, -2373, 92, 1719,
-    1618, 1094, 341, -62, -579, -972, -645, -560, -501, -336, -654, 267,
-    -142, -1702, -922, 589, 1126, 862, 509, 30, -676, -1645, -2597, -2308,
-    -2348, -3457, -3865, -2493, -2149, -2549, -3221, -3579, -2919, -2664, -1911, -1546,
-    -1387, -1150, -685, -138, -42, 121, -304, -332, -291, -1892, -1881, -1486,
-    -1320, -663, -391, -42, 167, -210, -964, -1243, -1559, -1905, -2626, -3275,
-    -2864, -2602, -2516, -2962, -2853, -1268, -703, -1004, -1647, -2891, -2936, -2990,
-    -2081, -975, -296, -337, -77, 284, 293, 891, 220, -472, -857, -2036,
-    -2295, -2052, -1522, -1164, -772, -276, -823, -1614, -2189, -2099, -2256, -2268,
-    -2345, -2989, -2988, -2920, -2868, -2565, -2452, -998, -740, -936, -1220, -1926,
-    -1669, -1853, -1370, -334, -39, -62, -41, 137, 168, 331, 278, -274,
-    -673, -374, -1298, -2031, -2465, -2411, -2148, -1923, -1757, -1846, -2292, -2992,
-    -2990, -2999, -2836, -2387, -2479, -2098, -1943, -2183, -1542, -90, 459, 321,
-    -252, -362, -539, -1143, -710, -399, 47, 705, 1322, 1360, 1713, 1284,
-    975, 888, 72, -493, -1085, -1987, -2950, -2553, -1511, -997, 14, 628,
-    -65, -947, -1701, -2361, -3227, -3833, -3117, -2530, -2378, -1330, -600, -263,
-    -186, -434, -59, -544, -440, 70, 260, 453, 1091, 1508, 1635, 1870,
-    2130, 1989, 1501, 1245, 1134, 867, 351, 190, 145, 583, 201, -98,
-    352, 491, 29, -157, -882, -1046, -1280, -1459, -1859, -1762, -404, -400,
-    -425, 70, 37, -137, -922, -1738, -1183, -120, 1764, 2914, 3147, 2618,
-    1941, 1494, 1170, 1503, 854, 1134, 1413, 1564, 999, 1226, 998, 346,
-    -120, 46, 1149, 1579, 1195, 758, 351, 142, 193, -266, -825, -1124,
-    -432, 714, 1118, 464, -73, -110, -28, 313, 536, 446, 1170, 1645,
-    1659, 1457, 1565, 1712, 1732, 2312, 2461, 2548, 2098, 2431, 2265, 1870,
-    1075, 766, 971, 1008, 1521, 1082, 1076, 810, 505, 304, 511, 867,
-    1594, 1235, 1144, 1099, 576, 10, 233, 918, 1010, 1563, 1734, 1831,
-    1867, 2161, 2175, 2014, 2558, 1840, 1125, 1051, 1164, 1439, 2071, 2560,
-    2566, 2730, 2736, 2422, 2259, 1908, 2056, 2176, 2533, 2486, 2789, 2568,
-    2312, 2122, 2193, 2320, 2434, 2192, 1411, 1353, 1302, 1527, 1266, 837,
-    1057, 1451, 1577, 1302, 1196, 1745, 2243, 2305, 2226, 2292, 1805, 1375,
-    971, 521, 212, 3, 295, 454, 560, 809, 852, 367, 639, 773,
-    853, 1051, 980, 1057, 799, 1465, 1643, 1967, 1701, 1326, 1808, 1920,
-    1502, 1580, 1636, 1341, 1408, 1428, 1748, 1674, 1583, 1504, 1281, 1589,
-    1581, 1066, 938, 503, 231, 582, 351, 100, 541, 251, -66, -369,
-    -98, -157, -507, -211, -175, 66, 450, 883, 1092, 1433, 586, 44,
-    35, -308, -420, 2, 613, 731, 699, 868, 1114, 1882, 2076, 1313,
-    957, 850, 1066, 1023, 1304, 610, 117, 286, 520, 60, -149, -314,
-    -330, 181, 866, 791, 358, -412, -872, -878, -983, -1273, -674, -350,
-    -776, -919, -1032, -910, -905, -286, 30, 193, 588, 304, 440, -24,
-    -15, 140, 300, 262, 59, -78, -362, -704, -496, -537, -719, -516,
-    -451, -314, -905, -974, -606, -752, -1068, -1255, -1864, -1723, -1341, -806,
-    -701, -109, -148, -540, -1027, -807, -1170, -1083, -703, -435, -372, -658,
-    -340, -315, -44, -223, -352, -449, -135, -637, -1252, -1552, -1543, -1662,
-    -1690, -1075, -338, -190, -990, -771, -401, -198, -418, -681, -1390, -1666,
-    -1072, -997, -1233, -1484, -1603, -1503, -1387, -1704, -1583, -1730, -1576, -1697,
-    -1801, -1668, -2204, -2277, -1921, -1996, -2075, -1649, -860, -812, -868, -526,
-    -382, -287, -623, -845, -987, -758, -529, -255, -31, 137, -265, -415,
-    -492, -103, -118, -487, -809, -1517, -1917, -1967, -2322, -2476, -2447, -2210,
-    -2053, -1363, -600, -750, -471, -662, -484, -508, -1399, -1829, -1853, -2022,
-    -2080, -2052, -1975, -2043, -2164, -1744, -1389, -1533, -1691, -1075, -721, -840,
-    -1326, -1363, -936, -1088, -752, -505, -603, -726, -299, -636, -914, -729,
-    -883, -887, -631, -647, -793, -737, -244, -160, -271, -940, -659, 25,
-    -273, -1260, -1567, -1896, -1730, -1899, -1942, -1944, -1715, -1800, -1585, -1124,
-    -1031, -886, -363, -671, -1253, -1346, -1061, -898, -534, -259, -681, -1188,
-    -586, -717, -845, -575, -199, -317, -213, 195, -296, -766, -1019, -671,
-    -394, -99, -288, -33, 265, -102, -355, 41, 96, 131, -193, -51,
-    166, 189, -306, -628, -1108, -1401, -1523, -927, -530, -607, -423, -539,
-    -616, -889, -1152, -442, -161, -516, -417, 130, 274, 738, 540, 619,
-    613, 913, 569, 447, -44, -210, -35, -320, -788, -686, -350, -266,
-    -209, -340, -289, -173, 193, 312, -96, -125, 188, 602, 565, 514,
-    568, -20, -407, -128, 33, 328, 603, 805, 1055, 1145, 1012, 1226,
-    1518, 1364, 862, 690, 1002, 1373, 999, 888, 461, 42, 220, 244,
-    373, 359, 543, 885, 818, 402, 535, 734, 418, 916, 815, 672,
-    467, 681, 393, 84, 220, 355, 252, 136, 222, 347, 574, 881,
-    1262, 1191, 941, 906, 815, 693, 969, 1286, 1456, 1237, 1050, 838,
-    1076, 1224, 1013, 1153, 1522, 1696, 1601, 1701, 1785, 1639, 1464, 1059,
-    819, 771, 873, 1032, 1006, 526, 768, 790, 736, 704, 985, 1123,
-    1385, 1531, 1803, 1201, 1097, 902, 699, 424, 436, 248, 188, 264,
-    40, 4, 352, 467, 625, 904, 978, 895, 826, 903, 713, 995,
-    988, 1015, 1254, 1559, 1548, 1537, 1355, 1294, 1551, 1308, 1071, 1376,
-    1437, 1277, 1124, 1059, 1361, 901, 1037, 1434, 883, 947, 1462, 1241,
-    588, -72, -533, -602, -58, 49, 215, 505, 660, 379, 455, 348,
-    521, 928, 1114, 748, 515, 420, 407, 392, 281, 205, 19, 14,
-    80, 36, 116, 284, 615, 767, 456, 339, 381, 290, 340, 141,
-    217, 668, 891, 1018, 853, 904, 985, 1131, 938, 753, 637, 801,
-    454, 136, 394, 253, -7, -220, -155, -348, -350, 74, -429, -761,
-    -702, -773, -757, -362, -26, 21, 47, 147, 301, 495, 522, 529,
-    -16, -108, -235, -356, -407, -461, -641, -732, -585, -220, -185, -167,
-    -339, -377, -567, -550, -406, -155, -455, -823, -693, -492, -253, 29,
-    272, 191, -21, 52, 149, 247, 389, 486, 294, 95, -81, 77,
-    146, -142, -275, -76, 81, 192, 114, -165, -67, -148, -312, -190,
-    62, -358, -150, 42, -119, -447, -101, -87, -241, -507, -730, -589,
-    -416, -559, -844, -1172, -1453, -1036, -1109, -1152, -951, -1097, -1306, -1200,
-    -1230, -924, -752, -506, -601, -496, -460, -363, -36, 296, 223, 171,
-    289, 257, 279, 319, 88, -267, -571, -557, -211, -242, -304, -553,
-    -508, -702, -507, -349, -833, -896, -718, -813, -865, -511, -748, -523,
-    -759, -493, -267, -201, -512, -736, -839, -883, -826, -1146, -1436, -1519,
-    -1585, -1397, -1306, -1463, -1159, -914, -1263, -1386, -1344, -899, -687, -883,
-    -892, -510, -164, 54, 105, 212, -29, -52, -278, -205, -222, -163,
-    165, 215, 31, -401, -472, -661, -771, -639, -983, -894, -504, -511,
-    -776, -1309, -1412, -1189, -1326, -1183, -1409, -1289, -906, -376, -476, -571,
-    -724, -810, -873, -700, -793, -803, -487, -681, -759, -888, -915, -982,
-    -854, -284, -168, -102, -614, -828, -863, -1128, -1310, -1121, -625, -326,
-    -305, -260, 290, 336, 327, 245, 135, -115, -151, -415, -656, -846,
-    -631, -687, -725, -598, -475, -371, -322, -276, -345, -508, -776, -830,
-    -851, -613, -174, -64, 237, 143, 104, 358, 165, 177, 73, -616,
-    -91, -73, -475, -508, -502, -791, -700, -609, -478, -473, -352, 74,
-    -257, -304, -376, -288, -211, -209, -470, -142, 176, 452, 642, 816,
-    586, 287, 55, 213, 213, 174, -35, 26, 1, 328, 546, 717,
-    619, 712, 900, 1062, 998, 527, 620, 624, 391, 76, 120, 31,
-    549, 514, 231, 350, 874, 641, 359, 519, 437, 607, 384, 81,
-    -68, -94, -143, -685, -249, -148, -312, 71, 176, 250, 145, 196,
-    310, 1, 330, 746, 905, 1062, 1530, 1740, 1708, 1834, 1626, 1729,
-    1346, 1193, 1015, 1056, 1165, 940, 766, 536, 829, 1085, 949, 1131,
-    1049, 920, 1061, 654, 99, 26, 414, 453, 484, 273, 771, 1267,
-    1036, 537, 651, 633, 396, 502, 325, 135, 228, 0, 44, 46,
-    216, 381, 496, 547, 429, 26, 53, 532, 791, 805, 994, 976,
-    1392, 1546, 1167, 1394, 1646, 1765, 1536, 1275, 1370, 1030, 1243, 1101,
-    1031, 1503, 1802, 1501, 802, 539, 995, 1088, 1281, 1240, 379, 418,
-    640, 212, -59, -91, 329, 309, -120, 68, 422, 480, 433, 435,
-    178, 115, 123, 373, 72, 592, 684, 241, 224, 271, 793, 470,
-    -75, 367, 131, 590, 602, 452, -158, -31, 255, 490, 639, 765,
-    953, 1077, 877, 398, 607, 210, 1020, 843, 286, -1, 431, -81,
-    493, 19, -81, 286, 405, 572, 32, 160, 565, 1062, -44, -697,
-    338, 655, 970, 1238, 711, 675, 1317, 1078, 109, 286, 272, -670,
-    -90, -201, -994, -178, -306, -375, -623, -212, -555, -1181, -275, -867,
-    508, 422, -721, 688, 1309, 566, 488, 237, 1079, 671, 527, -48,
-    -230, 384, 359, -568, 286, -162, 605, 623, 899, -212, 173, 225,
-    402, 220, 350, 144, 490, 537, -592, -989, -285, -959, -189, -582,
-    -1390, -354, -431, -672, -18, 26, -481, 198, 527, -729, -419, -33,
-    -1253, -1591, -976, -1394, -935, -425, -1127, -895, -996, 136, -284, -721,
-    93, -883, -1972, -27, 1638, 932, 404, 265, 40, 509, 22, -1082,
-    22, -145, -1075, -843, -163, -458, -930, 539, 25, 96, 356, 575,
-    -289, -196, -837, 172, -490, -552, 453, -297, -117, 22, 204, -236,
-    597, -53, -409, -1192, -120, -1130, -1640, -1197, -93, -2427, -1949, -1276,
-    -1743, -911, -1811, -2362, -1914, -523, -925, -1314, -1290, -1887, -1215, -730,
-    -1117, -934, -1296, -978, -121, -194, -1702, 92, -736, -234, 1073, 709,
-    -596, -748, 271, 819, -31, 1004, -860, -2132, -304, -460, 641, 1566,
-    -935, 46, -353, -1337, -2351, -1974, -3395, -3069, -2602, -2967, -1282, -1178,
-    -1033, -1333, -2094, -1068, 370, 264, -775, -453, 421, -725, -2563, -86,
-    -689, -1373, 700, 1566, 1032, 1348, -37, -1541, -1865, -214, -354, 976,
-    780, 2505, 2160, 373, 1928, 3493, 2122, 2504, 1728, -259, -1134, -750,
-    -392, 235, 1623, 1898, -1187, -331, 308, -360, -898, -2114, -3080, -1216,
-    -467, 712, -1795, 1103, 1889, 385, -53, 598, -133, -648, -15, 1816,
-    2010, 1430, 1559, 2315, 2234, 2776, 1275, 653, 1618, 3124, 2366, 719,
-    -202, -162, -280, 738, 57, 1024, 49, -262, -470, -641, -1491, -1356,
-    -1487, -1645, -1526, -3632, -3026, -1977, -121, 1303, 1847, 1089, -417, -1344,
-    -198, 404, 840, 952, 956, 1265, 413, 1768, 1709, 1991, 2198, 1798,
-    3081, 113, -2234, -1571, -2347, 343, 816, 1116, -589, -2737, -2461, -1931,
-    -2583, -4226, -3028, -3982, -4808, -3349, -2311, -1159, -522, 564, -358, -1021,
-    -2540, -2411, -534, -154, 499, 432, -304, -222, -555, 359, 1822, 1651,
-    -406, -1113, 809, 229, -1744, -975, -517, -1276, 30, -320, -52, -1740,
-    -2635, -842, -507, -1474, -2674, -648, -1006, -1292, -3147, -2574, -586, 1442,
-    1795, -2153, -1804, -618, -1749, -1367, -1529, -1337, -277, 518, 421, 213,
-    890, 116, -153, 483, -271, -1110, -278, -892, -97, -127, 1218, -407,
-    11, 1486, 971, 1228, 1322, -1309, 1, -772, -1478, 1528, 2956, -770,
-    498, 3230, 3493, 2401, -475, -1601, -450, 1234, 623, 2538, 3335, 2380,
-    192, -364, 2278, 2573, -273, -31, 1581, 1533, 1010, 929, 831, 502,
-    387, 1174, 1910, 2241, 838, -34, 1061, 2120, -738, 157, 1049, -975,
-    432, 3532, 1200, -546, 497, 1136, 1433, 1626, 2788, 2402, 1249, 2006,
-    2665, 3486, 4237, 3144, 3068, 3721, 3319, 671, 718, 1513, 3036, 2462,
-    1944, 2041, 2168, 1398, -11, 1030, 627, 703, -204, -1154, 560, 904,
-    -896, -534, 1904, 3631, 1985, 885, -9, 596, 1066, 1749, 2223, 1959,
-    3034, 3427, 3250, 3118, 2795, 3504, 4013, 3494, 4256, 2775, 556, -1000,
-    1380, 3053, 1522, -504, 491, 1130, -373, -1661, -2123, 11, -1245, -1937,
-    -1262, -769, -1871, -2457, -1156, 659, 2033, 2459, 257, -1165, -1600, 101,
-    404, 575, 1814, 2694, 2799, 2436, 2033, 604, 1709, 2122, 1912, 786,
-    -1503, -2691, -2437, -299, -218, 509, -27, -1677, -2572, -2527, -3526, -4295,
-    -3548, -2718, -3756, -2567, -832, -3223, -3915, -648, 1984, -423, -564, -846,
-    -2697, -3591, -1369, 679, 722, 400, 1834, 1530, 732, -1095, 1030, 540,
-    -18, -428, -984, -3263, -2211, 614, -1373, -2242, -1865, -2975, -1711, -2300,
-    -3810, -3465, -2671, -3026, -3013, -2202, -3219, -3041, -1848, -1817, -2839, -2379,
-    -1824, -2564, -2241, -1769, -1847, -2055, -1002, -576, -143, -1650, -1167, -1372,
-    -1475, -460, -298, 251, -2777, -1715, -864, -1648, -1064, -249, -517, -1380,
-    -605, -1011, -2792, -2861, -2173, -1318, -1755, -516, 834, 568, -897, 1555,
-    1787, 983, -519, -100, -515, -1398, 732, 1530, 2463, 2416, 2072, 1280,
-    2018, 122, -121, 199, -70, -1003, -664, 77, 497, 139, -880, 774,
-    1850, 504, -219, -1263, 208, -863, -1471, 410, 771, -1201, -699, 1851,
-    1364, 205, -30, 521, 10, 53, -396, 247, 1917, 2765, 3049, 1910,
-    3553, 2505, 1968, 2283, 2045, 1242, 1846, 273, -181, 676, 1077, -37,
-    1625, 1446, 543, -811, -246, 152, 415, -469, -285, -1259, 1072, -54,
-    -126, 1878, 2243, 1907, 228, -265, -485, -536, 86, 2477, 3618, 2657,
-    1819, 1923, 2993, 2412, 2203, 3384, 3026, 614, 753, 2, 135, 1880,
-    1948, 1734, 886, 782, -836, -957, 1040, 605, -1655, -2679, -3095, -966,
-    -121, -934, -594, -5, 1213, 399, -180, -271, 47, -1065, -1258, -211,
-    1056, 1333, 1281, 1070, 1887, 1329, 1043, 524, 540, 23, -234, -601,
-    -1119, -1140, -903, -201, -1023, -316, -1393, -1677, -1621, -2014, -2711, -3885,
-    -2337, -1518, -848, -2318, -1530, -615, -1485, -1021, -1352, -1707, -1085, -878,
-    848, 355, 1432, 1221, 303, 942, 2271, 1970, 395, 408, 1164, -87,
-    -336, -231, -1595, -1810, -198, -1221, -2660, -1604, -659, -1983, -2448, -3503,
-    -3083, -2868, -2709, -2489, -3014, -2710, -1753, 218, -1131, -2281, -1549, -742,
-    -1252, -944, -348, 294, -431, -243, 332, 1155, 1272, 1672, 1936, 1438,
-    35, 95, 1073, -495, -907, -1192, -1176, -47, -842, -249, -92, -1143,
-    -993, -1603, -670, -2234, -1351, -1306, -873, -322, 762, 1690, 1879, 1205,
-    468, 721, 1353, 1836, 3125, 4640, 4564, 3528, 2237, 1892, 1947, 373,
-    -1156, 136, 1257, 1629, 1533, 2667, 1385, -580, 609, 2379, 2047, 999,
-    1590, 1045, 456, 1340, 637, 171, 203, -155, -247, 899, -62, 292,
-    336, 408, 830, 1171, 1872, 2164, 2847, 4096, 3294, 3494, 3011, 3440,
-    4459, 3328, 1609, 2214, 2395, 1305, 1820, 1636, 1925, 2435, 1865, 1829,
-    720, 260, 830, 2071, 1252, -22, -728, 124, 380, 743, 641, 1848,
-    1490, 1268, 1419, 683, 37, 2267, 1451, 1083, 2421, 3558, 2549, 2311,
-    2918, 2987, 1053, 1226, 2461, 2281, -357, -278, 1114, 850, 1955, 1056,
-    -193, 636, 868, 253, -775, -814, -391, -1231, -2879, -868, 348, -315,
-    -1721, 184, 197, -2, -479, -996, -2074, -1931, -216, 1424, 71, -416,
-    69, 626, -143, -664, 71, -1117, -1828, -286, 1340, -1618, -3872, -668,
-    37, 123, -1169, -1171, -1779, -2709, -2629, -2854, -2446, -3370, -3796, -2040,
-    -2610, -2264, -1489, -998, -243, -371, -1413, -1952, -1857, -1114, -882, -836,
-    617, 1783, 1276, 1713, 802, 59, 330, -620, 193, -201, -1572, -798,
-    -1223, -1777, -910, -46, -1183, -1395, -672, -1948, -1135, -1459, -3081, -3514,
-    -3559, -2471, -1695, -2414, -4094, -2531, -845, -1223, -2058, -1923, -1978, -2016,
-    -2346, -1642, -1628, -411, 566, -919, -363, 959, 193, -710, 966, 882,
-    -481, -107, -404, -1281, -820, 257, -482, -1351, -2523, -2040, -1132, -1236,
-    -1800, -1556, -2018, -1139, 37, -1119, -2187, 414, 1020, 717, 2298, -180,
-    -610, 1365, 1775, 2310, 2863, 3438, 3378, 1963, 1718, 578, 289, 1419,
-    1340, 1801, 1667, 1509, 2302, 2227, 279, -108, 772, 1478, 920, -378,
-    867, 109, -218, -1566, -2469, -1512, -1019, -1897, -101, 1287, -195, -750,
-    -1291, -398, -1381, 763, 2763, 1903, 2027, 3125, 3284, 3275, 3070, 2399,
-    2525, 3072, 2401, 1855, 426, 1567, 1760, 2395, 1387, 1494, 358, -199,
-    -783, -1479, -701, -1129, -2644, -1865, -2056, -1332, -747, 751, 1487, 1081,
-    577, -749, -6, 29, 763, 2166, 2486, 2595, 2508, 3033, 3982, 4133,
-    2602, 2217, 2296, 1723, 515, 978, 899, 977, 1760, 1201, 271, -19,
-    571, -2087, -1597, -787, -1230, -2481, -2455, -3248, -2144, -1043, -1612, -1911,
-    -52, 39, -739, -971, 314, -1414, -1283, -1003, -843, 479, 641, -739,
-    250, -198, 1329, 736, -320, -1635, -1769, -692, -1067, -2258, -1596, -2002,
-    -2182, -1138, -1955, -2543, -2149, -2898, -3542, -2688, -3121, -3611, -2574, -1201,
-    -2569, -1705, 10, -34, -4, -479, -1402, -868, -986, -34, -21, 1772,
-    1519, 1740, 1673, 681, 468, -319, 863, -496, -264, -777, -1040, -2098,
-    -955, -731, -966, -1586, -1303, -622, -1870, -2841, -2188, -3096, -3212, -3054,
-    -2575, -2028, -1758, -1347, -1386, -1032, -536, -1372, -1591, -2050, -2140, -1165,
-    -362, -346, 756, 836, 529, 1131, 366, -627, 333, 138, -179, -66,
-    -682, -594, -365, -895, 103, -89, -351, -498, -759, 154, -1123, -1582,
-    -2492, -860, -782, 38, -424, -534, 910, 1152, 1194, 778, 551, 420,
-    455, 1596, 3465, 4200, 3915, 2436, 2225, 1896, 793, 963, 1910, 1478,
-    2220, 2764, 1642, 1857, 2190, 2111, 2050, 1870, 2275, 1654, 1033, 302,
-    479, 1066, 244, -118, -86, -219, 236, 1287, -307, -1029, -1510, 997,
-    758, 474, 879, 529, 1488, 2783, 2737, 3004, 2061, 1491, 1359, 2751,
-    1935, 1745, 1787, 1260, 1902, 2134, 1641, 1058, 515, 1012, 1346, 481,
-    -509, 88, 192, -165, 801, -149, 272, -600, 340, 313, 446, 1183,
-    1081, 1105, 1550, 637, 794, 1015, 1372, 2616, 1935, 1373, 1648, 958,
-    976, 1204, 1941, 1460, 1223, 1593, 1767, 380, 193, 659, 1209, 1323,
-    340, -25, -156, 70, 22, -526, -418, 559, 7, -811, -988, -1014,
-    -699, -1001, -1882, -1410, -882, -990, -1138, -306, -799, -2021, -806, -1267,
-    -2226, -2082, -1783, -1865, -2588, -2103, -397, -1866, -1624, -401, -1172, -824,
-    -1512, -1047, -588, -1702, -2149, -1000, -957, -1042, -1276, -1672, -436, -677,
-    -820, -834, -789, -1084, -236, -774, -1732, -938, -96, 685, -94, -724,
-    -483, -15, -640, -1239, -888, -962, -466, -760, -781, -289, -507, -653,
-    -1158, -1298, -815, -1149, -639, -529, -1367, -857, -892, -533, -623, -1365,
-    -675, -1974, -1974, -1826, -1662, -892, -563, -356, -895, -1154, -50, -628,
-    -756, -764, -646, -353, -942, -499, -932, -737, -765, -1027, -1366, -384,
-    -117, 232, -226, -463, -533, -517, -1125, 186, -262, -1052, -691, -699,
-    135, 1021, 243, 56, 454, 477, 1090, 1503, 1096, 1591, 1609, 1951,
-    2243, 1336, 934, 1157, 1691, 1525, 1011, -89, 725, 831, 66, 178,
-    131, 608, 1310, 535, 818, 890, 395, 373, 339, 840, 1080, 757,
-    407, 583, 1058, 787, 546, 947, 1021, 922, 893, 1951, 1504, 467,
-    1029, 1606, 1696, 1718, 1412, 569, 376, -159, 286, 435, -37, 239,
-    -174, 198, 124, 544, 183, 440, 168, 944, 1124, 132, 238, -72,
-    76, 617, 251, -46, 53, 235, 245, 1141, 301, -148, -119, 369,
-    993, 1444, 1141, 517, 1245, 1153, 254, 398, 1057, 1178, 751, 399,
-    435, 630, 333, 411, 965, 990, 634, 601, 421, 491, 978, 788,
-    876, 404, 27, 34, 165, -329, -104, 12, -512, -1351, -1058, -445,
-    -692, -1088, -287, -87, -874, -1481, -1761, -2231, -2191, -2230, -1894, -1476,
-    -1720, -1892, -2146, -1840, -1531, -2272, -1765, -777, -696, -1061, -1187, -793,
-    -735, -996, -815, -416, -540, -171, -402, -1148, -812, -1123, -956, -388,
-    -258, -112, -278, -171, -372, -143, -816, -267, 10, -35, -326, 240,
-    -280, -986, -1373, -857, -1092, -957, -910, -231, -406, -640, -34, 163,
-    -527, -823, -1412, -1046, -401, -1013, -760, -1083, -1490, -755, -1173, -1422,
-    -1270, -1179, -757, -745, -1245, -1042, -811, -848, -924, -401, -10, -289,
-    -1014, -243, -425, -1197, -1106, -460, -571, -1083, -484, 210, 297, -330,
-    -422, -898, -594, -241, -9, -482, -654, -876, -468, 577, 271, -188,
-    -741, -663, -510, -156, 943, 892, 784, 1501, 2149, 1497, 1573, 2470,
-    1980, 1985, 1494, 2137, 2157, 1601, 949, 1758, 1112, 1158, 2236, 1791,
-    1246, 1199, 1675, 1312, 550, 697, 348, 31, 52, 474, 528, 106,
-    -302, 204, 604, 346, 555, 1226, 793, 132, 492, 544, 1095, 1580,
-    1519, 1549, 1857, 1671, 1324, 1321, 1173, 947, 209, -132, 600, 914,
-    1578, 1015, 796, 643, 642, 1318, 135, -136, -123, 456, 247, 509,
-    1082, 483, -146, -54, -250, -430, -315, 148, 1137, 1467, 1760, 1738,
-    1811, 1614, 1529, 2175, 1820, 849, 1280, 828, 979, 1156, 1460, 1022,
-    955, 591, 1196, 984, 832, 755, 774, 678, 811, 127, 513, 937,
-    -94, -703, -47, 58, -39, -626, -836, -201, 358, -89, -347, -717,
-    -1364, -892, -1522, -1263, -808, -1285, -1567, -940, -761, -1413, -1785, -2304,
-    -2416, -2446, -2322, -1647, -1785, -2320, -1820, -1495, -1210, -1511, -1322, -1118,
-    -883, -717, -940, -956, -678, -154, -461, -935, -685, -122, -369, -179,
-    -193, 74, 340, -46, 192, 158, 140, -893, -1238, -964, -1056, -1014,
-    -988, -1169, -855, -678, -954, -326, -277, -527, -877, -810, -1201, -926,
-    -328, -194, -358, -458, -532, -518, -931, -653, -1296, -1476, -784, -234,
-    -360, -470, -871, -973, -1445, -2114, -1563, -1134, -939, -1090, -1418, -1256,
-    -1178, -1585, -1639, -745, -538, -974, -1518, -656, 104, -512, -151, 158,
-    303, 416, 576, -5, 83, -6, 318, 503, -139, 72, 277, 123,
-    -91, 179, 411, 1200, 993, 991, 1144, 1133, 998, 728, 571, 882,
-    890, 556, 729, 1545, 1649, 1637, 927, 1091, 1690, 1575, 1638, 1271,
-    897, 978, 1008, 1103, 1460, 1532, 1166, 590, 1123, 843, 570, 236,
-    -56, -93, 408, 315, 230, -63, 213, 297, 292, 563, 703, 840,
-    355, -92, -141, 469, 916, 703, 535, 1083, 1003, 874, 632, 795,
-    1173, 860, 989, 897, 430, 515, 236, 868, 748, 550, 175, -230,
-    -189, 401, -182, -285, 44, 261, 303, 704, 1513, 1787, 1155, 583,
-    784, 588, 722, 897, 899, 1155, 848, 984, 1097, 971, 585, 621,
-    647, 466, 429, 578, 370, 415, 406, 870, 424, -37, -60, -534,
-    -582, -674, -700, -1031, -963, -1170, -1040, -1057, -964, -1387, -1235, -1100,
-    -1734, -1688, -966, -1175, -1739, -1490, -685, -1343, -1976, -2239, -1797, -1797,
-    -2175, -2299, -2021, -1487, -1159, -969, -446, -244, -552, -934, -1103, -1321,
-    -733, -877, -901, -185, -238, -891, -725, -802, -510, -324, 105, -153,
-    -223, 299, 523, 296, 198, -203, -543, -595, -298, -145, -414, -282,
-    -297, -371, -802, -511, -718, -698, -1125, -777, -980, -857, -565, -604,
-    -544, -154, 339, 41, -187, -3, -75, -501, -731, -656, -768, -883,
-    -724, -1026, -363, -61, -323, -683, -940, -699, -782, -1041, -1350, -1046,
-    -772, -494, -841, -800, -647, -409, -526, -641, -172, 11, 252, 112,
-    278, -220, -272, 173, 740, 574, 947, 733, 468, 667, 151, 505,
-    1226, 924, 1233, 1467, 1029, 1122, 1418, 1692, 1220, 823, 994, 1168,
-    1340, 1155, 1219, 1197, 1129, 1107, 1145, 1035, 1327, 1652, 1441, 1477,
-    1420, 1734, 1766, 1416, 1801, 1642, 1047, 641, 973, 1215, 673, 513,
-    583, 536, 601, 736, 777, 624, 683, 572, 268, 468, -148, -198,
-    -245, 109, 372, 64, 596, 717, 165, 295, 412, 647, 646, 486,
-    912, 1309, 1252, 1673, 817, 692, 590, 327, 650, 688, 777, 1209,
-    1317, 427, 559, 343, 672, 1176, 998, 763, 1060, 477, 423, 469,
-    360, 410, 418, 922, 680, 237, 549, 77, 192, 797, 701, 879,
-    760, 467, 416, 512, 739, 488, 249, 37, -56, 93, 469, -88,
-    -566, -853, -333, -306, -606, -635, -775, -851, -1065, -1373, -1075, -753,
-    -1076, -1264, -983, -1443, -1969, -2255, -1832, -1679, -1675, -2177, -1896, -1382,
-    -1507, -1599, -1209, -1186, -1335, -1860, -1196, -577, -556, -846, -958, -1068,
-    -1194, -1292, -1434, -790, -760, -1201, -1544, -1295, -991, -939, -540, -514,
-    -277, -245, -850, -731, -782, -695, -435, 94, 365, -377, -948, -671,
-    -470, -108, -225, -323, -209, -239, -403, -373, -669, -672, -505, -555,
-    -384, -480, -1015, -885, -1183, -922, -1744, -1774, -1202, -744, -1033, -1102,
-    -874, -874, -1314, -1465, -804, -66, -51, -477, -326, -144, -336, -338,
-    -43, 301, -481, -685, -521, -280, -174, -286, 52, 431, -44, -102,
-    221, 149, 173, 81, -539, -49, 318, 570, 696, 1058, 962, 967,
-    1259, 1230, 1217, 1134, 1440, 1422, 1552, 1264, 1623, 1687, 1536, 1688,
-    2160, 1963, 1475, 1273, 1376, 1628, 1867, 1831, 1535, 1130, 1412, 1271,
-    1147, 1459, 1473, 1235, 1284, 989, 755, 553, 802, 1109, 1772, 1395,
-    1537, 621, 672, 903, 700, 451, -24, 514, 1292, 469, 865, 777,
-    855, 563, 317, -18, 150, 174, 175, -183, -408, 504, -155, 41,
-    407, -45, 588, 706, 200, -177, -430, -755, -109, -28, 192, 372,
-    88, -138, -187, 499, 1043, -72, 220, 702, 339, 720, 1084, 785,
-    446, 971, 898, 73, -133, -104, 28, 358, 235, -31, 299, 887,
-    614, 144, -365, -155, -14, -30, -215, -20, -195, -220, -836, -1262,
-    -827, -830, -677, -494, -563, -435, -1354, -1555, -1201, -1497, -1670, -2210,
-    -2323, -2424, -2379, -2088, -2340, -3253, -2060, -2627, -2723, -2613, -2629, -2954,
-    -2449, -1821, -1107, -992, -720, -948, -662, -80, -253, -762, -693, 188,
-    -305, -1057, 109, -439, -1139, -1510, -999, -1159, -1730, -2216, -1783, -1983,
-    -2392, -2247, -1318, -184, -445, -1168, -2105, -311, 801, 5, -310, 0,
-    -997, -1114, -951, 818, 1639, 931, 2106, 2751, 1917, 38, -950, -1414,
-    -2571, -2952, -2444, -1312, 262, 324, -1142, -1922, -1570, -459, -824, -1064,
-    -234, -66, -876, -1070, -860, -620, -1563, -2104, -1279, 4, -666, -1455,
-    -1952, -1657, -1409, -352, 519, 934, 1550, 1464, 2453, 2891, 2775, 2099,
-    2812, 3302, 994, 24, 1728, 1720, 919, 1818, 1351, 1452, 843, -118,
-    126, 495, -258, 103, 756, 196, 1144, 65, 1088, 2635, 2905, 3121,
-    1720, 1091, 1782, 1651, 1197, 2584, 3341, 4067, 4422, 4135, 3645, 3825,
-    3321, 2764, 2984, 2067, 734, 935, 943, 1405, 1842, 1807, 2122, 895,
-    234, -662, -1387, -1320, -1786, -1255, -1377, -90, -279, 333, -87, 54,
-    1683, 2261, 535, 359, -56, -195, 802, 690, 1269, 2227, 2440, 1466,
-    1545, 1532, 1953, 1616, -772, -445, 866, -514, -1040, -986, -47, 1529,
-    470, -1114, -777, -46, -622, -1556, -847, -980, -304, 243, 122, -1131,
-    -1004, -624, -234, 1182, -169, -155, -162, -524, 392, 195, 608, 864,
-    674, 362, 739, 863, 773, 543, 704, 80, -550, -291, -1117, -2089,
-    -1683, -1676, -311, -959, -2047, -2089, -1871, -2544, -3926, -3801, -2555, -2891,
-    -4066, -4048, -2796, -3039, -3138, -2135, -2316, -2133, -2563, -2897, -3986, -2532,
-    -1498, -979, -424, -20, 367, 1122, 336, 495, 488, -293, -1306, -989,
-    -1230, -1401, -1534, -702, -161, -1554, -965, -1627, -2181, -1577, -2983, -2447,
-    -2443, -2887, -3147, -1975, -2021, -2081, -327, -739, -167, -1042, -2027, -1849,
-    -901, -280, 1768, 2836, 1853, 2745, 1632, -606, 13, -279, -120, 118,
-    -591, -76, -180, 1312, -862, -1349, -489, -952, -1365, -458, -622, -959,
-    -477, -1010, -1970, -1557, -2007, -2424, -885, -304, -1422, -2129, -516, -1055,
-    -1698, -1157, 620, 1344, 632, 1647, 3504, 4036, 2958, 2458, 2604, 2596,
-    1998, 1337, -293, 316, 1957, 2578, 1515, 762, 697, 192, -664, -655,
-    624, 978, -192, -427, 130, 828, 147, 1206, 2051, 1943, 1718, 1532,
-    1591, 1159, 1164, 1160, 2263, 1767, 3501, 3454, 3660, 4125, 3368, 4216,
-    3580, 3565, 2795, 1095, 1487, 1907, 2897, 2645, 2197, 1736, 1035, 721,
-    -159, -599, -968, -527, -122, -276, 117, 116, 684, 1041, 1688, 2637,
-    2207, 1519, 393, 775, 773, 831, 1956, 2179, 2169, 3004, 3559, 2707,
-    1829, 1203, 1338, 718, 1982, 191, -2083, -171, 1298, 1113, 440, 479,
-    632, -68, -973, -1534, -1268, -1301, -1765, -1285, -425, -639, -114, 171,
-    516, 434, 189, 505, 33, -69, -856, -162, 165, 212, 839, -271,
-    1677, 2631, 1418, 396, -8, -135, 935, 164, -2160, -2367, -624, -176,
-    -1096, -1941, -1669, -2866, -2597, -2698, -2677, -2991, -2942, -2570, -3303, -3459,
-    -2617, -2011, -1408, -2873, -2434, -1039, -1142, -1392, -2939, -3199, -2601, -1011,
-    -764, -931, 336, 372, 30, 575, -264, -261, 316, -837, -1286, -1178,
-    -1236, -848, -238, -746, -1933, -2490, -2154, -2322, -3328, -2986, -3024, -2795,
-    -2130, -1238, -1123, -2394, -1777, -112, -469, -265, -1519, -1917, -1649, -741,
-    418, 2059, 1797, 172, 322, -195, -475, -917, -1848, -474, 103, 484,
-    1039, 930, -706, -1152, -261, -157, -499, 259, 384, 150, -339, -1207,
-    -929, -604, -987, -2157, -1933, -515, -911, -1143, -1716, -2052, -317, 87,
-    556, 1267, 902, 1478, 2471, 2789, 3128, 3580, 2416, 1184, 1473, 1420,
-    955, 1474, 1872, 2366, 2995, 2784, 2287, 670, 929, 642, 365, 818,
-    392, -344, -671, 668, 1611, 579, 1396, 2297, 2374, 1076, 1007, 931,
-    1007, 2010, 1972, 2802, 4074, 3005, 4018, 4106, 3802, 3457, 3908, 2885,
-    2785, 2599, 2517, 1832, 1671, 2455, 1510, 1162, 1270, -542, 76, -465,
-    -353, -1454, -1421, -598, -483, 148, 0, -1121, -239, 1289, 1322, 561,
-    -841, 137, 700, 492, 795, 1478, 1686, 1921, 3422, 1747, 1801, 1793,
-    1208, 1089, 2139, 2106, 954, 195, 1706, 1531, 1516, 1824, 811, -1160,
-    -967, -429, -1588, -2091, -1961, -1218, -1282, -1069, -134, -282, -74, 562,
-    55, -305, -370, -243, -888, -52, 916, 1350, 1776, 2158, 2576, 1429,
-    761, 872, 832, -173, -978, -650, -687, -1992, -3089, -2556, -1790, -1491,
-    -1648, -2618, -3648, -3264, -3876, -4526, -3752, -4256, -3779, -3611, -4278, -3421,
-    -3615, -2667, -2889, -2462, -1627, -2064, -2027, -1733, -685, -757, 99, 2,
-    517, 1336, 319, -711, 85, -133, -1105, -1023, -314, -831, -2055, -1345,
-    -1705, -1556, -1090, -1767, -3695, -3781, -2958, -2006, -2515, -2936, -2659, -1735,
-    -1527, -1796, -1661, -695, -369, 59, -1199, -2451, -2825, -1280, 1514, 2252,
-    1061, 1143, 1847, 936, -356, -303, -655, 373, 947, 631, 267, 1188,
-    485, -231, -780, -1975, -1269, 15, -1769, -1548, -1205, -892, -1432, -2527,
-    -2260, -3376, -2004, -434, -926, -1001, -296, -244, 103, -195, 988, 1562,
-    3486, 2834, 3075, 3522, 3664, 2658, 3114, 2779, 3594, 3665, 1283, 883,
-    2450, 2688, 2221, 2342, 2128, 997, 630, -155, -177, -1140, -300, -418,
-    -953, 170, 522, 1103, 1455, 1100, 1510, 1413, 1204, 890, 1404, 1691,
-    2324, 2629, 2827, 3211, 3443, 4660, 4102, 3251, 3899, 3569, 3060, 2459,
-    974, 2223, 2156, 2648, 2713, 2409, 1335, 1471, 411, -663, -131, -829,
-    -1801, -1288, 88, -541, -683, -543, -1199, -87, 1600, 623, -942, -197,
-    -394, -101, 754, 1565, 2145, 1816, 1668, 1516, 1027, 1400, 1650, 1527,
-    1513, 1580, 2376, 551, 59, 1335, 1894, 905, -467, -711, -161, -62,
-    -780, -1208, -1412, -1913, -1133, -1231, -486, -1331, -808, -141, 709, -82,
-    -283, -161, -192, -97, 496, 124, 176, 297, 973, 205, -12, 998,
-    416, -511, -732, -1708, 129, -1334, -1440, -1969, -2016, -1802, -770, -933,
-    -2384, -3486, -3879, -3609, -3505, -4452, -4239, -3381, -3473, -3085, -2551, -2863,
-    -2050, -1300, -562, -781, -1033, -1629, -734, -79, 217, -23, 597, 1227,
-    1714, 1159, 901, 1146, 251, -119, -38, -561, -1703, -2518, -1142, -1862,
-    -2348, -2055, -2779, -2690, -2749, -3170, -4025, -3109, -3083, -3216, -2841, -3051,
-    -3383, -1686, -1194, -1447, -1824, -3029, -1874, -1431, -548, 1798, 2656, 2330,
-    1929, 1601, 940, 933, 323, -566, 500, 1033, 1042, 300, 510, 331,
-    -880, -291, -187, -203, -782, -645, -1150, -1838, -1862, -1651, -2077, -1934,
-    -2064, -2180, -920, -152, -1183, -369, -395, 264, 1702, 1659, 1762, 2812,
-    2542, 3443, 3702, 4618, 3884, 3343, 3529, 3880, 2052, 1996, 2657, 3212,
-    3926, 2576, 2359, 1335, 304, 228, -73, -708, -1758, -1543, -1420, -1642,
-    -802, -40, -206, 1058, 2446, 1894, 1418, 1198, 2204, 2208, 2583, 3267,
-    2872, 3900, 4270, 4820, 5148, 4679, 4721, 4083, 3750, 3682, 2131, 1634,
-    1973, 1684, 1588, 1500, 1248, 590, 43, -426, -798, -1704, -2551, -2688,
-    -2576, -2105, -1682, -679, -1340, -2210, -612, 608, 620, 421, 613, 354,
-    78, 646, 1487, 1642, 3093, 2689, 1996, 1493, 2191, 2389, 1936, 1512,
-    1542, 1381, 1, -432, 268, 1094, 1843, 1016, 841, -266, -1361, -1920,
-    -1904, -2080, -2382, -1915, -2463, -1184, -738, -812, 168, 1336, 935, -118,
-    -283, 42, 197, 388, 589, 799, 1320, 2367, 1086, 953, 448, 406,
-    -525, -1064, -1025, -1353, -1399, -2116, -2810, -2138, -1156, -1930, -2238, -2347,
-    -2662, -4157, -4628, -4681, -5359, -5211, -5043, -4267, -3302, -2911, -3110, -2201,
-    -1544, -1976, -1699, -1318, -953, -1354, -996, -173, -258, 762, 609, -3,
-    724, 465, -336, 33, -681, -1047, -2009, -1841, -1933, -2340, -1582, -2269,
-    -2023, -2312, -2881, -3137, -4171, -4301, -3762, -3793, -3622, -2850, -3008, -3068,
-    -1806, -1316, -598, -1388, -2427, -1521, -360, 1621, 2314, 3230, 2423, 1274,
-    1094, 47, -32, -1343, -601, 136, 123, 144, 1244, -263, -562, 152,
-    216, 268, 270, -173, -16, 193, -1427, -2340, -2277, -1302, -1254, -1416,
-    -301, 29, 222, -159, -17, 143, -84, 42, 1666, 1969, 2462, 3700,
-    3256, 2708, 2438, 2990, 2828, 2659, 3065, 3367, 3007, 3232, 2226, 1696,
-    1544, 1297, 1229, 1165, 751, -252, -59, 163, 201, -173, -135, -425,
-    -220, -111, 727, 940, 863, 1292, 1536, 2189, 2847, 2261, 2228, 2917,
-    3014, 3799, 3407, 2638, 2862, 3671, 3137, 3565, 3020, 3170, 3654, 4028,
-    2907, 3072, 2873, 1805, 1854, 2067, 1886, 768, 373, -192, -680, -795,
-    -766, -239, 28, 151, 271, 478, 420, 806, 452, 827, 586, 125,
-    780, 1194, 602, 971, 1017, 494, 735, 618, 562, 953, 531, 696,
-    1322, 1747, 925, 630, 1363, 894, 475, 755, 332, 186, -575, -654,
-    -992, -1005, -652, -511, -283, -222, -799, -778, -1002, -937, -848, -1502,
-    -1388, -479, -1166, -821, -421, -729, -1377, -998, -791, -1350, -2700, -2623,
-    -2678, -2331, -2021, -1772, -1766, -1539, -1120, -1016, -1749, -2261, -2438, -3063,
-    -3505, -3122, -3316, -2704, -2834, -3079, -2477, -2263, -1866, -1560, -1703, -1936,
-    -1976, -1730, -1252, -1124, -1944, -2041, -1450, -1349, -1147, -975, -860, -969,
-    -1748, -1634, -1678, -1579, -1079, -1268, -2287, -2351, -1470, -2072, -1663, -1752,
-    -1943, -2525, -2424, -2470, -2239, -2126, -2364, -1997, -1521, -1084, -605, -1080,
-    -1113, 45, -174, -234, -239, -118, 287, 329, -142, -346, -502, -892,
-    -533, -923, -1190, -624, -827, -706, -232, -65, -61, 316, 931, 474,
-    -41, 31, -623, -1112, -1285, -1309, -218, 521, 611, 757, 2248, 2098,
-    1878, 2176, 1324, 1371, 1462, 916, 1854, 2886, 2924, 2445, 1737, 1986,
-    2207, 2025, 2111, 1870, 2202, 1813, 1503, 2011, 2243, 1888, 2094, 2163,
-    1624, 1334, 2063, 2405, 1063, 701, 449, 944, 1308, 844, 1282, 1612,
-    1998, 2251, 2074, 1586, 1735, 1978, 2681, 3374, 3460, 2948, 2596, 2265,
-    2601, 2522, 2362, 2537, 2088, 2243, 1953, 2224, 2311, 1963, 1785, 1440,
-    1406, 1226, 955, 482, 450, 129, -519, -904, -1215, -1127, -936, -704,
-    -499, -258, 257, 498, 460, 223, 472, 1038, 821, 916, 836, 224,
-    321, 649, 374, 479, 1378, 1002, 388, 187, 149, 745, 1232, 1922,
-    1763, 1752, 1811, 2071, 1108, 638, 34, -89, -682, -874, -1161, -1110,
-    -1230, -1672, -1143, -964, -718, -870, -1057, -1040, -1361, -2065, -1707, -1499,
-    -1319, -1610, -1401, -1160, -1883, -1438, -1326, -1624, -1793, -1629, -2235, -2134,
-    -1758, -1389, -1669, -1892, -1458, -1542, -1657, -1601, -1623, -2601, -3078, -3045,
-    -3349, -3160, -3085, -3141, -3023, -2851, -2491, -2049, -2263, -2482, -2364, -1748,
-    -1548, -1602, -1939, -1510, -825, -697, -529, -747, -924, -632, -719, -977,
-    -1183, -923, -1235, -1955, -1964, -1602, -1801, -1719, -995, -1316, -1852, -2562,
-    -3440, -3413, -2720, -2219, -1386, -1076, -688, -509, -273, 116, -454, -720,
-    -512, -478, -350, -527, -822, -429, -377, -405, 458, 417, 178, 829,
-    803, 719, 47, 156, -51, 213, 1097, 1357, 1685, 1371, 1378, 982,
-    529, 495, 141, 82, 709, 1208, 1616, 1167, 1105, 1305, 1914, 1291,
-    1374, 1930, 1817, 2004, 2023, 1872, 2273, 2004, 1575, 1606, 1825, 1479,
-    1653, 2193, 2305, 1868, 1883, 2147, 2522, 2298, 2064, 2452, 2298, 2268,
-    2097, 1744, 1852, 1674, 1235, 1575, 1855, 1896, 1845, 1951, 1795, 2153,
-    2140, 2077, 2894, 3203, 2713, 3267, 3139, 2825, 3033, 3154, 3268, 2955,
-    3102, 2897, 2813, 2636, 2442, 2305, 1713, 1185, 888, 926, 905, 870,
-    612, 157, -39, 50, -187, -513, -152, 143, 179, 91, 432, 253,
-    700, 1385, 872, 942, 1354, 1082, 587, 503, 208, 142, 600, 851,
-    452, 495, 192, -57, 491, 718, 866, 731, 638, 966, 898, 709,
-    335, 378, 487, 529, -127, -630, -655, -638, -961, -871, -928, -878,
-    -512, -243, -367, -809, -920, -1564, -2140, -1593, -1996, -2022, -2630, -2672,
-    -2301, -2661, -2238, -1890, -2004, -2144, -2456, -2180, -1957, -2093, -2266, -2294,
-    -2237, -1892, -1846, -1790, -1519, -1320, -1496, -1859, -1805, -2038, -2371, -2443,
-    -2484, -2148, -2024, -2137, -2095, -1852, -1374, -1331, -1930, -2134, -1823, -1466,
-    -1449, -1475, -1715, -1729, -1378, -1480, -1465, -1263, -1402, -1132, -1284, -1126,
-    -1592, -1935, -2030, -1934, -1555, -1611, -1797, -1946, -1967, -2135, -2008, -1925,
-    -1414, -1163, -1098, -665, -912, -1161, -839, -637, -1160, -979, -1275, -1195,
-    -842, -679, -988, -567, -240, -579, -127, 283, 455, 658, 616, 405,
-    333, 53, 211, 587, 759, 818, 429, 1171, 1569, 1614, 1285, 623,
-    729, 553, 686, 1100, 645, 1004, 1803, 2146, 1850, 2147, 1817, 1761,
-    1634, 1150, 1400, 951, 1311, 1294, 1400, 1876, 1931, 2199, 2329, 2313,
-    2276, 2269, 1716, 2014, 2652, 2234, 2160, 1617, 2004, 2151, 1966, 2164,
-    1982, 2199, 1941, 1591, 2172, 2149, 2310, 2234, 1845, 2277, 2653, 2415,
-    1913, 2134, 1729, 1904, 2435, 2444, 2627, 2386, 2438, 1843, 1479, 1876,
-    1475, 1388, 550, 394, 835, 1036, 900, 704, 684, 306, 245, 194,
-    44, 194, -142, -351, -209, -179, 194, 150, 331, 299, 818, 561,
-    500, 278, 770, 338, 192, 440, 608, 507, 766, 843, 873, 1061,
-    897, 1482, 1500, 1331, 1169, 1137, 985, 1150, 1031, 617, 136, 62,
-    -72, 696, 935, 600, 497, -34, -585, -1124, -877, -1039, -1195, -1015,
-    -1233, -1457, -1703, -1998, -2411, -2245, -2509, -2429, -2788, -2751, -2747, -2544,
-    -2476, -2557, -2713, -2687, -2733, -2369, -2413, -2575, -2182, -2215, -1776, -1749,
-    -2041, -1459, -1683, -2065, -2272, -2142, -2367, -2804, -3192, -3147, -1771, -2019,
-    -2094, -1400, -1519, -1843, -2158, -2052, -2097, -2189, -1837, -2161, -1869, -2038,
-    -2486, -2327, -1793, -1893, -1895, -1425, -1542, -1518, -1477, -1620, -1747, -2108,
-    -2053, -2172, -1780, -1245, -1483, -1776, -1433, -1073, -1092, -1146, -1065, -1413,
-    -1392, -1413, -1047, -1043, -1175, -1323, -1435, -1091, -896, -384, -231, -221,
-    -879, -396, 187, 153, -243, -123, 258, 225, 214, 602, 1087, 670,
-    995, 1143, 942, 618, 1367, 1518, 1814, 1874, 1588, 1622, 1260, 1497,
-    1619, 1243, 1950, 1947, 2259, 2099, 1679, 1386, 1122, 1462, 1890, 1570,
-    1079, 773, 783, 1444, 1495, 1742, 2052, 2113, 1882, 1611, 1862, 2260,
-    2581, 2023, 2052, 2520, 2261, 2171, 2158, 2173, 2130, 2686, 2392, 2344,
-    2223, 2140, 1854, 1884, 2060, 2601, 2584, 2702, 2705, 2255, 1998, 2076,
-    2213, 2281, 2143, 2020, 2560, 2862, 2356, 1930, 1310, 1090, 1458, 1764,
-    1431, 1415, 1250, 791, 1001, 972, 958, 1168, 1326, 743, 475, 144,
-    477, 515, 767, 615, 469, 496, 607, 119, 99, -304, -303, -340,
-    -435, -214, -162, 192, 609, 668, 812, 687, 851, 894, 792, 840,
-    683, 468, 401, 14, 30, 71, -123, -303, -69, 374, 922, 581,
-    404, 146, -257, -93, -225, -618, -749, -1111, -1201, -1306, -1383, -1528,
-    -1720, -1906, -2008, -2340, -2398, -2324, -2516, -2629, -2256, -2490, -2426, -2285,
-    -1960, -2176, -2617, -2581, -2659, -2199, -2171, -2526, -2670, -2524, -1908, -1635,
-    -1796, -1718, -2139, -2619, -2557, -2717, -2370, -2002, -1730, -1634, -1880, -2403,
-    -2452, -2252, -1788, -1388, -1159, -1281, -1799, -1891, -1781, -1368, -1099, -1514,
-    -1881, -2066, -1451, -1165, -1134, -1618, -1850, -1482, -1586, -2050, -2000, -1703,
-    -1378, -1631, -1667, -1612, -1763, -1496, -936, -675, -1212, -1605, -2072, -2284,
-    -2070, -1542, -876, -988, -1072, -1314, -1357, -1227, -644, 287, 889, 1058,
-    525, 95, -687, -793, -17, 663, 1183, 1831, 1726, 1004, 388, 282,
-    754, 1203, 1141, 1026, 1117, 1181, 2038, 2368, 2206, 1383, 710, 1155,
-    702, 450, 315, 531, 757, 1249, 1489, 1921, 2487, 2679, 2427, 1536,
-    632, 147, -253, 354, 732, 1045, 563, 473, 1399, 1735, 2017, 2464,
-    2404, 2374, 2708, 2942, 2674, 1856, 2242, 2118, 2117, 2299, 2431, 2739,
-    3425, 3509, 2683, 2596, 2895, 2900, 2276, 2239, 2363, 2838, 3455, 3262,
-    2650, 1174, 2854, 4298, 2726, -308, -1661, -1345, 193, 879, 2503, 3522,
-    3369, 3676, 3278, 2688, 2663, 2451, 1680, 424, -587, -603, -1240, -1023,
-    -1180, -1650, -1828, -2353, -2904, -3081, -3244, -3171, -2648, -1512, -1274, -1342,
-    -453, 67, -81, 474, 965, 1090, 999, 1362, 2058, 1893, 1391, 1447,
-    1290, 1964, 2629, 2387, 2129, 3060, 3649, 4274, 4415, 3921, 3614, 3498,
-    3414, 2484, 2142, 2257, 2147, 2720, 2253, 2407, 2654, 1889, 1033, 1007,
-    945, 950, 338, 39, -428, -764, 171, 80, -259, -978, -1322, -1554,
-    -2848, -3159, -1594, -1726, -1775, -1412, -3248, -4050, -4160, -2855, -1255, -1951,
-    -1862, -917, -1835, -3299, -4364, -4827, -5424, -5745, -5504, -6289, -6159, -5010,
-    -5544, -5739, -5556, -4862, -4692, -4134, -4538, -4949, -5212, -4884, -5525, -5672,
-    -5857, -5611, -5618, -5030, -4927, -4670, -4808, -5039, -4289, -3657, -2872, -1613,
-    -1701, -1249, -1753, -1743, -1219, -1292, -1689, -1797, -2488, -2619, -1953, -1715,
-    -887, 198, 139, 558, 296, -41, -344, -241, 32, 911, 1418, 945,
-    1173, 768, 1101, 2761, 4298, 3794, 2383, 1791, 2500, 3130, 4124, 4281,
-    5130, 4856, 4526, 3481, 2689, 3696, 3095, 3039, 3061, 3161, 758, -707,
-    170, 1394, 1932, 2288, 2119, 1222, 1353, -129, -464, -1441, -2333, -2280,
-    -2166, -1818, -1597, -1151, -1833, -1445, 534, 467, -826, -1001, -811, 172,
-    10, -904, -555, 86, 932, 1409, 1105, 1210, 207, -393, -714, -1296,
-    -462, -570, -724, -182, -667, -1343, -701, 206, 11, -1411, -2048, -2298,
-    -1597, -1501, -1465, -1537, -1676, -984, -228, 195, 599, 236, 664, -38,
-    833, 1955, 3253, 3785, 2904, 2746, 2802, 3072, 3265, 3704, 4712, 4561,
-    3708, 3136, 2920, 2989, 3090, 3366, 3842, 4466, 3793, 3164, 2232, 2198,
-    2515, 2245, 1250, 1588, 2166, 3700, 4290, 4297, 3794, 2985, 2672, 3509,
-    4227, 4934, 4310, 3233, 3040, 3431, 3594, 3295, 2856, 3211, 4199, 4512,
-    4232, 2797, 1135, 1129, 1793, 1374, 793, 229, 381, -280, -1290, -1627,
-    -523, -1194, -869, -1328, -2212, -2839, -2718, -2389, -3013, -3641, -3849, -3544,
-    -2129, -1443, -989, -628, -2893, -4541, -4262, -3043, -515, 1308, 2336, 1739,
-    432, -657, -1573, -1612, -2413, -2354, -2435, -2630, -1765, -662, -1341, -2235,
-    -2036, -1310, -145, 808, 1154, -197, -2066, -3950, -3592, -2314, -2291, -3402,
-    -3174, -2518, -1811, -1182, -677, -656, -593, -570, -159, 579, 1629, 1702,
-    2172, 2533, 3254, 2652, 1437, 2114, 2486, 1778, 1415, 1317, 2349, 3792,
-    3319, 2598, 1602, 1345, 1853, 1849, 2661, 3095, 3380, 2333, 2840, 1674,
-    1162, 1468, 3847, 4926, 3802, 2847, 2635, 2219, 3079, 3370, 4024, 5170,
-    5457, 4762, 3452, 2515, 3333, 4111, 3352, 2365, 2159, 1103, 1286, 1638,
-    2847, 3553, 2377, 1807, 1302, 542, -994, -2061, -2838, -2822, -2253, -2318,
-    -2425, -3241, -2709, -1710, -580, 267, -706, -2033, -2734, -2635, -1243, -459,
-    114, -295, 109, 752, 1167, 613, -496, -1616, -1752, -1691, -1270, -2315,
-    -3983, -3585, -1598, -118, 177, -286, -2089, -2766, -3603, -4683, -4964, -4953,
-    -5518, -4911, -4734, -4339, -4859, -4617, -4548, -4155, -3406, -2401, -1958, -2653,
-    -2745, -2799, -1971, -834, -782, -1179, -622, 233, 258, -221, -1199, -1195,
-    -663, -1209, -1767, -2086, -1712, -1676, -670, 237, -235, -469, -567, 195,
-    656, 30, -1084, -854, -545, -780, -487, 207, 656, 878, 1666, 2117,
-    2145, 2138, 2565, 2427, 1358, 1066, 1726, 2222, 2783, 3677, 3200, 3559,
-    4015, 3376, 3386, 3063, 1497, 1504, 1761, 1933, 2381, 2206, 2519, 1958,
-    1933, 1410, 990, -185, -738, -154, 314, -167, -324, -538, 222, 1513,
-    1594, 2275, 1365, 502, 626, 197, 1222, 3514, 4163, 3855, 2995, 2100,
-    600, 437, 991, 1860, 1203, 958, 311, 1233, 633, 373, -559, 156,
-    -6, -124, -1000, -2118, -2605, -1561, -1471, -2788, -3774, -4996, -5356, -3295,
-    -2565, -3278, -4147, -3499, -2962, -3126, -3721, -3424, -3023, -2833, -2086, -1678,
-    -1605, -1571, -1172, -1395, -1362, -3133, -4535, -4705, -4353, -4377, -3181, -2257,
-    -2354, -3066, -3001, -2672, -2881, -2818, -2898, -3379, -3898, -4057, -3891, -4408,
-    -3068, -1073, -490, -754, -1440, -2639, -3319, -2664, -2341, -1995, -1096, -138,
-    1032, 987, 613, 404, 621, -991, -1251, -1984, -2396, -2751, -1871, -972,
-    -658, -29, -426, -2118, -3628, -4176, -3534, -2507, -2278, -1729, -1870, -1794,
-    -1528, -762, -777, -369, 592, 1009, 576, 320, 335, 823, 1565, 3274,
-    3614, 3526, 3262, 4271, 4057, 4209, 3411, 3149, 3091, 3501, 2366, 1597,
-    2188, 3338, 3509, 3629, 3131, 2699, 2659, 2228, 1260, 591, -197, -328,
-    -263, -196, 816, 1142, 829, 492, 1973, 1800, 1955, 2636, 2544, 1949,
-    1581, 2987, 3683, 4172, 4404, 3846, 3066, 2724, 2947, 2230, 830, 1393,
-    2238, 2830, 2086, 1580, 2119, 2676, 3484, 2622, 2372, 1456, 720, -408,
-    -537, -315, -516, -260, -451, -439, -1169, -807, -528, -175, -661, -1165,
-    -872, -742, -14, -325, 239, 389, 1294, 1290, 1087, 1274, 552, -236,
-    -789, -1262, -1367, -1659, -1420, -1950, -2268, -3537, -3429, -3327, -3744, -4041,
-    -4318, -3717, -3967, -4606, -4393, -4249, -4274, -4073, -3716, -2462, -2878, -3196,
-    -4209, -5321, -4678, -3790, -3843, -1999, -937, -1179, -1861, -1866, -1688, -1600,
-    -1476, -1108, -807, -1355, -1911, -1092, -820, -1733, -2415, -2660, -1918, -1210,
-    -674, -570, -1661, -2618, -3338, -4193, -4691, -3762, -4643, -4035, -2708, -3140,
-    -3058, -3776, -2808, -2427, -1418, -844, 4, 458, 467, 68, -6, 147,
-    189, -37, 731, -470, -1511, -734, 160, -48, 274, 787, 1067, 1229,
-    1535, 1072, 315, -442, -753, -416, 2, 62, 381, 1223, 1558, 2868,
-    3170, 2835, 1706, 1375, 1835, 2876, 2937, 4016, 4043, 4319, 5034, 5210,
-    5143, 4713, 4149, 3761, 3181, 2849, 2427, 2393, 3123, 4089, 4172, 4340,
-    4004, 2719, 2507, 2116, 2876, 2661, 2383, 2657, 2923, 2477, 2167, 1368,
-    1247, 1880, 3830, 4520, 3858, 3704, 3220, 2987, 3919, 4570, 4137, 3894,
-    3758, 4235, 5219, 5337, 4803, 4178, 4032, 4538, 3483, 2351, 1960, 1656,
-    1768, 2327, 2441, 2580, 2143, 1474, 743, -176, -748, -357, -324, -180,
-    511, -9, -803, -650, 228, 598, 115, 2, 388, -326, -277, 3,
-    925, 713, 1614, 1644, 1553, 1188, -314, -883, -1196, -977, -1006, -1917,
-    -2519, -2206, -1779, -795, -1061, -1096, -1899, -2305, -2910, -3979, -4430, -4427,
-    -4693, -5057, -4659, -5059, -4629, -3906, -3197, -3512, -4082, -4142, -4124, -4714,
-    -4545, -3638, -3340, -2368, -1925, -2373, -2712, -2707, -2493, -2330, -2523, -2702,
-    -4016, -4388, -4629, -4820, -4603, -3361, -2613, -2638, -3169, -3979, -4584, -4276,
-    -4397, -4889, -4958, -4979, -4543, -4138, -4747, -4014, -3812, -3747, -2803, -3580,
-    -3880, -3453, -3873, -2567, -1161, -303, -560, -1486, -2316, -2126, -1378, -65,
-    114, -422, -519, -288, 130, 632, -644, -530, -488, 234, 76, -170,
-    -159, -362, -550, -527, -816, -1775, -2493, -2634, -1332, -372, -523, -553,
-    -477, -126, 193, 306, 1016, 1044, 1680, 2141, 2470, 1996, 1869, 1823,
-    1229, 1420, 899, 529, 1527, 2142, 2935, 3693, 4179, 3900, 3579, 3268,
-    2911, 2377, 2041, 1748, 1602, 1029, 1162, 1831, 1883, 2811, 4097, 4515,
-    3915, 3508, 3366, 4110, 4919, 4618, 4671, 5062, 5389, 5557, 5400, 5154,
-    5725, 5407, 4706, 4390, 3284, 1800, 1542, 2602, 3792, 4309, 4688, 4661,
-    4033, 3505, 2580, 2093, 1472, 863, 1062, 1625, 1331, 1739, 1864, 2357,
-    3607, 4176, 3861, 3538, 1901, 1269, 1911, 2412, 3061, 3278, 4038, 4376,
-    3662, 3779, 3750, 3706, 3743, 3549, 3586, 3224, 2192, 1779, 1819, 2573,
-    2538, 2087, 1046, 390, 121, 317, 143, -65, -433, -457, -211, -594,
-    -637, -131, 644, 815, 861, 407, -276, -446, 479, 262, 1170, 1396,
-    1952, 2253, 2282, 1873, 1704, 1216, 598, -281, 243, 409, -603, -1179,
-    -1262, -1287, -1008, -634, -1015, -795, -1187, -1907, -2318, -1891, -2531, -3708,
-    -3444, -3711, -3837, -3177, -2384, -2258, -2534, -2737, -3209, -3607, -3316, -2492,
-    -1868, -2290, -2852, -2261, -1147, -1461, -1351, -1278, -1622, -2281, -2635, -3021,
-    -3497, -3360, -3952, -3984, -3604, -2922, -3208, -4005, -3880, -3686, -4012, -4214,
-    -4874, -5854, -6100, -5225, -4856, -5393, -4381, -4377, -4262, -5088, -5509, -5263,
-    -4543, -4430, -3350, -2180, -1821, -2462, -2607, -3236, -3161, -3002, -2954, -2427,
-    -1788, -1657, -2199, -865, -2547, -3488, -3237, -2430, -2815, -2762, -2442, -2254,
-    -2168, -2329, -2787, -2422, -2273, -2252, -2128, -1800, -2626, -3402, -2608, -2712,
-    -2684, -1939, -1087, -848, -253, -185, -180, -135, -89, 265, 162, 210,
-    86, -343, 283, 536, 444, 467, 1000, 881, 465, 411, 434, 160,
-    193, 344, -73, -322, -450, 314, 788, 1475, 2844, 3155, 2302, 2092,
-    1217, 613, 677, 1751, 2515, 2608, 3332, 3627, 3310, 3285, 3357, 3618,
-    3445, 3462, 3754, 2247, 1797, 2203, 2473, 2562, 3102, 2436, 2705, 2551,
-    1691, 1853, 2386, 2651, 2594, 1702, 1609, 1737, 2979, 2990, 3203, 4372,
-    4426, 4289, 3792, 3437, 3391, 4374, 4978, 5007, 5150, 5846, 5944, 5670,
-    5479, 5776, 5278, 4782, 4446, 4739, 3848, 3864, 4496, 3920, 3669, 3874,
-    3624, 3537, 2642, 2418, 2068, 1775, 1552, 1478, 1923, 2472, 2581, 2548,
-    2871, 3227, 3048, 3015, 2896, 3499, 3870, 3762, 4139, 3595, 3709, 3913,
-    4223, 3331, 3862, 3771, 3807, 3648, 3664, 2832, 2091, 2015, 2438, 2172,
-    1996, 1137, 1211, 767, 287, -87, -590, -1251, -1564, -1351, -1052, -410,
-    133, 503, 589, 851, 1486, 1726, 1221, 921, 393, 521, 585, 237,
-    32, 716, 1014, 845, 1196, 464, 563, 569, 201, -211, -429, -225,
-    -21, -640, -512, -284, -552, -1323, -1959, -2234, -1703, -3088, -4013, -4358,
-    -4040, -3187, -3447, -4268, -3287, -2463, -2332, -1711, -2879, -3002, -3034, -1944,
-    -1098, -511, -372, -526, -1101, -1718, -1946, -2296, -1771, -1865, -1502, -1582,
-    -1884, -1624, -1910, -2971, -2943, -2829, -2335, -1971, -1974, -2718, -3316, -4276,
-    -4639, -5118, -5195, -5326, -5400, -4419, -4231, -4727, -5371, -5327, -5363, -4782,
-    -4433, -3368, -2633, -2521, -2646, -3184, -3830, -3737, -3423, -3014, -3094, -4217,
-    -4363, -4275, -3908, -3162, -2549, -2414, -2686, -3127, -4051, -4107, -5056, -5304,
-    -5368, -4241, -3855, -3695, -3280, -3495, -3823, -2658, -2471, -2947, -3733, -3438,
-    -3265, -2719, -2375, -1516, -518, -477, -772, -764, -1067, -1870, -2107, -1926,
-    -1740, -2700, -2987, -2952, -2813, -2500, -2736, -2108, -2311, -2983, -3370, -2909,
-    -3610, -3361, -3627, -2877, -2552, -2142, -2379, -2225, -1909, -1638, -897, -526,
-    -874, -701, -188, 258, 417, 823, 484, 417, 661, 1374, 1953, 2040,
-    1829, 1274, 1345, 1345, 1166, 616, 157, 347, 249, 271, -522, -267,
-    -388, -353, -88, -357, -895, -526, 9, 823, 1308, 1168, 1630, 1478,
-    1327, 1281, 1302, 1111, 1608, 2196, 2947, 3608, 4182, 4468, 4815, 5029,
-    4706, 4142, 3740, 3330, 2685, 2648, 2781, 3033, 2277, 2257, 2232, 2484,
-    2380, 2718, 2646, 2062, 1085, 404, 333, 1307, 1736, 1897, 2026, 2559,
-    3164, 3100, 3814, 4521, 3685, 3206, 2249, 2346, 3716, 4226, 4450, 5824,
-    6483, 6641, 6570, 6624, 6624, 6576, 6012, 5484, 4914, 4325, 3225, 3285,
-    3619, 4285, 4032, 3477, 3409, 3295, 2956, 2166, 2149, 2182, 2075, 2021,
-    2247, 2145, 2293, 3274, 3744, 4035, 3124, 942, 1313, 1836, 2675, 3974,
-    5417, 5221, 4986, 4640, 4257, 4188, 4098, 4290, 4318, 4240, 3908, 4683,
-    4667, 3204, 3009, 3259, 3547, 3943, 3994, 3118, 2157, 1908, 1541, 1218,
-    1402, 1563, 1229, 2834, 3357, 2693, 1149, 34, -9, 22, 212, 601,
-    1494, 1735, 2251, 2600, 2658, 2325, 2174, 1946, 2012, 1144, 933, 817,
-    955, 1219, 597, 501, 248, -496, -265, -778, -1379, -1832, -1778, -1471,
-    -1220, -1008, -937, -1095, -595, 701, 1152, 666, -185, -538, -481, -554,
-    -443, -605, 327, 444, 574, 655, 335, 846, 697, -48, 241, -272,
-    -1939, -2530, -2456, -2387, -2496, -2405, -2264, -2029, -2763, -2642, -3062, -4019,
-    -4182, -4266, -4684, -5191, -4762, -3585, -2832, -1651, -1053, -1144, -2400, -3234,
-    -3745, -3714, -2748, -2327, -1953, -2020, -2182, -1507, -519, -947, -1283, -1543,
-    -2054, -1625, -2681, -3070, -4265, -3993, -3863, -3182, -3145, -3037, -2982, -3587,
-    -4354, -4684, -5251, -5285, -5237, -5129, -4444, -3942, -3468, -3446, -3257, -2927,
-    -3134, -3540, -3050, -3163, -2897, -2907, -3147, -2517, -2424, -2587, -2739, -2810,
-    -3156, -3247, -2439, -1979, -2600, -3098, -4688, -5217, -4580, -4064, -2982, -2773,
-    -3266, -3645, -4846, -5926, -5895, -5933, -5425, -5119, -4824, -4332, -3906, -2860,
-    -2222, -2357, -2387, -2714, -2914, -2670, -2546, -2369, -1954, -1613, -414, -27,
-    312, -223, -529, -9, -124, -729, -1378, -1586, -1383, -1774, -2339, -2712,
-    -2456, -1884, -1274, -1713, -2014, -2648, -3016, -3561, -3321, -3163, -2525, -1954,
-    -2246, -1226, -821, -1764, -902, -1158, -2317, -1475, -801, -164, 1232, 2161,
-    1467, 1354, 835, 610, 1108, 1453, 1364, 1819, 2134, 2125, 2530, 2506,
-    1452, 983, 1238, 1477, 2026, 1905, 959, -161, -281, 225, -222, 158,
-    -121, -532, 424, 1060, 1215, 831, 208, 514, 674, 1605, 2275, 2437,
-    2832, 2986, 2672, 3078, 3149, 3287, 3747, 3944, 2280, 2542, 2496, 3079,
-    3420, 3155, 2818, 2817, 3096, 2571, 1711, 810, 1160, 1034, 1261, 1130,
-    1383, 2190, 2383, 2662, 3888, 4343, 4220, 3301, 3046, 3502, 3975, 4109,
-    4162, 4058, 4618, 4976, 5654, 5431, 5371, 5156, 4729, 5040, 4084, 2570,
-    3326, 3545, 4181, 4180, 3784, 3299, 4123, 3583, 2663, 1671, 1239, 1192,
-    1139, 1271, 1162, 1492, 2102, 2440, 3064, 3698, 4243, 3742, 3144, 2524,
-    2574, 3149, 4120, 4570, 5111, 4627, 4385, 4635, 4572, 4778, 4715, 4614,
-    5022, 4989, 4289, 3241, 3273, 3763, 3903, 3705, 4237, 3811, 3315, 2520,
-    1793, 1108, 1177, 1108, 1269, 2133, 1654, 1542, 2549, 2904, 2443, 2239,
-    1295, 1597, 1980, 2554, 3018, 3508, 3669, 3044, 3123, 3367, 2685, 3007,
-    2581, 2300, 2469, 1909, 1219, 1168, 1111, 1067, 1560, 2029, 1951, 1629,
-    1195, 352, -350, -1150, -1081, -757, -646, -319, -723, -660, -304, 519,
-    248, -207, -243, 96, 687, 1137, 1534, 1761, 1904, 2146, 1578, 1884,
-    1568, 1676, 1528, 1203, 1074, 425, 213, -203, -636, -666, -359, -339,
-    -57, -750, -1544, -2284, -2579, -2875, -2725, -2480, -2460, -2600, -3281, -3244,
-    -2570, -2275, -1373, -1898, -4019, -4453, -3401, -2725, -975, -240, -87, -495,
-    -1098, -1886, -1788, -1595, -1072, -319, -144, -969, -930, -835, -1843, -1871,
-    -1319, -853, -1030, -991, -1650, -2491, -3269, -3620, -4131, -3947, -3796, -4254,
-    -4366, -3118, -2772, -3015, -4025, -4504, -4332, -4361, -3931, -3111, -2853, -2474,
-    -2696, -2711, -3407, -3695, -3385, -2732, -3359, -3398, -3361, -2832, -2714, -2832,
-    -2850, -2846, -3217, -3108, -3691, -3867, -4511, -4519, -5145, -4607, -3924, -4040,
-    -4740, -3457, -2153, -2016, -1918, -2584, -2980, -3129, -2583, -2054, -1651, -1575,
-    -1087, -1183, -1811, -2436, -3131, -2872, -3145, -2405, -2404, -3552, -4398, -4129,
-    -3806, -3387, -3073, -3582, -4134, -4078, -4731, -5115, -5564, -5512, -5171, -4563,
-    -4289, -3856, -3494, -3491, -2999, -2423, -2174, -2357, -2543, -2834, -3146, -2984,
-    -3135, -2631, -1937, -1625, -1669, -1515, -1518, -1000, -731, -1116, -1693, -1908,
-    -2478, -2042, -1487, -1188, -1609, -1335, -2338, -2263, -3077, -3498, -3908, -3950,
-    -3888, -3454, -2977, -2879, -2483, -1893, -694, -285, -530, -762, -1137, -1630,
-    -1347, -1185, -278, -8, -15, -173, -38, 318, 291, 111, -190, 53,
-    -295, -946, -1325, -1117, -837, -432, -478, -423, -858, -1218, -1387, -1877,
-    -2225, -2381, -2109, -1627, -1669, -1012, -292, 659, 1275, 1734, 1852, 1023,
-    970, 1130, 1207, 1396, 2177, 2407, 3203, 3411, 3251, 3193, 2994, 2770,
-    2969, 2840, 2346, 1316, 764, 770, 627, 1060, 1171, 1276, 1359, 747,
-    -59, -504, -476, -588, -386, 97, 177, 1083, 1513, 1328, 1588, 1702,
-    1548, 2212, 1981, 787, 1067, 2551, 3354, 4308, 5236, 4936, 3864, 3592,
-    2949, 3058, 4763, 3333, 3647, 4248, 4392, 4737, 4551, 2943, 2761, 2946,
-    3210, 2740, 2250, 2548, 2267, 1858, 2124, 1797, 1189, 1582, 974, 1465,
-    2298, 2233, 2254, 2330, 1527, 1457, 1775, 2377, 3530, 3971, 4088, 4239,
-    4137, 3844, 3808, 3859, 4241, 3616, 3600, 4347, 4812, 4629, 4623, 3684,
-    3214, 1746, 2047, 1780, 1592, 1378, 1102, 798, 1018, 1430, 1980, 2752,
-    2469, 3606, 4380, 3644, 3321, 3596, 2984, 2877, 3501, 4121, 4104, 4385,
-    4395, 4129, 4478, 4612, 4643, 4213, 4791, 3914, 2900, 2625, 2698, 2483,
-    2678, 2519, 2820, 2115, 1650, 1316, 704, 620, 302, 178, 519, 969,
-    1013, 1298, 977, 733, 2270, 2359, 1554, 1014, 973, 924, 1622, 1825,
-    2170, 1790, 2456, 2675, 2917, 3353, 3402, 3229, 2984, 1727, 1398, 2257,
-    2216, 2360, 2292, 1698, 1329, 625, 207, -46, -478, -636, -721, -752,
-    -775, 242, 197, 148, 733, 967, 1699, 1349, 56, -176, -605, -810,
-    -552, -305, 611, 263, 272, 1077, 786, 684, 534, 451, 944, 517,
-    209, 227, -374, -1166, -233, -835, -931, -1171, -1877, -1646, -2397, -2487,
-    -3154, -3271, -3475, -3434, -3065, -2899, -2397, -1203, -825, -425, -807, -969,
-    -1018, -1650, -1529, -808, -24, 55, 178, 3, -80, 367, 531, -78,
-    -165, -623, -1434, -1935, -1512, -1688, -2220, -1817, -1796, -2121, -2374, -2816,
-    -3622, -3134, -3388, -3641, -3756, -4052, -3999, -3663, -2817, -3677, -3588, -2620,
-    -2371, -3326, -4783, -5311, -4887, -4188, -1806, -501, -135, -970, -1417, -1645,
-    -2386, -1911, -1925, -1379, -1030, -1116, -1018, -446, -1821, -3321, -3757, -2975,
-    -2433, -2288, -2227, -3042, -3539, -3917, -3780, -4267, -3348, -3997, -3646, -2910,
-    -3603, -4654, -5477, -6015, -5148, -4377, -3974, -3468, -2516, -2507, -2387, -2047,
-    -1923, -1446, -1319, -1059, -1549, -3092, -4251, -3458, -2349, -1834, -1602, -2048,
-    -2597, -3388, -3683, -4126, -4453, -5504, -5231, -4608, -3462, -2902, -2654, -2801,
-    -2162, -868, -567, -1325, -1891, -2321, -2345, -2044, -1412, -325, -360, -903,
-    -953, -396, -700, -953, -1262, -2105, -1806, -1811, -3172, -2924, -2687, -2436,
-    -1377, -818, -981, -1757, -2890, -2908, -2803, -2902, -2653, -2412, -2560, -2321,
-    -2088, -2026, -1949, -1724, -1658, -2164, -2624, -2222, -1956, -1814, -696, -90,
-    153, 151, 672, 646, 659, 824, 363, 461, 672, 524, 174, -328,
-    -340, -536, -449, -151, -622, -342, -1010, -1336, -1871, -1670, -888, -954,
-    -571, -907, 57, -159, 164, 533, 992, 348, -134, -669, -544, -193,
-    437, 1049, 1234, 1364, 2109, 2152, 2344, 2216, 1774, 1607, 1277, 1258,
-    668, 486, 163, 432, 1340, 1085, 1920, 1228, 410, -39, 163, 284,
-    279, 247, 345, 677, 520, 1238, 1526, 1964, 2118, 1757, 1855, 1365,
-    1446, 2118, 2495, 2535, 3381, 3501, 3532, 3790, 4100, 3680, 2945, 3073,
-    3291, 3151, 2743, 1721, 1694, 2259, 2300, 2569, 3466, 2126, 2000, 1778,
-    952, 919, 795, 824, 1019, 907, 1799, 1234, 940, 1975, 2215, 2413,
-    2282, 1073, 1088, 724, 2617, 4502, 5412, 5432, 4711, 3956, 2888, 3465,
-    2106, 2388, 3164, 3788, 4028, 4034, 4556, 2998, 2194, 2645, 3024, 3207,
-    3902, 3269, 2381, 2010, 1929, 880, 2107, 1789, 1220, 2490, 1962, 1582,
-    592, 320, 236, 919, 2094, 2397, 2668, 3404, 3348, 3743, 3736, 3583,
-    3187, 3278, 2501, 1769, 1691, 2279, 2413, 3540, 3183, 2505, 2249, 1329,
-    1246, 945, 1179, 686, 755, 480, 1122, 1899, 2546, 2363, 2514, 3184,
-    3462, 3323, 2795, 2567, 2755, 3226, 3234, 3737, 4002, 3518, 3212, 2847,
-    2662, 3129, 2675, 2150, 2172, 1320, 88, 90, 684, 1316, 2092, 1516,
-    1018, 682, -13, -953, -1059, -980, -384, -521, 257, -187, 419, 305,
-    -432, 685, 1497, 1240, 1003, 683, 201, 208, 488, 906, 1774, 1992,
-    2282, 2046, 2247, 1611, 1480, 1344, 1466, 1228, 381, -184, -107, 744,
-    505, 535, 435, -576, -2036, -2361, -1999, -1553, -1609, -1743, -1069, -1146,
-    -1158, -986, -621, -578, 185, -203, 133, -139, -535, -787, -374, 73,
-    455, 327, 707, 395, 465, 20, -749, -744, -422, -455, -745, -1210,
-    -1760, -1869, -2234, -2664, -1676, -1130, -901, -1347, -2044, -2465, -3283, -3436,
-    -3329, -2783, -3065, -2859, -2093, -1184, -858, -1142, -794, -1149, -1108, -903,
-    -1247, -756, -539, -359, 79, 473, -160, -1101, -1111, -635, -1141, -1620,
-    -997, -1757, -1949, -1892, -2310, -2817, -2733, -2774, -2784, -2143, -3244, -4227,
-    -4701, -4444, -4010, -4521, -4129, -3657, -3554, -1972, -1282, -645, -1995, -3825,
-    -3640, -2202, -1842, -1265, 347, 669, 394, -667, -1372, -1542, -2579, -2971,
-    -2202, -796, -262, -692, -396, -901, -2341, -2583, -1753, -1338, -847, -1491,
-    -1639, -1535, -2645, -2571, -2424, -3057, -4214, -3052, -2694, -3281, -4054, -4292,
-    -4035, -3864, -3052, -3402, -2912, -1977, -1120, -344, -872, -653, -998, -1053,
-    -923, -1992, -2882, -2456, -1232, -579, -897, -1240, -1724, -1913, -2589, -2779,
-    -2714, -3358, -3273, -3171, -2807, -2539, -1792, -2172, -1523, -601, 117, 31,
-    -1008, -723, -650, -507, -254, -584, -64, 900, 1086, 964, 588, -205,
-    -639, -760, -1125, -1277, -2146, -1651, -1533, -1223, -1331, -1044, -919, -1367,
-    -1562, -2705, -2876, -3038, -3016, -2682, -2251, -2109, -1839, -1993, -1539, -1065,
-    46, 236, -69, -963, -1103, -1557, -1396, -730, -554, 500, 763, 917,
-    1001, 623, 593, 458, -205, -150, -104, 119, -426, -253, -596, 27,
-    278, -127, -157, -288, -1119, -1204, -1463, -2147, -1930, -1072, -961, -1097,
-    -437, -353, -298, 890, 1453, 1378, 653, -34, -676, -500, 714, 195,
-    660, 1805, 2309, 2373, 2040, 1321, 980, 1326, 2178, 1575, 961, 1149,
-    990, 114, -17, 243, 855, 793, 563, 601, -16, -501, -879, -953,
-    -837, -596, -550, 123, 500, 832, 1284, 1610, 1307, 906, 722, 1470,
-    1440, 1881, 2743, 3119, 3655, 4031, 3911, 3548, 2901, 2434, 2587, 2686,
-    2314, 2066, 2203, 1916, 1947, 1364, 1714, 1348, 980, 1093, 723, 497,
-    -53, -389, -512, 178, 1187, 520, 1228, 2839, 2704, 846, -11, 775,
-    1479, 2431, 2885, 2889, 3947, 4626, 4203, 3006, 3305, 1378, 2127, 2841,
-    2999, 3439, 3479, 4092, 3810, 2115, 1804, 2341, 2864, 2521, 2816, 2390,
-    1969, 1722, 1470, 1118, 545, 582, 974, 1207, 614, -144, -812, -940,
-    -816, -135, 222, 1131, 1908, 2533, 3438, 3511, 3209, 3022, 3318, 2513,
-    1817, 2267, 2679, 3382, 3406, 2956, 2543, 2099, 1779, 600, 224, -318,
-    -505, -148, 378, 801, 1357, 1284, 1050, 1299, 1894, 2592, 2591, 2254,
-    1729, 1287, 1338, 1547, 1965, 2079, 2537, 2845, 2982, 3265, 2745, 2602,
-    2511, 2050, 1178, 950, 1064, 1912, 1801, 1456, 1907, 1965, 1425, 313,
-    -1110, -1333, -1112, -977, -393, -787, -434, 49, 273, 254, 903, 1742,
-    1770, 701, -196, -597, 25, 425, 1685, 1890, 1799, 1980, 2372, 2757,
-    2219, 1323, 1246, 981, 838, 957, 959, -84, -672, -663, 480, 544,
-    -1, -349, -750, -1065, -1283, -1907, -1993, -1780, -1369, -1097, -1701, -1290,
-    -602, -390, -376, -732, -1017, -1014, -1042, -1099, -1085, -1142, -273, 956,
-    1453, 1242, 1042, 1276, 1136, 283, 64, 5, -474, -612, -424, -1004,
-    -1445, -965, -497, -722, -813, -1522, -1312, -1345, -2070, -2584, -2311, -2282,
-    -2278, -2230, -2178, -1683, -1212, -847, -631, -1622, -2261, -2223, -1856, -1454,
-    -637, -38, 355, 774, 705, 512, 541, -325, -1061, -496, 97, -312,
-    -989, -947, -1738, -2189, -1678, -2331, -2447, -2611, -3081, -3072, -2401, -2668,
-    -3035, -2892, -2984, -2755, -2479, -1455, -583, -2061, -3331, -3549, -2537, -1514,
-    -862, -503, 978, 1079, 521, -609, -929, -728, -2113, -1866, -580, -372,
-    -605, -299, -395, -1410, -1827, -1427, -1036, -535, -538, -1301, -1545, -1413,
-    -1880, -2328, -2714, -3288, -3750, -3113, -3071, -3334, -3832, -4560, -4578, -3985,
-    -2764, -2012, -1546, -955, -307, 696, 871, 968, -44, 181, 96, -1004,
-    -1682, -1353, -687, 183, -100, 540, 158, -772, -1833, -2590, -3089, -3112,
-    -3376, -2693, -2245, -2131, -1439, -1614, -1294, -976, -786, -987, -1081, -1337,
-    -1565, -1699, -643, -726, -284, 228, 447, 770, 495, 367, -16, -145,
-    -425, -622, -1899, -1901, -890, -793, -912, -1324, -1830, -1625, -2341, -2860,
-    -3127, -2961, -2893, -2607, -2318, -1925, -1493, -1846, -1687, -1803, -236, 605,
-    515, 406, 129, -334, -267, 231, 273, 898, 820, 1346, 1728, 1663,
-    1208, 1166, 448, -190, -834, -427, -632, -615, -462, -479, -698, -693,
-    -860, -1260, -1838, -1552, -2063, -2706, -2335, -2095, -1670, -1372, -860, -768,
-    -358, -864, -600, -824, -635, -139, -341, -122, 73, 476, 1515, 2249,
-    2242, 1766, 1737, 1758, 1469, 1183, 1017, 927, 451, -27, 433, 437,
-    350, 1, -43, 46, -182, -580, -907, -1269, -799, -950, -543, -828,
-    -903, -713, 109, 267, 540, 559, 811, 639, 853, 1046, 1404, 1454,
-    1912, 2680, 2746, 2693, 2500, 2391, 2158, 2401, 2802, 2399, 1717, 1526,
-    835, 1149, 1228, 490, 400, 193, 337, 646, 1039, 673, 639, 1002,
-    1220, 928, 734, 343, 715, 957, 1397, 1394, 1412, 1253, 1754, 1773,
-    1685, 1855, 2111, 2031, 1673, 1615, 1736, 1398, 1194, 1271, 1531, 1982,
-    1810, 1460, 1431, 1668, 1789, 1869, 1635, 892, 1187, 1506, 1488, 1280,
-    1657, 1739, 1109, 1002, 1052, 1095, 1166, 1389, 1318, 1382, 1201, 967,
-    1225, 1495, 1530, 1692, 1911, 1812, 1866, 2217, 2043, 2226, 1837, 1704,
-    1830, 1802, 1655, 1348, 1288, 1317, 1356, 1169, 1227, 1224, 1114, 1006,
-    1314, 1362, 1280, 1281, 1118, 708, 935, 952, 836, 861, 1054, 1019,
-    1080, 1164, 947, 775, 1028, 1130, 1073, 662, 715, 943, 1396, 945,
-    676, 762, 976, 1249, 1255, 1141, 1335, 1393, 1452, 850, 924, 681,
-    225, 355, 833, 1009, 828, 880, 907, 808, 647, 684, 598, 597,
-    608, 597, 263, -78, -7, 70, 253, 706, 538, 561, 880, 813,
-    623, 305, 382, 388, 446, 455, 391, 378, 366, 289, 292, 351,
-    182, 57, 191, 132, -78, -157, -478, -140, -13, -188, -348, -403,
-    -382, -333, -477, -716, -748, -410, -314, -63, 22, 191, 351, 532,
-    800, 129, -32, -535, -729, -401, -65, 18, -51, -108, 197, -101,
-    -417, -531, -472, -513, -788, -874, -958, -796, -836, -399, -411, -565,
-    -505, -530, -912, -786, -385, -113, -186, -57, -437, -696, -399, -364,
-    -222, -417, -662, -1012, -1279, -1280, -554, -332, -352, -739, -829, -877,
-    -856, -949, -1299, -1097, -941, -976, -838, -641, -707, -1063, -951, -715,
-    -837, -808, -816, -1011, -849, -775, -692, -949, -1018, -1086, -897, -1019,
-    -762, -702, -581, -857, -1194, -1190, -1342, -1203, -1057, -1022, -1181, -1087,
-    -1115, -1138, -1094, -983, -1012, -1430, -1764, -1950, -1837, -1558, -1525, -1700,
-    -1652, -1475, -1327, -956, -808, -1304, -1375, -1320, -1406, -1393, -1293, -1309,
-    -1094, -1121, -1014, -297, -114, -388, -806, -989, -1416, -1331, -1181, -1078,
-    -1043, -773, -924, -1002, -1191, -1146, -1126, -1477, -1520, -1612, -1763, -1719,
-    -1496, -1120, -1056, -1075, -1354, -1637, -1441, -1372, -1285, -996, -747, -561,
-    -672, -796, -891, -771, -375, -358, -658, -1070, -1298, -1627, -1385, -730,
-    -705, -919, -920, -824, -750, -720, -565, -543, -687, -753, -1099, -1109,
-    -946, -643, -604, -889, -1193, -1264, -954, -744, -660, -1051, -1177, -1365,
-    -906, -859, -1152, -1125, -885, -817, -274, -120, -49, -494, -915, -660,
-    -577, -722, -559, -317, -267, -353, -199, 106, 14, -157, -387, -721,
-    -694, -796, -636, -549, -484, -602, -593, -560, -513, -436, -553, -598,
-    -902, -776, -386, -142, -363, -381, -239, -54, 514, 410, 326, 149,
-    156, 207, 218, 388, 597, 618, 370, 45, 133, 348, -52, 187,
-    -40, -36, 60, 121, 389, 187, -38, -80, 155, 113, -74, 169,
-    401, 304, 313, 486, 296, 416, 168, 13, 150, 384, 669, 780,
-    547, 343, 376, 712, 1026, 1108, 1316, 1168, 976, 695, 719, 662,
-    813, 948, 837, 697, 609, 947, 908, 807, 686, 676, 1034, 968,
-    742, 723, 593, 556, 325, 532, 536, 343, 393, 802, 777, 858,
-    1299, 1212, 924, 723, 683, 678, 862, 845, 871, 1087, 1178, 1396,
-    1294, 1274, 1225, 1211, 959, 613, 868, 1057, 933, 1167, 1049, 957,
-    971, 1150, 1243, 1109, 979, 816, 797, 961, 1045, 1253, 1304, 1293,
-    1244, 1404, 1831, 1806, 1795, 1545, 1309, 1378, 1434, 1398, 1190, 916,
-    728, 481, 945, 1045, 915, 820, 555, 623, 818, 1062, 988, 858,
-    829, 897, 1055, 1226, 1088, 984, 1295, 1299, 1281, 1201, 1183, 1132,
-    1057, 748, 1006, 736, 845, 763, 695, 609, 641, 930, 997, 976,
-    864, 749, 783, 737, 805, 867, 602, 611, 490, 287, 467, 611,
-    721, 771, 875, 1101, 1211, 1065, 719, 492, 598, 797, 624, 656,
-    744, 355, 513, 725, 939, 895, 666, 583, 534, 361, 552, 393,
-    180, 319, 226, 179, 279, 292, 362, 422, 298, 306, 187, 181,
-    240, 214, 282, 101, 129, 75, 378, 266, 330, 638, 614, 340,
-    487, 387, 530, 598, 606, 603, 687, 830, 761, 529, 394, 285,
-    177, 200, 89, 58, 97, -172, -333, -235, -385, -509, -714, -703,
-    -397, -273, -119, -73, -157, 6, 19, 241, 247, 231, 69, -100,
-    -148, 9, -153, 105, 130, 194, 16, -234, -265, -40, 61, -106,
-    -182, 2, -153, 140, -90, -142, -381, -470, -440, -487, -434, -428,
-    -221, -203, 57, -67, -378, -448, -342, -447, -585, -694, -834, -641,
-    -465, -516, -474, -324, -357, -563, -605, -693, -643, -557, -536, -777,
-    -1174, -1151, -1268, -1133, -851, -928, -708, -514, -405, -311, -630, -718,
-    -632, -423, -585, -911, -991, -974, -764, -640, -513, -698, -510, -641,
-    -688, -610, -540, -769, -960, -901, -953, -667, -444, -346, -188, -233,
-    -262, -306, -512, -567, -842, -703, -743, -946, -948, -1022, -1097, -957,
-    -1121, -1087, -1074, -853, -831, -701, -819, -823, -804, -502, -415, -339,
-    -683, -632, -700, -946, -873, -490, -444, -587, -634, -865, -984, -1001,
-    -974, -1032, -847, -732, -603, -452, -165, -180, -454, -655, -353, -391,
-    -488, -723, -1004, -1024, -824, -575, -652, -760, -756, -681, -458, -415,
-    -277, -306, -469, -269, -611, -639, -651, -709, -798, -984, -1050, -630,
-    -361, -152, -289, -625, -632, -378, -373, -530, -571, -583, -425, -512,
-    -533, -538, -530, -300, -305, -165, -88, -340, -329, -541, -622, -780,
-    -944, -1054, -735, -503, -500, -422, -390, -244, -335, -356, -686, -642,
-    -373, -206, 19, 150, 105, -147, -305, -98, -231, -356, -382, -355,
-    -356, -671, -721, -510, -464, -424, -734, -454, -506, -362, -306, -481,
-    -614, -364, -49, -78, -247, -326, -270, -173, -37, -119, -193, -188,
-    56, 50, 45, 17, 158, 196, 53, -57, -129, -313, 117, 62,
-    216, 346, 210, 267, 302, 114, 145, 195, 232, 518, 485, 574,
-    591, 390, 301, 410, 354, 275, 561, 737, 846, 665, 386, 44,
-    42, 168, 194, 233, 285, 245, 522, 230, 177, 217, 471, 683,
-    449, 367, 332, 205, 65, 24, 162, 456, 457, 499, 511, 514,
-    691, 513, 528, 580, 304, 554, 454, 508, 797, 778, 629, 726,
-    678, 688, 698, 711, 524, 659, 889, 1115, 1103, 1165, 735, 701,
-    626, 583, 536, 896, 847, 537, 450, 314, 248, 350, 693, 717,
-    647, 679, 546, 480, 625, 410, 386, 557, 674, 910, 978, 785,
-    643, 312, 132, 55, 418, 1006, 1211, 1306, 1084, 1125, 1095, 948,
-    795, 695, 472, 550, 704, 922, 607, 317, 1024, 1132, 1028, 1172,
-    1282, 896, 833, 1198, 1488, 1162, 1291, 1611, 1313, 1031, 1280, 864,
-    623, 450, 512, 548, 239, 424, 853, 763, 894, 761, 540, -113,
-    220, 767, 507, 425, 686, 209, -51, 513, 687, 746, 711, 884,
-    694, 938, 1370, 767, 774, 1194, 872, 650, 474, 123, 283, 399,
-    770, 910, 644, 453, 433, 197, 80, 356, 596, 533, 707, 713,
-    524, 852, 612, 674, 452, 554, 867, 558, 185, 233, 203, 136,
-    402, 528, 786, 780, 659, 323, 389, 172, 53, -43, 37, -420,
-    -457, -320, -105, 86, -238, -253, -236, -99, -521, -798, -367, -199,
-    -73, -422, -264, -262, -840, -442, -366, -915, -355, -574, 125, -39,
-    204, 194, 508, 302, 645, 182, 413, -37, 1, 103, 436, -64,
-    284, -735, -247, -459, -404, 544, -226, -1348, 272, -92, -889, -778,
-    621, 572, -70, -2, -518, 147, -136, -194, -119, -545, -986, -437,
-    15, -330, -1240, 758, -160, -345, -1199, -489, -172, -415, -257, -767,
-    -1471, -739, -1702, -1923, -1452, -538, -1090, -1797, -1820, -937, -1121, -816,
-    -542, -1470, -1873, -624, -1400, -2399, -1310, -1291, -118, 499, -19, -404,
-    -476, -76, 105, -609, -649, 358, -737, -616, 1207, 1152, 84, -145,
-    -297, 790, 363, -781, -527, 1323, -189, -691, -917, -364, -809, 158,
-    342, -1511, -1200, -101, -715, -601, -1642, -1768, -1652, -2063, -1974, -2825,
-    -2901, -2520, -2622, -2411, -2204, -2311, -2268, -2329, -1091, 850, 396, -418,
-    74, -311, -790, -318, -36, 721, 865, 451, 40, -1262, 475, -1096,
-    -89, 208, -901, 165, 139, -807, -1931, -1316, -1560, -1315, -2075, -2422,
-    -2476, -2565, -1380, -1268, -1973, -2038, -2078, -1662, -1673, -1595, -1037, 698,
-    1710, 844, 645, 2646, 864, 234, 776, -98, -974, -165, 1057, 494,
-    -98, 885, 1086, -1035, -151, -99, 385, 1467, 2335, 1741, 2193, 1060,
-    957, 1864, 355, -1030, 24, -1122, -1195, -620, -530, 466, 2448, 1162,
-    691, 517, 2640, 1856, -1276, -763, 491, -55, 798, 1720, 2340, 1636,
-    -836, -1042, -778, -50, -85, -2099, -1518, 421, -334, -608, 289, 194,
-    146, 1264, 154, 1220, 2115, 1766, 1478, 825, 1460, 2920, 1264, 2384,
-    2978, 2527, 1694, 3424, 2609, 1051, 801, 2074, 1214, 2026, -364, -654,
-    -19, 990, -570, -659, -364, 234, -1314, -1108, -2076, -1654, -1324, -96,
-    -597, -1464, -624, 1058, 2200, 1875, 2471, 2408, 1249, 1491, 980, 2932,
-    4036, 2655, 3449, 2001, 2880, 2393, 1672, 2654, 3556, 2729, 1435, 2212,
-    989, 1332, 242, -6, 1188, 296, -1008, -1219, -2247, -1613, -3515, -3655,
-    -2112, -4279, -5206, -5715, -2596, -3366, -3237, -2380, -2823, -2093, -2886, -2900,
-    -2178, -2922, -2458, -2884, -2109, -725, -38, -562, 615, 65, -138, 1715,
-    340, 648, 2172, 2060, 530, 126, 1585, 902, 652, 1782, 348, 358,
-    308, 524, 1993, 1674, 1371, 2507, 1942, 2304, 847, -472, 1050, -402,
-    -2573, -3180, -1594, -2490, -3240, -3920, -4032, -3237, -4293, -3370, -3346, -3484,
-    -2714, -2985, -2945, -3971, -3748, -5424, -5139, -4454, -3957, -3232, -1000, -1362,
-    -1861, -115, 1008, -1758, -2187, -1287, 1560, 1753, 1172, 7, 73, 995,
-    -205, -307, 2679, 2834, 838, 1547, 3638, 2058, 1991, 2010, 1280, 883,
-    1270, 1004, 1080, 24, 982, -34, -567, 82, -1949, -2377, -2492, -2412,
-    -1792, 557, 100, 129, -1140, -1129, -2602, -2194, -3523, -2485, -1502, -508,
-    -2309, -1220, 332, -1270, -1894, 893, -272, -1623, -227, 2252, 1576, -470,
-    -194, -30, 916, 938, 190, 926, 3735, 2353, 2728, 3580, 1704, 2659,
-    2957, 2631, 3078, 2273, 3131, 1394, 3097, 2549, 612, 434, 1254, 742,
-    1889, 1631, 743, 730, 1209, 826, 1068, -216, 399, -52, -722, -166,
-    1084, -654, 1527, 2666, -5, 2268, 3062, 2495, 1156, 1384, 1291, 2144,
-    2286, 3359, 3271, 2332, -162, 573, 283, 905, 1782, 2325, 3617, 5077,
-    3072, 4045, 3168, 1330, 478, 1595, 962, 1432, 1762, 2051, 2007, 2595,
-    2416, 3136, 1337, 2600, 4435, 1019, 1103, 486, -105, 2638, 2719, -399,
-    359, 339, 341, -1145, -1822, -710, 158, -1077, -1932, -529, 12, -990,
-    1120, 855, 755, 888, 2606, 678, 17, 954, 2555, 3739, 845, 1742,
-    3766, 2987, 883, 1118, 2583, 993, 1484, 1004, 1152, 621, 1307, 2179,
-    693, -970, -2489, 21, -240, -324, -596, -556, -1486, -783, -1455, -1318,
-    -802, -1761, -1673, -192, -330, -497, 451, 819, 1510, 1211, 1759, 2609,
-    402, 2662, 2111, 2789, 1532, 2331, 1035, 1930, 1801, 1092, 955, 1082,
-    -311, -512, 523, -396, -1279, -11, -601, -1237, -1702, -1970, -1257, -3253,
-    -3899, -4224, -4457, -4657, -5733, -7267, -5795, -4262, -4330, -5030, -3940, -3491,
-    -4253, -4947, -4663, -4415, -2824, -2987, -2988, -1701, -1932, -1877, -266, -207,
-    -1618, -312, 2463, 1521, 629, 1991, 1348, 1513, 1487, 482, -527, 1017,
-    -146, 66, 568, 980, 731, 1373, 1288, -69, 1043, 602, -1702, -2696,
-    -347, 830, 36, -366, -804, -2083, -3984, -6106, -4974, -3325, -3723, -5479,
-    -4148, -3743, -5234, -5239, -4985, -5589, -6156, -5728, -4270, -4892, -4478, -3950,
-    -3020, -1496, -1976, -1245, -775, -1532, -1882, 24, 820, 1181, 1573, 2024,
-    1577, 474, 234, -21, 322, 1408, 2867, 981, 1623, 1754, 2433, 1410,
-    1489, 2164, 1392, 530, 677, 421, -876, 1018, 142, -557, -1606, -3205,
-    -2563, -2303, -2458, -1893, -847, 594, -2792, -3054, -3349, -4073, -3091, -3900,
-    -2957, -1531, -3451, -2658, -1773, -2408, -782, 547, 1178, 420, -1600, -345,
-    1517, 2483, 2137, 2251, 3238, 1830, 937, 1231, 1702, 2856, 3699, 2110,
-    2514, 2519, 3524, 3119, 3522, 3961, 2927, 1118, 944, 1736, 3424, 748,
-    724, 1950, 1115, 1728, 635, -327, 467, 2022, 1561, -211, -592, -382,
-    -221, 648, -106, 141, 46, 254, -531, 1084, 1498, 948, 401, 1861,
-    547, 1713, 3351, 2996, 1442, 2282, 1070, 2116, 1975, 2166, 2689, 3322,
-    4358, 5200, 4162, 4246, 1846, 1436, 2715, 968, 2078, 2706, 1532, 1682,
-    1437, 1912, 1485, 2132, 1343, 1249, 1697, 313, 316, 2099, 819, 1329,
-    1610, 826, -580, -256, 242, -1137, -329, 356, -178, 1454, 806, 144,
-    425, 417, 690, -672, 721, 1187, 907, 1673, 1890, 1435, 644, 3604,
-    3015, 2619, 2567, 3241, 3095, 2675, 1125, 3163, 1925, 2012, 3005, 2616,
-    1171, 1799, 524, -332, 863, 116, 1048, -403, -23, 192, 382, -392,
-    -908, -1501, -1398, -277, -1303, -1496, -1214, -695, 623, 1365, 1874, 2455,
-    1715, 2504, 2219, 1159, 2671, 2389, 1949, 588, 1333, 1277, 1792, 1696,
-    911, 1986, 1990, 823, 1565, 924, 423, 1106, 910, -217, -1357, -710,
-    -1910, -3116, -1985, -2847, -3720, -3722, -4140, -2668, -3319, -2767, -3845, -4696,
-    -3609, -2458, -3888, -5753, -5016, -4704, -3851, -4571, -4481, -2604, -1571, -2757,
-    -1326, -406, -1339, -304, 826, 1825, -157, 204, 1298, 1317, 471, 836,
-    1739, 613, 443, 1315, 547, -263, 113, 1834, 1966, 1641, 819, 1717,
-    -115, 77, 252, 291, -2002, -2109, -2520, -2115, -2170, -4031, -5965, -5142,
-    -4230, -3367, -3106, -3748, -2657, -3019, -3818, -5575, -4963, -5718, -5009, -4397,
-    -3613, -3376, -2702, -1172, 487, -1150, -573, 238, 534, -876, 14, 793,
-    1526, 633, -928, 175, 1661, -398, 23, 580, 2822, 3085, 1418, 989,
-    2022, 1785, 1520, -4, -1204, 972, 157, -1286, -1183, -796, -395, -416,
-    -732, -2576, -3899, -3567, -2706, -2351, -819, -1816, -2344, -2016, -2675, -3081,
-    -2324, -2762, -3230, -1131, -1339, -1671, -2389, -1330, -497, 353, -974, -158,
-    505, 903, 2128, 1532, 933, 590, 2487, 1248, 598, 2126, 1883, 767,
-    409, 913, 1834, 3282, 2521, 2721, 2594, 2846, 3093, 206, 761, 962,
-    974, -51, -147, -1047, -232, -1029, -535, 1153, 2578, 1599, 296, 1499,
-    392, 927, 665, -338, -913, -347, -77, 1020, 1284, 1554, 1161, 2163,
-    2269, 1954, 2030, 2576, 2536, 3607, 3323, 2387, 2745, 2476, 1166, 1673,
-    2413, 2653, 4458, 4185, 4540, 3460, 1721, 1151, 1648, 2214, 1015, 1347,
-    722, 1402, 1214, 156, 1091, 759, 26, 500, 1372, 181, -525, -588,
-    -1592, 471, 512, 235, 592, 365, 1065, -47, -464, -548, 30, 1528,
-    -243, 1501, 987, -1295, 811, 1579, 1140, 1061, 1534, 333, 1300, 1514,
-    -727, 123, 1100, 1060, 1868, 2185, 2104, 859, 1277, 1286, 754, 1439,
-    1216, 922, 147, 1264, 122, -939, 567, -50, 0, 131, -112, 120,
-    -50, -532, -945, -2060, -1183, -77, -340, -80, -708, 1368, 1374, 659,
-    966, 1896, 1826, 2356, 2501, 1842, 4246, 4641, 2977, 2507, 737, 2,
-    134, 473, -240, -433, -1021, -81, -93, -934, 15, -1277, -1392, -486,
-    -1553, -1122, -2388, -1994, -2361, -3130, -5251, -4786, -4153, -5050, -4481, -3382,
-    -2515, -2255, -3506, -3037, -2375, -3803, -4229, -2760, -2944, -3064, -3553, -3726,
-    -3529, -2034, -2140, -2636, -1173, -696, 517, 617, -499, -621, 611, 1071,
-    690, -131, -29, 964, 1366, 623, 700, 488, 395, 778, 158, -396,
-    631, 875, 446, 833, -826, -1726, -2577, -2689, -2837, -3243, -3389, -3728,
-    -3690, -3901, -3732, -3275, -2449, -3086, -3645, -3779, -3963, -2945, -2213, -2006,
-    -2922, -1515, -1052, -780, -1467, -1922, -85, -153, -480, 340, 910, 1417,
-    989, 1361, 1405, 1209, 526, 1096, 1165, 1146, 327, -269, -259, 576,
-    523, 761, 1217, 1414, 744, 58, -559, -235, -1897, -1398, -7, -1087,
-    -1539, -931, -874, -1664, -1579, -972, -1799, -3111, -3232, -2309, -1957, -1844,
-    -1904, -1720, -411, -270, -550, 344, 185, 55, 355, 1326, 547, 325,
-    1340, 1942, 2223, 2218, 1559, 1215, 1840, 852, 230, 946, 1633, -381,
-    -166, 943, 532, 732, 522, 824, 1562, 236, -631, 1070, 1733, 1434,
-    974, 932, 1994, 1707, 970, 1963, 2280, 2306, 1826, 1312, 697, 824,
-    989, 1090, 1606, 1761, 1716, 1062, 1791, 2540, 2204, 2056, 2116, 1855,
-    2406, 1785, 953, 2091, 2979, 3026, 3086, 2968, 2215, 2116, 2674, 2337,
-    1811, 3085, 1781, 2040, 1879, 892, 911, 1046, 2248, 2152, 679, 1625,
-    1363, 1179, 1419, 1017, 725, 882, 1282, 919, 534, -184, 272, 692,
-    -36, 149, 501, 1360, 897, 513, 68, 1667, 1742, 974, 225, 1005,
-    441, 633, 208, 1254, 1074, 32, -302, 76, 295, 261, -664, -777,
-    -78, 255, -1015, -383, -206, -64, -290, -136, -622, -520, -1482, -671,
-    -375, -487, -614, 30, -963, -60, 242, 960, 1028, 1759, 1062, 754,
-    339, 759, -89, -121, -127, -22, 577, 911, -116, 465, 1281, 2014,
-    1515, 2350, 2123, 1780, 1147, 169, -435, 454, 661, -8, 743, -109,
-    639, -152, -863, -847, -1423, -1705, -1440, -1861, -3044, -1899, -2598, -2761,
-    -3045, -2928, -2642, -2167, -2173, -1965, -2720, -2487, -1553, -1327, -2799, -3644,
-    -3155, -2553, -2228, -3174, -3460, -2485, -2453, -3587, -3429, -2567, -2531, -3451,
-    -2309, -2390, -2354, -2681, -2808, -2653, -2901, -3009, -1854, -1240, -225, -290,
-    -103, 395, -829, -1104, -795, -875, -850, -888, -1269, -1063, -869, -1555,
-    -1900, -1928, -2262, -1831, -1486, -1595, -1403, -1630, -2545, -2188, -2296, -1864,
-    -1443, -993, -1105, -1695, -1545, -1643, -1802, -2033, -1804, -1307, -896, -1013,
-    -805, -645, -553, 413, 371, 19, -7, -356, -434, -16, 400, 532,
-    -105, -1041, -833, -896, -600, -461, -318, 57, -281, -1239, -1522, -1482,
-    -808, -174, -899, -1699, -1891, -1764, -1600, -358, -900, -1132, -635, -128,
-    -302, -265, 9, 652, 959, 19, -655, -509, -552, 346, -371, 145,
-    -29, 107, -204, 60, 37, 764, 362, 287, 579, 501, -83, -39,
-    908, 677, -59, -26, 595, -354, 510, 864, 957, 391, 402, -145,
-    244, -22, -530, 446, 460, 314, -182, 50, 875, 1059, 1443, 1503,
-    1106, 1142, 1392, 1442, 1774, 967, 1044, 1717, 2635, 2332, 2026, 2261,
-    2865, 2201, 1495, 1944, 1899, 1888, 2031, 2036, 2272, 2659, 2208, 1981,
-    2481, 2651, 4047, 3301, 3059, 2418, 3319, 3657, 3482, 3635, 3620, 3288,
-    3599, 2876, 2180, 2651, 3237, 2325, 1547, 1111, 759, 688, 467, 540,
-    514, 65, 132, 651, 381, 441, 125, 592, 1116, 273, -283, 254,
-    437, 1075, 1178, -37, -265, -307, 150, 179, 467, 1241, 1701, 1744,
-    1585, 1424, 1477, 1651, 1311, 943, 1199, 692, -27, 128, 496, 17,
-    559, 760, 1036, 649, -585, -625, 106, 123, -157, -144, -738, -1156,
-    -593, -54, 105, 297, 542, 254, 696, 833, 754, 357, 417, 384,
-    -521, 184, 429, 973, 1044, 425, 103, -143, 384, 583, 1201, 753,
-    241, -38, 279, 69, 135, -82, 294, -311, -126, -692, -570, -34,
-    442, -332, -459, -950, -303, -1142, -1927, -2103, -1386, -1451, -1876, -2810,
-    -2592, -2459, -1627, -1124, -1726, -1834, -1300, -1485, -1635, -1477, -1600, -2004,
-    -2145, -2066, -1535, -1736, -1989, -2214, -2913, -3585, -3812, -3497, -3180, -3010,
-    -3627, -3040, -2809, -2470, -2453, -2249, -2384, -1407, -1743, -2426, -3313, -2187,
-    -1694, -1552, -1851, -1210, -1462, -1771, -1111, -306, -308, -527, -826, -300,
-    -892, -1701, -1864, -1932, -1802, -1875, -1730, -707, -801, -845, -1722, -1378,
-    -1247, -1644, -1507, -770, -209, -1256, -790, 350, -337, -411, -1160, -1452,
-    -715, -90, -250, -288, -515, 34, 230, -94, -234, -541, -876, -807,
-    -342, -696, -857, -676, -18, -288, -512, -356, 203, -88, -1406, -1318,
-    -847, -740, -1375, -2003, -1861, -1468, -1109, -1228, -1187, -22, 188, -451,
-    -546, -476, -469, 316, 266, 471, 176, 532, 25, 65, 416, -291,
-    -347, -173, 76, 373, -187, 155, 676, 663, 877, 1357, 959, 953,
-    232, 634, 415, 771, 578, 293, 640, 568, 381, 584, 730, 445,
-    621, 860, 322, -247, 551, 488, 269, 467, 760, 665, 1121, 1028,
-    946, 856, 963, 1187, 1482, 893, 1408, 2008, 2622, 2559, 2410, 1410,
-    1725, 2116, 2129, 1985, 2192, 2450, 2383, 2709, 2517, 2922, 2802, 2805,
-    2750, 2483, 2931, 3285, 2598, 2584, 3162, 2823, 2712, 2637, 2636, 3133,
-    2974, 2665, 2510, 1874, 1928, 1280, 817, 1074, 556, 324, 408, 448,
-    238, 265, 94, -53, -525, -715, -475, 499, 474, 218, 336, 627,
-    1113, 1243, 531, 236, 730, -34, 297, 496, 1086, 1399, 1052, 1856,
-    2141, 1291, 1208, 1367, 1936, 1658, 1234, 1250, 1278, 953, 631, 826,
-    356, 924, 1035, 685, 339, 672, 386, 391, 37, -7, 70, 18,
-    -505, -60, -43, -309, 353, 173, 35, -282, -297, -984, -120, -15,
-    323, -19, 140, 146, 587, 356, 646, 319, 797, 474, 642, 1081,
-    468, 1063, 1008, 1279, 1373, 868, 93, 530, 463, 506, 418, 92,
-    -455, -411, 11, 726, -130, -975, -1034, -891, -925, -1887, -1880, -2083,
-    -1944, -2163, -1319, -1544, -1404, -2174, -2004, -1520, -1592, -2142, -2158, -2095,
-    -2289, -2087, -2217, -2181, -2303, -2501, -2770, -3061, -2579, -2595, -2332, -1754,
-    -2224, -2606, -2415, -1877, -1961, -2211, -2603, -2065, -1396, -1432, -1618, -1862,
-    -2079, -1988, -1311, -1519, -1846, -1341, -1240, -1279, -683, -283, -946, -1386,
-    -966, -792, -1230, -1424, -1405, -1060, -2013, -2110, -1875, -1565, -1723, -1793,
-    -1920, -1393, -1974, -1593, -709, -356, -473, -1200, -413, -527, -424, -235,
-    -724, -702, -609, -767, -809, -675, -523, -311, -691, -201, 154, 251,
-    209, 140, 77, -676, -1000, -820, -836, -1067, -1325, -820, -415, -369,
-    -617, -902, -600, -782, -622, -306, -801, -493, -993, -1196, -567, 198,
-    -195, -386, -669, -909, -756, -402, -473, 365, 800, 823, 499, -393,
-    -215, 33, 392, 628, 523, 277, 294, 562, 1093, 1315, 555, 560,
-    396, 239, 362, 68, 125, 123, 178, 159, 425, 751, 457, 1264,
-    999, 569, 269, 257, 917, 1008, 872, 898, 1185, 1302, 1284, 1101,
-    1376, 1970, 1298, 1418, 1676, 1634, 1197, 935, 1506, 1821, 1741, 1038,
-    1668, 2132, 2335, 2442, 2288, 2185, 1824, 2439, 2532, 2827, 2502, 1941,
-    2274, 2700, 2353, 2777, 2882, 3655, 3000, 2502, 3291, 2839, 2290, 2114,
-    2610, 2247, 2063, 1647, 1667, 1583, 1488, 1665, 1499, 1821, 1538, 1048,
-    1092, 1185, 713, -81, 245, -221, -83, -2, 632, 50, 1, -64,
-    -98, 104, 153, 1263, 1132, 584, 371, 551, 890, 770, 987, 966,
-    1426, 1661, 1226, 1076, 1658, 1367, 1378, 1455, 1251, 470, 269, 489,
-    439, -38, -534, -191, -71, -190, -355, -108, 609, 808, 382, 157,
-    89, -132, -334, -202, 50, 40, -115, -184, -48, -413, -196, -162,
-    -267, -474, 310, 324, 601, 586, 752, 1150, 506, 70, 440, 321,
-    365, 833, 760, 364, 343, 766, 1377, 915, 998, 905, 525, 763,
-    112, -71, 183, 233, -339, 172, -224, -899, -1256, -536, -798, -1145,
-    -1596, -1918, -1828, -1499, -1515, -1579, -1465, -1858, -1941, -1483, -1820, -2176,
-    -2393, -2841, -2775, -2327, -2015, -1968, -2343, -2844, -2302, -2247, -2325, -2325,
-    -1975, -2184, -2756, -2802, -2617, -2687, -2691, -2271, -1623, -1465, -1499, -1477,
-    -1254, -1799, -3291, -2969, -2290, -1591, -1545, -1418, -1168, -1483, -1827, -1866,
-    -1557, -1683, -2162, -1542, -1749, -1359, -1280, -1409, -1807, -1929, -1377, -1995,
-    -1632, -1335, -1229, -1195, -1521, -496, -649, -833, -369, -487, -314, -422,
-    -41, 223, 600, 647, 0, -116, -312, 198, -3, 80, 1171, -81,
-    -24, 299, -175, -952, -770, -762, -448, -113, -95, -418, -451, -662,
-    -648, -1058, -453, -402, -343, -70, -110, -705, -593, 200, 286, -944,
-    -1407, -614, -673, 64, -155, -271, -793, -1480, 177, 219, -755, 430,
-    734, -353, -768, 29, 1148, 336, -87, 348, 1069, -225, -588, 62,
-    1012, 449, 38, 56, 440, 826, -937, 74, -401, -1429, -137, -26,
-    -225, -729, -525, -652, -318, 608, 376, 737, 996, 1569, 1305, 1661,
-    1534, 809, 1417, 2091, 2037, 2065, 1528, 1986, 1273, 994, 1893, 1583,
-    1401, 1359, 1300, 1348, 1533, 1196, 1273, 1835, 1510, 1519, 993, 1893,
-    1926, 726, 1678, 2167, 1584, 1590, 1167, 2483, 2289, 2235, 1712, 1673,
-    1566, 2101, 2008, 2603, 2347, 1975, 1924, 2227, 1626, 1822, 1868, 2314,
-    2090, 915, 574, 1165, 1704, 1949, 1893, 1260, 1265, -929, -832, 720,
-    1680, 1752, 2885, 2673, 963, 1264, 2257, 1300, 55, 409, -886, -2130,
-    -2076, -909, 78, 76, 1058, 1192, 1953, 1501, 2041, 2976, 599, -1009,
-    234, 1066, 680, 1193, 1279, 652, -336, -1693, -503, -649, -650, -1076,
-    -501, -220, 114, -652, 303, 426, 445, -631, -1146, -1058, -101, 564,
-    299, 807, 1061, 905, 2002, 2102, 2599, 2366, 2993, 2313, 1892, 1169,
-    546, 1524, 1539, 1638, 91, -1210, 113, 698, 125, 367, 747, 1310,
-    -57, -618, -140, -557, -1137, -1210, -903, -1720, -808, -603, 1, -80,
-    519, 1010, 1367, 723, 92, 62, 1891, 949, 103, -855, -853, -300,
-    -1091, -2079, -1162, -528, -2217, -1746, -1168, -603, -722, -1962, -2473, -2739,
-    -3370, -3134, -1829, -2553, -2423, -1807, -2939, -4758, -4101, -3160, -3397, -3140,
-    -2414, -2382, -2595, -2525, -2343, -3492, -4542, -3822, -4826, -4333, -3212, -2959,
-    -2557, -2000, -1827, -1576, -1997, -1662, 74, -1215, -979, 177, 1210, 689,
-    -1527, -1692, -1176, -848, -1349, -1215, 1382, 1379, 314, 161, 1644, 1689,
-    530, -353, -741, -25, -133, 96, 553, -64, -508, -1299, -1892, -3035,
-    -2850, -2141, -1801, -898, 361, -365, -1283, -1582, -1188, -917, -2298, -3386,
-    -2108, -2438, -1848, -1856, -1929, -408, 48, -94, -120, 440, 471, 660,
-    2366, 1428, 1271, 664, 293, -434, -143, 751, 1040, 637, 1181, 1636,
-    1366, 1722, 2101, 675, 1227, 1112, -254, -16, -214, -230, -640, -1042,
-    -881, -1173, -1098, -2410, -2239, -580, -490, 25, -479, -404, -1534, -1832,
-    -1373, -1055, -888, -971, -1015, -1922, -671, 1089, 173, 1050, 2953, 3393,
-    1902, 828, 2704, 3838, 2593, 1022, 1511, 742, 929, 2102, 2313, 1659,
-    2490, 3547, 2966, 2490, 4032, 4114, 2486, 2075, 1546, 2100, 2648, 1443,
-    1196, 1371, 1045, 1317, 1227, 1097, 963, 2214, 2466, 1623, 2397, 2645,
-    2639, 1259, 1056, 1616, 1247, 1716, 1648, 932, 880, 684, 542, 1222,
-    1988, 1878, 2277, 1991, 338, 2611, 3776, 2726, 487, 617, 549, -1268,
-    -1278, 201, 1498, 1986, 1974, 3327, 3143, 2641, 2235, 872, 430, 300,
-    684, -115, 1221, 1166, 1055, 882, 1658, 1514, 1291, 961, 980, -1221,
-    -1609, -1257, -1833, -299, 494, 93, -1271, -1756, -76, -31, -1606, -1479,
-    -1471, -1312, -2795, -2461, -1956, -1023, -244, 1242, 1028, 105, -869, -595,
-    515, 494, 942, 1375, 1538, 859, 1184, 2150, 2863, 2941, 1839, 1155,
-    1542, 440, 598, 1280, 1366, 1284, -109, -1639, -1484, -584, 1293, 936,
-    549, 991, 198, -87, -876, -1240, -613, -1364, -1369, -1263, -400, 16,
-    -604, 418, 1236, 1378, 1002, 498, -43, 133, 979, -31, -311, 856,
-    -386, -1345, -869, -732, -722, -1016, -1439, -701, -414, -1459, -2438, -1190,
-    -1087, -2412, -2784, -1040, -681, -2352, -2795, -2419, -1972, -2863, -4177, -3997,
-    -3691, -2203, -1828, -2249, -2481, -3178, -3112, -3548, -4030, -4749, -4174, -4436,
-    -4734, -3339, -2438, -1936, -1668, -1334, -2099, -1894, -1793, -979, -898, 811,
-    1515, 880, 309, -418, 426, -208, -230, 1096, 733, 956, 994, 857,
-    192, -249, 1047, 1143, 1177, -196, -34, -35, -1566, -1810, -1493, -1131,
-    -1912, -2424, -3490, -2170, 27, -1024, -672, -37, -524, -1585, -2063, -1847,
-    -1901, -1407, -937, -1575, 59, 131, -322, -413, 56, 237, 1013, 875,
-    1376, 1012, 1688, 2590, 3912, 2623, 1507, 1911, 78, -535, -142, 606,
-    1503, 787, 826, 2034, 1410, 871, 1087, 1553, 959, 863, 442, 266,
-    -934, -1517, -1120, -1862, -1259, -1558, -1380, -1804, -2236, -1018, -1601, -1028,
-    129, -679, -763, -1173, -1247, -409, -421, 133, 1257, 1075, 488, 202,
-    1216, 1607, 1269, 902, 646, 2618, 3580, 3404, 3078, 2451, 1934, 3047,
-    3411, 2451, 3285, 3592, 1947, 1957, 3036, 3063, 2926, 3534, 4112, 3510,
-    3004, 1549, 1925, 1301, 846, 2166, 2298, 145, -825, -373, 729, 1722,
-    1582, 665, 852, -29, -1108, -1340, -1265, -531, -384, -339, 2049, 1791,
-    1247, 1454, 1671, 1662, 971, 932, 996, 1121, 2811, 2981, 2157, 2467,
-    1886, 786, 968, 1606, 974, 1820, 2896, 2923, 4112, 2465, 934, 45,
-    -443, 906, 321, 1379, 798, 729, 345, -52, -1370, -288, -105, -198,
-    74, -198, -783, -302, -39, 391, 57, -1025, -1515, -2549, -2826, -2527,
-    -1623, -2071, -2698, -2433, -2349, -2422, -2810, -2122, -156, -76, -422, 138,
-    -1052, -615, 4, 274, 273, -640, 547, 1407, 440, 400, 413, 1286,
-    1830, 1077, 2060, 1500, 1344, 597, 478, 21, -1266, -1804, -377, 281,
-    403, 914, 1303, 705, 514, -573, -1853, -1618, -1706, -2519, -1894, -1217,
-    -2135, -1864, -1603, -605, 55, -138, -1163, 181, -597, -1148, -159, 255,
-    325, -1075, -1325, -2209, -3065, -2674, -387, -254, -809, -223, -935, -1142,
-    -491, -298, 118, -1085, -1778, -2298, -1795, -2381, -3132, -3862, -3772, -4490,
-    -5189, -3710, -3267, -2666, -1135, -2038, -3285, -4181, -3791, -3547, -4101, -4155,
-    -4340, -3224, -3278, -2719, -3517, -2928, -1989, -1678, -744, -295, -464, -734,
-    -1197, -644, 1303, 1325, 678, 62, -1164, -361, -588, -373, -1142, 290,
-    611, 162, 659, 235, 386, 1187, 754, 482, 808, -279, -1168, -878,
-    -1569, -1229, -1699, -1649, -1580, -2114, -1863, 220, 145, -1383, -1958, -363,
-    -1371, -2182, -1202, -547, -987, -1161, -799, -764, -257, -222, 376, 645,
-    153, 384, 331, 181, 721, 2280, 1873, 1074, 1317, 1212, 744, 651,
-    51, -54, 1089, 820, 344, 1524, 1185, 221, 921, 1953, 565, 150,
-    -640, 115, -557, -1551, 624, 9, -614, -958, -596, -284, -1017, -236,
-    369, 1325, 764, -122, 666, 437, 652, 1306, 1642, 1438, 1177, 839,
-    590, 1549, 1430, 1325, 597, 1451, 2838, 2498, 3881, 4212, 3181, 1693,
-    1931, 2651, 2485, 1877, 2677, 3103, 2608, 3835, 3908, 3005, 3414, 2465,
-    1987, 2416, 2691, 1495, 931, 1962, 1007, 1541, 1050, 248, 960, 1400,
-    521, 613, 541, 511, 753, 472, 1828, 1647, 429, 333, 455, 1002,
-    1334, 1204, 1967, 1963, 1346, 1077, 759, 950, 348, 1174, 2907, 2240,
-    828, 1979, 2070, 537, 302, 1437, 2942, 3030, 3208, 3210, 3276, 1508,
-    291, 760, 1002, 302, -843, -226, 1184, 293, 497, 1126, 1976, 846,
-    -442, -460, -551, -1051, -826, -323, -1472, -403, 330, -530, -1373, -1757,
-    -1129, -1105, -1624, -1698, -1871, -2120, -2039, -1191, -1060, -1921, -657, -197,
-    -390, -630, -1035, -1374, -1406, -1126, -322, 644, 471, -339, -437, 6,
-    697, 1067, -50, -252, 797, 126, 1057, 934, 31, -463, -924, -1758,
-    -1616, -1282, -139, 82, -3, 7, -22, -1071, -1162, -981, -1817, -2297,
-    -1534, -1717, -1980, -1856, -1192, -1398, -1633, -1133, -878, -424, 79, -1659,
-    -2169, -1172, -1108, -2373, -3005, -2375, -1778, -1144, -1163, -1295, -910, -1834,
-    -2328, -2453, -1703, -1480, -1732, -2081, -2531, -2659, -2740, -2939, -2965, -3045,
-    -2608, -3666, -4381, -4487, -4027, -3627, -2773, -2401, -3697, -3415, -2786, -3644,
-    -3070, -3442, -4862, -4908, -4086, -3880, -3069, -2508, -2248, -1367, -1173, -1556,
-    -1486, -1539, -1807, -1749, -902, -204, -108, -985, -448, -618, -613, -825,
-    -455, 824, 1765, 1439, 1403, 1451, 1538, 1215, 1082, 419, -500, -512,
-    -429, 461, -176, -467, -1111, -1794, -2042, -1857, -2102, -1517, -1126, -708,
-    -232, -190, -1421, -1351, -1874, -2051, -1801, -909, -382, 139, 637, 1469,
-    1720, 988, 676, 548, 73, 10, 182, 492, 250, 415, 1341, 1162,
-    1500, 705, 1092, 1271, 1247, 1364, 1394, 1412, 717, 1148, 1145, 275,
-    -45, 573, 325, 235, 253, 617, -391, -709, 705, 1198, 421, 337,
-    -7, -16, 938, 584, 281, 1545, 1317, 1397, 1036, 985, 1828, 2033,
-    1205, 1327, 2768, 3193, 2938, 2471, 2773, 2839, 3506, 3276, 1468, 2227,
-    3589, 3647, 2595, 2870, 2666, 2416, 2522, 2976, 3026, 2986, 2719, 2798,
-    2786, 2365, 2600, 2428, 2339, 2580, 1453, 1139, 1811, 2291, 2471, 2518,
-    2441, 2311, 1412, 1589, 2006, 1832, 1761, 2228, 2322, 1955, 2414, 2194,
-    1704, 1761, 1893, 1586, 1619, 863, 1817, 2345, 1806, 1313, 1853, 1529,
-    922, 1486, 1874, 524, 574, 1125, 1020, 1247, 720, 385, 707, 1039,
-    1222, 1607, 1077, 905, 1182, 655, 739, 491, -445, -301, 205, 328,
-    604, 227, 335, 879, -11, -485, 99, -778, -425, 366, -20, -602,
-    -542, -271, -257, -594, -678, 338, 105, 276, 163, -324, -796, -1018,
-    -1605, -2399, -2852, -2407, -1943, -1796, -1733, -1320, -1218, -1323, -1202, -1448,
-    -738, -289, -1477, -2137, -2241, -1388, -564, -652, -477, -315, -725, -176,
-    521, -202, -822, -204, -43, -507, -877, -880, -723, -631, -306, -141,
-    -900, -1659, -1598, -1755, -1899, -1319, -815, -769, -1496, -2361, -2496, -1998,
-    -1308, -2130, -3088, -2562, -2052, -2909, -2720, -3003, -2527, -2170, -2445, -2449,
-    -2576, -3161, -3045, -2329, -2267, -1809, -2346, -2801, -2383, -2310, -2367, -2303,
-    -2444, -2291, -2741, -2534, -2503, -2680, -2375, -1843, -3013, -2868, -1926, -2435,
-    -2633, -2905, -2494, -1853, -2378, -2321, -1866, -1621, -1283, -1211, -1462, -2219,
-    -1622, -2241, -2452, -2002, -1510, -1737, -1265, -1240, -1525, -1155, -818, -957,
-    -1185, -1175, -1084, -891, -861, -984, -1007, -818, -1531, -964, -549, -191,
-    458, -103, -109, -115, -305, -1028, -1640, -1407, -374, 112, -63, -3,
-    215, 350, -119, -259, -346, 345, 666, 516, 685, 740, 750, 627,
-    896, 828, 262, 297, 133, 551, 799, 885, 447, 232, 144, -469,
-    -619, -412, -481, -9, 180, 134, 829, 886, 552, 725, 677, 971,
-    1050, 1635, 1222, 542, 621, 1247, 1114, 968, 1149, 1462, 1590, 1757,
-    1999, 1841, 2016, 1996, 1798, 2004, 2327, 2183, 2359, 2179, 2392, 2488,
-    2406, 2203, 2271, 2596, 2268, 2227, 2678, 2651, 2755, 2653, 2566, 2715,
-    2742, 2489, 2609, 2567, 2213, 2235, 1914, 2281, 2279, 2257, 2835, 3261,
-    3539, 2991, 2373, 2247, 2501, 2215, 2213, 2223, 2008, 2121, 2374, 2037,
-    1901, 1707, 1410, 1221, 1645, 1705, 1517, 1879, 1861, 1860, 2039, 2059,
-    2166, 1965, 1809, 1902, 2030, 2382, 2579, 2280, 1775, 1858, 2316, 1917,
-    1636, 1884, 2440, 2060, 1921, 1922, 1845, 1726, 1862, 2002, 1822, 1623,
-    1325, 1187, 883, 1176, 717, 1146, 1130, 969, 839, 629, 671, 977,
-    722, 338, 356, 88, 279, -198, 312, 119, -335, 23, -601, -625,
-    -391, 165, -227, -28, 45, -179, -441, -634, -926, -697, -627, -946,
-    -1193, -1543, -1655, -1650, -2057, -2212, -2367, -2295, -2011, -2019, -2144, -2064,
-    -1917, -1486, -1176, -1234, -945, -777, -1172, -976, -382, -485, -576, -957,
-    -836, -784, -750, -675, -437, -243, -538, -553, -951, -1026, -877, -811,
-    -1303, -1268, -1380, -1421, -1274, -1516, -2137, -2577, -2159, -1852, -2121, -2234,
-    -2194, -2230, -2566, -3023, -3452, -3969, -3649, -3323, -3451, -3635, -3793, -4188,
-    -4413, -4385, -3977, -4000, -3879, -3693, -3643, -3354, -3256, -3348, -3243, -3286,
-    -3133, -2856, -2829, -3011, -2755, -2763, -3068, -3158, -2714, -3059, -3122, -2818,
-    -2880, -3290, -3163, -2874, -2682, -2531, -2433, -2332, -1992, -2036, -2073, -2075,
-    -1797, -1829, -2229, -2255, -2132, -1875, -2195, -2036, -1975, -1717, -1570, -1379,
-    -1255, -1195, -1503, -1270, -1384, -1681, -1434, -1218, -1387, -858, -892, -744,
-    -861, -875, -1288, -957, -771, -994, -1009, -644, -893, -520, -127, -559,
-    -377, -72, 180, 66, -318, 279, 475, 606, 557, 632, 591, 817,
-    508, 166, 198, 643, 838, 848, 709, 600, -23, -63, -199, -217,
-    -866, -681, -407, -336, -380, -337, 176, 108, 164, 682, 735, 848,
-    1213, 1374, 1365, 1292, 1269, 1171, 1236, 1606, 1577, 1650, 1758, 2053,
-    2111, 2104, 2383, 2604, 2468, 2356, 2333, 2517, 2525, 2449, 2666, 2931,
-    2989, 3011, 3389, 3322, 3324, 3149, 3157, 2771, 2986, 2690, 2816, 2646,
-    2577, 2749, 2605, 2429, 2821, 2922, 3041, 3243, 3116, 2764, 2422, 2840,
-    2779, 2681, 3213, 3434, 3392, 3136, 3082, 2932, 2510, 2790, 2570, 2481,
-    2360, 2089, 2256, 1992, 1878, 1677, 1621, 1613, 1451, 1628, 1745, 1757,
-    1590, 1971, 1985, 1972, 1853, 1873, 2052, 2135, 2330, 2041, 2089, 2159,
-    1916, 1980, 2110, 1936, 2093, 1689, 1616, 1852, 1786, 1608, 1246, 1288,
-    1173, 1407, 1347, 1898, 1703, 1390, 1773, 1546, 1503, 1201, 1218, 1243,
-    820, 938, 912, 471, 409, 5, -348, 106, -269, -350, -580, -732,
-    -640, -479, -330, -367, -525, -355, -304, -238, -141, -107, -204, -316,
-    -751, -1080, -1129, -1585, -1429, -1257, -1271, -1161, -1352, -1117, -1094, -865,
-    -1067, -1211, -1106, -1040, -1032, -939, -758, -871, -759, -629, -1117, -1142,
-    -1119, -960, -745, -964, -957, -676, -466, -754, -1303, -1166, -1165, -1517,
-    -1689, -1331, -1516, -1878, -2037, -2240, -2052, -1872, -1811, -1869, -1790, -1835,
-    -2233, -2147, -2337, -2538, -2505, -2918, -3143, -3143, -3439, -3570, -3582, -3578,
-    -3365, -2991, -3020, -3273, -3390, -3337, -3487, -3161, -3018, -2981, -2781, -2566,
-    -2573, -2767, -2819, -2512, -2557, -2854, -2707, -3264, -3005, -3051, -3402, -3295,
-    -3211, -3169, -2895, -3270, -3019, -2587, -2735, -2822, -2574, -2295, -2374, -2461,
-    -1999, -1542, -1567, -1568, -1924, -1736, -1847, -1880, -1696, -1872, -1669, -1360,
-    -1253, -1105, -1169, -735, -456, -766, -901, -1045, -1427, -1275, -1240, -1186,
-    -1071, -809, -514, -547, -443, -431, -456, -226, 26, -173, 119, 121,
-    -7, -186, 133, 116, -272, -187, 329, 422, 444, 419, 169, 641,
-    857, 1162, 1369, 1645, 1901, 1946, 1458, 1300, 1152, 1130, 754, 573,
-    572, 695, 438, 472, 442, 343, 516, 449, 362, 458, 637, 562,
-    841, 1038, 1257, 1471, 1711, 1592, 1713, 1623, 1733, 1351, 1620, 1413,
-    1671, 2208, 2187, 1977, 2109, 2333, 2009, 1929, 1825, 2108, 2427, 2451,
-    2435, 2516, 2688, 2432, 2320, 3160, 3250, 2794, 2768, 2825, 2309, 2235,
-    2262, 2392, 2703, 2562, 2573, 2734, 2918, 2874, 3344, 3364, 2958, 2962,
-    3411, 3228, 3238, 3156, 3325, 3060, 3352, 3458, 3511, 3243, 3349, 3171,
-    2600, 2254, 2179, 2673, 2601, 2424, 2082, 1755, 1516, 1185, 913, 1082,
-    1216, 1134, 1377, 1644, 1753, 1922, 1659, 1920, 2043, 1692, 1527, 1396,
-    1364, 1305, 1234, 1167, 979, 995, 1081, 902, 579, 535, 464, 484,
-    437, 420, 405, 147, 267, 410, 464, 555, 599, 945, 383, 593,
-    619, 493, 394, -149, -548, -588, -554, -662, -500, -440, -450, -569,
-    -517, -555, -691, -511, -784, -919, -718, -849, -926, -1186, -880, -971,
-    -835, -812, -763, -638, -718, -1116, -1239, -1007, -938, -720, -498, -485,
-    -679, -1076, -1274, -1111, -820, -909, -972, -729, -1036, -1162, -1070, -991,
-    -929, -870, -940, -1283, -1540, -1933, -2184, -1786, -1767, -1944, -1610, -1392,
-    -1576, -1920, -2020, -2252, -2316, -2145, -2214, -2292, -2404, -2158, -1920, -2118,
-    -2152, -1937, -2313, -2249, -2537, -2723, -2989, -3310, -3566, -3328, -3393, -3306,
-    -3056, -2950, -2712, -2913, -2907, -2629, -2323, -2508, -2575, -2629, -2694, -2699,
-    -2513, -2666, -2485, -1922, -1982, -2265, -2203, -2496, -2754, -2844, -2711, -2842,
-    -2553, -2698, -3062, -2868, -3234, -3262, -3106, -2872, -2767, -2416, -2128, -1912,
-    -2007, -2077, -2095, -1743, -1863, -2234, -1987, -1894, -1762, -1646, -1482, -953,
-    -413, -461, 36, 451, 359, 370, 163, -55, -160, -395, -174, -59,
-    55, 279, 321, 295, -38, -19, -18, -428, -734, -554, -352, -804,
-    -816, -323, -763, -1079, 475, 2434, 1560, -1138, -2493, -2262, -2046, -1034,
-    416, 1830, 3158, 3498, 3681, 3783, 3447, 3058, 2283, 1757, 485, 319,
-    -163, -756, -1547, -2290, -2219, -2072, -2050, -2279, -1785, -1207, -877, -844,
-    -777, -482, 372, 711, 1127, 1461, 2772, 3611, 3679, 3342, 3554, 3374,
-    4078, 4247, 4408, 4287, 4987, 4931, 4961, 5292, 5569, 5791, 5822, 6197,
-    5637, 5681, 5964, 6490, 6308, 6352, 6242, 6461, 6491, 5907, 6714, 6849,
-    6614, 6691, 6149, 6319, 6227, 6046, 6050, 6156, 6247, 5966, 5354, 5111,
-    5172, 4789, 3848, 4282, 3887, 2950, 3091, 2593, 2063, 1229, 1020, 558,
-    226, 273, -475, -1363, -2444, -2481, -3122, -3525, -4093, -4011, -4360, -4284,
-    -4706, -4367, -4381, -4784, -4730, -4187, -3777, -3527, -3726, -3770, -3650, -3899,
-    -4459, -3869, -2493, -2129, -3325, -2768, -3738, -3882, -2632, -1257, -145, 630,
-    872, 749, 2151, 1415, 390, -419, -1092, -1063, -590, -334, 330, 1142,
-    1193, 1790, 1846, 2235, 1346, 425, 896, 1762, 1795, 1464, 1293, 1017,
-    1248, 1670, 1205, 969, 1440, 1632, 1181, 264, 1140, 1822, 2102, 1692,
-    1077, 1038, 1420, 1806, 2151, 2551, 1964, 3185, 4078, 4917, 4526, 3420,
-    2455, 2142, 1133, 922, 618, -24, -2601, -2972, -3133, -2259, -811, -1315,
-    -1675, -1690, -2460, -3070, -2992, -4028, -5801, -6608, -6330, -5421, -4470, -4709,
-    -4845, -3838, -3499, -4251, -3229, -1843, -2417, -3184, -2797, -2311, -3484, -3664,
-    -3978, -3505, -2487, -1938, -1642, -2462, -3113, -3832, -3073, -2724, -3032, -3881,
-    -4709, -4843, -4883, -4997, -5906, -5696, -4558, -3386, -4119, -4262, -3966, -4021,
-    -3369, -2349, -2077, -1867, -1709, -1267, -120, 347, -156, -930, -2, 264,
-    1323, 2003, 2651, 3256, 3045, 3124, 2963, 2482, 2495, 3828, 4572, 5033,
-    5567, 5780, 5328, 5885, 5559, 5305, 4969, 4701, 3605, 3686, 4040, 3465,
-    3198, 2729, 1571, 1672, 2244, 2973, 2946, 2173, 901, 55, 190, -898,
-    -2015, -2623, -1908, -1459, -1618, -1565, -2538, -3165, -1834, -363, -694, -644,
-    449, 632, 503, -49, -1019, -2043, -1951, -1131, -160, -1046, -962, -781,
-    206, 81, 2, -108, -156, -1334, -849, -1123, -1439, -1531, -2099, -2971,
-    -3946, -4307, -3986, -3167, -2701, -2451, -2121, -1867, -1831, -2351, -3132, -2787,
-    -2334, -2038, -1950, -1689, -1213, -1325, -1355, -530, 821, 738, 1317, 2096,
-    1939, 872, 509, 1096, 2115, 3076, 3369, 3386, 3182, 3060, 3376, 3762,
-    3010, 2421, 3320, 3631, 2504, 2344, 2857, 3497, 2849, 2149, 1738, 1464,
-    2469, 3140, 3367, 3284, 3515, 3957, 3960, 3594, 3259, 2942, 2597, 3331,
-    2554, 2745, 3122, 4064, 5111, 4771, 5724, 6665, 6380, 5941, 5834, 4025,
-    3061, 3915, 4357, 4361, 5880, 5710, 5285, 4748, 4022, 2900, 2106, 1264,
-    1242, 852, 1638, 2044, 1861, 1012, 1038, 1720, 1332, -185, -443, 486,
-    108, -538, -427, -846, -1970, -2774, -3260, -3950, -4475, -3785, -2876, -2007,
-    -3438, -3199, -2073, -1317, -1753, -2650, -3437, -3263, -2033, -620, -52, -590,
-    -802, -347, -336, -106, -320, -654, -957, -1571, -1418, -1901, -1759, -3023,
-    -4603, -3904, -3089, -2225, -2429, -3098, -3752, -3886, -3389, -3489, -3806, -3793,
-    -2978, -2408, -2490, -2261, -2371, -2054, -1916, -1538, -944, -1273, 732, 1384,
-    1045, 1033, 518, 88, 929, 1469, 2290, 2208, 2938, 2403, 2419, 2609,
-    3197, 3074, 2248, 2275, 2164, 1526, 1330, 2405, 3154, 1413, 398, 351,
-    1216, 1617, 1923, 1250, 858, 777, 466, -272, -294, -621, -344, 145,
-    319, 35, 258, 973, 1315, 2797, 3274, 3600, 4355, 4814, 4650, 3453,
-    3145, 2924, 3451, 4024, 4351, 4844, 5335, 5879, 5196, 4569, 4230, 4216,
-    4396, 4109, 2779, 1695, 1936, 2416, 1704, 324, -473, 443, 478, -29,
-    -1087, -949, -1435, -1552, -2320, -2595, -2799, -2916, -2748, -3122, -3524, -4043,
-    -3749, -3449, -3541, -2694, -2239, -2605, -1494, -944, -779, -1239, -1984, -2649,
-    -3141, -2330, -2304, -1572, -750, -547, -455, -404, -413, -495, -919, -1178,
-    -1747, -1431, -1874, -2626, -3100, -4125, -4753, -4635, -3181, -2664, -2978, -3186,
-    -3104, -3725, -4843, -4716, -4439, -3857, -4135, -5006, -4923, -4407, -3672, -2964,
-    -2055, -1559, -1038, -337, 336, 411, 302, 56, 125, -990, -1192, -1067,
-    -830, -483, -1048, -958, -848, -118, 363, -125, -1037, -2489, -2678, -2188,
-    -2174, -2211, -2486, -1862, -2108, -1091, -248, -99, -541, -497, -395, -1177,
-    -2019, -2149, -1120, -1184, -423, -66, 938, 1702, 2613, 3420, 2839, 2572,
-    4619, 5576, 5353, 4412, 1898, 2013, 3013, 4609, 5012, 6332, 6522, 6353,
-    5434, 4493, 3512, 2727, 1394, 1022, 1407, 2225, 2131, 3277, 3410, 3012,
-    3035, 3722, 3111, 2452, 2692, 2349, 2499, 2716, 2466, 2066, 1863, 1164,
-    1343, 779, 362, 609, 751, 686, 950, 1376, 1645, 1358, 1197, 1253,
-    919, 939, 1232, 1983, 2070, 2410, 2069, 2329, 2006, 1599, 1336, 978,
-    434, 451, -557, -644, -497, -1725, -1679, -548, 216, -33, -654, -451,
-    -1205, -1716, -2539, -3120, -3651, -4211, -4176, -3854, -3424, -3224, -3988, -3792,
-    -4027, -3545, -3647, -3470, -2205, -1532, -1763, -1909, -2501, -2488, -2615, -2510,
-    -2619, -2240, -2594, -2342, -2834, -3030, -3269, -3264, -3244, -4464, -4497, -4122,
-    -4945, -5354, -5659, -6016, -5784, -4499, -3995, -3557, -3400, -3767, -4017, -4480,
-    -4205, -4729, -4618, -4454, -4063, -3998, -4047, -3395, -2716, -2209, -1811, -1743,
-    -1781, -1411, -518, -422, -316, -888, -996, -381, -404, -197, -465, 292,
-    446, 1294, 1995, 1862, 1306, 821, -153, -194, 498, 577, 465, 151,
-    -63, -594, -1342, -1352, -1294, -992, -903, -816, -1330, -1598, -1797, -2830,
-    -2273, -1957, -1712, -1455, -785, -739, -59, 597, 1185, 2181, 3359, 5229,
-    5756, 4967, 4176, 4378, 4315, 4237, 4265, 4466, 5281, 5164, 5036, 4437,
-    4459, 4538, 4305, 3939, 3538, 3704, 3194, 2615, 2212, 3161, 3238, 2758,
-    2694, 2594, 2699, 2568, 2817, 2899, 3076, 2650, 2929, 3122, 2236, 1829,
-    2117, 1931, 2043, 1858, 2563, 2867, 3672, 3825, 4410, 5012, 4385, 3928,
-    3506, 3862, 3972, 3443, 3468, 3270, 3689, 3514, 2999, 2727, 2260, 2345,
-    1723, 1379, 470, 424, 104, -293, -660, -1229, -1632, -1471, -1670, -1314,
-    -943, -1213, -534, -744, -1417, -1961, -2728, -3144, -2525, -1986, -1566, -1673,
-    -1519, -996, -707, -646, -1030, 340, 741, 417, -82, -1361, -2043, -1861,
-    -1528, -1056, -289, 667, 374, -24, -1242, -2643, -3496, -3777, -3336, -3262,
-    -3151, -2927, -2391, -1950, -2424, -3001, -2273, -3106, -3744, -4502, -3944, -3784,
-    -4290, -4580, -4975, -5758, -6143, -6898, -6710, -6939, -7078, -6944, -7051, -6866,
-    -5347, -4329, -4007, -4442, -4478, -4298, -4106, -3650, -3100, -2474, -1891, -1385,
-    -1459, -1118, -722, -511, -791, -341, -497, -1105, -914, -1070, -1886, -2354,
-    -2425, -1450, -572, -1007, -961, -1803, -1338, -1227, -1633, -2418, -2391, -2175,
-    -2480, -1913, -1967, -2274, -1725, -1216, -602, -403, -363, 275, 1834, 1740,
-    894, 281, 529, 222, -21, 277, 866, 873, 1719, 2040, 2643, 2622,
-    1937, 1990, 1947, 2289, 2659, 1987, 2502, 3065, 1817, 1142, 1724, 2274,
-    2800, 3424, 3427, 2949, 2275, 2362, 2342, 1903, 2541, 2643, 2395, 2007,
-    2138, 2787, 2654, 3925, 4276, 4473, 5634, 6763, 7354, 7195, 6766, 6409,
-    6497, 6512, 7238, 7055, 7287, 7222, 7179, 7320, 7031, 6792, 5787, 5494,
-    5403, 4470, 3826, 3848, 4109, 4492, 4056, 3715, 3474, 3511, 3340, 3453,
-    3188, 2835, 2049, 2093, 1168, 1469, 1504, 1305, 1393, 1872, 2174, 2896,
-    2520, 2113, 3109, 3971, 4335, 4360, 4664, 4326, 3786, 3578, 3218, 3440,
-    3913, 4212, 3841, 3687, 4016, 3422, 2874, 2280, 2148, 2156, 1689, 1685,
-    1047, 711, 314, 197, -220, -1212, -1155, -283, -168, 297, 532, -263,
-    -531, -1416, -1104, -1118, -1182, -1280, -1055, -831, -800, -649, -539, -165,
-    370, 530, 458, 515, 339, -447, -696, -1385, -1662, -1548, -1100, -1337,
-    -1531, -1882, -1982, -1664, -1658, -2078, -2752, -3070, -3278, -3473, -3582, -3447,
-    -3670, -3844, -3986, -4429, -4388, -4433, -3954, -3963, -4175, -4362, -4448, -5165,
-    -5934, -5932, -6424, -5684, -5060, -4898, -4919, -4839, -4431, -4727, -4257, -3059,
-    -2857, -3055, -3228, -4231, -5283, -4620, -3463, -2294, -1506, -925, -2018, -3085,
-    -4342, -5248, -4555, -3932, -4275, -4544, -4217, -3690, -3690, -4035, -3841, -3613,
-    -2775, -3906, -4700, -4701, -4554, -3764, -3800, -4253, -4863, -5486, -5650, -5455,
-    -5565, -5210, -4732, -4419, -4607, -3518, -3530, -3107, -3278, -3793, -4019, -3663,
-    -3609, -3065, -2277, -1922, -1135, -433, -373, -480, -83, 152, -163, 314,
-    338, 692, 773, 358, 560, 865, 1622, 1233, 1520, 1304, 897, 921,
-    875, -367, -251, -252, -207, -429, -493, -811, -810, -63, 88, 529,
-    1162, 1767, 2146, 2879, 3098, 2752, 2875, 2950, 3080, 3216, 3353, 3540,
-    3206, 3437, 3222, 2539, 1903, 2147, 2073, 1776, 2778, 2548, 2563, 2515,
-    2202, 1845, 1729, 2243, 2676, 3055, 3709, 3964, 3696, 3870, 4095, 3631,
-    3291, 3129, 3066, 3272, 3069, 3592, 4188, 4301, 4859, 5209, 5666, 5198,
-    4751, 4641, 4647, 4890, 5406, 5445, 5536, 5772, 5671, 5375, 5880, 5601,
-    5687, 5241, 4947, 4677, 5137, 5475, 5864, 5203, 4878, 5028, 5390, 4684,
-    4955, 4563, 4318, 4005, 3961, 3261, 2510, 2942, 3363, 3411, 3305, 2981,
-    2994, 2463, 2793, 3080, 3597, 3655, 4012, 3764, 3538, 3500, 3143, 2831,
-    2543, 2225, 2489, 1920, 2523, 2427, 2110, 2154, 1427, 793, 580, 1276,
-    1262, 1495, 1405, 1382, 1183, 1069, 1366, 1445, 1571, 1315, 1618, 1534,
-    1387, 1070, 747, 565, 685, 892, -59, -351, -1193, -1497, -1235, -1397,
-    -979, -175, -230, 54, -145, -814, -897, -863, -1218, -1572, -1640, -1997,
-    -1749, -1684, -2415, -2306, -2327, -2039, -2506, -2729, -3512, -3475, -3369, -3042,
-    -2725, -1850, -1867, -2151, -2346, -2827, -3253, -2656, -2780, -2639, -2828, -2624,
-    -3773, -3635, -3821, -5092, -4972, -5070, -5130, -5167, -4031, -4239, -4210, -4234,
-    -3515, -3076, -3095, -3396, -4087, -4543, -4723, -4856, -4800, -4816, -5179, -3818,
-    -4476, -4891, -5374, -5865, -5940, -5626, -5326, -4930, -4753, -3622, -3266, -3576,
-    -3708, -3591, -3974, -3892, -4023, -3856, -3871, -3747, -4097, -4088, -3791, -4271,
-    -4999, -5802, -6120, -6281, -6163, -5263, -4830, -4524, -4376, -4386, -4176, -4087,
-    -4577, -4723, -4486, -4668, -4199, -4342, -3691, -3350, -3138, -3095, -3233, -3837,
-    -3947, -3605, -3031, -2748, -2725, -2435, -2047, -2259, -2642, -2312, -2410, -2502,
-    -2003, -1716, -1354, -1515, -1052, -1062, 3, -159, -489, -1194, -2162, -2253,
-    -1652, -1222, -645, -486, 7, 117, 65, 92, 335, 10, -882, -1318,
-    -1082, -760, -391, -96, -451, -261, 638, 632, 479, 684, 434, 785,
-    680, 626, 224, 916, 1276, 1207, 953, 1220, 1013, 1263, 1863, 2021,
-    1607, 1594, 1789, 1817, 1414, 1158, 868, 1523, 1767, 2125, 2842, 3137,
-    3130, 3828, 4003, 4284, 4441, 4366, 4293, 4059, 3874, 3767, 3290, 4281,
-    4313, 4438, 4742, 4534, 4035, 3454, 3223, 3418, 3868, 4397, 3928, 4197,
-    4451, 4346, 4082, 3655, 3651, 3658, 3324, 3436, 4032, 4169, 4217, 3924,
-    3631, 3487, 3077, 3178, 3352, 3246, 3390, 4113, 4223, 4428, 4535, 5053,
-    5383, 4721, 4343, 4596, 4339, 4544, 4530, 4552, 4770, 4482, 4877, 5089,
-    4775, 4910, 4450, 4027, 3984, 3866, 3882, 4322, 4491, 4990, 4681, 4636,
-    4591, 4461, 3978, 4305, 4028, 4106, 3938, 4030, 4151, 3852, 2870, 2242,
-    2296, 2521, 2915, 3473, 3838, 3971, 3565, 3492, 3487, 3170, 2406, 1981,
-    1852, 1811, 1648, 1701, 2089, 1848, 2138, 2169, 1891, 1977, 1623, 1047,
-    1050, 1416, 1742, 1950, 2215, 1924, 2415, 2702, 2187, 2211, 2204, 1838,
-    1565, 1395, 1505, 1573, 1409, 1402, 992, 248, -79, -435, -547, -580,
-    -442, -14, -139, -484, -300, -94, -457, -1070, -1325, -1205, -1283, -1514,
-    -1111, -1240, -1052, -1185, -1429, -1539, -1309, -1731, -2083, -2218, -2131, -1975,
-    -1314, -1158, -934, -882, -1378, -1797, -1978, -2343, -2592, -2237, -2400, -2450,
-    -2040, -2168, -2455, -2668, -2739, -2868, -2697, -3014, -2875, -2882, -2671, -2982,
-    -2973, -3000, -2732, -2724, -3148, -3155, -2752, -2879, -2923, -2971, -3082, -3101,
-    -2909, -2383, -2650, -3530, -3690, -3819, -3449, -3199, -3073, -2884, -2912, -3256,
-    -3408, -3499, -3778, -3946, -4057, -4632, -4128, -3982, -3773, -4552, -4456, -4291,
-    -4453, -4688, -4649, -4558, -4256, -4338, -3821, -3226, -3132, -3297, -3385, -3382,
-    -3733, -3922, -4213, -4023, -4087, -3930, -4198, -4549, -4217, -4296, -4138, -4138,
-    -4540, -4046, -4437, -4112, -3857, -3390, -2882, -3297, -3518, -2603, -2265, -2650,
-    -3191, -3451, -3348, -2853, -2566, -2597, -2558, -2388, -2346, -2820, -3067, -3337,
-    -3501, -3422, -3301, -2649, -2829, -2541, -2506, -2236, -2211, -2673, -2811, -2734,
-    -2757, -2415, -2365, -1779, -1881, -2201, -2004, -1914, -1578, -1732, -1284, -1306,
-    -912, -919, -424, -293, -40, -34, 280, 161, -162, -207, -48, 74,
-    300, 443, 494, 429, 273, 313, 824, 1135, 815, 519, 571, 388,
-    973, 662, 889, 893, 1362, 1338, 1158, 876, 648, 845, 1298, 1245,
-    1488, 1520, 1900, 1953, 1690, 1100, 1070, 1308, 1645, 1824, 2360, 2706,
-    3225, 3264, 2959, 3443, 3355, 3130, 2953, 3059, 2712, 3008, 2984, 2601,
-    2993, 3048, 3192, 2880, 3315, 3252, 3284, 3428, 3802, 3818, 4150, 4186,
-    4029, 4012, 4404, 4201, 3498, 3353, 3151, 3262, 3391, 3269, 3389, 3420,
-    3197, 3592, 3546, 2813, 2849, 2738, 3151, 3152, 2988, 3747, 3492, 3231,
-    4030, 3766, 3587, 3253, 2753, 3376, 3320, 3423, 3819, 4007, 3982, 4025,
-    4196, 4194, 4418, 4311, 4549, 4532, 4638, 4517, 4582, 4309, 4164, 4249,
-    4134, 4412, 4500, 3975, 4668, 4111, 4265, 4552, 4231, 4250, 4420, 4402,
-    4689, 4275, 4081, 3945, 4023, 4134, 4191, 3794, 3754, 3828, 3591, 2460,
-    1780, 1711, 1423, 1313, 1254, 1732, 1701, 2279, 2160, 2287, 1720, 1762,
-    1620, 1990, 1855, 2378, 2546, 2856, 2515, 2212, 2394, 2265, 1925, 1862,
-    2164, 2324, 2243, 2638, 2816, 2422, 1787, 1302, 859, 674, 791, 906,
-    985, 1039, 1805, 1562, 1608, 1215, 1573, 1420, 838, 396, -7, -374,
-    -969, -583, -328, -224, -44, -305, -71, -165, -546, -584, -599, -439,
-    -410, -262, -454, -124, 94, -167, -399, -983, -1191, -1464, -1035, -943,
-    -1255, -1254, -923, -1051, -1571, -1725, -1675, -1467, -1474, -1500, -1679, -1595,
-    -1424, -1203, -1886, -1184, -1377, -1520, -2125, -2636, -2704, -2404, -2143, -1827,
-    -1464, -1822, -1753, -2075, -2190, -2248, -2401, -2672, -2788, -2796, -2664, -2944,
-    -2841, -2442, -2140, -2389, -2646, -2952, -3185, -3254, -2506, -2261, -2750, -3069,
-    -2881, -2584, -2400, -2236, -2544, -2477, -2542, -2094, -2023, -1815, -1650, -1868,
-    -1713, -2058, -2784, -3319, -3414, -3231, -3388, -3300, -2833, -2880, -3118, -3124,
-    -2986, -2946, -3194, -3505, -3068, -2792, -3045, -2928, -2912, -2782, -2861, -2460,
-    -2482, -2436, -2641, -2953, -3420, -2909, -2579, -2735, -2708, -2750, -2479, -2711,
-    -2859, -3115, -3287, -2965, -2612, -2514, -1967, -2357, -2352, -1831, -1870, -2054,
-    -2533, -3280, -3345, -3202, -2659, -2449, -2191, -1976, -1957, -2338, -2544, -2401,
-    -2380, -2393, -2447, -2187, -1949, -2196, -2472, -2507, -2185, -2646, -3137, -3100,
-    -2823, -2605, -2279, -1446, -1422, -1692, -1972, -2052, -1713, -1424, -1278, -1237,
-    -1104, -1570, -1202, -963, -808, -1194, -1144, -381, -558, -1092, -1462, -1989,
-    -1526, -794, -502, -663, -382, -155, -520, -996, -947, -773, -652, -686,
-    -656, -465, -117, 51, 152, 129, -49, -172, -590, -1023, -632, -28,
-    258, 89, 236, 124, 48, 230, 249, 257, 306, 377, 451, 778,
-    938, 829, 729, 1136, 1748, 1085, 361, 168, -61, 222, 130, 428,
-    695, 719, 579, 591, 1192, 1331, 1326, 1069, 1070, 895, 855, 1309,
-    1835, 1688, 1852, 2356, 2102, 2025, 1509, 1635, 1961, 1919, 2254, 2389,
-    2189, 2180, 1548, 1660, 1638, 1863, 1850, 2364, 2264, 2314, 2043, 1602,
-    1512, 1525, 1727, 1441, 1088, 1414, 1985, 2346, 2108, 2128, 2114, 1956,
-    2368, 2987, 2992, 2447, 2437, 2774, 2753, 2488, 2462, 2325, 2445, 2380,
-    2717, 2344, 2184, 2609, 2695, 2577, 2525, 2760, 2883, 2910, 2474, 2331,
-    2893, 2838, 2915, 3461, 3362, 2942, 2986, 3521, 3520, 3515, 3721, 3520,
-    2683, 1897, 1950, 2599, 2781, 2639, 2666, 2694, 2801, 2297, 1987, 2338,
-    2444, 2501, 2518, 2222, 2391, 2693, 2540, 2556, 2169, 2593, 2967, 2381,
-    2470, 2537, 2263, 2130, 2477, 2338, 1806, 1691, 2137, 2135, 2900, 2915,
-    2730, 2460, 2197, 2431, 2548, 2358, 2551, 2508, 2785, 2402, 1888, 1560,
-    1852, 2043, 1978, 2382, 2388, 2158, 2284, 2635, 1965, 1792, 1557, 1694,
-    1890, 1778, 1732, 1793, 1953, 2467, 2392, 1899, 1720, 1874, 1701, 1535,
-    1610, 1853, 1407, 1107, 1026, 1040, 1104, 855, 682, 521, 369, 581,
-    580, 272, -235, -423, -676, -471, -612, -588, -420, -567, -987, -900,
-    -668, -474, -498, -271, 3, 319, 359, 496, 136, -112, 146, 638,
-    926, 613, 780, 765, 315, 291, 125, 223, 409, 55, 25, 253,
-    46, -153, 101, 313, 226, 220, 448, 357, 424, -198, -87, -513,
-    -399, -123, -479, -1362, -2333, -2950, -3342, -3048, -2884, -3029, -3118, -3323,
-    -2929, -3443, -3160, -2921, -2978, -2823, -2902, -2931, -2952, -3078, -2836, -2654,
-    -1838, -1176, -1222, -1115, -1074, -1818, -2449, -737, -54, -171, -132, 406,
-    -592, -1539, -1924, -1695, -759, -263, -276, -1193, -1006, -461, -1486, -2950,
-    -3816, -4083, -4302, -4101, -3421, -3572, -3757, -3681, -3692, -2442, -2243, -2500,
-    -2378, -2120, -1497, -1448, -1266, -1391, -2346, -2909, -3647, -4063, -4412, -4072,
-    -3648, -4141, -3373, -2267, -2094, -2587, -2399, -2796, -2883, -2108, -1481, -1059,
-    -861, -749, -170, 212, 146, -256, 59, 512, -158, -1017, -1356, -1461,
-    -2926, -3598, -3551, -2841, -2226, -1949, -1962, -1974, -2590, -2665, -2725, -3011,
-    -3147, -3281, -3404, -3358, -3326, -3260, -2617, -2083, -1433, -2104, -1660, -602,
-    -508, -679, -733, -1341, -1691, -1778, -1403, -733, -22, 31, 690, 342,
-    239, -285, -335, 214, 518, 81, -1106, -1935, -2068, -2970, -3478, -3564,
-    -2601, -1550, -1243, -954, -1188, -1482, -1373, -2057, -2894, -3639, -3440, -3168,
-    -3143, -3087, -2927, -2696, -2439, -1895, -1241, -1079, -89, 110, -404, -740,
-    -683, -1052, -1082, -599, -132, 145, 659, 1553, 1459, 1261, 1476, 1184,
-    879, 572, 339, 623, -415, -700, -1027, -1880, -2512, -2279, -1611, -417,
-    133, 206, 20, -652, -1089, -1454, -1553, -1855, -1807, -2249, -1226, 109,
-    -20, -471, 396, 953, 359, 487, 1531, 1678, 1230, 1363, 1634, 1657,
-    1108, 1369, 2371, 2156, 2413, 2579, 2430, 2574, 2443, 1969, 2110, 2254,
-    1893, 1249, 372, -172, -465, -702, -1380, -683, 261, 831, 1411, 1453,
-    660, 128, -63, -175, 208, 479, 10, 425, 375, 902, 1046, 1324,
-    1538, 2037, 2549, 3866, 4607, 3704, 3207, 2987, 2403, 3022, 3588, 4295,
-    3709, 3300, 3096, 3764, 3694, 4189, 4413, 4129, 3968, 2888, 2117, 1581,
-    1000, 142, 545, 933, 757, 1043, 1679, 1980, 2278, 1971, 1938, 1537,
-    758, 470, 554, 956, 1029, 1166, 1318, 1380, 1527, 1566, 2554, 2321,
-    3705, 4271, 2909, 2618, 3290, 1713, 1563, 2557, 3477, 3665, 4674, 5421,
-    5493, 4140, 3426, 2651, 2148, 2854, 2609, 2618, 1723, 1720, 1979, 1915,
-    1511, 2555, 2792, 2246, 2705, 3182, 3948, 3908, 3573, 2994, 1945, 1499,
-    1174, 955, 777, 1033, 1197, 1855, 431, 1430, 2607, 2405, 2850, 2356,
-    2255, 2085, 1970, 2075, 2388, 2170, 2328, 3343, 3875, 3731, 3447, 2664,
-    2335, 2104, 1535, 1407, 1870, -47, -620, -586, 210, 787, 1082, 1947,
-    1700, 2174, 1615, 862, 138, 84, -72, -242, 561, 421, 585, 312,
-    880, 1265, 1334, 1026, 2476, 3120, 3102, 1943, 1178, 1271, 1889, 2398,
-    2031, 2539, 2679, 2652, 2812, 2679, 1978, 2176, 1824, 2160, 2064, 1021,
-    295, -192, -2010, -2854, -3069, -3230, -2305, -1308, -844, -975, -694, -1746,
-    -2549, -3049, -3851, -3748, -3607, -3203, -3059, -2591, -1893, -1507, -1731, -904,
-    -859, -604, 580, 981, 398, 245, -270, -95, -182, 397, 993, 919,
-    1344, 1246, 794, 655, 65, -264, 59, -393, -1328, -1621, -1872, -2190,
-    -2775, -3720, -3621, -2909, -1748, -1782, -1605, -1736, -2820, -3362, -3590, -4137,
-    -4220, -4149, -3656, -4012, -3664, -3177, -3147, -2031, -2421, -2829, -2256, -1128,
-    -1072, 67, 151, -376, -486, -509, -713, -1136, -760, -698, -981, -371,
-    -185, -914, -683, -998, -762, -788, -1462, -2742, -3831, -4005, -4042, -5089,
-    -4426, -3957, -2728, -1870, -1714, -2642, -2255, -2963, -4041, -4055, -4273, -4501,
-    -3742, -2628, -2183, -2354, -2147, -2509, -2170, -2123, -1665, -399, 272, 783,
-    -41, -639, -487, -1308, -1378, -1679, -1602, -612, -189, 207, -104, -525,
-    -607, -195, -982, -1965, -3072, -3018, -3477, -3456, -3447, -3389, -3845, -3229,
-    -2401, -2230, -1789, -1494, -2289, -2634, -3053, -3936, -4537, -4338, -4333, -3433,
-    -2313, -1437, -1878, -1395, -1784, -1834, -656, -393, 144, 509, -1094, -871,
-    -503, 851, 774, 697, 1536, 1069, 158, -341, -1013, -1099, -637, -623,
-    -635, -1094, -1283, -1104, -767, -693, 357, -23, -522, -371, -96, -72,
-    -117, -600, -553, -421, -969, -1533, -2397, -2403, -2094, -2219, -2149, -2060,
-    -2509, -1676, -1247, -1058, -700, -464, -11, 162, 394, 698, 341, 1106,
-    898, 699, 963, 1209, 1312, 1378, 1324, 2072, 1738, 1727, -9, -1122,
-    -1487, -129, 1358, 903, 690, 1116, 631, 342, -636, -829, -555, -659,
-    -255, -152, 389, -56, 432, 721, 332, 603, 474, 1512, 2910, 3110,
-    2796, 2969, 1738, 1883, 1814, 2616, 2714, 2422, 3256, 3483, 2571, 2509,
-    2549, 2332, 2212, 1851, 1737, 1663, 1785, 864, -80, -537, -819, -219,
-    492, 1052, 1141, 1396, 1219, 943, 527, 131, -401, -172, -289, 122,
-    328, 496, 1127, 1019, 782, 849, 1287, 2019, 3582, 4396, 3981, 3306,
-    3382, 3427, 3077, 2969, 2890, 2521, 2358, 2878, 3646, 3190, 3197, 3236,
-    2790, 2685, 1889, 1692, 1737, 1256, 947, -316, 52, 690, 1943, 2070,
-    2331, 1596, 1572, 1613, 1141, 647, -38, -150, 579, 678, 1332, 2073,
-    1672, 1537, 2115, 2049, 2350, 3599, 4307, 3389, 3135, 3113, 2418, 2318,
-    3119, 2770, 2794, 3173, 2751, 2414, 3431, 2931, 2369, 2656, 1666, 333,
-    446, -356, -211, 639, -367, -432, -426, -957, -340, 1100, 797, 891,
-    1484, 760, 414, 705, 86, 416, 487, 619, 913, 1384, 1106, 2149,
-    3077, 3172, 3762, 3382, 3306, 2819, 3361, 2891, 3103, 3542, 3614, 3847,
-    4100, 3924, 3385, 3428, 2247, 2097, 2504, 2106, 1400, 1172, 10, -865,
-    -1174, -1333, -1622, -1331, -611, -74, 269, 499, 225, 313, -85, -669,
-    -1374, -1426, -1961, -1784, -1847, -1620, -1558, -860, 9, 430, -182, 1145,
-    1090, 845, 1597, 246, -472, -97, 1307, 1988, 2596, 3981, 3848, 3118,
-    1830, 1587, 1060, 656, 775, 1015, 1600, 1423, 989, 658, 847, 899,
-    1438, 63, -330, 240, 432, 697, 506, -803, -874, -1420, -2558, -3803,
-    -3920, -4031, -3291, -3117, -2805, -2608, -762, -1074, -1197, -1606, -2064, -1635,
-    -987, -761, -444, -468, -103, -130, 363, 763, 1891, 1133, 849, 257,
-    -372, -412, -636, -1479, -1898, -2351, -1940, -1773, -831, -604, -783, -507,
-    -984, -1198, -1985, -2891, -2772, -2406, -3056, -3610, -2969, -2799, -2577, -1403,
-    125, -242, -236, 516, 1035, 598, -541, -1230, -1010, -762, -690, -381,
-    -1, 286, 605, 593, 562, 394, -51, -367, -882, -1185, -1639, -2643,
-    -2564, -3041, -4384, -4644, -3638, -2338, -1214, -990, -1391, -2024, -2332, -3110,
-    -3575, -3056, -3514, -3658, -3668, -4004, -4479, -4037, -3123, -2225, -988, -1057,
-    -807, -272, -439, -1104, -1547, -2162, -1643, -485, 89, 121, 68, 685,
-    316, 418, -18, -34, 452, 272, 341, 597, -463, -1264, -1753, -1608,
-    -2253, -2691, -2231, -1763, -658, 240, 35, -1019, -2073, -2410, -3271, -3156,
-    -3124, -3226, -3770, -3435, -2543, -2278, -2086, -1760, -1434, -439, -145, -95,
-    -462, -479, -896, -728, -451, -117, 783, 1399, 888, 990, 693, -75,
-    -192, -361, -1323, -1265, -1106, -774, -594, -1097, -1704, -2604, -2548, -2731,
-    -2242, -682, 40, 437, 294, -490, -637, -1359, -2020, -1863, -2550, -2496,
-    -2273, -1800, -1483, -1096, -22, -76, -506, -201, -462, 412, 561, -200,
-    -263, -638, -393, 151, 404, 555, 1554, 1537, 815, 1255, 929, 479,
-    237, 744, 801, 284, 613, -179, -836, -870, -480, -70, -576, -25,
-    757, 74, 111, -844, -1867, -1754, -2332, -2959, -2515, -2223, -2134, -1847,
-    -1349, -644, -344, -1265, -393, 380, 337, 157, 406, -526, -624, 470,
-    1076, 2393, 2842, 3176, 2319, 1692, 1356, 1435, 1465, 1388, 1712, 2182,
-    1769, 1510, 1601, 1448, 1670, 1976, 1888, 919, 300, 1000, 1627, 1755,
-    984, 604, -365, -814, -1110, -1267, -1558, -1109, -522, -520, -785, 264,
-    515, 266, 16, 146, 115, 144, 516, 1034, 2249, 2504, 2436, 3100,
-    3779, 3306, 3070, 3051, 2155, 1473, 1324, 1323, 762, 59, -23, -633,
-    165, 533, 844, 864, 918, 985, 1045, 841, 766, 427, 392, 164,
-    -9, 129, 701, 1036, 1252, 2083, 2442, 2732, 2471, 2893, 2557, 2902,
-    3230, 3755, 3984, 3909, 4216, 3939, 3454, 2754, 2379, 2102, 2054, 1721,
-    1700, 1064, 1225, 984, 146, 83, 293, 796, 733, 533, 407, 562,
-    487, 1185, 1534, 1517, 1371, 858, 450, 68, -292, -245, 169, 468,
-    376, 593, 779, 1020, 1344, 1005, 1116, 1184, 1549, 1520, 1683, 1433,
-    1603, 1770, 1967, 2253, 2328, 2498, 2037, 2233, 2016, 1565, 1449, 1549,
-    850, 1166, 908, 971, 1061, 1388, 1463, 874, 1191, 1351, 1173, 800,
-    842, 1466, 980, 765, 806, 747, 903, 1187, 913, 1004, 1097, 831,
-    219, 250, 192, 147, 60, -21, 378, 1012, 1100, 1150, 1244, 1191,
-    741, 778, 952, 655, 536, 607, 761, 388, -167, -15, 389, 480,
-    488, 280, -116, -73, 213, 361, 584, 847, 528, 539, 401, 377,
-    -47, -202, -234, -472, -468, 60, 747, 951, 809, 744, 572, 219,
-    -85, -277, -452, -173, -312, -308, -295, -150, -138, 323, -173, -344,
-    -810, -525, -558, -614, -457, -735, -971, -655, -305, 175, 128, 269,
-    -40, 456, 589, 235, -679, -1011, -722, -1192, -1294, -1166, -1011, -1137,
-    -1427, -1356, -1558, -1804, -2200, -2011, -1588, -1601, -1796, -1464, -1133, -1072,
-    -1206, -1084, -945, -764, -698, -696, -338, -125, -445, -996, -1001, -354,
-    -190, -248, -424, -90, 67, 18, -615, -1335, -1278, -1242, -1096, -1060,
-    -913, -601, -301, -62, -232, -559, -929, -940, -945, -1145, -1277, -1894,
-    -2053, -2050, -1827, -2130, -2289, -1916, -1872, -2268, -1980, -1906, -1838, -1888,
-    -1482, -738, -984, -1279, -1581, -1193, -842, -1053, -1450, -1814, -2177, -2171,
-    -2144, -1603, -1066, -1035, -1100, -1340, -1392, -1402, -1459, -1555, -1535, -1247,
-    -1058, -943, -922, -1159, -1503, -1650, -1643, -1538, -1558, -1535, -1150, -588,
-    -356, -55, -308, -296, -340, -174, -354, -557, -383, -468, -469, -338,
-    -473, -269, -531, -726, -1033, -1102, -1238, -1424, -1542, -1871, -1944, -1922,
-    -1342, -1426, -1311, -1453, -1262, -1102, -967, -1308, -1422, -1224, -1207, -958,
-    -854, -1034, -1205, -1431, -1361, -1322, -1205, -1470, -1489, -1267, -1044, -1136,
-    -1393, -1642, -1553, -1801, -1738, -1488, -1069, -527, -219, -87, 136, 199,
-    187, 108, 113, 106, 28, 179, 210, 78, 101, 259, 482, 883,
-    585, 14, -280, -320, 204, -81, -65, -168, 67, -326, -860, -670,
-    -609, -721, -1115, -1022, -884, -646, -582, -364, -89, 85, -203, -414,
-    -553, -440, -353, -221, -536, -907, -668, -504, -716, -835, -749, -905,
-    -689, -548, -403, -425, -41, 728, 1342, 1334, 1131, 704, 435, 511,
-    926, 1549, 1513, 1292, 1015, 990, 418, 330, 444, 423, 511, 831,
-    599, 466, 462, 751, 538, 22, 327, 554, 370, 203, 361, 641,
-    442, 842, 964, 913, 583, 292, 202, 36, -206, -262, -117, -112,
-    -129, 105, 511, 694, 761, 475, 462, 386, 425, 678, 828, 1118,
-    1215, 1366, 1499, 1350, 1015, 800, 656, 406, 366, 645, 552, 368,
-    1014, 1234, 799, 771, 846, 1087, 1555, 1464, 1460, 1833, 1715, 1391,
-    1300, 1188, 847, 673, 473, 586, 674, 947, 1221, 1226, 1455, 1710,
-    1381, 975, 910, 594, 248, 679, 781, 633, 393, 918, 964, 767,
-    660, 267, 188, 143, 110, 524, 889, 1143, 1168, 1262, 1535, 1670,
-    1744, 1622, 1673, 1569, 1740, 1957, 1753, 1704, 1481, 1334, 1147, 1339,
-    1247, 865, 728, 962, 1010, 1126, 1120, 1161, 1091, 1003, 645, 344,
-    447, 371, 592, 976, 1080, 837, 1100, 1133, 879, 817, 828, 848,
-    1010, 685, 598, 565, 913, 898, 748, 745, 752, 730, 766, 772,
-    633, 714, 963, 1000, 1189, 1161, 1017, 1201, 1222, 1069, 1214, 1179,
-    1191, 882, 1000, 1071, 1029, 549, 310, 484, 757, 736, 423, 300,
-    260, 183, 145, 335, 498, 612, 557, 39, -450, -658, -631, -648,
-    -140, 55, -151, -187, 96, -23, -50, -105, -300, -41, 217, -42,
-    132, 339, 160, 218, 397, 203, 159, 246, 436, 700, 717, 831,
-    785, 942, 1052, 1128, 1228, 1052, 657, 518, 583, 787, 697, 499,
-    97, -11, -186, -490, -688, -605, -633, -708, -764, -556, -486, -423,
-    -390, -378, -331, -454, -884, -857, -884, -816, -593, -293, 25, -99,
-    -201, -580, -730, -733, -885, -928, -1083, -1004, -559, -674, -560, -303,
-    -461, -678, -923, -599, -479, -544, -758, -490, -367, -552, -427, -525,
-    -225, -322, -429, -384, -225, -58, -82, -254, -395, -621, -509, -530,
-    -490, -154, -258, -612, -597, -268, -521, -157, -155, -36, -109, 9,
-    -421, -749, -781, -802, -1005, -925, -784, -851, -842, -813, -902, -1341,
-    -1428, -1609, -2024, -2074, -2180, -1998, -1783, -2170, -2113, -2197, -2459, -2374,
-    -2161, -1823, -1605, -1179, -1078, -1040, -1257, -1378, -1087, -990, -851, -418,
-    -37, -261, -42, 291, -12, 2, -46, -61, -300, -143, -34, -329,
-    -217, -433, -102, -83, -158, 198, 90, -417, -847, -1134, -1239, -1353,
-    -1357, -978, -685, -900, -1025, -1062, -1216, -1343, -1441, -1391, -1714, -1670,
-    -1569, -1303, -1607, -1564, -1435, -1873, -2131, -1907, -1502, -1552, -1588, -1266,
-    -896, -795, -505, -445, -768, -798, -783, -483, -433, -120, -78, 52,
-    38, 133, -194, 491, 27, -386, 20, -153, -418, -543, -40, 148,
-    232, 120, -222, -245, -536, -410, -537, -682, -477, 44, -266, -258,
-    -457, -413, -577, -514, -705, -683, -805, -925, -935, -1002, -931, -484,
-    -685, -914, -846, -936, -857, -717, -540, -368, -344, -125, -112, 57,
-    -145, -285, 144, 213, 51, -129, -197, -99, 115, 72, -21, -188,
-    -137, -32, -310, -179, -124, 26, 260, -62, -303, 32, 156, -212,
-    -230, -110, -152, -36, -436, -332, 13, 499, 551, 485, 432, 146,
-    247, 199, 123, 58, 165, 196, 227, 607, 660, 745, 295, -35,
-    -180, -402, -519, -90, 149, 196, 414, 739, 652, 768, 978, 1221,
-    817, 841, 1055, 940, 663, 549, 358, 89, 467, 370, 508, 667,
-    453, 686, 907, 860, 1066, 1380, 1197, 1049, 452, 79, 203, 246,
-    401, 596, 888, 999, 1319, 1260, 826, 923, 766, 619, 316, 191,
-    275, 329, 378, 482, 552, 451, 646, 573, 528, 758, 819, 1263,
-    1056, 939, 844, 1272, 1259, 1184, 1424, 1656, 1443, 1507, 1683, 1668,
-    1291, 1538, 1873, 1674, 1496, 1234, 840, 464, 483, 382, 834, 989,
-    684, 1346, 1443, 1147, 760, 238, -87, -377, -217, -300, -263, 345,
-    692, 633, 698, 502, 756, 1018, 299, 594, 974, 699, 431, 595,
-    849, 407, 508, 617, 703, 382, 912, 1063, 652, 1041, 1427, 797,
-    941, 1076, 470, 216, 1147, 826, 729, 1461, 1613, 1066, 1291, 1395,
-    1137, 850, 411, 529, -46, 72, -5, -453, 517, 66, 66, 603,
-    299, 562, 68, -214, -90, -330, -306, -161, 156, -207, -215, 148,
-    29, -172, 451, 360, 456, 709, 395, 736, 912, 484, 46, -231,
-    76, 54, 192, 725, 886, 1108, 105, 265, 571, 817, 692, 416,
-    378, -69, -515, -511, -281, 315, 256, 67, 382, 177, 210, 277,
-    113, 335, 512, -2, -321, -487, -152, -346, 32, 115, -519, -821,
-    -518, -551, -19, 31, 202, 165, 240, 469, -402, -20, -127, -201,
-    27, -145, -17, 261, 220, 525, 183, -856, -682, -647, -316, -525,
-    -630, -823, -525, -60, -439, -258, 0, 177, 22, -183, 0, 436,
-    23, -130, 13, -1049, -702, -174, -576, -600, -563, -326, -720, -500,
-    662, -185, -737, 604, -820, -192, -352, -900, 486, -269, -1015, -295,
-    -490, -812, -85, 191, -156, -801, -561, -398, -687, -773, -1239, -762,
-    -589, -96, -461, -829, -271, -1160, -82, -480, -807, -282, -363, -383,
-    -693, -1371, -1215, -1140, -411, -189, -4, -811, -26, 482, -538, 115,
-    278, -1000, -892, -225, -327, -809, 74, 636, -443, -477, 392, -395,
-    91, 370, -710, -463, -949, -968, -788, -858, 549, 85, -355, 548,
-    607, -368, 524, -186, -154, 41, -1527, -2542, -788, -2049, -2732, -1753,
-    -1233, -2110, -1530, -736, -1298, -874, -287, 113, -32, 235, 438, 229,
-    -331, 867, 113, -515, 960, 806, 473, 1267, 1051, 378, -258, 347,
-    685, 722, -33, -956, -1148, -1222, -942, -248, -585, 268, -1911, -1721,
-    -1917, -305, -2696, -1222, -2311, -3009, -1432, -421, -719, -1650, -445, 406,
-    -1795, 392, 1160, 1614, 318, 2249, 1275, -1775, -1388, -136, 758, 2101,
-    2093, -1103, 1421, 3266, 2925, 810, 1034, -1648, -1121, -1635, -844, 28,
-    996, 1420, 277, 1457, 1835, 276, 876, 2181, 2453, 2000, 483, -1019,
-    -554, 1435, 604, -1222, -512, -1147, -2114, -1112, -1051, -1335, 35, -420,
-    -691, 351, 288, -684, -101, 1127, 682, 1513, 1603, 1798, 1225, 1406,
-    1287, 2903, 3015, 1179, -463, 1126, 358, 23, -1888, -385, 537, 2120,
-    598, 366, -249, 349, 1506, 176, -878, 515, -23, -519, -552, 792,
-    827, -635, 212, 845, 1277, 1887, 2859, 3451, 3522, 1332, 1822, 1609,
-    2652, 2436, 1183, 1299, 2573, 1300, 927, 634, 797, 461, 1278, -572,
-    -1386, -91, -792, -1455, -2597, -3359, -2176, -1617, -1128, -1032, -464, -2033,
-    -810, -1047, -1596, -2276, -2689, -1645, -2221, -1981, -895, -2288, -1296, -707,
-    1136, -920, 681, 2809, 2121, 1779, 1073, 139, 1952, 453, -646, 235,
-    1385, 2112, 1977, 2905, 2007, 1100, 673, 1984, 1582, 479, -627, -2061,
-    -1580, -2253, -1658, -2315, -1398, -1628, -1233, -2526, -2913, -2136, -1773, -1789,
-    -2398, -3744, -2228, -3074, -2675, -3541, -1426, -2890, -1753, -481, 148, -739,
-    1188, 1339, 1007, -617, -998, -400, 1209, 1066, 384, 1798, 2563, 2800,
-    2158, 3141, 1138, 89, 552, 1733, -1062, -245, -217, 117, 1301, -460,
-    -2057, 49, -618, -781, -317, 1414, 1372, -1259, -3205, -2987, -1830, -2318,
-    -3677, -3015, -934, -1509, -3030, -1507, -314, -1907, -1226, 401, 687, 2727,
-    230, -190, 494, 409, 555, 1398, 2705, 1686, 2700, 3008, 1902, 1975,
-    2908, 1499, 855, 1337, 1112, 3228, 1657, 2080, 1012, -876, 149, -1241,
-    219, 2875, 2447, 261, 1632, 1729, 985, -622, 334, 245, -940, -1016,
-    -1625, 1703, 1692, -375, -243, 1116, 2342, 1263, 1743, 3613, 1924, 1321,
-    905, 1013, 2235, 1934, 3855, 4445, 3188, 1996, 1632, 1705, 1788, 2661,
-    2599, -213, 839, 3247, 2376, 2083, 1561, 2927, 1773, 483, -121, 976,
-    2879, 2796, 645, 1939, 2137, 363, 529, 714, -1290, 614, 580, 316,
-    -820, -290, 1421, 2457, 1907, 1752, 3247, 1034, 1227, 1794, 1636, 3183,
-    3067, 2744, 3111, 3567, 2720, 3398, 2355, -688, 886, 2789, 1917, 943,
-    -563, 315, -478, -1184, 1942, 2409, -133, 299, 797, -926, -1121, -3065,
-    -2193, 188, -1417, -2884, 360, 456, -1608, 258, 1109, 2597, 2660, 1474,
-    1540, 2729, 63, 1672, 1687, 1888, 1082, 2900, 3297, 1430, 2809, 3484,
-    2614, 2044, 949, 274, 684, -86, -1046, -1444, -427, -3033, -2785, -3199,
-    -2186, -3474, -2283, -1969, -1836, -2794, -3170, -3591, -4235, -3731, -5029, -3971,
-    -3413, -3947, -3017, -1455, -1076, -1798, -583, -1615, 343, 624, -300, -1098,
-    -244, 90, -131, -8, 849, 145, 1783, 1657, 1015, 444, -93, 253,
-    10, -38, 449, -1364, -640, -1706, -2326, -3410, -2819, -2089, -2778, -3673,
-    -1259, -2119, -3604, -3949, -3906, -5501, -4501, -4525, -4222, -4511, -2143, -1001,
-    -2706, -2287, -1061, -2018, -2789, -1599, 690, 1520, -615, -1727, -337, 728,
-    -2624, -104, 1646, 1240, -439, 935, 938, 789, -624, -1247, -371, -1057,
-    -2317, -1162, 23, -919, -1736, -3273, -2694, -3771, -1783, -368, -2459, -2441,
-    -1246, -3478, -3563, -5003, -2313, -3190, -3343, -2991, -2828, -2365, -2927, -1403,
-    494, -554, -2395, -1435, -295, 426, 134, -381, -146, 209, 491, 454,
-    350, 2831, 1933, 1251, 3114, 2090, 1527, 2103, 1927, 527, 2851, 1706,
-    1320, 961, 916, 293, 828, 1424, 181, -428, 1840, 966, -377, -609,
-    -405, -2339, -2362, -2312, -1450, -474, -459, 397, 518, 2135, 825, 1336,
-    1929, 2134, 253, 1919, 1471, 1420, 1929, 2587, 3394, 2835, 2768, 2743,
-    2066, 2211, 402, 296, 507, 1334, 1005, 1671, 2005, 219, 2478, 2404,
-    2639, 1537, -127, 522, 2283, 981, 2183, 3162, 3057, 1440, -290, 97,
-    1968, 583, -225, 79, -557, -1537, -522, 540, 422, 1573, 1103, -522,
-    1006, 2764, 1545, 2097, 2237, 3652, 3363, 3555, 2522, 1272, 2327, 1650,
-    1998, 2574, 2401, 2402, 2894, 1467, 1071, 457, 148, 1404, 593, -298,
-    1454, 609, -1299, 470, 40, -1895, -1020, -839, -557, -972, 889, 1183,
-    1005, 1177, 1794, 2334, 1741, 1879, 1249, 1639, 99, 158, 1974, 2164,
-    3507, 2376, 1837, 3341, 4045, 2140, 1887, 1942, 640, 455, -765, -976,
-    1, -362, -2207, -1398, -2073, -2275, -931, 1230, -2859, -3184, -3380, -2433,
-    -3590, -1896, -2325, -3280, -2905, -2019, -3126, -2738, -2886, -70, 251, 497,
-    -1114, -1242, 487, 1616, 1011, 43, 397, 1102, 386, 733, 996, 1095,
-    539, 1363, 983, 873, 1415, 1349, 176, -49, 1292, -637, -1320, -1345,
-    -1215, -3044, -2132, -1115, -1398, -3245, -2089, -1781, -1903, -3160, -2584, -1414,
-    -2807, -1826, -2012, -3281, -1920, -1306, -535, -202, -288, -228, -306, -203,
-    -1256, -667, -57, 250, -489, -820, -249, 834, 502, -165, 1045, 821,
-    1039, -1055, 81, 1161, -1311, -500, 294, 372, -526, -510, -445, -557,
-    -1634, -2066, -3346, -2059, -1534, -245, -1333, -2351, -2824, -2521, -3644, -2312,
-    -2258, -3070, -3326, -2525, -583, -745, -1290, -392, 392, 40, 263, -1293,
-    -787, 470, 191, 931, 2148, 866, 575, 2420, 2308, 2493, 1604, 2643,
-    3010, 2703, 1628, 1051, 1906, 1444, 1220, 1316, 684, 760, 83, 947,
-    2622, 1777, 2516, 1226, 1286, 1855, 255, -833, -503, 46, -722, 810,
-    683, -455, 682, 988, 155, 1326, 1999, 1639, 2588, 470, -944, 1112,
-    2494, 1630, 3818, 5867, 5081, 2909, 2403, 1866, 2784, 2590, 1295, 1996,
-    1809, 1983, 1942, 2411, 1479, 614, 691, -253, -329, 290, 846, 1258,
-    1991, 1137, 980, 6, 98, -1353, -1009, -1166, -677, -908, -223, -144,
-    -14, 1579, 1168, 669, 1258, 160, 79, 415, 457, 1805, 2268, 2154,
-    3302, 2112, 1838, 1927, 2825, 626, 1031, 1866, 430, 580, 1330, -253,
-    -1226, 19, -1403, -94, -367, -1546, -1418, -1075, -1458, -909, -1586, -2308,
-    -1198, -1528, -618, 48, -308, -1334, -262, 1856, 2050, 2174, 2005, 1156,
-    1551, 1075, 646, 571, 402, 1078, 1814, 1698, 2236, 2336, 2932, 3411,
-    3129, 1964, 1498, 1505, -818, -1936, -1322, -1700, -3870, -3319, -2644, -2174,
-    -2417, -2259, -3778, -3941, -4580, -3876, -3612, -5366, -5674, -5575, -5074, -4764,
-    -3811, -3457, -2864, -2534, -1602, -1033, -415, -480, 710, -427, -2102, -1712,
-    -2254, -1372, -839, 327, -317, -277, -558, -81, 533, 1457, 834, 668,
-    -121, 165, -1187, -1248, -1701, -1135, -2093, -1758, -1210, -1498, -1098, -752,
-    -927, -1525, -1741, -2543, -3411, -2026, -1789, -2732, -3378, -2482, -2657, -2667,
-    -2772, -2574, -1234, -258, -912, -702, -1325, -1109, -782, -1028, -661, -750,
-    -488, 277, 2566, 2021, 914, 336, -74, 169, 412, 215, -414, -822,
-    -811, -574, 42, -691, -2369, -2661, -2562, -1964, -651, -1361, -210, -522,
-    -1517, -1593, -2768, -3080, -1117, -1582, -2272, -1187, -1601, -803, 782, -508,
-    19, -1507, -182, 944, 1310, 880, -107, -334, 408, 729, 1380, 1877,
-    2740, 1976, 1749, 2933, 3522, 2051, 2480, 1977, 2959, 1738, 1377, 2225,
-    1577, 891, 1175, 780, 1097, 2350, 2462, 2890, 1541, 1210, 1697, 1609,
-    1034, 684, -140, 616, -239, 975, 1123, 1277, 1413, 1073, 2897, 3397,
-    2148, 2477, 2822, 833, 357, 1027, 2888, 3795, 4443, 4376, 4476, 4000,
-    2847, 1964, 959, 965, 810, 1163, 1614, 1267, 2019, 1603, 1676, 921,
-    208, 833, 746, 604, 1424, 2656, 2335, 1870, 30, 443, 322, 62,
-    -355, -334, 395, -179, 330, 481, 673, 791, 34, 761, 247, -57,
-    -122, 1401, 1315, 2079, 2993, 3090, 2706, 2573, 2754, 3018, 3164, 2099,
-    2492, 2027, 1764, 1626, 251, 321, 198, 76, 251, -201, -1269, -1153,
-    -1242, -884, -1147, -2054, -1923, -1249, -867, -505, -448, 570, 442, 1425,
-    1267, 1034, 1291, 2171, 2448, 2203, 1696, 2139, 2227, 2275, 3025, 2150,
-    1861, 1875, 1752, 1226, 844, 918, 479, 561, -278, -1111, -640, -1524,
-    -2652, -1913, -3540, -3449, -2881, -3003, -2180, -2720, -3258, -2055, -2936, -3655,
-    -3740, -3968, -3824, -2851, -2365, -2161, -2412, -2862, -3432, -2771, -1713, -2133,
-    -2516, -2454, -2022, -2374, -2319, -1881, -1301, -1389, -660, -1072, 47, -356,
-    -1434, -559, -753, -1602, -710, -943, -569, -935, -699, -1680, -2162, -1081,
-    -1091, -1831, -1385, -907, -1139, -600, -1219, -1387, -811, -391, -647, -1611,
-    -1253, -692, -661, -713, -654, -523, -1206, -1218, -975, -1699, -1532, -1696,
-    -707, -951, -1609, -1204, -758, -1601, -1329, -1439, -1354, -1285, 199, 202,
-    -253, -966, -545, -182, -165, 396, 261, 38, 163, 199, -14, -750,
-    -835, -862, 241, 480, -603, -1128, -1194, -1229, -964, -781, -734, -1031,
-    -937, -1056, -528, -1947, -1481, -672, -565, -1409, -1074, -1423, -801, -990,
-    -410, -480, 558, -332, 205, 447, 224, -26, 513, -22, 16, 170,
-    778, 1073, 703, 1214, 1603, 857, 1480, 1627, 1639, 1567, 1708, 1302,
-    1763, 2835, 2480, 2687, 2745, 1282, 2070, 1877, 1727, 2113, 1292, 924,
-    1526, 1675, 694, 775, 1531, 1450, 589, 627, 1080, 1588, 731, 1315,
-    1191, 1497, 893, 1524, 1232, 1047, 1616, 1492, 1345, 1643, 458, 521,
-    1188, 1400, 1200, 643, 737, 1225, 569, 750, 19, 611, 708, -19,
-    204, 362, 731, 1156, 757, 1226, 1244, 909, 1048, 468, 949, 1068,
-    971, 785, 691, 585, 1247, 1261, 968, 1230, 973, 765, 1009, 1020,
-    617, 427, -14, 832, 469, 647, 1211, 747, -589, -109, -228, -820,
-    -514, -493, 291, 141, -184, -357, 86, 368, 451, 608, 465, 594,
-    450, 392, -9, 188, 675, 108, -202, -20, -374, 123, 423, 50,
-    -232, 228, -22, -60, 231, -39, 175, 736, 423, 456, 432, 78,
-    -34, -334, -514, -646, -1160, -1524, -1588, -1017, -670, -1345, -1362, -1886,
-    -1878, -1460, -2060, -2166, -1942, -2683, -2066, -1619, -1206, -1527, -1879, -1606,
-    -1683, -2067, -2409, -2717, -2447, -2297, -2536, -2480, -2693, -3009, -2272, -2210,
-    -2477, -2235, -3192, -2768, -2480, -1645, -1458, -949, -1602, -1575, -1243, -1007,
-    -772, -1296, -478, 79, -178, -201, -79, -196, -674, -22, 612, 588,
-    533, 203, -206, 590, -40, 7, 29, -457, -388, 468, 194, -141,
-    -611, -765, -807, -83, -816, -968, 85, -62, -1261, -1411, -478, -934,
-    -654, -357, -127, -476, -1116, -1040, -995, -693, -1143, -1290, -822, -1094,
-    -781, -1070, -741, -590, -613, -1116, -768, -781, -282, -418, -292, 83,
-    -172, -112, 39, 341, -128, 504, 612, 187, -435, -12, 14, 205,
-    532, 927, 1035, 937, 708, 701, 621, 338, 75, 719, 891, 565,
-    521, 743, 1286, 1136, 271, 523, 394, 1063, 954, 795, 1340, 1646,
-    969, 1691, 1132, 1139, 1345, 1065, 1167, 1559, 1506, 1731, 1820, 2069,
-    2203, 2094, 1991, 1630, 1659, 2061, 2354, 1709, 1977, 1410, 1833, 2539,
-    2778, 2152, 2215, 1822, 1677, 1953, 1821, 1728, 2042, 2116, 2360, 2226,
-    2172, 1790, 1307, 1337, 1432, 782, 891, 1718, 1016, 869, 769, 241,
-    434, 902, 1304, 1042, 834, 697, 964, 1048, 906, 450, 766, 189,
-    137, 688, 1453, 843, -66, 146, 286, 639, 777, 596, 483, 512,
-    194, -238, -278, 290, 692, 969, 469, 822, 1059, 1269, 411, 467,
-    696, 403, 326, -20, 557, 415, 303, 582, 770, 535, 821, 1101,
-    1271, 943, 1056, 1148, 1141, 1240, 1127, 1188, 584, 802, 1495, 1549,
-    1671, 1495, 672, 249, 461, 442, -40, -11, -1008, -820, -790, -963,
-    -1110, -648, -952, -1076, -985, -664, -1105, -1286, -886, -742, -624, -658,
-    -625, -1097, -1225, -1642, -1627, -1452, -962, -1500, -1717, -1526, -1094, -984,
-    -988, -1183, -1872, -1783, -2301, -2139, -2648, -2186, -2041, -2125, -1764, -1538,
-    -1726, -1773, -1901, -2239, -2360, -2213, -1714, -1831, -1123, -1018, -650, -910,
-    -858, -1335, -1208, -1602, -1323, -1124, -1085, -761, -457, -678, -534, -498,
-    -228, -455, -702, -611, -960, -900, -596, -57, -450, -207, -310, -577,
-    -910, -1294, -1336, -718, -1153, -1247, -1072, -899, -971, -1194, -1328, -1100,
-    -1054, -1215, -1341, -1204, -732, -699, -175, 75, -188, -571, -493, -49,
-    -302, 59, 10, 158, 149, -247, -294, -307, -229, -593, -1107, -978,
-    -747, -616, -425, -245, -1109, -1705, -1570, -1232, -860, -1086, -925, 3,
-    -419, -1199, -1222, -654, 207, 71, -241, -103, -193, -682, -470, -158,
-    93, 420, 302, 886, 565, 102, 278, 1168, 1201, 1100, 497, 468,
-    897, 1392, 1235, 972, 1076, 1148, 923, 1445, 1436, 1846, 2117, 2083,
-    1881, 1625, 1613, 1823, 2333, 2559, 2385, 2734, 1813, 1245, 1401, 1710,
-    1629, 1483, 1335, 1826, 1829, 1569, 1746, 1217, 934, 883, 485, 697,
-    372, 536, 664, 978, 1141, 1341, 1107, 1533, 1280, 1161, 623, 1026,
-    1038, 844, 1072, 771, 853, 972, 1398, 896, 454, 435, 677, 1107,
-    1133, 752, 565, 936, 1046, 1523, 1892, 1522, 1062, 502, -235, 550,
-    425, 357, 358, 139, -227, -406, -639, 42, 46, -62, -205, -210,
-    -104, -418, -35, 269, 16, -15, 12, -464, -458, -139, 235, 500,
-    540, 602, 559, 587, 575, 661, 1166, 1367, 1377, 1267, 1319, 1430,
-    1226, 1164, 1139, 808, 335, 961, 796, 400, 164, 165, 96, -371,
-    -563, -321, -179, -306, -614, -388, -218, -871, -707, -698, -1048, -840,
-    -749, -1103, -1506, -1291, -814, -911, -995, -868, -1107, -1164, -1116, -1268,
-    -2013, -2191, -1917, -1866, -1869, -1580, -1448, -1203, -1577, -2216, -1921, -2069,
-    -1868, -2376, -2203, -2218, -1905, -2046, -1734, -2029, -2481, -2831, -2114, -1573,
-    -1612, -1835, -1710, -1131, -1082, -1180, -1333, -1207, -984, -626, -897, -666,
-    -452, -706, -116, -48, -111, 128, -426, -674, -816, -1066, -526, -585,
-    -480, -305, -281, 58, 277, 200, -397, -575, -658, -955, -1284, -1312,
-    -970, -314, -198, -599, -488, -770, -487, -606, -726, 313, -494, -635,
-    -318, -74, -194, -520, -397, -248, -552, -342, -138, -765, -432, -395,
-    -136, -288, -109, -289, -214, -228, -661, -413, -923, -852, -694, -275,
-    -192, 63, -84, 139, -279, -397, -712, -721, -777, -51, 37, 149,
-    314, 7, 351, 444, 199, -112, -154, -263, 5, 566, 1107, 461,
-    -206, -2, 601, 631, 660, 382, 943, 1085, 946, 1114, 1573, 1884,
-    1450, 1225, 1894, 2116, 1772, 1988, 1794, 2136, 2017, 2531, 3147, 3210,
-    2818, 2570, 2649, 2816, 2105, 1584, 2146, 2302, 2385, 2104, 2364, 1898,
-    1462, 1641, 2211, 1630, 1393, 525, 564, 790, 525, 531, 207, 149,
-    252, 407, 345, 170, -139, 136, 585, 722, 961, 532, 256, 325,
-    288, 484, 898, 679, 670, 1458, 1588, 1171, 1126, 1157, 874, 770,
-    376, 218, 289, 463, 1063, 1196, 609, 501, 89, 208, 137, 528,
-    416, 383, -299, -407, -405, 54, 366, -37, 16, 52, -158, -412,
-    11, 271, 279, 192, 114, 417, 877, 247, 584, 788, 773, 697,
-    572, 665, 607, 900, 598, 571, 327, 342, 287, 770, 468, 533,
-    319, -87, -140, -7, 395, -118, 74, 237, -223, -274, -751, -300,
-    -272, -431, -534, -539, -1036, -667, -296, -440, -522, -995, -792, -862,
-    -1060, -1085, -1297, -887, -1214, -1298, -1153, -1105, -1419, -1700, -1522, -1316,
-    -1595, -2085, -1695, -2313, -2661, -3005, -2946, -2322, -2531, -2896, -2221, -2278,
-    -2004, -2122, -1952, -2195, -2310, -1718, -1588, -1786, -1720, -1977, -1365, -827,
-    -958, -1040, -426, -294, -999, -925, -953, -490, -191, 355, 445, 327,
-    262, -319, -75, 26, 698, 96, 129, 410, 29, -160, 368, 8,
-    676, 65, 266, -241, -1080, -698, -849, -1108, -1105, -513, -270, -487,
-    -620, -1034, -1018, -1061, -1030, -1392, -1190, -1414, -810, -142, -1291, -707,
-    -1106, -1429, -700, 19, -185, -544, -720, -13, -93, 223, -69, 4,
-    -188, -416, -131, 80, 523, 191, 269, 80, -106, -301, -218, -190,
-    -481, -431, 4, 51, 210, 80, -379, -568, 51, -267, 500, 615,
-    648, 405, 589, 259, 518, 300, 440, 664, 79, 1024, 1575, 264,
-    -86, 410, 997, 263, 322, 868, 1559, 1318, 758, 474, 654, 1780,
-    1377, 827, 1235, 847, 1551, 1263, 1476, 1659, 1406, 1771, 1254, 1687,
-    2158, 1393, 1446, 2103, 2629, 655, 1052, 2314, 2699, 1624, 1391, 1618,
-    -55, -526, 329, 1093, 1401, 1658, 1923, 2215, 2823, 1696, 649, 363,
-    292, -939, -1310, -347, 507, 840, -166, -92, 1778, 2102, -47, 376,
-    1325, 1742, 1916, 1027, 1650, 955, -363, -641, -358, -534, -1786, -1394,
-    -693, -1210, -12, 619, 686, -442, -1698, -430, -6, -252, -41, 418,
-    801, 1851, 1990, 1029, 1607, 1648, 1955, 1039, 694, 1332, 1486, 153,
-    -1544, -1058, 270, 1220, 1426, 1603, 107, 717, 416, 215, -520, -2084,
-    -800, -808, -528, -762, -1302, -738, 87, -467, -179, -248, 1850, 2477,
-    1271, 853, 484, -326, 80, 955, 261, 742, 522, 1268, 1390, 1752,
-    1148, 1148, 1391, 633, -530, -205, -232, -621, -531, -1691, -1571, -3531,
-    -2883, -1801, -590, -2312, -3378, -3064, -2996, -3783, -4344, -5124, -4186, -4050,
-    -4007, -3273, -3821, -4081, -2909, -2855, -4064, -2796, -671, -1317, -1214, -1805,
-    -2389, -1910, -2311, -2170, -1113, -1151, 241, 443, 106, 909, 766, -45,
-    -69, -46, 414, 1024, 201, 272, 613, -833, -1674, -1756, -172, -1315,
-    -1246, -831, -323, -1159, -2310, -375, -640, -1809, -1789, -1607, -451, -1967,
-    -1516, -1831, -1281, -1507, -915, -1274, 975, 2014, 900, -156, -500, -717,
-    -436, -597, -1106, 450, 415, 657, 929, 875, 1613, 532, -580, 237,
-    -329, -192, 98, -835, -185, -1886, -2039, -1984, -2599, -1803, -190, 249,
-    -552, 186, -343, -583, -1259, -1934, -734, -1038, -1480, -1499, -433, -135,
-    621, 272, 79, 1883, 2611, 1693, 1923, 855, 164, 1394, 1341, 606,
-    969, 2863, 2289, 2846, 1866, 2117, 2102, 1711, 2811, 1289, 1677, 1608,
-    2389, 1102, 499, -157, -1887, 199, 841, 551, 931, 1868, 2157, 401,
-    -106, -156, -188, -957, -1098, -497, 352, 1158, 1923, 2254, 1454, 1306,
-    4014, 3170, 2520, 2687, 2319, 784, 107, 1501, 3518, 2676, 3903, 4301,
-    4175, 2407, 3339, 2367, 1234, 1203, 2240, 2674, 1484, 1656, 1294, 1335,
-    -52, 1882, 2131, -488, 104, -992, 435, 133, 1146, 153, -939, -1948,
-    -2188, -1008, -2615, -3445, -1673, -287, -2063, -1761, 42, 122, -302, -568,
-    -853, -1079, 389, 619, 1510, 1363, 1669, 2368, 3084, 2757, 2651, 2540,
-    2294, 1685, 1772, 537, 1772, 1901, -51, -983, -237, 1208, 1733, 1986,
-    1424, -134, 138, -133, -894, -2620, -1948, -1191, -1707, -1534, -2111, -910,
-    -173, -152, 541, 548, 654, 495, 1463, -147, -756, -1032, -443, 129,
-    -70, 416, 574, 212, 382, 1146, 744, -213, 9, 569, 696, 173,
-    -1327, -861, -318, -2549, -3590, -2341, -1788, -2598, -1267, -241, -2394, -1916,
-    -2837, -3063, -3871, -4478, -4370, -4393, -4449, -3854, -2604, -1954, -3121, -2804,
-    -1414, -1578, -849, -513, -1020, -1259, -2357, -1559, -2106, -1355, -812, -1692,
-    104, 111, 449, 657, -86, -34, 524, 413, 653, 486, 1478, 1259,
-    -479, -1489, -644, -1591, -1437, 132, 116, 534, -556, -979, -2114, -2464,
-    -1800, -1163, -1402, -1589, -1343, -327, -171, -1305, -502, 502, 22, 698,
-    785, 2045, 412, -174, 667, 293, -713, 484, 39, 356, 1370, 1623,
-    1381, 815, 283, 262, 359, 517, -453, -407, -834, -993, -668, -1940,
-    -1678, -1107, -813, -128, -636, -1023, -1205, -1371, -1458, -2541, -1872, -1274,
-    -1160, -1731, -61, 960, -304, -203, 1576, 1580, 906, 1281, 2875, 2878,
-    3250, 1963, 1457, 1930, 1148, 1567, 2916, 3272, 3463, 3455, 3767, 4282,
-    4169, 4000, 4125, 3525, 1554, 1776, 1771, 1108, 987, 258, 712, 1748,
-    1083, 1260, 457, -254, -278, -518, -2219, -1835, -1188, -365, -698, -880,
-    -451, 107, 66, 485, 31, 1055, 2061, 3283, 2410, 2984, 1866, 714,
-    1444, 2540, 2976, 4424, 5665, 5169, 4270, 3210, 3230, 2154, 2001, 2429,
-    3602, 2898, 2524, 3359, 2686, 1197, 1503, 1398, 652, 1344, 1432, 575,
-    392, 1002, 93, -889, -627, -870, -2074, -2299, -2554, -2750, -2567, -2606,
-    -1794, -1084, -1053, -700, -675, -1571, -1195, -823, -2, 92, 310, -107,
-    276, 986, 1844, 2814, 1291, 1707, 1815, 1310, 272, 1295, 247, -93,
-    674, 153, 652, 840, 1607, 1278, 1307, 1193, -1031, -2136, -1367, -1614,
-    -1308, -2200, -2621, -39, -185, -182, 1757, 2378, 584, -257, 1458, 1397,
-    209, -106, -779, -716, -942, -1106, -1820, -1439, -445, -593, -394, 294,
-    431, -263, -874, -1930, -2559, -3427, -2815, -2975, -4161, -4091, -3210, -3988,
-    -2889, -1810, -2438, -3604, -3921, -4209, -4024, -4484, -4062, -3534, -3908, -4159,
-    -3005, -2732, -2880, -2337, -1187, -684, -1982, -2140, -575, -235, -481, -1188,
-    -617, -1227, -971, -1017, -150, -368, -913, 222, 1879, 735, -268, 510,
-    -85, -1541, -1580, -1645, -951, -1318, -2296, -2723, -2076, -1656, -1603, -1980,
-    -2418, -2215, -2977, -3275, -3571, -2563, -3421, -2490, -2274, -1994, -2338, -2039,
-    -1386, -358, -538, 388, 1916, 816, 436, 900, 860, 1155, 497, 531,
-    1954, 2221, 1419, 2861, 2603, 2712, 2339, 2861, 2293, 2234, 2072, 1004,
-    340, 809, 568, -22, -663, -598, -508, -829, -1119, -1101, -902, -1859,
-    -1671, -1808, -1589, -862, -2155, -1505, -986, -942, -1467, -583, 175, -257,
-    675, 1316, 1027, 1140, 1500, 1949, 1405, 2190, 2755, 2708, 2538, 4675,
-    4368, 4270, 4853, 5831, 5226, 5938, 5538, 5092, 4518, 3607, 2999, 3665,
-    2024, 1765, 1371, 858, 969, 1118, 1173, 671, 1394, 747, -117, 421,
-    -285, -309, -316, -843, -497, -487, -1507, -1586, 155, -601, 50, 1933,
-    2158, 1814, 2366, 2005, 1635, 1844, 1956, 2978, 4848, 4855, 4822, 5187,
-    4393, 3255, 3374, 3115, 2252, 2336, 3881, 3256, 2660, 2701, 2610, 2148,
-    2609, 1238, -530, -1061, -637, 643, 575, -358, -927, -255, -586, -1611,
-    -2037, -1382, -2045, -1523, -609, -1430, -790, -276, -534, -1118, -789, -1786,
-    -1111, 110, 108, -602, -206, 807, 1578, 1501, 861, 2193, 2437, 1279,
-    748, 623, -398, -1655, -1467, -1326, -1568, -967, -243, 668, 1437, 189,
-    -1308, -1192, -905, -1812, -1710, -1504, -1926, -809, 457, -42, -191, 70,
-    325, -164, 192, 937, 1092, -613, -379, -515, -1739, -889, -1033, -445,
-    65, 64, -176, -247, 349, 751, 272, -996, -1676, -2280, -2846, -2941,
-    -2908, -3293, -4370, -3470, -3249, -3310, -3692, -4100, -3959, -4278, -5516, -5089,
-    -4962, -5336, -4670, -4335, -3942, -3570, -3775, -3111, -2922, -2368, -2275, -2857,
-    -1152, -314, -213, -1855, -1033, -966, -732, -1025, -281, 793, 458, 1161,
-    1504, 2327, 2233, 2001, 1381, 1402, 760, 471, -250, -1157, 151, -871,
-    -1831, -1930, -1381, -1249, -1895, -1836, -2553, -2400, -3194, -3574, -3407, -3669,
-    -2542, -2178, -3024, -2136, -1818, -1448, -680, -1036, -1752, -1512, -1475, -371,
-    -669, -1221, -1445, 133, 1060, 1332, 872, 2115, 2221, 2285, 2851, 2732,
-    3066, 2890, 1862, 1868, 1355, 701, 644, 578, 274, 751, 463, -542,
-    -463, -560, -89, -43, -425, -279, 280, -454, -463, 267, -860, -659,
-    -55, 8, 701, 864, 880, 1427, 1564, 1421, 1851, 2729, 1894, 1827,
-    2426, 2452, 2498, 2874, 2687, 3566, 4474, 4773, 4555, 4925, 4488, 4364,
-    5023, 4767, 3589, 3318, 2790, 2629, 2473, 2295, 1756, 1350, 1109, 1556,
-    1493, 1576, 1559, 859, 18, 947, 1178, 664, 546, 863, 771, 449,
-    1628, 765, 1045, 654, 2713, 3250, 3330, 3064, 2287, 1719, 1744, 1624,
-    2324, 3750, 4702, 5283, 4401, 3428, 2579, 1663, 1505, 1304, 696, 979,
-    955, 1190, 1551, 1554, -113, -37, -364, -1415, -1213, -224, 310, 684,
-    926, 727, 93, 527, 369, -520, -526, -42, 346, -544, -1172, -427,
-    -284, -515, -139, -182, -1114, -1511, 1, 788, 524, 460, 1386, 1188,
-    941, 1833, 1842, 1498, 605, 618, 65, -759, -823, -1536, -327, -125,
-    -1120, -1119, -1432, -2141, -2135, -2787, -2796, -2873, -2940, -2773, -2118, -1721,
-    -1850, -1533, -1808, -1816, -2135, -741, -860, -1181, -1097, -583, -684, -1452,
-    -1262, -548, -868, -263, -430, -601, -516, -717, -802, -88, -556, -834,
-    -620, -1255, -2329, -1946, -2254, -3321, -4050, -3668, -3025, -3201, -3794, -3951,
-    -4033, -4426, -4199, -4684, -4013, -3547, -3940, -3324, -3987, -4502, -4009, -3500,
-    -3648, -3998, -3688, -3701, -3981, -3605, -3950, -3583, -3373, -3258, -2917, -2457,
-    -2032, -1638, -1091, -929, -309, -364, 117, 506, -269, -539, -631, -650,
-    346, -363, -569, 457, -35, -222, -175, -639, -618, -769, -2169, -2173,
-    -1153, -1284, -1442, -1303, -1509, -979, 471, 313, -461, -766, -416, -738,
-    -973, -1309, -1034, -964, -488, -656, -844, -899, -854, -413, -402, 222,
-    679, 839, 864, 720, 1023, 675, 887, 843, 702, 997, 547, 553,
-    1160, 941, 1064, 722, 1041, 1113, 727, 1180, 1828, 1895, 1607, 1560,
-    1821, 2384, 2347, 2378, 2034, 2116, 2083, 2240, 2533, 2247, 1284, 1630,
-    1510, 1762, 2496, 2258, 1664, 2201, 2764, 2764, 3284, 2910, 2354, 2516,
-    3462, 3300, 2849, 2770, 3014, 3279, 2708, 2666, 2674, 2267, 2138, 1395,
-    1860, 1977, 1929, 1661, 1600, 2076, 2506, 2748, 2844, 3055, 2599, 2137,
-    1753, 1971, 2234, 2666, 2451, 2143, 2467, 2288, 1978, 1691, 1703, 2389,
-    2397, 1097, 1282, 1300, 1521, 2355, 1825, 929, 1407, 2118, 2178, 1664,
-    1596, 1894, 1919, 1315, 843, 1117, 1185, 996, 115, 279, -479, -597,
-    -188, 218, -211, 22, -174, -217, 18, 672, 841, 379, 362, -49,
-    -235, -275, 175, -555, -221, 201, 79, -115, 148, -262, -368, -610,
-    224, 752, 1230, 687, 567, 656, 473, 85, 365, 893, 76, -21,
-    580, 300, -290, -1046, -1617, -1498, -750, -478, -837, -941, -1234, -782,
-    -599, -805, -409, -699, -1136, -1184, -1171, -1104, -1563, -1837, -2000, -2117,
-    -2001, -2034, -2608, -2761, -2788, -2540, -2237, -1671, -1750, -1303, -946, -726,
-    -1649, -1921, -1413, -1315, -1311, -1310, -1144, -1230, -1168, -1471, -1492, -1537,
-    -2433, -2720, -2862, -3074, -3108, -2849, -2818, -3045, -2670, -1949, -2233, -2458,
-    -3167, -3025, -3044, -2673, -2794, -2819, -2643, -2599, -2451, -2500, -3173, -3279,
-    -3255, -3170, -2510, -2726, -2292, -2039, -1742, -1628, -1336, -1483, -1357, -1170,
-    -1197, -1065, -881, -869, -554, -691, -617, -824, -651, -923, -1274, -1148,
-    -717, -716, -690, -283, -283, 61, 477, 398, 231, 157, -7, -21,
-    -423, -91, -290, -427, -166, -116, 12, -67, -792, -1212, -958, -252,
-    -295, -119, 223, 439, 1162, 1653, 1538, 1159, 1022, 696, 561, 420,
-    344, 725, 257, 45, -194, -436, -1297, -1483, -517, 544, 823, 470,
-    -258, -174, 507, 1064, 1023, 1012, 1233, 1785, 1871, 2365, 2310, 2311,
-    2068, 2377, 2464, 2192, 1874, 1321, 1353, 2018, 2365, 2695, 2942, 3189,
-    3174, 3431, 2787, 2287, 2436, 1995, 2132, 2345, 2604, 2679, 2640, 2922,
-    3172, 3368, 3271, 2333, 1618, 1762, 1856, 1397, 1119, 1196, 1224, 1552,
-    1445, 1322, 1266, 1071, 1149, 979, 1191, 1314, 1211, 1758, 1251, 803,
-    399, 411, 505, 1060, 1691, 1875, 2402, 2449, 2346, 2212, 2330, 1934,
-    2052, 2355, 2285, 1991, 1807, 2205, 2206, 1872, 2074, 2016, 1521, 937,
-    584, 382, 414, 289, 42, -104, -63, 711, 1322, 1007, 716, 724,
-    289, 154, -321, -524, -532, -752, -1227, -1070, -1230, -1299, -1277, -1379,
-    -1493, -1566, -1226, -747, -523, -446, -190, -80, -72, -87, 309, 113,
-    476, 1003, 927, 823, 961, 364, 264, 267, -513, -999, -570, -324,
-    -598, -818, -874, -1069, -906, -770, -1140, -1123, -1035, -902, -979, -1496,
-    -1406, -1395, -1575, -1729, -2017, -2096, -2179, -2039, -1900, -2121, -2166, -1713,
-    -2012, -1787, -2051, -2187, -2210, -2583, -2656, -2410, -2315, -2419, -1763, -1534,
-    -1649, -1756, -1957, -1934, -1948, -2682, -2641, -2404, -2379, -2298, -1921, -2421,
-    -2032, -1654, -1604, -1883, -1721, -1843, -1578, -1455, -1478, -2019, -2367, -2288,
-    -2770, -2843, -2701, -2666, -3164, -3201, -2478, -2044, -2319, -2502, -2304, -2610,
-    -1785, -1123, -987, -671, -706, -756, -559, -480, -1084, -1187, -906, -1160,
-    -1341, -1403, -1524, -1240, -1019, -1139, -1248, -786, -965, -1069, -892, -435,
-    -715, -1096, -1254, -1018, -1034, -603, -150, -264, -258, -397, -457, -271,
-    -371, -431, -635, -642, -310, -229, -46, 124, 42, 273, 566, 643,
-    509, 251, 435, 686, 533, -187, 87, 340, 341, 376, 419, 254,
-    636, 805, 613, 442, 488, 59, 61, 26, 214, 347, 300, 603,
-    991, 1175, 1104, 1297, 1306, 1197, 1462, 1680, 1443, 1848, 2342, 2397,
-    2723, 3243, 3486, 3491, 3508, 3251, 3193, 3352, 2908, 2830, 2559, 2595,
-    3023, 3045, 3128, 3254, 3269, 3101, 2688, 2371, 2206, 2004, 1637, 1799,
-    2123, 1818, 1435, 1499, 1869, 2071, 2233, 2316, 2434, 2521, 2297, 1641,
-    1315, 893, 568, 496, 258, 556, 208, 195, 588, 441, 742, 1152,
-    1115, 719, 832, 1135, 1648, 1897, 1472, 1741, 2186, 1973, 1912, 2340,
-    2425, 2277, 2327, 1738, 1558, 1774, 1844, 1481, 1129, 1064, 1104, 808,
-    1035, 1071, 1129, 657, 427, -69, -333, -49, -365, -281, -358, -422,
-    -74, -172, -37, -333, -564, -74, -238, -509, -404, -827, -1012, -1074,
-    -786, -627, -302, -501, -562, -926, -667, -681, -534, -597, -578, -479,
-    -342, -634, -544, -277, -622, -875, -381, -724, -502, -653, -877, -907,
-    -652, -703, -1113, -1593, -1881, -1661, -1321, -1744, -1658, -1734, -1730, -1733,
-    -1770, -2034, -2337, -2370, -1919, -1795, -2113, -2012, -1871, -1794, -2067, -2303,
-    -2175, -2051, -2024, -2305, -2049, -2155, -2343, -1908, -2086, -2965, -2818, -2309,
-    -2845, -2895, -2869, -2862, -2879, -2814, -2598, -2516, -2299, -2147, -2255, -2389,
-    -2499, -2320, -2106, -2257, -2252, -1851, -2077, -1663, -1964, -2016, -2138, -2119,
-    -2173, -1822, -1266, -1472, -1341, -1257, -826, -705, -950, -1205, -1206, -1186,
-    -838, -639, -538, -938, -636, -629, -607, -623, -240, -149, -436, -741,
-    -475, -1129, -1175, -1235, -1159, -1437, -1972, -2080, -2307, -1800, -1522, -1461,
-    -1505, -823, -736, -857, -773, -515, -470, -269, -223, -128, 294, 655,
-    917, 551, 780, 951, 1413, 1152, 861, 973, 759, 1230, 1872, 1364,
-    1373, 1845, 1266, 1700, 1040, 573, 451, 309, 315, 241, 652, 577,
-    759, 1246, 1001, 935, 1272, 1051, 1033, 1143, 1482, 1556, 1456, 1116,
-    1072, 1283, 1320, 1395, 1409, 1163, 1023, 1427, 2174, 1958, 2072, 2097,
-    2743, 3197, 3107, 3242, 3291, 2761, 3196, 3355, 3617, 4257, 3850, 3443,
-    3178, 3449, 3394, 3205, 2666, 2229, 2351, 2771, 2285, 2677, 2346, 2321,
-    2133, 1468, 1205, 1168, 947, 1440, 1444, 1374, 1044, 1192, 1456, 1254,
-    686, 595, 898, 1149, 1075, 1144, 942, 679, 557, 1085, 1479, 1282,
-    787, 491, 743, 1274, 1063, 1155, 1143, 1186, 1115, 1240, 1479, 1385,
-    1475, 1183, 1067, 835, 1032, 899, 587, 192, 457, 336, 295, 224,
-    152, 167, 51, 442, 2, 429, 590, 37, 260, -262, -480, -679,
-    -410, -343, -358, -228, -329, -523, -233, -254, 178, -89, -736, -524,
-    3, -250, -406, -1186, -1308, -1220, -999, -1152, -1200, -1874, -2191, -2313,
-    -1944, -1972, -2477, -2307, -2241, -1687, -1379, -1855, -1360, -1106, -1274, -1590,
-    -1255, -1491, -1119, -1491, -2253, -2857, -2893, -2375, -1284, -425, -618, -797,
-    -1550, -1951, -1747, -1433, -1729, -1579, -1234, -768, -1555, -2323, -1895, -1736,
-    -1332, -1663, -2078, -1893, -1472, -1189, -488, -1621, -2516, -2208, -2050, -3135,
-    -4238, -4483, -4186, -3148, -2057, -2039, -2597, -2364, -2325, -2784, -3404, -3285,
-    -2945, -2419, -2262, -2239, -2681, -1884, -1898, -1638, -1342, -1608, -710, -361,
-    -455, -248, -119, -8, -159, -343, -328, 69, -543, 159, 986, 1392,
-    1058, 347, 53, -40, -251, -652, -1242, -1502, -1436, -790, -1126, -1872,
-    29, 1861, 279, -1917, -2919, -2032, -1164, -848, -92, 479, 1324, 1808,
-    1415, 602, -494, -809, -283, 3, -338, -1067, -1126, -907, -869, -1403,
-    -2161, -1942, -1583, -2563, -2574, -1849, -1922, -1366, -653, 556, 417, 846,
-    2106, 2193, 2299, 2878, 2554, 2546, 2501, 2668, 2899, 3487, 3369, 4445,
-    4889, 5263, 4603, 4560, 5221, 5552, 5850, 5509, 5600, 5602, 5728, 6406,
-    6409, 5699, 5889, 5427, 5453, 4913, 5217, 6220, 6096, 5501, 4592, 4088,
-    4945, 5183, 5293, 4880, 4916, 4738, 4002, 3051, 2457, 2221, 2327, 1819,
-    1238, 331, -774, -1922, -2010, -2481, -2682, -2932, -3066, -1973, -1196, -1352,
-    -1714, -2422, -3383, -3125, -3336, -2587, -2923, -4118, -4278, -4011, -4556, -5046,
-    -3606, -2740, -2631, -2465, -2259, -2734, -3575, -3924, -3482, -2559, -3056, -2460,
-    -3741, -2539, -2028, -2736, -3748, -4266, -5451, -5193, -4561, -3626, -2879, -2007,
-    -2396, -2455, -1651, -965, -979, -1673, -1351, 88, 929, 982, -9, -485,
-    -587, 241, 590, 1040, 891, 2232, 1445, 1994, 3456, 4000, 2767, 1591,
-    1454, 3362, 3987, 4115, 4550, 3562, 2837, 3484, 4026, 3997, 3832, 4199,
-    4007, 3150, 1661, 241, 1406, 256, -362, -1250, -1314, -1251, -1942, -2468,
-    -1018, -1588, -2400, -3344, -3988, -4021, -4667, -4367, -4017, -4344, -3412, -2836,
-    -1578, -1673, -1997, -1317, -228, -543, -1208, -2305, -3780, -2525, -2272, -2013,
-    -2184, -2424, -1546, -1385, -847, -1032, -534, -1457, -2118, -2544, -3093, -2520,
-    -3097, -3576, -4939, -6054, -5914, -5029, -3500, -2527, -2421, -3265, -4292, -3955,
-    -3628, -3362, -3356, -3406, -3906, -3735, -2858, -3347, -2610, -1565, -1379, -296,
-    1322, 2904, 3897, 3222, 2263, 921, 1396, 2040, 2538, 3901, 4133, 4546,
-    4860, 5039, 5281, 5134, 4940, 4827, 4177, 4921, 4872, 4396, 3597, 2676,
-    1659, 1793, 1173, 1557, 2727, 3335, 3733, 3346, 2906, 2126, 1387, 2041,
-    2201, 1630, 1174, 1498, 2111, 2321, 2123, 1846, 1759, 1841, 1711, 2672,
-    2810, 1877, 804, 172, 187, 989, 845, 358, 54, 87, 9, 1006,
-    866, 1266, 1257, 196, 469, -133, -880, -1280, -2119, -2658, -2802, -3779,
-    -3842, -2821, -2355, -2246, -3081, -3746, -3794, -3674, -2176, -1986, -2180, -2070,
-    -2870, -2890, -2416, -2412, -1925, -384, -235, -561, -360, 45, -284, -650,
-    -824, 1396, 2590, 2324, 1463, 860, -314, -26, 1558, 1760, 1549, 857,
-    1256, 1924, 2714, 2349, 1566, 395, -14, -39, 47, 931, 310, 1138,
-    1797, 1948, 1296, 517, 786, 1956, 2248, 2136, 1522, 946, 667, 518,
-    1354, 1803, 2623, 3797, 3522, 5424, 6965, 7236, 5433, 5532, 3386, 1858,
-    2797, 4632, 5087, 6199, 6360, 6276, 4977, 4641, 4561, 4813, 4353, 4025,
-    3171, 2691, 2121, 2428, 3331, 1516, 1258, 321, -1071, -1098, 324, 1109,
-    1769, 898, 8, -836, -627, -1243, -1894, -1263, -1657, -1764, -1459, -2242,
-    -2106, 576, 1136, 660, -968, -2352, -2884, -2374, -2114, -1399, -1643, -612,
-    714, 613, 105, -694, -985, -1462, -1010, -1036, -972, -1910, -3327, -3910,
-    -4804, -3342, -1553, -2265, -3502, -5031, -5581, -5569, -6265, -5709, -4981, -4190,
-    -3892, -3115, -2876, -2518, -3711, -3132, -2927, -2354, -2126, 327, 181, -34,
-    -320, -965, -486, -613, 482, 655, 369, 416, 621, 1093, 661, 1076,
-    1097, 1321, 2379, 2427, 1953, 1275, 1090, 468, -257, -1010, 77, -120,
-    -82, 124, -278, -495, -147, -310, 191, -31, -110, 254, -98, 323,
-    1221, 1949, 1774, 1674, 2344, 2288, 2619, 3207, 4129, 3416, 4270, 4026,
-    3454, 4657, 4337, 4164, 3878, 3905, 4775, 5058, 4975, 4756, 4254, 4171,
-    4486, 4836, 3825, 3460, 3331, 2167, 159, 144, 1068, 1171, 1422, 1312,
-    1423, 506, -597, -1356, -1088, -761, -156, -645, 221, 372, -268, -603,
-    -612, -246, 342, -661, -785, 538, 1358, 1156, 28, -1203, -2213, -1846,
-    -1614, -1593, -1480, -1305, -1093, -1543, -1820, -2339, -2184, -2126, -2602, -3585,
-    -4176, -3623, -3271, -3604, -5416, -6097, -6185, -6644, -6227, -5585, -4984, -5212,
-    -4997, -4354, -4984, -5281, -5316, -5616, -5592, -5105, -4315, -4245, -4258, -4044,
-    -3216, -2006, -1677, -843, -1286, -1537, -2736, -1837, -958, -1188, -1375, -1779,
-    -2146, -1087, -529, -167, -672, -533, -110, 81, -93, 826, -121, -1341,
-    -3637, -3934, -3644, -3448, -3318, -2259, -2202, -2615, -3414, -3946, -3399, -3227,
-    -2882, -3544, -3102, -2685, -2461, -1878, -910, -842, 104, -668, 172, 1951,
-    2481, 3511, 2760, 529, 378, 966, 2050, 3126, 5050, 6139, 6287, 4182,
-    3363, 1862, 1908, 1485, 2245, 3633, 4295, 4272, 3170, 2715, 3156, 4185,
-    3265, 685, 941, 1322, 2602, 2535, 3465, 2620, 2026, 562, -982, -111,
-    39, 426, 408, 620, 638, 703, 2273, 3039, 1735, 1344, 1115, 1589,
-    1805, 1773, 2172, 2263, 1951, 1965, 2490, 2624, 2062, 1646, 1943, 1983,
-    1885, 1779, 1775, 1705, -145, -293, -5, 132, -133, -405, -1068, -1148,
-    -1942, -1917, -2514, -2317, -2934, -2763, -2186, -922, -664, -989, -87, 237,
-    390, -1154, -1430, -381, -823, -1825, -1142, -1254, -1385, -508, -572, -299,
-    -405, -974, -741, -243, 82, -869, -2336, -2397, -2407, -2058, -2839, -2597,
-    -2763, -4053, -4891, -4675, -4110, -3904, -3371, -2852, -3929, -4995, -5653, -5265,
-    -5799, -5836, -5539, -4939, -3872, -3296, -3088, -3170, -3171, -2567, -1825, -2203,
-    -1262, -753, -916, -1579, -2502, -2256, -1475, -1334, -650, -566, -448, 389,
-    1669, 1211, 709, 641, -9, -9, 461, 134, -9, -497, -1368, -1870,
-    -2336, -1422, -1292, -1368, -30, 151, -907, -1586, -2426, -2586, -2244, -1240,
-    -154, 161, 836, 949, 1228, 724, 99, 119, 71, 619, 1799, 3090,
-    2512, 2206, 2611, 2209, 2526, 2931, 2255, 2769, 2172, 3208, 4336, 4247,
-    4226, 4489, 4694, 4330, 3330, 3510, 2925, 3027, 3709, 3005, 1853, 719,
-    806, 1441, 2398, 2064, 2223, 1403, 1716, 1736, 2287, 2506, 2778, 2403,
-    1419, 1383, 2592, 3957, 4155, 3847, 4513, 4868, 4816, 4637, 3673, 2459,
-    3414, 3962, 4059, 4010, 4510, 4383, 3609, 3387, 3813, 3769, 3783, 4175,
-    3349, 2461, 1808, 1915, 1971, 1578, 1425, -255, -943, -932, -674, 555,
-    298, 568, 609, -176, -1441, -2391, -2905, -2777, -2643, -2572, -2414, -2056,
-    -1402, -573, -136, 48, 1506, 1095, 376, 59, -2313, -4416, -2857, -422,
-    575, 336, 1489, 1986, 1510, 364, -1276, -1991, -2250, -2007, -1688, -1889,
-    -2006, -2573, -3140, -3584, -3743, -2360, -3778, -4060, -4819, -5097, -3921, -4184,
-    -5001, -4090, -3466, -3497, -4347, -4571, -4652, -5304, -5310, -4794, -5211, -5021,
-    -3118, -3660, -3625, -3497, -3857, -4170, -3705, -2511, -2266, -1774, -2015, -1899,
-    -3267, -3053, -2499, -2107, -2040, -1973, -2319, -2151, -2547, -3010, -3124, -3488,
-    -2809, -2289, -1962, -2527, -2391, -2414, -2426, -2292, -2339, -2755, -2803, -2702,
-    -2915, -2407, -2026, -1681, -882, -116, 524, 448, 722, 1275, 1315, 349,
-    -569, -184, 150, 711, 1311, 2309, 2421, 2171, 2558, 2409, 1932, 2018,
-    1688, 2090, 1075, 941, 119, 914, 1291, -26, 11, 683, 678, 700,
-    1206, 696, 617, 1408, 1391, 1034, 161, 98, -279, -119, 236, 785,
-    1809, 2135, 2588, 3533, 4250, 3830, 4344, 4773, 4557, 3859, 4117, 3721,
-    4596, 4456, 4635, 5771, 5402, 4595, 4763, 4291, 4750, 4630, 5103, 5061,
-    4784, 4970, 4510, 4891, 4697, 3984, 2756, 2066, 2872, 3739, 3570, 3734,
-    3672, 3200, 2226, 1033, 637, 1487, 1396, 1068, 1949, 2696, 2999, 3379,
-    3536, 3693, 4257, 3770, 3419, 2810, 3483, 3480, 2985, 2671, 3297, 4079,
-    3939, 3000, 2878, 3394, 3359, 3259, 3169, 2775, 2553, 1711, 1624, 1279,
-    1156, 737, 122, 178, -472, 327, 1199, 787, 858, 112, 208, -471,
-    -1075, -1461, -1313, -1780, -1343, -1102, -990, -806, -499, -500, 216, 459,
-    49, -269, 144, 269, 884, 892, 621, 175, 458, -267, -38, 295,
-    -63, 556, 541, 525, 877, -57, -611, -832, -1233, -1847, -3111, -3315,
-    -4562, -5100, -6202, -4888, -4418, -4220, -3901, -3548, -4104, -4988, -5468, -5198,
-    -5590, -5685, -5415, -4867, -4673, -4348, -4054, -2759, -3754, -3468, -2492, -2486,
-    -2914, -2187, -3309, -3459, -2757, -1951, -1410, -537, -461, -867, -2319, -3296,
-    -3551, -4027, -4324, -3740, -3817, -3684, -3608, -4254, -4182, -3892, -4333, -3401,
-    -5053, -5545, -5310, -3913, -3598, -3880, -3560, -4371, -5007, -4856, -5023, -5264,
-    -4756, -4656, -4237, -4984, -4872, -3689, -3538, -4190, -3804, -4010, -3261, -2457,
-    -2257, -1891, -1030, -1075, -545, -769, -1187, -1926, -2178, -1531, -1540, -1520,
-    -1422, -1351, -1707, -3025, -2998, -2393, -1788, -2772, -2186, -2112, -1887, -2242,
-    -2215, -1860, -1762, -1936, -1145, -593, -992, -354, 93, 243, 662, 1880,
-    1561, 1667, 2726, 2511, 2429, 1108, 1208, 1446, 2162, 2099, 2722, 3276,
-    3701, 3905, 3376, 3170, 3392, 3554, 3035, 3187, 3432, 2088, 2061, 1679,
-    603, 293, 760, 1581, 1789, 2251, 1585, 1367, 926, 871, 298, 576,
-    314, 291, 553, 915, 1540, 2132, 2699, 3297, 3744, 4075, 4192, 3992,
-    5209, 6048, 6536, 6407, 6478, 5404, 5865, 5977, 6093, 6033, 6143, 6027,
-    6819, 7284, 6517, 6550, 5575, 5149, 4888, 4332, 4124, 4024, 2785, 2353,
-    2526, 3146, 3785, 3924, 3746, 3229, 3066, 3181, 3544, 3428, 2773, 2703,
-    2863, 2956, 2703, 2798, 3218, 3596, 3559, 3343, 3552, 4125, 3897, 3916,
-    3832, 3328, 3400, 4126, 4963, 4435, 4151, 4024, 3700, 3856, 3461, 2964,
-    3189, 3564, 3175, 2836, 2563, 2380, 1520, 1119, 1075, 962, 451, 286,
-    288, 477, 90, -146, -47, 455, 48, -775, -930, -1806, -1701, -847,
-    -520, -65, 361, 706, 1270, 1328, 1942, 2022, 2254, 1540, 669, 205,
-    -262, 456, 594, 417, -166, -439, -20, 443, -35, -166, 241, 306,
-    -13, -488, -1027, -1667, -2656, -2914, -3002, -3243, -3646, -2926, -2739, -2630,
-    -3295, -3199, -3329, -3757, -4135, -4425, -4600, -4555, -4228, -4235, -4288, -3535,
-    -2781, -3148, -2844, -1557, -2004, -2720, -2774, -4007, -4457, -3868, -2168, -1924,
-    -935, -90, -887, -2217, -3058, -2440, -3433, -4049, -3850, -3875, -3258, -3270,
-    -3449, -3595, -3407, -3914, -3464, -4676, -5378, -5425, -4465, -3609, -3584, -3053,
-    -3093, -3318, -3901, -4907, -5465, -5046, -4818, -4750, -4839, -5553, -4395, -3999,
-    -4202, -4937, -4588, -4751, -3693, -3653, -3085, -2944, -2733, -2205, -1629, -2099,
-    -2590, -2532, -2441, -3114, -3375, -2931, -2475, -3018, -3562, -3744, -3436, -2714,
-    -2184, -2338, -2315, -2277, -2891, -2930, -3007, -3348, -3304, -3439, -3096, -2365,
-    -2272, -2035, -1366, -952, -678, -1122, -228, 938, 998, 864, 502, 528,
-    397, 1044, 1892, 1446, 1649, 2011, 2048, 1543, 1141, 1018, 974, 952,
-    738, 609, -191, -235, 316, 138, -1033, -1036, -883, -414, 216, -461,
-    -412, -6, -409, -252, -233, -748, -269, -296, -396, 94, 570, 1145,
-    1267, 2335, 2251, 2703, 2966, 3534, 4344, 3839, 3246, 2479, 2635, 2668,
-    2469, 3223, 3542, 4548, 4734, 4950, 4616, 4482, 4248, 4330, 4516, 4609,
-    4392, 4002, 3217, 2972, 2448, 1752, 1892, 2148, 2297, 2718, 2148, 2238,
-    2524, 2613, 1941, 2063, 2381, 2294, 2240, 2639, 3267, 3368, 4087, 4241,
-    4042, 4358, 5025, 5985, 5269, 4697, 3540, 3702, 3589, 3910, 4103, 4667,
-    5169, 5612, 6321, 6419, 6344, 5814, 5343, 4855, 4316, 3620, 3510, 2991,
-    3166, 2396, 2259, 2596, 3609, 4373, 3983, 3730, 3524, 3000, 3102, 3069,
-    2662, 2203, 2374, 2624, 2447, 2105, 1875, 1315, 1465, 2200, 2413, 2866,
-    3193, 3791, 4095, 3303, 3409, 3148, 3326, 3682, 3593, 3120, 2921, 3045,
-    3297, 3054, 2891, 3040, 2722, 2282, 2026, 1503, 1483, 252, 342, 663,
-    323, 510, 877, 1595, 2019, 1174, 725, -72, -1263, -1517, -1455, -1544,
-    -1877, -1988, -1508, -1195, -1052, -132, 338, -350, 1257, 1534, 956, 1072,
-    -163, -1243, -998, -187, 30, 837, 1602, 1623, 629, -305, -1573, -1819,
-    -1826, -2312, -2079, -1283, -1060, -839, -659, -873, -1253, -1357, -1790, -2959,
-    -2659, -2273, -1634, -1296, -1203, -1669, -2333, -2611, -2935, -2712, -3451, -3489,
-    -3817, -3388, -4040, -3827, -3164, -2336, -2221, -2582, -3259, -3173, -2196, -2415,
-    -2347, -2005, -1538, -319, -651, -227, -287, -603, -1431, -2037, -2258, -2401,
-    -2797, -3813, -4464, -4241, -3411, -2853, -3290, -3613, -3915, -3767, -4259, -4562,
-    -4464, -4489, -4497, -4552, -4538, -4396, -3526, -3904, -3580, -3561, -3168, -3029,
-    -3256, -2054, -1755, -1622, -2471, -2940, -2757, -2523, -2298, -1859, -2043, -2324,
-    -1905, -2408, -2105, -2147, -1903, -2628, -2846, -3129, -3570, -3936, -4186, -4920,
-    -4968, -4487, -3668, -4081, -4322, -4531, -4914, -4872, -4933, -5006, -4743, -4913,
-    -5247, -4538, -4388, -4245, -4126, -4132, -4087, -3642, -2752, -1730, -1094, -583,
-    75, -979, -1600, -1931, -2050, -1757, -1682, -1388, -1052, -770, -263, -581,
-    -1059, -827, -1236, -1403, -973, -620, -906, -596, -906, -1754, -2410, -2483,
-    -1892, -1187, -1142, -997, -989, -1583, -2329, -1982, -1962, -2017, -1509, -1449,
-    -480, -764, -1101, -1378, -1447, -1415, -673, -463, 149, 504, 16, 143,
-    123, 625, 1010, 1341, 1473, 2024, 2092, 2443, 2350, 2548, 2875, 2689,
-    2654, 2836, 2294, 1621, 2163, 2048, 1340, 394, 347, 106, 122, 863,
-    1549, 1644, 1974, 1650, 1331, 973, 881, 622, 815, 795, 389, 845,
-    853, 1144, 1801, 2483, 3237, 3860, 4487, 4289, 3645, 3315, 3400, 3387,
-    3425, 3672, 4230, 4688, 4524, 4807, 4650, 4197, 4299, 4221, 4360, 3617,
-    2931, 2448, 2835, 2404, 2211, 2154, 1458, 643, 1725, 2398, 3135, 3242,
-    2745, 2141, 2208, 1838, 1348, 1670, 1709, 2092, 1357, 1592, 2362, 3062,
-    3093, 3632, 5063, 5151, 4828, 5450, 4968, 3595, 3585, 4441, 5149, 5951,
-    6744, 6492, 5367, 4517, 3848, 3606, 3529, 3164, 3658, 3903, 3727, 3814,
-    3580, 3616, 3537, 3532, 2470, 1758, 1722, 2234, 2471, 2615, 2255, 1655,
-    1104, 1103, 782, 830, 988, 495, 898, 821, 382, 668, 2014, 2324,
-    1437, 1502, 2069, 1959, 2064, 2614, 2407, 3315, 3951, 3934, 3832, 3671,
-    3326, 3588, 4261, 3433, 3048, 2695, 2279, 1387, 622, 546, 1030, 1360,
-    1414, 1078, 374, 60, -476, -700, -794, -1260, -1533, -1644, -1426, -857,
-    -283, 9, -81, 14, 33, -329, 384, 1217, 819, 688, 608, 949,
-    155, 374, 1226, 1547, 1601, 1688, 1571, 1363, 1163, 665, 300, -107,
-    -373, 155, -473, -1029, -1509, -2052, -1962, -2001, -1210, -776, -799, -1271,
-    -1491, -2241, -3433, -3535, -3204, -3175, -3786, -3607, -3277, -2606, -2806, -2981,
-    -2652, -2724, -3175, -2866, -1519, -1190, -1499, -2009, -2046, -2789, -2643, -2397,
-    -1901, -948, -608, -369, -510, -417, -350, -640, -1164, -1414, -1851, -1784,
-    -2028, -2540, -2735, -3320, -4037, -4055, -2986, -2708, -2644, -2549, -3030, -3708,
-    -4001, -4463, -5152, -5158, -4776, -4730, -4318, -4214, -3531, -3953, -3801, -4037,
-    -3693, -3206, -3306, -2492, -2716, -3263, -3030, -2873, -2969, -2396, -2102, -1734,
-    -1077, -1059, -1900, -2425, -2198, -2300, -2003, -2389, -2989, -3689, -3492, -3850,
-    -4509, -4655, -5064, -4416, -3893, -3902, -4156, -4057, -4075, -4174, -3993, -4649,
-    -4629, -4735, -5034, -5269, -4745, -4722, -4222, -3947, -4071, -3958, -3182, -2958,
-    -1925, -1958, -2380, -2499, -2228, -1796, -1636, -1227, -1133, -1667, -1786, -1196,
-    -1433, -1545, -1815, -2100, -2705, -2916, -2939, -3309, -3026, -3391, -3485, -3725,
-    -3817, -3628, -3370, -3084, -3115, -2376, -2705, -2968, -3417, -3251, -3809, -3748,
-    -3490, -3026, -2538, -1887, -2244, -1810, -2560, -1391, -437, -553, -1004, -257,
-    -963, -1558, -815, 27, 1017, 2113, 2138, 1722, 1133, 191, 240, -81,
-    -335, -377, 217, 58, 354, 383, 415, 605, 523, 924, -139, -854,
-    -608, -214, 419, 139, -9, -90, -527, -1175, -1164, -1213, -884, -479,
-    -566, -443, -153, 629, 1359, 1531, 1088, 983, 1110, 969, 1647, 2499,
-    3395, 3579, 3293, 3724, 4073, 3349, 3703, 4163, 4177, 3473, 3323, 2911,
-    2362, 1493, 1910, 2665, 2850, 2637, 3042, 2862, 2684, 2397, 1896, 1412,
-    1298, 870, 1250, 1158, 1546, 1840, 1359, 1586, 2097, 2770, 2429, 2981,
-    4076, 4503, 4165, 3495, 3589, 3767, 3404, 3479, 4105, 4884, 4443, 4703,
-    5063, 4964, 4827, 4799, 4430, 4399, 4418, 3503, 3252, 2710, 1599, 1292,
-    1997, 2725, 3191, 3703, 3594, 3096, 2797, 2413, 2340, 1611, 1680, 1924,
-    2048, 2719, 2700, 2390, 3214, 3515, 3559, 3713, 3348, 3408, 4363, 4819,
-    4489, 3910, 3416, 3305, 3303, 4036, 4762, 4772, 4530, 4910, 4608, 4070,
-    3954, 4294, 3977, 3693, 3115, 2476, 2132, 2474, 2195, 1719, 1821, 2195,
-    2497, 2885, 2916, 2453, 2153, 1075, 548, 532, 610, 1088, 1122, 549,
-    690, 1204, 1414, 2313, 2397, 2517, 2756, 3312, 3248, 2721, 2280, 1981,
-    2333, 2500, 2744, 3026, 3137, 3597, 3589, 3378, 3141, 2530, 1998, 1906,
-    1891, 1547, 1188, 569, 574, 55, -380, -847, -1347, -1155, -498, -540,
-    -265, -394, -758, -492, -882, -1433, -1412, -1772, -2142, -1624, -803, -503,
-    -731, -698, -613, -37, 572, 1263, 1041, 243, -555, -134, -86, 399,
-    782, 999, 1215, 1085, 1381, 962, 204, -173, -563, -341, -437, -703,
-    -628, -874, -1733, -2181, -2529, -3102, -3544, -2713, -2441, -2382, -2506, -2453,
-    -3220, -3024, -2946, -3376, -3380, -3200, -3133, -2538, -2584, -2106, -1774, -2148,
-    -1949, -958, -1739, -1812, -1264, -1798, -2473, -2493, -1684, -1082, -329, 114,
-    474, -210, -1415, -2308, -3130, -3302, -3353, -3092, -2651, -2282, -2292, -2230,
-    -2230, -2151, -1837, -3333, -3820, -3461, -3080, -2378, -2202, -1832, -2602, -3437,
-    -4015, -4032, -4078, -4004, -4074, -3945, -3316, -3714, -2975, -2020, -2247, -2917,
-    -3445, -4210, -3510, -2568, -2893, -2096, -1658, -1785, -1388, -1465, -1630, -1378,
-    -1391, -2227, -2517, -2739, -2586, -3208, -3629, -3508, -3134, -3286, -3558, -3518,
-    -3215, -2951, -3654, -4049, -4205, -4116, -4178, -3879, -3794, -4172, -4014, -3063,
-    -2107, -1788, -1521, -1197, -575, -138, -703, -1582, -1886, -2181, -1902, -1689,
-    -1255, -1376, -753, -835, -912, -701, -793, -1586, -1812, -2429, -2680, -3001,
-    -2712, -2499, -2572, -3966, -5071, -4498, -3518, -3274, -2820, -2497, -2740, -3329,
-    -3526, -3395, -3606, -3300, -3244, -3072, -3106, -2570, -1641, -1320, -1058, -835,
-    -1033, -1120, -378, 810, 685, -12, -289, -611, -384, 92, 510, 1018,
-    996, 1169, 855, 507, -1, 145, -131, -495, -668, -1150, -1480, -1511,
-    -1978, -3127, -3067, -2046, -1848, -1616, -1502, -1818, -2257, -2752, -2376, -2498,
-    -2271, -2197, -1799, -1331, -904, -216, 122, 743, 1377, 1362, 1749, 2331,
-    2215, 2169, 1752, 1379, 1589, 1903, 1990, 2512, 2601, 3665, 3974, 3590,
-    2990, 2257, 1886, 1396, 1596, 1499, 1451, 919, 764, 192, -136, -734,
-    -451, -235, -330, -69, 211, -307, -396, 15, 17, -488, -971, -202,
-    -178, 550, 1330, 1564, 2083, 2196, 2285, 3037, 3256, 3442, 3447, 3566,
-    3179, 2859, 2740, 2731, 2783, 2844, 3572, 3347, 3867, 3485, 3140, 2807,
-    2593, 2580, 2059, 2151, 1628, 1731, 1294, 970, 1038, 998, 978, 1606,
-    1542, 1550, 1326, 995, 1319, 1025, 775, 677, 936, 1388, 1687, 1887,
-    2659, 2967, 2573, 3052, 3311, 3051, 3720, 3800, 3139, 3298, 3231, 2198,
-    2110, 3440, 3331, 4007, 4637, 4979, 4003, 3554, 2794, 2206, 1804, 722,
-    1096, 1059, 1004, 2088, 2794, 2368, 1784, 2370, 1333, 538, 892, 1456,
-    1629, 2050, 2176, 1263, 1419, 1377, 1385, 1257, 1653, 1901, 2093, 2583,
-    1265, 2226, 3723, 4012, 3307, 3153, 2075, 2050, 2304, 2631, 3060, 3338,
-    4229, 4069, 3701, 3395, 3355, 3022, 2964, 1967, 2204, 2763, 1236, 954,
-    930, 1188, 1318, 904, 731, 31, 109, -296, -765, -690, -490, -706,
-    -736, -729, 149, 1133, 1332, 1264, 1786, 2308, 2101, 1895, 2372, 3191,
-    3746, 2978, 2207, 2026, 1735, 1854, 2629, 3063, 3194, 2875, 3190, 3753,
-    3275, 2549, 1929, 1556, 1095, 900, 875, 617, -496, -1438, -1383, -1637,
-    -1540, -1034, -664, -919, -1721, -1876, -2400, -3158, -3372, -2891, -2643, -1848,
-    -1260, -1039, -771, -187, 104, -840, -501, -345, -155, 846, 650, -278,
-    -407, -699, -645, -505, 94, 355, 1136, 1410, 668, 470, 217, -282,
-    -715, -809, -903, -1173, -1212, -1603, -1954, -1743, -1303, -1332, -1525, -1844,
-    -2497, -2816, -3193, -4050, -4184, -3836, -3900, -3058, -2439, -2780, -2346, -2220,
-    -2030, -1447, -1015, -1203, -1644, -1224, -303, -852, -1105, -1585, -2022, -1638,
-    -1205, -1036, -627, -67, -128, -72, -191, -340, -638, -1008, -1572, -2541,
-    -2640, -2332, -2498, -2827, -3391, -3494, -4146, -3955, -4073, -2691, -2494, -2774,
-    -2698, -2590, -2603, -2937, -3048, -3300, -3021, -2921, -3472, -3053, -2721, -2453,
-    -1861, -2156, -1340, -1224, -1208, -1682, -2119, -2781, -2371, -2044, -1135, -1037,
-    -514, -188, -212, -178, -606, -989, -1382, -1339, -1814, -2069, -1796, -1718,
-    -2811, -3442, -3139, -3296, -3005, -2794, -2173, -2301, -1944, -2069, -2545, -3083,
-    -3277, -3608, -3297, -3233, -2520, -2207, -2130, -2217, -2169, -1660, -1341, -2187,
-    -1231, 194, -390, -442, -1694, -3160, -2500, -1671, -1687, -227, 1351, 1414,
-    428, -599, -1952, -2616, -2331, -2224, -1846, -1734, -1355, -1031, -874, -1583,
-    -1903, -1251, -1647, -2933, -3337, -2891, -2140, -1554, -1566, -1727, -1825, -2175,
-    -2029, -2007, -1832, -2041, -1436, -1575, -2357, -1475, -1290, -1516, -1289, -1780,
-    -1008, -1158, -843, -464, 85, 354, 1115, 1717, 1491, 1038, 735, 720,
-    64, -347, -479, -372, -884, -1703, -2232, -1702, -1287, -1013, -804, -1081,
-    -1335, -1574, -1804, -1983, -1694, -1286, -890, -923, -790, -752, -464, -254,
-    -486, 214, -89, 310, 1736, 2683, 2557, 1741, 1297, 1122, 405, 716,
-    1567, 1788, 1736, 2446, 2411, 2383, 1801, 2009, 2152, 1645, 1443, 1268,
-    1290, 849, 822, 321, -653, -721, -222, 271, 738, 629, 651, -234,
-    -628, -108, 67, -659, -540, -385, 224, 249, 347, 1003, 679, 1539,
-    1704, 866, 2183, 3106, 2707, 2557, 2063, 1768, 1785, 1823, 2495, 3420,
-    3345, 3118, 3073, 3323, 3316, 2825, 2809, 2155, 1978, 1652, 1045, 1324,
-    1795, 838, 162, 326, 1605, 1659, 2309, 2398, 1649, 862, 522, 684,
-    106, 280, 496, 603, 1199, 1654, 1531, 2469, 2863, 2314, 2366, 2800,
-    3362, 3804, 3537, 2764, 1964, 2176, 2480, 2483, 3475, 4103, 4204, 4480,
-    4199, 3458, 3067, 3122, 2132, 1935, 1884, 1528, 1359, 1129, 809, 156,
-    -55, -398, -519, 368, 659, 1661, 1562, 1203, 721, 866, 382, 984,
-    679, 335, 654, 1084, 1390, 1683, 1718, 1961, 2623, 3843, 3556, 3235,
-    2540, 1796, 1814, 2858, 2995, 3359, 4037, 4744, 4561, 4271, 3832, 3117,
-    2441, 2205, 2443, 2199, 2434, 1717, 1059, 797, 290, 55, -544, -463,
-    -3, 873, 437, 235, -151, -144, 189, -761, -983, -749, -521, -144,
-    18, -467, -313, 362, -79, 41, 1453, 1992, 1473, 1360, 1160, -334,
-    322, 871, 1775, 3847, 4162, 3429, 2859, 2080, 1167, 470, 64, 940,
-    -626, -176, 1523, 1034, 472, -244, -77, 643, -904, -1843, -1581, -1008,
-    -784, -611, 49, 223, -93, -472, -930, -1315, -1361, -1054, -500, -1546,
-    -1193, 266, 820, 468, -81, -431, -841, -849, -95, 857, 1345, 1356,
-    1445, 1652, 1422, 1063, 1027, 194, 117, -264, -451, -345, -1599, -1644,
-    -1561, -1257, -498, -416, -516, -606, -1003, -1548, -1540, -2265, -1968, -2538,
-    -2432, -2168, -1804, -1350, -1618, -1133, -798, -804, -361, -218, 793, 980,
-    744, -16, -508, -666, -703, -526, 139, 507, 811, 1458, 1377, 865,
-    749, -38, 213, -64, -497, -1007, -917, -718, -2253, -3191, -2992, -1953,
-    -1422, -1386, -1270, -2141, -2246, -2530, -2793, -2946, -2660, -2646, -2620, -2323,
-    -2506, -1889, -1864, -1907, -1939, -1583, -1780, -1035, 238, -104, -786, -1402,
-    -1603, -1096, -885, -227, -162, 469, 538, -67, -56, -11, -426, -1185,
-    -949, -1309, -1337, -1369, -1464, -1975, -2643, -2846, -2983, -2013, -2036, -2155,
-    -1384, -1831, -2170, -3142, -3093, -3183, -2720, -2594, -2923, -2165, -2107, -1431,
-    -1762, -783, -1064, -838, -106, 508, 774, 246, -378, -580, -1160, -856,
-    -718, -309, -182, 119, 838, 241, -218, -472, -522, -474, -1051, -1600,
-    -1411, -2165, -2203, -2155, -2392, -2417, -2843, -2750, -3034, -2546, -2530, -1997,
-    -1688, -2191, -2248, -2500, -2903, -2853, -2688, -1982, -1653, -1781, -1561, -1291,
-    -1074, -117, 11, 156, 420, -739, -863, -442, 239, -68, 971, 1204,
-    1734, 1541, 1641, 1191, 816, 694, 88, 38, -39, 466, -286, -1345,
-    -1693, -2168, -1810, -1810, -2399, -1966, -1625, -1171, -1305, -1632, -1463, -1266,
-    -1779, -2241, -2726, -2242, -2194, -2351, -2248, -1856, -822, -586, -1084, 686,
-    1792, 1020, 1026, -39, -568, -880, -417, 1571, 1963, 2257, 2477, 2553,
-    2481, 909, -193, -1139, 285, -246, -1408, 117, 1180, 807, 825, 504,
-    205, -560, -1710, -1301, -714, -86, 129, 54, 362, -182, -208, -922,
-    -1350, -1298, -561, -330, -563, -517, 615, 1242, 1039, 594, 389, 587,
-    923, 1314, 1364, 1761, 2133, 2219, 2480, 2695, 2725, 2669, 2237, 1980,
-    1462, 734, 429, 262, 56, -323, 177, 966, 851, 1322, 1153, 653
-};
-
-#endif // AUDIO_DATA_H_DARUDE_SANDSTORM_AUDIO
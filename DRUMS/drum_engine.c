@@ -0,0 +1,374 @@
+#include <stddef.h>
+#include "drum_engine.h"
+#include "classic_beats.h"
+#include "session.h"
+#include "log_events.h"
+
+static void wake(drum_engine_t *engine) {
+    if (engine->ops && engine->ops->wake) {
+        engine->ops->wake(engine->context);
+    }
+}
+
+static void changed(drum_engine_t *engine) {
+    if (engine->ops && engine->ops->changed) {
+        engine->ops->changed(engine->context);
+    }
+}
+
+// Everything for the audio side goes through here so it wakes up for it
+static void send_audio_cmd(drum_engine_t *engine, audio_cmd_t cmd) {
+    audio_queue_push(&engine->queue, cmd);
+    wake(engine);
+}
+
+// Ask the audio side to play the sound on a pad as soon as it can
+static void play_pad(drum_engine_t *engine, uint8_t pad) {
+    audio_cmd_t cmd = {
+        .time = AUDIO_TIME_NOW,
+        .gain = MIXER_UNITY_GAIN,
+        .type = AUDIO_CMD_TRIGGER,
+        .pad = pad,
+    };
+    send_audio_cmd(engine, cmd);
+}
+
+// Send a loop event to the mixer, it starts on exactly the sample its tick lands on
+static void queue_loop_event(uint8_t pad, uint32_t tick, void *context) {
+    drum_engine_t *engine = context;
+
+    if (pad < MIXER_NUM_PADS) { // if its an actual track
+        audio_cmd_t cmd = {
+            .time = tempo_sample_of(&engine->tempo, tick),
+            .gain = MIXER_UNITY_GAIN,
+            .type = AUDIO_CMD_TRIGGER,
+            .pad = pad,
+        };
+        send_audio_cmd(engine, cmd);
+    }
+}
+
+// Clear all loop events
+static void clear_loop(drum_engine_t *engine) {
+    sequencer_clear(&engine->sequencer);
+    sequencer_set_length(&engine->sequencer, 0);
+    tempo_set_bpm(&engine->tempo, engine->tempo.bpm);  // not locked to a loop any more
+    LOG(LOG_LOOP, LOG_LOOP_CLEARED, 0, 0);
+}
+
+// Play a classic beat instead of the loop, the sequencer reads the pattern
+// straight out of flash so nothing gets copied (see classic_beats.h).
+// The tempo goes to the one the beat was written for, + and - still change it
+static void load_classic_beat(drum_engine_t *engine, uint8_t beat_index) {
+    if (beat_index >= NUM_CLASSIC_BEATS) {
+        LOG(LOG_LOOP, LOG_BEAT_INVALID, beat_index, 0);
+        return;
+    }
+
+    const beat_pattern_t *pattern = &classic_beats[beat_index];
+
+    sequencer_set_pattern(&engine->sequencer, pattern);
+    tempo_set_bpm(&engine->tempo, pattern->bpm);
+
+    LOG(LOG_LOOP, LOG_BEAT_LOADED, beat_index, pattern->steps);
+}
+
+// ---- what the transport asks for ----
+
+static void transport_play_pad(void *context, uint8_t pad) {
+    play_pad(context, pad);
+}
+
+static void transport_assign_sound(void *context, uint8_t pad, uint8_t sound) {
+    drum_engine_t *engine = context;
+    audio_cmd_t cmd = {
+        .time = AUDIO_TIME_NOW,
+        .sound = sound,
+        .type = AUDIO_CMD_SET_SOUND,
+        .pad = pad,
+    };
+
+    send_audio_cmd(engine, cmd);
+    changed(engine);
+    LOG(LOG_PADS, LOG_PAD_SOUND, pad, sample_bank_name(engine->bank, sound));
+}
+
+static void transport_record_start(void *context, uint32_t time) {
+    drum_engine_t *engine = context;
+
+    // the sample clock stands still while the audio is parked
+    wake(engine);
+
+    // so now start keeping track of time,
+    engine->loop_start_sample = sample_clock_at(&engine->clock, time);
+    sequencer_clear(&engine->sequencer); // we don't consider any of the previous loop as important now
+}
+
+// While recording the loop is kept in samples, it gets turned into ticks when recording stops
+static void transport_record_pad(void *context, uint8_t pad, uint32_t time) {
+    drum_engine_t *engine = context;
+    uint32_t triggered = sample_clock_at(&engine->clock, time) - engine->loop_start_sample;
+
+    if (!sequencer_record(&engine->sequencer, triggered, pad)) {
+        LOG(LOG_LOOP, LOG_LOOP_FULL, pad, 0);
+    }
+}
+
+static uint32_t transport_record_stop(void *context, uint32_t time) {
+    drum_engine_t *engine = context;
+    uint32_t loop_samples = sample_clock_at(&engine->clock, time) - engine->loop_start_sample;
+    uint32_t loop_ticks = tempo_samples_to_ticks(&engine->tempo, loop_samples);
+
+    // lock the tempo to the loop so every pass is exactly as many samples as it was
+    // recorded, and every hit comes back on the sample it was recorded on
+    loop_store_scale(&engine->loop_store, loop_ticks, loop_samples);
+    sequencer_set_length(&engine->sequencer, loop_ticks);
+    tempo_lock(&engine->tempo, loop_ticks, loop_samples);
+    LOG(LOG_LOOP, LOG_RECORD_OFF, (uint32_t)((uint64_t)loop_samples * 1000 / engine->tempo.sample_rate), 0);
+    changed(engine);
+    return engine->loop_store.used;
+}
+
+// Play the loop from the top, starting one block from now so the first events arent late
+static void transport_play_start(void *context) {
+    drum_engine_t *engine = context;
+
+    wake(engine);  // the mixer clock doesnt move while parked
+    tempo_start(&engine->tempo, drum_engine_now(engine) + AUDIO_BLOCK_SIZE);
+    sequencer_start(&engine->sequencer, 0);
+}
+
+static void transport_play_stop(void *context) {
+    drum_engine_t *engine = context;
+    sequencer_stop(&engine->sequencer);
+}
+
+static void transport_clear(void *context) {
+    clear_loop(context);
+    changed(context);
+}
+
+static void transport_load_beat(void *context, uint8_t beat) {
+    load_classic_beat(context, beat);
+    changed(context);
+}
+
+static void transport_overdub_start(void *context) {
+    drum_engine_t *engine = context;
+    sequencer_overdub_start(&engine->sequencer);
+}
+
+// Add a hit to the loop while it plays, at the tick that was going out when it was hit
+static void transport_overdub_pad(void *context, uint8_t pad, uint32_t time) {
+    drum_engine_t *engine = context;
+    uint32_t tick = tempo_tick_at(&engine->tempo, sample_clock_at(&engine->clock, time));
+
+    if (!sequencer_overdub(&engine->sequencer, tick, pad)) {
+        LOG(LOG_LOOP, LOG_LOOP_FULL, pad, 0);
+    }
+}
+
+static void transport_overdub_stop(void *context) {
+    drum_engine_t *engine = context;
+
+    LOG(LOG_LOOP, LOG_OVERDUB_OFF, engine->loop_store.num_layers, engine->loop_store.used);
+    changed(engine);
+}
+
+static void transport_undo(void *context) {
+    drum_engine_t *engine = context;
+
+    sequencer_undo(&engine->sequencer);
+    LOG(LOG_LOOP, LOG_LOOP_UNDO, engine->loop_store.num_layers, 0);
+    changed(engine);
+}
+
+static const transport_ops_t engine_transport_ops = {
+    .play_pad = transport_play_pad,
+    .assign_sound = transport_assign_sound,
+    .record_start = transport_record_start,
+    .record_pad = transport_record_pad,
+    .record_stop = transport_record_stop,
+    .play_start = transport_play_start,
+    .play_stop = transport_play_stop,
+    .clear = transport_clear,
+    .load_beat = transport_load_beat,
+    .overdub_start = transport_overdub_start,
+    .overdub_pad = transport_overdub_pad,
+    .overdub_stop = transport_overdub_stop,
+    .undo = transport_undo,
+};
+
+void drum_engine_init(drum_engine_t *engine, const drum_engine_ops_t *ops, void *context,
+                      const sample_bank_t *bank, uint32_t sample_rate, uint16_t bpm, uint8_t beat) {
+    engine->ops = ops;
+    engine->context = context;
+    engine->loop_start_sample = 0;
+
+    // point the sounds at everything in the sample bank
+    engine->bank = bank;
+    engine->num_sounds = 0;
+    if (bank && sample_bank_count(bank) > 0) {
+        uint32_t count = sample_bank_count(bank);
+        engine->num_sounds = count < DRUM_ENGINE_MAX_SOUNDS ? count : DRUM_ENGINE_MAX_SOUNDS;
+        for (uint8_t i = 0; i < engine->num_sounds; i++) {
+            sample_bank_sound(bank, i, &engine->sounds[i]);
+        }
+    }
+
+    audio_queue_init(&engine->queue);
+    loop_store_init(&engine->loop_store, engine->events, LOOP_STORE_EVENTS);
+    sequencer_init(&engine->sequencer, &engine->loop_store);
+    tempo_init(&engine->tempo, sample_rate, AUDIO_BLOCK_SIZE, bpm);
+    sample_clock_init(&engine->clock, sample_rate);
+    mixer_init(&engine->mixer);
+    transport_init(&engine->transport, &engine_transport_ops, engine, engine->num_sounds, NUM_CLASSIC_BEATS, beat);
+}
+
+void drum_engine_load_pads(drum_engine_t *engine) {
+    if (engine->num_sounds == 0) {
+        return;  // nothing sensible to play, the pads just stay quiet
+    }
+    for (int i = 0; i < MIXER_NUM_PADS; i++) {
+        mixer_set_sound(&engine->mixer, i, &engine->sounds[engine->transport.pad_sound[i]]);
+    }
+}
+
+void drum_engine_pad(drum_engine_t *engine, uint8_t pad, uint32_t time) {
+    // start the sound we want to play straight away, the mixer handles the rest.
+    // when picking sounds the transport plays it once the new sound is on the pad
+    if (transport_pad_plays_now(&engine->transport)) {
+        play_pad(engine, pad);
+    }
+
+    // recording it or picking sounds happens in drum_engine_handle
+    transport_post(&engine->transport, TRANSPORT_EV_PAD, pad, time);
+}
+
+bool drum_engine_handle(drum_engine_t *engine) {
+    transport_event_t event;
+
+    if (!transport_pop(&engine->transport, &event)) {
+        return false;
+    }
+
+    transport_state_t before = engine->transport.state;
+    transport_handle(&engine->transport, &event);
+    if (engine->transport.state != before) {
+        LOG(LOG_LOOP, LOG_TRANSPORT, engine->transport.state, transport_state_name(engine->transport.state));
+    }
+    return true;
+}
+
+// Hand out the loop events coming up in the next little while, only the ones actually due get looked at.
+// The tick clock moves on a block at a time and each block gets the events whose ticks land in it
+void drum_engine_schedule(drum_engine_t *engine) {
+
+    // if we are in the playback loop mode
+    if (engine->sequencer.playing) {
+        uint32_t until = drum_engine_now(engine) + DRUM_ENGINE_LOOKAHEAD;
+
+        while ((int32_t)(until - tempo_block_end(&engine->tempo)) >= 0) {
+            sequencer_advance(&engine->sequencer, tempo_block_end_tick(&engine->tempo), queue_loop_event, engine);
+            tempo_advance(&engine->tempo);
+        }
+    }
+}
+
+void drum_engine_set_bpm(drum_engine_t *engine, uint16_t bpm) {
+    tempo_set_bpm(&engine->tempo, bpm);
+    changed(engine);
+}
+
+bool drum_engine_toggle_layer(drum_engine_t *engine, uint8_t layer) {
+    if (layer >= engine->loop_store.num_layers) {
+        return false;
+    }
+    loop_store_mute(&engine->loop_store, layer, !engine->loop_store.layers[layer].muted);
+    changed(engine);
+    return true;
+}
+
+void drum_engine_undo(drum_engine_t *engine) {
+    transport_undo(engine);
+}
+
+bool drum_engine_idle(const drum_engine_t *engine) {
+    return __atomic_load_n(&engine->mixer.live, __ATOMIC_RELAXED) == 0 && !engine->sequencer.playing;
+}
+
+uint32_t drum_engine_save(const drum_engine_t *engine, uint8_t *buf, uint32_t capacity) {
+    const sequencer_t *seq = &engine->sequencer;
+    session_settings_t settings;
+
+    for (int i = 0; i < MIXER_NUM_PADS; i++) {
+        settings.pad_sound[i] = engine->transport.pad_sound[i];
+    }
+    settings.beat = engine->transport.beat;
+    settings.pattern = seq->pattern ? (uint8_t)(seq->pattern - classic_beats) : SESSION_NO_PATTERN;
+    settings.bpm = engine->tempo.bpm;
+    settings.length = seq->length;
+    settings.loop_samples = engine->tempo.locked ? engine->tempo.den : 0;
+
+    return session_save(buf, capacity, &settings, &engine->loop_store);
+}
+
+bool drum_engine_restore(drum_engine_t *engine, const uint8_t *data, uint32_t length) {
+    session_settings_t settings;
+
+    if (!session_load(data, length, &settings, &engine->loop_store)) {
+        return false;
+    }
+
+    // the sample bank might have changed since, only keep sounds that are still there
+    for (int i = 0; i < MIXER_NUM_PADS; i++) {
+        if (settings.pad_sound[i] < engine->num_sounds) {
+            engine->transport.pad_sound[i] = settings.pad_sound[i];
+        }
+    }
+    if (settings.beat < NUM_CLASSIC_BEATS) {
+        engine->transport.beat = settings.beat;
+    }
+    tempo_set_bpm(&engine->tempo, settings.bpm);
+    sequencer_set_length(&engine->sequencer, settings.length);
+    if (settings.loop_samples) {
+        tempo_lock(&engine->tempo, settings.length, settings.loop_samples);
+    }
+    if (settings.pattern < NUM_CLASSIC_BEATS) {
+        sequencer_set_pattern(&engine->sequencer, &classic_beats[settings.pattern]);
+    }
+    return true;
+}
+
+// Apply everything the control side asked for since the last block
+static void apply_audio_commands(drum_engine_t *engine) {
+    mixer_t *mixer = &engine->mixer;
+    audio_cmd_t cmd;
+
+    while (audio_queue_pop(&engine->queue, &cmd)) {
+        // how far into this block (or later blocks) it should start, anything late plays straight away
+        uint32_t delay = 0;
+        if (cmd.time != AUDIO_TIME_NOW && (int32_t)(cmd.time - mixer->clock) > 0) {
+            delay = cmd.time - mixer->clock;
+        }
+
+        switch (cmd.type) {
+        case AUDIO_CMD_TRIGGER:
+            mixer_trigger(mixer, cmd.pad, delay, cmd.gain);
+            break;
+        case AUDIO_CMD_SET_SOUND:
+            if (cmd.sound < engine->num_sounds) {
+                mixer_set_sound(mixer, cmd.pad, &engine->sounds[cmd.sound]);
+            }
+            break;
+        }
+    }
+}
+
+void drum_engine_render(drum_engine_t *engine, int16_t *out, uint32_t n, uint32_t now_us) {
+    // the block rendered last time just started going out
+    sample_clock_anchor(&engine->clock, engine->mixer.clock - AUDIO_BLOCK_SIZE, now_us);
+
+    apply_audio_commands(engine);
+    mixer_render(&engine->mixer, out, n);
+}
@@ -0,0 +1,140 @@
+#ifndef DRUM_ENGINE_H
+#define DRUM_ENGINE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "mixer.h"
+#include "audio_queue.h"
+#include "transport.h"
+#include "tempo.h"
+#include "sample_clock.h"
+#include "loop_store.h"
+#include "sequencer.h"
+#include "sample_bank.h"
+
+// Everything the drum machine does apart from talking to the hardware: the mixer,
+// recording and playing loops, the classic beats, picking sounds and saving all of
+// it. main.c wires the pins, the PWM and the flash up to it on the pico, and the
+// host tools drive the exact same code with made up pad hits on a PC.
+// Times handed in are in us on whatever timer the platform anchors the sample
+// clock with (see drum_engine_render), everything inside is timed in samples.
+// Nothing in here touches the pico hardware so it can also be built on a PC.
+
+// most sounds we take from the sample bank
+#ifndef DRUM_ENGINE_MAX_SOUNDS
+#define DRUM_ENGINE_MAX_SOUNDS 32
+#endif
+
+// how far ahead of the mixer we hand out loop events. they go into the queue with the exact
+// sample they start on, so this just has to cover one block plus a loop timer tick
+#ifndef DRUM_ENGINE_LOOKAHEAD
+#define DRUM_ENGINE_LOOKAHEAD (2 * AUDIO_BLOCK_SIZE)
+#endif
+
+#if DRUM_ENGINE_MAX_SOUNDS > 255
+#error "DRUM_ENGINE_MAX_SOUNDS has to fit in a transport pad_sound"
+#endif
+
+// What the engine needs from the platform. context is the one given to drum_engine_init
+typedef struct {
+    // the sample clock is about to be read or the audio side sent something, so the
+    // audio has to be running. Can be NULL if it always is
+    void (*wake)(void *context);
+    // something worth saving changed (see drum_engine_save), can be NULL
+    void (*changed)(void *context);
+} drum_engine_ops_t;
+
+typedef struct {
+    // the audio side, only drum_engine_render touches the mixer. Everything else sends
+    // it commands through the queue, all from the same side so they count as one producer
+    mixer_t mixer;
+    audio_queue_t queue;
+
+    // which mode we are in (recording, playing, picking sounds...), see transport.c
+    transport_t transport;
+
+    // everything is timed in samples gone out of the speaker, the loop is kept in
+    // ticks and tempo turns them into samples
+    sample_clock_t clock;
+    tempo_t tempo;
+    uint32_t loop_start_sample;  // when recording started
+
+    // the loop itself, 4 bytes a hit split into overdub layers (see loop_store.h), and
+    // the sequencer that plays it only looking at what is due, see sequencer.c
+    loop_event_t events[LOOP_STORE_EVENTS];
+    loop_store_t loop_store;
+    sequencer_t sequencer;
+
+    // every sound the pads can pick from, out of the sample bank
+    const sample_bank_t *bank;
+    mixer_sound_t sounds[DRUM_ENGINE_MAX_SOUNDS];
+    uint8_t num_sounds;
+
+    const drum_engine_ops_t *ops;
+    void *context;
+} drum_engine_t;
+
+// Sounds come from bank (NULL, or one that didnt open, leaves the pads with nothing
+// to play), the tempo starts at bpm and beat is the classic beat the beat select
+// button goes on from. Set a fetch on engine->mixer after this if it needs one, then
+// restore a session if there is one and call drum_engine_load_pads
+void drum_engine_init(drum_engine_t *engine, const drum_engine_ops_t *ops, void *context,
+                      const sample_bank_t *bank, uint32_t sample_rate, uint16_t bpm, uint8_t beat);
+
+// Give every pad the sound the transport has for it
+void drum_engine_load_pads(drum_engine_t *engine);
+
+// ---- the control side, pad and button interrupts and the main loop ----
+// These all push to the audio queue and change the sequencer, so they must not
+// interrupt each other. On the pico they are all core0 interrupts on the same
+// priority, or the main loop with those held off
+
+// A pad was hit at time. It plays straight away and goes to the transport to be
+// recorded (or picked a sound for) by drum_engine_handle
+void drum_engine_pad(drum_engine_t *engine, uint8_t pad, uint32_t time);
+
+// A button or the beat pins, one of transport_event_type_t
+static inline bool drum_engine_post(drum_engine_t *engine, uint8_t type, uint8_t arg, uint32_t time) {
+    return transport_post(&engine->transport, type, arg, time);
+}
+
+// Take the next posted event and do it, false if there wasnt one
+bool drum_engine_handle(drum_engine_t *engine);
+
+// Hand the mixer the loop events coming up, call it at least once a block
+void drum_engine_schedule(drum_engine_t *engine);
+
+// Speed up or slow down the loop, the ticks stay as they are and just go by faster
+void drum_engine_set_bpm(drum_engine_t *engine, uint16_t bpm);
+
+// Mute or unmute an overdub layer, 0 is the first recording
+bool drum_engine_toggle_layer(drum_engine_t *engine, uint8_t layer);
+
+// Throw away the last pass overdubbed
+void drum_engine_undo(drum_engine_t *engine);
+
+// Nothing is playing or about to, the audio could stop and the flash could be erased
+bool drum_engine_idle(const drum_engine_t *engine);
+
+// Sample time of the next block the mixer will render
+static inline uint32_t drum_engine_now(const drum_engine_t *engine) {
+    return __atomic_load_n(&engine->mixer.clock, __ATOMIC_RELAXED);
+}
+
+// ---- the session, main loop only ----
+
+// Write the loop, the pad sounds, the beat and the tempo into buf, returns how many
+// bytes it took or 0 if it didnt fit (see session.h)
+uint32_t drum_engine_save(const drum_engine_t *engine, uint8_t *buf, uint32_t capacity);
+
+// Put a saved session back, before drum_engine_load_pads. False if it wasnt one
+bool drum_engine_restore(drum_engine_t *engine, const uint8_t *data, uint32_t length);
+
+// ---- the audio side ----
+
+// Render the next n samples into out. The block rendered last time started going
+// out at now_us, that anchors the sample clock the pad times are turned into
+// samples with. Call mixer_prefetch on engine->mixer once the block is handed over
+void drum_engine_render(drum_engine_t *engine, int16_t *out, uint32_t n, uint32_t now_us);
+
+#endif // DRUM_ENGINE_H
@@ -0,0 +1,180 @@
+#include <stddef.h>
+#include <string.h>
+#include "flash_log.h"
+
+#define HEADER_BYTES ((uint32_t)sizeof(flash_log_header_t))
+
+// plain crc32 (the zip one) a nibble at a time, 16 entries keeps it small
+uint32_t flash_log_crc32(uint32_t crc, const uint8_t *data, uint32_t length) {
+    static const uint32_t table[16] = {
+        0x00000000, 0x1db71064, 0x3b6e20c8, 0x26d930ac, 0x76dc4190, 0x6b6b51f4, 0x4db26158, 0x5005713c,
+        0xedb88320, 0xf00f9344, 0xd6d6a3e8, 0xcb61b38c, 0x9b64c2b0, 0x86d3d2d4, 0xa00ae278, 0xbdbdf21c,
+    };
+
+    crc = ~crc;
+    for (uint32_t i = 0; i < length; i++) {
+        crc ^= data[i];
+        crc = (crc >> 4) ^ table[crc & 15];
+        crc = (crc >> 4) ^ table[crc & 15];
+    }
+    return ~crc;
+}
+
+static uint32_t header_crc(const flash_log_header_t *header) {
+    return flash_log_crc32(0, (const uint8_t *)header, offsetof(flash_log_header_t, header_crc));
+}
+
+static uint32_t round_up(uint32_t value, uint32_t to) {
+    return (value + to - 1) / to * to;
+}
+
+static uint32_t max_record(const flash_log_t *log) {
+    return (log->size - FLASH_LOG_SECTOR * (FLASH_LOG_ERASE_AHEAD + 1)) / 3;
+}
+
+// Is there a good record starting at offset
+static bool record_ok(const flash_log_t *log, uint32_t offset, flash_log_header_t *header) {
+    memcpy(header, log->base + offset, HEADER_BYTES);
+
+    if (header->magic != FLASH_LOG_MAGIC || header->header_crc != header_crc(header) ||
+        header->length > log->size - offset - HEADER_BYTES) {
+        return false;
+    }
+    return flash_log_crc32(0, log->base + offset + HEADER_BYTES, header->length) == header->data_crc;
+}
+
+void flash_log_init(flash_log_t *log, const flash_log_ops_t *ops, void *context, const uint8_t *base, uint32_t size) {
+    log->ops = ops;
+    log->context = context;
+    log->base = base;
+    log->size = size;
+    log->latest = FLASH_LOG_NONE;
+    log->latest_bytes = 0;
+    log->seq = 0;
+    log->data = NULL;
+    log->erases = 0;
+    log->programs = 0;
+
+    // records always start on a page, so only those need looking at
+    flash_log_header_t header;
+    for (uint32_t offset = 0; offset + HEADER_BYTES <= size; offset += FLASH_LOG_PAGE) {
+        if (log->base[offset] != (FLASH_LOG_MAGIC & 0xFF)) {
+            continue;  // quick way past erased and data pages
+        }
+        // compare by difference so the sequence number can wrap
+        bool newer = log->latest == FLASH_LOG_NONE || (int32_t)(((const flash_log_header_t *)(base + offset))->seq - log->seq) > 0;
+        if (newer && record_ok(log, offset, &header)) {
+            log->latest = offset;
+            log->latest_bytes = HEADER_BYTES + header.length;
+            log->seq = header.seq;
+        }
+    }
+
+    // whatever is after the newest record might be half written, so start
+    // again at the next sector which gets erased before it is used
+    log->head = 0;
+    if (log->latest != FLASH_LOG_NONE) {
+        log->head = round_up(log->latest + log->latest_bytes, FLASH_LOG_SECTOR) % size;
+    }
+    log->erased = 0;
+}
+
+bool flash_log_latest(const flash_log_t *log, const uint8_t **data, uint32_t *length) {
+    if (log->latest == FLASH_LOG_NONE) {
+        return false;
+    }
+    *data = log->base + log->latest + HEADER_BYTES;
+    *length = log->latest_bytes - HEADER_BYTES;
+    return true;
+}
+
+bool flash_log_write(flash_log_t *log, const uint8_t *data, uint32_t length) {
+    if (log->data != NULL || HEADER_BYTES + length > max_record(log)) {
+        return false;
+    }
+
+    log->header.magic = FLASH_LOG_MAGIC;
+    log->header.seq = log->seq + 1;
+    log->header.length = length;
+    log->header.data_crc = flash_log_crc32(0, data, length);
+    log->header.header_crc = header_crc(&log->header);
+
+    // records dont wrap round the end, go back to the start if it doesnt fit
+    uint32_t bytes = round_up(HEADER_BYTES + length, FLASH_LOG_PAGE);
+    if (log->head + bytes > log->size) {
+        log->head = 0;
+        log->erased = 0;
+    }
+
+    log->data = data;
+    log->start = log->head;
+    log->written = 0;
+    return true;
+}
+
+// Erase the sector at head, unless the newest record is in it
+static flash_log_status_t erase_at_head(flash_log_t *log, bool can_erase) {
+    uint32_t sector = log->head + log->erased;
+    if (sector >= log->size) {
+        return FLASH_LOG_IDLE;  // erased right up to the end, wrapping sorts out the rest
+    }
+    if (log->latest != FLASH_LOG_NONE && sector < log->latest + log->latest_bytes &&
+        log->latest < sector + FLASH_LOG_SECTOR) {
+        return FLASH_LOG_FAILED;
+    }
+    if (!can_erase) {
+        return FLASH_LOG_WAITING;
+    }
+
+    log->ops->erase(log->context, sector);
+    log->erased += FLASH_LOG_SECTOR;
+    log->erases++;
+    return FLASH_LOG_BUSY;
+}
+
+flash_log_status_t flash_log_step(flash_log_t *log, bool can_erase) {
+    // nothing to write, get some sectors ready for later instead
+    if (log->data == NULL) {
+        if (!can_erase || log->erased >= FLASH_LOG_ERASE_AHEAD * FLASH_LOG_SECTOR) {
+            return FLASH_LOG_IDLE;
+        }
+        flash_log_status_t status = erase_at_head(log, can_erase);
+        return status == FLASH_LOG_BUSY ? FLASH_LOG_BUSY : FLASH_LOG_IDLE;
+    }
+
+    if (log->erased == 0) {
+        flash_log_status_t status = erase_at_head(log, can_erase);
+        if (status == FLASH_LOG_FAILED) {
+            log->data = NULL;  // newest record is in the way, its too big to save
+        }
+        return status;
+    }
+
+    // the next page is the header and data laid end to end, 0xFF after the end
+    uint32_t total = HEADER_BYTES + log->header.length;
+    memset(log->page, 0xFF, FLASH_LOG_PAGE);
+    for (uint32_t i = 0; i < FLASH_LOG_PAGE && log->written + i < total; i++) {
+        uint32_t at = log->written + i;
+        log->page[i] = at < HEADER_BYTES ? ((const uint8_t *)&log->header)[at] : log->data[at - HEADER_BYTES];
+    }
+
+    log->ops->program(log->context, log->head, log->page);
+    log->programs++;
+    log->head += FLASH_LOG_PAGE;
+    log->erased -= FLASH_LOG_PAGE;
+    log->written += FLASH_LOG_PAGE;
+    if (log->head == log->size) {
+        log->head = 0;
+        log->erased = 0;
+    }
+
+    if (log->written < total) {
+        return FLASH_LOG_BUSY;
+    }
+
+    log->latest = log->start;
+    log->latest_bytes = total;
+    log->seq = log->header.seq;
+    log->data = NULL;
+    return FLASH_LOG_DONE;
+}
@@ -0,0 +1,112 @@
+#ifndef FLASH_LOG_H
+#define FLASH_LOG_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// Keeps records (the saved session) in a region of flash as a log. Every record
+// goes after the last one and the write position goes round the whole region, so
+// every sector gets erased about as often as the others (wear leveling) instead
+// of one sector being erased for every save. Records have a sequence number and
+// CRCs, at boot the newest record that checks out is the one that counts, so
+// losing power halfway through a save just leaves the one before.
+// Writing is done a page at a time by flash_log_step so the caller decides when,
+// and erasing a sector (which takes ages) only happens when the caller says it can.
+// Nothing in here touches the pico hardware so it can also be built on a PC,
+// the flash itself is behind flash_log_ops_t.
+
+#define FLASH_LOG_PAGE 256      // smallest thing flash can program
+#define FLASH_LOG_SECTOR 4096   // smallest thing flash can erase
+
+#ifndef FLASH_LOG_SIZE
+#define FLASH_LOG_SIZE (64 * 1024)
+#endif
+
+// how many sectors flash_log_step keeps erased in front of the write position
+// when it is allowed to erase, so saves can go ahead later without erasing
+#ifndef FLASH_LOG_ERASE_AHEAD
+#define FLASH_LOG_ERASE_AHEAD 2
+#endif
+
+#if FLASH_LOG_SIZE % FLASH_LOG_SECTOR
+#error "FLASH_LOG_SIZE must be a whole number of sectors"
+#endif
+
+#define FLASH_LOG_MAGIC 0x474f4c44  // "DLOG"
+#define FLASH_LOG_NONE 0xFFFFFFFFu
+
+typedef struct {
+    uint32_t magic;
+    uint32_t seq;         // one more than the record before, newest wins
+    uint32_t length;      // bytes of data after the header
+    uint32_t data_crc;    // crc32 of the data
+    uint32_t header_crc;  // crc32 of the fields above
+} flash_log_header_t;
+
+// Biggest record (with its header) that can always be written without erasing
+// the newest one, which has to survive until the new one is complete. A third
+// because the new one might not fit after the newest and go back to the start,
+// in front of it
+#define FLASH_LOG_MAX_RECORD ((FLASH_LOG_SIZE - FLASH_LOG_SECTOR * (FLASH_LOG_ERASE_AHEAD + 1)) / 3)
+
+// offsets are from the start of the region, erase gets whole sectors and
+// program whole pages
+typedef struct {
+    void (*erase)(void *context, uint32_t offset);
+    void (*program)(void *context, uint32_t offset, const uint8_t *page);
+} flash_log_ops_t;
+
+typedef enum {
+    FLASH_LOG_IDLE,     // nothing to do
+    FLASH_LOG_BUSY,     // did a page or an erase, call again
+    FLASH_LOG_WAITING,  // needs to erase but wasnt allowed to
+    FLASH_LOG_DONE,     // the record being written is complete
+    FLASH_LOG_FAILED,   // the record cant fit, it was dropped
+} flash_log_status_t;
+
+typedef struct {
+    const flash_log_ops_t *ops;
+    void *context;
+    const uint8_t *base;   // the region where it can be read, the flash goes here
+    uint32_t size;
+
+    uint32_t latest;       // offset of the newest good record, FLASH_LOG_NONE if none
+    uint32_t latest_bytes; // its size including the header
+    uint32_t seq;          // its sequence number
+    uint32_t head;         // where the next record goes
+    uint32_t erased;       // bytes from head on known to be erased
+
+    // the record being written
+    const uint8_t *data;   // NULL if nothing is being written
+    flash_log_header_t header;
+    uint32_t start;
+    uint32_t written;      // bytes of header and data programmed so far
+    uint8_t page[FLASH_LOG_PAGE];
+
+    uint32_t erases;       // for seeing how hard the flash is worked
+    uint32_t programs;
+} flash_log_t;
+
+uint32_t flash_log_crc32(uint32_t crc, const uint8_t *data, uint32_t length);
+
+// Find the newest good record in the region at base (size bytes, a whole number
+// of sectors). Reads only, nothing is erased or written here
+void flash_log_init(flash_log_t *log, const flash_log_ops_t *ops, void *context, const uint8_t *base, uint32_t size);
+
+// The newest good record, false if there isnt one. data points into the region
+bool flash_log_latest(const flash_log_t *log, const uint8_t **data, uint32_t *length);
+
+// Start writing a record, data has to stay as it is until flash_log_step says
+// DONE or FAILED. False if a write is already going or it is too big
+bool flash_log_write(flash_log_t *log, const uint8_t *data, uint32_t length);
+
+static inline bool flash_log_writing(const flash_log_t *log) {
+    return log->data != NULL;
+}
+
+// Do one page of the record being written, or one sector erase if can_erase
+// allows it. With nothing to write and can_erase it erases ahead instead
+flash_log_status_t flash_log_step(flash_log_t *log, bool can_erase);
+
+#endif // FLASH_LOG_H
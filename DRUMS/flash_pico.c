@@ -0,0 +1,59 @@
+#include "flash_pico.h"
+#include "pico/stdlib.h"
+#include "pico/multicore.h"
+#include "hardware/flash.h"
+#include "hardware/sync.h"
+#include "hardware/regs/addressmap.h"
+#include "xip_stream.h"
+
+#ifndef AUDIO_ON_CORE1
+#define AUDIO_ON_CORE1 0
+#endif
+
+#if FLASH_LOG_PAGE != FLASH_PAGE_SIZE || FLASH_LOG_SECTOR != FLASH_SECTOR_SIZE
+#error "flash_log.h has the wrong flash page or sector size"
+#endif
+
+uint32_t flash_pico_offset(void) {
+    return PICO_FLASH_SIZE_BYTES - FLASH_LOG_SIZE;
+}
+
+const uint8_t *flash_pico_base(void) {
+    return (const uint8_t *)(uintptr_t)(XIP_BASE + flash_pico_offset());
+}
+
+// Get everything off the flash, the other core, our interrupts and the stream DMA
+static uint32_t flash_pico_begin(void) {
+#if AUDIO_ON_CORE1
+    multicore_lockout_start_blocking();
+#endif
+    uint32_t saved = save_and_disable_interrupts();
+
+    // a sound chunk might still be coming out of the flash
+    xip_stream_wait();
+    return saved;
+}
+
+static void flash_pico_end(uint32_t saved) {
+    restore_interrupts(saved);
+#if AUDIO_ON_CORE1
+    multicore_lockout_end_blocking();
+#endif
+}
+
+static void flash_pico_erase(void *context, uint32_t offset) {
+    uint32_t saved = flash_pico_begin();
+    flash_range_erase(flash_pico_offset() + offset, FLASH_SECTOR_SIZE);
+    flash_pico_end(saved);
+}
+
+static void flash_pico_program(void *context, uint32_t offset, const uint8_t *page) {
+    uint32_t saved = flash_pico_begin();
+    flash_range_program(flash_pico_offset() + offset, page, FLASH_PAGE_SIZE);
+    flash_pico_end(saved);
+}
+
+const flash_log_ops_t flash_pico_ops = {
+    .erase = flash_pico_erase,
+    .program = flash_pico_program,
+};
@@ -0,0 +1,22 @@
+#ifndef FLASH_PICO_H
+#define FLASH_PICO_H
+
+#include "flash_log.h"
+
+// flash_log_ops_t for the pico's own flash, the log lives in the last
+// FLASH_LOG_SIZE bytes of it well past the firmware and the sample bank.
+// While the flash is being erased or programmed nothing can run from it, so
+// interrupts on this core are held off and (with AUDIO_ON_CORE1) core1 gets
+// locked out in RAM until it is done. The audio renders from flash on whichever
+// core it is on, so only write while it is parked (audio_out_parked) or it misses
+// blocks: a page program is up to a few ms, a sector erase 45 ms and up to 400 ms
+// on the W25Q16, 15 blocks or more. The pad interrupts wait that long as well, see
+// run_session_save in main.c for when erasing is allowed.
+
+extern const flash_log_ops_t flash_pico_ops;
+
+// Where the log region starts in flash, and where it can be read from
+uint32_t flash_pico_offset(void);
+const uint8_t *flash_pico_base(void);
+
+#endif // FLASH_PICO_H
@@ -0,0 +1,125 @@
+#include "gpio_dispatch.h"
+#include "hardware/gpio.h"
+#include "hardware/irq.h"
+#include "hardware/structs/iobank0.h"
+#include "hardware/structs/systick.h"
+#include "hardware/sync.h"
+
+// SysTick is a 24 bit down counter, audio_out.c might have started it already
+#define GPIO_SYSTICK_MASK 0x00FFFFFFu
+
+// 4 event bits per pin, 8 pins per status register
+#define GPIO_EVENT_BITS 4
+#define GPIO_PINS_PER_REG 8
+#define GPIO_NUM_REGS ((NUM_BANK0_GPIOS + GPIO_PINS_PER_REG - 1) / GPIO_PINS_PER_REG)
+
+static gpio_handler_fn gpio_handlers[NUM_BANK0_GPIOS];
+static io_irq_ctrl_hw_t *gpio_irq_ctrl;
+static gpio_dispatch_stats_t gpio_stats;
+
+// when the edges being handled came in, see gpio_dispatch_held_off
+static uint32_t gpio_edge_time;
+static uint32_t gpio_held_since;
+static bool gpio_held;
+
+static void __isr __time_critical_func(gpio_dispatch_isr)(void) {
+    uint32_t start = systick_hw->cvr;
+    bool first = true;
+
+    gpio_edge_time = gpio_held ? gpio_held_since : time_us_32();
+    gpio_held = false;
+
+    for (uint r = 0; r < GPIO_NUM_REGS; r++) {
+        uint32_t status = gpio_irq_ctrl->ints[r];
+
+        // each set bit is an event, go a whole pin (4 bits) at a time
+        while (status) {
+            uint shift = __builtin_ctz(status) & ~(GPIO_EVENT_BITS - 1);
+            uint32_t events = (status >> shift) & 0xF;
+            uint gpio = r * GPIO_PINS_PER_REG + shift / GPIO_EVENT_BITS;
+            status &= ~(0xFu << shift);
+
+            // clear the edges before the handler so a new edge during it isnt lost,
+            // levels clear themselves when the pin changes
+            iobank0_hw->intr[r] = events << shift;
+
+            if (first) {
+                uint32_t dispatch = (start - systick_hw->cvr) & GPIO_SYSTICK_MASK;
+                if (dispatch > gpio_stats.max_dispatch) {
+                    gpio_stats.max_dispatch = dispatch;
+                }
+                first = false;
+            }
+            gpio_handlers[gpio](gpio, events);
+        }
+    }
+
+    uint32_t cycles = (start - systick_hw->cvr) & GPIO_SYSTICK_MASK;
+    gpio_stats.calls++;
+    gpio_stats.total_cycles += cycles;
+    if (cycles > gpio_stats.max_cycles) {
+        gpio_stats.max_cycles = cycles;
+    }
+}
+
+// Anything that fires without a handler just gets ignored
+static void gpio_ignore(uint gpio, uint32_t events) {
+    (void)gpio;
+    (void)events;
+}
+
+void gpio_dispatch_init(void) {
+    for (uint i = 0; i < NUM_BANK0_GPIOS; i++) {
+        gpio_handlers[i] = gpio_ignore;
+    }
+
+    // each core has its own enable and status registers, use the ones for this core
+    gpio_irq_ctrl = get_core_num() ? &iobank0_hw->proc1_irq_ctrl : &iobank0_hw->proc0_irq_ctrl;
+
+    // count cycles for the stats, leave it alone if the audio is already using it on this core
+    if (!(systick_hw->csr & M0PLUS_SYST_CSR_ENABLE_BITS)) {
+        systick_hw->rvr = GPIO_SYSTICK_MASK;
+        systick_hw->cvr = 0;
+        systick_hw->csr = M0PLUS_SYST_CSR_CLKSOURCE_BITS | M0PLUS_SYST_CSR_ENABLE_BITS;
+    }
+
+    irq_set_exclusive_handler(IO_IRQ_BANK0, gpio_dispatch_isr);
+    irq_set_enabled(IO_IRQ_BANK0, true);
+}
+
+void gpio_dispatch_add(uint gpio, uint32_t events, gpio_handler_fn handler) {
+    gpio_handlers[gpio] = handler;
+    gpio_set_irq_enabled(gpio, events, true);
+}
+
+void gpio_dispatch_remove(uint gpio, uint32_t events) {
+    gpio_set_irq_enabled(gpio, events, false);
+    gpio_handlers[gpio] = gpio_ignore;
+}
+
+uint32_t gpio_dispatch_edge_time(void) {
+    return gpio_edge_time;
+}
+
+void gpio_dispatch_held_off(uint32_t since) {
+    for (uint r = 0; r < GPIO_NUM_REGS; r++) {
+        if (gpio_irq_ctrl->ints[r]) {
+            gpio_held_since = since;
+            gpio_held = true;
+            return;
+        }
+    }
+}
+
+void gpio_dispatch_stats(gpio_dispatch_stats_t *stats) {
+    // the interrupt is on this core, just hold it off while we copy
+    uint32_t saved = save_and_disable_interrupts();
+    *stats = gpio_stats;
+    restore_interrupts(saved);
+}
+
+void gpio_dispatch_stats_reset(void) {
+    uint32_t saved = save_and_disable_interrupts();
+    gpio_stats = (gpio_dispatch_stats_t){0};
+    restore_interrupts(saved);
+}
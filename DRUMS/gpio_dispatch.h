@@ -0,0 +1,44 @@
+#ifndef GPIO_DISPATCH_H
+#define GPIO_DISPATCH_H
+
+#include <stdint.h>
+#include "pico/stdlib.h"
+
+// Our own IO bank interrupt handler instead of the SDK's shared gpio callback.
+// It reads the interrupt status registers straight off and calls the handler
+// for each pin from a table indexed by pin number, so a pad doesnt have to wait
+// while we work out which pin it was. Pico only
+
+// Same arguments as the SDK gpio callback, events are GPIO_IRQ_* bits
+typedef void (*gpio_handler_fn)(uint gpio, uint32_t events);
+
+typedef struct {
+    uint32_t calls;          // times the interrupt ran
+    uint32_t max_cycles;     // slowest run, handlers included
+    uint32_t max_dispatch;   // most cycles from entering the interrupt to calling a handler
+    uint64_t total_cycles;
+} gpio_dispatch_stats_t;
+
+// Take over the IO bank interrupt on this core, call before adding any pins
+void gpio_dispatch_init(void);
+
+// Call handler on these events for this pin, and turn the interrupt on for it
+void gpio_dispatch_add(uint gpio, uint32_t events, gpio_handler_fn handler);
+
+// Turn those events off again and stop calling anything for the pin
+void gpio_dispatch_remove(uint gpio, uint32_t events);
+
+// When the edge being handled came in, for the handlers to use. Normally that is
+// when the interrupt started, unless gpio_dispatch_held_off says otherwise
+uint32_t gpio_dispatch_edge_time(void);
+
+// Interrupts on this core have been off since the time given (us), call it before
+// turning them back on. An edge that came in meanwhile waited all that time for its
+// handler, the next gpio_dispatch_edge_time counts from since, the worst it could be
+void gpio_dispatch_held_off(uint32_t since);
+
+// Timing of the handler so far, and start again
+void gpio_dispatch_stats(gpio_dispatch_stats_t *stats);
+void gpio_dispatch_stats_reset(void);
+
+#endif // GPIO_DISPATCH_H
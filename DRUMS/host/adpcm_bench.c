@@ -0,0 +1,140 @@
+// Host benchmark for the IMA ADPCM song clips.
+// Checks how close the decoded rick roll clip is to the original int16 one,
+// that seeking to any block gives the same samples as decoding straight
+// through, and how much decoding costs per sample compared to plain PCM.
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#include "adpcm.h"
+#include "mixer.h"
+#include "bank_file.h"
+
+// the original int16 clip from the converter, the adpcm one comes out of the
+// sample bank the firmware uses
+#include "../../song_conversion/rick_roll.h"
+
+#define CLIP_LENGTH (sizeof(rick_roll_audio) / sizeof(rick_roll_audio[0]))
+#define BENCH_SAMPLES 4000000
+
+static int16_t decoded[CLIP_LENGTH];
+static const uint8_t *rick_roll_adpcm;
+static uint32_t rick_roll_adpcm_bytes;
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void check_quality(void) {
+    adpcm_state_t state;
+    adpcm_seek(&state, rick_roll_adpcm, 0);
+    adpcm_decode(&state, rick_roll_adpcm, 0, decoded, CLIP_LENGTH);
+
+    double signal = 0, noise = 0;
+    int32_t worst = 0;
+    for (uint32_t s = 0; s < CLIP_LENGTH; s++) {
+        int32_t err = decoded[s] - rick_roll_audio[s];
+        signal += (double)rick_roll_audio[s] * rick_roll_audio[s];
+        noise += (double)err * err;
+        if (abs(err) > worst) {
+            worst = abs(err);
+        }
+    }
+
+    printf("clip: %zu samples, %zu bytes pcm, %u bytes adpcm (%.2fx smaller)\n",
+           CLIP_LENGTH, sizeof(rick_roll_audio), rick_roll_adpcm_bytes,
+           (double)sizeof(rick_roll_audio) / rick_roll_adpcm_bytes);
+    printf("snr: %.1f dB, worst sample error: %d\n", 10 * log10(signal / noise), worst);
+
+    // any seek point has to land on exactly what a straight decode gives
+    uint32_t mismatches = 0;
+    srand(1);
+    for (int i = 0; i < 1000; i++) {
+        uint32_t position = (uint32_t)rand() % (CLIP_LENGTH - 64);
+        int16_t out[64];
+        adpcm_seek(&state, rick_roll_adpcm, position);
+        adpcm_decode(&state, rick_roll_adpcm, position, out, 64);
+        for (int s = 0; s < 64; s++) {
+            mismatches += out[s] != decoded[position + s];
+        }
+    }
+    printf("seek: %u mismatched samples over 1000 random seeks\n", mismatches);
+}
+
+static double bench_decode(void) {
+    static int16_t out[AUDIO_BLOCK_SIZE];
+    adpcm_state_t state;
+    uint32_t position = 0;
+    volatile int16_t sink = 0;
+
+    double start = now_ns();
+    for (uint32_t s = 0; s < BENCH_SAMPLES; s += AUDIO_BLOCK_SIZE) {
+        if (position + AUDIO_BLOCK_SIZE > CLIP_LENGTH) {
+            position = 0;
+        }
+        if (position == 0) {
+            adpcm_seek(&state, rick_roll_adpcm, 0);
+        }
+        adpcm_decode(&state, rick_roll_adpcm, position, out, AUDIO_BLOCK_SIZE);
+        sink = out[0];
+        position += AUDIO_BLOCK_SIZE;
+    }
+    (void)sink;
+    return (now_ns() - start) / BENCH_SAMPLES;
+}
+
+static double bench_mixer(const mixer_sound_t *sound, int voices) {
+    static mixer_t mixer;
+    static int16_t pcm[AUDIO_BLOCK_SIZE];
+
+    mixer_init(&mixer);
+    mixer_set_sound(&mixer, 0, sound);
+
+    double start = now_ns();
+    for (uint32_t s = 0; s < BENCH_SAMPLES; s += AUDIO_BLOCK_SIZE) {
+        if (mixer.live == 0) {
+            for (int i = 0; i < voices; i++) {
+                mixer_trigger(&mixer, 0, 0, MIXER_UNITY_GAIN);
+            }
+        }
+        mixer_render(&mixer, pcm, AUDIO_BLOCK_SIZE);
+        mixer_prefetch(&mixer);
+    }
+    return (now_ns() - start) / BENCH_SAMPLES;
+}
+
+int main(void) {
+    sample_bank_t bank;
+    if (!bank_file_open(&bank, DRUMS_SAMPLE_BANK_PATH)) {
+        return 1;
+    }
+
+    int index = bank_file_find(&bank, "Rick Roll");
+    const sample_bank_entry_t *entry = index < 0 ? NULL : sample_bank_entry(&bank, (uint16_t)index);
+    if (entry == NULL || entry->format != MIXER_FORMAT_ADPCM || entry->length != CLIP_LENGTH) {
+        fprintf(stderr, "no adpcm Rick Roll clip matching song_conversion/rick_roll.h in the bank\n");
+        return 1;
+    }
+
+    mixer_sound_t adpcm_sound;
+    sample_bank_sound(&bank, (uint16_t)index, &adpcm_sound);
+    rick_roll_adpcm = adpcm_sound.data;
+    rick_roll_adpcm_bytes = entry->bytes;
+
+    const mixer_sound_t pcm_sound = {rick_roll_audio, CLIP_LENGTH, MIXER_FORMAT_PCM16};
+
+    check_quality();
+
+    printf("\ndecode only: %.2f ns per sample\n", bench_decode());
+    printf("\nns per output sample, block of %d\n", AUDIO_BLOCK_SIZE);
+    printf("voices       pcm     adpcm\n");
+    for (int voices = 1; voices <= 4; voices++) {
+        printf("%6d  %8.2f  %8.2f\n", voices, bench_mixer(&pcm_sound, voices), bench_mixer(&adpcm_sound, voices));
+    }
+
+    return 0;
+}
@@ -0,0 +1,42 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bank_file.h"
+
+bool bank_file_open(sample_bank_t *bank, const char *path) {
+    FILE *f = fopen(path, "rb");
+    if (f == NULL) {
+        fprintf(stderr, "cant open sample bank %s\n", path);
+        return false;
+    }
+
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+
+    // never freed, the sounds point into it for as long as the program runs
+    uint8_t *image = size > 0 ? malloc((size_t)size) : NULL;
+    if (image == NULL || fread(image, 1, (size_t)size, f) != (size_t)size) {
+        fprintf(stderr, "cant read sample bank %s\n", path);
+        fclose(f);
+        free(image);
+        return false;
+    }
+    fclose(f);
+
+    if (!sample_bank_open(bank, image, (size_t)size)) {
+        fprintf(stderr, "%s is not a sample bank we understand\n", path);
+        free(image);
+        return false;
+    }
+    return true;
+}
+
+int bank_file_find(const sample_bank_t *bank, const char *name) {
+    for (uint16_t i = 0; i < sample_bank_count(bank); i++) {
+        if (strcmp(sample_bank_name(bank, i), name) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
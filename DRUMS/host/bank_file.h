@@ -0,0 +1,17 @@
+#ifndef BANK_FILE_H
+#define BANK_FILE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "sample_bank.h"
+
+// Loads DRUMS/sample_bank.bin on the PC so the host tools use the same sounds
+// as the firmware. CMake passes the path in as DRUMS_SAMPLE_BANK_PATH
+
+// Read the bank into memory and open it, prints why and returns false if it cant
+bool bank_file_open(sample_bank_t *bank, const char *path);
+
+// Index of the sound called name, -1 if it isnt in the bank
+int bank_file_find(const sample_bank_t *bank, const char *name);
+
+#endif // BANK_FILE_H
@@ -0,0 +1,202 @@
+// Offline renderer, runs the drum engine (the same mixer, sequencer and transport
+// the firmware runs) on the PC and writes what it plays to a 16 bit WAV at the
+// firmware's sample rate. Drive it with a classic beat, a saved session (a loop
+// dump from --save) and/or a script of pad hits and button presses, see
+// render_script.h for the script format.
+//   drums_render --beat 2 --seconds 60 funk.wav
+//   drums_render --script take.txt --save take.session take.wav
+//   drums_render --session take.session --seconds 3600 hour.wav
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "drum_engine.h"
+#include "session.h"
+#include "classic_beats.h"
+#include "host_platform.h"
+#include "bank_file.h"
+#include "render_script.h"
+#include "wav_file.h"
+
+#define DEFAULT_BPM 120
+#define FIRST_CLASSIC_BEAT 2   // same as main.c
+#define DEFAULT_SECONDS 10     // with no script, or this long past its last event
+#define TAIL_SECONDS 2
+
+static sample_bank_t bank;
+static drum_engine_t engine;
+static script_t script;
+static uint8_t session_buf[SESSION_MAX_BYTES];
+
+typedef struct {
+    wav_file_t wav;
+    bool pwm;     // write what the PWM would put out instead of the mixer output
+    bool failed;
+} output_t;
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void usage(void) {
+    fprintf(stderr,
+            "usage: drums_render [options] out.wav\n"
+            "  --script FILE   pad hits and button presses, see render_script.h\n"
+            "  --beat N        play classic beat N from the start (0 to %d)\n"
+            "  --session FILE  load a saved session and play its loop from the start\n"
+            "  --save FILE     save the session at the end, for --session later\n"
+            "  --seconds S     how much to render, default %d s past the last script event\n"
+            "  --bpm N         tempo to start at, default %d\n"
+            "  --pwm           write the PWM output (%u counts a sample) instead of the mixer output\n"
+            "  --bank FILE     sample bank, default the one built into the firmware\n",
+            NUM_CLASSIC_BEATS - 1, TAIL_SECONDS, DEFAULT_BPM, HOST_PWM_WRAP);
+}
+
+// Read a whole file into buf, false if it isnt there or doesnt fit
+static bool read_file(const char *path, uint8_t *buf, uint32_t capacity, uint32_t *length) {
+    FILE *f = fopen(path, "rb");
+    if (f == NULL) {
+        fprintf(stderr, "cant open %s\n", path);
+        return false;
+    }
+    *length = (uint32_t)fread(buf, 1, capacity, f);
+    bool ok = !ferror(f) && fgetc(f) == EOF;
+    fclose(f);
+    if (!ok) {
+        fprintf(stderr, "cant read %s (or its too big)\n", path);
+    }
+    return ok;
+}
+
+static bool write_file(const char *path, const uint8_t *buf, uint32_t length) {
+    FILE *f = fopen(path, "wb");
+    bool ok = f && fwrite(buf, 1, length, f) == length;
+    if (f && fclose(f) != 0) {
+        ok = false;
+    }
+    if (!ok) {
+        fprintf(stderr, "cant write %s\n", path);
+    }
+    return ok;
+}
+
+static void write_block(const int16_t *pcm, uint32_t n, void *context) {
+    output_t *output = context;
+
+    if (output->pwm) {
+        // the levels go back to 16 bits so the WAV is what GPIO 0 puts out, steps and all
+        uint16_t levels[AUDIO_BLOCK_SIZE];
+        int16_t out[AUDIO_BLOCK_SIZE];
+        mixer_to_pwm(pcm, levels, n, HOST_PWM_WRAP);
+        for (uint32_t i = 0; i < n; i++) {
+            out[i] = (int16_t)((int32_t)levels[i] * 65536 / HOST_PWM_WRAP - 32768);
+        }
+        output->failed |= !wav_file_write(&output->wav, out, n);
+    } else {
+        output->failed |= !wav_file_write(&output->wav, pcm, n);
+    }
+}
+
+int main(int argc, char **argv) {
+    const char *script_path = NULL, *session_path = NULL, *save_path = NULL, *out_path = NULL;
+    const char *bank_path = DRUMS_SAMPLE_BANK_PATH;
+    int beat = -1;
+    long bpm = DEFAULT_BPM;
+    double seconds = 0;
+    output_t output = {.pwm = false, .failed = false};
+
+    for (int i = 1; i < argc; i++) {
+        bool has_value = i + 1 < argc;
+        if (strcmp(argv[i], "--script") == 0 && has_value) {
+            script_path = argv[++i];
+        } else if (strcmp(argv[i], "--beat") == 0 && has_value) {
+            beat = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--session") == 0 && has_value) {
+            session_path = argv[++i];
+        } else if (strcmp(argv[i], "--save") == 0 && has_value) {
+            save_path = argv[++i];
+        } else if (strcmp(argv[i], "--seconds") == 0 && has_value) {
+            seconds = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--bpm") == 0 && has_value) {
+            bpm = atol(argv[++i]);
+        } else if (strcmp(argv[i], "--bank") == 0 && has_value) {
+            bank_path = argv[++i];
+        } else if (strcmp(argv[i], "--pwm") == 0) {
+            output.pwm = true;
+        } else if (argv[i][0] != '-' && out_path == NULL) {
+            out_path = argv[i];
+        } else {
+            usage();
+            return 2;
+        }
+    }
+    if (out_path == NULL || (beat >= NUM_CLASSIC_BEATS) || bpm < TEMPO_MIN_BPM || bpm > TEMPO_MAX_BPM) {
+        usage();
+        return 2;
+    }
+
+    if (!bank_file_open(&bank, bank_path)) {
+        return 1;
+    }
+    drum_engine_init(&engine, NULL, NULL, &bank, HOST_SAMPLE_RATE, (uint16_t)bpm, FIRST_CLASSIC_BEAT);
+
+    // the session goes in before the pads get their sounds, same as booting
+    uint32_t length;
+    if (session_path) {
+        if (!read_file(session_path, session_buf, sizeof(session_buf), &length) ||
+            !drum_engine_restore(&engine, session_buf, length)) {
+            fprintf(stderr, "%s isnt a session this build understands\n", session_path);
+            return 1;
+        }
+    }
+    drum_engine_load_pads(&engine);
+
+    // the beat or the loop starts playing at the top, then whatever the script does
+    script_t *events = NULL;
+    if (script_path) {
+        if (!script_load(&script, script_path, HOST_SAMPLE_RATE)) {
+            return 1;
+        }
+        events = &script;
+    }
+    if (beat >= 0) {
+        drum_engine_post(&engine, TRANSPORT_EV_BEAT_PIN, (uint8_t)beat, host_us(0));
+    } else if (session_path) {
+        drum_engine_post(&engine, TRANSPORT_EV_PLAY, 0, host_us(0));
+    }
+    while (drum_engine_handle(&engine)) {
+    }
+
+    uint64_t samples = (uint64_t)(seconds * HOST_SAMPLE_RATE);
+    if (seconds <= 0) {
+        uint32_t last = events && events->count ? events->events[events->count - 1].sample : 0;
+        samples = events ? last + TAIL_SECONDS * HOST_SAMPLE_RATE : DEFAULT_SECONDS * HOST_SAMPLE_RATE;
+    }
+
+    if (!wav_file_open(&output.wav, out_path, HOST_SAMPLE_RATE)) {
+        return 1;
+    }
+    double start = now_ns();
+    render_script(&engine, events, samples, write_block, &output);
+    double took = (now_ns() - start) / 1e9;
+    if (!wav_file_close(&output.wav) || output.failed) {
+        fprintf(stderr, "cant write %s\n", out_path);
+        return 1;
+    }
+
+    host_log_drain();
+    double audio = (double)samples / HOST_SAMPLE_RATE;
+    printf("%s: %.1f s of audio in %.3f s, %.0fx real time, %u voices started, %u stolen\n", out_path, audio,
+           took, took > 0 ? audio / took : 0, engine.mixer.triggers, engine.mixer.steals);
+
+    if (save_path) {
+        length = drum_engine_save(&engine, session_buf, sizeof(session_buf));
+        if (length == 0 || !write_file(save_path, session_buf, length)) {
+            return 1;
+        }
+        printf("session saved to %s, %u bytes, %u hits\n", save_path, length, engine.loop_store.used);
+    }
+    return 0;
+}
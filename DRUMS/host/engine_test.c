@@ -0,0 +1,135 @@
+// Host test for the whole drum engine, the same code main.c runs on the pico.
+// Records a loop with pad hits at known samples through the buttons and the
+// transport, lets it play for a few passes and checks every hit goes to the mixer
+// on the sample it was recorded on. Then saves the session, puts it back into a
+// fresh engine and checks that plays the same.
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include "drum_engine.h"
+#include "session.h"
+#include "host_platform.h"
+#include "bank_file.h"
+
+#define START_BEAT 2
+#define PASSES 5
+#define MAX_TRIGGERS 64
+
+typedef struct {
+    uint32_t offset;  // samples after record was pressed
+    uint8_t pad;
+} hit_t;
+
+static const hit_t hits[] = {{1000, 0}, {5000, 3}, {5000, 1}, {10001, 4}, {17777, 2}};
+#define NUM_HITS (sizeof(hits) / sizeof(hits[0]))
+#define LOOP_SAMPLES 21050
+
+static sample_bank_t bank;
+static drum_engine_t engine;
+static drum_engine_t restored;
+static uint8_t session_buf[SESSION_MAX_BYTES];
+static int failures;
+
+// every trigger handed to the mixer with a sample time, in the order they were sent
+static audio_cmd_t triggers[MAX_TRIGGERS];
+static uint32_t num_triggers;
+
+// Run the engine block by block until the mixer gets to sample, writing down the
+// loop triggers before the audio side takes them off the queue
+static void run_until(drum_engine_t *e, uint32_t sample) {
+    int16_t pcm[AUDIO_BLOCK_SIZE];
+
+    while ((int32_t)(sample - drum_engine_now(e)) > 0) {
+        drum_engine_schedule(e);
+        for (uint32_t i = e->queue.tail; i != e->queue.head; i++) {
+            audio_cmd_t cmd = e->queue.cmds[i & (AUDIO_QUEUE_SIZE - 1)];
+            if (cmd.type == AUDIO_CMD_TRIGGER && cmd.time != AUDIO_TIME_NOW && num_triggers < MAX_TRIGGERS) {
+                triggers[num_triggers++] = cmd;
+            }
+        }
+        host_render(e, pcm, AUDIO_BLOCK_SIZE);
+    }
+}
+
+// The main loop side, everything posted gets handled
+static void handle_all(drum_engine_t *e) {
+    while (drum_engine_handle(e)) {
+    }
+}
+
+// Every pass should have every hit, on the sample it was recorded on
+static void check_passes(const char *name, uint32_t play_start) {
+    uint32_t expected = 0;
+
+    for (uint32_t pass = 0; pass < PASSES; pass++) {
+        for (uint32_t i = 0; i < NUM_HITS; i++, expected++) {
+            uint32_t want = play_start + pass * LOOP_SAMPLES + hits[i].offset;
+            if (expected >= num_triggers || triggers[expected].time != want ||
+                triggers[expected].pad != hits[i].pad) {
+                printf("FAIL %s: pass %u hit %u wanted pad %u at %u, got pad %u at %u\n", name, pass, i,
+                       hits[i].pad, want, expected < num_triggers ? triggers[expected].pad : 0,
+                       expected < num_triggers ? triggers[expected].time : 0);
+                failures++;
+                return;
+            }
+        }
+    }
+    printf("%s: %u passes, %u triggers all on the sample\n", name, PASSES, expected);
+}
+
+int main(void) {
+    if (!bank_file_open(&bank, DRUMS_SAMPLE_BANK_PATH)) {
+        return 1;
+    }
+
+    drum_engine_init(&engine, NULL, NULL, &bank, HOST_SAMPLE_RATE, 120, START_BEAT);
+    drum_engine_load_pads(&engine);
+    run_until(&engine, 4000);
+
+    // record, hit the pads, stop. Stopping starts it playing one block later
+    uint32_t record_at = 4321;
+    run_until(&engine, record_at);
+    drum_engine_post(&engine, TRANSPORT_EV_RECORD, 0, host_us(record_at));
+    handle_all(&engine);
+    for (uint32_t i = 0; i < NUM_HITS; i++) {
+        run_until(&engine, record_at + hits[i].offset);
+        drum_engine_pad(&engine, hits[i].pad, host_us(record_at + hits[i].offset));
+        handle_all(&engine);
+    }
+    run_until(&engine, record_at + LOOP_SAMPLES);
+    drum_engine_post(&engine, TRANSPORT_EV_RECORD, 0, host_us(record_at + LOOP_SAMPLES));
+    num_triggers = 0;
+    handle_all(&engine);
+    uint32_t play_start = drum_engine_now(&engine) + AUDIO_BLOCK_SIZE;
+
+    if (engine.transport.state != TRANSPORT_PLAYING || !engine.tempo.locked ||
+        engine.tempo.den != LOOP_SAMPLES || engine.loop_store.used != NUM_HITS) {
+        printf("FAIL record: state %s, locked %d to %u samples, %u hits\n",
+               transport_state_name(engine.transport.state), engine.tempo.locked, engine.tempo.den,
+               engine.loop_store.used);
+        failures++;
+    }
+    run_until(&engine, play_start + PASSES * LOOP_SAMPLES);
+    check_passes("recorded", play_start);
+
+    // the same session in a new engine plays the same hits
+    uint32_t bytes = drum_engine_save(&engine, session_buf, sizeof(session_buf));
+    drum_engine_init(&restored, NULL, NULL, &bank, HOST_SAMPLE_RATE, 120, START_BEAT);
+    if (bytes == 0 || !drum_engine_restore(&restored, session_buf, bytes)) {
+        printf("FAIL restore: %u bytes\n", bytes);
+        failures++;
+    } else {
+        drum_engine_load_pads(&restored);
+        run_until(&restored, 1000);
+        drum_engine_post(&restored, TRANSPORT_EV_PLAY, 0, host_us(1000));
+        num_triggers = 0;
+        handle_all(&restored);
+        play_start = drum_engine_now(&restored) + AUDIO_BLOCK_SIZE;
+        run_until(&restored, play_start + PASSES * LOOP_SAMPLES);
+        check_passes("restored", play_start);
+    }
+
+    host_log_drain();
+    printf("engine: %d failures\n", failures);
+    return failures ? 1 : 0;
+}
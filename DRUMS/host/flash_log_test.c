@@ -0,0 +1,296 @@
+// Host test for the flash log and the saved session.
+// The flash is a RAM array that behaves like NOR flash: erasing sets a sector to
+// 0xFF and programming can only clear bits, and it counts erases per sector so we
+// can see the wear get spread round. Power cuts are faked by stopping part way
+// through a write and starting again from whatever is in the array.
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include "flash_log.h"
+#include "session.h"
+
+#define NUM_SECTORS (FLASH_LOG_SIZE / FLASH_LOG_SECTOR)
+
+typedef struct {
+    uint8_t bytes[FLASH_LOG_SIZE];
+    uint32_t erases[NUM_SECTORS];
+    uint32_t bad_programs;  // pages programmed without being erased first
+} ram_flash_t;
+
+static ram_flash_t flash;
+
+static void ram_erase(void *context, uint32_t offset) {
+    ram_flash_t *f = context;
+    memset(f->bytes + offset, 0xFF, FLASH_LOG_SECTOR);
+    f->erases[offset / FLASH_LOG_SECTOR]++;
+}
+
+static void ram_program(void *context, uint32_t offset, const uint8_t *page) {
+    ram_flash_t *f = context;
+    for (uint32_t i = 0; i < FLASH_LOG_PAGE; i++) {
+        if (f->bytes[offset + i] != 0xFF) {
+            f->bad_programs++;
+            break;
+        }
+    }
+    for (uint32_t i = 0; i < FLASH_LOG_PAGE; i++) {
+        f->bytes[offset + i] &= page[i];
+    }
+}
+
+static const flash_log_ops_t ram_ops = {
+    .erase = ram_erase,
+    .program = ram_program,
+};
+
+// a brand new chip has never been erased, so start from junk
+static void flash_reset(void) {
+    for (uint32_t i = 0; i < FLASH_LOG_SIZE; i++) {
+        flash.bytes[i] = (uint8_t)(i * 7 + 3);
+    }
+    memset(flash.erases, 0, sizeof(flash.erases));
+    flash.bad_programs = 0;
+}
+
+static void log_open(flash_log_t *log) {
+    flash_log_init(log, &ram_ops, &flash, flash.bytes, FLASH_LOG_SIZE);
+}
+
+// Step a write through to the end, false if it didnt finish
+static bool log_finish(flash_log_t *log) {
+    for (int i = 0; i < 10000; i++) {
+        flash_log_status_t status = flash_log_step(log, true);
+        if (status == FLASH_LOG_DONE) {
+            return true;
+        }
+        if (status == FLASH_LOG_FAILED) {
+            return false;
+        }
+    }
+    return false;
+}
+
+static void fill(uint8_t *data, uint32_t length, uint32_t seed) {
+    for (uint32_t i = 0; i < length; i++) {
+        data[i] = (uint8_t)(seed * 31 + i * 13 + (i >> 8));
+    }
+}
+
+// The newest record is there and holds what we wrote
+static bool latest_is(const flash_log_t *log, const uint8_t *data, uint32_t length) {
+    const uint8_t *got;
+    uint32_t got_length;
+    return flash_log_latest(log, &got, &got_length) && got_length == length && memcmp(got, data, length) == 0;
+}
+
+// A loop with an overdub on top goes through the bytes and back unchanged
+static int test_session(void) {
+    static loop_event_t events[LOOP_STORE_EVENTS], events2[LOOP_STORE_EVENTS];
+    static uint8_t buf[SESSION_MAX_BYTES];
+    loop_store_t store, store2;
+    session_settings_t settings = {{3, 1, 4, 1, 5}, 2, 0, 135, 7680}, got;
+    int failures = 0;
+
+    loop_store_init(&store, events, LOOP_STORE_EVENTS);
+    for (uint32_t i = 0; i < 16; i++) {
+        loop_store_append(&store, i * 480, (uint8_t)(i % MIXER_NUM_PADS));
+    }
+    loop_store_new_layer(&store);
+    loop_store_append(&store, 100, 2);
+    loop_store_append(&store, 5000, 4);
+    loop_store_mute(&store, 1, true);
+
+    uint32_t bytes = session_save(buf, sizeof(buf), &settings, &store);
+    loop_store_init(&store2, events2, LOOP_STORE_EVENTS);
+    if (!bytes || !session_load(buf, bytes, &got, &store2)) {
+        printf("session: didnt load back\n");
+        return 1;
+    }
+
+    if (memcmp(&got, &settings, sizeof(got)) != 0 || store2.num_layers != 2 || store2.used != store.used ||
+        memcmp(events, events2, store.used * sizeof(loop_event_t)) != 0) {
+        printf("session: came back different\n");
+        failures++;
+    }
+    for (int i = 0; i < 2; i++) {
+        if (store2.layers[i].first != store.layers[i].first || store2.layers[i].count != store.layers[i].count ||
+            store2.layers[i].last != store.layers[i].last || store2.layers[i].muted != store.layers[i].muted) {
+            printf("session: layer %d came back different\n", i);
+            failures++;
+        }
+    }
+
+    // too small a buffer, truncated or mangled data are all turned down
+    if (session_save(buf, bytes - 1, &settings, &store) != 0) {
+        printf("session: saved into too small a buffer\n");
+        failures++;
+    }
+    if (session_load(buf, bytes - 4, &got, &store2) || store2.used != store.used) {
+        printf("session: loaded a truncated session\n");
+        failures++;
+    }
+    buf[sizeof(session_header_t)] ^= 1;  // first layer count is one off now
+    if (session_load(buf, bytes, &got, &store2)) {
+        printf("session: loaded a session with bad layer counts\n");
+        failures++;
+    }
+    return failures;
+}
+
+// Saves go round the whole region so every sector wears about the same, and
+// every one can be found again after a reboot
+static int test_wear(void) {
+    static uint8_t data[FLASH_LOG_MAX_RECORD - sizeof(flash_log_header_t)];
+    flash_log_t log;
+    int failures = 0;
+
+    flash_reset();
+    log_open(&log);
+    if (flash_log_latest(&log, &(const uint8_t *){NULL}, &(uint32_t){0})) {
+        printf("wear: found a record in blank flash\n");
+        failures++;
+    }
+
+    for (uint32_t save = 0; save < 500; save++) {
+        uint32_t length = 1 + (save * 7919) % sizeof(data);
+        fill(data, length, save);
+
+        if (!flash_log_write(&log, data, length) || !log_finish(&log)) {
+            printf("wear: save %u failed\n", save);
+            return failures + 1;
+        }
+        // reboot every now and then
+        if (save % 7 == 0) {
+            log_open(&log);
+        }
+        if (!latest_is(&log, data, length) || log.seq != save + 1) {
+            printf("wear: save %u not found\n", save);
+            failures++;
+        }
+    }
+
+    uint32_t least = 0xFFFFFFFFu, most = 0, total = 0;
+    for (int i = 0; i < NUM_SECTORS; i++) {
+        least = flash.erases[i] < least ? flash.erases[i] : least;
+        most = flash.erases[i] > most ? flash.erases[i] : most;
+        total += flash.erases[i];
+    }
+    printf("wear: 500 saves, sectors erased %u to %u times (%u on average)\n", least, most, total / NUM_SECTORS);
+    // a record that doesnt fit before the end goes back to the start, so the last
+    // sectors get skipped now and then. Still nothing like one sector taking every save
+    if (least == 0 || most > 2 * total / NUM_SECTORS) {
+        printf("wear: erases not spread out\n");
+        failures++;
+    }
+    if (flash.bad_programs) {
+        printf("wear: %u pages programmed without erasing\n", flash.bad_programs);
+        failures++;
+    }
+    return failures;
+}
+
+// Losing power part way through a save leaves the one before it, even when the
+// half written record has a good header
+static int test_power_loss(void) {
+    static uint8_t first[3000], second[3000];
+    flash_log_t log;
+    int failures = 0;
+
+    flash_reset();
+    log_open(&log);
+    fill(first, sizeof(first), 1);
+    fill(second, sizeof(second), 2);
+    flash_log_write(&log, first, sizeof(first));
+    log_finish(&log);
+
+    for (int pages = 0; pages < 12; pages++) {
+        log_open(&log);
+        flash_log_write(&log, second, sizeof(second));
+        for (int i = 0; i < pages; i++) {
+            flash_log_step(&log, true);
+        }
+
+        // power comes back
+        log_open(&log);
+        if (!latest_is(&log, first, sizeof(first))) {
+            printf("power loss: lost the old save after %d steps\n", pages);
+            failures++;
+        }
+    }
+
+    // and a finished save after all that is the one that counts
+    flash_log_write(&log, second, sizeof(second));
+    log_finish(&log);
+    log_open(&log);
+    if (!latest_is(&log, second, sizeof(second))) {
+        printf("power loss: new save not found\n");
+        failures++;
+    }
+
+    // a bit going bad in the newest record goes back to the one before
+    flash.bytes[log.latest + sizeof(flash_log_header_t) + 100] ^= 0x10;
+    log_open(&log);
+    if (!latest_is(&log, first, sizeof(first))) {
+        printf("power loss: corrupt record was used\n");
+        failures++;
+    }
+    return failures;
+}
+
+// Erasing only happens when allowed, and erasing ahead lets a save go through
+// without any more of it
+static int test_erase_timing(void) {
+    static uint8_t data[FLASH_LOG_SECTOR];
+    flash_log_t log;
+    int failures = 0;
+
+    flash_reset();
+    log_open(&log);
+    fill(data, sizeof(data), 3);
+
+    flash_log_write(&log, data, 1000);
+    if (flash_log_step(&log, false) != FLASH_LOG_WAITING || log.erases != 0) {
+        printf("erase timing: erased when it wasnt allowed to\n");
+        failures++;
+    }
+    log_finish(&log);
+
+    // with nothing to write it gets sectors ready, then stops
+    uint32_t steps = 0;
+    while (flash_log_step(&log, true) == FLASH_LOG_BUSY && steps < 100) {
+        steps++;
+    }
+    if (steps == 0 || log.erased < FLASH_LOG_ERASE_AHEAD * FLASH_LOG_SECTOR - FLASH_LOG_SECTOR) {
+        printf("erase timing: didnt erase ahead\n");
+        failures++;
+    }
+
+    // now a save fits in what was erased and never needs to wait
+    uint32_t erases = log.erases;
+    flash_log_write(&log, data, sizeof(data) - 100);
+    for (int i = 0; i < 100 && flash_log_writing(&log); i++) {
+        if (flash_log_step(&log, false) == FLASH_LOG_WAITING) {
+            printf("erase timing: had to wait with sectors erased ahead\n");
+            failures++;
+            break;
+        }
+    }
+    if (log.erases != erases || !latest_is(&log, data, sizeof(data) - 100)) {
+        printf("erase timing: save after erasing ahead went wrong\n");
+        failures++;
+    }
+
+    // too big for the region is turned down straight away
+    if (flash_log_write(&log, data, FLASH_LOG_MAX_RECORD)) {
+        printf("erase timing: took a record that cant fit\n");
+        failures++;
+    }
+    return failures;
+}
+
+int main(void) {
+    int failures = test_session() + test_wear() + test_power_loss() + test_erase_timing();
+
+    printf("flash log: %d failures\n", failures);
+    return failures ? 1 : 0;
+}
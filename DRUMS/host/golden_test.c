@@ -0,0 +1,327 @@
+// Golden audio regression test for the mixer and the sequencer.
+// Renders a fixed set of scenarios through the whole engine (every classic beat,
+// more voices than the mixer has, songs on top of each other, hits loud enough to
+// clip, a recorded loop, the PWM output) and checks every sample against the
+// golden file checked in next to this. The golden file has a hash of every second
+// of each scenario, so a change shows up with the second it starts in.
+// Any change to the mixer has to come out bit identical or come with a new golden
+// file and a reason. Write one with
+//   golden_test --update
+// and --wav DIR writes every scenario out as a WAV to listen to.
+// How long each scenario took to render is printed as well.
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "drum_engine.h"
+#include "classic_beats.h"
+#include "host_platform.h"
+#include "bank_file.h"
+#include "render_script.h"
+#include "wav_file.h"
+#include "log_events.h"
+
+#define MAX_SECONDS 20
+#define LINE_MAX_BYTES (64 + MAX_SECONDS * 17)
+
+typedef struct {
+    const char *name;
+    uint32_t seconds;
+    bool pwm;            // hash the PWM levels that go to GPIO 0 instead of the mixer output
+    bool clips;          // its meant to clip, it isnt testing anything if it doesnt
+    bool (*setup)(drum_engine_t *engine, script_t *script);
+} scenario_t;
+
+// what came out of a scenario
+typedef struct {
+    uint64_t samples;
+    uint64_t hash;                 // all of it
+    uint64_t second[MAX_SECONDS];  // each second on its own
+    uint32_t clipped;              // samples at full scale
+    wav_file_t wav;
+    bool writing;
+    bool pwm;
+} result_t;
+
+static sample_bank_t bank;
+static drum_engine_t engine;
+static script_t script;
+static int failures;
+
+// ---- the scenarios ----
+
+static bool play_beat(drum_engine_t *e, uint8_t beat) {
+    drum_engine_post(e, TRANSPORT_EV_BEAT_PIN, beat, host_us(0));
+    return true;
+}
+
+static bool beat_money(drum_engine_t *e, script_t *s) { return play_beat(e, CLASSIC_BEAT_MONEY); }
+static bool beat_hip_hop(drum_engine_t *e, script_t *s) { return play_beat(e, CLASSIC_BEAT_HIP_HOP); }
+static bool beat_funk(drum_engine_t *e, script_t *s) { return play_beat(e, CLASSIC_BEAT_FUNK); }
+
+// The funk beat, sped up and slowed down while it plays
+static bool tempo_changes(drum_engine_t *e, script_t *s) {
+    play_beat(e, CLASSIC_BEAT_FUNK);
+    return script_add(s, 2 * HOST_SAMPLE_RATE, SCRIPT_BPM, 177) &&
+           script_add(s, 4 * HOST_SAMPLE_RATE + 1234, SCRIPT_BPM, 63) &&
+           script_add(s, 6 * HOST_SAMPLE_RATE, SCRIPT_BPM, 300);
+}
+
+// Put a sound from the bank on a pad by name
+static bool give_pad(drum_engine_t *e, uint8_t pad, const char *name) {
+    int sound = bank_file_find(&bank, name);
+    if (sound < 0 || sound >= e->num_sounds) {
+        printf("FAIL: no %s in the sample bank\n", name);
+        return false;
+    }
+    e->transport.pad_sound[pad] = (uint8_t)sound;
+    return true;
+}
+
+// Hits on every pad far quicker than the voices run out, so old ones get stolen
+static bool max_polyphony(drum_engine_t *e, script_t *s) {
+    bool ok = true;
+    for (uint32_t i = 0; i < 3 * MIXER_MAX_VOICES; i++) {
+        ok = ok && script_add(s, 1000 + i * 97, SCRIPT_PAD, (uint16_t)(i % MIXER_NUM_PADS));
+    }
+    return ok;
+}
+
+// The songs (ADPCM, streamed out of the bank) over each other and the drums
+static bool overlapping_songs(drum_engine_t *e, script_t *s) {
+    if (!give_pad(e, 0, "Rick Roll") || !give_pad(e, 1, "Sandstorm") || !give_pad(e, 2, "Enter Dragon")) {
+        return false;
+    }
+    return script_add(s, 500, SCRIPT_PAD, 0) &&
+           script_add(s, HOST_SAMPLE_RATE, SCRIPT_PAD, 1) &&
+           script_add(s, 2 * HOST_SAMPLE_RATE + 77, SCRIPT_PAD, 2) &&
+           script_add(s, 3 * HOST_SAMPLE_RATE, SCRIPT_PAD, 3) &&
+           script_add(s, 4 * HOST_SAMPLE_RATE, SCRIPT_PAD, 0) &&  // the same song again over itself
+           script_add(s, 5 * HOST_SAMPLE_RATE, SCRIPT_PAD, 4);
+}
+
+// Every pad at once over and over, way past what 16 bits can hold
+static bool clipping(drum_engine_t *e, script_t *s) {
+    bool ok = true;
+    for (uint32_t hit = 0; hit < 8; hit++) {
+        for (uint16_t pad = 0; pad < MIXER_NUM_PADS; pad++) {
+            ok = ok && script_add(s, 2000 + hit * 300, SCRIPT_PAD, pad);
+        }
+    }
+    return ok;
+}
+
+// Record a loop through the buttons, overdub on it, undo and play on
+static bool recorded_loop(drum_engine_t *e, script_t *s) {
+    static const struct {
+        uint32_t ms;
+        script_action_t action;
+        uint16_t arg;
+    } steps[] = {
+        {200, SCRIPT_RECORD, 0}, {400, SCRIPT_PAD, 0}, {650, SCRIPT_PAD, 3}, {900, SCRIPT_PAD, 0},
+        {1010, SCRIPT_PAD, 1}, {1150, SCRIPT_PAD, 3}, {1400, SCRIPT_PAD, 2}, {1833, SCRIPT_RECORD, 0},
+        {2500, SCRIPT_RECORD, 0}, {2700, SCRIPT_PAD, 4}, {3100, SCRIPT_PAD, 2}, {4000, SCRIPT_RECORD, 0},
+        {4100, SCRIPT_RECORD, 0}, {4300, SCRIPT_PAD, 1}, {4500, SCRIPT_CLEAR, 0}, {5000, SCRIPT_RECORD, 0},
+        {8000, SCRIPT_BPM, 140},
+    };
+
+    for (uint32_t i = 0; i < sizeof(steps) / sizeof(steps[0]); i++) {
+        if (!script_add(s, steps[i].ms * (HOST_SAMPLE_RATE / 1000), steps[i].action, steps[i].arg)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static const scenario_t scenarios[] = {
+    {"beat_money", 8, false, false, beat_money},
+    {"beat_hip_hop", 8, false, false, beat_hip_hop},
+    {"beat_funk", 8, false, false, beat_funk},
+    {"beat_funk_pwm", 4, true, false, beat_funk},
+    {"tempo_changes", 8, false, false, tempo_changes},
+    {"max_polyphony", 3, false, false, max_polyphony},
+    {"overlapping_songs", 10, false, false, overlapping_songs},
+    {"clipping", 2, false, true, clipping},
+    {"clipping_pwm", 2, true, true, clipping},
+    {"recorded_loop", 12, false, false, recorded_loop},
+};
+
+#define NUM_SCENARIOS (sizeof(scenarios) / sizeof(scenarios[0]))
+
+// ---- rendering them ----
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+// 64 bit FNV-1a over the samples as little endian bytes
+#define HASH_START 0xcbf29ce484222325ull
+static uint64_t hash_sample(uint64_t hash, int16_t sample) {
+    hash = (hash ^ ((uint16_t)sample & 0xFF)) * 0x100000001b3ull;
+    return (hash ^ ((uint16_t)sample >> 8)) * 0x100000001b3ull;
+}
+
+static void take_block(const int16_t *pcm, uint32_t n, void *context) {
+    result_t *result = context;
+    int16_t out[AUDIO_BLOCK_SIZE];
+
+    if (result->pwm) {
+        // the PWM levels themselves, 0 to HOST_PWM_WRAP
+        mixer_to_pwm(pcm, (uint16_t *)out, n, HOST_PWM_WRAP);
+    } else {
+        memcpy(out, pcm, n * sizeof(int16_t));
+    }
+
+    for (uint32_t i = 0; i < n; i++, result->samples++) {
+        uint32_t second = (uint32_t)(result->samples / HOST_SAMPLE_RATE);
+        result->hash = hash_sample(result->hash, out[i]);
+        result->second[second] = hash_sample(result->second[second], out[i]);
+        if (pcm[i] == INT16_MAX || pcm[i] == INT16_MIN) {
+            result->clipped++;
+        }
+    }
+    if (result->writing) {
+        wav_file_write(&result->wav, pcm, n);
+    }
+}
+
+static bool render(const scenario_t *scenario, result_t *result, const char *wav_dir, double *took) {
+    memset(result, 0, sizeof(*result));
+    result->hash = HASH_START;
+    for (uint32_t i = 0; i < MAX_SECONDS; i++) {
+        result->second[i] = HASH_START;
+    }
+    result->pwm = scenario->pwm;
+
+    drum_engine_init(&engine, NULL, NULL, &bank, HOST_SAMPLE_RATE, 120, 2);
+    script_init(&script);
+    if (!scenario->setup(&engine, &script)) {
+        return false;
+    }
+    drum_engine_load_pads(&engine);
+    while (drum_engine_handle(&engine)) {
+    }
+
+    if (wav_dir) {
+        char path[512];
+        snprintf(path, sizeof(path), "%s/%s.wav", wav_dir, scenario->name);
+        result->writing = wav_file_open(&result->wav, path, HOST_SAMPLE_RATE);
+    }
+
+    double start = now_ns();
+    render_script(&engine, &script, (uint64_t)scenario->seconds * HOST_SAMPLE_RATE, take_block, result);
+    *took = (now_ns() - start) / 1e6;
+
+    if (result->writing) {
+        wav_file_close(&result->wav);
+    }
+    log_ring_init(&log_ring);  // nobody wants to read it
+    return true;
+}
+
+// name samples hash then a hash per second, all hex
+static void format_line(char *line, size_t size, const scenario_t *scenario, const result_t *result) {
+    int used = snprintf(line, size, "%s %llu %016llx", scenario->name, (unsigned long long)result->samples,
+                        (unsigned long long)result->hash);
+    for (uint32_t i = 0; i < scenario->seconds && used > 0 && (size_t)used < size; i++) {
+        used += snprintf(line + used, size - (size_t)used, " %016llx", (unsigned long long)result->second[i]);
+    }
+}
+
+// The golden line for name, false if there isnt one
+static bool find_golden(FILE *golden, const char *name, char *line, size_t size) {
+    size_t length = strlen(name);
+
+    rewind(golden);
+    while (fgets(line, (int)size, golden)) {
+        if (strncmp(line, name, length) == 0 && line[length] == ' ') {
+            line[strcspn(line, "\r\n")] = '\0';
+            return true;
+        }
+    }
+    return false;
+}
+
+// Which second the two lines first differ in, -1 if they are the same all through
+static int first_bad_second(const char *got, const char *want) {
+    int field = 0;
+    while (*got && *got == *want) {
+        field += *got == ' ';
+        got++, want++;
+    }
+    if (*got == *want) {
+        return -1;
+    }
+    return field < 3 ? 0 : field - 3;
+}
+
+int main(int argc, char **argv) {
+    bool update = false;
+    const char *wav_dir = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--update") == 0) {
+            update = true;
+        } else if (strcmp(argv[i], "--wav") == 0 && i + 1 < argc) {
+            wav_dir = argv[++i];
+        } else {
+            fprintf(stderr, "usage: golden_test [--update] [--wav DIR]\n");
+            return 2;
+        }
+    }
+    if (!bank_file_open(&bank, DRUMS_SAMPLE_BANK_PATH)) {
+        return 1;
+    }
+
+    FILE *golden = fopen(DRUMS_GOLDEN_PATH, update ? "w" : "r");
+    if (golden == NULL) {
+        printf("FAIL: cant open %s, make it with --update\n", DRUMS_GOLDEN_PATH);
+        return 1;
+    }
+    if (update) {
+        fprintf(golden, "# golden_test output, name samples hash then a hash per second.\n");
+        fprintf(golden, "# Only regenerate it (golden_test --update) for a change that is meant to sound different\n");
+    }
+
+    printf("%-18s %8s %9s %8s %8s  %s\n", "scenario", "samples", "render ms", "x real", "clipped", "result");
+    for (uint32_t i = 0; i < NUM_SCENARIOS; i++) {
+        const scenario_t *scenario = &scenarios[i];
+        result_t result;
+        char got[LINE_MAX_BYTES], want[LINE_MAX_BYTES];
+        double took;
+
+        if (!render(scenario, &result, wav_dir, &took)) {
+            printf("FAIL %s: couldnt set it up\n", scenario->name);
+            failures++;
+            continue;
+        }
+        format_line(got, sizeof(got), scenario, &result);
+
+        const char *verdict = "ok";
+        char detail[64] = "";
+        if (scenario->clips && result.clipped == 0) {
+            verdict = "FAIL, never clipped";
+            failures++;
+        } else if (update) {
+            fprintf(golden, "%s\n", got);
+            verdict = "written";
+        } else if (!find_golden(golden, scenario->name, want, sizeof(want))) {
+            verdict = "FAIL, not in the golden file";
+            failures++;
+        } else if (strcmp(got, want) != 0) {
+            snprintf(detail, sizeof(detail), " from second %d", first_bad_second(got, want));
+            verdict = "FAIL, different";
+            failures++;
+        }
+
+        double audio_ms = (double)result.samples * 1000 / HOST_SAMPLE_RATE;
+        printf("%-18s %8llu %9.2f %8.0f %8u  %s%s\n", scenario->name, (unsigned long long)result.samples, took,
+               took > 0 ? audio_ms / took : 0, result.clipped, verdict, detail);
+    }
+    fclose(golden);
+
+    printf("golden: %d failures\n", failures);
+    return failures ? 1 : 0;
+}
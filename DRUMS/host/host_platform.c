@@ -0,0 +1,30 @@
+#include "host_platform.h"
+#include "log_events.h"
+
+log_ring_t log_ring;
+uint32_t host_log_now = 0;
+
+static const char *const log_formats[LOG_NUM_EVENTS] = {
+    LOG_EVENT_LIST(LOG_EVENT_FORMAT)
+};
+
+uint32_t log_time(void) {
+    return host_log_now;
+}
+
+uint32_t host_us(uint32_t sample) {
+    return (uint32_t)((int64_t)(int32_t)sample * 1000000 / HOST_SAMPLE_RATE);
+}
+
+void host_render(drum_engine_t *engine, int16_t *out, uint32_t n) {
+    // the block rendered last time starts going out now, same as render_audio_block
+    uint32_t now = host_us(engine->mixer.clock - AUDIO_BLOCK_SIZE);
+
+    host_log_now = now;
+    drum_engine_render(engine, out, n, now);
+    mixer_prefetch(&engine->mixer);
+}
+
+void host_log_drain(void) {
+    log_ring_drain(&log_ring, log_formats, LOG_NUM_EVENTS);
+}
@@ -0,0 +1,30 @@
+#ifndef HOST_PLATFORM_H
+#define HOST_PLATFORM_H
+
+#include <stdint.h>
+#include "drum_engine.h"
+#include "audio_rate.h"
+
+// What main.c does for the engine on the pico, done on a PC instead. There is no
+// audio hardware so the us timer is made up, it runs exactly in step with the
+// samples rendered so a pad hit at host_us(s) lands on sample s. It goes wrong
+// once the sample count wraps (about 54 hours in), nothing runs that long.
+
+#define HOST_SAMPLE_RATE SAMPLE_RATE
+#define HOST_CLOCK_HZ 125000000  // clk_sys while the audio plays
+#define HOST_PWM_WRAP audio_out_wrap_for(HOST_CLOCK_HZ)  // PWM counts per sample, as on the pico
+
+// what the log records get stamped with, host_render keeps it at the current block
+extern uint32_t host_log_now;
+
+// The us timer at sample, negative samples are before the first block
+uint32_t host_us(uint32_t sample);
+
+// Render the next n samples of the engine like the audio interrupt does, including
+// the prefetch. Call drum_engine_schedule before it if a loop could be playing
+void host_render(drum_engine_t *engine, int16_t *out, uint32_t n);
+
+// Print everything the engine logged
+void host_log_drain(void);
+
+#endif // HOST_PLATFORM_H
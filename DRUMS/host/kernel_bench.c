@@ -0,0 +1,475 @@
+// Host microbenchmarks for every audio kernel, each one on its own.
+//   mix              mixer_render with N voices, PCM16 and the ADPCM songs
+//   clamp, pwm       the 16 bit clamp and the PWM scaling the mixer ends every block with
+//   clamp_pwm        both, a block at a time and one sample a call like the old
+//                    sample_timer_callback did
+//   envelope, oscillator, synth
+//                    the per sample work of SYNTHESIZER/synthesizer.ino, as in the
+//                    sketch (float) and fixed point, see synth_kernels.h
+//   check_loop_events
+//                    drum_engine_schedule handing out a loop of N hits (this is what
+//                    check_loop_events became), the queue gets emptied after every block
+// Every kernel gets warmed up, then timed over a number of repetitions. The numbers
+// are per output sample (and per hit for the loop), min, median, mean and standard
+// deviation over the repetitions. Cycles come from the TSC on x86, which ticks at the
+// nominal clock so turn frequency scaling off for numbers you want to compare.
+//   kernel_bench [--reps N] [--filter KERNEL] [--json FILE]
+// Variants of the same kernel sit next to each other so a new implementation can go
+// in as another variant and get compared with the old one.
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "drum_engine.h"
+#include "host_platform.h"
+#include "bank_file.h"
+#include "synth_kernels.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HAVE_TSC 1
+#else
+#define HAVE_TSC 0
+#endif
+
+#define SAMPLES_PER_REP (1u << 17)  // about 6 s of audio
+#define DEFAULT_REPS 21
+#define WARMUP_REPS 3
+#define SOUND_LENGTH 88200          // as long as one of the song clips
+#define MIX_INPUT 4096              // mixed blocks the clamp and pwm kernels go round
+#define LOOP_SAMPLES 88200          // 4 s, two bars at 120
+#define SYNTH_RETRIGGER 8192        // how often the synth voices start another note
+
+_Static_assert(LOOP_STORE_EVENTS >= 5000, "kernel_bench needs the loop store built with room for 5000 hits");
+
+typedef struct {
+    const char *kernel;
+    const char *variant;
+    uint32_t param;
+    const char *param_name;
+    void (*setup)(uint32_t param);
+    uint64_t (*run)(uint32_t samples);  // returns how many items (hits) it did, 0 if that doesnt mean anything
+} kernel_t;
+
+typedef struct {
+    double min, median, mean, stddev;
+} stats_t;
+
+static int16_t sounds[MIXER_NUM_PADS][SOUND_LENGTH];
+static sample_bank_t bank;
+static bool have_bank;
+static mixer_t mixer;
+static drum_engine_t engine;
+static uint32_t mix_voices;
+static int32_t mix_input[MIX_INPUT];
+static int16_t pcm_input[MIX_INPUT];
+static volatile uint16_t sink;  // stands in for the PWM compare register
+
+// ---- mixing ----
+
+static void setup_mix(const mixer_sound_t *sound, uint32_t voices) {
+    mixer_init(&mixer);
+    for (int i = 0; i < MIXER_NUM_PADS; i++) {
+        mixer_set_sound(&mixer, i, &sound[i]);
+    }
+    mix_voices = voices;
+}
+
+static void setup_mix_pcm16(uint32_t voices) {
+    mixer_sound_t sound[MIXER_NUM_PADS];
+    for (int i = 0; i < MIXER_NUM_PADS; i++) {
+        sound[i] = (mixer_sound_t){sounds[i], SOUND_LENGTH, MIXER_FORMAT_PCM16};
+    }
+    setup_mix(sound, voices);
+}
+
+static void setup_mix_adpcm(uint32_t voices) {
+    static const char *const songs[] = {"Rick Roll", "Sandstorm", "Enter Dragon"};
+    mixer_sound_t sound[MIXER_NUM_PADS];
+
+    for (int i = 0; i < MIXER_NUM_PADS; i++) {
+        int index = have_bank ? bank_file_find(&bank, songs[i % 3]) : -1;
+        if (index < 0 || !sample_bank_sound(&bank, (uint16_t)index, &sound[i])) {
+            sound[i] = (mixer_sound_t){sounds[i], SOUND_LENGTH, MIXER_FORMAT_PCM16};
+        }
+    }
+    setup_mix(sound, voices);
+}
+
+static uint64_t run_mix(uint32_t samples) {
+    int16_t pcm[AUDIO_BLOCK_SIZE];
+
+    for (uint32_t s = 0; s < samples; s += AUDIO_BLOCK_SIZE) {
+        // keep the voice count where it should be as sounds finish
+        while (mixer_active_voices(&mixer) < mix_voices) {
+            mixer_trigger(&mixer, (uint8_t)(mixer.triggers % MIXER_NUM_PADS), 0, MIXER_UNITY_GAIN);
+        }
+        mixer_render(&mixer, pcm, AUDIO_BLOCK_SIZE);
+        mixer_prefetch(&mixer);
+        sink = (uint16_t)pcm[0];
+    }
+    return 0;
+}
+
+// ---- clamp and pwm ----
+
+static void setup_clamp(uint32_t param) {
+    srand(2);
+    for (int i = 0; i < MIX_INPUT; i++) {
+        // up to three sounds worth, so plenty of it clips
+        mix_input[i] = (rand() % (6 * 32768)) - 3 * 32768;
+    }
+    mixer_clamp(mix_input, pcm_input, MIX_INPUT);
+}
+
+static uint64_t run_clamp(uint32_t samples) {
+    int16_t out[AUDIO_BLOCK_SIZE];
+    for (uint32_t s = 0; s < samples; s += AUDIO_BLOCK_SIZE) {
+        mixer_clamp(&mix_input[s % MIX_INPUT], out, AUDIO_BLOCK_SIZE);
+        sink = (uint16_t)out[s & (AUDIO_BLOCK_SIZE - 1)];
+    }
+    return 0;
+}
+
+static uint64_t run_pwm(uint32_t samples) {
+    uint16_t levels[AUDIO_BLOCK_SIZE];
+    for (uint32_t s = 0; s < samples; s += AUDIO_BLOCK_SIZE) {
+        mixer_to_pwm(&pcm_input[s % MIX_INPUT], levels, AUDIO_BLOCK_SIZE, HOST_PWM_WRAP);
+        sink = levels[s & (AUDIO_BLOCK_SIZE - 1)];
+    }
+    return 0;
+}
+
+static uint64_t run_clamp_pwm(uint32_t samples) {
+    int16_t out[AUDIO_BLOCK_SIZE];
+    uint16_t levels[AUDIO_BLOCK_SIZE];
+    for (uint32_t s = 0; s < samples; s += AUDIO_BLOCK_SIZE) {
+        mixer_clamp(&mix_input[s % MIX_INPUT], out, AUDIO_BLOCK_SIZE);
+        mixer_to_pwm(out, levels, AUDIO_BLOCK_SIZE, HOST_PWM_WRAP);
+        sink = levels[s & (AUDIO_BLOCK_SIZE - 1)];
+    }
+    return 0;
+}
+
+// the end of the old sample_timer_callback, one call per sample (with samp_sum
+// going to the PWM like it was meant to, not mix)
+__attribute__((noinline)) static void legacy_clamp_pwm(int32_t samp_sum) {
+    if (samp_sum < -32768) {
+        samp_sum = -32768;
+    } else if (samp_sum > 32767) {
+        samp_sum = 32767;
+    }
+
+    int32_t shifted_mix = samp_sum + 32768;
+    sink = (uint16_t)((shifted_mix * HOST_PWM_WRAP) / 65536);
+}
+
+static uint64_t run_clamp_pwm_per_sample(uint32_t samples) {
+    for (uint32_t s = 0; s < samples; s++) {
+        legacy_clamp_pwm(mix_input[s % MIX_INPUT]);
+    }
+    return 0;
+}
+
+// ---- the synthesizer ----
+
+static synth_voice_t synth[SYNTH_VOICES];
+static synth_fixed_voice_t synth_fixed[SYNTH_VOICES];
+// quick enough that a note goes through attack, decay, sustain, release and idle
+// between retriggers, and A4 and E5 at FREQUENCY_SCALING
+static const synth_rates_t rates = {0.0005f, 0.0005f, 0.0005f};
+static const synth_fixed_rates_t fixed_rates = {33, 33, 33};
+static const float increments[SYNTH_VOICES] = {440.0f * 8.4f / 1000, 659.26f * 8.4f / 1000};
+
+// Start or let go of the notes now and then so every envelope state gets a go
+static void synth_notes(uint32_t s) {
+    uint32_t at = s % SYNTH_RETRIGGER;
+    for (int v = 0; v < SYNTH_VOICES; v++) {
+        if (at == 0) {
+            synth[v] = (synth_voice_t){true, 0, increments[v], 0, SYNTH_ENV_ATTACK, 0.6f, 0.5f};
+            synth_fixed[v] = (synth_fixed_voice_t){true, 0, (uint32_t)(increments[v] * (1 << 24)), 0,
+                                                   SYNTH_ENV_ATTACK, 39322, 32768};
+        } else if (at == SYNTH_RETRIGGER * 3 / 4) {
+            synth[v].env_state = SYNTH_ENV_RELEASE;
+            synth_fixed[v].env_state = SYNTH_ENV_RELEASE;
+        }
+    }
+}
+
+static void setup_synth(uint32_t param) {
+    synth_notes(0);
+}
+
+// the oscillator on its own, playing at a steady level
+static void setup_oscillator(uint32_t param) {
+    synth_notes(0);
+    for (int v = 0; v < SYNTH_VOICES; v++) {
+        synth[v].env_level = 0.8f;
+        synth_fixed[v].env_level = 52429;
+    }
+}
+
+static uint64_t run_envelope_float(uint32_t samples) {
+    for (uint32_t s = 0; s < samples; s++) {
+        synth_notes(s);
+        for (int v = 0; v < SYNTH_VOICES; v++) {
+            synth_envelope(&synth[v], &rates);
+        }
+    }
+    sink = (uint16_t)(synth[0].env_level * 4095);
+    return 0;
+}
+
+static uint64_t run_envelope_fixed(uint32_t samples) {
+    for (uint32_t s = 0; s < samples; s++) {
+        synth_notes(s);
+        for (int v = 0; v < SYNTH_VOICES; v++) {
+            synth_fixed_envelope(&synth_fixed[v], &fixed_rates);
+        }
+    }
+    sink = (uint16_t)synth_fixed[0].env_level;
+    return 0;
+}
+
+static uint64_t run_oscillator_float(uint32_t samples) {
+    for (uint32_t s = 0; s < samples; s++) {
+        sink = (uint16_t)synth_oscillator(synth);
+    }
+    return 0;
+}
+
+static uint64_t run_oscillator_fixed(uint32_t samples) {
+    for (uint32_t s = 0; s < samples; s++) {
+        sink = (uint16_t)synth_fixed_oscillator(synth_fixed);
+    }
+    return 0;
+}
+
+static uint64_t run_synth_float(uint32_t samples) {
+    for (uint32_t s = 0; s < samples; s++) {
+        synth_notes(s);
+        sink = (uint16_t)synth_generate(synth, &rates);
+    }
+    return 0;
+}
+
+static uint64_t run_synth_fixed(uint32_t samples) {
+    for (uint32_t s = 0; s < samples; s++) {
+        synth_notes(s);
+        sink = (uint16_t)synth_fixed_generate(synth_fixed, &fixed_rates);
+    }
+    return 0;
+}
+
+// ---- the loop ----
+
+// A loop of hits hits spread over LOOP_SAMPLES, recorded and locked like a real one
+static void setup_loop(uint32_t hits) {
+    drum_engine_init(&engine, NULL, NULL, NULL, HOST_SAMPLE_RATE, 120, 0);
+
+    srand(3);
+    for (uint32_t i = 0; i < hits; i++) {
+        sequencer_record(&engine.sequencer, (uint32_t)((uint64_t)i * LOOP_SAMPLES / hits),
+                         (uint8_t)(rand() % MIXER_NUM_PADS));
+    }
+    uint32_t ticks = tempo_samples_to_ticks(&engine.tempo, LOOP_SAMPLES);
+    loop_store_scale(&engine.loop_store, ticks, LOOP_SAMPLES);
+    sequencer_set_length(&engine.sequencer, ticks);
+    tempo_lock(&engine.tempo, ticks, LOOP_SAMPLES);
+
+    tempo_start(&engine.tempo, drum_engine_now(&engine) + AUDIO_BLOCK_SIZE);
+    sequencer_start(&engine.sequencer, 0);
+}
+
+static uint64_t run_loop(uint32_t samples) {
+    audio_cmd_t cmd;
+    uint64_t hits = 0;
+
+    for (uint32_t s = 0; s < samples; s += AUDIO_BLOCK_SIZE) {
+        engine.mixer.clock += AUDIO_BLOCK_SIZE;  // a block went by
+        drum_engine_schedule(&engine);
+        while (audio_queue_pop(&engine.queue, &cmd)) {
+            hits++;
+        }
+    }
+    return hits;
+}
+
+static const kernel_t kernels[] = {
+    {"mix", "pcm16", 1, "voices", setup_mix_pcm16, run_mix},
+    {"mix", "pcm16", 2, "voices", setup_mix_pcm16, run_mix},
+    {"mix", "pcm16", 4, "voices", setup_mix_pcm16, run_mix},
+    {"mix", "pcm16", 8, "voices", setup_mix_pcm16, run_mix},
+    {"mix", "pcm16", 16, "voices", setup_mix_pcm16, run_mix},
+    {"mix", "adpcm", 1, "voices", setup_mix_adpcm, run_mix},
+    {"mix", "adpcm", 4, "voices", setup_mix_adpcm, run_mix},
+    {"clamp", "block", AUDIO_BLOCK_SIZE, "block", setup_clamp, run_clamp},
+    {"pwm", "block", AUDIO_BLOCK_SIZE, "block", setup_clamp, run_pwm},
+    {"clamp_pwm", "block", AUDIO_BLOCK_SIZE, "block", setup_clamp, run_clamp_pwm},
+    {"clamp_pwm", "per_sample", 1, "block", setup_clamp, run_clamp_pwm_per_sample},
+    {"envelope", "float", SYNTH_VOICES, "voices", setup_synth, run_envelope_float},
+    {"envelope", "fixed", SYNTH_VOICES, "voices", setup_synth, run_envelope_fixed},
+    {"oscillator", "float", SYNTH_VOICES, "voices", setup_oscillator, run_oscillator_float},
+    {"oscillator", "fixed", SYNTH_VOICES, "voices", setup_oscillator, run_oscillator_fixed},
+    {"synth", "float", SYNTH_VOICES, "voices", setup_synth, run_synth_float},
+    {"synth", "fixed", SYNTH_VOICES, "voices", setup_synth, run_synth_fixed},
+    {"check_loop_events", "schedule", 50, "hits", setup_loop, run_loop},
+    {"check_loop_events", "schedule", 500, "hits", setup_loop, run_loop},
+    {"check_loop_events", "schedule", 5000, "hits", setup_loop, run_loop},
+};
+
+#define NUM_KERNELS (sizeof(kernels) / sizeof(kernels[0]))
+
+// ---- timing ----
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static uint64_t cycles(void) {
+#if HAVE_TSC
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+static int compare_doubles(const void *a, const void *b) {
+    double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+static stats_t get_stats(double *values, int n) {
+    stats_t stats = {0};
+
+    qsort(values, (size_t)n, sizeof(double), compare_doubles);
+    stats.min = values[0];
+    stats.median = n % 2 ? values[n / 2] : (values[n / 2 - 1] + values[n / 2]) / 2;
+    for (int i = 0; i < n; i++) {
+        stats.mean += values[i] / n;
+    }
+    for (int i = 0; i < n; i++) {
+        stats.stddev += (values[i] - stats.mean) * (values[i] - stats.mean) / n;
+    }
+    stats.stddev = sqrt(stats.stddev);
+    return stats;
+}
+
+static void json_stats(FILE *json, const char *name, stats_t stats) {
+    fprintf(json, "\"%s\": {\"min\": %.4f, \"median\": %.4f, \"mean\": %.4f, \"stddev\": %.4f}", name, stats.min,
+            stats.median, stats.mean, stats.stddev);
+}
+
+int main(int argc, char **argv) {
+    int reps = DEFAULT_REPS;
+    const char *filter = NULL, *json_path = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--reps") == 0 && i + 1 < argc) {
+            reps = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--filter") == 0 && i + 1 < argc) {
+            filter = argv[++i];
+        } else if (strcmp(argv[i], "--json") == 0 && i + 1 < argc) {
+            json_path = argv[++i];
+        } else {
+            fprintf(stderr, "usage: kernel_bench [--reps N] [--filter KERNEL] [--json FILE]\n");
+            return 2;
+        }
+    }
+    if (reps < 1) {
+        reps = 1;
+    }
+
+    srand(1);
+    for (int i = 0; i < MIXER_NUM_PADS; i++) {
+        for (int s = 0; s < SOUND_LENGTH; s++) {
+            sounds[i][s] = (int16_t)((rand() & 0xffff) - 32768);
+        }
+    }
+    have_bank = bank_file_open(&bank, DRUMS_SAMPLE_BANK_PATH);
+
+    FILE *json = NULL;
+    if (json_path) {
+        json = fopen(json_path, "w");
+        if (json == NULL) {
+            fprintf(stderr, "cant write %s\n", json_path);
+            return 1;
+        }
+        fprintf(json, "{\n  \"benchmark\": \"kernel_bench\",\n  \"block_size\": %d,\n  \"sample_rate\": %d,\n",
+                AUDIO_BLOCK_SIZE, HOST_SAMPLE_RATE);
+        fprintf(json, "  \"samples_per_rep\": %u,\n  \"warmup_reps\": %d,\n  \"reps\": %d,\n  \"tsc\": %s,\n",
+                SAMPLES_PER_REP, WARMUP_REPS, reps, HAVE_TSC ? "true" : "false");
+        fprintf(json, "  \"results\": [");
+    }
+
+    double *ns = malloc(sizeof(double) * (size_t)reps);
+    double *cyc = malloc(sizeof(double) * (size_t)reps);
+    double *per_item = malloc(sizeof(double) * (size_t)reps);
+    bool first = true;
+
+    printf("%-18s %-10s %6s  %10s %10s %8s  %10s  %10s\n", "kernel", "variant", "param", "ns/sample", "median",
+           "stddev", "cyc/sample", "ns/hit");
+    for (uint32_t k = 0; k < NUM_KERNELS; k++) {
+        const kernel_t *kernel = &kernels[k];
+        if (filter && strcmp(filter, kernel->kernel) != 0) {
+            continue;
+        }
+
+        kernel->setup(kernel->param);
+        for (int i = 0; i < WARMUP_REPS; i++) {
+            kernel->run(SAMPLES_PER_REP);
+        }
+
+        uint64_t items = 0;
+        for (int i = 0; i < reps; i++) {
+            uint64_t c = cycles();
+            double start = now_ns();
+            items = kernel->run(SAMPLES_PER_REP);
+            double took = now_ns() - start;
+            c = cycles() - c;
+
+            ns[i] = took / SAMPLES_PER_REP;
+            cyc[i] = (double)c / SAMPLES_PER_REP;
+            per_item[i] = items ? took / items : 0;
+        }
+        stats_t ns_stats = get_stats(ns, reps);
+        stats_t cyc_stats = get_stats(cyc, reps);
+        stats_t item_stats = get_stats(per_item, reps);
+
+        printf("%-18s %-10s %6u  %10.3f %10.3f %8.3f  %10.1f", kernel->kernel, kernel->variant, kernel->param,
+               ns_stats.min, ns_stats.median, ns_stats.stddev, cyc_stats.median);
+        if (items) {
+            printf("  %10.2f", item_stats.median);
+        }
+        printf("\n");
+
+        if (json) {
+            fprintf(json, "%s\n    {\"kernel\": \"%s\", \"variant\": \"%s\", \"%s\": %u, ", first ? "" : ",",
+                    kernel->kernel, kernel->variant, kernel->param_name, kernel->param);
+            json_stats(json, "ns_per_sample", ns_stats);
+            if (HAVE_TSC) {
+                fprintf(json, ", ");
+                json_stats(json, "cycles_per_sample", cyc_stats);
+            }
+            if (items) {
+                fprintf(json, ", \"hits_per_rep\": %llu, ", (unsigned long long)items);
+                json_stats(json, "ns_per_hit", item_stats);
+            }
+            fprintf(json, "}");
+            first = false;
+        }
+    }
+
+    if (json) {
+        fprintf(json, "\n  ]\n}\n");
+        fclose(json);
+    }
+    free(ns);
+    free(cyc);
+    free(per_item);
+    return 0;
+}
@@ -0,0 +1,139 @@
+// Host benchmark for the block mixer.
+// Runs the old one sample per call mixing from sample_timer_callback next to
+// mixer_render and prints the time per output sample for each.
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <time.h>
+#include "mixer.h"
+
+#define PWM_WRAP 4095
+#define SOUND_LENGTH 88200     // as long as one of the song clips
+#define BENCH_SAMPLES 2000000  // samples rendered per measurement
+#define LEGACY_TRACKS 5        // the old mixer had one fixed track per pad
+
+static int16_t sounds[MIXER_NUM_PADS][SOUND_LENGTH];
+
+// ---- the old per sample mixer, kept as close to the firmware as possible ----
+volatile uint32_t tracks_playing = 0;
+volatile int32_t samples_left_to_play[LEGACY_TRACKS];
+volatile uint32_t total_samples[LEGACY_TRACKS];
+volatile int16_t const *tracks[LEGACY_TRACKS];
+volatile uint16_t pwm_level;  // stands in for the PWM compare register
+
+__attribute__((noinline)) static void legacy_sample_callback(void) {
+    int32_t samp_sum = 0;
+
+    for (int i = 0; i < LEGACY_TRACKS; i++) {
+        if ((tracks_playing >> i) & 0x01) {
+            uint32_t current_sample_index = total_samples[i] - samples_left_to_play[i];
+
+            if (current_sample_index < total_samples[i] && tracks[i] != NULL) {
+                samp_sum += tracks[i][current_sample_index];
+                samples_left_to_play[i]--;
+                if (samples_left_to_play[i] <= 0) {
+                    tracks_playing &= ~(1u << i);
+                }
+            } else {
+                tracks_playing &= ~(1u << i);
+            }
+        }
+    }
+
+    if (samp_sum < -32768) {
+        samp_sum = -32768;
+    } else if (samp_sum > 32767) {
+        samp_sum = 32767;
+    }
+
+    int32_t shifted_mix = samp_sum + 32768;
+    pwm_level = (uint16_t)((shifted_mix * PWM_WRAP) / 65536);
+}
+
+static void legacy_trigger_all(int voices) {
+    for (int i = 0; i < voices; i++) {
+        tracks[i] = sounds[i];
+        total_samples[i] = SOUND_LENGTH;
+        samples_left_to_play[i] = SOUND_LENGTH;
+        tracks_playing |= 1u << i;
+    }
+}
+
+// ---- timing helpers ----
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static double bench_legacy(int voices) {
+    double start = now_ns();
+    for (uint32_t s = 0; s < BENCH_SAMPLES; s++) {
+        // retrigger when everything finished so the voice count stays constant
+        if (tracks_playing == 0) {
+            legacy_trigger_all(voices);
+        }
+        legacy_sample_callback();
+    }
+    return (now_ns() - start) / BENCH_SAMPLES;
+}
+
+static double bench_block(int voices, uint32_t block) {
+    static mixer_t mixer;
+    static int16_t pcm[MIXER_MAX_BLOCK];
+    static volatile uint16_t pwm[MIXER_MAX_BLOCK];
+
+    mixer_init(&mixer);
+    for (int i = 0; i < MIXER_NUM_PADS; i++) {
+        mixer_sound_t sound = {sounds[i], SOUND_LENGTH, MIXER_FORMAT_PCM16};
+        mixer_set_sound(&mixer, i, &sound);
+    }
+
+    double start = now_ns();
+    for (uint32_t s = 0; s < BENCH_SAMPLES; s += block) {
+        if (mixer.live == 0) {
+            // more voices than pads just means the pads overlap themselves
+            for (int i = 0; i < voices; i++) {
+                mixer_trigger(&mixer, i % MIXER_NUM_PADS, 0, MIXER_UNITY_GAIN);
+            }
+        }
+        mixer_render(&mixer, pcm, block);
+        mixer_to_pwm(pcm, (uint16_t *)pwm, block, PWM_WRAP);
+        mixer_prefetch(&mixer);  // same as the firmware, copy the next chunks into SRAM
+    }
+    return (now_ns() - start) / BENCH_SAMPLES;
+}
+
+int main(void) {
+    static const uint32_t blocks[] = {32, 64, 128, 256};
+    const int num_blocks = sizeof(blocks) / sizeof(blocks[0]);
+
+    srand(1);
+    for (int i = 0; i < MIXER_NUM_PADS; i++) {
+        for (int s = 0; s < SOUND_LENGTH; s++) {
+            sounds[i][s] = (int16_t)((rand() & 0xffff) - 32768);
+        }
+    }
+
+    printf("ns per output sample, %d samples per run\n", BENCH_SAMPLES);
+    printf("voices  per-sample");
+    for (int b = 0; b < num_blocks; b++) {
+        printf("  block%-4u", blocks[b]);
+    }
+    printf("\n");
+
+    for (int voices = 1; voices <= MIXER_MAX_VOICES; voices++) {
+        if (voices <= LEGACY_TRACKS) {
+            printf("%6d  %10.2f", voices, bench_legacy(voices));
+        } else {
+            printf("%6d  %10s", voices, "-");
+        }
+        for (int b = 0; b < num_blocks; b++) {
+            printf("  %9.2f", bench_block(voices, blocks[b]));
+        }
+        printf("\n");
+    }
+
+    return 0;
+}
@@ -0,0 +1,151 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "render_script.h"
+#include "host_platform.h"
+
+static const char *const action_names[] = {"pad", "record", "play", "clear", "select", "next", "beat", "bpm"};
+#define NUM_ACTIONS (sizeof(action_names) / sizeof(action_names[0]))
+
+void script_init(script_t *script) {
+    script->count = 0;
+}
+
+bool script_add(script_t *script, uint32_t sample, script_action_t action, uint16_t arg) {
+    if (script->count == SCRIPT_MAX_EVENTS ||
+        (script->count > 0 && sample < script->events[script->count - 1].sample)) {
+        return false;
+    }
+    script->events[script->count].sample = sample;
+    script->events[script->count].action = (uint8_t)action;
+    script->events[script->count].arg = arg;
+    script->count++;
+    return true;
+}
+
+static bool parse_line(script_t *script, char *line, uint32_t sample_rate) {
+    char *hash = strchr(line, '#');
+    if (hash) {
+        *hash = '\0';
+    }
+
+    char what[16], arg[16];
+    double ms;
+    int fields = sscanf(line, "%lf %15s %15s", &ms, what, arg);
+    if (fields <= 0) {
+        return true;  // blank
+    }
+    if (fields < 2 || ms < 0) {
+        return false;
+    }
+
+    uint32_t action = 0;
+    while (action < NUM_ACTIONS && strcmp(what, action_names[action]) != 0) {
+        action++;
+    }
+    if (action == NUM_ACTIONS) {
+        return false;
+    }
+
+    long n = 0;
+    if (action == SCRIPT_PAD || action == SCRIPT_BEAT || action == SCRIPT_BPM) {
+        if (fields < 3) {
+            return false;
+        }
+        if (action == SCRIPT_BEAT && strcmp(arg, "none") == 0) {
+            n = TRANSPORT_NO_BEAT;
+        } else {
+            char *end;
+            n = strtol(arg, &end, 10);
+            if (*end != '\0' || n < 0 || n > 0xFFFF || (action == SCRIPT_PAD && n >= MIXER_NUM_PADS)) {
+                return false;
+            }
+        }
+    }
+
+    double sample = floor(ms * sample_rate / 1000 + 0.5);
+    return sample <= 0xFFFFFFFFu && script_add(script, (uint32_t)sample, action, (uint16_t)n);
+}
+
+bool script_load(script_t *script, const char *path, uint32_t sample_rate) {
+    FILE *f = fopen(path, "r");
+    if (f == NULL) {
+        fprintf(stderr, "cant open script %s\n", path);
+        return false;
+    }
+
+    char line[256];
+    uint32_t number = 0;
+    bool ok = true;
+    script_init(script);
+    while (ok && fgets(line, sizeof(line), f)) {
+        number++;
+        if (!parse_line(script, line, sample_rate)) {
+            fprintf(stderr, "%s:%u: cant use this (or it goes back in time): %s", path, number, line);
+            ok = false;
+        }
+    }
+    fclose(f);
+    return ok;
+}
+
+// A pad interrupt or button press, then the main loop handling it. start is the
+// sample the render started on
+static void deliver(drum_engine_t *engine, const script_event_t *event, uint32_t start) {
+    uint32_t time = host_us(start + event->sample);
+
+    host_log_now = time;
+    switch (event->action) {
+    case SCRIPT_PAD:
+        drum_engine_pad(engine, (uint8_t)event->arg, time);
+        break;
+    case SCRIPT_RECORD:
+        drum_engine_post(engine, TRANSPORT_EV_RECORD, 0, time);
+        break;
+    case SCRIPT_PLAY:
+        drum_engine_post(engine, TRANSPORT_EV_PLAY, 0, time);
+        break;
+    case SCRIPT_CLEAR:
+        drum_engine_post(engine, TRANSPORT_EV_CLEAR, 0, time);
+        break;
+    case SCRIPT_SELECT:
+        drum_engine_post(engine, TRANSPORT_EV_SOUND_SELECT, 0, time);
+        break;
+    case SCRIPT_NEXT:
+        drum_engine_post(engine, TRANSPORT_EV_BEAT_NEXT, 0, time);
+        break;
+    case SCRIPT_BEAT:
+        drum_engine_post(engine, TRANSPORT_EV_BEAT_PIN, (uint8_t)event->arg, time);
+        break;
+    case SCRIPT_BPM:
+        drum_engine_set_bpm(engine, event->arg);
+        break;
+    }
+
+    while (drum_engine_handle(engine)) {
+    }
+}
+
+void render_script(drum_engine_t *engine, const script_t *script, uint64_t samples,
+                   render_out_fn out, void *context) {
+    int16_t pcm[AUDIO_BLOCK_SIZE];
+    uint32_t next = 0;
+    uint32_t start = drum_engine_now(engine);
+
+    for (uint64_t done = 0; done < samples;) {
+        uint32_t n = samples - done < AUDIO_BLOCK_SIZE ? (uint32_t)(samples - done) : AUDIO_BLOCK_SIZE;
+
+        // the loop timer, then the audio interrupt
+        drum_engine_schedule(engine);
+        host_render(engine, pcm, n);
+        out(pcm, n, context);
+
+        // the block rendered before this one just started going out, whatever
+        // happens while it plays gets to the engine before the next block
+        while (script && next < script->count && script->events[next].sample < done) {
+            deliver(engine, &script->events[next++], start);
+        }
+        done += n;
+    }
+}
@@ -0,0 +1,62 @@
+#ifndef RENDER_SCRIPT_H
+#define RENDER_SCRIPT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "drum_engine.h"
+
+// Pad hits and button presses for rendering the engine offline, one per line:
+//   <ms> <what> [n]
+// with what being
+//   pad n     hit pad n (0 to 4)
+//   record    the record button, same for play, clear, select (sound select) and next (beat select)
+//   beat n    the arduino beat pins asking for classic beat n, or beat none
+//   bpm n     change the tempo like + and - on the serial
+// Times are from the start of the render and have to go forwards, anything after a #
+// is a comment. Each one reaches the engine the way it would on the pico, while the
+// block it happens in is going out, so recorded hits land on exactly their sample
+
+#ifndef SCRIPT_MAX_EVENTS
+#define SCRIPT_MAX_EVENTS 4096
+#endif
+
+typedef enum {
+    SCRIPT_PAD,
+    SCRIPT_RECORD,
+    SCRIPT_PLAY,
+    SCRIPT_CLEAR,
+    SCRIPT_SELECT,
+    SCRIPT_NEXT,
+    SCRIPT_BEAT,
+    SCRIPT_BPM,
+} script_action_t;
+
+typedef struct {
+    uint32_t sample;  // when, in samples from the start
+    uint8_t action;   // one of script_action_t
+    uint16_t arg;
+} script_event_t;
+
+typedef struct {
+    script_event_t events[SCRIPT_MAX_EVENTS];
+    uint32_t count;
+} script_t;
+
+void script_init(script_t *script);
+
+// Add one event, false if it is full or goes back in time
+bool script_add(script_t *script, uint32_t sample, script_action_t action, uint16_t arg);
+
+// Read a script file like the one above, prints the line that is wrong and returns
+// false if it cant
+bool script_load(script_t *script, const char *path, uint32_t sample_rate);
+
+// Called with every block rendered
+typedef void (*render_out_fn)(const int16_t *pcm, uint32_t n, void *context);
+
+// Run the engine for samples samples from where it is, feeding it the script as it
+// goes. script can be NULL
+void render_script(drum_engine_t *engine, const script_t *script, uint64_t samples,
+                   render_out_fn out, void *context);
+
+#endif // RENDER_SCRIPT_H
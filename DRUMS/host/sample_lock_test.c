@@ -0,0 +1,214 @@
+// Host test for the sample locked clock.
+// Records a loop the way the firmware does, pad times in us turned into samples by
+// a sample_clock_t anchored every block, then plays it back through the tempo and
+// the sequencer for hours of samples and checks every hit comes out on exactly the
+// sample it was recorded on, pass after pass. Then overdubs on top of it and checks
+// those come round exactly too.
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sample_clock.h"
+#include "tempo.h"
+#include "sequencer.h"
+
+#define SAMPLE_RATE 22050
+#define BLOCK 64
+#define LOOKAHEAD (2 * BLOCK)
+#define HOURS 10
+#define MAX_HITS 32
+
+typedef struct {
+    uint32_t offset;  // samples into the loop
+    uint8_t pad;
+} hit_t;
+
+static loop_event_t events[LOOP_STORE_EVENTS];
+static loop_store_t store;
+static sequencer_t seq;
+static tempo_t tempo;
+
+// what should come out of each pass, and what did
+static hit_t expected[MAX_HITS];
+static uint32_t num_expected;
+static hit_t got[MAX_HITS];
+static uint32_t num_got;
+static uint32_t play_start;
+static uint32_t loop_samples;
+static uint32_t current_pass;
+static uint32_t overdub_pass;  // pass the overdub went in, it plays from the one after
+static uint32_t passes_checked;
+static int failures;
+
+static int compare_hits(const void *a, const void *b) {
+    const hit_t *x = a, *y = b;
+    if (x->offset != y->offset) {
+        return x->offset < y->offset ? -1 : 1;
+    }
+    return x->pad - y->pad;
+}
+
+static const hit_t overdub_hits[] = {{100, 4}, {10007, 4}, {30011, 4}};
+#define NUM_OVERDUB (sizeof(overdub_hits) / sizeof(overdub_hits[0]))
+
+// Sort what a pass played and compare it with what was recorded
+static void check_pass(void) {
+    hit_t want[MAX_HITS];
+    uint32_t num_want = num_expected;
+
+    memcpy(want, expected, sizeof(want));
+    if (current_pass > overdub_pass) {
+        memcpy(want + num_want, overdub_hits, sizeof(overdub_hits));
+        num_want += NUM_OVERDUB;
+    }
+    qsort(want, num_want, sizeof(hit_t), compare_hits);
+    qsort(got, num_got, sizeof(hit_t), compare_hits);
+    if (num_got != num_want || memcmp(want, got, num_got * sizeof(hit_t)) != 0) {
+        if (failures < 10) {
+            printf("pass %u: played %u hits, expected %u", current_pass, num_got, num_want);
+            for (uint32_t i = 0; i < num_got && i < num_want; i++) {
+                if (got[i].offset != want[i].offset) {
+                    printf(", hit %u at %u not %u", i, got[i].offset, want[i].offset);
+                    break;
+                }
+            }
+            printf("\n");
+        }
+        failures++;
+    }
+    num_got = 0;
+    passes_checked++;
+}
+
+// Same as queue_loop_event in main.c, the sample it plays on has to be in the block
+static void emit(uint8_t pad, uint32_t tick, void *context) {
+    uint32_t sample = tempo_sample_of(&tempo, tick);
+    uint32_t since = sample - play_start;
+    uint32_t pass = since / loop_samples;
+
+    if ((int32_t)(sample - tempo.sample) < 0 || (int32_t)(sample - tempo_block_end(&tempo)) >= 0) {
+        if (failures < 10) {
+            printf("tick %u went to sample %u, outside its block\n", tick, sample);
+        }
+        failures++;
+    }
+    while (pass != current_pass) {
+        check_pass();
+        current_pass++;
+    }
+    if (num_got < MAX_HITS) {
+        got[num_got++] = (hit_t){since % loop_samples, pad};
+    }
+}
+
+// check_loop_events in main.c, for the block starting at now
+static void play_block(uint32_t now) {
+    uint32_t until = now + LOOKAHEAD;
+
+    while ((int32_t)(until - tempo_block_end(&tempo)) >= 0) {
+        sequencer_advance(&seq, tempo_block_end_tick(&tempo), emit, NULL);
+        tempo_advance(&tempo);
+    }
+}
+
+// The us a sample goes out at, with an interrupt that can be up to 30 us late.
+// Kept in 64 bits here so the real sample can be worked out, the clock gets 32
+static uint64_t us_of(uint64_t sample, uint32_t jitter) {
+    return sample * 1000000 / SAMPLE_RATE + jitter;
+}
+
+static void run(uint16_t bpm, uint32_t start_sample) {
+    sample_clock_t clock;
+    uint32_t record_start, record_stop;
+    uint64_t sample = start_sample;
+
+    // hits at odd places, some right at the start and end of the loop
+    static const uint32_t offsets_ms[] = {0, 1, 250, 251, 500, 733, 1000, 1499, 1999};
+    static const uint8_t pads[] = {0, 1, 3, 2, 0, 4, 1, 3, 2};
+    const uint32_t num_hits = sizeof(offsets_ms) / sizeof(offsets_ms[0]);
+    const uint32_t length_us = 2000123;
+
+    loop_store_init(&store, events, LOOP_STORE_EVENTS);
+    sequencer_init(&seq, &store);
+    tempo_init(&tempo, SAMPLE_RATE, BLOCK, bpm);
+    sample_clock_init(&clock, SAMPLE_RATE);
+    num_expected = num_got = 0;
+    current_pass = 0;
+    overdub_pass = 0xFFFFFFFFu;
+    passes_checked = 0;
+
+    // recording, the audio anchors the clock every block and the pads come in as us
+    uint64_t start_us = us_of(sample, 0) + 777;
+    uint32_t next_hit = 0;
+    sample_clock_anchor(&clock, (uint32_t)sample, (uint32_t)us_of(sample, 0));
+    record_start = sample_clock_at(&clock, (uint32_t)start_us);
+    while (next_hit <= num_hits) {
+        sample += BLOCK;
+        uint64_t block_us = us_of(sample, (uint32_t)(sample * 7) % 31);
+        sample_clock_anchor(&clock, (uint32_t)sample, (uint32_t)block_us);
+
+        // anything that happened during this block gets converted after it, like the main loop does
+        uint64_t hit_us = next_hit < num_hits ? start_us + offsets_ms[next_hit] * 1000 : start_us + length_us;
+        while (next_hit <= num_hits && block_us >= hit_us) {
+            uint32_t at = sample_clock_at(&clock, (uint32_t)hit_us);
+
+            // the clock shouldnt be more than a sample out from the real time
+            int32_t error = (int32_t)(at - (uint32_t)(hit_us * SAMPLE_RATE / 1000000));
+            if (error < -1 || error > 1) {
+                printf("%u bpm: us to samples out by %d\n", bpm, error);
+                failures++;
+            }
+
+            if (next_hit == num_hits) {
+                record_stop = at;
+            } else {
+                sequencer_record(&seq, at - record_start, pads[next_hit]);
+                expected[num_expected++] = (hit_t){at - record_start, pads[next_hit]};
+            }
+            next_hit++;
+            hit_us = next_hit < num_hits ? start_us + offsets_ms[next_hit] * 1000 : start_us + length_us;
+        }
+    }
+
+    // record_stop in main.c
+    loop_samples = record_stop - record_start;
+    uint32_t loop_ticks = tempo_samples_to_ticks(&tempo, loop_samples);
+    loop_store_scale(&store, loop_ticks, loop_samples);
+    sequencer_set_length(&seq, loop_ticks);
+    tempo_lock(&tempo, loop_ticks, loop_samples);
+
+    // playback for hours, start_loop_playback in main.c
+    uint32_t now = (uint32_t)sample + 12345;
+    play_start = now + BLOCK;
+    tempo_start(&tempo, play_start);
+    sequencer_start(&seq, 0);
+
+    uint64_t blocks = (uint64_t)HOURS * 3600 * SAMPLE_RATE / BLOCK;
+    uint32_t overdub_block = (10 * loop_samples + loop_samples * 3 / 4) / BLOCK;
+    for (uint64_t b = 0; b < blocks; b++, now += BLOCK) {
+        play_block(now);
+
+        // three quarters of the way through the 10th pass, overdub a few hits that were
+        // heard earlier in it. They were played live so they go round from the next pass
+        if (b == overdub_block) {
+            overdub_pass = (now - play_start) / loop_samples;
+            sequencer_overdub_start(&seq);
+            for (uint32_t i = 0; i < NUM_OVERDUB; i++) {
+                uint32_t heard = play_start + overdub_pass * loop_samples + overdub_hits[i].offset;
+                sequencer_overdub(&seq, tempo_tick_at(&tempo, heard), overdub_hits[i].pad);
+            }
+        }
+    }
+
+    printf("%u bpm: %u sample loop, %u passes in %u hours all sample exact%s\n", bpm, loop_samples,
+           passes_checked, HOURS, failures ? " (NOT)" : "");
+}
+
+int main(void) {
+    run(120, 1000);
+    run(300, 0xFFF00000u);  // the sample counter wraps during this one, and the tick clock a few times
+    run(93, 777777);
+
+    printf("sample lock: %d failures\n", failures);
+    return failures ? 1 : 0;
+}
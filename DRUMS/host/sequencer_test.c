@@ -0,0 +1,152 @@
+// Host test for the sequencer with a loop as big as the store holds.
+// Fills the loop store to within a few hits of LOOP_STORE_EVENTS over a few layers,
+// with gaps from nothing (hits on the same tick) up to near the biggest delta an
+// event can hold, so the loop is over an hour long in ticks. Then plays it for
+// several passes with the tick clock wrapping round, advancing by anything from one
+// tick to more than a whole loop at a time, and checks every hit comes out exactly
+// once a pass, in order, on its own tick and never outside the range asked for.
+#include <stdio.h>
+#include <stdint.h>
+#include "sequencer.h"
+
+#define LAYERS 4              // each layer plays its own pad so emit can tell them apart
+#define HITS (LOOP_STORE_EVENTS - 3)
+#define PASSES 6
+#define START_TICK 0xF0000000u  // the tick clock wraps in the first pass
+#define MAX_LENGTH (1u << 30)   // comparisons in the sequencer are by signed difference
+#define SMALL_GAP 100000        // about 0.7 s at 120 BPM
+
+typedef struct {
+    uint32_t time;
+    uint8_t pad;
+} hit_t;
+
+static loop_event_t events[LOOP_STORE_EVENTS];
+static loop_store_t store;
+static sequencer_t seq;
+static hit_t hits[LAYERS][HITS];
+static uint32_t layer_hits[LAYERS];
+static uint32_t length;
+
+// how far each layer has got while playing, and the range being handed out
+static uint32_t next_hit[LAYERS];
+static uint32_t passes[LAYERS];
+static uint32_t range_start;
+static uint32_t range_end;
+static uint32_t emitted;
+static int failures;
+
+static uint32_t seed = 1;
+
+static uint32_t next_random(void) {
+    seed = seed * 1664525u + 1013904223u;
+    return seed >> 8;
+}
+
+// Every layer starts on tick 0, then mostly short gaps, some hits together and now
+// and then a gap of a good chunk of an event's delta
+static void make_loop(void) {
+    loop_store_init(&store, events, LOOP_STORE_EVENTS);
+    sequencer_init(&seq, &store);
+
+    for (uint32_t l = 0; l < LAYERS; l++) {
+        uint32_t count = HITS / LAYERS + (l == 0 ? HITS % LAYERS : 0);
+        uint32_t time = 0;
+
+        if (l > 0) {
+            loop_store_new_layer(&store);
+        }
+        for (uint32_t i = 0; i < count; i++) {
+            if (i > 0) {
+                uint32_t r = next_random();
+                uint32_t gap = r % 8 == 0 ? 0 : r % SMALL_GAP;
+                if (r % 256 == 1) {
+                    gap = LOOP_EVENT_MAX_DELTA / 2 + r % (LOOP_EVENT_MAX_DELTA / 2);
+                }
+                if (time + gap >= MAX_LENGTH - SMALL_GAP) {
+                    gap = r % 2;
+                }
+                time += gap;
+            }
+            hits[l][i] = (hit_t){time, (uint8_t)l};
+            loop_store_append(&store, time, (uint8_t)l);
+        }
+        layer_hits[l] = count;
+        // the last hit of the longest layer sits on the last tick of the loop
+        if (time + 1 > length) {
+            length = time + 1;
+        }
+    }
+    sequencer_set_length(&seq, length);
+}
+
+static void emit(uint8_t pad, uint32_t time, void *context) {
+    emitted++;
+    if (pad >= LAYERS) {
+        printf("FAIL: pad %u isnt in the loop\n", pad);
+        failures++;
+        return;
+    }
+
+    uint32_t l = pad;
+    const hit_t *hit = &hits[l][next_hit[l]];
+    uint32_t want = START_TICK + passes[l] * length + hit->time;
+    if (time != want || (int32_t)(time - range_start) < 0 || (int32_t)(time - range_end) >= 0) {
+        if (failures++ < 10) {
+            printf("FAIL: layer %u pass %u hit %u at tick %u, wanted %u, asked for %u to %u\n", l, passes[l],
+                   next_hit[l], time, want, range_start, range_end);
+        }
+    }
+    if (++next_hit[l] == layer_hits[l]) {
+        next_hit[l] = 0;
+        passes[l]++;
+    }
+}
+
+int main(void) {
+    make_loop();
+    if (store.used != HITS || store.dropped != 0 || store.num_layers != LAYERS) {
+        printf("FAIL: store has %u hits in %u layers, %u dropped, wanted %u\n", store.used, store.num_layers,
+               store.dropped, HITS);
+        return 1;
+    }
+
+    // the whole run is more ticks than the clock holds, so count what is left in 64 bits
+    sequencer_start(&seq, START_TICK);
+    uint64_t left = (uint64_t)PASSES * length;
+    range_start = START_TICK;
+    while (left > 0) {
+        // mostly small steps, sometimes more than a whole loop in one go, and sometimes
+        // right up to a hit, which then has to wait for the next step
+        uint32_t r = next_random();
+        uint32_t step = r % 64 == 0 ? length + length / 3 : 1 + r % (length / 50);
+        if (r % 4 == 1) {
+            uint32_t hit = START_TICK + passes[0] * length + hits[0][next_hit[0]].time;
+            step = hit - range_start ? hit - range_start : step;
+        }
+        if (step > left) {
+            step = (uint32_t)left;
+        }
+        range_end = range_start + step;
+
+        sequencer_advance(&seq, range_end, emit, NULL);
+        range_start = range_end;
+        left -= step;
+    }
+
+    for (uint32_t l = 0; l < LAYERS; l++) {
+        if (passes[l] != PASSES || next_hit[l] != 0) {
+            printf("FAIL: layer %u played %u passes and %u hits, wanted %u passes\n", l, passes[l], next_hit[l],
+                   PASSES);
+            failures++;
+        }
+    }
+    if (emitted != (uint32_t)HITS * PASSES) {
+        printf("FAIL: %u hits played, wanted %u\n", emitted, HITS * PASSES);
+        failures++;
+    }
+
+    printf("sequencer: %u hits in %u layers over %u ticks, %u passes, %d failures\n", HITS, LAYERS, length,
+           PASSES, failures);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,161 @@
+#include "synth_kernels.h"
+
+// rich_lookup_table from the sketch
+const int16_t synth_table[SYNTH_TABLE_SIZE] = {
+    2048, 2207, 2364, 2520, 2672, 2820, 2963, 3101,
+    3231, 3354, 3469, 3576, 3672, 3760, 3837, 3904,
+    3961, 4008, 4044, 4071, 4088, 4095, 4094, 4084,
+    4066, 4042, 4011, 3974, 3932, 3886, 3837, 3785,
+    3732, 3677, 3623, 3568, 3515, 3464, 3415, 3368,
+    3325, 3285, 3249, 3216, 3188, 3164, 3145, 3129,
+    3117, 3109, 3104, 3102, 3103, 3107, 3112, 3119,
+    3127, 3135, 3144, 3152, 3160, 3166, 3171, 3175,
+    3176, 3175, 3171, 3164, 3155, 3143, 3128, 3110,
+    3089, 3066, 3040, 3012, 2982, 2950, 2917, 2883,
+    2848, 2813, 2778, 2743, 2709, 2676, 2644, 2614,
+    2585, 2559, 2534, 2512, 2492, 2474, 2459, 2446,
+    2436, 2427, 2421, 2416, 2413, 2411, 2410, 2410,
+    2410, 2411, 2411, 2412, 2411, 2409, 2407, 2402,
+    2396, 2389, 2379, 2367, 2353, 2337, 2319, 2299,
+    2277, 2253, 2227, 2200, 2171, 2141, 2111, 2079,
+    2048, 2017, 1985, 1955, 1925, 1896, 1869, 1843,
+    1819, 1797, 1777, 1759, 1743, 1729, 1717, 1707,
+    1700, 1694, 1689, 1687, 1685, 1684, 1685, 1685,
+    1686, 1686, 1686, 1685, 1683, 1680, 1675, 1669,
+    1660, 1650, 1637, 1622, 1604, 1584, 1562, 1537,
+    1511, 1482, 1452, 1420, 1387, 1353, 1318, 1283,
+    1248, 1213, 1179, 1146, 1114, 1084, 1056, 1030,
+    1007, 986, 968, 953, 941, 932, 925, 921,
+    920, 921, 925, 930, 936, 944, 952, 961,
+    969, 977, 984, 989, 993, 994, 992, 987,
+    979, 967, 951, 932, 908, 880, 847, 811,
+    771, 728, 681, 632, 581, 528, 473, 419,
+    364, 311, 259, 210, 164, 122, 85, 54,
+    30, 12, 2, 1, 8, 25, 52, 88,
+    135, 192, 259, 336, 424, 520, 627, 742,
+    865, 995, 1133, 1276, 1424, 1576, 1732, 1889,
+};
+
+// the two voices are mixed a bit unevenly, like in the sketch
+#define WEIGHT0 0.55f
+#define WEIGHT1 0.45f
+#define FIXED_WEIGHT0 141  // the same in 8.8
+#define FIXED_WEIGHT1 115
+
+// ---- as in the sketch ----
+
+void synth_envelope(synth_voice_t *v, const synth_rates_t *rates) {
+    if (v->env_state == SYNTH_ENV_ATTACK) {
+        v->env_level += rates->attack;
+        if (v->env_level >= 1.0f) {
+            v->env_level = 1.0f;
+            v->env_state = SYNTH_ENV_DECAY;
+        }
+    } else if (v->env_state == SYNTH_ENV_DECAY) {
+        v->env_level -= rates->decay;
+        if (v->env_level <= v->decay_target) {
+            v->env_level = v->sustain_level;
+            v->env_state = SYNTH_ENV_SUSTAIN;
+        }
+    } else if (v->env_state == SYNTH_ENV_SUSTAIN) {
+        v->env_level = v->sustain_level;
+    } else if (v->env_state == SYNTH_ENV_RELEASE) {
+        v->env_level -= rates->release;
+        if (v->env_level <= 0.0f) {
+            v->env_level = 0.0f;
+            v->env_state = SYNTH_ENV_IDLE;
+            v->active = false;
+        }
+    }
+}
+
+static float oscillate(synth_voice_t *v) {
+    v->phase += v->phase_increment;
+    while (v->phase >= SYNTH_TABLE_SIZE) {
+        v->phase -= SYNTH_TABLE_SIZE;
+    }
+    uint8_t index = (uint8_t)v->phase;
+    return (synth_table[index] - SYNTH_MIDPOINT) * v->env_level;
+}
+
+int synth_oscillator(synth_voice_t *voices) {
+    float mixed = 0.0f;
+    for (uint8_t i = 0; i < SYNTH_VOICES; i++) {
+        if (voices[i].active) {
+            mixed += (i == 0 ? WEIGHT0 : WEIGHT1) * oscillate(&voices[i]);
+        }
+    }
+    return (int)(mixed + SYNTH_MIDPOINT);
+}
+
+int synth_generate(synth_voice_t *voices, const synth_rates_t *rates) {
+    float mixed = 0.0f;
+    for (uint8_t i = 0; i < SYNTH_VOICES; i++) {
+        if (!voices[i].active) {
+            continue;
+        }
+        synth_envelope(&voices[i], rates);
+        mixed += (i == 0 ? WEIGHT0 : WEIGHT1) * oscillate(&voices[i]);
+    }
+    return (int)(mixed + SYNTH_MIDPOINT);
+}
+
+// ---- fixed point ----
+
+void synth_fixed_envelope(synth_fixed_voice_t *v, const synth_fixed_rates_t *rates) {
+    switch (v->env_state) {
+    case SYNTH_ENV_ATTACK:
+        v->env_level += rates->attack;
+        if (v->env_level >= SYNTH_FIXED_ONE) {
+            v->env_level = SYNTH_FIXED_ONE;
+            v->env_state = SYNTH_ENV_DECAY;
+        }
+        break;
+    case SYNTH_ENV_DECAY:
+        v->env_level -= rates->decay;
+        if (v->env_level <= v->decay_target) {
+            v->env_level = v->sustain_level;
+            v->env_state = SYNTH_ENV_SUSTAIN;
+        }
+        break;
+    case SYNTH_ENV_SUSTAIN:
+        v->env_level = v->sustain_level;
+        break;
+    case SYNTH_ENV_RELEASE:
+        v->env_level -= rates->release;
+        if (v->env_level <= 0) {
+            v->env_level = 0;
+            v->env_state = SYNTH_ENV_IDLE;
+            v->active = false;
+        }
+        break;
+    }
+}
+
+// the table value times the envelope, still Q16
+static int32_t fixed_oscillate(synth_fixed_voice_t *v) {
+    v->phase += v->phase_increment;
+    return (synth_table[v->phase >> 24] - SYNTH_MIDPOINT) * v->env_level;
+}
+
+int synth_fixed_oscillator(synth_fixed_voice_t *voices) {
+    int32_t mixed = 0;
+    for (uint8_t i = 0; i < SYNTH_VOICES; i++) {
+        if (voices[i].active) {
+            mixed += (i == 0 ? FIXED_WEIGHT0 : FIXED_WEIGHT1) * (fixed_oscillate(&voices[i]) >> 16);
+        }
+    }
+    return (mixed >> 8) + SYNTH_MIDPOINT;
+}
+
+int synth_fixed_generate(synth_fixed_voice_t *voices, const synth_fixed_rates_t *rates) {
+    int32_t mixed = 0;
+    for (uint8_t i = 0; i < SYNTH_VOICES; i++) {
+        if (!voices[i].active) {
+            continue;
+        }
+        synth_fixed_envelope(&voices[i], rates);
+        mixed += (i == 0 ? FIXED_WEIGHT0 : FIXED_WEIGHT1) * (fixed_oscillate(&voices[i]) >> 16);
+    }
+    return (mixed >> 8) + SYNTH_MIDPOINT;
+}
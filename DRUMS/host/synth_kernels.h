@@ -0,0 +1,79 @@
+#ifndef SYNTH_KERNELS_H
+#define SYNTH_KERNELS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// The per sample work of SYNTHESIZER/synthesizer.ino (the envelope and the
+// wavetable oscillator) in plain C so it can be benchmarked on the PC, plus a
+// fixed point version to compare it with. The float one is copied from the
+// sketch as it is, keep it in step if the sketch changes.
+
+#define SYNTH_VOICES 2
+#define SYNTH_TABLE_SIZE 256
+#define SYNTH_MIDPOINT 2048  // the table and the DAC are 12 bit, centred here
+
+typedef enum {
+    SYNTH_ENV_IDLE,
+    SYNTH_ENV_ATTACK,
+    SYNTH_ENV_DECAY,
+    SYNTH_ENV_SUSTAIN,
+    SYNTH_ENV_RELEASE,
+} synth_env_state_t;
+
+extern const int16_t synth_table[SYNTH_TABLE_SIZE];
+
+// ---- as in the sketch ----
+
+typedef struct {
+    bool active;
+    float phase;            // 0 to 256, fractional
+    float phase_increment;  // per sample
+    float env_level;        // 0 to 1
+    uint8_t env_state;      // one of synth_env_state_t
+    float decay_target;
+    float sustain_level;
+} synth_voice_t;
+
+typedef struct {
+    float attack;   // per sample
+    float decay;
+    float release;
+} synth_rates_t;
+
+// updateEnvelope
+void synth_envelope(synth_voice_t *voice, const synth_rates_t *rates);
+
+// generateAudio without the envelope, the DAC value for the next sample
+int synth_oscillator(synth_voice_t *voices);
+
+// generateAudio, envelope and oscillator for every voice
+int synth_generate(synth_voice_t *voices, const synth_rates_t *rates);
+
+// ---- fixed point ----
+// The envelope is Q16 (65536 is full level) and the phase is 8.24 so it wraps round
+// the table by itself, no floats anywhere. Same shape, the rounding is different
+
+#define SYNTH_FIXED_ONE 65536
+
+typedef struct {
+    bool active;
+    uint32_t phase;            // table index in the top 8 bits
+    uint32_t phase_increment;
+    int32_t env_level;         // Q16
+    uint8_t env_state;
+    int32_t decay_target;
+    int32_t sustain_level;
+} synth_fixed_voice_t;
+
+typedef struct {
+    int32_t attack;   // Q16 per sample
+    int32_t decay;
+    int32_t release;
+} synth_fixed_rates_t;
+
+void synth_fixed_envelope(synth_fixed_voice_t *voice, const synth_fixed_rates_t *rates);
+int synth_fixed_oscillator(synth_fixed_voice_t *voices);
+int synth_fixed_generate(synth_fixed_voice_t *voices, const synth_fixed_rates_t *rates);
+
+#endif // SYNTH_KERNELS_H
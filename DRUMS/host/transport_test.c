@@ -0,0 +1,238 @@
+// Host test for the transport state machine.
+// Feeds scripted button/pad/beat pin events through it and checks the state it
+// ends up in and exactly what it asked the firmware to do, using ops that just
+// write down what they were called with.
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include "transport.h"
+
+#define NUM_SOUNDS 8
+#define NUM_BEATS 3
+
+// everything the ops got asked to do since the last step, like "rs@100 rp0@150"
+static char trace[256];
+static uint32_t recorded;
+
+static void trace_add(const char *format, unsigned a, unsigned b) {
+    size_t used = strlen(trace);
+    snprintf(trace + used, sizeof(trace) - used, used ? " " : "");
+    used = strlen(trace);
+    snprintf(trace + used, sizeof(trace) - used, format, a, b);
+}
+
+static void op_play_pad(void *context, uint8_t pad) { trace_add("pp%u", pad, 0); }
+static void op_assign_sound(void *context, uint8_t pad, uint8_t sound) { trace_add("as%u=%u", pad, sound); }
+static void op_record_start(void *context, uint32_t time) { recorded = 0; trace_add("rs@%u", time, 0); }
+static void op_record_pad(void *context, uint8_t pad, uint32_t time) { recorded++; trace_add("rp%u@%u", pad, time); }
+static void op_play_start(void *context) { trace_add("ps", 0, 0); }
+static void op_play_stop(void *context) { trace_add("px", 0, 0); }
+static void op_clear(void *context) { recorded = 0; trace_add("cl", 0, 0); }
+static void op_load_beat(void *context, uint8_t beat) { trace_add("lb%u", beat, 0); }
+static void op_overdub_start(void *context) { trace_add("od", 0, 0); }
+static void op_overdub_pad(void *context, uint8_t pad, uint32_t time) { trace_add("op%u@%u", pad, time); }
+static void op_overdub_stop(void *context) { trace_add("ox", 0, 0); }
+static void op_undo(void *context) { trace_add("un", 0, 0); }
+
+static uint32_t op_record_stop(void *context, uint32_t time) {
+    trace_add("re@%u", time, 0);
+    return recorded;
+}
+
+static const transport_ops_t test_ops = {
+    .play_pad = op_play_pad,
+    .assign_sound = op_assign_sound,
+    .record_start = op_record_start,
+    .record_pad = op_record_pad,
+    .record_stop = op_record_stop,
+    .play_start = op_play_start,
+    .play_stop = op_play_stop,
+    .clear = op_clear,
+    .load_beat = op_load_beat,
+    .overdub_start = op_overdub_start,
+    .overdub_pad = op_overdub_pad,
+    .overdub_stop = op_overdub_stop,
+    .undo = op_undo,
+};
+
+typedef struct {
+    uint8_t type;
+    uint8_t arg;
+    uint32_t time;
+    transport_state_t state;  // state we should be in after it
+    const char *ops;          // what should have been asked for
+} test_step_t;
+
+#define PAD(pad, time) TRANSPORT_EV_PAD, pad, time
+#define BUTTON(type, time) TRANSPORT_EV_##type, 0, time
+#define BEAT_PIN(beat, time) TRANSPORT_EV_BEAT_PIN, beat, time
+
+static const test_step_t script[] = {
+    // pads on their own dont do anything in the main loop, the interrupt plays them
+    {PAD(0, 10),                   TRANSPORT_IDLE,         ""},
+
+    // record a loop of two hits, stopping it plays it back
+    {BUTTON(RECORD, 100),          TRANSPORT_RECORDING,    "px rs@100"},
+    {PAD(1, 150),                  TRANSPORT_RECORDING,    "rp1@150"},
+    {BUTTON(PLAY, 160),            TRANSPORT_RECORDING,    ""},
+    {PAD(3, 200),                  TRANSPORT_RECORDING,    "rp3@200"},
+    {BUTTON(RECORD, 300),          TRANSPORT_PLAYING,      "re@300 ps"},
+    {PAD(2, 310),                  TRANSPORT_PLAYING,      ""},
+    {BUTTON(PLAY, 400),            TRANSPORT_IDLE,         "px"},
+    {BUTTON(PLAY, 410),            TRANSPORT_PLAYING,      "ps"},
+
+    // clearing stops it
+    {BUTTON(CLEAR, 500),           TRANSPORT_IDLE,         "px cl"},
+
+    // a recording with nothing in it doesnt play
+    {BUTTON(RECORD, 600),          TRANSPORT_RECORDING,    "px rs@600"},
+    {BUTTON(RECORD, 700),          TRANSPORT_IDLE,         "re@700"},
+
+    // clearing while recording throws the take away but keeps going
+    {BUTTON(RECORD, 800),          TRANSPORT_RECORDING,    "px rs@800"},
+    {PAD(0, 810),                  TRANSPORT_RECORDING,    "rp0@810"},
+    {BUTTON(CLEAR, 820),           TRANSPORT_RECORDING,    "cl"},
+    {BUTTON(RECORD, 830),          TRANSPORT_IDLE,         "re@830"},
+
+    // the beat button goes on from the starting beat and wraps round
+    {BUTTON(BEAT_NEXT, 900),       TRANSPORT_BEAT,         "lb0 ps"},
+    {BUTTON(BEAT_NEXT, 910),       TRANSPORT_BEAT,         "lb1 ps"},
+    {BUTTON(PLAY, 920),            TRANSPORT_IDLE,         "px"},
+
+    // beat pins from the arduino
+    {BEAT_PIN(2, 1000),            TRANSPORT_BEAT,         "lb2 ps"},
+    {BEAT_PIN(TRANSPORT_NO_BEAT, 1010), TRANSPORT_IDLE,    "px"},
+    {BEAT_PIN(TRANSPORT_NO_BEAT, 1020), TRANSPORT_IDLE,    ""},
+
+    // picking sounds, first touch picks the pad, touching it again moves its sound on
+    {BUTTON(SOUND_SELECT, 1100),   TRANSPORT_SOUND_SELECT, "px"},
+    {PAD(4, 1110),                 TRANSPORT_SOUND_SELECT, "pp4"},
+    {PAD(4, 1120),                 TRANSPORT_SOUND_SELECT, "as4=5 pp4"},
+    {PAD(4, 1130),                 TRANSPORT_SOUND_SELECT, "as4=6 pp4"},
+    {PAD(1, 1140),                 TRANSPORT_SOUND_SELECT, "pp1"},
+    {PAD(1, 1150),                 TRANSPORT_SOUND_SELECT, "as1=2 pp1"},
+
+    // the other buttons are ignored, beat pins wait until we are done
+    {BUTTON(RECORD, 1200),         TRANSPORT_SOUND_SELECT, ""},
+    {BUTTON(PLAY, 1210),           TRANSPORT_SOUND_SELECT, ""},
+    {BUTTON(CLEAR, 1220),          TRANSPORT_SOUND_SELECT, ""},
+    {BUTTON(BEAT_NEXT, 1230),      TRANSPORT_SOUND_SELECT, ""},
+    {BEAT_PIN(0, 1240),            TRANSPORT_SOUND_SELECT, ""},
+    {BUTTON(SOUND_SELECT, 1300),   TRANSPORT_BEAT,         "lb0 ps"},
+
+    // back in select a pad carries on from the sound it was given
+    {BUTTON(SOUND_SELECT, 1400),   TRANSPORT_SOUND_SELECT, "px"},
+    {PAD(4, 1410),                 TRANSPORT_SOUND_SELECT, "pp4"},
+    {PAD(4, 1420),                 TRANSPORT_SOUND_SELECT, "as4=7 pp4"},
+    {PAD(4, 1430),                 TRANSPORT_SOUND_SELECT, "as4=0 pp4"},
+    {BUTTON(SOUND_SELECT, 1500),   TRANSPORT_IDLE,         ""},
+
+    // recording over a beat stops the beat first
+    {BEAT_PIN(1, 1600),            TRANSPORT_BEAT,         "lb1 ps"},
+    {BUTTON(RECORD, 1700),         TRANSPORT_RECORDING,    "px rs@1700"},
+    {PAD(2, 1710),                 TRANSPORT_RECORDING,    "rp2@1710"},
+    {BEAT_PIN(TRANSPORT_NO_BEAT, 1720), TRANSPORT_RECORDING, ""},
+    {BUTTON(RECORD, 1800),         TRANSPORT_PLAYING,      "re@1800 ps"},
+
+    // record while the loop plays overdubs on top, clear takes the last pass off
+    {BUTTON(RECORD, 1900),         TRANSPORT_OVERDUB,      "od"},
+    {PAD(3, 1910),                 TRANSPORT_OVERDUB,      "op3@1910"},
+    {BUTTON(CLEAR, 1920),          TRANSPORT_OVERDUB,      "un"},
+    {BUTTON(RECORD, 1930),         TRANSPORT_PLAYING,      "ox"},
+    {PAD(3, 1940),                 TRANSPORT_PLAYING,      ""},
+
+    // however overdubbing ends it gets stopped
+    {BUTTON(RECORD, 2000),         TRANSPORT_OVERDUB,      "od"},
+    {BUTTON(PLAY, 2010),           TRANSPORT_IDLE,         "px ox"},
+    {BUTTON(PLAY, 2020),           TRANSPORT_PLAYING,      "ps"},
+    {BUTTON(RECORD, 2030),         TRANSPORT_OVERDUB,      "od"},
+    {BEAT_PIN(TRANSPORT_NO_BEAT, 2040), TRANSPORT_OVERDUB, ""},
+    {BEAT_PIN(0, 2050),            TRANSPORT_BEAT,         "lb0 ps ox"},
+    {BUTTON(PLAY, 2060),           TRANSPORT_IDLE,         "px"},
+    {BUTTON(PLAY, 2070),           TRANSPORT_PLAYING,      "ps"},
+    {BUTTON(RECORD, 2080),         TRANSPORT_OVERDUB,      "od"},
+    {BUTTON(SOUND_SELECT, 2090),   TRANSPORT_SOUND_SELECT, "px ox"},
+    {BUTTON(SOUND_SELECT, 2100),   TRANSPORT_IDLE,         ""},
+
+    // going to another mode in the middle of a recording finishes the take first
+    {BUTTON(RECORD, 2200),         TRANSPORT_RECORDING,    "px rs@2200"},
+    {PAD(1, 2210),                 TRANSPORT_RECORDING,    "rp1@2210"},
+    {BUTTON(SOUND_SELECT, 2220),   TRANSPORT_SOUND_SELECT, "re@2220 px"},
+    {BUTTON(SOUND_SELECT, 2230),   TRANSPORT_IDLE,         ""},
+    {BUTTON(RECORD, 2300),         TRANSPORT_RECORDING,    "px rs@2300"},
+    {PAD(0, 2310),                 TRANSPORT_RECORDING,    "rp0@2310"},
+    {BUTTON(BEAT_NEXT, 2320),      TRANSPORT_BEAT,         "re@2320 lb1 ps"},
+    {BUTTON(PLAY, 2330),           TRANSPORT_IDLE,         "px"},
+    {BUTTON(RECORD, 2400),         TRANSPORT_RECORDING,    "px rs@2400"},
+    {PAD(4, 2410),                 TRANSPORT_RECORDING,    "rp4@2410"},
+    {BEAT_PIN(2, 2420),            TRANSPORT_BEAT,         "re@2420 lb2 ps"},
+    {BUTTON(PLAY, 2430),           TRANSPORT_IDLE,         "px"},
+};
+
+#define NUM_STEPS (sizeof(script) / sizeof(script[0]))
+
+// Run the script straight through transport_handle
+static int run_script(void) {
+    transport_t transport;
+    int failures = 0;
+
+    transport_init(&transport, &test_ops, NULL, NUM_SOUNDS, NUM_BEATS, NUM_BEATS - 1);
+    for (size_t i = 0; i < NUM_STEPS; i++) {
+        const test_step_t *step = &script[i];
+        transport_event_t event = {step->time, step->type, step->arg};
+
+        trace[0] = '\0';
+        transport_handle(&transport, &event);
+
+        if (transport.state != step->state || strcmp(trace, step->ops) != 0) {
+            printf("step %zu: got %s \"%s\", expected %s \"%s\"\n", i,
+                   transport_state_name(transport.state), trace,
+                   transport_state_name(step->state), step->ops);
+            failures++;
+        }
+    }
+
+    // sounds picked in select stay with the pads
+    if (transport.pad_sound[1] != 2 || transport.pad_sound[4] != 0 || transport.pad_sound[0] != 0) {
+        printf("pad sounds wrong: %u %u %u\n", transport.pad_sound[0], transport.pad_sound[1], transport.pad_sound[4]);
+        failures++;
+    }
+    return failures;
+}
+
+// Events go through the queue in order with their times, and a full queue says so
+static int run_queue(void) {
+    transport_t transport;
+    transport_event_t event;
+    int failures = 0;
+
+    transport_init(&transport, &test_ops, NULL, NUM_SOUNDS, NUM_BEATS, 0);
+    for (uint32_t i = 0; i < TRANSPORT_QUEUE_SIZE; i++) {
+        if (!transport_post(&transport, TRANSPORT_EV_PAD, (uint8_t)(i % MIXER_NUM_PADS), 1000 + i)) {
+            printf("queue: post %u failed\n", i);
+            failures++;
+        }
+    }
+    if (transport_post(&transport, TRANSPORT_EV_PAD, 0, 0) || transport.overflows != 1) {
+        printf("queue: full queue took an event\n");
+        failures++;
+    }
+    for (uint32_t i = 0; i < TRANSPORT_QUEUE_SIZE; i++) {
+        if (!transport_pop(&transport, &event) || event.time != 1000 + i || event.arg != i % MIXER_NUM_PADS) {
+            printf("queue: event %u came out wrong\n", i);
+            failures++;
+        }
+    }
+    if (transport_pop(&transport, &event)) {
+        printf("queue: empty queue gave an event\n");
+        failures++;
+    }
+    return failures;
+}
+
+int main(void) {
+    int failures = run_script() + run_queue();
+
+    printf("transport: %zu steps, %d failures\n", NUM_STEPS, failures);
+    return failures ? 1 : 0;
+}
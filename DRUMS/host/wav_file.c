@@ -0,0 +1,84 @@
+#include <string.h>
+#include "wav_file.h"
+
+#define WAV_HEADER_BYTES 44
+
+// WAV is little endian whatever we are running on
+static void put16(uint8_t *at, uint16_t value) {
+    at[0] = (uint8_t)value;
+    at[1] = (uint8_t)(value >> 8);
+}
+
+static void put32(uint8_t *at, uint32_t value) {
+    put16(at, (uint16_t)value);
+    put16(at + 2, (uint16_t)(value >> 16));
+}
+
+static void make_header(uint8_t *header, uint32_t sample_rate, uint64_t samples) {
+    uint64_t data_bytes = samples * 2;
+    if (data_bytes > 0xFFFFFFFFu - WAV_HEADER_BYTES) {
+        data_bytes = (0xFFFFFFFFu - WAV_HEADER_BYTES) & ~1u;
+    }
+
+    memcpy(header, "RIFF", 4);
+    put32(header + 4, (uint32_t)data_bytes + WAV_HEADER_BYTES - 8);
+    memcpy(header + 8, "WAVEfmt ", 8);
+    put32(header + 16, 16);               // fmt chunk size
+    put16(header + 20, 1);                // plain PCM
+    put16(header + 22, 1);                // mono
+    put32(header + 24, sample_rate);
+    put32(header + 28, sample_rate * 2);  // bytes a second
+    put16(header + 32, 2);                // bytes a sample
+    put16(header + 34, 16);               // bits a sample
+    memcpy(header + 36, "data", 4);
+    put32(header + 40, (uint32_t)data_bytes);
+}
+
+bool wav_file_open(wav_file_t *wav, const char *path, uint32_t sample_rate) {
+    uint8_t header[WAV_HEADER_BYTES];
+
+    wav->sample_rate = sample_rate;
+    wav->samples = 0;
+    wav->file = fopen(path, "wb");
+    if (wav->file == NULL) {
+        fprintf(stderr, "cant write %s\n", path);
+        return false;
+    }
+
+    // sizes are 0 until wav_file_close puts them in
+    make_header(header, sample_rate, 0);
+    return fwrite(header, 1, sizeof(header), wav->file) == sizeof(header);
+}
+
+bool wav_file_write(wav_file_t *wav, const int16_t *samples, uint32_t n) {
+    uint8_t bytes[512];
+    uint32_t done = 0;
+
+    while (done < n) {
+        uint32_t chunk = n - done < sizeof(bytes) / 2 ? n - done : sizeof(bytes) / 2;
+        for (uint32_t i = 0; i < chunk; i++) {
+            put16(bytes + i * 2, (uint16_t)samples[done + i]);
+        }
+        if (fwrite(bytes, 2, chunk, wav->file) != chunk) {
+            return false;
+        }
+        done += chunk;
+    }
+    wav->samples += n;
+    return true;
+}
+
+bool wav_file_close(wav_file_t *wav) {
+    uint8_t header[WAV_HEADER_BYTES];
+    bool ok = true;
+
+    make_header(header, wav->sample_rate, wav->samples);
+    if (fseek(wav->file, 0, SEEK_SET) != 0 || fwrite(header, 1, sizeof(header), wav->file) != sizeof(header)) {
+        ok = false;
+    }
+    if (fclose(wav->file) != 0) {
+        ok = false;
+    }
+    wav->file = NULL;
+    return ok;
+}
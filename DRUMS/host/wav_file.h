@@ -0,0 +1,26 @@
+#ifndef WAV_FILE_H
+#define WAV_FILE_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+// Writes mono 16 bit WAV files a block at a time, so hours of audio never have to
+// be in memory. The sizes in the header get filled in when it is closed
+
+typedef struct {
+    FILE *file;
+    uint32_t sample_rate;
+    uint64_t samples;  // written so far
+} wav_file_t;
+
+// Prints why and returns false if the file cant be made
+bool wav_file_open(wav_file_t *wav, const char *path, uint32_t sample_rate);
+
+bool wav_file_write(wav_file_t *wav, const int16_t *samples, uint32_t n);
+
+// Fixes up the header and closes it, false if anything didnt get written. A WAV
+// cant hold more than 4 GB, past that the sizes are left at the most it can say
+bool wav_file_close(wav_file_t *wav);
+
+#endif // WAV_FILE_H
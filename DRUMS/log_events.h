@@ -0,0 +1,62 @@
+#ifndef LOG_EVENTS_H
+#define LOG_EVENTS_H
+
+#include "log_ring.h"
+
+// Every message the firmware logs from interrupts. Each one belongs to a subsystem,
+// and a subsystem set to 0 compiles its LOG calls away completely, e.g.
+// add -DLOG_PADS=0 to the compile definitions to stop the pad spam
+
+#ifndef LOG_PADS
+#define LOG_PADS 1       // touch pads and picking sounds for them
+#endif
+#ifndef LOG_BUTTONS
+#define LOG_BUTTONS 1    // the mode pushbuttons
+#endif
+#ifndef LOG_LOOP
+#define LOG_LOOP 1       // recording, playing back, the classic beats and mode changes
+#endif
+
+// name, format. The format gets two values, an unsigned long and then either an
+// unsigned long or a string
+#define LOG_EVENT_LIST(X) \
+    X(LOG_PAD_TOUCHED,      "Touch sensor activated: GPIO %lu") \
+    X(LOG_PAD_SOUND,        "Pad %lu: %s") \
+    X(LOG_RECORD_OFF,       "RECORD mode OFF - duration: %lu ms") \
+    X(LOG_PLAY_PRESSED,     "Play button pressed") \
+    X(LOG_CLEAR_PRESSED,    "Clear button pressed") \
+    X(LOG_BEAT_PRESSED,     "Beat select button pressed") \
+    X(LOG_LOOP_CLEARED,     "Loop cleared") \
+    X(LOG_LOOP_FULL,        "No room in the loop, dropped a hit on pad %lu") \
+    X(LOG_OVERDUB_OFF,      "OVERDUB off - %lu layers, %lu hits") \
+    X(LOG_LOOP_UNDO,        "Took the last pass off, %lu layers left") \
+    X(LOG_BEAT_INVALID,     "Invalid beat index: %lu") \
+    X(LOG_BEAT_LOADED,      "Loaded classic beat %lu, %lu steps") \
+    X(LOG_TRANSPORT,        "Mode %lu: %s")
+
+#define LOG_EVENT_ID(name, format) name,
+#define LOG_EVENT_FORMAT(name, format) format,
+
+typedef enum {
+    LOG_EVENT_LIST(LOG_EVENT_ID)
+    LOG_NUM_EVENTS
+} log_event_t;
+
+// the one ring, only core0 interrupts (and the main loop with them held off) write
+// to it and they all run at the same priority so they never interrupt each other.
+// The main loop drains it
+extern log_ring_t log_ring;
+
+// when something got logged in us, the pico uses its timer and a PC build can use
+// whatever it likes. Whoever owns log_ring supplies it
+uint32_t log_time(void);
+
+// Log an event if its subsystem is on. When it is off the if (0) lets the compiler
+// drop the whole thing, arguments and all
+#define LOG(subsystem, event, a, b) do { \
+        if (subsystem) { \
+            log_ring_push(&log_ring, (event), log_time(), (uint32_t)(a), (uintptr_t)(b)); \
+        } \
+    } while (0)
+
+#endif // LOG_EVENTS_H
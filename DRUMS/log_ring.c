@@ -0,0 +1,71 @@
+#include <stdio.h>
+#include <string.h>
+#include "log_ring.h"
+
+// head and tail keep counting up and wrap at 2^32 like in audio_queue.c, the
+// acquire/release pairs make sure a record is fully written before it is read
+
+void log_ring_init(log_ring_t *ring) {
+    ring->head = 0;
+    ring->tail = 0;
+    ring->dropped = 0;
+    ring->reported = 0;
+}
+
+bool log_ring_push(log_ring_t *ring, uint16_t event, uint32_t time, uint32_t a, uintptr_t b) {
+    uint32_t head = ring->head;
+    uint32_t tail = __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE);
+
+    if (head - tail >= LOG_RING_SIZE) {
+        ring->dropped++;
+        return false;  // full, the main loop is behind
+    }
+
+    log_record_t *record = &ring->records[head & (LOG_RING_SIZE - 1)];
+    record->time = time;
+    record->event = event;
+    record->a = a;
+    record->b = b;
+    __atomic_store_n(&ring->head, head + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+bool log_ring_pop(log_ring_t *ring, log_record_t *record) {
+    uint32_t tail = ring->tail;
+    uint32_t head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+
+    if (head == tail) {
+        return false;  // empty
+    }
+
+    *record = ring->records[tail & (LOG_RING_SIZE - 1)];
+    __atomic_store_n(&ring->tail, tail + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+void log_ring_drain(log_ring_t *ring, const char *const *formats, uint16_t num_formats) {
+    log_record_t record;
+
+    while (log_ring_pop(ring, &record)) {
+        printf("[%10lu] ", (unsigned long)record.time);
+
+        if (record.event >= num_formats) {
+            printf("unknown log event %u\n", record.event);
+            continue;
+        }
+
+        const char *format = formats[record.event];
+        if (strstr(format, "%s")) {
+            printf(format, (unsigned long)record.a, (const char *)record.b);
+        } else {
+            printf(format, (unsigned long)record.a, (unsigned long)record.b);
+        }
+        printf("\n");
+    }
+
+    uint32_t dropped = ring->dropped;
+    if (dropped != ring->reported) {
+        printf("(%lu log records dropped)\n", (unsigned long)(dropped - ring->reported));
+        ring->reported = dropped;
+    }
+}
@@ -0,0 +1,50 @@
+#ifndef LOG_RING_H
+#define LOG_RING_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// printf over USB from an interrupt can block for ages and hold up everything
+// else on that core. Instead interrupts drop a small fixed size record in here
+// (which message, when, two numbers) and the main loop turns them into text later.
+// One producer and one consumer, same rules as audio_queue.
+// Nothing in here touches the pico hardware so it can also be built on a PC.
+
+// Must be a power of two
+#ifndef LOG_RING_SIZE
+#define LOG_RING_SIZE 64
+#endif
+
+#if LOG_RING_SIZE & (LOG_RING_SIZE - 1)
+#error "LOG_RING_SIZE must be a power of two"
+#endif
+
+typedef struct {
+    uint32_t time;       // when it happened, in us
+    uint16_t event;      // index into the format table handed to log_ring_drain
+    uint16_t unused;
+    uint32_t a;          // first value for the format
+    uintptr_t b;         // second value, or a string that lives forever if the format has %s
+} log_record_t;
+
+typedef struct {
+    log_record_t records[LOG_RING_SIZE];
+    uint32_t head;       // next slot to write, only the producer changes it
+    uint32_t tail;       // next slot to read, only the consumer changes it
+    uint32_t dropped;    // records lost because the ring was full
+    uint32_t reported;   // how many of those the consumer has already owned up to
+} log_ring_t;
+
+void log_ring_init(log_ring_t *ring);
+
+// Producer side, returns false (and counts it) if the ring is full
+bool log_ring_push(log_ring_t *ring, uint16_t event, uint32_t time, uint32_t a, uintptr_t b);
+
+// Consumer side, takes the oldest record off the ring
+bool log_ring_pop(log_ring_t *ring, log_record_t *record);
+
+// Print everything waiting, one line per record. formats[event] gets a then b,
+// a as an unsigned long and b as a string if the format has a %s in it
+void log_ring_drain(log_ring_t *ring, const char *const *formats, uint16_t num_formats);
+
+#endif // LOG_RING_H
@@ -0,0 +1,81 @@
+#include "loop_store.h"
+
+void loop_store_init(loop_store_t *store, loop_event_t *events, uint32_t capacity) {
+    store->events = events;
+    store->capacity = capacity;
+    store->dropped = 0;
+    loop_store_clear(store);
+}
+
+void loop_store_clear(loop_store_t *store) {
+    store->used = 0;
+    store->num_layers = 0;
+}
+
+bool loop_store_new_layer(loop_store_t *store) {
+    if (store->num_layers >= LOOP_STORE_LAYERS) {
+        return false;
+    }
+
+    loop_layer_t *layer = &store->layers[store->num_layers];
+    layer->first = store->used;
+    layer->count = 0;
+    layer->last = 0;
+    layer->muted = false;
+    store->num_layers++;
+    return true;
+}
+
+bool loop_store_append(loop_store_t *store, uint32_t time, uint8_t pad) {
+    if (store->num_layers == 0) {
+        loop_store_new_layer(store);
+    }
+
+    loop_layer_t *layer = &store->layers[store->num_layers - 1];
+    uint32_t delta = time - layer->last;
+
+    if (store->used >= store->capacity || time < layer->last || delta > LOOP_EVENT_MAX_DELTA ||
+        pad > LOOP_EVENT_PAD(0xFFFFFFFFu)) {
+        store->dropped++;
+        return false;
+    }
+
+    store->events[store->used++] = LOOP_EVENT(pad, delta);
+    layer->count++;
+    layer->last = time;
+    return true;
+}
+
+bool loop_store_undo(loop_store_t *store) {
+    if (store->num_layers == 0) {
+        return false;
+    }
+
+    store->num_layers--;
+    store->used = store->layers[store->num_layers].first;
+    return true;
+}
+
+void loop_store_mute(loop_store_t *store, uint8_t layer, bool muted) {
+    if (layer < store->num_layers) {
+        store->layers[layer].muted = muted;
+    }
+}
+
+void loop_store_scale(loop_store_t *store, uint32_t num, uint32_t den) {
+    for (uint8_t l = 0; l < store->num_layers; l++) {
+        loop_layer_t *layer = &store->layers[l];
+        uint32_t time = 0;
+        uint32_t scaled = 0;
+
+        for (uint32_t i = layer->first; i < layer->first + layer->count; i++) {
+            time += LOOP_EVENT_DELTA(store->events[i]);
+
+            uint32_t next = (uint32_t)((uint64_t)time * num / den);
+            uint32_t delta = next - scaled < LOOP_EVENT_MAX_DELTA ? next - scaled : LOOP_EVENT_MAX_DELTA;
+            store->events[i] = LOOP_EVENT(LOOP_EVENT_PAD(store->events[i]), delta);
+            scaled += delta;
+        }
+        layer->last = scaled;
+    }
+}
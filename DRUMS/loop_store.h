@@ -0,0 +1,72 @@
+#ifndef LOOP_STORE_H
+#define LOOP_STORE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Where recorded loops live. Every hit is one 32 bit word, the pad in the top
+// bits and the ticks since the hit before it in the rest, all in one arena
+// handed over at init so nothing gets allocated. The hits are split into layers:
+// the first recording is layer 0 and every pass of overdubbing on top of it gets
+// a new layer, which can be muted or thrown away (undo) on its own.
+// Layers sit one after the other in the arena and only the newest one grows, so
+// adding a hit and undoing a layer are both just moving the end of the arena.
+// Nothing in here touches the pico hardware so it can also be built on a PC.
+
+#ifndef LOOP_STORE_EVENTS
+#define LOOP_STORE_EVENTS 4096   // hits across all the layers, 4 bytes each
+#endif
+#ifndef LOOP_STORE_LAYERS
+#define LOOP_STORE_LAYERS 16
+#endif
+
+#define LOOP_EVENT_DELTA_BITS 28
+#define LOOP_EVENT_MAX_DELTA ((1u << LOOP_EVENT_DELTA_BITS) - 1)
+
+#define LOOP_EVENT(pad, delta) (((uint32_t)(pad) << LOOP_EVENT_DELTA_BITS) | (delta))
+#define LOOP_EVENT_PAD(event) ((uint8_t)((event) >> LOOP_EVENT_DELTA_BITS))
+#define LOOP_EVENT_DELTA(event) ((event) & LOOP_EVENT_MAX_DELTA)
+
+typedef uint32_t loop_event_t;
+
+typedef struct {
+    uint32_t first;   // index of its first hit in the arena
+    uint32_t count;
+    uint32_t last;    // loop time of its last hit, the next one is stored relative to it
+    bool muted;
+} loop_layer_t;
+
+typedef struct {
+    loop_event_t *events;
+    uint32_t capacity;
+    uint32_t used;
+    loop_layer_t layers[LOOP_STORE_LAYERS];
+    uint8_t num_layers;
+    uint32_t dropped;  // hits that didnt fit (or came in out of order)
+} loop_store_t;
+
+void loop_store_init(loop_store_t *store, loop_event_t *events, uint32_t capacity);
+
+// Throw everything away
+void loop_store_clear(loop_store_t *store);
+
+// Start a new layer on top, false if there are no layers left
+bool loop_store_new_layer(loop_store_t *store);
+
+// Add a hit at loop time time to the newest layer (starting layer 0 if there are
+// none yet). Times in a layer have to go up, returns false and counts it if it
+// doesnt or the arena is full
+bool loop_store_append(loop_store_t *store, uint32_t time, uint8_t pad);
+
+// Throw away the newest layer, false if there wasnt one
+bool loop_store_undo(loop_store_t *store);
+
+// Muted layers are kept but dont play
+void loop_store_mute(loop_store_t *store, uint8_t layer, bool muted);
+
+// Change what the times are counted in, every time t becomes t * num / den rounded
+// down. A loop gets recorded in samples and turned into ticks once its length is
+// known. Deltas that get too big for an event are clamped
+void loop_store_scale(loop_store_t *store, uint32_t num, uint32_t den);
+
+#endif // LOOP_STORE_H
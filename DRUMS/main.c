@@ -2,56 +2,41 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include "pico/stdlib.h"
-#include "hardware/pwm.h"
-#include "hardware/clocks.h"
 #include "hardware/irq.h"
 #include "hardware/gpio.h"
 #include "hardware/timer.h"
+#include "hardware/clocks.h"
+#include "pico/multicore.h"
+#include "pico/stdio_usb.h"
+
+#include "drum_engine.h"
+#include "audio_out.h"
+#include "classic_beats.h"
+#include "sample_bank.h"
+#include "xip_stream.h"
+#include "log_events.h"
+#include "gpio_dispatch.h"
+#include "transport.h"
+#include "session.h"
+#include "flash_log.h"
+#include "flash_pico.h"
+#include "power.h"
+#include "hardware/sync.h"
+#include "hardware/structs/iobank0.h"
+
+// With this on, core1 does nothing but render audio and core0 looks after the pads,
+// buttons, loops and USB. Set from CMakeLists.txt
+#ifndef AUDIO_ON_CORE1
+#define AUDIO_ON_CORE1 0
+#endif
 
-// Include your sample data headers
-#include "kick-16bit.h"
-#include "crash-16bit.h"
-#include "snare-16bit.h"
-#include "tom1-16bit.h"
-#include "tom2-16bit.h"
-
-// Include extra audio samples
-//#include "audio_data.h"
-#include "rick_roll.h"
-// Add the new sound header files
-#include "darude_sandstorm.h"
-#include "blk_enter_dragon.h"
-
-
-void bit_set(volatile uint32_t *track_bitmap, uint8_t tracknumber) {
-    // OR the track bit position with 1 to set it
-    *track_bitmap |= 1 << tracknumber;
-}
-
-void bit_clr(volatile uint32_t *track_bitmap, uint8_t tracknumber) {
-    // AND the track bit position with 0 to clear it
-    *track_bitmap &= ~(1 << tracknumber);
-}
-
-uint8_t testbit(uint32_t track_bitmap, uint8_t tracknumber) {
-    // shift everything right by our track nunber and chekc its value
-    // AND with the mask 
-    return (track_bitmap >> tracknumber) & 0x01;
-}
-
-#define SAMPLE_RATE 22050  // 22Khz, to be fair we got this from ur mans repo, 
-#define PWM_WRAP 4095   // 12 bits for PWM, 16 didnt really work
 
 #define num_active_tracks 5
-// this just help to 
-#define NR_SAMPLES_OF(track) ((sizeof(track)) / (sizeof(int16_t)))
 
 
 
 // PWM configuration
-const int pwm_output_pin  = 0;       // we shall use the gpio pin 0 for outputting the PWM
-// https://electronics.stackexchange.com/questions/729277/what-is-slicing-in-pwm
-// we need to set the slice controlling our pwm, more info here ^^^^
+const int pwm_output_pin  = 0;       // we shall use the gpio pin 0 for outputting the PWM, see audio_out.c
 
 // Capacitave touch pads 
 const uint Drum_Pads[num_active_tracks] = {16, 17, 18, 19, 28};  
@@ -61,187 +46,99 @@ const uint Drum_Pads[num_active_tracks] = {16, 17, 18, 19, 28};
 #define PLAY_PIN 12       
 #define CLEAR_PIN 22      
 #define BEAT_SELECT_PIN 21
-#define MAX_LOOP_EVENTS 50 
 
 // Ruari's Arduino will send digital signals here to say which sound we want to play
 #define CLASSIC_1 8      
 #define CLASSIC_2 9      
 #define CLASSIC_3 10     
 #define NO_BEAT 11  
-#define NUM_CLASSIC_BEATS 3   // Number of built-in classic beats
-#define MAX_CLASSIC_BEAT_EVENTS 50    // Maximum number of events in a classic beat
-// initialising classic beat, idk if these are still needed but im slightly worried about initialisation
-volatile uint8_t current_beat = 2;     // Currently selected classic beat (start with funk beat)
-volatile bool classic_beat_mode = false; // Whether classic beat mode is active
+#define FIRST_CLASSIC_BEAT 2       // the beat select button goes on from here (start with funk beat)
 
 // pins for sound config 
 #define SOUND_SELECT_PIN 20  // pushbutton for sound config
-#define total_num_tracks 9  
 
 // LED indicators for whatever mode we are in 
 #define RECORD_LED 15  // GPIO pin for recording status LED
 #define PLAY_LED 14    // GPIO pin for playback status LED
 #define LED_FLASH_PERIOD 250  // LED flash period in ms
 
-// THESE ALL NEED TO BE VOLTILE. we change stuff with interupts
-volatile uint32_t tracks_playing = 0;  // each bit tells us if a track is playing
-volatile int32_t samples_left_to_play[num_active_tracks] = {0};
-
-// Loop control globals
-volatile bool record_mode = false;
-volatile bool play_mode = false;
-// millisecond variables for looping
-volatile uint64_t loop_timestamp = 0;  // current timestamp for loop
-volatile uint64_t loop_start_time = 0; // when we started recoding 
-volatile uint64_t loop_end_time = 0;   // when we stopped recording
-volatile uint64_t loop_duration = 0;   // total loop time in milliseconds
-
-// Sound selection mode control
-volatile bool sound_select_mode = false;
-volatile uint8_t current_button_to_configure = 0;  // Which button is being configured
-volatile uint8_t currently_selected_sound = 0;     // Which sound is currently selected
-volatile uint8_t last_selected_beat = 0xFF; // Track the last selected beat to detect changes,set this as default
-
-// LED status variables - no longer need these for flashing since LEDs stay solid
-// Keeping variable declarations for compatibility with other parts of the code
-volatile uint32_t record_led_state = 0;
-volatile uint32_t play_led_state = 0;
-volatile uint32_t led_flash_timestamp = 0;
+// how often the cache numbers get printed
+#define STATS_PERIOD_MS 5000
 
-// for each "loop event" we have a tuple basically with the type of beat and then the time it should plauy
+// When boot got to each stage, in us since reset (the timer starts at 0 then).
+// Nothing gets printed while booting, USB isnt up yet, so these and everything
+// else worth knowing about the boot get printed once a terminal connects
 typedef struct {
-    uint8_t track;      // the type of drum we should play
-    uint64_t timestamp; // Timestamp when it should play
-} LoopEvent;
-
-volatile LoopEvent loop_events[MAX_LOOP_EVENTS];
-volatile uint16_t loop_event_count = 0;
-
-// Classic beat patterns
-// Each beat is defined as an array of LoopEvents,
-// each beat has a row, its a matrix
-const LoopEvent classic_beats[NUM_CLASSIC_BEATS][MAX_CLASSIC_BEAT_EVENTS] = {
-
-    // WE HAVE NO HIHAT, hithats seem to come up a lot, but we dont have one smh
-    // money beat, 
-    {
-        {4, 0},      // Crash on beat 1
-        {0, 0},      // Kick on beat 1
-        {4, 250},    // Crash on offbeat
-        {4, 500},    // Crash on beat 2
-        {3, 500},    // Snare on beat 2
-        {4, 750},    // crash on the offbeat again
-        {4, 1000},   // Crash on beat 3
-        {0, 1000},   // Kick on beat 3
-        {4, 1250},   // Crash on offbeat
-        {4, 1500},   // Crash beat 4
-        {3, 1500},   // Snare beat 4
-        {4, 1750},   // Crash on the offbeat
-        {0, 2000},   // Loop back to beat 1
-        {255, 0}     // 255 MEANS END OF LOOP LETS DO IT AGAIN
-    },
-    
-    // hip hope r smt
-    {
-        {0, 0},      // Kick on beat 1
-        {3, 500},    // Snare on beat 2
-        {0, 750},    // Kick on offbeat
-        {0, 1000},   // Kick on beat 3
-        {3, 1500},   // Snare on beat 4
-        {4, 1750},   // Crash on the offbeat ish (could remove this it sounds kinda bad)
-        {0, 2000},   // Loop back to beat 1
-        {255, 0}     // End marker
-    },
-    
-    // funky beat
-    // NOW THIS IS GOOD
-    {
-        {0, 0},      // Kick on beat 1
-        {4, 125},    // Crash on on 1/16 (called semiquavers apparenlty)
-        {3, 250},    // Snare on offbeat
-        {4, 375},    // Crash 
-        {0, 500},    // Kick on beat 2
-        {4, 625},    // Crash on 16
-        {3, 750},    // Snare on the "and" of 2
-        {0, 875},    // Kick on 16th 
-        {4, 1000},   // Crash/Hi-hat on beat 3
-        {3, 1250},   // Snare on the "and" of 3
-        {0, 1500},   // Kick on beat 4
-        {4, 1625},   // Crash/Hi-hat on 16th note
-        {3, 1750},   // Snare on the "and" of 4
-        {4, 1875},   // Crash/Hi-hat on 16th note
-        {0, 2000},   // Loop back to beat 1
-        {255, 0}     // End marker
-    }
-};
-
-// Length of each classic beat in milliseconds
-const uint64_t classic_beat_durations[NUM_CLASSIC_BEATS] = {2000, 2000, 2000};
-
-// Array of all available sounds
-// This array contains all sound samples that can be assigned to buttons
-// Updated to include the new sound samples
-const uint32_t available_sounds_sizes[total_num_tracks] = {
-    NR_SAMPLES_OF(kick),
-    NR_SAMPLES_OF(tom1),
-    NR_SAMPLES_OF(tom2),
-    NR_SAMPLES_OF(snare),
-    NR_SAMPLES_OF(crash),
-    NR_SAMPLES_OF(rick_roll_audio),
-    NR_SAMPLES_OF(darude_sandstorm_audio),
-    NR_SAMPLES_OF(blk_enter_dragon_audio)
-};
-
-const int16_t *available_sounds[total_num_tracks] = {
-    kick,
-    tom1,
-    tom2,
-    snare,
-    crash,
-    rick_roll_audio,
-    darude_sandstorm_audio,
-    blk_enter_dragon_audio
+    uint32_t main_start;     // the sdk has set up the clocks and got to main()
+    uint32_t audio_live;     // the DMA is asking the mixer for audio
+    uint32_t pads_armed;     // pad and button interrupts are on
+    uint32_t usb_connected;  // a terminal opened the serial port, 0 until then
+    uint32_t restore_us;     // how long getting the saved session back took
+    bool restored;
+} boot_times_t;
+
+boot_times_t boot_times;
+
+// With nothing playing for this long the audio parks, clk_sys goes down and the
+// main loop sleeps between interrupts. Anything that needs the audio wakes it
+// back up, see wake_audio
+#define IDLE_AFTER_MS 500
+#define IDLE_CHECK_PERIOD_US 10000
+#define IDLE_TIMER_MS 50  // the loop timer while parked, just enough to keep saving going
+uint32_t parked_at = 0;
+uint32_t parked_us = 0;  // time spent parked, not counting now
+
+// the drum machine itself, everything but the hardware (see drum_engine.h). The pin
+// handlers, the loop timer and the main loop run its control side on core0 and the
+// audio DMA interrupt renders it. All the producers (the pin handlers and the loop
+// timer) are core0 interrupts on the same priority, so they never interrupt each
+// other and count as one producer
+drum_engine_t engine;
+
+#define DEFAULT_BPM 120
+#define BPM_STEP 5           // how much + and - on the serial change the tempo by
+
+// messages from interrupts wait in here until the main loop prints them, see log_events.h
+log_ring_t log_ring;
+static const char *const log_formats[LOG_NUM_EVENTS] = {
+    LOG_EVENT_LIST(LOG_EVENT_FORMAT)
 };
 
-const char *sound_names[total_num_tracks] = {
-    "Kick",
-    "Tom1",
-    "Tom2",
-    "Snare",
-    "Crash",
-    "Audio",
-    "Rick Roll",
-    "Sandstorm",
-    "Enter Dragon"
-};
+uint32_t log_time() {
+    return time_us_32();
+}
 
-// THIS ARRAY IS VERY IMPORTANT
-// it hols the sound that the pads are currently assigned,
-// this is the configuration when the pico starts up
-volatile uint32_t total_samples[num_active_tracks] = {
-    NR_SAMPLES_OF(kick),   
-    NR_SAMPLES_OF(tom1),   
-    NR_SAMPLES_OF(tom2),   
-    NR_SAMPLES_OF(snare),  
-    NR_SAMPLES_OF(crash),  
-};
+// Track the last selected beat to detect changes,set this as default
+uint8_t last_selected_beat = TRANSPORT_NO_BEAT;
 
-// just set the initial values to the NORMAL drum sounds
-volatile int16_t const *tracks[num_active_tracks] = {
-    kick,      
-    tom1,      
-    tom2,      
-    snare,     
-    crash,     
-};
+// LED status variables - no longer need these for flashing since LEDs stay solid
+// Keeping variable declarations for compatibility with other parts of the code
+volatile uint32_t record_led_state = 0;
+volatile uint32_t play_led_state = 0;
+volatile uint32_t led_flash_timestamp = 0;
 
-const uint pusshbuttons[] = {
-    SOUND_SELECT_PIN,
-    RECORD_PIN,
-    PLAY_PIN,
-    CLEAR_PIN,
-    BEAT_SELECT_PIN
-};
+// the session (loop, pad sounds, beat, tempo) is saved to the end of the flash as a
+// log, see flash_log.h. Saving waits until nothing has changed for a bit and we are
+// not in the middle of recording, the pages get written a few ms apart from the main loop.
+// Erasing a sector holds everything up for far longer than a page, so it waits until
+// the audio has been parked for FLASH_ERASE_AFTER_MS, see run_session_save
+#define SESSION_SAVE_DELAY_MS 2000
+#define FLASH_STEP_PERIOD_US 3000
+#define FLASH_ERASE_AFTER_MS 5000
+flash_log_t flash_log;
+uint8_t session_buf[SESSION_MAX_BYTES];  // has to stay put while it is being written
+bool session_dirty = false;
+uint32_t session_changed_at = 0;
+
+_Static_assert(SESSION_MAX_BYTES <= FLASH_LOG_MAX_RECORD, "a full loop wont fit in the flash log");
+
+// All the sounds are packed into one image in flash (sample_bank.bin, built into the
+// firmware by sample_bank.S). To add a sound put it in song_conversion/sample_bank.txt
+// and rebuild the bank, no code changes needed
+extern const uint8_t sample_bank_image[];
+extern const uint8_t sample_bank_image_end[];
+sample_bank_t sample_bank;
+bool sample_bank_ok = false;
 
 const uint beat_pins[] = {
     CLASSIC_1,
@@ -250,72 +147,74 @@ const uint beat_pins[] = {
     NO_BEAT
 };
 
-// Button to sound mapping - keep track of which sound is assigned to each button
-volatile uint8_t button_sound_mapping[num_active_tracks] = {0, 1, 2, 3, 4, 5};
-
-// Function to set up PWM for audio output
-void pwm_audio_init(void) {
-
-    // set the pin 0 to be able ot do PWM
-    gpio_set_function(pwm_output_pin, GPIO_FUNC_PWM);
-    
-    uint slice_num = pwm_gpio_to_slice_num(pwm_output_pin);
-    
-    float pico_clk = clock_get_hz(clk_sys);  
-    float actual_pwm_clk = pico_clk / (SAMPLE_RATE * PWM_WRAP);
-    
-    pwm_config config = pwm_get_default_config();
-    pwm_config_set_clkdiv(&config, actual_pwm_clk);
-    pwm_config_set_wrap(&config, PWM_WRAP - 1);
-    pwm_init(slice_num, &config, true);
-    
-    // Set initial PWM level to middle (silence)
-    pwm_set_gpio_level(pwm_output_pin, PWM_WRAP / 2);
-    
-}
-
-// Add an event to the loop
-void add_loop_event(uint8_t track) {
-    if (loop_event_count < MAX_LOOP_EVENTS) {
-        uint64_t current_time = time_us_64();
-        uint64_t triggered_time = current_time - loop_start_time;
-        
-        loop_events[loop_event_count].track = track;
-        loop_events[loop_event_count].timestamp = triggered_time;
-        loop_event_count++;
+#define NUM_BEAT_PINS (sizeof(beat_pins) / sizeof(beat_pins[0]))
+#define BEAT_PIN_EDGES (GPIO_IRQ_EDGE_RISE | GPIO_IRQ_EDGE_FALL)
+
+// goes every ms while the audio runs, see loop_timer_callback. Parked it goes every
+// IDLE_TIMER_MS instead and the beat pins get interrupts, see park_loop_timer
+struct repeating_timer loop_timer;
+
+void park_loop_timer();
+void resume_loop_timer();
+
+// Parking and resuming have to happen on the core the DMA interrupt runs on, with
+// its interrupts off (see audio_out.h). With AUDIO_ON_CORE1 core0 leaves the request
+// here and core1 does it between blocks. The FIFO belongs to the flash lockout (see
+// flash_pico.c), its interrupt handler would eat anything else we sent down it
+typedef enum {
+    AUDIO_REQUEST_NONE,
+    AUDIO_REQUEST_PARK,
+    AUDIO_REQUEST_RESUME,
+} audio_request_t;
+
+#if AUDIO_ON_CORE1
+volatile uint32_t audio_request = AUDIO_REQUEST_NONE;
+volatile uint32_t audio_request_since;
+#endif
+
+// Park or resume the audio and wait until it is done, core0 with interrupts off
+void audio_control(audio_request_t request, uint32_t since) {
+#if AUDIO_ON_CORE1
+    audio_request_since = since;
+    __atomic_store_n(&audio_request, request, __ATOMIC_RELEASE);
+    __sev();
+    while (__atomic_load_n(&audio_request, __ATOMIC_ACQUIRE) != AUDIO_REQUEST_NONE) {
+        tight_loop_contents();
     }
+#else
+    if (request == AUDIO_REQUEST_PARK) {
+        audio_out_park();
+    } else {
+        audio_out_resume(since);
+    }
+#endif
 }
 
-// Clear all loop events
-void clear_loop() {
-    loop_event_count = 0;
-    loop_duration = 0;
-    printf("Loop cleared\n");
-}
+// Set by pad_isr while it plays the pad, so a wake from a touch counts from the edge
+// and not from when the handler got to run (the flash can hold it off, see run_session_save)
+bool pad_touching = false;
+uint32_t pad_touched_at;
 
-// Load a classic beat pattern into the loop
-void load_classic_beat(uint8_t beat_index) {
-    if (beat_index >= NUM_CLASSIC_BEATS) {
-        printf("Invalid beat index: %d\n", beat_index);
+// Get the audio going again if it was parked, from anywhere on core0. The time it
+// took until the first block is rendered goes in the wake stats
+void wake_audio(void *context) {
+    if (!audio_out_parked()) {
         return;
     }
-    
-    // Clear any existing loop
-    loop_event_count = 0;
-    
-    // Copy the classic beat pattern to the loop events
-    int i = 0;
-    while (i < MAX_CLASSIC_BEAT_EVENTS && classic_beats[beat_index][i].track != 255) {
-        loop_events[i].track = classic_beats[beat_index][i].track;
-        loop_events[i].timestamp = classic_beats[beat_index][i].timestamp * 1000; // Convert ms to μs
-        i++;
+
+    uint32_t saved = save_and_disable_interrupts();
+    if (audio_out_parked()) {
+        uint32_t now = time_us_32();
+        power_full();
+
+        // nothing renders while parked so the clock is ours until the resume.
+        // a 1 sample block and a silent one go out before the next one the mixer renders
+        sample_clock_anchor(&engine.clock, engine.mixer.clock - AUDIO_BLOCK_SIZE - 1, now);
+        audio_control(AUDIO_REQUEST_RESUME, pad_touching ? pad_touched_at : now);
+        parked_us += now - parked_at;
+        resume_loop_timer();
     }
-    
-    loop_event_count = i;
-    loop_duration = classic_beat_durations[beat_index] * 1000; // Convert ms to μs
-    
-    printf("Loaded classic beat %d with %d events, duration: %llu ms\n", 
-           beat_index, loop_event_count, loop_duration / 1000);
+    restore_interrupts(saved);
 }
 
 // NEW: Check beat selection pins and update beat selection if needed
@@ -338,365 +237,540 @@ void check_beat_selection_pins() {
         selected_beat = 0xFF; 
     }
     
-    // If selection changed and not in sound selection mode
-    if (selected_beat != last_selected_beat && !sound_select_mode) {
+    // If selection changed let the transport know, it works out what to do about it
+    if (selected_beat != last_selected_beat) {
         last_selected_beat = selected_beat;
-        
-        if (selected_beat < NUM_CLASSIC_BEATS) {
-            // Load and play the selected beat
-            current_beat = selected_beat;
-            load_classic_beat(current_beat);
-            
-            // Turn on classic beat mode and start playback
-            classic_beat_mode = true;
-            play_mode = true;
-            record_mode = false;
-            loop_timestamp = 0;
-            
-            // Update LEDs
-            gpio_put(RECORD_LED, 0);
-            gpio_put(PLAY_LED, 1);
-            
-            printf("Classic beat %d selected via GPIO pins and playing\n", current_beat);
-        } else if (selected_beat == 0xFF) {
-            // Stop playing the beat
-            play_mode = false;
-            classic_beat_mode = false;
-            gpio_put(PLAY_LED, 0);
-            printf("Beat playback stopped via GPIO pins\n");
-        }
+        drum_engine_post(&engine, TRANSPORT_EV_BEAT_PIN, selected_beat, time_us_32());
     }
 }
 
-// Universal GPIO callback for all inputs
-void gpio_isr(uint gpio, uint32_t events) {
-    // Check if this is a touch sensor
-    bool is_touch_sensor = false;
-    int touched_pad = -1;
-    
-    for (int i = 0; i < num_active_tracks; i++) {
-        if (gpio == Drum_Pads[i]) {
-            is_touch_sensor = true;
-            touched_pad = i;
-            break;
-        }
+// Pad number for each pin, 0xFF for pins that arent a pad
+uint8_t pad_for_gpio[NUM_BANK0_GPIOS];
+
+// A touch pad went high
+void pad_isr(uint gpio, uint32_t events) {
+    uint8_t touched_pad = pad_for_gpio[gpio];
+    uint32_t now = time_us_32();
+
+    // Only process rising edge for touch sensors
+    if (events & GPIO_IRQ_EDGE_RISE) {
+        LOG(LOG_PADS, LOG_PAD_TOUCHED, gpio, 0);
+
+        // plays it straight away, recording it or picking sounds happens in the main loop
+        pad_touched_at = gpio_dispatch_edge_time();
+        pad_touching = true;
+        drum_engine_pad(&engine, touched_pad, now);
+        pad_touching = false;
     }
-    
-    // Handle touch sensors (rising edge)
-    if (is_touch_sensor) {
-        // Only process rising edge for touch sensors
-        if (events & GPIO_IRQ_EDGE_RISE) {
-            printf("Touch sensor activated: GPIO %d\n", gpio);
-            
-            // Touch sensor was activated
-            buttons_pressed[touched_pad] = true;
-            
-            // If in sound selection mode, configure the button
-            if (sound_select_mode) {
-                if (current_button_to_configure == touched_pad) {
-                    // Button already selected, cycle through available sounds, make sure to wrap around
-                    currently_selected_sound = (currently_selected_sound + 1) % total_num_tracks;
-
-                    // switch the track that is currently assigned to the pad
-                    button_sound_mapping[touched_pad] = currently_selected_sound;
-                    
-                    // update how long the samples are so that the sound playing works
-                    total_samples[touched_pad] = available_sounds_sizes[currently_selected_sound];
-
-                    // change the current list of tracks that we play
-                    tracks[touched_pad] = available_sounds[currently_selected_sound];
-                    
-                    // Play the new sound so we can hear what we are selecting 
-                    bit_set(tracks_playing, touched_pad);
-                    samples_left_to_play[touched_pad] = total_samples[touched_pad];
-
-                } else {
-                    // just touched a new pad
-                    // set it as the drum pad we are currently configuring
-                    current_button_to_configure = touched_pad;
-
-                    // update the array that holds the sound currently corresponding to each touch pad
-                    currently_selected_sound = button_sound_mapping[touched_pad];   
-                    
-                    // Play the current sound before we make any changes
-                    bit_set(tracks_playing, touched_pad);
-                    samples_left_to_play[touched_pad] = total_samples[touched_pad];
-                }
-                return;
-            }
-            
-            // SET THE BIT of the sound we want to play, the rest will be handled
-            bit_set(tracks_playing, touched_pad);
-            samples_left_to_play[touched_pad] = total_samples[touched_pad];
-            
-            if (record_mode) {
-                add_loop_event(touched_pad);
-            }
-        }
+}
+
+// Sound selection mode button
+void sound_select_isr(uint gpio, uint32_t events) {
+    // Only process falling edge for control buttons
+    if (!(events & GPIO_IRQ_EDGE_FALL)) {
         return;
     }
-    
-    // Handle push buttons (falling edge)
+
+    if (!gpio_get(SOUND_SELECT_PIN)) {  // Button pressed (active low)
+        drum_engine_post(&engine, TRANSPORT_EV_SOUND_SELECT, 0, time_us_32());
+    }
+}
+
+// Record button
+void record_isr(uint gpio, uint32_t events) {
     // Only process falling edge for control buttons
     if (!(events & GPIO_IRQ_EDGE_FALL)) {
         return;
     }
-    
-    // Sound selection mode button
-    if (gpio == SOUND_SELECT_PIN) {
-        if (!gpio_get(SOUND_SELECT_PIN)) {  // Button pressed (active low)
-
-            // every time we press the sound select pin just toggle the bool
-            sound_select_mode = !sound_select_mode;
-            
-            // if we are in the sound select mode
-            if (sound_select_mode) {
-
-                current_button_to_configure = 0xFF; // No button selected yet
-                currently_selected_sound = 0;
-                
-                // Turn off all the other modes so we don't get annoying overlap things
-                record_mode = false;
-                play_mode = false;
-                classic_beat_mode = false;
-                
-                // Turn off mode LEDs
-                gpio_put(RECORD_LED, 0);
-                gpio_put(PLAY_LED, 0);
-            } else {
-                printf("SOUND SELECTION mode OFF\n");
-            }
-        }
+
+    if (!gpio_get(RECORD_PIN)) {  // Button pressed (active low)
+        drum_engine_post(&engine, TRANSPORT_EV_RECORD, 0, time_us_32());
+    }
+}
+
+// Play button
+void play_isr(uint gpio, uint32_t events) {
+    // Only process falling edge for control buttons
+    if (!(events & GPIO_IRQ_EDGE_FALL)) {
         return;
     }
-    
-    // Record button
-    if (gpio == RECORD_PIN) {
-        if (!gpio_get(RECORD_PIN)) {  // if record wa spressed
-
-            // ONLY go into this loop if we aren't picking a sound for one of the pads
-            if (!sound_select_mode) {
-                if (!record_mode) {
-                    // if we aren't in record mode then start recording
-                    record_mode = true;
-                    classic_beat_mode = false; // stop playing premade beats
-
-                    // so now start keeping track of time, 
-                    loop_start_time = time_us_64();
-                    loop_event_count = 0; // set the length to zero, we don't consider any of the previous loop as important now
-                    gpio_put(RECORD_LED, 1); // Turn on record LED
-                } 
-                else {
-                    // if we are in record mode then stop recording when we press the button
-                    record_mode = false;
-                    // now 
-                    loop_end_time = time_us_64();
-                    loop_duration = loop_end_time - loop_start_time;
-                    printf("RECORD mode OFF - duration: %llu ms\n", loop_duration / 1000);
-
-                    gpio_put(RECORD_LED, 0); // Turn off record LED
-                    
-                    // Automatically start playback if we have recorded any beats
-                    if (loop_event_count > 0) {
-                        play_mode = true;
-                        loop_timestamp = 0;
-                        gpio_put(PLAY_LED, 1); // Turn on play LED
-                    }
-                }
-            }
-        }
+
+    if (!gpio_get(PLAY_PIN)) {  // Button pressed (active low)
+        LOG(LOG_BUTTONS, LOG_PLAY_PRESSED, 0, 0);
+        drum_engine_post(&engine, TRANSPORT_EV_PLAY, 0, time_us_32());
+    }
+}
+
+// Clear button
+void clear_isr(uint gpio, uint32_t events) {
+    // Only process falling edge for control buttons
+    if (!(events & GPIO_IRQ_EDGE_FALL)) {
         return;
     }
-    
-    // Play button
-    if (gpio == PLAY_PIN) {
-        if (!gpio_get(PLAY_PIN)) {  // Button pressed (active low)
-            printf("Play button pressed\n");
-            // Only respond if not in sound selection mode
-            if (!sound_select_mode) {
-                play_mode = !play_mode;
-                if (play_mode) {
-                    printf("PLAY mode ON\n");
-                    // Reset loop position when starting playback
-                    loop_timestamp = 0;
-                    gpio_put(PLAY_LED, 1); // Turn on play LED
-                } else {
-                    printf("PLAY mode OFF\n");
-                    gpio_put(PLAY_LED, 0); // Turn off play LED
-                }
-            }
-        }
+
+    if (!gpio_get(CLEAR_PIN)) {  // Button pressed (active low)
+        LOG(LOG_BUTTONS, LOG_CLEAR_PRESSED, 0, 0);
+        drum_engine_post(&engine, TRANSPORT_EV_CLEAR, 0, time_us_32());
+    }
+}
+
+// Beat select button
+void beat_select_isr(uint gpio, uint32_t events) {
+    // Only process falling edge for control buttons
+    if (!(events & GPIO_IRQ_EDGE_FALL)) {
         return;
     }
-    
-    // Clear button
-    if (gpio == CLEAR_PIN) {
-        if (!gpio_get(CLEAR_PIN)) {  // Button pressed (active low)
-            printf("Clear button pressed\n");
-            // Only respond if not in sound selection mode
-            if (!sound_select_mode) {
-                clear_loop();
-                classic_beat_mode = false;
-            }
-        }
+
+    if (!gpio_get(BEAT_SELECT_PIN)) {  // Button pressed (active low)
+        LOG(LOG_BUTTONS, LOG_BEAT_PRESSED, 0, 0);
+        drum_engine_post(&engine, TRANSPORT_EV_BEAT_NEXT, 0, time_us_32());
+    }
+}
+
+void update_leds() {
+
+    // if we are recording, set the red LED on
+    gpio_put(RECORD_LED, transport_record_led(&engine.transport));
+
+    // if we are in playback mode, then set the green LED on
+    gpio_put(PLAY_LED, transport_play_led(&engine.transport));
+}
+
+// Print the XIP cache hit rate and where the mixer read its sounds from, then start counting again.
+// Only once a terminal is there to see it, otherwise the counts just pile up
+void report_cache_stats() {
+    static mixer_cache_stats_t last;
+
+    if (!stdio_usb_connected()) {
         return;
     }
+
+    xip_stats_t xip;
+    xip_stats_read(&xip, true);
+
+    // the mixer counters belong to the audio side, just take the difference since last time
+    mixer_cache_stats_t now = engine.mixer.cache;
+    printf("XIP cache: %lu/%lu hits (%lu%%), %lu bytes streamed\n",
+           (unsigned long)xip.hits, (unsigned long)xip.accesses,
+           (unsigned long)(xip.accesses ? (uint64_t)xip.hits * 100 / xip.accesses : 100),
+           (unsigned long)xip.streamed);
+    printf("Sound chunks: %lu attack, %lu stream, %lu flash, %lu prefetched\n",
+           (unsigned long)(now.attack_reads - last.attack_reads),
+           (unsigned long)(now.stream_reads - last.stream_reads),
+           (unsigned long)(now.flash_reads - last.flash_reads),
+           (unsigned long)(now.prefetches - last.prefetches));
+    last = now;
+}
+
+bool loop_timer_callback(struct repeating_timer *t) {
+    
+    // check the arduino in case theres an actual beat selected
+    check_beat_selection_pins();
+    
+    // see if any loop events are coming up
+    drum_engine_schedule(&engine);
+    
+    // Updata our LEDs
+    update_leds();
     
-    // Beat select button
-    if (gpio == BEAT_SELECT_PIN) {
-        if (!gpio_get(BEAT_SELECT_PIN)) {  // Button pressed (active low)
-            printf("Beat select button pressed\n");
-            // Only respond if not in sound selection mode
-            if (!sound_select_mode) {
-                // Cycle through classic beats
-                current_beat = (current_beat + 1) % NUM_CLASSIC_BEATS;
-                
-                // Load the selected beat
-                load_classic_beat(current_beat);
-                
-                // Turn on classic beat mode and start playback
-                classic_beat_mode = true;
-                play_mode = true;
-                record_mode = false;
-                loop_timestamp = 0;
-                
-                // Update LEDs
-                gpio_put(RECORD_LED, 0);
-                gpio_put(PLAY_LED, 1);                
+    return true;
+}
+
+// While parked nothing is playing and the beat pins have their own interrupt, this
+// only gets the main loop out of __wfi now and then so a save carries on
+bool idle_timer_callback(struct repeating_timer *t) {
+    return true;
+}
+
+// A beat pin changed while parked, the new beat wakes the audio
+void beat_pin_isr(uint gpio, uint32_t events) {
+    check_beat_selection_pins();
+}
+
+// Going to sleep, slow the loop timer right down and watch the beat pins instead
+void park_loop_timer() {
+    cancel_repeating_timer(&loop_timer);
+    add_repeating_timer_ms(-IDLE_TIMER_MS, idle_timer_callback, NULL, &loop_timer);
+    for (uint32_t i = 0; i < NUM_BEAT_PINS; i++) {
+        gpio_dispatch_add(beat_pins[i], BEAT_PIN_EDGES, beat_pin_isr);
+    }
+
+    // one could have changed since the loop timer last looked
+    check_beat_selection_pins();
+}
+
+// Awake again, back to polling everything every ms
+void resume_loop_timer() {
+    for (uint32_t i = 0; i < NUM_BEAT_PINS; i++) {
+        gpio_dispatch_remove(beat_pins[i], BEAT_PIN_EDGES);
+    }
+    cancel_repeating_timer(&loop_timer);
+    add_repeating_timer_ms(-1, loop_timer_callback, NULL, &loop_timer);
+}
+
+// Called from the audio DMA interrupt whenever one of the buffers has finished playing
+void render_audio_block(uint16_t *levels, uint32_t n) {
+    int16_t pcm[AUDIO_BLOCK_SIZE];
+
+    drum_engine_render(&engine, pcm, n, time_us_32());
+    mixer_to_pwm(pcm, levels, n, audio_out_wrap());
+
+    // the block is ready, now get the next bits of the sounds out of flash
+    mixer_prefetch(&engine.mixer);
+}
+
+#if AUDIO_ON_CORE1
+// core1 only does audio. The DMA interrupt gets enabled from here so it runs on this core,
+// then we just sleep until the next buffer needs filling
+void audio_core_main() {
+    // lets core0 park us while it writes the flash, see flash_pico.c
+    multicore_lockout_victim_init();
+
+    audio_out_init(pwm_output_pin, render_audio_block);
+
+    // let core0 know the audio is up
+    multicore_fifo_push_blocking(1);
+
+    // the DMA interrupt wakes us for every block, core0 with __sev for a park or resume
+    while (true) {
+        __wfe();
+
+        uint32_t request = __atomic_load_n(&audio_request, __ATOMIC_ACQUIRE);
+        if (request != AUDIO_REQUEST_NONE) {
+            uint32_t saved = save_and_disable_interrupts();
+            if (request == AUDIO_REQUEST_PARK) {
+                audio_out_park();
+            } else {
+                audio_out_resume(audio_request_since);
             }
+            restore_interrupts(saved);
+            __atomic_store_n(&audio_request, AUDIO_REQUEST_NONE, __ATOMIC_RELEASE);
         }
+    }
+}
+#endif
+
+// ---- saving the session, all of this runs from the main loop ----
+
+// Something worth keeping changed, it gets saved once things settle down
+void session_changed(void *context) {
+    session_dirty = true;
+    session_changed_at = time_us_32();
+}
+
+const drum_engine_ops_t engine_ops = {
+    .wake = wake_audio,
+    .changed = session_changed,
+};
+
+// Park the audio once nothing has played for IDLE_AFTER_MS, see wake_audio for the way back
+void run_idle() {
+    static uint32_t busy_at = 0;
+    uint32_t now = time_us_32();
+
+    if (audio_out_parked()) {
+        return;
+    }
+    if (!drum_engine_idle(&engine) || engine.transport.state != TRANSPORT_IDLE ||
+        audio_queue_depth(&engine.queue) != 0) {
+        busy_at = now;
+        return;
+    }
+    if (now - busy_at < IDLE_AFTER_MS * 1000) {
         return;
     }
+
+    // a pad could go between the check and parking, it cant with interrupts off
+    uint32_t saved = save_and_disable_interrupts();
+    if (audio_queue_depth(&engine.queue) == 0 && __atomic_load_n(&engine.mixer.live, __ATOMIC_RELAXED) == 0) {
+        audio_control(AUDIO_REQUEST_PARK, now);
+        power_slow();
+        parked_at = now;
+        park_loop_timer();
+    }
+    restore_interrupts(saved);
+}
+
+// Copy the session into session_buf and start writing it out
+void save_session() {
+    uint32_t bytes = drum_engine_save(&engine, session_buf, sizeof(session_buf));
+
+    if (bytes && flash_log_write(&flash_log, session_buf, bytes)) {
+        session_dirty = false;
+    }
 }
 
-void check_loop_events() {
+// Start a save once things have settled, and write a bit more of it (the main loop
+// runs this every FLASH_STEP_PERIOD_US). Nothing can run from the flash while it is
+// written, so pages only go in while the audio is parked, see flash_pico.h. A page is
+// a block at most, but an erase holds a pad off for 45 ms or more, so those wait until
+// we have been parked FLASH_ERASE_AFTER_MS. Most saves dont need one, boot erases ahead
+void run_session_save() {
+    if (session_dirty && !flash_log_writing(&flash_log) &&
+        time_us_32() - session_changed_at >= SESSION_SAVE_DELAY_MS * 1000 &&
+        engine.transport.state != TRANSPORT_RECORDING && engine.transport.state != TRANSPORT_OVERDUB &&
+        engine.transport.state != TRANSPORT_SOUND_SELECT) {
+        save_session();
+    }
+
+    // with interrupts off a pad cant wake the audio between the check and the write.
+    // One that comes in during the write gets its wake counted from when we started
+    uint32_t saved = save_and_disable_interrupts();
+    uint32_t start = time_us_32();
+    flash_log_status_t status = FLASH_LOG_IDLE;
+    if (audio_out_parked()) {
+        status = flash_log_step(&flash_log, start - parked_at >= FLASH_ERASE_AFTER_MS * 1000);
+    }
+    gpio_dispatch_held_off(start);
+    restore_interrupts(saved);
+
+    switch (status) {
+    case FLASH_LOG_DONE:
+        printf("Session saved, %lu bytes at %lu (%lu erases so far)\n", (unsigned long)flash_log.latest_bytes,
+               (unsigned long)flash_log.latest, (unsigned long)flash_log.erases);
+        break;
+    case FLASH_LOG_FAILED:
+        printf("Session too big to save\n");
+        break;
+    default:
+        break;
+    }
+}
 
-    // if we are in the playback loop mode
-    // and if we have something in the loop
-    if (play_mode && loop_duration > 0) {
+// Put back whatever was saved last, before the pads get their sounds
+void restore_session() {
+    uint32_t start = time_us_32();
+    const uint8_t *data;
+    uint32_t length;
 
-        // loop through all of the loop events
-        for (int i = 0; i < loop_event_count; i++) {
+    flash_log_init(&flash_log, &flash_pico_ops, NULL, flash_pico_base(), FLASH_LOG_SIZE);
+    if (!flash_log_latest(&flash_log, &data, &length) || !drum_engine_restore(&engine, data, length)) {
+        return;
+    }
 
-            // check if each event should have played yet,
-            // have a window just to make sure we dont miss any of the beats, (even if they are slightly incorrectly timed)
-            if (loop_events[i].timestamp <= loop_timestamp && 
-                loop_events[i].timestamp > loop_timestamp - 5000) { // 5ms window
+    boot_times.restore_us = time_us_32() - start;
+    boot_times.restored = true;
+}
 
-                uint8_t track = loop_events[i].track; // get the track that we should be playing
+// Nothing is playing yet at boot, so erase the sectors the next saves go in now
+// instead of waiting for a long idle, see run_session_save
+void erase_ahead() {
+    while (flash_log_step(&flash_log, true) == FLASH_LOG_BUSY) {
+    }
+}
 
-                if (track < num_active_tracks) { // if its an actual track
-                    bit_set(tracks_playing, track);
-                    samples_left_to_play[track] = total_samples[track];
-                }
-            }
-        }
-        
-        // if we have completed the loop then set the timestamp back to zero so we start again
-        if (loop_timestamp >= loop_duration) {
+// Handle everything the pin handlers and the beat pins posted since last time
+void run_transport() {
+    while (true) {
+        // the actions push to the audio queue and change the sequencer, which the core0
+        // interrupts do too. Holding them off keeps it one producer like before
+        uint32_t saved = save_and_disable_interrupts();
+        bool handled = drum_engine_handle(&engine);
+        restore_interrupts(saved);
 
-            loop_timestamp = 0; 
-            
+        if (!handled) {
+            break;
         }
     }
 }
 
-void update_leds() {
+// Speed up or slow down the loop, the ticks stay as they are and just go by faster
+void change_tempo(int change) {
+    // the loop timer reads the tempo while it hands out events
+    uint32_t saved = save_and_disable_interrupts();
+    drum_engine_set_bpm(&engine, (uint16_t)(engine.tempo.bpm + change));
+    restore_interrupts(saved);
 
-    // if we are recording, set the red LED on
-    if (record_mode) {
-        gpio_put(RECORD_LED, 1);
-    } else {
-        gpio_put(RECORD_LED, 0); 
+    printf("Tempo %u BPM\n", engine.tempo.bpm);
+}
+
+// Print the layers of the loop, 1 is the first recording and the rest are overdubs
+void print_loop_layers() {
+    const loop_store_t *loop_store = &engine.loop_store;
+
+    printf("loop: %lu of %lu hits used, %lu dropped\n", (unsigned long)loop_store->used,
+           (unsigned long)loop_store->capacity, (unsigned long)loop_store->dropped);
+    for (int i = 0; i < loop_store->num_layers; i++) {
+        printf("  layer %d: %lu hits%s\n", i + 1, (unsigned long)loop_store->layers[i].count,
+               loop_store->layers[i].muted ? " (muted)" : "");
     }
+}
 
+// Mute or unmute a layer, the loop timer might be playing it
+void toggle_loop_layer(uint8_t layer) {
+    uint32_t saved = save_and_disable_interrupts();
+    bool toggled = drum_engine_toggle_layer(&engine, layer);
+    restore_interrupts(saved);
 
-    // if we are in playback mode, then set the green LED on
-    if (play_mode) {
-        gpio_put(PLAY_LED, 1); 
+    if (toggled) {
+        print_loop_layers();
+    }
+}
+
+// Open the sample bank built into the firmware, the engine takes its sounds from it
+void load_sample_bank() {
+    size_t size = (size_t)(sample_bank_image_end - sample_bank_image);
+
+    sample_bank_ok = sample_bank_open(&sample_bank, sample_bank_image, size);
+}
+
+// What load_sample_bank found, printed later once USB is up
+void print_sample_bank() {
+    if (engine.num_sounds == 0) {
+        printf("Sample bank is broken, rebuild it with song_converter.py --bank\n");
+        return;
+    }
+
+    for (uint8_t i = 0; i < engine.num_sounds; i++) {
+        const sample_bank_entry_t *entry = sample_bank_entry(&sample_bank, i);
+
+        // the mixer plays everything at SAMPLE_RATE, so a different rate would be the wrong pitch
+        if (entry->rate != SAMPLE_RATE) {
+            printf("Warning: %s was converted at %u Hz\n", entry->name, entry->rate);
+        }
+    }
+    printf("Sample bank: %u sounds, %lu bytes\n", engine.num_sounds,
+           (unsigned long)(sample_bank_image_end - sample_bank_image));
+}
+
+// Everything about the boot, the first time a terminal connects and again on b
+void print_boot_report() {
+    printf("Boot: main at %lu us, audio live at %lu us, pads armed at %lu us, USB at %lu us\n",
+           (unsigned long)boot_times.main_start, (unsigned long)boot_times.audio_live,
+           (unsigned long)boot_times.pads_armed, (unsigned long)boot_times.usb_connected);
+    print_sample_bank();
+    if (boot_times.restored) {
+        printf("Session restored in %lu us\n", (unsigned long)boot_times.restore_us);
     } else {
-        gpio_put(PLAY_LED, 0); 
+        printf("No saved session\n");
     }
+    printf("Audio running at %lu Hz, tempo %u BPM\n", (unsigned long)audio_out_sample_rate(), engine.tempo.bpm);
+    printf("Send p for the audio timing, r to reset it, + and - for the tempo, b for this again\n");
+    printf("l lists the loop layers, 1-9 mute them and u takes the last one off\n");
 }
 
-// this will handle the timing for our loopoing
-bool loop_timer_callback(struct repeating_timer *t) {
-    
-    // check the arduino in case theres an actual beat selected
-    check_beat_selection_pins();
-    
-    // Update loop timestamp
-    if (play_mode && loop_duration > 0) {
-        loop_timestamp += 1000; // Increment by 1ms (timer is set to 1ms)
-        check_loop_events();
+// Single letter commands from the USB serial, c is PICO_ERROR_TIMEOUT if nothing came in
+void handle_serial_command(int c) {
+    audio_profile_stats_t stats;
+    gpio_dispatch_stats_t pins;
+    uint32_t mhz = clock_get_hz(clk_sys) / 1000000;
+
+    switch (c) {
+    case 'p':
+        audio_out_profile(&stats);
+        audio_profile_print(&stats, clock_get_hz(clk_sys));
+        printf("audio queue: %lu overflows, deepest %lu\n",
+               (unsigned long)engine.queue.overflows, (unsigned long)engine.queue.max_depth);
+
+        gpio_dispatch_stats(&pins);
+        printf("pin interrupt: %lu calls, avg %lu cycles, worst %lu cycles (%lu us), worst to handler %lu cycles\n",
+               (unsigned long)pins.calls,
+               (unsigned long)(pins.calls ? pins.total_cycles / pins.calls : 0),
+               (unsigned long)pins.max_cycles, (unsigned long)(pins.max_cycles / mhz),
+               (unsigned long)pins.max_dispatch);
+
+        audio_wake_stats_t wake;
+        audio_out_wake_stats(&wake);
+        printf("idle: parked %lu times for %lu ms%s, wake to first block from the edge last %lu us, worst %lu us\n",
+               (unsigned long)wake.parks,
+               (unsigned long)((parked_us + (audio_out_parked() ? time_us_32() - parked_at : 0)) / 1000),
+               audio_out_parked() ? " (parked now)" : "",
+               (unsigned long)wake.last_wake_us, (unsigned long)wake.max_wake_us);
+        break;
+    case 'r':
+        audio_out_profile_reset();
+        gpio_dispatch_stats_reset();
+        printf("audio profile reset\n");
+        break;
+    case '+':
+        change_tempo(BPM_STEP);
+        break;
+    case '-':
+        change_tempo(-BPM_STEP);
+        break;
+    case 'l':
+        print_loop_layers();
+        break;
+    case 'b':
+        print_boot_report();
+        break;
+    case 'u': {
+        uint32_t saved = save_and_disable_interrupts();
+        drum_engine_undo(&engine);
+        restore_interrupts(saved);
+        break;
+    }
+    default:
+        // 1 to 9 mute and unmute the layers
+        if (c >= '1' && c <= '9') {
+            toggle_loop_layer((uint8_t)(c - '1'));
+        }
+        break;
     }
-    
-    // Updata our LEDs
-    update_leds();
-    
-    return true;
 }
 
-// Timer callback function for audio sample generation
-bool sample_timer_callback(struct repeating_timer *t) {
-    int32_t mix = 0;
-    int32_t samp_sum = 0;
-    uint16_t pwm_val = 0;
-    
-    // Process active tracks and mix samples
-    for (int i = 0; i < num_active_tracks; i++) { // for every track we have
+// USB comes up in the background while we play, say hello when someone is listening
+void report_boot() {
+    if (boot_times.usb_connected == 0 && stdio_usb_connected()) {
+        boot_times.usb_connected = time_us_32();
+        print_boot_report();
+    }
+}
 
-        if (testbit(tracks_playing, i) == 1) { // if it is currently playing
+// Take one character off the USB serial if there is one, never waits
+void poll_serial() {
+    int c = getchar_timeout_us(0);
 
-            uint32_t current_sample_index = total_samples[i] - samples_left_to_play[i]; // get the sample we need to play
+    if (c != PICO_ERROR_TIMEOUT) {
+        handle_serial_command(c);
+    }
+}
 
-            if (current_sample_index < total_samples[i] && tracks[i] != NULL) {  // if we still have samples left to play
-                samp_sum += tracks[i][current_sample_index];
-                samples_left_to_play[i]--;  // Decrement number of samples left to play
-                
-                if (samples_left_to_play[i] <= 0) {
-                    bit_clr(tracks_playing, i);  // Finished playing this track
-                }
-            } else {
-                // we have completed playing that sample so just exit now
+void drain_log() {
+    log_ring_drain(&log_ring, log_formats, LOG_NUM_EVENTS);
+}
 
-                bit_clr(tracks_playing, i); // clear the bit that set the sample to play
-            
-            }
-        }
-    }   
+// The main loop goes round these, running each one whose period is up.
+// Period 0 runs it every time round
+typedef struct {
+    void (*run)(void);
+    uint32_t period_us;
+    uint32_t last;
+} main_job_t;
+
+main_job_t main_jobs[] = {
+    {run_transport, 0, 0},
+    {drain_log, 0, 0},
+    {poll_serial, 0, 0},
+    {report_boot, 0, 0},
+    {run_session_save, FLASH_STEP_PERIOD_US, 0},
+    {report_cache_stats, STATS_PERIOD_MS * 1000, 0},
+    {run_idle, IDLE_CHECK_PERIOD_US, 0},
+};
+
+#define NUM_MAIN_JOBS (sizeof(main_jobs) / sizeof(main_jobs[0]))
 
-    // dont let the total mixed value go over 16 bits
-    // just set it to the max if it goes over
-    if (samp_sum < -32768) {
-        samp_sum = -32768;
-    } 
-    else if (samp_sum > 32767) {
-        samp_sum = 32767;
+void run_main_jobs() {
+    for (uint32_t i = 0; i < NUM_MAIN_JOBS; i++) {
+        main_job_t *job = &main_jobs[i];
+        uint32_t now = time_us_32();
+
+        if (job->period_us == 0 || now - job->last >= job->period_us) {
+            job->last = now;
+            job->run();
+        }
     }
-    
-    // Map from [-32768, 32767] to [0, 4096] 
-    int32_t shifted_mix = (int32_t)mix + 32768;
-    int32_t scaled_mix = shifted_mix * PWM_WRAP;
-    uint16_t pwm_val = (uint16_t)(scaled_mix / 65536);
-    
-    pwm_set_gpio_level(pwm_output_pin, pwm_val);
-    
-    return true;
 }
 
 // Function to initialize pushbuttons with interrupts on falling edge
-void init_pushbutton(uint pin) {
+void init_pushbutton(uint pin, gpio_handler_fn handler) {
     // Configure pin as input with pull-up resistor
     gpio_init(pin);
     gpio_set_dir(pin, GPIO_IN);
     gpio_pull_up(pin);
     
-    // Enable interrupt for falling edge (button press) and set callback
-    gpio_set_irq_enabled_with_callback(pin, 
-                                     GPIO_IRQ_EDGE_FALL, 
-                                     true, 
-                                     &gpio_isr);
+    // Enable interrupt for falling edge (button press) and give the pin its handler
+    gpio_dispatch_add(pin, GPIO_IRQ_EDGE_FALL, handler);
 }
 
 // Function to initialize beat pins as simple inputs
@@ -706,39 +780,63 @@ void init_beat_pin(uint pin) {
     gpio_set_dir(pin, GPIO_IN);
     gpio_pull_up(pin);
     
-    // No interrupts needed for these pins
+    // Polled by the loop timer, they only get interrupts while parked (see park_loop_timer)
 }
 
 int main() {
+    boot_times.main_start = time_us_32();
+    power_init();
+
+    // audio first, then the pads, then USB. Nothing waits for USB, it enumerates in
+    // the background and everything worth printing from the boot waits for it
+    // (see report_boot)
+
+    // find all our sounds
+    load_sample_bank();
+
+    // give every pad its starting sound
+    log_ring_init(&log_ring);
+    drum_engine_init(&engine, &engine_ops, NULL, sample_bank_ok ? &sample_bank : NULL,
+                     SAMPLE_RATE, DEFAULT_BPM, FIRST_CLASSIC_BEAT);
+    xip_stream_init();
+    mixer_set_fetch(&engine.mixer, xip_stream_fetch, xip_stream_wait);
+    restore_session();
+    erase_ahead();
+    drum_engine_load_pads(&engine);
+
+    // get our PWM ready, from here on the DMA asks the mixer for audio by itself
+#if AUDIO_ON_CORE1
+    multicore_launch_core1(audio_core_main);
+    multicore_fifo_pop_blocking();
+#else
+    audio_out_init(pwm_output_pin, render_audio_block);
+#endif
+    boot_times.audio_live = time_us_32();
+
+    // every pin interrupt on core0 goes through our own handler, see gpio_dispatch.c
+    gpio_dispatch_init();
 
-    // get the pico sdk up and running
-    stdio_init_all();
-    
-    sleep_ms(2000); // just wait a sec to make sure everything is chilling
-    
-    pwm_audio_init(); // get our PWM ready
-    
     // Set up the touch pads for interupts
+    for (int i = 0; i < NUM_BANK0_GPIOS; i++) {
+        pad_for_gpio[i] = 0xFF;
+    }
     for (int i = 0; i < num_active_tracks; i++) {
         gpio_init(Drum_Pads[i]);
         gpio_set_dir(Drum_Pads[i], GPIO_IN);
         
-        // Use with_callback for all touch sensors
-        gpio_set_irq_enabled_with_callback(Drum_Pads[i],        // cycle through all the pads
-                                          GPIO_IRQ_EDGE_RISE,   // set at rising edge interupt
-                                          true,                 // we want the interupt to be working
-                                          &gpio_isr);           // use the gpio_isr function as a callback
+        // rising edge on any pad goes to pad_isr, which looks up which pad it was
+        pad_for_gpio[Drum_Pads[i]] = i;
+        gpio_dispatch_add(Drum_Pads[i], GPIO_IRQ_EDGE_RISE, pad_isr);
     }
     
-    const int total_pushbuttons = sizeof(pusshbuttons) / sizeof(pusshbuttons[0]);
-    const int total_beat_pins = sizeof(beat_pins) / sizeof(beat_pins[0]);
-
-    // Initialise the beat pins from arduino and also the mode pushbuttons
-    for (int i = 0; i < total_pushbuttons; i++) {
-        init_pushbutton(pusshbuttons[i]);
-    }
+    // Initialise the mode pushbuttons and the beat pins from arduino
+    init_pushbutton(SOUND_SELECT_PIN, sound_select_isr);
+    init_pushbutton(RECORD_PIN, record_isr);
+    init_pushbutton(PLAY_PIN, play_isr);
+    init_pushbutton(CLEAR_PIN, clear_isr);
+    init_pushbutton(BEAT_SELECT_PIN, beat_select_isr);
         
-    for (int i = 0; i < total_beat_pins; i++) {
+    for (uint32_t i = 0; i < NUM_BEAT_PINS; i++) {
         init_beat_pin(beat_pins[i]);
     }
 
@@ -751,13 +849,23 @@ int main() {
     gpio_set_dir(PLAY_LED, GPIO_OUT);
     gpio_put(PLAY_LED, 0);  // Start with LED off
     
-    // Configure repeating timer for audio sample generation
-    struct repeating_timer sample_timer;
-    add_repeating_timer_us(-1000000 / SAMPLE_RATE, sample_timer_callback, NULL, &sample_timer);
-    
     // Configure repeating timer for loop timing with 1ms precision
-    struct repeating_timer loop_timer;
     add_repeating_timer_ms(-1, loop_timer_callback, NULL, &loop_timer);
-    
+    boot_times.pads_armed = time_us_32();
+
+    // USB last, the host takes its time enumerating us but that all happens in interrupts
+    stdio_init_all();
+
+    // everything else runs off interrupts. The main loop does what they posted, prints
+    // what they logged, saves the session and looks after the USB serial, see main_jobs
+    while (true) {
+        run_main_jobs();
+
+        // parked there is nothing to do until an interrupt, the loop timer goes every IDLE_TIMER_MS
+        if (audio_out_parked()) {
+            __wfi();
+        }
+    }
+
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,262 @@
+#include <stddef.h>
+#include <string.h>
+#include "mixer.h"
+
+#define MIXER_NO_CHUNK 0xFFFFFFFFu
+
+void mixer_init(mixer_t *mixer) {
+    memset(mixer, 0, sizeof(*mixer));
+}
+
+void mixer_set_fetch(mixer_t *mixer, mixer_fetch_fn fetch, mixer_wait_fn wait) {
+    mixer->fetch = fetch;
+    mixer->wait = wait;
+}
+
+// Bytes in one full chunk of a sound
+static inline uint32_t mixer_chunk_bytes(uint8_t format) {
+    return format == MIXER_FORMAT_ADPCM ? ADPCM_BLOCK_BYTES : MIXER_CHUNK_SAMPLES * sizeof(int16_t);
+}
+
+// Bytes holding the first samples of a sound, rounded up to whole words for the fetch
+static uint32_t mixer_sound_bytes(uint8_t format, uint32_t samples) {
+    uint32_t bytes = format == MIXER_FORMAT_ADPCM ? ADPCM_BYTES_FOR(samples) : samples * sizeof(int16_t);
+    return (bytes + 3) & ~3u;
+}
+
+static void mixer_copy(mixer_t *mixer, void *dst, const void *src, uint32_t bytes) {
+    if (mixer->fetch) {
+        mixer->fetch(dst, src, bytes);
+    } else {
+        memcpy(dst, src, bytes);
+    }
+}
+
+void mixer_set_sound(mixer_t *mixer, uint8_t pad, const mixer_sound_t *sound) {
+    if (pad >= MIXER_NUM_PADS) {
+        return;
+    }
+
+    // anything still playing the old attack goes back to reading flash, we are about to overwrite it
+    const uint8_t *attack = (const uint8_t *)mixer->attack[pad];
+    uint32_t remaining = mixer->live;
+    while (remaining) {
+        uint8_t i = (uint8_t)__builtin_ctz(remaining);
+        remaining &= remaining - 1;
+        if (mixer->voices[i].attack == attack) {
+            mixer->voices[i].attack_length = 0;
+        }
+    }
+
+    mixer->pads[pad] = *sound;
+
+    uint32_t length = 0;
+    if (sound->data != NULL) {
+        length = (MIXER_ATTACK_BYTES / mixer_chunk_bytes(sound->format)) * MIXER_CHUNK_SAMPLES;
+        if (length > sound->length) {
+            length = sound->length;
+        }
+        mixer_copy(mixer, mixer->attack[pad], sound->data, mixer_sound_bytes(sound->format, length));
+    }
+    mixer->attack_length[pad] = length;
+}
+
+// Find a voice for a new sound, a free one if there is one, otherwise the oldest
+static uint8_t mixer_pick_voice(mixer_t *mixer) {
+    uint32_t free_voices = ~mixer->live;
+#if MIXER_MAX_VOICES < 32
+    free_voices &= (1u << MIXER_MAX_VOICES) - 1;
+#endif
+
+    if (free_voices) {
+        return (uint8_t)__builtin_ctz(free_voices);
+    }
+
+    uint8_t oldest = 0;
+    for (uint8_t i = 1; i < MIXER_MAX_VOICES; i++) {
+        // compare against the trigger count so this still works after it wraps
+        if ((int32_t)(mixer->voices[i].started - mixer->voices[oldest].started) < 0) {
+            oldest = i;
+        }
+    }
+    mixer->steals++;
+    return oldest;
+}
+
+void mixer_trigger(mixer_t *mixer, uint8_t pad, uint32_t delay, uint16_t gain) {
+    if (pad >= MIXER_NUM_PADS || mixer->pads[pad].data == NULL || mixer->pads[pad].length == 0) {
+        return;
+    }
+
+    uint8_t v = mixer_pick_voice(mixer);
+    mixer_voice_t *voice = &mixer->voices[v];
+
+    voice->sound = mixer->pads[pad];
+    voice->position = 0;
+    voice->delay = delay;
+    voice->gain = gain;
+    voice->started = mixer->triggers++;
+    voice->attack = (const uint8_t *)mixer->attack[pad];
+    voice->attack_length = mixer->attack_length[pad];
+    voice->stream_chunk[0] = MIXER_NO_CHUNK;
+    voice->stream_chunk[1] = MIXER_NO_CHUNK;
+    mixer->live |= 1u << v;
+}
+
+uint32_t mixer_active_voices(const mixer_t *mixer) {
+    return (uint32_t)__builtin_popcount(mixer->live);
+}
+
+// Add count samples into the mix, scaled by gain
+static void mixer_add(int32_t *dst, const int16_t *src, uint32_t count, uint16_t gain) {
+    if (gain == MIXER_UNITY_GAIN) {
+        for (uint32_t s = 0; s < count; s++) {
+            dst[s] += src[s];
+        }
+    } else {
+        int32_t g = gain;
+        for (uint32_t s = 0; s < count; s++) {
+            dst[s] += (src[s] * g) >> 8;
+        }
+    }
+}
+
+// Where to read a chunk of a voice's sound from, SRAM if we have it
+static const uint8_t *mixer_chunk(mixer_t *mixer, const mixer_voice_t *voice, uint32_t chunk) {
+    uint32_t bytes = mixer_chunk_bytes(voice->sound.format);
+
+    if (chunk * MIXER_CHUNK_SAMPLES < voice->attack_length) {
+        mixer->cache.attack_reads++;
+        return voice->attack + chunk * bytes;
+    }
+    if (voice->stream_chunk[chunk & 1] == chunk) {
+        mixer->cache.stream_reads++;
+        return (const uint8_t *)voice->stream[chunk & 1];
+    }
+    mixer->cache.flash_reads++;
+    return (const uint8_t *)voice->sound.data + chunk * bytes;
+}
+
+void mixer_render(mixer_t *mixer, int16_t *out, uint32_t n) {
+    int32_t mix[MIXER_MAX_BLOCK];
+
+    if (n > MIXER_MAX_BLOCK) {
+        n = MIXER_MAX_BLOCK;
+    }
+    memset(mix, 0, n * sizeof(mix[0]));
+
+    // the attack and stream copies from last time have to be there before we read them
+    if (mixer->wait) {
+        mixer->wait();
+    }
+
+    // take a copy of what is playing once per block, the inner loops then only
+    // touch plain memory instead of reloading the voice state every sample
+    uint32_t live = mixer->live;
+    uint32_t remaining = live;
+
+    // walk the set bits only, so the cost is per live voice not per voice slot
+    while (remaining) {
+        uint8_t i = (uint8_t)__builtin_ctz(remaining);
+        remaining &= remaining - 1;
+
+        mixer_voice_t *voice = &mixer->voices[i];
+
+        // a sound can be told to start part way into a block, or a few blocks from now
+        if (voice->delay >= n) {
+            voice->delay -= n;
+            continue;
+        }
+        uint32_t start = voice->delay;
+        voice->delay = 0;
+
+        uint32_t left = voice->sound.length - voice->position;
+        uint32_t count = left < n - start ? left : n - start;
+
+        // a block can cross into the next chunk, which might live somewhere else
+        int32_t *dst = mix + start;
+        while (count > 0) {
+            uint32_t chunk = voice->position / MIXER_CHUNK_SAMPLES;
+            uint32_t offset = voice->position % MIXER_CHUNK_SAMPLES;
+            uint32_t run = MIXER_CHUNK_SAMPLES - offset;
+            if (run > count) {
+                run = count;
+            }
+
+            const uint8_t *src = mixer_chunk(mixer, voice, chunk);
+            if (voice->sound.format == MIXER_FORMAT_ADPCM) {
+                // decode just this block's worth, the voice keeps the decoder state between blocks
+                int16_t decoded[MIXER_MAX_BLOCK];
+                adpcm_decode_block(&voice->adpcm, src, offset, decoded, run);
+                mixer_add(dst, decoded, run, voice->gain);
+            } else {
+                mixer_add(dst, (const int16_t *)src + offset, run, voice->gain);
+            }
+
+            dst += run;
+            count -= run;
+            voice->position += run;
+        }
+
+        if (voice->position >= voice->sound.length) {
+            live &= ~(1u << i);  // finished playing this voice
+        }
+    }
+
+    mixer->live = live;
+    mixer->clock += n;
+
+    // dont let the total mixed value go over 16 bits
+    mixer_clamp(mix, out, n);
+}
+
+void mixer_prefetch(mixer_t *mixer) {
+    uint32_t remaining = mixer->live;
+
+    while (remaining) {
+        uint8_t i = (uint8_t)__builtin_ctz(remaining);
+        remaining &= remaining - 1;
+
+        mixer_voice_t *voice = &mixer->voices[i];
+        uint32_t chunks = (voice->sound.length + MIXER_CHUNK_SAMPLES - 1) / MIXER_CHUNK_SAMPLES;
+        uint32_t first = voice->position / MIXER_CHUNK_SAMPLES;
+
+        // the chunk it is in and the one after, they go in different buffers so the
+        // one being played never gets written over
+        for (uint32_t chunk = first; chunk < first + 2 && chunk < chunks; chunk++) {
+            if (chunk * MIXER_CHUNK_SAMPLES < voice->attack_length || voice->stream_chunk[chunk & 1] == chunk) {
+                continue;
+            }
+
+            uint32_t samples = voice->sound.length - chunk * MIXER_CHUNK_SAMPLES;
+            if (samples > MIXER_CHUNK_SAMPLES) {
+                samples = MIXER_CHUNK_SAMPLES;
+            }
+            const uint8_t *src = (const uint8_t *)voice->sound.data + chunk * mixer_chunk_bytes(voice->sound.format);
+            mixer_copy(mixer, voice->stream[chunk & 1], src, mixer_sound_bytes(voice->sound.format, samples));
+
+            voice->stream_chunk[chunk & 1] = chunk;
+            mixer->cache.prefetches++;
+        }
+    }
+}
+
+void mixer_clamp(const int32_t *in, int16_t *out, uint32_t n) {
+    for (uint32_t s = 0; s < n; s++) {
+        int32_t v = in[s];
+        if (v < -32768) {
+            v = -32768;
+        } else if (v > 32767) {
+            v = 32767;
+        }
+        out[s] = (int16_t)v;
+    }
+}
+
+void mixer_to_pwm(const int16_t *in, uint16_t *out, uint32_t n, uint16_t wrap) {
+    for (uint32_t s = 0; s < n; s++) {
+        // shift up to [0, 65535] and scale down to the PWM range
+        uint32_t shifted = (uint32_t)((int32_t)in[s] + 32768);
+        out[s] = (uint16_t)((shifted * wrap) >> 16);
+    }
+}
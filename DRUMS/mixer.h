@@ -0,0 +1,138 @@
+#ifndef MIXER_H
+#define MIXER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "adpcm.h"
+
+// The mixer renders audio in blocks instead of one sample per interrupt.
+// Nothing in here touches the pico hardware so it can also be built on a PC.
+
+// How many samples we render per call, anything from 32 to 256 works.
+// Bigger blocks are cheaper per sample, smaller ones react to the pads faster
+#ifndef AUDIO_BLOCK_SIZE
+#define AUDIO_BLOCK_SIZE 64
+#endif
+
+#define MIXER_MIN_BLOCK 32
+#define MIXER_MAX_BLOCK 256
+#define MIXER_NUM_PADS 5     // sounds are picked per drum pad
+#define MIXER_UNITY_GAIN 256 // gains are 8.8 fixed point, this is full volume
+
+// Voices are shared between all the pads, so a pad can ring over itself and
+// songs dont cut off drums. Has to fit in the 32 bit live bitmap
+#ifndef MIXER_MAX_VOICES
+#define MIXER_MAX_VOICES 16
+#endif
+
+// Sounds are read in chunks of this many samples, one ADPCM block. A chunk is
+// 512 bytes of PCM16 or ADPCM_BLOCK_BYTES of ADPCM
+#define MIXER_CHUNK_SAMPLES ADPCM_BLOCK_SAMPLES
+#define MIXER_CHUNK_MAX_BYTES (MIXER_CHUNK_SAMPLES * 2)
+
+// Reading sounds straight out of flash goes through the 16 KB XIP cache, and a few
+// long clips playing at once keep throwing each other out of it. So the start of
+// every pad's sound (the attack, where a late sample is most noticeable) is copied
+// into SRAM when it is assigned, and each voice streams the rest into its own SRAM
+// buffer a chunk ahead of where it is playing.
+// This is how many bytes of attack we keep per pad, 2048 samples of PCM16
+#ifndef MIXER_ATTACK_BYTES
+#define MIXER_ATTACK_BYTES 4096
+#endif
+
+#if AUDIO_BLOCK_SIZE < MIXER_MIN_BLOCK || AUDIO_BLOCK_SIZE > MIXER_MAX_BLOCK
+#error "AUDIO_BLOCK_SIZE must be between MIXER_MIN_BLOCK and MIXER_MAX_BLOCK"
+#endif
+
+#if MIXER_MAX_VOICES < 1 || MIXER_MAX_VOICES > 32
+#error "MIXER_MAX_VOICES must be between 1 and 32"
+#endif
+
+#if MIXER_ATTACK_BYTES < MIXER_CHUNK_MAX_BYTES || MIXER_ATTACK_BYTES % 4 != 0
+#error "MIXER_ATTACK_BYTES must hold at least one chunk and be a multiple of 4"
+#endif
+
+// How a sound is stored
+typedef enum {
+    MIXER_FORMAT_PCM16,  // plain int16_t samples
+    MIXER_FORMAT_ADPCM,  // 4 bit ima adpcm blocks, see adpcm.h
+} mixer_format_t;
+
+typedef struct {
+    const void *data;        // the samples, int16_t for PCM16 or bytes for ADPCM, 4 byte aligned
+    uint32_t length;         // total number of samples in the sound
+    uint8_t format;          // one of mixer_format_t
+} mixer_sound_t;
+
+// Copies bytes from src (flash) to dst (SRAM). It is allowed to finish in the
+// background, the mixer calls the wait function before it reads anything it fetched.
+// bytes, src and dst are always multiples of 4
+typedef void (*mixer_fetch_fn)(void *dst, const void *src, uint32_t bytes);
+typedef void (*mixer_wait_fn)(void);
+
+typedef struct {
+    mixer_sound_t sound;     // the sound this voice is playing
+    uint32_t position;       // index of the next sample to play
+    uint32_t delay;          // samples to wait before the sound actually starts
+    uint32_t started;        // trigger count when it started, the oldest voice gets stolen first
+    uint16_t gain;           // volume, MIXER_UNITY_GAIN plays it as recorded
+    adpcm_state_t adpcm;     // decoder state for ADPCM sounds
+    const uint8_t *attack;   // SRAM copy of the start of the sound
+    uint32_t attack_length;  // how many samples of it are in attack, 0 once the pad changes sound
+    uint32_t stream_chunk[2];  // which chunk of the sound is in each stream buffer
+    uint32_t stream[2][MIXER_CHUNK_MAX_BYTES / 4];  // the next chunks of the sound, even and odd
+} mixer_voice_t;
+
+// Where the samples for each chunk came from, to see how well the caching works
+typedef struct {
+    uint32_t attack_reads;   // chunks read from the SRAM attack copies
+    uint32_t stream_reads;   // chunks read from the voice stream buffers
+    uint32_t flash_reads;    // chunks read straight from flash, the prefetch didnt keep up
+    uint32_t prefetches;     // chunks copied into stream buffers
+} mixer_cache_stats_t;
+
+typedef struct {
+    mixer_sound_t pads[MIXER_NUM_PADS];
+    uint32_t attack_length[MIXER_NUM_PADS];  // samples of each pad's sound in attack
+    uint32_t attack[MIXER_NUM_PADS][MIXER_ATTACK_BYTES / 4];
+    mixer_voice_t voices[MIXER_MAX_VOICES];
+    uint32_t live;           // each bit tells us if a voice is playing
+    uint32_t clock;          // number of samples rendered so far, the time of the next block
+    uint32_t triggers;       // how many voices have been started
+    uint32_t steals;         // how many times a voice was cut short to make room
+    mixer_fetch_fn fetch;    // how to copy out of flash, NULL just uses memcpy
+    mixer_wait_fn wait;      // waits for the fetches to land, can be NULL
+    mixer_cache_stats_t cache;
+} mixer_t;
+
+void mixer_init(mixer_t *mixer);
+
+// Use something other than memcpy to copy sounds into SRAM, like a DMA from the XIP
+// streaming FIFO. Set it before any sounds are assigned
+void mixer_set_fetch(mixer_t *mixer, mixer_fetch_fn fetch, mixer_wait_fn wait);
+
+// Assign a sound to a pad and copy its attack into SRAM, voices already playing the
+// old sound carry on from flash
+void mixer_set_sound(mixer_t *mixer, uint8_t pad, const mixer_sound_t *sound);
+
+// Start a new voice with the pad's sound, delay samples into the next block.
+// If every voice is busy the oldest one is stopped and reused
+void mixer_trigger(mixer_t *mixer, uint8_t pad, uint32_t delay, uint16_t gain);
+
+// How many voices are playing right now
+uint32_t mixer_active_voices(const mixer_t *mixer);
+
+// Mix the next n samples of every live voice into out, clamped to 16 bits
+void mixer_render(mixer_t *mixer, int16_t *out, uint32_t n);
+
+// Fill the voice stream buffers for the next blocks. Call it after mixer_render once
+// the block has been handed over, so the copying isnt in the way of the audio
+void mixer_prefetch(mixer_t *mixer);
+
+// Clamp a block of mixed samples to 16 bits, the last step of mixer_render
+void mixer_clamp(const int32_t *in, int16_t *out, uint32_t n);
+
+// Map a block from [-32768, 32767] to PWM levels in [0, wrap]
+void mixer_to_pwm(const int16_t *in, uint16_t *out, uint32_t n, uint16_t wrap);
+
+#endif // MIXER_H
@@ -0,0 +1,29 @@
+#include "power.h"
+#include "hardware/clocks.h"
+
+static uint32_t power_full_hz;
+
+void power_init(void) {
+    power_full_hz = clock_get_hz(clk_sys);
+}
+
+static void power_set(uint32_t hz) {
+    clock_configure(clk_sys,
+                    CLOCKS_CLK_SYS_CTRL_SRC_VALUE_CLKSRC_CLK_SYS_AUX,
+                    CLOCKS_CLK_SYS_CTRL_AUXSRC_VALUE_CLKSRC_PLL_SYS,
+                    power_full_hz, hz);
+}
+
+void power_slow(void) {
+#if POWER_IDLE_CLOCK_DIV > 1
+    power_set(power_full_hz / POWER_IDLE_CLOCK_DIV);
+#endif
+}
+
+void power_full(void) {
+#if POWER_IDLE_CLOCK_DIV > 1
+    if (clock_get_hz(clk_sys) != power_full_hz) {
+        power_set(power_full_hz);
+    }
+#endif
+}
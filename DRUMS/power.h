@@ -0,0 +1,28 @@
+#ifndef POWER_H
+#define POWER_H
+
+#include <stdint.h>
+
+// Turning clk_sys down while the audio is parked, pico only. clk_sys stays on
+// pll_sys and just gets divided down, which is glitch free and takes a few us.
+// The timer (and so time_us_32 and the repeating timers) runs off clk_ref and
+// USB off pll_usb, so neither notices. The PWM has to be set up again for the
+// new clock, see audio_out_park and audio_out_resume.
+
+// How much clk_sys gets divided by while idle, 1 leaves it alone.
+// 2 keeps it above the 48 MHz USB runs at
+#ifndef POWER_IDLE_CLOCK_DIV
+#define POWER_IDLE_CLOCK_DIV 2
+#endif
+
+#if POWER_IDLE_CLOCK_DIV < 1 || POWER_IDLE_CLOCK_DIV > 4
+#error "POWER_IDLE_CLOCK_DIV has to be 1 to 4"
+#endif
+
+// Remember what clk_sys is at full speed, call it once after the clocks are set up
+void power_init(void);
+
+void power_slow(void);
+void power_full(void);
+
+#endif // POWER_H
@@ -1,7369 +0,0 @@
-// C header file generated by Python script
-// Audio data for: rick_roll_audio
-// Format: int16_t
-// Sample Rate: 22050 Hz
-// Duration: 4.000 seconds
-// Length: 88200 samples
-
-#ifndef AUDIO_DATA_H_RICK_ROLL_AUDIO
-#define AUDIO_DATA_H_RICK_ROLL_AUDIO
-
-#include <stdint.h> // Required for int16_t
-#include <stddef.h> // Required for size_t
-
-const size_t rick_roll_audio_length = 88200;
-
-const int16_t rick_roll_audio[88200] = {
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0,
-    1, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0,
-    1, 0, 0, 1, 1, -1, 1, 0, 0, -1, 0, 0,
-    0, 0, 1, 0, 0, 0, 1, 0, 0, -1, 0, 0,
-    -1, 0, 1, -1, -1, 1, 2, 0, -2, -2, 1, 0,
-    2, -1, -1, 1, 0, -1, 2, 0, -3, 0, -2, 0,
-    0, 0, 1, 2, -1, 0, -3, 1, -1, 1, 3, 0,
-    -3, -1, 4, -3, 4, 1, 2, 0, -5, 0, 1, -1,
-    2, 0, 1, -1, 2, 1, -3, -2, 5, 1, 0, -4,
-    0, 0, -1, -1, 4, 2, -2, -1, 0, -1, 1, -3,
-    3, -2, 1, -2, 1, 3, -4, -1, 3, 0, 2, -3,
-    2, -1, -4, 8, -4, 2, 1, -2, -2, -1, 9, 2,
-    -1, -2, -3, 2, 3, -1, -2, 2, 0, -8, 4, 6,
-    -1, -3, 0, -5, 2, 2, 0, -1, 0, -3, -1, -2,
-    -1, 1, 0, 1, -1, 0, 0, -1, -2, 0, 0, 0,
-    -1, 0, 1, 0, 2, 1, 1, 2, -1, -1, 1, 0,
-    -1, 3, -1, 1, -1, 1, 0, -1, 3, 1, 0, 2,
-    2, 0, 2, -1, -2, 1, 1, -2, 1, 0, 1, 0,
-    1, 4, 7, 13, 15, 15, 3, 2, 8, -3, -10, -9,
-    -14, -18, -8, -15, 0, 8, -3, -9, 7, 15, 7, 16,
-    6, 1, -10, 4, -10, 0, 6, 0, 7, 7, 5, 0,
-    -8, -22, -26, -26, -14, -26, -11, -4, -4, -6, -14, -8,
-    -18, -29, -18, -27, -18, -26, -10, -5, -13, -31, -9, -19,
-    -29, -31, -33, -34, -30, -26, -18, -22, -5, -4, -18, -18,
-    -26, -46, -36, -28, -33, -12, -9, -19, -31, -24, -21, -22,
-    -30, -27, -28, -31, -23, -8, -3, -13, -9, -11, -26, -34,
-    -1, -16, -16, 15, -4, -14, -9, -19, -12, -15, -2, -31,
-    -42, 5, 6, -12, -9, -3, -10, -38, -14, -9, -24, -18,
-    10, 0, 6, -5, 3, -30, -19, -17, -27, -29, -5, -15,
-    1, -3, -12, -13, -22, -29, -30, -22, -20, 5, -5, -6,
-    15, 9, -10, -8, -11, -36, 1, -7, 1, -4, -1, -1,
-    -9, -21, 10, -2, 5, 9, -9, -4, -3, -18, -15, -20,
-    -13, -12, -4, 19, 2, -4, -16, -1, -11, -16, -16, -10,
-    -3, -11, 1, -1, 11, 12, 2, 14, 13, 5, -4, 16,
-    -9, 5, -18, -2, 7, -9, 17, -6, -26, -4, 1, -7,
-    -6, -1, -14, -18, -16, -32, -30, -48, -16, -24, -20, -13,
-    0, -12, -8, 6, 17, 16, 9, 13, -8, -4, -3, -8,
-    2, -2, -30, -23, -1, -9, -6, -19, -12, -12, -18, 8,
-    10, -9, -9, -3, -13, -10, -16, -7, -26, -8, -16, -24,
-    -38, -8, -21, -41, -22, -15, -10, -30, -31, -21, -26, -5,
-    -15, -2, -5, -6, 6, -1, -4, 2, -19, -1, 4, 6,
-    -7, -16, -22, 1, 2, -1, -9, 5, 6, 4, -13, -8,
-    -30, -9, 4, 3, 6, 3, -15, -4, 5, 4, 28, 12,
-    -2, 17, 9, -12, -9, 8, 10, 8, 4, 12, -1, 12,
-    12, 3, -2, 16, 14, -8, 10, 10, 14, 16, -3, -14,
-    11, -5, -14, -4, 2, 10, 12, -6, 8, -9, -3, 2,
-    9, -4, 7, -2, -12, 6, 28, 26, 15, -7, 6, 14,
-    9, 6, 0, 3, -7, 7, -6, -5, -4, -10, -23, 0,
-    6, 2, -23, -26, -18, 4, -12, -2, -15, -27, -4, -14,
-    -5, -1, -20, -16, 13, -7, -8, 16, 3, 3, -24, -21,
-    4, -5, -9, 9, 21, 15, -1, -6, -18, -14, 5, -29,
-    -16, -26, -30, -25, -22, -1, -13, -18, -22, -22, -18, -2,
-    -1, -17, -11, -12, -21, -26, -9, -4, -19, -21, -1, -9,
-    4, -6, 13, 5, 13, 32, 20, -7, 19, 14, 11, 15,
-    29, 19, 2, 12, 1, 20, 5, 4, -7, 8, 13, -1,
-    6, 25, 16, -14, 12, 9, -2, -11, -13, -8, -34, -15,
-    0, -15, -10, -18, -5, -17, -7, 7, -18, -17, 0, -5,
-    -3, -31, -21, -35, -23, -18, -14, -14, 12, -19, -28, -22,
-    -29, -14, -28, -17, -12, -42, -20, -43, -40, -44, -36, -10,
-    -35, -26, -1, 2, -29, -5, -14, -7, -14, 3, -14, -12,
-    3, -29, -30, -13, -18, -18, -29, -33, -29, -35, -30, -18,
-    -26, -29, -28, -6, -26, -10, -23, -30, -36, -12, -20, -37,
-    -11, -29, -44, -5, -17, -8, 1, -11, -9, -22, -30, -30,
-    -19, -17, -8, -13, -5, -6, -12, -5, -23, -20, -23, -11,
-    -21, -19, -8, -13, 2, -10, -27, -4, 4, -4, -14, -18,
-    -30, -10, -3, -1, -18, -8, -15, -30, 10, -15, 13, 5,
-    6, 12, 0, 9, 14, 0, 3, 12, 6, 7, 26, -12,
-    -25, -3, 14, -5, 4, 15, -1, -16, -29, -9, -15, -38,
-    -10, -3, 10, 17, 21, 13, 4, -7, -4, -17, -2, -12,
-    -30, -23, -14, -18, -26, -5, -11, -23, -20, 5, -2, -9,
-    -1, -22, -15, -2, 3, -4, -23, -12, -21, -20, -13, -25,
-    -27, -33, -4, -8, -11, -28, -16, 6, -9, 7, 3, -28,
-    -19, -9, -28, -1, -9, -28, -25, 14, -25, -25, 0, 4,
-    -9, 9, 6, 9, 6, 7, 23, 12, -8, 7, 13, -18,
-    -23, -15, -10, -1, -10, -2, -16, -17, -13, -10, 6, -3,
-    9, -2, 10, -9, -21, 11, 2, -11, 6, -8, 11, -2,
-    -16, -10, -31, -5, -14, -2, 8, 11, 10, 9, 10, 3,
-    5, 5, 27, 4, 6, 30, -11, -13, -22, 3, -11, -30,
-    6, -24, -26, -17, -13, -1, -4, 19, 38, 8, 26, 37,
-    17, 1, 2, 15, -6, -7, 3, 1, 8, 16, 7, 2,
-    1, -7, 29, 16, 31, 19, 8, 15, 5, 18, 8, 21,
-    2, 14, 3, -7, -4, 25, 16, 25, 26, 40, 28, -1,
-    25, 12, -15, 8, 8, 19, 7, 29, 32, 32, 18, 20,
-    24, -1, 22, 32, 20, 24, 22, 26, 24, 49, 28, 11,
-    53, 33, 30, 27, 36, 24, 15, 35, 2, 0, 17, 6,
-    7, -1, 3, 7, -6, 10, -14, 7, -9, -3, 11, 9,
-    -7, 8, -4, 11, 1, 2, -4, 5, 24, -12, 4, 8,
-    -16, 1, -13, -36, -11, 15, 17, 11, 14, 38, 24, 30,
-    35, 31, 27, 14, 7, 7, 1, 10, -8, 7, 8, 16,
-    17, 28, 54, 2, 10, 39, 29, 31, 38, 47, 23, 11,
-    34, 10, -3, 29, 15, -5, -10, 13, -5, 10, -12, 4,
-    13, 7, 10, 6, 21, 31, 22, 39, 5, 18, 9, 22,
-    9, -4, 2, 9, 22, -6, -1, 5, 0, 11, 17, 27,
-    -8, 6, 27, 7, 11, 20, 4, -1, -3, -10, -29, -27,
-    -5, -17, -18, 22, 9, 12, 20, 11, 13, -17, -19, -9,
-    -17, -4, -1, 6, -26, 8, -10, -15, -17, -23, -13, -15,
-    0, 0, 7, 18, -4, -5, -14, -11, -8, 6, -6, 5,
-    10, 0, 8, -6, -7, -10, -30, -11, -21, 12, 6, 26,
-    13, 2, -25, -6, 39, -13, -13, -4, -21, -4, 18, 17,
-    -5, -11, -8, 1, -38, 0, -5, -2, -3, 3, -5, -11,
-    2, 8, -7, 14, -10, -6, -26, 10, 7, 5, -3, 1,
-    7, -3, -3, -3, -5, 1, -4, 4, 39, 25, 22, 4,
-    3, 6, -5, 13, 11, 9, 12, 25, 15, 25, 15, 14,
-    -15, -10, 18, -13, 15, 31, 16, -2, 1, 42, -8, -12,
-    -4, -1, -13, 12, 13, 1, 5, 2, 29, 5, 10, 15,
-    18, 5, 29, 5, -8, 4, -3, 5, -11, 29, 5, 24,
-    9, 7, 4, 0, -12, 2, -21, -1, -12, 1, -2, -21,
-    -13, -18, -16, -7, -10, -9, -19, -22, -17, -11, -16, -15,
-    1, -29, -19, -22, -33, -27, -35, -2, -19, -13, -3, -16,
-    -12, 0, -8, -2, -19, 12, -19, -17, -24, -21, -32, -8,
-    -26, -12, -21, -32, -11, -18, -27, 0, -9, -24, -27, -8,
-    -14, -18, -21, -12, -9, -11, 5, -27, -17, -16, 2, 0,
-    5, -1, 0, -10, 10, 7, 16, 24, 15, -11, -1, 12,
-    -6, 20, 7, 19, 32, 17, 19, -6, 12, 4, -11, 7,
-    12, 11, -17, 10, -5, -11, 11, 19, 1, -6, -17, 16,
-    5, 2, 27, 12, 8, 2, 13, 3, 10, 30, 23, 6,
-    12, 30, -4, 15, 17, 9, 9, 37, 36, 10, 22, 17,
-    33, 1, 11, 17, 5, 5, 8, -5, -1, 37, 3, 10,
-    28, 14, 34, 22, 9, 13, 20, 37, 20, 9, -8, 2,
-    -6, 10, -7, 0, -27, -14, -8, -13, -10, 0, 4, -3,
-    0, -4, 8, -5, -5, -12, -7, -5, -8, -12, -12, -14,
-    0, -23, -8, -7, -5, 0, -14, -10, 15, 14, 4, -4,
-    -5, -21, -10, 4, -16, -18, 0, -18, -7, -24, -22, -15,
-    -16, -10, -9, -4, -18, 0, -12, -2, 17, 10, -8, -13,
-    -7, -17, -26, -15, -14, -19, -19, 0, -5, -25, -10, -10,
-    -24, -13, 1, 1, -3, -16, -22, -12, -13, 4, -18, -16,
-    1, -27, -20, -23, -10, -1, 4, 0, -11, -8, -14, 8,
-    12, 12, 17, 23, 20, 24, 30, 25, 45, 36, 46, 56,
-    50, 46, 50, 56, 41, 40, 43, 34, 23, 37, 31, 23,
-    31, 34, 29, 28, 34, 34, 26, 14, 28, 21, 10, 11,
-    -3, -7, -27, -22, -42, -33, -32, -50, -34, -47, -59, -83,
-    -68, -84, -64, -89, -86, -89, -66, -66, -74, -88, -62, -109,
-    -81, -39, -101, -64, -66, -68, -29, -74, -33, -31, -62, 9,
-    -27, 9, 28, 28, 5, 38, 26, 54, 45, 123, 40, 162,
-    145, 192, 144, 236, 158, 149, 312, 179, 271, 269, 245, 325,
-    259, 291, 376, 192, 323, 284, 156, 317, 356, 246, 270, 216,
-    216, 76, 177, 101, 177, 58, 181, 173, -82, -7, 17, -111,
-    48, -28, -98, 53, -70, -20, -35, -186, -21, -140, -279, -83,
-    -194, -51, -44, 45, -234, -38, -118, -121, -237, -189, -122, -156,
-    -214, -66, -471, -182, -629, -386, -97, -471, 16, -285, -122, -335,
-    -403, -516, -448, -436, -70, -112, -209, 264, 662, -217, 19, 34,
-    24, 158, 672, 1019, 911, 101, 223, 197, -147, 492, 445, 300,
-    -21, 416, 74, 571, -368, -369, -316, -377, 63, -616, 500, 765,
-    0, -448, 137, -708, -662, -122, 48, -1265, 235, -329, -1620, 862,
-    846, 433, 349, -235, 208, 10, -643, 108, 167, 524, 718, 72,
-    -162, 2359, -1650, -1549, 2198, -1296, -3912, -3188, -2284, 2139, -1152, 970,
-    -8052, -9893, -6650, -509, 4190, -1445, 1616, 8118, 8241, 11386, 4142, -4820,
-    793, 10480, 12455, 10483, 10268, 3893, -1972, -7040, -4006, 1552, -11601, -10609,
-    -3717, -6346, -178, -6845, -14245, -10420, -6857, -2458, 3427, 6733, 6057, 10025,
-    10978, 2617, 6163, -4771, 1945, -131, 1059, 14325, 10126, -2503, -3981, 3605,
-    6408, 8909, 442, -3938, -2130, 4830, -8883, -4691, 6382, 2121, -5883, 2839,
-    4009, -5316, -5621, -8261, -9690, -7447, -9228, -6737, -8340, -8775, -9429, -7313,
-    -5455, -5759, -5970, -4294, -1910, 418, -1057, -1807, 3758, 10806, 7647, 4403,
-    4790, 9435, 13345, 11898, 6922, 6560, 9597, 10675, 14000, 9626, 1369, 9964,
-    10163, 1863, -4530, 3322, 6899, 8150, 6291, 1988, 2722, 2215, 3779, 3947,
-    5225, 3301, 3265, -2896, -7194, -4080, -5408, -5162, -8407, -6605, -7848, -7084,
-    -11556, -5600, -8068, -15718, -17594, -9984, -3141, -2306, -9542, -15230, -13084, -6610,
-    -1568, -1904, -2911, -4540, -3400, -10316, -6116, -1474, -10035, -8049, -3373, -4761,
-    -9203, -1880, -3199, -6876, 1292, -1169, 1467, 5417, 355, 7166, 5813, 2787,
-    12309, 7400, 4040, 10725, 10472, 7443, 10898, 5329, 13463, 6902, 4849, 13736,
-    9223, 2471, 6854, 6988, 6895, 446, 3758, 10723, 5968, 4093, 5187, 9094,
-    8997, 5927, 3255, 5231, -1270, -2899, 587, -5788, -5824, -52, -1362, -6813,
-    -10776, -11022, -2825, -8621, -7567, -4466, -6163, -10871, -13139, -4040, -7302, -10082,
-    -6315, -2278, -8217, -8553, -7798, 977, 2121, 56, -7141, -5801, -5969, -8455,
-    -5577, -3200, -6063, -3569, -4683, -1781, -3034, -1173, 2814, 2128, 8385, 7923,
-    4172, 5623, 5593, 3603, 5561, 4636, 11090, 9270, 5807, 10185, 11841, 8883,
-    7490, 6992, 5439, 4297, 5553, 7354, 5534, 6693, 3935, -3230, -1500, 2921,
-    3435, 3795, 2902, 4545, 4583, 4295, 2497, -821, 97, -1375, -7049, -4524,
-    118, 1678, -4072, -6891, -8837, -6293, -9249, -3167, -4727, -9950, -3004, -11523,
-    -7536, -3983, -4664, -3295, -6177, -7816, -9472, -5246, -6571, -2792, 2904, 2502,
-    -1364, -4355, 2734, 1276, -6963, -6686, -1676, -1262, 2482, -2603, -1478, 2640,
-    1722, -398, 2200, -1148, 3836, 8154, 3536, 1557, 4238, 4595, 306, 3077,
-    7750, 9986, 5988, 3703, 9177, 8400, 6375, 10220, 12074, 5684, 3893, 3114,
-    2152, 2417, 4684, 6690, 3852, 3188, -2325, -1367, 4754, 7210, 2309, -712,
-    3899, 2672, 2690, -2440, -2807, 1541, 3114, -120, -7270, -7637, 754, -1638,
-    -5476, -7933, -5520, -1002, -6608, -8624, -8973, -9323, -1918, -5161, -7711, -8414,
-    -2881, -3086, -10043, -8129, -8143, -2670, -2573, -5151, -2822, -431, -2695, 4522,
-    6660, -1587, -5572, -4526, 2480, 2098, -328, -1610, -709, 2604, 6081, -221,
-    155, 2304, 8278, 9861, 691, 4297, 6783, 9578, 4421, 3617, 6236, 7232,
-    7021, 3088, 8830, 7003, 355, 2238, 6123, 10268, 2121, -2579, 2172, 2017,
-    1241, 1490, 3317, -632, -2073, -4929, 2261, 6538, 2093, 701, -545, 1141,
-    -163, -146, -827, -5734, -4041, -2350, -3426, -4891, -3615, -596, -4904, -9966,
-    -10378, -2327, -9062, -11400, -3126, -1262, -7206, -8558, -3252, -2731, -3597, -7370,
-    -4128, -3432, -3087, -1455, -3627, -3386, 553, -1801, -564, 1362, -1240, 3121,
-    1943, -4497, -4015, 843, 2283, -162, 1192, 3872, 6707, 3066, 2148, 4399,
-    5242, 4001, 9003, 10133, 5060, 6481, 5966, 10811, 8605, 4317, 8081, 9733,
-    6319, 3968, 7411, 6254, 5453, 8213, 1374, 2053, 4952, 2577, 3220, 3361,
-    6102, 5377, 1346, -787, -2081, -859, -505, -587, 4322, 8162, 6029, 950,
-    1016, -4239, -972, 3519, 2416, -976, -305, 748, -5026, -5453, -162, -2936,
-    -4158, -5457, -2768, -260, -5087, -1601, -4367, -7123, -5903, -4308, -6361, -4963,
-    -3853, -595, -2238, -3905, 626, -3414, -1990, -2906, -1482, 4991, 2704, 643,
-    -4005, 3130, 9718, 3059, -3309, -6709, -833, 2645, 1037, 2369, 2959, -378,
-    1578, -1235, 3488, 1832, 1816, 3628, 2967, 3410, 1798, -641, 3536, 7950,
-    6886, 4096, 1414, 2811, 7698, 4682, 7533, 2655, 3404, 3410, 5989, 4075,
-    -2198, 1389, 2716, 1793, -434, -3223, 333, 2131, -3638, -6083, -6316, 1633,
-    3126, -1501, 639, -3889, 91, -3060, -5068, -1509, -2286, -1665, -6294, -8244,
-    -4958, -1209, -125, -4731, -5632, -5916, -5739, -5799, -1404, -2450, -2942, -4445,
-    -3892, -5540, -4287, -3636, -3905, -3810, -3083, -6305, -445, 1089, -4079, -1340,
-    3714, 467, -4613, -2234, -123, -1285, 5244, 5165, 3083, -332, 247, -1982,
-    272, -2793, 393, -884, -853, 112, 2426, 2302, -306, -2117, 1167, 4180,
-    2814, 1667, 5567, 6266, 5499, 5441, 8040, 3348, 1095, 4657, 4705, 3657,
-    5421, 6185, 2020, 3522, 1599, -2168, -147, 2496, -1203, -1079, 1386, 766,
-    312, -5127, -3746, -4720, -6438, -4288, -469, -360, -691, 449, 437, -143,
-    -2439, -2932, -1230, -2049, -1165, 1313, -2229, -5705, -7146, -1814, -1611, -5346,
-    -5537, -3663, -3722, -1451, -5791, -5900, -5228, -1729, -3778, -6632, -2659, -1860,
-    -1786, -2490, -5857, -4918, -4147, -1114, 590, 255, 4122, 439, -1279, 3771,
-    5162, 5668, 4858, 3497, 3719, 2541, 2576, -588, -816, 3631, 3911, 2907,
-    2673, 5652, 5690, 3503, 1429, 3089, 3688, 6745, 4831, 3963, 4921, 4592,
-    4382, 7020, 5646, 5581, 2714, 7201, 5479, 4493, 5090, 4587, 3213, 5697,
-    7558, 5336, 1576, -106, 1096, 1396, 5599, 1247, -1504, -71, 1049, 860,
-    1051, -1292, -5711, -5969, 1122, 2370, -1392, -2753, -2105, -1365, -325, -1486,
-    -1864, -1089, -3663, -4161, -3068, -3727, -3157, -100, -4157, -1644, -2843, -6429,
-    -4903, -4762, -2332, -6107, -2826, -3766, -4440, -2099, -1137, -486, -1598, -3349,
-    -3268, -3163, -1612, 2009, -897, -268, 3966, 3542, 2464, 2783, 3209, 3815,
-    2381, 4754, 4826, 5367, 3078, -101, 1319, 4724, 2521, 742, -198, 641,
-    2151, 2142, 5275, 2723, 1664, 3220, 3362, 4816, 5352, 2628, 3360, 3903,
-    1495, 2741, 4044, 5263, 5531, 2276, 3249, 3324, -2149, -269, 3114, 3869,
-    -1531, 408, 995, -4774, -3388, -1189, -143, -988, -981, -3548, -4054, -6847,
-    -2551, -1700, -5786, -6964, -6361, -2359, -1269, -3155, -1890, -4517, -2637, -3311,
-    -2846, -662, -5299, -7129, -4460, -2099, -5165, -7107, -7081, -4717, -4742, -3676,
-    -1323, -2686, -7090, -3540, -1033, -1015, -2242, -2638, -3367, -3158, 253, -1617,
-    -1219, -1439, 1459, 1630, 1415, 1594, 1224, 485, 34, -137, -883, 2344,
-    3891, 472, 1374, 6555, 6437, 5196, 2486, 2193, 1954, 3192, 2312, 1480,
-    -389, 1070, 2020, 4408, 4815, 1832, 1333, 2204, 1177, -304, 3788, 4169,
-    1834, 2914, 1994, 3690, 3963, 2149, 1328, 628, 2041, 78, 175, -108,
-    -386, 2182, 1304, -1089, -4083, -4353, -1058, 39, -3392, -1097, -2027, -2739,
-    -1136, -1075, -320, -3748, -4689, -6115, -5208, -4917, -2825, -1510, -2479, -799,
-    -2111, -2298, -49, -701, 706, -781, -2144, -601, -2056, -3565, -997, 15,
-    -2530, -1919, -3439, -2645, -3804, -4244, -2145, 368, -3465, -6253, -775, 185,
-    -2034, -900, 541, 971, -828, -780, 1806, -1139, -1215, 2869, 3958, 1274,
-    78, 612, 1255, 208, -268, 2193, 2302, 3878, 3315, 6910, 3663, -631,
-    996, 2097, 1409, 275, 737, 756, 1391, 2329, 2554, 3001, 1654, 675,
-    698, 4066, 5387, 2694, -1062, 2383, 3769, 2969, 145, 666, 2258, 4041,
-    3069, -1553, 1755, 1928, 1408, -806, -3168, -29, 1694, 110, -1744, -2697,
-    -1969, 1554, 552, 1128, 1481, -262, -2578, -3249, -1264, -2644, -2524, -2605,
-    -3512, -2149, -2239, -2136, 622, 2549, 1718, -4105, -3537, 653, -413, -111,
-    -1295, -4304, -2660, -1833, -2330, -2228, -3293, -3273, -4613, -2880, -2018, -3241,
-    -262, -3351, -6523, -2744, -1714, 742, -834, -3630, 1004, -537, -1952, 785,
-    1746, 828, 266, -1246, -1293, -305, 1863, 1012, -1467, 1819, 808, 754,
-    3023, 1463, 895, 4150, 3893, 3268, 1572, 1627, 1950, -1970, -676, 2080,
-    -895, 43, 2873, 2640, 745, -661, 2716, 3712, 2258, 2764, 3134, 3688,
-    4803, 4672, 2420, 1956, 3826, 4074, 3168, 870, 1436, 4165, 3444, 1120,
-    -2627, -3287, -815, -397, 606, 1633, -1922, -3207, -1817, -1414, -624, -2028,
-    -1676, -3432, -3336, -2087, -2449, -2981, -4988, -4013, -3826, -5216, -4608, -2406,
-    -1020, -2669, -3079, -3000, -2769, -2598, -1012, -3355, -1895, 466, 342, 234,
-    -2991, -3700, -4005, -2971, -4206, -3297, -592, 217, -2330, -2291, -895, 411,
-    -839, -1210, -488, -1225, 1235, 1319, -558, -645, 1218, 1583, 2762, 673,
-    -1739, 901, 3000, 2750, 1321, 3579, 1948, 2684, 1777, 3524, 3587, 2890,
-    4164, 2290, 1725, 3649, 4850, 433, -927, 395, 1010, 767, 2236, 3314,
-    3137, 993, 494, 1176, 1270, 1335, 2633, 2653, 3494, 1951, -1520, 231,
-    2658, 3291, 3, 147, 879, 466, 342, 55, 423, -687, 9, -1502,
-    -3142, -793, 1198, -2726, -2161, -2, -353, -1557, -2997, -3491, -1606, -2218,
-    -2511, -2716, -3259, -2213, -1033, -2478, -3492, -1400, -4098, -4319, -2793, -1349,
-    808, 759, -418, -2678, -1638, -686, -728, 1144, 2132, -1453, -1852, -1424,
-    -225, 156, -914, 52, -173, -312, -1228, -1436, -1146, -2826, -694, 2959,
-    650, -1388, -1852, -1839, 2100, 3495, 1305, -1060, 93, 2297, -48, 831,
-    1598, 1161, 2658, 3379, 3162, 919, 1437, 2532, 3920, 2382, 1, 1448,
-    3054, 2414, 2492, 4579, 3324, 1640, -723, 35, 2087, 965, 1000, 1309,
-    1959, 1322, -441, -303, 53, 1625, 1013, 1742, 3247, 2695, 95, 1534,
-    2220, -69, 671, 3480, 2999, 1218, 101, 837, -1074, -1033, 1098, -1654,
-    -2397, -200, 236, 557, -1137, -3176, -872, -90, -2834, -2962, -2966, -627,
-    -1089, -2956, -2812, -1857, -2871, -3294, -1760, -4199, -4141, -741, -2780, -4254,
-    -3370, -2773, 88, 734, 125, 325, 340, 803, -2105, -2163, -211, 1026,
-    -217, -1321, -1993, -2647, -2185, -322, 1182, -1137, -1125, -1201, -118, -99,
-    1220, 1320, -939, 11, 1250, 196, -1715, 558, 1813, 1160, 1600, 16,
-    -1601, 549, 2293, 2504, 1419, 1165, 4251, 2505, 1289, 3831, 3268, 30,
-    3410, 3461, 2976, 3417, 4354, 3953, 1484, 3597, 4349, 2249, 1412, 622,
-    309, 1144, 1238, 222, 892, 370, 1300, -545, -830, -751, -3043, -1004,
-    1939, 1201, -1378, -2374, 544, 572, 387, 977, 239, -640, 1113, 1487,
-    -58, -1120, 804, 2632, 25, -501, 33, 781, -441, -4476, -3047, -1119,
-    -471, -534, -879, -618, -3464, -3914, -391, -116, -3621, -4853, -3165, -1685,
-    -1860, -3427, -2777, -4727, -4828, -3178, -2039, 238, -61, -2638, -3726, -2178,
-    -2825, -966, -1362, -1650, 674, -86, -1606, -657, 36, -1248, -2384, -2748,
-    -1922, -1093, -1389, -4056, -4778, -2373, -1087, -465, -2363, -1504, -1668, 102,
-    181, 75, -902, 232, 319, 201, 359, 1111, 1462, 1213, 1663, 1248,
-    145, -373, 1236, 2307, 531, 2858, 3210, 3203, 3816, 2368, 1414, 1504,
-    1615, 2289, 4057, 4681, 1744, 3780, 1707, 713, 2336, 1918, 2637, 736,
-    310, 2682, 1674, -12, 1421, 3511, 3314, 2376, -1882, -2139, 1379, 2123,
-    -879, -1265, 260, 355, 1079, -802, -60, -1343, -1169, -85, -531, -1471,
-    45, -311, -2625, -2817, -3858, -4611, -3384, -3682, -2444, -1541, -3644, -4867,
-    -3267, -3655, -1797, -1844, -2383, -1438, -1935, -4351, -4238, -4620, -2541, -2469,
-    -4032, -3777, -1051, -718, -1990, -1283, -1696, -1745, -183, -193, -1251, 72,
-    -2348, -3328, -170, 1026, -863, -522, 2382, 2065, -575, -755, -50, -947,
-    1559, 453, -1946, 322, 1990, 983, 587, -1384, -1437, 518, 873, 1773,
-    2521, 3111, 2216, 1150, 3018, 5921, 5151, 3182, 1746, 1390, 2117, 3555,
-    3502, 2275, 3117, 2864, 2790, 3184, 3526, 3552, 2019, 2277, 3485, 2465,
-    3439, 1405, 192, 1984, 2002, 74, -1101, -1762, 280, 1397, -373, -1507,
-    -516, -374, -706, -17, 602, 281, 936, -457, -1302, 251, -365, -1039,
-    -62, 200, -381, -612, 590, 971, 27, -1088, 375, 318, -1590, -1658,
-    -2433, -2616, -1210, -1279, -582, 185, -1199, -3029, -1886, -2657, -2312, -774,
-    -119, -147, -410, -850, -1012, -2566, -2246, -2251, -3348, -1862, -1620, -3321,
-    -1889, 124, 1444, -304, -558, 90, 1014, 860, 1732, 2463, 1153, 1512,
-    2429, 1836, 3381, 1859, 205, 1401, 2760, 3469, 1943, 661, 295, 2041,
-    2877, 2103, 1039, -1406, -694, 399, 467, -479, -1439, -1077, 212, 121,
-    -831, 1061, 2281, 726, 980, 250, 846, 3305, 506, -1425, 427, 1398,
-    1746, -60, -644, -31, 1913, 1898, 2994, 1535, 1176, 984, 3731, 6139,
-    4465, 1375, 67, 138, 738, 2229, 2166, 110, 931, 1226, -319, 294,
-    1900, 1329, 1144, 2067, 1542, -56, 31, -547, 111, 2369, 2329, 710,
-    935, 578, 679, 532, 320, 957, 47, 1020, 1354, 53, -871, -1545,
-    -500, -138, -2037, -3013, -2112, -1304, -1575, -2717, -3195, -2741, -3184, -2921,
-    -842, -1408, -2166, -1983, -3042, -2396, -2399, -5232, -4837, -3302, -2246, -4017,
-    -4774, -4226, -3728, -2319, -1421, -1261, -1255, -542, -445, -1503, -1029, 963,
-    1103, 673, 821, 168, -161, 957, 2101, 2023, 1549, 1198, 361, -264,
-    1464, 1943, 97, 1156, 1468, 995, 2005, 2148, 2584, 3731, 2928, 1852,
-    1095, 1981, 3953, 4854, 3651, 3008, 3270, 2528, 2775, 3705, 4759, 3100,
-    2156, 2425, 2941, 2355, 1340, 1863, 2854, 2188, 1178, 1479, 1898, -474,
-    458, 2217, 2392, 1330, 186, -720, 144, -418, -1608, -641, -666, -1161,
-    -1359, -1658, -1124, -1458, -1420, -1332, -2761, -2440, -318, -785, -2255, -2064,
-    -2027, -2156, -677, -736, -1701, -2039, -2548, -2105, -937, -1953, -2106, -2403,
-    -2105, -1031, -1206, -1216, -1032, -1722, -1875, -2401, -2123, -1854, -1491, -2403,
-    -3102, -2855, -3072, -3694, -2934, -1127, -1046, -2898, -3332, -2113, -141, -257,
-    -1287, -1154, -553, -963, -2406, -1226, 846, 1756, 1192, 608, 1574, 1355,
-    764, 835, 1375, 964, 161, 656, 2749, 1236, 779, 1814, 1886, 1771,
-    1570, -107, -1576, -683, -574, -2751, -1971, -627, -781, 55, 165, -756,
-    -1836, -1531, -1345, -1339, -1772, 610, 1857, -112, -1150, -223, 1133, 60,
-    -1090, 4, 1970, 2441, 1038, 923, 1462, 3028, 1167, 125, 1433, 1119,
-    819, 808, 1135, 1261, 1667, 1495, 1673, 3198, 1425, -1343, -369, 461,
-    63, 23, 1009, 1170, -430, -890, 849, 373, -1511, -112, 1378, 1698,
-    1676, 457, -1141, -747, 621, 798, 984, 659, -298, -695, -687, -792,
-    -760, -1333, -2009, -2476, -3128, -1464, 75, -1019, -2927, -3426, -3078, -2301,
-    -1860, -2721, -2869, -2778, -2775, -2915, -3306, -3542, -3772, -2691, -1815, -3415,
-    -4560, -4027, -3814, -3433, -2396, -2679, -4424, -3949, -3056, -2507, -2154, -1720,
-    -669, -236, 588, 1230, 1416, 649, 1183, 1244, 1844, 3143, 1656, 556,
-    1352, 2902, 2803, 2547, 2927, 2724, 2124, 2007, 3258, 3446, 1458, 1429,
-    2902, 2628, 2392, 1038, 1320, 2350, 2178, 2117, 3538, 2648, 1701, 1779,
-    2089, 1683, 258, 979, 1167, 275, 984, 2245, 703, -331, 605, 1857,
-    1612, 1183, 592, 631, 178, 667, 1711, 1622, -113, -147, 256, 1325,
-    1901, 1060, -356, -781, -391, -470, -710, -62, -985, -865, -847, 182,
-    -557, -2057, -1463, -912, -1233, -401, -1428, -2106, -876, -315, -1493, -1376,
-    -1569, -1500, -15, 177, -266, -759, -1812, -2142, -1304, -1230, -2005, -618,
-    598, 286, -69, 114, 86, -1239, -1472, -1259, -887, 152, 1639, 1278,
-    -147, -207, 58, -736, -1503, -1458, -1942, -596, 50, 460, -1242, -2419,
-    -1383, -125, 1, 189, -104, 128, 193, 453, 2336, 3256, 2576, 3528,
-    4225, 3124, 2528, 3111, 2858, 1779, 1749, 1983, 1000, 137, 358, 1405,
-    48, -1083, -1242, -774, -143, -503, 159, 13, 160, 412, -885, 17,
-    1410, 1292, 432, 210, 463, 374, 637, 1107, 1036, 259, 1189, 1617,
-    555, 906, 1147, 386, 638, 747, 564, 234, 214, 205, 550, 1207,
-    333, 14, 342, 495, 407, 892, 1040, 388, 1223, 1966, 1884, 1760,
-    2082, 1949, -514, -828, 484, 384, 437, 133, -837, -9, 790, 898,
-    1518, 600, -863, -182, 745, 518, 417, 34, 695, 404, 319, 1000,
-    1272, 294, -750, -399, -325, -195, 896, 1151, 72, 1444, 2148, 1383,
-    1187, 998, -94, -294, 293, 613, 730, 911, 1502, 531, -223, -1116,
-    -2395, -1893, -1699, -1739, -861, -1062, -2144, -1461, -1244, -1719, -2427, -1795,
-    -775, -196, -837, -951, -949, -1741, -2504, -1493, 518, 1122, 111, -1223,
-    -1399, -666, -381, -659, -964, -739, -588, -716, -280, -102, 134, 1800,
-    2025, 392, -146, 183, 176, 509, 478, -171, 706, 1585, 1766, 1367,
-    334, -255, -111, 1981, 2507, 1056, 1259, 1006, 567, 1588, 2243, 2125,
-    1735, 1484, 1430, 2160, 1803, 2165, 3234, 1657, 1183, 903, -275, 588,
-    1038, 1150, 929, 767, 428, 778, 1150, 1557, 2505, 2401, 768, 359,
-    899, 1101, 780, -207, 550, 849, -99, 64, 501, -660, -2316, -1483,
-    276, 264, -790, -1639, -1289, -1877, -2075, -2585, -3613, -3240, -2184, -1578,
-    -1921, -1734, -1779, -2570, -2649, -2082, -2117, -2916, -3027, -2436, -2662, -2908,
-    -2503, -2575, -2688, -2254, -1881, -1689, -1156, -1200, -1587, -1882, -1487, -1282,
-    -1123, -1374, -1658, -775, 631, 192, -528, -695, -363, 601, 1026, 99,
-    -102, 1196, 1546, 1021, 352, 1, 227, 956, 174, -386, 478, 1064,
-    1999, 2263, 1487, 885, 326, 604, 1317, 1030, 1507, 1349, 889, 1323,
-    1016, 669, 493, 858, 895, 226, -1076, -1338, -379, -721, -196, 429,
-    -733, -1382, -227, 1528, 1155, 575, 1364, 809, 39, 502, 993, 1066,
-    1150, 1555, 1551, 1827, 1816, 714, -549, 101, 1542, 1384, 1062, 1582,
-    1840, 1049, 33, -392, 184, 891, 662, 40, 358, 1566, 127, -631,
-    -640, -1286, -697, 175, -852, -2595, -2727, -3165, -4150, -2579, -957, -1749,
-    -3052, -2028, -2353, -3130, -2235, -1492, -1015, -1444, -1244, -639, -982, -1190,
-    -1524, -1620, -671, -386, -754, -346, 530, -463, -1091, -397, -950, -1312,
-    -452, 489, 667, 727, 616, 42, 580, 680, -114, 720, 896, -690,
-    -731, -106, -297, -446, 126, 1015, 938, 328, 678, 890, -244, 776,
-    1730, 2054, 1932, 1899, 1546, 757, 886, 1123, 790, 227, -409, -540,
-    -365, -613, -634, -871, -1072, -911, -598, -733, -70, -304, -1105, -917,
-    -774, 494, 394, -590, -187, 57, -636, -920, -1022, -1786, -1343, -263,
-    -23, -309, -1185, 272, 1243, 163, 694, 1041, 238, 129, 847, 2079,
-    2148, 2436, 2698, 2817, 3370, 3324, 2411, 2831, 3599, 2398, 2245, 2363,
-    1947, 2385, 1782, 1295, 866, -219, -197, 662, 1125, 870, 227, -263,
-    289, 1445, 1474, 1217, 882, 413, 249, 12, -257, 281, -469, -2018,
-    -2695, -2852, -2408, -1852, -2744, -3296, -3073, -2209, -741, -1688, -2901, -2242,
-    -1307, -893, -1220, -1893, -2167, -1520, -166, -328, -464, -494, -1896, -2253,
-    -2122, -1949, -1967, -1697, -1268, -698, -422, -142, 12, -778, -1088, -1247,
-    -673, 192, 890, 1126, 990, 577, 468, -429, -675, 905, 1015, 790,
-    1320, 1815, 1242, 1604, 1575, 1275, 1327, 1467, 1244, 730, 838, 833,
-    1214, 1705, 1192, 670, 354, 249, 834, -220, -1419, -588, -696, -677,
-    -949, -1036, -162, -589, -1007, -471, -503, -270, 530, 381, 675, 418,
-    782, 1951, 1430, 1037, 1001, 882, 496, 602, 1037, -193, -1295, -1336,
-    -493, 60, -3, -193, -1171, -329, 957, 1708, 1613, 700, 698, 1695,
-    2130, 2360, 1951, 782, 989, 1216, 1586, 2188, 1407, 318, 385, 490,
-    424, 1196, 829, 1382, 2158, 1520, 1276, 1558, 1659, 2978, 2888, 2618,
-    2327, 853, 42, 722, 952, 1208, 1475, 592, -161, -1095, -1079, -422,
-    -1401, -2430, -2512, -1515, -1060, -1705, -1981, -1996, -2821, -1886, -1732, -2205,
-    -2394, -1349, -1137, -1521, -1465, -2336, -2292, -2364, -2755, -2310, -1639, -1748,
-    -1271, -577, -271, -876, -1573, -1710, -1465, -297, 71, -626, -132, 789,
-    680, 834, 397, -260, 599, 1158, 549, 462, 508, 728, 591, 234,
-    596, 117, 459, 773, 788, 1121, 1266, 1385, 1398, 1357, 1825, 268,
-    -1031, -1508, 389, 2926, -455, -5556, -3876, 1333, 6059, 996, 1861, 5454,
-    3248, 3132, -734, 5450, 5277, 3500, 3047, 1752, 3250, -3497, -6594, -6561,
-    -4562, -2242, -4389, -7491, -5005, -7281, -5283, -2990, -6234, -7439, -3310, 4603,
-    5426, -887, -526, 1780, 2048, 9895, 8165, 6605, 3249, 6662, 10567, 7264,
-    83, -1584, -304, 1992, -3390, -5231, -4140, -5706, -3384, 306, 620, -7799,
-    -7527, 1318, 3471, 4812, 6056, 2928, 661, 5477, 4432, 5043, -1011, 4302,
-    6223, 7230, 7976, 3406, -1110, -3482, -2710, -2835, -3491, 366, 1318, -1458,
-    -3885, -2601, 569, 1924, -884, -5697, -5801, 1428, 1019, -3600, -8611, -6307,
-    -4104, -4819, -4619, -6332, -5643, -3234, -3519, -3647, -1734, -1648, -414, -119,
-    1084, -102, -842, -157, -983, -374, 1429, 3617, 2812, -365, 245, 2718,
-    3114, 4520, 5104, 4118, 2307, 2219, 5294, 4275, -419, 714, 3828, 5097,
-    3724, 3525, 4446, 3294, 1727, 1960, 663, 1147, 67, -1630, -1526, -1050,
-    -2437, -3830, -3755, -3328, -2714, -1883, -4559, -4432, -3488, -1684, -3492, -3907,
-    -5050, -4657, -4028, -4445, -4857, -5218, -3592, -1480, -588, -1533, 22, -1257,
-    -2317, -1758, -2185, -1548, -1164, -1136, -2092, -939, 681, 443, 364, 1932,
-    3407, 1976, 1332, 1469, 2069, 2558, 4812, 4821, 3734, 3281, 1231, 3024,
-    2942, 1032, 957, 4358, 4633, 4296, 2760, 1143, 2570, 3084, 1810, -328,
-    -1715, 1755, 4466, 2976, 543, 2000, 1390, 1226, -6, -1339, -2762, 50,
-    -1072, -2324, -3601, -3650, -2262, -3022, -4467, -4605, -3663, -2926, -3908, -2055,
-    -1071, -696, -288, -354, -1168, -2633, -3148, -2035, -1039, -189, -689, -240,
-    -1498, 224, -276, -1244, -2682, -3002, -2791, -2633, -2346, -1938, -1124, 185,
-    302, 723, -460, -630, 515, 2071, 3267, 1354, 305, 3107, 2810, 1014,
-    541, 1387, 1685, 2689, 953, -1414, 905, 2875, -293, -405, 1688, 34,
-    1087, 1403, -410, -1305, -2386, -1447, 33, 2619, 2426, 1470, 2321, 1331,
-    518, -561, -498, 1090, 1587, 336, -439, -357, -776, -689, -292, 133,
-    -800, -1797, -1372, -2265, -208, -125, -1620, -1223, -50, -874, -1442, -1735,
-    -3177, -2921, -1624, -1988, -590, 335, -1232, -290, 2153, 2621, -260, -2867,
-    -538, 701, 1832, 710, 196, 1715, 2025, 1944, 1094, 802, 1600, 1831,
-    1602, 2766, 2794, 1476, 969, 461, 1014, 2212, 3227, 4030, 2126, 122,
-    939, 3390, 3542, 1256, 1088, 3044, 3235, 2917, 2706, 1702, 1017, 627,
-    576, 1146, 837, 1378, 1595, 1406, 1533, 1986, 743, -572, 118, 333,
-    -12, 85, 132, 1092, 461, -339, 1021, 305, -1753, -1946, -1533, -1977,
-    -1233, -87, 193, 240, -1977, -2123, -404, -1476, -1454, -1524, -2182, -2134,
-    -2365, -2924, -2265, -955, -1289, -522, -431, -1166, -1414, -3274, -1747, -408,
-    -2731, -3418, -1721, -1574, -598, -1132, -1211, -635, -1138, -411, -640, 972,
-    1639, 732, 1251, -156, -430, 958, 1755, 1783, 2157, 628, 958, 1531,
-    1238, 1587, 1994, 1975, 178, 900, 1425, 109, 87, 709, 155, -1457,
-    -1317, -762, 914, -43, -394, 1478, 2057, 511, -88, 1024, -710, -1838,
-    22, 89, -595, -835, -1357, -1545, -1654, -1824, -467, -1043, -1924, -2844,
-    -3056, -1228, -258, -1251, -2297, -1892, -1114, -925, -695, 827, 899, -763,
-    -1050, 142, 570, -690, 486, 2206, 2254, 626, -1798, 399, -239, 153,
-    952, -95, 939, 1927, 769, -876, 5, 1038, 1249, 1121, -81, 151,
-    225, 1401, 2277, 2025, 1982, 1782, 896, 1080, 1918, 1091, 649, 769,
-    665, 838, 1565, 1097, 491, 1590, 2370, 964, 561, 1329, 1963, 41,
-    -1768, -29, 1994, 2299, 2723, 1849, 1217, 1975, 853, 878, 194, -221,
-    1189, 572, -920, -873, 763, -729, -1835, -1524, -1285, -1845, -2020, -1037,
-    -1216, -2590, -3243, -2213, -1253, -1117, -2330, -1360, -1975, -1941, -1439, -310,
-    -457, 100, 627, -1469, -1158, 1232, 1668, 215, -222, -127, -331, -229,
-    -909, -376, 550, 1429, 299, -468, 421, 567, -557, -180, 434, -554,
-    964, 1840, 1371, 1660, 1386, -202, 1769, 2067, 2177, 1735, 759, 1459,
-    2765, 2626, 905, 760, 1412, 270, 74, 1842, 585, -418, 203, 131,
-    63, -638, 552, -536, -1609, -882, 1615, 2794, 1809, 175, -300, 487,
-    -993, -1160, -437, -375, -707, -530, -548, -1076, -2500, -2750, -1889, -1763,
-    -2753, -1804, -1978, -1645, -1875, -720, 792, -542, -2707, -3209, -1989, -2004,
-    -1241, -193, -2122, -1576, -376, -477, -726, -1396, -730, -317, -1050, 285,
-    1813, 1261, 1832, 429, 99, -71, 70, 904, 788, -987, 250, 2111,
-    1424, 217, -610, 637, 1834, 1800, 1681, 577, 254, 754, 1091, 722,
-    -125, 1323, 1705, 635, -148, -253, -260, -26, 528, -504, -2105, -558,
-    732, 442, 658, -375, -1380, 125, 661, -1012, -984, -1150, -1132, -552,
-    9, -242, -843, -773, 71, 245, -295, -403, 836, -448, -1074, -1228,
-    -554, -267, -1314, -1868, -1557, -1982, -1590, -896, -760, -1012, -1294, -906,
-    -1098, -2233, -1336, -463, -795, 216, -700, -828, 159, -335, 11, 560,
-    267, 370, 322, -499, 241, 1148, 1256, 1079, 442, 586, 2956, 1201,
-    -729, 283, 514, 590, 885, 1426, -36, -597, 228, -404, 511, 1026,
-    1476, 1823, 1115, 1563, 1956, 1050, 898, 1485, 1727, 2134, 1976, 816,
-    2355, 2319, 2204, 3077, 1870, 851, 1133, 2383, 1938, -258, -31, 384,
-    -1229, -128, -203, -1137, -1677, -798, -1014, -1719, -2598, -2437, -2120, -2183,
-    -2048, -376, -772, -897, -1313, -1148, -367, -1731, -2308, -1208, -624, -1295,
-    -1923, -1409, -1902, -1154, -487, -1969, -2643, -2068, -1355, -936, -1828, -989,
-    -904, -1532, -1818, -823, 595, 1109, -399, -1443, -2550, -776, -778, -107,
-    158, 805, 524, 233, 567, 830, 273, 81, 50, 1362, 1200, 212,
-    -171, 1331, 976, 454, 837, 944, 1457, 1391, 961, 1386, 2651, 1560,
-    1728, 1927, 2413, 2316, 2289, 2873, 3157, 624, 419, 1931, 1961, 2003,
-    1682, 980, 595, 892, 1496, 1560, 1216, 860, 1033, 1561, 1442, 1021,
-    1474, 63, -1066, 683, 672, -640, -455, -1137, -1140, -1137, -1395, -107,
-    303, 1017, -13, 122, 462, 62, -513, -876, -531, -1976, -2348, -2213,
-    -2076, -1163, -1822, -3129, -2447, -1486, -675, -1717, -1973, -1746, -2828, -1735,
-    -1287, -2061, -1210, -1683, -1485, -1192, -1215, -579, -505, -1253, -1125, -593,
-    746, 49, -1089, -1404, -56, 218, 65, -727, -1258, -690, 483, 452,
-    -875, -2102, -1817, -1847, -1627, -776, -74, 178, 224, -489, -349, 742,
-    2136, 1334, 1374, 2006, 1402, 543, 1201, 2054, 2015, 1440, 1427, 604,
-    1748, 2926, 3027, 2431, 1433, 1134, 1513, 1526, 1644, 2545, 1915, 2554,
-    2509, 1988, 2240, 1408, 24, 523, 588, 1020, 706, 770, 835, -533,
-    -1309, -398, 885, 767, 858, 1902, 1830, 2026, 2619, 2310, 1822, 1206,
-    793, 82, 837, 955, -76, -24, -1094, -1827, -1318, -1676, -2530, -1123,
-    582, -526, -1519, -2013, -2307, -1689, -1277, -1261, -1949, -2477, -2121, -1720,
-    -1916, -1902, -2351, -3147, -2218, -1884, -3001, -2835, -3147, -2736, -2040, -1455,
-    -1792, -1866, -1518, -1038, -830, -1805, -1533, -389, -178, -1389, -626, -567,
-    -479, 168, -78, 125, -3, 845, 629, 178, 576, 229, 56, 1750,
-    1676, 1908, 2028, 2250, 2332, 1733, 1747, 1361, 1543, 2231, 2410, 2186,
-    1417, 1306, 1945, 1395, 1699, 2064, 1016, 1165, 2206, 2348, 2019, 1436,
-    1114, 1207, 1429, 1776, 1395, 792, 228, 373, 1218, 2055, 1539, 574,
-    -92, 142, 321, 688, 275, -916, -609, -996, -6, -446, -1408, -1673,
-    -1253, -988, -2778, -2415, -1965, -2136, -1342, -779, -1111, -1408, -1703, -2205,
-    -448, -357, -1155, -1708, -1234, -875, -809, -846, -1179, -1305, -1712, -2125,
-    -1680, -1903, -1492, -968, -330, -601, -1629, -1040, -210, -43, 1050, 913,
-    514, -460, -184, -356, -990, -1104, -505, -178, 83, 691, 1100, 407,
-    -133, 1102, 1531, 495, 625, 1395, 906, 1054, 1027, 442, 998, 989,
-    1349, 1649, 1108, 228, -675, 50, 949, 719, -394, -486, 214, 560,
-    333, -79, 671, 704, 219, 134, -4, 71, 837, 671, -609, -194,
-    -337, -287, 65, -259, -819, -480, -514, -414, -694, -308, 79, -89,
-    -521, -268, 182, 470, 204, 152, 404, 127, -596, -838, -405, 372,
-    253, -27, -473, -249, -744, -1052, -385, -902, -296, -60, -78, 547,
-    116, 470, 284, 685, 299, 31, 662, 889, 897, 542, 233, 1116,
-    1241, 770, 1076, 890, 1045, 1866, 1307, 1299, 1438, 1610, 290, 16,
-    615, -247, -456, -33, 904, 780, 472, 363, 39, -51, -581, -422,
-    -296, -20, -91, -491, -450, -737, -529, -871, -1237, -817, -296, -134,
-    -1036, -845, -1273, -1187, -501, 159, -246, -106, 258, -193, -23, 139,
-    -4, -60, 32, -328, -271, -421, -779, -341, 15, -603, -189, 494,
-    337, -360, -931, -650, 484, 1426, 1092, 870, 111, 97, 1337, 1342,
-    59, -186, 101, 136, 34, -536, -366, -12, 123, -1033, -954, 327,
-    686, 330, -370, -1142, -380, -154, -1174, -1107, -472, -197, 122, 779,
-    546, -506, -1125, -376, -148, 245, -467, -522, 323, 425, 147, 21,
-    459, 319, -1338, -984, 74, -642, -952, -282, -132, 362, -419, -634,
-    -850, -1282, -786, -379, -410, 161, 997, 1298, 212, -148, 234, 809,
-    1044, 1892, 1860, 1524, 1317, 1647, 1090, 1181, 1147, 885, 466, 9,
-    -261, 335, -539, -1378, 272, 1272, 895, 116, 383, 196, -51, -256,
-    -246, -106, -134, -235, -289, -822, -319, -281, -656, -883, -680, -755,
-    -836, -598, -670, -843, -1163, -1480, -976, -180, 199, -469, 104, 608,
-    -384, -1200, -1312, -1040, -246, -291, -1219, -2040, -1548, -1258, -618, -909,
-    -1079, -862, -289, -541, -674, -766, -361, 613, 779, -182, -722, -610,
-    269, 915, 512, 7, 332, 1600, 1888, 1195, 1268, 2052, 2056, 1110,
-    422, -132, 626, 1905, 1284, 1479, 2202, 1900, 1666, 1772, 1518, 1276,
-    1301, 1901, 1922, 596, 1031, 480, -608, -111, 717, 599, -210, -111,
-    535, 679, -277, -514, -914, -1319, -870, -98, 104, 41, 409, -126,
-    -239, 834, 1102, 1046, -25, -176, 715, 911, -468, -424, 300, 1183,
-    276, -301, -238, -479, -58, 535, 933, 1379, 935, -116, -665, -696,
-    -621, -712, -1282, -415, 230, 24, -1646, -1820, -1110, -914, -1905, -2286,
-    -1217, -217, -597, -895, -1380, -312, 118, -482, -246, 1081, 1268, 580,
-    214, 83, -466, -164, -6, -438, -919, -829, -1204, -1875, -1775, -1459,
-    -1328, -1188, -839, -327, -129, -148, -194, -251, -322, 365, 940, 641,
-    478, 848, 1030, 1278, 1712, 1137, 250, 1002, 1500, 1618, 1522, 567,
-    344, 1100, 1116, 868, 726, 1883, 3052, 3017, 2857, 2388, 1720, 2911,
-    2620, 1746, 1439, 1325, 986, 510, 708, 1064, 1030, 1380, 346, -165,
-    517, 336, 73, 1024, 1050, 532, -635, -280, 238, 46, 523, -367,
-    -632, -81, -195, 427, -113, -864, -1165, -1310, -1531, -1805, -2320, -1365,
-    -1090, -1154, -1663, -1890, -2094, -1926, -1733, -1933, -2045, -1485, -1243, -2596,
-    -3129, -2482, -1869, -2006, -3114, -4114, -3940, -2346, -1365, -2028, -1572, -825,
-    -977, -1057, -1206, -563, -39, -298, -792, -829, 120, 498, -93, -928,
-    -728, -501, -7, 104, -822, -1751, -722, 919, 161, -646, -224, 490,
-    1011, 298, 784, 1182, 1469, 1933, 2174, 2764, 1733, 2466, 2658, 2566,
-    2360, 1573, 1387, 1188, 1125, 1172, 988, 891, 580, 525, 1443, 2317,
-    1673, 719, 1130, 2003, 1925, 1354, 786, 1438, 1711, 1136, -436, -59,
-    476, 309, -415, -1314, -1391, -412, 364, -144, -1760, -1572, 337, 800,
-    -855, -1459, -1192, -568, -169, -117, -1149, -2031, -1494, -618, -997, -1641,
-    -2553, -1919, -1382, -1533, -1824, -2153, -1218, -323, -285, -1091, -1884, -1462,
-    -639, 39, -119, 350, 594, 83, 224, 887, 826, -850, -1408, -1024,
-    -565, -114, -15, 384, -568, -1580, -1176, -804, -776, -159, 254, 1225,
-    585, 173, 1086, 2102, 1538, 126, 623, 1905, 2036, 2184, 1352, 2024,
-    2159, 1612, 1491, 1578, 1373, 779, 116, -89, -566, -346, 119, 360,
-    46, -179, 344, -426, -1097, -404, 74, -43, -255, -891, -1283, -767,
-    -876, -1049, -2452, -2239, -1021, -507, -1211, -1837, -1996, -2302, -2121, -1631,
-    -1029, -371, 111, 555, 435, 893, 1682, 1625, 826, -269, 198, 1471,
-    1292, -52, -853, -309, 431, 279, -130, -646, 108, 496, 276, 423,
-    130, -179, 651, 951, 658, 513, 644, 527, 837, 1067, 863, 1093,
-    1552, 720, 854, 1887, 1435, 1201, 991, 1104, 247, 297, 447, 325,
-    107, 238, -340, -762, -15, -351, -674, -1160, -1182, -633, -1234, -1544,
-    -1981, -2629, -1979, -1016, -1628, -2623, -1481, -470, -547, -971, -1246, -675,
-    3, 549, 146, -99, -968, -450, 541, 230, -822, -244, 328, -128,
-    -173, -317, -155, -987, -516, 208, -41, -682, -871, -601, -1240, -840,
-    459, 505, 1236, 2083, 1356, 1471, 958, 1264, 980, 485, 444, 1056,
-    1241, -321, -1186, -221, 376, 449, 889, 688, 561, 694, 1090, 1848,
-    1315, 813, 1595, 1728, 1110, 925, 1007, 879, 995, 1675, 1983, 2036,
-    1056, 425, 925, 979, 548, 772, 1440, 1396, 531, 232, 616, 383,
-    48, -34, -1030, -821, -97, -381, -1276, -849, -191, -504, -189, 511,
-    227, -80, 481, 604, 792, 389, -791, -314, 309, 301, -985, -1293,
-    -413, -305, -453, -1095, -1881, -1875, -1456, -1094, -1365, -929, -487, -833,
-    -973, -828, -100, -244, -728, -920, -544, -205, -163, -282, 244, 386,
-    124, 199, 134, 391, 130, -48, 32, 312, 293, 1025, 656, 169,
-    262, 616, 450, -154, -485, -712, -416, -709, -1261, -1045, -1150, -1824,
-    -1938, -1135, -613, -949, -1306, -1137, -1334, -782, -167, -1008, -559, 484,
-    1076, 434, 767, 956, -473, -235, 217, 628, 812, 621, 714, 658,
-    555, 648, 391, 538, 1163, 1691, 1241, 1442, 1669, 1813, 1363, 890,
-    833, 1883, 2018, 1130, 2200, 2664, 2177, 1327, 562, 967, 1639, 2073,
-    1846, 921, 624, 1135, 1321, 1029, 1145, 1673, 1250, 1130, 1267, 1008,
-    1074, 914, 147, -448, -951, -941, -1142, -968, -801, -1560, -1928, -1685,
-    -1423, -1760, -2368, -2702, -2964, -1160, -41, -1647, -2426, -2048, -2174, -2120,
-    -1966, -1939, -2139, -1730, -1179, -1272, -2518, -2901, -2956, -2268, -1363, -1562,
-    -2292, -2697, -1861, -1074, -2132, -2444, -1829, -713, -110, 84, 733, 836,
-    379, 177, 78, 463, 1000, 909, 98, -27, 901, 1234, 989, 1121,
-    958, 200, 271, 1234, 866, 81, 884, 932, 128, 1267, 2336, 1897,
-    1121, 1541, 2117, 2000, 1572, 2048, 2028, 1781, 1227, 827, 540, 336,
-    -107, 309, 801, 1111, 302, -680, 159, 469, 205, 185, -147, -65,
-    230, 520, 41, 228, -16, -250, 102, 522, 582, 566, 44, -503,
-    166, 1489, 373, -526, -672, -879, -815, -1015, -1386, -1064, -778, -535,
-    186, -947, -1165, -917, -810, -988, -1387, -1790, -2101, -913, -372, -170,
-    -957, -1176, -1113, -433, -250, -477, -325, -94, 4, 178, 362, 808,
-    1066, 756, 814, 888, 1721, 1966, 765, -219, -425, 82, -238, -729,
-    -1102, -1225, -1602, -1643, -1347, -1686, -1486, -402, 49, 68, 605, 731,
-    867, 1865, 2140, 2071, 1107, 235, 1317, 2450, 2971, 2742, 1830, 1514,
-    1624, 872, -228, -401, -803, -1148, -1407, -934, -1319, -1977, -1774, -1590,
-    -1099, -1231, -1074, -511, -801, -236, 393, -352, -180, 102, -133, -493,
-    -1041, -369, 13, -54, -950, -843, -74, 383, -10, -564, -985, -502,
-    99, -705, -2061, -2802, -1697, -152, 148, -277, -68, 105, 213, 908,
-    1522, 498, -224, 186, 516, 1636, 1938, 225, -803, 249, 1457, 1819,
-    1438, 817, 531, 1129, 1419, 637, 180, -426, -255, 227, 1080, 1556,
-    1030, 776, 212, -244, -507, 487, 1512, 1448, 648, 108, 819, 1688,
-    1074, -86, 437, 1984, 2667, 2286, 1850, 2204, 1692, 1717, 1700, 1493,
-    1562, 1038, 915, 1005, -132, -324, 321, 188, -899, -1204, -554, -572,
-    -1190, -1522, -1821, -1475, -1307, -1831, -1975, -2350, -1739, -873, -1333, -1524,
-    -1343, -1583, -703, -972, -1679, -1682, -1830, -1636, -1378, -828, -1516, -2313,
-    -314, 226, -181, -289, -197, -242, 349, 30, -1289, -1940, -1051, 116,
-    -27, -275, -783, -1398, -1418, -1145, -321, 48, 209, 377, 715, 554,
-    667, 622, 1359, 1198, 324, 948, 2252, 2201, 1853, 1729, 2216, 2009,
-    1779, 1178, 164, -287, -169, 381, 965, 1052, 935, 974, 1396, 1170,
-    47, 260, 1597, 2013, 1936, 1443, 1678, 1540, 1529, 1193, 1147, 1582,
-    2427, 2461, 1598, 1282, 914, 248, 495, 671, 59, -502, -228, -242,
-    -1033, -2174, -1850, -1182, -588, -976, -530, -973, -2096, -1646, -1335, -1321,
-    -1306, -1441, -1479, -1077, -867, -925, -836, -862, -1264, -1664, -1319, -1561,
-    -1591, -1234, -1929, -1897, -909, -1120, -1047, -1143, -1112, -1425, -1391, -1049,
-    -655, 250, 411, -391, -1025, -527, 346, 692, 1266, 1463, 781, -330,
-    -275, -422, -595, -891, -588, -510, 452, 381, -500, -911, -1173, -1019,
-    -980, -439, 690, 1229, 512, 625, 979, 888, 666, 939, 992, 937,
-    1211, 841, 344, 174, 879, 1356, 1543, 1556, 709, 1042, 1203, 564,
-    1037, 1742, 1004, 228, 978, 1551, 542, 775, 1015, 83, -277, 214,
-    1010, 1282, 754, 280, 375, 1338, 2217, 1820, 2047, 2148, 1618, 1148,
-    1590, 2278, 1091, 561, 774, 762, 208, -1136, -1709, -1933, -1482, -1806,
-    -2143, -2177, -2728, -3074, -1757, -1186, -1903, -1977, -1583, -1290, -1233, -1378,
-    -2011, -2283, -1686, -1056, -1417, -1449, -792, -1404, -2242, -1908, -413, -1047,
-    -1181, -1116, -1159, -611, 437, 635, -48, 138, 607, 565, 234, 84,
-    -217, -715, -797, 252, 922, 653, -502, -453, 385, 82, -764, 142,
-    424, -174, 170, 188, 1062, 1472, 1397, 886, 1245, 1323, 940, 836,
-    1473, 571, -109, -291, -213, -721, -1065, -731, -306, -1007, -1861, -1674,
-    -1370, -1523, -802, 252, 981, 673, 240, 547, 626, 940, 1007, 955,
-    277, 92, 361, 98, -610, -1185, -1131, -425, -275, -435, -932, -928,
-    -382, -1, 1472, 780, 551, 1739, 2555, 2853, 2072, 1610, 1814, 2356,
-    2099, 1426, 1567, 1823, 2327, 2655, 2136, 1080, -226, -419, 67, 730,
-    889, 402, 232, 716, 981, 1209, 548, -470, 232, 1105, 662, 400,
-    530, 714, -187, -1302, -1127, -1061, -1031, -932, -274, -835, -1565, -1713,
-    -2259, -2330, -1122, -201, -963, -1291, -1329, -1550, -1421, -1709, -1908, -1690,
-    -1394, -1377, -1032, -771, -1154, -2096, -2217, -1516, -1495, -1943, -1509, -1151,
-    -711, -126, -120, -1004, -1042, -940, -1243, -807, -791, -932, -1032, -1520,
-    -1690, -825, -391, -389, -562, -607, -245, 672, 1586, 1326, 1198, 1374,
-    1720, 2275, 2693, 2167, 1235, 1137, 1465, 1909, 1338, -52, -151, 133,
-    39, -871, -1753, -1090, -688, -1267, -1491, -1427, -331, 308, 753, 441,
-    3, 167, 996, 1740, 1973, 1656, 1388, 918, 521, 707, 750, 404,
-    288, 195, -550, -802, -878, -436, 58, -263, -241, -106, -77, 665,
-    633, 334, 803, 1153, 1358, 1270, 1732, 1743, 1117, 514, 789, 317,
-    -288, 41, 459, 56, -4, -355, 41, 113, 315, 189, 137, 454,
-    706, 1634, 2051, 1279, 1161, 1470, 2224, 1838, 602, 219, 889, 1120,
-    669, -153, -208, 323, 38, -238, -654, -1557, -1700, -805, -415, -290,
-    -171, -780, -1253, -1708, -1711, -1531, -1927, -2305, -1770, -1387, -1267, -1117,
-    -1229, -1367, -1338, -1081, -1213, -2106, -1864, -1108, -747, -621, -248, -512,
-    -1120, -862, -574, -425, -120, 535, 952, 84, -441, -210, -375, 38,
-    730, 1198, 1632, 1584, 944, 288, 120, 326, 258, 170, 225, 756,
-    1717, 1746, 897, 872, 871, 160, 14, 742, 1567, 2282, 1939, 1008,
-    6, 627, 1060, 330, -229, 148, 306, 754, 890, -344, -1150, -1054,
-    -1111, -1111, -810, -399, -178, -24, -381, -263, 94, -440, -332, 21,
-    -568, -184, 941, 1157, 622, 128, 131, -56, 15, -276, -732, -385,
-    557, 383, -439, -584, -386, -388, -334, 281, 433, 52, -116, 317,
-    954, 987, 644, 755, 456, 443, 1197, 1276, 930, 994, 1391, 1760,
-    1966, 1250, 232, 530, 1053, 964, 1122, 775, -10, -211, 1063, 862,
-    194, 1008, 977, 750, 70, -421, -624, -985, -1367, -1170, -1050, -381,
-    -335, -1031, -1246, -785, -984, -1582, -916, -219, -274, -940, -642, 20,
-    180, -57, 433, 144, -398, -393, -128, -285, -729, -1409, -1756, -1698,
-    -1755, -1734, -1309, -597, -750, -1484, -1396, -959, -652, -592, -347, -24,
-    -91, -73, -161, -497, -465, -437, 389, 535, 85, -68, 227, 283,
-    546, 394, 472, -243, -748, -467, -619, -572, 191, 125, -240, 89,
-    87, -191, 414, 672, 805, 1331, 794, -426, -631, -72, 317, 102,
-    -290, 101, 623, 339, -16, 379, 571, 694, 587, 1119, 1409, 249,
-    371, 917, 995, 843, 472, 524, 224, 540, 1517, 1793, 1802, 745,
-    23, 163, 333, 300, 344, 159, -163, -716, -871, -53, -493, -920,
-    -674, -737, -372, -126, -267, -310, -373, -34, 144, 498, -269, -1482,
-    -1126, -234, -914, -1975, -2948, -2614, -2032, -1898, -1972, -2187, -2205, -2205,
-    -1872, -1007, -281, -149, 250, 265, 0, 637, 1531, 1356, 861, 1408,
-    1732, 1825, 1376, 1131, 1037, 577, -209, -621, -1216, -1926, -1887, -1300,
-    -659, -459, -496, -260, -62, 368, -59, 198, 1375, 1669, 1739, 1849,
-    2036, 1977, 1712, 1747, 1358, 644, 265, 307, 738, 771, -42, -46,
-    542, -88, -649, -1199, -1187, -428, -88, -568, -1192, -1332, -869, -817,
-    -625, -2, -145, -463, -193, 638, 470, -70, -380, 335, 802, 617,
-    -269, -327, 553, 734, 2, -609, -317, -117, 287, 212, -463, -493,
-    -384, -43, -107, -302, 86, 303, 390, 246, -146, -501, -27, 594,
-    839, 929, 379, 758, 1517, 549, 11, 549, 925, 960, 646, 586,
-    577, 387, 147, -543, -816, -633, -492, -567, -382, 3, 263, 104,
-    -292, -530, -461, -109, 141, 32, 116, 170, 246, -58, -255, -369,
-    -188, 122, 437, 236, -91, 211, 358, 507, 437, 512, 16, -39,
-    472, 725, 1165, 849, 595, 1879, 1865, 1621, 1356, 1368, 806, 911,
-    702, 196, -214, 670, 1431, 874, 229, 19, -93, 193, 608, 625,
-    126, -104, 34, 237, 20, -463, -517, -20, -20, -573, -195, -275,
-    -818, -536, -266, -725, -900, -657, -1155, -1919, -1674, -1768, -1780, -1589,
-    -1966, -2052, -1424, -1638, -1570, -1356, -1563, -1509, -626, -340, -575, -333,
-    144, 592, 514, 486, 111, -9, 243, 294, 392, -156, -115, -178,
-    -765, -1543, -1066, -539, -520, -946, -1450, -1009, -579, -634, -327, 117,
-    250, -265, -42, -9, 262, 389, 764, 960, 1282, 1707, 1431, 765,
-    687, 755, 725, 293, 113, -8, 264, 183, 381, -153, -151, 202,
-    369, 113, 156, 394, -93, 121, 424, 255, 696, 696, 424, 439,
-    351, 102, 299, 87, -842, -617, 660, 790, 177, 871, 1531, 1132,
-    205, -38, 243, -106, -122, 627, 1240, 797, 393, -149, -335, -269,
-    -148, -105, 38, 121, 222, 361, 105, -451, -426, 72, 465, 864,
-    1066, 173, -595, 294, 656, -179, -314, 381, 949, 1160, 473, -41,
-    -328, 261, 44, -254, 127, 343, -230, -460, -637, -63, -189, -568,
-    -532, 209, 803, 160, -902, -238, 134, 95, 121, -427, -1231, -1494,
-    -1007, -960, -1311, -1446, -1260, -1273, -1205, -719, -570, -833, -1284, -1234,
-    -955, -686, -705, -503, -275, 241, 447, 336, 91, -307, -109, 249,
-    -615, -1612, -1183, -447, -190, -495, -923, -880, -255, 480, 160, -379,
-    -221, 164, 0, 173, 371, -76, -244, 303, 1272, 1746, 1264, 137,
-    -241, 306, 500, 273, 144, -94, -22, 28, 427, 473, 567, 540,
-    325, 513, 1200, 1333, 1168, 1002, 1002, 1289, 1493, 1454, 1496, 1098,
-    1116, 768, 734, 239, -9, -328, -354, 160, 775, 459, 125, 227,
-    522, 719, 662, 610, 423, -233, 75, 1020, 731, 405, 583, 797,
-    685, 286, -296, -354, -111, -283, 621, 1408, 1033, 421, 311, 147,
-    240, 109, -10, 107, 263, 90, -297, -601, -467, -566, -474, -622,
-    -663, -817, -891, -942, -1289, -1517, -1669, -1539, -880, -715, -1036, -971,
-    -695, -910, -1573, -2174, -1775, -575, -159, -841, -1046, -352, -258, -1022,
-    -1919, -1586, -1293, -1300, -1128, -1017, -702, -542, -1145, -1467, -1313, -816,
-    -296, -205, -537, -623, -309, 96, -237, -608, -263, -449, -324, 595,
-    812, 238, 157, 1049, 1214, 531, -101, -514, -339, 230, 653, 644,
-    448, 432, 778, 968, 534, 16, 513, 1309, 1716, 1165, 1012, 1188,
-    1236, 1129, 801, 692, 835, 1286, 1239, 834, 173, 549, 1153, 1255,
-    978, 398, 151, 350, 419, 160, 67, 384, 771, 1115, 1284, 760,
-    608, 1035, 1127, 841, 572, 410, 438, 976, 1281, 1080, 862, 458,
-    92, 372, 413, -354, -901, -683, -554, -994, -806, -704, -899, -1032,
-    -1163, -1593, -1821, -1670, -914, -449, -369, -75, 921, 1346, 125, -679,
-    -273, 163, 284, 267, -125, -412, -596, -349, -42, -552, -983, -1105,
-    -593, -56, -287, -1022, -1067, -715, -379, -393, -142, -97, -233, -230,
-    -475, -1144, -1047, -690, -946, -1256, -856, 273, 72, -755, -1126, -1277,
-    -1319, -1030, -723, -329, 180, -118, -267, 324, 450, -227, -501, -65,
-    315, 396, 564, 743, 514, -181, -545, -71, 348, -2, -763, -435,
-    493, 820, 1083, 699, 123, 538, 1402, 1151, 322, 75, 613, 676,
-    921, 1310, 1010, 640, 811, 1125, 861, 362, 454, 991, 768, 349,
-    566, 1179, 1545, 1682, 1588, 1300, 773, 1097, 1936, 1656, 1100, 722,
-    861, 781, 582, 858, 685, 397, 176, -270, -800, -1064, -570, -52,
-    -192, -821, -1251, -887, -711, -1306, -1346, -1143, -1149, -1071, -1035, -804,
-    -549, -460, -742, -1379, -1548, -889, -730, -809, -1016, -1032, -785, -545,
-    -1002, -1512, -1376, -866, -1162, -1313, -1289, -868, -738, -896, -1178, -1562,
-    -1425, -795, -195, -101, -679, -816, -538, -210, -383, -543, -436, 582,
-    1398, 1318, 853, 711, 740, 447, 692, 1361, 1478, 1514, 1621, 1630,
-    1150, 1113, 1475, 1746, 1782, 1557, 1827, 2023, 1656, 1628, 1451, 816,
-    702, 991, 1345, 897, 879, 1115, 934, 727, 1039, 1431, 1317, 1067,
-    1073, 1046, 1025, 1044, 678, 674, 617, 299, 308, 149, -194, -246,
-    -197, -238, -395, -515, -592, -435, -306, -46, -38, -476, -795, -751,
-    -640, -973, -1074, -920, -762, -864, -1585, -1957, -2251, -2478, -2379, -2099,
-    -2283, -2491, -1911, -1295, -1611, -2378, -2445, -1967, -1713, -1620, -1544, -1358,
-    -1647, -1433, -1054, -934, -1046, -1132, -1145, -710, -205, -120, -451, -272,
-    -112, -211, -379, -84, 518, 705, 539, 555, 1183, 1452, 1394, 1261,
-    1467, 1712, 1201, 929, 1281, 1549, 2005, 1848, 1215, 621, 702, 1452,
-    2046, 2068, 1798, 1436, 1371, 1692, 1702, 1745, 1671, 1617, 1702, 1374,
-    1220, 1253, 1255, 1444, 1223, 1179, 1372, 1470, 1188, 684, 479, 419,
-    555, 732, 612, 295, 498, 564, 136, -373, -570, -765, -930, -431,
-    -318, -774, -920, -942, -927, -669, -141, 174, 115, -532, -908, -105,
-    257, 271, -112, -571, -967, -911, -698, -986, -1198, -1253, -1467, -1565,
-    -1537, -1434, -1694, -1657, -1024, -474, -843, -1331, -1197, -932, -1253, -1473,
-    -1518, -1079, -565, -381, -468, -493, -105, 65, -374, -293, 288, 20,
-    -571, -682, -507, -477, -322, -432, -875, -759, -207, 192, 159, -120,
-    -529, -779, -219, 258, 315, 188, 210, 268, 56, 96, 315, 428,
-    312, 429, 480, 448, 511, 616, 772, 841, 615, 412, 30, -138,
-    -170, -103, 348, 808, 700, 363, 66, 531, 1117, 1088, 466, 525,
-    848, 697, 727, 1197, 1320, 1254, 698, 498, 658, 787, 963, 1271,
-    1479, 1139, 725, 602, 613, 784, 955, 931, 722, 518, 311, -137,
-    401, 1027, 1276, 718, 344, 587, 398, 15, -263, -514, -640, -269,
-    -362, -501, -262, -73, -66, 66, -221, -309, -601, -1060, -641, -261,
-    38, 70, -247, -600, -751, -443, -155, -720, -767, -772, -915, -935,
-    -1175, -1457, -1603, -1450, -1234, -951, -745, -594, -639, -327, -338, -534,
-    -980, -968, -454, 11, 154, 228, -190, -729, -694, -881, -702, -336,
-    20, 81, 81, 332, 677, 624, 835, 1162, 1278, 1132, 1084, 1418,
-    1540, 1349, 1303, 1227, 1284, 863, 47, -459, -301, -86, 8, 4,
-    -136, -70, 41, 4, 107, 443, 303, 54, 142, -13, -3, 394,
-    278, 258, 49, -179, -114, 89, -93, -664, -1007, -1158, -1025, -578,
-    -435, -482, -728, -697, -666, -1034, -1300, -1322, -678, 124, 518, 131,
-    -303, -83, -47, -66, 307, 375, 289, 297, -96, -5, 222, 179,
-    20, -66, -108, -28, 469, 993, 1045, 630, 382, 798, 1097, 943,
-    526, 374, 690, 574, 220, 219, 62, 13, 83, 188, 276, 583,
-    466, -27, -115, 256, 535, 447, -63, -417, -364, -140, -69, -226,
-    -256, -284, -196, 18, 304, 154, 241, 449, 543, 327, 351, 410,
-    388, 297, 706, 1185, 725, -73, -83, 17, -230, -429, -2, 265,
-    -229, -743, -1002, -1003, -956, -1235, -1173, -677, -392, -282, -404, -469,
-    -366, -127, -97, -341, -341, 94, 374, 428, 446, 511, 209, 323,
-    473, 223, 204, 435, 894, 879, 743, 488, 66, -211, -155, 332,
-    622, 520, 444, 304, -136, -340, -423, -660, -814, -869, -886, -757,
-    -529, -404, -315, -300, -368, -383, -216, -12, 155, 254, 374, 304,
-    -27, 101, 372, 175, -281, -425, 50, 374, 160, -91, -170, -376,
-    -414, -269, -358, -706, -767, -701, -644, -605, -446, -230, 13, 163,
-    36, 50, 221, 357, 31, -425, -364, -232, -297, -346, -281, 107,
-    395, 236, -39, -391, -507, -160, 497, 864, 958, 925, 940, 1059,
-    1027, 875, 714, 523, 495, 578, 470, 376, 278, 258, 318, 372,
-    510, 355, -230, -447, -254, -185, -212, -7, 244, 199, 183, 355,
-    604, 669, 583, 704, 719, 276, -71, -46, 233, 563, 570, 300,
-    -105, -417, -194, -4, -212, -411, 9, 458, 374, 204, 258, 103,
-    39, -101, -42, -88, 21, 329, 334, 237, 89, -60, -69, -17,
-    -43, 44, 191, 146, -120, -168, -89, -88, 20, 138, -193, -606,
-    -608, -515, -651, -676, -745, -769, -731, -697, -621, -546, -417, -611,
-    -714, -558, -405, -360, -415, -548, -742, -677, -741, -609, -509, -726,
-    -776, -662, -640, -583, -274, -224, -638, -838, -784, -679, -462, -640,
-    -793, -596, -389, -180, -185, -119, -224, -490, -679, -749, -518, -260,
-    -424, -406, 142, 355, -66, -473, -684, -543, -90, 520, 521, 256,
-    289, 484, 762, 829, 872, 1072, 1094, 1283, 1197, 1145, 1377, 1311,
-    1235, 1471, 1546, 1325, 873, 818, 1088, 1273, 1082, 827, 627, 453,
-    532, 942, 947, 605, 200, 61, 296, 595, 793, 668, 312, 197,
-    391, 365, 209, 46, -3, -54, 94, 373, 336, -75, -324, -85,
-    2, -203, -266, -53, 136, -295, -939, -855, -687, -820, -838, -438,
-    -91, -154, -281, -456, -429, -269, -379, -543, -680, -487, -135, -178,
-    -619, -758, -661, -495, -415, -346, -424, -579, -382, -19, 177, 200,
-    -23, -239, -113, 63, 316, 344, 316, 301, 470, 574, 283, -57,
-    -163, -275, -237, -2, 354, 364, 58, -150, -117, 11, 10, -87,
-    -86, 182, 505, 305, 208, 358, 423, 147, -77, -37, -3, 255,
-    359, 341, 468, 258, -30, 117, 385, 203, -44, -3, -1, -28,
-    149, 267, 284, 415, 537, 160, -238, -254, -216, -397, -609, -758,
-    -777, -602, -388, -582, -712, -735, -769, -838, -869, -648, -489, -183,
-    1, -171, -229, -35, 72, -201, -503, -624, -137, 396, 389, -30,
-    -282, -231, -4, 74, -74, -229, -423, -462, -186, 266, 391, 294,
-    290, 323, 330, 333, 553, 792, 624, 423, 459, 650, 525, 344,
-    249, 566, 1117, 1118, 709, 393, 355, 558, 799, 868, 698, 829,
-    1060, 863, 573, 495, 416, 345, 200, 359, 405, 338, 189, -254,
-    -398, -143, 33, -211, -642, -553, -232, -339, -230, -180, -318, -302,
-    -280, -314, -594, -696, -676, -691, -681, -696, -533, -369, -669, -925,
-    -864, -762, -455, -99, -378, -884, -1080, -906, -709, -539, -725, -1044,
-    -1199, -1000, -645, -331, -159, -286, -592, -1040, -1031, -826, -816, -805,
-    -707, -491, -305, -424, -505, -461, -452, -422, -279, -96, -99, -277,
-    54, 262, 283, 472, 177, -5, 262, 705, 780, 582, 625, 574,
-    462, 675, 950, 970, 861, 692, 771, 912, 1000, 893, 559, 316,
-    454, 416, 194, 37, 221, 500, 580, 515, 538, 629, 578, 314,
-    232, 304, 126, -27, -91, 117, 248, -32, -427, -658, -454, -206,
-    -223, -325, -302, -204, 16, 226, 261, 257, 463, 459, 174, -15,
-    63, 68, 11, 288, 227, -203, -214, 159, 398, 73, -539, -551,
-    -383, -321, -704, -955, -759, -490, -512, -608, -516, -310, -254, -339,
-    -531, -770, -815, -770, -480, -126, -94, -248, -79, 117, -29, -136,
-    -8, 201, 333, 162, -58, 145, 517, 615, 653, 679, 785, 793,
-    703, 601, 404, 258, 274, 506, 608, 680, 508, 90, 193, 451,
-    546, 474, 300, 286, 345, 296, 268, 392, 351, 187, 128, 151,
-    97, 210, 454, 647, 732, 521, 411, 344, 418, 438, 327, -93,
-    -299, -269, -333, -399, -311, -287, -275, -331, -414, -435, -489, -500,
-    -407, -492, -545, -610, -700, -720, -600, -577, -623, -674, -646, -633,
-    -495, -450, -398, -409, -480, -583, -796, -952, -774, -391, -341, -581,
-    -725, -487, -200, -50, -149, 27, 162, 178, 32, -147, -222, -160,
-    -66, 153, 358, 273, -69, -161, 271, 464, 344, 250, 119, 0,
-    58, 399, 385, -34, -199, 48, 334, 487, 414, 212, 243, 257,
-    247, 360, 581, 692, 844, 880, 750, 555, 486, 431, 411, 622,
-    912, 674, 277, 17, -72, 96, 240, 168, 101, 68, 21, -134,
-    -159, -143, -68, 69, 107, 143, 315, 150, 27, -103, -343, -559,
-    -502, -510, -656, -650, -596, -675, -820, -636, -228, 88, 58, -256,
-    -387, -325, -177, -202, -280, -187, -46, 174, 146, -78, -114, -169,
-    -142, -39, 130, -69, -256, -40, 77, 193, 372, 413, 408, 258,
-    45, -184, -99, 177, 198, 178, 192, 117, 193, 242, 271, 223,
-    268, 409, 218, 54, 167, 473, 511, 408, 220, 51, 57, 83,
-    9, 45, 121, 76, 149, 283, 416, 321, 111, 158, 131, 40,
-    68, 156, 89, 125, 412, 414, 28, -275, -211, -22, 55, -40,
-    -173, -257, -265, -388, -397, -419, -583, -696, -668, -573, -509, -753,
-    -949, -648, -376, -329, -427, -683, -801, -686, -235, -133, -489, -815,
-    -812, -607, -424, -399, -272, -302, -238, -354, -394, -235, -4, 26,
-    32, 158, 240, 376, 470, 199, 47, -2, -50, 38, 10, 257,
-    534, 646, 408, 178, 247, 382, 453, 224, 125, 211, 241, 283,
-    388, 494, 601, 532, 473, 472, 645, 672, 343, 311, 550, 788,
-    860, 794, 612, 457, 629, 770, 779, 781, 938, 954, 583, 330,
-    358, 455, 516, 622, 501, 306, 156, 241, 163, -26, -113, -63,
-    -70, -23, -28, -219, -81, 115, -172, -609, -684, -455, -213, 17,
-    -183, -499, -484, -112, 23, -114, -121, 18, 1, -321, -475, -421,
-    -220, -98, -161, -263, -273, -255, -322, -415, -553, -735, -785, -639,
-    -725, -822, -809, -836, -871, -818, -772, -892, -815, -794, -879, -840,
-    -596, -441, -401, -265, -127, -107, -203, -276, -341, -287, -88, 172,
-    177, 179, 171, 163, 302, 399, 366, 136, 128, 179, 46, -55,
-    -64, -74, -151, 73, 331, 419, 495, 298, 135, 84, 36, 48,
-    119, 267, 334, 274, 352, 600, 621, 588, 668, 691, 702, 780,
-    690, 619, 634, 791, 970, 883, 788, 614, 399, 400, 603, 594,
-    353, 373, 409, 195, 53, 89, 95, 123, 155, 121, 72, 93,
-    45, 125, 187, 62, -18, -92, 19, 92, -136, -133, 79, 44,
-    -128, -150, -74, 13, 73, 0, 14, 33, 6, -4, -125, -207,
-    -101, 52, 28, -132, -402, -475, -393, -245, -196, -440, -741, -803,
-    -484, -252, -526, -817, -677, -372, -175, -164, -232, -76, 120, 32,
-    -235, -383, -252, -333, -400, -379, -260, -187, -32, -52, -195, -266,
-    -236, -191, -117, -167, -57, -10, -95, -113, -36, 86, 30, -310,
-    -452, -347, -233, -130, -122, -394, -499, -409, -318, -246, -182, -314,
-    -280, -70, 25, 75, 61, 92, 238, 198, 148, 144, 223, 386,
-    379, 288, 149, 160, 353, 342, 218, 203, 181, 137, 91, 25,
-    189, 455, 421, 56, -118, 49, 93, 168, 286, 165, -48, 58,
-    117, 44, 119, 203, 148, 83, 195, 307, 112, -114, -334, -330,
-    -97, 8, -107, -59, 22, -62, -214, -190, -204, -100, 75, 50,
-    -217, -438, -393, -223, 21, 115, -46, -288, -374, -300, -95, 110,
-    198, 388, 537, 634, 734, 732, 586, 500, 400, 390, 410, 384,
-    492, 559, 536, 539, 601, 495, 250, 192, 175, 33, -86, -107,
-    -17, -31, 61, 133, 13, -7, 143, 176, 247, 481, 672, 541,
-    256, 90, -21, 4, 65, 36, 24, -38, -124, -157, -202, -319,
-    -456, -523, -382, -99, 130, 50, -42, -124, -109, -43, -235, -373,
-    -257, -159, -71, -220, -204, -214, -249, -185, -215, -184, -143, -279,
-    -521, -458, -435, -426, -334, -200, -74, 39, 142, 25, -98, -44,
-    166, 231, 14, -112, -64, 11, -38, -61, -99, 86, 184, -15,
-    -75, 28, 192, 198, -20, -262, -280, -270, -381, -237, -182, -206,
-    -304, -292, -119, -59, -19, -34, 88, 90, -33, -257, -259, -276,
-    -212, -253, -397, -642, -735, -729, -536, -375, -228, -416, -597, -495,
-    -338, -291, -34, 75, 28, -73, -97, -67, -6, 151, 345, 168,
-    4, 12, -74, -146, -91, 119, 266, 369, 256, 24, -143, 186,
-    405, 632, 572, 480, 514, 596, 567, 930, 1154, 743, 776, 886,
-    736, 536, 730, 848, 457, 481, 936, 943, 557, 221, 556, 1586,
-    911, 324, 238, 838, 461, 235, 183, 623, 533, 458, 595, 291,
-    43, 123, 300, 578, 110, -1009, -192, 148, -175, -324, 126, -661,
-    -1183, -1024, 292, 1217, 2453, 1669, -216, 3945, 6438, -1766, -7180, -4308,
-    -2653, 2644, -4527, -9750, -3905, -2244, -5483, -6975, -2917, -1649, -10290, -5317,
-    -3036, 2053, 6828, 5481, 1809, 7474, 12009, 5584, -1918, 6874, 11119, 11964,
-    11091, 6712, 2865, -284, -1407, -2881, -11184, -9184, -6233, -33, -9900, -15518,
-    -15848, -15293, -12586, -9812, -3249, 1730, 1131, -4037, 5742, 13085, 14545, 4801,
-    -3205, 372, 10523, 12769, 8510, 6388, 7602, 649, -3919, -2490, 3986, -6526,
-    -9743, -12060, -10820, -6287, 1273, -9776, -9697, -2408, -6352, -2326, 760, 2066,
-    -6370, -4177, 2827, 6646, -1441, -3321, 2434, 10337, 13599, 9304, 5572, 4340,
-    -2823, 3345, 9661, 2162, 2416, 8446, 11006, 11496, 11064, 9899, 9603, 4630,
-    4192, -310, 6106, 3743, 1843, 2633, -1407, -3911, -7638, -3783, -3815, -9874,
-    -8124, -6132, -10058, -7171, -3758, -8980, -7047, -7793, -11282, -5801, -4083, -9544,
-    -9612, -3708, -1780, 1370, -6412, 637, 1268, 435, 3132, -3111, -3321, -2001,
-    250, -407, -1316, -2556, 686, -202, 932, 2010, 6729, 8750, 3788, 5786,
-    8961, 7520, 6764, 9124, 8811, 10671, 8917, 3638, 6593, 7347, 2884, 11163,
-    9288, 9651, 6445, 2577, 6097, 1392, -4493, -5536, 171, 2657, -447, -1635,
-    -3537, -2029, 1728, 1853, 1944, -3575, -316, 1679, -3347, -4634, -3199, -7903,
-    -5244, -5219, -10123, -11431, -3482, -8825, -14183, -10523, -10711, -6208, -10518, -11086,
-    -6359, -13168, -10096, -6014, -5737, -9652, -3541, -5717, -6028, -7913, -5292, -2883,
-    -4301, 4508, 5254, -3825, -6744, -3621, -1489, 3967, 1431, 691, -895, -3999,
-    4303, 6622, 5062, 7504, 4112, 8346, 9145, 1072, 8790, 5972, 5527, 8444,
-    8469, 10540, 12803, 6259, 6661, 5877, 395, 8074, 11557, 5669, 2610, 7216,
-    7296, 3831, 3319, 6810, 3477, 1706, 365, -1950, 7766, 7786, -470, 4562,
-    7562, 3565, -1324, 720, 1402, 2717, 2621, -617, 21, -3703, 1391, 212,
-    4607, -58, -4777, -8781, -6708, -7221, -4189, -7323, -6993, -2595, -5264, -2921,
-    -1757, 90, 345, -4606, -3085, -355, -1559, -5070, -4965, -2403, 1970, 4115,
-    3130, 3894, -1463, -7195, -5345, -5231, -5282, 523, -1870, -667, -1251, 1297,
-    -3275, 4333, 1629, -3596, -2326, 1786, 6548, 6917, 3925, 1665, -698, 2199,
-    4490, 1819, 7592, 8621, 1289, 3620, 5248, 4340, 1622, -773, 1379, 600,
-    2253, 4203, 1138, -6473, -1213, -5241, -5829, -1694, 3851, -229, 553, -521,
-    -3075, 2389, 318, -2549, 1887, -5254, -8434, -2910, 996, -4123, -4927, -7612,
-    -10361, -8039, -8645, -35, -6430, -10173, -5405, -7397, -7130, -905, -6033, -9280,
-    -5450, -4711, -8301, -498, -7073, -3115, -3903, -3898, 2134, -2485, -1405, 1547,
-    -703, 4965, 1695, -4909, -5065, -4062, 3609, 2616, -1044, 2524, 2745, -3193,
-    6105, 9627, 4013, 2718, 5530, 6746, 10281, 3188, 6438, 5070, 10322, 9615,
-    6788, 8535, 1176, 5260, 7975, 7291, -927, 3154, 2840, 1954, 7682, 5917,
-    4628, -124, 2000, 5160, 2692, 1678, -58, -3823, -2087, 3440, 5007, 1499,
-    4378, 761, 4551, 5124, -2323, 1324, 2649, -549, -5444, -5208, -2930, -2032,
-    -2089, -9136, -8133, -5085, -7157, -573, -4881, -7280, -4425, -4547, -4902, -12,
-    -4043, -4493, -3727, -888, -1527, -3405, -4408, -3424, -969, 1506, 4360, -649,
-    1915, 634, 3036, 7300, 4241, 37, -226, 3116, 80, -2431, -1486, -1562,
-    -184, 4638, 2180, -1552, -1065, 492, 5842, 8245, 4602, 4225, 4617, 4345,
-    6641, 4611, 2431, 4141, 9545, 7595, 3476, -545, 2206, 1298, 5540, 5687,
-    1306, -405, 998, 578, 3881, 2706, -419, -970, 66, -704, -1745, -2476,
-    -6269, -4944, 551, 4536, 4228, -4108, -7328, -6351, -61, 2329, -4148, -3789,
-    -1507, -4150, -6572, -1020, -1336, -3561, -3401, -4425, -9540, -8088, -7634, -8670,
-    -4070, -709, -5893, -9723, -9533, -3949, -1884, -4968, -2552, -4657, -2470, -5053,
-    -2602, 2536, -4510, -3212, 4442, 3140, 96, -3013, -1537, 1963, 6921, 3402,
-    -204, -1706, -965, 708, 2920, 6860, 4440, 793, -1102, 50, 2377, 5191,
-    1505, 3038, 8092, 7619, 2283, 6706, 7348, 4588, 3953, 4410, 5276, 7591,
-    5604, 2519, 417, 4566, 8691, 3251, 3675, 1998, 626, 774, 1276, 3869,
-    -914, 1562, -2969, -332, 2736, -495, -1529, -3551, -4878, -6301, -2949, -950,
-    -2347, -3553, -32, 1960, 884, -4645, -2440, -1879, 82, -4892, -3408, -3608,
-    -3890, -3669, -5459, -3645, -4127, -4090, -3122, -6603, -7959, -4309, -3712, -4292,
-    -6546, -4813, -3789, -6459, -6691, -1970, -314, -3236, -3623, -2066, -899, -384,
-    -577, 1617, -596, 396, 2357, 5211, 5085, 7655, 6905, 937, 5479, 3553,
-    993, 3612, 1465, 862, 4952, 6450, 1626, 1129, 3589, 6610, 5860, 5265,
-    3378, 6432, 5586, 3903, 3515, 5156, 2948, 5623, 6420, 5735, 4300, 1316,
-    2889, 615, 1399, 675, 3217, 2561, 3224, -267, -3969, -2088, 2349, -508,
-    -1952, -532, -2263, 1680, 168, -1406, -1074, -5865, -3634, 237, -1837, -2160,
-    -2782, -1443, -655, 566, -2703, -4900, -6878, -766, -949, -3860, -6315, -857,
-    -3639, -7406, -4822, -2370, -3855, -2357, -3669, -5909, -4228, -4785, -2535, -207,
-    -1185, -4494, -2833, -1968, -1947, -3165, -3015, -2101, -2005, -2217, 389, 4587,
-    1412, 166, 1870, -1093, 4186, 5064, 4238, 4658, 3425, 3104, 3832, 4057,
-    906, 1001, 1983, 3621, 4412, -527, 3172, 4951, 7346, 1756, -608, -475,
-    2481, 3989, 1059, 805, 3173, 2714, 2237, 4428, 6389, 4468, -1439, 704,
-    5512, 4238, 1380, -2807, -1090, 3558, 2664, -1577, 663, -965, -686, -3854,
-    -1043, 439, -2699, -1925, -6302, -6354, -5378, -969, -5709, -5509, -3044, -3380,
-    -5070, -793, 2461, 408, -3653, -1576, -1854, -2821, -1640, 60, -2953, -2085,
-    -1396, -4506, -2493, -5001, -6430, -1308, -1786, -4194, -6025, -3628, -4174, -5270,
-    -3463, -244, -4374, -4433, -3277, 529, 187, -1896, 2010, 2116, -1829, -453,
-    1399, 1743, 2620, 2754, 3662, 3654, 2049, 357, 6337, 6823, 10691, 8368,
-    1050, -1839, 76, 1063, 757, -37, 2464, 4275, 1943, 947, 3742, 5641,
-    4398, 2473, 3277, 3266, 2465, 2590, 1003, 1272, 4183, 3718, 2319, 4051,
-    2669, 1093, 3609, 1194, 112, 1854, 2412, 633, 1932, 1352, -3194, -657,
-    398, -4897, -2769, -1804, 663, -1087, -3744, -1432, -1965, -5256, -1995, -1779,
-    -7318, -6225, -303, 1497, -4625, -1324, 2251, -341, -922, 855, -744, 402,
-    -1620, -1398, 2242, -1589, -5230, -1058, -1251, -776, -1519, -3995, -2245, -3086,
-    -1458, 525, -2142, -5649, -3747, -1852, -1751, -196, -1894, -3317, -3218, -734,
-    1833, 2775, -1551, -329, 3786, 1687, 2143, 2032, 1987, -248, 4288, 4755,
-    3068, 865, 3121, 5438, 9867, 5965, 618, 163, 1912, 1150, 522, 1661,
-    155, 1796, 4043, 2259, 2443, 1430, 2315, 3037, 5168, 4374, 92, 2101,
-    1803, 1364, 4971, 5647, 2542, 2779, 2818, -362, 2755, 3073, -435, 924,
-    4012, 1559, -1404, 418, -1891, 948, 415, -2799, -3321, -639, 429, -1247,
-    3, -1834, -4314, -1253, 328, -3815, -5166, -4782, -5436, -2195, 1765, 491,
-    -2740, -5057, -2459, -278, -937, 631, -1986, -3632, -2122, -2189, -1676, -108,
-    -2027, 86, -1665, -3138, -4720, -2228, -4312, -3805, -1882, -1714, -588, -2649,
-    -3521, -3471, -2351, -3540, -1280, 2632, 2095, -1345, -1505, 893, 1000, 3558,
-    1081, -1081, 1480, 4559, 1062, -2145, 1109, 5203, 3495, 2006, 194, 4265,
-    4980, 2919, 2732, 26, -588, 1860, 325, -71, 166, 685, -413, -566,
-    1315, 1849, 3841, 1998, 1100, 1702, 3330, 4185, 4784, 1738, 944, 763,
-    2726, 3779, 4072, 3266, 1003, -701, 1324, 1658, -1590, -2769, 100, 622,
-    818, -2924, -3288, -855, -2403, -5810, -7784, -5257, -2631, -1090, -3941, -5276,
-    -5396, -5871, -5778, -5197, -5367, -5674, -5561, -6035, -1971, 1742, -1078, -2389,
-    -3451, -1928, -1370, -885, -1854, -3380, 133, 96, -1369, -1576, -2097, -621,
-    -3017, 1173, 752, 483, -764, -721, -3381, -2142, -1876, -2927, -1050, 1781,
-    274, 657, 544, 681, 2677, 1791, 875, 1505, 2683, 4973, 3468, 5,
-    1119, 3291, 3831, 4842, 1569, 497, 2369, 1641, 2847, 4077, 4754, 5644,
-    3055, 2744, 4515, 2350, 746, -276, -207, 1527, 2151, 1082, -1476, -1267,
-    920, 1876, 2124, 247, 1994, 1027, -169, -1476, -38, -977, 1382, 2077,
-    1920, 1633, -1170, -1051, 897, -414, 107, 223, -125, -1434, -1391, -2277,
-    -128, -1022, 653, 944, -1061, -4448, -2083, 32, -3110, -4932, -2806, -728,
-    273, -1663, -3883, -2689, -3722, -3544, -2791, -3890, -3718, -556, 2306, -2118,
-    -2486, -1460, -445, -1334, -1487, -1480, -803, 486, -132, 1853, 2221, -781,
-    302, 1989, -441, -246, -980, -3491, -240, 2254, 1449, 1972, 90, 1016,
-    -1286, -783, 2375, 1778, 287, 3075, 1862, 472, 124, 1930, 4041, 1408,
-    243, 766, 4413, 4988, 3508, 4960, 3878, 1983, 1429, 1978, 3771, 2783,
-    5225, 3932, 4753, 4907, 3287, 2939, 1212, 2243, -146, -70, 2408, 1447,
-    -704, 494, 1499, 2319, 435, -1042, -251, 1633, 215, 88, 841, 1819,
-    1177, 1570, 844, -46, 698, 983, 1350, 945, 995, 1067, 1418, -264,
-    -1046, -1193, -1439, -2319, -2403, -2163, -1331, -1632, -982, 937, 913, 344,
-    -590, -576, -272, -1355, -5000, -2800, -1236, -480, -789, -2310, -2485, -3816,
-    -4482, -3956, -2764, -1374, -860, 662, 1059, 104, 407, -1059, -2808, -2404,
-    -342, -564, -244, 1511, 808, -1022, -1362, -1270, -1990, -2802, -1464, -1281,
-    514, 944, -61, -2178, -2020, 215, 424, -689, -933, 1511, 3004, 3677,
-    1751, 1235, 722, 4398, 5334, 1881, 881, 3496, 4944, 2908, 1640, 3373,
-    3536, 3866, 1981, 3004, 4318, 3436, 3322, 3322, 1968, 2738, 2690, 89,
-    -792, 1002, 55, -2229, -687, 601, 1550, 2846, 1875, 1949, 751, 1580,
-    2872, -241, -2551, 346, 1386, 1943, 1775, 5, -117, -388, -909, -2571,
-    -1146, -634, -330, -562, -2017, -2033, -2731, -4841, -3346, -1835, -3889, -3115,
-    -2843, -3030, -1429, -756, -1477, -2335, -5013, -6149, -3013, -2742, -3693, -2595,
-    -1112, -2550, -4144, -2814, -2531, -5879, -4268, -1429, -3813, -1951, -498, -501,
-    -590, -1621, -1286, -2259, -1158, 656, -1544, -2102, -744, 328, -632, -1042,
-    -763, -1776, -702, 1911, 143, -1349, -1319, -651, -850, -596, 661, 1664,
-    666, -2602, -168, 2754, 2943, 222, -273, 3064, 2561, -509, 309, 2045,
-    2391, 2885, 3071, 2266, 1655, 3160, 3110, 2899, 2209, 3180, 3907, 4076,
-    3269, 3358, 2127, 1560, 3331, 3990, 3975, 2533, -185, -1352, -536, -248,
-    348, -377, 120, -32, -2592, -2689, -1819, -69, 214, -1271, -2345, -190,
-    299, -2400, -2858, -2431, -2094, -1161, -1063, -429, -498, -2426, -3489, -1706,
-    -1170, -1980, -2317, -2650, -1989, -384, -1909, -2375, -1504, -363, -2187, -5230,
-    -2458, -943, -2937, -3784, -5024, -3991, -1835, -3189, -4348, -3618, -3373, -2637,
-    -1684, -1215, -1425, -2281, -2015, -3697, -3634, -760, 2246, 1332, 457, 702,
-    -60, -144, 2267, 3661, 1330, -1118, -288, 1269, 3129, 416, -444, 1470,
-    1625, 1174, 538, 572, -1134, -611, 1496, 1863, 502, -753, -584, 44,
-    1981, 1237, -580, -1327, 771, -380, 133, 2540, 902, 216, 1730, 2407,
-    1914, 2563, 2443, 1733, 1971, 3818, 4090, 3522, 2483, 3145, 3432, 3169,
-    2725, 1691, 2744, 1938, 1014, 1067, 1384, 2283, 2041, 277, -2598, -2333,
-    -678, 2024, 1594, 733, 343, 800, 166, 424, 2370, 1461, 1299, 3028,
-    3027, 553, 95, 1495, 223, 1736, 1632, -1586, 150, 2299, 1045, -1288,
-    -2834, -600, 651, -409, -178, -821, -1515, -1881, -1703, 398, 513, -2067,
-    -3231, -3817, -3797, -1161, 1062, -288, -2516, -1194, 93, -2380, -1417, 1435,
-    686, -1126, 204, -373, -1151, -2488, -4698, -2847, -572, 274, -1092, -362,
-    -1229, -2058, -1263, 285, -1157, -1756, -474, -813, -2045, -999, 2218, 1552,
-    -1611, -1703, 392, 364, 950, 232, 218, 613, 845, -893, -656, 1322,
-    2491, 2855, 2189, -828, -1821, 1463, 1774, -339, -114, 2256, 3816, 2212,
-    1002, 3172, 2534, 2866, 4696, 2759, 2130, 3004, 2507, 699, 2393, 3819,
-    4254, 3476, 2415, 1899, 2901, 2981, 2517, 4483, 4552, 4179, 2734, 2911,
-    1871, 1561, -463, -1396, -917, -1333, -168, 2091, 1435, -675, -2713, -804,
-    1787, 1203, -1158, -1330, -338, -594, -1235, 1574, 1505, -679, 668, 1009,
-    -1177, -1193, 1192, -542, -1691, -1304, -3534, -3675, -3128, -3694, -3151, -3812,
-    -3082, -4228, -5310, -4471, -3148, -4660, -5524, -4279, -2532, -2787, -3727, -2344,
-    -2654, -2593, -1046, -678, -1901, -1690, -1956, -1952, -1322, -1454, -1382, -656,
-    1348, 2992, 2436, 2430, 958, 956, 2644, 3160, 2727, 2955, 2857, 2438,
-    1371, 1775, 2197, 2117, 3620, 2935, 2207, 2344, 2181, 2419, 2315, 2151,
-    964, 256, 639, 1116, 1484, 2092, 1907, 1496, 1144, 943, 1303, 3205,
-    3753, 1470, 1167, 1604, 1759, 1969, 1633, 2056, 1969, 666, -754, 856,
-    2732, 1994, 1313, 200, -1768, -592, -1059, -2346, -1301, 559, 1123, 887,
-    247, -71, 850, -21, -2546, -4039, -2943, 805, 1299, -1940, -2038, -332,
-    -1417, -330, 922, -265, -697, 1194, 7, -1262, -611, 484, 62, 176,
-    73, 113, 143, -813, -89, 1034, -821, -1306, -1263, -1866, -2231, -1334,
-    -1310, -1565, 52, 322, -123, -323, -1473, -1130, 237, 1285, 344, -1262,
-    -3195, -3909, -2830, -3221, -1957, -1502, -2384, -1586, -2035, -1166, -1425, -3576,
-    -3405, -2972, -2193, -2530, -2898, -3333, -3398, -1830, 29, 845, -1183, -1629,
-    56, 695, -46, -43, -702, -532, 8, -411, -1590, -1062, -950, -826,
-    -1579, -418, 1212, 431, -1581, -2154, -1158, -467, -40, 734, -97, 420,
-    870, 477, 2290, 2194, 801, 2027, 4673, 4791, 2314, 1439, 2106, 3194,
-    3799, 2472, 1791, 2199, 2190, 3188, 4839, 2780, 820, 1974, 2288, 1531,
-    1573, 2215, 2151, 3273, 4063, 2333, 2291, 2326, 1091, 748, 2691, 1364,
-    124, 878, 17, 544, 1516, 999, 48, -1509, -1991, 349, -715, -1947,
-    -1576, -103, -463, -1904, -2572, -2484, -1758, -1140, -1053, -844, -1453, -1794,
-    -1645, -2882, -4153, -2783, -1569, -1190, -1435, -2528, -3257, -2138, -1586, -3781,
-    -3457, -3717, -2657, -1113, -451, -930, -1249, -1853, -2187, -1294, -733, -384,
-    -217, -372, -2101, -3464, -3300, -719, 1177, 519, -1323, -983, -1327, -1188,
-    617, 491, -652, -395, 659, 895, 1834, 1212, 461, 1775, 3596, 2156,
-    1140, 975, 247, -268, 775, 2391, 1687, 1018, 664, 217, 9, 97,
-    975, 2478, 2035, 632, 884, 789, -717, 280, 2907, 3395, 597, -853,
-    969, 1183, -954, -107, 1480, 1021, 2020, 918, 1175, 1888, 1773, 2085,
-    1518, 81, 560, 1668, 2336, 2491, 2373, 2753, 2315, 761, 821, 2619,
-    1357, -620, 693, 1812, 2394, 2628, 1771, 1136, 1355, 823, -873, -942,
-    -318, 80, 575, 119, -1107, -1404, -946, -1728, -2858, -1564, 1019, 1054,
-    -696, -1921, -1479, 447, 873, -114, -1618, -911, 670, 588, -1274, -2860,
-    -2198, -942, -306, -1769, -3133, -1706, -791, -791, -1651, -2503, -1867, -1448,
-    -3072, -2587, -1463, -1046, -1708, -2470, -2025, -1358, -1107, -1973, -1868, -482,
-    -615, -1601, -868, -804, -1403, -1971, -1231, 1197, 1721, 1097, -149, -577,
-    1, 93, 118, -525, -1183, 794, 1297, -809, -1001, 272, 928, 671,
-    -621, -1445, -639, 278, -529, -908, -71, 210, 974, 891, -681, 1022,
-    2387, 1703, -945, -1714, 234, 1229, 945, -564, -925, 331, 676, 1104,
-    2053, 1033, 204, -503, 148, 2619, 2943, 2005, 1034, 1053, 1901, 2633,
-    2915, 1097, 327, 1338, 1396, 1752, 2639, 1509, -192, 442, 2219, 1956,
-    2282, 3192, 2283, 1963, 4229, 4174, 2225, 1813, 2555, 4142, 5299, 2337,
-    -837, 518, 829, -2299, -3255, -1624, -861, -2792, -3873, -3223, -2761, -3569,
-    -2733, -1410, -2102, -2832, -2988, -2780, -2231, -458, -214, -530, -275, 316,
-    -337, -24, -301, 528, 2123, 1107, -302, -1082, -1971, -1830, -1499, -1374,
-    -2771, -4077, -2999, -2760, -3397, -3752, -4996, -3929, -1158, -1137, -3381, -3433,
-    -2385, -1455, -1541, -2756, -2995, -1323, -153, 561, 317, 529, 969, 14,
-    -957, -695, -178, 192, -757, -2271, -1367, 391, 966, 73, 319, 365,
-    -217, -878, 633, 2501, 2868, 3514, 3942, 3147, 2825, 2966, 2337, 2240,
-    2563, 3065, 3521, 1720, 641, 2052, 2370, 1706, 816, 782, 2407, 4349,
-    3566, 921, 172, 1388, 1677, 1674, 1423, 1832, 1983, 1650, 1354, 2139,
-    1638, -67, -1596, -1846, -1914, -604, 81, -1295, -510, -109, -1075, 532,
-    2136, 764, -677, 460, 1080, 1751, 1712, 66, -414, 1833, 2098, 718,
-    -954, -1240, 374, -333, -2090, -1676, -1994, -2317, -2665, -2827, -1758, -1606,
-    -2271, -1989, -2730, -3381, -2232, -1424, -1485, -1774, -2194, -1771, -1826, -1517,
-    -682, 92, -938, -1646, -726, 214, -278, -1279, -1834, -1504, -245, -769,
-    -1518, -1361, 445, 750, -1648, -3912, -2280, -1708, -2465, -3478, -3144, -1193,
-    -316, -1224, -1544, -1087, 372, 1939, 1234, -321, -589, 764, 536, -325,
-    783, 803, 772, 1389, 1800, 1580, 11, -2263, -1217, 1694, 1150, -1820,
-    -1001, 2235, 2561, 2197, 1708, 883, 1440, 995, 1383, 2629, 2386, 1381,
-    762, 1067, 1585, 1576, 1233, 817, 946, 1903, 1316, 1350, 2371, 3168,
-    2556, -151, 725, 3833, 3355, 2888, 1743, 203, 29, 1198, 1824, 1573,
-    533, 1908, 3092, 1758, 396, 699, 1486, 825, -125, 35, 1910, 1357,
-    342, 1099, 1598, 375, -672, -437, -462, -962, -485, 470, 1055, 222,
-    -590, -563, -1698, -2562, -2072, -1464, -893, -1049, -572, 445, -1396, -4150,
-    -2163, -536, -2478, -2835, -1944, -2830, -3411, -2914, -2773, -2477, -2114, -1263,
-    -649, 45, 795, 1141, 364, -1454, -1769, -1125, -1253, -1121, -470, 373,
-    421, 130, -1064, -2444, -2676, -2966, -2826, -2495, -1475, -867, -1107, -1618,
-    -721, 404, 580, -775, -1730, -1777, -1628, -1887, -2013, -1091, -504, -1082,
-    -1593, -1461, -896, -1134, -1691, -1821, -702, 365, -133, -383, -543, -373,
-    -27, 1218, 2457, 1902, 1247, 3090, 3064, 1589, 1690, 3654, 5638, 5356,
-    4067, 3873, 2979, 2070, 2695, 3329, 2634, 2040, 2398, 1451, 1466, 2675,
-    4010, 3405, 1929, 2161, 2070, 809, 894, 1832, 1617, 887, 983, 1218,
-    1274, 1500, 928, 234, 553, 284, -1255, -1091, -738, -783, -405, 268,
-    168, -1024, -1558, -1044, -1087, -1362, -597, 3, 360, 927, 499, -512,
-    -1918, -2010, -337, -374, -1090, -996, 516, 162, -682, 10, -273, -1595,
-    -1680, -67, 731, 478, -98, -719, -629, -755, -1813, -2846, -3151, -2054,
-    -1057, -631, -772, -1250, -1893, -1639, -839, -1050, -683, 1808, 3129, 810,
-    -655, 1920, 2658, 329, -165, -102, -144, 633, -99, -1729, -2044, -2315,
-    -3441, -3510, -2710, -2576, -3024, -3135, -3896, -3835, -2773, -2530, -2543, -1420,
-    103, 949, 825, 1526, 1342, 219, 724, 448, -942, -1024, 105, 548,
-    28, 436, 386, -591, -417, 424, 544, -879, -1722, -1211, -309, 750,
-    970, -274, -734, 328, 1863, 1822, 1611, 1915, 2891, 3738, 3237, 2046,
-    954, 2019, 4148, 4240, 3958, 2993, 2227, 1422, 962, 1217, 1137, 564,
-    585, 955, 1327, 1883, 1549, 96, -844, -537, 354, 1357, 1766, 276,
-    -448, 143, 1383, 1726, 612, 393, 1448, 1821, 716, -200, -336, -1179,
-    -1558, -358, -260, -670, 38, -569, -2098, -2750, -1745, -286, -15, -150,
-    -415, 36, -366, 26, 955, 936, 574, 608, 336, -669, -830, 833,
-    1990, 1906, -312, -205, 1761, 1750, 1417, 2074, 310, -2602, -3114, -2029,
-    -636, -350, -661, -1104, -1137, -764, -564, -538, -59, -693, -1440, -834,
-    -240, -175, -919, -881, 449, -76, -389, -433, -533, -260, -1413, -2266,
-    -1967, -1348, 70, 144, 106, -668, -948, 76, 492, -1236, -2694, -2279,
-    -2050, -1215, -1395, -1521, -2570, -2350, -2281, -2067, -2142, -2545, -3619, -4826,
-    -3824, -2875, -2669, -1715, -751, -298, -1672, -695, 610, 367, 322, -446,
-    -165, 569, 2274, 1381, -968, -113, 342, 477, 6, 943, 3275, 3431,
-    2521, 1812, 3313, 2811, 2935, 3606, 4284, 2610, 2561, 3003, 3368, 3206,
-    2436, 2569, 4031, 3761, 3817, 3016, 4353, 3377, 1749, 1341, 2042, 1136,
-    -783, 307, 2164, 3143, 2813, 3147, 2033, 1245, 1269, 324, 80, 403,
-    967, 1760, 905, -130, -204, 49, -196, -638, -2797, -4753, -2520, 4384,
-    5224, -2918, -4731, 4341, 7783, 821, -4996, 2799, 9662, 8579, 2021, -444,
-    2976, 973, -7378, -10392, -5451, -1235, -275, -10262, -12458, -12724, -9725, -7915,
-    -15925, -15190, -12836, -6571, -2138, 2430, 3440, -653, -4910, 720, 8212, 8539,
-    4657, -113, 7889, 14431, 13704, 10360, 4340, 2271, 228, -8364, -4159, -4775,
-    -2859, -2950, -10676, -10335, -9047, -4985, -13015, -12284, -9254, -5064, 860, 5186,
-    10274, 11183, -680, -8012, 3662, 10910, 7552, 760, 5601, 6541, 6802, -423,
-    2457, 1680, 3331, 1087, -4096, -6632, 2382, 5372, -3233, -8305, -8421, -9357,
-    -11114, -7506, -9410, -7394, -8475, -4863, 697, -459, -1361, -1525, -2868, -3000,
-    -1753, 4081, 2959, 747, 8026, 4885, 2453, 7282, 12368, 13359, 4902, 2274,
-    7698, 9520, 5380, 3473, 8629, 6769, 8749, 3829, 3608, 4382, 673, 3416,
-    8301, 4226, 4194, 5606, 2349, -1787, 1247, -507, -2634, -4495, -5352, -2033,
-    -5122, -7566, -2946, -5795, -8916, -8772, -5735, -3476, -5862, -10348, -11189, -9173,
-    -6555, -1523, -1773, -4577, -7636, -6048, -3975, -3387, -4284, -2390, -364, 4043,
-    2654, -473, -2900, -3619, -1242, -2414, -6567, -3299, 1026, 1135, -3078, 2008,
-    3787, 1804, 901, 2578, 6744, 6123, 2603, 2410, 8632, 7438, 6608, 8027,
-    3574, 4442, 7720, 8303, 6403, 1685, 3010, 5985, 3180, 4702, 7106, 3526,
-    1198, 2620, 4200, 1220, -2366, -2622, 5444, 4109, 3500, 2136, -538, -1351,
-    4623, 702, -1133, 77, -4189, -4591, -3984, -6153, -4571, -3283, -6088, -10698,
-    -7290, -3069, -5201, -6230, -5925, -6761, -7601, -9865, -4986, -3422, -6022, -9777,
-    -5261, -2525, -1340, -3162, -4456, -2975, -4406, -4404, -6244, -1401, 368, -3369,
-    -1072, -4195, -3659, -3197, -2288, 7, 956, 220, 5749, 2507, 5043, 3188,
-    2273, 10005, 6677, 3898, 1108, 4369, 6894, 8556, 7541, 778, 6048, 10094,
-    8904, 7165, 5082, 7395, 10739, 4926, 6434, 7702, 3659, 7119, 4532, 4029,
-    4012, -596, 1608, 699, 4659, 6059, 3024, 3074, 3010, 3093, 4563, -1039,
-    389, 1361, 1110, -667, -2173, -1619, 541, -4688, -7056, -4677, -2893, -6916,
-    -4467, -8967, -7354, -4084, -7226, -8406, -6661, -9139, -9232, -4339, -2582, -6096,
-    -4638, -7380, -5687, -3769, 2561, 1638, -3457, 607, -1466, -7102, -7321, -2747,
-    1474, -750, -2846, -5444, -1079, 3311, -1933, -2596, -2562, 1482, 3634, 356,
-    2658, 1746, 3243, 2210, 4977, 5830, 933, 2597, 6482, 4980, 3684, 5184,
-    6248, 2681, 4897, 7544, 2712, -622, 7180, 6750, 470, 99, 2630, 1581,
-    -3961, 539, -1656, -468, 2546, -1435, 2190, -516, -2024, -1774, -1395, -1198,
-    -1000, -6282, -5786, 123, 847, -1771, -3045, -4588, -8360, -5746, -3181, -5186,
-    -5441, -4188, -4246, -6764, -3063, -2751, -3820, -5826, -4821, -8906, -5416, 2213,
-    -2309, -2747, -579, -1583, -5339, -6884, -2323, 167, 3286, 5705, -169, -5540,
-    -796, -367, 5221, 4054, -1129, -2704, 3589, 5060, 862, -1530, 3754, 3290,
-    5544, 7734, 5337, 786, 1411, 4262, 5795, 5293, 5304, 4448, 3496, 6561,
-    7258, 4623, 4945, 2696, 3393, 3158, 6819, 5245, -95, 865, 4805, 6445,
-    2650, 3219, -235, -1089, -2162, -3719, -2889, 952, 6120, 2211, 1674, 1794,
-    -1642, -875, -4882, -4366, -2718, -1333, -1178, -4102, -800, -3618, -4619, -3040,
-    244, 2539, -5867, -6360, -982, -4294, -4887, -6781, -4885, -585, -944, -4375,
-    -4208, -4015, -2603, -4892, -5382, -3917, -49, 2913, -1372, -1757, 461, 352,
-    2841, 1769, -1465, -2248, -226, -1676, -1263, -1493, 1726, 4755, 1680, 1229,
-    4369, 1092, 729, 5954, 4280, 2114, 7960, 8318, 4883, 4070, 4337, 5600,
-    7455, 4220, 5694, 4100, 4433, 6949, 2799, 4578, 1128, -1273, 3171, 2909,
-    2995, 2788, 1352, -373, 2921, 3528, 1205, 493, -558, 298, -2879, -4507,
-    2862, 537, 292, 816, -549, 115, -1222, 293, -1220, -4517, -4643, -2180,
-    -138, -1989, -5771, -6892, -6056, -5014, -3315, -3924, -4740, -3590, -2798, -3634,
-    -3251, -5766, -3551, -1829, -4981, -5103, -2806, -1685, -5265, -6131, -3124, -3836,
-    -4129, -1088, -1115, 96, -4023, -768, 4601, 2915, 2084, 1147, 2201, 2124,
-    -1880, -1342, 765, -133, 1924, 3712, 406, -225, 3935, 1773, 928, -761,
-    -164, 2236, 2786, 1141, 3220, 5032, 358, 2705, 4254, 4113, 4413, 3459,
-    4679, 2011, -1631, 2382, 2884, 1355, 1047, 2100, -623, -2978, -749, -1368,
-    -2367, -2626, -4139, -4219, -2106, -2964, -2705, -5432, -3482, 38, -612, -1667,
-    -2809, 997, 985, 225, -2367, -2931, -1809, -1171, -1634, -5401, -5428, -1944,
-    -3849, -5587, -5162, -1519, -1239, -5819, -5723, -4181, -4494, -2454, -4358, -5296,
-    -1490, -2378, -1726, -1214, -2473, -822, -76, 176, -2216, -313, -96, 94,
-    -576, 4657, 6347, 1211, 1382, 8139, 7706, 1619, 437, 4156, 4241, 1877,
-    2401, 5829, 2926, 2187, 5045, 1009, 3876, 3679, 1336, 4384, 2509, 3251,
-    4791, 5869, 1782, 294, 2911, 8191, 5599, 4648, 3302, 3771, 2005, 4324,
-    5842, 2698, -256, 2317, 4650, 4291, 2476, 327, -395, 1665, -1073, -4150,
-    -2754, -3409, -199, -1986, -6077, -8387, -8907, -4005, -365, -4512, -6289, -1881,
-    -1778, -3076, -2226, -1777, -1877, -2386, -5072, -3317, -2287, -1981, -5515, -5898,
-    -4822, -3260, -327, -1952, -3197, -4485, -5036, -3491, -4843, -1988, -2156, -2274,
-    825, 124, -856, -25, -2807, -2249, -381, 1899, 1609, 4554, 4763, 517,
-    -821, 3120, 8313, 4362, 2559, 6091, 8204, 6163, 2301, 4034, 4412, 3629,
-    3678, 2182, 3377, 5347, 3996, 980, 5985, 5939, 1971, 4972, 4757, 4557,
-    6006, 7232, 5826, 6698, 1953, 6995, 8799, 6870, 2935, 2874, 4594, 2159,
-    1049, 1206, 1239, 1476, 1716, 2138, -271, -1317, 1364, 183, -3593, -4999,
-    -4090, -1587, -2316, -4186, -1996, -3314, -5084, -6167, -4395, -2784, -1153, -1922,
-    -5358, -4189, -3641, -4672, -5579, -6903, -4006, -3631, -5338, -6346, -4740, -3486,
-    -4319, -4602, -7534, -7174, -2290, -1907, -5199, -6400, -2370, -236, -2936, -6123,
-    -3242, -742, -1045, -2707, -4844, -2190, 285, 859, 2641, 1764, 81, 945,
-    632, 4492, 5920, 5419, 5303, 1410, 4192, 4669, 5936, 5746, 5727, 4631,
-    3814, 2931, 298, 1785, 2846, 3160, 6139, 2898, 2670, 5398, 3448, 3079,
-    5723, 7699, 6674, 4662, 3069, 2143, 4751, 5074, 2706, 5515, 4199, 3361,
-    2591, 2042, 314, 767, -869, -396, 1452, -1372, -1162, 890, 208, -2692,
-    -3011, 175, 482, -4494, -3394, -3503, -1745, -970, -1734, -362, -2699, -4201,
-    -2482, -2853, -3941, -1799, -2888, -3676, -2598, -4311, -4645, -5408, -5059, -2793,
-    -3812, -5261, -2929, -3057, -4392, -4609, -5440, -3704, -3645, -5479, -3842, -3179,
-    -3482, -2091, -293, -176, -55, -3279, -2908, -2342, -252, -2444, -1450, 726,
-    1831, 1667, -777, -922, -361, -1346, -1090, 1961, 1750, 4265, 3583, 844,
-    2035, 2419, 2448, 2434, 2238, 5108, 5477, 513, -1678, 1158, 3422, 2591,
-    4355, 2700, 1787, 3712, 2371, 1748, 2090, 3649, 5503, 5437, 3825, 3275,
-    2541, 2649, 2329, 992, 237, 4141, 4788, 1969, 1260, 1167, -1683, -2409,
-    -406, -605, -1629, 372, -2053, -1747, -199, -292, -694, -2202, -2032, -4159,
-    -4316, -2909, -3087, -3369, -3413, -1062, -3487, -3855, -6042, -6652, -1812, -1283,
-    -1869, -955, -687, -1286, -488, -1847, -2294, -1612, -2247, -4979, -3615, -434,
-    322, -1899, -2933, -4795, -3472, -3315, -2008, -526, -1395, -2085, -1919, -2151,
-    1750, 2066, -1547, -1169, -3128, -1593, 1112, 2803, -926, -1327, 559, 1442,
-    2476, 1122, -396, 906, 2695, 1707, 1115, 1644, 1795, 2654, 3452, 4304,
-    4090, 3496, 4170, 4182, -208, -1012, 355, 620, 1696, 1717, 433, 233,
-    1420, 3009, 2762, 1433, 1187, 1866, 1599, 2359, 4384, 4205, 2820, 2383,
-    3082, 1757, -579, -209, -33, 979, 3613, 1499, -947, -1318, -311, 2293,
-    2404, 709, -1136, -1949, -124, -326, -2192, -2061, -2394, -473, 592, -746,
-    -3021, -1869, -3059, -4236, -1571, -4021, -5186, -3307, -3167, -4414, -3216, -1939,
-    -1520, -2316, -2768, -317, -405, -1878, -1702, 1142, 2040, -1631, -2389, -1094,
-    -1093, -1558, -2922, -2010, -650, 89, -561, -931, -1189, 322, -164, 35,
-    1000, -121, -620, -1023, 298, 1125, 228, -558, 1084, 1707, 2218, 3002,
-    3666, 3361, 2044, 468, 771, 2568, 3350, 1981, 2469, 4666, 3202, 1548,
-    2577, 3248, 3202, 3544, 4244, 2009, 522, 387, 1300, -682, -119, -1858,
-    -2505, -366, 406, 2333, 2317, -328, 11, 1546, 321, 2126, 3215, 2482,
-    3587, 2028, 904, 1410, -116, 2532, 1803, 573, 102, 1726, 1550, -1004,
-    -1196, -211, -1521, -2394, -678, 406, -1331, -2599, -3444, -1814, -182, -2637,
-    -1943, -3298, -3417, -3315, -3222, -820, -1888, -4747, -5018, -4023, -4111, -5048,
-    -1880, 113, 657, -1355, -1128, 491, 111, -1184, -1094, 2612, 3026, 145,
-    -590, 818, 132, 292, -1321, -3442, -1568, 894, -463, -2479, -1569, -997,
-    -2358, -2517, -1649, -754, -130, 891, 873, 1039, 361, 2235, 5379, 4970,
-    1487, 24, 1621, 2163, 4250, 5293, 3365, 3697, 3373, 2965, 3107, 2575,
-    2288, 1760, 3117, 5205, 2938, 2070, 1602, 2340, 1611, -1932, -2321, -964,
-    -363, -368, 1083, -363, -3049, -162, 1735, 312, 452, -166, -79, 2979,
-    1763, -801, 851, 3334, 919, -1421, 6, 1607, 2567, 982, 603, 992,
-    -913, -882, 901, 2450, 1317, -1524, -1413, -2434, -3294, -3251, -2450, -1831,
-    -137, -683, -2557, -2188, -344, 1845, 20, -1463, -1799, -2898, -3561, -2698,
-    -318, -1183, -3348, -3961, -4419, -1784, 513, -1466, -2992, -1916, -507, -1824,
-    -380, -692, -630, -1633, -1234, 1625, -97, -2581, -609, -1232, -292, 994,
-    -1081, -1267, -1314, -375, 491, -684, -2559, -2571, -738, -749, 108, -823,
-    -706, -967, -623, 441, 2274, 1613, 571, 3037, 2770, 1870, 3218, 4701,
-    3095, 2855, 2977, 2820, 2214, 3296, 2663, 3445, 3315, 2844, 743, 824,
-    2494, 2983, 2882, 195, -2359, -1536, -845, 169, 1152, 489, 114, 918,
-    1646, 946, 511, 187, -285, 1260, 1629, 461, 2405, 1951, 1602, 1758,
-    1432, 1229, 1190, 373, 376, 624, -697, -825, -227, -686, -3321, -3607,
-    -2128, -1480, -2646, -1376, -997, -2915, -3019, -2635, -3977, -3344, -2890, -2352,
-    -1628, -382, -1216, -4164, -4023, -2951, -1405, -934, -2024, -3231, -3044, -3279,
-    -3440, -1599, -234, 1204, 364, -1669, -974, 1145, -657, -2515, 263, -149,
-    -1400, -1271, -3325, -2389, 204, -521, -2428, -1875, 408, 1133, -984, -430,
-    993, 309, 894, 503, 1526, 2689, 3680, 2758, 2642, 1304, 781, 1651,
-    2766, 2458, 1360, 1772, 2688, 1571, 2480, 4119, 4152, 2121, 1522, 1683,
-    870, -189, 697, 1733, 2347, 3314, 801, 1596, 670, 135, 3083, 3721,
-    285, 212, -402, -260, 855, 766, -338, -1281, -2791, -2735, 273, -499,
-    -2317, -347, -185, -587, -762, -1847, -1751, -2093, -3864, -2408, -421, -284,
-    -940, -2832, -2580, -1565, -2262, -904, 107, -2583, -2179, -63, 303, -996,
-    -1606, -774, -1823, -3671, -1182, 1076, -1801, -2455, -971, -133, -660, -2168,
-    -1469, -888, 261, 664, 744, 106, -1940, -810, -490, -2715, -2848, -203,
-    -1743, -1594, 1310, 1984, -613, -1300, -2329, 170, 1430, 2113, 798, -1794,
-    -208, 858, -136, -36, -760, -387, 603, -535, -672, 918, 366, -317,
-    495, 1740, 1703, 748, -1078, -1363, -415, -144, 275, 2182, 3008, 984,
-    -1119, 213, 2178, 2863, 1276, -1, 497, 3124, 2358, -1173, -1658, 815,
-    2647, 2583, 2483, 982, 990, 3161, 2470, 3165, 2161, 2936, 2640, 2527,
-    5062, 4572, 745, -893, -572, -495, 144, 2228, 824, -1759, -1281, 998,
-    1849, 477, 853, 149, -777, 1415, 2540, 1190, -253, 1610, 2017, 1665,
-    1688, 963, -310, -210, 534, -1215, -1759, -828, 872, -123, -1792, -1149,
-    -167, -854, -1395, -972, -982, -1764, -2465, -2078, -724, -1034, -572, -714,
-    -2828, -1772, -1871, -3237, -4575, -4048, -2616, -2648, -2033, -2893, -2829, -2387,
-    -3363, -3979, -4601, -4794, -3315, -149, 1379, -809, -1117, -53, 988, 224,
-    580, -912, -2539, -831, 1408, -25, -2005, 608, 2361, 560, -1502, -1100,
-    794, 493, -603, 736, 2031, 1982, 921, 1134, 1756, 2388, 2113, 1430,
-    1533, 1698, 2544, 5118, 3514, 2042, 851, 1827, 3138, 4087, 2608, 2823,
-    2189, 1435, 2290, 4219, 4142, 3056, 4262, 6236, 5768, 4123, 3712, 4589,
-    4812, 3867, 3362, 2098, 1998, 2759, 3133, 3398, 2694, -302, -1164, -64,
-    -488, -1005, -2531, -2538, -1618, -1333, -1938, -3121, -2668, -2719, -3591, -3993,
-    -2437, -2923, -3986, -3562, -2062, -3538, -3378, -1460, -4219, -5275, -3178, -1260,
-    -2133, -4412, -4920, -3001, -1515, -1504, -2308, -2072, -2351, -1505, -884, 86,
-    -828, -2418, -2889, -3188, -2686, -450, -74, -3400, -4363, -2695, -1682, -776,
-    -562, -545, -1612, -1980, -1569, -222, -1949, -2734, -244, 430, -1262, -16,
-    3549, 3264, 805, 1757, 3431, 2789, 2968, 3842, 3214, 2223, 1470, 2026,
-    3069, 2981, 2117, 2327, 3178, 1185, -117, 2014, 1488, -521, -416, -820,
-    -229, 2555, 2334, -11, -1268, -831, 59, 663, 485, -44, 1307, 3639,
-    3694, 1505, 377, 1395, 2392, 2080, 1025, 890, 2543, 2798, 1153, 2108,
-    2927, 1788, 1421, 1666, 2117, 1299, 566, 634, 203, -875, -1784, -1647,
-    -418, -653, 641, 1708, -807, -3186, -2156, -1702, -1523, -947, -817, -250,
-    -306, -848, -202, -43, -755, -2373, -1935, 915, 1161, 373, 612, -119,
-    -1570, -1142, -2500, -2852, -1523, -12, 61, -462, -1686, -2588, -2802, -1641,
-    -1638, -1856, -1535, -627, -75, -1498, -3159, -2692, -1848, -2904, -1907, -173,
-    348, -197, -838, -245, -1157, -2973, -2269, -1365, -1483, -2221, -1806, -1097,
-    -1397, -2563, -1645, 33, -1358, -3184, -1791, 643, 941, 455, 1236, 1172,
-    1079, 617, 193, 1094, 1942, 2240, 473, 526, 2176, 2091, 1333, 718,
-    -292, -250, 852, 204, -686, -369, 1067, 1861, 870, 1430, 2101, 1136,
-    224, 459, 1192, 2224, 2954, 2357, 1457, 2825, 3183, 2275, 1797, 981,
-    -56, 277, 1497, 3012, 3576, 2200, 220, -203, 1247, 1854, 1124, 221,
-    1215, 828, -887, -330, 557, 404, -48, -217, -985, -1083, 586, 1401,
-    1894, 1533, 973, -1226, -2227, -545, -636, -1658, -750, -878, -3462, -3197,
-    -490, 6, -457, -2826, -3303, -1312, -245, -333, -1304, -618, -821, -799,
-    -425, -116, -244, 106, -945, -1731, -710, -293, 384, -384, -1458, -1395,
-    -1722, -1535, -1435, -1499, -1257, -1207, -412, -946, -1196, -1134, -1493, -2546,
-    -937, -250, -1486, -1124, -1349, -1705, -516, -1391, -2599, -2175, -2225, -2074,
-    -77, 356, -911, -2487, -2108, -1460, -2299, -2501, -1741, -835, 1354, 740,
-    -79, -371, 780, 2092, 515, 933, 516, -316, 655, 1367, 1994, 717,
-    -812, -2424, -893, 389, 870, 719, -272, -6, 714, 567, 332, 855,
-    820, 1390, 3022, 2872, 1278, 613, 1461, 2400, 1849, 2037, 925, 2191,
-    4276, 3276, 2188, 1819, 2638, 2801, 1119, 944, 1937, 1844, 1947, 2227,
-    2165, 973, 1046, 2531, 3449, 2111, 248, 411, 2348, 3110, 2507, 1246,
-    823, 1273, 897, -109, -560, -943, -552, -597, -1969, -3130, -2334, -1129,
-    -1890, -1235, -658, -564, -899, -257, 254, -111, -839, -308, 1088, 2134,
-    1643, 55, -132, 533, 1020, 1142, 10, -1085, -765, -2057, -3741, -3394,
-    -2067, -1827, -2506, -2955, -3498, -2610, -2073, -1676, -1822, -3652, -4434, -3676,
-    -1216, -823, -2410, -3178, -2281, -1835, -1837, -1304, -1392, -2572, -1501, -440,
-    -260, 429, -22, -844, -1294, -1266, -1133, -81, -515, -1722, -2103, -2353,
-    -1956, -504, 481, 279, -714, -994, -408, -556, 10, -212, 180, 263,
-    1944, 2954, 2313, 709, 469, 2285, 3165, 3505, 2991, 3687, 4098, 2928,
-    2677, 3702, 3940, 3069, 1704, 2159, 2092, 2390, 2927, 2451, 1922, -250,
-    -508, 212, 1534, 1861, 289, -623, -98, 1651, 2573, 1843, 584, 478,
-    1993, 3051, 3026, 1920, 1090, 2214, 4503, 3870, 1953, 1128, 1271, 1426,
-    1735, 935, 934, 620, 1274, 420, -1726, -2769, -2333, -951, -2191, -4294,
-    -4669, -3415, -2502, -1983, -1684, -2692, -4426, -3877, -1313, -871, -2113, -2860,
-    -1702, 197, -494, -1531, -2095, -1733, -1573, -1142, -738, -665, -789, -1054,
-    -1911, -1171, -768, -530, -1218, -1804, -2247, -3498, -3357, -1691, -142, -381,
-    -1448, -2093, -1534, -1325, -710, 759, 768, 340, 645, 953, 490, 372,
-    -92, 57, 610, 1572, 1422, 905, 329, -17, 530, 1675, 961, -409,
-    130, 700, 453, 623, 1604, 754, -632, 232, 1938, 2515, 531, -224,
-    1021, 1973, 1916, 2173, 1762, 633, 559, 250, 1120, 954, 1002, 1730,
-    2555, 1968, 472, -215, -179, 226, 1210, 2242, 2364, 1156, 1335, 1686,
-    497, 842, 1071, 12, -824, -232, 803, 569, -599, -208, 1102, -106,
-    -1913, -1831, -526, 446, 126, -382, -71, 1183, 1050, 707, 459, 309,
-    386, 322, 501, 430, 580, 183, -1039, -1525, -1224, -1039, -1103, -221,
-    -133, -820, -1277, -1277, -708, 1029, 825, -542, -316, 491, 270, -796,
-    -1947, -607, 425, 402, 179, 495, 1032, -225, -961, -194, -517, -1698,
-    -1386, -529, -651, -1121, -1843, -2649, -1756, -330, -544, -1833, -3369, -3517,
-    -1575, -429, -396, -2003, -2462, -1203, 164, 213, 531, 1030, 1026, 625,
-    999, 813, -393, -1614, -1056, -651, -709, -678, -830, -758, -971, -1829,
-    -3021, -1584, 51, 9, 572, -34, -889, -536, 203, -467, -579, 1112,
-    1998, 1178, 759, 572, -541, 22, 1282, 1324, 1214, 2206, 1340, 306,
-    -200, 688, 716, 176, 59, 23, 239, 380, 130, 90, -44, 1142,
-    1826, 1142, 599, -61, 357, 783, 889, 1360, 1164, 1420, 1032, 400,
-    412, 936, 1656, 2099, 1796, 544, -9, 853, 840, 250, 116, -163,
-    71, 1076, 810, -348, -75, 461, 632, -6, 849, 1942, 2095, 2169,
-    2077, 1197, 792, 793, 535, 531, -161, -375, -244, -750, -490, -359,
-    -1263, -2458, -2110, -1095, -1302, -2443, -3537, -4177, -3700, -3457, -2593, -2542,
-    -2780, -3144, -4306, -3273, -2183, -2327, -1672, -249, -89, -748, -158, 72,
-    6, 353, 505, 476, 582, 985, 1129, 730, 793, 822, 639, 168,
-    310, 954, 624, 410, 796, 1176, 504, 442, 214, -886, -576, 3,
-    117, 1156, 678, -94, 53, 879, 1721, 2378, 2560, 2110, 1122, 1439,
-    1533, 1044, 1798, 1651, 440, 214, 710, 747, 349, -705, -1825, -1442,
-    -771, -1604, -952, -908, -2030, -1441, -161, -195, -460, 416, 814, 264,
-    128, 929, 1904, 1291, 239, -172, -83, 155, -603, -1597, -1005, -273,
-    -697, -637, -417, -81, 271, -490, -653, -457, 480, 1129, 1690, 1717,
-    1943, 1790, 837, -314, 628, 948, 395, 1245, 2025, 2015, 1322, 522,
-    -1051, -775, 198, -63, -421, -317, -203, 207, 200, 317, 293, 487,
-    -306, -1543, -793, 312, 511, 269, 66, -357, -870, -563, 6, 161,
-    -88, -432, -549, -51, 141, -353, -981, -545, -117, -340, -1318, -1221,
-    -744, -1495, -1182, -1248, -1934, -1254, 60, 198, -856, -594, -517, -243,
-    166, 206, 64, -733, -163, 728, 649, 504, 352, 74, -199, -570,
-    175, 742, -167, -733, -113, 166, 10, 280, 299, 200, -546, -735,
-    66, -27, -51, 494, 1016, 2014, 1810, 1397, 1978, 1418, 85, -763,
-    -1340, -1607, -1395, -1350, -2070, -2170, -1855, -1942, -1857, -1731, -1620, -1848,
-    -2105, -1907, -1150, -390, -696, -2295, -2367, -1354, 661, 994, 726, 750,
-    1020, 1057, 1787, 1821, 782, 632, 1004, 1372, 895, -126, -224, -787,
-    -308, 519, 1289, 1074, 904, 1712, 1977, 1777, 1786, 1550, 1340, 1380,
-    1421, 1129, 1147, 929, 1348, 1146, -260, -552, 194, 1885, 2022, 1295,
-    1658, 2169, 1599, 1915, 2693, 2458, 1877, 1834, 2141, 2890, 3318, 2624,
-    1743, 1398, 2471, 2759, 1665, 1603, 1976, 898, -194, -5, -575, -910,
-    -664, -1475, -1708, -704, -395, -649, -1856, -2232, -1297, -1370, -2472, -2759,
-    -2746, -1936, -2011, -2046, -1473, -1020, -476, -2647, -2859, -1653, -831, -662,
-    -608, -850, -1362, -1379, -2130, -3227, -3202, -2910, -2735, -2007, -1040, -286,
-    -801, -2017, -1298, -738, -328, -1220, -1117, -528, 193, 67, -1337, -1751,
-    -1145, -940, -1074, -680, 1180, 1604, 1015, 13, 36, 911, 417, -419,
-    683, 3066, 5169, 1456, -939, 3700, 43, -1446, -5735, -6173, -424, 3629,
-    -674, -5707, -4394, -5697, -2961, -686, 4396, 5605, 6578, 8718, 7962, 6466,
-    1983, 8094, 9406, 10149, 3704, 6521, 8417, 3133, -4535, -4416, -2070, -7101,
-    -6257, -12038, -6924, 740, 1461, -1870, -9013, -12648, -10625, -4980, 1711, -1210,
-    3546, 10405, 5749, 5227, 8179, 8980, 1941, 7551, 6505, 671, 12195, 11159,
-    2781, -2647, -3517, -7219, -974, -5082, -6802, -6642, -3883, -3078, -5285, 3223,
-    -1951, -6927, -6930, -443, -2336, 1336, -2020, -9297, -4160, -474, -308, -1609,
-    1300, 9574, 1953, 1711, 10389, 11001, 7646, 5623, 5432, 5006, 5365, 3748,
-    8134, 2256, 2771, 570, -3049, -929, -1015, 1871, -3797, -5003, -6058, -3962,
-    -1135, -4172, -4466, -8436, -8219, -5956, -4665, -5153, -6700, -5554, -4195, -4858,
-    -2386, -3476, -1156, -1139, -507, -3489, -4188, 441, -4570, -5144, 1361, 1361,
-    -2846, 1876, 4040, -672, 893, 810, 2107, 1977, 3771, 1881, 2806, 1939,
-    5256, 7192, 4327, 2595, 2102, 2025, 2327, 3951, 3720, 1809, 464, 3842,
-    4320, 6219, 4547, 3306, -983, -3194, 391, 5795, 649, 1395, 3453, 4276,
-    3610, 2395, 504, -684, -1236, -3784, -419, -1116, -789, 412, -3573, -4955,
-    -7588, -7056, -3300, -2993, -5548, -4784, -3154, -4398, -4482, -3055, -2343, -3247,
-    -3409, -6045, -3774, -3827, -3760, -2483, -822, 1533, 513, -229, 288, -2632,
-    -4692, -1626, -1180, -400, -306, 1659, 2358, -1187, -1169, 3455, 3992, 1243,
-    543, 4897, 5984, 2910, 5072, 5779, 4817, 5568, 5861, 5937, 5087, 4200,
-    3080, 3450, 5269, 2355, 4850, 4133, 2462, 1801, 435, 2967, 3003, 1599,
-    1722, -1031, -4082, 1303, 3222, 1722, -403, 941, 2348, 1126, -2618, 768,
-    1883, 1124, -1544, -2408, -799, 656, -1969, -3232, -3417, -2540, -3340, -4802,
-    -4570, -6068, -3858, -2803, -4475, -5794, -3066, -2024, -5091, -3386, -3017, -940,
-    -1334, -4971, -3556, -3231, -2400, -808, 611, 3640, 162, -3161, -579, 623,
-    255, 1388, 2377, -493, 2068, 3506, 1767, 687, 1559, 6055, 4552, 3602,
-    3123, 2505, 3221, 2855, 3455, 3343, 3379, 5816, 3872, 2415, 1672, 2000,
-    2484, 4227, 3689, 903, 1886, 2478, 325, 955, 1705, 2172, 2855, -1657,
-    -2975, 556, 3866, 2718, 1456, -30, -1515, 670, 904, 8, -598, -1507,
-    -3107, -2446, -903, -2080, -4838, -4280, -5720, -5912, -3895, -1681, -5543, -6866,
-    -4140, -4713, -4891, -3182, -2346, -4464, -3546, -2614, -3172, -4641, -4210, -364,
-    -957, -2123, -1602, -2085, -593, -892, -166, 1018, 740, 1276, -848, -2272,
-    1491, 3480, 2740, 2167, 676, 74, 983, 937, 982, -83, 2911, 3988,
-    2664, 2732, 2327, 2340, 2434, 1855, 2367, 823, 4507, 3727, 1638, 2835,
-    4617, 2535, 632, 2073, 2518, 731, 2288, 3420, 2080, 582, 75, 1794,
-    2871, 558, -2624, -1235, 840, -421, 114, -1853, -2405, 213, -594, -69,
-    -394, -748, -1299, -577, 275, -1331, 226, 67, -2261, -3962, -2108, -408,
-    -1165, -1731, -688, -1886, -1049, -2671, -4683, -4594, -2357, -2536, -1818, -1700,
-    -4155, -2023, -2458, -3386, -1223, -440, 8, 348, 553, 2728, 3537, 1304,
-    824, 1992, 118, 668, 3221, 1998, 30, -2, 3077, 5135, 2954, 586,
-    50, 2360, 2880, 841, 2323, 3351, 3086, 2601, 4139, 4914, 3508, 3108,
-    2755, 2331, 2014, 3608, 3690, 3157, 2642, 1677, 1516, 1900, -307, -1227,
-    1646, 2985, 270, -1249, 130, -760, -2022, -809, 1108, -889, 116, 629,
-    -1448, -657, -1665, 55, -1274, -2003, -3508, -2535, -1969, -3799, -4952, -5059,
-    -1897, -1559, -2168, -2504, -3126, -3624, -3242, -2432, -1567, -3274, -2688, -2213,
-    -2719, -3631, -3336, -2519, -1700, -2099, -4157, -3247, -925, -540, -937, -2394,
-    -2940, -1755, 489, 2649, 1205, -1306, -859, -1870, -595, 2885, 3213, 693,
-    -421, 138, -421, 2627, 2210, 1176, 2292, 2652, 912, 794, 2264, 2749,
-    1287, 1803, 2710, 1990, 3059, 2627, 1635, 3138, 2032, 1009, 3862, 3442,
-    3185, 3008, 1312, 2300, 2740, 1460, 1376, 1770, 226, 720, 964, 401,
-    -611, -2482, -2763, -770, -757, -263, -411, -392, -1514, -531, 152, -213,
-    792, -302, -2505, -1771, -682, -2034, -3712, -4154, -2627, -2150, -2081, -3127,
-    -2581, -2936, -3812, -2108, -1511, -1525, -396, -474, -882, -852, -2138, -1666,
-    214, -281, -790, -1616, -459, -585, 109, -1222, -1288, -1036, -424, 460,
-    359, 778, -1764, -846, 451, 296, 342, -951, 365, -287, -152, 1064,
-    2431, 3126, 2286, 2287, 1584, 2789, 2844, 3087, 2219, 2239, 1708, 2754,
-    3358, 1840, 3152, 3175, 991, 1985, 2638, 2513, 2170, 182, 473, -946,
-    -427, -1331, -1506, -1383, -1354, -1319, -3282, -1119, -1588, -3658, -3779, -2653,
-    -2206, 77, 773, 36, -815, -1309, -100, 1254, -684, -1412, -494, 155,
-    907, 874, -2108, -1397, -1357, -522, -200, -2688, -2687, -1080, -962, -1218,
-    -1290, -1069, -2011, -2615, 172, 399, -270, 597, 162, 1016, 2108, 237,
-    395, 91, 1323, 1752, 2507, 1058, 1571, 2722, 2439, 3254, 2887, 2784,
-    2288, 1787, 2054, 2352, 689, 377, 2288, 3039, 1739, 410, 374, 1815,
-    669, 723, 1914, 1192, 2483, 1682, -280, 832, 2482, 1493, 868, 51,
-    -2, 275, 261, -659, -498, -67, -1209, -320, -1313, -743, -1168, -2224,
-    -2381, -2801, -2679, -938, -2205, -3798, -2445, -2673, -2873, -3728, -4205, -3931,
-    -3561, -2495, -1782, -3726, -3145, -861, -1959, -1972, -451, -1803, -2649, -3333,
-    -2998, -1089, -1982, -1646, -1774, -2335, -1095, -1944, -445, 1283, -373, -518,
-    -1035, -888, 862, 648, 2140, 2464, 923, 741, 1872, 965, 1017, 1597,
-    2381, 1841, 549, 1316, 1748, 1442, 2361, 2816, 1835, 2035, 4011, 2551,
-    1685, 4064, 4235, 1640, 1339, 2343, 2796, 2426, 1765, 2865, 4144, 1424,
-    1163, 2977, 2547, 1640, 1674, -301, -127, 1562, 1623, 1165, 398, 1528,
-    1192, 477, 475, 1224, -231, -918, -184, -229, -1259, -806, -742, -1286,
-    -2693, -3083, -1887, -2096, -1351, -361, -1641, -2079, -1341, -2034, -3135, -3526,
-    -2620, -2376, -1999, -2838, -2959, -1995, -2270, -3056, -3599, -3406, -2435, -2669,
-    -2396, -1101, -646, -2187, -2868, -2056, -2820, -2413, -774, -1553, -1188, 618,
-    88, -467, 1382, 1487, 598, 431, -137, 597, 2511, 1882, 1536, 2412,
-    1640, 76, 1094, 1717, 610, 875, 963, 1436, 2213, 1856, 1238, 2029,
-    1627, 1419, 1734, 1989, 1817, 3256, 3656, 1842, 265, 1412, 2167, 1155,
-    2038, 2805, 2974, 3241, 3291, 2556, 1207, 1165, 1980, 1032, 1050, 1498,
-    1012, 1555, 727, -857, -268, -1035, -3636, -2958, -1258, -450, -4, -757,
-    -2458, -2523, -2064, -807, -67, -536, -267, 211, -1059, -1086, 82, -308,
-    -1342, -1629, -1228, -513, -377, -1208, -1511, -342, -1253, -2204, -2686, -1444,
-    -791, -1048, -1324, -2216, -1536, -959, -996, -637, -808, -1061, -1284, -23,
-    718, -549, -1052, -801, 521, -198, -748, 350, 1255, 593, -1329, -33,
-    461, 318, -409, 7, 1555, 2028, 183, 584, 1554, 1640, 455, -73,
-    864, 1669, 2005, 161, 459, 1370, 1223, 172, 612, 1605, 133, -318,
-    532, 2248, 2428, 1572, 488, -205, -17, -359, 674, 1808, -196, -1462,
-    581, 1875, 1346, 178, 1179, 1497, 1106, 576, 1466, 1275, 80, 312,
-    192, 195, 618, 740, 628, -63, -651, 306, 1278, 1251, 334, 887,
-    1203, 13, -789, -716, -825, -252, 120, -512, -1705, -1105, 234, -865,
-    -2758, -3078, -1854, -1318, -1946, -3265, -2377, -1702, -2464, -2757, -2057, -960,
-    -695, -1255, -1364, -1083, -1372, -1184, -1646, -2163, -1533, -1095, -1741, -1587,
-    -2290, -2304, -1352, -1286, -1141, -510, -555, -952, -1201, 201, 17, -975,
-    -1250, -780, 57, -127, -768, -529, 699, 858, 481, 227, -12, 158,
-    943, 986, 1071, 923, 1356, 1890, 1970, 2110, 1365, 1529, 1491, 2062,
-    2176, 2238, 2536, 2498, 1337, 1190, 1587, 251, -452, 1096, 1547, 922,
-    435, 248, -259, -393, 674, 817, 880, 611, 909, 1113, 1313, 1490,
-    1310, 689, 1010, 835, 618, 328, -158, 34, 585, -548, -237, 562,
-    -168, -950, 93, 1201, 1168, -648, -700, -264, -712, -362, -149, -690,
-    -1008, -807, -1195, -934, -1629, -2041, -1015, -1201, -1443, -1381, -1086, -938,
-    -1062, -1285, -805, -39, 284, -432, -1076, -1496, -975, 32, 670, -242,
-    -778, -150, -131, -180, -496, -1162, -186, -293, -895, -1091, -312, -75,
-    385, 907, 891, 315, -517, -211, 661, 531, -7, -324, 223, 399,
-    63, 1210, 912, 147, 457, 772, 1334, 685, 762, 1486, 1574, 1385,
-    799, 1640, 1527, 1215, 474, -860, -746, 651, 1199, 1233, 673, 55,
-    112, -726, -725, 361, -141, -263, -179, 320, 287, 449, 812, 585,
-    432, -520, -153, -395, -796, -514, 76, -1062, -1359, -345, -506, -1645,
-    -608, 497, -330, -838, -1313, -536, 200, 361, 821, 645, 625, -189,
-    -490, 560, 516, 671, 1228, 767, 349, -51, 313, 580, -159, -407,
-    -704, -131, 1408, 1841, 1479, 324, -877, -195, -139, -1069, -1475, -938,
-    -1227, -820, -902, -2002, -1885, -1229, -829, -960, -1496, -1442, -373, -556,
-    127, 675, 200, -54, 557, 1954, 1790, 546, 83, 630, 706, 558,
-    239, -133, -151, 200, 258, 813, 129, 38, 473, 261, 266, 92,
-    401, 230, 422, 1472, 1789, 1742, 2208, 1972, 1494, 1463, 1518, 2017,
-    915, 12, 553, 684, -171, -41, 629, 655, -462, -730, 84, 427,
-    -73, -358, -378, 73, 709, 1065, 974, 298, 739, 750, 698, 1188,
-    1369, 648, -18, -55, 378, 430, 782, 605, -559, -1249, -235, -82,
-    -693, -1094, -831, -701, -882, -758, -790, -1213, -1232, -482, -281, -703,
-    -939, -993, -807, -816, -1251, -1411, -1344, -871, -409, -261, 215, 661,
-    232, -356, 487, -109, -1428, -1678, -1457, -1313, -926, -808, -1234, -2206,
-    -2232, -1431, -574, -624, -1493, -842, -240, -147, -66, -375, -793, -103,
-    683, 410, 501, 963, 1206, 1337, 1077, 484, 932, 1347, 707, 584,
-    518, 1020, 751, 197, 377, 105, -290, 275, 470, -419, -637, -13,
-    465, 1348, 1713, 2314, 1824, 1715, 1619, 1352, 1383, 1671, 2116, 2533,
-    1946, 1252, 1060, 1038, 1273, 1987, 1652, 1294, 922, 822, 77, -771,
-    -934, -895, -1438, -733, -820, -1465, -1808, -2177, -1932, -1386, -1498, -1563,
-    -1871, -1258, -638, -420, -577, -1452, -1639, -1033, -1019, -512, -241, -657,
-    -1516, -1214, -636, -500, -322, -485, -546, -1109, -1180, -902, -1203, -825,
-    -111, -349, -770, -1058, -457, 403, -622, -1269, -578, -219, -674, -99,
-    537, 63, -551, -692, 425, -101, -1253, -346, 1110, 1139, 1421, 1753,
-    559, -471, -164, 394, 167, 227, 210, -231, -764, -935, -255, 17,
-    -448, -1328, -1393, -251, 298, 195, 349, 363, -437, -1364, -752, -243,
-    -358, -350, -96, -251, 203, 315, 289, 406, 1, -435, 422, 1061,
-    732, 677, 949, 1080, 470, -204, 20, 323, 513, 1291, 1702, 1586,
-    1464, 886, 14, 48, 1007, 1064, 658, 566, 411, 286, 582, 589,
-    -239, -545, 77, 627, 305, 398, 806, 553, 1132, 1306, 726, 834,
-    1657, 1616, 836, 456, 565, 317, -65, -31, 331, 965, 558, -17,
-    -614, -662, -764, -486, -862, -1251, -1313, -822, -903, -1981, -2055, -1737,
-    -1611, -2178, -2888, -2676, -1643, -1076, -605, -286, -536, -761, -1026, -780,
-    -87, 837, 756, 153, -52, -56, 621, 1091, 1245, 742, -30, -547,
-    -571, -838, -1160, -1259, -708, -791, -846, -562, -800, -814, -640, 221,
-    255, 206, 180, -105, 164, 1613, 2768, 1849, 493, 966, 1436, 582,
-    878, 1613, 1915, 1703, 1405, 1075, 1791, 2253, 2624, 2805, 2354, 2269,
-    2137, 1513, 1598, 1623, 1787, 1664, 737, 601, 590, 86, 299, 740,
-    77, -313, 234, 1123, 1747, 1346, 623, 1176, 1168, 147, -82, -288,
-    -500, 176, 836, 442, -721, -400, -75, -1166, -1789, -1592, -1673, -1491,
-    -1824, -1916, -1728, -1390, -1791, -2008, -1804, -1752, -2158, -1999, -1588, -1645,
-    -1054, -728, -971, -1450, -1582, -1619, -1350, -1039, -856, -1700, -2348, -2099,
-    -2437, -1951, -1947, -2129, -1261, -1238, -2182, -2248, -848, 114, -714, -1382,
-    -1049, 73, 1070, 697, 1173, 2255, 2666, 2039, 2412, 2409, 2287, 2949,
-    3014, 3335, 3919, 3724, 3096, 2825, 2700, 2834, 2219, 2124, 2252, 1779,
-    2246, 2893, 3533, 3171, 2945, 2165, 1291, 878, 717, 534, 209, -52,
-    72, -96, -137, -134, -73, 356, -99, -489, -467, -374, -574, -213,
-    41, 11, -24, 466, -36, -869, -592, 27, 840, 429, -569, -936,
-    -1125, -2194, -2320, -2105, -2786, -2565, -2419, -3250, -3431, -2545, -2959, -4087,
-    -3662, -2719, -2579, -1906, -1704, -2026, -1859, -1773, -1749, -1039, -368, -532,
-    -187, 1156, 1231, 994, 1220, 833, 1256, 2328, 2101, 1939, 1847, 2097,
-    2488, 1710, 442, -151, -281, 16, 143, 650, 995, 1100, 530, -568,
-    -300, -313, -908, -737, 256, 467, 762, 1001, 779, 451, 585, 350,
-    369, 1041, 2255, 2044, 1512, 1406, 1005, 461, 37, 179, 132, -94,
-    -620, -234, 146, -558, -1317, -1107, -727, -903, -1028, -1459, -1405, -670,
-    -458, -1309, -1666, -1562, -1150, -382, -141, -552, -898, -180, 718, 474,
-    -364, -548, -277, -343, -338, 26, 621, 233, 220, -179, -1060, -889,
-    353, 286, -495, -71, 979, 1235, 447, 361, 687, 1458, 1690, 1294,
-    1042, 1153, 1106, 1395, 1606, 908, -308, 101, 789, 1055, 1108, 850,
-    -41, -326, 195, 146, -306, 158, 512, 413, 488, 646, 996, 1001,
-    496, -192, 250, 141, 451, 401, 178, 654, 589, -209, -515, -275,
-    -691, -1231, -1330, -1517, -1910, -1687, -1835, -2582, -2774, -2750, -3444, -2920,
-    -2498, -2400, -1774, -2561, -3592, -2513, -1497, -2111, -1915, -894, -732, -1250,
-    -1181, -743, -728, -634, -509, -226, 215, 521, -9, -90, 285, 172,
-    -71, 97, 243, 78, 126, 394, 238, -305, -216, -167, 533, 518,
-    168, 506, 748, 715, 1215, 1903, 996, 51, 526, 1547, 1730, 1075,
-    799, 1267, 1208, 942, 840, 844, 1105, 852, 251, 56, 626, 1321,
-    1547, 568, -152, 40, 501, 698, 474, 889, 833, 257, 125, 312,
-    198, 453, 741, 378, -507, -415, 51, -444, -536, -345, -305, 119,
-    604, 759, 1005, 305, -209, -817, -477, 232, 49, 98, 433, 157,
-    -612, -898, -984, -1191, -598, -96, 148, 25, 301, 247, -556, -959,
-    -607, 83, 981, 1277, 728, 386, -362, -551, -90, 103, -243, -436,
-    -344, -372, -341, 339, -242, -1210, -1223, -1200, -1072, -709, -165, -262,
-    -565, -945, -1221, -1553, -1470, -1291, -1358, -1697, -1165, -1113, -804, -555,
-    -860, -530, -99, -811, -1086, -117, 34, -482, -322, 164, 277, 477,
-    126, 48, 689, 773, 549, 917, 1532, 1248, 1421, 1649, 948, 372,
-    587, 498, 80, 54, -107, 24, -129, -285, -1017, -747, 620, 424,
-    -361, -967, -658, -29, -22, -337, -546, -1724, -2127, -957, 560, 1124,
-    654, 301, 905, 1457, 1624, 1176, 1061, 924, 529, 826, 1222, 1380,
-    1463, 1456, 1126, 592, 713, 524, 445, 1021, 1566, 1460, 1134, 895,
-    1101, 1281, 1234, 315, -173, 184, -273, -1022, -705, -277, -39, 429,
-    1003, 1434, 738, 162, 669, 1003, 692, 1054, 1400, 1098, 1135, 948,
-    804, 755, 84, -1428, -1279, -772, -1126, -1486, -1606, -2334, -2645, -1670,
-    -1708, -2003, -2001, -2225, -1945, -1236, -696, -313, 153, -401, -728, 42,
-    1002, 1271, 802, -443, -562, 28, 177, -268, -1128, -1214, -519, 31,
-    -616, -1007, -653, -664, -1929, -1650, -634, -791, -2047, -2815, -1730, 369,
-    1577, 419, -51, 517, 635, 480, 1350, 1446, 1589, 1679, 1857, 2124,
-    2813, 2722, 1411, 742, 386, 332, 541, 1080, 1330, 1216, 504, -277,
-    136, 453, -155, -609, 45, 630, 602, 213, 922, 1254, 1043, 709,
-    114, 751, 1255, 617, 291, 1479, 1067, 761, 941, 1093, 1699, 1653,
-    706, 324, 703, 447, 179, 13, 688, 355, 255, -252, -1159, -1486,
-    -2118, -1816, -1144, -1356, -839, 53, -804, -1463, -1530, -1554, -2238, -2525,
-    -2005, -1671, -449, 672, -316, -1028, -419, -438, -725, -716, -2, -167,
-    -259, 267, 464, 163, -233, -12, 771, 657, 883, 1474, 740, 342,
-    257, -430, -395, 113, -349, -1156, -944, -487, -513, -542, -1082, -1393,
-    -1002, -598, -1043, -400, 725, 824, 852, 1440, 991, 89, 477, 995,
-    752, 814, 1329, 1003, 328, 593, 613, 212, -524, -1503, -1367, -927,
-    -681, -894, -587, -416, -444, -244, 184, 1662, 1961, 1265, 309, -153,
-    511, 845, 1153, 1447, 1366, 877, 410, -148, -455, -459, -498, -702,
-    -1377, -1360, -861, -687, -729, -1522, -1799, -1616, -1474, -963, -1145, -572,
-    223, -56, -248, -179, 80, 607, 685, 302, 923, 1267, 1391, 794,
-    709, 604, 703, 1786, 1636, 934, 327, 148, -167, 154, 63, -198,
-    -268, -552, -1058, -366, 902, 802, -100, 156, 846, 89, 348, 1133,
-    742, 462, 773, 677, 87, 62, 439, -241, -1688, -1707, -1139, -1125,
-    -1264, -1840, -1596, -812, -827, -1385, -1309, -929, -1007, -735, -28, 212,
-    135, 104, -26, 452, 1491, 1329, 1156, 1224, 519, -140, -137, -147,
-    -339, 63, 526, 485, -337, -572, -467, -744, -529, -625, -994, -405,
-    -175, -192, -707, -560, 252, 34, -558, -1016, -656, 123, 257, -502,
-    -590, 126, 775, 1065, 635, -366, -1022, -378, 149, -121, -219, -269,
-    -507, -648, -904, -1320, -667, -317, -359, -320, 285, 649, 834, 1304,
-    1112, 1594, 2452, 2718, 1670, 507, 1257, 2666, 3365, 2585, 1705, 1481,
-    1146, 1343, 1808, 1567, 956, 324, 265, -224, -344, -63, -763, -1437,
-    -876, -320, 322, 380, -397, -1203, -1002, -837, -829, -234, -237, -612,
-    -230, -469, -1336, -1369, -844, -855, -1189, -518, -119, 77, 67, -119,
-    -212, -161, 199, -453, -696, -33, -126, -1154, -1676, -1731, -1711, -1367,
-    -1360, -1955, -2590, -1508, -752, -614, -664, -502, 429, 951, 673, 77,
-    436, 843, 1394, 1925, 2359, 2600, 2088, 742, 202, 793, 1700, 1794,
-    1093, 689, 631, 667, 656, 947, 1253, 1099, 805, 1456, 1287, 1486,
-    1537, 1167, 991, 328, -21, -385, -729, -1154, -1181, -989, -1046, -1772,
-    -2358, -2306, -1726, -1977, -2000, -1149, -507, -744, -883, -608, -1163, -1053,
-    -478, -442, 211, 308, 722, 786, 367, 181, 306, 94, -41, 166,
-    315, 844, 886, 257, -165, -383, -459, -59, 433, 311, 159, -102,
-    376, 657, 392, 231, -87, -208, 548, 1359, 1086, -420, -1407, -662,
-    107, 581, 976, 899, 1368, 1540, 742, 327, 561, 433, 239, 423,
-    154, 320, 240, 444, -173, -723, -570, -659, -516, -668, -599, -58,
-    -158, -1005, -586, 289, 273, -140, 170, 368, 130, 881, 471, 271,
-    254, 3, -108, 426, -155, -810, -568, -739, -1304, -1055, -251, -234,
-    -908, -201, 361, 767, 1522, 1230, 1168, 1588, 2096, 2242, 2659, 2186,
-    1329, 775, 981, 1215, 1207, 1059, 276, -94, 341, 598, 557, 407,
-    -73, -489, -197, -91, 92, 415, 65, -210, -1040, -746, 317, 1966,
-    220, -1393, -1129, -1590, -1445, -3001, 123, 1583, -1668, -2089, 1108, 3510,
-    1384, -2006, -3198, -3769, -1947, -1186, -1731, -5104, -2145, -1523, -2299, 224,
-    -2682, -5114, -5725, -6472, -3765, -564, 1293, -703, 1062, 132, 1843, 2478,
-    2363, 2024, 841, 1695, 4655, 4482, 525, 383, -409, 1378, 1234, -461,
-    -172, 622, -1908, -1375, 2003, -1505, -842, 1245, 821, 1969, -1360, -38,
-    -2949, -1053, 1008, 608, 3397, 4573, 3901, 2318, 1024, 2344, 3056, 1273,
-    3786, 1292, 917, 4371, 2889, 3562, 5180, 3648, 4703, 1829, -322, 94,
-    469, 129, -1355, -193, -153, -314, -1665, -530, -2211, -4417, -2699, -614,
-    -2510, -1693, -2634, -2748, -2863, -2396, -772, -618, -1280, -1615, -2782, -1326,
-    -2123, -1469, -2306, -3559, -2826, -3087, -1336, -980, -1206, -1098, 489, 926,
-    538, 1643, 1452, 1239, 2048, 1429, 1770, 1757, 2291, 3237, 3656, 1860,
-    968, 1515, 1058, 1888, 218, -132, 82, 1185, -449, 177, 634, -564,
-    -1696, -1427, -2367, -2302, -2083, -1037, -370, -314, 371, -329, -1058, 808,
-    563, -13, 423, 44, 456, 640, -1641, -1378, -1680, -1119, -740, -1005,
-    -2155, -2910, -3813, -2696, -3202, -3348, -1360, -815, -1771, -1397, -786, -467,
-    488, -1605, -1490, -1076, 1331, 1524, 1265, 3018, 1767, 991, 2477, 2221,
-    2141, 1794, 1972, 1060, 2109, 1802, 1786, 287, -510, 699, 623, -820,
-    704, -3, -7, -590, -1124, 294, -412, 720, 1050, 250, 1556, 1646,
-    2634, 2612, 2003, 2494, 2305, 3493, 2923, 2147, 1959, 2180, 1873, 1648,
-    2146, 1708, 295, -451, -913, -909, -1582, -2008, -2254, -2713, -2415, -1088,
-    -95, 1256, 939, -482, -1668, -2113, -1074, -186, -309, -1349, -770, -172,
-    -564, -1069, -2117, -2435, -2100, -3108, -1683, -1145, -892, -1757, -3546, -2547,
-    -2362, -945, -1476, -2519, -1751, 2, 1194, 588, 26, -1266, -1652, -785,
-    3, -378, 804, 387, 973, 916, -128, 611, 1409, 411, -784, -963,
-    -262, 114, -971, -2060, -491, -965, -1208, 1603, 1893, 473, 266, 1440,
-    2085, 1898, 2116, 1122, 1504, 2547, 2034, 2457, 3108, 334, -103, 461,
-    1219, 840, -146, 23, 295, 704, 359, 1521, 1226, 842, 1256, 2492,
-    1909, 1618, 882, 257, -176, -556, -742, -498, 295, 543, 360, -502,
-    -1018, -529, 220, -727, -1695, -2627, -3240, -2446, -1615, -1841, -816, -1797,
-    -1947, -4, -77, 251, 590, 490, 398, -835, -120, -359, -208, 955,
-    812, 183, -736, -1388, -1629, -460, -510, -1506, -452, 667, 353, 1112,
-    1126, -105, -214, 1100, 1136, 930, 2462, 2925, 1796, 2016, 1146, 1725,
-    1028, 905, 3016, 2313, 2370, 2194, 2323, 647, 1014, 1062, -386, -687,
-    -617, 849, 1294, -175, -564, -26, -1076, 477, 1324, 1493, 903, 174,
-    835, -1348, -2012, -921, -866, -170, -114, -670, -722, -893, -1184, -492,
-    -815, -1255, -1372, -1548, -748, -937, -2171, -3176, -3236, -2321, -1948, -2055,
-    -1618, -1992, -3135, -1632, -1121, -2374, -2822, -3034, -1648, -1324, -2057, -1838,
-    -1765, -1581, -1331, -1553, -1369, -1110, -236, -108, -245, -1259, -1151, -750,
-    -130, 1132, 580, -1071, -202, 1025, 696, 484, -760, 225, 1528, 1407,
-    2655, 2048, 1409, 1898, 1545, 2150, 2660, 2440, 1719, -364, 36, 823,
-    1052, 754, -149, -146, -600, 710, 1385, 1074, 1812, 2786, 2856, 2604,
-    1275, 1189, 1624, 1450, 1335, 1560, 3026, 2569, 1676, 1401, 1592, 1350,
-    760, 397, -274, 38, 182, -164, -528, 810, 1045, -621, -1146, -345,
-    -686, -687, -421, -1426, -231, 477, -679, 90, 255, -628, -1060, 123,
-    481, 227, -1171, -1230, -863, -1099, -674, -571, -1993, -1914, -1046, -1068,
-    -866, -508, -502, -811, -1314, -1079, -1345, -752, -817, -572, -522, -75,
-    1048, -138, -640, -760, -314, -359, -1038, 465, 929, 289, 262, -715,
-    -326, 562, -1373, -1234, -828, -216, 262, 696, 549, 156, -424, -383,
-    -189, -417, -906, 253, 1398, 167, -148, 222, -538, -643, -223, -43,
-    -317, 623, 485, 270, 961, 559, -345, 215, 702, 516, 1139, -541,
-    -218, 747, -119, 143, 320, 365, 875, 1432, 2228, 1514, 104, 484,
-    696, 359, 186, -184, -636, -63, 885, 53, -853, -1254, -2177, -1238,
-    151, -255, -819, -1103, -824, -931, 806, 566, -431, 373, 1167, 851,
-    797, 395, 317, 1367, 628, -1336, -575, -26, -152, -59, -751, -785,
-    342, 186, -604, -739, -401, -388, -890, -1116, -1231, -1453, 257, 588,
-    -698, -931, 1068, 1378, 568, 429, 1535, 971, 8, 736, 1673, 1470,
-    1781, 831, 1122, 840, -62, 690, 938, 1110, 214, 139, -19, -521,
-    -207, -860, -1317, -1644, -2061, -1167, -736, -1574, -1142, -1212, -1218, -553,
-    286, 1535, 625, 66, 437, 136, 1149, -35, -479, 427, 1320, 934,
-    667, 672, -157, -693, -248, -1013, -1318, -433, -261, -596, -943, -91,
-    -1220, -715, -79, -714, -1654, -863, -712, -913, -1280, -1006, -559, 58,
-    -499, -1665, -1808, -815, -146, -4, -27, 176, 187, 1415, 1413, 1044,
-    1403, 1236, 1575, 2032, 1217, -100, 452, 473, -150, 13, 564, 353,
-    -1201, -891, -196, -228, -1704, -928, -431, -1499, -2093, -1697, -677, -738,
-    -1418, -920, -1209, -1125, -191, 955, 292, 113, 39, 256, 502, 1130,
-    1671, 1810, 2920, 3323, 1511, 1389, 3801, 3503, 1635, 2015, 3099, 2000,
-    439, 1204, 1402, 276, 63, -744, -502, 829, -170, -410, -396, -150,
-    -993, -1005, -689, -59, -381, -462, 241, -422, -244, -151, -41, 436,
-    -476, -380, 194, 377, -25, 14, 213, -498, 387, -424, -819, -833,
-    -674, -1243, -1112, -37, -347, -1482, -1476, -906, -2009, -3346, -1740, -699,
-    -1800, -2873, -1773, -1951, -3953, -3685, -572, -203, -871, -1658, -1373, -430,
-    143, -18, -618, -1288, -832, 27, 168, 109, 205, 593, -28, -556,
-    370, 157, 369, 1152, 651, -293, 906, 804, 531, 1440, 2122, 868,
-    898, 909, 1085, 1907, 1592, 602, 1191, 2771, 2334, 581, 914, 1450,
-    1816, 2697, 1690, 1203, 1864, 2689, 1919, 1129, 2231, 2601, 1981, 902,
-    2853, 2599, 2183, 1183, 131, 171, 514, 674, -262, -1170, -1117, -452,
-    -1326, -889, -342, -930, -1063, -1473, -470, -654, -1631, -1785, -359, -869,
-    -1538, -1385, -1233, 103, 1, -1345, -902, -1880, -2507, -1443, -731, -1178,
-    -1574, -1917, -2540, -2451, -2882, -1818, -2075, -1955, -1490, -2376, -2639, -2432,
-    -1889, -976, -1819, -2048, -1293, -1393, -1388, 371, -395, -812, 364, 584,
-    1206, 1105, -630, -878, 860, 1953, 1218, 651, 521, 761, 1201, 1262,
-    1862, 1229, 1898, 2782, 1958, 1265, 1094, 1007, 193, 665, 1178, 1582,
-    1658, 1486, 1553, 960, 1253, 2233, 1226, 1553, 2598, 2001, 1077, 1342,
-    1894, 2225, 2521, 1538, 1473, 1882, 2191, 2003, 1123, 1564, 2849, 1889,
-    87, -315, 645, 616, 350, 435, 229, -276, -285, -210, -194, -548,
-    -575, -942, -1666, -1180, -748, -508, -1181, -1297, -1788, -1657, -741, -556,
-    -591, -1316, -1715, -1457, -1134, -1090, -1062, -1169, -1375, -1586, -725, -274,
-    21, -917, -1874, -2408, -1213, 242, -747, -1904, -994, -744, -1014, -128,
-    241, -687, -680, -349, 652, 591, 138, 242, -45, -689, 265, 196,
-    -474, -1302, -763, -825, -1388, -863, 352, -171, -229, -55, 50, -1,
-    532, 304, 294, 72, -13, -88, -241, -69, 630, 1312, 1620, 1123,
-    1132, 1017, 876, 591, 834, 820, 1313, 2281, 1726, 888, 714, 628,
-    899, 554, 187, -184, -391, -510, -218, -87, -122, -476, -84, 319,
-    129, -89, -158, 239, 1427, 495, -19, 705, 1006, 826, -291, -623,
-    -89, 1239, 1099, 909, 103, -1026, -595, 449, 1118, 693, 226, -258,
-    13, 193, 1136, 1066, 1011, 1379, 1329, 667, -304, -778, -142, 962,
-    750, -566, -1435, -1070, -1064, -614, -497, -1132, -461, 814, -289, -1114,
-    -319, -602, 50, 599, -44, -478, -612, -1403, -1917, -1141, -506, -1202,
-    -1909, -960, -165, -979, -1794, -1672, -2015, -770, -981, -2099, -1593, -936,
-    -1804, -1762, -1423, -1578, -1540, -578, -762, -441, -614, -375, -263, -250,
-    156, 227, -264, -308, -24, 187, -152, -165, 150, 323, 498, 778,
-    1005, 1010, 1163, 710, -85, -908, -226, 608, 269, 281, 246, 44,
-    302, 775, 1209, 1843, 1409, 1140, 441, 378, 667, 199, 266, 1278,
-    1504, 1262, 1260, 258, -565, -370, 137, 695, 1255, 650, 779, 1159,
-    281, 400, 1479, 899, 483, 540, -108, -217, -162, -279, -172, -447,
-    -421, 268, 330, 434, 157, 419, 190, -459, -894, -1491, -930, 102,
-    -26, -828, -468, -314, -499, 85, 965, 933, 460, -131, -56, 737,
-    961, 604, 581, -95, -1132, -1049, -322, -156, 336, 536, -222, -1233,
-    -822, -1120, -1087, -660, -951, -1568, -675, -502, -1650, -1939, -1268, -1426,
-    -1258, -862, -706, -438, 146, -894, -1413, -771, 109, 123, -185, -42,
-    380, 323, -272, 11, 592, 50, -443, -197, -535, 161, -66, -196,
-    -715, -1207, -577, -200, 487, 622, 618, 345, -16, 80, 290, 129,
-    238, 928, 1113, 1192, 934, 727, 637, 989, 789, 168, -52, 563,
-    798, -252, -725, 154, 719, 497, 429, -56, -162, -198, -423, -429,
-    58, 1197, 1483, 988, 643, 464, -48, 1067, 2202, 2042, 1721, 1061,
-    443, 224, -399, -1176, -831, 474, -194, -1168, -641, -345, -27, 311,
-    -196, -315, -440, -120, -230, -460, -1215, -860, -200, -889, -1380, -1015,
-    -434, -380, -1149, -1323, -1316, -1779, -1656, -854, -369, -506, -186, 68,
-    -256, -532, -1245, -2072, -2178, -1983, -2005, -1131, -271, 129, -740, -1202,
-    -660, -605, -360, -81, -550, -1200, -681, 89, 435, 128, -47, -558,
-    -387, -636, -1566, -1412, -1167, -974, -887, 239, 1139, 695, 232, -131,
-    135, 303, 222, 479, 1008, 782, 834, 1353, 1844, 1279, 1240, 1955,
-    2025, 1848, 1904, 1938, 1568, 1528, 2043, 2523, 1631, 585, 1204, 1432,
-    707, 212, 578, 662, 223, -4, 272, 483, 437, 137, 582, 234,
-    -376, 176, 108, -499, -392, -362, -79, 770, 217, 82, 90, 152,
-    139, -236, -148, 680, 1345, 268, -141, 897, -149, -1179, -805, -560,
-    -599, -728, -738, -1291, -2361, -1528, -359, -174, -494, -320, -648, -1364,
-    -2609, -2473, -1555, -990, -130, -9, -1228, -1788, -1333, -312, -274, -704,
-    -1023, -328, 52, 153, 558, -213, -284, 855, 535, -86, 27, 528,
-    -150, -237, -127, -271, -379, -866, -1372, -1194, -1030, -189, -157, -1260,
-    -1594, -1483, -1024, -626, -674, -313, -961, -1686, -665, -446, -1050, -1085,
-    -848, -243, 466, 391, 99, 482, 791, 919, 426, 703, 1327, 1446,
-    1212, 844, 742, 1700, 1467, 1153, 976, 1252, 1059, 1188, 1193, 1593,
-    1390, 907, 1430, 1114, 454, 834, 846, 335, 90, -133, 79, 638,
-    849, 779, 861, 606, 581, 971, 1582, 1222, 67, -832, -143, 648,
-    1206, 1353, 775, 586, 1163, 528, -334, -6, 717, 690, 634, 55,
-    346, 1394, 720, 91, -700, -905, 654, 1339, 563, -333, -1141, -192,
-    -39, -1074, -1142, -950, -392, 325, -265, -1368, -1489, -956, -358, 234,
-    -69, -721, -1033, -1068, -55, 93, -851, -1100, -530, -1014, -2023, -2506,
-    -1875, -1124, -678, -1300, -2336, -1850, -1181, -1171, -642, 123, 236, 677,
-    64, -481, -1014, -187, 556, 291, -200, -1298, -1548, -293, -193, -653,
-    -883, -864, -625, -1273, -1512, -889, -803, -341, 671, 61, -806, -1038,
-    -917, -394, 578, 503, -1008, -16, 895, 649, 1495, 2176, 2349, 2053,
-    957, 544, 85, -276, -37, 374, 644, 1353, 1774, 562, -133, 490,
-    28, -605, -662, -1188, -740, -247, -489, 111, 874, 338, -242, -661,
-    -381, 440, 162, 119, 964, 1485, 1119, 1127, 2038, 1318, 515, 1049,
-    667, -82, -379, 151, 617, 465, 617, 305, -296, -519, -697, -390,
-    41, 526, 634, 116, -449, -998, 446, 1271, 966, 700, 1667, 2130,
-    2349, 2820, 1468, 653, 735, 1247, 1257, 253, 188, 1098, 1383, 938,
-    -33, -53, 375, 326, -92, 59, 649, 825, 366, 706, 1408, 857,
-    -67, -1314, -1399, -1392, -919, -989, -1321, -1471, -760, -360, -782, -1593,
-    -1888, -1677, -1254, -2113, -2913, -2133, -889, -1021, -1588, -1143, -1661, -2118,
-    -2107, -1195, -381, -1056, -2281, -2503, -1465, -566, -969, -1322, -1738, -1903,
-    -1644, -1852, -1976, -2242, -2113, -1901, -1464, -1092, -1336, -1250, -1459, -2099,
-    -2161, -333, 1186, 255, 34, 922, 1080, 349, 1156, 2067, 1662, 1651,
-    2309, 3378, 2339, 1582, 2138, 2935, 2842, 2306, 1982, 1333, 618, 1374,
-    2147, 2045, 1897, 1665, 2044, 1689, 1715, 2230, 1298, 436, 1106, 1895,
-    2086, 1936, 2141, 2136, 1904, 1246, 1343, 1361, 1638, 866, 844, 1414,
-    860, 1149, 1265, 447, -691, -1767, -1034, -486, -998, -692, -434, -603,
-    -1502, -1191, -854, -808, -619, -1073, -1569, -1598, -1275, -634, -326, -406,
-    -1269, -1341, -1032, -1152, -2183, -2181, -1980, -2131, -1888, -944, -628, -562,
-    -662, -908, -1841, -2383, -1797, -1202, -865, -924, -1052, -870, -957, -1535,
-    -1263, -634, -407, -223, -183, 171, 331, 592, 638, -295, 140, 1030,
-    -23, -289, 446, 596, -105, 817, 1028, -249, -448, 206, 689, 82,
-    469, 1587, 1220, 262, 1262, 2110, 1840, 1599, 1910, 1905, 1776, 1019,
-    710, 1327, 1883, 948, 622, 1314, 1152, 710, -63, -1472, -1558, -584,
-    -186, 103, -148, -395, -249, -965, -1225, -355, 155, 175, -892, -1648,
-    -800, -167, -692, -950, -775, -497, -697, 371, 387, -221, 106, -24,
-    68, 231, 112, -344, -1033, -838, -742, -1222, -1737, -1799, -1239, -1214,
-    -1256, -1380, -1271, -976, -67, -287, -231, -761, -689, 76, -110, -425,
-    463, 1143, 651, 417, 1520, 2537, 1706, 513, 901, 686, 262, 428,
-    175, 212, 1328, 1654, 938, 305, 962, 1876, 1675, 609, 303, 1147,
-    798, 764, 1245, 1146, 299, -41, 787, 1176, 120, -81, 820, 967,
-    381, -259, -706, -659, 183, 554, -111, 120, -583, -1574, -754, -328,
-    -185, -239, -481, -20, -99, -3, -148, -293, 50, 14, 100, 273,
-    12, -473, -967, -863, -1527, -1660, -974, -1436, -1985, -1434, -1239, -1643,
-    -1318, -1037, -666, -1667, -1558, -344, -464, -682, -752, -1011, -1302, -925,
-    -853, -1099, -1127, -1126, -1665, -1275, -494, -435, -1594, -2104, -1502, -1020,
-    -1260, -226, 1317, 1204, 938, 1012, 1200, 1584, 876, 1219, 1716, 1292,
-    1324, 1378, 961, 10, 1298, 2543, 2079, 719, 596, 1058, 972, 1877,
-    2240, 1555, 719, 536, 498, 1162, 1942, 1506, 1176, 1156, 1176, 675,
-    912, 881, 231, -147, -607, -386, -137, -386, -216, -51, 210, -105,
-    -483, -262, 192, 80, -107, -643, -165, 814, 1121, 1153, -40, -826,
-    -954, -189, 519, 53, -691, -582, -168, -397, -671, -1025, -2169, -2151,
-    -1472, -1660, -698, 29, -1673, -2356, -1663, -1582, -1825, -2581, -2658, -2127,
-    -2140, -1574, -862, -449, -524, -528, -30, -430, -483, -204, 262, 664,
-    341, 109, 457, 1021, 1640, 1620, 887, 1278, 1087, -160, 80, 787,
-    -204, -499, 890, 971, 391, 56, -148, -451, -627, -586, 239, 639,
-    854, 1998, 1458, 947, 1082, 1674, 2089, 2368, 1147, -648, 725, 1511,
-    905, 311, -457, -1124, -1286, -807, 645, 1151, -310, -1559, -1872, -1383,
-    63, -225, -1493, -1383, -496, -596, -1384, 337, 1066, 747, 1014, 624,
-    213, 333, 400, 511, 1482, 1251, 548, -65, -380, -54, -309, -643,
-    -472, -744, -892, -1488, -2127, -2403, -2579, -2250, -1173, -791, -1688, -1342,
-    -1025, -660, 943, 1474, 650, 279, -181, -333, 814, 1342, 439, 730,
-    1950, 2720, 2394, 1609, 1432, 1362, 1082, 664, -168, -139, 562, 922,
-    364, 142, 445, 677, 1354, 696, -126, -331, 252, 1118, 1219, 352,
-    -57, 285, 448, 614, 3, 211, 675, 1735, 1562, 1047, 1496, 2348,
-    1212, 604, -93, -670, -99, -347, -588, 231, -584, -1981, -1376, 110,
-    601, -95, -748, -1065, -1402, -1039, -1124, -1179, -1209, -710, -442, -446,
-    -299, -467, -768, -826, -817, -1345, -1522, -1731, -2198, -1851, -1372, -909,
-    -278, -238, -486, -776, -850, -1166, -1870, -1869, -1288, -834, -798, -1531,
-    -2098, -1602, -1050, -1375, -2141, -1176, 314, -7, -933, -557, -170, -791,
-    -691, -256, 76, -15, 448, 817, 876, 1079, 1895, 3162, 2364, 744,
-    931, 1480, 641, -54, 763, 2149, 3038, 3490, 2934, 1707, 814, 405,
-    1631, 2779, 2399, 1696, 966, 996, 2163, 2141, 1761, 1250, 323, 668,
-    1840, 2001, 1514, 551, 504, 843, 1188, 1035, 994, 1258, 1189, 1537,
-    1511, 760, 141, -109, -278, -387, -146, 445, 543, -462, -654, 389,
-    488, 591, -108, -1284, -763, 72, 217, 303, -735, -1838, -1411, -902,
-    -848, -1871, -2978, -2962, -3484, -3290, -1837, -1014, -2036, -2851, -2974, -2304,
-    -1664, -798, -990, -2362, -2263, -1708, -1191, -993, -315, 1094, 794, -689,
-    -2035, -1883, -1015, 45, 711, -351, -1010, -689, -123, 540, 1065, 442,
-    -639, -220, 96, -55, 166, 215, 316, 731, 554, 756, 1099, 47,
-    -862, -77, 1339, 1437, 767, 462, 524, 800, 1552, 1844, 1516, 782,
-    581, 805, 1275, 630, -4, 145, 852, 731, -22, -505, -771, -1292,
-    -701, 234, 97, -20, 144, -338, -333, 1179, 1795, 1111, 655, 653,
-    825, 1523, 2144, 2284, 1961, 918, -624, -1204, -103, 861, 922, 148,
-    -1232, -1621, -1574, -1692, -1465, -1558, -1389, -539, 5, -471, -315, -633,
-    -797, -1154, -508, -500, -926, -602, -62, -254, -716, -662, 550, 586,
-    -175, -710, -299, 53, -385, -557, -1346, -1295, -429, 513, 1474, 1115,
-    -108, -230, -594, -1042, -433, 413, 568, 1251, 1049, 970, 1884, 2290,
-    1882, 1740, 1402, -219, -331, -314, -37, 825, 1163, 1310, 1133, 273,
-    241, 972, 762, 748, 789, 95, 480, 578, 610, 307, -119, 356,
-    1167, -241, -851, 905, 1779, 1088, 336, 345, 89, 482, 512, -8,
-    172, -257, -1597, -2838, -2702, -2974, -2878, -2547, -2986, -3600, -4231, -4377,
-    -3956, -2676, -1631, -1559, -2461, -3029, -2274, -1609, -929, 50, 503, -95,
-    -25, 1169, 2527, 2235, 1339, 1052, 727, 720, 788, 736, 377, -42,
-    23, 589, 650, -163, -536, -1088, -1289, -116, 822, 685, 412, 502,
-    651, 1433, 1928, 1162, -99, -734, 420, 1815, 2026, 2102, 1859, 1804,
-    2077, 2095, 1492, 369, 481, 604, 848, 1214, 705, 979, 1051, 938,
-    929, 415, -16, 248, 338, 529, 991, 817, 449, 751, 2076, 2929,
-    2304, 1966, 1514, 1444, 1493, 896, 263, 554, 792, 391, 325, -180,
-    -1374, -2229, -2481, -2706, -2427, -1788, -1623, -1582, -2302, -2993, -2052, -1374,
-    -1252, -991, -1233, -699, 238, 268, 727, 714, 626, 771, 1008, 637,
-    -70, -543, -1045, -1304, -698, -968, -1263, -999, -788, -957, -1826, -2204,
-    -1966, -1399, -633, -644, -1002, -879, -863, -829, -53, 555, 342, 230,
-    724, 406, 569, 1058, 1300, 748, -9, 278, 719, 1145, 1190, 1063,
-    700, 717, 457, 881, 1550, 1684, 847, -574, -1738, -1267, 180, 413,
-    -974, -2100, -2393, -2124, -1611, -1513, -1931, -1678, -560, -398, 523, 1321,
-    1336, 522, 136, 274, 819, 1709, 1543, 1000, 1229, 1885, 1353, 1697,
-    2369, 1981, 941, 786, 682, -510, -417, 368, 870, 769, 323, -111,
-    -379, -372, 41, 618, 76, -1010, -1540, -1241, -733, -663, -1882, -2132,
-    -998, -1345, -1075, -1315, -700, -962, -859, -354, -927, -1101, -105, 450,
-    -129, -1115, -882, -125, 411, -301, -267, 63, 160, -776, -1212, 593,
-    1383, 162, -21, 1072, 1210, 595, 312, 931, 1104, 945, 1349, 1722,
-    1640, 895, -340, -37, -554, -485, 22, 615, 977, -1936, -1406, 1885,
-    -1961, -2252, 1969, -2095, -5164, 344, 6512, 2345, 3445, 4431, -3539, 5736,
-    11375, 5134, 2460, 1989, 739, 2207, -2128, 6427, 6025, 3302, -3107, -4949,
-    -7200, -2673, -3547, -466, -5292, -10700, -8973, -6272, -8397, -6368, 1860, 1681,
-    -6366, -4041, 5230, 9414, 6471, 4537, 5902, 5398, 13716, 5956, 1332, 3669,
-    9238, 9836, 11263, 2289, 1489, 3656, -3076, -8151, -8144, -9935, -7381, -8757,
-    -8229, -3706, -8087, -11979, -7059, -6184, -3026, 2840, 5438, -3963, -7262, -3849,
-    -2394, 1760, 6810, 6003, 1937, 4330, 454, 606, -273, -8960, -5783, -1696,
-    3976, 8956, 7813, 632, 1644, 9476, 6625, 7819, 5003, 3429, 4557, 6739,
-    5429, 68, -1404, -700, -2925, -3923, -6703, -5163, -3016, -2849, -4771, -5859,
-    -3639, -5663, -7831, -7754, -5285, -5020, -5365, -5765, -6093, -4150, -3238, -1933,
-    -1072, -1711, -2299, -4340, 508, 5808, 7627, 4244, -388, -3741, -1351, 3808,
-    4057, 898, 1815, 2131, 5034, 7446, 4796, 2299, 5967, 4907, 4103, 2268,
-    5914, 7705, 9551, 6424, -477, 1421, 5497, 5372, 3885, 5, 4288, 5715,
-    4438, 3512, 7353, 2914, 111, -1906, 1562, 3760, 3115, -2251, -4386, -2367,
-    -7, -1316, -4107, -3280, 1302, 1846, -353, 2917, 1446, -256, -1704, 10,
-    -2387, -3687, -4619, -8810, -5650, -3123, -8733, -7198, -1736, -4558, -7636, -5526,
-    -3332, -4829, -3607, -3792, -5218, -4518, -980, -6314, -4413, -2396, -2932, -1371,
-    -981, -4575, -5816, -2503, -1115, -2810, -2874, 3072, 4336, 3209, 1882, 6134,
-    2633, -3194, -2869, -1578, -274, 4480, 3882, -37, -1489, 1667, 1038, 2290,
-    2404, -1456, 2453, 6145, 4332, 5554, 5918, 496, 980, 3819, 1714, 1963,
-    5460, 4417, 4064, 6121, 4137, 6088, 4798, 2381, 1905, -99, 1964, 4216,
-    2074, -333, -1288, 1937, 1550, -3272, -2113, -3267, -4392, -2404, 699, 3280,
-    1894, -1409, -3285, -2807, -2276, -989, -1173, -2861, -1754, -4368, -4641, -3655,
-    -7646, -4240, -4024, -7963, -4702, -4916, -4522, -3372, -6431, -4828, -4610, -6490,
-    -1382, -84, -4983, -3402, 1064, 1260, -2484, -2156, 461, -25, 1075, 917,
-    -1627, -408, 2436, -617, 2449, 3483, 631, 6110, 2642, -3693, 944, 3900,
-    3211, -529, -1940, 3943, 2536, -1922, 1790, 4144, 4047, 6094, 5537, 5623,
-    4692, 4062, 5189, 6162, 6196, 7201, 6431, 6427, 4975, 2714, 7114, 3828,
-    2130, 2096, 1998, 825, 1539, 1540, 2010, 3207, 1027, 708, -868, 1086,
-    -460, -743, -935, -2124, -3500, -4302, -6470, -4334, -1387, -1195, 1643, -228,
-    -4662, -4987, -3166, -5174, -6066, -4884, -2576, -3530, -4987, -6489, -3984, -5211,
-    -7290, -5292, -3916, -5256, -5541, -7199, -9184, -6968, -4259, -3208, -5162, -6591,
-    -5763, -611, -782, -2534, -2130, -484, 154, -1019, -852, -192, 1352, 4261,
-    2485, 653, 1940, 3455, 4918, 3343, 6797, 4276, 1284, 3240, 1701, -721,
-    293, -995, 3775, 6551, 2839, 1131, 3795, 2689, 3084, 5940, 5865, 5354,
-    7699, 5362, 4279, 5546, 5777, 7285, 6946, 4935, 1662, 5062, 4160, 347,
-    3986, 5310, 2988, 376, 599, 3527, 1884, -2498, 1143, 386, -1071, -457,
-    219, -2200, -3682, -2848, -3263, -4470, -5615, -6807, -3859, 249, 1363, -1323,
-    -4636, -3913, -5095, -3187, -2541, -2639, -2583, -3075, -7177, -8274, -6386, -2900,
-    -4440, -4457, -2218, -4210, -4132, -5438, -6408, -6714, -4546, -3575, -4978, -2742,
-    -3049, -5453, -3164, -2194, -4017, -3484, -1078, 1431, -141, 1021, 1622, 120,
-    480, 1496, 2446, 4407, 3273, 4398, 3718, 5031, 6862, 6726, 3742, 2851,
-    3286, 1709, 3477, 6134, 6036, 4405, 6689, 6989, 7232, 7383, 7147, 7226,
-    5948, 6312, 4315, 5844, 6198, 6985, 7468, 7735, 4622, 2010, 1417, 2634,
-    3675, 2150, 2509, 1811, 2411, 2423, 7, 1238, 718, -1719, -2849, -2915,
-    -993, -295, -1689, -4330, -4305, -3284, -1777, -2117, -7311, -6909, -4686, -6891,
-    -7812, -783, -2718, -6433, -5224, -3397, -6219, -3788, -3355, -5534, -7473, -6043,
-    -1642, -3854, -6221, -2924, -4683, -6799, -5017, -3647, -3441, -4567, -4058, -3226,
-    -2410, -5164, -3511, -3730, -1807, -1532, -5117, -4463, -2988, -2751, -727, 19,
-    -3653, -1072, -1929, 25, 4220, 3802, 3141, 2532, 2073, 681, -186, 2342,
-    3863, 5997, 8022, 5631, 1549, -1641, 870, 3009, -56, 1019, 3370, 4321,
-    4062, 2670, 3619, 3235, 1803, 1118, 3715, 6083, 5957, 5465, 3573, 3017,
-    4796, 4312, 3793, 2480, 3510, 3488, 2771, 3948, 2443, -1197, 692, 2882,
-    357, -865, 1817, 3297, -398, -2044, 1443, 3569, -1558, -2960, -2003, -1571,
-    -1941, -2669, -5618, -2715, -4402, -5837, -6277, -4135, -1527, -1830, -1468, -2406,
-    -2495, -3642, -2238, -884, 380, 1873, 1689, -702, -2850, -2627, -2384, -2096,
-    -2039, -1288, -4220, -2615, -2119, 193, -1882, -3698, -3714, -2745, -2089, -3359,
-    -4051, -995, 938, -485, -1454, 1118, 2173, -1873, -728, 1882, 2163, 1316,
-    1912, 1319, 2095, 2838, -428, -102, 4375, 4146, 3126, 1356, 4699, 7719,
-    2394, -418, -110, 423, 3323, 1523, 3392, 3925, 1040, 3616, 3878, -549,
-    56, 1516, 3722, 2771, 3483, 2825, 2170, -895, 2187, 5296, 3957, 2797,
-    3361, 727, 1956, 1670, -1009, -497, 1193, 405, -1837, 217, 1051, 2779,
-    -775, -3242, -4465, -3722, -1756, -1283, -4044, -4905, -1793, -3182, -5497, -6107,
-    -3785, -2466, -6047, -8900, -6998, -4930, -2008, -2531, -1285, -222, -2416, -2883,
-    -456, -2610, -3142, -2950, -3628, -337, 504, -1770, -5017, -1983, -169, -2300,
-    -1239, -1034, -2466, -1766, -2555, 265, -365, -2685, 1320, 2749, -664, -471,
-    1158, 1085, -101, -197, 911, 2276, 3849, 2131, 985, 5077, 6780, 4822,
-    2204, 2966, 3447, 1714, 4717, 4621, 5314, 6261, 3933, 1969, 4019, 6314,
-    5406, 2524, 1463, -374, 2377, 2762, 1953, 1482, 579, 3664, 4201, 3335,
-    2607, 3446, 3564, 1878, 3339, -3, 971, 3001, 3368, 2945, 3474, 1464,
-    -477, 233, 1735, 405, 2184, 3119, 93, 223, 305, -54, -10, -1262,
-    -1594, -3097, -2279, -332, 1284, -2313, -4455, -3035, -2468, -3746, -3130, -2935,
-    -1551, -1519, -3429, -5523, -5572, -8419, -8044, -1587, -136, -3336, -2130, -2381,
-    -1018, -1325, -986, -784, -3348, -2452, -3068, 593, -2920, -3195, 1307, 187,
-    -1215, -4039, -3284, -900, -776, -1746, -2637, -20, 483, -2461, -1288, 2612,
-    1485, -1046, -93, 1638, -885, -1386, 1965, -1545, -397, 2273, 784, 1507,
-    1676, -3, 1225, 1945, 2990, 1410, 1356, 1917, 89, 1057, 2155, 4466,
-    4349, 2009, 3543, 7019, 4255, 2142, 3859, 3289, 4398, 2673, 2358, 2034,
-    -667, 3014, 2257, 2243, 423, -104, 2495, 379, -1027, -1131, -522, -714,
-    -141, 923, -501, -214, 918, 1150, -2069, -2101, -383, 405, -914, -792,
-    612, 182, -2376, 276, -1466, -2967, -2, 350, -1125, 1008, -1935, -6102,
-    -1663, 320, -3629, -4433, -1046, -1480, -3916, -1494, -1028, -3311, -5921, -4616,
-    -5566, -5599, 893, 2904, -852, -3466, -2328, 107, 2222, 73, -268, 714,
-    1932, -586, -3031, -1275, -604, -590, 1249, 603, -3493, -1575, -111, -70,
-    -165, 63, -1023, 949, 59, -173, 3594, 345, 500, 3741, 680, -322,
-    735, 2099, 1572, 2770, 2363, 609, 1291, 3264, 3790, 2480, 107, 1219,
-    2825, 2641, 2417, 3478, 434, 2602, 3904, 3023, 4765, 4679, 3601, 2581,
-    -1094, -768, 1860, 2635, -1796, -869, 655, -106, 491, 927, 253, -258,
-    -763, 675, 1330, -161, -246, 2421, 2949, -247, -1970, -108, -1760, -3824,
-    -128, 1686, -423, -778, -3094, -3225, -4046, -3660, -1742, -2284, -1194, -3266,
-    -5417, -4757, -1632, -1060, -627, -3930, -6533, -5287, -2473, -2299, -3372, -1675,
-    -1921, -4197, -3342, -536, -2138, -3446, -2686, -1778, -3079, -3633, -684, 848,
-    45, 414, -1344, -1032, -1041, 138, 1884, 1015, -1053, -2015, -2941, -34,
-    1378, 1779, 512, 279, -1447, -172, 969, 1208, 182, 645, 223, -570,
-    -650, 1020, 2336, 2763, 2358, 156, 2486, 4653, 3811, 2061, 892, 2073,
-    3975, 2560, 1902, 2206, 2542, 4377, 3575, 1502, -663, 2643, 2776, 816,
-    418, 1409, 2854, 1527, -1416, -811, -152, 1905, 3417, 3292, -462, -1795,
-    -257, -660, -1737, -2601, -2073, -775, -271, -65, 161, 405, -287, 691,
-    112, -2855, -1229, 759, -808, -656, -13, -1700, -1247, -1978, -1293, 1212,
-    264, -1978, -1352, 858, 336, -1715, -3248, -3485, -2851, -1151, -449, 1640,
-    -428, -3787, -4535, -2072, 522, -133, -2173, -3454, -2729, -1357, -1587, -1697,
-    -3728, -1857, -848, -1005, -1297, -883, -366, -4089, -3070, -1446, -957, 1571,
-    509, 2045, 2938, 237, 516, 1663, 97, 508, 2697, 2662, 369, 1585,
-    881, -311, -1135, 1749, 1594, 682, 1311, -401, 382, 1087, 49, 2676,
-    1835, -378, 208, 1558, 2067, 2794, 2867, 1126, 2032, 2129, 4431, 3097,
-    1212, 1855, 1162, 2990, 4541, 2718, 2166, 3201, 4339, 3498, 4785, 4435,
-    4062, 3241, 2787, 1392, 615, 2224, 2740, 2537, 4300, 3661, 2135, -294,
-    -3591, -138, -153, -65, -279, 597, -463, -962, -1876, -1767, 349, -373,
-    -643, -606, -1638, -1230, -1612, -251, -63, -495, -1101, -2118, -1671, 1380,
-    1795, 262, -1768, -1482, -2286, -2122, -1421, -3437, -3764, -561, -258, -3453,
-    -1667, 139, -2623, -5833, -4436, -2767, -2103, -1495, -3498, -3610, -1850, -2245,
-    -2754, -1108, -1955, -3952, -3380, -3002, -2233, -3453, -4054, -3656, -1494, -2455,
-    -4148, -3598, -263, 178, -354, -534, 1073, 1123, -1250, -2308, 575, 1925,
-    1663, 1711, 1201, -252, -2362, -3371, -3039, 172, 2092, 565, -198, 774,
-    -1763, -3581, -379, 972, -411, 1167, 3608, 3061, 2314, -416, 324, 2382,
-    1851, 365, 847, 4222, 5229, 4984, 2330, 1095, 2450, 1995, 5136, 4584,
-    2344, 5519, 5754, 3378, 1820, 2463, 4132, 4168, 3202, 1937, 4730, 6367,
-    2771, 3619, 5324, 5666, 4542, 2111, 2167, 2491, 480, 614, 764, 675,
-    763, 1050, 132, -357, -558, -1024, -866, -712, -1350, -1235, -2217, -1047,
-    688, -117, -1667, -1011, -3832, -5187, -3443, -1214, -905, -1837, -3315, -3354,
-    -2640, -3458, -1293, -3116, -3301, -942, -1803, -6344, -7540, -3282, -2977, -3806,
-    -5624, -7046, -4371, -2318, -5085, -6194, -6846, -5007, -3900, -6206, -4673, -3486,
-    -3272, -4544, -4825, -3381, -2574, -2540, -2857, -4530, -4411, -157, 1949, 2961,
-    2209, 1837, 1580, 1444, 1868, 4947, 5454, 2669, 1940, 2696, 2496, 1078,
-    430, 1405, 3108, 4115, 1433, -1922, 889, 761, -981, -1862, -309, 599,
-    1153, 1626, 2012, 1833, 1096, 2064, 2183, 2619, 3771, 3677, 532, 1487,
-    4648, 5050, 3004, 3614, 2931, 1256, 2522, 3386, 4871, 3147, 2061, 432,
-    945, 1962, 1868, 1145, -69, 1053, 1133, 518, 1805, 1440, 519, 2017,
-    2855, 121, -1922, -391, -2121, -2685, -2393, -1250, 770, -480, -3346, -3242,
-    -1478, 382, 815, -577, -1864, -597, -219, -238, 108, -46, -1628, -1894,
-    -168, -1257, -1062, -389, -1101, -1858, -1366, -399, -727, -2829, -2074, -1380,
-    -1105, -1950, -2331, -2468, -3284, -2468, -3142, -2704, -4180, -3382, -2327, -1678,
-    -1344, -2567, -2761, -2083, -1482, 535, -201, -530, -752, 406, -164, 871,
-    1924, 218, -191, 419, 648, 907, -1120, -1528, 1158, 3487, 1894, 883,
-    850, 1679, 2257, 152, 666, 1213, 1169, 2308, 794, 566, 1685, 1277,
-    -401, 551, 928, -619, 724, 374, -875, -899, 354, 2585, 2597, 1156,
-    1204, 1875, 2207, 3564, 4353, 2071, 769, 1729, 4139, 4211, 1413, 1620,
-    3281, 3278, 2691, 2211, 799, -532, 1124, 2172, 4002, 3852, 2021, -678,
-    1532, 3697, 1914, 1795, 2724, 2366, 3081, 1493, 541, 720, -476, 2515,
-    5060, 1183, -4147, -3157, -1494, -2643, -3184, -3105, -1481, -1436, -403, -1784,
-    -3458, -2770, 115, 1714, 291, -2129, -321, -236, -1325, -663, 247, -151,
-    741, 1000, -716, 15, -1018, -1291, 494, -110, -2696, -1369, -322, -638,
-    604, -1608, -2115, -716, -1495, -684, 745, -757, -2051, -3118, -1360, -922,
-    -1527, -2829, -1916, -1715, -676, -1539, -3277, -2753, -1327, -1665, -1553, -832,
-    -620, -371, 189, -6, -2636, -2918, -2996, -2532, -38, 522, -188, 1226,
-    2239, 575, 136, 1417, 1264, 1579, 1994, 3194, 1891, 10, 120, 2533,
-    3269, 898, 822, -64, -358, 1182, 1948, 1712, -307, -204, -1196, -2407,
-    -1264, 1140, 654, -266, -328, -1920, -2959, -1868, 1610, 1061, -2376, -172,
-    3658, 1430, -566, 1994, 3286, 1631, 787, 2109, 3433, 2568, 1753, 2095,
-    3799, 4453, 2525, 939, 1510, 2183, 1419, 1252, 2776, 1605, 1637, 2067,
-    3149, 3358, 2162, 968, 2015, 885, -113, 522, -2087, -3008, -235, -1838,
-    -1454, 690, -352, -2479, -1073, -2354, -2513, -1362, -2654, -2341, -954, -941,
-    181, 1515, 686, -269, -836, -649, 779, -431, -1942, -546, 106, -883,
-    -2233, -2847, -1845, -2383, -3882, -2809, -2577, -3427, -3105, -2601, -3447, -4105,
-    -3918, -2469, -2146, -1392, -1827, -2110, -2255, -1360, -1692, -1774, -906, -842,
-    -612, -635, -679, -430, 396, 383, -456, -74, 1787, 2070, 598, -2035,
-    -2072, -970, 2641, 4535, 1932, 1605, 4019, 3643, 2847, 3497, 1293, 1214,
-    3407, 3326, 1800, 2219, 2575, 1215, 1541, 3299, 2872, 2272, 2221, 2230,
-    2076, 1968, 2796, 3227, 1857, 2566, 1980, 1696, 2465, 2149, 2443, 1597,
-    889, 1932, 75, 108, 2026, 4540, 4708, 2181, 584, 657, 478, 1141,
-    1805, 813, 393, 2651, 2364, 1233, 923, 540, -132, -279, -1775, -2473,
-    -1317, -486, -1449, -241, -486, -3102, -3134, -1202, -1384, -2464, -1413, -1393,
-    -3398, -3432, -3557, -4058, -5320, -4593, -4205, -3789, -3694, -3309, -4308, -5174,
-    -4896, -3581, -3135, -2709, -2397, -1833, -1882, -2068, -776, -235, -428, 348,
-    380, -289, -1245, -298, -2, -279, 844, -340, 139, 973, 1473, -1142,
-    -2373, -777, 337, 709, 1263, 253, -61, 958, 78, -762, 584, 1113,
-    -709, -896, 802, 1047, 1007, -892, -1926, 17, 1159, 694, 420, 2514,
-    2437, 639, 800, 2643, 2323, 1979, 1460, 1651, 2892, 3575, 1915, 3364,
-    4572, 3538, 2465, 4262, 4459, 2461, 3662, 3079, 2247, 2249, 2638, 2921,
-    2761, 3051, 1111, -177, 36, 665, -199, -635, 368, 415, -762, -707,
-    -997, -475, 687, 1185, -394, 116, -169, -142, 248, 22, 10, 626,
-    129, -213, -413, -483, 628, -653, -2248, -1770, 63, 1903, 646, -1901,
-    -2781, -1092, 476, -643, -560, -1657, -1195, -196, -535, -39, 464, -1395,
-    -1283, 1495, 205, -1591, -1404, -188, -491, -258, -893, -1638, -1453, -1841,
-    -2413, -3128, -3386, -2940, -2587, -2992, -1646, -1928, -2727, -2073, 146, 338,
-    -1588, -1769, -1067, -1097, -1025, -580, -1826, -1572, -255, -1452, -925, -1503,
-    -561, 565, 1218, 2625, 986, -1521, -619, 1438, 1876, 606, -1065, -1578,
-    -413, 743, 737, -658, 349, -303, -2557, -992, 322, 137, -1004, -1647,
-    -1718, -894, -502, -1550, -922, 358, 266, -1330, -1725, -950, -44, -652,
-    -1691, -2032, -872, 1140, 1604, 580, -64, -617, 66, 1116, 2298, 4442,
-    2950, 2523, 3778, 4102, 4944, 4256, 3344, 5101, 5137, 3873, 4224, 3600,
-    2310, 2904, 2916, 2229, 1914, 272, 460, 1945, 1912, 1523, 1236, 1152,
-    -119, -1291, -642, -274, 228, 236, -1032, -1090, -757, 198, 653, 130,
-    -1021, -1487, 519, 1300, 710, 653, 928, 614, 67, 842, 2030, 999,
-    244, -484, -549, 702, 1172, -5, -934, -1314, -2287, -2818, -2096, -273,
-    -625, -673, -1072, -3143, -3493, -1809, -765, -1732, -2063, -1773, -512, -934,
-    -2728, -2014, -3067, -3034, -2460, -2875, -2352, -2274, -1519, -1243, -344, -1707,
-    -3466, -3192, -1882, -456, -1102, -1400, -1491, -2056, -2763, -1333, -968, -2027,
-    -1820, -2538, -2778, -2038, -336, 927, 140, 187, 1914, 1877, 958, 1683,
-    2265, 1620, 422, 1187, 2626, 2398, 1154, 559, 1442, 1704, 745, -291,
-    101, 539, -482, -1294, -194, -809, -3136, -2018, 1275, 1789, -82, 535,
-    1856, 1218, 1258, 3226, 3362, 1576, 2121, 2247, 1826, 2263, 2288, 1993,
-    1780, 976, 1089, 2583, 2244, 1614, 2244, 3184, 2345, 2615, 2501, 1465,
-    2068, 1127, -291, -552, -1025, 403, 1734, 1276, -235, -200, 502, 827,
-    869, -461, 866, 2064, 2315, 1295, -237, -516, 422, 2055, 1365, -251,
-    987, 2191, -696, -669, 1589, 1301, 50, 380, 2380, 2905, 799, -1534,
-    -559, 1550, 492, -1249, -943, -949, -824, -1564, -1373, 21, -240, -558,
-    -837, -964, -1038, 311, 1104, 1260, 1278, 663, -87, -490, 109, -147,
-    -423, 769, 1923, 874, -300, -685, -631, -1845, -2988, -2431, -1512, -2267,
-    -3139, -2289, -1979, -3578, -4646, -2744, -835, -329, -946, -817, -2099, -2775,
-    -2507, -1017, -115, -1132, -2072, -2702, -2488, -1667, -1214, -1454, -1598, -1523,
-    -85, 48, -267, -823, -2451, -1990, 480, -326, -1828, -1951, -1616, -1494,
-    -1690, -3130, -3143, -1463, 316, 621, -1023, -661, -77, 583, 645, 420,
-    -590, -749, 446, 1515, 713, 291, 1349, 935, 916, 826, 936, 120,
-    -154, 645, 1170, 2039, 1886, 1919, 2215, 999, 1362, 3213, 4282, 3957,
-    4080, 4336, 3849, 4586, 3255, 2028, 3018, 4931, 4568, 3551, 3259, 3585,
-    2283, 1960, 3174, 2494, 3097, 3842, 2416, 1620, 1401, 1144, 1694, 1140,
-    245, 430, 1732, 1854, 1113, 341, 1508, 1195, 596, 1914, 2285, 1200,
-    554, 822, 1210, 624, 656, 1029, 118, -544, -1204, -308, 629, -184,
-    -755, -658, -1554, -2371, -2654, -2666, -1898, -1719, -2125, -2986, -2330, -1327,
-    -1184, -2612, -2720, -1772, -2320, -1700, -1451, -1100, -1467, -2765, -2430, -948,
-    -1740, -3594, -4378, -4316, -3793, -4235, -4414, -4383, -3551, -2914, -2914, -1853,
-    -1201, -991, -1691, -1845, -1349, -236, -1442, -2266, -791, 1417, 1995, 44,
-    -1374, -1309, -1426, -555, -400, -1699, -515, 376, -378, -1050, -238, 534,
-    -61, -1610, -1091, -398, -88, -814, -890, 710, 1486, 410, -39, 1185,
-    1332, 1497, 2913, 2314, 1867, 2854, 3022, 1857, 1277, 2455, 2431, 1708,
-    2281, 2251, 619, 232, 1317, 1998, 1390, 2171, 2006, -323, -245, 1106,
-    726, 215, -613, 491, 1300, 266, 19, 1143, 978, 1281, 3022, 2839,
-    1860, 1806, 1786, 621, -18, 179, 934, 1203, 994, -30, -24, 360,
-    540, 1403, 996, -317, -1263, -402, -22, -1196, -1595, -1113, -749, -810,
-    -663, 79, -222, -316, -641, -1227, -513, 277, -239, -734, -112, 265,
-    1921, 1932, 260, -58, 1404, 2410, 1382, 26, -144, 469, 1843, 2589,
-    2414, 620, 407, 932, 91, -182, 282, 697, 1302, 1386, 272, 908,
-    1025, 334, 1227, 2092, 381, -728, -704, -1111, -1747, -1949, -1006, -666,
-    -2205, -3941, -4035, -3316, -3833, -4576, -4100, -3061, -3488, -4315, -3921, -3890,
-    -3421, -2559, -1455, -817, -1385, -2594, -2711, -1404, -784, -1145, -1351, -1898,
-    -2707, -1819, -371, -122, -470, -796, -1656, -1543, -656, -684, -532, -1138,
-    -2432, -2485, -206, -765, -2177, -1312, -750, -262, -1153, -1851, -1117, -780,
-    -1027, -785, -720, 89, 840, 1089, 1280, 496, 130, 838, -722, -506,
-    2305, 3960, 3811, 2201, 1648, 2701, 2406, 2379, 3025, 2981, 3229, 3713,
-    3890, 3366, 3346, 3683, 3497, 1260, 895, 2369, 3322, 2687, 2826, 5067,
-    5410, 2858, 1411, 1589, 1408, 2621, 3415, 1935, 1094, 1352, 991, 1220,
-    1151, 280, 659, 1898, 1573, 1255, 744, 253, 535, 715, 483, 976,
-    1182, 403, 323, 208, -131, 477, 818, -536, -1643, -1217, -980, -859,
-    -266, -275, -27, -770, -2176, -1902, -1326, -37, 1284, -429, -2626, -1556,
-    1021, 756, 200, -611, -1557, -939, -878, -1120, -1434, -1717, -2112, -2325,
-    -1242, -2044, -2677, -2336, -2980, -1431, -696, -859, 399, -219, -628, -307,
-    1660, -261, -2670, -2620, -2224, -1439, -1117, -4496, -5605, -4475, -1867, -1679,
-    -4142, -6689, -6234, -3415, 3144, 1615, -1676, -916, -3665, -849, 8957, 10116,
-    3488, 7541, 8066, 978, 59, -3232, -8676, -1033, 5265, -6861, -10504, -7214,
-    -8523, -7025, -2272, -1850, -9847, -2092, -4689, 41, -5172, -1420, 6481, 9738,
-    9225, 8939, 7402, 1619, 5565, 15670, 11508, 8373, -753, 2396, 6477, 9415,
-    14066, 11790, 8632, 4, -4966, -203, -525, -2353, 1871, -6444, -5969, -11499,
-    -3035, -5117, -5089, -7726, -7835, -1525, -4304, -2450, -12097, -8027, -5267, -7327,
-    2319, 5573, -3046, 226, 5072, -1865, 4677, 12298, 10842, 3401, 12805, 8454,
-    2645, 10880, 11813, 6519, 7358, 7123, 1543, 3670, 1231, 3354, 1206, -5357,
-    1118, -4386, 1309, -5396, -3707, -3168, -8382, -8528, -5278, -10344, -11286, -7315,
-    -7554, -7120, -6852, -1748, 734, -3935, 233, 4235, 2120, 723, 704, -1799,
-    1897, 1846, 4198, 3890, 534, 3393, 8696, 6188, -954, -8796, -2042, 1088,
-    -236, -515, -5563, -858, 2818, -502, -1809, -210, -2529, 1976, 5946, -205,
-    3058, 3905, 4866, -1578, -1053, 2047, 6314, 3965, -849, -2238, 1535, 527,
-    3377, 7554, 4585, -1254, -1921, -3085, 4296, 668, -209, -2396, 1709, 1208,
-    -2830, -1286, -3361, -7098, -3161, -26, -2356, -11388, -10232, -8088, 135, 1431,
-    -2822, -3337, 137, -2610, -4558, -1316, -3075, -1955, -829, -4079, -7667, -5569,
-    -7853, -6277, -762, 1372, -3287, -4214, -5704, -1889, -1087, -4167, -1898, -2565,
-    272, -648, -768, -1739, -2494, 394, 4079, 2468, -2516, -49, 299, 1899,
-    5296, 3125, 4410, 3413, 3333, 7377, 8054, 5712, 5670, 7679, 13938, 9797,
-    2898, 3880, 671, 5336, 9366, 7615, 3689, 6853, 4880, 2256, 4355, 5020,
-    7153, 8588, 8677, 2108, 1650, 5843, 7274, 10417, 7221, 3447, 1866, 700,
-    5676, 6153, 227, 1617, 4322, 2548, -1206, -2933, -823, -536, -2352, -3489,
-    -1965, -1567, -3831, -2284, -2568, -1363, -2437, -3943, -5270, -3318, -5207, -10224,
-    -8638, -8147, -7005, -1194, -3311, -2983, -6110, -6610, 36, -71, -3429, -2863,
-    1506, -2470, -4303, -2975, 673, -3163, -1965, -3441, -5279, -5904, -3397, -2191,
-    -2290, -4113, -5732, -7901, -6976, -10150, -7353, -2305, -1198, -2607, -3324, 553,
-    1425, -1904, -2203, -962, 18, -1246, 890, -903, -1547, -440, 3608, 6887,
-    5621, -667, 1549, 6959, 7599, 3788, 7681, 5467, 375, 2802, 1915, 877,
-    1949, 5062, 602, 746, 2991, 3307, 3058, -303, 312, -313, 1958, 3179,
-    3292, 1851, 3235, 5660, 2488, 4829, 7980, 4453, 1544, -2320, -1911, 2160,
-    2626, 2042, 801, 989, -294, 626, 987, 2394, -1772, -5960, -4345, -54,
-    -1929, -4019, -4343, -3932, -4222, -4078, -2137, -4273, -5728, -4960, -6543, -5732,
-    -7819, 1148, 76, -3296, -4635, -2763, 2386, -1079, -4279, -4519, -2027, -2579,
-    -3480, 206, -1166, -3795, -605, 1320, 1, -3410, -3942, 1231, 2447, -1747,
-    -3014, -3533, -2007, 3028, 651, 1899, 1034, -1512, 988, 5596, 2253, 3187,
-    2705, 2045, 1957, 4412, 1562, 2069, 2392, 7444, 7267, 3399, 4545, 6646,
-    6587, 6052, 7216, 5611, 5002, 7878, 4744, 2477, -523, 2100, 5269, 7732,
-    6404, 931, -2734, -818, 650, 1782, 2563, 1650, 4197, 3205, -1506, 2223,
-    3666, 997, -609, -813, 1074, 3193, 2455, -3305, -6268, -1825, 1442, -743,
-    -4080, -289, -754, -2886, -3016, -1325, -1802, -2779, -4474, -6053, -3157, -3229,
-    -5437, -8444, -5402, -4403, -6124, -6521, -4775, -7817, -8682, -4112, -3611, -4131,
-    -6602, -7873, -3393, -2990, -2998, -1310, -4480, -1937, 187, -38, -2810, -1379,
-    1946, -273, -886, -1785, 1210, 1067, -3335, -2495, -3366, -655, -2513, -977,
-    2916, 1701, -3174, -2072, 1397, 1658, 1823, 2242, -2640, 1578, 1958, 1277,
-    3692, 2189, 244, 2588, 3329, 4571, 5498, 3558, -552, -351, 4345, 6356,
-    8347, 7121, 3972, 3913, 4962, 6157, 7312, 4515, 5946, 8753, 7849, -124,
-    -384, 395, 1307, 2920, 3403, 892, 358, 1036, 651, 1615, 884, 667,
-    4061, 1907, 3368, 2889, -1766, 451, 3101, 5404, 3859, 2008, -2221, -1997,
-    -524, 2809, 1118, -555, 545, -1953, -5258, -2028, 641, 65, -2788, -2244,
-    -3940, -3718, -1345, -2370, -2382, -3303, -3072, -5669, -7249, -5124, -4146, -3747,
-    -5051, -5361, -6196, -8187, -7920, -2221, -3735, -5333, -1424, 2043, -792, 398,
-    -743, -389, -1192, 1984, 1968, -870, -1415, -761, -1852, -69, 1568, 105,
-    -1913, -1032, -2635, -24, 1536, 1510, -1271, -1098, -328, 2678, 2756, 1615,
-    3004, 4510, 5729, 4254, 2564, 690, -1114, 2700, 6909, 4544, 3997, 5811,
-    1127, 1058, 3621, 2120, 1211, 2394, 1976, 2004, 4558, 2424, 2159, 3989,
-    709, -1842, -1208, 2222, 4363, 4391, 3641, 233, -1702, 421, 1955, 1002,
-    -333, 570, -18, 2417, 1384, -864, -3576, -492, -108, -343, -461, 559,
-    -1038, -1235, 1419, 1710, -285, 2359, 1260, -3980, -4366, -1473, -755, -2709,
-    -3969, -4360, -1966, 361, -4139, -3367, -3464, -4616, -7154, -3064, 1192, 7,
-    -3181, -5385, -4275, -3374, -1545, -1759, -3379, -1542, -1654, -1420, -2095, -4434,
-    -5676, -4634, -4509, -5990, -6136, -2371, -2078, 768, 201, 1436, 3588, 720,
-    -2551, -542, -1020, 1686, -475, -138, 2379, 2195, 1919, 1607, 2037, 41,
-    -730, 1210, 4602, 3125, 3007, 603, -267, 2813, 4419, 3526, 1197, 425,
-    606, 603, 4078, 3614, 1427, 1840, 4054, 2446, 711, 2875, 1495, 272,
-    2888, 2084, -1772, 299, 3697, 3131, 4982, 3588, 2737, 4484, 4232, 6579,
-    3706, 994, 4697, 4979, 4386, 4585, 1836, 496, -179, -2310, -3907, -1840,
-    -508, 202, -1835, -1835, 1494, 1405, 786, -2739, -2549, -1243, 2243, -1203,
-    -5166, -1843, 299, -320, -2668, -2449, -2190, -1665, -3299, -2570, -1050, -383,
-    -1128, -3780, -1802, -632, -713, -4330, -3767, -4417, -3384, -4114, -4706, -1453,
-    -3488, -4445, -514, -1360, -2112, -1422, -3564, -4210, -2452, -2711, -4993, -3048,
-    -2924, -2996, -2142, -2869, -1967, -5206, -7037, -3268, -1610, -280, 1845, -1403,
-    -339, 1185, 324, 2546, 790, -894, 168, 117, 524, 3621, 2445, -1795,
-    478, 2614, 2334, 2601, 2077, 2461, 111, 843, 3544, 5358, 2029, 923,
-    2255, 2222, 4331, 4691, 3098, 2107, 3376, 5885, 4477, 3853, 1101, 3336,
-    5563, 2983, 1818, 5340, 4930, 3093, 3881, 4371, 5712, 5442, 5590, 6154,
-    3651, 1151, 3317, 2492, 1458, 3212, 5054, 5028, 3329, 3032, 4013, 1702,
-    1866, -613, -3139, 512, 2474, 517, -661, -1286, -1431, -2358, -1337, -988,
-    -1889, -353, 234, -139, -943, 1425, 2637, -1035, -2866, -3704, -2053, -177,
-    -1739, -3973, -4262, -1919, -2580, -2745, 40, -2621, -4621, -2167, -582, -1773,
-    -4861, -4933, -5774, -882, -1366, -5744, -5415, -2759, -2293, -4470, -2283, -1466,
-    -2858, -2482, -2776, -1986, -582, 585, -2304, -1815, -2006, -4903, -2352, -905,
-    -1899, -1855, -1583, 1531, 1729, -676, 173, 1490, 3205, 1886, 2482, 3062,
-    3123, 592, -1155, -186, 364, 2178, 1530, -668, -666, -141, -158, 332,
-    377, 1180, 886, -211, -158, -124, 2484, 1876, -427, 2078, 5437, 1853,
-    -1641, -798, 643, 1961, 3330, 3530, 3185, 4550, 3472, 4392, 6925, 6356,
-    4968, 2797, 2008, 1532, 2007, 579, 1571, 6259, 5027, -129, 343, 2337,
-    3181, 4814, 4410, 2282, 1633, 3354, -1210, -5489, -3801, -260, 323, -436,
-    -2604, -6255, -5151, -4453, -3928, -4444, -2364, 392, 187, -1947, -3204, -1023,
-    -2229, -4754, -4376, -1546, 2536, 4222, -1048, -4433, -2924, 755, 1828, 1372,
-    -1175, -2102, 1249, -600, -1676, -514, -2654, -1511, -595, -3149, -6717, -3056,
-    -2384, -4137, -3110, -3067, -1261, -1474, -2576, -1221, -2436, -4697, -683, -1138,
-    -2700, -827, -387, -981, -1509, -1535, 269, 1045, 1541, 415, -3290, -4822,
-    -2741, 3286, 6353, 2431, 1414, 869, 16, 3574, 6081, 4643, 2718, 1465,
-    996, 2603, 1079, 535, 1990, 3073, 2647, 126, -1475, -147, -112, 2332,
-    1733, -1510, 167, 3140, 1779, 472, 1353, 3469, 2081, 2367, 3844, 3641,
-    1099, 182, 2194, 4163, 2373, 622, 1824, 1485, 468, -270, 2522, 2240,
-    1405, 899, 73, 372, 813, 779, 2314, 3848, 2312, -738, -1840, -2146,
-    -139, 1595, 2064, 1853, 401, -1635, -117, 2118, -76, -3784, -4772, -1824,
-    -1317, -904, -2376, -3832, -2990, -1000, -4400, -6451, -2164, 135, -2285, -3420,
-    -3553, -3069, -1140, -1868, -2507, -1770, -212, -1060, -81, 901, 292, -2119,
-    -2116, -3281, -3886, -1178, 551, -2055, -3054, -855, 677, 1634, 2122, 1308,
-    986, 1232, 1194, -1818, -1360, -618, 345, 1424, 1034, 197, -781, -629,
-    -2490, -2784, -2016, 342, -316, 375, 361, -703, -373, -750, -1354, -866,
-    -821, -1154, -445, 30, 211, 2094, 870, 1177, 3495, 2908, 4177, 4374,
-    3782, 3071, 2668, 1857, 2405, 1793, 1180, -53, 1062, 4922, 3801, 1192,
-    300, 659, 1394, 2403, 1362, -968, 135, 1701, 1511, 386, 988, 653,
-    1130, 1136, 612, 2216, 2596, -103, -682, 1144, 61, -577, 408, 1986,
-    3270, 1968, 1735, 3206, 2121, 2108, 2770, 3591, 3046, 1559, 447, 101,
-    49, 936, 753, 969, 1228, -507, -2461, -1378, 841, 1168, 1169, 1212,
-    133, -1424, -1829, -1526, -1460, -2418, -3433, -3756, -1913, 343, -2352, -5508,
-    -3434, -3177, -2403, -81, -569, -2218, -1070, -1645, -2124, -649, -1331, -2744,
-    -1787, 158, -1162, -1731, -2729, -3689, -1542, -1091, -2673, -2290, -3379, -3963,
-    -1538, 600, 959, -2258, -4291, -2438, -1199, -808, -752, -763, -1658, -2105,
-    -2841, -1481, -781, -2128, -1853, -1947, -2555, -2454, -1610, -3143, -4070, -3468,
-    -2648, -772, 180, -1248, -2084, 696, 1246, -429, -659, -1457, -620, 1442,
-    3170, 1203, -432, 2096, 1138, 2315, 4620, 2243, 2160, 2502, 401, 2488,
-    4160, 3412, 2069, 2674, 3650, 2511, 2885, 2673, 1546, 3253, 3017, 857,
-    321, 918, 1638, 1735, 2983, 3304, 3245, 3129, 1534, 2333, 4579, 4414,
-    3315, 3888, 3487, 3159, 3612, 2365, 2582, 3776, 4193, 3309, 977, 1674,
-    3721, 3583, 2355, 527, 1065, 2165, 9, -553, 558, 862, 1556, 931,
-    434, -370, -480, -670, -1853, -2899, -4036, -1759, -1404, -1186, 582, -1970,
-    -5227, -5180, -2324, -2434, -4835, -4531, -4368, -6398, -6048, -4779, -4333, -2660,
-    -2228, -3611, -4714, -3998, -957, 772, -1287, -3450, -2790, -1677, -2407, -1854,
-    17, -469, -1389, -998, -1150, -1005, -1272, -989, -767, -1210, -2581, -3638,
-    -2616, -1955, -2511, -2355, -1700, -2803, -3050, -1859, 441, -365, -2145, -1159,
-    -1754, -1116, -466, 292, 855, 494, 1342, 810, 215, 1339, 2075, 2420,
-    3135, 3131, 787, 497, 628, 769, 2804, 3967, 4335, 3103, 358, -794,
-    408, 2677, 3565, 2736, 2411, 3294, 3123, 2165, 1043, 157, 2032, 2068,
-    -1021, 69, 3748, 3400, 651, 202, 607, -547, -530, 1080, 1603, 1243,
-    1787, 1427, 976, 125, 1258, 1336, 1570, 1667, -509, -81, 595, 1226,
-    2219, 2614, 1947, 820, 1313, 2758, 1844, -719, -2025, -1604, -1052, 101,
-    1712, 801, -988, -2740, -2508, -183, -300, -761, -1265, -1576, 127, 562,
-    773, -555, -2431, -2428, -1467, -701, -2254, -1646, -637, -2200, -2418, -2162,
-    -2635, -1339, -1098, -1659, -2485, -3438, -1754, -790, -1058, -1685, -3685, -4777,
-    -4063, -2987, -1304, -570, -1306, -771, -167, 128, 1167, 1064, 410, 457,
-    -502, -869, 198, 1455, 1748, 1173, 1649, -211, -1049, 383, 656, 28,
-    -376, -478, -664, -206, 670, -410, -1054, -209, -1804, -2846, -2621, -1314,
-    326, 419, -1247, -1238, -1347, -65, 2300, 2172, 1540, 1327, 949, 1548,
-    1478, 1804, 1077, 1286, 2634, 1423, 142, 32, 246, 1200, 1439, -339,
-    -150, 1394, 1610, -335, -3107, -3252, -1252, 2017, 3518, 3513, 2240, 940,
-    1003, 3352, 5578, 4750, 1837, 459, 689, 1551, 3049, 3440, 2367, 1574,
-    963, 996, 3280, 1932, -91, 1084, 3564, 1800, 104, -77, -185, 521,
-    1963, 1395, -364, 815, 1313, -1071, -702, 222, -818, -1308, -434, 158,
-    -400, -1800, -1083, 835, 534, -2276, -1169, 678, 105, -595, 800, 1273,
-    134, -619, -1514, -481, 1655, 2221, 1312, 81, 788, -858, -2170, -1508,
-    433, 1926, 1640, -284, -2575, -2799, -1016, 504, 878, 22, 160, -1135,
-    -3038, -2623, -1532, -2614, -3909, -3310, -2808, -3170, -3775, -3950, -4459, -3614,
-    -1265, -1407, -3386, -3543, -1851, -1283, -1353, -536, -332, -2326, -1381, 900,
-    1533, 73, -1435, -903, 286, 793, -937, -1338, -55, 421, -15, 1748,
-    3045, 2954, 2442, 1505, 1207, 2419, 2394, 556, 60, 1348, 1350, 1008,
-    668, 1202, 2023, 1252, -27, 241, 407, 1215, 1510, 598, 310, 241,
-    -202, -759, -221, 946, 2005, 1899, 189, 302, 1091, 1989, 1928, 1443,
-    2457, 2164, 2042, 1632, 1416, 2907, 4727, 4360, 4238, 3878, 3721, 3921,
-    3351, 2479, 1736, 1181, 2501, 2285, 1575, 726, 165, 287, 123, 1161,
-    372, -1175, -1375, -1606, -919, -2204, -3686, -3141, -1256, 148, -158, -1135,
-    -847, -677, 474, 2187, 1901, 13, -342, -213, 240, 92, -722, -705,
-    -184, 1076, -542, -2581, -2006, -2013, -3374, -3448, -2955, -2463, -1942, -1004,
-    -887, -2449, -3579, -1757, 248, 421, -90, -1315, -2077, -1584, -614, -786,
-    -1557, -1014, 133, 793, -468, -2050, -2242, -721, 317, -937, -1828, -93,
-    272, -2443, -2839, -2116, -1763, -1814, -1437, -849, -2240, -3138, -2640, -1351,
-    -871, -2323, -2364, -764, -635, -612, -1095, -807, -264, 486, -118, -1414,
-    -93, 518, -570, 222, 145, -59, 316, -802, -51, 1805, 1431, 258,
-    846, 860, 422, 352, -473, -952, -313, 287, 562, 959, -463, -1630,
-    -1143, 195, 768, 894, 1053, 450, 58, 1578, 1291, -509, -133, 1291,
-    1671, 918, 1028, 1850, 2766, 2844, 2659, 2351, 2033, 2244, 3259, 3309,
-    2398, 2454, 2093, 1229, 1514, 2231, 2210, 2086, 2672, 4861, 6173, 5552,
-    4817, 4841, 5368, 4677, 4044, 3039, 1929, 3255, 3242, 2088, 981, 1015,
-    1322, 534, 578, 642, -1047, -592, 794, 425, 183, 62, 590, -188,
-    -1754, -2659, -1101, -267, -1600, -2502, -2690, -1783, -942, -1082, -69, -768,
-    -2835, -2319, -97, 753, -922, -2899, -2639, -2210, -2127, -2413, -2679, -2347,
-    -1678, -1875, -2329, -2078, -2522, -3651, -3572, -3791, -3787, -3054, -3172, -3907,
-    -4017, -3584, -1600, -643, -1061, -1576, -2227, -2551, -2748, -3201, -4484, -3613,
-    -1502, -643, -1469, -2750, -2380, -2120, -3179, -2319, -2311, -3148, -2147, -1720,
-    -2346, -2619, -2117, -945, -1574, -1650, -2008, -2157, -782, -1671, -122, 1631,
-    1713, 395, -543, 902, 2251, 1490, 1454, 2199, 3012, 2183, 1674, 3682,
-    3813, 1737, 1648, 3287, 2779, 1273, 1593, 2522, 2874, 3393, 3247, 2151,
-    1371, 3761, 3936, 2789, 2892, 3116, 2452, 1613, 1014, 1622, 2035, 2172,
-    2192, 1740, -142, -69, 2231, 3242, 2367, 1495, 999, 305, -401, 251,
-    1265, 1234, 1397, 1179, 715, 1048, 1683, 1868, 1706, 485, -1161, -1601,
-    -768, 153, 1172, 308, -1185, -1309, -423, 953, 1868, 2011, 2039, 2020,
-    1901, 2190, 1941, 586, 291, 395, 1055, 511, -340, -1, 891, 505,
-    596, 824, -1078, -1058, -1397, -1475, -1510, -1756, -1850, -2640, -2587, -1187,
-    -831, -1887, -3092, -3540, -2622, -2395, -1106, -436, -2292, -2168, -334, 805,
-    615, 615, 365, -1147, -1631, -980, -396, -981, -171, 557, 1388, 839,
-    -1086, -1675, -1740, -1939, -1951, -1523, -425, 1142, 465, -1305, -2098, -2174,
-    -2093, -1950, -1842, -1864, -995, -1621, -3662, -3289, -1158, -499, -1264, -2603,
-    -3130, -1483, 139, -64, -1426, -1575, 354, 54, -1144, -693, -903, -1858,
-    -1764, -1689, -1864, -538, -5, -1220, -1425, -1203, -646, -563, -792, 92,
-    415, 465, 376, 828, 108, 294, 1297, 2526, 3177, 1013, -856, -951,
-    641, 2553, 3321, 2668, 2122, 2510, 2240, 2956, 4127, 2884, 1026, 1561,
-    2098, 2020, 1665, 532, 317, 1563, 2132, -127, -689, 1409, 2618, 1895,
-    1725, 1279, -408, -188, 523, 1080, 2415, 2188, 1766, 1980, 1173, 776,
-    1476, 983, 333, 719, 1000, 907, 40, 734, 1769, 2771, 3627, 2807,
-    549, -313, -891, -1902, -1972, 189, 2517, 3114, 2720, 1817, 1263, 1378,
-    1073, -221, -373, 1083, 1536, 900, -589, -679, 685, 627, -313, -1630,
-    -970, 640, 463, -1333, -2324, -1586, -1462, -1765, -947, -1675, -2550, -2507,
-    -2115, -2976, -3691, -3745, -3110, -2017, -1763, -2069, -2354, -1174, -832, -2131,
-    -1069, -310, -720, 487, 945, -567, -819, 1104, 2004, 1511, 1379, 1625,
-    1110, 1283, 1673, 1330, 740, 1546, 826, -829, -1732, -899, -623, -596,
-    1, -698, -2232, -1985, -1365, -879, -644, -1060, -1487, -1329, -1550, -1689,
-    -1597, -1963, -1265, 282, 1478, 2615, 1328, -1579, -1566, -698, -1257, -1803,
-    -958, -413, -83, -775, -1782, -1894, -1492, -581, 374, 456, 150, -542,
-    -1251, -1546, -309, 1521, 1339, -836, -930, 209, 758, 885, 560, -482,
-    -864, -433, 188, 1259, 768, -480, 402, 940, 1057, 1968, 1390, 7,
-    -452, -224, -815, -987, -911, -917, -256, -523, -968, -928, -1164, -784,
-    22, -194, -968, -792, -780, -750, 256, 822, 113, 43, 493, 1671,
-    1317, 1152, 1306, 1746, 1590, 455, 1198, 2182, 1397, 987, 1396, 1904,
-    1569, 993, 1123, 2052, 2531, 1632, 1425, 1331, 777, 1125, 2122, 2742,
-    2568, 2437, 2340, 1411, 617, 435, 1252, 1805, 1193, 527, -604, -1151,
-    73, 1867, 2545, 763, -261, 470, 758, 308, -331, -523, -145, -2,
-    -670, -1165, -1004, -1676, -878, 556, -267, -1439, -2006, -2351, -1838, -1258,
-    -1757, -1853, -1409, -525, 48, -441, -1033, -560, -250, -579, -1098, -998,
-    316, 426, -624, -851, -624, 409, 596, 106, -780, -924, -265, -180,
-    4, -523, -1194, -751, -1041, -2078, -1521, -2339, -3643, -2689, -1914, -2421,
-    -2651, -3388, -4026, -3589, -3356, -2181, -1613, -2437, -3147, -2765, -1374, -878,
-    -158, 1340, 443, -1955, -2335, -1067, -110, -645, -1616, -1214, -261, -238,
-    -695, -196, 283, 140, 530, 1347, 266, -1411, -507, 557, 813, 771,
-    -173, -817, -620, 281, 467, 485, 527, 384, 212, -429, -595, 551,
-    1390, 780, 150, 1344, 1427, 402, 435, 1489, 2198, 1870, 2113, 2764,
-    1900, 539, 223, 861, 1062, 869, 719, -488, -1166, -432, -90, -27,
-    173, -665, -1265, -235, 720, 884, 1265, 589, -23, 154, 291, -281,
-    946, 2633, 2761, 1948, 944, 1318, 1450, 1413, 716, 1082, 2872, 3487,
-    2582, 1906, 1846, 2669, 2524, 2104, 1423, 1539, 3048, 3143, 3707, 4496,
-    4459, 4576, 3590, 2351, 1335, 1176, 1430, 1766, 1935, 917, -542, -293,
-    121, -582, -877, -707, -360, -149, -707, -1171, -649, 40, -210, -1081,
-    -1820, -2246, -1096, 43, -689, -1695, -2322, -1671, -931, -1173, -1592, -1585,
-    -2030, -2420, -1998, -1822, -1771, -1517, -707, -1290, -2618, -2534, -2135, -1554,
-    -647, -1205, -2224, -1894, -1841, -2052, -2144, -3025, -2845, -1506, -1247, -1973,
-    -3093, -3601, -3614, -2875, -1539, -1183, -2671, -2650, -2783, -2487, -804, -262,
-    -1035, -939, -432, -269, 129, -128, -926, -156, 1332, 889, -414, -630,
-    111, 490, -168, -218, -786, -639, 32, 177, 255, 130, -35, 100,
-    -558, -599, 10, 718, 382, 522, 1172, 1312, 330, -507, 123, 1198,
-    1183, 1589, 1305, 1013, 980, 1671, 2725, 3257, 3613, 3314, 2956, 2474,
-    2071, 2577, 2711, 2038, 1471, 1070, 200, -332, -229, 653, 1874, 1602,
-    741, 1233, 1168, 292, 314, 1224, 1516, 613, -42, -1431, -1802, -1237,
-    -1376, -1436, -1154, -1153, -1720, -1807, -1784, -1697, -1602, -1072, -503, -1640,
-    -2754, -2138, -117, 240, -722, -898, 400, 1596, 835, -950, -1665, -1777,
-    -799, 403, 638, -1010, -1420, -338, 292, 927, 1433, 1132, 985, 1481,
-    1188, 226, 190, 964, 1930, 2143, 1393, 674, 65, -206, 613, 1408,
-    1467, 1188, 948, 405, 137, 796, 1422, 1315, 1143, 1000, 700, 191,
-    -257, -535, -291, -357, 280, 961, 348, -164, 20, -54, 199, 776,
-    1307, 1443, 1407, -5, 87, 560, 1282, 754, -582, 326, 1801, 2055,
-    1187, 664, 333, 897, 189, -1097, 514, 800, 522, -81, 449, 1239,
-    -169, 465, 206, 1585, 1908, 933, -278, -1027, -801, -1701, -1287, -3705,
-    -4501, -3347, -1828, -1833, -3774, -3180, -3642, -4246, -2255, -2954, -3677, -2736,
-    -1250, -2009, -3893, -3655, -1557, -265, 94, -3363, 1614, 7010, 6712, 234,
-    -8546, -4980, 1908, 4672, 7944, 7318, -48, -3992, -9422, -4813, -189, -6781,
-    -8614, -10092, -9041, -4100, 2394, -7426, -10246, -4047, -6953, -10123, -4722, -254,
-    5592, 6903, 2096, 9221, 11978, 14686, 9958, 7721, 10276, 17138, 12090, 8822,
-    -391, 7361, 9732, 6841, 684, 1761, 3817, -5832, -10824, -8549, -5120, -1323,
-    -234, -4044, -57, -9719, -3350, -1064, -8387, -7011, -591, 5987, 1852, -493,
-    -2509, -3108, -1199, 7209, 3567, 4643, 2966, 6931, 13534, 4248, 186, -18,
-    -639, 10449, 11166, 7401, 11935, 9203, 8122, 2963, 12896, 7767, 3675, 2262,
-    -2489, 1486, 1578, -3055, -2456, -5411, -2102, -4913, -6641, -3743, -4266, -2736,
-    -5833, -6438, -6721, -6011, -8036, -9634, -5089, -8082, -7205, -5400, -59, -4377,
-    -7826, -6413, -2455, -6789, -7635, -2513, 1737, -2147, -1910, -2175, 4805, -1916,
-    2352, 5894, -3159, -18, 290, -2543, -3911, -2013, 220, 3205, 285, -10,
-    -3438, 2889, 6083, 6848, 5997, 2062, 454, 2566, 6516, 9024, 3296, 1864,
-    5197, 6168, 6989, 6176, 7928, 5204, 5432, 1457, 2312, 6667, 5155, -419,
-    1942, 2196, -750, -1204, 1495, -1411, 70, -2731, -5518, -3115, -2577, -2028,
-    -3831, -9851, -11311, -3707, -943, -2849, -2039, -5578, -6296, -3821, -389, 453,
-    -1818, -4400, -3641, -4505, -1589, -677, -4556, -5964, -1097, -3074, -3298, -397,
-    -605, -2449, -404, -2378, -8132, -4838, -1390, -3010, -1102, -687, -3154, -3142,
-    -1692, -184, -821, -4565, 2017, 1257, 3086, 2165, 5809, 1172, -1061, 355,
-    4799, 4091, 5487, 6597, 7064, 3500, 2220, 4322, 5443, 3638, 1724, 4556,
-    6823, 7167, 7569, 4111, 2554, 5931, 5499, 4964, 2712, 6795, 9686, 8449,
-    4263, 5400, 3897, 5173, 1825, 2549, 2815, 6270, 5220, 196, -172, 1033,
-    4214, 3226, -718, -1492, -158, 2774, 80, -921, -2714, -1792, -2252, -1550,
-    -974, -4847, -5702, -5264, -5046, -2694, -4809, -7562, -8648, -859, 840, -3748,
-    -3550, -3580, -1218, 1450, -1620, -3417, -2427, -4272, -5727, -1132, -785, -3206,
-    -1129, -4557, -6507, -3553, -2012, 83, -3118, -4229, -7258, -3597, -2599, -3439,
-    -2534, -2247, -1592, -6675, -4395, -684, 503, -4025, 452, 2648, -2084, -3032,
-    998, 2190, 2367, 800, 932, 2144, 3196, 4202, 7301, 5350, 3155, 6526,
-    7480, 4028, 2705, 2371, 684, 1803, 2659, 3627, 2172, -2604, -1596, 749,
-    5584, 7526, 3147, -1317, 300, 4231, 4698, 5847, 4357, 3983, 3391, 3370,
-    2729, -1297, -1859, 3349, 3871, 1794, -1429, -429, -345, -1477, -2703, -1092,
-    274, -381, -2719, -3063, -3871, 1625, -751, -2458, -583, -1098, -3636, -6383,
-    -6036, -6953, -2920, -1999, -4218, -5380, -9170, -4105, -1874, 2285, 1895, -2809,
-    -3399, -2944, -3179, -2803, -1933, -2449, -579, -439, -4600, -4680, 1130, -940,
-    -1610, 3, -1584, -2821, -1403, -1557, -2382, -2696, 806, -135, 1053, -3222,
-    -940, -948, -1899, 77, -721, -1398, -1071, 1550, 2796, 1213, 767, 3196,
-    2455, 1875, 1964, 5617, 6217, 4854, 1302, 3388, 3598, 2717, 7653, 7852,
-    6411, 5666, 654, 914, 1075, -7, 3305, 1306, 4446, 3590, 2573, 690,
-    -1343, 2166, 2440, 1518, 1582, 1923, 3096, 3307, 87, 4217, 4716, 868,
-    -409, 4011, 5388, 3326, 1516, 2161, 1108, 1818, 2487, -142, -2109, 1935,
-    2589, -45, -291, -2143, -3920, -1960, -3310, -3961, -1341, -2019, -4027, -5969,
-    -2951, -1029, -3055, -3932, -1792, -5335, -6927, -3296, -3558, -638, 945, -3214,
-    -364, 2678, 2955, 1990, -1721, -2543, -63, -388, -3666, -2261, 1839, -1003,
-    -2687, -4092, -1281, -1534, -3650, -2039, -1099, -2319, -443, 441, -964, -1275,
-    785, -988, 1519, -849, -3322, -2193, -71, 1509, 3089, -278, 66, -1108,
-    2235, 3683, 4860, 2452, 851, 2479, 3981, 3702, 4090, 1397, 1778, 3025,
-    4221, 3871, 3263, 4233, 3388, 4028, -575, 7, 2885, 1485, -219, 170,
-    -3566, -1724, 2168, 574, 40, 1829, 497, -1341, -325, 124, 1300, 114,
-    -1600, -3445, 121, -732, -60, 1070, -709, -4387, -3828, -1177, 1059, -358,
-    -1672, -4269, -3157, -1487, -2753, -1614, -2342, -2820, -2911, 437, -969, -4801,
-    -5839, -3411, -2661, -4754, -5233, -2707, -4234, -3258, -3563, -5412, -5541, -4763,
-    -5076, -5804, -5947, -3192, -2128, -2604, -201, 313, -3599, -2793, -2189, -666,
-    282, 258, -1270, -1428, -1356, -588, 2191, 1840, 728, 641, -265, -768,
-    609, 752, -695, 1154, 2221, 143, 1422, 628, 211, 4090, 4747, 1309,
-    171, 2238, 3464, -57, -96, 2982, 2298, 3989, 4593, 3448, 2486, 4289,
-    4244, 4074, 2897, 4348, 4391, 4448, 2988, 2469, 3734, 4301, 2616, 3297,
-    6676, 6077, 2671, 2553, 3387, 3107, 1087, 954, 1492, 469, 2825, 2656,
-    362, 486, 1616, 408, 601, -1045, -3146, -1575, 511, 646, 194, -1911,
-    -1159, -590, -1677, -1451, -2004, -3514, -1811, -2457, -1731, 745, 178, -1274,
-    -3496, -4717, -4637, -1095, -1031, -2202, -1997, -1174, -2803, -3760, -3128, -3145,
-    -3341, -1593, -3625, -4293, -2737, -2832, -3124, -1872, -4393, -6844, -5019, -3227,
-    -3612, -2002, -2139, -1678, -1243, -2991, 151, 221, -1089, -745, 628, 1608,
-    -1222, -761, 1121, 302, -166, 214, 1682, 2717, -62, 269, 2069, 2156,
-    602, 455, 1171, 2682, 2218, -197, 363, 2275, 1873, 1898, 642, 1121,
-    87, 1022, 1382, 4007, 2395, 788, 486, 1015, 2085, 3580, 3028, 2534,
-    2332, 2949, 2775, 3633, 5067, 3176, 2443, 3780, 5936, 3299, 2416, 2667,
-    4946, 6383, 3207, -621, -776, 781, 379, -759, -946, 734, 547, 222,
-    1266, 1126, -1089, -2984, 999, 2905, 37, -2166, -1633, -581, 333, -547,
-    246, -1185, 245, -1167, -928, 1558, 111, 1435, -377, -3058, -2292, -1417,
-    -1487, -3698, -60, -692, -3251, -3774, -2119, 183, -697, -1853, -867, -2615,
-    -2792, -701, -1186, -3723, -2128, -961, -1403, -1713, -5241, -2875, -1678, -2306,
-    -3020, -3328, -4366, -3568, -1966, -779, -287, -1381, -1095, -1280, -1405, -390,
-    1705, 1461, -2040, -2006, 792, 836, 1107, 416, -812, 472, 609, -1849,
-    452, 1482, 1716, 491, 635, 1395, -956, -386, 36, 93, 2399, 2622,
-    932, -424, 939, 2794, 505, 980, 1915, 3192, 3242, 1153, 3384, 3806,
-    469, 414, 3511, 3544, 2289, 2900, 2647, 2564, 1518, 1949, 4001, 1130,
-    53, 783, 1133, -843, 1740, 1847, 954, -617, -192, 1283, -572, -1860,
-    2, -440, -1365, -1464, 429, -290, -487, 110, 345, -125, 30, 363,
-    781, 2332, 2239, 2093, 1326, -476, 521, 1581, -632, -762, -90, 269,
-    689, 561, -663, -274, -1203, -303, 944, -1567, -2533, -1577, -1250, -2152,
-    -1969, -1515, -1395, -2581, -3778, -3288, -724, -2461, -2516, 175, -790, -2285,
-    -1467, -1595, -1216, -829, -932, -2591, -1254, 177, 1021, 1079, -702, 370,
-    756, 327, 1673, 1306, 1041, 1018, 1260, 1830, 1817, 1206, 1740, -431,
-    -1321, 344, 1127, -375, -593, 645, 330, -511, -1663, -360, -773, -10,
-    -893, -1038, -991, -868, 680, 150, -117, 282, -578, -152, 381, -336,
-    558, 2049, 1437, 1107, 1434, 1267, 1694, 1119, 1229, 2261, 307, -1145,
-    1044, 2444, 947, 741, 991, 889, -286, -811, 15, -37, -542, 34,
-    -427, -388, 729, 728, -2177, -2947, -782, -1265, -1327, -1224, -1381, 315,
-    -450, -1054, 257, -848, -248, 101, -1954, -1825, 131, 1102, -312, -1189,
-    -103, 318, -1406, -1014, 862, -497, -1553, -151, 454, -1383, -1091, 22,
-    -1514, -875, -827, -1795, -1244, -871, -311, 131, -626, -1820, -1496, -1591,
-    -1009, -1518, -617, -951, -1256, -1656, -550, 428, -167, -348, -491, 392,
-    2333, 1868, -246, -891, 355, 9, 169, 1226, 146, -900, 42, 746,
-    -135, 960, 698, -451, 363, 1490, 1079, 571, 703, 1578, 1562, 238,
-    1895, 2119, 1824, 2829, 2506, 1882, 784, 648, 2417, 1799, -193, 1263,
-    2041, 2361, 2599, 2795, 3505, 1559, 1063, 3279, 1726, 55, 2514, 2617,
-    1163, 1298, 645, 1460, 813, 599, 1149, 959, 313, 872, 1677, -319,
-    -1306, -652, -54, 301, 262, 538, -243, -1900, -770, 1578, 964, -330,
-    -32, -507, -299, 273, -251, -257, -1384, -1740, -1729, -1884, -2675, -2884,
-    -2968, -2760, -3322, -3276, -2294, -1076, -2169, -2792, -1994, -1749, -816, -568,
-    21, -1525, -1903, -1419, -1210, -403, -272, -651, -655, -640, -637, -847,
-    -749, -707, -1286, -623, -1585, -1072, 54, -786, -2198, -1215, -997, -451,
-    -360, -725, 552, 1197, -666, -1364, 623, 1643, 334, -1014, -846, 248,
-    1144, 797, 7, 1026, 2052, 766, 2010, 2502, 1508, 1386, 836, 456,
-    919, 1183, 1128, 2138, 3016, 2883, 2837, 2370, 3083, 2365, 2414, 2908,
-    2961, 1297, 893, 2731, 3035, 658, 1647, 3167, 2730, 737, 297, 1741,
-    1000, 533, -460, -414, 1757, 1488, 12, 154, -396, -551, -278, 460,
-    1171, 1011, 843, 290, -146, -744, -365, 1747, 2165, -261, -525, -467,
-    -662, -12, 49, 74, 142, -1066, -1430, -218, -811, -1353, 72, 190,
-    -1561, -1811, -1366, -1078, -393, 972, 854, -418, -382, -18, 921, 1018,
-    1416, -376, -2376, -1978, -2180, -1614, -2491, -2792, -1275, -1133, -1925, -2171,
-    -1844, -1329, -300, -382, -505, -822, -349, -522, -1080, 324, 1301, 190,
-    -3, 27, -136, -41, -475, -1101, -276, 868, -210, 318, 877, 506,
-    -286, -24, 1021, -388, -1478, -529, -607, -562, -1303, -1822, -1442, -1887,
-    -2151, -2250, -2394, -1068, -858, -934, -691, -1744, -1957, -759, 215, 715,
-    -419, -201, -482, 18, 1136, 1832, 1587, 1666, 335, -851, -1094, 1389,
-    1758, 891, 1654, 1317, 750, 429, 529, 1525, 2493, 1113, 579, 1357,
-    2087, 1104, 83, 302, 651, 1175, 918, 204, 1470, 1831, 1126, 714,
-    1591, 1634, 895, 911, 815, 963, 1808, 1909, 1302, 660, 1142, 1950,
-    2574, 3194, 2663, 1569, 2199, 2116, 2598, 2044, 1906, 2580, 3233, 2635,
-    1319, 907, 1153, 1786, 1947, 747, 893, 1334, 838, 309, 1599, 1494,
-    513, -359, -665, -972, -962, -1978, -1931, -1061, -496, -620, -942, -3494,
-    -4250, -3298, -1986, -1563, -1695, -1350, -1759, -2181, -1963, -1001, -1407, -1662,
-    -1037, -1417, -2096, -1294, -334, -1005, -753, -433, -2357, -2095, -218, -277,
-    -1255, -2073, -2576, -2627, -3286, -2995, -2211, -1857, -1938, -1890, -2521, -3785,
-    -2955, -2107, -2262, -3248, -2688, -2434, -1763, -1411, -969, -1406, -1930, -1386,
-    -916, -1244, -1248, 271, 495, 428, 1671, 1184, -255, 255, 1503, 1305,
-    986, 989, 664, 667, 376, 989, 1181, 1173, 237, 397, -363, 333,
-    1806, 1865, 2153, 1917, 949, 863, 1533, 2524, 2764, 2933, 2144, 2015,
-    2333, 2018, 2085, 2755, 3465, 2954, 2902, 2528, 2451, 2007, 2380, 3426,
-    3091, 1951, 2344, 3609, 3945, 2967, 2280, 2454, 2127, 1882, 1603, 1949,
-    1707, 1003, 655, 1478, 1381, 966, 523, -431, -621, -860, -1408, -1346,
-    -1817, -1919, -1132, -730, -528, -664, -1228, -1043, -1149, -899, -966, -1158,
-    -388, -59, -1126, -810, -246, -617, -1364, -2232, -2117, -1843, -1909, -2795,
-    -2979, -2007, -2937, -3680, -3455, -3865, -3553, -2895, -2550, -3050, -3463, -2787,
-    -1869, -1466, -2002, -2380, -1972, -1757, -1852, -1541, -715, -224, -940, -483,
-    408, 345, -86, -21, 45, 160, 118, 105, 255, -212, -536, -1039,
-    -1023, -726, -436, 91, 157, 209, -654, 208, 1844, 1890, 575, 593,
-    1672, 1972, 1287, 411, 885, 2630, 2361, 1030, 284, 1582, 2289, 1251,
-    1321, 432, 391, 1203, 1360, 893, -115, 422, 1363, 926, -317, -639,
-    -248, 192, 296, 331, 417, 1624, 1683, 313, 1256, 2550, 3132, 3319,
-    2853, 1798, 737, 494, 1554, 1245, 1222, 1829, 1339, 175, -121, 929,
-    1722, 1506, -396, -349, 203, 151, 972, 827, -714, -299, 762, 60,
-    -1187, -1037, -514, 665, 1008, 72, 383, 477, 45, -487, -1065, -1133,
-    -121, -28, -682, -946, 460, 679, 37, -329, -199, 713, 844, -25,
-    -580, -331, -7, 468, 673, 1556, 1470, 1151, 880, -415, 46, 1024,
-    1529, 1809, 1742, 1177, 661, 829, 1337, 1147, 521, 146, -391, -1525,
-    -1789, -1919, -1704, -2033, -2903, -4287, -3437, -1351, -1366, -2274, -2833, -2682,
-    -2716, -3535, -3788, -2912, -2522, -2327, -2105, -1595, -1500, -1490, -548, -704,
-    -1969, -1725, -91, 54, -829, -340, 287, 182, 591, 119, 1105, 1563,
-    682, -189, -373, -292, -295, 241, 810, 133, -821, -604, -30, -445,
-    -1074, -768, 186, -376, -170, -236, -969, -730, 10, 622, 464, -516,
-    -381, 413, 572, 851, 1262, 1119, 1473, 1814, 2354, 2561, 2665, 2765,
-    2358, 2640, 2918, 2408, 1525, 1626, 1574, 2157, 2767, 1694, 303, 570,
-    35, -852, -217, 963, 719, -1023, -203, 794, 615, -125, -1028, -949,
-    -143, 114, 653, 1289, 754, 99, 392, 1326, 1194, 542, 916, 1161,
-    854, 603, 1216, 1583, 304, -191, -232, -336, 355, 993, 1033, -246,
-    -732, -244, 14, -361, -788, -625, 43, 139, -401, -429, -846, -293,
-    639, -27, -408, 37, 122, -824, -826, 303, 453, -460, -418, -12,
-    138, -218, 130, 787, -184, -1066, -707, -366, -236, -249, -1240, -2071,
-    -1423, -1221, -1103, -1048, -1684, -1462, -747, -346, -297, -833, -1935, -1832,
-    -845, -617, -575, -511, -543, -213, 267, -316, -425, -939, -1268, -226,
-    -149, -636, -388, -446, -835, -660, -330, -267, -488, -820, -1845, -1823,
-    -652, -584, -740, -1171, -1348, -1148, -1391, -1322, -1598, -1349, -1102, -1463,
-    -2539, -2493, -1479, -857, -718, -1016, -1109, -829, -747, -332, 773, 1149,
-    143, 14, 1028, 2073, 2276, 1592, 1551, 2203, 1810, 704, 827, 1877,
-    1475, 1156, 643, 79, 1194, 1624, 1643, 1022, 458, -124, 296, 788,
-    1032, 564, 137, 174, 376, 1111, 1464, 144, -11, 564, 970, 1210,
-    689, 191, 316, 946, 442, 350, 1080, 1627, 876, -321, -280, 357,
-    483, 224, 505, 1336, 1237, 668, 42, -558, 25, 276, 177, -331,
-    -774, 112, 626, 412, -173, -133, -116, -335, -697, -290, 18, -279,
-    -1356, -966, 667, 1403, 549, -702, -862, 215, 377, -236, -422, -598,
-    -512, -655, -48, -193, -635, -303, -1122, -1485, -1726, -1133, 18, -169,
-    -842, -622, -562, -1433, -1683, -793, -282, -868, -1585, -2840, -2799, -814,
-    -486, -758, -935, -1442, -1462, -1016, -292, -110, -429, -427, 488, 843,
-    629, 81, 489, 716, 245, -130, -129, 394, 1146, 522, -521, -176,
-    955, 743, -214, -459, -215, 752, 925, 250, -173, 90, 854, 980,
-    477, 1159, 1001, 343, 435, 968, 637, -180, -409, -373, -261, -299,
-    -341, -97, 123, 145, 508, 401, 432, 765, 133, 5, 11, -22,
-    -193, -483, -134, 339, 268, 562, 247, -642, -976, -649, -264, 591,
-    577, -372, 171, 987, 637, 702, 1592, 2069, 1430, 620, 1328, 1610,
-    1555, 1261, 1321, 711, 191, 782, 1813, 1457, 562, 296, 65, -185,
-    -2, 477, 357, -337, 203, 202, 204, 313, -68, 156, -376, -1613,
-    -1103, 333, 823, 874, 534, 455, 576, 836, 898, 164, -146, -346,
-    229, 654, 753, 1125, 1, -825, -14, -246, -64, -63, -966, -1297,
-    -1091, -896, -530, -439, -284, -864, -1698, -1442, -991, -927, -1782, -1787,
-    -1339, -556, 323, -19, -825, -1137, -426, -1, -751, -1157, -611, -696,
-    -815, -52, -498, -1185, -614, 204, -9, -151, -395, -901, -744, -431,
-    -216, -346, -947, -1204, -916, -753, -1217, -1886, -2523, -2184, -1181, -425,
-    402, 657, 112, -538, -153, 200, 922, 1200, 626, 530, 638, 768,
-    1259, 1287, 1105, 827, 427, 441, 542, 752, 422, 335, 573, -403,
-    -882, -75, 949, 803, 717, 1482, 1902, 2086, 2581, 1897, 541, 24,
-    657, 1736, 2114, 2054, 1967, 1659, 755, 387, 1328, 1625, 1094, 1394,
-    835, 383, 460, 722, -132, -495, -148, 1051, 1334, 350, -237, 538,
-    551, 60, 313, 750, 1549, 1144, -47, -317, -593, -485, 371, 411,
-    123, 581, 716, -98, -986, -1284, -785, -129, 252, -358, -920, -1151,
-    -1646, -988, -1149, -1491, -778, -335, -654, -1109, -1551, -1601, -1316, -1517,
-    -2477, -2703, -2194, -2131, -1376, -843, -888, -1364, -1920, -1791, -1229, -842,
-    -327, -21, -66, 42, 487, 468, 228, 543, 306, -192, 111, 1027,
-    1474, 1267, 715, 793, 486, 64, 684, 625, -74, -341, 279, 416,
-    -301, -359, 467, 321, -493, -892, -491, -1234, -1717, -501, -63, -393,
-    -300, 342, -131, -1162, -1243, -261, 136, 857, 1363, 660, 383, 529,
-    246, 76, 536, 532, 343, 1212, 1421, 549, 171, 29, 379, 519,
-    269, 725, 890, 220, 124, 284, 433, 1238, 2074, 1953, 698, -208,
-    -238, 319, 750, 341, -133, 408, 328, -581, -558, 8, 369, -426,
-    -1321, -1137, 17, 219, -794, -1357, -1336, -1406, -1605, -1016, 67, -522,
-    -1373, -1264, -501, -161, -306, -254, -1308, -1592, -425, 437, 1178, 1726,
-    1047, -17, 124, 1022, 1301, 1160, 1211, 1080, 1553, 2380, 2136, 1257,
-    1741, 1973, 1228, 1162, 1840, 1680, 1370, 1739, 1751, 761, 188, -202,
-    -626, -611, -36, -137, -1310, -1876, -1880, -1200, -768, -320, 33, -137,
-    -795, -1215, -845, 2, 403, 508, 38, -829, -947, -257, 208, -35,
-    -312, -108, -90, -722, -1119, -954, -527, -570, -1032, -692, 320, 1074,
-    562, -102, 37, 19, -417, -600, -107, 515, 452, 587, 673, 166,
-    150, 50, 494, 1016, 729, 806, 766, -44, -245, -422, -779, -210,
-    433, -295, -2234, -2960, -1416, -787, -1124, -1057, -1762, -2312, -2357, -1532,
-    -742, -412, -277, -889, -1141, -980, -482, 1045, 1334, 561, 1168, 2196,
-    2367, 2171, 1577, 1000, 1218, 1275, 828, 846, 1930, 2501, 1670, 907,
-    501, -76, 25, -120, -289, -320, -794, -1488, -1102, -429, -234, 676,
-    545, 162, -314, -1137, -1170, -1201, -1085, -31, 472, 473, 963, 591,
-    -847, -978, -668, -732, 271, 1082, 192, -1, -259, -724, -425, 28,
-    488, -137, -822, -411, -157, -512, -808, -587, -970, -633, -281, -88,
-    -267, -783, -1693, -1678, -541, -194, -199, -580, -144, 604, 1809, 1371,
-    814, 902, 1160, 2012, 2423, 2186, 2176, 1843, 1033, 1262, 2153, 2279,
-    1775, 1902, 1753, 981, 1145, 1495, 1886, 2113, 1830, 817, 542, 1572,
-    1922, 358, -665, -1387, -2163, -379, 1225, -482, -2089, -2564, -1569, -380,
-    -1232, -1823, -1556, -939, -962, -436, 251, -314, -813, -312, 1411, 1636,
-    -420, -545, 280, -158, -949, -858, -1068, -1626, -1983, -1900, -1832, -1840,
-    -1751, -2083, -2319, -2226, -2055, -2004, -1621, -794, -690, -1113, -1160, -1451,
-    -2353, -2732, -2831, -1734, -621, -480, -35, 523, 714, 428, 730, -328,
-    -2236, -2209, -1432, -1534, -1382, -1516, -2171, -1230, -556, -1365, -1386, 227,
-    1213, 1128, -322, -1659, -118, 1939, 1944, 1351, 648, 1853, 2756, 2200,
-    1191, 147, 1335, 3834, 3564, 1765, 1954, 3179, 2474, 1397, 1549, 2035,
-    3111, 2439, 1518, 805, -41, 884, 1996, 1679, 458, -1249, -1984, -735,
-    -212, -1561, -1194, -219, 922, 330, -1007, 623, 2083, 1398, -233, 115,
-    1192, 2111, 1068, 506, 1215, 2101, -412, 327, 3207, 949, -443, 3398,
-    407, -1169, 1979, 1676, 3369, 2033, -464, 1241, -534, -3680, -3325, -3352,
-    -4565, -5670, -5040, -2882, -2505, -2571, -1360, 4, 654, -590, -2741, -1537,
-    -674, 824, 1557, 623, 572, 2964, 4585, 4064, 4284, 2287, 9, -847,
-    1037, 622, -1107, -1397, 345, 1158, 991, 735, 376, -904, -2163, -2698,
-    -915, -52, -1196, -3518, -6596, -1354, 9912, 13475, 9570, 487, -6831, -6134,
-    -2576, -3545, -3376, 3082, 6278, 3036, -778, 1331, 5069, 1830, -5277, -8888,
-    -5345, 1488, 1845, -3822, -5020, -4630, -2949, 3528, 5175, 563, -6024, -5012,
-    1452, 9052, 8815, -369, -3811, -778, 2923, 6635, 6958, 3384, 1002, -912,
-    -112, 489, 2214, 532, -7010, -13632, -12011, -8635, -7293, -6762, -4146, -2512,
-    -1639, -2392, -2927, -1610, 1820, 4468, 6884, 7050, 5019, 4572, 7881, 7691,
-    3307, 3099, -763, -5572, -5795, -2311, -2346, -6935, -7699, -1180, 3001, -3970,
-    -9346, -5471, 1908, 306, -7330, -4279, 7255, 12247, 13219, 9905, 5516, -369,
-    -4192, -5503, -6643, -6854, -8090, -6267, -1184, 4492, 7291, 6594, 6866, 5619,
-    -790, -8273, -10206, -5793, 961, 8169, 14654, 14301, 6781, -3378, -3615, 6470,
-    7582, 1358, -2716, -4470, -1650, 1566, 4190, 2465, -344, 2495, 3530, -3001,
-    -1866, 5919, 9175, 6934, 4071, 2492, 542, 297, 3707, 4966, 1730, -678,
-    -663, 133, 2832, 4834, 978, -1993, 590, 3199, 7514, 8510, 5772, 5393,
-    5389, 7126, 4578, 3207, -5431, -7193, -2006, -7670, -9773, -8469, -7943, -15597,
-    -9450, -8253, -13401, -9894, -4071, -3875, -3749, -5271, -10760, -7158, -7061, -1577,
-    1893, 4783, 3079, 2287, 3459, 7385, 6932, 6564, 3247, -4991, -2115, 2908,
-    8434, 7288, 4624, 2886, -4747, -3463, 3235, 1559, -3836, -5900, -1081, -8548,
-    -12735, -12358, -7025, -12102, -5212, -9277, -15044, -11039, -3863, -2754, -11628, -9783,
-    -8608, -5653, 195, 2661, 6509, 5544, 4118, -35, 1868, 6763, 10711, 6898,
-    1302, 3080, 5533, 2131, -1105, 6012, 11714, 6140, 5610, 8397, 8446, 3436,
-    2801, 7652, 11219, 11778, 11909, 6638, 9751, 10898, 10600, 8370, 7593, 5178,
-    -565, -2023, 1383, 1522, -2042, -5172, -7617, -10050, -8251, -1229, -764, -4876,
-    -4795, -2694, -2323, 221, -424, -1552, -1572, 1237, -2150, -3274, -3630, -5509,
-    -1997, 2359, 2115, -2230, -93, 2146, 1391, -513, 1713, 4933, 5219, 2230,
-    -1276, 25, -1665, -2122, 368, 33, -2916, -1137, -1431, -5309, -7475, -5825,
-    -4462, -2690, -4174, -7203, -4689, -3141, -4472, -3383, -6764, -6834, -5479, -2801,
-    -4093, -2344, -1121, -288, 493, 966, 2043, 2671, -1869, -3419, -2790, 1296,
-    2680, 2809, -1799, -2204, 466, -1267, -994, -2096, -3676, -2660, -1389, -4311,
-    -3977, -5210, -5889, -4136, -2112, -4149, -5068, -3384, -4226, -4641, -4372, -3445,
-    -2032, -3591, -3008, -2494, -3810, -2473, -556, -643, -317, -368, -879, -1456,
-    -2476, -1124, 262, 2855, 2177, -1352, 2308, 3902, 3498, 4448, 4673, 2896,
-    3854, 4016, 4851, 2244, -950, 3381, 5391, 3669, 3790, 5182, 6578, 4261,
-    5620, 6551, 6781, 7368, 7848, 7814, 8985, 8049, 7724, 6722, 7255, 8501,
-    8795, 8691, 5069, 6174, 7645, 9575, 9738, 7280, 7230, 4866, 7974, 10664,
-    10746, 6523, 3805, 3482, 3994, 3478, 4209, 2695, 1780, 2264, 2035, 2729,
-    3521, 3036, 3639, 2138, 709, -802, -1797, -1377, -383, -459, 465, 3226,
-    -2020, -4889, -2494, -1577, -1492, -4365, -8479, -4586, -2039, -5944, -11471, -10324,
-    -6917, -4219, -7694, -9896, -7460, -7943, -7632, -6772, -7046, -8620, -9699, -10882,
-    -12092, -10197, -9559, -10470, -12207, -12358, -12677, -16659, -16810, -15007, -15706, -16877,
-    -15525, -12161, -9946, -7870, -7273, -6153, -4616, -3353, 519, -1235, -2763, -1302,
-    -3339, -4868, -1699, 85, -1434, -3105, -3688, -4802, -5308, -3618, -3460, -5126,
-    -2627, -4422, -2979, 823, 492, -964, -2744, -589, 849, 1144, 2787, 3097,
-    2383, -1127, -83, 2867, 4135, 2617, 3739, 3314, 5060, 4033, 4528, 6899,
-    7562, 6260, 7800, 7257, 8420, 9381, 8661, 8186, 11147, 12792, 12444, 9011,
-    5979, 8782, 8871, 8024, 9942, 9508, 8915, 7952, 6164, 8430, 8602, 10857,
-    11018, 7448, 6220, 10868, 10384, 8332, 8836, 6949, 7006, 8320, 7729, 8387,
-    8160, 7128, 5763, 5688, 4773, 4814, 4747, 3495, 1694, 400, -2604, -2203,
-    446, 189, -537, -878, 1472, 1442, 1566, -14, -179, -30, -380, 2696,
-    2059, 1364, 905, 250, 665, 162, 104, -1203, 913, 1782, -688, -2804,
-    1223, 1530, 242, 564, 1732, 383, -197, -1875, -4120, -2768, -1388, -4202,
-    -5425, -4939, -4065, -4650, -5428, -2611, -3574, -4434, -7037, -9162, -7788, -4788,
-    -3106, -5722, -7201, -7633, -7570, -6418, -6449, -5549, -6315, -7759, -5744, -2954,
-    -4645, -6317, -3215, -2691, -2738, -2307, -3325, -2966, -2574, -1220, -2663, -2103,
-    -4931, -4462, -2857, -3639, -4541, -4512, -4369, -5621, -3696, -1250, -4334, -4214,
-    677, -1172, -4395, -3530, -1908, -4018, -2047, -1464, -4200, -6541, -4686, -5441,
-    -6852, -5659, -5276, -5968, -5671, -6599, -4059, -3827, -3881, -5928, -2282, -1834,
-    -5130, -792, 1895, -790, -1613, -1254, -1597, 1211, 1833, 669, -3143, 705,
-    686, -889, -1767, 101, 2060, 487, -2902, -360, 1378, -3116, -3728, 573,
-    259, -2060, 599, -2787, -504, 1246, 422, -2678, -2651, 214, 774, 1074,
-    3380, 2904, 817, -790, -1335, 1839, 4577, 8016, 4553, 3919, 5418, 6904,
-    4573, 4397, 4164, 4668, 7919, 8319, 6054, 7444, 8161, 7527, 9155, 5884,
-    7326, 7606, 6908, 7928, 8847, 5444, 9244, 11141, 9479, 6635, 6586, 8355,
-    10489, 6952, 6510, 9183, 8076, 4522, 6038, 5760, 10646, 11481, 9808, 8219,
-    8275, 9217, 11405, 11593, 10706, 10218, 10105, 9638, 11176, 9202, 5895, 6329,
-    6850, 7700, 7765, 5901, 5210, 4516, 3576, 8705, 8697, 4101, 3272, 2482,
-    4026, 2347, 1772, 4224, 2149, -516, -3766, -932, -1969, 568, 1739, -2076,
-    -4260, -3559, -2111, -1200, 1571, 1178, -4917, -6619, -2946, -1998, -5827, -5727,
-    -4922, -4292, -5392, -5033, -6298, -8712, -9606, -6858, -8681, -9376, -8530, -7823,
-    -10316, -12659, -14891, -7994, -9924, -11554, -10953, -14575, -15372, -12155, -9727, -6985,
-    -4799, -12274, -17026, -12508, -7679, -5980, -7930, -12374, -11019, -8109, -11528, -11151,
-    -6695, -8044, -7301, -7215, -4718, -3713, -6793, -7056, -9019, -6282, -6206, -10083,
-    -9893, -8922, -10699, -13651, -9595, -9602, -11200, -10068, -8794, -8744, -11149, -10065,
-    -9628, -10628, -11334, -13026, -10083, -9365, -6844, -6224, -8914, -7706, -6175, -5838,
-    -4139, -4735, -2862, -4277, -3811, -2215, -668, -184, -3696, -1326, 1960, 2735,
-    2833, 4412, 2150, -740, 1376, 2283, 2819, 2685, 2328, 3846, 2927, 41,
-    560, 4989, 5658, 4603, 3944, 825, 3264, 6174, 5115, 3192, 1458, 4210,
-    5199, 3298, 3616, 1633, 2188, 3716, 2110, 4629, 2794, 3603, 4102, 6332,
-    5517, 3854, 4403, 7338, 8727, 7221, 6487, 6416, 7029, 9633, 8949, 4678,
-    4841, 10706, 12418, 9290, 3723, 1496, 6982, 9669, 10733, 7463, 8054, 5465,
-    9489, 9972, 9524, 10663, 9072, 8627, 7649, 8425, 10922, 9813, 10706, 11346,
-    11599, 9935, 12866, 11298, 9491, 12314, 8387, 11194, 12697, 11443, 8918, 8497,
-    9582, 10552, 10157, 9180, 9228, 8923, 9078, 13102, 8264, 10636, 9250, 8832,
-    11678, 9248, 5776, 9106, 6116, 9407, 6831, 8112, 4421, 11630, 9868, 4563,
-    8845, 7988, 5772, 5912, 5183, 6981, 5741, 6779, 15, 2479, 5737, 5085,
-    1150, 3726, 4840, 1260, 3037, 1535, 1375, -1015, -201, -312, -206, 779,
-    -1492, -3108, -1981, -3233, -4479, -4605, -5852, -5051, -6558, -3658, -1783, -3634,
-    -7545, -8728, -6416, -2444, -2595, -8439, -6770, -5732, -5359, -5931, -5895, -7834,
-    -5554, -3307, -6952, -7019, -9361, -9635, -8453, -13605, -14039, -13511, -11113, -9320,
-    -11033, -12140, -13175, -12654, -13908, -9220, -10634, -9248, -12512, -15464, -13000, -11111,
-    -7449, -8247, -10496, -11386, -11351, -12132, -9816, -10451, -9785, -8820, -9494, -12457,
-    -9524, -10407, -11714, -8146, -8086, -11340, -10985, -9255, -9865, -13592, -9165, -8023,
-    -9349, -12216, -12342, -8746, -9313, -7620, -5988, -8311, -6390, -1804, -3149, -5665,
-    -4752, -4852, 234, -2407, -6859, -4135, -562, -2624, 3122, 732, -306, 3179,
-    3454, -549, 907, 2449, 1763, -1185, -725, 1805, 461, 2026, 2375, -498,
-    1103, -961, -418, 2748, 4892, 2605, 1778, 3225, 3490, 2986, 5301, 3984,
-    4339, 4294, 4658, 4320, 6146, 7868, 7562, 4224, 7531, 8168, 5243, 5440,
-    8189, 9454, 3755, 3977, 9958, 7872, 6824, 9071, 6520, 7150, 8246, 7391,
-    5243, 8294, 8553, 4804, 2211, 3351, 5420, 6158, 7685, 6332, 5871, 7747,
-    7849, 5396, 8069, 9780, 6116, 5697, 6258, 5984, 6356, 7591, 7678, 4879,
-    8272, 8950, 7583, 6275, 6055, 7026, 3649, 3227, 4433, 5049, 2989, 5599,
-    8161, 6875, 4152, 3482, 6501, 10987, 8324, 5626, 7999, 6467, 7281, 8499,
-    8760, 6546, 2387, 2223, 6254, 7004, 5789, 4804, 5606, 5833, 1595, 1958,
-    2663, 3325, 3429, 1760, 931, 3733, 4592, 4260, 1117, -1089, 712, 1672,
-    1897, 98, 485, 4028, 3417, 951, 94, -79, 265, 4135, 1321, 488,
-    -287, 1179, 48, -1886, -4024, -2463, -1087, -1813, -2300, -1777, -2843, -1749,
-    -1814, -7029, -6187, -5848, -4010, -1795, -4092, -3704, -3214, -3721, -5828, -7000,
-    -8228, -7299, -4347, -3864, -3056, -4535, -7156, -7009, -5289, -7086, -8296, -6936,
-    -3686, -4540, -4683, -6328, -9755, -7876, -5004, -8260, -8088, -8513, -7876, -9317,
-    -7999, -6607, -6859, -8260, -11132, -10355, -8913, -5520, -6749, -8463, -7320, -7245,
-    -7192, -7556, -6883, -7954, -9394, -7242, -7001, -6622, -6848, -5093, -2626, -1707,
-    -1975, -2700, -2636, -3354, -3186, -2803, -3452, -1514, -1966, -1158, -1670, -3861,
-    -2947, -2621, -1432, -1146, -77, -3383, -6415, -2965, -964, -2294, -2757, -3280,
-    -2438, -838, -255, -330, 1847, 2150, -173, -500, 282, 2011, 2329, 2040,
-    2548, 2513, 2731, 4267, 2507, 1095, 3415, 3699, 3291, 3627, 4763, 6144,
-    7286, 5259, 2241, 1936, 2335, 3507, 2312, 1791, 2734, 4475, 6605, 6822,
-    7075, 7062, 7681, 6349, 5262, 5668, 6882, 8648, 9641, 7513, 6059, 7417,
-    7376, 7859, 10804, 8128, 7088, 8003, 9736, 11866, 11183, 9832, 9593, 9471,
-    8975, 8055, 8574, 10540, 9094, 7243, 7574, 7742, 8196, 7709, 9523, 9512,
-    7351, 6378, 7081, 7023, 5400, 5440, 4645, 3986, 4909, 4366, 5920, 7362,
-    4018, 1924, 682, -1148, -1654, -337, 779, 116, -31, -792, 396, 819,
-    -829, -481, -1296, -1849, 105, -63, -887, 622, -914, -3045, -397, 1547,
-    1810, 1020, -781, -1230, -819, -219, 138, 160, -625, 484, -313, -919,
-    441, 1025, 807, -1974, -3066, -3453, -4161, -3671, -1437, -2729, -3556, -3875,
-    -2794, -1881, -3881, -6375, -5423, -3390, -4920, -5041, -3427, -1782, -2370, -4622,
-    -5628, -5425, -4210, -4638, -5200, -4804, -5562, -6134, -5392, -5439, -4048, -5394,
-    -7444, -8553, -8568, -6922, -5364, -4374, -4028, -4974, -6587, -7581, -7063, -4301,
-    -1440, -3852, -4834, -5629, -4891, -5540, -5575, -4325, -2685, -3883, -6260, -4193,
-    -3276, -2150, -1585, -1859, -1282, -3485, -2758, -807, -1038, -1808, -2314, -2327,
-    -3088, -4105, -3855, -5360, -3299, -3336, -4112, -3471, -3130, -1922, -4053, -4458,
-    -5745, -6979, -4982, -5392, -4125, -3990, -4151, -1487, -68, -77, -1840, 46,
-    1437, 300, -1614, -349, 165, -436, 491, 57, 425, 2074, 3622, 1165,
-    1122, 404, 1286, 1873, 1773, 1217, 59, 829, 433, -444, -684, 512,
-    1611, 1564, 815, 594, 1224, 2394, 1971, 1444, 2563, 1171, 1057, 1239,
-    1590, 1166, 1823, 5273, 4038, 2601, 961, 2058, 2802, 3965, 4845, 3796,
-    1241, 1692, 1392, 2565, 3579, 3477, 3472, 4297, 3695, 2932, 2471, 3226,
-    2454, 4135, 3328, 3421, 2912, 5517, 6141, 3583, 2066, 3038, 2925, 2650,
-    2222, 4273, 4340, 3418, 2549, 1946, 3139, 4536, 3764, 3249, 1706, 1680,
-    2602, 2786, 2144, 2891, 4116, 3241, 2272, 2770, 4116, 3216, 443, -473,
-    228, 260, -258, 331, 1842, 2977, 2331, 2261, 2643, 1868, 2687, 3347,
-    3167, 1378, 2597, 2438, 2506, 1750, 2388, 2729, -794, -981, 2423, 2271,
-    967, 1080, -443, -821, 273, 375, 578, 175, -488, -960, -898, -337,
-    800, 190, 2107, 2460, 415, 338, 1603, 1135, 1797, 3596, 2327, 2263,
-    1230, 406, 400, 2533, 3483, 2151, 647, 2118, 1680, 104, -153, 808,
-    925, 904, 1821, 1886, 1406, -448, -1282, 479, 1051, -190, -1591, -1431,
-    -1151, -408, -494, 1429, 1941, 1138, 1201, 1034, 702, 738, -778, -1135,
-    608, 445, 1079, -719, -2373, -1227, 328, -372, 104, 1039, 92, -2287,
-    -3840, -3062, -2655, -3095, -1583, -1660, -3249, -4485, -4026, -2802, -1736, -3518,
-    -3388, -2267, -326, -1164, -1580, -709, -839, -1108, -1210, -926, -2297, -2198,
-    -1096, -2170, -2459, -1441, -1404, -1805, -3422, -5407, -4865, -3486, -2913, -4618,
-    -4588, -4902, -4876, -3492, -2902, -225, -1494, -2272, -1594, -2423, -1678, -1597,
-    -3379, -2524, -1289, -1080, -617, -844, -1878, -3371, -2040, -2821, -3134, -2667,
-    -4504, -5238, -6942, -4717, -4327, -6934, -7225, -6507, -6195, -6727, -6494, -6723,
-    -6009, -5135, -5947, -5126, -1778, -3321, -4183, -5542, -6932, -6779, -5777, -1174,
-    -2483, -5768, -5331, -4669, -3214, -4120, -4081, -4148, -3667, -4060, -4469, -3465,
-    -1546, -1907, -1870, -4091, -2825, -2743, -3607, -1918, -3787, -3892, -1696, -1539,
-    -1375, -1786, -1009, -2329, -1966, -2191, -2562, -1663, -945, -1536, 1, -783,
-    1053, 2483, 1916, 2165, 798, 1244, 3543, 4815, 3821, 3448, 4357, 4021,
-    5475, 5393, 6583, 6596, 6198, 7040, 9099, 7375, 6576, 6470, 7661, 7941,
-    7151, 7576, 8497, 9001, 8987, 8685, 8171, 7760, 8520, 7854, 8400, 8542,
-    8670, 7794, 8100, 6455, 5476, 5313, 4919, 3270, 3518, 5245, 5711, 4038,
-    3335, 2495, 1362, 1729, 2568, 2659, 3359, 3542, 5214, 7039, 7104, 5370,
-    4390, 4180, 3645, 2731, 537, 2758, 5333, 4276, 3426, 3162, 2122, 1737,
-    1998, 2289, 3956, 5100, 4674, 3309, 3436, 3929, 4000, 4136, 3331, 3324,
-    3442, 5234, 5775, 4747, 3505, 2465, 1259, 301, 1050, 1611, 1825, 1501,
-    2554, 1549, -233, 63, 1152, 344, 506, -115, -385, -328, 481, 925,
-    -1109, -3940, -4811, -4872, -4217, -3076, -2520, -3073, -1391, -1767, -3729, -4331,
-    -5390, -8538, -8886, -8913, -5994, -3902, -3897, -4007, -3883, -4622, -6594, -6089,
-    -4449, -3529, -3703, -3400, -898, -896, -2428, -905, -233, -2171, -3091, -2698,
-    -598, -500, -985, -1864, -3305, -3780, -4234, -3956, -3196, -2104, -1138, -1668,
-    -1983, -4113, -3965, -2527, -3312, -2772, -2438, -2638, -291, 494, -361, -1360,
-    -2984, -4609, -4381, -3689, -2227, -719, 104, -1054, -272, -2076, -1829, 198,
-    -805, -2539, -2745, -1979, -1785, -1541, -2515, -3002, -4646, -4868, -3860, -3779,
-    -3801, -2194, 966, 421, -1444, -2522, -1833, -2046, -1857, -1530, -2032, -1605,
-    -1647, -645, -828, 1401, -1558, -2591, -3003, -2911, -3155, -1370, 61, -1462,
-    -3321, -2331, -1079, -2358, -1237, -1570, -1783, -858, 577, 191, -1719, -1020,
-    -2797, -940, 590, 367, -1000, 1087, 2407, -6, -2280, -640, 464, -435,
-    328, -929, 105, 1300, 3599, 1958, 1023, 2021, 1397, 1390, 1716, 1728,
-    2198, 2629, 2537, 526, 977, 2760, 1698, 990, 1291, 1889, 2729, 2885,
-    4322, 1421, -1145, -1574, 314, 1154, 1008, 2174, 5105, 6602, 5409, -143,
-    -718, 224, -59, -96, -451, 60, -568, 964, 1822, -205, -24, -1219,
-    -913, -396, 435, 686, 2966, 4094, 4111, 3673, 4817, 2168, 3120, 3620,
-    3737, 4427, 4356, 4633, 3044, 987, 1579, 2216, 3849, 2436, 448, 2886,
-    5694, 5283, 3297, 3295, 2983, 2124, 4415, 2744, 2931, 4691, 4845, 3767,
-    2589, 762, 3116, 4717, 4745, 3581, 3049, 5348, 3905, 1698, -41, 2077,
-    1751, 508, 1901, 1863, 2568, 3949, 4261, 3290, 51, -1594, 107, 1235,
-    1975, 1201, 987, 4710, 5041, 2310, 344, 1365, -412, 467, 1580, -114,
-    -807, 1446, 3545, 3451, 1427, 345, 429, 888, 1492, -244, 321, 2724,
-    2903, 1550, 1776, 1158, -497, 1024, 228, 381, 706, 2650, 1712, 1030,
-    838, 1377, 1947, 2188, 2888, 3404, 4223, 5188, 4697, 4249, 4654, 2473,
-    2312, 4157, 4381, 4217, 5669, 7823, 5699, 2903, 1152, 1069, 1361, 2009,
-    1883, 2053, 1605, 709, -613, 429, -951, -3396, -3748, -3038, -2941, -3821,
-    -1414, -164, -2441, -5723, -7259, -6365, -5612, -2962, -2631, -1193, -812, -1980,
-    -2062, -1113, -4243, -6664, -6574, -4837, -3630, -4882, -2921, -1923, -2480, -4829,
-    -6187, -6208, -4873, -2187, -3516, -3141, -3447, -4107, -4258, -2975, -5712, -5048,
-    -2664, -101, -545, -1259, -709, -3054, -3997, -3149, -3533, -4969, -4418, -3674,
-    -3002, -724, -298, -1297, -721, -1047, -4320, -3936, -2389, 555, 956, 1378,
-    563, -1616, -2243, -713, -1513, -2092, -1573, -50, 1149, 2051, 1240, 357,
-    159, -2306, -3626, -3665, -1042, 1052, 623, 352, 345, -2181, -4471, -3466,
-    -3660, -4809, -2884, -1195, -249, 155, -627, -1202, -1940, -4222, -5760, -6765,
-    -3280, -2859, -2916, -4053, -4788, -4907, -6387, -6449, -8079, -7502, -5234, -3868,
-    -2393, -4124, -5730, -5068, -5529, -6244, -5335, -5293, -2761, -2875, -1428, -3614,
-    -3592, -3178, -4461, -4378, -4995, -4257, -3597, -1620, -53, -1492, -2059, -1020,
-    -2252, -2781, -2075, -2004, 8, 714, 1318, -646, -871, -1082, -1495, -543,
-    -234, 2067, 2097, 2375, 3548, 1702, -136, -292, 77, -856, -111, 185,
-    1152, 2106, 3903, 3424, 2222, 536, -988, -850, -816, 1354, 42, 1088,
-    2206, 1989, 2561, 3149, 2379, -1035, -1799, -266, 1366, 3242, 3446, 1964,
-    737, 231, -140, 383, 1119, 3448, 2758, 3460, 3280, 3528, 2616, 2937,
-    4355, 3342, 2229, 1789, 1834, 3468, 4585, 5414, 3558, 2359, 2099, 3277,
-    2842, 3758, 3164, 3486, 2165, 2629, 1600, 3936, 4766, 4944, 3974, 2211,
-    3664, 5634, 6362, 4908, 3297, 3181, 3930, 5097, 4229, 2973, 3738, 5434,
-    4965, 4203, 2609, 4787, 4737, 5241, 3672, 2305, 3519, 4125, 5684, 4473,
-    3049, 1062, -30, 372, -33, -762, 3096, 3742, 2229, 1301, 1794, 1452,
-    -606, -477, -1501, -2663, -2113, -856, 615, -522, -162, -518, -1004, 582,
-    48, -1936, 174, -316, -1233, -2236, -980, -1470, -1888, -1431, -2024, -2940,
-    -2722, 588, 2032, -211, -692, 547, 1530, 2503, 582, -97, 1672, 2313,
-    2211, 2139, 3992, 3712, 3836, 4669, 4147, 3131, 2632, 4332, 3245, 1697,
-    2061, 3573, 3788, 4182, 2693, 2571, 2583, 3289, 1718, 122, -247, 307,
-    -297, -407, -1357, -3397, -3104, 1018, 2986, 2125, 481, 793, 87, -946,
-    -1259, 46, 1129, 2884, 1562, 1939, 249, 78, 258, -504, -669, -2442,
-    -3090, -1904, -1567, -2332, -2787, -2033, -1995, -2133, -1716, -956, -777, 1080,
-    307, 25, -1485, -289, 614, -1018, -2171, -2113, -847, 2266, 2409, 1275,
-    58, 952, -74, -718, 789, 1390, 1281, 121, 105, -1076, -1811, -562,
-    1065, -457, -406, 1596, 605, 185, -525, -441, -2656, -1619, -1476, 232,
-    695, -237, 1296, 52, -246, -1110, -2306, -2080, -779, -3194, -2712, -934,
-    -1398, -1132, -1189, -1704, -3068, -3003, -3882, -3408, -3712, -3055, -632, -764,
-    -1575, -2040, -4552, -4248, -3691, -5451, -3124, -1599, -3384, -4673, -3521, -2817,
-    -4060, -5727, -4981, -4064, -4542, -4046, -2494, -2630, -1929, -3520, -4884, -3834,
-    -3547, -3770, -1801, 325, 338, -449, 408, 789, -724, -736, 921, 2735,
-    1295, 337, 1769, 872, 2216, 1431, 77, 974, -260, -413, 191, 896,
-    466, -131, 746, 759, -2283, -997, 1958, 3106, 2483, -23, 466, -906,
-    -1259, -1067, -793, -2016, -2743, -642, 254, -154, -585, -195, 433, -584,
-    -3657, -2507, -1371, -777, -1461, -1328, -1039, -1639, -1783, -3628, -3826, -4764,
-    -4089, -3455, -3087, -3776, -2982, -3001, -1742, -3993, -6852, -4285, -3267, -3037,
-    -3628, -3407, -3196, -3050, -4655, -5125, -4514, -4997, -3803, -2191, -2375, -3021,
-    -1173, -2737, -1802, -1909, -1826, -329, 1566, 792, 616, 318, 1235, 4077,
-    4104, 1969, 1709, 2430, 3398, 4801, 3893, 3235, 4055, 3390, 2447, -224,
-    403, 3178, 3579, 3097, 2621, 667, 937, 1766, 2119, 734, -766, -856,
-    576, 1105, -59, -326, 265, 172, 144, 461, 142, 678, 387, 300,
-    2436, 1202, 1143, 1843, 2304, -450, -1545, -971, 796, 1390, 502, 1691,
-    2657, 2178, 1998, 752, 1088, 1986, 1041, 2123, 3032, 2395, 2518, 2854,
-    2690, 278, 700, 2370, 3687, 2244, 1060, 2464, 3019, 2370, 3512, 3186,
-    3909, 3579, 1923, 4455, 4690, 4234, 5111, 4747, 3670, 1379, 1092, 2941,
-    4128, 2309, 2831, 5233, 5511, 4728, 4089, 3713, 4598, 4385, 4698, 4534,
-    2862, 2453, 2137, 2240, 1830, 360, -388, 1601, 1890, 1426, 665, 1872,
-    841, -1408, -1311, -302, -333, -2103, -1375, -202, 1474, 2700, 1273, 958,
-    -1425, -1919, -3033, -3077, -1785, -199, -1314, -1163, -2486, -3151, -1540, 167,
-    -711, -2768, -3974, -3585, -2032, -1215, -1194, -2636, -3807, -4321, -3813, -3575,
-    -3302, -2795, -3779, -3110, -3524, -1897, -880, 1907, -492, -1624, -1127, 206,
-    1971, 2547, 2300, -331, -1649, -549, 435, 154, 1577, 1678, -167, -731,
-    -1367, -334, 193, 2582, 716, -1215, 414, -1502, -2049, 134, 233, -180,
-    -2406, -3272, -3855, -4132, -684, 112, -1213, -2411, -3113, -2458, -2357, -1499,
-    -1883, -1995, -2363, -2483, -2372, -2288, -2817, -1920, -3743, -3794, -4182, -3878,
-    -1003, -357, -1059, -3388, -2024, -345, -520, 57, -1633, -2013, -1828, -2125,
-    -1090, -852, -65, 1185, -2059, -1762, -2532, -2138, 242, -797, -750, -1044,
-    -1835, -1726, -1003, 272, 1082, -127, 779, 416, 320, -699, 1039, 1537,
-    -1194, -1269, -603, 367, 1628, 914, 1038, 216, 797, 1872, 2985, 2514,
-    4813, 1937, 323, 422, 129, -238, 1754, 277, -741, -1883, -2041, -940,
-    -1926, -2786, -1547, -3852, -3683, -3029, -2716, -2623, -155, -1432, -2328, -3599,
-    -3887, -2841, -2434, -2270, -4326, -6236, -5291, -4125, -3145, -1633, -654, -2920,
-    -3337, -1550, -878, 621, 2882, -326, -1414, -656, -900, -45, 402, 538,
-    -996, -1999, -977, -761, -661, 328, -184, -1141, -1758, 20, 1424, 2715,
-    3311, 641, -1535, -463, -764, 1385, 1558, 166, 808, 133, -1244, -1443,
-    -1669, 1406, 2773, 1083, -210, 2395, 3456, 4648, 4397, 2493, 1099, 1310,
-    1787, 2033, 795, 49, 410, 338, 441, -322, 271, 3022, 248, -2957,
-    -3509, -1528, -2005, -821, -168, -1087, -2425, -1358, -889, -181, -1569, -2033,
-    -434, -887, -1640, -1349, 1491, 3780, 2793, 2583, 1427, 2287, 3997, 4676,
-    4788, 4357, 2803, 5205, 5275, 4311, 1106, -773, 1053, 839, 627, 577,
-    3323, 3842, 2133, 2859, 3275, 5430, 6396, 6956, 6100, 4921, 2389, 5303,
-    6219, 6605, 4760, 3063, 2556, 2470, 1965, 1596, 1770, 2853, 1939, 2313,
-    2183, 2434, 1682, 2067, 2548, 3460, 856, 2160, 2254, 2945, 3884, 3143,
-    1823, 1266, -1074, 1087, 3052, 3705, 3269, 1877, 399, 1294, 2557, 3518,
-    2707, 643, -1633, 508, -417, -1021, -741, -2098, -3143, -2205, -1443, -487,
-    1375, 1393, 1654, 1233, 2099, 1195, 1765, 1837, 3724, 3821, 3597, 4870,
-    4369, 3420, 3076, 9, -288, 1042, 174, 1688, -263, -20, 1355, 876,
-    -68, -97, 1411, 2333, 309, -1129, -110, 993, 376, -506, -808, -3668,
-    -2984, -1486, 146, 1152, -1356, -936, 1259, 1871, 907, 345, -525, 1069,
-    1341, 443, 0, -123, -289, -174, -66, -740, -3152, -2318, -2259, -2047,
-    -3448, -3944, -5802, -5263, -4988, -4717, -2342, -1530, -4224, -1765, -612, -2601,
-    -27, -403, -2117, -4768, -4964, -1883, -538, -1309, -1443, -1796, -2904, -3230,
-    -2406, -2599, -2115, -1318, 241, 1899, 1413, 1420, -2974, -2841, -3356, -3474,
-    -3837, -4641, -2989, -3120, -2381, 191, 1086, -961, -2563, -2991, -1213, -2046,
-    -277, 1256, -660, 929, 573, -574, -2269, -4030, -4781, -3521, -1675, -3004,
-    -3316, -3203, -3747, -3962, -2965, -3234, -4535, -3986, -1916, -621, -2167, -1999,
-    -546, -1914, -4917, -4587, -3426, -3112, -1748, -2914, -3640, -5136, -8136, -5464,
-    -6274, -5737, -6714, -7462, -5498, -5564, -6084, -5304, -4985, -7442, -10830, -10485,
-    -8692, -6366, -4242, -3843, -4665, -5626, -5132, -362, -2419, -708, -1844, -403,
-    2565, 3897, 4892, 3696, 544, -2531, -1845, -1488, -214, 120, 886, 869,
-    597, -308, -1626, 2443, 935, 1889, 546, 2386, 3155, 4522, 5520, 4879,
-    3883, 1034, 1466, 1576, 2769, 2442, 4008, 1887, 5302, 4263, 1498, 2243,
-    2575, 906, -652, 1437, 2680, 1670, 3198, 2165, 2230, 168, 2285, 5531,
-    1478, -273, -389, 1493, 1627, 1239, -1789, -3502, -712, 1416, 1796, 3660,
-    3921, 2659, 2764, 1734, -1309, -2511, -1894, 769, -337, -804, 178, 3198,
-    4400, 2644, 790, -4049, -360, 1447, 1304, 300, 1330, 1042, 3190, 2571,
-    -653, -1491, -1517, 829, 959, 1112, 1865, 3068, 2019, 1299, 105, -2189,
-    100, 339, 886, -130, 1337, 1478, 2178, 2218, -1887, -3846, -4557, -238,
-    583, -2016, -1209, 1871, 2702, 2860, -1936, -3301, -2713, -1763, 1086, 11,
-    1140, 1453, 3106, 3683, 1450, 1659, 2479, 2815, 533, -79, -1299, 2279,
-    4708, 793, -2638, -2471, -957, 2172, 931, -453, 453, -1359, -569, 1029,
-    903, -1385, -4680, -1484, 65, 1236, 923, 3665, 3553, 1434, -94, 2531,
-    1943, 5231, 5657, 3792, 3295, 3452, 3131, 4391, 4180, 3205, -260, 1355,
-    1636, 2206, 3064, 5850, 6311, 3848, 725, -273, 1376, 3789, 3265, 917,
-    1231, 1520, 3861, 3322, 4066, 2195, -206, 2219, 1298, 2615, 4172, 5573,
-    5751, 1870, -1262, -1688, 558, 581, 1167, 1783, 1387, 1953, 2831, 4230,
-    6460, 3426, 46, 668, -525, 1112, -414, -493, -218, -2148, -2911, -2638,
-    304, 538, -300, -1938, -2886, -1807, -1458, -3256, -1988, -2477, -4337, -1533,
-    -909, -432, -1707, -2073, -1987, -3454, -4837, -5215, -4982, -4113, -3335, -2331,
-    -4817, -5728, -5472, -2995, -794, -3528, -4400, -2573, -3003, -288, 887, 272,
-    237, -2695, -2435, 535, 937, 2926, 1546, -155, -907, -2559, -256, 1044,
-    489, -1753, -4458, -4531, -5615, -2869, -1647, -3705, -3001, -3663, -4001, -1319,
-    -5777, -2531, -2601, -370, -1593, -1177, 2416, 2421, 3162, 1341, 1482, 1058,
-    1431, 525, 759, -537, -3332, -2439, -1248, 279, -655, 2583, -478, -1799,
-    -3800, -4200, -617, 145, -574, -3095, -1928, 875, 4016, 4732, 3629, 1685,
-    769, 1672, 4448, 4041, 3573, 5661, 2837, 1813, 2510, 1190, 3115, 5041,
-    4611, 1588, 2038, 2515, 2528, 3014, 1887, -115, -2594, -2579, -189, 789,
-    -490, 4180, 2674, -161, -1902, -2187, 1659, 1763, 1592, -921, -554, 759,
-    1745, 3868, 2195, -1025, -3494, -1190, 91, -673, -217, 540, -1004, -1136,
-    373, -557, -1539, 259, -2103, -3004, -1686, -1797, -2611, -2176, -1651, -2310,
-    -3694, -1189, 1941, 1104, 1737, 2876, 1825, -2411, -1724, -217, -175, -385,
-    -149, -1676, 1132, 4037, 914, 2797, 3115, 722, -1022, -1873, 675, -263,
-    -955, 561, 1705, -688, 1159, 1507, -404, 1888, 942, -491, 3593, 4895,
-    4204, 4654, 4564, 1328, -1275, -147, 476, 979, 1618, 389, -1851, -3259,
-    -3327, -1910, -3606, -2269, -4775, -5744, -3129, -4303, -4575, -2970, -3776, -6489,
-    -5932, -1583, -1709, -2207, -691, 2712, 482, 318, 2632, 2461, 1157, 602,
-    -186, 1221, 2803, 133, 72, 41, -1376, -4634, -4081, -2087, -1572, -414,
-    -835, -4230, -6348, -4692, -1695, -2336, -1833, -1527, -1363, 93, 1994, 1819,
-    1962, 2280, 1346, -1670, 1568, 1987, 479, -1210, -1867, -2002, -1662, -1349,
-    -253, -3311, -2110, -2186, -3232, 1198, 2158, 2369, 1305, 500, 60, -2108,
-    525, -913, -375, 1195, 2027, 1712, 3131, 5603, 3578, 1762, 2199, 283,
-    887, 1578, 371, 728, -780, 114, -2087, -474, 2105, -2649, -3364, -3987,
-    -5105, -5248, -3431, -302, -1522, -2451, -2102, -3034, -405, 1935, 809, 1236,
-    -197, 1, -883, 933, 1688, -437, 275, -577, -119, -1747, -2002, -656,
-    -665, -1621, -2211, -2437, 1391, 1847, 1007, 1059, -1617, -543, -328, 941,
-    -140, -3148, -1925, -494, -430, -3518, -990, 2360, 1229, 532, -385, -1238,
-    3588, 4532, 3697, 3054, 538, -60, 673, 601, -2304, -3620, -4080, -1093,
-    1043, 554, 1093, -76, -1750, -3455, -3376, -1712, -133, -2145, -869, -246,
-    -2219, -570, 1870, 3300, 1311, -616, -1053, 1823, 1381, 887, 209, 1246,
-    2879, -777, -1371, 1360, 3388, 2078, 586, -660, -2467, -1580, 296, 510,
-    -1811, -4748, -3507, -751, -2981, -1356, -2210, -2103, -1914, -2557, -970, 1558,
-    3811, 2373, 2599, 2645, 348, 888, 3096, 2427, -439, -3117, -1375, 2438,
-    1136, 2643, -370, 226, 829, -570, 573, 601, 3102, 3757, 2744, 1089,
-    11, 113, 1300, 7, -3026, -4058, 587, 2954, 3443, 5211, 1543, 440,
-    -1807, -2845, -731, 159, 424, -1862, -973, -1401, -2086, 315, 3296, 1550,
-    -1626, -2624, 819, 2597, 541, -1172, -902, 1064, 41, -278, 271, 3001,
-    4272, 2306, 1962, 1686, 2495, 1453, 1909, 913, -1884, -1619, 433, 1319,
-    1548, 2130, 1179, 1564, 606, -808, -314, 2003, 670, -2712, -3576, -1813,
-    -696, -1322, -2317, -3996, -5171, -3644, -723, -585, -2566, -1014, 1164, 854,
-    -2268, -3029, -235, 3607, 3781, 2204, 1499, 2920, 3076, 1633, 209, -2697,
-    -3542, -1579, 1694, 3542, 2461, 2220, 1197, -2453, -5377, -4449, -2595, -3005,
-    -4418, -3718, -1288, 2773, 5367, 3163, 2770, 96, -909, 643, 2541, 2186,
-    -1357, -202, 2476, 1162, 287, 1417, 5441, 5553, 3182, 2225, 1707, 2347,
-    3461, 23, -379, -560, -1435, 187, 1077, 1050, 59, -37, 1679, 1260,
-    1641, 2238, 4348, 2340, 614, 1684, 2458, 4951, 3581, -1521, -1017, -796,
-    -1425, -895, 206, -1010, -4193, -2466, -786, -3039, -5681, -3482, -1247, -3378,
-    -3569, -2773, -1291, 1898, 993, -1161, -954, -712, -1081, -9, 3744, 3628,
-    717, 1763, 785, -462, -2463, -237, 635, -3584, -2698, -2347, 1023, 4243,
-    1525, 214, -2136, -3480, -4348, -3313, 106, -2076, -6064, -5847, -1620, 1051,
-    -613, 1111, 1819, 20, 428, -25, 2772, 3902, 1701, 1082, 996, 998,
-    -436, -663, 1697, -888, -3167, -2887, -222, 1393, 1065, 1987, 1774, -225,
-    -1179, -1086, 238, -684, -1843, -2210, -3099, -203, 1352, 2664, 3375, 1365,
-    -261, -200, 2145, 2229, 881, 3619, 3759, 2523, 2029, 3330, 3329, 1380,
-    982, -738, -2442, -1273, -3129, -1511, -975, -1922, -2934, -1876, -1787, -3742,
-    -5143, -2108, -2284, -1716, -763, 1279, 3769, 5949, 4574, 1000, 283, 253,
-    1824, 4631, 3363, 1317, -1170, 54, 2007, 1045, 1318, 1115, 413, 1511,
-    982, 1594, 1053, 1399, 1131, -1377, -107, -45, 1118, 3601, 2862, 2870,
-    3299, 5264, 4627, 4246, 5195, 5198, 3647, 3706, 3844, 2629, 1274, 965,
-    -1105, -2915, -1950, -1299, 1541, 1765, 475, -14, -1301, -1666, -2695, -1384,
-    410, 73, 1434, 1779, 2911, 3166, 3860, 4695, 2782, -492, -586, 333,
-    2406, 3357, 3114, 2287, 1678, -1214, -4256, -5366, -5606, -4912, -4107, -3949,
-    -2929, -1503, 200, -627, -5002, -6354, -7683, -6215, -2211, -1789, -3636, -4100,
-    -1543, -155, 981, 2710, 1134, 1518, 4000, 3115, 1192, 1437, 1820, 1667,
-    -606, -1113, -1298, -864, 340, -270, -2105, -264, 154, -2411, -3269, -3489,
-    -2435, -869, 453, -119, -1033, -1940, -1270, -1767, -903, -470, -315, 1321,
-    2661, 2497, 1144, 1554, 1453, -1563, -2373, -2456, -2631, -707, 293, -2188,
-    -1491, -60, 1374, 28, -1728, -3413, -4134, -2053, -480, -378, -227, 499,
-    -685, -3483, -5075, -5398, -3562, -604, 380, -290, 890, 1243, 524, -1361,
-    -2571, -3865, -5354, -2273, -1394, -3063, -3402, -1064, -451, -1266, -1426, -508,
-    -2503, 93, -519, -2479, -1359, 481, 135, -1036, -208, 345, 122, 1747,
-    933, 482, 2104, 3177, 1316, 9, -766, 2034, 2908, 4337, 3006, 956,
-    76, -1796, -4060, -3826, -2464, -1645, -1132, 218, -1381, -1337, -1497, -1666,
-    -2472, -4057, -3210, -1751, -1167, 1000, 2650, 3266, 3204, 2984, 2173, 171,
-    -369, -1079, -778, -72, 24, 464, 940, 253, -157, -2050, -2936, -2406,
-    -954, 1181, 3568, 3944, 2974, 1088, 591, -254, 571, 495, 1220, 1542,
-    -17, 171, 1359, 2046, 2060, 1351, 1663, 35, 37, 1398, 2992, 882,
-    281, 16, -7, 715, 387, -1815, -2576, -2365, -1755, -1288, -796, -2161,
-    -2287, -2581, -1972, -1121, 506, 666, -90, -1883, -3047, -2931, -2375, -863,
-    246, 958, 2611, 2523, 1123, -386, -1089, -933, -1959, -266, -1026, -1708,
-    117, 2649, 2056, 724, 370, 257, -72, -31, -1052, -1466, -182, -62,
-    -1093, 140, -814, -1685, -1696, -271, -2416, -1795, 426, 2039, 3519, 2535,
-    -144, -759, -169, 88, -861, -868, 149, -1519, -2438, -1116, 697, 1805,
-    3177, 4520, 1389, 1003, 1370, 1519, 1214, -538, -1203, 535, 3146, 4359,
-    3138, 2645, 2219, 507, 1623, 3698, 2869, 1534, 2299, 3644, 3394, 6521,
-    4684, 3852, 2524, -1152, -2020, -1630, -282, 1083, 599, 655, -1485, -2166,
-    -1530, -1920, -3509, -4173, -1479, -775, -1607, -356, 1157, 3179, 2454, 1727,
-    2450, 2241, 1990, 1666, 1135, 1695, 327, -417, 651, -884, -3501, -3120,
-    -288, -2102, -2586, -2601, -779, 1305, -1537, -3166, -2742, -2510, -1446, -823,
-    -573, -109, -672, 1120, 3152, 2838, 1284, 3834, 5779, 4399, 2549, 980,
-    2111, 1498, 411, 899, 1699, 2750, 4016, 3778, 2160, 1121, 184, 1820,
-    1611, -851, -1361, 1773, 2870, 2305, 3051, 3151, 3417, 664, -1754, -617,
-    -856, -130, 2737, 3823, 2845, 564, -66, -176, -386, -3561, -2822, -1349,
-    -2313, -4888, -5275, -3510, -3171, -4404, -3148, -3072, -4103, -4914, -4392, -4256,
-    -4132, -4749, -2856, -713, -996, -2074, -802, 1415, 443, -46, 1110, 1423,
-    1634, 766, 2183, 2011, 1435, 1189, 1592, 913, -404, -1059, -134, 1281,
-    269, -462, 191, 1300, 1077, 142, -639, -2522, -2506, -177, 1958, 1959,
-    3501, 3770, 3432, 2940, 616, 1479, 2947, 706, -1774, -1487, 628, 1666,
-    1238, 2763, 936, -2376, -3836, -3361, -2797, -3046, -2426, -203, 2324, 2144,
-    -681, -580, -783, -1336, -1644, -38, 2316, 2097, 3140, 2608, 1391, 973,
-    1494, 3188, 3341, 2447, 1848, 1699, 2952, 1515, -813, 401, 864, -540,
-    -2098, -1119, -778, -1582, -1463, -2780, -4071, -4310, -2051, -466, -202, 144,
-    -1510, -1146, 168, -791, -381, 1377, 2072, 2657, 2149, 4128, 3179, 4415,
-    3307, -264, -2139, -2833, -2049, -887, 425, 1001, 1383, 1281, 980, -1044,
-    -963, 187, -471, -2888, -1814, 125, 986, 2986, 2640, 3043, 2409, 860,
-    678, 863, 1726, 2130, 1490, 2990, 3892, 860, 530, 220, -762, -1926,
-    -63, 429, 1642, 725, -932, -2, -41, -998, 204, 2034, 2396, 644,
-    -557, 1371, 1746, 412, 1188, 2325, 1113, -476, 442, 891, 846, -1089,
-    -1736, -1099, -1756, -2073, -653, 252, -701, -3996, -6528, -4755, -4192, -3329,
-    -1900, -1269, -2295, -1926, -242, 342, -279, -2766, -3052, -2919, -2963, -1822,
-    900, 3601, 3319, 2568, 2383, 3068, 2158, 1272, 951, -96, -1778, -1135,
-    1513, 1644, 793, 512, 698, -826, -2970, -2986, -1251, -107, -2069, -2646,
-    -1503, 43, -763, -1914, -2052, -2248, -3008, -772, 1930, 1015, -485, -2071,
-    -2972, -3029, -3369, -2911, 275, 149, -3261, -5368, -4424, -3045, -2811, -2926,
-    -4029, -3894, -3594, -1522, -442, -1321, -1781, -2434, -2711, -2811, -2193, -192,
-    3654, 3201, 208, -1794, -592, 535, 1008, 1567, 764, -1, 600, 1823,
-    2130, 2107, 406, -1581, -2445, -1926, -845, 1672, 3520, 1546, -536, -190,
-    1202, -49, 24, -1132, -2485, -3353, -1910, -825, 818, 876, 504, 494,
-    -838, -2193, -1412, 1287, 1946, -465, -1783, 89, 1574, -36, -459, -1179,
-    -2981, -3149, -1605, 246, 1040, 641, -756, -2342, -3580, -3710, -1066, 1896,
-    1102, -614, -1686, 433, 799, 1475, 2930, 1323, 400, 1522, 1096, 1079,
-    1143, 360, -515, -1915, -3310, -2385, 1244, 3550, 1788, 49, -750, 16,
-    -1300, 199, 1889, 1154, 1613, 2408, 2954, 3792, 3374, 1209, -337, -2179,
-    -2226, 216, 3951, 4283, 2382, 813, 2220, 2122, 1043, 1509, 723, -137,
-    404, -810, -504, 1133, 90, -648, -348, -2239, -2695, 41, 997, 93,
-    -959, -1487, 226, -539, -1540, -1578, -2513, -1440, -392, -226, 1880, 2338,
-    640, -737, -2430, -3216, -1483, 1284, 611, 241, -101, 482, 404, -22,
-    -150, -884, -1891, -1199, -1164, -1770, -1439, -2701, -3113, -3477, -3878, -3251,
-    -1125, 277, -840, -909, 295, 957, -840, -814, -399, -944, -164, 1525,
-    2249, 2779, 2817, 1268, -112, -2497, -2677, -1713, 751, 2152, 1622, 2744,
-    5765, 5745, 3557, 3517, 2780, 1301, 1987, 2644, 3117, 3985, 3818, 4564,
-    4340, 3535, 3467, 3056, 3796, 1335, 141, 2687, 4445, 2526, 1993, 1352,
-    567, -999, -310, 1027, 2088, 1448, 926, 77, -2451, -4302, -3474, -2312,
-    -1256, -3259, -2299, 481, 310, -1035, -559, -511, -1032, -1438, 296, 1204,
-    785, -534, -109, -709, -2056, -1313, 537, 2926, 1663, -599, 1069, 1823,
-    774, 233, -165, -197, -1928, -1264, 1306, 2663, 1926, 874, 304, -1125,
-    -2375, -1590, 477, 3924, 2720, 2385, 4304, 4735, 3754, 3248, 2957, 1368,
-    -1266, -230, 997, 703, -5, 218, 743, 497, 608, 159, 718, 643,
-    -3250, -2522, 253, 1153, 1176, 607, -151, -1525, -2146, 720, 2058, 1125,
-    763, 239, -44, -1135, -1877, -2054, -771, -1628, -2243, -1566, -1315, -1472,
-    -2036, -1388, -2479, -4588, -3389, -992, -1545, -2626, -2971, -3134, -4022, -3702,
-    -2335, -1638, 1, -399, 372, 458, 1130, 1599, 1270, 1710, -214, -1626,
-    600, 2005, 1495, 996, 316, -503, -2000, -2238, -1743, -798, 164, 1316,
-    1638, 829, 822, -312, -108, -452, -1563, -1245, 1616, 1671, 1113, 1097,
-    1467, 1997, 2357, 4289, 3516, 2200, 1000, 1025, 1470, 1397, 1632, 992,
-    98, -1468, -2947, -2732, -1672, -1576, -1032, 257, -89, -1197, -502, 315,
-    1143, -110, 202, 1487, 1310, 408, 102, 1525, 2632, 1995, 954, 1818,
-    2442, 334, -1606, -2660, -3652, -4103, -2348, -1828, -1222, -2138, -1066, -360,
-    -850, -1437, -1522, -1431, -1400, -1828, -1568, -713, -320, -798, -785, -965,
-    -1318, -1271, -175, 115, -509, 211, 1928, 3141, 2850, 2364, 2148, 1835,
-    1555, 2172, 1654, 2395, 1418, -114, -921, -347, -183, 2410, 3627, 3301,
-    683, -196, -445, -750, 516, 1416, 1298, 972, 980, 1815, 1208, 1933,
-    1371, 1361, 1692, 1393, 863, 428, -41, -1174, -3064, -3208, -3028, -2626,
-    -1896, -1441, -2003, -1771, -945, -991, -100, 610, -65, -1399, -1784, -1304,
-    1072, 801, 908, -27, 786, 2555, 2364, 2729, 2501, 1963, 643, 269,
-    654, 649, 387, -199, -870, -1696, -2516, -2193, -1832, -2476, -3027, -2887,
-    -1553, -154, 1668, 2019, 1780, 623, 228, 153, 1428, 772, 579, 55,
-    -889, -769, -1037, 683, 1398, 1294, 805, 227, -95, -1088, -2351, -1574,
-    -518, -541, -1604, -1057, -645, -585, -486, -1174, -547, -524, 619, 1425,
-    -421, -1691, -1362, -1008, -564, -1023, -2070, -1058, -262, 215, 1301, 1763,
-    951, 806, 1219, -543, -1906, -3733, -1770, -1003, -3279, -3334, -3079, -2493,
-    -438, -1141, -359, -473, -608, -114, 764, 1559, 1776, 2277, 1148, 504,
-    345, 693, 1628, 363, 89, 176, 169, 1164, 1723, 1399, 1574, 558,
-    -168, -1210, -895, -142, -896, 393, -84, 433, 200, 982, 1054, 779,
-    660, 1484, 1245, 1606, -88, -1195, 699, 1066, 2, -1259, -1539, -1170,
-    -1429, -1122, -2334, -2818, -877, -1116, -1076, -2050, -2832, -2494, -1674, -1632,
-    -1529, -1204, -533, -977, -1293, -1286, -450, -29, 1413, 1289, -143, -1697,
-    -1278, -1904, -1686, -3358, -2884, -1876, -1233, 160, 2093, 2074, 478, -460,
-    -1494, -823, -505, 220, 1183, -216, -2147, -1279, -628, -814, -1169, -842,
-    -416, 1537, 2195, 2802, 3767, 4311, 4333, 3355, 1996, 2345, 3694, 3966,
-    3740, 2902, 3088, 2751, 2381, 1671, 818, 1215, 626, 1379, 2290, 266,
-    -1728, 645, 825, -148, -1250, -2219, -588, 171, -682, -1652, -106, -146,
-    -331, -1727, -1082, 201, 58, -829, -330, -904, -2634, -2812, 628, -2590,
-    -2478, -836, -1803, -841, -68, -231, -1149, -1504, -1927, -5713, 85, -534,
-    27, 2745, 498, 3470, 2977, 3296, 2586, -295, -222, -259, 1078, -696,
-    1862, -43, -2090, -2403, -938, -4200, -2208, 2090, 2520, -1235, 2745, -2908,
-    3070, 6046, 3123, -2275, -2437, 555, 690, -1027, -835, 3236, 780, -2165,
-    577, -518, 1262, 2047, 3763, 4563, 2608, 1691, -86, 3287, 884, -1701,
-    35, 1221, -684, 73, 2921, -752, 1337, -1767, -3027, -1254, 459, -1167,
-    2417, -988, -2231, -464, 2731, 2287, -1332, 1147, -2405, 5, 1178, 3030,
-    1457, 384, -2182, -726, -4598, -824, -28, -2508, -1333, -3874, -5532, 1280,
-    351, -4250, -4195, 1651, 2884, 316, 4992, 3989, -1187, -2595, -4165, -4030,
-    -583, 889, 2644, 1442, 2451, 490, 1888, 1092, 4442, 5751, 2676, 176,
-    -1585, 3567, 556, 1951, 3900, 1834, 5342, 8063, 2853, 8663, 3355, 1633,
-    2786, 3056, 467, 650, 614, -3451, -2497, -3129, -3098, -1992, -2260, -578,
-    -2939, -2929, -1162, -1719, 2438, 2675, 7076, 2720, 3681, 3915, 2271, 1792,
-    -2169, -1099, -4327, -7193, -8926, -4760, -5429, -7854, -7674, -7094, -6438, -8075,
-    -3386, 90, 412, 557, 2406, 4299, 7455, 6955, 5192, 2839, 651, -4384,
-    -3684, -6308, -2406, -4290, -10696, -10495, -4624, -1996, -4299, 466, -295, -3761,
-    501, 104, 3203, 5423, 3256, 6796, 8365, 6012, 7214, 9944, 11948, 6958,
-    2161, 5331, 3654, 5343, 738, 3003, -2272, -215, 3568, 1492, -1421, -1481,
-    -2396, -4725, -4944, 1394, -1086, -6638, -4582, -5211, -1035, -1767, -1525, -354,
-    -2119, -3696, 956, 797, -3430, -3180, -1835, -3799, -3021, -1806, -320, -1737,
-    -920, -904, 912, 1402, 1250, 2857, -720, -23, -1257, -733, 520, 1236,
-    -2506, -1082, 1463, 2023, -2490, -1939, -4537, -540, 2049, -4249, 409, 1247,
-    483, -54, 3382, 354, 311, -2295, -5537, -1229, 1490, -999, 2220, 4865,
-    602, 263, -1416, 54, -519, 2851, -471, -1077, 171, -635, -1025, 1567,
-    -523, -3941, -2340, -759, -602, -1349, 2461, -3661, 615, 878, -986, 1565,
-    4220, 4102, 1482, 1095, 6433, 4260, 1241, -243, -701, 1646, 2938, -16,
-    1299, 3373, -382, -1805, -1144, 799, 4672, 4224, 1362, 3371, 1693, 2013,
-    3860, 1497, 437, -1547, -548, 2518, 3026, 7374, 4527, 2668, 4509, 2694,
-    429, -1255, 374, -593, -2371, -1191, -2529, -4171, -3705, -2596, -1073, -766,
-    -1809, 3036, 3030, 2165, 3010, 5216, 1242, 4509, -926, -642, -702, -1253,
-    928, 5882, 3974, 4826, 2651, 2661, 7125, 7898, 5868, 4242, 3309, 3805,
-    955, -779, -3916, -8046, -7726, -7373, -5887, -6139, -6967, -5387, -5234, -7113,
-    -7648, -5254, -4846, -8460, -7037, -7528, -6862, -5041, -4603, -4568, -3174, -4434,
-    -6137, 96, 1739, -1668, 1902, 1790, -3479, 789, 1422, -3614, -2817, -994,
-    -1151, 1610, 2275, 2236, -700, -1731, 1443, -1276, -165, 2384, -387, -3671,
-    1638, 1622, 1694, -3188, -2185, -5127, -5474, 641, -1055, 967, 5335, 4043,
-    5038, 4966, 3502, 3795, 3387, -1409, -875, -2623, 5727, 4370, -427, -234,
-    -2857, -2914, -3345, 990, 1143, -2152, 2640, 3392, 3372, 145, 4693, 597,
-    1858, -5724, -3790, -33, -2121, -3060, -286, 59, -2456, -4280, -4438, 1192,
-    -1070, -92, 2491, -1346, -1585, -1745, -3620, -3864, -3852, 324, -2006, -1178,
-    587, 664, 2058, 1063, 1957, 1655, 2496, 1107, 1737, 3806, 10657, 3319,
-    2170, 5980, -1782, 3745, 4485, 1246, 2220, 7048, 2830, -4668, 6392, -1075,
-    -5196, -4193, -1417, -315, 1545, 2304, 1374, 3285, 5515, 7210, 1643, -3693,
-    558, 2506, 1854, 3393, 4006, 3149, 669, -346, 1347, 1990, -501, 866,
-    3678, 7322, 2685, 6951, 2013, 1112, -225, -4884, 638, 4745, 1904, -1030,
-    -1866, -278, 1329, -3086, -3743, -6687, -6564, -4141, -3011, -1032, -2455, -8555,
-    -4696, 1935, -4391, -6141, 273, 1831, 1678, 2993, 2160, 4851, 6843, -1921,
-    322, 957, -413, -1327, -1088, -398, 1644, -2174, -3567, -2092, -2224, -1024,
-    115, -3749, 1208, 4022, -384, 5449, -604, -4641, 2580, -2477, -668, 683,
-    4971, -779, 939, 2155, -2909, -546, -2960, -6547, -5175, -1938, 152, 3166,
-    -2205, -4873, -7303, -1993, 4527, -1315, -744, -3178, 2081, 3814, 4751, -2075,
-    1213, -2326, -4210, -4839, -1448, -580, 3445, -2391, -5194, -1483, 3004, 348,
-    -1017, 3233, 495, -4389, 3031, 5747, 4057, -3042, -3274, 784, 1851, 2963,
-    1839, 299, -1487, 2504, 5801, -114, -1307, -4383, -4795, -3829, -6831, -6972,
-    -3919, -3034, 662, -1645, -7155, -6436, -2445, 824, -321, 4068, -87, -5674,
-    -1919, -1064, 519, -679, -5001, 801, -434, 1157, 4406, 3161, 3907, 4160,
-    4522, 1589, 2577, 3426, 6312, 963, 3954, 1184, 3140, 2730, -25, -1564,
-    -2521, 211, -1623, 3499, 949, 2016, -4133, -5924, -2813, 322, -2944, -2217,
-    -7988, -3922, -1524, -2809, 3533, -1869, -6208, -2036, -1425, -1465, -1958, 4019,
-    2263, -151, 1370, 4811, 3749, 1638, 1194, -52, 1038, 5175, 4676, 2637,
-    -2056, -236, 1143, 1739, -1016, 2799, 2292, 257, -841, 2688, 5758, 4912,
-    4371, 4156, 1570, 7743, 9907, 4787, 2545, 1207, 2655, 3527, 1823, -857,
-    -3170, -2298, -1176, 2123, 5373, -122, 414, -3701, 2537, 6094, 3672, 1858,
-    2390, 4361, 4644, 3528, 3822, 4990, 4848, 4552, 1766, 1121, 7456, 10747,
-    3395, -100, -3671, 397, 4142, 5180, -382, 235, -3325, -1794, -822, -1361,
-    725, -3354, -2961, -7184, -8236, -2026, -4930, -3747, -8266, -5945, -5805, -2358,
-    -3083, -3896, -3672, -3623, -2443, -49, 88, -3111, -3942, -2968, -1673, -349,
-    -1094, -986, -2704, -4440, -3389, -5085, -2024, -691, -1175, 334, -3013, -3699,
-    -1941, -43, 2617, -2034, 1025, -3349, -424, -867, -734, 1275, 4142, -1739,
-    504, -1679, 1267, 1974, 769, -1808, 1306, 404, 4629, -2132, 148, 3765,
-    371, 1956, 3077, 2220, 1638, 949, 4086, 3907, 1882, -2408, -2590, 613,
-    -241, -906, 59, -3456, -3092, -2752, 1847, 1572, 1038, 2210, -1383, -1037,
-    4171, 5850, 3106, 2743, 3895, 5262, 1828, 3784, -145, 2320, 3223, 577,
-    984, 1273, 1783, 2982, 380, -660, 1055, 3720, 1518, -411, 1876, -1745,
-    42, -2880, 4653, 2775, 3730, 762, -646, -4208, 416, 4351, 80, -1771,
-    -3147, -1374, -790, -43, -845, 997, -683, -1144, -402, 4242, -1217, 1994,
-    6234, 2650, 1378, 3742, 3033, 4488, -2455, 1918, 3326, 4478, 1202, -1152,
-    4458, 1420, 3720, 5612, -1177, 1429, 2526, 624, -3017, -4463, -6206, -822,
-    -3070, -5537, -13411, -6413, -10448, -3803, -4222, -10709, -8762, -7051, -3498, -6464,
-    -6408, -5408, -6624, -9939, -5133, -7094, -4151, -4869, -3848, -2728, -5422, -4225,
-    3484, 2102, 362, -2393, 368, 579, 871, 2886, 5298, -571, -805, 1859,
-    246, 177, 191, 580, -2659, 692, 1884, -3581, -4293, -708, 3449, -802,
-    -5212, 1490, 991, -1448, 3037, 3629, -82, 759, -129, 1953, 761, 5463,
-    2077, -1434, -1606, 1660, 2109, -1230, -1360, -2838, 996, 664, 269, 1428,
-    2875, -992, 884, 556, -1433, -787, 1939, 1122, 795, -2084, -458, -1993,
-    -104, -1119, 1529, -832, -5392, -2631, 1347, 4435, 2040, 1765, 4406, 5,
-    -2405, 785, 4012, 3561, 2123, 2299, -664, -1115, 2608, 4991, 4273, 232,
-    -2998, 4002, 6253, 4409, 2153, 1325, 4772, 1743, 3035, 5384, 4477, 6917,
-    2284, 1135, 5764, 8903, 6768, 1957, 2136, 6353, 1889, 4152, 2632, 4940,
-    3254, 7336, 763, 1729, 7105, 3874, 4200, 4914, 917, 2562, 7281, 4015,
-    2407, 2415, 3777, 6002, 3531, 2181, 1997, 4139, 3041, 2925, 4973, 991,
-    766, -1779, 2527, 1380, 2259, 905, 1402, 1993, -832, 3943, 569, -1274,
-    -533, 1217, 3121, 486, -4642, 190, 198, -571, -4340, -3972, 483, -72,
-    154, 790, -3592, 1128, 5383, 2605, 88, -269, 2016, 1438, 1655, -306,
-    1452, -2773, -2235, -4252, -3247, -1369, -2335, -2349, -1245, -4275, -579, -1569,
-    -5036, -272, -2042, -2455, -3219, -213, 1006, 1255, 1237, 2430, 739, -934,
-    1422, 1110, 2159, 388, 1626, -1296, -786, -161, 3196, -2267, -5890, -3617,
-    -2343, -3614, -4876, -2707, -4859, -2465, -5212, -6935, -5816, -8341, -5583, -4450,
-    -4150, -3776, -4051, -4493, -3142, -2577, -2453, -4683, -2136, -1327, -2324, -445,
-    2008, 1766, -2336, -2392, -834, -1336, -505, 178, -1172, 348, 1606, 3106,
-    1304, -451, -1367, -4024, -2783, -115, -3533, -4625, -3295, -5056, -5504, -7686,
-    -7954, -6111, -6502, -5054, -2883, -3077, -3994, -3271, -536, -4059, -2805, -3492,
-    -4414, 462, -988, -1024, 1567, 1129, 532, -3079, -2543, -3127, -800, 570,
-    473, 548, 2355, 203, -408, -623, -1896, -1916, 966, 1395, 76, 1103,
-    -1803, -254, -1453, -2826, -5951, -4181, -2783, -5149, -2576, -1695, -5455, -5721,
-    -1679, -2110, -4605, -3865, 17, -1933, -1554, -843, 592, 3535, 1694, -1223,
-    -1110, 2480, 1829, 2957, 5431, 4688, 4490, 3753, 1574, 782, 2181, 1862,
-    2085, 1861, 2304, 389, 2415, 3446, 1907, 171, 564, 2240, 3563, 3995,
-    4924, 5737, 3606, 2508, 4062, 3188, 4081, 5447, 6125, 3047, 4522, 4707,
-    6316, 5506, 4544, 4881, 3397, 3557, 6724, 5745, 5746, 6659, 3245, 2963,
-    -27, 1938, 1641, 6369, 6906, 3430, 3797, 3887, 2417, 4868, 2951, 2084,
-    274, -1077, 1722, 919, 1791, 2405, 230, -908, -1642, -845, 1000, 1413,
-    1594, 973, 1105, 1250, 1739, 638, -1048, -2584, -4221, -2356, -289, -2609,
-    -1397, -1791, -2079, -3281, -2814, -3462, -898, -188, 1199, -715, -1959, -925,
-    499, -1273, -111, -1084, -404, -34, 1221, -1423, -433, 716, 316, -4175,
-    -547, -815, 464, 3425, 3547, 2438, 2377, 5864, 5199, 3705, 3066, 4305,
-    4229, 3377, 4375, 4251, 4112, 1035, 814, 1048, -699, 334, 4177, 5123,
-    2646, 1656, 1739, 938, -416, -482, 367, -654, -2039, -2939, -2545, -2290,
-    915, -1211, -2467, -2985, -1390, -1401, -6, 2769, 1705, 1322, 3012, 2225,
-    3851, 4450, 4260, 3584, 4021, 3852, 3103, 4629, 5695, 4868, 1861, 818,
-    2172, 3442, 722, 1284, 175, -1727, -1994, -1538, -1020, -942, 318, -326,
-    -2219, -3555, -2735, 231, -2266, -620, -2006, -67, -2772, -1332, -1281, -688,
-    -1095, 970, 582, -977, 1547, 2100, 84, 206, 306, 254, 2341, 3015,
-    371, 2364, 263, 2724, 366, 654, 1099, 3126, -25, 710, -133, -1628,
-    -1035, -1491, -2174, -1691, -3553, -4539, -4172, -4941, -3319, -3677, -5576, -7215,
-    -8462, -8556, -5850, -4804, -7346, -4928, -4179, -7473, -8648, -6205, -4985, -5688,
-    -8870, -6839, -4351, -4897, -6481, -3647, -2650, -3779, -5781, -4823, -3369, -4789,
-    -5937, -2647, -3489, -6089, -2439, -1275, -1518, -2887, -4922, -5040, -3825, -4282,
-    -3718, -3318, -1071, -1841, -3908, -2932, -2200, -1019, -1401, -242, -3332, -3099,
-    -75, -1397, 678, 128, 96, 168, -93, -114, 102, 417, 757, -889,
-    -1411, -2314, -723, -156, -1257, -2227, -5400, -6430, -4825, -3882, -5203, -4362,
-    -4423, -4549, -2740, -3837, -1189, -842, -909, 923, -3057, -1801, 2141, 1834,
-    649, -851, -3145, -1657, -664, -568, -480, 401, -2323, -1070, -1131, -817,
-    2790, 1360, -613, 2783, -140, 603, 2933, 422, 1146, -1025, 506, 158,
-    2390, 2365, 1305, 1420, -928, -1119, 438, -367, 644, 1488, 3870, 4468,
-    2252, 3801, 3571, 5377, 5238, 6340, 2766, 4036, 6686, 6866, 6574, 6228,
-    5660, 4433, 5429, 3955, 2457, 3568, 4882, 3099, 508, 867, 3529, 1784,
-    2416, -17, -898, 5, -286, -334, -90, -693, 20, 66, 1593, -1260,
-    732, 2476, -444, 1517, 1121, 538, 2817, 1502, 3375, 2641, 1534, 1956,
-    5732, 5447, 5813, 4487, 4796, 3587, 2446, 2400, 3217, 4197, 3512, 2435,
-    316, 2277, 2739, 340, 498, 1055, 735, 1772, 1932, 578, 2163, 1138,
-    -1242, -3026, -1949, -2239, -745, -822, 1471, 404, 698, -591, -465, 279,
-    1893, 1328, 1024, 2516, 5427, 2536, 4160, 4382, -239, 779, 2275, 3086,
-    2880, 3426, 3871, 3559, 2665, 644, -6, -910, 1607, -838, -2723, -1765,
-    200, -1363, -1368, -3053, -4373, -2859, -4188, -4416, -3947, -3433, -2796, -2330,
-    -2090, -1932, -2749, -2258, -1389, -1727, -1291, 802, 1608, 199, 1116, 726,
-    -1821, 16, 1508, -664, -1662, 1247, 1189, 806, -760, 273, -104, 142,
-    1615, -79, 695, 1809, 1296, -2111, -897, 232, -3654, -2692, -2912, -3919,
-    -2554, -1843, -403, -252, -827, -308, -764, 1350, 421, -273, 1947, 2504,
-    3770, 3252, 1434, 2503, 3261, 3058, 1365, 74, 2735, 2822, 2200, 1172,
-    -604, -3011, -1504, -879, -1314, -2957, -1408, -2698, -4074, -2883, -525, -2918,
-    -3379, -3780, -4322, -2579, -2737, -2047, -947, -2000, -1972, -2632, -3525, -1494,
-    -2686, -3913, -603, -1592, -1555, -3315, -2681, -1971, -977, -1499, 2574, 1587,
-    792, 1175, 2243, 789, -378, 685, -206, 3508, 2178, 1608, 2878, 1980,
-    1276, -1819, -3691, -1134, -930, -205, 211, 783, 3052, 2071, 4067, 3180,
-    2939, 2135, 3891, 3750, 2862, 4515, 5003, 5152, 4025, 1379, 2607, 3407,
-    3756, 4921, 2816, 2686, 4672, 3769, 3702, 2599, 94, -2709, 293, 1048,
-    149, 344, 1198, -1823, -1757, -2482, -1557, 37, -4029, -3253, -283, -2329,
-    -1697, -794, 1194, 684, -24, -2110, -1813, 671, 297, -54, 890, 301,
-    -1312, -1861, 838, 1184, 1736, -227, -147, -762, -3282, -1377, -1751, -2951,
-    -3779, -4743, -1107, -835, -2637, -2452, -4848, -5349, -7002, -6705, -4901, -4323,
-    -2982, -2485, -2997, -3535, -1186, 45, 605, 2188, -329, -947, 369, 1408,
-    1009, 562, 1558, 2182, 36, 2021, 2595, 2578, 3284, 5595, 5064, 3692,
-    2186, 3066, 4864, 1595, 1440, 1349, 44, -351, -295, 1616, -2244, -3086,
-    -3788, -4278, -3031, -2595, -2592, -2734, -3325, -4144, -4688, -2192, -2072, -3819,
-    -712, -2662, -2925, 1453, -759, 404, 77, -2363, -3966, -1493, 2516, 1289,
-    2801, 767, 2271, 365, -1181, 514, 1542, 1084, 454, -1925, 1377, 2741,
-    754, 716, -276, -1647, -4532, -2325, -904, -985, -1177, 796, -748, -3381,
-    -802, -244, 1596, 1092, -759, 585, 515, 3260, 2838, 2258, 2323, 791,
-    1641, 1365, 3807, 5580, 2594, 3777, 4615, 3092, 2526, 2701, 1901, -176,
-    -1633, -1671, -134, 785, -2292, -64, -1285, -1145, -3601, 130, 558, -2926,
-    -2854, -1259, -1136, -2414, -920, -983, -1796, -1772, -4269, -6349, -1035, -2690,
-    -4941, -6137, -4764, -5404, -6829, -4021, -5219, -3411, -3106, -2956, -3352, -3506,
-    -4086, -2838, -3481, -2949, -3745, -1793, -296, -335, 874, -717, -3306, -2821,
-    -2084, -3105, -2554, 927, -1759, 298, 1647, -345, 1137, 1590, 698, -854,
-    735, 3069, 2507, 1999, 1538, 1155, 262, 1948, 3503, 1888, 1125, 2097,
-    2166, 2918, 1272, 132, -304, -60, -1257, -2928, -2810, -1116, 219, -3506,
-    -2520, -514, -2021, -948, -1615, -2280, -1960, -2725, -2667, -1797, -378, -2154,
-    26, -399, -588, 424, 1926, 1963, 960, 1678, 2077, 2710, 1894, 4566,
-    1913, 3204, 3189, 2154, 24, 2598, 1410, -1325, -1399, 1164, -663, 696,
-    1881, 1419, -1643, 1287, 1031, -1469, 475, 424, -207, -903, 1801, 3278,
-    4408, 4560, 4642, 1529, 1484, 3752, 2513, 2759, 4693, 5403, 1136, 2838,
-    4676, 5034, 4497, 4432, 6228, 4245, 4547, 4840, 9692, 6440, 4727, 3987,
-    2116, 2044, 4695, 3532, 4701, 2460, 2557, 161, 846, 623, -109, -2586,
-    -1181, -1377, -692, 275, 3736, 906, -2670, -5681, -3030, -1098, 262, -728,
-    1953, -1069, -1591, 1281, 1642, 1119, 1192, -987, 441, 796, 1966, 5138,
-    4164, 2186, 1317, 873, 674, 2550, 2041, 920, 1602, 1761, 219, 2170,
-    2115, -8, -1499, -1572, -538, -589, 1069, 4394, 4103, 1024, -796, -1499,
-    -1418, 334, 1235, 1285, 1341, 409, 1806, 1413, 4958, 2951, 1927, 4378,
-    2612, 2219, 5071, 6141, 5620, 3939, 1854, 424, -138, -847, -1230, -861,
-    -2847, -631, -1288, -1096, 145, -3425, -3800, -4160, -4266, -1668, -865, 147,
-    -1273, -4079, -4131, -5292, -3632, -3932, -4102, -3139, -4374, -4386, -3591, -3074,
-    -4108, -4451, -2709, -4335, -2321, -1835, 1880, 2092, 566, -1530, -161, -434,
-    -288, -1235, 670, 856, -323, 2082, -415, 2373, -753, 238, -1871, -2448,
-    375, 2141, 2392, 2146, 235, -489, -717, -645, -801, -2685, -396, -1198,
-    856, -1968, -3114, -450, -828, 1553, -75, 925, 1921, 2526, 441, 3437,
-    2513, 997, 202, -217, -3044, -1506, -1329, -163, 700, -26, -827, -2182,
-    -3820, -3293, -4567, -3942, -1968, -2953, -3448, -2264, -3833, -2656, -2633, -3413,
-    -3665, -2181, -2868, -2264, -400, -804, -1053, -2184, 653, -874, -4025, 823,
-    618, -2037, -881, -836, -3273, -1463, -2296, -3976, -3735, -4552, -1476, 544,
-    -481, -1910, -2927, -887, -53, -2884, -462, 814, 936, 2419, 3132, 2766,
-    2865, 4468, 2128, 820, 1493, 1768, 4788, 4853, 3823, 4307, 3343, 5983,
-    4285, 5553, 5455, 6291, 5506, 4389, 3899, 2498, 4763, 3346, -995, -942,
-    -1412, -1030, 1111, 2050, 499, 1036, -2163, -2245, -1182, -2853, 156, 804,
-    -1832, -1403, -56, -1009, -2260, -1410, -1057, -4095, -2470, -1661, -1062, -1747,
-    -460, 393, -2951, -3086, -1915, -1415, -25, -1092, -3399, 380, -1780, -1196,
-    -764, -1496, -1587, -3932, -2417, -1368, 143, -1337, -798, -2479, -2032, -3818,
-    -3421, -2977, 1480, -2438, -3697, -1386, -3338, -1821, 616, -1580, -3038, -2130,
-    -500, 1943, 498, 1143, 1608, 2419, 4359, 4432, 5102, 5482, 5920, 4227,
-    3578, 3767, 4573, 3304, 2018, 1937, 274, 744, 2615, 4145, 813, 1049,
-    6, 621, 612, -1358, -207, 1706, 483, -2956, -2761, 110, -1794, -2894,
-    -3373, -3129, -3662, -2880, -272, -2880, -2076, -1169, -2314, -1742, -1488, -1128,
-    -663, 2069, 948, -1230, 70, 590, 1698, 1474, -752, 160, 242, 890,
-    1554, -232, 2311, 263, -824, 2288, 365, 487, 2487, 4431, 2484, 1743,
-    3987, 2366, 2364, 2574, 404, 2095, 2509, 2597, 2406, 1205, -1618, -794,
-    1098, 2269, 1915, 2505, 3051, 3684, 941, 295, 1804, 2563, 2461, -1191,
-    -1854, 557, 1885, 2573, 3376, 1409, 27, -136, -345, -164, -1102, -462,
-    695, 42, -2639, -33, -570, 1698, -2217, -2957, -1229, 53, 1943, 2266,
-    -495, -2347, -279, -673, -1613, -2654, -676, 144, -593, -1343, -2508, -1848,
-    -1141, -2381, -4087, -4659, -3130, -2113, -1043, -2633, -1596, -2047, -1633, -782,
-    -486, -2639, -2538, 492, 982, 409, 459, 2893, 4006, 2592, -1546, -1035,
-    1237, 1528, 1388, 958, 164, 272, -373, 462, 2328, 3762, 4283, 3215,
-    3293, 2150, 4624, 4922, 3796, 897, -91, -603, 740, 2615, 2109, -142,
-    -1009, -1564, -1874, -3230, -4758, -1406, -1192, -4018, -861, -2008, -2016, -1195,
-    -115, -1170, -5162, -4063, 1149, 198, 216, -1270, -1018, -736, -1621, -2096,
-    158, 1958, 3430, -222, 559, 2470, 2278, 1990, 1765, -20, -202, 178,
-    2438, 2591, 1478, -323, -2142, -795, -1424, -923, 1232, 1335, -2054, -2257,
-    1805, 904, 2899, 4049, 1580, 224, 2807, 927, 3837, 4617, 3461, 1746,
-    2663, 4087, 3422, 4033, 6092, 5589, 4306, 3782, 4171, 3861, 4364, 4271,
-    2352, 1352, 594, 3231, 2762, 2249, 3060, 2958, 2025, -1130, -1146, 560,
-    -384, 409, -1708, -1416, 347, -1091, 384, -2371, -2831, -3047, -5360, -2483,
-    -2003, -2632, -1223, -2429, -1683, -2411, -3114, -1571, -1035, -323, -248, 1689,
-    861, 2304, 3530, 1092, 2740, 568, -188, 1797, -375, 2541, 3840, 1758,
-    1023, 1526, 1145, 1932, 721, 716, 1506, 1411, 1095, 2512, 1276, 913,
-    109, -1276, -1451, -280, -947, -532, 1317, 371, -2159, 657, 1452, 1738,
-    3534, 2788, 2015, 3095, 3329, 786, 2587, 1197, -181, -100, -366, -803,
-    902, 1669, 1762, -765, -2342, -1454, -4326, -4666, -3725, -2588, -2765, -4572,
-    -2739, -3349, -4172, -1240, -1718, -2874, -5812, -4427, -1112, 0, 301, -506,
-    -2288, -2794, -2952, -1332, -621, -617, -1686, -2903, -582, -2107, -2679, -344,
-    -3658, -5152, -6616, -4632, -2186, -679, 1331, -474, -1318, 580, -1617, -308,
-    911, -462, -251, 674, 1109, 1893, 3110, 2877, 898, -1570, -3169, -1328,
-    1175, 1398, -36, 356, 817, 649, 1374, 1897, 2758, 1503, -588, 1112,
-    235, -142, 1948, 550, -2186, -1996, -2108, -361, 1285, 2864, 373, -3102,
-    -3325, -4243, -2522, -2421, -1225, -1343, -3393, -2120, -2328, -2190, -622, -1849,
-    -5043, -7071, -6150, -4408, -2041, 47, -2346, -3632, -3739, -2237, -2392, -578,
-    -864, 933, -424, 86, -142, 744, 871, 419, -3237, -5412, -4185, -821,
-    -543, -1806, -794, -2469, -2909, -2492, -809, -2896, -621, 217, -2322, -2598,
-    -428, 2565, 2225, -666, -2921, -1231, -1498, 1999, 1944, 2921, 2558, 2100,
-    3349, 5494, 3551, 3722, 5870, 5119, 5240, 7513, 4912, 7176, 6624, 1983,
-    3312, 4894, 5524, 3432, 2964, 847, -1273, -2110, -1855, -2619, -2891, -1946,
-    -2293, -1115, -2457, -1330, -2508, -895, -2280, -3804, -4504, -3134, -2082, -793,
-    -421, -928, -3193, -1982, -1950, -649, -1223, -689, 991, 2027, 5181, 4737,
-    2133, -1014, -3638, -5537, -6803, -4330, -2242, -32, -1529, -414, -2062, -2263,
-    21, 1928, 61, -411, 1679, -290, 1189, 2228, 1859, 3466, 5006, 894,
-    4122, 2502, 353, 1052, 1219, 1330, 2131, 1593, 179, -1423, -1105, -2474,
-    -3038, -2744, -1880, -1562, -315, 1177, 500, 2774, 2840, 3378, 4825, 3969,
-    4081, 4503, 2380, 2424, 109, -493, -4141, -3277, -5531, -4507, -2816, -4016,
-    -5245, -4392, -3415, -2024, -3133, -2401, 1776, 1473, 2558, 5221, 5203, 4987,
-    2936, 4857, 2555, -1172, -3470, -4711, -1754, -4057, -5633, -3364, -1949, -2482,
-    -2341, 312, 103, 1628, 1600, 2687, 2555, 3585, 4376, 5564, 3778, 6990,
-    6059, 7351, 7167, 4033, 6373, 3430, 3140, 3581, 5441, 1095, -301, 2691,
-    2768, 1303, 3912, 5694, 2007, -516, -451, 2796, 1918, 812, -542, -789,
-    46, 425, 1042, 2857, -2104, -3945, -3547, -3748, -3315, -3206, -2165, -3433,
-    -3823, -917, 324, -1294, 266, 2194, -147, 167, 2927, 122, -375, -315,
-    -3269, -3078, -518, 60, -2582, -759, 962, -386, -2028, -2713, -2241, -1325,
-    -2036, -2674, -1952, -1436, -2481, -351, -199, -1642, -2569, -5394, -4935, -2180,
-    -3427, -4284, -840, -1198, -3022, -2600, -2262, -1821, -896, -146, -215, 1409,
-    955, 488, 269, 635, -1769, -807, 1212, 2772, 3020, 2658, 1765, 3704,
-    2214, 649, -128, 3210, 2770, 3667, 4904, 4799, 4816, 3282, 2773, 3149,
-    2564, 1533, 73, 1038, 735, -21, -437, -1852, -2484, -1339, -1111, -1822,
-    -929, 1895, 1603, 1364, -1655, -3436, -4488, -2045, -917, -831, 2404, 6788,
-    5376, 2756, 2364, 1044, 1563, 1234, 379, 1424, -113, 829, 1824, 558,
-    -649, -190, 214, 96, 1983, 3497, 5516, 5359, 6014, 6158, 3983, 359,
-    -173, -238, 392, -1459, -3324, -2445, 1737, 4885, 3295, 2722, 3550, 5908,
-    5070, 4170, 6447, 5909, 4943, 3755, -1609, -909, -3226, -986, -1452, -2943,
-    -3961, -2184, -1741, -2192, -3494, -4845, -3849, -3983, -5797, -7294, -7887, -5233,
-    -7304, -5903, -6431, -7003, -6740, -2982, -399, 928, 972, 3297, 2860, 699,
-    -252, -950, 476, 2949, 3743, 772, 2188, 3407, 5790, 1902, -2583, -2616,
-    -1977, 1976, 226, 59, 1896, 517, 2524, -3782, -4484, -3671, -2675, -40,
-    -2244, -928, 165, 3829, 4583, 975, -1855, -2064, -1282, -824, 770, -67,
-    1388, 654, 920, 1670, -109, -513, 691, 1059, -1677, 1107, 3573, 4758,
-    1385, 5035, 4343, 902, 1240, 2367, 2893, 984, 1313, -145, -1952, -4328,
-    -999, 1198, -755, -1354, 824, -1622, 1100, 741, -2846, -4014, -1114, -769,
-    -3366, -1195, 2123, -1232, 434, 2279, -1024, -4288, -4801, -3096, -2183, 202,
-    -1503, 749, 5211, 1282, -3775, 550, -984, -155, -273, -442, 108, 4574,
-    1070, -2282, -3781, 174, 148, -2621, -5200, -2742, -795, 985, -2377, -1569,
-    -3663, -4781, -3160, -1376, -22, -2830, -1590, 1290, 2717, 2062, 1821, 1041,
-    2116, 1127, -152, 4084, 8996, 5551, 1727, 1663, 5552, 4685, 5624, 8178,
-    1036, 736, 5117, 7170, 3245, -1550, -5076, -3646, 3104, -768, -5474, -5298,
-    -7235, -8597, -9928, -10268, -8391, -7524, -6611, -4246, -3423, -3669, 1432, 2373,
-    -163, -1142, -1343, -59, 2340, 4631, 6076, 1473, -596, -1606, -830, 842,
-    1366, -3228, -3797, -2493, -3117, -924, -2080, -144, -1418, -4164, 405, 566,
-    3316, -709, -2520, 294, 475, 162, 824, -3751, -4086, -4889, -2739, -930,
-    -3304, -3931, -4738, -2575, -2016, -5529, -570, 522, 531, -691, -1787, -1412,
-    -830, 521, -753, -439, -124, 3512, 1307, 360, 2294, -2846, -2067, -82,
-    618, 763, -4175, 110, 5370, 2677, 3239, -351, -3451, -3219, 2451, 4030,
-    766, 467, -290, 1117, 2710, -176, 1541, 5216, 2831, 2957, 295, -2737,
-    -4176, -1123, -1546, -1085, -3385, -6826, -6948, -1452, -939, 954, -1509, -4619,
-    -1648, 2945, 2357, 446, 3079, 5101, 1575, 991, 29, -7, 4215, 2928,
-    -2212, -657, 73, -127, 4468, 232, -4616, -7417, -3348, 97, -179, -3304,
-    -2208, -2523, -886, 816, 1220, -457, -2638, -5979, -1013, 525, 6172, 3051,
-    -1031, -3354, -581, -1596, -262, -695, -1305, -6719, -2211, 3665, 1809, 2082,
-    -1968, -3372, -2405, 1598, 5210, 5214, 493, -589, 2233, 5736, 3832, 841,
-    3405, 6386, -148, -32, 4923, 6030, 1686, 1220, 686, -2104, 4503, 8028,
-    4089, 262, 1865, 7279, 5809, 4002, -1515, -2278, 370, 1193, 4452, 2753,
-    972, -1982, -930, 1917, -103, -3036, -2184, -953, 992, 120, 1168, 1357,
-    4993, 2502, 2559, 1646, 2192, 8939, 9714, 9936, 5621, 4848, 9004, 11616,
-    7887, 3790, 5586, 7213, 9042, 7909, 6169, 4395, 2164, 305, -1594, 1586,
-    2101, -1574, -1683, -724, -2406, -1640, -425, -3241, -3286, -3167, -5572, -411,
-    -842, -2799, -4392, -4952, -7946, -4891, -2890, -3564, -3248, -4534, -3280, -3814,
-    -6833, -3344, -2118, -1665, -3148, -5984, -2362, 1655, -57, -321, -2734, -663,
-    -1550, -3316, -3800, -1009, 1065, -338, 535, -221, -1998, 177, -168, -935,
-    -3336, -1828, 565, -1604, -7022, -1417, -5759, -4161, -6268, -5645, -4616, -7489,
-    -5466, 27, 1628, 53, -5348, -3702, 1699, 1827, 5769, 4098, 3029, 2357,
-    4262, 7212, 2747, 2257, -2966, -2448, 890, 5856, 2559, -2253, 2541, -842,
-    -2586, -1506, -1511, -2887, 2927, 2591, 1034, 3990, 1017, 1208, 341, -1169,
-    -3486, 7, 5297, 1218, 2725, 5623, 77, -1057, 764, 1586, 2347, 3717,
-    144, 1503, 2181, 3839, 3953, 1935, -1162, -2071, -2316, -2846, 2499, 1411,
-    4178, 1511, -2972, -1664, -358, -3173, 1571, 2390, -1372, -2474, 1146, 185,
-    -687, 1464, 1214, 1924, 548, -2175, 2237, 3240, 4207, 3509, 972, -2060,
-    1474, 5813, -1166, -6083, -2672, 3286, 7347, 2695, -2399, -1301, -2085, 1369,
-    3717, -1632, -2115, 317, 1075, -2090, -2428, -2451, -1617, -1575, -1295, -3598,
-    -2495, 64, -2991, -761, -4405, -6867, -4308, -3805, -7336, -6580, -3317, -2483,
-    -5554, -6344, -4126, -4987, -3287, -3969, -4144, -2686, 380, -267, -2411, 228,
-    748, -4353, -915, -1256, -866, 655, -1408, -355, -2010, -3955, 1719, -213,
-    -2098, -718, -2606, -5353, -1458, 2993, -53, -5383, -3680, 274, -39, -2672,
-    -129, 1724, 4097, 5870, 1768, 1609, 4445, 697, 3904, 3643, 1830, 2156,
-    7780, 6766, 3037, 1756, 89, 1476, 1306, -334, 1384, 584, -2867, -3600,
-    -643, -89, -2810, -4347, -448, -2495, -3917, -3615, -413, 1166, -1611, 447,
-    -3687, -4930, 2924, 4064, 727, 657, 168, 2925, 4910, 1680, -119, 1896,
-    4819, 3613, 874, 3484, 5315, 3908, 672, -230, 1031, 4984, 2385, -1520,
-    -400, 3044, 668, 1069, 2236, 2076, 6736, 3797, -1099, -457, 895, 820,
-    4826, -461, -1092, 1169, 168, 3318, 2283, 1877, 1969, 3246, 495, -599,
-    2052, 1342, 929, 4384, 1342, 225, 2317, 4463, 5876, 499, 3094, 4323,
-    1326, 2486, 1423, 499, 1259, 101, 2372, 4402, 2229, -44, 1523, 2055,
-    670, 47, 1351, 2118, 2230, 697, -17, -3647, -2249, 815, -2393, -1099,
-    -4160, -4316, -3334, -1401, -2696, -702, -294, -1065, 129, -694, 2909, 3390,
-    -1504, -926, 2473, 1835, 1355, 685, 665, 1185, -2341, -375, -1037, -1411,
-    -1713, -2425, -1695, -1752, -3558, -4681, -3227, -2252, -2947, -5819, -3746, -4571,
-    -3492, 1184, -1990, -6329, -4812, -1295, -4500, -2495, -2686, -3049, -1426, -1934,
-    -2601, -3671, -2957, 920, -1938, -4845, -2843, -3048, -770, -2847, -2700, -3649,
-    -3163, -3242, -4609, -3041, -2068, -2638, -3421, -4373, -3003, 612, 1018, 253,
-    -994, -1371, -1585, 17, 2028, -25, -992, -433, 566, 575, 962, 1030,
-    120, -2607, -2532, -213, -1762, -3558, -5918, -5905, -7113, -7348, -8477, -6464,
-    -5726, -7750, -9897, -9134, -6581, -5919, -5659, -5439, -4379, -5324, -4804, -1432,
-    -662, -217, -624, -690, -2070, -1288, 894, 2416, 3008, 725, 2012, 4195,
-    2327, 3573, 1012, 1439, 1566, 305, -40, 1304, -419, -1504, -655, -1442,
-    -2077, -3243, -2121, -1919, -2764, -2780, -1409, -1593, -2548, -1883, -2464, -2304,
-    -4134, -3592, -2219, -1243, -1061, 825, 528, -2521, -2914, -2276, -945, -79,
-    -1114, -1156, 530, 319, 1347, 4674, 4896, 3050, 2372, 4604, 4390, 5751,
-    5566, 5249, 4417, 2758, 2498, 5748, 6406, 4110, 4928, 6790, 5236, 3806,
-    4958, 4606, 3255, 3946, 1769, 1149, 3353, 3151, 1753, 1985, 7, -2115,
-    -2658, 531, 2119, 896, 2203, 3638, 4027, 4096, 3606, 5795, 3515, 2245,
-    4570, 6471, 7422, 6679, 6263, 6687, 5489, 3974, 4038, 5715, 4153, 4358,
-    4123, 3580, 3344, 2714, 3849, 1175, -36, -502, 130, 1437, 510, 1880,
-    2601, 2879, 1782, 447, 1543, 1914, 2160, 2972, 2433, 701, 996, 2810,
-    2113, 1735, 1978, -793, -945, 888, 794, 2435, -1812, -3703, -2906, -3195,
-    -3138, -3569, -2509, -1852, -1704, -1141, -3106, -593, -140, -1228, -677, -1159,
-    -303, 103, 973, 1679, -261, -1262, -1042, 502, 245, -329, 1722, 2446,
-    1250, 340, -104, -1245, -2058, -3303, -2113, -916, -2094, -1427, 1269, -175,
-    -2433, -2037, 591, 1677, 1292, 2927, 4429, 4858, 4989, 5623, 5520, 5232,
-    4515, 5633, 6223, 4354, 3185, 4329, 5174, 3922, 2439, 2586, 4081, 3308,
-    1811, 1537, 1448, 2226, -198, -1636, -560, -181, -17, 1155, -528, 180,
-    500, 724, 190, -2181, -2705, -1786, -557, -2660, -2655, -1096, -1597, -79,
-    -1276, -957, 55, -757, -698, -470, -2019, -1716, -971, -1010, -2014, -1032,
-    681, 439, 745, 829, 1712, 2897, 4488, 4196, 4361, 3932, 3410, 4282,
-    5322, 4049, 3553, 4742, 3001, 2128, 2664, 2878, 1321, 969, -313, -321,
-    -1146, -466, -313, -2318, -3076, -3701, -4375, -4731, -3844, -4298, -4709, -3959,
-    -4840, -4559, -2966, -1557, -1958, -2148, -2453, -1558, -1933, -1644, -2564, -2514,
-    -4364, -5234, -3706, -2610, -3400, -5004, -3698, -2757, -6099, -5678, -6148, -6070,
-    -8270, -7663, -6065, -5942, -5268, -3435, -3346, -2819, -3912, -3338, -1532, -389,
-    -1667, -2214, -584, -1847, -2362, -1340, -966, -2313, -4609, -2953, -2216, -4555,
-    -2503, -2098, -2540, -4058, -4579, -2944, -1658, -1809, -2816, -1661, -1813, -4747,
-    -3640, -864, -423, -1778, -2537, -201, -246, -487, 1145, 1233, 2554, 713,
-    -1621, 294, -68, -1284, -273, 580, -1455, -2898, -1801, 167, -627, -1898,
-    -18, -408, -2083, -1208, -908, -526, 333, -1517, -1279, 302, 1207, 2010,
-    3571, 3199, 2582, 3115, 3921, 5087, 3944, 964, 2027, 2670, 608, -12,
-    1459, 2153, 1819, -515, 113, -229, -352, -548, 644, -1501, -3217, -3614,
-    -1593, -550, -2736, -1080, -437, -1974, -1106, 467, 1355, 2629, 2744, 1907,
-    1508, 2511, 3043, 3633, 3225, 1684, -71, 210, 3055, 3155, 2284, 3018,
-    1972, 189, 1346, 2805, 3165, 5004, 5958, 3793, 4085, 5348, 5722, 5889,
-    4483, 5216, 5156, 5960, 6435, 4992, 6930, 7794, 5809, 4750, 4510, 3799,
-    2831, 3667, 3000, 976, 210, -342, -32, 22, -2153, -2994, -2437, -2717,
-    -3192, -3038, -2784, -3924, -6002, -6758, -6437, -4598, -4447, -1564, -374, -292,
-    1392, 2573, 2828, 3191, 2754, 1309, -88, 1150, 2632, 2554, 4542, 3488,
-    1591, 799, 1994, 1772, 1914, 2380, 1773, 715, 80, 695, 1751, 1580,
-    -942, -2757, -3233, -1283, 102, 990, 886, -707, -2817, -2331, -225, -1011,
-    -454, 36, 64, -1171, -1524, -1313, -1356, -2546, -3753, -4165, -4133, -3131,
-    -1847, -354, 72, 236, 655, 542, -265, 929, 2406, 2117, 1630, 2033,
-    2837, 2109, 4175, 4271, 2712, 1758, 505, 2308, 2906, 2357, 2426, 820,
-    -2171, -2706, -2649, -2660, -2052, -1672, -2257, -1933, -3023, -1941, -1519, -2646,
-    -4652, -7002, -6749, -4427, -3004, -3200, -2632, -2837, -2541, -2515, -1088, 78,
-    725, 562, 962, 1669, 1508, 2806, 1845, 1327, -1354, -3665, -3629, -616,
-    -199, -2436, -4181, -2867, -2271, -2788, -1198, -810, -1696, -2525, -2181, -2301,
-    -3210, -2125, -1426, -1653, -2917, -1927, -148, 805, 464, 983, 901, 1421,
-    218, 333, 1227, -405, 628, 1225, 668, -247, 669, 1707, 2081, 1318,
-    765, 1532, 2530, 2121, 2596, 2557, 2367, 1408, 1464, 1875, 1030, 29,
-    2648, 3026, 1078, 1730, 2530, 2845, 1646, -679, -1120, -700, 128, 244,
-    547, 907, 329, -316, -385, -305, -1465, -806, 272, 1020, 708, 193,
-    1591, 2698, -166, -1967, 272, 1741, 1367, 2865, 4416, 3905, 3323, 6163,
-    7295, 6064, 6131, 7440, 8009, 6120, 5757, 5650, 6080, 4503, 2256, 2536,
-    3333, 3386, 2173, 3315, 3660, 1987, 2257, 2143, -378, -1504, -1571, -730,
-    -1301, -2287, -2215, -1525, -1964, -3368, -3793, -2709, -4091, -5401, -4520, -5050,
-    -6096, -6579, -5328, -7457, -9418, -8688, -7671, -6725, -6055, -5204, -3875, -3022,
-    -4369, -4503, -3457, -2564, -3463, -2553, 502, 1671, 871, 3331, 4268, 762,
-    -776, -283, 2161, 1492, 430, 1847, 2071, 1219, -328, -979, -92, -2598,
-    -3805, -1740, -1180, -2471, -2822, -1978, -879, -2609, -3238, -1943, 1, -2150,
-    -2585, -159, 1190, -841, -1263, 1016, 1565, 32, 713, 4210, 4941, 4123,
-    5620, 6418, 5517, 3013, 1968, 4147, 3763, 1387, 2438, 4082, 3110, 1600,
-    115, 1563, 263, -741, 104, 1271, 938, -246, -493, -189, -1304, -2256,
-    -2426, -546, -696, -211, 2170, 2795, 1126, -338, 241, -1697, -1756, -1931,
-    -1618, 95, 1303, 1463, 1238, 1047, -1504, -3637, -3849, -2057, -954, -634,
-    1287, 1537, 732, -337, 735, -132, -1108, -1532, -152, -25, 513, 586,
-    1246, 1041, -490, -181, 148, -59, 257, 1350, 424, 123, -788, -887,
-    -1025, -1716, -1977, -1819, 238, 1253, 1806, 2514, 2765, 1458, -102, 204,
-    465, 595, 596, 2333, 1303, 1024, 2204, 1737, -85, 279, -1543, -933,
-    -1891, -2108, -1530, -1901, -3751, -5211, -6196, -7082, -7381, -7791, -6164, -5327,
-    -7112, -7367, -7081, -7602, -8156, -8799, -8425, -5512, -5787, -4031, -1798, -344,
-    -581, -2926, -4672, -2871, -2385, -2706, -831, -344, -1098, -412, 191, -801,
-    -298, -1487, -1155, -1319, -1514, -738, 384, 2173, 3133, 2595, 2686, 4110,
-    4391, 4741, 5855, 5483, 4646, 7078, 7016, 5004, 4322, 3596, 4078, 2679,
-    2314, 3319, 3673, 2629, 1612, 373, -438, 277, -440, -1503, -1637, -2337,
-    -1413, -172, -1130, -2440, -2381, -1632, -2297, -3797, -3647, -3083, -1328, -931,
-    -1654, -1646, -1755, -879, -778, -5, 819, 926, 2064, 2473, 1366, 1111,
-    1373, 1933, 2176, 1595, 2508, 3656, 4604, 3699, 2713, 2372, 2292, 2332,
-    1239, 2585, 2242, 2973, 4803, 5295, 4143, 4044, 4702, 4178, 1994, -9,
-    -369, 341, 1731, 2424, 3524, 3592, 1781, 1202, 1717, 1753, 805, 622,
-    1746, 1307, 1974, 1693, 2466, 2989, 1939, 1468, 2304, 3575, 5226, 5147,
-    6556, 6901, 6095, 7512, 7752, 6563, 6052, 6906, 5170, 5755, 5050, 4569,
-    4628, 2607, 795, -891, -143, 616, -199, -2387, -640, -2004, -2913, -2052,
-    -1955, -683, -896, -157, 290, 528, -528, 151, 1644, -570, -184, 473,
-    2341, 3524, 1996, 1187, 2092, 1557, -634, -619, -1050, -72, -49, -1147,
-    -793, -2262, -2401, -1316, -3708, -5387, -6697, -7353, -5575, -4786, -5552, -4644,
-    -3615, -5250, -5786, -4933, -3993, -2864, -1719, -1352, -2071, -1547, 525, 576,
-    -309, -1536, -835, 655, 1334, 1731, 2334, 2065, 3275, 1787, 1754, 2854,
-    1818, 3131, 2941, 2570, 1787, 1321, 2683, 1857, 363, 251, 2053, 2820,
-    2612, 1382, -161, 32, -1340, -2379, -3345, -4087, -4301, -2584, -3315, -5727,
-    -7931, -7916, -7285, -8869, -9640, -7386, -6764, -6017, -5311, -7214, -6027, -4766,
-    -5368, -3719, -4052, -4479, -1810, 915, -38, -194, 427, 1556, 1743, 39,
-    1841, 2310, 1758, 2030, 1730, 1221, 2303, 2350, 2498, 2711, 310, 1911,
-    4423, 5036, 2278, 844, 575, 782, 1038, -80, 838, 673, -349, -610,
-    -842, -225, 278, -20, 1091, 377, -1161, -1081, 514, 304, -1135, -3751,
-    -4501, -4627, -5480, -5641, -4342, -3655, -4817, -5463, -4026, -4656, -5426, -6023,
-    -5077, -5113, -6299, -3026, 1202, 912, -1255, -932, -1289, -238, 805, 1646,
-    4133, 4457, 5138, 5134, 4107, 4438, 4161, 3719, 4257, 3374, 1285, 3352,
-    4796, 3886, 1561, 582, 166, 117, 877, 539, 1505, 1311, 82, -659,
-    21, 1636, 1087, 737, 3223, 3436, 2685, 5422, 6262, 4747, 2887, 702,
-    1399, 2798, 2651, 3891, 3760, 2319, 1276, 1057, 2331, 3133, 2235, 2882,
-    4347, 2768, 2878, 4691, 4289, 4788, 1490, -501, -750, -303, -202, 1036,
-    1807, 302, -708, -377, 129, -179, -3129, -3223, -1344, -2464, -1817, -772,
-    -516, -1946, -5047, -4948, -3411, -3541, -3206, -1896, -1836, -2106, -2785, -1676,
-    -1408, -891, -2869, -2868, -2848, -2457, -1014, -98, 851, -650, -1646, -525,
-    -1027, -1015, -1873, -1292, -3042, -4041, -3681, -3978, -5041, -4281, -5748, -5010,
-    -3765, -2538, -1355, -946, -1855, -1570, -1128, -315, -143, 1790, 4679, 5163,
-    4046, 5096, 5495, 5324, 7840, 8073, 7100, 9089, 8287, 8659, 8444, 7615,
-    7387, 6830, 4947, 3660, 2130, 766, 1884, 2080, 1501, 1758, 668, 501,
-    299, -1525, -1856, -3010, -3602, -2032, -3091, -4172, -4195, -4819, -5091, -4523,
-    -4737, -4353, -3755, -3923, -3903, -3654, -4179, -4432, -2975, -2764, -3497, -3933,
-    -2565, -1091, -813, -217, 427, 1338, 1375, 1581, 1047, 512, 1811, 2813,
-    4023, 3616, 3333, 3552, 3259, 3034, 3355, 4601, 5771, 6026, 5507, 5501,
-    5853, 5676, 5199, 2824, 2689, 3847, 3687, 3391, 4153, 1610, -405, -1,
-    -311, 0, 14, -31, 831, 1054, 1428, -411, 364, -324, -2417, -4836,
-    -4418, -2842, -3225, -1400, 453, -684, -2545, -4241, -4175, -3735, -5007, -6555,
-    -5845, -5256, -5837, -6562, -4503, -3448, -6080, -7527, -4704, -3060, -3697, -1721,
-    689, -1253, -2276, -2539, -1365, -282, -2980, -2491, -1606, 537, 735, 762,
-    1599, 719, -3127, -3581, -1014, -2082, -1721, 58, -830, -1797, -2790, -3090,
-    -2095, -1979, -3231, -2300, 67, 1612, 328, 1209, 2369, 723, -1306, -268,
-    2024, 2782, 2638, 4523, 5355, 4489, 3347, 1763, 4230, 4778, 5004, 5418,
-    6712, 6854, 5025, 5617, 5334, 1201, -932, -185, 427, 817, 2105, 2428,
-    2268, 696, -1623, -2001, -748, -404, -271, -1195, 217, 1179, -111, 122,
-    1632, 792, 840, 78, 2073, 2405, 3763, 4486, 2874, 491, -442, -2075,
-    -1288, -569, -1375, -1873, -283, -799, -1023, -615, -1181, -1991, -2946, -3918,
-    -2110, -978, -1372, -1180, -1615, -2732, -2586, -3214, -830, 177, -917, -1828,
-    1446, 2307, 1047, 1242, 1520, 2020, 1311, 2321, 3330, 5413, 7538, 6986,
-    6323, 5968, 4621, 4674, 7040, 8224, 8557, 8546, 9500, 8300, 6108, 6336,
-    5249, 5168, 3881, 3411, 3785, 5246, 5375, 4849, 2629, 1768, -390, -323,
-    -1268, -2034, -2302, -2696, -2598, -3483, -5868, -7122, -6938, -5698, -6982, -7028,
-    -6764, -3569, -2994, -3554, -2740, -2777, -3816, -3028, -2188, -2091, -1649, 189,
-    1961, 2483, 2912, 3725, 4148, 3772, 2009, 1050, 442, 1888, 2008, 1506,
-    158, 451, 288, 768, 298, -618, -85, -467, 313, 27, -431, -192,
-    207, 195, 150, -458, -213, 1886, 1774, 1895, 1387, 578, -26, 918,
-    468, 444, -271, -1108, 202, -1158, -3245, -2698, -3663, -5014, -4783, -4245,
-    -2903, -3868, -3458, -2910, -2999, -3806, -3062, -2261, -3420, -4862, -4625, -3432,
-    -2103, -2184, -1540, 195, -931, -1645, -396, 687, 1235, 319, 1450, 452,
-    -415, -1519, -2498, -4398, -4451, -4900, -4697, -4229, -2704, -3990, -1623, -896,
-    -3878, -3457, -1571, -1830, -2856, -1729, 934, 1570, 4918, 7611, 1270, -8063,
-    -6817, -1760, -561, -3994, 1106, 764, -8283, -4834, 5588, 5452, -4868, -4885,
-    2763, 9234, 6292, 1552, 4190, 7638, 4743, -1379, -799, 8096, 13966, 9427,
-    -1808, -9117, 1423, 10296, 6732, 424, -7510, -74, -8293, -6258, 7369, 140,
-    -8897, -7909, 200, -5403, -8191, -11245, -8763, -2397, -11514, -16808, -9673, 1722,
-    -133, -1090, -4317, -10421, -10034, -4471, -455, 2977, 1229, -2306, -4778, -2597,
-    2376, -48, 578, 1094, 4750, 5437, 5604, 5047, 5944, 5683, 4886, 4692,
-    3467, 4259, 5724, 4677, 3744, 8448, 12839, 3315, 415, 5037, 3799, 3666,
-    3649, 9044, 13731, 16400, 9605, -1258, -8, 4106, 5257, 2655, 4310, 9714,
-    8064, 2250, -5956, -7156, 1327, 3212, -2228, -7075, -7170, -4001, -5297, -11330,
-    -11759, -5452, -7455, -8611, -7255, -8286, -11162, -14443, -11212, -2156, -4942, -12931,
-    -11703, -10700, -8067, -3085, -1241, -5394, -7321, -6958, -4720, 2265, 3254, -2005,
-    -4683, -3858, 231, 2712, 2432, 1790, 3442, 4503, 5873, 6581, 5429, 6697,
-    7589, 9739, 11949, 11930, 11305, 9302, 4974, 5524, 8199, 10882, 8903, 3367,
-    7732, 12241, 13306, 6079, 555, 8598, 13341, 7464, 1950, 3374, 6852, 815,
-    -7943, -5192, 1930, 4331, 4223, 4387, 646, -3748, -4698, -3319, -3276, -3169,
-    -2370, -3729, -2217, -274, -219, -1290, -1589, -760, -5134, -14052, -15700, -11270,
-    -7295, -3557, -2693, -4459, -7509, -14062, -12488, -3626, -3343, -9217, -11699, -9815,
-    -12028, -6271, -5001, -7103, -9191, -6175, -7622, -10382, -5241, 3496, 3346, -1271,
-    -4367, -5946, -791, 921, 3358, 1503, 736, 2150, 482, 387, 924, -710,
-    -4491, -777, 5964, 2813, 2124, -2032, 1642, 8593, 11578, 9596, 5746, 4638,
-    6686, 7780, 6001, 7518, 9642, 12241, 8248, 4829, 3264, 3984, 7000, 11384,
-    13486, 16616, 18838, 13296, 5623, 5926, 5591, 6363, 8528, 3161, 5603, 8757,
-    2835, 2951, 8275, 10972, 7956, 1967, 3992, 3005, 6649, 7552, 4163, 2808,
-    1698, -2894, -1237, 1841, 2870, 4048, 6884, 8773, 1877, -4501, -1064, -973,
-    -8606, -6314, -2210, -4376, -8255, -5955, -5888, -8682, -8051, -9612, -12541, -8079,
-    -4814, -4581, -8206, -8064, -7029, -8699, -11356, -8154, -10254, -7047, -10317, -16221,
-    -11014, -6857, -4096, -1484, -4494, -4072, -11836, -10320, -6374, -5936, -4342, -3386,
-    -5692, -9189, -7321, -9126, -10437, -6926, 2960, 5531, 932, 847, -682, -1780,
-    3134, 3884, 449, -672, -3865, -1437, 4264, 2333, -2170, -1470, 1288, -874,
-    1562, 2774, -3268, -3743, 884, -120, 2401, 6224, 3566, 1122, -6132, -3218,
-    3700, 7420, 3324, 1890, 3348, -667, 6557, 4575, -291, 5692, 8124, 9798,
-    8182, 8566, 12589, 6493, 851, 1092, 7346, 12528, 7882, 3929, 9106, 11289,
-    11599, 15362, 12455, 13063, 3961, 82, 3392, 7122, -912, -2021, 2114, 7525,
-    9299, 9199, 7427, 11686, 15295, 17592, 11550, 7453, 7832, 3782, -5168, -3462,
-    -595, -9214, -2328, 412, -2794, 4421, 9024, 7206, 5660, 3122, 2217, 3644,
-    2171, -1580, 3471, 468, -9680, -11339, -3081, -3964, -5752, -6454, -6014, 4710,
-    6516, -646, -5026, -5986, -11560, -15826, -18661, -11095, -7508, -8398, -8087, -3282,
-    -568, -2970, -144, 1261, -5667, -8511, -5664, -4970, -4842, -4908, -6823, -3384,
-    -8584, -6529, 697, -1591, -3999, -3067, -5709, -4588, -1606, -6636, -3787, -720,
-    -1973, 611, 4464, 5545, 3211, 3115, -2996, -280, 3032, 347, 2768, 3511,
-    805, -1487, -28, 488, 5459, 4835, 885, 78, 6450, 3760, 4020, 7380,
-    5566, 3275, 835, 1131, 1347, 4438, 6106, 1822, 2223, 7251, 7545, 3635,
-    8444, 12099, 10467, 5489, 8352, 7778, -2259, -159, -134, -4420, -3111, -869,
-    1463, 3747, 5990, 4, -3959, 516, -2693, -381, 1279, 153, -2387, -3434,
-    4801, 6395, 346, -3185, -2381, -1276, -5598, -4120, -6880, -8025, -7152, -2626,
-    81, -6295, -8664, -9456, -8724, -8938, -10068, -9637, -7313, -9331, -8255, -4777,
-    -6564, -10182, -7121, -6716, -7338, -2785, -3189, -7663, -7473, -2307, -3112, -6511,
-    -5966, 312, 913, -99, 348, -4492, -1566, -749, 1993, -2577, -1872, -1242,
-    -2043, -2443, -2592, -3678, -1619, -3407, -1622, -1767, -1165, -2094, -2845, -2122,
-    323, 1558, -660, -2947, -3746, -5267, -987, 2740, 1460, 3848, 1995, -1902,
-    1441, 2573, 1466, 681, -2688, 519, 3592, 2062, 4173, 6132, 1467, -2184,
-    1356, 4041, 3711, 3843, 5181, 4672, 3263, 3286, 4975, 5622, 5787, 4451,
-    5045, 7204, 5409, 5480, 4328, 8170, 5650, 2003, 4138, -58, 4404, 11532,
-    11225, 5420, 2351, 5479, 9108, 7442, 2621, 2017, 4180, 5653, 9985, 8060,
-    6671, 7984, 7795, 6910, 3956, 3753, 3809, 9479, 14777, 9919, 7339, 2001,
-    1584, 653, 2412, 5655, 9182, 6449, 787, -800, 4917, 7208, 4492, -523,
-    -998, -974, 2707, -1708, -4461, -871, -2788, -5723, -4539, -3394, -1758, -3419,
-    -3012, 1668, 5205, -489, -864, -941, -5369, -6799, -6945, -7612, -4545, -2735,
-    -4210, -7085, -10848, -11851, -7245, -9431, -10311, -3977, -2044, -7833, -9510, -7636,
-    -9000, -9062, -8351, -8599, -12674, -10354, -9575, -8607, -11519, -9601, -6552, -8584,
-    -11259, -11745, -11188, -10902, -10411, -7841, -2662, -2849, -7810, -11981, -8749, -6279,
-    -6837, -11282, -8797, -5920, -6116, -7344, -7814, -7458, -7922, -8205, -5080, -4205,
-    -4974, -5825, -4353, -4420, -4161, -821, -399, -2726, -3863, -827, 1477, -1079,
-    -1231, -1105, -1823, -614, -936, -4807, -4971, -356, -588, -1030, -671, -249,
-    -969, 2678, 1243, -3844, -1928, 3432, 962, -1163, 374, 3578, 5811, 2932,
-    3242, 2903, 2444, 2111, 2535, 4471, 5439, 4824, 6680, 5315, 5181, 5682,
-    7506, 4434, 3449, 7533, 10034, 10498, 8078, 8811, 8593, 12671, 15382, 13656,
-    11206, 13611, 13635, 12945, 15011, 18703, 17049, 14345, 15055, 16044, 15562, 14029,
-    14818, 15999, 13391, 11604, 10396, 10864, 12033, 11902, 11583, 12987, 7463, 6906,
-    8180, 8652, 9134, 6489, 5821, 10567, 12037, 9541, 6781, 5267, 6178, 5986,
-    5177, 8084, 6012, 6819, 7644, 4458, 4810, 3337, 6270, 7513, 1898, -2041,
-    913, 4472, 4084, 1636, 2270, 1960, -1048, -2505, -1905, -1310, -36, 2671,
-    1606, -847, -5075, -6250, -2558, -2478, -2392, -3741, 1829, -1820, -3713, -1407,
-    -4313, -391, -926, -4739, -2, 1972, -2136, -8516, -10794, -5338, -4390, -4229,
-    -2398, -5984, -6127, -3017, -1831, -2730, -9207, -6740, -7742, -12086, -12156, -9696,
-    -7851, -5410, -5064, -5036, -6964, -11678, -10875, -7790, -4226, -7016, -9145, -9643,
-    -12546, -9380, -7038, -11425, -15208, -15341, -12427, -10041, -8716, -6415, -1461, -6066,
-    -7255, -9392, -8116, -8274, -11536, -10186, -9190, -6223, -5401, -5678, -4683, -4823,
-    -4889, -7825, -7836, -3167, -2044, -8961, -8582, -4640, -6608, -7260, -6135, -1478,
-    -3663, -7872, -3915, -5308, -4700, -5652, -3445, -59, -1790, -4818, -5003, -6446,
-    -2662, -811, -4654, -3679, -2596, -3875, -3638, 1335, 1532, -1609, -436, 2051,
-    1314, -2493, -1493, 505, 1478, -2455, -1064, 128, 105, -139, 48, 1605,
-    -1092, -1670, -578, 1920, 5202, 5347, 3050, 179, -583, 1144, 4302, 7792,
-    1292, -37, 2449, 4555, 6631, 5480, 4585, 2577, 5184, 2762, 3159, 2421,
-    3588, 4222, 6029, 6845, 5877, 2851, 1641, 1927, -390, -1051, 1377, 4190,
-    5788, 4909, 3055, 5082, 1504, 3239, 5816, 6829, 6661, 7606, 9903, 7427,
-    5867, 4417, 6262, 9730, 7858, 3927, 6433, 12501, 13114, 9152, 9477, 12621,
-    12001, 5795, 5546, 7884, 10108, 9355, 7059, 12994, 12459, 11284, 12007, 8074,
-    7944, 7303, 5239, 3140, 5431, 5644, 1541, 2312, 3322, 1178, 4374, 5987,
-    4994, 4252, 3701, 2544, 2744, 2354, 2304, 3310, 2167, -9, -429, 2351,
-    875, 1289, 4733, -315, -2452, -3892, -5332, -5476, -5974, -2364, 375, -2403,
-    -8073, -9321, -6321, -3315, 95, -1385, -4604, -6479, -2288, 842, -4228, -8593,
-    -5761, -6374, -8648, -10049, -9621, -8972, -7471, -4965, -4760, -8870, -11887, -8521,
-    -8770, -7348, -9257, -10100, -8323, -5171, -5475, -5876, -4253, -5767, -7752, -6451,
-    -3864, -3773, -7262, -8728, -10741, -12271, -13793, -11861, -13274, -12686, -9810, -11999,
-    -10807, -14568, -18350, -12709, -7314, -7118, -10734, -8443, -9509, -13231, -10339, -7345,
-    -8561, -12972, -15412, -11645, -8890, -11755, -11797, -8446, -7996, -9949, -6638, -4599,
-    -6073, -10801, -11572, -6028, -4974, -6389, -7772, -4487, 26, -659, -2206, -5138,
-    -7086, -6621, -7073, -5164, -6031, -6751, -6172, -3054, -3075, -2913, -2929, -3245,
-    -3460, -4345, -2358, 1278, 1523, -33, 2559, 2247, 1872, 395, 1988, 4857,
-    1063, -3541, -4080, -1837, -945, 572, 6470, 7024, 3925, 4149, 8163, 10192,
-    6729, 4682, 4413, 5254, 6808, 7928, 8475, 9434, 11437, 7440, 6354, 9307,
-    9258, 11273, 9903, 8391, 4960, 6055, 10818, 11801, 9788, 7874, 7509, 9171,
-    9182, 7909, 7299, 4039, 1036, 3423, 6310, 8815, 7015, 6678, 6972, 7562,
-    6419, 6948, 10403, 9042, 4551, 5262, 7805, 3604, 452, 2667, 4927, 5332,
-    1324, 1059, 3535, 5918, 6298, 5300, 4684, 4599, 5645, 4933, 3477, 3926,
-    4594, 7526, 5598, 7560, 8572, 9135, 7479, 8607, 9738, 11586, 9352, 8058,
-    7962, 9162, 10750, 8611, 6062, 5851, 5119, 4196, 4820, 5117, 5219, 1922,
-    1877, 4948, 2640, -774, -1461, -1327, 568, -374, 591, 1522, 1127, -1439,
-    -1713, -801, 1575, 1578, 94, -502, 130, 276, -2375, -861, -665, -103,
-    -50, -2508, -2218, -1019, 1145, 552, -1592, -3564, -4695, -5398, -5748, -2223,
-    -2814, -3987, -4455, -3781, -3339, -3992, -1477, -1474, -2823, -2314, -1683, -3655,
-    -5049, -4275, -4861, -4104, -2277, -1591, -3949, -6828, -4196, -4996, -5244, -3102,
-    -2169, -6416, -7951, -5127, -4738, -6776, -7614, -6276, -4430, -4477, -2781, -1725,
-    -3487, -3992, -5722, -6659, -5510, -5482, -7349, -8676, -8089, -12168, -10919, -9718,
-    -10157, -10787, -7375, -7098, -6908, -6940, -7708, -8774, -11112, -8813, -3670, -4435,
-    -6661, -6717, -5405, -5553, -5798, -5248, -3759, -5344, -4548, -4668, -3141, -1566,
-    -3831, -1109, -4069, -7297, -5149, -958, -1739, -3139, -5654, -5732, -4742, -4167,
-    -2528, -2294, -4657, -4485, -6247, -6995, -5394, -5179, -7563, -7135, -5488, -7853,
-    -4558, -195, 432, -1201, -162, 585, 1517, 2995, 30, -1211, 31, 692,
-    -1286, -375, 830, -432, -823, 1498, 4162, 5758, 4580, 1605, 527, 3081,
-    5816, 7188, 7333, 5061, 4365, 7398, 8508, 4679, 6292, 6986, 9101, 14661,
-    11941, 8199, 10891, 12427, 11341, 10047, 9333, 8201, 7009, 5216, 7501, 7503,
-    6094, 6094, 7610, 9120, 8712, 8666, 8503, 6340, 5409, 6903, 6913, 5276,
-    6984, 6846, 2591, 1925, 3891, 6067, 8132, 6272, 3512, 6245, 6330, 7546,
-    6990, 7606, 9545, 6309, 5162, 4370, 6017, 9036, 7995, 6120, 6317, 7665,
-    8658, 9748, 9561, 8216, 8259, 7638, 9548, 10188, 6504, 8773, 9769, 8363,
-    8959, 10119, 8934, 6022, 4497, 6219, 6143, 6040, 7688, 6669, 2579, 4279,
-    4016, 1438, 804, 192, -2256, -2904, -988, -3737, -2338, 220, -1867, -1685,
-    1159, -845, -5765, -4276, -1767, -966, -1560, -2829, -2294, 907, -219, -2550,
-    -3326, -3312, -5352, -6167, -5452, -3082, -3959, -6812, -5804, -1536, -651, -4311,
-    -6946, -5539, -3415, -654, -312, -3926, -7522, -8360, -8119, -7524, -7709, -7530,
-    -4816, -2231, -5810, -6457, -5512, -6269, -5156, -4577, -3624, -3026, -2809, -1843,
-    -1628, -1265, -2714, -4056, -3535, -2357, -3890, -6484, -2487, -1662, -5910, -5028,
-    -2732, -5554, -9386, -10303, -11639, -9903, -8407, -10176, -11268, -7426, -7913, -9234,
-    -7354, -4552, -5312, -5399, -5051, -7766, -8611, -6772, -4302, -3093, -3234, -4521,
-    -5244, -6042, -5097, -3758, -3404, -2829, -2154, -1747, -2399, -1384, 453, 238,
-    -1069, -131, -113, -2194, -3005, -2530, -2577, -3835, -3206, -2956, -1075, -1818,
-    -4820, -7794, -4367, -2360, -3005, -4977, -3435, -2039, -2951, -5843, -4642, -557,
-    95, -3881, -4783, -3691, -1211, 1420, 1541, 1173, -1467, -2745, 275, 2959,
-    1930, -3133, -2790, 385, 321, -251, 4061, 5114, 580, -2330, -203, 737,
-    1610, 1973, 2275, 3779, 1172, 410, 2884, 4519, 3787, 4499, 5658, 2946,
-    -9, 1485, 2054, 1498, 340, 799, -251, -1587, -2434, 689, 4612, 3443,
-    1942, 1393, 3865, 4847, 3306, 3184, 2011, 958, 1093, 270, 228, 818,
-    -1934, -2464, 833, 2293, 20, 433, 3453, 3565, 536, 871, 3338, 3885,
-    1129, 1734, 4859, 3511, 1526, 3801, 6650, 6714, 5915, 6172, 7838, 8876,
-    10836, 12906, 12670, 9100, 7153, 9420, 8487, 6266, 6518, 9139, 10507, 9038,
-    8023, 6773, 4157, 2343, 3156, 4250, 3193, 2135, 5395, 4480, 3718, 3550,
-    5156, 5729, 4404, 3333, 3820, 4083, 4170, 2094, 3303, 4978, 4375, 2549,
-    1020, 2133, 1600, 262, 2122, 2280, 1142, 3737, 2599, -500, -3115, -3210,
-    -2591, -2542, -2039, -742, 484, 285, -586, -2728, -3943, -744, 2202, 2121,
-    -952, -954, -2007, -1063, -251, -725, -5185, -7359, -4295, -3595, -1554, -1653,
-    -2131, -1551, -4171, -5155, -5476, -2813, -3059, -2674, -185, 367, -2079, -2726,
-    -1151, -1478, -3208, -2759, -2453, -1117, -1011, -755, -1438, -3278, -6660, -7546,
-    -6361, -6445, -6855, -5237, -3341, -4364, -7947, -9235, -7874, -8658, -8436, -5777,
-    -4715, -4131, -5088, -6248, -4668, -4341, -4917, -7185, -5338, -3699, -1994, -658,
-    -55, -672, -50, 2182, 3246, 1045, 369, 2361, 3304, 2262, 712, 795,
-    -1167, -4597, -4252, -2671, -1530, -3144, -3742, -2979, -3751, -3880, -3684, -5061,
-    -5779, -6966, -7124, -4668, -284, -70, -797, -1194, -2114, -2924, -4620, -3969,
-    -3795, -4440, -605, 1884, 2517, 66, 175, 2408, 1545, -1874, -1465, 636,
-    4242, 5274, 4253, 3016, 1423, 578, 2072, 2220, -3, -836, 753, 1409,
-    2539, 6057, 4083, 1285, -646, -2348, 1504, 2603, 2459, 1934, 1129, 4133,
-    5266, 725, -2053, 60, 243, 366, 405, 2554, 1879, 62, -1244, -1355,
-    -1116, -1699, -3086, -1163, 656, -215, 59, -559, -2178, -4613, -3090, -1861,
-    -4487, -2744, 1224, 2624, 124, -838, -68, -1414, -1529, 303, -120, 1573,
-    1822, 1424, 683, -182, -51, 2232, 2055, 2381, 3216, 4708, 5933, 5894,
-    8611, 6945, 3975, 4164, 5033, 5216, 7779, 8716, 8287, 7300, 4728, 5277,
-    6812, 5423, 2875, -145, 1523, 3104, 2544, 4072, 2636, 87, -493, 1290,
-    2794, 3527, 3906, 4651, 2903, 2185, 3833, 4377, 3428, 4853, 4696, 4099,
-    5596, 5082, 4391, 3638, 5500, 7172, 7371, 6651, 4082, 3744, 5620, 7682,
-    5950, 3296, 4901, 4550, 4141, 4395, 2708, 316, 1968, 4633, 1857, 70,
-    2672, 3551, 2931, 3692, 2351, 1428, 4092, 6796, 5444, 4800, 1886, -584,
-    1901, 2851, 1612, 1619, 2326, 1495, 1999, 1631, 875, -188, -458, -888,
-    -1022, -2046, -1068, -2490, -3432, -1331, -2000, -4376, -3940, -3777, -6245, -6348,
-    -4927, -5007, -4255, -4967, -6533, -5154, -3651, -2698, -4564, -4282, -2792, -4023,
-    -3537, -2779, -3946, -3268, -2953, -2078, -3309, -2156, -910, -195, -1958, -2409,
-    687, 2067, -293, -139, 146, -1938, -3995, -3330, -4393, -3341, -3307, -3476,
-    -3766, -3361, -3323, -4391, -3736, -3109, -7168, -5417, -2675, -2894, -4621, -5654,
-    -6799, -6286, -5173, -6833, -6092, -7308, -8070, -5053, -4646, -5319, -4608, -3960,
-    -4711, -3797, -1281, -66, -48, -813, -191, 366, 600, 1877, 1786, 1366,
-    2744, 2305, 2412, -656, -644, 331, -1738, -5324, -3790, -2270, -1051, -204,
-    -2458, -4171, -4935, -4346, -2544, -1153, -3075, -3274, -1159, -605, -3045, -3297,
-    190, -531, -2630, -4950, -4186, -2584, -966, -824, -316, -3421, -5602, -6100,
-    -5491, -5650, -5559, -6302, -9006, -9253, -6562, -5318, -5139, -8286, -9190, -5349,
-    -3370, -2646, -3458, -4038, -3370, -2912, -2593, -2833, -1811, -967, -886, -833,
-    -1635, -583, -329, 3203, 4117, 2513, 1812, 144, 322, 3873, 6348, 4114,
-    4009, 5043, 3237, -688, 2175, 5782, 5194, 2142, 250, -267, 689, 1610,
-    906, -144, -605, -88, 1741, 2097, 1443, -2, -1291, -995, -32, 1109,
-    400, 1160, 1853, 1841, 4165, 2603, 1679, 4451, 2402, 630, 300, -164,
-    1635, 4841, 4705, 3105, 2192, 1206, 3876, 6420, 5374, 3124, 1492, 3413,
-    4705, 3608, 3330, 3707, 4801, 5024, 4823, 4987, 5129, 5301, 5396, 3662,
-    2899, 4817, 5959, 5866, 4581, 5535, 4973, 5050, 3786, 3109, 4730, 4475,
-    1168, 2758, 5075, 6551, 6852, 6313, 7812, 6223, 3178, 3321, 7172, 5741,
-    4574, 5906, 5912, 5327, 2923, 1201, -208, -805, -2312, -2611, 595, 1808,
-    -278, -1455, 42, -267, -3399, -3063, -682, -424, 2129, 4073, 5431, 3750,
-    4389, 6673, 5391, 3962, 3771, 3962, 6184, 8469, 7292, 5784, 6003, 4105,
-    2605, 3502, 3125, 3066, 2782, -72, -167, 695, 466, -1000, -2555, -2572,
-    -2632, -1861, -1447, -1619, -612, -3995, -6148, -2760, -773, -1061, -441, -1812,
-    -3928, -2949, -1115, -1027, -825, -636, -2424, -3547, -1419, 740, 2965, 4904,
-    2906, -655, -188, 215, -919, -732, 1707, 2948, 2879, 2478, 2336, 3167,
-    3283, 2718, 701, 487, -729, 608, 2293, 3931, 1896, 353, -408, -525,
-    -560, -1977, -454, 1277, 1324, -901, -2318, -512, 38, -3017, -4838, -5727,
-    -4177, -3612, -4589, -4401, -4661, -3715, -5088, -5687, -5710, -6015, -5860, -6244,
-    -6789, -8269, -5831, -5996, -9962, -11579, -9753, -9603, -8867, -7468, -5663, -5109,
-    -6536, -8064, -5069, -3157, -5170, -7521, -8047, -7493, -6738, -5466, -3910, -2877,
-    -4556, -6487, -5288, -3812, -1261, 2386, 2498, 181, 875, 1505, -307, -340,
-    2011, 358, -944, 2217, 2380, -517, -2712, -3012, -2672, -3350, -4817, -3414,
-    -4082, -4059, -4050, -4491, -6107, -5870, -5849, -6590, -6020, -5885, -6389, -2488,
-    19, -1727, -2377, 629, 764, -3100, -2864, -1067, -842, 118, -116, -1738,
-    622, 115, -2786, -3177, -2043, -3511, -3037, -282, -663, -1720, 388, 128,
-    -1985, -1732, -150, -1155, -727, 351, 724, 1498, 4252, 4491, 3713, 4275,
-    2677, 2106, 2130, 4426, 4483, 3810, 3977, 3423, 717, -269, 1697, 1086,
-    364, 2638, 3485, 3271, 3526, 3006, 1350, 471, -39, -556, -1289, 453,
-    -1285, -2241, 43, -210, -2074, 116, 1059, -712, -2601, -1061, 585, 1548,
-    1744, 2726, 2739, 173, -1291, 598, 3313, 3084, 3026, 2797, 1508, 1598,
-    5021, 5586, 3591, 3872, 5519, 7245, 8379, 6740, 7239, 8998, 6707, 2984,
-    2429, 2363, 3073, 4900, 6162, 4897, 2622, 707, 1611, 2478, -1210, -3889,
-    -1776, 892, 506, 1416, 2794, 1487, -962, -882, 18, -237, -71, 579,
-    480, 833, 1958, -199, 292, 2087, 1766, 1658, 4321, 7358, 6147, 6581,
-    8127, 8884, 4953, 3833, 4883, 6017, 6199, 4257, 3498, 3171, 2644, 2865,
-    2764, 2609, 937, 2028, 3198, 2409, 1982, 2481, 3370, 3692, 3760, 3604,
-    3587, 3288, 6472, 9755, 8364, 5008, 4184, 3509, 3302, 3357, 3326, 3020,
-    2645, 2833, 4171, 2676, 1943, 1000, -1603, -3255, -4011, -3895, -1210, -371,
-    -4168, -3433, -2327, -4024, -4669, -3616, -2650, -1212, 837, 2559, 2475, 1526,
-    2364, 3258, 1532, -1984, -1465, 1299, 2209, 1169, 1693, 3192, 1102, 79,
-    1103, 802, 2138, 3368, 3477, 5409, 4857, 1359, -620, 3930, 3954, 1413,
-    1687, 1116, 514, 2151, 1770, 69, -1852, -1552, -1553, -1512, 418, 62,
-    229, -1065, -1427, -2172, -2547, -4203, -5703, -5264, -2894, -2001, -3886, -3159,
-    -1423, -3786, -5514, -5323, -6355, -6635, -3310, -2787, -3608, -2974, -3701, -6259,
-    -4596, -5002, -5708, -5789, -3932, -4564, -5275, -2223, -2295, -5624, -4536, -6720,
-    -8973, -8291, -5364, -4024, -5995, -5780, -6257, -5352, -4796, -5705, -5277, -3595,
-    -1347, -1499, -1979, -782, -309, 55, -406, -1802, -1917, -972, 1382, 1957,
-    1782, 1204, -455, -694, -1771, -2352, -2615, -4692, -5741, -6447, -5130, -4336,
-    -7647, -8349, -6516, -3958, -5327, -5459, -3918, -2255, -1520, -2384, -2660, -3629,
-    -3639, -512, 2868, 1878, -2116, -1461, 2698, 3428, 1339, 2097, 2752, 1283,
-    838, 2124, 2267, 2011, 1636, 29, -11, -1472, -2296, -685, -1996, -4260,
-    -5164, -3052, -453, -1309, -4217, -4694, -3789, -4215, -4574, -2332, -1015, -2203,
-    -3042, -2583, -2717, -2862, -2615, -2218, -3834, -3709, -3647, -4057, -4419, -2183,
-    -1786, -2733, -2707, -957, -273, 1271, 769, -860, 471, 1872, 2297, 3057,
-    3064, 2510, 1683, 1100, 675, 0, 848, 2966, 2557, 1513, 1818, 3899,
-    4616, 2821, 1544, 999, 832, 1741, 1444, 1573, 3282, 3080, 2125, 2316,
-    2268, 2649, 3519, 3579, 2495, 1240, 1673, 2321, 3180, 3708, 3965, 2920,
-    2401, 2895, 3862, 2854, 2641, 908, 584, -39, -829, -1347, -1148, -860,
-    -1311, -648, 166, -518, -326, -109, -755, -914, -384, 1395, 1704, 1874,
-    1788, 1972, 2524, 1334, 1737, 3369, 4294, 6539, 6484, 6619, 7852, 8912,
-    8598, 6412, 7778, 7661, 6684, 7947, 7476, 6533, 4762, 3961, 2776, 2093,
-    1131, 747, 1120, 1535, 347, 1455, 3240, 1201, -104, 1053, 3773, 4295,
-    636, -2542, 215, 4540, 6203, 4857, 3897, 635, -1426, -205, 1080, -2432,
-    -4093, -1296, 2015, 3009, 2394, 1244, 2165, 2179, -1014, -2483, 980, -602,
-    -1943, -46, 2571, 3549, 5218, 7794, 7802, 4902, 2327, 864, -2797, -4759,
-    -5006, -6282, -4481, -941, 2040, 5668, 7910, 8709, 6229, 1326, -749, -4045,
-    -5422, -4463, -4407, -3818, -3908, -2758, -2334, -1063, 757, 2201, 3011, 4128,
-    4951, 2049, -27, 735, 938, 1134, -1391, -4247, -4144, -4294, -4467, -3346,
-    -1183, -2067, -2140, -1258, -994, -555, -408, 353, -221, -264, -77, 815,
-    2626, 3082, -361, -1557, 1276, 1483, 650, 2622, 2688, 1852, 921, 298,
-    4123, 5249, 3397, 983, -1768, -805, 2340, 3504, 2832, 1621, 684, -861,
-    -1989, -3181, -4329, -4748, -5446, -7482, -9088, -8503, -6941, -6295, -3801, -2831,
-    -3649, -3900, -4916, -5415, -5726, -6469, -5314, -5009, -5310, -4694, -412, 2033,
-    140, -413, -821, 1417, 2848, 1249, -373, -1753, -3625, -5899, -7417, -6607,
-    -6883, -6244, -6304, -5001, -4952, -6169, -6197, -6346, -7048, -4296, -1955, 2075,
-    4743, 5027, 5255, 5096, 3028, 2529, 3061, 2600, 2088, 3488, 3387, 1453,
-    418, 280, -2228, -5231, -6887, -5937, -6249, -7478, -7827, -6969, -5500, -5793,
-    -4895, -2831, -749, -1773, -2001, -296, -2285, -5726, -4564, -3125, -4647, -6068,
-    -3785, -491, 1417, 2808, 2921, 2109, 1239, -797, -1087, 1025, 274, -3802,
-    -4078, -1317, -1345, -1134, 1960, 4407, 1360, -765, -72, 2005, 1994, 2268,
-    2458, 1076, 604, 1130, 2110, 2482, 1930, 1018, 1245, 1781, 2062, 62,
-    223, 1214, 785, 1706, 2193, 3347, 2295, 1216, 759, -2131, -1936, -1027,
-    -1111, -1220, -1671, -807, 920, 1015, 329, 1265, 2655, 340, -261, 2720,
-    6082, 6832, 6420, 6729, 6890, 6836, 6407, 6065, 7336, 6959, 4326, 2907,
-    -445, -4184, -6299, -6553, -7496, -9128, -7424, -4452, -1358, -227, -718, -896,
-    277, -247, -993, -1923, -763, -228, -285, 862, 3226, 4876, 4894, 3499,
-    2538, 1431, 1313, 1663, 2339, 1851, 941, 21, -804, -1632, -2532, -3405,
-    -3169, -3659, -4865, -6386, -5721, -4641, -4513, -3873, -3300, -1244, 80, 1123,
-    2622, 3921, 4213, 3881, 4229, 5519, 5898, 4447, 2939, 2373, 2420, 2674,
-    2774, 289, -2485, -1401, -1104, -485, 211, 1748, 1390, 2153, 3547, 1796,
-    1697, 2315, 3892, 4035, 4340, 5772, 5501, 3926, 3994, 2177, 520, -120,
-    -586, -10, -543, 115, -593, -662, -1415, -3102, -3569, -3379, -3440, -3838,
-    -3536, -733, -122, 466, 132, -1190, -1940, -1883, -2273, -2250, -1299, 2042,
-    3057, 2765, 5692, 7522, 6340, 4743, 3788, 3120, 1844, 823, 542, -617,
-    -1632, -2535, -3334, -2152, -1047, 60, 3106, 4964, 4885, 5068, 6649, 5873,
-    4216, 3838, 3649, 1931, 2259, 4598, 5141, 4805, 4930, 3542, 3722, 4535,
-    3553, 3017, 4480, 4780, 3484, 2964, 3269, 2046, 1744, 1388, 627, 859,
-    2333, 2883, 1632, 328, 0, -188, -146, -1660, -3532, -2905, -2580, -2886,
-    -3720, -3220, -3050, -2982, -2356, -1074, -204, -167, 1004, 2969, 2204, 663,
-    792, 536, -173, -1132, -385, 192, -428, -275, -294, -599, -995, -1987,
-    -2143, -3517, -6008, -7034, -5927, -5575, -5868, -4976, -4018, -4478, -5588, -4995,
-    -2743, -1861, -2376, -3086, -3247, -4359, -5961, -7137, -7074, -7596, -8661, -9289,
-    -5831, -5112, -6988, -7185, -5612, -5874, -7708, -6058, -3613, -2524, 155, 1394,
-    1792, 1768, 118, -801, 303, 226, -749, -1763, -201, -1539, -3004, -3933,
-    -5087, -5619, -5956, -7044, -8418, -8315, -6071, -5077, -4510, -4765, -4648, -3797,
-    -2371, -1940, -1483, -1323, -255, -198, -1393, -112, 1168, 582, 1497, 1626,
-    584, 2393, 3464, 2868, 2373, 1653, 1952, 3079, 2883, 868, -74, 1227,
-    2316, 3303, 3772, 2302, 1452, 749, 394, 1066, 572, -36, 1414, 2153,
-    1627, 2173, 3001, 3578, 3153, 2903, 3084, 4383, 5811, 6388, 6088, 6108,
-    6665, 6887, 7075, 7220, 5769, 6078, 5906, 4710, 3318, 3198, 2591, 2787,
-    498, 146, 771, 288, 239, 19, -922, -2834, -3592, -3351, -1348, -684,
-    -1466, -80, 1562, 1482, 562, 222, 861, 353, -1221, -1275, -1130, -1554,
-    -1857, -1286, -208, 355, 33, 332, 2542, 3326, 1731, 1763, 2115, 387,
-    524, 1183, 1693, 1126, 343, 1099, 1993, 2043, 1720, 1413, 2665, 3401,
-    3677, 3279, 2614, 3631, 4002, 4010, 3808, 1276, 862, 1646, 3232, 1002,
-    7, 989, 930, 209, 155, -674, -439, -459, -1169, -114, -514, -2101,
-    -2631, -501, -680, -1152, -720, -2196, -874, -1458, -2101, -1791, -3096, -4135,
-    -3507, -3728, -2508, -1182, -1366, -1771, -2062, -1870, -1157, 2121, 1752, -298,
-    -398, 327, 2754, 1528, 491, 790, 655, 610, 2208, 2577, 2328, 2616,
-    2194, 2334, 2655, 2729, 1419, 2183, 941, -599, 280, 2179, 2193, 485,
-    -798, -216, -1680, -3777, -2853, -2462, -4096, -4524, -4220, -3570, -3931, -4696,
-    -3600, -1624, -3326, -4339, -4508, -3714, -3828, -4463, -3483, -3933, -5631, -4082,
-    -1978, -2728, -2644, -393, 1824, 3208, 3153, 2028, 2304, 3894, 3368, 1564,
-    880, 1882, 2308, 3337, 3385, 1182, -255, 1002, 2235, 1382, 1064, 300,
-    -820, 782, 2167, 1725, 2282, 2503, 1858, 2565, 2960, 3654, 3803, 4797,
-    5835, 5033, 4409, 5935, 5648, 4222, 3979, 3134, 1694, 1834, 1815, 506,
-    466, -1507, -3514, -1777, -358, 411, -15, 587, 820, -838, -1747, 172,
-    -425, -1139, -93, 237, 1738, 2411, 2421, 2608, 3948, 2404, 606, 869,
-    13, 126, 1367, 1601, 716, 216, 123, 2, -1774, -3206, -1432, -1348,
-    -1221, -1143, -1644, -2909, -4724, -6068, -5264, -5748, -5989, -4427, -4820, -4595,
-    -3514, -4692, -4641, -3160, -3074, -3071, -2114, -1215, -202, 111, -250, -1302,
-    -2190, -2178, -2744, -3575, -3773, -4015, -4742, -3934, -3024, -3626, -3536, -3738,
-    -4416, -3224, -1628, -1544, -912, -41, 582, 1529, 824, 479, 687, 3271,
-    5398, 3767, 3069, 3462, 2793, 854, 513, 267, -714, 1262, 3037, 3703,
-    3607, 4401, 4618, 4267, 4031, 3045, 2157, 3285, 4116, 4744, 6416, 7922,
-    7762, 5976, 5574, 3532, 2511, 3161, 2621, 4121, 3574, 3040, 1440, -99,
-    -39, 2, 1062, 1615, 627, -65, 1108, 1047, -1034, 369, 728, -1291,
-    192, 1060, 565, 686, -449, 176, 355, -1242, -1321, -1265, 899, 858,
-    -1213, 715, 1910, 2191, 1978, 1989, 805, -442, 1343, 2283, 2036, 1716,
-    1561, 1178, 511, -1042, -1467, -1611, -1479, -3275, -2850, -1265, -2507, -2801,
-    -3499, -3579, -4140, -3783, -1731, -68, 1811, 2071, 1578, 1571, 2177, 1872,
-    742, 649, 1076, 173, 700, 1916, 2925, 1777, 620, -54, -2521, -1575,
-    -712, -1457, -861, -868, -71, -394, -1828, -2715, -2355, -1483, -1576, -3083,
-    -2925, -1504, -630, -72, -1274, -2529, -2993, -1673, -644, -143, 968, -746,
-    -2480, -2656, -3235, -4647, -3760, -3538, -5765, -6963, -7310, -6846, -5702, -5682,
-    -5973, -5169, -4457, -2341, -1194, 862, 2231, 586, 1862, 2515, 1577, 696,
-    1277, 1663, 1853, 2105, 1714, 989, 267, -383, -824, -1977, -2753, -1679,
-    -1186, -43, 427, -1034, -1353, -2201, -2191, -1330, -1300, -1849, -610, -356,
-    514, 2337, 4048, 2978, 616, -601, -400, 959, 781, 1093, 1401, -212,
-    -184, -1504, -3569, -2849, -3275, -3963, -5561, -7132, -5925, -5587, -4987, -4988,
-    -4735, -4259, -3206, -1756, -746, 1074, 884, -79, -177, 721, 1258, 2466,
-    2942, 2797, 1902, 2113, 2303, 2157, 1785, 1731, 2403, 2214, 3418, 4273,
-    4807, 5801, 4673, 3976, 3227, 3904, 2752, 2644, 3860, 4153, 3446, 4099,
-    3878, 4273, 3283, 1553, 2561, 3608, 3725, 3849, 3776, 4382, 4263, 4009,
-    3986, 4659, 3583, 2572, 3239, 2267, 1737, 3860, 4096, 3019, 857, 145,
-    1303, 1463, 1206, 544, -220, 264, 295, -107, 99, -32, -540, 301,
-    976, -269, -1519, -1396, -747, -705, -1795, -1552, -73, 412, 799, -812,
-    -2484, -3044, -4024, -3743, -3013, -3627, -4345, -3192, -3364, -3505, -3398, -3238,
-    -3094, -3913, -4169, -1576, 2044, 2739, 2629, 2509, 1997, 1847, 2835, 2539,
-    1441, 396, 305, 1844, 533, -858, -2329, -1852, -2031, -3805, -5700, -4889,
-    -3266, -2427, -3587, -4804, -4576, -3543, -491, 278, 1131, 1483, 1424, 2577,
-    1816, 3558, 4081, 5575, 5172, 4521, 4972, 6877, 7844, 6996, 5597, 4391,
-    2809, 3657, 4584, 3997, 3723, 3365, 3033, 3438, 2505, 2529, 1260, 289,
-    -815, -699, -161, 1835, 2818, 1975, 467, -593, -472, 1154, 2070, 2474,
-    2081, 2548, 3596, 3476, 2614, 2757, 2337, 991, -748, -532, 653, 2950,
-    2842, 404, -75, -802, -899, -480, -764, -2792, -3707, -2468, -1273, -1545,
-    -953, -531, -923, -427, -613, -741, 423, 1435, 1645, 1686, 886, -1043,
-    -263, 1748, 2508, 1603, 494, -711, 48, -981, -863, -721, -1289, -587,
-    -237, -328, 590, 2006, 643, -1836, -2790, -1980, -692, -741, -1118, -513,
-    -266, -385, -699, -886, -732, -2091, -3492, -3498, -3288, -2263, -198, -604,
-    -3124, -5269, -6477, -5979, -4848, -5297, -5810, -5522, -4759, -4049, -4734, -5133,
-    -4771, -4646, -5028, -5343, -4885, -3518, -1212, -391, -423, -818, -1180, -704,
-    7, -1523, -2162, -3057, -2892, -3720, -4283, -3898, -3525, -3583, -3576, -2457,
-    -2532, -2786, -1480, -1442, -2005, -1804, -1604, -283, 1663, 838, 1835, 2618,
-    1420, -139, 823, 1424, 1330, 1561, 3029, 4276, 4099, 3767, 3035, 1667,
-    -430, -1481, -2183, -1411, -1966, -3334, -1842, -2259, -4048, -5112, -5656, -5819,
-    -6137, -6725, -5216, -4179, -5082, -4025, -2584, -3651, -5058, -5050, -4960, -3511,
-    -2468, -1953, -449, -570, -1242, -2112, -2866, -2271, -1315, -1186, -392, -343,
-    -1190, -995, 369, 1173, 1529, 891, 206, 408, 752, 1011, 1270, 484,
-    223, -20, 584, 1944, 2714, 2634, 3299, 2896, 1523, 2092, 1813, 1500,
-    1657, 2025, 3237, 4047, 5277, 6209, 6069, 3862, 2622, 2144, 2770, 4152,
-    4908, 4951, 5588, 5266, 4188, 4124, 3509, 2562, 1716, 1865, 2417, 2933,
-    4719, 5629, 5188, 3687, 2933, 1254, 867, 2598, 3407, 2848, 3230, 2473,
-    2414, 2095, 387, -604, -1032, -1123, -1508, -1898, -202, 667, -463, -2762,
-    -3321, -2636, -1729, -1085, -643, -710, -910, -1619, -719, -1172, -1654, -618,
-    -1410, -1899, -1516, -1410, -473, -719, -2770, -4322, -5117, -4870, -2608, -540,
-    -313, -488, -212, 16, 290, -2034, -2304, -667, -685, 736, 2087, 2806,
-    5069, 4355, 2415, 2593, 1708, 2541, 3917, 4084, 5088, 5440, 5426, 5128,
-    3835, 1878, 2812, 3030, 2101, 2749, 2562, 3410, 4660, 2144, 932, 262,
-    -1718, -2962, -2314, -1480, 409, 1288, 1373, 1933, 871, -891, 557, 1410,
-    2186, 3252, 3681, 6102, 6620, 4018, 2966, 1446, 736, 1675, 2151, 1798,
-    3140, 3173, 1602, -64, -1509, -1546, -639, -451, 303, -225, -997, 1023,
-    1256, -212, -1123, -2460, -2554, -380, 1302, 1789, 3186, 2972, 2467, 3013,
-    654, -407, 723, 1329, 1571, 1928, 2224, 3809, 2466, 597, -44, -739,
-    -1341, 151, 917, 2161, 3640, 2794, 2357, 1404, -499, -703, 504, 357,
-    -171, -65, 1144, 2423, 1440, -189, -834, -1688, -2786, -2009, -1946, -1192,
-    424, -141, -341, -1150, -2817, -3664, -2658, -1632, -1236, -1048, 1364, 2232,
-    1049, 108, -275, -1649, -1551, -622, -61, 1560, 1453, -448, -920, -1547,
-    -3316, -2993, -2264, -2264, -2389, -2411, -2622, -2376, -3154, -4448, -5609, -6857,
-    -5803, -5082, -4162, -2611, -2837, -3994, -3834, -3648, -4538, -4047, -3162, -1876,
-    -728, 32, 406, 612, -943, -1299, -1576, -2229, -1144, -345, 913, 1627,
-    2215, 1220, 186, -25, -642, -900, 327, -241, -531, 151, 76, -1399,
-    -2746, -2896, -4033, -5327, -5624, -5133, -3563, -3193, -2582, -2476, -3130, -4158,
-    -4084, -4148, -3631, -3750, -3201, -2018, -1317, -2348, -2289, -2386, -3342, -4434,
-    -4257, -3225, -2780, -2981, -3306, -4128, -4687, -5385, -5156, -4946, -4643, -4936,
-    -5118, -4709, -4784, -5553, -4511, -4401, -5434, -4892, -2502, -1491, -1427, -799,
-    -213, -674, -295, 389, 1324, 1676, 2082, 2721, 4390, 4387, 2470, 2634,
-    4204, 3848, 2407, 2649, 4257, 4958, 5047, 5248, 4659, 3154, 2948, 4121,
-    5077, 5183, 5904, 6700, 7309, 6266, 3311, 2780, 3253, 2562, 1258, 869,
-    1522, 1982, 1055, 1264, 567, -835, -1331, -642, 87, 668, 1411, 2055,
-    3656, 3653, 2451, 2902, 2915, 1900, 2424, 2899, 4032, 3749, 2617, 2696,
-    1855, 573, -106, 533, 693, 414, 612, 696, 1024, -725, -2523, -2121,
-    -2499, -4268, -4228, -3754, -2628, -3512, -3702, -3291, -4240, -4947, -3212, -894,
-    -1126, -854, -871, -105, -109, -1781, -2248, -700, -49, -561, -666, 633,
-    1397, 1246, 1110, 463, -554, -1467, -464, 1123, 804, 1147, 840, 1923,
-    781, -1051, -1201, -693, -2001, -3350, -2541, -367, -572, -1072, -1624, -1933,
-    -1964, -1663, 283, 1738, 2477, 2672, 3245, 3917, 3604, 3588, 3468, 3519,
-    3005, 3101, 4207, 3721, 2628, 2283, 2179, 1636, 189, -330, 2105, 2199,
-    1760, 1370, 1862, 2532, 2549, 1173, 1229, 1321, 631, 1236, 2303, 1112,
-    863, 1440, 905, 768, 408, 1726, 4213, 4134, 3218, 3848, 4042, 4696,
-    4155, 3332, 3889, 4068, 3688, 4600, 5404, 4354, 4562, 4840, 3802, 2865,
-    2513, 3266, 4717, 5060, 4095, 3907, 3144, 3676, 2915, 3292, 2288, 205,
-    -31, 474, -113, -283, 256, -850, -2291, -3312, -1334, 215, 849, -570,
-    -1298, -455, 242, 527, 45, 861, 316, -873, 5, 751, 140, 480,
-    190, -230, -412, -1468, -1508, -454, -517, -1508, -1626, -2307, -1061, -1331,
-    -1518, -2223, -3360, -2884, -1996, -3513, -4686, -4389, -4418, -3806, -4561, -3892,
-    -2096, -617, -879, -333, -1530, -2426, -1453, -1626, -876, -721, -1560, -1261,
-    -335, -527, -565, -61, -253, -935, -2510, -2086, -1112, -588, -822, -938,
-    -2810, -3153, -3324, -3526, -3611, -2757, -3889, -3773, -3388, -3926, -3193, -1751,
-    -2327, -3497, -3912, -4235, -2303, -1089, -10, 647, -432, 97, 701, 1185,
-    1115, 2103, 1601, 1344, 924, 444, 170, 535, -574, -2086, -2069, -1846,
-    -1135, -1488, -458, -1960, -3407, -1990, -512, -1001, -1600, -2360, -3332, -1942,
-    -1798, -3519, -3072, -2782, -3826, -2783, -2262, -1617, -330, -378, 146, -1625,
-    -3585, -2787, -1817, -1734, -1154, -1780, -1616, -239, -338, -328, 736, 834,
-    -394, -134, -53, 1160, 1917, 2603, 2474, 1126, 655, 1718, 1606, 1463,
-    1225, 640, 1094, 544, -181, 480, 1508, 678, -541, -1019, -545, 1354,
-    2399, 2441, 2036, 1499, 1400, 3305, 3858, 2669, 2339, 2444, 3165, 3334,
-    2366, 2222, 2492, 952, 158, -393, 275, 895, 261, -577, -997, -1792,
-    -2405, -1434, -473, -853, -1628, -1952, -1454, -1098, -1459, -1400, -2179, -2766,
-    -2796, -2235, -528, 1722, 2299, 1417, 1019, -704, -1202, 930, 660, -883,
-    -1430, 221, 1077, 1083, 18, -509, -1530, -2615, -2768, -1945, -1475, -187,
-    -603, -1129, -1032, -2902, -3290, -1212, -981, -2326, -2403, -1060, -1003, -125,
-    -78, -550, -1112, -2079, -2576, -2179, -860, 269, 207, 540, 1808, 1191,
-    1037, 1728, 747, -652, -277, 1371, 1767, 2192, 1861, 577, -478, -907,
-    -925, 290, 1779, 755, 350, 1208, 1013, -399, -728, 691, 1037, 768,
-    792, 1561, 1963, 1841, 925, 714, 883, 826, 994, 2421, 4085, 4097,
-    3978, 4818, 4235, 3440, 2204, 1974, 2140, 3279, 4452, 5462, 5448, 3988,
-    2277, 1166, 979, 1544, 2434, 2444, 2351, 2340, 1577, 2221, 1975, 1060,
-    271, -76, -15, 1085, 1912, 1627, 433, -249, -1473, -2203, -2507, -2812,
-    -2596, -1655, -1052, -675, -252, 1153, 1702, 328, -80, 365, 789, 1580,
-    2311, 2559, 2007, 1522, -323, -591, -798, -1219, -603, -202, 196, -186,
-    -762, -912, -1393, -3031, -3526, -3557, -2105, -210, 553, -343, -1700, -1557,
-    -2464, -2495, -1465, -314, 800, 67, -554, 136, 584, 1036, 160, -1882,
-    -1949, -673, 773, 1631, 1754, 486, 370, -279, -1440, -1830, -650, -535,
-    -837, -1142, -1192, 337, -474, -1368, -945, -1835, -2895, -1638, 314, 1879,
-    556, -1308, -1737, -1705, -1648, -2777, -2393, -1877, -2409, -2634, -1159, 755,
-    206, -140, 57, -1042, -1011, 483, 2246, 2580, 776, 757, 1047, 1741,
-    1930, -20, -346, -550, -1001, -1025, 913, 985, -328, -834, -2110, -4094,
-    -4088, -1120, 1013, 92, -1281, -1849, -1720, -1411, -1794, -1484, -1384, -2200,
-    -2716, -2392, -376, -762, -2350, -2684, -2969, -3403, -1935, 1188, 471, -1222,
-    -1639, -2970, -2471, -1559, -1348, -886, -2508, -3274, -3317, -1706, -210, -981,
-    -2529, -3049, -3504, -3633, -2270, -892, -1190, -1033, -2300, -3189, -1898, -375,
-    59, -472, -1153, -829, -676, 1262, 2598, 2567, 1449, 336, 1205, 2780,
-    4292, 4506, 3098, 2797, 2017, 3050, 4607, 5511, 4453, 2218, 1259, 704,
-    947, 2339, 2891, 2906, 1024, -952, -408, 1103, 2865, 2962, 1954, 2462,
-    1581, 2151, 2830, 3081, 1824, 699, 751, 1698, 3804, 4978, 4559, 3686,
-    2287, 2785, 3980, 4603, 4287, 2568, 1211, 1590, 1626, 2674, 3617, 3606,
-    1539, 405, -554, -434, -260, -121, -1193, -2074, -3197, -3071, -1078, -795,
-    -1639, -2807, -3277, -3637, -3433, -3231, -2325, -2266, -3775, -3651, -3578, -2919,
-    -2915, -2298, -1193, -1534, -2139, -1245, 369, 1325, 556, -1120, -2320, -1378,
-    -41, 558, 782, -47, -1246, -967, -768, -503, -299, -468, 83, -318,
-    -1393, -1213, -607, -1257, -1159, -1079, -1279, -500, 79, 175, -255, -1266,
-    -2057, -1804, -356, 1365, 837, 540, 1179, 588, 318, 952, 1475, 1434,
-    1588, 965, 1419, 2957, 4007, 3193, 2164, 1684, 1642, 1909, 2607, 3105,
-    2180, 1813, 1302, 1023, 902, 1279, 1630, 1011, 656, 691, 251, 1046,
-    762, -348, -580, 104, 435, 858, 1442, 1674, 2089, 2197, 2551, 3553,
-    2802, 2635, 3327, 3352, 2730, 2533, 2352, 3691, 3357, 2513, 1833, 532,
-    565, 1043, 753, 1023, 292, -466, 763, -94, -2132, -1034, 216, 514,
-    1114, 1044, 1159, 1116, -207, -741, -766, -730, -427, 331, 1166, 938,
-    -251, 60, 1532, 678, -278, 130, 8, -440, 338, 581, 1279, 46,
-    -1590, -1414, -499, -916, -1319, -378, 590, -136, -1668, -591, -649, -2331,
-    -2544, -1023, -772, -953, -723, -1231, -1680, -2844, -4035, -3612, -2343, -2318,
-    -2832, -2987, -2864, -3395, -2304, -663, -839, -2310, -1665, 36, -138, 400,
-    232, -814, -1715, -1935, -1402, -1396, -1567, -1891, -1925, -1191, -1736, -3569,
-    -3079, -2166, -2922, -4645, -3322, -1928, -1938, -658, 610, 218, -1381, -2534,
-    -2893, -2258, -1693, -1335, -1263, 169, 562, 561, 1282, 1645, 348, -381,
-    698, 1315, 770, 1455, 1741, 1278, 104, -739, -1325, -708, -596, -1244,
-    -1095, -672, -1078, -1255, -970, -1517, -3364, -3254, -2323, -1299, -1112, -864,
-    -1193, -2112, -2851, -3575, -2695, -1107, -1075, -1181, -814, -1287, -1847, -863,
-    787, 374, -608, -643, 386, 1475, 1798, 2239, 1741, 618, -165, 165,
-    1715, 1768, 1103, 1005, 1459, 832, 186, 956, 1134, 180, -321, 612,
-    2182, 2418, 2760, 3679, 3782, 1950, 248, 16, 869, 1358, 1273, 958,
-    1429, 1406, 1633, 1715, 836, 132, 970, 1498, 1235, 641, 1071, 2160,
-    2455, 1497, 465, 952, 1623, 2049, 1666, 791, 440, 364, 985, 263,
-    -1044, -854, -603, 155, -92, -584, 207, 92, -1016, -2463, -2273, -1413,
-    -743, -439, -363, -137, -1496, -1540, -702, -728, -522, -869, -189, 454,
-    212, 803, 1518, 1126, -102, -2052, -1393, -316, 540, 755, 479, -575,
-    -1559, -1977, -1941, -2074, -2218, -1964, -917, -815, -1435, 354, 1079, 1165,
-    688, -648, -430, -232, -117, 588, 953, 34, 307, 57, 177, 265,
-    611, 1059, 1342, 352, -81, -11, 1033, 1640, 1435, -1259, 36, -1536,
-    1948, 1528, 221, 2067, 161, 338, 649, 549, 2057, 2673, 1118, -625,
-    3187, 2002, 48, 1106, -2433, 4097, -324, 28, 1674, 926, 1491, 1251,
-    2376, 1222, 3386, 737, 622, 1757, 3673, -67, 1215, 3173, 2844, -1261,
-    2681, -2028, 2884, 1537, 4612, -417, 1140, 2834, 1329, -474, -2259, 2900,
-    1000, -222, 756, -1552, -2108, 899, 1065, 6097, 2863, -2648, -7974, -2653,
-    1925, 1239, 1437, 3125, -187, -381, -418, -2299, 304, -1060, -1160, -47,
-    3411, 1181, 4377, 2067, 2882, 1415, 2426, 3652, 1494, -2574, -4933, -150,
-    -1681, -1297, -2020, 1250, 5187, 6775, 3171, 4837, 2449, -4001, -3550, -5701,
-    -8593, -5904, -5579, -8106, -4672, 1956, 3302, 2353, 7790, 8497, 4260, 1223,
-    -2241, -3585, -3654, -3845, -3487, -5923, -4362, -4608, -1306, -3127, -1431, 3554,
-    3933, 17, 2009, 5605, 906, -1188, 2559, -1568, 34, -529, -3869, 98,
-    -2578, -5834, -1275, 97, -2001, -2340, -596, -4101, -188, -2652, -1632, 1647,
-    -2791, -1522, -1003, -549, 1414, 14, 1158, 1361, 1268, 186, 1388, 379,
-    120, -161, 591, 422, 2031, -1923, -616, 2715, 2264, 3147, 4335, 2708,
-    1748, -352, 3472, 2174, 3241, -1960, 188, -238, 510, -730, -348, -1207,
-    -77, -4752, -3953, -5929, -679, 484, -5943, -2603, 2161, 959, -2576, 110,
-    126, -2467, -748, -3001, -3735, -590, -4477, -1509, -1323, -4067, -283, -1031,
-    -964, -804, -3783, 1082, -2634, -2624, -1280, -466, -4465, -5242, -6550, -6696,
-    -6979, -5652, -5251, -6379, -5918, 1307, -449, -2305, -2068, 655, -230, -1551,
-    -2581, 3612, 4572, 4173, 7347, 7641, 7388, 6757, 7158, 2446, 901, 898,
-    2638, 1706, -933, 3014, 3612, 1820, -698, -2504, -1994, -4525, -6845, -4421,
-    -1005, -2565, -2290, -780, 938, 3959, 2002, 4810, 4753, 6798, 4848, 3687,
-    6084, 6159, 2971, -207, 1290, 1645, 4546, -173, 594, 5012, 4578, 5182,
-    6769, 7306, 3110, 1427, 2489, 446, 1695, 1189, -283, 940, -471, -493,
-    -2223, 2331, 984, -504, 1414, 906, -849, -890, -2062, -1308, -1159, 1076,
-    -1034, 404, 1499, -1158, -1206, -2945, 1514, -66, -2266, -1739, -1415, -646,
-    -300, -1731, 72, 3282, -1499, -3202, -3802, -1749, -2431, -3181, -3360, -2134,
-    -3054, -1957, -3329, -2522, -1814, -2369, -1877, -2831, -4196, 1378, -194, -3768,
-    -1766, -2076, -4664, -4444, -1735, -246, 1207, 3233, 3885, 2474, 4466, 5406,
-    3892, 4250, 3500, 3465, 358, -1687, -3477, -4228, -5289, -4847, -4038, -1455,
-    1091, 160, 1272, 1163, 3619, 1734, 2789, 628, -3361, -673, -2780, -4850,
-    -290, -675, -1354, 23, 2140, 473, 3578, 785, 1664, 1870, -228, 678,
-    -1432, -1746, -1571, 402, -507, -954, -881, -217, 1219, 3131, 70, 546,
-    -383, 30, -2659, 229, 105, -179, -1955, -1258, -3725, 1389, 2531, 501,
-    2278, 3404, 93, 2241, 5103, 4715, 4996, 1029, 2608, 2603, -846, -258,
-    -1891, -1305, -1115, -1366, -607, 344, 1389, 346, 2025, 2627, 2119, 4682,
-    6320, 6372, 4868, 7593, 5557, 5865, 6953, 3261, 6079, 3516, 1237, 1103,
-    546, -1132, -738, -1554, -2160, 1340, -110, -1900, -3267, -943, -3382, -2906,
-    660, -4867, -3667, -2168, -2870, -1974, -1867, -1392, -2524, -2647, -648, -2222,
-    -3198, -3698, -2491, -3927, -2905, -2848, -3338, 356, 778, 955, 973, 1110,
-    1019, -441, -11, -3007, -3223, -6402, -2006, -2000, -2458, -1944, 532, 4108,
-    6382, 3661, 4519, 9056, 6547, 4782, 7163, 4747, 5406, 6020, 4191, 3202,
-    5246, 5195, 4264, 2361, 3987, 2702, 1246, 2442, 2936, 4493, 1452, 2729,
-    2508, -214, 3784, 2129, 1788, -157, -238, 619, -908, -2024, 136, -840,
-    616, 607, -1490, -3238, -5482, -3312, -2304, -1448, 449, -1342, 89, 319,
-    -1514, -3110, -1555, -2616, -3720, -2153, -3948, -2820, -1068, -3469, -4310, -2792,
-    -3016, -6909, -4379, -2563, -3371, -2392, -3546, -4652, -2756, -3211, 2020, 2817,
-    -282, -1720, -1476, -2185, -4184, -6745, -7873, -6585, -6641, -6875, -5157, -2449,
-    -366, -853, -1368, -1702, -1476, -468, -3431, -50, -1290, -1724, -1467, -6086,
-    -3751, -2792, -3878, -5271, -4690, -4098, -4733, -2206, -2971, -2607, -2540, -866,
-    -1390, -414, -893, -838, 1079, 4351, 4430, 4686, 3290, 3678, 4793, 3089,
-    2992, 1380, 1731, -213, -670, -1122, -399, -1879, -2812, -5457, -3569, -1499,
-    -2125, -2585, -1701, 381, -551, -1823, 545, 1717, 5087, 6168, 5779, 5609,
-    5908, 1974, 477, -137, 1360, 1650, 2852, 820, 3207, 2342, 4035, 4973,
-    3562, 4872, 2086, 3834, 3386, 1367, 1941, 2122, 1908, 1061, 1678, 4969,
-    3293, 3630, 3850, 4781, 5152, 5290, 6763, 5949, 5332, 6269, 5986, 1424,
-    1238, 3096, 3867, 2744, 723, 1970, 3210, 5324, 5393, 7495, 6422, 6365,
-    7404, 7128, 4795, 3501, 4548, 2881, 3636, 4262, 3593, 3847, 3265, 19,
-    697, 735, 2746, 2337, 1422, 3036, 3330, 3025, 4871, 2051, 1750, 275,
-    444, -1850, -2784, -1077, -1700, -145, 1024, -746, -786, 198, 394, -1557,
-    -645, -985, -923, -2103, -917, -3104, -4443, -7515, -6708, -6494, -5147, -3470,
-    -3500, -5159, -7937, -5170, -4100, -4965, -4097, -3608, -3468, -4308, -3699, -3912,
-    -3793, -3120, -2094, -1536, -509, 1126, 2804, 3174, 1696, 294, -528, -156,
-    -206, -1899, 158, -2059, -2266, -1433, -385, 169, -2810, -2929, -3998, -3386,
-    -965, -2563, -1104, -655, -407, 1791, 1928, -924, -3240, -4059, -4046, -3565,
-    -1397, -1911, -1691, -210, -1262, -1137, -468, -463, -548, -1499, -1188, -1577,
-    -2726, -4686, -5167, -5175, -6188, -5815, -4934, -5293, -3938, -41, -377, -1934,
-    -3207, -1304, -1081, 2154, 635, 1374, 4412, 3522, 2259, 824, 2749, 2438,
-    1801, 763, 439, -622, 1596, 3561, 1363, -724, 721, 9, 1614, 582,
-    737, 1837, 1274, -235, -696, 656, 1443, -1309, 614, 1432, 1346, 1688,
-    1954, -839, -796, -574, -571, 44, -1889, -1321, -2261, -868, -2383, -1543,
-    -2726, -1532, -1758, -2763, -4678, -4122, -4286, -3836, -2523, -2890, -3559, -4366,
-    -2355, -1652, -33, 312, 594, 1842, 4194, 5012, 5343, 3730, 2490, 3173,
-    1451, 4765, 5246, 6672, 6150, 5833, 3250, 3324, 2429, 1316, 2447, 286,
-    23, 482, 2971, 3691, 4786, 3608, 5386, 4583, 4630, 3775, 3630, 5120,
-    5003, 4106, 4682, 4005, 3663, 2696, 3066, 2607, 3857, 4903, 5096, 5119,
-    5629, 4770, 6686, 5305, 3245, 2610, 1241, 1261, 2529, -278, -1328, -1548,
-    -1607, -1942, -158, 852, 174, -511, -2221, -3587, -2980, -1794, -2070, -2304,
-    -1742, -986, -1504, -710, -947, -1504, -2013, -3600, -5446, -6257, -5543, -5841,
-    -4740, -3919, -2931, -3475, -3676, -5189, -6484, -6300, -5046, -7075, -6338, -4737,
-    -5515, -6376, -3818, -4024, -5214, -6505, -5796, -4782, -4610, -5011, -2861, -3743,
-    -4329, -3002, -1014, -944, -795, -27, 1844, 2270, 4461, 6768, 6707, 6452,
-    7593, 8110, 4446, 3025, 2181, 512, -616, -190, -917, 288, -367, -523,
-    -453, 499, 1894, 1511, 1118, 716, 1568, 2557, 2649, 985, 2042, 3690,
-    4147, 5358, 4529, 4166, 3372, 2823, 1514, 1654, 2560, 2662, 3617, 2124,
-    3392, 4535, 4330, 3019, 3065, 2367, 2109, 1632, 3778, 1634, -453, 435,
-    3503, 2862, 1543, 499, -101, 410, -263, 370, 1322, 62, -1334, -2283,
-    -2907, -2809, -2372, -2641, -2564, -1304, -1398, -287, 1159, 195, 371, 158,
-    1729, 2736, 940, 775, 2373, 2924, 1214, 3218, 2793, 2418, 2489, 1182,
-    1801, -681, -722, -72, -1292, -3860, -3908, -4246, -2651, -1314, -2379, -3662,
-    -3017, -1568, -1848, -829, -2504, -4020, -3408, -1630, -1647, -1509, -1431, -327,
-    327, -1333, -3448, -5809, -4045, -2973, -3532, -3766, -3099, -3211, -4231, -3273,
-    -1966, 1096, -329, -1489, -2121, -809, -227, -1254, -3216, -4728, -5300, -3308,
-    -1743, -1138, -1522, -2503, -1838, 488, 1304, 399, -822, 1741, 1702, -300,
-    -1152, -261, -63, 135, -841, -2947, -5695, -5607, -1203, -2333, -2705, -2211,
-    -1876, -3364, -5025, -3596, -2516, -3180, -3215, -2704, -1405, -236, 1014, -542,
-    -1650, -1991, -2086, -3839, -3418, -2655, -2510, -2306, -2025, -1079, -1157, -962,
-    -38, -1138, -3649, -3616, -2267, -829, 300, -1487, -1385, -8, 1535, 4700,
-    5341, 5296, 3717, 2980, 2865, 5097, 6365, 6984, 7386, 6715, 5577, 6570,
-    6597, 6350, 4950, 5241, 5546, 4235, 2945, 5046, 5737, 4815, 1615, 896,
-    -107, -1097, -1279, -2310, -2770, -4397, -2349, -2044, -92, 535, 477, 635,
-    -370, -1734, -288, -1036, -764, -855, 793, 971, -31, -659, -1520, -200,
-    -1301, -1650, -1723, -862, 1880, 2572, 30, -2061, -970, 1214, 3664, 3314,
-    2764, -87, -1538, -1743, -292, 1568, 1728, 3613, 6828, 6923, 5202, 5103,
-    5996, 5548, 6922, 8157, 7083, 7548, 8956, 5524, 4510, 4470, 5271, 5249,
-    5537, 5240, 6604, 6220, 2902, 3693, 7035, 6459, 6582, 4998, 3999, 3233,
-    2270, 1785, 310, 414, 1052, 1166, 654, 833, 485, -2686, -4461, -2398,
-    -2107, -2209, -974, -1679, -1867, -1256, -4134, -3333, -1949, -2030, 6, -310,
-    -1077, -1282, -524, 172, -44, -1292, -1592, -1776, -1258, 454, 878, -1567,
-    -4148, -2189, -1617, -2745, -1034, 854, 1000, 826, 927, 1791, 1878, -977,
-    -1138, -2858, -4043, -3763, -3703, -5536, -5471, -3412, -3004, -3163, -3028, -1849,
-    19, -365, 363, -83, -626, -471, -1402, -155, -1405, -753, -307, -2051,
-    -3163, -3654, -3652, -2281, -1766, -467, 1085, 1009, 608, -1687, -1532, -786,
-    362, 3379, 2790, -123, -2350, -4329, -4637, -4198, -4721, -2879, -3269, -4516,
-    -3861, -1609, -3858, -5116, -6685, -4865, -1952, 2270, 2907, 945, -2878, -3305,
-    -1819, -1662, -928, 677, 869, 2467, 4741, 3115, 954, 350, -1685, -1657,
-    -857, 1316, 2656, 2751, 554, -759, -247, -331, 44, 2166, 4642, 4580,
-    6117, 2614, 401, 98, 711, 1608, 2271, 440, -1187, -1895, -2119, -326,
-    -787, -544, -1922, -2086, -854, 1494, 2234, 1284, -597, -1741, -2826, -831,
-    1539, 642, -1091, -2505, -293, 2556, 3829, 3231, 626, -496, -357, -289,
-    -2409, -1756, -1569, -875, 1273, 2994, 2802, 330, -5241, -6894, -5585, -3973,
-    -1469, -1570, -1409, -2552, -2443, -1806, -2433, -3991, -6190, -4014, 462, -26,
-    -227, -1258, -1861, -3950, -3287, -1183, -3569, -3587, -781, 559, 312, -2829,
-    -4787, -4664, -3954, -90, 414, -862, -3049, -3277, -3736, -3243, -1778, -3184,
-    -3923, -2926, -1262, -799, -14, -1085, -1883, -4899, -3952, 482, -376, -1979,
-    -2535, -674, 727, 1099, 832, 330, -36, -421, -1383, -2344, -4112, -3832,
-    -1994, -1402, 1647, 1468, 304, -1821, -4756, -5155, -3022, 291, 1721, 1407,
-    1516, 1759, 837, 1951, 3122, 4480, 2350, 4994, 5997, 3270, 1970, -1058,
-    -845, -1318, 203, 989, 875, 1250, 3027, 3030, 2237, 2484, 4284, 3685,
-    3995, 6405, 7969, 7192, 5207, 2797, -188, 1367, 1789, -102, -170, 1664,
-    3508, 2401, 3087, 2319, 3378, 1353, 1077, 2530, 2398, 2936, 2131, 1146,
-    1454, -95, -1965, -1585, -2383, -1374, -3468, -4753, -4927, -1909, -959, -253,
-    808, 1325, 2905, 3220, -631, -1732, -181, 258, 2013, 1867, 665, -528,
-    -507, -631, 570, 2255, 1354, 1218, -168, 400, 2457, 848, 70, 361,
-    1829, 3596, 5318, 7381, 7187, 2990, 1283, 1596, 4214, 4480, 6589, 6469,
-    5892, 5764, 3747, 877, 2329, 4424, 3137, 548, 1448, 4030, 3794, 3793,
-    3502, 3791, 3272, 2999, 3660, 3414, 3018, 3075, 2122, -29, 1137, 2168,
-    2322, 4318, 3649, 2289, 1806, -271, -8, 2121, 4156, 5200, 3996, 1927,
-    2643, 2667, -176, -1463, -2090, -1668, -1024, 256, -49, -459, -203, -2214,
-    -747, 2259, 3071, 2717, -542, -1068, -485, -907, -771, -859, -1980, -2502,
-    -1645, 445, -258, 28, -399, -1478, -1010, -135, 1218, 1379, 1914, 1802,
-    -1165, -4167, -4385, -3626, -3688, -3676, -3587, -5186, -5714, -5994, -6237, -6183,
-    -2918, -3780, -5229, -7944, -6918, -4639, -3681, -4388, -4936, -5704, -4199, -3342,
-    -3264, -4193, -2420, -3226, -4687, -3896, -2632, -113, 510, -649, 518, -2621,
-    -3528, -374, -597, -738, 18, 800, -1912, -3548, -1291, -1819, -275, 558,
-    -1263, -1187, -2708, -1009, -2100, -4660, -2938, -1397, -1610, -8, 2774, 3872,
-    2212, 2699, 1972, 2500, 6725, 6120, 5784, 6186, 5847, 5194, 4132, 5576,
-    4347, 3348, 2681, 2164, 1177, 473, 624, 1376, 1607, 2637, 2611, 1192,
-    2018, 431, -978, -1091, -203, 895, 1956, 815, -1173, -1827, -3466, -4704,
-    -5839, -4750, -4314, -2819, -7209, -6266, -4497, -3248, -3996, -4129, -3938, -2536,
-    -1817, -2787, -346, 371, 410, -2129, -4568, -4150, -2373, 1496, -2147, -1659,
-    -2000, -1793, -678, -681, -917, -1696, -3360, -3401, -2095, -87, 2767, 205,
-    -1867, -2440, -1004, -2145, -1746, 621, -551, 143, 152, 935, -1164, -3551,
-    -4510, -1042, -928, -1434, 279, -1173, -495, -460, -274, -2723, -2334, 339,
-    2220, 1065, -983, -4391, -4399, -5444, -3725, -1602, -1196, -711, -2384, -2809,
-    -1151, 215, -1207, -2928, -1594, 493, 974, 608, 1431, 318, -1212, -2941,
-    -1135, -657, -1065, 121, -2082, -3820, -4085, -2261, -1551, -1020, 668, 289,
-    -885, -1881, -3785, -4193, -3515, -3727, -1796, -948, 40, 1321, -405, -2760,
-    -2563, -2530, -2025, 876, 3283, 4453, 4064, 2670, -392, -1900, -1684, -1038,
-    3069, 884, -1480, -2679, -1359, -903, -1908, -2189, -1647, 489, 2259, 3594,
-    4217, 3130, 2411, 2125, 1870, 3708, 7792, 8029, 6973, 4795, 4182, 3087,
-    1714, 1293, 2723, 4773, 6568, 6497, 4390, 2937, 2579, 1873, 2638, 3610,
-    4305, 4640, 2953, 2787, -406, -2259, -2375, -496, 1734, 920, 933, 1109,
-    -1144, -5556, -5088, -3820, -1492, 1130, 2581, 128, -1581, 1547, -570, -1956,
-    -143, 2705, 4652, 4637, 3930, 2517, 751, -1291, -1539, -1568, 398, 1805,
-    1331, -2317, -2267, 575, -941, -255, 896, 2928, 4254, 3926, 4705, 3441,
-    1767, 1827, 3387, 4834, 6968, 6911, 5541, 3127, 4323, 7148, 5682, 5822,
-    5605, 7472, 8912, 8428, 8569, 5740, 5009, 4707, 6534, 7821, 8297, 5304,
-    3352, 2470, 2363, 366, -301, 940, 2831, 5104, 3731, 900, 97, -890,
-    -382, -763, 733, 1610, 1160, -562, -445, 899, 850, -1494, -3530, -2204,
-    1964, 3622, 1321, -838, -2392, -3991, -5057, -4619, -3127, -882, -537, -2355,
-    -2401, -3732, -4265, -1627, -2636, -2258, -730, -1036, -2077, -2051, -1898, -3936,
-    -4891, -4539, -2721, -868, -1418, -2587, -2639, -4314, -2105, -353, -1527, -1592,
-    604, -1805, -3655, -3880, -2999, -3498, -1813, 630, 1575, -881, -4273, -3518,
-    -2788, -3637, -2415, -2853, -2111, 225, 2040, -1796, -2501, -3709, -1954, -2394,
-    -1706, 643, 1729, -945, -4258, -4090, -2781, 634, 1358, 984, 1685, 3438,
-    1488, -391, 366, -1412, -1732, -2504, -1475, 1664, 2133, -476, -2041, -4167,
-    -5325, -2955, -2093, -766, 8, -1254, -3001, -1960, 241, 991, 1378, -439,
-    483, 2840, 2325, 2100, 2545, -1909, -1574, 11, -1392, -62, 1745, 799,
-    -1137, -2379, -1264, -1043, 424, -475, 2690, 2188, -1640, -1040, -1312, -3522,
-    -1275, -2042, -4073, -1761, -764, -1970, -1619, -1899, -2745, -2433, -2613, -3635,
-    649, 928, -2016, -2516, -4152, -1130, 3173, 3566, 3062, 5340, 3211, -316,
-    -256, 189, 1348, 3093, 2157, 1870, 1743, -511, -1207, -1305, -3290, -2569,
-    -1091, -936, 748, 1169, -3652, -5368, -4623, -4964, -3988, -2100, -1780, -2987,
-    -3379, -4035, -4902, -8539, -7039, -3966, -2530, -3035, -1057, -2472, -5564, -7344,
-    -7299, -5324, -4131, -3164, -646, 835, -1157, -1566, -4662, -9115, -6971, -3514,
-    -2453, -2886, -2804, -3685, -2086, -2129, -2189, -1094, -1219, -1852, 692, 1555,
-    906, 1550, -4717, -5984, -1435, 1378, 108, 2349, 1083, -1635, -1149, -1303,
-    -438, 2052, 1945, 405, 792, -1318, -1277, 465, -2791, -3555, -485, 2891,
-    2451, 2862, -636, -1854, -456, -1075, -551, 1549, 2359, 3399, 5156, 2774,
-    1926, -241, -2119, -1705, 2879, 4447, 4491, 4704, 1861, -2507, -2039, -369,
-    1471, 1090, 2350, 4597, 4771, 4052, 2014, -3348, -5050, -2615, 2970, 3157,
-    1993, 1890, 2664, 1761, 2235, 2904, 3396, 2187, 3635, 3367, 3104, 4338,
-    1333, -2109, -2337, 638, 3727, 5901, 4843, 2148, 331, 197, 1613, 1649,
-    1894, 1707, 3039, -112, -1756, -283, -2512, -3435, -2863, -1106, 215, 1990,
-    35, -512, -1712, -299, 940, 3787, 3767, 4890, 6658, 4663, 3913, 3922,
-    1448, 1726, 3413, 5205, 6689, 6699, 3961, 1622, 200, 2521, 4017, 5056,
-    2565, 4241, 4256, 4804, 5606, 3564, -876, -537, 1327, 2501, 3303, 3010,
-    2671, 1925, 2445, 4195, 4699, 4680, 1999, 1784, 2149, 3635, 6111, 5334,
-    2481, 1770, 2840, 5424, 7278, 6702, 5420, 5690, 6990, 4628, 3491, 4220,
-    5629, 5039, 4173, 2711, 3448, 2238, 1073, -983, -1862, -406, 49, -771,
-    -2446, -2587, -174, 278, 264, 397, 204, -505, -1011, -802, -1007, -1398,
-    -1646, -2143, 230, 1893, 2496, 295, -1908, -3731, -2333, -2651, -1801, 1556,
-    -498, -1297, -1488, -489, -4080, -6611, -8055, -9579, -6413, -4407, -4956, -6746,
-    -6414, -5433, -4499, -5157, -5030, -4273, -5020, -5636, -4905, -2904, -4734, -5258,
-    -7818, -8109, -4347, -1574, -2155, -1975, -275, -1790, -1559, -3299, -284, 1236,
-    608, -1661, -40, 1562, 869, 1028, -1327, -1609, -130, 717, -279, -415,
-    1555, 1544, 1590, 1143, 1485, 1669, 1220, 527, 1410, 1323, 257, -921,
-    -2041, -1603, 2620, 3678, 1449, 155, -837, -2483, -948, 1924, 3889, 4403,
-    3053, 2389, 2359, 1194, -147, -1345, -1040, -217, 1617, 1958, 458, 624,
-    249, -1574, -1612, -1326, 933, 1759, -73, -1151, -1639, -543, -2712, -4514,
-    -3912, -1193, 2293, 2413, 904, 206, -604, -2192, -1731, -57, 1580, 1260,
-    54, -908, -840, 128, -1694, -2355, -2643, -4115, -2493, -1581, -1539, -263,
-    -583, 356, -138, 2044, 3702, 3419, 1843, 1588, 690, -390, -4437, -1751,
-    657, 688, -801, -1470, -4081, -4422, -5078, -4640, -4082, -1063, -2386, -3499,
-    -3667, -4215, -3235, -4584, -8148, -6119, -5665, -5202, -3968, -2821, -3759, -3512,
-    -1633, -1274, -1492, 547, -1466, -1765, -3071, -2632, -1685, -4118, -3827, -704,
-    934, -194, 1537, 2699, 241, 34, 1615, 1693, 961, 2046, 166, 2053,
-    744, -489, -970, -2073, -1308, -1320, -2679, -3505, -985, 6, -1859, -358,
-    1203, 1518, 1539, 1393, 882, 1979, -1310, -2345, -3147, -1514, 698, 1554,
-    439, 148, 1855, 736, -4069, -2901, -1338, 872, 1462, 916, 9, -437,
-    -1697, -3243, -4833, -4385, -5299, -5623, -3451, -1843, -54, -1918, -2902, -619,
-    -933, -168, 248, 209, 852, -562, -1293, -926, 325, 1118, -285, -345,
-    1808, 3061, 4525, 2828, 4149, 6428, 4549, 5384, 3036, 5379, 8142, 5965,
-    3420, 1757, 3456, 4286, 2616, 1259, 1071, 3767, 1613, 2009, 6338, 6364,
-    6843, 6418, 3553, 2888, 4113, 3642, 2655, 4117, 4526, 2680, 2039, 3472,
-    3128, 2007, -592, -1293, -57, 1853, 3048, 3815, 1765, 1666, 1408, -2472,
-    -2438, 351, -1383, -4108, -3579, -2587, -135, -1441, -2532, -1646, -1694, -546,
-    -917, -1260, -557, 93, 1696, -2405, -1957, 52, -593, 56, 3193, 2275,
-    3795, 4120, 5243, 6224, 4296, 4177, 4101, 3547, 6023, 8154, 5990, 1427,
-    539, 4001, 325, 2832, 5831, 4702, 1576, 4862, 5718, 6012, 7856, 5290,
-    2838, 4712, 5153, 6731, 3570, 2769, 2609, 4267, 1345, 3015, 3899, 408,
-    -332, 310, -569, -901, -465, 1248, 232, 800, -588, -3466, -4136, -3157,
-    -1009, -508, -2209, -2150, -2839, -4288, -5121, -143, -1639, -2812, -2070, -3171,
-    -1628, -1493, -2492, -5068, -8399, -5219, -5815, -3661, -3604, -3155, -1926, -1850,
-    -157, 1819, 593, 404, 1461, 647, -163, 3745, 1191, 313, -1631, -1808,
-    -2033, 84, -1970, -4109, -4206, -4118, -2161, 1891, -1873, -2629, -3738, -4002,
-    -1469, 1683, -273, -2491, -1004, -2174, 640, 603, 1460, -1841, -1018, -1738,
-    -1239, 2111, -680, -447, -739, -2452, 1191, 942, -1167, -4088, -2704, -2410,
-    -624, -1471, -3830, -6316, -4217, -3135, -1428, -1057, -760, -1451, 905, -3,
-    783, 2584, -1016, -2273, -406, -2171, 776, 1413, -2017, -897, -794, 1505,
-    2024, 2759, 1148, 795, 1041, 3406, 4282, 3029, -799, -1573, -933, 1589,
-    1481, 2556, -909, 421, -1311, 4748, 3048, 3226, 2085, 31, 1679, 2027,
-    4456, 2052, 571, -1925, -3482, 4423, 2459, 1293, -958, -5166, -1212, 875,
-    1028, -158, -1604, -189, -1715, 808, 471, 3497, -1576, -1890, 266, 2557,
-    -765, -604, -4353, -2446, -3980, -1048, -4696, 1638, -1941, -59, -3540, -189,
-    -2556, -2513, -4952, -5935, 1425, 1045, -2580, -1525, -3046, -2370, 2243, 2228,
-    1604, -984, -1337, -691, 144, 369, 50, -577, -2566, -7091, -4011, -2326,
-    -4666, -864, -7392, -5560, -3755, 974, -2438, 35, -4443, -1961, 1258, 1647,
-    1289, 161, 39, -2467, 265, 964, 2702, -2943, -3023, -3347, -1027, -1431,
-    31, 820, -4474, -2303, -558, -2970, -461, -2564, -4050, -2413, -1702, -1771,
-    -3904, -4979, -3268, -2027, -2165, 698, 698, 5577, 1455, 3754, 2354, 1639,
-    -3285, -2309, 46, 1658, 3712, 547, -3600, -514, 4580, 2967, 4139, 7351,
-    5195, 4647, 2748, 6185, 8999, 539, 2484, 5166, 4389, -132, 4143, 4382,
-    -255, 702, 284, -1247, 1739, 4440, 1289, 428, 1391, 4625, -91, -1200,
-    2510, 2466, 451, -481, 1878, -1060, 1072, 758, 120, 536, 2915, 497,
-    -178, -1759, -184, -752, 1422, -3040, -1402, 2156, -700, 39, -3056, -3972,
-    -4499, -5631, -5550, -6147, -1730, 703, -3881, 436, -605, 1254, -399, -4507,
-    -2563, 2777, 857, 1800, 582, 1935, 1695, 2666, 2420, 6005, 7510, 4495,
-    5492, 7923, 6369, 3853, 6939, 5368, 1983, 3609, 6878, 3923, 4532, 6186,
-    5811, -1800, -220, 8483, 5071, 4274, 7153, 5869, 3502, 1197, 6274, -400,
-    2570, 3012, 3131, 4603, 2866, 1803, 1040, -296, -10, 3669, 1446, -758,
-    1692, 432, -3547, 621, 929, -1036, -2566, -12, 843, 268, -2917, -5210,
-    -4121, -3955, -1663, -721, -1557, 2060, 1126, -2413, -1109, 551, -1361, -3973,
-    -674, 1744, 520, -3507, -2431, 1619, 1683, 537, 4512, 2401, 1496, 3534,
-    168, 557, 4001, -859, -3931, -234, 1927, -1506, -985, -1815, -283, -2165,
-    -3239, -1334, -1332, 743, 653, -970, 2418, 696, 600, -2545, -1637, -261,
-    2364, -574, -2399, -989, -488, -6157, -1908, -2208, -4512, -3579, -1631, -1231,
-    -5198, -3281, -5393, -5643, -3711, -2776, -3983, -2077, -411, -2598, -7105, -5324,
-    -3511, -3802, -3941, -2146, 2143, -3, 2970, -2219, -3892, -2234, 493, -584,
-    -3937, -921, 4829, -1331, -965, 2451, 4337, 1708, 632, 2727, 4151, 4499,
-    5503, -3, 1512, 3997, 2089, 708, -175, 1730, 2449, 1870, -1734, -3388,
-    71, -2871, 429, 2286, 2713, -150, 209, -554, 75, 1846, 2678, -127,
-    68, 1570, 2964, -552, -454, -622, -479, -903, 863, -649, -1219, -801,
-    -2522, -2361, -2018, -1459, -2509, -2478, -823, 526, -2009, -5911, -7454, -3576,
-    -1976, -3405, -1635, 904, 1411, 440, -1965, -1820, -1748, -1938, -4165, -467,
-    287, -285, 1836, -1838, -993, -605, 982, -2607, 3859, 3142, 2484, 1933,
-    1111, 1756, 130, -1647, -3184, -883, 1711, 1157, 3121, -2693, -2544, -2549,
-    -2811, 128, 919, 88, 246, 1122, -1701, -122, -1800, -2357, -1036, -2388,
-    298, 77, 791, -4446, -1183, 491, -2668, -691, -1379, -598, 59, 181,
-    1091, 541, -2588, -2536, -237, 993, 314, -2681, -5535, -7421, -2853, -2451,
-    -1898, -1771, 838, -448, -4725, -954, 688, -3224, -1408, -2257, -1176, 3001,
-    2727, 3164, -1155, -605, 2355, 1851, 695, 2056, 2563, 98, -1416, 3821,
-    2644, -3313, -5083, -3572, 1490, 1000, -1627, -1669, -2897, -3477, -1320, -1777,
-    -1306, 2362, 1046, -1471, 3923, 6678, 3387, -156, -2150, 1037, 1436, 1279,
-    767, 2440, 839, 1179, 2711, -134, -484, -2869, -1376, -382, 2270, 5649,
-    828, -1803, -939, 2149, 857, 282, 1651, -1284, -2187, 884, 4225, 4760,
-    3094, 2120, 1585, 4585, 3210, 3409, 1061, -650, 1401, 635, 3112, 3441,
-    4340, 669, 3571, 4187, 3995, 3102, -261, 1760, 2672, 3670, 5103, 2249,
-    -617, 240, 1239, 1946, 871, -1421, -1163, -1393, -1300, 330, 378, 146,
-    -2236, -2005, -782, 748, 4692, 239, -1903, -425, 1451, -192, -1790, 1276,
-    1333, 1447, 3092, 2334, 537, -1290, -6198, -3582, -11, 4828, 3748, -1036,
-    -1042, -320, 187, -2699, -3848, -5170, -1962, -1500, 2248, 5315, 4563, 343,
-    -944, 593, 3679, 4479, 2642, 1961, 1839, 3244, 2289, 543, -756, 4422,
-    3569, 1916, 2630, 5443, 2100, -2575, 559, 3413, 3513, 2245, -372, 1286,
-    2390, 2966, -287, -2646, -1657, 505, -599, 1270, 1847, 2092, 610, 552,
-    -1611, 906, 1211, -678, -1246, -1563, -1397, -1417, -1172, -5860, -2679, -3464,
-    -1708, -2134, -1593, -3794, -5939, -6960, -2728, 558, -584, -355, -1060, 414,
-    -805, -796, -987, -3832, -5281, -4443, -2264, 2243, 495, -2116, -1485, -3722,
-    -2460, -3007, -1118, 653, 1783, 2480, 1304, 869, -413, 1361, 2149, 2862,
-    5142, 3049, 727, -1133, 971, 1365, 937, 1812, -720, -555, 4259, 1528,
-    -1365, -2268, -4037, -3174, -2110, -1007, 2190, -39, -1795, -1234, 15, -1435,
-    365, 1694, 919, 1466, -1339, -532, -372, -554, -2536, -734, -1144, 477,
-    -135, -1351, -3562, -3087, -1036, -1426, 222, -267, 1583, 19, -2942, -3469,
-    -2597, -1484, -4321, -3669, -3432, -1682, 40, -1550, -1885, 2443, 1961, -343,
-    -348, 305, 1211, 2106, 1723, -1234, 363, 1934, -249, 1456, 2439, 2331,
-    807, 7, 469, 2955, 2231, 820, 28, 2150, 2157, 1951, 859, -697,
-    2342, -682, -1719, -3909, -2907, -1751, -1497, -1247, 202, 819, -843, 144,
-    1365, 2457, 923, 662, -1497, -191, 1998, 2201, 985, -1838, 989, -2373,
-    -1716, -2881, -2174, -1675, -3124, -2629, 218, 413, -142, -2867, -5077, -1470,
-    -1988, -3974, -4119, -2091, -2909, -1826, -455, 1040, 346, 137, -1845, -1518,
-    246, 1529, -1461, -2746, -1842, 47, 2880, 1560, -647, -1205, -1455, 225,
-    -882, -996, 1021, -617, -1526, 1802, 3600, 2934, -618, -1213, 66, 739,
-    1592, 142, -82, -3185, -1052, 644, 3343, 2073, 2362, 626, 647, 1095,
-    1216, -2727, -1670, 177, -1083, 1892, -852, -1143, -3686, -3573, -1282, -441,
-    -1650, 236, 440, -592, -159, 2828, 3672, -1533, -399, 473, 728, 965,
-    -866, -3090, -5611, -2110, 2412, 3517, 1273, 734, -430, -3839, 306, 1968,
-    233, -121, 2665, 1473, 4168, 5326, 3205, -624, -427, -454, -176, 92,
-    -74, 88, -513, -1325, 2006, 1658, -1314, -1962, 207, 171, 747, 964,
-    -2832, -1906, -366, 1968, 2110, 2059, 789, 2122, 1587, 1696, 2015, 1334,
-    -1728, -1640, 2159, 4977, 2634, 1224, -629, -1077, -623, 34, 918, 832,
-    -657, -895, -357, 3353, 4220, 878, -1629, -611, 1237, 1547, 1318, -1350,
-    -3239, -96, 2718, 4183, 3111, 3942, 2342, -926, -726, 495, 2099, 1143,
-    255, 4548, 6135, 4128, 2778, 22, -911, 922, 630, 2065, 2074, 4100,
-    3439, 3468, 4682, 2167, -112, -1385, 401, 2877, 3460, 1006, -1011, -4744,
-    -5305, -1921, -1469, -2189, -3139, -1414, -812, 319, 2040, 1426, -1122, -1840,
-    996, 4314, 2967, 1128, 577, 178, -1521, -1690, -1438, -2910, -3569, -3798,
-    -2291, -297, 1412, -1397, -4588, -4454, -1084, -116, -1856, -3903, -3851, -3592,
-    -1184, 1025, -915, -3119, -532, -1120, -1053, -532, 1740, -1020, -1934, 1390,
-    3403, 4187, 2336, 1052, 629, -417, 1198, 2766, 578, -1223, 400, 1403,
-    2728, 2227, 272, -4005, -1214, 1675, 3404, 2736, -483, -1400, -2856, -1918,
-    -564, 943, -696, -1366, 261, 1339, 838, 554, -1363, -3719, -2606, -1001,
-    879, -1428, -1934, -1138, -2826, -2247, -1786, -2346, -4036, -2405, 443, 1747,
-    2673, 1586, -1418, -598, 2113, 1152, -9, -2008, -3067, -3525, -1416, 445,
-    709, -1092, -1474, -522, 783, 1844, 2151, 1860, 675, 2077, 4378, 5642,
-    4060, 2693, 100, -261, 840, 492, 141, -1791, -1823, -327, 1210, 1592,
-    -890, -1021, -716, 693, 1040, 677, 348, -1149, -3357, -2909, -618, 1312,
-    886, -1212, -431, 970, 1227, 855, 165, 843, -190, 739, -937, -541,
-    439, -1958, -1972, -561, -1278, -2988, -4102, -4302, -4284, -2780, -913, -1511,
-    -1704, -542, 949, 839, -498, -953, -3623, -4925, -2858, 342, 2811, 1128,
-    836, 1459, 1880, 289, -888, -749, -476, -112, 1781, 2858, 3487, 2308,
-    -886, -2869, -2818, -1080, 207, 990, 1049, 2089, 1531, 927, -456, -1439,
-    530, 1960, 1254, -48, 521, -1970, -4101, -4885, -2980, -610, -1097, -1129,
-    -56, 411, -1383, -507, -422, 1796, 3860, 4332, 1680, 3374, 2322, 216,
-    930, 588, 1948, 474, -1702, -2339, -1482, -1324, -1411, -565, -290, 2508,
-    3330, 1132, -1446, -3123, -4770, -4384, -2797, -1860, 1214, 1840, 512, 545,
-    -654, -3843, -4165, -2052, 713, 3376, 3248, 2639, 4374, 3158, 806, 37,
-    -1434, -1962, 474, 1988, 3163, 3652, 1182, -1473, -3398, -3789, -1347, 1406,
-    96, -55, -12, -1351, -2826, -3069, -4299, -1879, 1232, 1744, 1941, 279,
-    -1114, -1465, -2345, -758, 320, 868, 1017, 1161, 1004, -66, 971, -12,
-    -442, 316, -659, 157, 2077, 2399, 1082, 604, 2188, 4371, 4027, 2234,
-    1090, -781, -1938, -3012, -1470, -1433, -241, 1385, 1587, 886, -254, -1959,
-    -1423, -1234, 2047, 3993, 4686, 4537, 3711, 2528, 333, -172, -633, -1078,
-    -531, 734, 2420, 2016, 251, -2031, -3225, -3251, 641, 1476, 2785, 1633,
-    766, -756, -2166, -3165, -2704, -1876, -1016, 258, -160, -1239, -2143, -1485,
-    -1178, -477, 1845, 2474, 4346, 1814, 561, 421, 1112, 1550, 716, -1940,
-    -1534, -1163, -1472, -2238, -2971, -1975, -1005, 1383, 2793, 3022, 2819, 627,
-    -383, -2194, -1130, 699, 1276, 1451, 2503, 2740, 1795, 975, 496, 656,
-    570, 827, 1165, 2261, 3005, 2077, 1321, 110, 1844, 1319, 181, 1188,
-    2248, 1511, -21, -945, -1394, -1294, -464, -313, 134, -571, -797, -2657,
-    -4746, -4324, -2664, -3093, -2763, -738, -728, -1710, -1266, -489, 1635, 2081,
-    1689, 1480, 1240, 409, -1691, -3474, -3109, 981, 1636, -1636, -3219, -4166,
-    -5464, -5247, -3988, -2623, -934, 1586, 1193, 2370, 1344, 1004, -2026, -6971,
-    -6263, -3046, 595, 1001, 1206, 4, -277, 789, 913, 748, 2014, 1822,
-    1351, 1630, 2411, 4074, 3162, 3578, 4208, 2731, 2077, 757, 1368, 487,
-    2554, 3142, 1215, 518, 2190, 1545, 1372, 385, 1033, -292, -1930, -424,
-    -384, -45, -1781, -1333, -1793, -1707, 354, -728, -1346, 292, -127, -1326,
-    -1417, -1039, -721, -2148, -915, 2026, 3126, 3385, 634, -1547, -4895, -3563,
-    -2693, -1981, 925, 4049, 3402, 1931, 1203, -314, -3210, -6355, -6016, -5587,
-    -1853, 1591, 1544, -336, -1399, -249, -1508, -2049, 1515, 3348, 3284, 2698,
-    2712, 1489, -268, 2041, 2301, 730, 1405, 1319, 417, -1148, 1281, 3251,
-    1397, 148, 500, 1561, 774, -252, -1377, -2707, -1460, 455, -155, 62,
-    -133, -1044, -1552, -915, 2338, 1269, 194, 1402, 1689, 1640, 1019, 556,
-    -1179, -758, 528, 933, 2046, 1703, 717, -2264, -5093, -3411, -1776, -3334,
-    -843, 1470, 1971, 1606, 790, -2509, -3235, -3595, -4080, -3496, -1797, 1390,
-    2429, -78, -2487, 33, -1767, -3421, -2426, 5, 1480, 1877, -80, -2311,
-    -2069, -1630, 1401, 2752, 2742, 3049, 3750, 2555, 1539, 2742, 1542, 489,
-    -873, -18, 1505, 668, -3063, -4352, -4255, -2590, -1136, -630, -2200, -3187,
-    -1951, -1994, -42, 510, 974, 1280, 2491, 3655, 4319, 1792, 985, 1988,
-    1453, 2429, 2886, 2894, 1645, 1109, -641, -2198, -1831, -1660, -1582, -783,
-    255, 2001, 391, -992, -240, -1445, -1560, -1431, -1816, -1830, -1300, -545,
-    -2197, -1546, 967, 597, -59, 1050, 2978, 2506, -538, 478, 688, -337,
-    1726, 4464, 4193, 1214, -247, -697, -2816, -1157, -67, -678, -1658, 352,
-    2567, 775, -1016, -1169, -2117, -1489, 1612, 2715, 778, -1434, -285, -1410,
-    -1301, -22, -1022, -1352, -1061, 2011, 427, -1744, -2075, -2005, -1720, 472,
-    3517, 2453, 1194, 876, 886, -496, -112, -428, -1257, 94, 3679, 4317,
-    2091, 2041, 2305, 461, -1582, -1002, -885, -2546, -1531, 574, 241, 152,
-    1350, 1383, -13, 2383, 3925, 591, -1994, -2847, -1377, -1419, 277, 3452,
-    1873, -954, -1294, -660, -1764, -366, 269, -173, 620, 3257, 2070, -852,
-    -2749, -4139, -4086, -3858, -309, 2544, -1169, -2950, -2986, -2533, -1369, -438,
-    -1854, -1067, 1262, 3335, 2163, 1172, -959, -1329, -1472, -263, 3160, 1030,
-    -1400, -1277, -1240, -1960, -1394, -3852, -3764, -1939, 464, 1460, 1075, 2198,
-    2582, 280, -1074, 542, 1169, -1508, -963, 1646, 3382, 3132, 2464, -613,
-    -399, 1815, 4664, 3486, 1765, 189, -302, 63, 2302, 6242, 4980, 2049,
-    182, 732, -428, 1115, -264, -181, 615, 623, 399, -789, -3046, -5361,
-    -7080, -5650, -1108, 1014, -979, -2591, -2968, -3041, -3005, -2360, -3238, -945,
-    1317, 2778, 2871, 700, -1546, -3300, -3254, -256, 2319, 613, -426, 136,
-    98, -1606, -1003, -2468, -1344, 563, 615, 1505, 1530, 1057, 307, -2946,
-    -3594, -709, -1042, -2163, -1398, 428, 732, 728, 309, -110, 2713, 3075,
-    4343, 5243, 3585, 2644, 1676, 1133, 2534, 4213, 4459, 5238, 5295, 3107,
-    1391, 1152, 914, 3263, 4150, 1598, 1944, 1192, -691, -2319, -3394, -1507,
-    172, -907, -1741, -615, -1349, -4110, -3983, -5074, -4811, -1713, -694, -171,
-    -1076, -1361, -2844, -4650, -3280, 939, 2219, 385, 1517, 3552, 1588, 151,
-    -650, -2520, -1866, -326, -425, -464, -73, 421, -1126, -2017, -850, -973,
-    -2885, -2186, 1363, 2307, 1150, 770, -835, -1519, 966, 2758, 3060, 1362,
-    161, -996, -1885, -768, 1260, 1528, 507, 1901, 3327, 2613, 1049, -496,
-    -997, 4, 2371, 2555, 1294, 691, 109, -1881, -2860, -426, 1910, 104,
-    -1001, 1780, 1604, -197, -451, -211, -1096, -18, 2753, 3024, 547, -531,
-    -985, -2919, -3526, -1003, 1171, -1779, -1935, -1024, -1194, -1779, -2981, -4177,
-    -4435, -1590, -613, -548, 294, 2084, 2604, 1814, 920, 1339, -715, -3044,
-    -366, 1118, 1532, 362, -761, -2738, -1393, 78, 430, 209, -122, 372,
-    82, -722, -166, 3105, 2490, 3045, 2912, 3116, 2469, 1367, -547, -1456,
-    1666, 1639, 249, -365, -1049, -1931, -3299, -3451, -827, -485, -1968, -1170,
-    456, 98, -729, -346, -1641, -562, 467, 1318, 1616, 1535, 894, -219,
-    -1092, -932, 2664, 2112, 611, -355, 691, -95, -239, -2170, -2677, -361,
-    -128, -1558, -2287, -1953, -810, -146, -2195, -2725, -2901, -2414, -2017, -340,
-    76, 413, 98, -285, 1583, 2039, 1174, 1898, 1580, 720, 581, 615,
-    170, 603, 1861, 2030, 1755, 1915, 1705, 1006, -1230, 146, 1333, 1551,
-    1061, 1041, 593, 49, -533, -1905, -1446, -349, 1295, 251, -650, -2178,
-    -1643, -2385, -2239, -1482, -600, -959, -153, -53, 696, 848, -394, -1146,
-    -1120, 891, 2313, 3060, 2812, 2536, 849, -4, 806, 1721, 1273, 359,
-    -20, 1014, 2215, 1895, 288, -2158, -2742, -2809, -2032, -646, -237, -1479,
-    -2220, -1619, -1846, -665, -84, -642, -1081, -714, -169, -646, -1258, -952,
-    824, 1405, 1717, 1508, 1074, 48, -269, -791, 774, 393, -1481, -2044,
-    -528, -1416, -4525, -3861, -4418, -3516, -2253, 264, 171, -953, -2919, -1679,
-    -524, 1062, 2566, 2287, 1288, 1014, 1856, 369, -717, -2247, -2674, -1361,
-    135, 782, 2143, 1772, -207, -1166, -1658, -1114, 186, 244, 227, 2002,
-    4236, 2674, 1391, 267, -208, -690, -475, 2048, 3872, 2970, 2227, 3024,
-    1348, 226, 338, 1588, 2263, 2447, 317, -624, 472, 767, 2092, 2883,
-    2456, 2082, 1475, 1565, 1524, 1075, 894, 1013, -1208, -1552, -320, -564,
-    -3383, -4616, -3756, -2306, -797, -311, 801, -852, -3008, -4100, -2559, -2312,
-    -1278, -1671, -214, 590, 196, -1813, -2462, -2085, -1001, 766, 828, 1628,
-    1821, 1034, 380, -39, -465, -1763, -314, 1, 762, 1352, 1421, 1022,
-    -1122, -1357, -405, -781, -1051, 1143, 1550, 1794, 1264, 2768, 1689, 1332,
-    1449, 1994, 3393, 3236, 2902, 1400, 830, 2658, 2946, 3093, 3754, 2822,
-    1965, 1642, 2199, 2579, 1960, 2191, 1543, 1267, 687, -893, -1269, -2833,
-    -2478, -2408, -2561, -232, -129, -1356, -3966, -5381, -4430, -3749, -3165, -3460,
-    -2815, -1068, -1896, -2481, -2447, -1162, -586, -845, -943, 235, 919, 469,
-    -989, -1114, -876, 32, 1418, 1759, 1397, 501, 98, -32, -517, -611,
-    -465, -739, -912, -286, 1065, 358, -1033, -783, -582, -550, 270, 1173,
-    1394, 274, -816, -867, 767, 2032, 1632, 2265, 2248, 2133, 2964, 1808,
-    1310, 1722, 2370, 2404, 2341, 1119, -244, -1363, -3147, -2571, -226, 605,
-    114, -49, -90, 847, 1692, -1546, -2151, -1450, -645, 230, 1596, 531,
-    -1910, -3339, -2082, -51, 1177, -1174, -2774, -4048, -3526, -620, -402, -1890,
-    -1366, -1200, -124, 1074, 1977, 9, -1267, -1133, -643, 918, 277, 287,
-    -967, -2458, -1268, 1378, -529, -2063, -2028, -33, 1342, 2124, 2503, 947,
-    -727, 59, 2109, 3607, 2420, 2517, 1858, 1586, 3713, 2831, 809, 795,
-    100, 716, 3219, 4612, 1727, -2327, -3033, -2557, -1726, -1521, -485, -851,
-    -1216, -1009, -8, -1595, -2628, -1901, -1970, -343, 1975, 2543, 1077, -142,
-    380, 2483, 2825, 1557, -1091, -844, -1545, -797, 539, -930, -2442, -1881,
-    -2239, -676, -423, -1735, -5518, -4462, -1220, 523, -1627, -3783, -2757, -2449,
-    -2355, -366, 1076, -431, -152, 983, 3162, 3947, 2708, -681, -1704, -597,
-    1108, 1586, 1743, 761, 1521, 2283, 3052, 2295, 881, 1444, 1618, 1740,
-    2900, 3077, 2088, 94, -1155, -1238, -2392, -2246, -2458, -1623, -551, 394,
-    525, -2021, -3114, -3374, -3858, -1575, 772, -782, -2603, -2021, 494, 2467,
-    1289, 772, 49, -885, 1166, 3592, 3767, 1868, 807, -229, 387, 3505,
-    4607, 2001, 601, 398, 2030, 1392, -1126, -2243, -3035, -2627, -2138, -1583,
-    -2030, -1958, -1859, -1536, -267, 760, -670, -2221, -1701, -371, -2, -556,
-    38, 1503, 1265, 1501, 2979, 1841, -138, -375, 432, 1120, 2575, 2810,
-    830, -1560, -1234, -1262, -3336, -4720, -2218, -1245, -1144, 1014, 2198, 1022,
-    -1433, -1361, -2532, -1246, 488, 674, -871, -1846, -427, 602, -942, -1011,
-    -456, -1688, -413, 997, 1197, 669, 1135, 290, 75, 1765, 3630, 4598,
-    3538, 2876, 3636, 3404, 468, 73, 987, 2084, 3435, 1907, 1634, 1367,
-    103, 69, 1240, 1900, 224, -868, 65, -270, -201, -779, -883, 39,
-    227, 649, 1151, 1410, 694, 705, 1315, 1783, 1289, 1254, 1176, 954,
-    -671, -3417, -5184, -5619, -6024, -2043, -49, -2105, -2378, -2547, -3721, -4872,
-    -4104, -4143, -1876, -831, -1402, -48, 539, 690, -3, -2071, -1919, 1292,
-    1944, 1268, 2303, 1121, -820, -636, -1148, -1837, -418, 385, 2378, 1564,
-    -135, 477, 354, -2369, -1697, 2029, 1875, 1801, 1598, 1875, 1952, 3200,
-    2839, 3174, 3334, 3723, 4676, 2983, 1601, 2044, 463, 1830, 4804, 3705,
-    2243, 1669, 1454, 411, 421, 1681, 1810, 416, 267, 943, 534, -1483,
-    -1471, -5938, -7634, -3249, 54, -1528, -743, -1199, -4280, -6034, -5202, -4476,
-    -4076, -2651, -1659, -1383, -268, -181, -1510, -4486, -4258, -1237, -1365, 741,
-    2679, 2177, 995, 1465, -332, -1272, -67, 2762, 5053, 5462, 2358, 1853,
-    712, -2983, -3205, -1821, -527, 574, 1026, -332, -1365, -387, -642, -241,
-    725, 2647, 2407, 3477, 2108, 1072, -187, 832, 2868, 1337, 2789, 4430,
-    4178, 1164, 1574, 2327, 2725, 2359, 1840, 589, 1320, 1547, -237, -2684,
-    -4253, -2678, -2448, -1262, 432, -339, -1693, -3008, -4073, -5180, -2989, -760,
-    872, -392, -1207, -2474, -2745, -3254, -2559, -589, -2427, -1001, 941, 1900,
-    1619, 426, -2431, -4181, -3643, -110, 2803, 4441, 4709, 2517, -455, -2065,
-    -2531, -2703, -1002, 1306, 2488, 2206, 1797, 12, -2000, -1711, 115, 960,
-    1562, 2978, 3836, 2371, -52, -1057, -835, -407, 173, 2677, 5213, 4912,
-    2925, 2977, 2977, 3424, 3979, 2532, 2295, 3203, 2705, 445, -1579, -2455,
-    -1657, -1846, -2810, -934, 998, 890, -1612, -3825, -4380, -1170, 714, 743,
-    737, -4, -2178, -2810, -1237, -1182, -1171, -2832, -1620, 342, -433, -1689,
-    -2552, -3543, -3544, -2492, -722, 823, 1302, 1481, -2467, -5039, -5178, -5341,
-    -5268, -1323, 2429, 2453, 218, -1752, -1619, -1651, -234, -47, 2481, 3612,
-    3471, 1613, 966, 2386, 2524, -1234, 782, 7543, 5342, 3821, 6287, 1457,
-    -106, 5056, 2512, 405, 706, 1256, 2450, 358, -1905, -2977, -3978, -4262,
-    -3855, -1894, 1096, 1880, -859, -1001, -2137, -2770, -5096, -3163, 1644, 5842,
-    6891, 6845, 1119, -4013, -2825, -893, 3432, 8267, 6651, 2681, 158, -198,
-    -42, -2474, -3587, -3527, -2919, -2377, -2873, -1343, -2962, -4135, -4102, -2238,
-    1189, 898, -2241, -4246, -3896, -1721, -2781, -5262, 383, 8441, 14455, 13805,
-    6168, -1068, -354, 2324, 258, 1683, 7366, 4188, -5914, -12136, -7261, -275,
-    -1977, -9348, -10607, -3973, 3431, 3729, 4674, 5018, 3192, 2483, 1136, -97,
-    -6482, -12752, -11313, -4543, 2601, 1111, -7285, -10236, -7774, -1825, 3254, 4591,
-    6289, 5847, 3243, 2400, 6607, 11067, 5311, -5050, -9161, -5164, 338, 1284,
-    2055, 2935, 2535, 3609, 3369, 3708, 3255, 869, 2312, 3173, 1273, 427,
-    2426, 3681, 393, 834, 4001, 1128, -1200, 1577, 5328, 2230, -4824, 642,
-    9863, 6828, -2583, -4893, 1482, 2750, -5388, -10673, -3925, 4282, 8241, 8445,
-    6036, -2429, -6721, -4220, -2393, -3906, -6639, -7214, -6709, -1123, 3719, 2939,
-    2396, 235, -2779, -6854, -14030, -15487, -8211, -1015, 5931, 5448, -1608, -9147,
-    -11683, -4144, 5098, 1595, -4042, -5211, -2580, 1068, 5109, 3906, 1080, 827,
-    -317, -5851, -6237, 1619, 8095, 6877, 2259, -792, -1843, -355, 1262, 3688,
-    4391, 2212, 2578, 4356, 7384, 6308, 1682, 1425, 3969, 2641, 2903, 2433,
-    -1250, -478, -225, -306, -224, 2619, 4351, 3620, 134, -1138, -130, -1333,
-    -2115, -2557, -2025, -1121, 2281, 3441, 2782, 5156, 6547, 4214, 1555, 1555,
-    -2440, -3440, -1868, -2990, -5660, -3012, -1058, -1433, -922, -1538, -3675, -6111,
-    -7081, -6350, -3623, -2281, -3100, -5177, -6732, -2917, 834, -91, -2162, 2550,
-    9223, 9256, 3228, -1541, -611, 383, 2003, 1793, -611, -998, -1594, -4223,
-    -4301, -2216, -701, 2672, 5275, 8768, 9067, 5695, 4848, 6602, 5628, 1987,
-    734, 2566, 5002, 5907, 4084, 680, -277, -188, 346, 275, 1308, 3829,
-    2063, 811, 604, 206, -2661, -4205, -3170, -1010, -552, 314, -370, -1721,
-    -1213, -406, -2339, -3546, -2223, -49, -398, -304, 1149, 1098, -921, -708,
-    1430, 2411, 2042, 1954, -65, -15, -710, 39, 1242, 2450, 2734, 1139,
-    -1023, -230, 295, -878, -1822, -2957, -2416, -1411, -338, 110, -2742, -2900,
-    -2953, -2842, -2844, -2506, -2878, -3576, -5160, -4369, -2696, -1996, 167, 182,
-    824, 2426, 4939, 1757, 648, 1283, -954, -1199, -633, -1859, -4538, -8075,
-    -9077, -8804, -10754, -10192, -9529, -9103, -5481, -1843, -449, -3593, -3891, -3080,
-    -4250, -1793, -626, -1956, -3080, -4986, -4519, -4458, -4150, -1802, -789, 526,
-    2979, 2428, 227, -2056, -409, -566, -1216, 96, -926, -1398, -205, -33,
-    -452, 245, 872, 815, -929, -691, 1592, 2922, 1551, 291, 1469, 502,
-    544, 2548, 3485, 5380, 5878, 5347, 6243, 7111, 8828, 8605, 7051, 8293,
-    9345, 9365, 8042, 8188, 9167, 6262, 4950, 7096, 7725, 6976, 4415, 3166,
-    4354, 4178, 3860, 1554, 1388, 3185, 5543, 6347, 5096, 4793, 4811, 3656,
-    5102, 7739, 9732, 8810, 5504, 5420, 6633, 6676, 6313, 5389, 5870, 7551,
-    8060, 5846, 4611, 4429, 1366, -967, -182, 1237, 1813, 986, -678, -1146,
-    -944, -1585, -3255, -5466, -5467, -6019, -6272, -5297, -4617, -4375, -4924, -4480,
-    -1587, -474, -740, -2656, -4325, -4873, -4443, -4081, -4833, -5861, -6197, -6305,
-    -6312, -5420, -3978, -4778, -7499, -7512, -4796, -4082, -5339, -6094, -7153, -8265,
-    -9479, -11359, -12145, -12164, -12082, -11985, -10750, -10438, -9356, -10494, -10557, -7928,
-    -4449, -2558, -2398, -2398, -3212, -2491, -2249, -1372, -588, -1514, -675, -1024,
-    -1635, -1388, -1604, -3799, -4861, -3371, -1969, -777, -803, -1889, -3254, -4236,
-    -5432, -4552, -4830, -3045, -2098, -2069, -905, -51, -778, -3288, -1782, 244,
-    1283, 1481, 1051, -661, 129, 1700, 2631, 2698, 2728, 4599, 3812, 4775,
-    5695, 6436, 5406, 2635, 2909, 3540, 3355, 2426, 2642, 2558, 3654, 2811,
-    2734, 3012, 4628, 4902, 4617, 4243, 4983, 5454, 4121, 4481, 4351, 4330,
-    4850, 5457, 5398, 5907, 6118, 4260, 6103, 6896, 7410, 7507, 7697, 6677,
-    6772, 6385, 5521, 5476, 5980, 7739, 7774, 7722, 7044, 6605, 5349, 5297,
-    6371, 7947, 8446, 7683, 6871, 7141, 7271, 6400, 5750, 5486, 4946, 5227,
-    4702, 4628, 4968, 4376, 3204, 3703, 4381, 6526, 7194, 6471, 5112, 5722,
-    5482, 3691, 3195, 3496, 4716, 5447, 6426, 7850, 6761, 5718, 5590, 4093,
-    4051, 4490, 2164, -645, -1111, 216, -558, -1991, -3242, -4944, -5849, -5988,
-    -4981, -4973, -5922, -6426, -6788, -6522, -4437, -4176, -5631, -6206, -4716, -3429,
-    -3226, -3783, -4170, -4888, -5221, -4149, -3544, -4370, -5774, -7104, -7816, -7422,
-    -5926, -7023, -8366, -8110, -7233, -6571, -6252, -5910, -6306, -6266, -5446, -4968,
-    -5589, -6345, -8251, -8946, -8895, -6616, -5521, -6325, -6559, -6537, -5818, -5781,
-    -6752, -8241, -9894, -9586, -8344, -7994, -8477, -9864, -10288, -10846, -9800, -7631,
-    -9215, -9590, -9511, -8769, -6802, -4994, -4991, -6512, -6647, -6167, -3830, -2069,
-    -1619, -2436, -2627, -3006, -876, 43, -237, -255, -938, -1179, -898, -56,
-    -290, -1537, -1949, -1184, 260, -583, -676, -1010, -2104, -839, 979, 577,
-    433, 1195, 1979, 2539, 4358, 4634, 2803, 2021, 2965, 6002, 7274, 7310,
-    7364, 6461, 5926, 7668, 9487, 9732, 9222, 9446, 8029, 8456, 10089, 9125,
-    5215, 3711, 5012, 7173, 7931, 8784, 8336, 6696, 5944, 7818, 9329, 8564,
-    8525, 8196, 7499, 8835, 10984, 9731, 6856, 6712, 7836, 9075, 9528, 10810,
-    10059, 8829, 8379, 8999, 9163, 8483, 9691, 8199, 6771, 8280, 9122, 6773,
-    5995, 7021, 6746, 6268, 6099, 6065, 4881, 3000, 2214, 2764, 3474, 3802,
-    3558, 1186, 1420, 3949, 3384, 2021, 2426, 2363, 3461, 3316, 3241, 3135,
-    1688, 365, -645, 2010, 3331, 3677, 1940, -265, 24, -870, -3012, -5134,
-    -5831, -5833, -5266, -5514, -4946, -4615, -5714, -7149, -6641, -4628, -3162, -2615,
-    -2887, -2981, -2289, -2832, -4161, -5085, -6127, -5468, -5328, -5889, -3673, -3517,
-    -4796, -7130, -6545, -5287, -5672, -6545, -8054, -7714, -7045, -7803, -8443, -9194,
-    -9480, -9457, -11097, -11833, -10070, -11724, -13686, -13434, -11339, -9546, -11436, -12021,
-    -12023, -9648, -7931, -8602, -9641, -10202, -9068, -7246, -8200, -6429, -7691, -10229,
-    -11356, -9048, -5095, -5398, -5874, -6774, -7536, -6083, -6330, -7063, -7740, -7712,
-    -6466, -6113, -6668, -5050, -5773, -6866, -6308, -4267, -2377, -2265, -1158, -1444,
-    -53, 2254, 1810, 2505, 3275, 2995, 4720, 4701, 6655, 7936, 7599, 6130,
-    6080, 7180, 8659, 9429, 9029, 7286, 8102, 7821, 6312, 6909, 6494, 5770,
-    5890, 5003, 5856, 6276, 5184, 5264, 6057, 6803, 7552, 7191, 6154, 5733,
-    8084, 7774, 7341, 7279, 5951, 6302, 5959, 6873, 8466, 7307, 5957, 6397,
-    6826, 7831, 8060, 8392, 6464, 5740, 6159, 5726, 5426, 4553, 4526, 4516,
-    3867, 4094, 4947, 5414, 5106, 4928, 5824, 6714, 5657, 4834, 3397, 5289,
-    5356, 4651, 4470, 4660, 4930, 5629, 5847, 6298, 6901, 5876, 5346, 4920,
-    5624, 6625, 5909, 4735, 4624, 5669, 4874, 3554, 3034, 4147, 3966, 3781,
-    2814, 4001, 4170, 3734, 3686, 4083, 4483, 3381, 3329, 2396, 2415, 1576,
-    936, 438, 1581, 1476, 1661, 1035, 327, 1534, 1700, 2129, 1425, 931,
-    462, 1551, 2796, 1802, 1694, -80, -1669, -1765, -25, 764, 578, -1606,
-    -2942, -2580, -2697, -3101, -3492, -3520, -4118, -3725, -4101, -4305, -4375, -6670,
-    -8178, -8605, -8401, -8308, -7860, -9333, -9595, -8233, -8090, -8370, -8400, -8338,
-    -6593, -6614, -7619, -6417, -5922, -7651, -7803, -6789, -5465, -5915, -7657, -9920,
-    -8784, -8363, -7302, -7124, -6983, -7333, -5802, -5959, -5741, -5430, -7488, -8054,
-    -6448, -4491, -3552, -4562, -6885, -8721, -7695, -5675, -4795, -7095, -8148, -8107,
-    -6882, -7473, -7893, -8725, -12083, -12815, -11446, -8889, -8389, -10735, -12503, -12935,
-    -12186, -10946, -9750, -9410, -9122, -7681, -6815, -5713, -5358, -6369, -7878, -7021,
-    -6417, -3516, -3719, -3788, -4306, -4393, -2792, -1501, -1403, -1578, -1221, -1906,
-    -2343, -1569, -1618, -3306, -4098, -3629, -2132, -1950, -3032, -3005, -3401, -2227,
-    201, 1970, 2045, 1836, 1369, 2145, 4463, 4104, 4020, 3677, 4096, 5447,
-    7760, 7038, 5598, 4451, 4778, 5716, 7845, 8521, 7631, 6600, 4876, 6627,
-    7722, 7182, 6576, 5127, 5908, 8311, 9821, 8625, 8245, 7723, 6348, 6766,
-    9728, 10278, 10025, 9544, 9544, 11545, 10769, 10048, 10084, 8465, 7998, 9975,
-    10324, 9364, 9778, 9622, 8925, 10133, 10814, 10918, 10926, 9452, 9634, 10620,
-    9480, 9717, 9780, 8134, 8879, 9867, 7520, 6664, 6923, 6278, 6060, 8110,
-    8792, 8378, 7054, 6676, 8689, 7765, 5758, 7662, 7225, 6570, 7707, 7439,
-    6207, 5212, 5789, 6759, 7620, 9035, 8667, 7940, 5117, 4941, 6732, 5660,
-    3657, 3527, 2766, 3450, 3212, 2507, 1829, 1072, 608, 542, 1925, 3445,
-    3383, 3390, 2131, 3176, 4460, 3615, 2024, 1720, 1057, 599, 579, -337,
-    -1115, -2007, -3375, -3788, -3720, -3479, -3794, -4908, -5314, -4344, -5051, -6861,
-    -7011, -6037, -6342, -6669, -7378, -8761, -8171, -8366, -7363, -7212, -8664, -8213,
-    -7906, -7577, -6262, -5081, -6773, -8520, -7968, -7112, -6800, -7371, -8356, -8756,
-    -9602, -9689, -7626, -8416, -9316, -9573, -11203, -12054, -10764, -10055, -11281, -11303,
-    -10813, -10976, -11394, -11873, -11235, -10942, -11934, -10122, -9560, -9604, -7720, -7027,
-    -7111, -5458, -4746, -4566, -3318, -3133, -2999, -2850, -3010, -3520, -3362, -2905,
-    -1569, 386, -1450, -2296, -1730, -2752, -2492, -1754, -2564, -3615, -4093, -4176,
-    -3783, -4763, -5900, -5796, -6703, -7070, -4313, -2638, -4481, -4346, -4392, -4499,
-    -2102, -783, -314, -1053, -1603, -1021, -1009, -1566, -1556, -1933, -2729, -1895,
-    -705, -1908, -2651, -2314, -4284, -3671, -2932, -3255, -2979, -2758, -2314, -2628,
-    -2931, -3657, -3840, -3455, -2276, -617, -319, -1332, -902, -1449, -168, 2106,
-    2380, 1563, 2404, 3843, 4060, 4754, 3629, 3256, 2635, 2651, 4666, 6854,
-    5950, 5075, 3593, 3446, 4796, 5490, 5323, 4499, 4757, 5718, 6089, 6165,
-    4073, 3528, 3232, 3453, 6415, 7686, 6401, 4891, 4368, 5540, 7622, 7104,
-    6674, 6044, 6538, 6890, 8831, 7553, 5155, 3827, 3685, 5969, 7959, 9019,
-    7251, 5207, 5298, 6838, 7750, 6851, 7157, 7537, 7536, 8343, 9924, 7923,
-    6354, 4947, 5182, 5830, 7807, 6826, 4308, 2605, 3451, 4290, 3171, 3780,
-    4005, 4752, 3886, 4907, 3421, 597, -400, -311, 978, 2479, 3731, 2277,
-    721, 563, 1108, 560, 1066, 2557, 3190, 3241, 3344, 4391, 3348, 1984,
-    1722, 3565, 3708, 4854, 5179, 3720, 3149, 2397, 2491, 870, 1702, 3608,
-    5066, 3505, 2508, 1094, -872, -3182, -2111, -1275, -1868, -2557, -2446, -3910,
-    -4282, -5353, -7048, -8215, -8032, -6547, -5442, -6434, -7051, -8580, -9482, -11110,
-    -9336, -9510, -9319, -8591, -8676, -7431, -7092, -7635, -8494, -7774, -5878, -3680,
-    -3268, -3770, -4635, -5319, -7556, -7010, -5297, -4805, -5267, -4439, -3804, -4165,
-    -5731, -8238, -7677, -6184, -4440, -5042, -6661, -7778, -6479, -6587, -7101, -6178,
-    -6688, -7606, -5896, -3905, -3356, -2367, -4588, -6042, -4580, -1227, 2264, 2330,
-    564, -1000, -1215, -1805, -333, -807, -1935, -2691, -2362, -2611, -2372, -3817,
-    -6718, -6555, -4582, -3743, -2471, -2447, -3038, -3715, -4388, -3261, -2898, -2991,
-    -2898, -1024, -747, 222, 1067, -518, -1745, 146, 3704, 6233, 5425, 3907,
-    2966, 3471, 2826, 3573, 2939, 2576, 2347, 3552, 4156, 4350, 2750, 112,
-    -632, 2344, 4707, 4174, 1910, 665, 879, 2224, 3295, 3734, 2026, 757,
-    1346, 3792, 5450, 5296, 4179, 1552, 2309, 4991, 7181, 7346, 6134, 4182,
-    5008, 5017, 5619, 5732, 4779, 3685, 3959, 6216, 6697, 6204, 4475, 3688,
-    4857, 5992, 5156, 5947, 4932, 5194, 4984, 4080, 4656, 4686, 3279, 2036,
-    3589, 5703, 5336, 4693, 3741, 3460, 5226, 7363, 7320, 6630, 4739, 6665,
-    5467, 3298, 3636, 3087, 2462, 2688, 5073, 5023, 2341, 988, 949, 2178,
-    3155, 3309, 1860, -367, 214, 2180, 1666, 2575, 3131, 1491, 278, 2646,
-    4997, 5251, 3413, 2093, 2341, 3600, 4492, 5074, 3155, 1805, 3043, 2508,
-    664, 278, 120, -1665, -2247, -1731, -875, -2124, -3504, -3409, -2141, -2529,
-    -3851, -3916, -4742, -3273, -2504, -3275, -3401, -3154, -3269, -3170, -1275, 234,
-    -56, -1380, -989, 816, 2490, 2348, 2478, 1545, 1398, 3284, 3365, 1155,
-    -800, -946, -37, 658, 874, 1160, -62, -2007, -1728, 738, 1289, -1011,
-    -2541, -3844, -2910, -2022, -1520, -2410, -4457, -4859, -3780, -3122, -2459, -1894,
-    -3704, -5670, -4728, -2590, -2530, -3548, -4189, -3984, -3915, -4107, -3990, -6174,
-    -8058, -7807, -6611, -7191, -7391, -8244, -11168, -11493, -9221, -8092, -10533, -12984,
-    -12490, -10488, -10654, -10034, -10620, -12257, -12934, -9910, -8238, -7505, -7421, -10096,
-    -10247, -8793, -5293, -4731, -6350, -6915, -5082, -3908, -3349, -3973, -6223, -8115,
-    -7189, -4783, -3698, -2645, -5171, -7739, -7493, -5445, -3415, -4696, -6435, -6544,
-    -6221, -6063, -4852, -4195, -6013, -6377, -4263, -2401, -1011, -1411, -3575, -4906,
-    -4349, -2120, -356, 32, -761, -1180, -1345, -1712, -494, -2040, -2972, -1551,
-    -152, 1053, 2506, 572, -1220, -1210, 829, 2773, 3407, 3818, 2873, 3042,
-    2449, 2752, 3159, 1425, 1703, 2083, 2156, 2699, 2300, -89, -1141, -846,
-    -108, 1238, 2910, 2596, 939, 1776, 1932, 1269, 227, 449, 2228, 3009,
-    2456, 4188, 3585, 3245, 3275, 4493, 4794, 6585, 7256, 6644, 5214, 5825,
-    7129, 7851, 8222, 8368, 9612, 9849, 10978, 11033, 10191, 9111, 8563, 8805,
-    9423, 11397, 12275, 10768, 8797, 7611, 7319, 6200, 7487, 7900, 6392, 5201,
-    6295, 6336, 5091, 2600, 1278, 747, 1327, 3923, 4015, 2766, 564, 17,
-    -1382, -696, 1145, 1726, 1461, 1506, 2067, 1980, 2566, 2158, 1744, 1245,
-    4238, 6486, 6580, 5378, 5175, 4728, 3831, 4698, 5523, 3801, 3274, 3103,
-    3055, 2883, 3003, 2863, 1015, 2078, 4329, 3894, 2148, -76, 433, 792,
-    1882, 3464, 3490, 3373, 3133, 2832, 2438, 4019, 3554, 2805, 2327, 5475,
-    7140, 8213, 5991, 2976, 2204, 2608, 3953, 3998, 2264, 1542, 1611, 637,
-    -238, -981, -3408, -4238, -4336, -2337, -1432, -1335, -2590, -4105, -3531, -3764,
-    -3121, -2272, -731, -230, 366, 399, 2183, 896, -1283, -1144, 1867, 3343,
-    3059, 1935, 1110, 1473, 2074, 1252, -811, -1430, -2273, -2391, -1971, -1387,
-    -669, -1019, -2691, -2599, -1657, -1451, -1162, -2764, -3998, -2905, -1444, -2148,
-    -1811, -2002, -2425, -2573, -2314, -1486, -1018, -1494, -1343, -272, 239, -88,
-    106, -1350, -1601, -1109, -1134, -1525, -1035, -542, -133, 274, -102, -953,
-    -1967, -1852, -1846, -367, 187, 465, -323, -1881, -2143, -2094, -3662, -4927,
-    -4877, -3786, -2262, -938, -2249, -3335, -4882, -5418, -3557, -1531, -1256, -1964,
-    -1874, -1882, -1978, -1530, -1727, -2883, -3891, -4492, -3543, -3018, -3552, -2375,
-    -2544, -4080, -3591, -3836, -3185, -3895, -3061, -4172, -3281, -2353, -3554, -4208,
-    -1638, -1002, -650, -1411, -1763, -691, -957, -1504, -1151, -997, -1994, -2228,
-    -1697, -2143, -2472, -2336, -4710, -4016, -3233, -3448, -2316, -3018, -4577, -4770,
-    -5936, -6033, -4789, -3300, -3935, -2858, -2172, -3481, -3179, -2827, -4759, -2530,
-    -1099, -349, 705, 418, 221, -483, -338, 718, 1613, 1646, 1976, 2835,
-    1517, 284, 1931, 2004, 1211, 2283, 926, -177, 1624, 3476, 3234, 3913,
-    3345, 2622, 3299, 3167, 4302, 3955, 3139, 2044, 729, 924, 3740, 4510,
-    2918, 1783, 1970, 2404, 2353, 3075, 2259, 2034, 2020, 3337, 3693, 3389,
-    1433, 540, 206, 965, 1745, 1122, 580, 1107, 1394, 339, -1518, -3246,
-    -3972, -3919, -2714, -1375, -1175, -3070, -3588, -4847, -4444, -2219, -905, -1032,
-    -1033, 692, 2153, 1946, 2233, 1641, 80, 1318, 4151, 5509, 4124, 3874,
-    4503, 4126, 3883, 4125, 3330, 1664, 1622, 2489, 3347, 4007, 3806, 1022,
-    867, 1112, 1997, 2094, 2664, 2338, 1031, 754, 2396, 3865, 1964, 1062,
-    2092, 3126, 4271, 4024, 2305, 2401, 3474, 4029, 4791, 3826, 2468, 1954,
-    2793, 2888, 4730, 5038, 4404, 5440, 5800, 5828, 5578, 2840, 2049, 2550,
-    4286, 4609, 5987, 5767, 2829, 1251, 31, 295, 1959, 878, 123, 751,
-    -573, -15, -995, -1556, -1128, -76, -523, -98, 1463, 1409, 738, 450,
-    -513, -346, -413, 487, 363, 325, 1561, 1644, 2128, 1393, 2328, 2762,
-    1617, 3446, 3994, 2998, 2128, 2545, 3898, 4368, 3714, 2518, 2023, 3300,
-    3908, 3110, 1847, 1708, 2765, 611, 577, 1533, 783, -745, -3096, -3062,
-    -2264, -561, -681, -2337, -3077, -4130, -4902, -6434, -8059, -5923, -6841, -7785,
-    -5941, -4341, -5003, -5911, -7105, -8229, -6961, -4231, -4426, -2976, -3446, -4285,
-    -3433, -4706, -3034, -2284, -3855, -3821, -3163, -3224, -3257, -3114, -5064, -5737,
-    -4299, -4119, -4537, -3920, -4646, -3962, -4320, -3527, -1108, -2038, -2188, -1049,
-    -1667, -2449, -1900, -2118, -2063, -1175, -1008, -1557, -987, -1544, -1702, -2273,
-    -2426, 481, 456, -59, 803, 1144, -379, -697, -1881, -4154, -2856, -706,
-    -900, -1291, -1114, -1592, -2129, -5455, -4794, -3988, -4594, -4035, -2700, -2769,
-    -2957, -3032, -4135, -4490, -2537, -2146, -1505, -328, 393, 1209, 325, 574,
-    2201, 1662, 1682, 3206, 4113, 3294, 2693, 4213, 3812, 3435, 3037, 2048,
-    785, 1058, 1457, 357, -113, 2179, 2453, 1632, 1023, 862, 555, -1019,
-    -677, 1220, 2459, 2952, 2006, 307, 1334, 2953, 1874, 872, 2362, 3238,
-    3451, 3977, 3707, 4437, 3747, 1586, 1472, 1638, 3843, 4500, 3593, 3510,
-    6187, 6071, 4953, 4001, 3000, 2645, 2906, 2741, 2287, 3860, 2717, 2033,
-    2357, 2784, 1897, 490, -436, 2197, 3924, 3527, 2473, 2099, 2818, 2991,
-    3043, 2777, 3397, 2772, 1716, 3176, 5417, 4707, 2431, -1035, -306, 772,
-    2408, 3053, 3055, 3709, 4483, 4361, 2394, 1162, 1629, 2117, 2074, 4391,
-    6276, 6339, 3252, 1770, 1848, 2439, 3422, 2834, 2313, 3043, 4018, 3202,
-    1336, 817, 1491, 2082, 1482, 1639, 3108, 2445, 799, 1182, 1805, 2610,
-    2358, 505, -961, 563, -217, -1586, -2321, -1972, -240, 1368, 1277, 1021,
-    510, -1032, -1781, -706, 1155, 2921, 2613, 1403, 2102, 2358, 515, 857,
-    334, 414, 619, 2279, 3339, 2110, 774, -385, -1848, -1603, 260, 784,
-    933, 2558, 4014, 440, -1937, -2049, -701, -364, 1155, 2907, 2487, 242,
-    393, -930, -758, 289, 332, -985, -850, 1258, 1567, -9, -1875, -2278,
-    -1890, -1240, -242, -790, -3439, -4289, -4225, -4925, -3973, -2741, -3718, -5622,
-    -6048, -5705, -7593, -9193, -9690, -9061, -7741, -5765, -4521, -5156, -7355, -6795,
-    -7794, -6797, -4569, -3127, -3301, -2376, -1382, -1934, -2853, -3017, -2839, -2930,
-    -1651, 206, 618, -2106, -2601, -4451, -6512, -5595, -4496, -5200, -3456, -1166,
-    -2448, -4296, -5822, -5457, -5254, -5001, -2969, -264, -826, -1969, -3244, -4971,
-    -3426, -786, -2466, -3024, -1359, -2422, -3194, -3909, -3152, -2495, -2599, -2012,
-    -676, -1058, -2289, -2275, -3007, -2467, 495, 1355, 337, 1652, 46, -2804,
-    -3004, -3452, -1910, -1294, -842, -433, -1186, -2769, -3492, -4435, -5746, -4669,
-    -3334, -4125, -3153, -1949, -3910, -4798, -5132, -3594, -1922, -1123, -1292, -1401,
-    -1802, -1400, -1924, -2561, -2965, -1648, -958, -904, 2089, 2626, 1139, -674,
-    -14, 1262, 1814, 1187, 1465, 2190, 3160, 2085, 1306, 594, 1552, 2966,
-    2085, 2135, 2422, 1784, 1060, 1088, 1870, 2557, 2951, 2624, 1630, 1757,
-    1768, 103, 580, 473, 1113, 1397, 1408, 333, -1818, -3433, -2964, -3380,
-    -2628, -1480, -648, -686, -1487, -1221, -2728, -2151, -1764, -1154, 366, 1737,
-    3305, 2621, 1766, 1082, 1933, 619, 2363, 3830, 2759, 1376, 1618, -84,
-    -1509, -1424, -312, 243, 1140, 2997, 2592, 1628, 1527, 2133, 1079, 873,
-    1651, 1691, 2268, 4116, 4066, 2188, 1224, 1853, 2369, 3160, 5405, 4937,
-    3304, 2826, 3831, 5209, 4192, 4639, 5392, 4640, 3964, 3969, 2497, 1207,
-    1666, 2550, 2013, 3487, 4618, 2795, 483, 560, 1795, 915, 182, 551,
-    756, 378, 2071, 2042, 483, 1167, 2779, 1926, 2894, 5716, 5744, 4334,
-    3331, 5328, 6925, 7211, 6969, 6295, 5586, 6938, 8755, 6804, 4380, 4019,
-    4262, 2757, 3794, 4873, 3567, 2062, 1961, 3330, 2998, 2512, 407, -837,
-    280, 5093, 4542, 1601, 890, 1873, 811, 2304, 4398, 4725, 1569, 1681,
-    2307, 2803, 3674, 3299, 1905, 1211, 3027, 5535, 4614, 3618, 3848, 3504,
-    3864, 5557, 6467, 4626, 3257, 3740, 2069, 2244, 2777, 444, -505, -295,
-    2339, 2800, 1671, 2231, 1866, 694, 659, 1768, 1941, 635, 532, 1221,
-    1660, 3579, 2808, 271, -1152, -12, 781, -801, -742, -951, -1537, -1062,
-    -237, 513, 41, 467, 1649, 1326, 1120, 619, -687, -2216, -1134, 1345,
-    239, -1753, -1398, -1509, -1271, -847, -620, -1077, -2537, -2425, -2343, -2290,
-    -2000, -1108, -2433, -3620, -1884, -1587, -2633, -2059, -2829, -4415, -3083, -2369,
-    -2955, -2984, -2690, -2978, -3594, -3923, -3936, -4067, -6035, -4013, -2296, -2862,
-    -3513, -3053, -2055, -1711, -1300, -2170, -2918, -2688, -1023, -1679, -881, -544,
-    -1178, -2569, -3104, -1535, -766, -1972, -3244, -4308, -2225, -1231, -971, -1992,
-    -2546, -1831, -1338, -1093, -1776, -2694, -3901, -3974, -2756, -916, -933, -1735,
-    -2389, -1198, -257, -499, -1792, -2011, -2019, -1169, -1300, -2348, -2857, -3452,
-    -2471, -3123, -3866, -3433, -4088, -5277, -5738, -5477, -5035, -5747, -7145, -7413,
-    -6490, -5090, -5814, -7724, -9607, -9944, -8687, -9277, -6117, -5564, -7768, -8188,
-    -5573, -4239, -2674, -3203, -3670, -2741, -2066, 607, 937, 1028, -434, 191,
-    -912, -817, 1341, 909, -2239, -2785, -3215, -2162, -2405, -3968, -2645, -1141,
-    -1282, -1667, -3687, -5219, -3610, -3072, -3782, -2409, -1392, -2553, -2793, -650,
-    -511, -1748, -2756, -2404, -272, 905, 2337, 1058, -599, -1863, -683, -972,
-    1141, 2779, 2921, 936, 893, 2744, 3245, 2151, 1758, 1385, 1513, 3347,
-    3423, 1478, 322, -1317, -3196, -3387, -1995, -84, -1154, -2967, -2562, -785,
-    -554, -935, -824, -606, 936, 3166, 2184, 1385, 892, 182, 177, 1141,
-    2050, 2212, 478, 258, 1571, 1939, 2397, 1713, 2427, 3993, 5920, 5067,
-    2539, 2941, 2394, 1238, 1778, 2303, 2764, 2750, 3258, 4883, 4706, 4279,
-    4999, 4297, 4403, 5184, 7268, 6260, 5835, 4301, 2091, 2565, 3628, 4768,
-    4305, 2805, 2472, 2574, 1563, 2098, 1196, -498, 786, 1769, 1683, 1635,
-    2338, -74, -1220, -1058, 56, 1121, 1667, 1161, 1464, 682, 696, 2388,
-    1889, 1973, 2729, 2943, 2420, 2770, 372, -1038, 601, 834, 259, 183,
-    19, 574, 12, -250, 830, 831, 1286, 2096, 3089, 2365, 2626, 2256,
-    147, 102, 1853, 2281, 2399, 2829, 3574, 4793, 4267, 5252, 4308, 3709,
-    3608, 3261, 3643, 4956, 5382, 2852, 545, 780, 2219, 400, -192, 317,
-    1939, 1161, 1474, 2506, 506, 855, 909, 1803, -143, 1287, 536, -1011,
-    -580, -839, -1682, -2405, -1415, 127, 35, 301, 1586, 1303, 3264, 4590,
-    5179, 4721, 5367, 5195, 2846, 2833, 3861, 4622, 3243, 2024, 1955, 1847,
-    661, 735, -614, -914, -664, -535, 347, -314, -193, -1416, -5227, -4159,
-    -1971, -1975, -1207, -546, -1899, -1507, -334, 59, -1317, -707, -181, 685,
-    107, 1335, 2535, 659, 443, 2449, 1240, 256, 1296, 2169, 2057, 3774,
-    4135, 1711, 1330, 1792, 2312, 1682, 490, 459, -853, -1693, 501, 272,
-    -1731, -954, -361, -1891, -2258, -842, -2120, -2526, -290, 302, 285, 49,
-    1130, 549, -1518, -2331, -1276, -1650, -939, -534, -1694, -3747, -1670, -878,
-    -3389, -1995, -1933, -1443, -1545, -1023, -248, -2400, -4792, -4366, -3872, -4405,
-    -833, -486, -3873, -4002, -1218, -3172, -2113, -554, -1080, -752, -1164, -232,
-    -1277, -1297, -316, 53, -1564, -1128, 146, -1896, -2773, 451, -813, -2772,
-    -1524, -2426, -999, -861, -192, -812, -2962, -3346, -1174, -2205, -1631, 439,
-    324, -3426, -3234, -2858, -4437, -2889, -1576, -964, -1479, -1058, 773, 30,
-    -1506, 34, -1450, -3357, -1163, 311, -2004, -2936, 58, -1484, -1392, -813,
-    -367, 263, -1109, -1015, -968, -2370, -1691, -389, -3786, -3356, 26, 1428,
-    -857, -134, -594, -1083, 543, 1234, 1298, 1726, 566, -358, -1446, -2489,
-    688, 100, -1720, -1992, -692, -2385, -2504, -2686, -4503, -3711, -3304, -3410,
-    -1690, -1679, -2948, -3194, -5707, -4768, -4247, -5096, -3968, -1043, 772, -496,
-    -1703, -3536, -2359, -536, 314, 561, 3475, 5457, 4534, 3100, 2305, 3375,
-    2335, 616, -342, 1696, 1632, 1413, -392, -2295, -1775, -1121, -1904, -1080,
-    -442, -1373, -2208, -3980, -2714, -1283, -2749, -2934, -1249, 420, 1157, 349,
-    -1156, -353, 650, 169, -468, 299, 1213, 798, -198, 542, 2704, 2951,
-    2240, 2209, 3243, 3681, 3329, 1340, 542, 2409, 3785, 3653, 3946, 3260,
-    2543, 1979, 655, 696, 1626, -237, -564, 919, 2605, 2677, 976, -2060,
-    -1847, -338, 546, 1997, 1318, 1698, 1821, 1647, 1633, 2686, 1278, -231,
-    -16, 2423, 4867, 4994, 3721, 2019, 2890, 2177, 2780, 2986, 2843, 3132,
-    2579, 1362, 457, -375, -1459, -1511, -375, 2587, 4429, 3519, 348, 1240,
-    2391, 3762, 5157, 3729, 2819, 2962, 3836, 5091, 4981, 2507, 1709, 2293,
-    3389, 4647, 3315, 245, -516, 531, 459, 1613, 1163, -666, -89, -75,
-    -778, 170, -813, -1741, -1409, 20, 2396, 2422, 707, -2626, -1820, -631,
-    440, 1228, -1250, -1569, 207, 336, 1651, 1524, -612, -1664, -1092, 717,
-    1397, 2027, 3, -1136, 905, 722, 1474, 611, -1199, -983, -1397, -155,
-    1686, 179, -1582, -1742, 524, 2272, 3811, 4101, 531, -511, 2041, 3090,
-    2948, -185, -219, -755, -1013, 587, 870, -678, -2304, 366, 2418, 565,
-    190, -40, -2323, -1638, -395, -565, -2622, -2579, -1318, -2753, -2452, -1760,
-    -1555, -3105, -3094, 214, 1085, 460, 1175, 306, -994, 2476, 4739, 2574,
-    919, 2176, 2263, 2516, 3985, 4368, 2341, 218, 535, 297, -1850, -1141,
-    110, -918, -659, 1412, -815, -4336, -4902, -4020, -6271, -5710, -3278, -3451,
-    -3846, -2800, -1627, -2561, -3677, -2532, -2144, -2632, 429, 2707, -54, -1696,
-    -537, 25, -1063, 1386, 2845, 2643, 2542, 3637, 4197, 1965, 1693, 2333,
-    2062, 2252, 3443, 3254, 1301, 189, 1484, -338, -351, 2116, 1680, -53,
-    60, 1422, 818, 936, 446, -810, -343, 216, 1768, 638, -878, -1368,
-    -1260, -1250, 771, 1141, 228, -1291, -1748, -3025, -2752, -1261, -847, 17,
-    1073, 1793, 112, -2709, -3384, -4197, -4032, -3662, -2581, -2569, -3614, -3516,
-    -2399, -2779, -3072, -2349, -2269, -1562, -344, 1322, -207, -693, -601, -793,
-    -616, 997, 1582, 1641, 1416, 1522, 1422, 912, 400, 243, 1416, 2240,
-    1918, 952, 803, 1582, 1386, -137, -169, 339, -393, 1782, 612, -262,
-    -897, -778, 379, -2074, -952, 244, -296, -2383, -2942, -1457, -1822, -1863,
-    530, -59, 388, -21, -2337, -2895, -3664, -1518, -1024, -1246, 1328, 1965,
-    1263, -508, -1094, -1181, -2716, -1526, -615, -1019, 1081, 56, -1035, -1356,
-    -929, 1056, -350, 520, 1553, 1816, 1181, 1075, 414, -1581, -3383, -1538,
-    -1245, 587, 2160, 103, -3189, -3359, -960, -571, -1482, -828, -1114, -1905,
-    -2143, -1040, -1736, -2625, -2543, -2614, -3578, -1964, -315, -1404, -1125, 488,
-    1568, 1406, 1207, 2651, 3456, 2265, 3831, 3083, 1764, 2607, 3889, 3703,
-    3551, 2565, 85, -2446, -2001, -1895, -1843, -3157, -1916, -796, -1523, -1072,
-    -876, -4072, -4920, -3762, -3345, -3457, -2944, -1831, -1253, -2158, -2196, -1861,
-    -2715, -1854, 465, 1002, 1010, 2349, 1802, 252, -23, 578, 953, 2316,
-    3260, 4129, 3560, 3348, 3498, 1658, 803, 1590, 2057, 2118, 2576, 3658,
-    1450, 521, 2124, 1553, 314, -610, -724, 552, 86, 1673, 1358, 196,
-    0, 457, 928, 555, 1282, 138, -1456, 141, 1650, 2755, 2949, 1428,
-    712, -29, 853, 1574, -389, -266, 401, 2181, 1662, 546, 370, -1193,
-    -2181, -2392, -2284, -1509, -2184, -2264, -2405, -1355, 391, -658, -1128, -466,
-    1248, 3059, 2805, 3024, 2815, 1108, 1346, 2866, 3331, 2643, 2108, 2233,
-    3723, 5213, 3257, 88, -101, 1543, 3110, 2307, 1228, 2101, 1285, 152,
-    1303, 1996, 1544, -95, -1690, -1757, 325, 1629, -748, -2262, -704, 477,
-    485, -818, -1266, -2201, -3816, -3077, -1409, 58, 1306, -9, -2342, -3227,
-    -1652, -977, -4075, -3666, -1059, -501, -921, -1204, -549, -1295, -684, 543,
-    -13, 1632, 2399, -1, -1127, -247, 1718, -500, -1685, 1062, 1261, 653,
-    290, -1039, -2388, -2884, -162, -215, -202, 1143, 272, -1540, -1595, 700,
-    298, -2104, -376, 2171, 852, 544, 831, -53, -1635, -1628, 437, 173,
-    1390, 2357, 1072, -297, -31, 1746, 1330, 1892, 4082, 4598, 3259, 4063,
-    4284, 2780, 445, 1657, 2070, 1763, 4060, 4687, 979, -2978, -3807, -3777,
-    -3771, -3804, -2098, -4026, -4961, -4347, -4274, -5072, -5011, -3427, -3838, -4051,
-    -1371, -1383, -3275, -4490, -3259, -2231, -2281, -180, 869, -198, 677, 437,
-    -465, -1563, 1005, 2917, 2422, 3074, 3860, 1609, -855, -355, 1983, 1858,
-    2976, 4582, 1874, -117, 731, 1524, 1484, 922, 1762, 1797, 2833, 3765,
-    4455, 3049, 253, 387, 314, 866, 3518, 4264, 1474, 997, 1941, 1256,
-    -296, 240, 477, 1509, 2416, 2895, 2346, -1544, -2209, -2186, -1559, -783,
-    8, -1764, -4215, -3508, -3720, -3926, -4598, -4943, -4952, -4051, -3086, -2208,
-    -4134, -5482, -5195, -4915, -3143, -987, -585, -1125, 161, 235, -1261, -508,
-    1088, 1502, 1668, 2122, 2727, 1264, 43, -1183, -840, 750, 2718, 3322,
-    1073, 227, -736, -1335, 580, 1849, 2461, 1585, 1839, 1352, 742, 1421,
-    642, -1767, -1970, -665, 425, 965, 2066, 2280, 841, -638, -251, 20,
-    90, 684, 2491, 1012, 394, 197, -1176, -1938, -208, 1236, -55, -1162,
-    -831, -981, -1294, -737, -291, -867, -573, 1753, 1973, 870, 257, -234,
-    -2153, -2550, -1246, -638, -515, -1003, -773, -2199, -3855, -3573, -2409, -3040,
-    -2879, -1515, -1614, -2859, -2705, -2948, -3315, -3350, -1634, 738, 574, 760,
-    362, -1234, -1607, -346, 629, 625, 1700, 1546, -156, 33, 1462, 1986,
-    1145, 1101, 3072, 3693, 4868, 5729, 4286, 3543, 3107, 3471, 2916, 2582,
-    3766, 4122, 878, -931, -529, -700, -2581, -1029, -1009, -2637, -2662, -2916,
-    -3306, -3964, -4138, -2837, -3771, -3895, -1747, -666, -2522, -1412, -734, -2547,
-    -2080, -477, 446, 745, 899, 2004, 875, -679, 1006, 2291, -97, 370,
-    3485, 2033, -613, 268, 602, -1157, -1160, 1362, 2371, 1878, 2681, 2362,
-    78, -568, 1860, 2008, 668, 1364, 3533, 2641, 2253, 2773, 2085, 1382,
-    1673, 2894, 2868, 3667, 4445, 3282, 1768, 1900, 3422, 1624, 1686, 3495,
-    3233, -103, -460, -275, -1031, -1749, -207, 545, 251, 687, -958, -2921,
-    -4406, -3887, -4405, -4867, -3181, -1023, -945, -2239, -1866, -1032, -1246, -1398,
-    148, -111, 1451, 2695, 2321, 2080, 2246, 3612, 1281, 630, 2274, 3786,
-    2306, 1582, 3132, 1974, -513, 63, 2165, 3146, 3164, 1627, 1299, 503,
-    172, 128, -1276, -1211, -68, 939, -1416, -1693, -976, -1806, -3562, -3019,
-    -1333, 460, -178, -353, -797, -1258, 3, -564, -1176, -1165, 631, -1073,
-    -2440, -1563, -1431, -2554, -3451, -1781, 734, 1571, -14, -1052, -486, -2016,
-    -1488, -1375, -222, 47, 1899, 1733, 1372, 1568, 795, -684, -2169, -2071,
-    -198, 484, -561, -757, -1093, -1350, -1740, -3160, -3652, -2969, -1397, -788,
-    -68, -268, -1908, -2849, -2011, 278, 2594, 1850, 1413, 2170, 803, 1140,
-    1139, 1391, -372, 1212, 2310, 1791, 2518, 2352, 697, 741, 1644, 4225,
-    4342, 4083, 3080, 2421, 1490, 1321, 2155, 51, -962, 420, -1275, -2784,
-    -2292, -4235, -5337, -5116, -3253, -1136, -2420, -4152, -4362, -5067, -6711, -4998,
-    -3324, -4803, -3207, -1024, -947, -1048, -1548, -1961, -1381, -1422, 279, 1728,
-    1974, 1739, 2632, 1652, 77, 905, -197, 44, 421, 1868, 1960, 1342,
-    -716, -836, -1285, -474, 2653, 3255, 2833, 3436, 3922, 1534, 1774, 2080,
-    2655, 2594, 3243, 4081, 3583, 2167, 1240, 2319, 1757, 2522, 4067, 3106,
-    3008, 2864, 918, -150, 646, 880, 939, 818, 190, -1930, -3462, -4681,
-    -4027, -3931, -3593, -1269, -1990, -3597, -4293, -5178, -8075, -7535, -6692, -4467,
-    -4770, -2950, -2121, -2796, -3414, -3425, -664, -894, -252, 1565, 3058, 3426,
-    3626, 1959, 707, 310, 2359, 3622, 3137, 2432, 1675, 1713, 777, 1500,
-    1842, 1164, 1623, 3701, 4710, 4246, 3969, 1460, -406, -622, 1848, 1636,
-    1525, -59, -455, -394, -1600, 914, 1355, 192, 1039, 2508, 2594, 1955,
-    2067, 704, -163, 1243, 3159, 2849, 1196, -1283, -978, -1940, -1154, 34,
-    167, 479, 1525, 1899, 251, -568, -2247, -3570, -3607, -441, 773, 428,
-    -435, -210, -1273, -3434, -2140, -2525, -2964, -2160, -1084, -1513, -2740, -2831,
-    -4909, -6206, -3803, -1220, -1181, -3065, -3483, -1651, -2680, -2729, -1373, -1528,
-    -86, 2669, 4596, 3692, 3550, 2681, 1038, 375, 3295, 5235, 3621, 1691,
-    2658, 3594, 1792, 3031, 3857, 4436, 5438, 5999, 4644, 4206, 4805, 3867,
-    2511, 2711, 3895, 2782, 640, -404, 700, -1364, -3550, -3339, -2655, -921,
-    31, -774, -3264, -4188, -4887, -5467, -5329, -2803, -1561, -2504, -2645, -459,
-    404, -2435, -4131, -3678, -1826, 1362, 1106, 37, -306, -628, -1733, -2189,
-    -1827, -1100, -1813, -2841, -2602, 5, -753, -3112, -4289, -3179, -92, 2454,
-    2320, 2768, 2176, 2209, 2814, 2617, 3228, 3844, 2844, 2025, 4680, 6072,
-    4362, 2332, 1195, 3806, 6544, 4914, 3463, 3836, 2934, 2545, 3074, 3513,
-    2475, 1047, -423, 531, 1538, 269, -1296, -4043, -3964, -617, -437, -1785,
-    -1982, -3585, -4790, -5529, -5137, -5093, -4286, -3410, -2434, -588, -464, -2561,
-    -4263, -4818, -984, 1756, 1833, 1963, 2865, 2469, 2413, 1738, 2014, -51,
-    321, 1260, 3521, 3872, 2392, -261, -3167, -2840, -3, 1290, 2015, 1961,
-    602, 246, -141, 173, -1422, -3131, -2946, -2412, -242, 70, -838, -2317,
-    -3125, -1183, -738, -80, 774, 911, 1125, 1400, 931, 2373, 1912, 895,
-    326, 1619, 2888, 536, -515, -680, 394, 1239, -310, 458, 1190, 453,
-    379, -563, -1236, -1135, -387, 201, 443, 1797, 1314, -1184, -3391, -2841,
-    -1512, -1401, -2518, -279, -758, -1653, -1883, -2860, -3928, -4075, -4226, -3343,
-    -1958, -755, -1387, -2376, -2939, -1513, -1553, -900, 1953, 4517, 4102, 3734,
-    3776, 2944, 2071, 1884, 1584, 2497, 2670, 2527, 2787, 2097, 2733, 2442,
-    211, 305, 2461, 2883, 3367, 2797, 2130, 747, 987, 1003, 222, 318,
-    -480, -637, -1585, -1677, -744, -2776, -3992, -2283, -1761, -2347, -1894, -3223,
-    -3885, -4090, -2404, -1925, -1196, -2222, -2154, -930, -1592, -1002, -1361, -2826,
-    -1747, 275, 565, 870, -435, -1429, -1519, -705, -390, -253, 118, -2351,
-    -1839, -1246, 555, 685, -1730, -2294, 1775, 3888, 3979, 3108, 1779, 2158,
-    3054, 4243, 3754, 4465, 3814, 2812, 3098, 3761, 5579, 4057, 1193, 1394,
-    3841, 3910, 3933, 1982, 575, -61, 1149, 1414, 38, -671, -2481, -2101,
-    -2375, -1427, -2760, -5153, -6612, -3335, -2438, -2650, -3379, -5309, -6200, -4739,
-    -2488, -1810, -1650, -2858, -2757, -1219, 768, 399, -1810, -2494, -1310, 2182,
-    3453, 4183, 2859, -136, -82, 2138, 2413, 1423, 853, -982, -1361, -588,
-    1975, 1214, -2088, -2176, 123, 2488, 3103, 2780, -571, -3133, 151, 2745,
-    1728, 498, -697, -977, -1629, -387, 316, -1379, -2687, -210, 1232, 1956,
-    2986, 1651, -1433, -1027, 2605, 3545, 2627, 1724, 1647, 2054, 2126, 3105,
-    2033, -1797, -1740, 947, 1604, 2454, 2728, -99, -2560, -1667, 694, 565,
-    60, -1260, -1492, -880, 988, 817, -4156, -5877, -3597, -1753, -1856, 628,
-    -476, -3715, -5246, -3263, -2690, -4062, -4190, -4496, -4148, -3467, -482, -705,
-    -4112, -3333, -6, 674, 2278, 3968, 2559, 138, 1475, 4292, 4597, 3382,
-    1808, 2475, 3690, 4212, 3854, 1472, 736, 2549, 4562, 3168, 4729, 3794,
-    1579, 869, 2753, 3007, 1900, 263, -361, 1177, 1270, 737, -1505, -2911,
-    -3670, -1667, -436, -1119, -24, -1582, -2875, -1944, -2196, -1984, -869, -1983,
-    -1713, 364, 1660, -1124, -3555, -3920, -2820, -1039, 275, 1347, 1212, -1411,
-    -1366, -810, -2519, -2252, -2467, -2316, -1151, -503, -1879, -3198, -2789, -1866,
-    -333, 1342, 2014, 2442, 2258, 2431, 2589, 2474, 3343, 4858, 3601, 3645,
-    5508, 6375, 2305, 694, 2929, 3369, 2731, 3881, 3110, 1898, 555, 2024,
-    1350, 570, 175, 784, -56, -1167, -64, -1282, -4614, -3996, -1541, -2974,
-    -2197, -1863, -3673, -4379, -3302, -2397, -4002, -3144, -1520, 13, -945, -400,
-    1324, -603, -2624, 350, 1669, 941, 3156, 3813, 3327, 2002, 1962, 947,
-    427, 607, 1129, 3075, 1626, -81, -1254, -3239, -2599, 146, 1076, 1064,
-    844, 59, -186, -98, -1595, -3525, -1848, -1176, 246, 412, -100, -1039,
-    -2809, -3900, -1840, -288, -534, -663, 770, 720, 532, 448, 14, 790,
-    1826, 1806, 2834, 2350, 401, -1215, -31, 371, 1000, 1523, 250, 592,
-    914, 307, -554, -1705, -1634, 737, 2206, 721, 1632, 849, -1749, -1787,
-    -139, 158, -931, -1891, -2304, -243, 418, -1180, -3926, -4939, -2978, -662,
-    -1378, -2122, -1143, -4219, -6652, -4586, -2052, -945, -110, 1206, 430, 1065,
-    2195, 395, -1357, -333, 3673, 5499, 4411, 4805, 5455, 2448, 1206, 3097,
-    3857, 2876, 2316, 1809, 883, 2868, 2005, -708, -1027, 844, 3071, 1617,
-    -551, 60, -1263, -5044, -2773, 458, -323, -1719, -2328, -2481, -2365, -1763,
-    -3553, -5531, -4092, -165, 833, -1639, -2591, -1005, -4078, -4702, -944, 119,
-    -1388, -3030, -2766, -1082, 663, 212, -2203, -3348, -1040, 1879, 965, -1379,
-    -654, -1807, -4280, -3207, -630, 421, 835, 1070, 2054, 1508, 1985, 1885,
-    410, 1181, 4366, 6546, 5122, 5205, 5522, 4050, 3180, 4474, 4560, 4886,
-    4266, 3618, 2661, 2303, 2015, 1217, 834, 1339, 1854, 751, -447, -3,
-    -1711, -4245, -4069, -3186, -2176, -2955, -3987, -3799, -4193, -4847, -4698, -5740,
-    -4623, -2547, -1567, -2055, -1336, -11, -1146, -1084, 355, 1342, 1963, 1215,
-    174, 1759, 2013, 1802, 1141, 840, 1389, 955, 738, 790, 635, -1228,
-    -2407, -2188, -2141, -474, 1652, 2210, 1916, 769, -971, -226, -171, -165,
-    -292, 46, 1112, 1335, 862, -691, -1241, -1686, -1691, 671, 1892, 1519,
-    -452, -1711, -698, 1622, 3712, 3487, 2035, 2140, 4026, 4831, 3044, 1290,
-    700, 559, 2151, 3999, 3564, 2759, 363, 329, 1540, -89, 1124, 139,
-    -941, -121, 1287, 2528, 706, -1937, -2931, -3278, -2191, -2228, -2240, -2545,
-    -3923, -2092, -2157, -2290, -2480, -4885, -4070, -2290, -2190, -3277, -4300, -5195,
-    -5954, -4437, -2717, -711, 1605, -868, -1451, -1078, -274, 1108, 643, -399,
-    3379, 5588, 5453, 5172, 3501, 4101, 3757, 4824, 6469, 6974, 4495, 488,
-    785, 2033, 4199, 3771, 1640, 1316, 1557, 1632, 547, -586, -1022, -1227,
-    -1594, 2, 2150, 2411, -484, -2205, -1971, -1918, -541, -443, -1586, -1655,
-    5, 1041, 226, -1172, -970, -2654, -3672, -1763, -229, -739, -2075, -2112,
-    -1863, -2244, -1123, -1776, -3194, -3016, -2395, -1339, -2492, -3059, -3356, -4165,
-    -3782, -76, 3524, 2606, -785, -767, 1191, 2513, 2197, 1692, 2487, 4011,
-    4953, 5302, 4009, 3574, 3458, 2437, 3245, 5051, 4474, 552, -2183, -354,
-    2009, 2260, 695, -512, -2792, -1708, -1146, -1441, -1340, -2058, -3123, -3055,
-    -1159, -43, -3175, -6302, -5955, -2257, -1482, -543, -422, -884, -1330, 791,
-    1613, 2856, 2932, 2394, 1223, 2776, 3506, 3733, 2854, 184, 856, 1547,
-    1983, 3396, 1479, -70, 183, -515, -686, -1850, -2283, -3174, -3375, -444,
-    169, -1836, -1835, -3033, -2220, -3065, -757, -1549, -2261, -3764, -2268, -1351,
-    -2752, -1790, -1025, -1884, -1631, 2452, 1075, -1405, -1414, -1238, 837, 4092,
-    3947, 3802, -933, -304, 694, 3098, 1878, 3687, 3330, 1503, 4781, 1081,
-    -2239, 338, 1521, -875, 3554, 5349, 2131, 978, -2616, -1374, 2379, -296,
-    1215, -144, 889, 126, -1081, -4070, -2076, -3125, -3086, -3087, -1182, 768,
-    -1249, -943, -878, -3695, -1268, -4763, -1908, -2103, -2016, -3897, -4097, -1788,
-    444, 2419, -207, 2935, -2084, -5535, -1393, -1521, -127, -280, 2910, 4337,
-    2211, 4707, 2317, 2901, 1592, -382, -750, 4239, 2821, 4898, 8065, 3878,
-    7910, 3259, -959, 2553, 3118, 106, 2264, -747, -2989, -4435, -2425, -1211,
-    -624, 4113, 3700, 5475, 6228, 4452, 954, -3517, -2407, -3992, -9025, -7268,
-    -7565, -10346, -8309, -7941, -8710, -2080, 1121, 1240, 4256, 8477, 7311, 2473,
-    -1998, -4749, -7608, -6678, -8390, -6513, -4741, -1771, -3770, -6450, -198, -1787,
-    2010, 2701, 6409, 7706, 12577, 6974, 5306, 9420, 7529, 3691, 5559, 4690,
-    6121, 5455, -611, 4377, 1989, -418, 2507, 2786, 926, 2971, 2411, -264,
-    -5020, -1339, -1584, 243, 1195, 899, -1360, 918, -2906, -2297, -3515, -553,
-    2115, -2697, 2656, -329, -69, -2656, 1813, -5204, 2520, 1166, -349, 1320,
-    2371, 275, -2350, 3422, 5136, 1722, 3490, 5323, 3419, 1732, 503, -951,
-    -681, -3479, -2278, -2267, 1116, -224, -3725, -4373, -2533, -621, -6431, -9100,
-    -6801, -1841, -4581, -3636, -480, -3964, -4146, -5091, -3151, -158, -1249, -1316,
-    1523, -443, -2589, -1245, -3099, -2180, -2560, 3236, 1126, 758, -740, 568,
-    -596, 738, 7741, 4635, 2328, 4979, 4095, 222, 814, 3117, 1328, -1132,
-    -3744, -3866, -1859, -1488, -3569, -3822, -704, -3320, 1664, -1135, -2686, 994,
-    -1698, -2283, -7835, -4510, 129, 2707, 3876, 3738, 9945, 9842, 9405, 7271,
-    5544, 2102, 1052, -2239, 2316, 1310, -2116, 615, 373, -1054, -3669, 78,
-    -4879, -1261, -1728, -7548, -4063, -2122, -493, -4734, -1632, -292, 5146, 4098,
-    2235, 9528, 7494, 6242, 6319, 9101, 7320, 7188, 4939, 2224, 2409, 5317,
-    3093, 2178, 2347, 2504, 1159, 3540, 3643, -489, 571, 2444, 2189, 886,
-    742, -2601, 1593, -1334, -5926, -3847, -1385, -6805, -6578, -4822, -3104, -3953,
-    -1879, -3329, -5314, -756, -1948, -2903, -5743, -676, -1251, -3316, -4523, 602,
-    -2298, -5610, -495, 1175, 1453, 2231, 3218, -2452, -3417, -667, -588, 873,
-    -1599, 2073, 3524, -374, -1191, -1296, -2271, -3324, -199, 2008, 2538, 1595,
-    2319, -2020, -2417, -591, -1558, -1439, -2548, 180, -2616, -1449, 47, -2474,
-    -5397, -3027, -984, -1704, 1631, -1831, -3660, -3199, -4218, -1590, -2951, -1916,
-    4544, 3409, 4343, 5022, 1833, 3784, 22, 1529, 4794, 4119, 2194, -475,
-    -2498, -5559, -6421, -6099, -7191, -4359, -2701, -1268, 2926, 3087, -874, -2265,
-    -1975, 2735, 4274, 2021, 467, -763, -4444, -5729, -4443, -5624, -3413, 1189,
-    -2173, -954, 5698, 117, -1028, -1160, -408, -987, 2878, 926, 2010, 802,
-    621, 1775, 1122, 1334, 974, 1712, 3873, 3526, 3171, 3886, 706, -166,
-    404, 7118, 3298, 3463, 2817, 2364, 418, 1886, -413, 2279, 4843, 2624,
-    4267, 2598, 3737, 567, -3997, 978, 1686, 3160, 3765, 728, -17, -2936,
-    -1761, -4610, -5178, -1475, -175, -2925, -1998, -803, -2728, -3565, -656, 494,
-    3519, 3628, 6004, 6328, 2391, 3439, 4021, 275, 2979, 5926, 7762, 7676,
-    6130, 6107, 2208, 410, 2997, 4143, 2592, 5081, 5984, 1244, 2421, 4425,
-    1622, 1111, -306, 1907, 4062, -1141, -2787, -2534, -4170, -2552, -1876, -1080,
-    -2283, 1043, -2211, -5073, -2344, -3671, -5086, -4183, -6276, -5800, -3503, -5872,
-    -8393, -9249, -10472, -6808, -4300, -5165, -2063, -1486, -2283, -3466, -1730, -5900,
-    -2898, -1782, -4232, 704, -3463, -2472, -92, -3892, -4152, -1178, 849, 2889,
-    5489, 7017, 4657, 7409, 2608, 2039, 4101, 5095, 7879, 8485, 6566, 4204,
-    4744, -1031, 1148, 1474, 1639, 525, 3143, 3345, 283, -2447, -1495, -293,
-    965, 1069, -4023, 1453, 1418, -4497, -4184, -2188, -1089, -625, -4223, -1254,
-    2165, -1874, -6110, -4968, -2754, -3708, -1741, -566, -1425, -2773, -3097, -3760,
-    -4387, -1813, -159, 423, -2886, 887, 2015, -5783, -5175, -2277, -5688, -3846,
-    59, -70, -478, -2710, -1245, -7039, -2906, -2659, -5414, -2270, -3063, -2892,
-    -2927, -7577, -6469, -7075, -9706, -5143, -3612, 74, -2000, -2803, -5715, -2455,
-    -414, -5379, -4528, 257, 778, -342, -1115, -435, 1068, 1513, 1825, 3698,
-    6235, 6692, 6787, 4310, 3758, 9232, 5989, 5627, 6652, 5608, 6821, 4802,
-    -117, 3119, -1509, -1315, 1949, 155, 870, -2114, 2101, -1558, -3364, -587,
-    1661, -848, -1249, 1676, 2527, 488, 5270, 4558, 3898, 5678, 9577, 10393,
-    6594, 6925, 5256, 1227, 2180, 2751, 4112, 2269, 743, 1718, -606, -1481,
-    1571, -2651, -4564, -1555, -1806, 2347, 2460, 1270, -379, 1951, 519, 4245,
-    3716, 3912, 5756, 7086, 9061, 9678, 10151, 8406, 8467, 10274, 10197, 8981,
-    7719, 7921, 2303, 4889, 5456, 7565, 2820, 1486, 3114, 3261, 2256, 4377,
-    1615, -4632, 452, -1773, -3640, -1132, -2879, -3900, -7453, -2521, -1023, -3251,
-    -5688, -3503, -4011, -4731, -1619, -3190, -5998, -5807, -2625, -1880, -2942, -2027,
-    -1951, -4009, -3131, 1213, -52, -199, -893, -1846, -2449, 2150, -455, -3674,
-    -3191, -4018, -1911, 738, -2907, -45, -5308, -2417, -4566, -2671, -1751, -7173,
-    -6800, -5652, -3993, -1725, -4915, -2957, -5006, -5254, -2515, -2555, -2458, -4880,
-    -4259, -3518, -3013, -191, -2939, -4157, -3756, -4598, 743, -1844, 356, -2148,
-    -3857, -3926, -64, -307, -2721, -2704, -931, -721, -1256, -3540, -5431, -6382,
-    -5315, -4878, -3169, -4627, -3297, -5106, -3358, -4486, 1778, -1841, -2959, -1892,
-    -1026, 401, 52, -1537, -4371, -2985, -3546, -1145, -5850, -4067, -3214, -6794,
-    -3476, 892, -2077, -443, -2392, -3095, -2166, -3876, -2108, -4879, -5488, -2426,
-    -2372, -1593, -277, 1662, -201, 514, 2238, 4882, 1679, 2544, 3919, 3805,
-    3211, 4399, 5730, 908, 3320, 2032, 2610, 1421, 4549, 2201, 11, 37,
-    1121, -146, -626, 907, 688, 1002, 783, -242, -1718, -2269, 599, -832,
-    -3408, -1288, -1675, -3297, -2889, -4014, -952, -3151, -113, 1510, 1071, 1775,
-    3578, 2053, 2607, 4860, 6814, 3124, 3528, 7447, 4126, 6110, 5888, 6560,
-    6096, 6517, 7927, 4939, 5373, 3433, 3340, 3007, 3804, 6376, 3708, 2725,
-    6439, 7210, 4367, 4924, 4751, 2422, 2876, 4104, 3733, 1774, 1490, -386,
-    -785, -531, -370, 855, -3815, -926, 1310, -1646, -4594, -3963, -4402, -5815,
-    -5373, -4855, -2236, -5076, -3642, -5459, -5790, -2793, -443, -3202, -2462, -487,
-    695, -1121, -1909, 1031, 980, -126, 3681, 4070, 3019, 6112, 5614, 2099,
-    6278, 8809, 7467, 5273, 7200, 8006, 5595, 6673, 6081, 5846, 6838, 5835,
-    9444, 5113, 4608, 5561, 928, 631, 5257, 4405, 2384, 1810, 3522, 4916,
-    1188, 3856, 3942, 2910, 1737, 4034, 2295, 793, 1380, -224, 209, -2264,
-    1182, -872, -1452, -1566, 2926, -1396, -4214, -3500, -4383, -4068, -4596, -1915,
-    -4045, -3168, -5475, -4858, -5336, -6440, -5951, -6674, -3607, -5449, -3500, -3068,
-    -4001, -5323, -4116, -4449, -3439, -3173, -4536, -1798, -4272, -5774, -5630, -4811,
-    -4658, -6174, -5483, -5386, -7581, -6416, -5810, -3736, -3204, -3743, -3717, -4813,
-    -5806, -3845, -5091, -7452, -4915, -4932, -5700, -3311, -2042, -2634, -805, 828,
-    1043, 709, 3621, 5704, 2852, 3044, 5358, 5828, 3865, 2212, 4518, 4586,
-    2680, 3618, 1822, 1218, 721, -4051, -2773, -2388, -3998, -2872, -2379, -1698,
-    -1785, -3910, -3546, -3760, -5264, -4499, -1327, 1296, -470, 263, -563, -126,
-    134, -896, -550, 1643, -2482, 1043, 3461, -2423, 224, -754, -2881, -2874,
-    -267, -1953, -1008, -2018, -2110, -1240, 418, 1001, -385, -861, 1778, 2732,
-    2889, 2239, 3836, 3495, 2907, 7464, 7457, 7432, 8237, 10461, 7890, 8436,
-    10872, 9132, 6121, 7520, 7057, 5251, 4444, 3956, 3781, 173, 3782, 4279,
-    2109, -1276, 1529, -1369, -3070, -734, -2707, -3021, -3589, -1278, -529, -3406,
-    -3345, -5514, -6741, -8048, -4274, -4234, -4062, -4609, -3067, -5694, -3150, -2363,
-    -2172, -4264, -502, 1031, 2024, -403, -309, 617, -1133, -180, 68, 723,
-    1179, -2268, 725, -266, -486, -229, -1707, -3586, 663, -2116, -2637, -1239,
-    -3040, -5061, -4659, -1171, -5679, -3208, -1955, -2369, -1103, -294, -331, -1428,
-    -2769, 2502, 2211, -1222, 1821, -291, -1708, -1348, 2596, 2587, 1425, 2670,
-    747, -2535, 1051, -1146, -881, -2631, -927, -750, -243, -1179, 335, -2545,
-    -4364, -4816, -1583, -2274, 697, 191, -2093, 443, 942, 1038, 1499, 838,
-    3148, 797, 2978, 2242, 171, -1102, -1937, -695, 303, -1095, -1334, -756,
-    -1974, -1308, -48, -1485, -2521, -1604, -1904, -2497, -40, -370, -4402, -4771,
-    195, -916, -2008, 2649, 2432, 2586, 2844, 5257, 5545, 5738, 7265, 7318,
-    6300, 9648, 6806, 4749, 5407, 5528, 6718, 7589, 7198, 6031, 6584, 2158,
-    3097, 2770, 3592, 3971, 1090, 1521, 3585, 2257, 3295, -1064, -935, -2876,
-    -3437, -188, -2897, -3825, -2825, -3849, -3460, -2873, 1306, 1144, -563, 780,
-    4336, 3258, 3116, 3066, 3994, 4783, 4734, 5071, 4722, 4970, 6415, 3707,
-    4556, 4712, 5713, 2378, 1598, 3284, 2930, -215, 1101, 632, 616, 737,
-    3327, 4982, 2355, 3660, 3299, 2155, 3787, 3553, 5588, 742, 2520, 1721,
-    -1231, 33, 59, -1659, -334, -759, 175, -2445, -1792, -3055, -4260, -5512,
-    -3497, -4642, -5768, -5206, -6672, -5842, -5446, -6235, -7380, -7806, -5490, -3543,
-    -5189, -4014, -3659, -4954, -3508, 1098, 649, -460, 1503, 1611, 2782, 3320,
-    4519, 3133, 3413, 4742, 3857, 4461, 4294, 4168, 3410, 3965, 6603, 5357,
-    2120, 3111, 3673, 1805, 977, 2043, 1892, -124, -490, 1312, 2126, 1306,
-    1063, 141, 980, 409, 1823, 1686, 1321, 473, -190, -934, -1275, 1257,
-    -1672, -88, 326, 126, -2604, -2806, -1679, -3473, -3041, -2685, -2134, -3975,
-    -3940, -4613, -8044, -3962, -3810, -5880, -7382, -5123, -5613, -4810, -6158, -5792,
-    -7046, -7047, -3967, -4019, -4894, -4679, -4997, -5084, -5904, -4062, -3368, -4286,
-    -6503, -4531, -3097, -6260, -6914, -5264, -6575, -5857, -3180, -4923, -6124, -7371,
-    -7951, -7737, -8302, -6667, -4915, -8823, -7846, -3022, -4203, -5199, -1327, -481,
-    -1068, 1069, 4662, 4726, 5309, 3531, 5237, 1667, 4031, 5283, 4761, 3039,
-    5724, 6065, 2612, 401, 1744, 181, 304, 1243, 1340, -1250, -208, -845,
-    -2387, -3983, -2235, -997, -3024, -3153, -1250, -1, -2443, -3861, -1032, -2699,
-    -144, 736, -515, -2166, 1621, -996, -1915, -956, 2423, 319, -1602, 1237,
-    2461, -1443, -2990, 1142, 840, -910, 2888, 1078, 865, 475, 2737, 2235,
-    2406, 5071, 5460, 3420, 5004, 8214, 8694, 6380, 8106, 11076, 9689, 8762,
-    11550, 10298, 10524, 8694, 8651, 5370, 6224, 7914, 7009, 5881, 8140, 6942,
-    5062, 1852, 4627, 3134, 2924, 2033, 1094, -909, -1165, -937, -1211, -3119,
-    -4968, -4033, -5538, -5939, -3108, -3385, -6447, -6823, -3263, -4606, -5585, -2369,
-    -680, -2101, -1719, -2016, 550, 1285, 2369, 392, 523, 2769, 3370, -21,
-    484, 3426, 4124, 271, 1503, 1854, -737, -1052, 1883, -908, -193, -1115,
-    -1265, -3725, -4582, -2837, -1806, -2800, -1556, -133, 1836, 114, 852, -2,
-    1606, 1608, 1155, 1510, 2117, 1106, 1969, 3381, 3138, 1125, 1973, 718,
-    2812, 2122, 3802, 2668, 1560, -751, -811, 1583, 1772, 1765, 1954, -1227,
-    -420, -295, 111, 231, -55, -438, 1619, -452, 1488, -1041, 298, 236,
-    361, -1518, -596, 1093, -811, -2481, -402, -882, -1474, -1537, -1281, -673,
-    184, -1074, -51, -2736, -3962, -2807, -741, -1428, -785, -1368, -2440, -2916,
-    -2521, -2416, -415, 589, 1714, 2556, 3315, 4807, 5600, 3511, 3446, 4959,
-    6386, 6600, 6389, 5492, 5301, 7226, 6801, 5617, 7205, 7776, 7665, 7837,
-    7643, 7964, 6202, 3347, 2474, 4576, 4595, 2165, 3188, 837, -1827, -761,
-    -3335, -2356, -4229, -3991, -3995, -3362, -2256, -2197, -3295, -3545, -1469, -1483,
-    -739, -601, 1914, -371, 2332, 1783, 1439, 894, 2093, 2506, 2355, 2506,
-    1980, 1117, -1160, 49, 1357, 1538, -3, 808, 359, 378, -426, -161,
-    995, 2180, 2341, 3802, 4979, 4350, 2616, 1407, 2072, 2233, 1905, 2092,
-    421, 1092, -332, -1272, -112, -1748, -2627, -944, -1020, -741, -1735, -3422,
-    -3887, -4965, -4691, -4986, -5287, -5081, -4302, -4765, -5471, -5070, -6448, -5848,
-    -6718, -3741, -2338, -2505, -3677, -2780, -2418, -18, -1568, -2800, -261, 178,
-    2369, 1284, 1888, 2774, 1401, 1574, 3583, 4869, 4103, 3665, 2895, 4120,
-    2437, 2415, 263, -122, -143, 690, -332, -473, -3449, -3739, -4226, -3674,
-    -149, -1280, -2237, -1885, -3050, -782, -511, -1608, -3802, -2982, -1433, -77,
-    -290, -2986, -1958, -1916, -1273, -445, 505, 844, -135, -1984, -2257, -1169,
-    -1689, -2584, -3327, -2898, -1950, -1141, -2698, -3713, -5457, -7393, -5212, -3637,
-    -2604, -3411, -5019, -5581, -4210, -3549, -6042, -7480, -6111, -3437, -4774, -2306,
-    -3178, -4881, -5462, -5300, -4264, -2014, -2522, -4226, -4068, -5651, -5339, -3965,
-    -7007, -8743, -6019, -3548, -4161, -4089, -5444, -5528, -5191, -2777, -1573, -341,
-    -95, -659, 850, 3384, 4744, 2395, -538, -216, 4157, 2542, 4788, 3536,
-    2749, 1979, 4266, 4577, 4078, 5396, 3002, 3143, 3769, 3307, 1982, 396,
-    -86, 1859, 2317, 3332, 1342, 266, -3652, -3090, -1058, -1903, 810, -943,
-    -1914, -939, 696, -1297, -2828, -4675, -4705, -907, 1438, 66, 160, -1128,
-    -3394, -2803, 261, 2152, 861, 939, 2395, 2477, 3824, 4683, 2756, 757,
-    3005, 6320, 8676, 7294, 4923, 7122, 5659, 4850, 6806, 6986, 7422, 6350,
-    8057, 10170, 8057, 8056, 3827, 3609, 4849, 6838, 6783, 4884, 4408, 4266,
-    3067, 3934, 4264, 2745, 2714, 2056, 3114, 1090, 407, -3099, -2406, -1123,
-    -964, 1354, -1224, -2520, -3571, -6152, -4359, -2022, -2199, -2599, -1934, 0,
-    -937, -1223, -2002, -2035, -2061, 19, 2761, 3868, 3336, 2729, 2238, 908,
-    2207, 4164, 3038, 3307, 2902, 3799, 3470, 845, -1109, -1071, -1062, -120,
-    -793, -1095, -2104, -1618, -2269, -2290, -723, -2264, -799, -1062, 1479, 1497,
-    1043, 700, 353, 763, 831, 461, 2851, 1361, 556, 809, 1373, 2700,
-    2905, 2345, 3603, 4802, 4371, 4027, 2575, 2217, 3477, 3065, 3948, 4132,
-    4021, 4152, 809, 508, -386, -186, 1055, 608, 1465, 1286, 687, -1398,
-    -2145, -2290, -2283, -2626, -80, 294, -742, -2366, -788, -1007, -3552, -1658,
-    -1991, -809, -1669, -520, -482, -1613, -1395, -3031, -1949, -2708, -3370, -990,
-    -1926, -994, -828, -1282, -361, 1551, -909, -68, 2548, 728, 1990, 2714,
-    3772, 6117, 4534, 1883, 4999, 5563, 5073, 6822, 6187, 7167, 7377, 7957,
-    7463, 8335, 7050, 3794, 4584, 2872, 3060, 2821, 1554, 1191, 1828, 831,
-    -1796, -3079, -3981, -3523, -3351, -2349, -2547, -1486, -3721, -2998, -3049, -5515,
-    -2712, -3029, -3703, -1350, -1443, -2716, -1541, -663, -1434, -3203, 449, -1789,
-    761, 62, -693, 973, 1543, -61, -655, -1096, 1069, 1685, -365, 1991,
-    2687, 2609, 1989, 1499, 169, 2205, 2073, -657, 257, 1280, 517, 884,
-    247, -1173, -1675, -3856, -2854, -3297, -2666, -1983, -1756, -2964, -2105, -2430,
-    -2845, -3817, -2760, -2907, -3966, -2842, -1949, -1491, -1878, -1419, -4863, -3503,
-    -1724, -1676, -3931, -2152, -1735, -1552, -2497, -2792, -1226, -713, -2473, -588,
-    1447, 2031, 2950, 936, 1620, 4271, 2937, 2258, 2431, 2373, 1886, 1310,
-    313, 1272, 736, -1162, -2719, -1132, -4912, -4349, -5245, -5936, -3463, -2828,
-    -3771, -6659, -6225, -4432, -5737, -3902, -4671, -2685, -4171, -3202, -1177, -2211,
-    -3053, -2367, -4194, -4041, 651, 791, -903, -2356, 536, -656, -1005, -268,
-    1398, -1839, -2769, -1650, -511, -442, -2091, -3034, -4055, -748, -1029, -1893,
-    -4983, -4232, -3748, -2023, -2546, -2256, -3422, -5551, -5512, -2838, -3029, -3129,
-    -3555, -5188, -4496, -2517, -2720, -4256, -6653, -6082, -4358, -5663, -4148, -2581,
-    -5325, -4947, -4099, -4232, -5232, -6725, -7123, -4565, -1614, -1373, -2108, -4697,
-    -3010, -2781, -2448, -1840, -102, 512, -1908, 621, 2639, 3719, -63, -76,
-    2498, 1978, 3557, 5610, 3829, 2885, 3548, 4233, 4519, 4826, 4402, 2010,
-    720, 1248, 2598, 1252, 378, -442, -491, 265, 1260, -1526, -3189, -2867,
-    -1627, -1707, -894, -558, -3395, -3967, -3420, -3862, -1653, -1850, -1908, -843,
-    -550, 2023, 735, -616, -498, 1661, 2354, 2358, 4795, 4680, 3368, 5599,
-    6080, 5259, 3867, 3190, 3012, 5752, 6664, 8072, 7144, 3498, 5172, 7659,
-    4612, 5042, 5606, 5859, 5960, 5967, 4685, 6012, 3013, 1222, 1721, 2958,
-    966, 1402, 403, 1282, 1117, 1371, 969, -288, -675, 995, -830, -1776,
-    -1702, -664, -1814, 168, 245, 668, -1198, -2572, -713, -764, -326, 909,
-    2099, 1333, 2059, 695, 1257, 1999, 574, 3369, 5143, 5096, 5130, 5106,
-    4244, 3625, 2409, 3648, 3518, 2229, 1711, 2273, 2168, 974, 2056, -476,
-    -1505, -984, -1674, -1210, -748, -37, -1181, -2039, 210, 603, -350, -1193,
-    -1120, -898, 272, 1050, 31, 881, 614, -598, 449, 2347, -910, 631,
-    1880, 2513, 3811, 4416, 3165, 2492, 1951, 4521, 3174, 2279, 1944, 1468,
-    777, 3869, 5785, 1565, 1986, 1001, 644, 1362, 3567, 1860, 1169, 126,
-    2827, 2198, -478, -1212, -1791, -2054, -426, 1627, 3236, 917, -653, -2753,
-    -849, 216, -805, -1802, -2217, -601, -693, -378, -901, -2212, -4245, -4250,
-    -2763, -121, -680, -3056, -2729, -2320, -861, 836, 1182, 683, -1673, 1114,
-    3455, 3996, 3669, 4183, 4128, 4248, 6717, 8274, 5378, 4961, 4998, 6500,
-    6633, 8370, 5795, 4213, 3722, 3840, 4530, 2535, -1431, 459, 269, -577,
-    2105, 1949, -1318, -4974, -4010, -1322, -2180, -1306, -4889, -3438, -2500, -658,
-    -2458, -4541, -5387, -4998, -2238, 831, 1971, 1581, -1052, -2502, -1264, 1730,
-    1301, 451, -842, 1425, 3147, 4190, 2485, 260, -326, 62, 3396, 3745,
-    4168, 948, -823, 29, 2409, 2254, 2067, -347, -3484, 296, -338, 162,
-    -1038, -3034, -5386, -4034, -1815, -1121, -4459, -5416, -5724, -4999, -2931, -1822,
-    -2966, -4864, -3163, -1303, -1645, -1382, -3234, -4381, -2740, -1860, 1326, -23,
-    -1996, -3531, -1707, 344, -1378, -334, -1447, -516, 852, 2600, 1749, 1843,
-    302, 342, 2379, 4177, 6505, 3122, 2500, 3393, 1767, 2376, 22, 769,
-    -1655, -1854, -223, -747, -2745, -4563, -5883, -3753, -4124, -3638, -3359, -6744,
-    -7616, -5023, -3661, -2491, -5064, -3615, -5052, -4974, -2144, -2327, -2412, -4281,
-    -3922, -1711, -194, -1304, -1453, -4462, -3934, -726, -548, -2218, -2135, -647,
-    -554, -1923, -3230, -1092, -3654, -4937, -1793, -229, 307, -727, -1363, -1434,
-    894, -91, 180, 454, -347, -560, 642, 717, -162, -614, -3777, -2336,
-    -2785, -902, -2196, -3125, -4190, -2473, -4942, -4574, -3841, -3522, -4684, -4856,
-    -4885, -4964, -4667, -4971, -5827, -3559, -4849, -2928, -2306, -5546, -3720, -3395,
-    -2762, -1289, -827, 713, 171, -889, 235, 1380, 1053, 1834, 2765, 4481,
-    3260, 2860, 3866, 712, 1248, 2533, 3306, 2096, 4365, 4658, 2669, 1981,
-    -437, -287, -1489, -278, -555, 1945, -577, -1659, -2165, -2612, -2268, -2523,
-    -3504, -1004, -1218, -2007, -2926, -3010, -2499, -1179, -179, -768, 880, 898,
-    1497, 1307, 1280, 4643, 3019, 3338, 4717, 5698, 4964, 4544, 3406, 2091,
-    2786, 4048, 4620, 4350, 5406, 6969, 5766, 2925, 4035, 2971, 5508, 4404,
-    3144, 6704, 5246, 1809, 426, 2695, 1886, 633, 2214, 687, 738, 1842,
-    -3588, -2556, -1696, -1960, -1192, 230, -576, 2574, 730, -2282, -2913, -1779,
-    -3103, -1457, 258, 1550, 1347, -478, -2181, -936, 347, 1726, 2067, 1460,
-    4403, 3477, 2543, 701, 2332, 3819, 4180, 5146, 5033, 5929, 5268, 2393,
-    143, 3619, 2525, 3299, 3206, 2840, 2568, 1292, -2196, -2610, -2581, -2159,
-    -1446, 1464, -254, 306, 956, -792, -2520, -1348, -99, -738, 792, 2245,
-    -49, 815, -1517, -1589, 723, 525, 1495, 1374, 1125, 723, 545, -361,
-    -816, -317, 1606, 1130, 3253, 4102, 3393, 1564, -776, 1488, 309, 960,
-    1631, 3972, 2601, 2210, 2593, -65, 2885, 3297, 3462, 3520, 6579, 2449,
-    2914, 2263, 848, 1294, 2275, 3332, 2572, 1408, 203, 1129, -2610, -4587,
-    -1720, -704, 34, 2683, -1652, -2271, -2306, -4023, -4846, -3227, -2353, -3161,
-    -520, -1330, 586, -2207, -2904, -2696, 187, 1211, 2340, 3591, 3309, 2415,
-    4853, 4957, 6544, 4805, 3787, 6954, 6260, 6483, 6205, 3612, 2671, 4313,
-    3979, 4417, 3763, 2657, 308, -496, 302, -400, -4013, -1792, -2915, -2664,
-    304, -615, -4026, -4193, -5828, -1623, -212, -2259, 1096, -84, -1369, 672,
-    364, -530, 1406, 1006, 484, 1915, 2767, -1624, -2592, -977, -2295, 1244,
-    2645, 2217, 1861, -2434, -2385, -3063, -1893, -1506, -765, -1497, -86, 3949,
-    3050, 1048, 1418, 1026, 747, 3453, 2076, 3932, 1632, -2631, -693, 472,
-    -1179, -2038, -2331, -4511, -4953, -2087, -4954, -8337, -7920, -6728, -7398, -7560,
-    -2012, -1009, -3298, -2028, 191, -1450, -1603, -1360, -420, -1664, -1706, 1687,
-    -19, -3471, -2129, -591, 343, 1537, 1961, 2737, 1355, 1599, 2449, 2689,
-    1694, -3, 3942, 2667, 4623, 5023, 869, -266, -444, 2936, 570, 2689,
-    1295, 1576, -2247, -3372, -1411, -4092, -4148, -3895, -2384, -1665, -5283, -4128,
-    -4571, -4812, -4857, -5468, -3345, -3368, -3999, -2981, -4462, -1080, -4787, -3343,
-    -2059, -623, -502, -1513, -2340, -4048, -3915, -3909, -3298, -1939, -2859, 635,
-    -969, -1547, -25, -3921, -4599, -1831, -2100, -1450, -1635, -150, 76, -2556,
-    166, 1109, 1151, 2280, 2678, 4228, 1405, 2584, 2385, 2623, -394, 90,
-    118, -1173, -878, -1359, -3669, -5888, -5540, -3905, -3488, -2970, -2323, -437,
-    -4822, -5255, -5625, -6834, -5900, -5151, -7183, -5707, -2358, -3321, -3678, -2414,
-    -2310, -492, -1432, 1297, 2654, 3540, 1430, 1533, 2605, 5840, 3663, 2735,
-    4369, 5107, 5621, 1302, 1124, 407, 2670, 1209, -760, 1526, 2584, 1852,
-    -710, -1574, -4334, -2143, -2639, -3199, -2760, -2306, -2713, -6025, -4535, -4813,
-    -3575, -3769, -2243, -814, -380, -625, -773, 762, 2018, 2296, 2138, 2467,
-    1480, 2489, 1895, 2667, 1818, 3821, 2872, 4201, 5704, 5586, 3735, 4876,
-    1553, 2684, 1872, 4338, 3466, 4436, 4182, 4007, 5063, 6744, 4910, 5219,
-    6476, 5240, 4645, 5805, 5075, 3158, 2112, 2948, 1981, 387, 1463, -616,
-    -2403, -1084, -2866, -4642, -1454, -4824, -2338, -3200, -2546, -61, -372, -1487,
-    -3100, -2345, -1253, -766, -931, 60, -626, -2019, -1806, -1218, -348, 1603,
-    3377, -10, 3362, 2793, 3431, 4430, 3616, 4637, 3135, 4955, 3394, 3644,
-    3822, 1924, 3735, 3164, 2620, 3735, 1772, 2143, 1439, 1258, 1304, 699,
-    -1505, 746, 368, 428, -721, -1654, -790, -686, 425, -166, 836, -520,
-    -1946, -936, 1086, -476, 941, -1391, 2930, 1205, 1047, 1075, 1182, 667,
-    -645, -909, 751, 705, 2351, -725, -2168, 1864, 2142, 837, -520, 518,
-    -1665, -189, 45, 322, 167, -383, -523, -177, 2517, 4330, 4612, 2296,
-    1803, 3286, 2980, 3843, 2909, 2149, 3851, 2543, 30, 70, -906, -2962,
-    -2078, -1913, -1864, 615, -3549, -3872, -3472, -2635, -3006, -2742, -1708, -1989,
-    -2184, -2580, -1541, -2018, -2479, -1784, -317, 1851, 2827, 2654, 2170, 733,
-    2278, 5061, 5409, 6014, 6458, 5426, 5672, 7284, 5977, 3047, 2597, 4222,
-    2991, 2221, 2221, 1262, 37, -1682, 290, 1028, -1195, -740, -1886, -2825,
-    -2659, -3505, -5311, -3325, -5798, -4798, -2986, -2297, -1926, -2426, -3591, -4162,
-    -1273, -391, -1003, -243, 1854, 290, 1973, 1019, -485, 160, 296, 1730,
-    3174, 1506, 851, 667, -748, -1814, 1270, 2480, 1702, 997, 255, 579,
-    1724, 418, -838, 1137, 2374, 2269, 3212, 1906, 1730, 418, -673, -121,
-    1504, 979, 1076, 548, -1812, -1765, -2611, -5393, -2126, -3174, -4611, -4056,
-    -3946, -3783, -4988, -3603, -3590, -3168, -1881, -74, -2570, -2486, -3268, -3435,
-    -2495, -2674, -2975, -2601, 273, 791, 1183, -237, 1009, 1820, 432, 1815,
-    3372, 4433, 4101, 2457, 1813, 1872, 2350, 620, 2058, 1774, 1261, 625,
-    139, -1661, -2474, -1888, -3740, -2195, -79, -654, -1540, -3165, -2567, -2750,
-    -3417, -1391, -1804, -2060, -2419, -2270, -3308, -3547, -3155, -2852, -2910, -444,
-    759, 204, -1704, -2325, -3221, -2055, -1043, -152, -1024, -830, -2910, -3439,
-    -2076, -2922, -2867, -2179, -1757, -581, 4, -942, -2375, -3097, -2393, -787,
-    -28, 1732, 339, 514, 1960, 2888, 3028, 2770, 1481, 506, 2914, 2739,
-    1408, 143, -1904, -2583, -1772, -2537, -1880, -4727, -5057, -3639, -5003, -3360,
-    -5518, -5476, -5310, -6238, -3227, -2418, -2328, -2595, -3703, -669, -1703, -558,
-    -169, -1681, -177, -36, 2280, 1215, 963, 3003, 2730, 3552, 6874, 5866,
-    4916, 3621, 1999, 4415, 4177, 4884, 3453, 1664, -136, 261, 104, -708,
-    -2732, -2476, -2709, -2442, -1763, -2416, -3863, -7063, -6259, -4724, -3147, -3867,
-    -3624, -5466, -5039, -2525, -2071, -2222, -1751, -2022, -262, 1516, 1681, 1456,
-    -375, 654, 1624, 4559, 5389, 3286, 2652, 2883, 4043, 2318, 4820, 3560,
-    2466, 587, 1952, 4750, 5413, 1334, 1517, 4226, 4498, 5895, 4619, 2659,
-    814, 2638, 4949, 3807, 3833, 4277, 2913, 2934, 4240, 3738, 1315, 548,
-    -301, -796, 473, 1688, 26, -3157, -5225, -4036, -2292, -3978, -4011, -4295,
-    -3532, -2699, -1948, -2631, -4402, -4384, -3773, -1967, -694, -47, -271, -2367,
-    -973, -919, 504, 1570, 1599, 877, 2610, 4773, 5081, 1792, 264, 3101,
-    4259, 4531, 4412, 3607, 3076, 557, 633, 2570, 1569, 1349, 61, -1132,
-    -979, 940, 1798, -1857, -1262, 447, 2220, 1387, 1150, -311, -2717, -2302,
-    -1219, -1143, -29, -86, 607, -189, 514, 1573, -122, -719, 81, 1014,
-    2948, 2271, 3046, 1775, -391, 237, -255, -1933, 503, 1518, -807, -239,
-    565, 878, -2121, -4008, -180, 1569, 237, 2125, 2477, 125, 1527, 1485,
-    191, 1772, 3661, 4344, 2558, 2634, 2893, 1660, -1313, -1484, 94, -807,
-    -523, -868, -3878, -4163, -3120, -4339, -7044, -3981, -69, -3704, -4768, -3484,
-    -2074, -2673, -814, 264, 1682, 1730, 2934, 1371, 408, 1093, 2559, 1419,
-    2076, 5492, 7544, 6049, 4408, 4689, 5330, 5300, 5840, 7070, 6294, 5584,
-    6066, 5238, 3644, 2645, 370, 5, -753, 1681, -96, -4262, -2535, -3725,
-    -5329, -2979, -3835, -4250, -5938, -3497, -2457, -4219, -4961, -3893, -5494, -6013,
-    -3252, -209, -2115, -3797, -1512, -2304, -641, 220, -305, 373, 1878, 2490,
-    2728, 2845, 1428, -98, 982, 1633, 4299, 2851, -1728, -1432, 921, 285,
-    2727, 2214, 2060, 350, 1266, 2090, 1870, -599, -2644, 768, 916, 2011,
-    5151, 3027, -1790, -831, 41, 48, 1679, 1564, -767, -1062, -1212, 1303,
-    -642, -3475, -5570, -3018, -2281, -2697, -1683, -5537, -6803, -4002, -2237, -2013,
-    -869, -2294, -3244, -1903, -561, -153, 420, -1085, -1557, -571, 1667, 3401,
-    1334, 363, 558, 3146, 2333, 2205, 4450, 1511, 913, 2667, 4134, 2842,
-    -659, -1218, 285, 904, -60, -243, -1909, -4648, -2317, -490, -287, 11,
-    -33, -1428, -3589, -927, 182, -4162, -4552, -3494, -3944, -1320, 13, -1410,
-    -2512, -3364, -2872, -1380, -1407, 652, 1283, -620, -37, 2256, 1080, -147,
-    561, -727, 714, 1398, -1758, -3863, -3145, -2681, -1326, 40, -738, -14,
-    -1701, -2869, -465, -380, 1193, 1030, 905, -229, 1034, 2882, 1538, 1170,
-    2138, 2022, 212, 1799, 2262, 310, -1625, -388, -1111, -2573, -3821, -3102,
-    -4326, -5127, -4271, -4568, -5694, -5114, -5023, -4919, -3209, -2141, -1341, -1252,
-    -1333, -1279, -258, 929, 2091, 519, 2500, 2864, 3942, 3807, 4838, 5585,
-    4712, 3674, 4535, 6139, 4460, 3496, 3852, 4105, 3084, 3020, 2006, -1267,
-    62, -999, -3806, -3867, -3609, -3631, -5169, -4478, -2535, -3499, -5692, -5442,
-    -5773, -5224, -3104, -1720, -2387, -4233, -3719, -3914, -2697, -2023, -364, 481,
-    -402, 606, 1694, 1427, 2520, 3022, 2902, 3800, 4376, 3196, 3282, 3967,
-    3314, 1311, 2949, 4689, 2865, 2695, 1668, 1488, 2540, 2072, 1343, 1114,
-    1839, 2213, 971, 355, 1677, 2297, 1082, -109, 2850, 3838, 2464, 1967,
-    1323, 1739, 558, -130, 913, 798, 1432, 2189, 419, -1340, -2021, -3528,
-    -3712, -3563, -2866, -2511, -3150, -3384, -4209, -2667, -2617, -2426, -3154, -2745,
-    455, 992, 492, 770, -363, -689, -424, 1453, 3736, 3632, 2062, 2132,
-    2872, 1153, 1577, 2937, 2652, 3894, 1063, 758, 1173, 213, -1710, -1724,
-    -446, 183, -428, -713, -2300, -1023, -1725, -1947, -1124, -1475, 767, 549,
-    -384, 134, -893, -815, 868, -1049, 160, 2445, 1728, -3, -289, 1842,
-    -111, -1226, -503, 2499, 2919, 2352, 3347, 2956, 1383, -181, 85, -958,
-    736, 1352, 627, -857, 976, 328, -1636, -2276, -1028, -322, 1175, 588,
-    1637, 2415, 217, 86, 229, 1657, 2430, 2594, 119, 1330, 2437, -928,
-    -2066, -326, 83, -809, -2460, -2411, -1820, -4264, -6656, -5472, -3172, -2969,
-    -3582, -3592, -4029, -3379, -4390, -3113, -2391, -205, 549, 742, 2340, 3182,
-    3620, 2981, 4271, 3975, 6430, 8231, 7176, 6028, 7209, 6340, 5426, 4030,
-    4650, 5582, 4995, 4386, 4554, 4754, 2023, -730, -2025, -2357, -1532, -2057,
-    -3015, -4012, -4450, -4340, -5428, -6069, -5528, -5770, -4992, -3936, -2297, -1082,
-    -2050, -3955, -2514, -268, 611, 459, 867, 1230, 10, 181, 909, 3084,
-    1787, 2195, 2912, 2576, 3407, 2410, 556, -296, 495, 3122, 2527, 679,
-    136, -768, -1715, -2563, -2365, -1349, -1127, -857, 89, 690, 379, -373,
-    -1194, -1410, 1656, 4281, 1966, 1636, 2113, 965, -952, -493, -368, -142,
-    -434, 566, 1537, 1152, -37, -1504, -2878, -2863, -2300, -526, -2206, -1731,
-    -2436, -2890, -2278, -1909, -4034, -2777, -997, -468, 42, 1553, 2023, 494,
-    -96, 2389, 3842, 3336, 2225, 2437, 2229, 82, 1845, 2729, 1511, 2092,
-    2293, 1901, 1119, 744, -459, -821, -405, 913, -557, -2192, -1661, -2252,
-    -3306, -3582, -3937, -4251, -3275, -2622, -1774, -2075, -2426, -3680, -2777, -2357,
-    -992, 1231, -1128, -674, 311, -96, -1377, -1950, -1986, -1142, 835, 1552,
-    2627, 2190, 1757, -48, 122, 408, 820, 1490, 453, 333, 717, -602,
-    -216, -2394, -3021, -1120, 257, 181, 77, 1022, 1508, 1107, 1775, 2464,
-    2642, 2176, 1081, 2308, 1543, -92, -729, -1174, -755, 180, -449, -1392,
-    -3031, -4116, -3752, -4327, -2813, -3450, -4311, -4922, -4402, -3335, -3986, -4524,
-    -4633, -2218, -1278, -81, 816, 1407, 2399, 1183, 1219, 3539, 4811, 4833,
-    5255, 5657, 6900, 4305, 3036, 1246, 3197, 2997, 2462, 1613, 2453, 3229,
-    1520, -1552, -1252, -647, -2159, -2706, -2320, -2868, -3301, -4996, -5609, -5598,
-    -6915, -5949, -5321, -5259, -3985, -1046, -2084, -2078, -1185, -64, -621, 17,
-    787, 1516, 2031, 911, 1873, 3370, 3113, 4407, 5287, 4633, 4552, 4397,
-    2924, 3904, 3164, 2254, 2908, 3498, 1444, 34, 893, -1823, -2744, -1552,
-    -795, -1126, -1920, -1321, 873, -957, -2160, -123, 37, 606, 2316, 3499,
-    2339, 2799, 1009, 408, 1481, 1785, 667, 1047, 1490, 2216, 2397, -653,
-    -2355, -1960, -2754, -1394, -314, -2440, -3722, -2326, -4189, -5302, -4864, -3278,
-    -3421, -3934, -2017, 151, 1002, 862, -248, 1074, 2449, 3733, 2937, 1131,
-    2828, 2892, -394, 1965, 4547, 4485, 3046, 2813, 2037, 694, 912, 492,
-    -856, -162, 425, 810, -194, -2157, 697, -1845, -4457, -2469, -676, -682,
-    -801, 499, -1286, 554, -576, -927, -1960, -178, 639, 448, 632, 709,
-    1101, -1338, -1758, -749, 145, -378, 1289, -425, 1195, 2222, 1248, -1146,
-    -198, 2188, 2544, 1600, 1791, 3291, 43, -1578, -1011, 190, -207, -734,
-    -498, -998, 1234, 2345, 2319, -387, 824, 2414, 1031, -670, -327, 480,
-    -943, -1539, -725, 1030, 895, 1951, -1720, -2816, -2292, -2116, -4553, -3647,
-    -2406, -2275, -2662, -3421, -3696, -2227, -1565, -4024, -2605, -239, 1725, 1355,
-    412, 2250, 3173, 1919, 2879, 4119, 4399, 4970, 6021, 6308, 5369, 5832,
-    5866, 3519, 2732, 2650, 4050, 2198, 1619, 2205, 1612, -1714, -1287, -1119,
-    -2427, -3014, -2484, -3266, -4843, -4229, -4689, -5753, -5352, -5053, -4871, -4788,
-    -3929, -2065, -1730, -1494, 648, 1006, -431, 608, 816, -150, 1380, 2457,
-    2257, 3627, 5551, 4809, 3629, 3332, 2350, 1887, 1950, 1401, 2046, 832,
-    872, 1242, -61, -654, -874, -1679, -2936, -2590, -971, -33, -2190, -1769,
-    -2245, -1777, -1069, -356, -1768, -1834, 10, 491, -305, -276, 1141, 369,
-    -1359, -1624, 1129, 801, -40, 801, 1308, 936, -328, -785, -1696, -1129,
-    46, -366, -504, -1931, -362, -661, -1946, -2313, -1549, -2322, -3050, -1730,
-    1199, 2099, 1155, 1618, 1866, 1435, 776, 2317, 2565, 1418, 2760, 4171,
-    3495, 5051, 5333, 3267, 875, 2034, 2530, 43, -1007, -505, -296, -260,
-    -823, 120, -423, -3079, -3521, -3942, -2798, -881, -868, -3461, -3716, -2119,
-    -1852, -3172, -2838, -2228, -1829, -2341, -1573, -535, -1309, -1234, -3273, -2758,
-    -1700, 985, 32, -296, 965, 938, 121, -599, -13, 379, 399, 860,
-    2068, 1176, -29, 1673, 933, -830, 409, 1444, 370, -712, 1059, 2678,
-    1808, 1506, 2597, 728, -840, 167, 770, -835, -856, 831, 851, 269,
-    1706, 386, -1025, -2547, -2034, -2956, -3655, -2836, -2441, -1808, -1538, -467,
-    -560, -2583, -3087, -1692, -929, 996, 3180, 3146, 1076, 589, 1025, 1886,
-    2349, 3429, 3275, 2515, 3133, 3635, 2175, 707, -253, -1170, -354, 1024,
-    1716, 329, -1238, -1815, -3042, -2124, -2101, -2448, -3049, -3576, -2451, -3109,
-    -4386, -3509, -3857, -3746, -2909, -2422, -2325, -4122, -2594, -1486, -1779, -912,
-    1503, 612, 67, 1228, 1971, 1515, 2501, 4333, 4971, 6655, 6740, 6133,
-    4507, 3307, 2722, 2421, 3178, 3017, 1990, 1916, 1992, 1562, 633, -1486,
-    -1746, -3438, -2337, 312, 1087, 387, -419, -1121, -2273, -3777, -1791, 411,
-    888, 1011, 1571, 541, -1148, -344, -1145, -2591, -184, 1241, 1048, 531,
-    756, 654, -1857, -2447, -113, -1058, -1675, -1196, -1546, -2756, -1809, -1311,
-    -2629, -1705, -99, -1099, -2484, -2152, -770, -1485, -1854, 958, 1921, 1554,
-    810, 1853, 635, 614, 2637, 2267, 3536, 4231, 4891, 3619, 1172, 3043,
-    1727, -834, 1115, 1928, 559, 681, 1356, 702, -677, -979, -762, -2635,
-    -1946, -16, 839, 226, 581, 469, -2559, -4151, -1697, -588, -828, -999,
-    -1638, -1154, -1523, -2365, -2578, -3155, -1627, -1585, -1347, -459, 2356, 1041,
-    -1834, -792, 1511, 365, 1707, 1047, 848, 2705, 2833, 1870, 1374, 2400,
-    1910, 1705, 780, 1066, 225, -1632, -389, 1427, 1152, 337, -352, -2351,
-    -3566, -2079, 185, 8, -602, 308, 643, -258, -500, -167, -2383, -2914,
-    -1223, -351, -700, -454, -1666, -2251, -427, 411, -13, -627, -467, 532,
-    1577, 1817, 3194, 2396, 1145, 1265, 3152, 4424, 5000, 3405, 1422, 1883,
-    3072, 3218, 2034, 550, -673, -417, 470, 308, 61, -1380, -2125, -1553,
-    -1909, -1616, -2140, -4288, -5194, -3236, -552, -80, -1294, -2950, -3053, -1143,
-    -1308, -1945, -2620, -3026, -1033, 1510, 1035, 995, -321, -2492, -1503, 1008,
-    2720, 4083, 3346, 2675, 2722, 4554, 3579, 1718, 1972, 2087, 3067, 3621,
-    2649, 833, -901, -596, 605, -23, 748, -570, -2016, -1946, -282, 269,
-    -426, -1900, -2661, -1087, 695, 1028, 321, -1908, -3042, -1597, -487, 777,
-    -7, -1489, -1607, -366, -324, -1775, -2389, -1493, -448, 1029, 36, 220,
-    -1011, -2533, -2623, -1037, 427, 1833, 55, -620, 525, 559, -607, -2280,
-    -3652, -1643, 131, 2051, 1531, 535, -997, -1216, -441, 723, 2634, 3406,
-    2541, 3302, 4971, 4918, 2446, 1182, 2509, 3951, 5008, 3946, 1907, 61,
-    -614, -218, 312, 1125, 159, -1835, -2220, -432, 284, -998, -3363, -4813,
-    -2915, -577, 161, -868, -2104, -3473, -3736, -3699, -1998, -955, -3022, -4097,
-    -1662, 254, -1794, -4107, -4415, -3342, -1023, 1030, 1243, -717, -1310, -689,
-    329, 1549, 2722, 1641, 875, 3569, 5419, 3987, 2023, 277, -1903, -1943,
-    1432, 3611, 1303, -1174, -1029, -792, -1067, -274, -527, -1145, -795, 1394,
-    176, -1805, -1157, -1511, -1878, 878, 2782, 1739, -713, -2431, -1765, -658,
-    -196, -598, -323, 280, 1612, 2530, 1714, 1041, 1155, 628, 596, 2829,
-    4526, 4898, 3057, 2261, 889, 1784, 2796, -535, -985, 1256, 3586, 162,
-    -1354, -2185, -4112, -5128, -3184, -1891, -2246, -4071, -4741, -4190, -3498, -2262,
-    -3932, -5149, -2503, 813, 150, -1803, -1399, -1893, -2579, -3397, -1474, 997,
-    1282, 93, 118, 544, 1890, 2035, 464, 806, 4335, 4885, 2105, 1477,
-    1886, 4030, 3450, 3728, 5309, 4402, 3138, 1377, 1636, 1478, 472, -223,
-    -427, 1657, 3375, 1615, -612, -970, -317, -467, -1146, 413, 1210, 1114,
-    1427, 303, -497, 121, -1046, -2473, -1204, 1832, 1715, -826, -2612, -2043,
-    -3279, -4195, -3776, -2882, -2583, -2830, -1879, -1370, -1927, -894, -2985, -3548,
-    399, 2982, 1967, -823, -1889, -771, -720, -1619, -1424, -295, -247, 101,
-    -527, -179, 387, -693, -1008, 1234, 4139, 3825, 1108, -676, 1011, 3304,
-    3848, 3697, 4385, 3964, 4215, 2299, 896, 1919, 707, -1607, -707, 1917,
-    2437, 1006, -1146, -2048, -1426, -412, -1436, -836, -617, 127, 150, -1679,
-    -1645, -1490, -3103, -3941, -2205, 170, 386, -877, -2291, -1593, -2247, -2556,
-    -2356, -2508, -2941, -306, 349, 1245, 1336, 601, -858, -8, 2041, 3512,
-    4375, 2716, 787, 1465, 2295, 1050, 992, 913, 552, 307, -133, -403,
-    -1318, -1587, -2292, -1314, -357, -890, -2314, -4929, -4654, -2399, -1246, -901,
-    -604, -1490, -316, 171, -414, -851, -1075, -918, -425, 613, 1866, 2904,
-    2434, 1844, 2497, 2495, 3100, 4201, 3074, 4124, 5464, 4064, 2526, 2061,
-    2393, 1993, 882, 1489, 2089, 2286, 359, -608, -864, -2008, -3196, -4329,
-    -4313, -3153, -2911, -2205, -1198, -2661, -2844, -3752, -3034, -1384, -458, 224,
-    -776, -418, -605, -1151, -950, -1012, -109, 295, 249, -791, -389, -24,
-    715, 681, 849, 606, 1646, 1382, 914, 1258, 3099, 3514, 2372, 2587,
-    2425, 2773, 3045, 713, 10, 838, 167, -1860, -2653, -71, 574, -186,
-    -822, -541, -142, -1014, -246, 1108, 1456, 1499, 189, -44, 1420, 2269,
-    1498, -611, -58, 1616, 1329, 266, -472, -1047, -2545, -4452, -3204, -2892,
-    -3484, -1743, -1743, -986, -638, -2381, -2433, -3451, -1097, 1413, 2056, -245,
-    158, 675, -754, 307, 1664, 431, 141, 479, 855, 1280, 2179, 1574,
-    293, -549, 1193, 2590, 2763, 1602, 2904, 3315, 1828, 2560, 3075, 2256,
-    1427, 1347, 1281, 947, 1502, -346, -1753, -882, 1168, 1656, -198, -440,
-    322, -427, -1368, 43, -8, -1305, -1774, -2479, -1706, -1174, -1037, -2409,
-    -3768, -3205, -819, -283, -2271, -3656, -2371, -2781, -2220, -2670, -1952, -942,
-    -339, 564, 1171, 1768, 1506, 441, 292, 2513, 3767, 2033, 1377, 2415,
-    1563, 1605, 2516, 1644, 702, -1790, -1528, -703, -458, -1021, -2490, -3079,
-    -4113, -2499, -2123, -1997, -1696, -808, -493, -721, -1105, -1208, -967, -120,
-    -209, 743, 2172, 1637, 1340, 866, 1823, 2855, 3247, 2875, 2527, 5552,
-    4488, 3303, 3882, 3919, 2782, 1573, 2276, 3279, 3884, 1999, 692, -982,
-    -590, 246, -1928, -2772, -1551, -2376, -4958, -5588, -5245, -5558, -5408, -4176,
-    -4193, -3636, -2289, -2025, -2650, -4098, -2779, -1839, -1455, -2115, 1285, 2793,
-    1314, -161, -414, -1287, -562, 835, 1580, 1064, 1052, 1782, -271, -142,
-    913, 1484, 1809, 3132, 5480, 3411, 1262, 1864, 237, -286, 1504, 2775,
-    2397, 545, 1152, 475, -2015, -1276, -64, -434, 582, 2437, 3916, 1176,
-    -1046, -677, -5, 1111, 1244, 1871, 2484, 1720, 1218, 473, -1040, -1441,
-    -1921, -2119, -796, 950, -1413, -4683, -5480, -5155, -4661, -2738, -1060, -3206,
-    -2682, -1042, -1999, -3964, -4106, -2757, -2335, -1224, 1601, 3411, 1052, -1671,
-    -3243, -2502, -1143, 388, 2158, 1000, 1505, 1523, -125, -799, 833, 1855,
-    1013, 2823, 6212, 5235, 2297, 439, -71, 985, 1653, 2879, 3200, 3326,
-    4395, 5140, 3023, -7477, -11705, -6675, -2750, -338, 1133, 4430, -7290, -10816,
-    -499, 6510, -4554, -6378, 2596, 10013, 7293, -1419, -235, 6550, 8185, 1573,
-    -3868, 4290, 14395, 10615, 1413, -10144, -6342, 6569, 11735, 4558, -6738, -2134,
-    -3179, -11823, 4464, 4694, -7264, -11241, 808, 1694, -4825, -8573, -10020, -4017,
-    -9058, -16608, -11542, -126, -569, -2454, -5962, -11517, -12627, -8853, -5901, 101,
-    301, -1824, -6094, -2899, 3215, -611, -601, 2649, 6018, 5641, 6767, 7102,
-    7941, 9563, 11220, 11509, 10611, 11528, 13464, 13559, 9077, 10688, 14274, 8410,
-    5584, 10091, 11255, 6954, 2394, 5686, 11106, 10891, 7519, -296, -3285, -257,
-    1237, -5303, -7713, -1700, -1219, -4970, -14409, -16495, -6237, -1099, -4631, -12889,
-    -17947, -8655, -6875, -14386, -10700, -6940, -10507, -9360, -4642, -6636, -12225, -15064,
-    -11615, -841, -1989, -7727, -9437, -9182, -7596, -166, 829, -4416, -5187, -3189,
-    1533, 4035, 5987, 741, -1709, -1445, 1433, 4586, 5533, 3601, 5856, 11278,
-    13262, 11433, 5522, 7250, 11562, 12648, 17549, 20632, 14368, 5327, 3537, 3902,
-    7622, 11929, 7920, -2860, 2581, 10757, 12912, 2082, -7016, 3886, 12148, 9979,
-    3055, 797, -1226, -2629, -8543, -5658, -170, 2951, 4182, 1370, -7814, -11708,
-    -10150, -4435, -1987, 1292, 2903, 384, -3460, -2847, -1442, -5827, -4442, -3625,
-    -8283, -11498, -16086, -15110, -6733, -2015, 1867, -1860, -6650, -12148, -9062, -136,
-    -1513, -7239, -8370, -12290, -14340, -7515, -3268, -4556, -6085, -2196, -1005, -10314,
-    -8445, 1420, 848, -5720, -5609, -4555, -2923, -3316, -2909, 174, 2507, 3171,
-    -256, 74, 5097, 7139, 1384, -2292, 1247, 6688, 7587, 3320, 5450, 11743,
-    7485, 3459, 2923, 2732, 8140, 11469, 10475, 10341, 12860, 8153, 6266, 7675,
-    6273, 6744, 10618, 10235, 3490, 5554, 7458, 7343, 3180, 6264, 8855, 8802,
-    5816, 3906, 5755, 5904, 3772, 2001, 4246, 6003, 3609, -17, 732, 3003,
-    6108, 4010, -1381, -1048, 778, 1777, 3261, 3692, -195, 4758, 8101, 5388,
-    -3617, -5777, 369, 1098, -4840, -491, 3383, -4340, -6391, -2939, -5176, -5442,
-    -1040, -1457, -4712, -6957, -4094, -4569, -11048, -11421, -10069, -7918, -6868, -13382,
-    -10599, -4881, -6957, -6177, -862, -5582, -12133, -8947, -11148, -16935, -20119, -16739,
-    -7426, -3469, -2806, -7527, -6896, 1124, 3899, 163, -4453, -5579, -4872, -7885,
-    -11583, -11632, -11426, -13847, -12687, -10228, -9293, -5558, -3450, 4153, 10436, 5454,
-    -2914, -1546, -3309, -4164, 3734, 2433, -3366, -3913, -6486, -3331, 6376, 3216,
-    3217, 11737, 15386, 14173, 7005, 4021, 741, -2692, -7553, 1888, 6324, 3145,
-    7458, 10933, 11894, 11908, 11075, 15364, 8880, 6802, 7369, 4057, 2463, -422,
-    2917, 4971, 1431, 794, 5399, 4654, 10175, 9481, -2308, -450, 3999, -558,
-    2332, 5207, 7907, 10914, 11376, 6420, 2396, 6513, 5971, 3560, 8657, 12973,
-    11218, 1083, 2099, 1581, -1465, 6167, 5296, -7895, -1271, 8938, 4293, -5359,
-    -4773, 737, 3632, 2022, -5667, -6950, -8292, -8172, -5253, -3062, -3524, -7101,
-    -1981, 355, -985, -2474, 159, -750, 271, -1762, -8906, -13846, -9239, -10106,
-    -10186, -8853, -5212, -6558, -7775, -4279, -2841, -4558, -6050, -6992, -4926, -3794,
-    -5327, -5109, -4655, -1705, -36, -1781, -3036, -6330, -6356, -3090, 217, -542,
-    -5451, -5388, -4146, -2993, -5280, -546, 2116, 89, 720, -3034, -281, 2558,
-    -1942, -2380, -1198, 1104, 2328, 3661, 4378, 4632, 4525, 2130, 5568, 4683,
-    3264, 4110, 6950, 7767, 7366, 6438, 6713, 8072, 6495, 3990, 6098, 11425,
-    8628, 2500, 5043, 8706, 7760, 6037, 6803, 5804, 1204, 883, 4697, 4077,
-    338, 4825, 1474, -1191, 2570, 1901, -2246, -4590, -3182, -527, 1685, 1513,
-    -4804, -5451, 192, 3085, -179, -3170, -4551, -1765, 2638, 1185, -2436, -4260,
-    -6629, -6944, -1262, 1684, -947, -4143, -3798, -3699, -5303, -5512, -2587, -3770,
-    -7406, -4422, 2524, -2264, -6326, -7734, -8773, -5408, -7535, -8524, -11229, -4714,
-    -319, -2026, -2282, -8339, -5730, 830, -1542, -10615, -7360, -3739, -3139, -1372,
-    -2602, -1520, 2432, -2409, -1349, -7877, -7572, -5693, 1026, 3616, -339, -3835,
-    -4173, -4730, -4479, -2822, -122, -509, -1377, -3350, -1248, 2590, 3361, 3892,
-    1644, -1504, -2706, 2762, 6299, 4756, 1505, -1326, 1415, 1828, 4260, 4482,
-    3850, 1817, 3807, 8358, 9249, 3699, 4865, 1464, 2394, 5426, 5521, 4629,
-    3092, 6516, 5494, 882, -998, 1150, 2003, 6721, 6217, 7556, 10004, 1356,
-    2581, 6330, 6277, 2181, 1838, 2156, 2321, 7336, 5417, 955, 3032, 6235,
-    5739, 8522, 5729, 1850, 4962, 5283, 6434, 8572, 4637, 7230, 6818, 8679,
-    8075, 4465, 2561, 160, 5283, 6455, 7815, 6281, 1895, -416, 2287, 2681,
-    2102, 1240, 2140, 1207, -866, 483, 1427, 4054, 3560, -540, -5186, -2033,
-    269, -2400, -2216, -2650, -2505, -6210, -2810, -2867, -3586, -6033, -5766, -3209,
-    -880, -773, -6933, -7651, -7538, -9380, -8502, -8031, -9197, -6764, -5106, -8513,
-    -8770, -3512, -5007, -11217, -8956, -5142, -10390, -8969, -7729, -5129, -9286, -9147,
-    -4217, -7937, -10329, -11117, -10879, -13028, -11439, -9339, -9638, -8094, -10385, -13604,
-    -12309, -12014, -12750, -12444, -10177, -8037, -7354, -8793, -8649, -9864, -10245, -8719,
-    -6835, -6450, -7005, -4511, -3604, -7989, -7719, -4033, -6279, -4529, -3247, -1223,
-    -1493, -4423, -4887, -3289, -5633, -4866, -2345, -2794, -2906, -326, -2912, -2020,
-    -2449, -3412, 625, 3263, -1650, -1613, 944, 4811, 4104, 995, 5380, 6987,
-    5918, 3353, 7305, 7786, 8186, 9487, 4887, 4517, 6720, 7544, 10544, 14123,
-    11951, 8960, 4015, 1635, 6460, 10790, 11407, 6380, 5704, 10859, 7109, 13387,
-    10640, 6041, 13178, 10160, 10348, 16643, 12369, 9583, 3331, 3844, 8104, 13453,
-    14928, 12020, 12030, 14026, 14896, 15371, 12956, 14872, 14505, 8712, 10185, 7744,
-    9729, 13593, 13133, 12669, 10804, 7054, 8798, 12824, 15065, 11581, 7087, 7861,
-    4815, 5610, 5524, 959, -2443, 1075, 2392, 932, 864, 5366, 11404, 9202,
-    2871, -971, 1490, 3787, -2405, 1179, 3578, 2647, 1641, 80, 537, 439,
-    755, -854, 1771, 1301, 307, -4652, -5400, -1183, -4967, -1894, -2511, 884,
-    373, -7093, -3491, -4445, -3223, -1333, -3055, -3688, -5755, -8304, -6157, -7413,
-    -6698, -9586, -13923, -10890, -8153, -8309, -4953, -2721, -5437, -9098, -8075, -8737,
-    -6970, -6762, -7723, -6471, -4079, -9287, -7125, -6753, -7815, -7256, -9159, -9392,
-    -9658, -11192, -12561, -7155, -2000, -4808, -11242, -12279, -7535, -5086, -4334, -6670,
-    -10911, -7881, -7140, -4867, -3973, -3034, -6673, -7924, -6837, -10019, -8342, -7864,
-    -3923, -7687, -5521, -2821, -7195, -7046, -8458, -10276, -8450, -6406, -7718, -6963,
-    -3585, -4124, -3854, -5097, -5937, -3410, -4517, -1267, 131, 150, -3186, -6302,
-    -4598, -4681, -2191, 643, -1379, -3502, -1540, -1292, -2766, -834, -2447, 1967,
-    -1006, -5486, -5336, -1531, 213, -1987, 1723, 3696, 2205, 2171, 839, 2435,
-    1876, -333, -2214, 160, 2429, 992, 559, 2037, 2107, 3519, 6166, 6625,
-    3104, 3823, 4855, 6456, 4440, 4104, 5385, 6644, 3919, 932, 4582, 7537,
-    5582, 7762, 7639, 5280, 3431, 1998, 1687, 1162, 4538, 6575, 6227, 3472,
-    2682, 4003, 8675, 11174, 12704, 10345, 9593, 11987, 12682, 11649, 12315, 11820,
-    7585, 7360, 10522, 12540, 9765, 8583, 8010, 9668, 11672, 10812, 11196, 7262,
-    6854, 5497, 6703, 8112, 8294, 6925, 7969, 7373, 4323, 4740, 7546, 9836,
-    5795, 5534, 6529, 4442, 4859, 2263, 3460, 4762, 4238, 4384, 4074, 5875,
-    5251, 6897, 11270, 9844, 10629, 6712, 4352, 5200, 5158, 8314, 7890, 5117,
-    2207, -1034, 1295, 1705, 16, 781, 402, -1510, 2327, 4352, 2207, -3563,
-    -6402, -4453, -1872, -2420, -3223, -6348, -6565, -3405, -586, -1599, -6180, -6506,
-    -4169, -6522, -7174, -8891, -11152, -9582, -5992, -5140, -6778, -10091, -9409, -8130,
-    -7656, -5019, -5857, -8071, -6788, -4885, -6629, -7693, -4884, -5598, -9213, -10808,
-    -11931, -10960, -11814, -11668, -8183, -7150, -6124, -10068, -10015, -4785, -7654, -9118,
-    -7669, -10725, -13390, -12450, -9593, -11916, -8124, -6832, -12455, -11777, -7888, -8797,
-    -9290, -10688, -10106, -8834, -7248, -8186, -5037, -3057, -6193, -8299, -5273, -4581,
-    -3448, -8979, -10910, -6661, -4400, -6296, -6065, -4850, -2606, -3082, -5870, -3687,
-    -1146, -2611, -5113, -7314, -5500, -4474, -7438, -5746, -2786, -2014, -2260, -2843,
-    -4190, -2890, -1612, -1536, -1217, 2542, 1054, -415, -779, 1283, 1975, 1643,
-    -43, 1622, 3582, 4288, 3061, 3309, 3136, 3148, 2670, 2874, 3771, 2540,
-    2977, 1003, 1221, 3304, 2903, 768, 1082, 2926, 5262, 4466, 4084, 3040,
-    5810, 5635, 6446, 4841, 7410, 9348, 6674, 8129, 5414, 7800, 9645, 9943,
-    11790, 12302, 9829, 7886, 8425, 11250, 10801, 11597, 11108, 11354, 11934, 8863,
-    8129, 8867, 10934, 8381, 10193, 9855, 6073, 3836, 3010, 8067, 5961, 6629,
-    5175, 3719, 5164, 6061, 8566, 5685, 5876, 9787, 8678, 3485, 3588, 4250,
-    4862, 8940, 8921, 9899, 7557, 5936, 6648, 7090, 6589, 6032, 4227, 3357,
-    6389, 8331, 6974, 2753, 882, 650, 4353, 5932, 7497, 4827, 2969, 2256,
-    1764, 4202, 4108, 3682, 923, -296, -971, -1786, -514, -439, -595, -532,
-    1369, 654, -876, -2388, -639, -3905, -4324, -1705, -1866, -2870, -1025, -2087,
-    -2780, 202, -398, -778, -282, -2646, -3529, -2985, -647, -2342, -1828, -2151,
-    -4507, -3989, -1983, -150, -93, 770, 677, -1007, -5176, -3643, -475, -372,
-    -738, -943, -3483, -3048, -5933, -7758, -8328, -8082, -8513, -7322, -3652, -2739,
-    -5890, -5415, -4969, -6856, -4813, -4044, -3930, -6591, -6307, -5883, -6695, -5867,
-    -6809, -9442, -9918, -6867, -4909, -4088, -4431, -7362, -9300, -6702, -4049, -4549,
-    -5750, -8673, -11399, -8614, -7603, -7230, -8637, -10168, -7894, -7962, -8176, -6310,
-    -4788, -7900, -10589, -9304, -6735, -5491, -6593, -5435, -6842, -8745, -8762, -5532,
-    -4589, -3619, -3546, -2719, -1286, -1647, -5862, -8331, -5389, -2817, -4435, -6473,
-    -6435, -6174, -4148, -4502, -4820, -5251, -3869, -3127, -1403, -1552, -4948, -378,
-    -1677, -5010, -6356, -2988, -719, 319, -1002, -1679, 796, 138, -8, 2744,
-    4597, 2893, 2824, 4988, 5638, 4104, 5444, 3502, 4214, 6643, 8708, 8269,
-    3718, 600, 4452, 9063, 7800, 6411, 7265, 3834, 3994, 5945, 7516, 3405,
-    960, 2012, 4749, 5359, 4459, 2425, 487, 612, 5184, 7987, 8591, 6520,
-    4315, 6588, 8863, 11933, 11541, 6283, 5286, 10861, 10689, 9854, 11132, 8653,
-    4671, 6098, 7354, 7199, 9913, 9338, 7916, 10058, 9295, 8922, 6170, 8258,
-    10855, 11197, 12159, 9841, 6252, 6203, 5809, 2564, 3890, 7711, 8844, 6305,
-    6057, 6839, 1547, 3153, 7398, 6876, 3874, 5689, 7349, 2588, 2698, 3644,
-    1857, 1607, 2365, 3243, 2016, 2137, 3351, -34, -695, 4088, 5659, -1313,
-    261, 4323, 1998, 769, 350, -49, 2660, 3172, 1393, 4651, 6651, 1007,
-    -1205, 1784, 743, -961, -1944, -2685, 310, 2878, 243, -2916, -4763, -7195,
-    -6468, -5830, -4580, -3520, -3863, -6786, -6507, -2408, -1481, -5875, -7542, -7999,
-    -4770, -1142, -2652, -5996, -7654, -4944, -5052, -1792, -2773, -3926, -5072, -2757,
-    -4888, -4169, -4473, -4649, -4658, -4612, -3039, -5303, -6088, -5602, -6009, -6223,
-    -6515, -7771, -3317, -1712, -4934, -9062, -7786, -4118, -2925, -5636, -6756, -7794,
-    -6502, -6406, -5987, -2910, -4641, -6538, -5637, -1540, -2444, -5857, -5518, -4392,
-    -2677, -2002, -2252, -3685, -3771, -766, -1627, -2841, -3438, -5007, -5102, -3821,
-    -3818, -5050, -6429, -7079, -6874, -8145, -6553, -2340, -1784, -3545, -666, 2881,
-    3884, 540, -856, 833, 554, -1501, -1791, 505, 686, 114, 853, 2039,
-    2782, 3960, 1749, 2108, 1875, 1076, 1931, 648, 170, 1797, 748, -2815,
-    -5169, -3456, -1497, -2488, -3055, -2773, -3151, -4217, -1717, 2753, 474, -3014,
-    -2782, -1529, -3565, -2788, 708, 1444, -100, -512, -247, 471, 2120, 221,
-    -972, -178, -31, 467, 2995, 5181, 6310, 4019, 3576, 5706, 4689, 2302,
-    3239, 3803, 4122, 3230, 589, -150, 2068, 4467, 1616, 1785, 5533, 5584,
-    2573, 3133, 4094, 1333, 1161, 5031, 3226, 1726, 2708, 2562, 2838, 3837,
-    4814, 3193, 1386, 1935, 5463, 4244, 3211, 2457, 2608, 2771, 3685, 5648,
-    4152, 2795, 1946, 1033, 1737, 1257, 1453, 3021, 3441, 5430, 7228, 7896,
-    6421, 7217, 7883, 5231, 6273, 6333, 6259, 7626, 9588, 7386, 5862, 4035,
-    4117, 5949, 4479, 6549, 5288, 4223, 2142, 823, 2438, 1136, 796, 1945,
-    2957, 2346, 3211, -51, 318, 2695, 3762, 3244, 3236, 5123, 5003, 2696,
-    2167, 3651, 4153, 2378, 1725, 1070, 557, 2239, 1524, 2570, 3394, 699,
-    431, 3286, 2109, 785, 1212, -2106, -3471, -2423, -561, -3093, -4248, -3829,
-    -2506, -2398, -3878, -3911, -2212, -1236, -3223, -2486, -369, -1372, -2213, -1994,
-    -1332, -1155, -3151, -4803, -3718, -733, 327, -2117, -6759, -7740, -5926, -5387,
-    -3960, -4685, -4055, -3524, -4259, -6129, -5958, -5419, -6189, -6525, -4881, -5217,
-    -6090, -4541, -1904, -3767, -4789, -3795, -3815, -3999, -1762, 1099, -585, -3048,
-    -2711, -1944, -1410, -158, 415, 631, 434, 335, 351, -353, -2477, -2259,
-    -453, -1554, -1867, -3802, -4401, -3697, -4309, -4406, -3443, -3948, -6567, -6666,
-    -5388, -4657, -4392, -6050, -3968, -5192, -6329, -4398, -1949, -2603, -3378, -2180,
-    -1532, 373, 2145, 2085, 4421, 3762, 1063, 418, -436, 1423, 1578, 1483,
-    2012, 1569, 1343, 999, 2531, 2704, 2250, 527, -1097, -195, 2313, -264,
-    -1112, -491, 695, 1379, 2718, 1058, -921, -1540, -1524, 395, 969, 91,
-    -1482, -3378, -1683, -898, -2606, -2569, -4157, -2847, 1549, 1780, -2612, -4674,
-    -3890, -2384, -2195, -2382, -1608, -3308, -4056, -1976, -3146, -3336, -2219, -2991,
-    -544, 2376, 1285, 1456, 2883, 2213, 3272, 3874, 3285, 1338, 2983, 6651,
-    5793, 906, 2246, 2788, 1744, 758, 1346, 374, 2262, 3317, 2305, 1125,
-    1124, 3478, 6223, 3083, 1062, 545, 395, 1241, 3673, 5042, 432, -2046,
-    951, 2831, 3408, 2841, 1627, 2062, 3177, 6055, 8926, 7183, 5513, 4454,
-    3347, 6856, 8135, 5481, 4706, 3962, 3486, 4015, 6832, 7317, 4883, 3306,
-    4290, 2547, 3808, 6293, 4881, 3087, 3282, 3775, 3488, 4263, 3811, 1098,
-    694, 3053, 5065, 7463, 6666, 4147, 2735, 4256, 6391, 6854, 5780, 6215,
-    6915, 5356, 2094, 995, 955, 904, -326, -1405, 299, 2220, 231, -1016,
-    1070, 485, -3736, -1483, -1057, 1057, 3989, 691, -1387, -319, 360, 1651,
-    3405, 1227, -980, 909, 1338, 1632, 2184, 3890, 1758, -226, 1290, 1775,
-    -392, -2110, 196, 189, -950, -109, -413, -3939, -3829, -2130, -3174, -6391,
-    -5925, -7563, -7468, -5256, -5348, -7973, -7973, -6520, -7581, -8656, -8205, -5636,
-    -6629, -5207, -3805, -2659, -3231, -3028, -4527, -5819, -4613, -1991, -848, -914,
-    -1415, -257, -1556, -2316, -1770, -924, -93, -1195, -1176, -1848, -1757, -1223,
-    -1553, -4452, -4958, -2094, -1055, -2571, -1490, -1569, -3916, -2626, -177, -1980,
-    -4311, -4830, -4137, -3359, -2047, -4237, -6694, -5574, -3887, -3827, -3335, -2512,
-    -3118, -5182, -6938, -7315, -6696, -6285, -4528, -3812, -5660, -6202, -4571, -6841,
-    -8318, -5547, -3877, -5777, -5384, -4316, -4558, -3997, -2414, -3352, -2340, -3243,
-    -1473, 346, -2295, -2766, -1408, -1155, -1212, -1053, 2065, 2960, 150, -2712,
-    -2626, -1283, -1097, -2055, -155, -2179, -4023, -2900, -3618, -3418, -896, -2280,
-    -5249, -5067, -2275, -901, -2679, -5111, -5185, -3092, -1783, -986, -2348, -2540,
-    -140, 2994, 1487, -796, -2372, -2394, -1760, 673, 2180, 1277, -988, 2403,
-    847, -659, 711, -151, -2734, -1426, 129, -1158, -2208, -492, -262, -2334,
-    -1461, 1569, 980, -743, -2096, -749, 833, 1430, 646, 1636, 2642, 2401,
-    2236, 1105, 934, 2106, 2277, 2047, 4180, 4768, 1813, 1819, 3769, 3415,
-    2056, 738, 3161, 5400, 2659, 2323, 2448, 1891, 3196, 5960, 3240, 1844,
-    3331, 3893, 5135, 7666, 6685, 3747, 3932, 6801, 7527, 6435, 6519, 6275,
-    6180, 8036, 8242, 6901, 6526, 7514, 7030, 6747, 5791, 5761, 5811, 3968,
-    1202, 2526, 3799, 3737, 2274, 1247, 2191, 1722, -297, -220, -547, -1187,
-    -791, -418, 617, 1631, 1156, 2634, 2946, 1451, 1351, 3550, 2706, 2143,
-    3078, 3938, 3428, 5401, 5971, 5944, 7878, 7786, 5218, 5172, 8139, 6101,
-    3343, 4405, 5030, 3232, 4582, 6242, 5781, 3170, 2853, 3931, 3098, 2329,
-    2715, 1674, 2793, 4070, 2337, 2353, 3870, 3384, 1874, 346, -392, 1434,
-    2932, 1906, 1372, 1291, 206, -1040, 281, 504, 712, 737, -2257, -4141,
-    -2918, -3367, -3756, -3006, -2166, 1579, 2355, -1532, -2372, 444, 374, 645,
-    1892, -897, -2026, -131, 766, 428, 1196, 1120, -970, -530, 3575, 2439,
-    -1063, 786, 1619, 14, -988, -461, 1056, 1114, 849, 896, -824, -2576,
-    -1291, -907, -2201, -1655, 206, -322, -355, -916, -2365, -3440, -3662, -1967,
-    -2178, -3877, -2050, -550, -2537, -2774, -2343, -4015, -2633, -307, -802, 45,
-    84, -794, -3037, -3610, -966, 717, -1370, -1652, -1769, -5326, -3764, -2729,
-    -5912, -5827, -2970, -4130, -4435, -4717, -3835, -4899, -7651, -9316, -6701, -5080,
-    -6676, -7491, -5895, -5516, -6156, -5853, -5870, -4806, -4540, -5924, -6695, -4594,
-    -3338, -4409, -5644, -5709, -4921, -6203, -6649, -4612, -5087, -6725, -6039, -3812,
-    -3933, -5714, -5572, -4150, -3488, -3466, -4519, -3708, -2966, -2980, -3036, -746,
-    2050, 1898, 2169, 1551, -98, 355, 1284, 133, 379, 372, 1075, 2202,
-    359, -1355, -1754, -2683, -1505, -434, -2878, -3054, -1410, -3142, -6249, -6497,
-    -3351, -682, -1192, -2384, -2498, -4120, -3758, -4800, -6243, -3619, -2768, -4610,
-    -3113, 238, -147, -1907, -1617, -389, 1189, 2215, 283, 1823, 3276, 2349,
-    3124, 5388, 6610, 7794, 6499, 6402, 6821, 3912, 2041, 3619, 3861, 3230,
-    3962, 3802, 3275, 5252, 5895, 3265, 1952, 1881, 1504, 2246, 3021, 1833,
-    2369, 2834, 2829, 1602, 198, 631, 1742, 2476, 3592, 4648, 2554, 904,
-    749, 1241, 1111, -93, -729, -1187, -1462, 218, 1606, 1454, 157, -377,
-    -127, 260, 247, -3175, -3079, -282, -1995, -2494, -478, 1136, 2710, 3682,
-    4799, 4472, 2549, 2413, 4256, 5229, 3457, 1468, 3650, 5782, 4140, 4663,
-    6276, 5977, 6729, 6255, 3454, 2280, 2376, 880, 1036, 1541, 1509, 624,
-    2775, 2878, -458, -750, 1862, 2633, 648, 732, 2805, 4288, 2878, 2219,
-    3896, 5649, 5474, 1594, 1582, 3520, 3901, 2741, 3045, 3155, 4066, 4080,
-    4756, 3816, 3407, 3599, 3376, 4502, 3627, 4092, 3603, 1419, 1486, 4607,
-    4092, 1357, 61, 1074, 1728, 2271, 1714, 192, -1715, -1751, -228, -376,
-    1320, 1525, -1432, -333, 2936, 1578, -126, 1326, -1226, -1722, -7, 399,
-    -68, 1591, 897, -449, -641, 433, 280, -542, -851, 124, 463, -2438,
-    -2682, -339, 943, 344, 1091, 3428, 3507, 3795, 4313, 4702, 3184, 2262,
-    3114, 3428, 2005, 197, -491, 2884, 3305, 894, 675, 13, -138, 681,
-    -638, -3100, -5084, -5897, -4005, -2573, -4208, -5583, -4809, -4417, -5324, -5472,
-    -5207, -4686, -5746, -6341, -4664, -3555, -6353, -6884, -5776, -5061, -2802, -1866,
-    -2956, -2290, -277, -3320, -3285, 620, -65, -1037, -472, 905, 1432, 2297,
-    1580, -1531, -2419, 654, 719, -1068, -192, -555, -2907, -2336, -1387, -3541,
-    -3315, -3171, -4914, -3428, -2717, -3699, -5303, -3751, -1724, -1428, -2818, -3650,
-    -2313, -1171, -2594, -3180, -3989, -5490, -3828, -3035, -4637, -3444, -3769, -4814,
-    -5758, -6597, -6124, -4797, -5139, -5817, -5188, -5766, -6861, -5971, -5630, -3048,
-    -3547, -5961, -4548, -1920, -1385, -2109, -3309, -2723, -2724, -445, 1490, 160,
-    -602, 244, 1892, 1861, 1402, 1982, 2533, 2240, 1782, 6, -1701, -373,
-    40, -1556, -1870, -1503, -2484, -2591, -610, -1626, -2675, -1348, -234, -2173,
-    -3121, -140, 615, -1683, -2628, -1318, 255, 666, 1885, 2613, 1152, 240,
-    -239, 564, 2125, 2441, 1895, 447, 1528, 3973, 3505, 1578, 1411, 1624,
-    1199, 3408, 3664, 1452, 1881, 2729, 1978, 630, -1113, 108, -740, -2877,
-    -2899, -2338, -3507, -2998, -2172, -1192, -204, -910, -1544, -2237, -757, -76,
-    -2215, -2536, -1450, -1812, -1313, -838, -1379, -1233, -1440, -539, 1545, 1938,
-    528, 1344, 925, -952, -1306, 770, 1112, -722, 972, 4148, 4337, 4294,
-    5521, 4895, 4943, 6007, 5431, 5979, 6638, 5047, 5222, 6859, 7149, 5523,
-    4599, 5706, 6765, 5218, 4002, 2567, 1850, 1640, 1151, 1017, 853, 704,
-    -67, 998, 1538, 1739, -5, -1176, -1064, 262, 1675, 295, -193, 197,
-    473, 1502, 1955, 2357, 4543, 5595, 3795, 2496, 3648, 3607, 3795, 3871,
-    3987, 5830, 6694, 6305, 5370, 4798, 3919, 5263, 4622, 4622, 4164, 4085,
-    4506, 3292, 1958, 2163, 2134, 2148, 2034, 2132, 3219, 1486, -1029, -298,
-    1531, 3567, 3280, 1964, 2852, 2980, 2222, 3315, 1221, -1092, 524, 119,
-    458, 1025, -822, -1340, -1862, -3815, -2914, -1506, -3108, -6113, -4800, -2553,
-    -4156, -5783, -4603, -3897, -4405, -3467, -1609, 783, -214, -2549, -179, 2182,
-    807, 647, 947, 789, 2086, 1264, -231, 1370, 3224, 1902, 2055, 3795,
-    3879, 2510, 1108, 1470, 287, -828, -1743, -1966, -2286, -1150, -269, -855,
-    -2392, -4074, -2656, -880, -2353, -3585, -2515, -2011, -2583, -917, 722, 572,
-    982, 2270, 1962, 1034, 2088, 1242, -1045, 342, 1654, 895, 2045, 2430,
-    904, -169, 2312, 4399, 4330, 3379, 3641, 703, -181, 354, -20, -271,
-    136, -651, -516, 18, -971, -2667, -5197, -7114, -5056, -3284, -4603, -7353,
-    -6900, -5892, -5381, -4605, -5444, -6399, -5403, -5705, -6341, -6045, -5082, -4949,
-    -5256, -5784, -4619, -3175, -1937, -1402, -1823, -1906, -1983, -2816, -4512, -4461,
-    -3000, -2318, -2518, -2223, -1097, -308, -563, -626, -473, 209, 2691, 1948,
-    -315, -391, -860, -197, 1585, 831, 1481, 2512, 2545, 1514, -204, -375,
-    528, 720, -700, -1970, -1315, -1984, -2792, -2435, -2959, -4055, -4453, -6274,
-    -4313, -3377, -5400, -5833, -6552, -7618, -6206, -5254, -2990, -1220, -1722, -2509,
-    -1272, -432, -710, -1519, -621, 862, 705, 1012, 1886, 981, 1193, 1992,
-    2700, 1931, 2572, 3527, 1468, -206, -997, -2248, -1313, -729, -492, 1072,
-    1371, 1764, 744, -1001, -1623, 46, 834, 469, 1167, 2576, 2598, 2083,
-    2515, 3248, 3049, 2968, 3214, 2913, 2282, 1186, -721, -1682, -2227, -852,
-    -541, -1463, -1428, -1912, -4344, -4931, -3960, -2040, -2523, -3378, -2405, -1151,
-    126, -860, -1513, 164, 940, 807, 1688, 2791, 3433, 3132, 3372, 3586,
-    3053, 2256, 2045, 2319, 3602, 4220, 2426, 1318, 1568, 1097, 1467, 2579,
-    2555, 993, 819, -245, -1229, -154, -724, -2335, -1427, -1060, 25, 624,
-    -217, -1248, -2493, -838, 489, 477, 2586, 4322, 4087, 2713, 1899, 2996,
-    3145, 4305, 5452, 5371, 6851, 6174, 3858, 3687, 4434, 5582, 7572, 6987,
-    5781, 6307, 5820, 4603, 4408, 4008, 1945, 2515, 2790, 1552, 1352, 2231,
-    -451, -3350, -2867, -3142, -3094, -2003, -1307, -1694, -2751, -2283, -1681, -3018,
-    -2356, -1072, -1911, -856, -662, -1125, -2314, -1947, -687, -1336, -1533, -749,
-    -97, 1112, -476, -1246, 515, 308, 422, 613, 1459, 1826, 315, 1109,
-    1850, 906, 1346, 3879, 2843, 3905, 5417, 5093, 2910, 3172, 3962, 3215,
-    2958, 2552, 3194, 4082, 3131, 1077, 26, 750, 1884, 1120, 623, 1247,
-    -824, -1383, 244, -557, -2673, -1291, -860, -1447, -672, -242, -316, -1530,
-    -1317, -17, -262, -199, -845, 138, 2550, 3062, 1777, 1327, 2748, 2379,
-    976, 3455, 4089, 1945, 1140, 833, 1356, 3126, 3499, 2836, 2850, 2091,
-    3215, 2483, 1605, 594, -231, 211, -39, 528, 907, 82, -1895, -3598,
-    -2064, -710, -2, 123, 93, 172, 787, 229, -207, 331, 1133, -9,
-    193, 788, 242, -2054, -2912, -4566, -4720, -4140, -5203, -7221, -6347, -5403,
-    -5089, -6140, -6272, -5897, -5278, -5523, -5168, -5069, -5135, -3476, -2398, -2168,
-    -471, -47, -572, -460, -15, 891, 928, 24, -561, 425, 356, 709,
-    1296, 82, -258, 52, -1130, -692, 454, -495, -1630, -2151, -3554, -3113,
-    -2623, -3703, -2844, -1833, -2411, -2896, -3394, -3998, -3554, -1853, -2264, -2150,
-    -1745, -775, -415, -493, 861, 2583, 3318, 3297, 4392, 5300, 3755, 4066,
-    4492, 4172, 4243, 4196, 4711, 5035, 4820, 4050, 3035, 2462, 1538, 1358,
-    309, -1280, -957, -600, -2191, -3131, -2713, -3846, -4099, -2323, -3707, -4108,
-    -4371, -4215, -4370, -3435, -3368, -3195, -2819, -3020, -3017, -3081, -3825, -3738,
-    -3881, -3261, -2396, -3116, -4103, -3701, -2653, -2231, -1305, -1277, -1471, 107,
-    811, 1001, -287, -1069, -747, -292, -286, -698, -217, 487, 1575, 1796,
-    1620, 1884, 1536, 495, 887, 2428, 1746, -272, 350, 1361, 1539, 42,
-    -649, -99, 358, 1326, 1744, -933, -2006, -864, 895, -395, -1112, 888,
-    302, -1587, -1092, -1010, -1802, -2116, -1401, -1658, -1068, -25, -25, -543,
-    -62, 344, -243, -333, 1922, 3336, 2318, 1652, 1832, 1364, 2809, 4544,
-    4109, 3082, 4412, 5821, 4813, 2767, 1840, 859, 1502, 2626, 4017, 2967,
-    1258, 1198, 1656, 1136, 1119, 768, -20, 50, 2286, 2556, 1199, 288,
-    1225, 2449, 4580, 5056, 4615, 3790, 2995, 3106, 2003, 1446, 2120, 1749,
-    -1000, -2134, -1050, -1340, -2703, -3506, -3681, -4092, -4489, -3634, -1726, -3501,
-    -4881, -3998, -3819, -2583, 975, 1883, -65, 2625, 3693, 2931, 1832, 2753,
-    2862, 3198, 2702, 2499, 1737, 1273, 1893, 2377, 1258, 975, 1240, -667,
-    1054, 2945, 1336, -513, -2045, -1656, -1989, -1749, -286, 731, -1886, -3129,
-    -1587, -1039, -1841, -1145, -1953, -3019, -2226, -531, 773, 401, -93, 196,
-    843, 1888, 3115, 4635, 4648, 4662, 4035, 3993, 5339, 6775, 7052, 6119,
-    5330, 4626, 4945, 4581, 4299, 2851, 2363, 2754, 2225, 1584, 1610, 600,
-    -343, -288, -747, -1197, -2392, -2802, -2625, -2331, -4019, -4471, -2973, -3865,
-    -3486, -863, 385, -1939, -2584, -2218, -1572, -459, -599, -2242, -2582, -1166,
-    -613, -743, -1737, -2619, -2967, -2894, -1770, -199, 301, -911, -2882, -2549,
-    -979, -1933, -2781, -2042, 271, 78, -9, 944, -421, -871, 570, 1374,
-    119, -463, 500, 365, -423, 511, 2371, 1466, -97, 898, 1985, 1215,
-    1458, 1056, 38, -584, -1236, -806, 299, -738, -2495, -2009, -1537, -574,
-    1100, -323, -1594, -1609, -1194, -211, 433, 261, 21, 307, -308, -295,
-    119, 557, 1120, 45, 1243, 3225, 2725, 1265, 1391, 1584, 1580, 2131,
-    1467, 346, 918, 1267, 719, -537, -873, 319, 564, 353, 263, 639,
-    -186, -1094, -127, -1336, -1046, -418, -194, -746, -584, 1094, 1841, 1588,
-    917, 99, -1133, -970, -521, -1183, -1864, -2583, -4264, -4117, -2396, -2076,
-    -2766, -5437, -5996, -4131, -2942, -4414, -5213, -4036, -2911, -1915, -2423, -1794,
-    -1525, -940, -616, -128, 566, 1035, 1489, 1391, 553, 116, -513, -557,
-    1137, 1663, 2743, 2260, 1069, 1379, 683, 340, 329, -4, -406, 238,
-    -260, -2086, -2672, -2273, -3042, -3205, -2993, -3470, -2762, -1693, -2368, -2954,
-    -3356, -2501, -682, -1143, -1444, 806, 1994, 2595, 2288, 3119, 2290, 3098,
-    4215, 5713, 7476, 6521, 5615, 5552, 5500, 5216, 4748, 4209, 4160, 4868,
-    2662, 159, 71, -482, -1211, -940, -511, -574, -1498, -1745, -2705, -3866,
-    -4546, -3872, -4054, -4217, -527, -118, -2547, -3145, -2168, -1734, -1612, -1277,
-    -1750, -1849, -781, -754, -2928, -3094, -2362, -1316, -2628, -1606, 867, 773,
-    349, -709, -1057, -633, 77, -974, -961, -80, 1048, -250, -1877, -537,
-    567, -719, -1329, 13, 1511, 1608, -775, -1484, 5, 2000, 1860, -230,
-    1163, 2544, 3541, 2138, 1054, 1195, 1691, 1963, 2744, 3612, 3497, 1562,
-    -389, -26, 1404, 1591, 1085, 811, 1133, 2457, 2616, -472, -1216, -860,
-    -783, -1085, -39, 1484, 205, -1182, -1107, -231, 179, 228, -321, 1220,
-    2622, 2965, 1913, 759, 1812, 1636, 1248, 808, 1746, 1110, 2226, 2582,
-    2525, 2331, 1846, 1153, 890, 1654, 1873, 885, 665, 549, -979, -1332,
-    -1220, 1305, 2740, 1833, 1756, 1131, 846, 1598, 177, -335, 1141, 770,
-    -441, -227, -443, -985, -1811, -2079, -1876, -1573, -1472, -2009, -1962, -1997,
-    -3016, -4272, -4467, -1906, -391, -1671, -1525, 423, 1264, 1804, 1712, 1585,
-    2561, 3659, 4179, 2566, 1688, 1435, 1008, 30, 146, 1327, 499, -43,
-    -32, 345, -194, -1814, -3178, -2786, -1969, -2435, -2726, -953, -346, -1058,
-    -2946, -3156, -2295, -1903, -1468, -1836, -2278, -2277, -1845, -1672, -1599, -915,
-    -770, 65, 1405, 2293, 2382, 2496, 2176, 2287, 3846, 5086, 4461, 4099,
-    4889, 5776, 5039, 3850, 4573, 4431, 3351, 2408, 3065, 3018, 1080, 39,
-    -328, -835, -938, -1714, -3938, -3695, -2985, -3277, -3827, -5083, -4439, -2306,
-    -2073, -1735, -1079, -1509, -1329, -1145, -1357, -567, -770, 577, 593, 1010,
-    -422, -1401, -1699, -1811, -466, 650, -856, -2013, -284, -285, -1067, -2046,
-    -3395, -3399, -3310, -3162, -2113, -970, -288, -83, -1521, -912, 620, 734,
-    395, 973, 37, -616, 414, 703, 902, 587, 216, -364, 942, 3219,
-    3586, 3232, 2204, 2652, 3344, 1831, 1010, 1057, 1050, 1910, 2519, 1703,
-    574, 37, 19, 1289, 2361, 464, -1108, -524, 407, 1308, 540, -565,
-    7, 744, 144, 240, 643, -909, -1893, -1186, 596, 1845, 689, -1112,
-    522, 371, -1102, -258, 183, 151, 1557, 1298, 1001, 1047, -218, -1521,
-    -1828, -811, -2150, -2716, -1540, -649, -404, -1507, -1890, -1161, -1882, -2814,
-    -1753, -2016, -408, 1125, -1101, -2776, -2173, -2459, -2157, -680, -447, -1182,
-    -1803, -1587, -1147, -1599, -2958, -3907, -3857, -2309, -1001, -1129, -2017, -2429,
-    -2908, -2120, -1399, -136, 568, 1442, 1271, 848, 1149, 1788, 2262, 2300,
-    1697, 1374, 378, -126, 591, 686, 789, 1030, 526, 1204, 1037, 662,
-    -917, -1524, -1898, -1985, -2060, -2605, -1646, -968, -1457, -1973, -1992, -2324,
-    -2035, -2774, -1842, 860, 967, -754, 87, 1935, 2013, 1972, 1917, 3076,
-    4353, 4808, 3751, 3873, 3729, 3572, 2782, 2936, 4220, 5835, 5209, 4757,
-    3874, 3277, 3189, 1508, -931, 566, 1302, -707, -1148, -644, -1989, -3747,
-    -3176, -1665, -1313, -2206, -2308, -2601, -2595, -1638, -1048, -1935, -2208, -1112,
-    -1200, -1746, -855, -448, -1332, -1267, -1506, 326, 447, -790, -1625, -1794,
-    -1363, -1023, -1048, -1504, -770, 179, -892, -1881, -1411, -1820, -3973, -4544,
-    -3124, -185, 320, -309, -137, -624, -886, -950, -1052, -679, 21, 1021,
-    404, -567, 499, 562, 765, 2458, 3385, 4393, 3796, 4230, 3979, 2978,
-    2045, 1005, 498, 1493, 3145, 2958, 2667, 3020, 1697, -110, 850, 1018,
-    887, -614, -1206, -1024, 199, 539, 226, 1168, 757, -634, -1492, -853,
-    -260, -475, -1262, -1975, -745, -456, 687, 397, -243, 564, 1570, 2162,
-    2396, 989, 1039, 1924, 1371, 344, -139, -994, -1391, -441, -323, -444,
-    -43, 498, 1311, 1569, 917, -714, -1071, -108, 902, 1020, -129, 386,
-    -721, -829, 439, 718, 146, 146, -81, -35, 507, 989, 595, -102,
-    -522, 118, 477, 1512, 2698, 2377, 489, -568, -619, -699, 1191, 2730,
-    1402, 1024, 1306, 2513, 3102, 1957, 1859, 1791, 1156, 756, -304, -1500,
-    -958, 302, -311, -924, -630, -743, -1203, -785, -1489, -2483, -3634, -4682,
-    -4694, -3545, -3089, -2949, -3408, -4194, -3015, -2460, -3406, -2490, -1553, -945,
-    -1021, -1467, 216, 1340, 2245, 1956, 2206, 2726, 4085, 4911, 3585, 3822,
-    3727, 1978, 2067, 4073, 4837, 3189, 2646, 2494, 3375, 3319, 1059, 84,
-    971, 308, -933, -2281, -2169, -1216, -2141, -3489, -2482, -2055, -3311, -2499,
-    -1218, -1638, -1198, -259, -1591, -2150, -323, 502, -767, -1870, -1179, -392,
-    -1212, -947, 795, 182, -685, -1350, -1216, -1309, 98, -692, -2697, -1297,
-    -409, -489, -427, -176, -1281, -2607, -3593, -3684, -2219, -2618, -1679, -1007,
-    -1627, -1121, 308, 557, 902, 1284, 1384, 400, 744, 591, 1666, 1830,
-    1606, 1802, 2885, 4348, 5524, 5787, 4902, 4186, 3772, 847, -377, 888,
-    2434, 1941, 1696, 1821, 971, -956, 740, 899, -179, -946, -1103, -1144,
-    -1352, -210, -601, -1814, -1087, -204, -1139, -2125, -1353, -1455, -2409, -2252,
-    -1297, -3260, -2381, 93, 189, -1258, -566, -68, -650, -1027, -141, 193,
-    -215, -421, -1001, -1735, -1601, -2242, -3177, -3705, -2240, -449, -1481, -2380,
-    -1299, -1358, -2892, -4451, -3003, -2404, -2935, -3546, -2846, -2135, -1243, -1225,
-    -3071, -2276, -120, 523, -674, 13, 508, -1337, -1628, -647, 227, 948,
-    1606, 2530, 2999, 2578, 2868, 1514, 78, 2161, 3552, 2281, 1060, 1991,
-    2471, 2334, 2281, 2141, 1318, 1145, 1733, 1394, 861, 1084, 589, -725,
-    -1087, 256, 1431, 2353, 2448, 539, -630, -1849, -2029, -799, -215, -879,
-    -1759, -1866, -612, 1312, 1210, -665, -217, 1024, 2082, 2403, 2040, 1113,
-    1245, 2462, 3300, 3213, 3430, 4077, 4306, 4890, 5538, 4673, 1873, 803,
-    2399, 3045, 3895, 1861, 610, 282, -357, -495, -366, -134, -881, -995,
-    -297, -1621, -2511, -3119, -3571, -2718, -2132, -2368, -2018, -878, -78, -207,
-    -1267, -2202, -1479, -1838, -2048, -1622, -1141, -1440, -2017, -2280, -2958, -3155,
-    -3108, -1883, -399, -1494, -2546, -2990, -3477, -2497, -2162, -2997, -3352, -3200,
-    -2844, -2188, -1341, -2450, -3418, -2724, -1122, -65, -426, -754, -1407, -1089,
-    200, 1474, 523, 1076, 2756, 3586, 3082, 3601, 2583, 2735, 3700, 4229,
-    3860, 4064, 3557, 2760, 1900, 1141, 651, 1363, 1230, 1705, 2263, 1727,
-    703, 915, 428, -72, -1389, -1350, -167, 1064, 1266, 106, -1694, -1769,
-    -37, 922, 311, 170, 444, 1103, 1533, 1134, -9, -169, -201, 1492,
-    2455, 2797, 2244, 729, -552, 507, 1242, 806, 665, 2152, 2116, 2008,
-    887, -1068, -204, -419, -1285, -903, -905, -271, -56, -851, -859, -1579,
-    -2626, -1510, -61, 34, -827, -938, -1744, -1968, -1636, -1948, -225, 2112,
-    2614, 1963, 828, -982, 839, 1487, 1064, 1134, 1328, 269, 597, 1697,
-    1843, 870, -879, -1068, 1605, 3517, 2834, 549, -1043, -2164, -143, -937,
-    -1788, -1129, -388, -794, -703, -1828, -2753, -3915, -4125, -3534, -2676, -2406,
-    -3887, -5213, -5252, -3758, -2840, -3853, -3588, -2625, -882, 273, 282, -1522,
-    -2315, -1913, -925, 949, 3108, 3539, 1786, 2022, 3165, 3970, 3944, 3800,
-    3501, 2978, 3066, 3265, 3336, 2367, 1744, 1086, 1142, 3020, 4116, 2034,
-    -1137, -1352, -332, -134, -998, -1138, -955, 766, 1911, 1170, 237, -821,
-    -836, 272, 1650, 3290, 1729, 361, -28, 570, 397, -481, -295, -30,
-    460, 1820, 1368, -518, -1373, -1895, -2833, -2984, -918, 685, 642, -1070,
-    -2204, -1904, -2456, -2390, -1669, -2280, -1935, -1597, -1428, -2201, -2447, -2652,
-    -2077, -715, 1169, 2142, 1582, -524, -1160, -1082, -554, 688, 2214, 2619,
-    3479, 3612, 3229, 2569, 2720, 2339, 2608, 3915, 4431, 3256, 1562, -53,
-    -517, -993, -873, -83, 1156, 1775, 1802, 1183, -824, -1996, -2438, -3122,
-    -2802, -882, 206, 740, -1575, -2449, -1133, -188, 525, -226, -276, -204,
-    -381, 110, -215, -873, -1149, -1144, -57, 1546, 2510, 939, -1362, -1123,
-    -340, 730, 113, -554, -322, -807, -593, -973, -1975, -1933, -1295, -590,
-    -46, 2, -200, -1069, -3082, -3552, -2741, -1887, -1079, -514, -940, -1861,
-    -2105, -1439, -1311, -712, -539, -289, 1298, 1985, 1666, 165, -202, 89,
-    1568, 2041, 1235, 2227, 3240, 2023, 1414, 1806, 1207, 651, 1397, 2232,
-    3550, 3040, 1027, -912, -990, -415, 194, -1221, -2421, -2326, -2610, -2018,
-    -2407, -2522, -2515, -2720, -2016, -1358, -1327, -1598, -2956, -3086, -2634, -1848,
-    -869, -1244, -872, -145, -128, -561, -771, 455, 1300, 1481, 1158, 2557,
-    2718, 1795, 1438, 2195, 2806, 3502, 4152, 3098, 2445, 2861, 2751, 2531,
-    3413, 2505, 1664, 2142, 1495, 387, -1039, -2567, -2626, -1217, -49, -29,
-    -1289, -2365, -1821, -941, -834, -885, 98, 190, 482, 1479, 748, 65,
-    65, 331, 1471, 1949, 1058, -449, -1015, -1289, -1500, -1130, -1786, -2145,
-    -2439, -2793, -2682, -2803, -3456, -4312, -5049, -3480, -919, -1719, -3102, -3168,
-    -4652, -5171, -3608, -2690, -919, 361, -1349, -2009, -373, 1320, 151, 226,
-    423, 997, 1322, 1385, 1302, 884, 520, 672, 871, 1601, 4365, 5175,
-    3318, 3001, 2854, 1979, 412, -160, 924, 1781, 1696, 409, -934, -786,
-    -1425, -1309, -752, -243, 157, 281, -138, -232, -61, 47, -641, -471,
-    1927, 3439, 2600, 1442, 1825, 994, 278, 980, 2582, 3259, 3547, 2778,
-    1029, 773, 472, 231, 146, 592, 1486, 1598, 644, 326, -1036, -2585,
-    -2471, -908, 434, 1491, 2373, 843, -808, -503, -501, -1552, -1385, 445,
-    790, 809, -1020, -2163, -2735, -2732, -1794, -1188, -676, 872, 965, 88,
-    -256, -279, 10, 279, 2003, 2129, 2455, 2086, 376, 418, 1022, 1023,
-    1320, 2071, 2412, 3483, 3279, 1540, -90, -1097, -1354, -248, -545, -787,
-    -1925, -3763, -4151, -4183, -4695, -3859, -3428, -2854, -1935, -1614, -3275, -4590,
-    -3785, -3552, -3469, -2611, -1914, -1679, -1200, -1211, -1836, -2135, -1388, -948,
-    -72, 2026, 3856, 2857, 1518, 1528, 2062, 1971, 2997, 3729, 2893, 3275,
-    3907, 3399, 3068, 3551, 2863, 2403, 2730, 3993, 4245, 2492, 747, -824,
-    -701, 156, 1239, 716, 497, 854, 576, -285, -83, -511, -1291, -176,
-    1658, 3967, 3676, 2153, 927, 765, 1751, 2872, 2316, 2234, 2652, 2215,
-    421, -638, -1354, -2743, -2726, -1197, -964, -2175, -2853, -3382, -3973, -3486,
-    -3628, -3768, -3798, -3307, -2502, -2545, -3563, -3704, -3166, -2613, -2199, -1207,
-    -90, 219, 238, -706, 163, 1636, 1637, 1046, 1000, 1287, 1839, 1799,
-    1974, 2519, 1481, 693, 2148, 3266, 3314, 2769, 1595, -539, -1721, -201,
-    799, 227, -907, -2083, -2899, -2509, -2305, -2824, -3358, -2367, -1225, -1166,
-    -840, -731, -877, -675, -151, -1341, -1084, -204, 1125, 1360, 620, 448,
-    -369, -193, 771, 1739, 1839, 1735, 1567, 1346, -660, -1716, -1186, -970,
-    -1270, -1256, -746, -1069, -553, -741, -1690, -2732, -2410, -1126, -500, -152,
-    -9, -1310, -2324, -1384, -131, -186, -972, -197, 490, 1387, 403, -1355,
-    -1633, -415, 1144, 761, -101, -261, 142, 702, 960, 2202, 1850, 1094,
-    2249, 3658, 3280, 2191, 1243, 1107, 1950, 3130, 4170, 3987, 3444, 3392,
-    2924, 1458, 536, 120, -182, -716, -639, -1316, -2325, -940, -2127, -4212,
-    -3035, -2193, -1039, -504, -1328, -3069, -3889, -4090, -2608, -1762, -1204, -833,
-    -1086, -812, -8, 144, -782, -1029, 31, 881, 1815, 1035, 254, 1593,
-    1911, 2705, 3629, 2234, 2164, 3046, 2694, 1871, 1397, 1368, 957, 1930,
-    2847, 2780, 517, -483, -79, -1264, -1757, -1571, -1770, -2119, -1549, -1543,
-    -2637, -2173, -1553, -1230, -148, 832, 1484, 2318, 2732, 2379, 768, -325,
-    275, 1300, 2220, 2910, 2219, 1212, 819, 360, -188, -1251, -2201, -3205,
-    -3072, -3266, -3472, -4084, -4526, -4891, -4057, -3685, -3921, -3589, -3265, -3294,
-    -2781, -2004, -2351, -1955, -190, 1385, 1302, 1980, 2858, 2673, 3097, 3889,
-    3737, 2865, 2587, 1940, 1521, 952, 770, 844, 1230, 2331, 3031, 1861,
-    897, 833, -125, -1196, -1256, -1288, -919, 519, -428, -1604, -2471, -2815,
-    -2538, -1957, -725, -249, 41, 25, 1170, 1335, 303, -370, -320, -69,
-    1413, 1771, 1534, 1867, 1550, 1582, 1120, 1353, 2168, 2907, 2181, 1981,
-    2407, 1973, 1022, 502, -26, -411, -225, -662, -49, 386, -734, -2141,
-    -1628, -954, -633, -1068, -2246, -1437, -845, -1060, -762, -1072, -1299, -213,
-    -40, -674, 0, 688, -930, -1771, -557, 315, 61, -272, -475, -36,
-    -415, -1055, -1096, -596, 1001, 1927, 1398, 374, -114, -567, 76, 643,
-    1330, 1529, 1843, 2700, 2780, 2618, 1243, -893, -1267, -738, -161, -850,
-    -2060, -3496, -2254, -2188, -2944, -2871, -2719, -2772, -2915, -2684, -2290, -2779,
-    -2874, -2728, -2011, -1420, -1474, -1763, -2074, -1281, -656, -1235, -526, 356,
-    766, 262, 1519, 2567, 2758, 2542, 2794, 3258, 3056, 2878, 2657, 1939,
-    1279, 920, 1531, 2195, 2638, 2335, 1335, 591, 1316, 1248, -66, -1640,
-    -2158, -934, -646, -679, 294, -2684, 663, -937, -110, 1735, 1357, 439,
-    771, 2906, 4433, 2601, 51, 3958, 2941, 3591, 1748, 1178, 1309, 3722,
-    -1030, 1786, -420, -1619, -3666, -1602, -4818, -3384, -1909, -4128, -5695, -2809,
-    -2695, -6441, -2252, -2874, -3652, -3600, -2719, -1386, 1407, 2812, 952, -1175,
-    3212, 4954, 3945, -817, 2226, 2004, -1716, 2139, -1420, -3405, -2497, 2628,
-    4377, 7914, 8866, 3524, -957, -387, -1002, -3065, -59, -2641, -1677, 2082,
-    -1581, 1352, 225, -4675, -1472, -4000, -2662, -1515, -3279, -3850, -3121, -1944,
-    2841, 2959, 5720, 6023, 4381, 6000, 4916, 4157, -1665, 140, 1185, -1994,
-    1190, 2916, 2001, -1915, -1319, -3349, -2507, -157, -2223, -4746, -1329, 1412,
-    -1005, -1490, 2206, 4195, 2749, 3298, 3495, 912, -439, -2969, -5956, -5753,
-    -7210, -5332, -5509, -4650, -3771, 1004, -4810, -5408, -141, 3546, 1633, 4877,
-    7543, 5856, 7367, 4645, 4311, 5846, -244, -993, -1737, -3376, -2478, -3423,
-    -3906, -5023, 406, -2869, 841, 2705, 1468, 2170, 4851, 865, 5643, 5051,
-    6566, 8388, 7512, 7037, 5961, 5538, 1880, 4539, -1463, 4070, 1048, -1496,
-    -2227, -106, -4281, -4929, -3398, -3117, -3935, -3354, 503, 213, -1514, -4088,
-    -4734, -1305, -4197, -3378, -4317, -2140, -1125, -4019, -1370, -2024, 3696, 2997,
-    -1525, 1461, 4056, 3066, -2625, 1624, -249, 418, 1338, 472, 759, 3112,
-    -1844, 1656, -455, -1630, -19, -2052, -2324, -3522, -4426, -1942, -4664, -4232,
-    -2143, -1401, -2827, -437, -1900, -1540, -1110, 1446, 467, 1141, -844, 7009,
-    3426, -1511, -996, -18, -841, -1366, -1731, 2302, -1332, -1895, -2333, -4443,
-    -2738, -5821, -6240, -5909, -6199, -3294, -4038, -4825, -6630, -5416, -4390, -2863,
-    -3073, -3061, -1227, -320, -1941, 895, 4737, 3483, 4642, 5787, 6998, 8589,
-    7125, 6573, 5996, 7591, 2574, 2521, 6990, 6588, 169, 1092, 652, 1879,
-    6280, -1934, 627, 2441, 3294, -1873, 1932, 3026, 1018, 1636, 1163, 1414,
-    1989, -97, -1240, 474, 2075, 2792, 717, 3290, 3765, 2200, 2619, -393,
-    -1421, -815, -1600, -1166, 1892, 3868, 1785, 2193, 4196, 4219, 3927, 2695,
-    4674, 2599, 277, -361, 126, -449, -1663, -5529, -3287, -2637, -260, -1692,
-    348, 2100, 3907, 3047, 1925, 2503, -1003, 740, -2494, -3392, -5779, -4946,
-    -2643, -6559, -6677, -1346, -4848, -7014, -6229, -3193, -3645, -3270, -3061, -3971,
-    -6394, -4809, -5066, -8357, -5929, -5035, -4659, -2775, -564, -1477, -892, -927,
-    887, 2729, 2764, 4018, 3921, 5775, 5864, 4494, 3849, 4086, 4543, 4138,
-    4370, 2444, -189, 2245, -754, -4079, -279, -952, -4662, -4645, -2630, -3857,
-    -4105, -4619, -3071, -2743, -1640, 1447, -245, -194, -2855, -2264, -71, -2859,
-    -2004, -2172, 648, 244, -745, -298, 199, 282, -2448, -885, 874, -222,
-    209, 824, -2152, 405, 1874, 328, 2864, 3950, 2084, 2797, 589, 108,
-    -1860, -3099, 495, 336, 1785, 4441, 2174, 2543, 3855, 579, 5480, 4059,
-    5245, 3300, 4802, 5060, 3374, 3301, 4274, 1068, 174, 2095, 1778, 2031,
-    -106, -628, 257, 602, 1063, 1082, 1153, -508, -2602, -581, -5854, -1556,
-    -1229, -6742, -2835, -334, -1812, -1621, 2360, -3069, -252, 1456, 1499, 2231,
-    3167, 1137, 1739, 3895, 3927, 2873, 4808, 3085, 4827, 3087, 5665, 3871,
-    1738, 2780, -1526, -2076, -917, 15, -3033, -3767, 428, -931, -888, -3852,
-    291, 1248, 1290, 466, -1042, -42, 912, -2889, -4404, 185, -316, -814,
-    -853, 1751, -1648, -232, -2266, -4019, -43, -330, -422, -5080, 220, 1516,
-    1296, 2978, 2911, 5738, 3926, 5947, 4749, 3820, 2260, 339, 1329, 1104,
-    1699, -477, 164, -2804, -2097, -2944, -6347, -3117, -1944, -1131, -3913, 176,
-    -415, -1007, 819, -238, 509, 3437, -1222, -3105, 528, 177, -3105, -402,
-    74, -2362, -956, -45, -1592, -2447, -454, -2056, -3024, 1261, -1462, -1562,
-    1522, 1816, 1026, -234, -545, 2624, 4396, 89, -876, 1361, 2847, 2632,
-    -3264, 425, 3963, 819, 1058, 625, 1813, 1114, -1841, -2040, -330, -1563,
-    -3688, -3552, -2334, -2980, -176, -2648, -4717, -2441, -180, -683, -339, 823,
-    -30, -1147, -4503, -4119, -4930, -5811, -6237, -7592, -5465, -4093, -3654, -143,
-    -2909, -2313, -111, 535, 2305, 1401, 2658, 1622, 3090, 5245, 2839, 1592,
-    3191, 3806, 1553, 69, 642, 3188, 1821, -1591, -76, 2821, 3027, -788,
-    -695, 839, -127, 82, 605, -2004, -1620, -45, -202, -26, -1357, -69,
-    325, -1187, -1071, 76, -1033, -835, -3608, -2511, -1610, -5832, -181, -2675,
-    -4669, -4956, -3814, -3851, -5396, -4291, -2593, -4960, -1865, -1533, 13, -234,
-    1474, 4260, 977, 4589, 6562, 4130, 1540, 4583, 6206, 3875, 3963, 5653,
-    4287, 5704, 7777, 5398, 6427, 7224, 4749, 6972, 3982, 4059, 1247, 4999,
-    1526, 3130, 1772, 1881, 1376, -88, 1296, -1621, -1891, -1324, -3182, -1179,
-    203, -1621, 442, 985, 937, 1522, 2711, 4565, 5098, 5476, 8242, 6727,
-    8461, 8424, 7038, 7348, 7774, 4240, 4859, 3990, 5691, 2612, -677, 1660,
-    2022, -1192, -1425, -2042, -3090, -2556, -4354, -2153, -3080, -5384, -2876, -5073,
-    -5043, -3649, -5140, -4551, -7046, -4093, -6039, -3548, -4288, -3175, -3491, -4055,
-    -3623, -3397, -5705, -959, -4851, -3409, -1897, -1891, -2530, 748, -3549, -3058,
-    -2593, -1809, -782, -2790, -1875, -2449, -2536, -1576, -2321, -2752, -882, -516,
-    991, 1510, -1478, 839, -541, -666, 1219, 2140, -871, 364, 1713, -1551,
-    1329, -1024, -2667, -2158, -1426, -1665, -2122, -2814, -107, -1347, 285, -4127,
-    21, 762, -843, -1675, 829, -1981, -935, 315, -1580, -1925, 1306, -2580,
-    1442, 1331, -308, 1768, 701, 3538, 4014, 504, 3672, 3303, 566, 3326,
-    1829, 1971, 1120, 2518, 2328, 4817, 329, 739, 272, -1187, 1409, -331,
-    74, 1753, 123, 4426, 983, 1982, 1512, 1993, 11, 3207, 2844, 2184,
-    2131, 3273, 1633, 1945, 2994, 1412, 1772, -1475, 1246, -468, -1715, -1989,
-    -3669, -3391, -5242, -3408, -1870, -2984, -1485, -1566, -3548, -3590, -2304, -3663,
-    -3024, -1572, -2147, -1407, -813, -129, -507, -254, 3732, 2636, 4279, 3176,
-    3657, 2826, 3808, 3115, 776, 3430, 1652, 1857, 710, 1498, -2079, -2411,
-    -2948, -1438, -5175, -4193, -5052, -8164, -6431, -8504, -9827, -7332, -8686, -9108,
-    -9881, -6632, -8667, -7159, -7223, -7033, -7137, -3694, -3027, -929, 285, 597,
-    -279, 1985, 3945, 2957, 3581, 3362, 4146, 7246, 3490, 6520, 4870, 1568,
-    5737, 6162, 1726, 1062, 3426, 2062, 1784, 274, -456, -2321, -35, -114,
-    709, 41, 155, -4844, -2233, -1676, -3092, -3501, -2291, -4150, -3376, -2849,
-    -3081, -2642, -1879, -1445, -1252, -1980, -742, 633, -1248, -1344, -1221, 1038,
-    1306, 3873, 4316, 1211, 1850, 1646, 274, 1912, 1095, 156, 435, 1149,
-    670, 978, -1188, -597, 1295, 3665, 1043, 2741, 4285, 4052, 2277, 4807,
-    2655, 1297, 2850, 4068, 6088, 5221, 4707, 4784, 3358, 4496, 4726, 4577,
-    1781, 3399, 1972, 2133, 2867, 1407, 2245, 1845, 1918, 3033, 2970, -743,
-    1678, 130, 867, 209, 338, 4483, 2553, 2279, 1788, 3458, 1583, 3532,
-    3340, 3839, 3532, 4061, 3050, 3840, 2128, 3408, 3645, 3543, 5002, 5229,
-    3996, 3337, 597, 3961, 1932, 1826, 1105, 3323, 3406, 2880, 3590, 2927,
-    3763, 2877, 3338, 2331, 2096, 3185, 1488, -355, 1843, 4366, 356, -866,
-    40, 491, 106, -2780, -1527, -1275, -3826, -4216, -2797, -2467, -1400, -1415,
-    -2966, -2069, 610, -866, 58, 755, -2287, -633, -682, -2853, -2666, -667,
-    -1001, 493, 1597, 1035, 1615, 2448, -1268, -180, -640, -490, 166, 513,
-    3950, 1400, -459, 874, 1142, -3, -749, -1752, -1460, -2235, -3661, -5943,
-    -6936, -5873, -5486, -7197, -5465, -6064, -5825, -5256, -7887, -6367, -4991, -7076,
-    -7800, -4779, -2133, -4366, -3905, -4600, -3157, 618, 660, 629, 2221, -402,
-    1024, 470, -1031, 1286, 1872, 294, 1209, 2093, 1661, -318, -247, -11,
-    -2320, -2857, -3436, -3429, -1374, -2305, -3412, -6025, -4466, -4047, -4198, -4724,
-    -4764, -6115, -6046, -8238, -8837, -6686, -6979, -6840, -3580, -2935, -3749, -3557,
-    -3419, -496, -1484, -2206, -960, 88, 2564, 2824, 1715, 2048, 509, 4,
-    1491, 1572, 1770, 396, 84, 671, -1406, -1775, -2000, 252, -862, -1694,
-    1084, -1219, -2212, -156, -3182, -2612, -1947, -1838, 156, -7, -1237, -1864,
-    -2099, -521, 284, -2556, -81, -871, -329, -1898, -1643, -3359, -1433, -1955,
-    -1155, 679, -1486, -1767, -2694, -2025, -1797, -1798, -834, -1683, -61, 889,
-    922, -1262, -274, -1780, 1167, 821, 2179, 3901, 4855, 3172, 3894, 1881,
-    1734, 4863, 5013, 3983, 4510, 5765, 6090, 4842, 3958, 3468, 3133, 3317,
-    2571, 4166, 5723, 4111, 1172, 3254, 5954, 4215, 2067, 4304, 7111, 6013,
-    4369, 5359, 5580, 5399, 6661, 7028, 6860, 6775, 3783, 3987, 3515, 2987,
-    4627, 2761, 2607, 4115, 2933, 1939, 878, 1092, 440, 404, 585, 323,
-    812, 531, 756, -1543, -1015, 15, 1326, 315, 194, 1293, 3597, 1423,
-    -1045, 960, 962, 121, 1522, 989, 1508, 2351, 1516, 1965, 651, -224,
-    72, -592, 233, 498, -771, -2113, -1694, -2396, -3871, -942, -3586, -3682,
-    -2957, -4698, -3407, -3009, -3273, -1415, -1594, 415, 97, -1519, 262, 537,
-    1785, 2281, 2536, 4975, 3220, 4226, 3641, 3353, 3643, 4865, 3284, 3880,
-    3932, 3820, 3900, 4465, 2224, 2313, 2828, 1779, 596, 2343, 138, 710,
-    1035, -413, -565, -594, -873, -1806, -880, 1639, -581, -1292, -1650, 283,
-    -970, 123, -188, 28, -1024, 1697, 2331, 687, 1771, 1776, 1395, 1628,
-    2111, 1620, 1996, 108, 1895, 2764, 616, 971, 2797, 2042, 1073, 1642,
-    1851, 1363, 2206, 728, 2686, 1492, 1048, -1093, 369, 779, 1345, 1929,
-    683, 160, 360, -806, 401, 1437, -649, -733, 264, 775, -1197, -1202,
-    118, -699, -24, -1048, -805, 276, -442, -2873, -2255, -2106, -2610, -3589,
-    -4073, -1936, -2140, -2884, -2596, -1982, -1924, -4175, -3694, -454, -3168, -3347,
-    -2718, -2264, -3278, -1550, -993, -3780, -3456, -4218, -3979, -4690, -4925, -3959,
-    -6032, -6067, -4501, -4496, -5017, -5328, -6416, -6335, -6806, -5760, -6391, -6637,
-    -5736, -3897, -4378, -5058, -3357, -3682, -3180, -3022, -1539, -1371, -1948, -2216,
-    -1653, -2223, -3391, -1839, -2173, -3482, -1552, -3191, -2945, -3479, -2877, -4489,
-    -3215, -1774, -1882, -2703, -3250, -2096, -3403, -1758, -3551, -1943, -1705, -2189,
-    -2272, -2439, -479, -1802, -3004, -2087, 105, 510, -87, -2508, -1587, -450,
-    -1359, 670, 23, 1183, -1132, -751, 330, -616, -1702, -1445, -1852, -1558,
-    -175, -2280, -2439, -2581, -3581, -4159, -3719, -3464, -2572, -2907, -1985, 415,
-    -1886, -1779, -574, -1018, 399, 1383, 2810, 2946, 4492, 5293, 5680, 5383,
-    5704, 6150, 5085, 6219, 6640, 6950, 4487, 4310, 5047, 3268, 5115, 5874,
-    4967, 3106, 2699, 2889, 2376, 191, 2070, 797, 2083, 973, 737, 1813,
-    -347, 626, 2007, 2249, 2250, 1402, 3330, 3025, 1888, 1503, 1149, 1260,
-    2675, 3292, 3615, 3027, 3703, 478, 1415, 4048, 2772, 3482, 3996, 3394,
-    3735, 3124, 5456, 2452, 2601, 2037, 3923, 3538, 3066, 3260, 2635, 2569,
-    1865, 161, 3002, 3520, 2114, 2601, 2474, 2431, 2052, 825, 717, 1941,
-    2543, 702, 3728, 1454, 1010, 1213, 2646, 1388, 2275, 2879, 2715, 2304,
-    1707, 2446, 627, -984, 897, -247, 164, 1373, -272, -1646, -2352, -1116,
-    -489, -1332, -678, -1050, -333, -59, -999, -38, -423, 544, 2003, 632,
-    2194, 1459, -28, -32, -1068, -875, -23, 8, 77, -714, -982, 715,
-    105, -2025, -1727, -1641, -249, 351, -597, -1154, -1069, 14, -1060, -984,
-    -1757, 805, 607, 50, 243, -199, -1024, -1941, -2624, -1753, -750, -779,
-    -885, -2309, -2129, -336, -1455, -1836, -1251, 296, -1508, -2148, -51, -65,
-    -2253, -3168, -568, -612, -1269, -942, -1553, -853, -2408, -1785, -2000, -1400,
-    -1790, -964, -3023, -1447, -820, -1480, -1641, -885, 558, -270, -30, -524,
-    24, -411, -198, -701, 309, -81, -578, 869, -1552, 157, -557, -2170,
-    -2806, -2906, -1255, -660, -3630, -2321, -70, -1128, -2503, -1401, -671, -1633,
-    -2178, -1524, -362, 1117, 339, 311, 797, 3038, 895, 531, 3703, 1927,
-    -1778, 390, 2124, -142, 727, 622, -1345, -1149, -1334, -1196, -1587, -1873,
-    -1548, -1561, -2030, -1232, -1777, -886, -645, -1053, -326, -1211, -1481, 941,
-    1035, 1080, -136, 376, 653, 2539, 3074, 1178, 1137, 2130, 21, 1184,
-    1794, 3418, 1452, 1463, 1571, 2138, 973, 1451, 2717, 2096, 2730, 1214,
-    2036, 2237, 1706, 2212, 1745, 2702, 3629, 3339, 2819, 3729, 1678, 2645,
-    283, 3031, 3496, 3567, 4897, 5243, 4167, 2185, 2667, 3385, 3756, 3712,
-    3044, 2520, 3984, 4111, 3140, 1619, 1451, 1578, 2103, 2242, 480, -176,
-    -1885, -1505, -1727, -1519, -1337, -1515, -2127, -3030, -2941, -1650, -2619, -3804,
-    -3032, -2901, -1544, -924, -1892, -3534, -2655, -891, -2492, -2250, -557, -1067,
-    -2315, -3750, -3440, -2391, -5098, -2571, -1961, -1770, -1598, -766, -1757, -2343,
-    -4698, -2936, -1914, -2795, -2158, -2197, -2524, -1365, -1578, -1772, -3015, -2302,
-    -1078, -1307, 505, -2166, -2265, -3881, -3405, -1418, -2098, -931, -1775, -1352,
-    786, 448, 731, 310, -1067, 613, 1396, 1848, 1553, 776, 2170, 3184,
-    868, 1490, 4422, 3894, 4219, 3229, 947, 602, 2787, 2108, 2377, 2603,
-    3423, 2040, 2656, 880, 814, 2160, 875, -1072, -88, 732, -418, -873,
-    931, -761, -1131, -1235, -1180, 1328, -294, -733, -1200, -698, -2833, -796,
-    2323, -283, 235, 1109, 306, 1307, 1825, -326, 1013, 1195, 2055, 2085,
-    2461, 2442, 1276, 3021, 2884, 1153, 1711, 1319, 1607, -114, 42, -752,
-    -654, 397, -959, -117, -996, 493, -1303, -1017, -2368, -1814, -2787, -2039,
-    -1447, -410, -1369, -2751, -1753, -411, -819, -1062, -604, -2115, 328, -1528,
-    -2223, -4149, -2847, -2285, -2582, -2719, -3254, -4143, -2985, -3367, -3144, -3259,
-    -4274, -4555, -5020, -2364, -4004, -4711, -2555, -4857, -4894, -3846, -3495, -4750,
-    -2356, -3463, -4377, -2090, -2478, -3329, -1845, -2341, -469, -328, 127, -2128,
-    -1005, 1130, -1901, -1980, 987, 637, -1133, 682, 303, 143, 416, -80,
-    -724, 127, -124, -1740, -2521, -362, -2841, -3551, -172, -1137, -1073, -1401,
-    -2750, -2502, -2376, -2437, -1405, -2091, -279, -1174, -1140, -1814, -877, 296,
-    -585, -1198, -827, 339, 1292, 93, 1772, 20, -600, 1277, 653, -1177,
-    1653, 1833, -13, 1741, 2356, 590, 1299, 1698, 381, -216, 2432, 590,
-    1604, 2375, 2145, 2688, 2791, 1579, 2103, 2980, 3430, 3269, 1587, 3697,
-    1984, 3075, 3012, 1146, 2584, 3343, 3529, 4038, 3225, 5017, 3906, 4293,
-    3390, 5414, 3643, 3742, 3683, 3685, 4205, 4743, 3793, 4393, 4314, 3964,
-    4272, 2833, 4031, 4102, 2823, 2616, 3550, 1077, 3142, 2178, 380, 1276,
-    3453, 2623, 1132, 3416, 1755, 1617, 2810, 1072, 659, 508, 872, 3518,
-    426, 1837, 549, 1609, 1611, 1496, 3124, 1788, 62, 2094, 1817, 1745,
-    2426, 2135, 1800, 1406, 2999, 1502, 1719, 2741, 1237, 2722, 1749, 3218,
-    2085, -291, 1354, 2328, 1553, 2116, 1894, 1823, 1274, 1952, 1529, 1147,
-    -504, 1825, -371, 1401, 742, 507, 817, 1161, 352, 70, -988, 169,
-    2130, 142, -1011, 61, 1551, -157, -1883, -1095, -2711, -1526, 200, -2099,
-    -1508, -4134, -2253, -2772, -2807, -1938, -1252, -2989, -2686, -512, -2372, -1655,
-    -2110, -2920, -2901, -2461, -2523, -934, -2719, -1520, -692, -2782, -997, 120,
-    -569, -2759, -214, -636, -1057, -2466, -421, -367, 262, 1043, -23, 1121,
-    913, 906, 527, 2278, 45, -768, -720, -1113, -1072, -592, -568, -2777,
-    -1451, -1261, -1284, -2519, -3202, -3793, -4547, -4936, -6005, -5948, -4844, -3918,
-    -3606, -4016, -4049, -4208, -4554, -5025, -4297, -4877, -2922, -2929, -3739, -1558,
-    -1872, -923, -1983, -1387, -785, -872, 55, -503, -1338, 94, -691, -532,
-    -1576, -688, -1097, -554, -2931, -1999, -1359, -4160, -2263, -669, -1732, -3098,
-    -1852, -2267, -3181, -1470, -1637, -1211, -3497, -2346, -2131, -2602, -4436, -1907,
-    -3789, -681, -209, -454, -775, -827, 1145, 786, 34, -1, -933, 1049,
-    147, 491, 509, 1639, 2269, 1234, 1025, 2640, 2371, 1555, 2409, 1736,
-    1343, -246, 1075, 291, 352, 1186, 559, 718, 1940, 4026, 1657, 2230,
-    2397, 1831, 768, 786, -511, 1637, 636, -440, 1749, 2362, 2728, 1956,
-    3348, 1625, 535, 1588, 814, -619, 2137, 4027, 1760, 2086, 2609, 3986,
-    2250, 2378, 3394, 3029, 957, 149, 1288, 1597, -516, 2312, 1798, 1771,
-    2927, 3620, 1589, -314, -340, 268, -1100, -1562, 436, -80, -495, -193,
-    -476, -612, -321, -1839, -1972, -748, -3655, -2486, -3312, -3557, -3347, -1822,
-    -1740, -1822, -1867, -2574, -2358, -2745, -1850, -3592, -2911, -3322, -2739, -1832,
-    -3049, -3935, -2614, -1825, -2170, -1363, -2366, -1821, -2386, -2208, -2934, -3942,
-    -3922, -2145, -1367, -1964, 54, -203, -69, -2518, -2169, -1441, -2849, -1153,
-    268, -1159, -832, -1153, 1087, 1443, 1541, 2090, 3007, 3633, 3122, 3323,
-    1982, 1474, -581, 1704, 1898, 3836, 5228, 4618, 3674, 2172, 1902, 862,
-    195, -813, 955, 40, 1708, 376, 289, 1218, 1320, 2261, 959, 2513,
-    696, 878, 227, -711, 93, 1116, 2617, 1415, 3416, 4042, 3704, 2442,
-    1394, 236, 350, 2233, 3523, 4807, 2981, 2645, 3135, 2860, 2678, 2253,
-    2388, 1074, 1962, 2899, 1763, 75, -456, 267, 238, 2141, 2976, 1791,
-    392, 902, 397, -877, -1316, 163, -2001, 322, 1196, 1433, 1001, -110,
-    -426, 1105, 723, 2538, 1465, 493, -193, -825, -816, -33, -487, -1467,
-    -306, 1188, 193, -267, -2953, -3489, -4611, -3361, -3316, -4082, -1899, -3164,
-    -2831, -4596, -4066, -2418, -1549, -3155, -2045, -1552, -3813, -3922, -4952, -5747,
-    -5728, -3332, -2330, -3542, 465, -458, -2210, -1750, -3599, -4529, -4188, -3344,
-    -1627, -1571, -1997, -2242, -602, -837, -673, -210, -966, -2103, -1614, -2270,
-    -1115, -2317, -1418, -480, -2172, 308, 1519, 774, -583, 288, -486, -2148,
-    -1795, -90, -398, 185, 1444, 600, -756, -431, 995, 684, -607, 529,
-    -669, -1787, -290, 73, 89, -731, 472, -525, -255, 159, 1488, 472,
-    -1147, -764, -1784, 1262, 926, -367, 1323, -319, -700, -1175, -96, 1413,
-    735, 50, -131, 1244, -604, 1827, 2297, 4, -753, 342, 1152, 1821,
-    2073, 1874, 1737, 101, 1386, 2840, 2561, 1851, 3409, 3832, 3357, 5849,
-    4476, 3526, 2884, 3797, 4884, 3701, 3648, 7064, 5929, 3133, 4570, 6150,
-    4696, 3044, 4959, 5360, 2705, 2396, 1911, 956, -88, 554, 329, 407,
-    1809, -72, -249, 2135, 1754, 585, -1596, -3399, -791, 1322, 1191, 977,
-    569, 893, 1022, 2193, 1518, 2097, 1253, 1957, 868, 3327, 2242, 1963,
-    2302, 2156, 2577, 2674, 4912, 3606, 922, 1970, 697, 620, 1559, 1752,
-    3178, 1962, 1721, 2068, 1387, -446, -19, 705, 139, 1517, 1426, 142,
-    338, 1247, 2862, 880, 1766, 2601, 2282, 1964, 2370, 2609, 233, 887,
-    1089, 531, 3389, 1865, 987, 707, 999, 40, -786, -1960, -799, -511,
-    -841, -1072, -269, -1218, -1338, -1696, -3004, -1400, 133, -1532, -931, -2054,
-    -2551, -1829, -3042, -2182, -2096, -972, -2361, -2195, -971, -1023, -2330, -2283,
-    -2272, -1828, -1781, -1568, -3124, -3456, -1883, -3088, -3677, -1373, -1203, -1600,
-    -2743, -1359, -3233, -4335, -2647, -3834, -3225, -915, -3119, -3215, -2117, -590,
-    -3932, -2792, -740, -2968, -2237, -1599, -1640, -1891, 213, -503, -1661, -1781,
-    -1358, -910, -1141, -1703, -1630, -1868, -2227, -2699, -2681, -4237, -1392, -2066,
-    -2699, -609, -1661, -2639, -2966, -2305, -3690, -1192, -2289, -3648, -1122, 44,
-    -1579, -3216, -1900, -1188, -2171, -2305, -2241, -2871, -3996, -2313, -2462, -3035,
-    -1965, -1395, -1493, -1277, -1971, -3580, -4185, -3554, -2436, -3058, -1670, -3058,
-    -2951, -1594, -1447, -1811, -778, -673, 358, 393, -201, -1218, 1403, -702,
-    -246, 490, 62, 179, 452, 131, 1085, 3025, 1485, -1110, -584, -518,
-    1169, -888, 709, 1886, 82, -395, -1171, -163, 53, 911, -62, -621,
-    535, -1573, -1767, -1476, -1537, 2042, 1025, 1547, 1966, 748, 1054, 2348,
-    -874, 471, 1747, 603, 956, 3004, 3390, 1990, 3000, 2943, 3954, 4442,
-    2748, 2830, 2618, 1590, 2624, 1029, 2296, 2787, 2448, 1855, 1908, 1925,
-    777, 937, 1668, 1537, -774, 296, -1222, 1633, 2079, 679, 3, 1037,
-    -1089, -1706, 156, -705, 1478, 4764, 2777, 2408, -2686, -7789, -4521, -2061,
-    -1876, -12, 315, -3426, -2371, -3840, -3646, -3495, -3319, -3212, -2662, -1025,
-    -1265, 827, 373, 2796, 3763, 2688, 2366, -118, 23, -1566, -1691, -2897,
-    -2184, -1978, -1816, -239, -396, 2161, 3205, 4954, 4185, 3890, 3305, -917,
-    -3417, -3400, -3664, -5962, -6095, -5707, -6759, -2736, -3868, -2690, 153, 3296,
-    2370, 5097, 6909, 3883, -833, -3959, -5876, -5619, -3970, -5556, -4066, -4084,
-    -3055, -1710, 357, 1538, 4393, 6963, 6109, 8253, 10128, 9857, 9500, 8465,
-    7282, 5988, 6608, 4529, 3426, 3358, 2667, 4440, 2711, 1809, 2128, 2115,
-    -1542, -401, -709, 406, -321, 268, 933, 2163, 1010, 458, 2064, 934,
-    261, 893, -43, 1396, 738, 2277, 1109, 1480, 355, -360, -3153, -2387,
-    -1851, -1781, -2835, -1313, 569, -1996, -2018, 1628, 4001, 3783, 2481, 2525,
-    -546, 1438, 1583, 1220, 2311, 1529, 1161, 2956, 1378, 1122, 2136, 1021,
-    -1200, -195, -632, -2192, -3905, -4736, -4609, -4982, -5657, -3152, -4276, -2636,
-    -3653, -3437, -2181, -4316, -3463, -3118, -6011, -7720, -7741, -5502, -5342, -4787,
-    -5130, -3886, -4711, -1476, -2602, -2966, -1328, -2095, -2034, -2188, -25, -227,
-    -1346, -606, -3292, -1796, -2663, -4899, -3397, -3235, -3714, -2198, -433, 529,
-    483, 2213, 2916, 2990, 644, 1546, 405, -784, 2152, 4321, 4131, 7023,
-    9002, 9133, 8800, 8719, 6641, 6268, 4520, 1512, 2794, 2138, 569, 1966,
-    2365, 985, 664, -1921, -2712, -3668, -6019, -7291, -6149, -5193, -5314, -4949,
-    -4017, -3888, -3292, -2143, -230, -345, 2139, 3835, 2032, 2067, 2902, 2363,
-    2519, 2550, 1862, 1438, -1572, 1115, 928, 3263, 619, 135, 2322, 3741,
-    3331, 2714, 4667, 1403, -223, 23, -785, -360, -1559, 224, -884, -1858,
-    -318, -599, -562, 66, 1339, 2260, 2740, 379, 1642, 1287, -1852, -1211,
-    -872, 1991, 958, 1882, 1260, 1829, 3953, 2595, 1791, 2928, 2865, 1340,
-    1191, 1775, 2567, -59, 1262, 2522, 2792, 2957, 2396, 709, 2017, 4078,
-    3165, 2246, 2136, 1526, 1122, 501, 1249, -1491, -1758, -326, -2369, -555,
-    -398, -694, -379, -503, -1506, -280, -808, -484, -1953, -1866, -920, -1444,
-    -185, -51, 2468, 4476, 1709, 2426, 3106, 3421, 3881, 2359, 2006, 2593,
-    1901, 304, -456, -2801, -4175, -5089, -4825, -6662, -4944, -2718, -252, 2049,
-    2596, 2908, 4353, 6965, 6896, 2784, 2634, 2744, 722, -188, -1023, -1246,
-    -927, -536, -42, 2299, 2783, 3520, 1263, 1100, 1777, -1555, -216, 499,
-    -3009, -2656, -2098, -2432, -2342, -2378, -810, 207, -669, -1429, -1323, -32,
-    -3088, -2811, -1655, -2725, -1022, -730, -2357, -1443, 28, 234, -4, 1475,
-    -281, 714, 614, 858, 1271, 973, 848, 960, 3924, 4249, 3368, 2269,
-    1453, -1360, -343, -377, -1367, -2159, -1319, -1880, -2679, -1993, 618, -152,
-    122, 1179, 2264, 609, 1465, 2227, 2127, 1702, 1960, 1984, 4793, 3206,
-    437, 2212, 1405, -636, -2250, -3007, -3089, -1159, -2285, -3016, -2186, -3627,
-    -3274, -3794, -4524, -2309, -3089, -4592, -4026, -3741, -3681, -4639, -5037, -4402,
-    -2520, -2712, -2208, -1964, -2475, -3911, -3701, -2425, -2191, -2567, -3208, -1666,
-    -4754, -5619, -6743, -5744, -6911, -8119, -5772, -4956, -3060, -1661, -2834, -3320,
-    -1054, -1227, -2306, -1165, -2158, -4699, -5605, -6009, -5995, -4914, -3670, -2873,
-    -1641, 1827, 1388, 773, 2029, 3583, 4928, 5013, 6811, 6266, 5891, 5857,
-    5461, 5666, 5520, 5948, 4765, 5999, 6528, 4979, 1749, 990, -393, 2,
-    1390, 1290, 1020, 2023, -297, -832, 16, -991, -599, -2988, -2126, -397,
-    -528, -1421, -637, -172, -1064, -120, 385, 2234, 1962, -217, -2433, -1129,
-    -1467, -2063, -1638, -481, 537, 1480, 401, -349, 90, -1472, -1818, -4070,
-    -2731, -1592, -3318, -3170, -959, -371, -409, -1299, 896, -3, -1701, 137,
-    -1709, -2286, -4076, -5092, -4664, -2352, -2159, -2324, -2404, -5281, -3741, -3283,
-    -3209, -4324, -4475, -3807, -4403, -4354, -3473, -4414, -4233, -2435, -2455, -673,
-    -1939, -341, -1688, -1697, -1947, -2073, 29, 510, 1088, 2252, 1253, 932,
-    437, 454, -1062, -1537, -245, 226, 293, 726, 1757, 1636, 4092, 3718,
-    3969, 4998, 6036, 6142, 5619, 6168, 6748, 7829, 9592, 9550, 11025, 11781,
-    12080, 10716, 9639, 9799, 9301, 7774, 6114, 4583, 5347, 4814, 3871, 3330,
-    3053, 2040, 2298, 1523, -4, -269, 488, -1856, -1134, -2063, 115, 408,
-    -519, 590, 1476, 2741, 2624, 2935, 3135, 4132, 4379, 3889, 3237, 1635,
-    4948, 3665, 2767, 2397, 5051, 3482, 5056, 3822, 2643, 4013, 4553, 2717,
-    2085, 3886, 3364, 1964, 1575, 1215, -524, -2109, -628, -1800, -2877, -2337,
-    -2372, -2234, -1344, 172, -258, -1952, -1753, -2080, -755, -2739, -3584, -2778,
-    -2066, -2241, -760, -280, -2592, -754, -986, 62, 404, 315, 143, -472,
-    -510, 204, -1104, -1601, -110, 48, -50, -1924, 1242, -148, 33, -456,
-    -1399, -1438, -2501, -1212, -1973, -3222, -3355, -4368, -4819, -4308, -4783, -5183,
-    -5931, -4799, -5237, -5516, -5785, -7664, -7844, -4520, -5733, -6159, -4521, -3724,
-    -2496, -3245, -4007, -3328, -4002, -2238, -1819, -2734, -3950, -4084, -4248, -3821,
-    -6049, -4685, -4440, -6149, -7133, -6141, -5799, -6596, -4845, -3821, -3092, -2702,
-    -873, -251, -1187, -332, -978, -1086, -555, 316, -478, 411, -302, -838,
-    -1122, 412, 1130, -1186, -753, -998, 61, -1230, -1326, -3075, -3391, -2060,
-    -1206, -1951, -530, -935, 90, -826, -1579, -1176, -3399, 334, -294, -1522,
-    -1262, -1666, -2043, -862, -505, 1396, -260, -578, 79, 1181, 1518, 91,
-    591, 1133, 1738, 3054, 4901, 5280, 4514, 5592, 6873, 5169, 4747, 6403,
-    7015, 5944, 3730, 2626, 334, 1378, 4145, 2555, 3998, 3748, 6494, 6890,
-    6120, 5825, 5548, 5508, 6548, 7366, 7674, 8267, 8015, 6927, 7161, 4954,
-    4408, 4350, 7179, 4701, 4064, 3123, 1614, 111, -536, 1531, 1219, 248,
-    2146, 1690, 1276, 388, -730, -1493, 2, -448, -74, 271, 1681, 1274,
-    660, -538, 2056, 1997, 1813, 2987, 1962, 2287, 586, -1402, 599, -958,
-    -891, -1085, -610, -1948, -989, -1942, -2495, -2900, -1983, -605, -329, 197,
-    -940, -290, -53, -753, -1183, -994, 375, 1240, 1581, 100, 771, 374,
-    2340, 3611, 3671, 4868, 4938, 6305, 6833, 5562, 4968, 4485, 4499, 5493,
-    5943, 4925, 5579, 5655, 5622, 4179, 4847, 3936, 3863, 4139, 3995, 4525,
-    1012, 983, -388, 430, 2011, 649, -743, 1448, 568, -1232, -588, -1173,
-    -1861, -2819, -1570, -97, -730, -1687, -1388, -2001, -3475, -2596, -2323, -1705,
-    -2627, -4119, -3117, -5261, -6137, -5397, -5803, -5436, -7669, -6208, -6190, -5842,
-    -5580, -6220, -6600, -5156, -5022, -4515, -4511, -3688, -5042, -3727, -4425, -3774,
-    -3729, -2602, -1942, -3355, -3734, -4427, -6057, -6103, -6708, -4382, -5104, -5214,
-    -5606, -6385, -5834, -5593, -5771, -7287, -7882, -5687, -4955, -3525, -5030, -4743,
-    -3783, -4265, -4883, -3391, -665, -1422, -2586, -3655, -3986, -3675, -3557, -3176,
-    -3836, -5500, -3889, -2021, -1599, -3065, -2828, -2324, -2180, -990, -67, 863,
-    638, 64, 2679, 3499, 3095, 4090, 5962, 5716, 7128, 6283, 5901, 6221,
-    5906, 6875, 5803, 4269, 3742, 3908, 2826, 3504, 2326, 1192, 242, -803,
-    1469, -406, -2058, -1804, -1476, -2092, -1780, -1495, 214, 482, -1612, -1083,
-    -340, -2232, -2263, -1930, -827, -775, -422, 169, 1621, 2544, 3025, 1979,
-    834, 1565, 1514, 2699, 2751, 2011, 2709, 3934, 3743, 2378, 3664, 4828,
-    3040, 2490, 2721, 505, 265, -171, -1816, -1611, -2618, -1984, -462, -770,
-    -1593, -1791, -2768, -2388, -2186, -2929, -3436, -4885, -2329, -657, -1562, -2297,
-    -1573, -928, -620, -574, -372, -47, -1116, -1712, -571, 29, -410, -122,
-    -2, 2053, 1725, 491, 1316, 1367, 1390, 1132, 2284, 561, 926, 1494,
-    1635, 491, 818, 1508, 2240, 472, -653, -679, -428, 734, -1288, -1891,
-    -2363, -254, -2106, -473, -1, 662, -711, -1486, -608, -1030, -681, -1152,
-    -315, 373, 222, 719, -711, 443, 603, 300, -53, -1914, -2661, -2788,
-    -3970, -4776, -3539, -4045, -3705, -2808, -994, -231, 692, 84, -324, -140,
-    1130, 1635, 2747, 3920, 3263, 2357, 2152, 3812, 6237, 5823, 4427, 2639,
-    2644, 3788, 4300, 1701, 1198, 2344, 868, 1006, 2522, 2218, 1007, -187,
-    -893, 82, -86, -1580, -1458, 1106, 1531, 891, -325, -493, 635, 1232,
-    -400, -251, 277, -235, -152, -545, 65, -422, -1340, -7, 749, 1102,
-    2770, 2029, 2281, 3376, 3380, 3158, 3798, 4510, 4772, 4944, 4602, 4282,
-    6466, 5985, 4460, 3265, 3861, 5601, 5254, 4476, 4162, 5407, 5311, 5202,
-    5740, 6959, 6975, 5647, 6663, 6962, 6019, 4956, 4566, 4820, 5635, 5431,
-    3371, 2826, 3809, 3218, 2276, 992, 445, 24, -2000, -1687, -2120, -2842,
-    -3067, -2913, -3126, -2020, -1519, -3014, -3263, -1757, -1530, -2478, -2364, -2774,
-    -1218, 184, -1326, -1703, -1351, -831, -309, -1288, -2298, -829, -1518, -2800,
-    -2799, -2647, -2213, -3169, -3807, -4339, -2485, -3149, -3799, -3220, -3333, -3340,
-    -4120, -3720, -2224, -482, -1809, -2926, -1815, -1357, -564, -933, -526, -131,
-    311, 1584, 1988, 1319, 1021, 1444, 2229, 2254, 1961, 2465, 2789, 2933,
-    4016, 4566, 3688, 3389, 3083, 3931, 3743, 2646, 2933, 2237, 2256, 2166,
-    1449, 3007, 2102, 1463, 1615, 1525, 2201, 534, -323, -872, 117, 1487,
-    -292, -436, -150, -892, -1209, -1028, -1368, -911, -1246, -1977, -2622, -1850,
-    -3124, -3425, -4641, -4296, -4917, -5725, -6906, -7068, -5653, -6267, -6676, -6128,
-    -6346, -5984, -5384, -5456, -4470, -3688, -2846, -3147, -2076, -2241, -2531, -2181,
-    -1534, -2260, -2003, -1825, -1952, -1527, -1718, -2182, -2285, -1841, -2703, -2491,
-    -3518, -4309, -4686, -3972, -4541, -4910, -5559, -4440, -5168, -5477, -4510, -2835,
-    -4641, -4404, -2840, -3893, -4110, -4239, -3507, -3967, -3082, -3119, -3411, -2253,
-    -1975, -1716, -2453, -4132, -4160, -3191, -3027, -1446, -483, 77, 1731, 1158,
-    1373, 2525, 2896, 2293, 3909, 4238, 4887, 4910, 5696, 6205, 7179, 7026,
-    6832, 7471, 6826, 6712, 6072, 5469, 4522, 5383, 4117, 2862, 3210, 2771,
-    2748, 1580, 1112, 2671, 344, 943, 2402, 1303, 540, 173, 1022, 1205,
-    1695, 1991, -289, -101, 526, 1097, 1066, 1077, 278, 2471, 1368, 541,
-    966, 2653, 2040, 659, 704, 2759, 2342, 734, 2256, 3385, 3586, 1185,
-    1456, 2173, 1285, 1408, 2123, 1011, 258, 841, 786, -908, -1575, -504,
-    -1946, -3021, -2535, -1517, -2407, -2995, -4261, -2789, -2190, -3934, -3293, -3019,
-    -2421, -2561, -2591, -2129, -1816, -863, -1533, -2841, -1377, -388, -1005, -1625,
-    -2463, -1995, -1522, -1453, -1083, -1218, -588, -713, -631, 615, 544, -2133,
-    -1737, -1067, -579, 396, -99, -1104, -691, 322, 1198, 936, -137, 376,
-    1469, 1343, 257, 1351, 270, -87, 650, 802, 1563, 1128, -537, -275,
-    188, -398, 93, 114, -212, 850, 10, -1222, -340, 32, -2154, -3109,
-    -2006, -1749, -1907, -2840, -3185, -2298, -2034, -1687, -1051, -97, -160, -86,
-    -25, 1335, 1619, 533, 681, 1952, 3170, 2578, 2670, 3527, 2329, 1374,
-    2554, 3464, 3075, 2181, 3401, 3704, 2528, 1106, 1024, 124, -162, 1193,
-    1040, -228, -1186, -1699, -1424, -1426, -627, -1345, -1954, -551, 328, -489,
-    -1075, -1713, -1831, -2294, -1361, -668, 250, 141, -1096, 254, 264, -1564,
-    -63, 1457, 2334, 1025, 1017, 2552, 2267, 909, 888, 1429, 1562, 2522,
-    3637, 3342, 2043, 1436, 2118, 2968, 3499, 3182, 5215, 5335, 5010, 5651,
-    4932, 4471, 5750, 6121, 5777, 5730, 5046, 3548, 2796, 2566, 2361, 2044,
-    2578, 3026, 3005, 3005, 2802, 1729, 180, -319, -124, -479, -190, -917,
-    -2120, -2937, -1785, -2293, -2327, -1301, -305, -929, -1377, -2129, -2901, -4179,
-    -4154, -4045, -2497, -1938, -742, -478, -1780, -1785, -1982, -2598, -2728, -2273,
-    -1499, -1174, -870, -876, -1180, -3002, -3029, -1619, -1369, -795, -609, -2233,
-    -3820, -4165, -3911, -3530, -3607, -2170, -552, 341, 158, 20, -1865, -1249,
-    -147, 50, 278, 74, -131, 351, 929, 610, 626, 613, 1487, 3072,
-    1915, 892, 1316, 397, -1282, -873, 353, 1845, 2236, 1983, 1269, 1661,
-    1746, 1160, 274, 1498, 1835, 1919, 2125, 1630, 1892, 1424, 525, 1507,
-    2616, 2516, 1494, 797, -170, -858, -1588, -2608, -2908, -1457, -1416, -887,
-    -575, -973, -1897, -2445, -2798, -2846, -3714, -5009, -4724, -5692, -6152, -5062,
-    -5037, -5938, -4743, -1935, -1384, -2717, -3949, -4170, -5372, -5680, -5031, -4021,
-    -2901, -2521, -2446, -2208, -2184, -1845, -2881, -2178, -1782, -2740, -3444, -2016,
-    -1537, -2832, -3585, -3804, -3732, -1506, -1232, -3210, -3906, -4819, -4974, -5870,
-    -6174, -5418, -4701, -4580, -3529, -3032, -3202, -2816, -3014, -3490, -2150, -3126,
-    -3843, -3752, -3983, -2667, -1960, -1502, -2099, -249, 1893, 1307, 1544, 174,
-    9, -1, 139, 2146, 2420, 2904, 3884, 2668, 3565, 4924, 4755, 4579,
-    6533, 5887, 4781, 4552, 4970, 4631, 4604, 4955, 3770, 4280, 5994, 5400,
-    4639, 2590, 1428, 561, 1625, 2324, 1577, 1010, 2106, 2685, 2539, 2826,
-    4804, 5379, 3681, 3473, 3997, 3377, 2030, 2205, 2561, 3288, 3644, 3979,
-    3964, 3970, 3813, 3170, 2438, 1884, 949, 1886, 1687, 426, 448, 1474,
-    2444, 2551, 2748, 2273, 2770, 2690, 1690, 1372, 886, 1206, 1453, 2267,
-    2356, 2251, 1149, 1280, 2048, 1144, 276, -747, -1749, 263, 50, -1916,
-    -1174, -734, -794, 216, 1716, 1341, 1353, 606, -325, 380, -379, -1079,
-    -1085, -310, 680, 1777, 543, -746, -3, 426, 733, 72, -376, -358,
-    -289, -1150, -506, -23, -1233, -638, 1977, 2334, 1965, 2248, 1782, 772,
-    1591, 2534, 1690, 1997, 3216, 3315, 2598, 1803, 2256, 2102, 2601, 2322,
-    1458, 634, 1038, 1220, -87, -543, -535, -1310, 1152, 2309, 2567, 903,
-    264, 417, 392, -934, -1257, -392, 37, -646, -23, 437, 1139, 1407,
-    702, -242, 469, 2154, 1058, 51, 849, 369, 163, 677, 2333, 3743,
-    2774, 1604, 1325, 1331, 1018, 1139, 1110, 1767, 1783, 1669, 1371, -233,
-    -1543, -1376, -766, -1067, -1405, -1602, -452, -1251, -3293, -3562, -3565, -3404,
-    -1549, 4, 188, -660, -1260, -2156, -2269, -1842, -1948, -394, 281, 840,
-    711, 143, 42, -717, -759, -645, 180, 1275, 1153, 666, -1472, -1212,
-    -673, -1143, -612, 775, 769, 827, 778, 913, 1258, 901, 674, 2561,
-    2277, 2213, 4064, 3343, 1748, 2302, 3812, 3982, 2770, 3328, 2880, 1688,
-    -71, -376, 345, 840, 1188, 2419, 2946, 2084, 1710, 754, -242, -323,
-    -90, 198, -260, -703, -675, -598, -2379, -2463, -2541, -2643, -1859, -1387,
-    -1809, -2308, -3372, -5265, -5862, -3816, -2521, -1148, -2000, -3503, -2767, -3217,
-    -3760, -3486, -3354, -2356, -429, 34, -574, 70, -1410, -3266, -3097, -1997,
-    -1838, -1614, -1395, -1577, -3131, -3214, -3709, -3075, -1610, -1453, -1697, -1652,
-    -1096, -2648, -4430, -2993, -1248, -850, -995, -1951, -1162, -349, -1338, -2455,
-    -3166, -3124, -561, -347, -937, -1016, -2606, -3531, -3158, -1283, -751, -966,
-    -1176, -1196, -871, -1622, -1529, -1878, -745, -135, 711, 706, 977, 1558,
-    -17, -1649, -2577, -742, 1124, 365, -712, -1789, -2056, -2803, -3841, -3537,
-    -2791, -1585, -1586, -1979, -602, -1253, -3793, -2907, -1610, -1920, -1761, -3601,
-    -4158, -1134, -1296, -3703, -3926, -2484, -1524, -1657, -1938, -2325, -3204, -4034,
-    -4962, -3018, -2028, -1444, -974, -1892, -1974, -2641, -3892, -3651, -3068, -2086,
-    -1338, -1761, -1880, -1392, -1079, -2384, -4442, -4033, -2424, -1473, -2589, -2888,
-    -2673, -4350, -5272, -3876, -3231, -2620, -1709, -1332, -1368, -1931, -3860, -4003,
-    -2611, -1932, -1729, -2042, -2954, -1756, 823, 694, -1490, -1721, -1140, 37,
-    936, 923, -872, -613, -240, 918, 2604, 3638, 2105, 2277, 3857, 3054,
-    1722, 2473, 3314, 2485, 4035, 4508, 3758, 3755, 4741, 4778, 2848, 3034,
-    3942, 3915, 4695, 3828, 2521, 2022, 1718, 1274, 2538, 3406, 4183, 4512,
-    5597, 4438, 3378, 4451, 4646, 3813, 3872, 2615, 2921, 4061, 3987, 3202,
-    2514, 1949, 3196, 2786, 2781, 3844, 1114, 116, -49, 435, 498, 1064,
-    1830, 1464, 2034, 2245, 1340, 817, 587, 537, 1331, 2360, 2859, 2460,
-    1213, 2671, 3161, 2430, 2620, 1755, 1710, 1959, 1677, 883, -546, -454,
-    -404, 319, 1838, 2071, 1355, 408, -67, -181, -506, -1602, -1716, -130,
-    -702, -19, 730, 777, -250, -193, 126, -337, -19, 4, 224, -1405,
-    -995, -775, -1124, -312, 789, 299, 672, 1046, 1146, 430, 777, 132,
-    427, 1647, 2539, 2291, 2241, 2240, 2650, 2282, 3137, 2799, 2508, 2543,
-    1703, 1207, 1537, 731, -205, 279, 1580, 1561, 1678, 1904, 669, 2632,
-    2645, 1699, 1186, 1732, 1435, 971, 972, 1444, 1268, 1222, 1813, 1785,
-    2413, 3241, 1816, 1070, 982, 364, 232, 618, 1271, 905, 361, 1198,
-    1433, 1373, 879, 389, -355, 232, 515, 1132, 366, -436, 105, 1400,
-    736, -834, -1196, -884, -1129, -213, -989, -1954, -2159, -2088, -1173, -990,
-    -1115, 146, 114, -513, -172, -978, -3211, -2708, -1278, -456, -427, -1037,
-    -11, 684, 752, 341, 706, 782, -27, -828, 608, -192, -1340, -722,
-    -47, -454, -333, 1115, 1633, 1119, 1494, 1939, 461, 351, 1842, 2160,
-    1880, 2007, 2191, 3148, 4504, 3653, 3259, 4180, 3943, 3231, 3239, 3260,
-    3281, 2316, 1632, 1752, 1507, 2536, 3138, 2809, 3385, 2685, 1942, 1007,
-    132, -522, 20, -381, -970, 158, -673, -2473, -1847, -1137, -1611, -1987,
-    -1959, -2397, -2631, -3025, -3491, -4341, -4090, -2766, -2090, -2000, -859, -1496,
-    -2193, -2288, -2787, -2500, -2480, -2366, -1600, -727, -370, -1491, -2077, -1849,
-    -1062, -1196, -1236, -1445, -2172, -1952, -1818, -2297, -3559, -2098, -1279, -1439,
-    -1081, -1013, -2273, -4068, -4045, -3657, -3298, -3411, -2917, -1093, -948, -1874,
-    -3030, -2106, -2633, -4057, -2388, -1957, -2278, -2733, -2889, -4147, -5031, -3343,
-    -2246, -1236, -1469, -555, -1306, -2373, -2173, -2395, -2414, -2277, -600, -267,
-    -514, -48, -623, -961, -676, -1218, -1383, -968, -710, -771, -1335, -3299,
-    -3937, -2084, -1454, -1878, -1478, -1428, -1632, -1112, -1753, -2415, -2114, -2199,
-    -1975, -2564, -3444, -2906, -2944, -2676, -1160, -1584, -2308, -1550, -1789, -2143,
-    -2509, -3036, -3774, -3232, -2609, -2913, -2717, -1577, -1711, -1702, -1686, -3025,
-    -4215, -3646, -2577, -3497, -3716, -2709, -3009, -3165, -3661, -3784, -2784, -2371,
-    -2750, -2991, -2629, -3204, -4413, -3244, -1412, -1593, -2391, -1472, -1609, -2494,
-    -2241, -2951, -3232, -3153, -1920, -1706, -1728, -805, -752, -554, -1028, -1225,
-    -1082, 29, -545, -1334, -1045, -545, -525, 197, 1320, 611, 814, 2233,
-    2437, 983, 539, 1641, 1233, 871, 2193, 2477, 1803, 2020, 2634, 3159,
-    2823, 2710, 3012, 2697, 3504, 4292, 3584, 2102, 1881, 2883, 4042, 4519,
-    3718, 3692, 4212, 4157, 4015, 3437, 2228, 1913, 2046, 2204, 2647, 3039,
-    1567, 920, 1258, 1614, 1623, 1061, 739, 1385, 741, -46, 836, 653,
-    803, 1134, 1573, 2004, 1755, 1248, 1798, 1876, 1221, 1800, 1828, 1899,
-    552, 316, 1620, 1670, 1617, 1787, 812, 212, 1261, 1835, 436, -1305,
-    -88, 915, 366, 950, 891, 971, 1379, 1708, 439, -191, -21, -314,
-    434, -461, -280, 739, 1370, 401, 80, 485, 1279, 1205, 1157, 899,
-    -96, -261, 740, 1434, -338, -976, -520, 1382, 2582, 1924, 1067, 75,
-    136, 940, 1866, 1580, 1858, 1488, 1533, 2257, 2476, 2528, 2208, 1882,
-    2817, 3052, 2846, 1056, 1245, 1751, 1881, 1874, 2556, 2865, 2158, 1187,
-    1272, 1103, 2188, 2901, 2067, 1360, 1215, 1431, 1184, 1157, 507, 2025,
-    3322, 1914, 2327, 1894, 817, 2706, 3889, 2251, 4115, 2342, -1175, 1483,
-    2336, -908, 1350, 1433, 574, 2734, 2018, 1676, 625, -3125, -2595, -684,
-    -1262, -1858, -2502, -1289, -405, -567, 70, -301, 357, 707, 872, 1614,
-    1957, 2071, 2651, 2956, 2866, 3183, 2563, 2949, 3090, 2587, 902, -501,
-    881, 43, -392, -131, -108, 302, 352, 411, -2061, -4111, -4394, -3860,
-    -3163, -2864, -2578, -2094, 279, 1503, 97, -4343, -5817, 3505, 12026, 12103,
-    5881, -3960, -7281, -2550, 1226, 4389, 7173, 8713, 3005, -5806, -7028, -789,
-    7059, 6556, -1922, -4708, 1430, 3545, -1373, -2375, -202, 648, 1571, 4650,
-    3013, -3230, -5658, 218, 8091, 10025, 4396, -2434, -5505, -2194, 2148, 2502,
-    70, -2236, -4832, -6253, -4416, -576, -490, -6688, -13099, -11829, -6274, -1232,
-    905, 2482, 3775, 2289, -51, -1427, -1691, -2132, -2420, -1949, -2711, -5707,
-    -6086, -3571, -1261, -2230, -587, 1590, -3012, -1528, 4433, 7022, 3424, -616,
-    4099, 6435, -1424, -9834, -10485, -6032, -9453, -14857, -13584, -5588, 2375, 4812,
-    4025, -479, -6071, -6830, -3665, -2104, -985, 294, -151, 1134, 4321, 6743,
-    4283, 2340, 707, -2963, -9518, -15271, -12504, -4586, 302, 3112, 3803, -1818,
-    -9127, -8007, 456, 3481, -1896, -4283, -4473, -2601, 2251, 5291, 2024, -713,
-    408, -290, -3676, -235, 6499, 8628, 5184, 2040, 782, 428, -392, 377,
-    1594, 1325, 913, 404, 107, -659, -2726, -5032, -2837, 559, 1860, 1160,
-    -531, 951, 1400, -200, -404, 763, 1686, 2903, 68, -3959, -4161, -2365,
-    -2475, -3345, -3677, -5026, -7024, -5459, -4907, -6177, -5200, -4106, -6106, -7073,
-    -6575, -5020, -3906, -5096, -7351, -5559, -4356, -4739, -4619, -2328, -2494, -3672,
-    -3618, -3649, -3114, -553, 119, -4497, -8033, -6429, -2797, -1767, -4586, -5358,
-    -741, 1976, -1665, -5330, -5211, -3149, -54, 1785, 929, 1300, 1947, 94,
-    -876, 157, 2378, 4485, 5411, 5647, 5897, 3938, 1612, 406, 971, 1403,
-    -982, -145, 3214, 4200, 3473, 3860, 5445, 5404, 5954, 7421, 7765, 6828,
-    6571, 6042, 5174, 4795, 4513, 3705, 4073, 5337, 7533, 9363, 10710, 11382,
-    10479, 10458, 9122, 6356, 5540, 6140, 6082, 5325, 4572, 2664, 1029, 2067,
-    3073, 3097, 2954, 1446, -695, -1094, -1086, -959, -1836, -2700, -3113, -3793,
-    -3153, -2527, -3106, -1682, 132, 845, 1072, 1688, 1718, 2913, 3389, 2381,
-    2294, 2013, 1189, 1079, 223, -632, -1384, -2990, -3057, -986, -475, -1354,
-    -2925, -4666, -4994, -4377, -3712, -3424, -3827, -3921, -2133, -1083, -2197, -3229,
-    -3362, -3873, -5559, -7988, -9906, -9396, -7437, -5184, -3743, -3990, -4069, -4566,
-    -5714, -4617, -1537, 135, -35, -306, -875, -451, 38, -478, -947, -456,
-    -79, -678, -1388, -981, 436, 1450, 2483, 2300, 685, 155, 1653, 2924,
-    2786, 2273, 1780, 2297, 2839, 2622, 2120, 1565, 1480, 2255, 2768, 2265,
-    2277, 2571, 2691, 3303, 3416, 3713, 3913, 3629, 3607, 4174, 4137, 3535,
-    3143, 3332, 4838, 5673, 5172, 4262, 4169, 5011, 5684, 5281, 3714, 2470,
-    2498, 2778, 2613, 2897, 3356, 4042, 4839, 5544, 5571, 4334, 3732, 3753,
-    3806, 5459, 7014, 7089, 7061, 8055, 8522, 7389, 6287, 5832, 5879, 5741,
-    5257, 5268, 4639, 3673, 2564, 1860, 1116, 658, 710, 1475, 1562, 1328,
-    1600, 1754, 1491, 2047, 2961, 2532, 2518, 3607, 3338, 1973, 1103, 911,
-    520, -868, -2501, -3780, -4379, -4311, -4067, -3147, -2275, -2514, -3248, -3948,
-    -3569, -2743, -2856, -3478, -3978, -4273, -4729, -5231, -5708, -5944, -6060, -6763,
-    -7689, -8784, -9565, -10168, -10365, -9473, -8405, -8309, -8749, -9604, -9844, -9136,
-    -7336, -5656, -6644, -8149, -8209, -7194, -6915, -6977, -6921, -6436, -6157, -5837,
-    -6286, -6940, -7162, -6651, -6349, -6485, -6190, -5163, -4956, -4419, -4348, -4980,
-    -4302, -3461, -3149, -2034, -898, -600, -1475, -2987, -4274, -5145, -4784, -3632,
-    -3690, -3055, -2433, -2025, -2102, -1420, 49, 1488, 2329, 2354, 2220, 2925,
-    3858, 3992, 4290, 5001, 6246, 6836, 6308, 5707, 5094, 5206, 5525, 5027,
-    4753, 4756, 4654, 5606, 5911, 5324, 4903, 5554, 6224, 6433, 6706, 6827,
-    6916, 7042, 6628, 6298, 6707, 7566, 7730, 7461, 7435, 7004, 6256, 5771,
-    6350, 7018, 7232, 6985, 6491, 6670, 7889, 8403, 8196, 7047, 6256, 6094,
-    5953, 5686, 5106, 4287, 3511, 2710, 2444, 2381, 2780, 3249, 3499, 4065,
-    4456, 4310, 4334, 4085, 3910, 3516, 3451, 3006, 2040, 1294, 778, -171,
-    -1725, -2776, -2911, -2119, -1318, -1377, -2370, -3404, -3176, -2431, -2557, -2104,
-    -1277, -470, -150, -235, -300, -402, -1712, -3667, -5152, -5193, -5391, -6093,
-    -7221, -7874, -7442, -7100, -7660, -7659, -7952, -8129, -8123, -8457, -8440, -7773,
-    -7722, -7893, -8416, -8828, -8960, -9047, -8862, -8889, -9324, -10252, -10764, -10431,
-    -10736, -10748, -9831, -9432, -9483, -9820, -10062, -9861, -8953, -8401, -8547, -9419,
-    -9681, -9743, -10193, -9938, -9087, -8748, -8805, -8424, -7590, -6295, -5457, -5886,
-    -6149, -5500, -4556, -4584, -4706, -4770, -4745, -4711, -4994, -4954, -4672, -4194,
-    -2852, -2213, -1733, -1028, -946, -1091, -573, 134, 836, 1608, 1951, 2324,
-    2900, 2577, 2345, 1633, 2007, 2768, 3158, 3070, 2932, 2743, 2776, 3128,
-    4135, 4111, 4390, 4917, 5491, 5918, 5109, 4951, 5767, 6370, 6758, 7266,
-    7918, 9261, 9859, 9079, 7795, 6841, 6564, 7507, 8120, 8197, 7611, 7293,
-    7308, 7918, 8206, 7803, 7852, 8225, 8318, 9189, 10003, 10310, 10159, 10730,
-    10895, 10755, 9681, 8930, 8389, 8480, 9106, 8431, 7477, 7781, 9420, 10337,
-    10914, 11595, 11987, 11948, 12009, 12341, 12921, 12597, 11901, 11349, 10557, 11003,
-    11950, 11646, 10325, 9449, 8791, 8658, 8197, 6891, 6260, 6788, 7367, 6814,
-    5799, 4921, 4591, 4827, 4740, 4423, 3070, 1888, 1417, 1343, 862, 917,
-    1012, 767, 780, 1814, 2239, 2282, 1718, 1575, 1107, 457, 538, 40,
-    -665, -1334, -1577, -2352, -3579, -3446, -2600, -3095, -3550, -4876, -6553, -7200,
-    -7506, -7286, -7920, -8346, -8121, -8805, -10155, -10493, -9882, -8501, -7730, -7919,
-    -8690, -10344, -11606, -12400, -12448, -12365, -12219, -12493, -12163, -11497, -10608, -10138,
-    -9660, -9718, -10155, -9968, -10069, -11392, -12278, -11998, -10915, -10674, -11255, -11680,
-    -12332, -12386, -10700, -10598, -11585, -11726, -10476, -9855, -9482, -9113, -8603, -8181,
-    -7503, -7434, -8284, -8330, -8340, -8400, -8695, -9017, -9632, -9246, -8803, -7791,
-    -7311, -7492, -8174, -8409, -7522, -6462, -5637, -5862, -5910, -5177, -4358, -3963,
-    -4277, -3959, -3826, -3989, -4395, -4599, -4911, -4328, -3186, -2421, -2644, -2193,
-    -1408, -1335, -1320, -935, -409, 156, 1276, 1988, 2099, 2360, 3123, 3495,
-    3610, 3652, 4313, 4955, 4239, 3617, 3460, 3654, 3855, 3416, 3129, 4145,
-    5145, 5694, 6098, 5684, 5646, 6762, 7889, 8074, 8235, 8467, 9214, 9182,
-    8343, 8347, 9430, 9405, 9841, 10223, 9831, 8969, 8541, 8383, 8721, 9540,
-    9324, 8982, 9111, 9702, 11543, 12033, 11633, 10771, 10063, 10019, 9671, 8299,
-    7612, 7122, 7766, 8642, 9255, 9358, 9679, 10871, 11112, 10752, 10665, 10522,
-    10319, 9639, 8832, 9369, 8910, 7803, 7753, 9074, 10499, 11088, 10305, 8362,
-    7235, 7631, 8358, 8592, 8490, 9243, 10356, 10809, 10434, 10214, 9994, 9818,
-    9076, 8303, 6585, 6392, 5790, 4827, 4599, 4674, 4837, 4588, 4373, 3900,
-    3126, 2722, 2624, 1833, 1064, 223, -667, -1825, -2163, -1674, -1609, -1656,
-    -1554, -1829, -1764, -1444, -1577, -3088, -4661, -4358, -3324, -2788, -3767, -4193,
-    -4810, -6023, -6483, -7068, -7183, -6656, -6415, -6367, -7253, -8930, -9710, -10193,
-    -10290, -10472, -10461, -10755, -11181, -11094, -10452, -10365, -10241, -10940, -11031, -10632,
-    -11065, -11352, -11546, -10742, -10045, -9957, -10629, -11705, -12253, -11936, -11991, -12510,
-    -12403, -11641, -10838, -10676, -10507, -11057, -11136, -10295, -10770, -11599, -12219, -12184,
-    -11797, -11908, -12267, -12377, -12885, -13746, -12806, -10778, -9443, -9310, -9629, -9902,
-    -8683, -6965, -5623, -5362, -6199, -5543, -5293, -5749, -6113, -6387, -6315, -6349,
-    -7019, -7024, -6086, -4792, -3646, -1981, -1247, -894, -1079, -563, 72, 455,
-    -81, 701, 1855, 1620, 2425, 2553, 2439, 1167, -280, -596, -53, 620,
-    357, -310, -780, -540, 183, 218, -629, -886, 28, 1296, 1615, 1587,
-    1493, 1303, 940, 591, 1958, 3465, 3775, 3188, 3225, 2916, 3385, 2171,
-    1285, 1841, 2798, 2994, 3220, 2413, 3343, 4227, 4226, 4417, 4782, 5356,
-    6260, 7302, 7093, 5739, 5326, 4776, 4968, 5128, 5803, 6769, 6681, 6169,
-    6405, 6714, 7412, 9661, 11070, 9981, 8477, 7893, 8782, 9502, 9556, 10159,
-    10590, 10961, 11198, 11708, 11993, 11051, 10475, 9955, 9924, 11726, 12937, 12523,
-    11912, 11955, 12170, 11897, 11657, 11948, 12200, 11572, 10662, 9392, 8773, 8074,
-    7634, 7840, 8132, 9996, 10653, 10185, 8909, 8205, 7795, 7963, 8530, 8453,
-    8513, 9004, 8231, 6794, 5798, 5054, 5113, 5063, 6068, 5667, 4503, 3905,
-    3678, 3363, 2862, 3002, 2502, 2003, 1692, 965, 674, 26, -565, 139,
-    485, 1941, 2269, 1391, 289, -961, -1737, -1816, -1860, -1195, 185, 592,
-    -321, -1426, -1873, -571, -16, -392, -829, -866, -1721, -2335, -3929, -4869,
-    -5022, -4710, -4409, -4894, -5099, -4933, -5554, -6661, -8307, -7761, -6783, -6474,
-    -5643, -6212, -8042, -8650, -9364, -9215, -8488, -7898, -8043, -8312, -6849, -7633,
-    -9825, -9727, -9881, -9354, -8244, -7747, -7189, -6444, -6710, -7190, -6124, -6761,
-    -7304, -6850, -6281, -5997, -6860, -8496, -9634, -10276, -9437, -9491, -9189, -8420,
-    -6828, -5503, -7533, -7566, -7836, -8955, -9189, -8051, -6979, -5211, -5499, -7291,
-    -7071, -6161, -5978, -6859, -8060, -8637, -7607, -7311, -7439, -7134, -7011, -6699,
-    -6200, -5055, -4356, -3266, -5325, -6463, -5603, -5500, -4921, -4013, -3349, -3504,
-    -2625, -3026, -1910, -2095, -1608, -1000, -181, -345, 223, -540, -2086, -1743,
-    -726, -695, -437, 526, 612, 1452, 788, 1106, 960, -228, -977, -888,
-    545, 1523, 2208, 580, -1593, -294, 1276, 1434, 1938, 2470, 3409, 4563,
-    3969, 3189, 2654, 2206, 2263, 3641, 6567, 8039, 6760, 4439, 3236, 4085,
-    5220, 5978, 6197, 5849, 6998, 9133, 9613, 8561, 8226, 7554, 8165, 9240,
-    10879, 10550, 8247, 6657, 5873, 6266, 7032, 8155, 8427, 8275, 8752, 9142,
-    7722, 7566, 7692, 8321, 9100, 10975, 11805, 10581, 9169, 8515, 8495, 8270,
-    8275, 6531, 6518, 6973, 7266, 7600, 6684, 6190, 6325, 5767, 7747, 8562,
-    5921, 3411, 1041, 852, 2854, 3740, 3015, 2413, 2860, 4197, 4769, 3561,
-    2140, 1089, 1707, 2252, 3425, 3838, 1587, 926, 1633, 2232, 4089, 4388,
-    3376, 3169, 3184, 3612, 1955, -139, -892, 351, 1982, 2860, 3350, 1726,
-    199, -770, -789, -741, 154, 175, 482, 36, -1314, -2631, -3852, -3838,
-    -3080, -3520, -2267, -1961, -3687, -5911, -7357, -8117, -9645, -7698, -6976, -8423,
-    -6910, -5859, -6237, -5373, -5375, -4363, -5395, -5977, -4768, -3824, -4107, -5683,
-    -7177, -8263, -5844, -3470, -4572, -4279, -3781, -2952, -2198, -1840, -3178, -4321,
-    -4682, -3962, -3653, -3514, -3918, -4573, -5422, -5272, -3979, -4729, -6012, -6822,
-    -6768, -7090, -6808, -7907, -8512, -8543, -6529, -4888, -5084, -6721, -7861, -8182,
-    -8631, -6920, -5782, -6640, -5603, -4367, -4556, -5570, -5972, -4388, -6032, -6987,
-    -4422, -3884, -3712, -5342, -6480, -6886, -6881, -4375, -4095, -4850, -3993, -1405,
-    -2322, -3566, -4451, -3549, -4027, -3168, -1914, -182, 30, -474, -1883, -2426,
-    -1301, -1281, -34, 33, 1601, 2808, 2741, 2988, 3127, 2786, 2599, 2728,
-    3510, 4056, 4738, 4586, 4165, 4104, 4431, 5856, 7063, 8127, 8229, 5773,
-    5042, 5680, 6836, 6659, 6345, 6189, 6210, 5385, 4002, 3996, 4127, 4272,
-    3712, 4086, 3989, 3962, 3075, 1671, 1269, 3500, 3822, 2956, 2014, 2479,
-    3237, 2629, 1274, 372, 127, 508, 1777, 2265, 2466, 1760, -315, -1636,
-    -771, 2006, 2921, 2424, 1104, 1326, 634, 284, -160, -647, -1634, -3231,
-    -1701, 963, 1694, 1049, 691, 1404, 2306, 3079, 2886, 1600, 1574, 2417,
-    2412, 2620, 2828, 3877, 3945, 6283, 7948, 8294, 7327, 5948, 4868, 5603,
-    5949, 5874, 6412, 6275, 7755, 7935, 6252, 5481, 6592, 6703, 6248, 5280,
-    5729, 5013, 5160, 4162, 2550, 4084, 4526, 4058, 4241, 2831, 3251, 2995,
-    1756, 1364, 434, 553, 1217, 2544, 4296, 4698, 3939, 2566, 2153, 2571,
-    3479, 4805, 3939, 2648, 1618, 804, 1186, 2812, 2190, 870, 1312, 2013,
-    1582, 2131, 2305, 1962, 2972, 3994, 4166, 3381, 3106, 3583, 2883, 2691,
-    2573, 2773, 1836, 1779, 2242, 1988, 1866, 1156, -329, -1018, -54, -418,
-    334, -196, -27, -1621, -3555, -3328, -3061, -3257, -2744, -3784, -4620, -4880,
-    -3927, -3598, -4611, -4043, -4635, -5585, -5608, -5966, -5720, -6775, -7355, -7282,
-    -8077, -8781, -7831, -6821, -7228, -6265, -6894, -7970, -7405, -7196, -7690, -7412,
-    -7166, -6209, -6954, -6660, -5819, -5962, -6977, -7170, -6490, -6015, -5233, -4275,
-    -4298, -4763, -3478, -4234, -3880, -3288, -2501, -2815, -3952, -4556, -5080, -5139,
-    -4539, -4050, -4199, -4600, -4604, -5653, -6466, -4753, -4419, -6076, -4604, -3392,
-    -2367, -3325, -4911, -6344, -6533, -4954, -2037, -1269, -2436, -3368, -4464, -3774,
-    -3686, -1944, -3882, -3812, -2656, -1656, -1662, -2235, -2914, -3525, -4024, -3656,
-    -2679, -2085, -1895, -2602, -2575, -2776, -2664, -1660, -2291, -1340, -978, 14,
-    -1436, -2259, -2691, -3116, -4117, -2292, -2946, -4109, -2727, -2761, -868, -1159,
-    -72, -537, -194, 613, 679, 886, 563, -1558, -1348, -1696, -787, 1639,
-    3038, 3674, 3053, 2334, 3837, 3306, 2524, 2373, 3918, 3678, 4265, 4381,
-    3605, 2143, 1899, 984, 3736, 5537, 5508, 4614, 2092, 1300, 2254, 2322,
-    1587, 2011, 4523, 4724, 5091, 4856, 3127, 1813, 587, 1586, 4111, 5387,
-    6468, 5582, 4918, 5994, 5653, 4592, 5131, 7150, 8423, 8690, 8363, 6628,
-    4263, 4129, 4025, 5500, 7863, 7504, 6814, 5749, 5584, 6863, 7039, 6335,
-    6363, 6553, 7622, 7968, 6821, 4870, 3041, 2826, 4078, 6079, 7343, 7119,
-    5087, 3680, 3753, 4229, 2082, 1385, 3568, 4831, 5232, 4277, 3167, 2184,
-    1452, 564, 2039, 3418, 3692, 3189, 1151, 1279, 863, 502, 1277, 1511,
-    2911, 3399, 2226, 1253, -218, -2366, -3203, -2615, -1550, -336, -355, -1831,
-    -1985, -541, -2750, -5405, -5988, -5481, -3130, -2327, -4318, -4920, -5460, -5451,
-    -4091, -3828, -1832, -396, -1308, -2424, -1848, -795, -1476, -54, 1145, 1207,
-    1906, 918, 653, -444, -996, -1424, -1501, -40, 1582, 1514, 195, -1731,
-    -1254, -2662, -3691, -2215, -517, 61, -644, -2280, -3143, -4877, -5175, -5026,
-    -2409, 324, 720, -1656, -3068, -3673, -3382, -3972, -3880, -3804, -2785, -912,
-    -1562, -2533, -3197, -4047, -3511, -4054, -3390, -1871, -3032, -5300, -5140, -4506,
-    -5312, -6118, -6609, -6502, -5299, -4361, -6035, -5777, -7025, -6400, -6327, -7274,
-    -6692, -5614, -6888, -7559, -6662, -5699, -4103, -1772, -1233, -793, -1149, -2530,
-    -2040, -380, -1381, -1188, -928, -104, 420, 1028, -109, 1511, 1471, 171,
-    1072, 1174, 1589, 2022, 3509, 213, -506, 862, 1514, 1097, 2177, 3701,
-    3114, 1310, -815, -84, -1008, -2389, -2085, -2982, -3260, -1608, -1224, -2771,
-    -2879, -3542, -3003, -4814, -5305, -3978, -3185, -3580, -4664, -3965, -3878, -3351,
-    -3843, -2759, -2137, -1016, -1311, -1460, -2121, -1829, -1623, -2440, -1525, -330,
-    -567, -1240, -466, -1952, -1767, 9, 900, 2782, 2298, 396, 50, 1403,
-    2166, 3231, 2134, 1339, 3475, 3507, 3057, 3567, 3758, 1756, 4110, 4096,
-    4774, 6114, 5267, 3666, 3140, 3337, 3847, 5697, 4414, 4997, 6795, 4341,
-    1848, 3135, 2279, 3339, 4264, 3676, 3728, 5109, 3510, 2958, 2166, 635,
-    1769, 2506, 22, 1317, 2014, 369, 545, -73, -1039, 1748, 1676, 1559,
-    2828, 4035, 1647, 2421, 3129, 2908, 3727, 4058, 4209, 4489, 4249, 3845,
-    5234, 4669, 5632, 7601, 8403, 8695, 9985, 7422, 6337, 6661, 6514, 7743,
-    9118, 8849, 8380, 8009, 7437, 8240, 7632, 6643, 6678, 6879, 6905, 9110,
-    9168, 6013, 2438, 3460, 5320, 5767, 5455, 6458, 6642, 4699, 5042, 3571,
-    -263, 1156, 3115, 3035, 1377, 2974, 2545, 1944, 872, 116, 1055, 842,
-    -653, 168, -262, -985, -496, -3367, -3090, -797, 71, -1567, -1429, -1996,
-    -2925, -3480, -4100, -4332, -3243, -4225, -4571, -3623, -5195, -4583, -3373, -4569,
-    -2596, -73, 1760, 323, 1217, -1383, -2935, -2619, -1711, -623, -227, -13,
-    1064, 1080, -211, -797, -2449, -2914, -2140, -1095, -1917, -1768, -1280, -3008,
-    -6127, -6160, -5924, -6591, -6790, -5468, -3357, -4054, -5567, -7715, -9372, -8780,
-    -6793, -5411, -7047, -7739, -6514, -5847, -7660, -7954, -7079, -7141, -7580, -6937,
-    -6448, -5620, -5236, -7545, -7726, -7309, -6236, -6395, -5520, -4892, -3838, -4058,
-    -3631, -2950, -2535, -2290, -1255, -1245, -2530, -1748, -1807, -4151, -3622, -2059,
-    62, 578, -619, -1453, -2317, -4103, -3600, -1960, -1185, -2573, -1484, -2857,
-    -3081, -2510, -3439, -4790, -4476, -4094, -2864, -1548, -2387, -3438, -5781, -5898,
-    -4950, -4191, -4591, -5187, -3424, -1763, -1516, -1887, -5222, -6348, -4563, -2381,
-    -1891, -3583, -5636, -5579, -5462, -4677, -3872, -2999, -5074, -5118, -4335, -3684,
-    -3784, -3200, -5819, -5969, -4703, -4538, -3387, -1049, -837, -10, 868, 410,
-    -610, 821, 1772, 1126, 1278, 1771, 3811, 4632, 3705, 3495, 4334, 6412,
-    6448, 4864, 2179, 2230, 3190, 4279, 3605, 3286, 3087, 2246, 3763, 3796,
-    4643, 3470, 1231, -1314, -600, 1675, 3842, 3075, 2043, 2911, 4235, 3381,
-    2061, 5024, 5281, 5099, 4699, 5022, 3408, 1930, 1572, 655, 2492, 3699,
-    4282, 3059, 3436, 3003, 3305, 2707, 229, 1335, 1255, 1653, 1088, 2914,
-    1398, 993, 212, -1068, 448, 2694, 1257, 1272, 2470, 36, -297, -1025,
-    322, 1564, 874, -978, 128, 1963, 2484, 3090, 2567, 3052, 5013, 3971,
-    1873, 2526, 4598, 5579, 6712, 6102, 7160, 7679, 7508, 6139, 6858, 6837,
-    5612, 4499, 3577, 4058, 7221, 5927, 4489, 4217, 4704, 2397, -159, 1339,
-    2680, 4404, 2639, 299, -786, 443, 1097, 318, -446, -1369, 1044, 2110,
-    1733, 2194, 1619, 138, -611, -152, 2608, 3828, 1993, 1606, 1471, 2840,
-    1325, 562, 873, 2018, 4624, 5133, 3935, 3526, 2375, 2589, 3270, 3534,
-    3718, 2588, 1525, 1830, 2828, 4694, 3466, 4861, 5070, 3398, 3578, 2804,
-    1837, 3203, 3913, 5067, 6110, 6851, 5890, 5733, 4821, 4209, 4895, 4581,
-    3001, 5966, 6463, 4089, 3724, 2553, 1483, 1897, 1767, 2287, 2494, 4335,
-    3158, 2187, 955, 1055, 2869, 1661, 1002, 1494, -405, -33, 376, -155,
-    -1166, -2048, -1954, -3734, -3700, -3353, -5153, -4616, -6952, -7619, -6434, -7182,
-    -6831, -6087, -6185, -5352, -3833, -4425, -6583, -5232, -2859, -3094, -3095, -2478,
-    -2599, -588, -676, -1334, -1039, -170, -333, -1865, -3128, -2256, -1513, -4044,
-    -5061, -2557, -702, -428, -208, -297, -755, -855, -2918, -4659, -3528, -1034,
-    -634, -1635, -1513, -668, 1032, -898, -1096, 777, 1995, 1856, 951, 664,
-    650, -1410, -1762, -1617, -241, 763, -737, -1457, -1090, -624, -1551, -5097,
-    -3454, -2956, -3363, -2879, -4432, -3867, -4173, -4883, -6474, -6228, -4702, -4502,
-    -6602, -5918, -5890, -5955, -6882, -6245, -3160, -3014, -3886, -5271, -4167, -534,
-    -766, -2445, -2386, -19, 1109, 727, -1015, -462, -219, -41, -1308, -61,
-    2246, 2326, 3428, 1756, 2047, 3334, 1901, -1191, -116, 2702, 2087, -1081,
-    -1212, 269, 525, -902, -2636, -2227, -2285, -882, 176, -2599, -2490, -2709,
-    -4545, -5998, -4795, -3703, -5184, -4709, -4375, -3044, -2192, -3226, -3525, -3469,
-    -3812, -1871, -2768, -2167, -1688, -1564, -4178, -4629, -2649, -1872, -2243, -1106,
-    -595, -296, 224, 1231, 2001, 448, -345, 12, -865, 2013, 3899, 2469,
-    -124, 761, 3520, 2353, 1415, 1731, 603, 524, 1023, 1581, 2866, 2887,
-    3507, 2341, 2747, 3893, 4215, 2381, 23, 1014, 1854, 77, 250, 741,
-    254, -722, -515, -450, -1995, -746, -912, -1591, -2029, -2629, -3763, -5511,
-    -6311, -4154, -3218, -2328, -2759, -3107, -3638, -3159, -2110, -4346, -6924, -5427,
-    -4551, -1481, -501, -915, -1791, -2006, -2022, -2235, 170, 1109, 1452, 611,
-    -245, 703, 3387, 2208, 910, 2147, 2234, 4169, 5255, 5185, 4733, 3965,
-    4241, 3501, 6094, 5731, 4339, 2609, 2491, 4355, 7652, 4830, 5257, 4636,
-    4463, 5704, 5124, 3901, 898, 931, 1194, 2640, 4648, 2463, 1531, 1105,
-    1956, 3299, 3219, 1472, 2647, 2557, 1510, 2030, 2875, 2921, 1815, 2907,
-    2713, 5420, 5446, 2734, 397, 343, 1475, 2614, 1107, -1230, -860, 355,
-    1627, 2218, 3199, 825, -1406, -2339, -1529, 1982, 759, -1049, -2792, -859,
-    2222, 4107, 3471, 1849, 2380, 2706, 4723, 5401, 6483, 5588, 5407, 4776,
-    5021, 5979, 4718, 4593, 3968, 4651, 6128, 5470, 4895, 3362, 3542, 3466,
-    4506, 5150, 3757, 2088, 1759, 2331, 2258, 1455, 574, -1892, -4476, -2736,
-    -2660, -1776, -1223, -2889, -2035, -2152, -1753, -2611, -2899, -4282, -4236, -2238,
-    -1051, -1481, -1339, -3768, -3565, -1391, -639, 1323, -96, -471, 1050, 372,
-    978, -850, -1056, -2874, -2464, 97, 1424, 1428, -405, -2827, -1418, 1209,
-    2467, 2079, -624, -2286, -744, 603, 2140, 1809, 2390, 1483, 1, -927,
-    -1584, -765, -2486, -3321, -1357, 384, 1020, 1867, 554, 805, 1952, 2077,
-    390, -433, 892, 774, -317, -2915, -1216, -750, -3075, -3807, -3149, -1713,
-    260, 233, -2469, -4470, -3305, -3438, -4801, -5821, -5549, -4998, -5513, -5100,
-    -2027, -4188, -6233, -8175, -8420, -7649, -6423, -5135, -5899, -5093, -2157, -2871,
-    -4686, -5515, -2682, -1730, -2982, -2148, -1095, -2304, -1831, -1534, -219, 214,
-    1139, 1401, -924, 677, 1961, 1511, -331, -678, -834, -3650, -4155, -1716,
-    481, 15, -1402, -878, 206, 2392, 3551, 2576, -190, 1251, 1626, 1747,
-    1693, 2535, 3078, 1509, 1973, 3528, 3775, 1995, 450, 1065, 1191, 1900,
-    1215, -601, -564, 1714, 2016, 819, -616, 1124, 2365, 1986, 2793, 1912,
-    1740, -406, -2048, -2938, -940, 959, 1868, 1083, 1249, 825, -1413, -3139,
-    -5052, -3982, -4029, -3933, -3611, -4036, -2574, -2007, -2483, -2513, -800, -192,
-    -376, 1003, 2509, 3048, 3061, 2037, 1242, 2133, 2369, 3724, 3766, 2602,
-    1419, 120, -1697, -539, 881, 1703, 929, -67, -604, -400, 1187, 600,
-    582, 825, 858, 1226, 281, -1012, -2522, -3453, -1369, 968, 1693, 486,
-    806, 1219, 722, 886, -567, -1579, 398, 3316, 4596, 3236, 1827, 97,
-    -754, -644, 2506, 4695, 3963, 2884, 2271, 2785, 1689, 1271, 420, 1065,
-    2704, 3940, 4101, 2941, 2555, 2958, 1670, 262, 626, 1437, 1151, 2260,
-    3617, 5092, 5908, 4495, 3069, 3390, 4951, 5362, 5271, 4085, 3604, 3644,
-    4044, 5268, 5892, 5066, 5586, 5224, 6029, 6191, 5464, 3000, 2387, 2573,
-    2552, 2249, 1216, -52, -246, -1966, -1231, 748, 950, 371, 1657, 1930,
-    736, -955, -2981, -3086, -1354, 942, 632, 240, -1216, -2449, -6032, -8050,
-    -6365, -3873, -3498, -2354, -1875, -1245, -830, -2467, -3644, -2647, -743, -177,
-    -302, 334, 378, 277, -1294, -2459, -1572, 313, 878, 1747, 3148, 2977,
-    2608, 802, 674, 852, 422, -679, -56, -21, 998, 487, -340, -839,
-    525, 259, -381, 475, 1089, 891, 760, -477, 929, 1824, 520, -291,
-    1259, 1213, 752, -1345, -1805, -1575, 157, -1273, -2130, -1116, -2069, -2122,
-    -3641, -5379, -3752, -3133, -4022, -4732, -4088, -4196, -6488, -9003, -9037, -7418,
-    -4456, -4872, -4983, -4296, -4159, -4159, -6153, -6766, -6086, -5631, -5800, -5099,
-    -3317, -1597, -1775, -2955, -4671, -3393, -303, -1227, 115, 689, 287, 509,
-    634, 338, -197, -876, -1496, -273, 2139, 2342, 943, -1396, -3320, -1155,
-    1637, 2155, 2240, 682, -276, -322, 672, 736, -569, -2960, -4080, -3007,
-    -1755, -3419, -4907, -6303, -5862, -3159, -4109, -4032, -4107, -4369, -3730, -3069,
-    -1803, -1647, -2598, -2452, -2876, -415, 1279, -1248, -2727, -3182, -1664, 447,
-    -607, -1836, -2146, -2679, -2753, -1684, -81, -1749, -2625, -2296, -794, 2814,
-    4744, 2486, -77, -2700, -186, 1800, 1303, 1865, 3128, 3012, 4060, 5989,
-    6306, 2350, 2575, 2843, 4919, 6587, 6926, 5233, 3531, 3358, 5796, 5994,
-    5618, 5172, 4102, 2748, 2728, 4622, 3328, -250, -1106, -1608, -95, -232,
-    -739, -1539, -1915, -1476, -422, -776, -1745, -3543, -3365, -3070, -2265, 637,
-    159, -1940, -2423, -387, -338, -969, -2906, -4873, -4186, -2151, 735, 1251,
-    -802, -2152, -1616, -174, 2012, 3283, 1658, 387, 920, 1219, 1067, 2566,
-    1890, 35, 727, 2179, 3081, 3252, 1826, 756, 2490, 4475, 5595, 4396,
-    2638, 2072, 3373, 3178, 1781, 1921, 1162, 576, 1442, 2372, 3586, 1721,
-    -1397, -1292, 1709, 4314, 5967, 4261, 1677, 1869, 3889, 2871, 505, 1233,
-    1295, 1410, 1991, 2932, 2218, -872, -2523, -1111, 1855, 3524, 3827, 2335,
-    1062, 1753, 2245, 702, -1332, -2253, -1992, -563, 1175, 3384, 2392, -850,
-    -3017, -2208, -782, 91, -846, -1236, -106, 612, 1350, 770, 204, 1447,
-    1619, 1639, 2641, 4288, 3586, 2831, 3837, 4827, 5294, 4359, 2519, 2974,
-    3243, 3449, 2172, -1128, -2432, -1048, -957, -795, 897, 1712, -297, -1049,
-    164, 1203, 3524, 2817, 1066, 189, -842, 668, 490, -1621, -791, 975,
-    701, 1935, 2804, 1796, 165, 496, 1355, 2835, 3476, 2938, 2957, 3107,
-    1993, 2441, 660, -2062, -1590, -420, 1185, 3165, 2854, 1126, 29, 6,
-    280, 1849, 2265, 2151, 3349, 3648, 2103, 1843, 58, -728, -1446, -2455,
-    -2618, -886, -1360, -1783, -337, -645, -841, 227, -217, 45, 802, 449,
-    1048, 450, -689, 103, 295, 658, 2018, 4199, 1635, 731, 1204, -627,
-    -691, 749, -934, -2561, -3304, -2908, -1798, -2521, -3314, -2491, -2638, -2325,
-    -577, -1358, -4082, -2126, -1024, -1918, -1128, -1227, -1180, -138, -196, -669,
-    -1879, -3354, -4135, -2878, -1915, -94, 1372, -213, -913, 616, 165, -1476,
-    -358, -462, 663, 1422, 1136, -839, -1347, -197, 625, -267, -2110, -1135,
-    -1327, -1516, 143, 1105, -728, -2018, -489, 374, 1982, 1540, 467, -1793,
-    -1248, -280, 798, 139, 195, 462, -192, 210, 549, 1838, 1381, 2308,
-    3352, 3064, 2221, 682, -16, -457, 374, 936, 699, -1081, -950, -2178,
-    -3058, -2764, -1566, -777, -695, -970, -429, 1835, 1959, 91, -1588, -2271,
-    -471, 21, -918, -1552, -1652, -2241, -1424, -2973, -4301, -4631, -4902, -6191,
-    -5111, -2657, -2225, -2644, -3255, -2484, 185, 133, -2060, -4140, -3844, -2205,
-    218, 1118, 1042, 1305, -410, -313, 1788, 2368, 1030, 198, -1462, -1064,
-    454, -152, -2304, -3000, -2550, -90, 548, 491, -242, 193, 76, 213,
-    309, -1597, -2664, -1928, -1618, 557, 468, -1061, -2555, -3121, -1950, -1202,
-    120, 92, -369, -288, -762, 1023, 2846, 1451, -846, -2687, -3529, -1621,
-    -1710, -3082, -5084, -6394, -4302, -4585, -4216, -5825, -5889, -5707, -5188, -2573,
-    -1152, -968, -1379, -1992, -618, 529, -771, -3324, -4718, -3046, -1179, 1332,
-    1779, 826, 925, 1440, 4065, 4446, 4332, 3062, 2185, 2760, 3501, 2751,
-    856, -406, -316, 626, 2373, 3556, 2851, 1149, 815, 1097, 3285, 2000,
-    300, -1153, 542, 3633, 2865, 1054, -1222, -2993, -2638, -2322, -1658, -2313,
-    -2411, -2703, -3064, -2993, -1290, -1779, -3919, -4953, -3382, -2155, -4120, -4947,
-    -4436, -4050, -2740, -1772, -873, -1243, -931, 349, -170, -396, 486, 231,
-    -470, 222, 2820, 3002, 236, -1202, -2091, -1877, -393, 1540, 1888, 1479,
-    2252, 3181, 4808, 6166, 6100, 3312, 2548, 4345, 6531, 5742, 3308, 2212,
-    1418, 2931, 4159, 5239, 4595, 5119, 5237, 5809, 7484, 7975, 5059, 1724,
-    2595, 4933, 5992, 4151, 1877, 470, -1320, -292, -543, -1683, -2637, -386,
-    797, 1681, 2069, 2414, -1037, -2750, -388, 2186, 2259, -129, -238, -1625,
-    -1952, -121, -387, -2217, -2733, -642, -63, 413, 770, -679, -3517, -1713,
-    2200, 4098, 2790, 799, -569, -3468, -1927, -4, 92, -1668, 188, 2216,
-    2794, 3163, 3433, 1037, -971, 822, 2962, 3133, 1225, -575, -1905, -1492,
-    558, 2987, 2498, 993, 2025, 2807, 2994, 2495, 1377, -1412, -1791, -625,
-    938, 848, 61, -944, -1126, -418, 220, -23, -2557, -2627, 199, 2623,
-    2829, 2165, 1039, -205, 1054, 1795, 1908, 588, -976, -2185, -445, 422,
-    816, -832, -2281, -2310, -82, 1338, 629, -251, -1005, -450, 2356, 3205,
-    3015, 1344, -1403, -2396, -1707, -931, -547, -1106, -1274, 830, 3205, 3857,
-    3096, 3292, 3402, 3327, 3919, 3795, 3833, 1413, -735, 320, 640, 1346,
-    1005, 1333, -41, 610, 1007, 299, -1390, -1522, -1103, -930, -1683, -1300,
-    -1004, -2212, -2224, -626, -877, -2467, -3054, -3359, -2682, -579, 950, 244,
-    17, 356, 1908, 1567, 1427, 1802, 148, -2183, -1407, -42, -266, -801,
-    -812, -1421, -1438, -1853, -1843, -1543, -690, 118, 561, 733, 2186, 1808,
-    -12, -1835, -1690, -292, 788, 1633, 1156, 1870, 2032, 370, -363, 113,
-    2070, 2543, 890, 503, 55, -2137, -4255, -4734, -3606, -1556, -812, -872,
-    -791, 63, 14, -806, -1104, -730, 1656, 2618, 1836, 2143, 554, -1173,
-    -1732, -1672, -1129, -1182, -3071, -4168, -3393, -2423, -2785, -2138, -1826, 85,
-    719, -707, -691, 1163, 283, -975, -861, -1741, -740, 353, 388, 497,
-    815, -1560, -3289, -3268, -1131, 1721, 1712, 82, 1701, 1641, 541, -492,
-    -1587, -3147, -1246, -1030, -1308, -470, 133, -1263, -1566, -1076, 1154, 3080,
-    2876, 2400, 2533, -69, -2907, -2609, -2260, -1860, 70, 69, 1091, 2493,
-    1873, 1454, 499, 276, 1179, 2726, 2378, 2540, 1764, -598, -1047, 1037,
-    1386, 1143, 620, -235, 616, -141, -1701, -1875, -1327, 1537, 2832, 2298,
-    1050, 1091, 593, -976, -1093, -801, -1758, -1234, -350, 838, 502, -1690,
-    -3439, -4661, -3268, -165, 749, 1035, 504, 196, -713, -2281, -3238, -3830,
-    -4626, -3222, -2310, -2089, -3410, -3152, -2166, -1973, 320, 1605, 1972, 2537,
-    2176, 1472, -627, -1557, -850, 374, 92, 1687, 2119, 1424, -57, 1243,
-    2124, 1209, 1603, 1065, 1880, 1744, 44, -437, -2002, -1307, 659, 229,
-    -1242, -1503, -2734, -3646, -3305, -2085, -1646, -350, 885, 1705, 1794, 462,
-    -1297, -2494, -3013, -904, -743, -2016, -669, -555, -2283, -2574, -2310, -2243,
-    -3242, -3152, -2991, -1514, -923, -1991, -2315, -3829, -3849, -2955, -3857, -3611,
-    -1567, -1386, -2157, -1849, -1201, -152, 1196, 1094, 1581, 2392, 2883, 2994,
-    2043, -31, 1395, 1836, 792, 1167, 1530, 465, 1206, 1928, 3193, 2821,
-    2959, 1467, 1857, 2392, 2854, 2158, -96, 666, 3005, 2903, 1620, 1141,
-    -1049, -2461, -1091, 63, 521, 2180, 2607, 2668, 3041, 3485, 2330, -1314,
-    -2286, -311, 697, -135, -225, 8, -853, -877, -1700, -3126, -3285, -2148,
-    -2958, -2400, -1899, -1433, -2223, -3362, -2405, -1254, -795, -1678, -1884, -2183,
-    -1335, 355, -711, -1100, 768, 1571, 1260, 2210, 2830, 3142, 910, 509,
-    1363, 1452, 2098, 1673, 1340, -227, 1123, 2682, 2010, 3815, 5511, 5356,
-    3971, 3363, 2530, 335, 187, 2403, 3719, 3980, 2744, 1603, 1031, 176,
-    1276, 10, -865, 1921, 3554, 3223, 3777, 3132, 1368, -1389, -1261, -460,
-    938, 3025, 1981, 845, -480, -45, -705, -3305, -1993, -345, -937, -1752,
-    -1348, -824, -1960, -565, 1061, 72, 1218, 2130, 510, -1127, -1297, 966,
-    319, -1296, 454, 1907, 1683, 1426, 829, -751, -976, 988, 1301, 902,
-    1198, 352, -56, 17, 1204, 1109, -427, 998, 2697, 3024, 2070, -105,
-    -2248, -3153, -1564, -50, 81, 1082, 889, -833, -2637, -3913, -3135, -4650,
-    -4691, -2627, -479, -292, -628, -798, -1942, -1850, -2405, -2912, -2245, -455,
-    891, 1114, -1217, -1032, -877, -2412, -2261, -955, 296, 386, -1390, -3226,
-    -3403, -2067, -643, 535, 1136, 716, 1508, 924, -1162, 976, 1236, 982,
-    779, 2038, 3246, 2946, 464, -533, 435, 1461, 2667, 3148, 2421, 1678,
-    2296, 275, 177, 44, -568, -11, 2024, 3094, 3359, 1053, -855, -482,
-    407, 2245, 4199, 4266, 2968, 1614, 118, -2510, -2754, -2687, -3620, -4107,
-    -1510, 428, -1069, -2612, -2604, -3239, -2700, -1208, -128, -360, -102, 2145,
-    1587, 1526, 1792, 182, -1465, -619, 659, 78, -3369, -3550, -3826, -4677,
-    -2086, 313, -56, -1772, -2151, -2162, -3768, -2675, -1390, -1516, -1314, 1211,
-    2488, 131, -1284, 188, 392, 1556, 4972, 5538, 3475, 1258, 1904, 1667,
-    694, 779, -1699, -2152, 103, 2556, 1644, -1726, -2697, -3285, -3588, -2045,
-    1156, 2003, 830, 462, 526, -1152, -1724, -1682, -1909, -1109, 1432, 2571,
-    1196, 1953, 2749, 1454, 297, 1024, 2674, 800, 707, 1502, 1740, 1103,
-    854, -756, -2267, -46, 1565, -1104, -2858, -3010, -2461, -2447, -876, 3639,
-    3767, 1628, 897, 921, -147, -571, -643, -707, 738, 3388, 2632, -291,
-    -1750, -2257, -1681, 39, 2732, 4848, 2845, 1973, 2105, 2456, 2060, 1536,
-    -203, -42, 2824, 3386, 1407, 272, -800, -2124, -3190, -1280, 2210, 1950,
-    525, -33, -438, -1756, -2112, -2390, -3104, -1777, 727, 583, -201, 83,
-    726, -393, -522, 1986, 2884, 1125, 263, 1859, 2145, 1250, 1810, -22,
-    -961, 73, 522, -1049, -2111, -3507, -3749, -4924, -2914, 405, 424, -1130,
-    -1689, -797, -2698, -2086, -2062, -1860, 90, 688, 599, -575, -1085, -1454,
-    -2836, -1549, 2430, 3531, 1197, -875, -367, 373, 214, -319, -1808, -1065,
-    -36, 733, 617, -579, -1041, -463, -1737, 648, 3948, 4282, 3266, 2550,
-    3340, 1753, 1227, -339, -492, 543, 896, 2235, 1559, -241, 311, -1604,
-    -2054, 8, -225, -850, -366, 1799, 1930, 1027, -459, -1729, -635, -345,
-    -84, -210, -2627, -4024, -5063, -6208, -4796, -2743, -2903, -2917, -1679, -599,
-    -1993, -3397, -4667, -2326, 722, 419, 21, -1105, -2782, -3445, -4315, -3043,
-    -649, 762, 884, 747, 541, -685, 10, -989, -961, 2150, 3122, 2461,
-    1967, 748, -759, -2138, -908, 700, 1999, 1738, 2206, 2879, 1310, -44,
-    339, -594, -1023, -119, 422, 1723, 1081, 755, -464, -989, 68, 953,
-    787, -484, 2488, 4194, 3331, 1927, 806, 769, 1859, 2119, 1839, 920,
-    -810, -2087, -3260, -2302, -1646, -2022, -3187, -1374, 843, -287, -1471, -2144,
-    -3044, -2750, -41, 866, -600, -1083, -316, -1648, -2392, -1237, 522, -869,
-    -454, 3597, 4286, 3285, 2944, 3293, 2114, 2790, 2862, 2245, 652, -462,
-    -2171, -2684, -2369, -1010, -404, -1891, 599, 1710, 1845, 904, 412, -695,
-    -937, 282, 151, 170, 900, 1763, 811, -244, -610, 450, -1429, -574,
-    2742, 4276, 3568, 2331, 1185, 88, 1906, 3049, 2669, 1751, 853, -691,
-    -2125, -2774, -1937, -887, -1805, -818, -387, 68, 163, -591, -2987, -2325,
-    -424, -13, -351, -10, -130, -1364, -1423, -651, 889, 418, 756, 1074,
-    2317, 2803, 2600, 950, 691, 2909, 3104, 2155, 1171, -120, -1010, -505,
-    -671, -377, 384, 756, 800, 1732, 2048, 1454, 29, -1737, -33, 1039,
-    258, -1005, -694, -173, 173, -198, -1650, -2833, -3459, -2717, -770, 994,
-    2166, 2542, 182, -1733, -346, -288, -704, -1113, -2376, -4212, -3890, -4080,
-    -4662, -4336, -2768, -2234, -1572, -879, -502, -1267, -2528, -1304, -509, -1158,
-    -1179, -530, -234, 341, -270, -1015, -1008, 1053, 2271, 2542, 2779, 2397,
-    1809, 2120, 3238, 4450, 4897, 3680, 2432, 772, 273, 48, -1558, -1866,
-    -754, 684, 717, 774, 1161, 642, -348, -231, 46, 751, 728, 1016,
-    791, 1038, 2485, 2065, 296, -486, 326, 633, 933, 1708, 1460, 219,
-    28, 203, -605, -1397, -1530, -927, -872, -835, -1307, -2043, -3206, -1566,
-    -445, 188, 311, -107, -1365, -627, -162, 1009, 1484, 345, -1037, -327,
-    461, 146, -782, -1574, -1643, -825, -102, -545, -339, -957, -709, 446,
-    1246, 2160, 2845, 2225, 787, -254, -629, -1048, -1227, -1840, -357, 743,
-    1136, 1096, 1018, -690, -459, 976, -215, -2019, -2039, -2097, -1755, -640,
-    -71, -1260, -2213, -2034, -1206, -1452, -814, 1585, 1699, 1573, 2341, 3571,
-    3060, 2580, 3013, 3234, 3247, 2581, 778, -381, -1057, -1575, -1390, -2061,
-    -1426, -1045, -1792, -2524, -2340, -2267, -1409, -1574, -2214, -2011, -692, -1024,
-    -1484, -911, 149, 1623, 1861, 2513, 2537, 1193, 385, 1684, 2116, 2149,
-    2763, 2120, 2006, 2981, 3076, 515, -96, -291, 1006, 1641, 1218, 1757,
-    1046, 575, 12, 2009, 1119, 1694, 2083, 1978, 2630, 4062, 2965, 1597,
-    825, 929, 1428, 337, 528, 1724, 1926, 380, -146, 1097, 320, 181,
-    -598, -1219, -80, -656, -1406, -2702, -2299, -1684, -2449, -1395, -989, -1302,
-    -2466, -4073, -3019, -3334, -2731, -2462, -3854, -4094, -3779, -3925, -4708, -3875,
-    -1998, -2175, -2109, -216, -850, -1723, -2328, -1363, 733, 2171, 3519, 2934,
-    2475, 3108, 2088, 422, -611, -124, -249, -1610, -734, -771, -1082, -1692,
-    -2976, -2094, -681, 626, 1028, 338, 387, 37, 471, -79, 838, 1350,
-    1358, 1844, 1894, 3061, 3108, 1581, 555, 761, 1585, 2062, 1957, 1413,
-    1347, 410, -336, 511, 1807, 464, -1063, -1672, -1921, -1120, -1902, -3236,
-    -3971, -3352, -1765, -330, -360, -216, -1435, -2509, -2974, -647, 1767, 828,
-    529, -12, 327, 1175, -355, -1600, -1489, 412, 1083, 1414, -70, -1502,
-    -2690, -3647, -2257, -423, -1718, -3370, -3969, -3210, -1193, -475, -2270, -3481,
-    -2028, -393, 555, 1427, 95, -1307, -1318, -180, 749, 610, 1, -108,
-    -793, 58, 975, 197, 42, 927, 1829, 2196, 1805, 1986, 562, -1022,
-    -1184, -115, 1483, 1332, -384, -1778, -2290, -473, -410, -1864, -1795, -2596,
-    -2372, -829, 418, -152, -2185, -3245, -2731, -1204, -171, 246, -110, -461,
-    13, 1365, 391, -1101, 277, 19, 1824, 4047, 3633, 2785, 2091, 2537,
-    3568, 2627, 1735, -289, -760, -1565, -431, 1522, 489, 63, -398, -1737,
-    706, 2141, 1931, 253, 581, 1523, 1807, 1094, 181, 729, 726, 918,
-    2044, 1533, 353, 280, 388, 472, 974, 401, -1285, -1079, -511, -208,
-    -744, -409, -1533, -1473, -1378, -250, -331, -2020, -3029, -2981, -2369, -1062,
-    324, -1061, -2500, -2754, -2997, -3309, -1783, -528, 580, 850, 2510, 3607,
-    2226, 971, 519, 1857, 3123, 5400, 5596, 2875, 2129, 2846, 3577, 1777,
-    707, -120, -788, -68, 631, 453, -936, -2204, -1737, -1388, 265, 1703,
-    240, 381, 302, 1396, 426, -760, -1311, -738, 170, 1088, 1315, 74,
-    -1005, -311, 499, 785, 1624, 283, -877, 252, 810, 207, 107, -370,
-    -451, -1190, -1652, -193, -757, -1625, -2839, -2666, -1866, -1221, -402, -1401,
-    -2639, -1332, -635, -1079, -1572, -407, 2024, 2620, 2869, 2751, 1277, -1017,
-    -983, 146, 936, 2139, 2761, 1920, 1328, 2575, 2712, 1329, 832, 797,
-    208, 495, 759, 43, -129, -664, -1653, -1372, 251, 765, 1559, 824,
-    -397, -335, -93, -1161, -695, -514, 472, 1798, 1213, 1727, 1463, 1354,
-    2867, 3875, 2982, 2529, 2025, 2062, 1498, 1633, 348, -1139, 119, 478,
-    -569, -1890, -2773, -3350, -3768, -3447, -2714, -2362, -1889, -1835, -2164, -1710,
-    -2065, -1945, -2354, -1692, 654, 1893, 1356, 1914, 1839, 554, -107, -402,
-    578, 1674, 2466, 1823, 1612, 1451, 1072, 524, -694, -1580, -440, -58,
-    -1036, 113, 85, -997, -282, 503, 336, 920, 1610, 3804, 5369, 4478,
-    3135, 2161, 812, 1882, 4838, 3195, 2498, 1921, -400, -2434, -1342, -801,
-    -814, -1311, -1099, 214, 840, -699, -846, -2692, -3266, -162, 651, -869,
-    -246, -1451, -3176, -3780, -2043, -2096, -2834, -3088, -2643, -3348, -2521, -3301,
-    -4620, -7176, -4007, 91, 891, 1597, 1225, -468, -869, -557, 1368, 1201,
-    1649, 4084, 5185, 4594, 3440, 2214, -129, -791, 386, 621, 137, -252,
-    -265, -2069, -1037, -1083, -864, -391, 811, 2076, 5037, 3188, 2977, 1165,
-    127, 1018, 1842, 1532, 3678, 4154, 2893, 698, 1320, 954, 2139, 2322,
-    3038, 1886, 1870, 703, 543, 395, -579, -425, -1210, -2495, 578, -2511,
-    -2490, -2153, -5120, -2120, -4213, -557, -892, -483, -1933, -1458, -88, -1375,
-    -3163, 518, -1453, 4376, 1959, 1241, -2495, -2953, -4571, -2077, -889, 727,
-    1586, -1033, -1562, -326, -767, -4714, 365, -2774, -1602, -1157, -150, -3172,
-    642, -2172, -2979, -5344, 325, 1227, 2557, -1256, -244, 326, -3232, -1202,
-    -1391, 264, -827, 4325, 2565, 3052, 2499, -1463, -443, 3103, 3457, 2892,
-    5809, 2162, -262, -1302, -5777, -4298, -2553, -3013, 2929, 4548, 4573, 372,
-    -904, -7876, -7947, -3698, -3172, -1010, 58, -117, -2897, -458, -2261, 173,
-    -3669, -2547, 3056, 466, 1266, 1665, -1307, -1972, 3724, 4209, 7856, 8221,
-    4088, 1906, 4270, 3652, 313, -956, -3046, -2967, -2333, -3767, -3435, -6028,
-    -5734, -4775, -3106, 94, 901, 5847, 5968, 4280, 4466, 5214, 868, -2781,
-    1727, 871, 331, -3766, -7821, -7837, -6023, -8507, -5388, -3248, -5734, -1005,
-    2799, 3772, 3508, 3818, 4500, 320, 3559, 833, -2257, -6207, -7928, -9638,
-    -5614, -8731, -7178, -6908, -4514, -1530, -2313, -1763, 911, 1786, -1730, 6057,
-    5916, 11196, 9032, 6634, 5519, 7310, 4772, 2517, 5746, 4012, 2183, 2496,
-    5424, 1621, 1987, -684, -1310, -675, 124, -799, -2357, 821, -398, -1,
-    -718, 581, 5266, 655, -16, 2085, 4155, 77, 568, 1917, 400, 3891,
-    1774, 1321, 1218, -519, -332, 2866, -624, 575, 251, 803, 989, -2209,
-    -796, -3036, -4037, -5563, -1498, -2443, -6459, -3800, -4765, -5774, -3345, 1489,
-    -4045, -2225, 1065, 1697, -2163, -1492, -386, 2496, 1381, -356, 3347, 5072,
-    1449, 2668, 1226, -1345, -611, 321, -1353, -3267, 680, 1895, -125, -3484,
-    -3558, -1957, -2185, -2664, -1404, -1366, -2170, -1935, -2327, -1551, 1045, -537,
-    859, 2049, 3390, -1711, -212, -711, -1112, -1248, -5864, 416, 5064, 4797,
-    -802, 32, 848, 2672, 3703, -594, 2623, 4601, 2194, 1041, 3710, 933,
-    1605, 195, 568, 56, 4, -3017, -4695, -4823, -6055, -5505, -910, -1570,
-    -4818, -3345, 635, 2518, 1884, 5000, 2640, 3687, 5027, 3304, -76, 855,
-    952, 296, 1028, 6313, 8255, 6283, 8756, 11189, 10663, 7194, 7768, 3565,
-    6281, 4076, -380, -5186, -1473, -2287, -2138, -1850, -164, 3130, -29, 2389,
-    -451, -1116, -1870, -2563, -1004, -6759, -335, 1689, -4122, -2655, -1436, 2257,
-    -1548, -2057, 1043, 1075, -1227, 2058, 2596, 1845, 1987, 3312, 4270, -97,
-    1206, 1667, -183, -3989, -3290, -3021, -5628, -5057, -3884, -2957, -5586, -4499,
-    -1746, -2750, -1709, 1049, 1008, -40, 1887, 2897, -1161, -2882, 658, -2333,
-    -1761, 850, -554, -2197, -2155, -533, -806, -3977, -640, -932, -1477, -1619,
-    -1844, -913, 1169, -3179, -2708, -7185, -1332, -1479, -2783, -492, 2024, 884,
-    -1496, 1437, 2188, 2422, 3437, 1259, 520, 2932, -618, 516, 1342, 1490,
-    -2770, 766, 356, -1815, 652, 344, 158, -2411, 1025, -662, -1684, -1642,
-    -118, -1182, -202, -1573, -680, -3387, 453, -889, -3127, 2250, 3075, -1138,
-    2273, 1654, 3549, 2845, 1467, 1807, 1304, 3970, 4559, 599, 1938, 2608,
-    -1486, -1800, -2066, 3417, -655, -3795, -463, -184, 536, 2753, 2909, 1259,
-    797, 2557, 1575, 1006, 1386, 920, 1658, 2150, 4271, 2504, -425, -2805,
-    -862, -4263, -3950, -3106, -992, -2303, -1153, 2835, 4860, 4992, 4706, 6019,
-    6799, 8563, 7357, 4119, 4736, 2845, 3891, -1037, -1995, 1500, -1046, -4335,
-    -2474, -157, -2195, -287, 2871, -2506, -113, 3283, -569, 1644, 4259, 2480,
-    2680, 692, 1211, -283, -155, 277, 659, -278, -2853, -218, -1002, -474,
-    -2271, -2098, 46, 145, -1580, -3245, -2220, -3452, -3038, -4226, -4538, -1906,
-    237, -2735, -1771, 145, 26, 314, 2290, 3394, 6910, 4110, 4134, 258,
-    2793, 3573, 3676, 2526, 1738, 4908, 3492, 2597, 399, 2820, -1257, -4232,
-    -462, -3033, -6250, -4491, -5630, -5665, -5774, -7184, -5951, -4180, -884, -3646,
-    -2887, -2664, -1349, -2055, -5286, -947, 2058, 792, -133, 1805, 1584, 496,
-    1376, 1694, 664, 2296, 503, 1528, -25, -539, 3115, -3261, -3084, -570,
-    -1141, -2904, -2032, -4697, -6108, -5473, -1440, -5125, -5071, -2818, -4843, -3691,
-    -2890, -4337, -3681, -4056, -4105, -2423, -720, -2512, 38, -1331, -1329, -1133,
-    1655, -416, 871, -352, 642, 2171, 202, -3086, -1191, -922, -3479, -1764,
-    -2456, -1135, -3324, -2683, -3387, -4893, -1605, -1173, -1342, -3461, 1088, 1939,
-    2276, 473, -1439, -2066, 551, -964, 572, 1719, -1221, 364, 1520, 1869,
-    -1078, 3002, 6457, 3745, 4020, 5381, 4936, 5100, 2879, 5481, 4461, 6479,
-    8228, 5564, 4396, 3905, 5585, 823, -205, 2746, 1089, -449, 2959, 1600,
-    2005, 867, -1562, 2778, 1038, 3821, 2958, 781, 2811, 1146, 567, 1547,
-    -24, 339, 2322, 2300, 1778, 3862, 2437, -209, -284, -1563, -835, -3325,
-    -1952, -3872, -3768, -3079, -6242, -6449, -4407, -3896, -4953, -3607, -2054, -1205,
-    -4564, -4468, -4351, -969, -2636, -684, -1672, 402, 1703, -2952, -2561, -2363,
-    -313, -1729, -1600, -3260, 578, -3197, -1195, -354, -1230, 2192, 1503, 2501,
-    -220, 1767, 1286, -1067, -504, 509, 1443, 415, 3311, 1377, 3172, 2283,
-    4901, 3085, 5346, 8753, 6662, 6706, 4964, 5000, 4965, 4971, 2684, 3642,
-    6406, 5483, 1286, 3592, 2296, -596, 2290, 147, 214, -1287, -68, -528,
-    -109, -618, -2403, -3568, -2778, -787, -192, -359, -3830, -1084, -171, 1376,
-    -1767, -3121, -757, -2523, -887, -66, -126, -25, 1105, 1848, 2180, 3045,
-    6739, 2353, 3620, 3748, 5973, 5265, 3990, 4213, 2932, 3189, 3682, 5944,
-    5034, 5166, 3975, 2403, 6465, 6405, 2977, 4315, 4956, 4691, 5716, 3525,
-    4729, 2790, -974, 4245, 940, -41, 346, -626, -3417, -1743, -1474, -3733,
-    -5388, -4749, -4377, -5733, -4346, -4057, -7272, -6071, -9113, -4005, -2633, -3799,
-    -3843, -6997, -7387, -2807, -3043, -2612, -4220, -623, -548, -2083, 850, -1507,
-    -2166, -3278, -511, -317, -2134, 378, -3402, -2474, -1659, -3307, -2223, -2966,
-    -1151, -2447, -3456, -2957, 527, -4248, -5882, -6446, -3370, -3445, -2744, -5893,
-    -4045, -6726, -4501, -5513, -6461, -5179, 337, -4236, -2913, 1485, -284, -4060,
-    -3486, -372, -2573, -1089, -1594, -1130, -2590, -1813, -1690, -1977, -78, 950,
-    638, 1973, 1011, 646, -2712, -3404, -3238, 190, -987, 346, -108, -3308,
-    -5613, -3097, -4086, -2064, -2765, -1342, 1249, 1098, -46, 4163, -533, -1305,
-    673, 4339, 925, 2595, 3186, 2711, -307, -1271, 1885, 1935, -650, 448,
-    -168, 1406, 1580, 1097, -440, -2914, -1161, -532, -696, 174, -1281, -1019,
-    -1087, -2558, -1219, 2278, 4597, 4421, 4823, 7378, 5907, 8464, 9431, 8182,
-    7317, 6891, 5227, 5285, 4324, 2947, 2472, -437, 1546, 3223, 1520, 1501,
-    -628, 1307, -170, -1720, 1160, 672, 146, 4130, 5203, 3241, -242, 696,
-    -409, 587, 1716, 5207, 2013, 1374, 3424, 3721, 2409, 2531, 2165, 3354,
-    2901, 5494, 5683, 4818, 2691, 1952, 2353, 4697, 4475, 4979, 4853, 1515,
-    3330, 3563, 2430, -1375, -887, 506, 836, -2198, -321, 781, -731, -3158,
-    -2159, 861, 58, 1414, 2166, 2190, 3753, 4853, 3543, 4109, 2176, 5173,
-    3629, 1741, 4153, 3160, 1610, 190, 2171, 2763, 3109, 2731, 550, 123,
-    1251, 1805, -6, -1300, -722, -115, -3422, -3343, -3816, -3576, -9288, -7059,
-    -2973, -3696, -3959, -3822, -1806, -620, 855, 314, 1317, 596, -507, 2656,
-    624, 2567, 3224, 432, 1162, 1722, 947, 2242, 2543, 149, -360, 600,
-    -23, -1118, -3270, -4565, -4717, -5978, -4675, -5194, -3885, -5718, -7481, -6491,
-    -4475, -5162, -4543, -4729, -1627, -595, -1707, -1554, -2055, -4219, -2850, -3002,
-    -890, -2858, -4031, -3973, -3239, -3082, -2003, -1533, -1897, -2805, -2913, -2537,
-    -6200, -4962, -3549, -5535, -6575, -6078, -3903, -5860, -5666, -4240, -4676, -4592,
-    -4123, -2455, -949, -3138, -530, -769, -3229, -2402, 273, -3430, -1855, -1739,
-    -1170, -1772, -2174, -3556, -2278, -1259, -1129, -2, -95, 1279, 3362, 408,
-    267, 1592, 543, 533, 2623, 2824, 3406, 2443, 4972, 4362, 3904, 3614,
-    6430, 7054, 5197, 8720, 6839, 6451, 5617, 5278, 5224, 4540, 3674, 1546,
-    5416, 1903, 2017, -238, -1490, 583, 1682, -1367, -1258, -532, -4045, -3587,
-    -3795, -2355, -5003, -4022, -5858, -6329, -8253, -6137, -6328, -6814, -7047, -5123,
-    -6243, -6414, -3377, -4070, -5035, -4284, -4278, -3468, -343, -2293, -1631, -1605,
-    -1680, -1913, -1026, -517, -1154, 2534, -1081, -210, -1498, -3797, -3371, -3705,
-    -4244, -1796, -874, -2815, -770, -958, 2108, 2148, 2495, 2880, 4177, 5238,
-    4623, 5955, 8950, 6449, 3877, 7030, 6818, 5985, 7263, 5803, 3468, 4029,
-    5031, 3100, 3374, 4824, 3148, 2784, 4244, 2975, 41, 1082, 2443, 467,
-    -954, 1006, -897, -4182, -3002, -1795, 559, 32, 1016, 1462, 2785, 2604,
-    3288, 4372, 4306, 1253, 4409, 3517, 4062, 6112, 4765, 3154, 2624, 428,
-    3884, 2834, 4399, 4450, 5760, 5281, 5081, 6995, 3391, 552, 3307, 3973,
-    4211, 4649, 3682, 2004, 1977, 4643, 4353, 5204, 5727, 6108, 6166, 8288,
-    9049, 8404, 7205, 6105, 7876, 8161, 7968, 5548, 4632, 3198, 3898, 2685,
-    5262, 3878, 2919, 484, 1262, -1354, -1735, 318, -3257, -6643, -5065, -2979,
-    -4639, -8831, -6964, -9389, -8045, -3176, -3784, -3085, -3238, -4553, -1346, -971,
-    531, -1840, -2956, -840, 1067, 2383, 130, -1606, -2489, -3510, -2003, -447,
-    -1057, -1292, -2977, -619, -738, -452, -2854, -2349, -6652, -5176, -4510, -4960,
-    -4614, -4901, -4057, -3253, -724, 230, 1047, 573, -898, 2651, 2289, 2950,
-    4456, 2157, 1009, 1733, 1332, -320, -2139, -2937, -1876, -1704, -398, -2523,
-    -2074, -5397, -4457, -2365, -4693, -4293, -3541, -4896, -4982, -4131, -3779, -8063,
-    -7363, -8984, -5597, -4215, -2569, -2744, -5471, -5426, -2566, -67, -4342, -3133,
-    -1902, -1895, -1938, -1481, 625, -1003, -2218, -1820, -1508, -1260, 3701, 769,
-    -1513, 1899, 3006, 1311, -1062, -616, -2887, -3970, -3276, -3921, -1348, -2936,
-    -2152, -1139, -1338, -1060, 386, 579, -1791, 3269, 3719, 1887, 1150, 2078,
-    4151, 2455, 4101, 3700, 3036, 157, 2813, 3032, 1449, 2405, 2588, -24,
-    -2843, 3495, -677, -3463, -1659, -1858, -2727, -3845, -4395, -5459, -4690, -6007,
-    -2178, -1965, -641, 1662, 706, -259, 4503, 3325, 1759, 1797, 2578, 2760,
-    4033, 3547, 2899, 1411, 1952, 2475, 3093, 2118, 1931, 2462, 1245, 5491,
-    3249, 1434, 2962, 483, 232, -43, 14, -2984, -3134, -2117, -1048, 1029,
-    -366, -2732, -1985, -63, -980, 1489, 2001, 55, -1328, 1719, 1977, 2147,
-    2812, 50, 100, 27, 2114, 2942, 1782, 2334, 1661, 164, 2324, 2982,
-    1011, -577, 279, 1991, 180, -492, -1228, -3695, -1608, -1991, -1337, -769,
-    -3739, -2695, -5625, -2448, -1938, -4388, -5172, -4799, -1842, -1335, -1287, -1769,
-    -3934, -2194, -1911, 207, 299, -905, -253, -1842, -1013, 2224, 1791, 893,
-    1525, 1960, 2830, 3569, -2219, -5202, -2158, -3114, -2094, 628, 1973, 1806,
-    -718, 171, 23, 2401, 3188, 1342, 546, 1668, 3854, 3764, 851, 1828,
-    -1473, -1633, 2188, 2402, 533, -1245, -2251, -1169, -2064, -2796, -1684, -2079,
-    -1991, -3731, -2090, -3765, -5893, -7843, -7176, -5419, -6243, -4315, -5539, -7049,
-    -5668, -3425, -3911, -4805, -3356, -1654, -1142, 1048, 2195, -2254, -1377, -179,
-    -653, 270, 2397, 1779, 1428, -366, 950, -994, -1321, 793, 852, 1845,
-    3062, 1203, 345, -2174, -1761, -852, 909, 1883, 4667, 6066, 4213, 4738,
-    4630, 4744, 5391, 7863, 9007, 8467, 9186, 8156, 7731, 6892, 4938, 5160,
-    5014, 5063, 4604, 4956, 3657, 3790, 2438, -1294, 15, 1578, 1797, 432,
-    -1030, -2275, -3425, -4596, -6734, -5537, -4400, -3508, -2177, -3841, -1760, -583,
-    -2123, -4930, -2868, -2107, -181, -705, -2422, -1506, -193, -2722, -2641, -2691,
-    -1130, -3170, -1452, 1152, -587, -1249, -2490, 282, 946, 1793, 2163, 1265,
-    -1043, -2129, -2701, -3541, -2443, -3295, -3024, -1714, 745, 249, 1229, 256,
-    1467, 2050, 5486, 6267, 4444, 2204, 3493, 5156, 5211, 5470, 4266, 3592,
-    4043, 3678, 5661, 7387, 4015, 386, 842, 3042, 2935, 4516, 1778, 788,
-    -766, -1525, 504, 429, -2650, -2417, -3109, -714, 2185, -1143, -1278, -2139,
-    -2457, -3331, 134, 219, -1979, -587, 18, 2000, 1397, -747, -2163, -2252,
-    -564, 754, 1068, 1757, -1667, -818, 1967, 2012, 3634, 2494, -692, -475,
-    716, 1928, 1375, 1314, 1775, 3391, 5185, 7841, 8859, 6896, 7466, 8087,
-    9108, 8968, 8275, 4834, 4956, 7642, 7472, 7462, 6605, 3123, 1416, 4714,
-    4498, 5943, 3114, 1031, -446, 143, 1379, 511, -1449, -3215, -3062, -3050,
-    -3833, -4545, -6141, -7938, -8406, -5468, -3726, -6566, -6052, -5451, -5365, -5440,
-    -5926, -4658, -4736, -1517, -1668, -2257, -1279, -1229, -2178, -4668, -2664, 1320,
-    -1825, -765, -2345, -2874, 475, -45, 526, -767, -2846, -1167, -1923, -3502,
-    -3861, -2715, -4519, -2987, -1984, -1035, -1108, -2240, -1972, -554, -550, -330,
-    -535, -2219, 1237, 1838, -451, 766, 2234, -1582, -3356, 46, 350, -1301,
-    -3160, -3895, -3270, -4217, -6562, -4112, -7209, -7947, -7320, -7034, -8185, -7896,
-    -7952, -9851, -7202, -4835, -2781, -4963, -4889, -3742, 59, -895, -2242, -1262,
-    -2583, 708, 2269, -230, -253, -779, -1540, -793, -1087, 2573, 1221, -3109,
-    -2407, 299, 3969, 1333, 874, -690, -247, 982, 1306, -2131, -4344, -2954,
-    -2685, -1092, 1124, 326, -2290, -1686, -90, 1919, 3555, 2793, 560, -328,
-    1986, 2128, 1680, 2374, 640, -757, 280, 1889, 2253, 1093, -2886, -990,
-    655, 1754, 627, 32, 614, -1546, -981, -1262, -1177, -3415, -3465, -3587,
-    -1624, -1378, -1521, -4408, -4670, -2381, -146, 1705, -211, -1206, 1204, 1015,
-    1980, 4040, 1612, -177, 1196, 4220, 2362, 3742, 1174, -820, -1144, -120,
-    1457, 3606, 3236, 1792, 618, 1745, 1417, 383, -1863, -553, 1405, 2075,
-    4042, 3882, 3507, 1823, 4487, 4990, 6541, 6229, 4389, 5689, 2601, 2201,
-    3713, 1093, -269, 1151, 797, 740, 713, -339, -3469, -2675, 149, -1393,
-    -527, 426, -472, -1915, -2491, -2524, -1869, -2751, -3021, -1685, -2202, -2099,
-    1106, -1756, -2280, -2693, 372, 922, 1447, 1497, 695, 801, -1139, -917,
-    -796, -1831, -1397, -1089, -425, 2026, -817, -1145, -329, -806, -358, 2044,
-    3807, 2951, 4192, 2907, 1142, 1186, -46, 587, 1652, -1043, 3539, 3510,
-    1754, 1199, 2745, 3768, 1227, 4471, 5419, 4391, 2088, 1917, 3076, 1813,
-    3033, 3020, 865, 1561, 3421, 64, -1134, -921, -663, -3881, -702, 623,
-    -1577, -3369, -3518, -3357, -5540, -4532, -2830, -3184, -3198, -1939, -1488, -836,
-    -1460, -2466, -2329, -2670, -686, 2908, 1257, 463, -1475, -2046, -1746, -755,
-    -776, -440, 47, 1035, -113, 1379, 1432, -31, -2899, -512, 2876, 2945,
-    1924, 1345, 1657, -2340, -1558, -1333, -1320, -2632, 642, -666, 372, 484,
-    1905, 2262, 2726, 3683, 5844, 5784, 3915, 4593, 4052, 4107, 6496, 6772,
-    4241, 5485, 6772, 6955, 4692, 5099, 4209, 1192, 2665, 6099, 4951, 2750,
-    2368, -455, -2465, -247, 872, -2349, -2457, -1688, -1343, -947, -2989, -1560,
-    -4800, -5425, -3095, 679, -1043, -1344, -271, -3970, -4402, -2374, -1516, -1193,
-    -3477, -671, -1936, -2256, -2419, -4056, -7132, -3830, -2136, -2310, -1569, 150,
-    -1426, -3340, -1957, -907, -441, -1259, -501, 813, 2058, 2818, 2164, 1654,
-    2001, 3476, 5694, 5022, 4824, 2846, 4439, 3072, 4195, 4238, 4129, 4169,
-    4149, 2326, 994, 2982, 1189, -1089, -255, 3312, 1421, -282, 520, -2200,
-    -1608, -2687, -2182, -2008, -1116, -868, -818, -1374, 531, -1862, -3321, -2679,
-    -2045, 885, -889, 1701, -727, -2182, -953, -1040, -1908, -1215, -436, 161,
-    -239, -72, -298, -1226, -2327, -2073, -898, -902, 0, 1329, 240, 1136,
-    559, -160, -1756, -1110, -331, -1434, -330, 2086, 2748, 4682, 2126, 4243,
-    5641, 4414, 4537, 5027, 5375, 7154, 6266, 4987, 5708, 5372, 4235, 3369,
-    1149, 1369, 1490, -415, -939, -94, -694, -1345, -3061, -2937, -3114, -2937,
-    -2923, -4017, -1894, -2735, -814, -3096, -2760, -1117, -3557, -4035, -3299, -600,
-    -861, -2180, 67, -1139, -3414, -2649, -3965, -1074, -1635, -2702, -1885, -2276,
-    -1890, -2578, -2774, -2684, -3403, -3232, -2423, -955, -462, -877, -1161, -2928,
-    -1971, -1750, -3079, -3747, -2824, -1621, -87, 1070, 2867, -280, 90, 436,
-    -238, 705, 459, 1265, 789, -1603, -344, 1869, -55, -2488, -3270, -1604,
-    -1554, -1369, -1226, -1760, -3131, -4115, -1074, -2463, -3530, -3436, -3313, -5985,
-    -4381, -4977, -4495, -5102, -7152, -5763, -5011, -5877, -6332, -6740, -5412, -4159,
-    -4161, -2283, -2621, -4354, -3806, -3139, -1789, -2010, -137, -1088, 411, -52,
-    -321, -230, -2492, -1879, 1088, 2134, 2549, 3173, 2606, 2249, 1575, 2322,
-    2608, 1052, -164, 2938, 2442, 3757, 4866, 2701, 2241, 2181, 3843, 4810,
-    5493, 3974, 2272, 1091, 566, 3408, 3672, 35, -506, -936, -775, -1577,
-    -2673, -2801, -5056, -4558, -3059, -2597, -2692, -4303, -4340, -7167, -6140, -2409,
-    -2626, -1510, -1459, -1263, -76, -3402, -4365, -2080, -867, -1347, 1149, 2165,
-    1031, -665, -1860, -2443, -148, 2706, 2587, 2909, 3460, 6501, 2127, -219,
-    2244, 2137, 899, 4514, 5937, 4755, 4640, 3568, 3969, 1374, 3023, 4310,
-    1020, 2624, 3155, 4460, 3108, 2909, 2669, 2512, 3636, 5279, 4909, 5691,
-    3666, 2000, 1058, 2953, 4080, 1508, 807, 711, -748, -1359, -4295, -3056,
-    -2948, -3995, -3872, -1472, -806, -4660, -5351, -4317, -5151, -2460, -1105, 861,
-    -156, 852, 354, -1892, -2473, 309, 372, 756, 3970, 5218, 3940, 4757,
-    886, 253, 2301, 3977, 5106, 5589, 3682, 2640, 248, -539, -1011, -922,
-    -1141, -650, 729, 1149, 1479, 1070, -427, 167, 317, 1052, 695, 1151,
-    2929, 1112, 1696, 3111, 4463, 1521, 4671, 4615, 4003, 4365, 4085, 2990,
-    2075, 3627, 4089, 2202, 2533, 1159, -223, 51, -404, -762, -1593, 87,
-    -2272, -1175, -839, -3206, -2921, -4050, -3164, -889, -400, -1597, -1185, -2010,
-    -1940, -3273, -2499, -2306, -2733, -2220, 897, 1785, -1300, 1446, -1543, -2689,
-    -804, 850, -992, -63, 1366, 67, -2748, -1769, -2949, -2371, -1663, -1459,
-    -358, 1417, -87, 1015, 2176, 1681, 3370, 998, 581, 1955, 2545, 2349,
-    2216, 2812, 3165, 2709, 2807, 3091, 4217, 4992, 2566, 4066, 4319, 4012,
-    4236, 57, 1053, 2784, -1017, -1126, -233, -127, -2006, -19, -1113, -1026,
-    -2277, -1293, -1708, -1296, 903, 273, 685, 539, 1864, 2935, 2888, 90,
-    859, 106, 666, 1236, 209, 333, -1175, 1867, -512, -1522, 78, -730,
-    -3009, -1293, 968, 344, -1341, -3346, -1715, -817, -1511, -513, -2569, -2383,
-    -1820, -831, -34, 361, 3, -3400, -2686, -2253, -1880, -2344, -3242, -3096,
-    -64, -176, -1291, 528, -937, -493, 877, 3883, 3061, 3833, 1657, -553,
-    17, 948, -409, -619, -1569, -1302, 823, 429, -733, -1904, -3306, -1307,
-    -698, 442, 467, -572, -1349, -746, 1697, 2092, 693, 161, 1896, 1449,
-    27, 665, 386, -809, 1319, 4264, 2366, 1379, 1045, -298, -76, 78,
-    2112, 2190, -1186, -1425, -497, -2653, -2876, -3686, -4091, -4616, -3924, -1809,
-    -1177, -520, -2712, -3238, -3127, -2883, 526, -1493, -2659, -706, 2429, 1438,
-    -291, 474, 1373, 619, 4405, 5492, 4324, 3231, 1613, 2564, 2704, 3426,
-    1686, 1061, 1718, 3426, 2783, 1779, 591, 1245, -525, 1287, 1593, -1103,
-    -1542, -350, -1626, -1714, 139, 1137, -277, -1845, -4052, -2881, -2983, -5280,
-    -4416, -3363, -3338, -610, -1143, -2711, -2829, -3616, -4902, -4045, -1576, 346,
-    -1903, -2781, -2669, -4002, -5043, -3323, -2404, -1398, -2669, -961, -251, 304,
-    668, -1686, -2857, -998, 1533, 1198, 1026, 2391, 448, 288, -261, 643,
-    3294, 1933, 3008, 6615, 2083, 1967, 4361, 867, 1453, 3171, 398, -747,
-    -304, -1223, -3815, -5012, -6985, -6091, -5008, -5864, -5825, -4436, -6712, -6994,
-    -7512, -7769, -5513, -3725, -2435, -1740, -2721, -3226, -3997, -3756, -2472, -2641,
-    -825, -985, -220, -2866, -3590, -2271, -4207, -4941, -3338, -936, -1253, -1476,
-    -2022, -2299, -3378, -2666, -2459, -620, 576, -1185, -661, 1135, 1866, 684,
-    -855, 858, 3226, 4876, 4838, 5278, 3070, 566, 801, 1651, 2788, 5732,
-    4261, 4637, 4568, 3042, 1405, 3122, 1476, 2033, 1974, 440, 595, -114,
-    -2763, -3360, -1529, -1191, -1115, 121, -2177, -1062, 584, -892, -2247, -238,
-    -1234, -1307, 1301, 333, -1661, -6046, -8138, -5881, -2355, 657, 4171, 6758,
-    2668, 789, -1924, -5070, -4691, -4355, -787, 2297, 3967, 2782, 2426, 752,
-    -1166, -560, 0, -720, 513, 722, 1310, 2620, 1751, 2913, 4903, 5141,
-    5493, 6830, 7866, 8066, 5229, 4637, 4756, 4421, 3039, 5452, 4513, 1852,
-    3315, 2236, 169, 437, 2457, 1503, 3413, 8304, 7485, 5205, 3691, 2768,
-    548, -324, -1113, -3731, -5099, -4970, -4754, -5707, -5363, -5964, -5025, -3215,
-    -1822, 770, 1655, -264, 395, 2094, 538, 61, -1757, -5351, -7609, -5652,
-    -5761, -5080, -2785, -3846, -2684, -377, -1730, 2889, 2505, -48, 2287, 3496,
-    6055, 6265, 5912, 5287, 8605, 8931, 4396, 3558, 3781, 2935, 1896, 4654,
-    5868, 5227, 3423, 2363, 2780, 4069, 5003, 4387, 129, 2685, 4529, 3716,
-    3392, 4374, 3549, 2785, 3815, 4025, 3750, 2441, 1124, -1153, -499, -3479,
-    -2318, -3673, -6392, -6492, -3921, -4064, -5000, -5688, -4034, -5463, -2967, -1572,
-    -2359, -2113, -1603, -695, -2016, 1321, 1173, -534, -1757, -2029, -23, 1884,
-    1478, 3971, 3954, 1775, 2541, 1653, -649, -2842, 303, 1819, -287, 77,
-    -1756, -3248, -4299, -1631, -2968, -3599, -2320, -2485, -2182, -145, -1315, -1016,
-    -3094, -1969, -2358, -1338, 185, -820, -1672, -1174, 1341, 399, 596, 961,
-    2685, 1878, 798, -118, -229, -784, -1906, -3701, -4594, -4052, -2535, -2144,
-    -2729, -1143, 584, 253, -77, 1466, 4015, 3897, 2607, 3600, 5549, 5030,
-    5680, 7590, 5765, 8479, 6908, 1884, 3490, 5083, 993, -142, 187, 1191,
-    3616, 2676, 3188, 4546, 3497, 3816, 4255, 3986, 2832, 1794, -1500, -4229,
-    -4086, -4396, -4739, -4507, -3452, 1101, 3954, 5881, 5954, 6341, 5227, 4004,
-    3396, 2371, 2227, -905, -2335, -3678, -3605, -1712, -2533, -4333, -1987, -1539,
-    -1978, -3827, -3070, -6378, -8611, -6173, -6288, -7129, -7403, -3178, -3744, -4911,
-    -2568, -758, -878, -875, 1084, 1916, 729, 2472, 1466, 1111, 1354, 4321,
-    3252, 3697, 958, 1068, -518, -2002, -904, -1085, -1104, -1773, -453, -322,
-    136, -850, -90, -1446, -713, 1139, 389, -1160, -1519, -1985, -4258, -3925,
-    -3164, -2973, -4745, -2967, -789, -1138, -515, -2420, -2129, -328, -2020, 1575,
-    2083, 940, 2172, 1459, 1238, -1553, -2203, -1366, -1350, -1056, 51, 357,
-    16, 248, 552, 1021, 1848, 672, -3124, -3275, -3324, -4126, -2683, -2761,
-    -5233, -3940, -3674, -991, -691, -2146, -2407, -649, 518, 1708, 3958, 2587,
-    1639, 924, -1060, -79, 3746, 3315, 1271, -468, 819, -554, 582, -995,
-    -1296, -1471, -243, 1063, -1025, -2643, -2509, -1893, -2691, -1833, -1884, -1339,
-    -3102, -2091, -2993, -3140, -2409, -1942, -1018, 866, 1738, 3283, 282, 1193,
-    3066, 3020, 2575, 1208, 1599, 746, 448, 1255, 1839, 249, -394, -3147,
-    -3486, -2228, -2668, -4734, -7212, -5993, -6744, -5720, -3159, 568, 336, 823,
-    2612, 4659, 4999, 3591, 4354, 4651, 3226, 2687, 2825, 1926, 975, -1223,
-    -2945, -3180, -2406, -1979, -2595, -2684, -268, 201, -666, -484, -668, -1223,
-    -812, 2512, -105, -2331, -2902, -4846, -4451, -4744, -5131, -6039, -5878, -7478,
-    -5337, -4507, -3549, -3738, -3354, -2182, 395, 1346, -682, 1323, 741, 614,
-    2267, 3786, 3852, 2910, 3671, 3700, 6955, 6474, 5326, 3926, 4328, 6749,
-    5622, 5194, 5639, 4852, 504, 1126, 2413, 2695, 1916, 2028, 1268, 1073,
-    1411, -77, -3246, -3038, -2773, -4432, -5601, -6232, -4548, -4149, -4469, -2138,
-    -1499, -786, -3294, -3348, -2487, -110, -180, -1834, -3862, -2457, 872, -1017,
-    -774, -633, -973, -2573, -3040, -1187, 978, -726, -3445, -2597, -1594, -155,
-    1795, -757, -563, 1985, 3112, 1287, 1498, 2644, 3192, 1701, 3304, 4003,
-    2408, 1549, 907, 480, -1312, 545, 1321, -1342, 577, 591, 335, 1105,
-    1345, 373, -644, -1345, -877, -1241, -1773, -2118, -1573, -1719, -2732, -2407,
-    -4532, -4030, -2969, -1436, -2805, -1502, -647, 145, 573, 2289, 4288, 3898,
-    2849, 1946, 2712, 2322, 2223, 2218, 264, -78, -561, 1169, -38, 228,
-    516, -2503, -2888, 57, -345, 229, 3308, 995, 814, 3680, 6582, 6422,
-    6285, 8042, 8742, 5997, 7718, 7531, 5566, 5005, 6700, 6801, 3863, 5257,
-    5831, 1618, 1338, 1808, 678, -183, 145, 1691, 877, -399, -340, -1204,
-    -2376, -2294, -170, -876, -1669, -285, -677, -2016, -128, 840, 270, 513,
-    1295, 2779, 294, 1261, 2385, 1884, -155, 1138, 2343, 1180, 859, 823,
-    -1298, -3019, -1580, -2480, -3592, -3152, -1384, -1074, -1899, -1750, -1941, -3450,
-    -4125, -2889, -4298, -4564, -3639, -5183, -6366, -3631, -2069, -3278, -2519, -543,
-    -1285, -1019, 332, -208, -535, 982, 2487, -135, 130, 1883, 2323, 1177,
-    378, 638, 867, 413, 820, 1912, 3319, 2723, 1995, 1389, -410, -562,
-    1562, 2068, 743, 640, 328, 24, 2192, 1595, 1785, 3181, 2766, 2483,
-    3905, 3994, 3775, 3544, 1298, 3569, 3686, 4103, 4516, 3657, 3722, 3844,
-    925, 150, -615, 132, 1044, 270, 1630, 806, 144, -300, 1481, 2217,
-    202, 1178, 2306, 867, 2485, 3703, 2015, 2561, 2302, 4365, 4623, 4956,
-    5855, 4669, 5699, 5841, 5936, 6516, 5570, 5048, 5046, 4637, 4174, 1440,
-    137, -1763, -1444, -1923, -3859, -3457, -4365, -6695, -6949, -6957, -7503, -7360,
-    -6933, -8377, -7901, -7078, -6805, -8765, -8924, -6821, -5407, -6126, -4995, -3974,
-    -3639, -2090, -1739, -700, -93, 459, 927, 3248, 2559, 4179, 3726, -779,
-    -130, 791, 1107, 1541, 63, -244, -1884, -2616, -2043, -2213, -3791, -3944,
-    -3843, -3396, -2971, -1955, -3709, -4245, -3295, -3317, -1845, -3183, -3771, -2648,
-    -4499, -4729, -4085, -4132, -6176, -4337, -1515, -1322, -991, -4040, -6352, -4880,
-    -5282, -5915, -2864, -4904, -5964, -6837, -6381, -5827, -6007, -5938, -4831, -4685,
-    -1848, -51, -300, -1937, -2050, -225, 614, 1998, 4031, 2641, 2943, 3896,
-    2649, 3437, 2902, 3858, 3816, 4342, 4588, 3723, 2639, -196, -1921, -1011,
-    -1556, -790, -2883, -2561, -934, -2818, -4322, -2298, -2136, -3944, -3802, -1252,
-    -1593, -2761, -3396, -3225, -1903, -1576, -937, -1317, -1928, -1373, -2270, -1474,
-    -664, -1365, -970, -97, 3491, 5338, 4755, 4281, 4947, 3082, 4003, 6304,
-    6437, 4875, 4904, 4396, 3717, 2452, 2135, 3031, 2134, 1071, 2885, 2922,
-    2211, 2995, 1977, 1173, 3818, 4216, 2515, 2723, 5243, 5874, 3527, 4404,
-    5569, 5228, 3280, 4529, 4836, 2862, 1649, 2460, -702, -817, 124, -1436,
-    -2522, -2392, -862, -1483, -2303, -1393, -1125, -3389, -3556, -1994, -2665, -2417,
-    -971, -919, -345, 1415, 2663, 249, -108, 1561, 2914, 1840, 3609, 3737,
-    2541, 3188, 3803, 3953, 3017, 4259, 3798, 1463, 1302, 2734, 2211, -243,
-    656, 2234, 1911, 1683, 3127, 3352, 2592, 3328, 3178, 3092, 3097, 5277,
-    4646, 3806, 5666, 5377, 2062, 514, 2570, 2771, -313, 1452, 2736, 773,
-    -706, -125, -1632, -2342, -1367, -1145, -1619, -1230, 420, -490, -2228, -2391,
-    -538, -1453, -1742, 160, -613, -1798, -1884, -4105, -5450, -5007, -3083, -2465,
-    -1568, -728, 448, -1204, -3799, -3995, -3372, -3093, -2184, -2026, -3298, -3828,
-    -3107, -4011, -5448, -4958, -3395, -3338, -2925, -2285, -3717, -4112, -3232, -2969,
-    -5077, -3772, -1768, -2509, -3440, -2855, -1888, -1725, -3156, -1857, 465, 1184,
-    2227, 3025, 1733, 2290, 1904, 1361, 2577, 2898, 3145, 2711, 1900, 2446,
-    722, -368, -313, -715, -721, -1680, -2354, -2427, -3950, -3551, -3850, -5802,
-    -4340, -2410, -4087, -3425, -4036, -5676, -6931, -5767, -4879, -5066, -2134, -797,
-    121, -1557, -2463, -603, -1515, -1659, 2358, 1096, 292, 1052, 3314, 3812,
-    3109, 4545, 4702, 4866, 4905, 5844, 5850, 4897, 4673, 2829, 561, 956,
-    2850, 801, 1467, 710, 1023, 155, -218, -616, 17, 1120, 879, 2513,
-    1939, 3151, 2377, 2550, 2229, 2088, 1354, 1383, 902, -112, -2127, -1373,
-    -1454, -4269, -4270, -3701, -3893, -5021, -4455, -3398, -5302, -5885, -5488, -4522,
-    -4873, -5067, -6304, -6525, -6609, -5267, -5000, -5228, -3086, -1576, -1161, 454,
-    1549, -126, -377, 448, 2378, 1758, 2798, 2907, 4375, 4237, 4363, 4148,
-    3365, 911, 2743, 2482, 2357, 2465, 1983, 96, -649, 429, 862, 1119,
-    570, -60, 752, 1529, 2002, 530, 175, 1517, 2088, 1610, 2839, 4166,
-    3116, 507, 2095, 2512, 1551, 2125, 2577, 3359, 4215, 6286, 7454, 5346,
-    5270, 6425, 6084, 6661, 7561, 7637, 4370, 2916, 4268, 4671, 4127, 3636,
-    2904, 2790, 435, 2365, 1967, 1457, 323, 3270, 5384, 7105, 6652, 6610,
-    5435, 5103, 6224, 6392, 6327, 4996, 5212, 3949, 5118, 5182, 2680, 128,
-    1343, 3516, 4389, 3817, 3169, 2021, -686, 293, 272, -368, -903, -959,
-    -1479, -297, -98, -2003, -2809, -2260, -559, 562, 1704, 2224, 1818, 121,
-    1471, 2166, 1687, 2381, 2352, 1324, 1187, 1596, 1762, -730, -2013, -1088,
-    -35, -1222, -1560, -559, -1840, -2502, -2645, -1250, -895, 4, -948, -2292,
-    -3002, -2347, -2738, -4597, -2980, -1961, -1214, -1739, -454, -1702, -1888, -1274,
-    -2781, -2754, -1201, -1930, -3197, -3068, -1832, -1304, -2205, -1296, -1426, -1611,
-    -679, -656, -1517, -2696, -3365, -2123, -3768, -4013, -3737, -4689, -5125, -5002,
-    -4170, -4896, -4281, -3728, -4213, -2703, -1379, 274, 622, 131, 2131, 1477,
-    1484, 3345, 2373, -227, -754, -656, -658, -1410, -989, -1190, -1943, -3398,
-    -3581, -2321, -1957, -3912, -4632, -4759, -2863, -3830, -4445, -6477, -7350, -7543,
-    -6514, -4918, -4008, -3993, -3980, -4005, -2961, -2025, -421, 1300, 2846, 1751,
-    2886, 3263, 2005, -913, -787, 1761, 1923, 2043, 1092, -221, -368, -2136,
-    -1570, -1326, -1610, 689, 1390, 453, 701, 205, -1276, -2740, -1318, 261,
-    1328, 2878, 1534, -744, 202, 269, 1707, 2024, 3064, 3876, 3150, 3606,
-    2738, 3521, 1716, 1010, 2740, 3490, 4468, 5780, 4132, 2870, 2575, 3050,
-    2884, 2288, 2235, 2755, 2370, 412, -10, -1874, -4900, -4343, -2700, -2041,
-    -1008, -1517, -3609, -3746, -4136, -4514, -2927, -1152, -572, -258, -1747, -2444,
-    -2463, -4653, -5962, -5098, -3257, -2989, -1937, -3014, -3974, -3047, -2966, -3541,
-    -2073, -660, 1442, 417, -1052, -809, -1807, -3043, -1987, 52, 1631, 3261
-};
-
-#endif // AUDIO_DATA_H_RICK_ROLL_AUDIO
@@ -0,0 +1,81 @@
+#include <string.h>
+#include "sample_bank.h"
+#include "adpcm.h"
+
+// How many bytes a sound of this format and length needs
+static uint32_t sample_bank_data_bytes(uint8_t format, uint32_t length) {
+    if (format == MIXER_FORMAT_ADPCM) {
+        return ADPCM_BYTES_FOR(length);
+    }
+    return length * sizeof(int16_t);
+}
+
+bool sample_bank_open(sample_bank_t *bank, const void *image, size_t size) {
+    const sample_bank_header_t *header = image;
+
+    bank->image = NULL;
+    bank->index = NULL;
+    bank->count = 0;
+
+    if (image == NULL || size < sizeof(*header)) {
+        return false;
+    }
+    if (header->magic != SAMPLE_BANK_MAGIC || header->version != SAMPLE_BANK_VERSION) {
+        return false;
+    }
+    if (header->size > size || header->index_offset % 4 != 0 ||
+        header->index_offset > header->size ||
+        (header->size - header->index_offset) / sizeof(sample_bank_entry_t) < header->count) {
+        return false;
+    }
+
+    const sample_bank_entry_t *index =
+        (const sample_bank_entry_t *)((const uint8_t *)image + header->index_offset);
+
+    // check every sound once here, so the mixer never has to
+    for (uint16_t i = 0; i < header->count; i++) {
+        const sample_bank_entry_t *e = &index[i];
+
+        if (e->format != MIXER_FORMAT_PCM16 && e->format != MIXER_FORMAT_ADPCM) {
+            return false;
+        }
+        if (e->offset % 4 != 0 || e->offset > header->size || e->bytes > header->size - e->offset) {
+            return false;
+        }
+        if (e->length > UINT32_MAX / 2 || sample_bank_data_bytes(e->format, e->length) > e->bytes) {
+            return false;
+        }
+        if (memchr(e->name, 0, SAMPLE_BANK_NAME_LEN) == NULL) {
+            return false;
+        }
+    }
+
+    bank->image = image;
+    bank->index = index;
+    bank->count = header->count;
+    return true;
+}
+
+const sample_bank_entry_t *sample_bank_entry(const sample_bank_t *bank, uint16_t i) {
+    if (i >= bank->count) {
+        return NULL;
+    }
+    return &bank->index[i];
+}
+
+bool sample_bank_sound(const sample_bank_t *bank, uint16_t i, mixer_sound_t *sound) {
+    const sample_bank_entry_t *e = sample_bank_entry(bank, i);
+    if (e == NULL) {
+        return false;
+    }
+
+    sound->data = bank->image + e->offset;
+    sound->length = e->length;
+    sound->format = e->format;
+    return true;
+}
+
+const char *sample_bank_name(const sample_bank_t *bank, uint16_t i) {
+    const sample_bank_entry_t *e = sample_bank_entry(bank, i);
+    return e ? e->name : "";
+}
@@ -0,0 +1,69 @@
+#ifndef SAMPLE_BANK_H
+#define SAMPLE_BANK_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "mixer.h"
+
+// All the sounds live in one packed image made by
+// song_conversion/song_converter.py --bank, instead of one C header per sound.
+// The image is a header, an index with one entry per sound, then the sound
+// data, every sound starting on a SAMPLE_BANK_ALIGN byte boundary.
+// Everything is little endian, same as the RP2040, so we read it in place.
+// Nothing in here touches the pico hardware so it can also be built on a PC.
+
+#define SAMPLE_BANK_MAGIC 0x4b4e4244u  // "DBNK"
+#define SAMPLE_BANK_VERSION 1
+#define SAMPLE_BANK_ALIGN 64
+#define SAMPLE_BANK_NAME_LEN 16
+
+typedef struct {
+    uint32_t magic;          // SAMPLE_BANK_MAGIC
+    uint16_t version;        // SAMPLE_BANK_VERSION
+    uint16_t count;          // number of sounds in the index
+    uint32_t index_offset;   // where the index starts, from the start of the image
+    uint32_t size;           // total size of the image in bytes
+    uint8_t reserved[16];
+} sample_bank_header_t;
+
+typedef struct {
+    uint32_t offset;         // where the sound data starts, from the start of the image
+    uint32_t length;         // number of samples
+    uint32_t bytes;          // size of the sound data
+    uint16_t rate;           // sample rate it was converted at
+    uint8_t format;          // one of mixer_format_t
+    uint8_t reserved;
+    char name[SAMPLE_BANK_NAME_LEN];  // nul terminated
+} sample_bank_entry_t;
+
+// the python script packs these by hand, so make sure the compiler agrees on the layout
+_Static_assert(sizeof(sample_bank_header_t) == 32, "sample bank header must be 32 bytes");
+_Static_assert(sizeof(sample_bank_entry_t) == 32, "sample bank entry must be 32 bytes");
+
+typedef struct {
+    const uint8_t *image;
+    const sample_bank_entry_t *index;
+    uint16_t count;
+} sample_bank_t;
+
+// Check the image and point the bank at it, the image has to stay around.
+// Returns false if the image is not a bank we understand or any sound
+// points outside of it
+bool sample_bank_open(sample_bank_t *bank, const void *image, size_t size);
+
+// How many sounds are in the bank
+static inline uint16_t sample_bank_count(const sample_bank_t *bank) {
+    return bank->count;
+}
+
+// Index entry for a sound, NULL if i is out of range
+const sample_bank_entry_t *sample_bank_entry(const sample_bank_t *bank, uint16_t i);
+
+// Fill in a mixer sound pointing straight at the bank data, no copy
+bool sample_bank_sound(const sample_bank_t *bank, uint16_t i, mixer_sound_t *sound);
+
+// Name of a sound, "" if i is out of range
+const char *sample_bank_name(const sample_bank_t *bank, uint16_t i);
+
+#endif // SAMPLE_BANK_H
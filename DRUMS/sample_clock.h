@@ -0,0 +1,56 @@
+#ifndef SAMPLE_CLOCK_H
+#define SAMPLE_CLOCK_H
+
+#include <stdint.h>
+
+// The one clock everything is timed on: the count of samples that have gone out of
+// the audio output. The audio side anchors it every block (this sample is going
+// out right now, at this us) and anything that only has a us timestamp, like a
+// pad interrupt, gets turned into a sample from the latest anchor. The us timer
+// only ever covers the few ms since the last block so it cant drift against the
+// audio, recording and playback both end up counting the same samples.
+// The anchor is written by one side (the audio interrupt) and read from the other
+// core, the count makes sure a reader never gets half of an update.
+// Nothing in here touches the pico hardware so it can also be built on a PC.
+
+typedef struct {
+    volatile uint32_t count;   // odd while the anchor is being changed
+    volatile uint32_t sample;
+    volatile uint32_t us;
+    uint32_t sample_rate;
+} sample_clock_t;
+
+static inline void sample_clock_init(sample_clock_t *clock, uint32_t sample_rate) {
+    clock->count = 0;
+    clock->sample = 0;
+    clock->us = 0;
+    clock->sample_rate = sample_rate;
+}
+
+// sample goes out at time us
+static inline void sample_clock_anchor(sample_clock_t *clock, uint32_t sample, uint32_t us) {
+    __atomic_store_n(&clock->count, clock->count + 1, __ATOMIC_RELEASE);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    clock->sample = sample;
+    clock->us = us;
+    __atomic_store_n(&clock->count, clock->count + 1, __ATOMIC_RELEASE);
+}
+
+// The sample going out at time us, which can be a bit either side of the anchor
+static inline uint32_t sample_clock_at(const sample_clock_t *clock, uint32_t us) {
+    uint32_t count, sample, anchor_us;
+
+    do {
+        count = __atomic_load_n(&clock->count, __ATOMIC_ACQUIRE);
+        sample = clock->sample;
+        anchor_us = clock->us;
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    } while ((count & 1) || count != __atomic_load_n(&clock->count, __ATOMIC_ACQUIRE));
+
+    // rounded to the nearest sample, either way
+    int64_t since = (int64_t)(int32_t)(us - anchor_us) * clock->sample_rate;
+    int64_t samples = since >= 0 ? (since + 500000) / 1000000 : -((-since + 500000) / 1000000);
+    return sample + (uint32_t)samples;
+}
+
+#endif // SAMPLE_CLOCK_H
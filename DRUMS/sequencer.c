@@ -0,0 +1,221 @@
+#include <stddef.h>
+#include "sequencer.h"
+
+// Back to the top of the loop for every layer
+static void sequencer_rewind(sequencer_t *seq) {
+    for (uint32_t i = 0; i < LOOP_STORE_LAYERS; i++) {
+        seq->cursors[i].index = 0;
+        seq->cursors[i].time = 0;
+    }
+    seq->position = 0;
+}
+
+void sequencer_init(sequencer_t *seq, loop_store_t *store) {
+    seq->store = store;
+    seq->length = 0;
+    seq->pass_start = 0;
+    seq->pass = 0;
+    seq->playing = false;
+    sequencer_clear(seq);
+}
+
+void sequencer_clear(sequencer_t *seq) {
+    loop_store_clear(seq->store);
+    sequencer_rewind(seq);
+    seq->overdub_pass = SEQ_NO_PASS;
+    seq->cursor = 0;
+    seq->pattern = NULL;
+}
+
+void sequencer_set_pattern(sequencer_t *seq, const beat_pattern_t *pattern) {
+    seq->pattern = pattern;
+    seq->length = beat_pattern_length(pattern);
+    seq->cursor = 0;
+}
+
+// New layer on top, its cursor starts at the top like everyone elses
+static bool sequencer_new_layer(sequencer_t *seq) {
+    if (!loop_store_new_layer(seq->store)) {
+        return false;
+    }
+    seq_cursor_t *cursor = &seq->cursors[seq->store->num_layers - 1];
+    cursor->index = 0;
+    cursor->time = 0;
+    return true;
+}
+
+bool sequencer_record(sequencer_t *seq, uint32_t time, uint8_t pad) {
+    loop_store_t *store = seq->store;
+
+    if (store->num_layers == 0 && !sequencer_new_layer(seq)) {
+        return false;
+    }
+
+    loop_layer_t *layer = &store->layers[store->num_layers - 1];
+    seq_cursor_t *cursor = &seq->cursors[store->num_layers - 1];
+    bool caught_up = cursor->index == layer->count;
+
+    if (!loop_store_append(store, time, pad)) {
+        return false;
+    }
+
+    // playback is already past it this time round, it was heard live anyway so
+    // step over it and it plays from the next pass
+    if (caught_up && seq->playing && time < seq->position) {
+        cursor->index++;
+        cursor->time = time;
+    }
+    return true;
+}
+
+void sequencer_overdub_start(sequencer_t *seq) {
+    seq->overdub_pass = SEQ_NO_PASS;
+}
+
+bool sequencer_overdub(sequencer_t *seq, uint32_t tick, uint8_t pad) {
+    if (!seq->playing || seq->pattern != NULL || seq->length == 0) {
+        return false;
+    }
+
+    // where in the loop the hit was, playback can be a bit ahead so it might
+    // belong to the pass before the one being handed out
+    int32_t offset = (int32_t)(tick - seq->pass_start);
+    uint32_t pass = seq->pass;
+    while (offset < 0) {
+        offset += seq->length;
+        pass--;
+    }
+    while (offset >= (int32_t)seq->length) {
+        offset -= seq->length;
+        pass++;
+    }
+
+    // every pass gets its own layer so undo takes off one pass at a time
+    if (pass != seq->overdub_pass) {
+        if (!sequencer_new_layer(seq)) {
+            seq->store->dropped++;
+            return false;
+        }
+        seq->overdub_pass = pass;
+    }
+    return sequencer_record(seq, (uint32_t)offset, pad);
+}
+
+bool sequencer_undo(sequencer_t *seq) {
+    // the layer underneath belongs to an older pass, dont add to it
+    seq->overdub_pass = SEQ_NO_PASS;
+    return loop_store_undo(seq->store);
+}
+
+void sequencer_set_length(sequencer_t *seq, uint32_t length) {
+    seq->length = length;
+}
+
+void sequencer_start(sequencer_t *seq, uint32_t now) {
+    sequencer_rewind(seq);
+    seq->cursor = 0;
+    seq->pass_start = now;
+    seq->pass = 0;
+    seq->overdub_pass = SEQ_NO_PASS;
+    seq->playing = true;
+}
+
+void sequencer_stop(sequencer_t *seq) {
+    seq->playing = false;
+}
+
+// Same as below but going through the steps of a pattern, each step is one read
+// of its pad mask and empty steps cost next to nothing
+static uint32_t sequencer_advance_pattern(sequencer_t *seq, uint32_t until, sequencer_emit_fn emit, void *context) {
+    const beat_pattern_t *pattern = seq->pattern;
+    uint32_t emitted = 0;
+
+    if (pattern->steps == 0) {
+        return 0;
+    }
+
+    while (true) {
+        if (seq->cursor >= pattern->steps) {
+            seq->cursor = 0;
+            seq->pass_start += seq->length;
+        }
+
+        uint32_t due = seq->pass_start + beat_pattern_step_time(seq->cursor);
+        if ((int32_t)(due - until) >= 0) {
+            break;
+        }
+
+        beat_step_t pads = pattern->grid[seq->cursor];
+        for (uint8_t pad = 0; pads != 0; pad++, pads >>= 1) {
+            if (pads & 1) {
+                emit(pad, due, context);
+                emitted++;
+            }
+        }
+        seq->cursor++;
+    }
+
+    return emitted;
+}
+
+// Every layer hands out its hits up to until or the end of the pass, whichever
+// comes first, then if the pass is over everyone goes back to the top.
+// Each hit is one word read and an add
+static uint32_t sequencer_advance_loop(sequencer_t *seq, uint32_t until, sequencer_emit_fn emit, void *context) {
+    loop_store_t *store = seq->store;
+    uint32_t emitted = 0;
+
+    if (seq->length == 0) {
+        return 0;
+    }
+
+    while (true) {
+        // compare by difference so this keeps working when the tick clock wraps
+        int32_t ahead = (int32_t)(until - seq->pass_start);
+        if (ahead <= 0) {
+            break;
+        }
+        uint32_t limit = (uint32_t)ahead < seq->length ? (uint32_t)ahead : seq->length;
+
+        for (uint32_t l = 0; l < store->num_layers; l++) {
+            const loop_layer_t *layer = &store->layers[l];
+            seq_cursor_t *cursor = &seq->cursors[l];
+
+            // hits past the end of the loop never play
+            while (cursor->index < layer->count) {
+                loop_event_t event = store->events[layer->first + cursor->index];
+                uint32_t time = cursor->time + LOOP_EVENT_DELTA(event);
+                if (time >= limit) {
+                    break;
+                }
+                if (!layer->muted) {
+                    emit(LOOP_EVENT_PAD(event), seq->pass_start + time, context);
+                    emitted++;
+                }
+                cursor->index++;
+                cursor->time = time;
+            }
+        }
+        seq->position = limit;
+
+        if (limit < seq->length) {
+            break;
+        }
+        // this pass is done, go round to the top
+        seq->pass_start += seq->length;
+        seq->pass++;
+        sequencer_rewind(seq);
+    }
+
+    return emitted;
+}
+
+uint32_t sequencer_advance(sequencer_t *seq, uint32_t until, sequencer_emit_fn emit, void *context) {
+    if (!seq->playing) {
+        return 0;
+    }
+    if (seq->pattern != NULL) {
+        return sequencer_advance_pattern(seq, until, emit, context);
+    }
+    return sequencer_advance_loop(seq, until, emit, context);
+}
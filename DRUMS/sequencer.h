@@ -0,0 +1,72 @@
+#ifndef SEQUENCER_H
+#define SEQUENCER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "beat_pattern.h"
+#include "loop_store.h"
+
+// Loop playback. The loop is the layers in a loop_store_t, each one already in
+// time order, with a cursor per layer pointing at its next hit. Advancing only
+// looks at hits that are actually due, so the cost per hit doesnt grow with the
+// length of the loop or how many hits are in it.
+// It can also play a beat_pattern_t straight out of flash instead of the loop.
+// All times are in ticks of the tempo clock (see tempo.h), so the same loop
+// plays at any tempo.
+
+typedef struct {
+    uint32_t index;  // next hit in the layer
+    uint32_t time;   // loop time of the hit before it (0 before the first)
+} seq_cursor_t;
+
+typedef struct {
+    loop_store_t *store;
+    seq_cursor_t cursors[LOOP_STORE_LAYERS];
+    uint32_t length;      // loop length in ticks
+    uint32_t position;    // how far into the current pass has been handed out
+    uint32_t pass_start;  // tick the current pass through the loop started on
+    uint32_t pass;        // passes since playback started
+    uint32_t overdub_pass;  // pass the newest layer was overdubbed in, SEQ_NO_PASS if none
+    uint32_t cursor;      // next step when playing a pattern
+    const beat_pattern_t *pattern;  // when set this plays instead of the loop
+    bool playing;
+} sequencer_t;
+
+#define SEQ_NO_PASS 0xFFFFFFFFu
+
+// Called for every event that is due, with the tick it should play on
+typedef void (*sequencer_emit_fn)(uint8_t pad, uint32_t time, void *context);
+
+void sequencer_init(sequencer_t *seq, loop_store_t *store);
+
+// Remove every layer and any pattern, playback stays on but has nothing to play
+void sequencer_clear(sequencer_t *seq);
+
+// Record a hit at loop time time into the newest layer, for recording a loop from
+// scratch. Returns false if it didnt fit
+bool sequencer_record(sequencer_t *seq, uint32_t time, uint8_t pad);
+
+// Overdubbing while the loop plays. tick is on the same clock as sequencer_advance,
+// each pass of the loop goes into its own layer and hits start playing from the
+// next pass round. sequencer_overdub_start makes the next hit start a fresh layer
+void sequencer_overdub_start(sequencer_t *seq);
+bool sequencer_overdub(sequencer_t *seq, uint32_t tick, uint8_t pad);
+
+// Throw away the newest layer
+bool sequencer_undo(sequencer_t *seq);
+
+// Play pattern instead of the loop. Nothing is copied so the pattern has to
+// stay around, sequencer_clear goes back to the loop
+void sequencer_set_pattern(sequencer_t *seq, const beat_pattern_t *pattern);
+
+void sequencer_set_length(sequencer_t *seq, uint32_t length);
+
+// Start from the top of the loop, with time 0 of the loop landing on tick now
+void sequencer_start(sequencer_t *seq, uint32_t now);
+void sequencer_stop(sequencer_t *seq);
+
+// Hand every event due before the tick until to emit, wrapping around
+// the end of the loop as many times as needed. Returns how many were emitted
+uint32_t sequencer_advance(sequencer_t *seq, uint32_t until, sequencer_emit_fn emit, void *context);
+
+#endif // SEQUENCER_H
@@ -0,0 +1,83 @@
+#include <string.h>
+#include "session.h"
+
+uint32_t session_save(uint8_t *buf, uint32_t capacity, const session_settings_t *settings, const loop_store_t *store) {
+    uint32_t layers_bytes = store->num_layers * sizeof(session_layer_t);
+    uint32_t events_bytes = store->used * sizeof(loop_event_t);
+    uint32_t total = sizeof(session_header_t) + layers_bytes + events_bytes;
+
+    if (total > capacity) {
+        return 0;
+    }
+
+    session_header_t header;
+    memset(&header, 0, sizeof(header));
+    header.magic = SESSION_MAGIC;
+    header.version = SESSION_VERSION;
+    header.num_layers = store->num_layers;
+    header.events = store->used;
+    header.settings = *settings;
+    memcpy(buf, &header, sizeof(header));
+
+    // the layers sit one after the other so the counts are enough to find them again
+    uint8_t *at = buf + sizeof(header);
+    for (uint8_t i = 0; i < store->num_layers; i++) {
+        session_layer_t layer = {store->layers[i].count, store->layers[i].muted};
+        memcpy(at, &layer, sizeof(layer));
+        at += sizeof(layer);
+    }
+    memcpy(at, store->events, events_bytes);
+    return total;
+}
+
+bool session_load(const uint8_t *data, uint32_t length, session_settings_t *settings, loop_store_t *store) {
+    session_header_t header;
+
+    if (length < sizeof(header)) {
+        return false;
+    }
+    memcpy(&header, data, sizeof(header));
+    if (header.magic != SESSION_MAGIC || header.version != SESSION_VERSION ||
+        header.num_layers > LOOP_STORE_LAYERS || header.events > store->capacity ||
+        length != sizeof(header) + header.num_layers * sizeof(session_layer_t) + header.events * sizeof(loop_event_t)) {
+        return false;
+    }
+
+    // the layer counts have to add up to the hits
+    const uint8_t *layers = data + sizeof(header);
+    const uint8_t *events = layers + header.num_layers * sizeof(session_layer_t);
+    uint32_t counted = 0;
+    for (uint8_t i = 0; i < header.num_layers; i++) {
+        session_layer_t layer;
+        memcpy(&layer, layers + i * sizeof(layer), sizeof(layer));
+        counted += layer.count;
+        if (layer.count > header.events || counted > header.events) {
+            return false;
+        }
+    }
+    if (counted != header.events) {
+        return false;
+    }
+
+    // put it back through append so the layers end up exactly as they were recorded
+    loop_store_clear(store);
+    for (uint8_t i = 0; i < header.num_layers; i++) {
+        session_layer_t layer;
+        memcpy(&layer, layers + i * sizeof(layer), sizeof(layer));
+        loop_store_new_layer(store);
+
+        uint32_t time = 0;
+        for (uint32_t n = 0; n < layer.count; n++) {
+            loop_event_t event;
+            memcpy(&event, events, sizeof(event));
+            events += sizeof(event);
+
+            time += LOOP_EVENT_DELTA(event);
+            loop_store_append(store, time, LOOP_EVENT_PAD(event));
+        }
+        loop_store_mute(store, i, layer.muted != 0);
+    }
+
+    *settings = header.settings;
+    return true;
+}
@@ -0,0 +1,54 @@
+#ifndef SESSION_H
+#define SESSION_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "mixer.h"
+#include "loop_store.h"
+
+// Turns everything worth keeping over a power cycle (the loop with its layers,
+// which sound each pad has, the beat and the tempo) into one block of bytes and
+// back, that block is what gets saved to flash (see flash_log.h).
+// The hits are kept exactly as they are in the loop store, 4 bytes each.
+// Nothing in here touches the pico hardware so it can also be built on a PC.
+
+#define SESSION_MAGIC 0x53455353  // "SESS"
+#define SESSION_VERSION 2
+#define SESSION_NO_PATTERN 0xFF
+
+typedef struct {
+    uint8_t pad_sound[MIXER_NUM_PADS];
+    uint8_t beat;      // classic beat the beat button goes on from
+    uint8_t pattern;   // classic beat playing instead of the loop, SESSION_NO_PATTERN for the loop
+    uint16_t bpm;
+    uint32_t length;   // loop length in ticks
+    uint32_t loop_samples;  // what the tempo is locked to (see tempo_lock), 0 if it isnt
+} session_settings_t;
+
+// what the block starts with, then a session_layer_t per layer, then the hits
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint8_t num_layers;
+    uint8_t reserved;
+    uint32_t events;
+    session_settings_t settings;
+} session_header_t;
+
+typedef struct {
+    uint32_t count;
+    uint32_t muted;
+} session_layer_t;
+
+// biggest a session can get, a full loop store
+#define SESSION_MAX_BYTES (sizeof(session_header_t) + LOOP_STORE_LAYERS * sizeof(session_layer_t) + \
+                           LOOP_STORE_EVENTS * sizeof(loop_event_t))
+
+// Write the session into buf, returns how many bytes it took or 0 if it didnt fit
+uint32_t session_save(uint8_t *buf, uint32_t capacity, const session_settings_t *settings, const loop_store_t *store);
+
+// Read a session back, rebuilding the loop in store. Everything is checked first,
+// so on false (not a session, or from a different version) nothing was changed
+bool session_load(const uint8_t *data, uint32_t length, session_settings_t *settings, loop_store_t *store);
+
+#endif // SESSION_H
@@ -0,0 +1,80 @@
+#include "tempo.h"
+
+void tempo_init(tempo_t *tempo, uint32_t sample_rate, uint32_t block_size, uint16_t bpm) {
+    tempo->sample_rate = sample_rate;
+    tempo->block_size = block_size;
+    tempo->sample = 0;
+    tempo->tick = 0;
+    tempo->rem = 0;
+    tempo->den = 0;
+    tempo_set_bpm(tempo, bpm);
+}
+
+// The only divides are in here, they happen when the tempo changes not per block.
+// The remainder is scaled over to the new den so the clock carries on from the same place
+static void tempo_set_fraction(tempo_t *tempo, uint32_t num, uint32_t den) {
+    if (tempo->den != 0 && tempo->den != den) {
+        tempo->rem = (uint32_t)((uint64_t)tempo->rem * den / tempo->den);
+    }
+
+    uint64_t block = (uint64_t)tempo->block_size * num;
+    uint64_t last = (uint64_t)(tempo->block_size - 1) * num;
+
+    tempo->num = num;
+    tempo->den = den;
+    tempo->block_ticks = (uint32_t)(block / den);
+    tempo->block_rem = (uint32_t)(block % den);
+    tempo->last_ticks = (uint32_t)(last / den);
+    tempo->last_rem = (uint32_t)(last % den);
+}
+
+void tempo_set_bpm(tempo_t *tempo, uint16_t bpm) {
+    if (bpm < TEMPO_MIN_BPM) {
+        bpm = TEMPO_MIN_BPM;
+    } else if (bpm > TEMPO_MAX_BPM) {
+        bpm = TEMPO_MAX_BPM;
+    }
+
+    // ticks a minute over samples a minute
+    tempo->bpm = bpm;
+    tempo->locked = false;
+    tempo_set_fraction(tempo, (uint32_t)bpm * TEMPO_PPQN, tempo->sample_rate * 60);
+}
+
+void tempo_lock(tempo_t *tempo, uint32_t ticks, uint32_t samples) {
+    // a tick still has to be shorter than a sample, and den has to leave room for two remainders
+    if (samples == 0 || ticks < samples || samples >= 0x80000000u) {
+        return;
+    }
+    tempo_set_fraction(tempo, ticks, samples);
+    tempo->locked = true;
+}
+
+void tempo_start(tempo_t *tempo, uint32_t sample) {
+    tempo->sample = sample;
+    tempo->tick = 0;
+    tempo->rem = 0;
+}
+
+uint32_t tempo_sample_of(const tempo_t *tempo, uint32_t tick) {
+    // how far past the current position the tick is, by difference so it stays right
+    // when the tick clock wraps. The tick is in this block so it's a block of ticks at most
+    int64_t ahead = (int64_t)(int32_t)(tick - tempo->tick) * tempo->den - tempo->rem;
+
+    if (ahead <= 0) {
+        return tempo->sample;
+    }
+    return tempo->sample + (uint32_t)((ahead + tempo->num - 1) / tempo->num);
+}
+
+uint32_t tempo_tick_at(const tempo_t *tempo, uint32_t sample) {
+    int64_t ticks = (int64_t)(int32_t)(sample - tempo->sample) * tempo->num + tempo->rem;
+
+    // round down, the right way for samples before the block too
+    int64_t whole = ticks >= 0 ? ticks / tempo->den : -((-ticks + tempo->den - 1) / tempo->den);
+    return tempo->tick + (uint32_t)whole;
+}
+
+uint32_t tempo_samples_to_ticks(const tempo_t *tempo, uint32_t samples) {
+    return (uint32_t)((uint64_t)samples * tempo->num / tempo->den);
+}
@@ -0,0 +1,103 @@
+#ifndef TEMPO_H
+#define TEMPO_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Musical time for the loops and beats. Everything the sequencer holds is in ticks
+// (TEMPO_PPQN to a beat) and this turns ticks into the samples the mixer counts.
+// How many ticks go by per sample is kept as an exact fraction, num / den, and the
+// tick clock is a whole number of ticks plus a remainder out of den. Advancing a
+// block is a couple of adds and nothing gets rounded, so the clock never drifts
+// against the sample count however long it runs. Changing tempo only changes the
+// fraction, none of the recorded events have to be touched.
+// Nothing in here touches the pico hardware so it can also be built on a PC.
+
+// Ticks per quarter note. High enough that a tick is shorter than a sample even at
+// TEMPO_MIN_BPM, so every sample lands on its own tick and a hit recorded on a
+// sample plays back on exactly that sample. Must be a multiple of 4 so 16th note
+// steps are whole ticks
+#ifndef TEMPO_PPQN
+#define TEMPO_PPQN 70560
+#endif
+
+#define TEMPO_MIN_BPM 20
+#define TEMPO_MAX_BPM 300
+#define TEMPO_MAX_SAMPLE_RATE 22050
+
+#if TEMPO_PPQN % 4
+#error "TEMPO_PPQN must be a multiple of 4"
+#endif
+#if TEMPO_PPQN * TEMPO_MIN_BPM < 60 * TEMPO_MAX_SAMPLE_RATE
+#error "TEMPO_PPQN is too small for a tick to be shorter than a sample"
+#endif
+
+typedef struct {
+    uint32_t sample_rate;
+    uint32_t block_size;        // samples the clock moves on each tempo_advance
+    uint16_t bpm;
+    uint32_t num;               // ticks per sample is num / den, at least 1
+    uint32_t den;
+    uint32_t block_ticks;       // ticks per block, whole ticks
+    uint32_t block_rem;         // and the rest, out of den
+    uint32_t last_ticks;        // same for the last sample of a block
+    uint32_t last_rem;
+    bool locked;                // num / den came from tempo_lock
+
+    uint32_t sample;            // sample time of the start of the current block
+    uint32_t tick;              // tick clock at sample, whole ticks
+    uint32_t rem;               // and the rest, out of den
+} tempo_t;
+
+void tempo_init(tempo_t *tempo, uint32_t sample_rate, uint32_t block_size, uint16_t bpm);
+
+// Clamped to TEMPO_MIN_BPM..TEMPO_MAX_BPM. The clock carries on from where it is,
+// only how fast it goes from here changes
+void tempo_set_bpm(tempo_t *tempo, uint16_t bpm);
+
+// Make ticks go by at exactly ticks per samples, for a loop that was recorded as
+// samples long and came out as ticks long. Then every pass of it is exactly that
+// many samples, where the tempo in bpm would be a little off. The bpm stays what
+// it was for showing, tempo_set_bpm goes back to it
+void tempo_lock(tempo_t *tempo, uint32_t ticks, uint32_t samples);
+
+// Restart the tick clock at tick 0 on sample
+void tempo_start(tempo_t *tempo, uint32_t sample);
+
+// Move on one block
+static inline void tempo_advance(tempo_t *tempo) {
+    tempo->tick += tempo->block_ticks;
+    tempo->rem += tempo->block_rem;
+    if (tempo->rem >= tempo->den) {
+        tempo->rem -= tempo->den;
+        tempo->tick++;
+    }
+    tempo->sample += tempo->block_size;
+}
+
+// Sample the current block ends on (and the next one starts on)
+static inline uint32_t tempo_block_end(const tempo_t *tempo) {
+    return tempo->sample + tempo->block_size;
+}
+
+// First tick that lands after the current block. Every tick before it and not
+// before the current position lands on one of the block's samples
+static inline uint32_t tempo_block_end_tick(const tempo_t *tempo) {
+    // the tick the last sample of the block is on, plus one
+    uint32_t tick = tempo->tick + tempo->last_ticks + 1;
+
+    // rems are under den < 2^31 so this cant wrap
+    return tempo->rem + tempo->last_rem >= tempo->den ? tick + 1 : tick;
+}
+
+// First sample at or after a tick in the current block
+uint32_t tempo_sample_of(const tempo_t *tempo, uint32_t tick);
+
+// Tick the clock is on at sample (rounded down), which can be either side of the
+// current block by a few seconds. tempo_sample_of gives the same sample back
+uint32_t tempo_tick_at(const tempo_t *tempo, uint32_t sample);
+
+// How many ticks a stretch of samples is at the current tempo, rounded down
+uint32_t tempo_samples_to_ticks(const tempo_t *tempo, uint32_t samples);
+
+#endif // TEMPO_H
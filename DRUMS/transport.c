@@ -0,0 +1,311 @@
+#include <stddef.h>
+#include "transport.h"
+
+// Each table entry is the state we go to and what to do on the way. An action
+// can pick a different state when it depends on more than the event, like
+// stopping a recording with nothing in it. NULL actions just change state.
+typedef transport_state_t (*transport_action_fn)(transport_t *transport, const transport_event_t *event,
+                                                 transport_state_t next);
+
+typedef struct {
+    transport_state_t next;
+    transport_action_fn action;
+} transport_transition_t;
+
+// ---- actions ----
+
+static transport_state_t act_record_pad(transport_t *t, const transport_event_t *event, transport_state_t next) {
+    if (event->arg < MIXER_NUM_PADS) {
+        t->ops->record_pad(t->context, event->arg, event->time);
+    }
+    return next;
+}
+
+// Touching the pad being configured again moves it on to the next sound,
+// touching any other pad picks that one to configure. Either way we hear it
+static transport_state_t act_select_pad(transport_t *t, const transport_event_t *event, transport_state_t next) {
+    uint8_t pad = event->arg;
+    if (pad >= MIXER_NUM_PADS) {
+        return next;
+    }
+
+    if (t->select_pad == pad && t->num_sounds > 0) {
+        t->select_sound = (uint8_t)((t->select_sound + 1) % t->num_sounds);
+        t->pad_sound[pad] = t->select_sound;
+        t->ops->assign_sound(t->context, pad, t->select_sound);
+    } else {
+        t->select_pad = pad;
+        t->select_sound = t->pad_sound[pad];
+    }
+    t->ops->play_pad(t->context, pad);
+    return next;
+}
+
+// Going off to another mode in the middle of a recording keeps the take, same as
+// pressing record. The hits are in samples until record_stop turns them into ticks
+static void transport_finish_take(transport_t *t, uint32_t time) {
+    if (t->state == TRANSPORT_RECORDING) {
+        t->ops->record_stop(t->context, time);
+    }
+}
+
+static transport_state_t act_enter_select(transport_t *t, const transport_event_t *event, transport_state_t next) {
+    transport_finish_take(t, event->time);
+    t->ops->play_stop(t->context);
+    t->select_pad = TRANSPORT_NO_PAD;
+    t->select_sound = 0;
+    return next;
+}
+
+static transport_state_t act_record_start(transport_t *t, const transport_event_t *event, transport_state_t next) {
+    t->ops->play_stop(t->context);
+    t->ops->record_start(t->context, event->time);
+    return next;
+}
+
+// Play what we just recorded straight away, unless nothing got recorded
+static transport_state_t act_record_stop(transport_t *t, const transport_event_t *event, transport_state_t next) {
+    if (t->ops->record_stop(t->context, event->time) == 0) {
+        return TRANSPORT_IDLE;
+    }
+    t->ops->play_start(t->context);
+    return next;
+}
+
+static transport_state_t act_play_start(transport_t *t, const transport_event_t *event, transport_state_t next) {
+    (void)event;
+    t->ops->play_start(t->context);
+    return next;
+}
+
+static transport_state_t act_play_stop(transport_t *t, const transport_event_t *event, transport_state_t next) {
+    (void)event;
+    t->ops->play_stop(t->context);
+    return next;
+}
+
+static transport_state_t act_clear(transport_t *t, const transport_event_t *event, transport_state_t next) {
+    (void)event;
+    t->ops->play_stop(t->context);
+    t->ops->clear(t->context);
+    return next;
+}
+
+static transport_state_t act_overdub_start(transport_t *t, const transport_event_t *event, transport_state_t next) {
+    (void)event;
+    t->ops->overdub_start(t->context);
+    return next;
+}
+
+static transport_state_t act_overdub_pad(transport_t *t, const transport_event_t *event, transport_state_t next) {
+    if (event->arg < MIXER_NUM_PADS) {
+        t->ops->overdub_pad(t->context, event->arg, event->time);
+    }
+    return next;
+}
+
+// Clearing while overdubbing takes the last pass back off
+static transport_state_t act_undo(transport_t *t, const transport_event_t *event, transport_state_t next) {
+    (void)event;
+    t->ops->undo(t->context);
+    return next;
+}
+
+// Clearing while recording throws away the hits so far but keeps recording
+static transport_state_t act_clear_take(transport_t *t, const transport_event_t *event, transport_state_t next) {
+    (void)event;
+    t->ops->clear(t->context);
+    return next;
+}
+
+static transport_state_t transport_play_beat(transport_t *t, uint8_t beat, uint32_t time) {
+    transport_finish_take(t, time);
+    t->beat = beat;
+    t->ops->load_beat(t->context, beat);
+    t->ops->play_start(t->context);
+    return TRANSPORT_BEAT;
+}
+
+static transport_state_t act_beat_next(transport_t *t, const transport_event_t *event, transport_state_t next) {
+    (void)next;
+    return transport_play_beat(t, (uint8_t)((t->beat + 1) % t->num_beats), event->time);
+}
+
+// Do whatever the beat pins are asking for, if we havent already
+static transport_state_t transport_apply_beat_pin(transport_t *t, transport_state_t state, uint32_t time) {
+    uint8_t beat = t->beat_pin;
+
+    if (beat == t->beat_pin_done) {
+        return state;
+    }
+    t->beat_pin_done = beat;
+
+    if (beat < t->num_beats) {
+        return transport_play_beat(t, beat, time);
+    }
+    // no beat stops whatever is playing, a recording carries on
+    if (state == TRANSPORT_PLAYING || state == TRANSPORT_BEAT || state == TRANSPORT_OVERDUB) {
+        t->ops->play_stop(t->context);
+        return TRANSPORT_IDLE;
+    }
+    return state;
+}
+
+static transport_state_t act_beat_pin(transport_t *t, const transport_event_t *event, transport_state_t next) {
+    t->beat_pin = event->arg;
+    return transport_apply_beat_pin(t, next, event->time);
+}
+
+// While picking sounds the pins are just remembered, and dealt with when we leave
+static transport_state_t act_remember_beat_pin(transport_t *t, const transport_event_t *event, transport_state_t next) {
+    t->beat_pin = event->arg;
+    return next;
+}
+
+static transport_state_t act_leave_select(transport_t *t, const transport_event_t *event, transport_state_t next) {
+    return transport_apply_beat_pin(t, next, event->time);
+}
+
+// ---- the table ----
+
+#define STAY(state) {state, NULL}
+
+static const transport_transition_t transport_table[TRANSPORT_NUM_STATES][TRANSPORT_NUM_EVENTS] = {
+    [TRANSPORT_IDLE] = {
+        [TRANSPORT_EV_PAD]          = STAY(TRANSPORT_IDLE),
+        [TRANSPORT_EV_SOUND_SELECT] = {TRANSPORT_SOUND_SELECT, act_enter_select},
+        [TRANSPORT_EV_RECORD]       = {TRANSPORT_RECORDING, act_record_start},
+        [TRANSPORT_EV_PLAY]         = {TRANSPORT_PLAYING, act_play_start},
+        [TRANSPORT_EV_CLEAR]        = {TRANSPORT_IDLE, act_clear},
+        [TRANSPORT_EV_BEAT_NEXT]    = {TRANSPORT_BEAT, act_beat_next},
+        [TRANSPORT_EV_BEAT_PIN]     = {TRANSPORT_IDLE, act_beat_pin},
+    },
+    [TRANSPORT_RECORDING] = {
+        [TRANSPORT_EV_PAD]          = {TRANSPORT_RECORDING, act_record_pad},
+        [TRANSPORT_EV_SOUND_SELECT] = {TRANSPORT_SOUND_SELECT, act_enter_select},
+        [TRANSPORT_EV_RECORD]       = {TRANSPORT_PLAYING, act_record_stop},
+        [TRANSPORT_EV_PLAY]         = STAY(TRANSPORT_RECORDING),
+        [TRANSPORT_EV_CLEAR]        = {TRANSPORT_RECORDING, act_clear_take},
+        [TRANSPORT_EV_BEAT_NEXT]    = {TRANSPORT_BEAT, act_beat_next},
+        [TRANSPORT_EV_BEAT_PIN]     = {TRANSPORT_RECORDING, act_beat_pin},
+    },
+    [TRANSPORT_PLAYING] = {
+        [TRANSPORT_EV_PAD]          = STAY(TRANSPORT_PLAYING),
+        [TRANSPORT_EV_SOUND_SELECT] = {TRANSPORT_SOUND_SELECT, act_enter_select},
+        [TRANSPORT_EV_RECORD]       = {TRANSPORT_OVERDUB, act_overdub_start},
+        [TRANSPORT_EV_PLAY]         = {TRANSPORT_IDLE, act_play_stop},
+        [TRANSPORT_EV_CLEAR]        = {TRANSPORT_IDLE, act_clear},
+        [TRANSPORT_EV_BEAT_NEXT]    = {TRANSPORT_BEAT, act_beat_next},
+        [TRANSPORT_EV_BEAT_PIN]     = {TRANSPORT_PLAYING, act_beat_pin},
+    },
+    // leaving this state stops the overdub, see transport_handle
+    [TRANSPORT_OVERDUB] = {
+        [TRANSPORT_EV_PAD]          = {TRANSPORT_OVERDUB, act_overdub_pad},
+        [TRANSPORT_EV_SOUND_SELECT] = {TRANSPORT_SOUND_SELECT, act_enter_select},
+        [TRANSPORT_EV_RECORD]       = {TRANSPORT_PLAYING, NULL},
+        [TRANSPORT_EV_PLAY]         = {TRANSPORT_IDLE, act_play_stop},
+        [TRANSPORT_EV_CLEAR]        = {TRANSPORT_OVERDUB, act_undo},
+        [TRANSPORT_EV_BEAT_NEXT]    = {TRANSPORT_BEAT, act_beat_next},
+        [TRANSPORT_EV_BEAT_PIN]     = {TRANSPORT_OVERDUB, act_beat_pin},
+    },
+    [TRANSPORT_BEAT] = {
+        [TRANSPORT_EV_PAD]          = STAY(TRANSPORT_BEAT),
+        [TRANSPORT_EV_SOUND_SELECT] = {TRANSPORT_SOUND_SELECT, act_enter_select},
+        [TRANSPORT_EV_RECORD]       = {TRANSPORT_RECORDING, act_record_start},
+        [TRANSPORT_EV_PLAY]         = {TRANSPORT_IDLE, act_play_stop},
+        [TRANSPORT_EV_CLEAR]        = {TRANSPORT_IDLE, act_clear},
+        [TRANSPORT_EV_BEAT_NEXT]    = {TRANSPORT_BEAT, act_beat_next},
+        [TRANSPORT_EV_BEAT_PIN]     = {TRANSPORT_BEAT, act_beat_pin},
+    },
+    // the other buttons do nothing while picking sounds
+    [TRANSPORT_SOUND_SELECT] = {
+        [TRANSPORT_EV_PAD]          = {TRANSPORT_SOUND_SELECT, act_select_pad},
+        [TRANSPORT_EV_SOUND_SELECT] = {TRANSPORT_IDLE, act_leave_select},
+        [TRANSPORT_EV_RECORD]       = STAY(TRANSPORT_SOUND_SELECT),
+        [TRANSPORT_EV_PLAY]         = STAY(TRANSPORT_SOUND_SELECT),
+        [TRANSPORT_EV_CLEAR]        = STAY(TRANSPORT_SOUND_SELECT),
+        [TRANSPORT_EV_BEAT_NEXT]    = STAY(TRANSPORT_SOUND_SELECT),
+        [TRANSPORT_EV_BEAT_PIN]     = {TRANSPORT_SOUND_SELECT, act_remember_beat_pin},
+    },
+};
+
+void transport_init(transport_t *transport, const transport_ops_t *ops, void *context,
+                    uint8_t num_sounds, uint8_t num_beats, uint8_t beat) {
+    transport->state = TRANSPORT_IDLE;
+    transport->ops = ops;
+    transport->context = context;
+    transport->num_sounds = num_sounds;
+    transport->num_beats = num_beats ? num_beats : 1;
+    for (uint8_t i = 0; i < MIXER_NUM_PADS; i++) {
+        transport->pad_sound[i] = i;
+    }
+    transport->select_pad = TRANSPORT_NO_PAD;
+    transport->select_sound = 0;
+    transport->beat = beat;
+    transport->beat_pin = TRANSPORT_NO_BEAT;
+    transport->beat_pin_done = TRANSPORT_NO_BEAT;
+
+    transport->head = 0;
+    transport->tail = 0;
+    transport->overflows = 0;
+}
+
+// head and tail work the same as in audio_queue.c
+bool transport_post(transport_t *transport, uint8_t type, uint8_t arg, uint32_t time) {
+    uint32_t head = transport->head;
+    uint32_t tail = __atomic_load_n(&transport->tail, __ATOMIC_ACQUIRE);
+
+    if (head - tail >= TRANSPORT_QUEUE_SIZE) {
+        transport->overflows++;
+        return false;  // full
+    }
+
+    transport_event_t *event = &transport->events[head & (TRANSPORT_QUEUE_SIZE - 1)];
+    event->time = time;
+    event->type = type;
+    event->arg = arg;
+    __atomic_store_n(&transport->head, head + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+bool transport_pop(transport_t *transport, transport_event_t *event) {
+    uint32_t tail = transport->tail;
+    uint32_t head = __atomic_load_n(&transport->head, __ATOMIC_ACQUIRE);
+
+    if (head == tail) {
+        return false;  // empty
+    }
+
+    *event = transport->events[tail & (TRANSPORT_QUEUE_SIZE - 1)];
+    __atomic_store_n(&transport->tail, tail + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+void transport_handle(transport_t *transport, const transport_event_t *event) {
+    if (event->type >= TRANSPORT_NUM_EVENTS) {
+        return;
+    }
+
+    const transport_transition_t *transition = &transport_table[transport->state][event->type];
+    transport_state_t next = transition->next;
+    if (transition->action) {
+        next = transition->action(transport, event, next);
+    }
+    // however we leave overdubbing, stop it
+    if (transport->state == TRANSPORT_OVERDUB && next != TRANSPORT_OVERDUB) {
+        transport->ops->overdub_stop(transport->context);
+    }
+    transport->state = next;
+}
+
+const char *transport_state_name(transport_state_t state) {
+    static const char *const names[TRANSPORT_NUM_STATES] = {
+        [TRANSPORT_IDLE] = "idle",
+        [TRANSPORT_RECORDING] = "recording",
+        [TRANSPORT_PLAYING] = "playing",
+        [TRANSPORT_OVERDUB] = "overdub",
+        [TRANSPORT_BEAT] = "beat",
+        [TRANSPORT_SOUND_SELECT] = "sound select",
+    };
+    return state < TRANSPORT_NUM_STATES ? names[state] : "?";
+}
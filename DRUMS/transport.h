@@ -0,0 +1,122 @@
+#ifndef TRANSPORT_H
+#define TRANSPORT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "mixer.h"
+
+// Which mode the drum machine is in (recording, playing a loop, picking sounds...)
+// as one state machine. Interrupts only post what happened and when, and the main
+// loop feeds the events through a state x event table. Everything the machine
+// wants done to the outside world goes through transport_ops_t, so it can be run
+// on a PC with a scripted list of events.
+// Nothing in here touches the pico hardware so it can also be built on a PC.
+
+// Must be a power of two
+#ifndef TRANSPORT_QUEUE_SIZE
+#define TRANSPORT_QUEUE_SIZE 32
+#endif
+
+#if TRANSPORT_QUEUE_SIZE & (TRANSPORT_QUEUE_SIZE - 1)
+#error "TRANSPORT_QUEUE_SIZE must be a power of two"
+#endif
+
+#define TRANSPORT_NO_BEAT 0xFF  // beat pin event arg when the arduino isnt asking for a beat
+#define TRANSPORT_NO_PAD 0xFF
+
+typedef enum {
+    TRANSPORT_IDLE,          // nothing going on, pads just play
+    TRANSPORT_RECORDING,     // recording a new loop, pad hits go into it
+    TRANSPORT_PLAYING,       // playing the recorded loop
+    TRANSPORT_OVERDUB,       // playing the loop and recording more on top of it
+    TRANSPORT_BEAT,          // playing one of the classic beats
+    TRANSPORT_SOUND_SELECT,  // pads pick their sounds instead
+    TRANSPORT_NUM_STATES
+} transport_state_t;
+
+typedef enum {
+    TRANSPORT_EV_PAD,           // arg is the pad
+    TRANSPORT_EV_SOUND_SELECT,  // the sound select button
+    TRANSPORT_EV_RECORD,        // the record button
+    TRANSPORT_EV_PLAY,          // the play button
+    TRANSPORT_EV_CLEAR,         // the clear button
+    TRANSPORT_EV_BEAT_NEXT,     // the beat select button
+    TRANSPORT_EV_BEAT_PIN,      // the arduino changed its beat pins, arg is the beat or TRANSPORT_NO_BEAT
+    TRANSPORT_NUM_EVENTS
+} transport_event_type_t;
+
+typedef struct {
+    uint32_t time;   // when it happened in us, pad hits get recorded at this time
+    uint8_t type;    // one of transport_event_type_t
+    uint8_t arg;
+} transport_event_t;
+
+// What the state machine can ask for. context is the one given to transport_init
+typedef struct {
+    void (*play_pad)(void *context, uint8_t pad);
+    void (*assign_sound)(void *context, uint8_t pad, uint8_t sound);
+    void (*record_start)(void *context, uint32_t time);  // clear the loop, time 0 of the loop is time
+    void (*record_pad)(void *context, uint8_t pad, uint32_t time);
+    uint32_t (*record_stop)(void *context, uint32_t time);  // returns how many hits got recorded
+    void (*play_start)(void *context);
+    void (*play_stop)(void *context);
+    void (*clear)(void *context);
+    void (*overdub_start)(void *context);
+    void (*overdub_pad)(void *context, uint8_t pad, uint32_t time);
+    void (*overdub_stop)(void *context);
+    void (*undo)(void *context);            // throw away the last pass overdubbed
+    void (*load_beat)(void *context, uint8_t beat);
+} transport_ops_t;
+
+typedef struct {
+    transport_state_t state;
+    const transport_ops_t *ops;
+    void *context;
+    uint8_t num_sounds;      // sounds the pads can pick from
+    uint8_t num_beats;       // classic beats there are
+    uint8_t pad_sound[MIXER_NUM_PADS];  // sound each pad has
+    uint8_t select_pad;      // pad being given a sound, TRANSPORT_NO_PAD if none yet
+    uint8_t select_sound;    // sound it has right now
+    uint8_t beat;            // classic beat last played
+    uint8_t beat_pin;        // what the arduino pins last asked for
+    uint8_t beat_pin_done;   // what we last did about them, they wait while picking sounds
+
+    // events from the interrupts, single producer single consumer like audio_queue
+    transport_event_t events[TRANSPORT_QUEUE_SIZE];
+    uint32_t head;
+    uint32_t tail;
+    uint32_t overflows;
+} transport_t;
+
+// Every pad starts on the sound with the same number, beat is the classic beat
+// the beat select button goes on from
+void transport_init(transport_t *transport, const transport_ops_t *ops, void *context,
+                    uint8_t num_sounds, uint8_t num_beats, uint8_t beat);
+
+// Interrupt side, returns false (and counts it) if the queue is full
+bool transport_post(transport_t *transport, uint8_t type, uint8_t arg, uint32_t time);
+
+// Main loop side, takes the oldest event off the queue
+bool transport_pop(transport_t *transport, transport_event_t *event);
+
+// Run one event through the table
+void transport_handle(transport_t *transport, const transport_event_t *event);
+
+// Pads normally play straight from their interrupt so they dont wait for the main
+// loop. While picking sounds the state machine plays them after changing the sound
+static inline bool transport_pad_plays_now(const transport_t *transport) {
+    return transport->state != TRANSPORT_SOUND_SELECT;
+}
+
+static inline bool transport_record_led(const transport_t *transport) {
+    return transport->state == TRANSPORT_RECORDING || transport->state == TRANSPORT_OVERDUB;
+}
+
+static inline bool transport_play_led(const transport_t *transport) {
+    return transport->state == TRANSPORT_PLAYING || transport->state == TRANSPORT_BEAT ||
+           transport->state == TRANSPORT_OVERDUB;
+}
+
+const char *transport_state_name(transport_state_t state);
+
+#endif // TRANSPORT_H
@@ -0,0 +1,66 @@
+#include <string.h>
+#include "xip_stream.h"
+#include "pico/stdlib.h"
+#include "hardware/dma.h"
+#include "hardware/structs/xip_ctrl.h"
+#include "hardware/regs/addressmap.h"
+
+static uint xip_dma_channel;
+static uint32_t xip_streamed;
+
+void xip_stream_init(void) {
+    xip_dma_channel = dma_claim_unused_channel(true);
+
+    // words come out of the stream FIFO as the flash reads finish, the DREQ paces the DMA
+    dma_channel_config c = dma_channel_get_default_config(xip_dma_channel);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_32);
+    channel_config_set_read_increment(&c, false);
+    channel_config_set_write_increment(&c, true);
+    channel_config_set_dreq(&c, DREQ_XIP_STREAM);
+    dma_channel_set_config(xip_dma_channel, &c, false);
+
+    // the FIFO is also mapped on the fast AHB port, reading it there is quicker than through the APB
+    dma_channel_set_read_addr(xip_dma_channel, (const void *)XIP_AUX_BASE, false);
+
+    xip_stats_t unused;
+    xip_stats_read(&unused, true);
+}
+
+void __time_critical_func(xip_stream_wait)(void) {
+    dma_channel_wait_for_finish_blocking(xip_dma_channel);
+}
+
+void __time_critical_func(xip_stream_fetch)(void *dst, const void *src, uint32_t bytes) {
+    uintptr_t addr = (uintptr_t)src;
+
+    // one copy at a time, the streaming engine only does one
+    xip_stream_wait();
+
+    if (addr < XIP_MAIN_BASE || addr >= XIP_NOALLOC_BASE) {
+        memcpy(dst, src, bytes);
+        return;
+    }
+
+    // anything left over from before would end up at the front of this copy
+    while (!(xip_ctrl_hw->stat & XIP_STAT_FIFO_EMPTY_BITS)) {
+        (void)xip_ctrl_hw->stream_fifo;
+    }
+
+    xip_ctrl_hw->stream_addr = addr;
+    xip_ctrl_hw->stream_ctr = bytes / 4;
+    dma_channel_transfer_to_buffer_now(xip_dma_channel, dst, bytes / 4);
+    xip_streamed += bytes;
+}
+
+void xip_stats_read(xip_stats_t *stats, bool reset) {
+    stats->hits = xip_ctrl_hw->ctr_hit;
+    stats->accesses = xip_ctrl_hw->ctr_acc;
+    stats->streamed = xip_streamed;
+
+    // writing anything clears the counters
+    if (reset) {
+        xip_ctrl_hw->ctr_hit = 0;
+        xip_ctrl_hw->ctr_acc = 0;
+        xip_streamed = 0;
+    }
+}
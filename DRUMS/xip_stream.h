@@ -0,0 +1,31 @@
+#ifndef XIP_STREAM_H
+#define XIP_STREAM_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Copies sound data out of flash with the XIP streaming engine and a DMA channel.
+// Streamed reads go straight to the flash and skip the 16 KB XIP cache, so the song
+// clips stop throwing the code and the other sounds out of it. Pico only, this is
+// what the mixer gets as its fetch function (mixer_set_fetch)
+
+typedef struct {
+    uint32_t hits;       // XIP cache hits since the last reset
+    uint32_t accesses;   // all cached XIP reads since the last reset
+    uint32_t streamed;   // bytes copied by xip_stream_fetch since the last reset
+} xip_stats_t;
+
+// Claim the DMA channel, call it once before anything is fetched
+void xip_stream_init(void);
+
+// Start copying bytes from src to dst, has to wait for the last copy first.
+// Anything not in flash just gets memcpy'd. bytes, src and dst must be multiples of 4
+void xip_stream_fetch(void *dst, const void *src, uint32_t bytes);
+
+// Wait for the last copy to finish
+void xip_stream_wait(void);
+
+// Read the XIP cache counters, reset starts them again from 0
+void xip_stats_read(xip_stats_t *stats, bool reset);
+
+#endif // XIP_STREAM_H
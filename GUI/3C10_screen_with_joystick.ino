@@ -49,6 +49,8 @@ const int MAX_DRUM_SCREENS = 4;
 int selected_drum = 0;
 int drum_screen_state = 1;
 const char* drumNames[] = {"Money beat", "Hip-Hop", "Funk"};
+// tempo each beat starts at on the pico, keep in step with DRUMS/classic_beats.h
+const int drumBpms[] = {120, 120, 120};
 
 //
 double fake_freq = 500;
@@ -431,9 +433,8 @@ void drawDrumSelectionScreen() {
   // Display additional info about the highlighted song if it's not "None"
   if(drum_screen_state < 4) {
     display.setCursor(0, yPos + (MAX_DRUM_SCREENS * lineHeight) + 4);
-    // <TODO> add an actual BPM
     display.print("BPM: ");
-    display.print(80 + (drum_screen_state * 20));
+    display.print(drumBpms[drum_screen_state - 1]);
   }
   
   // show the currently active song at the bottom
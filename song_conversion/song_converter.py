@@ -1,6 +1,38 @@
+import argparse
+import os
+import re
+import struct
+
 import numpy as np
 from scipy.io import wavfile
 
+# ima adpcm block layout, has to match DRUMS/adpcm.h
+# every block starts with the decoder state (int16 predictor, uint8 step index, uint8 unused)
+# so the firmware can start decoding at any block, then 4 bits per sample, low nibble first
+ADPCM_BLOCK_SAMPLES = 256
+ADPCM_BLOCK_HEADER = 4
+
+# sample bank image layout, has to match DRUMS/sample_bank.h
+# a header, then one index entry per sound, then the sound data. everything is
+# little endian and every sound starts on a SAMPLE_BANK_ALIGN byte boundary
+SAMPLE_BANK_MAGIC = b"DBNK"
+SAMPLE_BANK_VERSION = 1
+SAMPLE_BANK_ALIGN = 64
+SAMPLE_BANK_NAME_LEN = 16
+SAMPLE_BANK_HEADER = struct.Struct("<4sHHII16x")          # magic, version, count, index offset, image size
+SAMPLE_BANK_ENTRY = struct.Struct("<IIIHBx%ds" % SAMPLE_BANK_NAME_LEN)  # offset, length, bytes, rate, format, name
+SAMPLE_BANK_FORMATS = {"pcm16": 0, "adpcm": 1}
+
+IMA_STEP_TABLE = [
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230,
+    253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963,
+    1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
+    3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487,
+    12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+]
+IMA_INDEX_TABLE = [-1, -1, -1, -1, 2, 4, 6, 8, -1, -1, -1, -1, 2, 4, 6, 8]
+
 def load_audio(file_path):
     """load audio file and return sample rate and data"""
     sr, data = wavfile.read(file_path)
@@ -44,6 +76,164 @@ def resample_audio(data, orig_rate, target_rate):
     # extract data from old indices of data at new indices
     return np.interp(indices, orig_indices, data)
 
+def load_header(file_path):
+    """load the samples back out of a header this script made, so clips can be re-encoded without the wav"""
+    with open(file_path) as f:
+        text = f.read()
+    # everything between the braces of the array, values can be decimal or 0x hex
+    body = text[text.index("{", text.index("int16_t")) + 1:text.rindex("}")]
+    values = [int(v, 0) for v in re.findall(r"-?(?:0x[0-9a-fA-F]+|\d+)", body)]
+    # hex values are the raw 16 bit pattern, wrap them back to signed
+    return [v - 0x10000 if v > 32767 else v for v in values]
+
+def ima_adpcm_encode(data):
+    """encode int16 samples into ima adpcm blocks of ADPCM_BLOCK_SAMPLES samples"""
+    out = bytearray()
+    predictor = int(data[0]) if len(data) else 0
+    index = 0
+
+    for start in range(0, len(data), ADPCM_BLOCK_SAMPLES):
+        block = [int(v) for v in data[start:start + ADPCM_BLOCK_SAMPLES]]
+        # pad the last block with silence, the header length says where the clip really ends
+        block += [0] * (ADPCM_BLOCK_SAMPLES - len(block))
+
+        # header is the decoder state going into the block, this is the seek point
+        out += struct.pack("<hBB", predictor, index, 0)
+
+        nibbles = []
+        for sample in block:
+            step = IMA_STEP_TABLE[index]
+            diff = sample - predictor
+            code = 0
+            if diff < 0:
+                code = 8
+                diff = -diff
+            if diff >= step:
+                code |= 4
+                diff -= step
+            if diff >= step >> 1:
+                code |= 2
+                diff -= step >> 1
+            if diff >= step >> 2:
+                code |= 1
+
+            # run the decoder so we track exactly what the firmware will hear
+            delta = step >> 3
+            if code & 4:
+                delta += step
+            if code & 2:
+                delta += step >> 1
+            if code & 1:
+                delta += step >> 2
+            predictor = predictor - delta if code & 8 else predictor + delta
+            predictor = max(-32768, min(32767, predictor))
+            index = max(0, min(88, index + IMA_INDEX_TABLE[code]))
+            nibbles.append(code)
+
+        for i in range(0, ADPCM_BLOCK_SAMPLES, 2):
+            out.append(nibbles[i] | (nibbles[i + 1] << 4))
+
+    return bytes(out)
+
+def create_adpcm_header_file(data, sr, out_file, array_name="audio_data"):
+    """create c header file with the audio as ima adpcm blocks, about a quarter of the size"""
+    dur = len(data) / sr
+    encoded = ima_adpcm_encode(data)
+
+    with open(out_file, 'w') as f:
+        f.write(f"// audio data for: {array_name}\n")
+        f.write(f"// format: ima adpcm, {ADPCM_BLOCK_SAMPLES} samples per block\n")
+        f.write(f"// sample rate: {sr} hz\n")
+        f.write(f"// duration: {dur:.3f} seconds\n")
+        f.write(f"// length: {len(data)} samples, {len(encoded)} bytes\n\n")
+        f.write("#ifndef AUDIO_DATA_H_%s\n" % array_name.upper())
+        f.write("#define AUDIO_DATA_H_%s\n\n" % array_name.upper())
+        f.write("#include <stdint.h>\n")
+        f.write("#include <stddef.h>\n\n")
+        f.write("// number of samples as a constant so it can go in static tables\n")
+        f.write("#define %s_SAMPLES %d\n\n" % (array_name.upper(), len(data)))
+        f.write(f"const size_t {array_name}_length = {len(data)};\n\n")
+        f.write(f"const uint8_t {array_name}[{len(encoded)}] = {{\n    ")
+
+        vals_per_line = 16
+        for i, v in enumerate(encoded):
+            f.write(f"0x{v:02x}")
+            if i < len(encoded) - 1:
+                f.write(",")
+                if (i + 1) % vals_per_line == 0:
+                    f.write("\n    ")
+                else:
+                    f.write(" ")
+            else:
+                f.write("\n")
+
+        f.write("};\n\n")
+        f.write("#endif // AUDIO_DATA_H_%s\n" % array_name.upper())
+
+def load_samples(file_path, target_sr, max_duration):
+    """int16 samples at the firmware rate from a wav or from a header made by this script"""
+    if file_path.endswith(".h"):
+        # already converted, just the samples at the firmware rate
+        return load_header(file_path)[:int(max_duration * target_sr)]
+
+    orig_sr, audio = load_audio(file_path)
+    # shorten audio array to max_duration seconds
+    audio = audio[:int(max_duration * orig_sr)]
+
+    # sample the new audio file at that bit width
+    if target_sr != orig_sr:
+        audio = resample_audio(audio, orig_sr, target_sr)
+
+    return normalize_audio_int16(audio)
+
+def create_sample_bank(manifest_file, out_file, target_sr, max_duration):
+    """pack every sound listed in the manifest into one sample bank image for the firmware"""
+    base = os.path.dirname(os.path.abspath(manifest_file))
+    sounds = []
+    with open(manifest_file) as f:
+        for line in f:
+            line = line.split("#")[0].strip()
+            if not line:
+                continue
+            name, source, fmt = [part.strip() for part in line.split(",")]
+            if fmt not in SAMPLE_BANK_FORMATS:
+                raise ValueError(f"unknown format {fmt} for {name}")
+            if len(name) >= SAMPLE_BANK_NAME_LEN:
+                raise ValueError(f"name {name} is longer than {SAMPLE_BANK_NAME_LEN - 1} characters")
+            sounds.append((name, os.path.join(base, source), fmt))
+
+    def align(n):
+        return (n + SAMPLE_BANK_ALIGN - 1) // SAMPLE_BANK_ALIGN * SAMPLE_BANK_ALIGN
+
+    index_offset = SAMPLE_BANK_HEADER.size
+    offset = align(index_offset + SAMPLE_BANK_ENTRY.size * len(sounds))
+    entries = bytearray()
+    blobs = []
+
+    for name, source, fmt in sounds:
+        samples = load_samples(source, target_sr, max_duration)
+        if fmt == "adpcm":
+            blob = ima_adpcm_encode(samples)
+        else:
+            blob = struct.pack("<%dh" % len(samples), *[int(v) for v in samples])
+
+        entries += SAMPLE_BANK_ENTRY.pack(offset, len(samples), len(blob), target_sr,
+                                          SAMPLE_BANK_FORMATS[fmt], name.encode("ascii"))
+        blobs.append((offset, blob))
+        print(f"{name:15s} {fmt:6s} {len(samples):7d} samples {len(blob):7d} bytes at 0x{offset:06x}")
+        offset = align(offset + len(blob))
+
+    image = bytearray(offset)
+    image[0:SAMPLE_BANK_HEADER.size] = SAMPLE_BANK_HEADER.pack(SAMPLE_BANK_MAGIC, SAMPLE_BANK_VERSION,
+                                                               len(sounds), index_offset, offset)
+    image[index_offset:index_offset + len(entries)] = entries
+    for start, blob in blobs:
+        image[start:start + len(blob)] = blob
+
+    with open(out_file, "wb") as f:
+        f.write(image)
+    print(f"{len(sounds)} sounds, {len(image)} bytes")
+
 def create_header_file(data, sr, out_file, array_name="audio_data"):
     """create c header file with int16_t array of audio data"""
     dur = len(data) / sr
@@ -76,20 +266,31 @@ def create_header_file(data, sr, out_file, array_name="audio_data"):
         f.write("#endif // AUDIO_DATA_H_%s\n" % array_name.upper())
 
 if __name__ == "__main__":
-    wav_file = "blk_enter_dragon.wav"
-    header_file = "blk_enter_dragon.h"
-    array_name = "blk_enter_dragon_audio"
-    target_sr = 22050
-    max_duration = 4.0  # seconds
-
-    orig_sr, audio = load_audio(wav_file)
-    # shorten audio array to 4 seconds
-    audio = audio[:int(max_duration * orig_sr)]
+    parser = argparse.ArgumentParser(description="convert a wav (or a header made by this script) into a c header for the drums")
+    parser.add_argument("input", nargs="?", default="blk_enter_dragon.wav")
+    parser.add_argument("output", nargs="?", default="blk_enter_dragon.h")
+    parser.add_argument("--name", default="blk_enter_dragon_audio", help="name of the c array")
+    parser.add_argument("--rate", type=int, default=22050, help="sample rate the firmware plays at")
+    parser.add_argument("--max-duration", type=float, default=4.0, help="seconds to keep")
+    parser.add_argument("--adpcm", action="store_true", help="write 4 bit ima adpcm instead of int16")
+    parser.add_argument("--bank", action="store_true",
+                        help="input is a sample bank manifest (see sample_bank.txt), output is the bank image")
+    args = parser.parse_args()
 
-    # sample the new audio file at that bit width
-    if target_sr != orig_sr:
-        audio = resample_audio(audio, orig_sr, target_sr)
-        orig_sr = target_sr
+    if args.bank:
+        create_sample_bank(args.input, args.output, args.rate, args.max_duration)
+        raise SystemExit(0)
 
-    audio_int16 = normalize_audio_int16(audio)
-    create_header_file(audio_int16, orig_sr, header_file, array_name)
+    wav_file = args.input
+    header_file = args.output
+    array_name = args.name
+    target_sr = args.rate
+    max_duration = args.max_duration  # seconds
+
+    audio_int16 = load_samples(wav_file, target_sr, max_duration)
+    orig_sr = target_sr
+
+    if args.adpcm:
+        create_adpcm_header_file(audio_int16, orig_sr, header_file, array_name)
+    else:
+        create_header_file(audio_int16, orig_sr, header_file, array_name)